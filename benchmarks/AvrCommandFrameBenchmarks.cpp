@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AvrCommandFrame.hpp"
+
+namespace Bloom::Benchmarks
+{
+    using DebugToolDrivers::Protocols::CmsisDap::Edbg::ProtocolHandlerId;
+    using DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::AvrCommandFrame;
+
+    /**
+     * The maximum AVR command packet size for a 64 byte HID report (the report size of most EDBG debug tools), minus
+     * the AVR command bytes.
+     */
+    static constexpr auto MAXIMUM_COMMAND_PACKET_SIZE = std::size_t(60);
+
+    /**
+     * Fragments a frame with a payload of the given size (as with a Write Memory command), into AVR commands.
+     */
+    static void generateAvrCommands(benchmark::State& state) {
+        auto commandFrame = AvrCommandFrame<std::vector<unsigned char>>(ProtocolHandlerId::AVR8_GENERIC);
+        commandFrame.payload = std::vector<unsigned char>(static_cast<std::size_t>(state.range(0)), 0xAA);
+
+        for (auto _ : state) {
+            auto avrCommands = commandFrame.generateAvrCommands(MAXIMUM_COMMAND_PACKET_SIZE);
+            benchmark::DoNotOptimize(avrCommands.data());
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+    }
+    BENCHMARK(generateAvrCommands)->Arg(8)->Arg(256)->Arg(800);
+
+    /**
+     * For comparison - generating the raw command frame, without fragmenting it.
+     */
+    static void getRawCommandFrame(benchmark::State& state) {
+        auto commandFrame = AvrCommandFrame<std::vector<unsigned char>>(ProtocolHandlerId::AVR8_GENERIC);
+        commandFrame.payload = std::vector<unsigned char>(static_cast<std::size_t>(state.range(0)), 0xAA);
+
+        for (auto _ : state) {
+            auto rawCommandFrame = commandFrame.getRawCommandFrame();
+            benchmark::DoNotOptimize(rawCommandFrame.data());
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+    }
+    BENCHMARK(getRawCommandFrame)->Arg(8)->Arg(256)->Arg(800);
+}
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "src/Services/StringService.hpp"
+#include "src/DebugServer/Gdb/Packet.hpp"
+
+namespace Bloom::Benchmarks
+{
+    using Services::StringService;
+    using DebugServer::Gdb::Packet;
+
+    static std::vector<unsigned char> generateData(std::size_t size) {
+        auto data = std::vector<unsigned char>(size);
+
+        for (auto index = std::size_t(0); index < size; ++index) {
+            data[index] = static_cast<unsigned char>(index * 37);
+        }
+
+        return data;
+    }
+
+    static void toHex(benchmark::State& state) {
+        const auto data = generateData(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            auto hex = StringService::toHex(data);
+            benchmark::DoNotOptimize(hex.data());
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+    }
+    BENCHMARK(toHex)->Arg(4)->Arg(256)->Arg(16384);
+
+    static void byteToHex(benchmark::State& state) {
+        const auto data = generateData(static_cast<std::size_t>(state.range(0)));
+        auto output = std::vector<unsigned char>(data.size() * 2);
+
+        for (auto _ : state) {
+            for (auto index = std::size_t(0); index < data.size(); ++index) {
+                Packet::byteToHex(data[index], output.data() + (index * 2));
+            }
+
+            benchmark::DoNotOptimize(output.data());
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+    }
+    BENCHMARK(byteToHex)->Arg(256)->Arg(16384);
+
+    static void hexToData(benchmark::State& state) {
+        const auto hex = StringService::toHex(generateData(static_cast<std::size_t>(state.range(0))));
+
+        for (auto _ : state) {
+            auto data = Packet::hexToData(hex);
+            benchmark::DoNotOptimize(data.data());
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+    }
+    BENCHMARK(hexToData)->Arg(4)->Arg(256)->Arg(16384);
+
+    static void parseHex(benchmark::State& state) {
+        const auto hexValue = std::string("800100");
+
+        for (auto _ : state) {
+            auto value = Packet::parseHex(hexValue);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    BENCHMARK(parseHex);
+}
@@ -0,0 +1,375 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <span>
+#include <memory>
+#include <vector>
+#include <optional>
+#include <QApplication>
+#include <QThread>
+#include <QEventLoop>
+#include <QTimer>
+#include <QScrollBar>
+
+#include "src/Insight/InsightSignals.hpp"
+#include "src/Insight/InsightWorker/InsightWorker.hpp"
+#include "src/Insight/InsightWorker/Tasks/ConstructHexViewerTopLevelGroupItem.hpp"
+#include "src/Insight/InsightWorker/Tasks/ComputeMemoryDifferences.hpp"
+
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/HexViewerWidget/ItemGraphicsView.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/HexViewerWidget/ByteAddressContainer.hpp"
+
+#include "src/Services/TargetControllerService.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+/*
+ * Measures the hex viewer's hot paths - item hierarchy construction, value refreshes, painting, scrolling and
+ * selection - on Qt's offscreen platform, so the benchmarks can run without a display.
+ *
+ * The hex viewer is exercised via its graphics view and scene (Widgets::ItemGraphicsView and
+ * Widgets::ItemGraphicsScene), which is where all of the above takes place. The rest of the HexViewerWidget (tool
+ * bars, search, etc) isn't constructed.
+ */
+namespace Bloom::Benchmarks
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryAddressRange;
+    using Targets::TargetMemoryDescriptor;
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAccess;
+
+    using Widgets::ItemGraphicsView;
+    using Widgets::ItemGraphicsScene;
+    using Widgets::TopLevelGroupItem;
+    using Widgets::HexViewerItemIndex;
+
+    static constexpr auto START_ADDRESS = TargetMemoryAddress(0x100);
+
+    static constexpr auto VIEW_WIDTH = 1200;
+    static constexpr auto VIEW_HEIGHT = 800;
+
+    /**
+     * How long we'll wait for a queued task (or the initial item hierarchy) before giving up on it.
+     */
+    static constexpr auto WAIT_TIMEOUT_MS = 30000;
+
+    static std::vector<unsigned char> generateData(std::size_t size, std::uint32_t seed) {
+        auto data = std::vector<unsigned char>();
+        data.reserve(size);
+
+        // A (deterministic) LCG will do - we just want values that vary from byte to byte
+        auto value = seed;
+        for (auto index = std::size_t(0); index < size; ++index) {
+            value = value * 1664525 + 1013904223;
+            data.push_back(static_cast<unsigned char>(value >> 24));
+        }
+
+        return data;
+    }
+
+    /**
+     * Runs the GUI event loop until the given signal is emitted, or until WAIT_TIMEOUT_MS has elapsed.
+     *
+     * @param sender
+     * @param signal
+     */
+    template <typename SenderType, typename SignalType>
+    static void waitForSignal(const SenderType* sender, SignalType signal) {
+        auto eventLoop = QEventLoop();
+        QObject::connect(sender, signal, &eventLoop, &QEventLoop::quit);
+        QTimer::singleShot(WAIT_TIMEOUT_MS, &eventLoop, &QEventLoop::quit);
+        eventLoop.exec();
+    }
+
+    /**
+     * A hex viewer for a RAM region of the given size, shown on the offscreen platform, with a focused region over
+     * its first 256 bytes.
+     *
+     * The view holds references to the memory descriptor, data, regions and settings, so this must be constructed
+     * in place.
+     */
+    class HexViewer
+    {
+    public:
+        TargetMemoryDescriptor memoryDescriptor;
+        std::optional<SharedMemoryBuffer> data;
+        std::vector<FocusedMemoryRegion> focusedRegions;
+        std::vector<ExcludedMemoryRegion> excludedRegions;
+        Widgets::HexViewerWidgetSettings settings;
+
+        std::unique_ptr<ItemGraphicsView> view;
+        ItemGraphicsScene* scene = nullptr;
+
+        explicit HexViewer(std::size_t size)
+            : memoryDescriptor(
+                TargetMemoryType::RAM,
+                TargetMemoryAddressRange(START_ADDRESS, START_ADDRESS + static_cast<TargetMemoryAddress>(size) - 1),
+                TargetMemoryAccess(true, true, true)
+            )
+            , data(SharedMemoryBuffer(generateData(size, 1)))
+            , focusedRegions({
+                FocusedMemoryRegion(
+                    "Focused region",
+                    TargetMemoryType::RAM,
+                    TargetMemoryAddressRange(
+                        START_ADDRESS,
+                        START_ADDRESS + static_cast<TargetMemoryAddress>(std::min(size, std::size_t(256))) - 1
+                    )
+                )
+            })
+        {
+            this->view = std::make_unique<ItemGraphicsView>(
+                this->memoryDescriptor,
+                this->data,
+                this->focusedRegions,
+                this->excludedRegions,
+                this->settings,
+                nullptr
+            );
+
+            this->view->resize(VIEW_WIDTH, VIEW_HEIGHT);
+            this->view->show();
+
+            QObject::connect(
+                this->view.get(),
+                &ItemGraphicsView::sceneReady,
+                this->view.get(),
+                [this] {
+                    this->scene = this->view->getScene();
+                }
+            );
+
+            this->view->initScene();
+            waitForSignal(this->view.get(), &ItemGraphicsView::sceneReady);
+
+            if (this->scene == nullptr) {
+                std::fprintf(stderr, "Timed out waiting for the hex viewer scene\n");
+                std::exit(EXIT_FAILURE);
+            }
+
+            // Let the view settle (layout, initial paint, etc) before we start measuring
+            QCoreApplication::processEvents();
+        }
+    };
+
+    /**
+     * Constructs, positions and indexes the item hierarchy, as the ConstructHexViewerTopLevelGroupItem task does on
+     * an InsightWorker thread. Only the construction is measured - not the destruction.
+     */
+    static void constructHierarchy(benchmark::State& state) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const auto memoryDescriptor = TargetMemoryDescriptor(
+            TargetMemoryType::RAM,
+            TargetMemoryAddressRange(START_ADDRESS, START_ADDRESS + static_cast<TargetMemoryAddress>(size) - 1),
+            TargetMemoryAccess(true, true, true)
+        );
+        const auto data = std::optional<SharedMemoryBuffer>(SharedMemoryBuffer(generateData(size, 1)));
+        auto settings = Widgets::HexViewerWidgetSettings();
+        const auto hexViewerState = Widgets::HexViewerSharedState(memoryDescriptor, data, settings);
+
+        auto targetControllerService = Services::TargetControllerService();
+
+        auto topLevelGroupItem = std::unique_ptr<TopLevelGroupItem>();
+        auto itemIndex = std::unique_ptr<HexViewerItemIndex>();
+
+        for (auto _ : state) {
+            auto task = ConstructHexViewerTopLevelGroupItem(
+                {},
+                {},
+                hexViewerState,
+                QPoint(Widgets::ByteAddressContainer::WIDTH, 0),
+                VIEW_WIDTH - Widgets::ByteAddressContainer::WIDTH
+            );
+
+            QObject::connect(
+                &task,
+                &ConstructHexViewerTopLevelGroupItem::topLevelGroupItem,
+                [&topLevelGroupItem, &itemIndex] (TopLevelGroupItem* item, HexViewerItemIndex* index) {
+                    topLevelGroupItem.reset(item);
+                    itemIndex.reset(index);
+                }
+            );
+
+            task.execute(targetControllerService);
+
+            state.PauseTiming();
+            topLevelGroupItem.reset();
+            itemIndex.reset();
+            state.ResumeTiming();
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size));
+    }
+    BENCHMARK(constructHierarchy)->Arg(2048)->Arg(65536)->Arg(262144)->Unit(benchmark::kMillisecond);
+
+    /**
+     * The full rebuild, as triggered by a resize or a change to the focused regions - constructing the hierarchy on
+     * the InsightWorker and applying it to the scene.
+     */
+    static void rebuildItemHierarchy(benchmark::State& state) {
+        auto hexViewer = HexViewer(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            hexViewer.scene->rebuildItemHierarchy();
+
+            /*
+             * InsightSignals::taskProcessed() is emitted after the task's topLevelGroupItem() signal, so by the time
+             * we've received it, the new hierarchy has been applied.
+             */
+            waitForSignal(InsightSignals::instance(), &InsightSignals::taskProcessed);
+        }
+    }
+    BENCHMARK(rebuildItemHierarchy)->Arg(2048)->Arg(65536)->Arg(262144)->Unit(benchmark::kMillisecond);
+
+    /**
+     * Refreshing the values of all byte items, as happens after every memory read.
+     */
+    static void refreshValues(benchmark::State& state) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        auto hexViewer = HexViewer(size);
+
+        const auto dataA = SharedMemoryBuffer(generateData(size, 1));
+        const auto dataB = SharedMemoryBuffer(generateData(size, 2));
+        auto useDataA = false;
+
+        for (auto _ : state) {
+            hexViewer.data = useDataA ? dataA : dataB;
+            useDataA = !useDataA;
+
+            hexViewer.scene->refreshValues();
+        }
+    }
+    BENCHMARK(refreshValues)->Arg(2048)->Arg(65536)->Arg(262144)->Unit(benchmark::kMillisecond);
+
+    /**
+     * Painting the entire viewport.
+     */
+    static void paint(benchmark::State& state) {
+        auto hexViewer = HexViewer(static_cast<std::size_t>(state.range(0)));
+        auto* viewport = hexViewer.view->viewport();
+
+        for (auto _ : state) {
+            viewport->repaint();
+        }
+    }
+    BENCHMARK(paint)->Arg(2048)->Arg(65536)->Arg(262144)->Unit(benchmark::kMillisecond);
+
+    /**
+     * Scrolling by a page, and repainting - every byte item in the viewport is newly exposed. Scrolling wraps around
+     * to the top, once the bottom has been reached.
+     */
+    static void scrollRepaint(benchmark::State& state) {
+        auto hexViewer = HexViewer(static_cast<std::size_t>(state.range(0)));
+        auto* viewport = hexViewer.view->viewport();
+        auto* scrollBar = hexViewer.view->verticalScrollBar();
+
+        for (auto _ : state) {
+            const auto nextValue = scrollBar->value() + scrollBar->pageStep();
+            scrollBar->setValue(nextValue > scrollBar->maximum() ? scrollBar->minimum() : nextValue);
+            viewport->repaint();
+        }
+    }
+    BENCHMARK(scrollRepaint)->Arg(2048)->Arg(65536)->Arg(262144)->Unit(benchmark::kMillisecond);
+
+    /**
+     * Selecting all byte items (as the "Select All" context menu action does), and repainting. Clearing the selection
+     * isn't measured.
+     */
+    static void selectAll(benchmark::State& state) {
+        auto hexViewer = HexViewer(static_cast<std::size_t>(state.range(0)));
+        auto* viewport = hexViewer.view->viewport();
+
+        auto selection = Widgets::ByteSelection();
+        selection.add(hexViewer.memoryDescriptor.addressRange);
+
+        for (auto _ : state) {
+            hexViewer.scene->selectByteItems(selection);
+            viewport->repaint();
+
+            state.PauseTiming();
+            hexViewer.scene->selectByteItems(Widgets::ByteSelection());
+            viewport->repaint();
+            state.ResumeTiming();
+        }
+    }
+    BENCHMARK(selectAll)->Arg(2048)->Arg(65536)->Arg(262144)->Unit(benchmark::kMillisecond);
+
+    /**
+     * What SnapshotDiff::refreshDifferences() triggers - computing the differences between two snapshots (via the
+     * ComputeMemoryDifferences task) and refreshing the hex viewer's values.
+     *
+     * The snapshots differ by a single byte, in every 256 bytes, so every page of the buffers has to be compared.
+     */
+    static void refreshDifferences(benchmark::State& state) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        auto hexViewer = HexViewer(size);
+
+        const auto dataA = *(hexViewer.data);
+        auto dataB = dataA;
+
+        for (auto offset = std::size_t(0); offset < size; offset += 256) {
+            const auto value = static_cast<unsigned char>(~dataA[offset]);
+            dataB.write(offset, std::span(&value, 1));
+        }
+
+        auto targetControllerService = Services::TargetControllerService();
+        auto differenceCount = std::size_t(0);
+
+        for (auto _ : state) {
+            auto task = ComputeMemoryDifferences(dataA, dataB, START_ADDRESS, hexViewer.excludedRegions);
+
+            QObject::connect(
+                &task,
+                &ComputeMemoryDifferences::memoryDifferencesComputed,
+                [&differenceCount] (std::vector<TargetMemoryAddressRange>, std::size_t count) {
+                    differenceCount = count;
+                }
+            );
+
+            task.execute(targetControllerService);
+            hexViewer.scene->refreshValues();
+
+            benchmark::DoNotOptimize(differenceCount);
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size));
+    }
+    BENCHMARK(refreshDifferences)->Arg(2048)->Arg(65536)->Arg(262144)->Unit(benchmark::kMillisecond);
+}
+
+int main(int argc, char** argv) {
+    // The benchmarks must be able to run without a display (CI runners, SSH sessions, etc)
+    if (::qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        ::qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    auto application = QApplication(argc, argv);
+
+    // The hex viewer constructs its item hierarchies via InsightWorker tasks, so we need a (GENERAL lane) worker
+    auto* insightWorker = new Bloom::InsightWorker(Bloom::InsightWorkerLane::GENERAL);
+    auto* workerThread = new QThread();
+    workerThread->setObjectName("IW1");
+    insightWorker->moveToThread(workerThread);
+    QObject::connect(workerThread, &QThread::started, insightWorker, &Bloom::InsightWorker::startup);
+    QObject::connect(workerThread, &QThread::finished, insightWorker, &QObject::deleteLater);
+
+    workerThread->start();
+
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return EXIT_FAILURE;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    workerThread->quit();
+    workerThread->wait();
+    delete workerThread;
+
+    return EXIT_SUCCESS;
+}
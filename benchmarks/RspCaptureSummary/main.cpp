@@ -0,0 +1,321 @@
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <map>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+
+#include "src/DebugServer/Gdb/PacketCaptureFormat.hpp"
+
+using Bloom::DebugServer::Gdb::PacketDirection;
+
+namespace
+{
+    struct CaptureRecord
+    {
+        std::uint64_t timestamp = 0;
+        PacketDirection direction = PacketDirection::FROM_CLIENT;
+        std::string data;
+    };
+
+    struct PendingRequest
+    {
+        std::uint64_t timestamp = 0;
+        std::string type;
+    };
+
+    struct Gap
+    {
+        std::uint64_t startTimestamp = 0;
+        std::uint64_t duration = 0;
+        std::string precedingType;
+        std::string followingType;
+    };
+
+    void printUsage() {
+        std::cout << "Usage: bloom-rsp-capture-summary [options] <capture file>\n\n"
+            << "Summarises a GDB packet capture (recorded by Bloom via the 'packetCaptureFile' debug server\n"
+            << "parameter). Reports the response latency (request arrival to response written) for each packet\n"
+            << "type, and the longest gaps between a response and the client's next request.\n\n"
+            << "Options:\n"
+            << "  --gaps=<n>    The number of gaps to report (default: 10)\n";
+    }
+
+    std::uint64_t readUnsigned(std::string_view data, std::size_t size) {
+        auto value = std::uint64_t(0);
+        for (auto byteIndex = std::size_t(0); byteIndex < size; ++byteIndex) {
+            value |= static_cast<std::uint64_t>(static_cast<unsigned char>(data[byteIndex])) << (byteIndex * 8);
+        }
+
+        return value;
+    }
+
+    std::vector<CaptureRecord> readCapture(const std::string& filePath) {
+        auto file = std::ifstream(filePath, std::ios::in | std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open capture file \"" + filePath + "\"");
+        }
+
+        const auto contents = std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        const auto magic = Bloom::DebugServer::Gdb::PACKET_CAPTURE_MAGIC;
+
+        if (
+            contents.size() < Bloom::DebugServer::Gdb::PACKET_CAPTURE_FILE_HEADER_SIZE
+            || !std::equal(magic.begin(), magic.end(), contents.begin())
+        ) {
+            throw std::runtime_error("\"" + filePath + "\" is not a Bloom GDB packet capture");
+        }
+
+        const auto version = readUnsigned(std::string_view(contents).substr(magic.size()), 4);
+        if (version != Bloom::DebugServer::Gdb::PACKET_CAPTURE_VERSION) {
+            throw std::runtime_error("Unsupported capture format version (" + std::to_string(version) + ")");
+        }
+
+        auto records = std::vector<CaptureRecord>();
+        auto position = Bloom::DebugServer::Gdb::PACKET_CAPTURE_FILE_HEADER_SIZE;
+
+        while ((contents.size() - position) >= Bloom::DebugServer::Gdb::PACKET_CAPTURE_RECORD_HEADER_SIZE) {
+            const auto header = std::string_view(contents).substr(position);
+            const auto size = static_cast<std::size_t>(readUnsigned(header.substr(9), 4));
+
+            position += Bloom::DebugServer::Gdb::PACKET_CAPTURE_RECORD_HEADER_SIZE;
+            if ((contents.size() - position) < size) {
+                // The capture was cut short (Bloom was killed mid-write) - we just ignore the partial record
+                break;
+            }
+
+            records.emplace_back(CaptureRecord{
+                .timestamp = readUnsigned(header, 8),
+                .direction = static_cast<PacketDirection>(header[8]),
+                .data = contents.substr(position, size),
+            });
+
+            position += size;
+        }
+
+        return records;
+    }
+
+    /**
+     * Packets are grouped by their command - the first character, or, for the 'q', 'Q' and 'v' packets, the name
+     * (e.g. "qXfer" or "vCont").
+     */
+    std::string packetType(const std::string& packet) {
+        if (packet.size() == 1 && packet[0] == 0x03) {
+            return "interrupt";
+        }
+
+        const auto dataStart = packet.find('$');
+        if (dataStart == std::string::npos || (dataStart + 1) >= packet.size() || packet[dataStart + 1] == '#') {
+            return "(empty)";
+        }
+
+        const auto data = std::string_view(packet).substr(dataStart + 1);
+        if (data[0] == 'q' || data[0] == 'Q' || data[0] == 'v') {
+            return std::string(data.substr(0, data.find_first_of(":;,?#")));
+        }
+
+        return std::string(1, data[0]);
+    }
+
+    /**
+     * Console output ('O' packets) and notifications can be sent at any time - they're not responses.
+     */
+    bool isResponse(const std::string& packet) {
+        if (packet.starts_with('%')) {
+            return false;
+        }
+
+        return !(packet.starts_with("$O") && !packet.starts_with("$OK#"));
+    }
+
+    double toMicroseconds(std::uint64_t nanoseconds) {
+        return static_cast<double>(nanoseconds) / 1000.0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    auto captureFilePath = std::optional<std::string>();
+    auto gapCount = std::size_t(10);
+
+    try {
+        for (auto argumentIndex = 1; argumentIndex < argc; ++argumentIndex) {
+            const auto argument = std::string(argv[argumentIndex]);
+
+            if (argument == "--help" || argument == "-h") {
+                printUsage();
+                return EXIT_SUCCESS;
+
+            } else if (argument.starts_with("--gaps=")) {
+                gapCount = std::stoul(argument.substr(7));
+
+            } else if (!argument.starts_with("--") && !captureFilePath.has_value()) {
+                captureFilePath = argument;
+
+            } else {
+                throw std::runtime_error("Unknown option \"" + argument + "\" - see --help");
+            }
+        }
+
+        if (!captureFilePath.has_value()) {
+            printUsage();
+            return EXIT_FAILURE;
+        }
+
+        const auto records = readCapture(*captureFilePath);
+        if (records.empty()) {
+            std::cout << "The capture holds no packets\n";
+            return EXIT_SUCCESS;
+        }
+
+        auto latenciesByType = std::map<std::string, std::vector<std::uint64_t>>();
+        auto gaps = std::vector<Gap>();
+
+        auto pendingRequests = std::deque<PendingRequest>();
+        auto pendingInterrupt = std::optional<std::uint64_t>();
+        auto lastResponse = std::optional<PendingRequest>();
+        auto clientPacketCount = std::size_t(0);
+        auto unansweredResponseCount = std::size_t(0);
+
+        for (const auto& record : records) {
+            if (record.direction == PacketDirection::FROM_CLIENT) {
+                ++clientPacketCount;
+
+                const auto type = packetType(record.data);
+
+                if (lastResponse.has_value() && pendingRequests.empty()) {
+                    gaps.emplace_back(Gap{
+                        .startTimestamp = lastResponse->timestamp,
+                        .duration = record.timestamp - lastResponse->timestamp,
+                        .precedingType = lastResponse->type,
+                        .followingType = type,
+                    });
+                }
+
+                if (type == "interrupt") {
+                    // The stop reply is the response to both the interrupt and the pending continue/step request
+                    pendingInterrupt = record.timestamp;
+                    continue;
+                }
+
+                pendingRequests.emplace_back(PendingRequest{.timestamp = record.timestamp, .type = type});
+                continue;
+            }
+
+            if (!isResponse(record.data)) {
+                continue;
+            }
+
+            if (pendingInterrupt.has_value()) {
+                latenciesByType["interrupt"].push_back(record.timestamp - *pendingInterrupt);
+                pendingInterrupt = std::nullopt;
+            }
+
+            if (pendingRequests.empty()) {
+                // A stop reply for a request that preceded the capture, or an asynchronous response
+                ++unansweredResponseCount;
+                continue;
+            }
+
+            const auto request = pendingRequests.front();
+            pendingRequests.pop_front();
+
+            latenciesByType[request.type].push_back(record.timestamp - request.timestamp);
+            lastResponse = PendingRequest{.timestamp = record.timestamp, .type = request.type};
+        }
+
+        const auto captureDuration = records.back().timestamp - records.front().timestamp;
+        auto totalServerTime = std::uint64_t(0);
+
+        std::cout << "Capture: " << records.size() << " packets (" << clientPacketCount << " from the client, "
+            << (records.size() - clientPacketCount) << " to the client), over " << std::fixed
+            << std::setprecision(3) << (static_cast<double>(captureDuration) / 1e9) << "s\n\n";
+
+        // Ordered by total time, so that the packet types that matter most come first
+        auto types = std::vector<std::pair<std::string, std::vector<std::uint64_t>*>>();
+        for (auto& [type, latencies] : latenciesByType) {
+            std::sort(latencies.begin(), latencies.end());
+            types.emplace_back(type, &latencies);
+        }
+
+        const auto sum = [] (const std::vector<std::uint64_t>& values) {
+            auto total = std::uint64_t(0);
+            for (const auto value : values) {
+                total += value;
+            }
+
+            return total;
+        };
+
+        std::sort(types.begin(), types.end(), [&sum] (const auto& a, const auto& b) {
+            return sum(*a.second) > sum(*b.second);
+        });
+
+        std::cout << std::left << std::setw(20) << "Packet type" << std::right << std::setw(8) << "Count"
+            << std::setw(12) << "Min (us)" << std::setw(12) << "Mean (us)" << std::setw(12) << "p50 (us)"
+            << std::setw(12) << "p99 (us)" << std::setw(12) << "Max (us)" << std::setw(12) << "Total (ms)" << "\n";
+
+        for (const auto& [type, latencies] : types) {
+            const auto total = sum(*latencies);
+            const auto percentile = [&latencies] (double fraction) {
+                const auto index = static_cast<std::size_t>(fraction * static_cast<double>(latencies->size() - 1));
+                return latencies->at(index);
+            };
+
+            // Continue and step latencies include the time the target spent running, so they're not server time
+            if (type != "c" && type != "s" && type != "vCont" && type != "interrupt") {
+                totalServerTime += total;
+            }
+
+            std::cout << std::left << std::setw(20) << type << std::right << std::setw(8) << latencies->size()
+                << std::setprecision(1)
+                << std::setw(12) << toMicroseconds(latencies->front())
+                << std::setw(12) << (toMicroseconds(total) / static_cast<double>(latencies->size()))
+                << std::setw(12) << toMicroseconds(percentile(0.5))
+                << std::setw(12) << toMicroseconds(percentile(0.99))
+                << std::setw(12) << toMicroseconds(latencies->back())
+                << std::setprecision(3) << std::setw(12) << (toMicroseconds(total) / 1000.0) << "\n";
+        }
+
+        auto totalClientTime = std::uint64_t(0);
+        for (const auto& gap : gaps) {
+            totalClientTime += gap.duration;
+        }
+
+        std::cout << "\nTime spent servicing requests (excluding target execution): " << std::setprecision(3)
+            << (toMicroseconds(totalServerTime) / 1000.0) << "ms\n"
+            << "Time spent waiting for the client's next request: " << (toMicroseconds(totalClientTime) / 1000.0)
+            << "ms\n";
+
+        if (unansweredResponseCount > 0) {
+            std::cout << unansweredResponseCount << " responses could not be matched to a request\n";
+        }
+
+        std::sort(gaps.begin(), gaps.end(), [] (const Gap& a, const Gap& b) {
+            return a.duration > b.duration;
+        });
+
+        if (!gaps.empty() && gapCount > 0) {
+            std::cout << "\nLongest gaps between a response and the next request:\n";
+
+            for (const auto& gap : std::vector<Gap>(gaps.begin(), gaps.begin() + std::min(gapCount, gaps.size()))) {
+                std::cout << "  at " << std::setprecision(6) << (static_cast<double>(gap.startTimestamp) / 1e9)
+                    << "s: " << std::setprecision(3) << (toMicroseconds(gap.duration) / 1000.0) << "ms, after "
+                    << gap.precedingType << ", before " << gap.followingType << "\n";
+            }
+        }
+
+    } catch (const std::exception& exception) {
+        std::cerr << "Error: " << exception.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "src/DebugServer/Gdb/RawPacketParser.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+namespace Bloom::Benchmarks
+{
+    using DebugServer::Gdb::RawPacket;
+    using DebugServer::Gdb::RawPacketParser;
+    using DebugServer::Gdb::ResponsePackets::ResponsePacket;
+
+    /**
+     * Binary data with a fair share of bytes that must be escaped ('#', '$', '}' and '*'), as found in program
+     * memory.
+     */
+    static std::vector<unsigned char> generateBinaryData(std::size_t size) {
+        auto data = std::vector<unsigned char>(size);
+
+        for (auto index = std::size_t(0); index < size; ++index) {
+            data[index] = static_cast<unsigned char>((index * 37) ^ (index >> 3));
+        }
+
+        return data;
+    }
+
+    /**
+     * Frames the given packet data, as the GDB client would - escaping the data and appending the checksum.
+     */
+    static RawPacket framePacket(const std::string& prefix, const std::vector<unsigned char>& binaryData) {
+        auto packet = RawPacket({'$'});
+        packet.insert(packet.end(), prefix.begin(), prefix.end());
+
+        for (const auto byte : binaryData) {
+            if (byte == '#' || byte == '$' || byte == '}' || byte == '*') {
+                packet.push_back('}');
+                packet.push_back(byte ^ 0x20);
+                continue;
+            }
+
+            packet.push_back(byte);
+        }
+
+        auto checksum = std::uint8_t(0);
+        for (auto byteIt = packet.begin() + 1; byteIt != packet.end(); ++byteIt) {
+            checksum = static_cast<std::uint8_t>(checksum + *byteIt);
+        }
+
+        static constexpr auto HEX_DIGITS = std::string_view("0123456789abcdef");
+        packet.push_back('#');
+        packet.push_back(static_cast<unsigned char>(HEX_DIGITS[checksum >> 4]));
+        packet.push_back(static_cast<unsigned char>(HEX_DIGITS[checksum & 0x0F]));
+
+        return packet;
+    }
+
+    /**
+     * Parses the given packet, in reads of up to readSize bytes, the way Connection::readRawPackets() does.
+     */
+    static void benchmarkParse(benchmark::State& state, const RawPacket& packet, std::size_t readSize) {
+        auto parser = RawPacketParser(packet.size() * 2);
+
+        for (auto _ : state) {
+            for (auto offset = std::size_t(0); offset < packet.size(); offset += readSize) {
+                auto result = parser.parse(packet.data() + offset, std::min(readSize, packet.size() - offset));
+
+                for (auto& parsedPacket : result.packets) {
+                    benchmark::DoNotOptimize(parsedPacket.data());
+                    parser.recycleBuffer(std::move(parsedPacket));
+                }
+            }
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * packet.size()));
+    }
+
+    static void parseBinaryWritePacket(benchmark::State& state) {
+        const auto dataSize = static_cast<std::size_t>(state.range(0));
+        const auto packet = framePacket(
+            "X800100," + std::to_string(dataSize) + ":",
+            generateBinaryData(dataSize)
+        );
+
+        benchmarkParse(state, packet, 4096);
+    }
+    BENCHMARK(parseBinaryWritePacket)->Arg(256)->Arg(4096)->Arg(16384);
+
+    static void parseFlashWritePacket(benchmark::State& state) {
+        const auto dataSize = static_cast<std::size_t>(state.range(0));
+        const auto packet = framePacket("vFlashWrite:0:", generateBinaryData(dataSize));
+
+        benchmarkParse(state, packet, 4096);
+    }
+    BENCHMARK(parseFlashWritePacket)->Arg(4096)->Arg(16384);
+
+    /**
+     * The client may deliver a packet in small pieces - this measures the cost of resuming the parser.
+     */
+    static void parseFlashWritePacketInSmallReads(benchmark::State& state) {
+        const auto packet = framePacket("vFlashWrite:0:", generateBinaryData(16384));
+
+        benchmarkParse(state, packet, static_cast<std::size_t>(state.range(0)));
+    }
+    BENCHMARK(parseFlashWritePacketInSmallReads)->Arg(64)->Arg(536);
+
+    static void responsePacketToRawPacket(benchmark::State& state) {
+        const auto packet = ResponsePacket(generateBinaryData(static_cast<std::size_t>(state.range(0))));
+
+        for (auto _ : state) {
+            auto rawPacket = packet.toRawPacket();
+            benchmark::DoNotOptimize(rawPacket.data());
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+    }
+    BENCHMARK(responsePacketToRawPacket)->Arg(64)->Arg(1024)->Arg(16384);
+}
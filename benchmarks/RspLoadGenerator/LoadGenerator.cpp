@@ -0,0 +1,292 @@
+#include "LoadGenerator.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <fstream>
+#include <QString>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::Benchmarks::RspLoadGenerator
+{
+    using Exceptions::Exception;
+
+    LoadGenerator::LoadGenerator(const LoadGeneratorConfig& config)
+        : config(config)
+        , client(config.address, config.port, config.timeout)
+    {}
+
+    QJsonObject LoadGenerator::run() {
+        // The same opening exchange as GDB, minus the queries that have no bearing on the measurements
+        this->client.exchange("qSupported:multiprocess+;swbreak+;hwbreak+;qRelocInsn+;vContSupported+");
+
+        const auto noAckMode = this->config.noAckMode && this->client.startNoAckMode();
+        this->client.exchange("?");
+
+        auto script = std::vector<std::string>();
+        if (this->config.scriptFilePath.has_value()) {
+            script = LoadGenerator::loadScript(*this->config.scriptFilePath);
+        }
+
+        auto results = QJsonArray();
+
+        for (const auto& scenario : this->config.scenarios) {
+            if (scenario == "stop-storm") {
+                results.append(this->measure(scenario, [this] { this->runStopStorm(); }));
+                continue;
+            }
+
+            if (scenario == "bulk-read") {
+                results.append(this->measure(scenario, [this] { this->runBulkRead(); }));
+                continue;
+            }
+
+            if (scenario == "step") {
+                results.append(this->measure(scenario, [this] { this->runStep(); }));
+                continue;
+            }
+
+            if (scenario == "flash-load") {
+                results.append(this->measure(scenario, [this] { this->runFlashLoad(); }));
+                continue;
+            }
+
+            if (scenario == "script") {
+                if (script.empty()) {
+                    throw Exception("The \"script\" scenario requires a non-empty script file (--script=<file>)");
+                }
+
+                results.append(this->measure(scenario, [this, &script] { this->runScript(script); }));
+                continue;
+            }
+
+            throw Exception("Unknown scenario \"" + scenario + "\"");
+        }
+
+        // End the session as GDB would
+        this->client.exchange("D");
+
+        auto output = QJsonObject();
+        output.insert(
+            "server",
+            QString::fromStdString(this->config.address + ":" + std::to_string(this->config.port))
+        );
+        output.insert("noAckMode", noAckMode);
+        output.insert("iterations", this->config.iterations);
+        output.insert("results", results);
+
+        return output;
+    }
+
+    void LoadGenerator::runStopStorm() {
+        this->exchange("g");
+        this->exchange("p" + LoadGenerator::toHex(LoadGenerator::STACK_POINTER_GDB_REGISTER_NUMBER));
+
+        for (auto readIndex = 0; readIndex < this->config.stopStormMemoryReads; ++readIndex) {
+            const auto address = this->config.ramAddress
+                + static_cast<std::uint32_t>(readIndex) * this->config.stopStormReadSize;
+
+            this->exchange(
+                "m" + LoadGenerator::toHex(address) + "," + LoadGenerator::toHex(this->config.stopStormReadSize)
+            );
+        }
+
+        this->exchange("p" + LoadGenerator::toHex(LoadGenerator::PROGRAM_COUNTER_GDB_REGISTER_NUMBER));
+    }
+
+    void LoadGenerator::runBulkRead() {
+        const auto endAddress = this->config.bulkReadAddress + this->config.bulkReadSize;
+
+        for (
+            auto address = this->config.bulkReadAddress;
+            address < endAddress;
+            address += this->config.bulkReadChunkSize
+        ) {
+            const auto size = std::min(this->config.bulkReadChunkSize, endAddress - address);
+            const auto response = this->exchange(
+                "m" + LoadGenerator::toHex(address) + "," + LoadGenerator::toHex(size)
+            );
+
+            if (response.size() != static_cast<std::size_t>(size) * 2) {
+                throw Exception(
+                    "Unexpected response size for memory read at 0x" + LoadGenerator::toHex(address) + " ("
+                        + std::to_string(response.size()) + " characters)"
+                );
+            }
+        }
+    }
+
+    void LoadGenerator::runStep() {
+        const auto response = this->exchange("s");
+
+        if (response.empty() || (response[0] != 'T' && response[0] != 'S')) {
+            throw Exception("Unexpected response to step packet: \"" + response + "\"");
+        }
+    }
+
+    void LoadGenerator::runFlashLoad() {
+        const auto complement = (this->flashLoadCount++ % 2) == 1;
+
+        this->exchange(
+            "vFlashErase:" + LoadGenerator::toHex(this->config.flashLoadAddress) + ","
+                + LoadGenerator::toHex(this->config.flashLoadSize)
+        );
+
+        const auto endAddress = this->config.flashLoadAddress + this->config.flashLoadSize;
+        for (
+            auto address = this->config.flashLoadAddress;
+            address < endAddress;
+            address += this->config.flashLoadChunkSize
+        ) {
+            const auto size = std::min(this->config.flashLoadChunkSize, endAddress - address);
+            auto packet = "vFlashWrite:" + LoadGenerator::toHex(address) + ":";
+            packet.reserve(packet.size() + size);
+
+            for (auto offset = std::uint32_t(0); offset < size; ++offset) {
+                // A fair share of these bytes will need escaping ('#', '$', '}' and '*'), as with real program images
+                const auto index = address + offset;
+                const auto byte = static_cast<unsigned char>((index * 37) ^ (index >> 3));
+                packet.push_back(static_cast<char>(complement ? ~byte : byte));
+            }
+
+            this->exchange(packet);
+        }
+
+        this->exchange("vFlashDone");
+    }
+
+    void LoadGenerator::runScript(const std::vector<std::string>& packets) {
+        for (const auto& packet : packets) {
+            this->exchange(packet);
+        }
+    }
+
+    std::string LoadGenerator::exchange(const std::string& packet) {
+        const auto startTime = std::chrono::steady_clock::now();
+        auto response = this->client.exchange(packet);
+        this->packetSamples.push_back(std::chrono::steady_clock::now() - startTime);
+
+        if (response.size() == 3 && response[0] == 'E') {
+            throw Exception(
+                "Server returned an error (" + response + ") in response to \"" + packet.substr(0, 32) + "\""
+            );
+        }
+
+        return response;
+    }
+
+    QJsonObject LoadGenerator::measure(const std::string& name, const std::function<void()>& iteration) {
+        iteration();
+        this->packetSamples.clear();
+
+        auto iterationSamples = Samples();
+        iterationSamples.reserve(static_cast<std::size_t>(this->config.iterations));
+
+        const auto bytesSentBefore = this->client.getBytesSent();
+        const auto bytesReceivedBefore = this->client.getBytesReceived();
+        const auto startTime = std::chrono::steady_clock::now();
+
+        for (auto iterationIndex = 0; iterationIndex < this->config.iterations; ++iterationIndex) {
+            const auto iterationStartTime = std::chrono::steady_clock::now();
+            iteration();
+            iterationSamples.push_back(std::chrono::steady_clock::now() - iterationStartTime);
+        }
+
+        const auto durationSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime)
+            .count();
+
+        auto result = QJsonObject();
+        result.insert("name", QString::fromStdString(name));
+        result.insert("packets", static_cast<qint64>(this->packetSamples.size()));
+        result.insert("durationMs", durationSeconds * 1000);
+        result.insert(
+            "packetsPerSecond",
+            durationSeconds > 0 ? static_cast<double>(this->packetSamples.size()) / durationSeconds : 0.0
+        );
+        result.insert("bytesSent", static_cast<qint64>(this->client.getBytesSent() - bytesSentBefore));
+        result.insert("bytesReceived", static_cast<qint64>(this->client.getBytesReceived() - bytesReceivedBefore));
+        result.insert("packetLatency", LoadGenerator::latencyStatistics(this->packetSamples));
+        result.insert("iterationLatency", LoadGenerator::latencyStatistics(iterationSamples));
+
+        this->packetSamples.clear();
+        return result;
+    }
+
+    std::vector<std::string> LoadGenerator::loadScript(const std::string& filePath) {
+        auto file = std::ifstream(filePath);
+        if (!file.is_open()) {
+            throw Exception("Failed to open script file \"" + filePath + "\"");
+        }
+
+        auto packets = std::vector<std::string>();
+        auto line = std::string();
+
+        while (std::getline(file, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+
+            // Continue packets would leave the target running, with nothing to stop it. Steps are fine.
+            if (line[0] == 'c' || line.starts_with("vCont;c")) {
+                throw Exception("Script \"" + filePath + "\" contains a continue packet (\"" + line + "\")");
+            }
+
+            packets.push_back(line);
+        }
+
+        return packets;
+    }
+
+    QJsonObject LoadGenerator::latencyStatistics(const Samples& samples) {
+        auto output = QJsonObject();
+        if (samples.empty()) {
+            return output;
+        }
+
+        auto sortedSamplesUs = std::vector<double>();
+        sortedSamplesUs.reserve(samples.size());
+
+        for (const auto& sample : samples) {
+            sortedSamplesUs.push_back(std::chrono::duration<double, std::micro>(sample).count());
+        }
+
+        std::sort(sortedSamplesUs.begin(), sortedSamplesUs.end());
+
+        const auto percentile = [&sortedSamplesUs] (double percentile) {
+            // Nearest-rank, as with the hardware benchmark (see HardwareBenchmark::addResult())
+            const auto rank = static_cast<std::size_t>(
+                std::ceil(percentile / 100 * static_cast<double>(sortedSamplesUs.size()))
+            );
+            return sortedSamplesUs[std::clamp(rank, std::size_t(1), sortedSamplesUs.size()) - 1];
+        };
+
+        output.insert(
+            "meanUs",
+            std::accumulate(sortedSamplesUs.begin(), sortedSamplesUs.end(), 0.0)
+                / static_cast<double>(sortedSamplesUs.size())
+        );
+        output.insert("p50Us", percentile(50));
+        output.insert("p90Us", percentile(90));
+        output.insert("p99Us", percentile(99));
+        output.insert("maxUs", sortedSamplesUs.back());
+
+        return output;
+    }
+
+    std::string LoadGenerator::toHex(std::uint32_t value) {
+        static constexpr auto HEX_DIGITS = std::string_view("0123456789abcdef");
+
+        auto output = std::string();
+        do {
+            output.insert(output.begin(), HEX_DIGITS[value & 0x0F]);
+            value >>= 4;
+        } while (value > 0);
+
+        return output;
+    }
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <optional>
+#include <functional>
+#include <QJsonObject>
+#include <QJsonArray>
+
+#include "RspClient.hpp"
+
+namespace Bloom::Benchmarks::RspLoadGenerator
+{
+    /**
+     * Parameters for the load generator. All addresses are in GDB's address space (RAM at 0x800000, program memory
+     * at 0x000000).
+     *
+     * The defaults suit an ATmega328P (as simulated by the mock debug tool, or otherwise).
+     */
+    struct LoadGeneratorConfig
+    {
+        std::string address = "127.0.0.1";
+        std::uint16_t port = 1442;
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(10000);
+
+        /**
+         * Whether to negotiate no-ack mode, as GDB does by default.
+         */
+        bool noAckMode = true;
+
+        int iterations = 100;
+
+        /**
+         * The scenarios to run, in order. See LoadGenerator::run() for the available scenarios.
+         */
+        std::vector<std::string> scenarios = {"stop-storm", "bulk-read", "step", "flash-load"};
+
+        /**
+         * Stop storm parameters - the number and size of memory reads that accompany the register reads, following
+         * each stop. IDEs typically read the stack, the locals being watched and a window of program memory around
+         * the program counter.
+         */
+        int stopStormMemoryReads = 4;
+        std::uint32_t stopStormReadSize = 32;
+        std::uint32_t ramAddress = 0x800100;
+
+        /**
+         * Bulk read parameters - a memory dump in chunks, as GDB performs for "dump memory" and the IDE memory view.
+         */
+        std::uint32_t bulkReadAddress = 0x000000;
+        std::uint32_t bulkReadSize = 8192;
+        std::uint32_t bulkReadChunkSize = 1024;
+
+        /**
+         * Flash load parameters - GDB's "load" command, split into vFlashWrite packets of the given size.
+         */
+        std::uint32_t flashLoadAddress = 0x003000;
+        std::uint32_t flashLoadSize = 4096;
+        std::uint32_t flashLoadChunkSize = 1024;
+
+        /**
+         * A recorded RSP session to replay, for the "script" scenario. One packet per line, without the framing
+         * (as found in the output of GDB's "set debug remote 1", for example). Blank lines and lines starting with
+         * '#' are ignored.
+         */
+        std::optional<std::string> scriptFilePath;
+    };
+
+    /**
+     * The LoadGenerator drives Bloom's GDB server with recorded or parameterised IDE traffic, and reports the
+     * throughput (packets per second) and latency percentiles for each traffic pattern.
+     *
+     * It connects like any other GDB client, so it must be pointed at a running Bloom instance. When that instance
+     * is configured with the mock debug tool (see MockDebugTool), the results reflect Bloom's host-side overhead alone,
+     * which allows for reproducible measurements of server-side changes without any hardware.
+     */
+    class LoadGenerator
+    {
+    public:
+        explicit LoadGenerator(const LoadGeneratorConfig& config);
+
+        /**
+         * Runs the configured scenarios.
+         *
+         * Available scenarios:
+         *  - "stop-storm": the requests that follow every stop - "g", several "m" reads and a "p" read of the PC.
+         *  - "bulk-read": a large memory dump in "m" chunks.
+         *  - "step": rapid single steps ("s"), each waiting for the stop reply.
+         *  - "flash-load": "vFlashErase", "vFlashWrite" chunks and "vFlashDone". Alternates between a data pattern and
+         *    its complement, so that every load actually changes the program memory.
+         *  - "script": a replay of the recorded session in LoadGeneratorConfig::scriptFilePath.
+         *
+         * @return
+         *  The results, as JSON.
+         */
+        QJsonObject run();
+
+    private:
+        using Samples = std::vector<std::chrono::steady_clock::duration>;
+
+        /**
+         * The AVR GDB register numbers for the stack pointer and program counter (see AvrGdb::TargetDescriptor).
+         */
+        static constexpr auto STACK_POINTER_GDB_REGISTER_NUMBER = 33;
+        static constexpr auto PROGRAM_COUNTER_GDB_REGISTER_NUMBER = 34;
+
+        LoadGeneratorConfig config;
+        RspClient client;
+
+        /**
+         * The per-packet latencies of the scenario that is currently being run. Populated by
+         * LoadGenerator::exchange().
+         */
+        Samples packetSamples;
+
+        std::uint64_t flashLoadCount = 0;
+
+        void runStopStorm();
+        void runBulkRead();
+        void runStep();
+        void runFlashLoad();
+        void runScript(const std::vector<std::string>& packets);
+
+        /**
+         * Sends the given packet, waits for the response and records the round trip in this->packetSamples.
+         *
+         * @param packet
+         *
+         * @return
+         *  The response.
+         */
+        std::string exchange(const std::string& packet);
+
+        /**
+         * Runs one scenario iteration this->config.iterations times (after a single warm-up iteration, which is
+         * not measured), and produces the results.
+         *
+         * @param name
+         * @param iteration
+         *
+         * @return
+         */
+        QJsonObject measure(const std::string& name, const std::function<void()>& iteration);
+
+        static std::vector<std::string> loadScript(const std::string& filePath);
+
+        static QJsonObject latencyStatistics(const Samples& samples);
+
+        static std::string toHex(std::uint32_t value);
+    };
+}
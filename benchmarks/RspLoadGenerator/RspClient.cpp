@@ -0,0 +1,199 @@
+#include "RspClient.hpp"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <string_view>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::Benchmarks::RspLoadGenerator
+{
+    using Exceptions::Exception;
+
+    RspClient::RspClient(const std::string& address, std::uint16_t port, std::chrono::milliseconds timeout)
+        : timeout(timeout)
+    {
+        auto socketAddress = sockaddr_in{};
+        socketAddress.sin_family = AF_INET;
+        socketAddress.sin_port = htons(port);
+
+        if (::inet_pton(AF_INET, address.c_str(), &(socketAddress.sin_addr)) != 1) {
+            throw Exception("Invalid IP address: \"" + address + "\"");
+        }
+
+        this->socketFileDescriptor = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (this->socketFileDescriptor < 0) {
+            throw Exception("Failed to create socket");
+        }
+
+        // GDB disables Nagle's algorithm too - without this, every exchange would incur the delayed ACK penalty
+        const auto enableNoDelaySocketOption = 1;
+        ::setsockopt(
+            this->socketFileDescriptor,
+            IPPROTO_TCP,
+            TCP_NODELAY,
+            &enableNoDelaySocketOption,
+            sizeof(enableNoDelaySocketOption)
+        );
+
+        if (::connect(
+                this->socketFileDescriptor,
+                reinterpret_cast<const sockaddr*>(&socketAddress),
+                sizeof(socketAddress)
+            ) != 0
+        ) {
+            ::close(this->socketFileDescriptor);
+            throw Exception(
+                "Failed to connect to " + address + ":" + std::to_string(port) + " - is Bloom running?"
+            );
+        }
+    }
+
+    RspClient::~RspClient() {
+        if (this->socketFileDescriptor >= 0) {
+            ::close(this->socketFileDescriptor);
+        }
+    }
+
+    void RspClient::sendPacket(const std::string& data) {
+        auto packet = std::string("$");
+        packet.reserve(data.size() + 4);
+
+        auto checksum = std::uint8_t(0);
+        for (const auto byte : data) {
+            if (byte == '#' || byte == '$' || byte == '}' || byte == '*') {
+                const auto escapedByte = static_cast<char>(byte ^ 0x20);
+                packet.push_back('}');
+                packet.push_back(escapedByte);
+                checksum = static_cast<std::uint8_t>(checksum + '}' + escapedByte);
+                continue;
+            }
+
+            packet.push_back(byte);
+            checksum = static_cast<std::uint8_t>(checksum + byte);
+        }
+
+        static constexpr auto HEX_DIGITS = std::string_view("0123456789abcdef");
+        packet.push_back('#');
+        packet.push_back(HEX_DIGITS[checksum >> 4]);
+        packet.push_back(HEX_DIGITS[checksum & 0x0F]);
+
+        this->write(packet);
+
+        if (this->acknowledgementsEnabled) {
+            const auto acknowledgement = this->readByte();
+
+            if (acknowledgement != '+') {
+                throw Exception(
+                    "Unexpected acknowledgement from server (byte value " + std::to_string(acknowledgement) + ")"
+                );
+            }
+        }
+    }
+
+    std::string RspClient::readPacket() {
+        while (true) {
+            auto byte = this->readByte();
+
+            // Skip any stray acknowledgements, and anything else that precedes the start of the packet
+            while (byte != '$') {
+                byte = this->readByte();
+            }
+
+            auto data = std::string();
+            while ((byte = this->readByte()) != '#') {
+                data.push_back(static_cast<char>(byte));
+            }
+
+            // The checksum - we don't verify it, as the connection is reliable
+            this->readByte();
+            this->readByte();
+
+            if (this->acknowledgementsEnabled) {
+                this->write("+");
+            }
+
+            if (data.size() > 1 && data[0] == 'O' && data != "OK") {
+                continue;
+            }
+
+            return data;
+        }
+    }
+
+    bool RspClient::startNoAckMode() {
+        if (this->exchange("QStartNoAckMode") != "OK") {
+            return false;
+        }
+
+        this->acknowledgementsEnabled = false;
+        return true;
+    }
+
+    void RspClient::write(const std::string& data) {
+        auto bytesRemaining = data.size();
+        const auto* nextByte = data.data();
+
+        while (bytesRemaining > 0) {
+            const auto bytesWritten = ::send(this->socketFileDescriptor, nextByte, bytesRemaining, MSG_NOSIGNAL);
+
+            if (bytesWritten < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                throw Exception("Failed to write to server socket - error no: " + std::to_string(errno));
+            }
+
+            nextByte += bytesWritten;
+            bytesRemaining -= static_cast<std::size_t>(bytesWritten);
+        }
+
+        this->bytesSent += data.size();
+    }
+
+    unsigned char RspClient::readByte() {
+        if (this->inputBufferPosition < this->inputBuffer.size()) {
+            return this->inputBuffer[this->inputBufferPosition++];
+        }
+
+        auto pollDescriptor = ::pollfd{
+            .fd = this->socketFileDescriptor,
+            .events = POLLIN,
+            .revents = 0,
+        };
+
+        const auto pollResult = ::poll(&pollDescriptor, 1, static_cast<int>(this->timeout.count()));
+        if (pollResult == 0) {
+            throw Exception("Timed out waiting for response from server");
+        }
+
+        if (pollResult < 0) {
+            throw Exception("Failed to poll server socket - error no: " + std::to_string(errno));
+        }
+
+        this->inputBuffer.resize(RspClient::READ_BUFFER_SIZE);
+        const auto bytesRead = ::recv(
+            this->socketFileDescriptor,
+            this->inputBuffer.data(),
+            this->inputBuffer.size(),
+            0
+        );
+
+        if (bytesRead <= 0) {
+            this->inputBuffer.resize(0);
+            throw Exception(bytesRead == 0 ? "Server closed the connection" : "Failed to read from server socket");
+        }
+
+        this->inputBuffer.resize(static_cast<std::size_t>(bytesRead));
+        this->inputBufferPosition = 1;
+        this->bytesReceived += static_cast<std::uint64_t>(bytesRead);
+
+        return this->inputBuffer[0];
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <chrono>
+
+namespace Bloom::Benchmarks::RspLoadGenerator
+{
+    /**
+     * A minimal GDB RSP client, for driving Bloom's GDB server with synthetic IDE traffic.
+     *
+     * The client implements only what the load generator needs: packet framing (with binary escaping), the
+     * acknowledgement handshake (or lack of, once no-ack mode has been negotiated) and blocking request/response
+     * exchanges with a timeout. Responses are not unescaped or run-length decoded - the load generator only checks
+     * their first few bytes.
+     */
+    class RspClient
+    {
+    public:
+        /**
+         * Connects to the GDB server at the given IPv4 address and port.
+         *
+         * @param address
+         * @param port
+         * @param timeout
+         *  The maximum time to wait for any single response from the server.
+         */
+        RspClient(const std::string& address, std::uint16_t port, std::chrono::milliseconds timeout);
+
+        ~RspClient();
+
+        RspClient(const RspClient& other) = delete;
+        RspClient(RspClient&& other) = delete;
+
+        RspClient& operator = (const RspClient& other) = delete;
+        RspClient& operator = (RspClient&& other) = delete;
+
+        /**
+         * Sends the given packet data (framed, escaped and checksummed here) and waits for the server to acknowledge
+         * it, if acknowledgements haven't been disabled.
+         *
+         * @param data
+         */
+        void sendPacket(const std::string& data);
+
+        /**
+         * Waits for the next packet from the server, and acknowledges it, if acknowledgements haven't been disabled.
+         *
+         * Console output packets ("O" packets, sent during "monitor" commands) are skipped.
+         *
+         * @return
+         *  The packet data, without the framing.
+         */
+        std::string readPacket();
+
+        /**
+         * Sends the given packet and waits for the server's response.
+         *
+         * @param data
+         *
+         * @return
+         */
+        std::string exchange(const std::string& data) {
+            this->sendPacket(data);
+            return this->readPacket();
+        }
+
+        /**
+         * Negotiates no-ack mode ("QStartNoAckMode"). Once the server has acknowledged the request, neither side
+         * sends acknowledgements.
+         *
+         * @return
+         *  True if the server accepted the request.
+         */
+        bool startNoAckMode();
+
+        /**
+         * The number of bytes sent to and received from the server, including framing and acknowledgements.
+         */
+        [[nodiscard]] std::uint64_t getBytesSent() const {
+            return this->bytesSent;
+        }
+
+        [[nodiscard]] std::uint64_t getBytesReceived() const {
+            return this->bytesReceived;
+        }
+
+    private:
+        static constexpr auto READ_BUFFER_SIZE = std::size_t(65536);
+
+        int socketFileDescriptor = -1;
+        std::chrono::milliseconds timeout;
+        bool acknowledgementsEnabled = true;
+
+        std::vector<unsigned char> inputBuffer;
+        std::size_t inputBufferPosition = 0;
+
+        std::uint64_t bytesSent = 0;
+        std::uint64_t bytesReceived = 0;
+
+        void write(const std::string& data);
+
+        /**
+         * Reads the next byte from the server, blocking (up to this->timeout) if there's nothing buffered.
+         *
+         * @return
+         */
+        unsigned char readByte();
+    };
+}
@@ -0,0 +1,155 @@
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <sstream>
+#include <optional>
+#include <QJsonDocument>
+
+#include "LoadGenerator.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+using Bloom::Benchmarks::RspLoadGenerator::LoadGenerator;
+using Bloom::Benchmarks::RspLoadGenerator::LoadGeneratorConfig;
+
+static void printUsage() {
+    std::cout << "Usage: bloom-rsp-loadgen [options]\n\n"
+        << "Drives a running Bloom GDB server with synthetic IDE traffic, and reports packets/sec and latency\n"
+        << "percentiles for each scenario, in JSON format.\n\n"
+        << "Options:\n"
+        << "  --address=<ip>             Server address (default: 127.0.0.1)\n"
+        << "  --port=<port>              Server port (default: 1442)\n"
+        << "  --iterations=<n>           Measured iterations per scenario (default: 100)\n"
+        << "  --scenarios=<a,b,...>      Any of stop-storm, bulk-read, step, flash-load and script\n"
+        << "                             (default: stop-storm,bulk-read,step,flash-load)\n"
+        << "  --script=<file>            Recorded session for the script scenario - one packet per line\n"
+        << "  --ack                      Don't negotiate no-ack mode\n"
+        << "  --storm-reads=<n>          Memory reads per stop storm (default: 4)\n"
+        << "  --storm-read-size=<n>      Size of each stop storm memory read (default: 32)\n"
+        << "  --ram-address=<address>    RAM address for stop storm reads (default: 0x800100)\n"
+        << "  --bulk-address=<address>   Bulk read start address (default: 0x0)\n"
+        << "  --bulk-size=<n>            Bulk read size (default: 8192)\n"
+        << "  --bulk-chunk-size=<n>      Bytes per bulk read packet (default: 1024)\n"
+        << "  --flash-address=<address>  Flash load start address (default: 0x3000)\n"
+        << "  --flash-size=<n>           Flash load size (default: 4096)\n"
+        << "  --flash-chunk-size=<n>     Bytes per vFlashWrite packet (default: 1024)\n"
+        << "  --output=<file>            Write the results to the given file, instead of stdout\n\n"
+        << "For measurements of Bloom's host-side overhead alone, configure the Bloom instance with the \"mock\"\n"
+        << "debug tool.\n";
+}
+
+int main(int argc, char* argv[]) {
+    auto config = LoadGeneratorConfig();
+    auto outputFilePath = std::optional<std::string>();
+
+    try {
+        for (auto argumentIndex = 1; argumentIndex < argc; ++argumentIndex) {
+            const auto argument = std::string(argv[argumentIndex]);
+            const auto separatorPosition = argument.find('=');
+            const auto name = argument.substr(0, separatorPosition);
+            const auto value = separatorPosition != std::string::npos
+                ? argument.substr(separatorPosition + 1)
+                : std::string();
+
+            // Accepts decimal and hexadecimal (0x prefixed) values
+            const auto numericValue = [&value, &name] {
+                try {
+                    return std::stoul(value, nullptr, 0);
+
+                } catch (const std::logic_error&) {
+                    throw Bloom::Exceptions::Exception("Invalid value for " + name + ": \"" + value + "\"");
+                }
+            };
+
+            if (name == "--help" || name == "-h") {
+                printUsage();
+                return EXIT_SUCCESS;
+
+            } else if (name == "--address") {
+                config.address = value;
+
+            } else if (name == "--port") {
+                config.port = static_cast<std::uint16_t>(numericValue());
+
+            } else if (name == "--iterations") {
+                config.iterations = static_cast<int>(numericValue());
+
+            } else if (name == "--scenarios") {
+                config.scenarios.clear();
+                auto scenarioStream = std::stringstream(value);
+                auto scenario = std::string();
+
+                while (std::getline(scenarioStream, scenario, ',')) {
+                    if (!scenario.empty()) {
+                        config.scenarios.push_back(scenario);
+                    }
+                }
+
+            } else if (name == "--script") {
+                config.scriptFilePath = value;
+
+            } else if (name == "--ack") {
+                config.noAckMode = false;
+
+            } else if (name == "--storm-reads") {
+                config.stopStormMemoryReads = static_cast<int>(numericValue());
+
+            } else if (name == "--storm-read-size") {
+                config.stopStormReadSize = static_cast<std::uint32_t>(numericValue());
+
+            } else if (name == "--ram-address") {
+                config.ramAddress = static_cast<std::uint32_t>(numericValue());
+
+            } else if (name == "--bulk-address") {
+                config.bulkReadAddress = static_cast<std::uint32_t>(numericValue());
+
+            } else if (name == "--bulk-size") {
+                config.bulkReadSize = static_cast<std::uint32_t>(numericValue());
+
+            } else if (name == "--bulk-chunk-size") {
+                config.bulkReadChunkSize = static_cast<std::uint32_t>(numericValue());
+
+            } else if (name == "--flash-address") {
+                config.flashLoadAddress = static_cast<std::uint32_t>(numericValue());
+
+            } else if (name == "--flash-size") {
+                config.flashLoadSize = static_cast<std::uint32_t>(numericValue());
+
+            } else if (name == "--flash-chunk-size") {
+                config.flashLoadChunkSize = static_cast<std::uint32_t>(numericValue());
+
+            } else if (name == "--output") {
+                outputFilePath = value;
+
+            } else {
+                throw Bloom::Exceptions::Exception("Unknown option \"" + argument + "\" - see --help");
+            }
+        }
+
+        if (config.iterations < 1 || config.bulkReadChunkSize == 0 || config.flashLoadChunkSize == 0) {
+            throw Bloom::Exceptions::Exception("Iteration counts and chunk sizes must be greater than zero");
+        }
+
+        auto loadGenerator = LoadGenerator(config);
+        const auto output = QJsonDocument(loadGenerator.run()).toJson(QJsonDocument::Indented);
+
+        if (outputFilePath.has_value()) {
+            auto outputFile = std::ofstream(*outputFilePath);
+            if (!outputFile.is_open()) {
+                throw Bloom::Exceptions::Exception("Failed to open output file \"" + *outputFilePath + "\"");
+            }
+
+            outputFile << output.toStdString();
+
+        } else {
+            std::cout << output.toStdString();
+        }
+
+    } catch (const Bloom::Exceptions::Exception& exception) {
+        std::cerr << "Error: " << exception.getMessage() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
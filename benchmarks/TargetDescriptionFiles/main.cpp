@@ -0,0 +1,325 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <new>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+#include <malloc.h>
+#include <unistd.h>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QDirIterator>
+
+#include "src/Targets/Microchip/AVR/AVR8/TargetDescription/TargetDescriptionFile.hpp"
+#include "src/Services/PathService.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+/*
+ * Loads every AVR8 TDF in the catalogue, from both its XML and its binary form, and builds the AVR8 descriptor
+ * structures (register descriptors, pad descriptors and variants), as a debug session would.
+ *
+ * For each TDF and form, we record:
+ *  - the load time (the benchmark timing)
+ *  - "allocations": the number of heap allocations made by a single load
+ *  - "retainedBytes": the heap memory held by the loaded TDF
+ *  - "residentBytes": the growth of the process's resident set over the first load of the TDF
+ *
+ * The allocation and memory counters are taken from an additional (untimed) load, before the timed iterations, so
+ * tracking allocations has no effect on the timing.
+ *
+ * The catalogue/xml and catalogue/binary benchmarks load every TDF in the catalogue, per iteration.
+ *
+ * By default, the TDFs are taken from the build's resources directory, which is where the binary forms are
+ * produced (see the post-build command of the Bloom target). Use --tdf-directory=<path> to load them from elsewhere.
+ */
+namespace
+{
+    std::atomic<bool> allocationTrackingEnabled = false;
+    std::atomic<std::uint64_t> allocationCount = 0;
+    std::atomic<std::int64_t> liveHeapBytes = 0;
+}
+
+void* operator new(std::size_t size) {
+    auto* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    if (allocationTrackingEnabled.load(std::memory_order_relaxed)) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        liveHeapBytes.fetch_add(
+            static_cast<std::int64_t>(::malloc_usable_size(pointer)),
+            std::memory_order_relaxed
+        );
+    }
+
+    return pointer;
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    if (pointer == nullptr) {
+        return;
+    }
+
+    if (allocationTrackingEnabled.load(std::memory_order_relaxed)) {
+        liveHeapBytes.fetch_sub(
+            static_cast<std::int64_t>(::malloc_usable_size(pointer)),
+            std::memory_order_relaxed
+        );
+    }
+
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    ::operator delete(pointer);
+}
+
+namespace Bloom::Benchmarks
+{
+    using Targets::Microchip::Avr::Avr8Bit::TargetDescription::TargetDescriptionFile;
+
+    static constexpr auto DIRECTORY_ARGUMENT = std::string_view("--tdf-directory=");
+
+    struct Footprint
+    {
+        std::uint64_t allocations = 0;
+        std::int64_t retainedBytes = 0;
+        std::int64_t residentBytes = 0;
+    };
+
+    static std::int64_t residentSetSize() {
+        auto statm = std::ifstream("/proc/self/statm");
+        auto totalPages = std::int64_t(0);
+        auto residentPages = std::int64_t(0);
+        statm >> totalPages >> residentPages;
+
+        return residentPages * static_cast<std::int64_t>(::sysconf(_SC_PAGESIZE));
+    }
+
+    static std::unique_ptr<TargetDescriptionFile> loadTargetDescriptionFile(
+        const QString& xmlFilePath,
+        bool loadBinaryForm
+    ) {
+        auto descriptionFile = std::make_unique<TargetDescriptionFile>(xmlFilePath, loadBinaryForm);
+
+        // The register descriptors are built upon loading. The pad descriptors and variants are built lazily.
+        benchmark::DoNotOptimize(descriptionFile->getRegisterDescriptorsMappedByType().size());
+        benchmark::DoNotOptimize(descriptionFile->getPadDescriptorsMappedByName().size());
+        benchmark::DoNotOptimize(descriptionFile->getVariantsMappedById().size());
+
+        return descriptionFile;
+    }
+
+    static Footprint measureFootprint(const QString& xmlFilePath, bool loadBinaryForm) {
+        auto footprint = Footprint();
+
+        const auto residentBytesBefore = residentSetSize();
+
+        allocationCount = 0;
+        liveHeapBytes = 0;
+        allocationTrackingEnabled = true;
+
+        auto descriptionFile = loadTargetDescriptionFile(xmlFilePath, loadBinaryForm);
+
+        allocationTrackingEnabled = false;
+        footprint.allocations = allocationCount;
+        footprint.retainedBytes = liveHeapBytes;
+        footprint.residentBytes = residentSetSize() - residentBytesBefore;
+
+        return footprint;
+    }
+
+    static void loadFile(benchmark::State& state, const QString& xmlFilePath, bool loadBinaryForm) {
+        try {
+            /*
+             * The resident set growth is only meaningful for the first load of the TDF, before the allocator has
+             * retained any of the memory freed by previous loads.
+             */
+            const auto footprint = measureFootprint(xmlFilePath, loadBinaryForm);
+
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(loadTargetDescriptionFile(xmlFilePath, loadBinaryForm));
+            }
+
+            state.counters["allocations"] = benchmark::Counter(static_cast<double>(footprint.allocations));
+            state.counters["retainedBytes"] = benchmark::Counter(
+                static_cast<double>(footprint.retainedBytes),
+                benchmark::Counter::kDefaults,
+                benchmark::Counter::kIs1024
+            );
+            state.counters["residentBytes"] = benchmark::Counter(
+                static_cast<double>(footprint.residentBytes),
+                benchmark::Counter::kDefaults,
+                benchmark::Counter::kIs1024
+            );
+
+        } catch (const Exceptions::Exception& exception) {
+            state.SkipWithError(exception.getMessage().c_str());
+        }
+    }
+
+    static void loadCatalogue(
+        benchmark::State& state,
+        const std::vector<QString>& xmlFilePaths,
+        bool loadBinaryForm
+    ) {
+        try {
+            for (auto _ : state) {
+                for (const auto& xmlFilePath : xmlFilePaths) {
+                    benchmark::DoNotOptimize(loadTargetDescriptionFile(xmlFilePath, loadBinaryForm));
+                }
+            }
+
+            state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * xmlFilePaths.size()));
+
+        } catch (const Exceptions::Exception& exception) {
+            state.SkipWithError(exception.getMessage().c_str());
+        }
+    }
+
+    /**
+     * Registers the benchmarks for all TDFs in the given directory (and its subdirectories).
+     *
+     * TDFs without a binary form are excluded from the binary benchmarks, as they would fall back to the XML.
+     *
+     * @param directoryPath
+     *
+     * @return
+     *  The number of TDFs found.
+     */
+    static std::size_t registerBenchmarks(const QString& directoryPath) {
+        auto fileIterator = QDirIterator(
+            directoryPath,
+            QStringList({"*.xml"}),
+            QDir::Files,
+            QDirIterator::Subdirectories
+        );
+
+        auto xmlFilePaths = std::vector<QString>();
+        while (fileIterator.hasNext()) {
+            xmlFilePaths.push_back(fileIterator.next());
+        }
+
+        std::sort(xmlFilePaths.begin(), xmlFilePaths.end());
+
+        // The file vectors must outlive the benchmarks, which capture them by reference
+        static auto allXmlFilePaths = std::vector<QString>();
+        static auto binaryXmlFilePaths = std::vector<QString>();
+        allXmlFilePaths = xmlFilePaths;
+
+        const auto directory = QDir(directoryPath);
+
+        for (const auto& xmlFilePath : xmlFilePaths) {
+            const auto fileInfo = QFileInfo(xmlFilePath);
+            const auto name = QDir::cleanPath(
+                directory.relativeFilePath(fileInfo.path()) + "/" + fileInfo.completeBaseName()
+            ).toStdString();
+
+            benchmark::RegisterBenchmark(
+                ("xml/" + name).c_str(),
+                [xmlFilePath] (benchmark::State& state) {
+                    loadFile(state, xmlFilePath, false);
+                }
+            )->Unit(benchmark::kMicrosecond);
+
+            if (!QFile::exists(TargetDescriptionFile::getBinaryFilePath(xmlFilePath))) {
+                continue;
+            }
+
+            binaryXmlFilePaths.push_back(xmlFilePath);
+
+            benchmark::RegisterBenchmark(
+                ("binary/" + name).c_str(),
+                [xmlFilePath] (benchmark::State& state) {
+                    loadFile(state, xmlFilePath, true);
+                }
+            )->Unit(benchmark::kMicrosecond);
+        }
+
+        benchmark::RegisterBenchmark(
+            "catalogue/xml",
+            [] (benchmark::State& state) {
+                loadCatalogue(state, allXmlFilePaths, false);
+            }
+        )->Unit(benchmark::kMillisecond);
+
+        if (!binaryXmlFilePaths.empty()) {
+            benchmark::RegisterBenchmark(
+                "catalogue/binary",
+                [] (benchmark::State& state) {
+                    loadCatalogue(state, binaryXmlFilePaths, true);
+                }
+            )->Unit(benchmark::kMillisecond);
+        }
+
+        if (binaryXmlFilePaths.size() < xmlFilePaths.size()) {
+            std::fprintf(
+                stderr,
+                "%zu of %zu TDFs have no binary form - they're excluded from the binary benchmarks\n",
+                xmlFilePaths.size() - binaryXmlFilePaths.size(),
+                xmlFilePaths.size()
+            );
+        }
+
+        return xmlFilePaths.size();
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace Bloom;
+
+    auto directoryPath = QString::fromStdString(
+        Services::PathService::resourcesDirPath() + "/TargetDescriptionFiles"
+    );
+
+    // Google Benchmark rejects arguments it doesn't recognise, so we remove ours before handing over the rest
+    auto arguments = std::vector<char*>();
+    for (auto index = 0; index < argc; ++index) {
+        const auto argument = std::string_view(argv[index]);
+
+        if (argument.starts_with(Benchmarks::DIRECTORY_ARGUMENT)) {
+            directoryPath = QString::fromStdString(
+                std::string(argument.substr(Benchmarks::DIRECTORY_ARGUMENT.size()))
+            );
+            continue;
+        }
+
+        arguments.push_back(argv[index]);
+    }
+
+    auto argumentCount = static_cast<int>(arguments.size());
+
+    if (!QDir(directoryPath).exists()) {
+        std::fprintf(stderr, "TDF directory (%s) not found\n", directoryPath.toStdString().c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (Benchmarks::registerBenchmarks(directoryPath) == 0) {
+        std::fprintf(stderr, "No TDFs found in %s\n", directoryPath.toStdString().c_str());
+        return EXIT_FAILURE;
+    }
+
+    benchmark::Initialize(&argumentCount, arguments.data());
+
+    if (benchmark::ReportUnrecognizedArguments(argumentCount, arguments.data())) {
+        return EXIT_FAILURE;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_set>
+
+#include "src/Targets/TargetRegister.hpp"
+
+namespace Bloom::Benchmarks
+{
+    using Targets::TargetRegisterDescriptor;
+    using Targets::TargetRegisterDescriptors;
+    using Targets::TargetRegisterType;
+    using Targets::TargetMemoryType;
+
+    /**
+     * Roughly the shape of an AVR8 register set - 32 general purpose registers, followed by a few hundred peripheral
+     * registers.
+     */
+    static std::vector<TargetRegisterDescriptor> generateDescriptors(std::size_t count) {
+        auto descriptors = std::vector<TargetRegisterDescriptor>();
+        descriptors.reserve(count);
+
+        for (auto index = std::size_t(0); index < count; ++index) {
+            auto descriptor = TargetRegisterDescriptor(
+                index < 32 ? TargetRegisterType::GENERAL_PURPOSE_REGISTER : TargetRegisterType::OTHER
+            );
+            descriptor.startAddress = static_cast<Targets::TargetMemoryAddress>(index);
+            descriptor.size = 1;
+            descriptor.memoryType = TargetMemoryType::RAM;
+            descriptor.readable = true;
+            descriptor.name = "register_" + std::to_string(index);
+            descriptor.groupName = "group_" + std::to_string(index / 8);
+            descriptor.description = "Description of register " + std::to_string(index);
+
+            descriptors.push_back(descriptor);
+        }
+
+        return descriptors;
+    }
+
+    static void constructDescriptorSet(benchmark::State& state) {
+        const auto descriptors = generateDescriptors(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            auto descriptorSet = TargetRegisterDescriptors(descriptors.begin(), descriptors.end());
+            benchmark::DoNotOptimize(descriptorSet.size());
+        }
+    }
+    BENCHMARK(constructDescriptorSet)->Arg(64)->Arg(512);
+
+    static void findInDescriptorSet(benchmark::State& state) {
+        const auto descriptors = generateDescriptors(static_cast<std::size_t>(state.range(0)));
+        const auto descriptorSet = TargetRegisterDescriptors(descriptors.begin(), descriptors.end());
+
+        for (auto _ : state) {
+            for (const auto& descriptor : descriptors) {
+                benchmark::DoNotOptimize(descriptorSet.find(descriptor));
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+    }
+    BENCHMARK(findInDescriptorSet)->Arg(64)->Arg(512);
+
+    /**
+     * Hashed lookups, as performed via the BiMap class.
+     */
+    static void findInDescriptorHashSet(benchmark::State& state) {
+        const auto descriptors = generateDescriptors(static_cast<std::size_t>(state.range(0)));
+        const auto descriptorSet = std::unordered_set<TargetRegisterDescriptor>(descriptors.begin(), descriptors.end());
+
+        for (auto _ : state) {
+            for (const auto& descriptor : descriptors) {
+                benchmark::DoNotOptimize(descriptorSet.find(descriptor));
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+    }
+    BENCHMARK(findInDescriptorHashSet)->Arg(64)->Arg(512);
+
+    /**
+     * The hash is computed from the descriptor's type and start address, upon each use.
+     */
+    static void hashNewDescriptor(benchmark::State& state) {
+        const auto hasher = std::hash<TargetRegisterDescriptor>();
+
+        for (auto _ : state) {
+            for (auto address = Targets::TargetMemoryAddress(0); address < 512; ++address) {
+                auto descriptor = TargetRegisterDescriptor(TargetRegisterType::OTHER);
+                descriptor.startAddress = address;
+
+                benchmark::DoNotOptimize(hasher(descriptor));
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 512));
+    }
+    BENCHMARK(hashNewDescriptor);
+
+    /**
+     * Descriptors are copied into register values, events and Insight's widgets. The strings are interned, so this
+     * shouldn't depend on their length.
+     */
+    static void copyDescriptors(benchmark::State& state) {
+        const auto descriptors = generateDescriptors(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            auto copies = descriptors;
+            benchmark::DoNotOptimize(copies.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+    }
+    BENCHMARK(copyDescriptors)->Arg(64)->Arg(512);
+}
@@ -1,8 +1,9 @@
 <?php
 /*
- * Copies AVR8 target description files to AVR_TDF_DEST_FILE_PATH, in preparation for a build, and creates a JSON
- * mapping of target signatures to file paths (relative to Bloom's binary).
- * The JSON mapping is compiled as a Qt resource and used for looking-up target description file paths, by target ID.
+ * Copies AVR8 target description files to AVR_TDF_DEST_FILE_PATH, in preparation for a build, and generates a C++
+ * header containing an index of target signatures to file paths (relative to Bloom's binary).
+ * The index is compiled into Bloom's binary and used for looking-up target description file paths, by target
+ * signature. See Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription::TargetDescriptionIndex.
  *
  * This script should be run as part of the build process.
  */
@@ -19,7 +20,7 @@ require_once __DIR__ . "/TargetDescriptionFiles/Factory.php";
 
 define("AVR_TDF_DEST_FILE_PATH", $buildPath . "/resources/TargetDescriptionFiles/AVR");
 define("AVR_TDF_DEST_RELATIVE_FILE_PATH", "../resources/TargetDescriptionFiles/AVR");
-define("AVR_TDF_MAPPING_FILE_PATH", AVR_TDF_DEST_FILE_PATH . "/Mapping.json");
+define("AVR_TDF_INDEX_FILE_PATH", $buildPath . "/generated/Avr8TargetDescriptionIndex.hpp");
 
 // Empty destination directory
 if (file_exists(AVR_TDF_DEST_FILE_PATH)) {
@@ -27,15 +28,19 @@ if (file_exists(AVR_TDF_DEST_FILE_PATH)) {
     exec("rm -r " . AVR_TDF_DEST_FILE_PATH);
 }
 
-if (file_exists(AVR_TDF_MAPPING_FILE_PATH)) {
-    unlink(AVR_TDF_MAPPING_FILE_PATH);
+if (file_exists(AVR_TDF_INDEX_FILE_PATH)) {
+    unlink(AVR_TDF_INDEX_FILE_PATH);
 }
 
 mkdir(AVR_TDF_DEST_FILE_PATH, 0700, true);
 
+if (!file_exists(dirname(AVR_TDF_INDEX_FILE_PATH))) {
+    mkdir(dirname(AVR_TDF_INDEX_FILE_PATH), 0700, true);
+}
+
 print "Loading AVR8 TDFs\n\n";
 
-$tdfMapping = [];
+$tdfIndexEntries = [];
 $avrTdfs = TargetDescriptionFiles\Factory::loadAvr8Tdfs();
 
 print "Processing " . count($avrTdfs) . " AVR8 TDFs...\n\n";
@@ -94,20 +99,45 @@ foreach ($avrTdfs as $avrTdf) {
         exit(1);
     }
 
-    $tdfMapping[strtolower($avrTdf->signature->toHex())][] = [
-        'targetName' => $strippedTargetName,
+    $tdfIndexEntries[] = [
+        'signature' => strtolower($avrTdf->signature->toHex()),
+        'targetName' => $id,
         'targetDescriptionFilePath' => $relativeDestinationFilePath,
     ];
 
     $processedTargetIds[] = $id;
 }
 
-if (file_put_contents(AVR_TDF_MAPPING_FILE_PATH, json_encode($tdfMapping, JSON_PRETTY_PRINT)) === false) {
-    print "FATAL ERROR: Failed to create JSON mapping of target IDs to target description file paths\n";
+// The index must be sorted by signature, as Bloom performs a binary search on it
+usort($tdfIndexEntries, function (array $entryA, array $entryB): int {
+    return [$entryA['signature'], $entryA['targetName']] <=> [$entryB['signature'], $entryB['targetName']];
+});
+
+$tdfIndex = "#pragma once\n\n"
+    . "/*\n"
+    . " * This file was generated by build/scripts/Avr8TargetDescriptionFiles.php. Do not modify.\n"
+    . " */\n\n"
+    . "#include <array>\n\n"
+    . "#include \"src/Targets/Microchip/AVR/AVR8/TargetDescription/TargetDescriptionIndex.hpp\"\n\n"
+    . "namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription::Generated\n"
+    . "{\n"
+    . "    static constexpr auto TARGET_DESCRIPTION_INDEX_ENTRIES = std::to_array<TargetDescriptionIndexEntry>({\n";
+
+foreach ($tdfIndexEntries as $entry) {
+    $tdfIndex .= "        {" . $entry['signature'] . ", "
+        . json_encode($entry['targetName'], JSON_UNESCAPED_SLASHES) . ", "
+        . json_encode($entry['targetDescriptionFilePath'], JSON_UNESCAPED_SLASHES) . "},\n";
+}
+
+$tdfIndex .= "    });\n"
+    . "}\n";
+
+if (file_put_contents(AVR_TDF_INDEX_FILE_PATH, $tdfIndex) === false) {
+    print "FATAL ERROR: Failed to create index of target signatures to target description file paths\n";
     exit(1);
 }
 
 print "\n";
-print "Created JSON mapping of target IDs to target description file paths: " . AVR_TDF_MAPPING_FILE_PATH . "\n\n";
+print "Created index of target signatures to target description file paths: " . AVR_TDF_INDEX_FILE_PATH . "\n\n";
 print "Processed " . count($avrTdfs) . " files.\n";
 print "Done\n";
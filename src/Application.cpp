@@ -1,7 +1,12 @@
 #include "Application.hpp"
 
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <QFile>
+#include <QDir>
+#include <QDirIterator>
 #include <QJsonDocument>
 #include <unistd.h>
 #include <yaml-cpp/yaml.h>
@@ -11,6 +16,16 @@
 
 #include "src/Logger/Logger.hpp"
 #include "src/Services/PathService.hpp"
+#include "src/Services/TraceService.hpp"
+#include "src/Services/SymbolService.hpp"
+#include "src/Services/MemorySnapshotService.hpp"
+#include "src/Services/ProjectSettingsService.hpp"
+#include "src/Services/StartupProfilingService.hpp"
+#include "src/HardwareBenchmark/HardwareBenchmark.hpp"
+#include "src/ParallelProgrammer/ParallelProgrammer.hpp"
+#include "src/ProgramImage/ProgramImage.hpp"
+#include "src/Targets/TargetDescription/TargetDescriptionFile.hpp"
+#include "src/Helpers/EnumToStringMappings.hpp"
 
 #include "src/Exceptions/InvalidConfig.hpp"
 
@@ -26,6 +41,17 @@ namespace Bloom
         try {
             this->setName("Bloom");
 
+            const auto profileStartupArgumentIt = std::find(
+                this->arguments.begin(),
+                this->arguments.end(),
+                "--profile-startup"
+            );
+
+            if (profileStartupArgumentIt != this->arguments.end()) {
+                this->arguments.erase(profileStartupArgumentIt);
+                Services::StartupProfilingService::enable();
+            }
+
             if (this->arguments.size() > 1) {
                 auto& firstArg = this->arguments.at(1);
                 const auto commandHandlersByCommandName = this->getCommandHandlersByCommandName();
@@ -49,15 +75,8 @@ namespace Bloom
 
             this->startup();
 
-            if (this->insightConfig->insightEnabled) {
-                this->insight = std::make_unique<Insight>(
-                    *(this->applicationEventListener),
-                    this->projectConfig.value(),
-                    this->environmentConfig.value(),
-                    this->insightConfig.value(),
-                    this->projectSettings.value().insightSettings
-                );
-
+#ifndef BLOOM_EXCLUDE_INSIGHT
+            if (this->insight != nullptr) {
                 /*
                  * Before letting Insight occupy the main thread, process any pending events that accumulated
                  * during startup.
@@ -72,6 +91,10 @@ namespace Bloom
                 this->shutdown();
                 return EXIT_SUCCESS;
             }
+#endif
+
+            // When Insight is enabled, the startup profile is completed by Insight, once its window has been shown
+            Services::StartupProfilingService::complete();
 
             // Main event loop
             while (Thread::getThreadState() == ThreadState::READY) {
@@ -115,24 +138,56 @@ namespace Bloom
                 "init",
                 std::bind(&Application::initProject, this)
             },
+            {
+                "--compile-target-description-files",
+                std::bind(&Application::compileTargetDescriptionFiles, this)
+            },
+            {
+                "--benchmark",
+                std::bind(&Application::runHardwareBenchmark, this)
+            },
+            {
+                "program",
+                std::bind(&Application::runParallelProgrammer, this)
+            },
+            {
+                "snapshot",
+                std::bind(&Application::runSnapshotCapture, this)
+            },
         };
     }
 
     void Application::startup() {
+        const auto startupPhase = Services::StartupProfilingService::ScopedPhase("Application startup");
+
         auto& applicationEventListener = this->applicationEventListener;
         EventManager::registerListener(applicationEventListener);
         applicationEventListener->registerCallbackForEventType<Events::ShutdownApplication>(
             std::bind(&Application::onShutdownApplicationRequest, this, std::placeholders::_1)
         );
 
-        this->loadProjectSettings();
-        this->loadProjectConfiguration();
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Load project settings");
+            this->loadProjectSettings();
+        }
+
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Load project configuration");
+            this->loadProjectConfiguration();
+        }
+
         Logger::configure(this->projectConfig.value());
+        Services::TraceService::configure(this->projectConfig.value());
+        Services::SymbolService::configure(this->projectConfig.value());
 
         Logger::debug("Bloom version: " + Application::VERSION.toString());
 
-        this->blockAllSignals();
-        this->startSignalHandler();
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Start signal handler and exporter");
+            this->blockAllSignals();
+            this->startSignalHandler();
+            this->startMetricsExporter();
+        }
 
         Logger::info("Selected environment: \"" + this->selectedEnvironmentName + "\"");
         Logger::debug("Number of environments extracted from config: "
@@ -150,8 +205,42 @@ namespace Bloom
             std::bind(&Application::onDebugSessionFinished, this, std::placeholders::_1)
         );
 
-        this->startTargetController();
-        this->startDebugServer();
+        /*
+         * Acquiring the hardware can take a while (USB enumeration, target activation, TDF loading, etc), so we kick
+         * off the TargetController first, and bring up the other components whilst it's doing that. The DebugServer
+         * opens its socket straight away, so GDB can connect before the hardware is ready - the connection will be
+         * serviced once the TargetController is ready.
+         */
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Start TargetController, DebugServer");
+            this->startTargetController();
+            this->startDebugServer();
+        }
+
+        if (this->insightConfig->insightEnabled) {
+#ifndef BLOOM_EXCLUDE_INSIGHT
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Construct Insight");
+
+            // Constructing Insight initialises Qt and loads Insight's resources
+            this->insight = std::make_unique<Insight>(
+                *(this->applicationEventListener),
+                this->projectConfig.value(),
+                this->environmentConfig.value(),
+                this->insightConfig.value(),
+                this->projectSettings.value()
+            );
+#else
+            Logger::warning(
+                "Insight is enabled in the project configuration, but this build of Bloom doesn't include Insight "
+                    "- Insight will not be started"
+            );
+#endif
+        }
+
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Wait for TargetController");
+            this->waitForTargetControllerStartup();
+        }
 
         Thread::setThreadState(ThreadState::READY);
     }
@@ -165,74 +254,32 @@ namespace Bloom
         Thread::setThreadState(ThreadState::SHUTDOWN_INITIATED);
         Logger::info("Shutting down Bloom");
 
+#ifndef BLOOM_EXCLUDE_INSIGHT
         if (this->insight != nullptr) {
             this->insight->shutdown();
         }
+#endif
 
         this->stopDebugServer();
         this->stopTargetController();
+        this->stopMetricsExporter();
         this->stopSignalHandler();
+        Services::SymbolService::shutdown();
 
         this->saveProjectSettings();
         Thread::setThreadState(ThreadState::STOPPED);
     }
 
     void Application::loadProjectSettings() {
-        const auto projectSettingsPath = Services::PathService::projectSettingsPath();
-        auto jsonSettingsFile = QFile(QString::fromStdString(projectSettingsPath));
-
-        if (jsonSettingsFile.exists()) {
-            try {
-                if (!jsonSettingsFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
-                    throw Exception("Failed to open settings file.");
-                }
-
-                this->projectSettings = ProjectSettings(
-                    QJsonDocument::fromJson(jsonSettingsFile.readAll()).object()
-                );
-                jsonSettingsFile.close();
-
-                return;
-
-            } catch (const std::exception& exception) {
-                Logger::error(
-                    "Failed to load project settings from " + projectSettingsPath + " - " + exception.what()
-                );
-            }
-        }
-
-        this->projectSettings = ProjectSettings();
+        this->projectSettings = Services::ProjectSettingsService::load();
     }
 
     void Application::saveProjectSettings() {
-        if (!this->projectSettings.has_value()) {
-            return;
+        if (this->projectSettings.has_value()) {
+            Services::ProjectSettingsService::save(*(this->projectSettings));
         }
 
-        const auto projectSettingsPath = Services::PathService::projectSettingsPath();
-        auto jsonSettingsFile = QFile(QString::fromStdString(projectSettingsPath));
-
-        Logger::debug("Saving project settings to " + projectSettingsPath);
-
-        QDir().mkpath(QString::fromStdString(Services::PathService::projectSettingsDirPath()));
-
-        try {
-            const auto jsonDocument = QJsonDocument(this->projectSettings->toJson());
-
-            if (!jsonSettingsFile.open(QIODevice::ReadWrite | QIODevice::Truncate | QIODevice::Text)) {
-                throw Exception(
-                    "Failed to open/create settings file (" + projectSettingsPath + "). Check file permissions."
-                );
-            }
-
-            jsonSettingsFile.write(jsonDocument.toJson());
-            jsonSettingsFile.close();
-
-        } catch (const Exception& exception) {
-            Logger::error(
-                "Failed to save project settings -  " + exception.getMessage()
-            );
-        }
+        Services::ProjectSettingsService::shutdown();
     }
 
     void Application::loadProjectConfiguration() {
@@ -393,6 +440,383 @@ namespace Bloom
         return EXIT_SUCCESS;
     }
 
+    int Application::compileTargetDescriptionFiles() {
+        const auto directoryPath = QString::fromStdString(
+            this->arguments.size() > 2
+                ? this->arguments.at(2)
+                : Services::PathService::resourcesDirPath() + "/TargetDescriptionFiles"
+        );
+
+        if (!QDir(directoryPath).exists()) {
+            throw Exception("TDF directory (" + directoryPath.toStdString() + ") not found");
+        }
+
+        auto fileIterator = QDirIterator(
+            directoryPath,
+            QStringList({"*.xml"}),
+            QDir::Files,
+            QDirIterator::Subdirectories
+        );
+
+        auto xmlFilePaths = std::vector<QString>();
+        while (fileIterator.hasNext()) {
+            xmlFilePaths.push_back(fileIterator.next());
+        }
+
+        /*
+         * Each TDF is compiled independently of the others (TargetDescriptionFile::compileToBinary() holds no shared
+         * state), so we spread the files across one worker per core. Workers take the next file from a shared
+         * index, which keeps them all busy despite the large variance in TDF sizes.
+         */
+        const auto workerCount = std::clamp(
+            static_cast<std::size_t>(std::thread::hardware_concurrency()),
+            std::size_t(1),
+            std::max(xmlFilePaths.size(), std::size_t(1))
+        );
+
+        auto nextFileIndex = std::atomic<std::size_t>(0);
+        auto compiledCount = std::atomic<std::size_t>(0);
+        auto failedCount = std::atomic<std::size_t>(0);
+
+        const auto compileFiles = [&xmlFilePaths, &nextFileIndex, &compiledCount, &failedCount] {
+            for (
+                auto fileIndex = nextFileIndex.fetch_add(1);
+                fileIndex < xmlFilePaths.size();
+                fileIndex = nextFileIndex.fetch_add(1)
+            ) {
+                const auto& xmlFilePath = xmlFilePaths[fileIndex];
+
+                try {
+                    Targets::TargetDescription::TargetDescriptionFile::compileToBinary(xmlFilePath);
+                    compiledCount++;
+
+                } catch (const Exception& exception) {
+                    Logger::error(
+                        "Failed to compile TDF \"" + xmlFilePath.toStdString() + "\" - " + exception.getMessage()
+                    );
+                    failedCount++;
+                }
+            }
+        };
+
+        auto workers = std::vector<std::future<void>>();
+        workers.reserve(workerCount);
+
+        for (auto workerIndex = std::size_t(0); workerIndex < workerCount; ++workerIndex) {
+            workers.emplace_back(std::async(std::launch::async, compileFiles));
+        }
+
+        for (auto& worker : workers) {
+            worker.get();
+        }
+
+        Logger::info(
+            "Compiled " + std::to_string(compiledCount) + " TDF(s), with " + std::to_string(workerCount)
+                + " worker(s)"
+        );
+        return failedCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    int Application::runHardwareBenchmark() {
+        auto includeProgramMemory = false;
+        auto outputFilePath = std::optional<std::string>();
+
+        for (auto argumentIt = this->arguments.begin() + 2; argumentIt != this->arguments.end(); ++argumentIt) {
+            const auto& argument = *argumentIt;
+
+            if (argument == "--include-flash") {
+                includeProgramMemory = true;
+                continue;
+            }
+
+            if (argument.starts_with("--output=")) {
+                outputFilePath = argument.substr(std::string("--output=").size());
+                continue;
+            }
+
+            this->selectedEnvironmentName = argument;
+        }
+
+        auto& applicationEventListener = this->applicationEventListener;
+        EventManager::registerListener(applicationEventListener);
+        applicationEventListener->registerCallbackForEventType<Events::ShutdownApplication>(
+            std::bind(&Application::onShutdownApplicationRequest, this, std::placeholders::_1)
+        );
+
+        this->loadProjectSettings();
+        this->loadProjectConfiguration();
+        Logger::configure(this->projectConfig.value());
+
+        Logger::info("Selected environment: \"" + this->selectedEnvironmentName + "\"");
+
+        this->blockAllSignals();
+        this->startSignalHandler();
+
+        applicationEventListener->registerCallbackForEventType<Events::TargetControllerThreadStateChanged>(
+            std::bind(&Application::onTargetControllerThreadStateChanged, this, std::placeholders::_1)
+        );
+
+        this->startTargetController();
+        this->waitForTargetControllerStartup();
+        Thread::setThreadState(ThreadState::READY);
+
+        auto benchmark = HardwareBenchmark(
+            includeProgramMemory,
+            [this] {
+                // Process any shutdown requests (e.g. from the SignalHandler, upon SIGINT)
+                this->applicationEventListener->dispatchCurrentEvents();
+                return Thread::getThreadState() != ThreadState::READY;
+            }
+        );
+
+        const auto targetDescriptor = Services::TargetControllerService().getTargetDescriptor();
+
+        auto report = benchmark.run();
+        report.insert("bloomVersion", QString::fromStdString(Application::VERSION.toString()));
+        report.insert("debugTool", QString::fromStdString(this->environmentConfig->debugToolConfig.name));
+        report.insert("target", QJsonObject({
+            {"name", QString::fromStdString(targetDescriptor->name)},
+            {"id", QString::fromStdString(targetDescriptor->id)},
+        }));
+
+        const auto reportJson = QJsonDocument(report).toJson();
+
+        if (outputFilePath.has_value()) {
+            auto outputFile = QFile(QString::fromStdString(outputFilePath.value()));
+
+            if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+                throw Exception("Failed to open benchmark output file (" + outputFilePath.value() + ")");
+            }
+
+            outputFile.write(reportJson);
+            outputFile.close();
+
+            Logger::info("Benchmark results written to " + outputFilePath.value());
+
+        } else {
+            std::cout << reportJson.toStdString() << std::flush;
+        }
+
+        return report.value("complete").toBool() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    int Application::runParallelProgrammer() {
+        if (this->arguments.size() < 3) {
+            throw Exception("No image file provided. Usage: bloom program <image file> [--environments=<names>]");
+        }
+
+        const auto& imageFilePath = this->arguments.at(2);
+        auto environmentNames = std::vector<std::string>();
+        auto outputFilePath = std::optional<std::string>();
+
+        for (auto argumentIt = this->arguments.begin() + 3; argumentIt != this->arguments.end(); ++argumentIt) {
+            const auto& argument = *argumentIt;
+
+            if (argument.starts_with("--output=")) {
+                outputFilePath = argument.substr(std::string("--output=").size());
+                continue;
+            }
+
+            auto environmentList = std::string();
+
+            if (argument.starts_with("--environments=")) {
+                environmentList = argument.substr(std::string("--environments=").size());
+
+            } else if (argument == "--environments" && std::next(argumentIt) != this->arguments.end()) {
+                environmentList = *(++argumentIt);
+
+            } else {
+                throw Exception("Invalid argument (\"" + argument + "\")");
+            }
+
+            for (const auto& name : QString::fromStdString(environmentList).split(',', Qt::SkipEmptyParts)) {
+                environmentNames.push_back(name.trimmed().toStdString());
+            }
+        }
+
+        if (!environmentNames.empty()) {
+            // Application::loadProjectConfiguration() validates the selected environment
+            this->selectedEnvironmentName = environmentNames.front();
+
+        } else {
+            environmentNames.push_back(this->selectedEnvironmentName);
+        }
+
+        auto& applicationEventListener = this->applicationEventListener;
+        EventManager::registerListener(applicationEventListener);
+        applicationEventListener->registerCallbackForEventType<Events::ShutdownApplication>(
+            std::bind(&Application::onShutdownApplicationRequest, this, std::placeholders::_1)
+        );
+
+        this->loadProjectSettings();
+        this->loadProjectConfiguration();
+        Logger::configure(this->projectConfig.value());
+
+        auto environmentConfigs = std::vector<EnvironmentConfig>();
+
+        for (const auto& environmentName : environmentNames) {
+            const auto environmentIt = this->projectConfig->environments.find(environmentName);
+
+            if (environmentIt == this->projectConfig->environments.end()) {
+                throw InvalidConfig("Environment (\"" + environmentName + "\") not found in configuration.");
+            }
+
+            environmentConfigs.push_back(environmentIt->second);
+        }
+
+        // We load the image before acquiring any hardware, so that an invalid image doesn't cost us anything
+        const auto programImage = std::make_shared<const ProgramImage>(ProgramImage::fromFile(imageFilePath));
+
+        this->blockAllSignals();
+        this->startSignalHandler();
+        Thread::setThreadState(ThreadState::READY);
+
+        auto programmer = ParallelProgrammer(
+            this->projectConfig.value(),
+            std::move(environmentConfigs),
+            programImage,
+            [this] {
+                // Process any shutdown requests (e.g. from the SignalHandler, upon SIGINT)
+                this->applicationEventListener->dispatchCurrentEvents();
+                return Thread::getThreadState() != ThreadState::READY;
+            }
+        );
+
+        auto report = programmer.run();
+        report.insert("bloomVersion", QString::fromStdString(Application::VERSION.toString()));
+        report.insert("image", QJsonObject({
+            {"path", QString::fromStdString(imageFilePath)},
+            {"bytes", static_cast<qint64>(programImage->size())},
+            {"segments", static_cast<qint64>(programImage->segments.size())},
+        }));
+
+        const auto reportJson = QJsonDocument(report).toJson();
+
+        if (outputFilePath.has_value()) {
+            auto outputFile = QFile(QString::fromStdString(outputFilePath.value()));
+
+            if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+                throw Exception("Failed to open programming report file (" + outputFilePath.value() + ")");
+            }
+
+            outputFile.write(reportJson);
+            outputFile.close();
+
+            Logger::info("Programming report written to " + outputFilePath.value());
+
+        } else {
+            std::cout << reportJson.toStdString() << std::flush;
+        }
+
+        return report.value("success").toBool() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    int Application::runSnapshotCapture() {
+        using Services::MemorySnapshotService;
+
+        if (this->arguments.size() < 3 || this->arguments.at(2).starts_with("--")) {
+            throw Exception(
+                "No snapshot name provided. Usage: bloom snapshot <name> [ram|eeprom|flash] [environment name] "
+                    "[--description=<text>]"
+            );
+        }
+
+        const auto name = QString::fromStdString(this->arguments.at(2));
+        auto description = QString();
+        auto memoryType = Targets::TargetMemoryType::RAM;
+
+        for (auto argumentIt = this->arguments.begin() + 3; argumentIt != this->arguments.end(); ++argumentIt) {
+            const auto& argument = *argumentIt;
+
+            if (argument.starts_with("--description=")) {
+                description = QString::fromStdString(argument.substr(std::string("--description=").size()));
+                continue;
+            }
+
+            const auto argumentMemoryType = EnumToStringMappings::targetMemoryTypes.valueAt(
+                QString::fromStdString(argument)
+            );
+
+            if (argumentMemoryType.has_value() && *argumentMemoryType != Targets::TargetMemoryType::OTHER) {
+                memoryType = *argumentMemoryType;
+                continue;
+            }
+
+            this->selectedEnvironmentName = argument;
+        }
+
+        auto& applicationEventListener = this->applicationEventListener;
+        EventManager::registerListener(applicationEventListener);
+        applicationEventListener->registerCallbackForEventType<Events::ShutdownApplication>(
+            std::bind(&Application::onShutdownApplicationRequest, this, std::placeholders::_1)
+        );
+
+        this->loadProjectSettings();
+        this->loadProjectConfiguration();
+        Logger::configure(this->projectConfig.value());
+
+        Logger::info("Selected environment: \"" + this->selectedEnvironmentName + "\"");
+
+        this->blockAllSignals();
+        this->startSignalHandler();
+
+        applicationEventListener->registerCallbackForEventType<Events::TargetControllerThreadStateChanged>(
+            std::bind(&Application::onTargetControllerThreadStateChanged, this, std::placeholders::_1)
+        );
+
+        this->startTargetController();
+        this->waitForTargetControllerStartup();
+        Thread::setThreadState(ThreadState::READY);
+
+        auto targetControllerService = Services::TargetControllerService();
+        const auto targetDescriptor = targetControllerService.getTargetDescriptor();
+
+        if (!targetDescriptor->memoryDescriptorsByType.contains(memoryType)) {
+            throw Exception(
+                "Target has no " + EnumToStringMappings::targetMemoryTypes.at(memoryType).toUpper().toStdString()
+                    + " memory"
+            );
+        }
+
+        const auto targetWasRunning = targetControllerService.getTargetState() != Targets::TargetState::STOPPED;
+        if (targetWasRunning) {
+            targetControllerService.stopTargetExecution();
+        }
+
+        auto snapshot = MemorySnapshotService::capture(
+            targetControllerService,
+            name,
+            description,
+            memoryType,
+            {},
+            {}
+        );
+
+        if (targetWasRunning) {
+            targetControllerService.continueTargetExecution(std::nullopt, std::nullopt);
+        }
+
+        const auto snapshotFilePath = MemorySnapshotService::store(
+            snapshot,
+            MemorySnapshotService::latestFullSnapshot(memoryType)
+        );
+
+        const auto report = QJsonObject({
+            {"bloomVersion", QString::fromStdString(Application::VERSION.toString())},
+            {"id", snapshot.id},
+            {"name", snapshot.name},
+            {"memoryType", EnumToStringMappings::targetMemoryTypes.at(snapshot.memoryType)},
+            {"bytes", static_cast<qint64>(snapshot.data.size())},
+            {"programCounter", static_cast<qint64>(snapshot.programCounter)},
+            {"stackPointer", static_cast<qint64>(snapshot.stackPointer)},
+            {"delta", snapshot.baseSnapshotId.has_value()},
+            {"path", snapshotFilePath},
+        });
+
+        std::cout << QJsonDocument(report).toJson().toStdString() << std::flush;
+        return EXIT_SUCCESS;
+    }
+
     void Application::startSignalHandler() {
         this->signalHandlerThread = std::thread(&SignalHandler::run, std::ref(this->signalHandler));
     }
@@ -401,13 +825,8 @@ namespace Bloom
         const auto shThreadState = this->signalHandler.getThreadState();
 
         if (shThreadState != ThreadState::STOPPED && shThreadState != ThreadState::UNINITIALISED) {
+            // This will wake the SignalHandler's event loop, allowing it to action the shutdown
             this->signalHandler.triggerShutdown();
-
-            /*
-             * Send meaningless signal to the SignalHandler thread to have it shutdown. The signal will pull it out of
-             * a blocking state and allow it to action the shutdown. See SignalHandler::run() for more.
-             */
-            pthread_kill(this->signalHandlerThread.native_handle(), SIGUSR1);
         }
 
         if (this->signalHandlerThread.joinable()) {
@@ -427,7 +846,9 @@ namespace Bloom
             &TargetController::TargetControllerComponent::run,
             this->targetController.get()
         );
+    }
 
+    void Application::waitForTargetControllerStartup() {
         const auto tcStateChangeEvent = this->applicationEventListener->waitForEvent<
             Events::TargetControllerThreadStateChanged
         >();
@@ -444,7 +865,7 @@ namespace Bloom
 
         const auto targetControllerState = this->targetController->getThreadState();
         if (targetControllerState == ThreadState::STARTING || targetControllerState == ThreadState::READY) {
-            EventManager::triggerEvent(std::make_shared<Events::ShutdownTargetController>());
+            EventManager::triggerEvent(Events::makeEvent<Events::ShutdownTargetController>());
             this->applicationEventListener->waitForEvent<Events::TargetControllerThreadStateChanged>(
                 std::chrono::milliseconds(10000)
             );
@@ -483,7 +904,7 @@ namespace Bloom
 
         const auto debugServerState = this->debugServer->getThreadState();
         if (debugServerState == ThreadState::STARTING || debugServerState == ThreadState::READY) {
-            EventManager::triggerEvent(std::make_shared<Events::ShutdownDebugServer>());
+            EventManager::triggerEvent(Events::makeEvent<Events::ShutdownDebugServer>());
             this->applicationEventListener->waitForEvent<Events::DebugServerThreadStateChanged>(
                 std::chrono::milliseconds(5000)
             );
@@ -496,6 +917,33 @@ namespace Bloom
         }
     }
 
+    void Application::startMetricsExporter() {
+        if (!this->projectConfig->metricsPortNumber.has_value()) {
+            return;
+        }
+
+        this->metricsExporter = std::make_unique<MetricsExporter>(
+            this->projectConfig->metricsIpAddress,
+            this->projectConfig->metricsPortNumber.value()
+        );
+
+        this->metricsExporterThread = std::thread(&MetricsExporter::run, this->metricsExporter.get());
+    }
+
+    void Application::stopMetricsExporter() {
+        if (this->metricsExporter == nullptr) {
+            return;
+        }
+
+        this->metricsExporter->triggerShutdown();
+
+        if (this->metricsExporterThread.joinable()) {
+            Logger::debug("Joining MetricsExporter thread");
+            this->metricsExporterThread.join();
+            Logger::debug("MetricsExporter thread joined");
+        }
+    }
+
     void Application::onShutdownApplicationRequest(const Events::ShutdownApplication&) {
         Logger::debug("ShutdownApplication event received.");
         this->shutdown();
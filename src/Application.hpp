@@ -12,8 +12,8 @@
 
 #include "src/TargetController/TargetControllerComponent.hpp"
 #include "src/DebugServer/DebugServerComponent.hpp"
-#include "src/Insight/Insight.hpp"
 #include "src/SignalHandler/SignalHandler.hpp"
+#include "src/MetricsExporter/MetricsExporter.hpp"
 
 #include "src/ProjectConfig.hpp"
 #include "src/ProjectSettings.hpp"
@@ -23,6 +23,10 @@
 
 #include "src/VersionNumber.hpp"
 
+#ifndef BLOOM_EXCLUDE_INSIGHT
+#include "src/Insight/Insight.hpp"
+#endif
+
 namespace Bloom
 {
     /**
@@ -80,6 +84,15 @@ namespace Bloom
         std::unique_ptr<DebugServer::DebugServerComponent> debugServer = nullptr;
         std::thread debugServerThread;
 
+        /**
+         * The MetricsExporter serves Bloom's runtime performance counters over HTTP. It's optional (see
+         * ProjectConfig::metricsPortNumber) and runs on a dedicated thread.
+         *
+         * See the MetricsExporter class for more on this.
+         */
+        std::unique_ptr<MetricsExporter> metricsExporter = nullptr;
+        std::thread metricsExporterThread;
+
         /**
          * Insight is, effectively, a small Qt application that serves a GUI to the user. It occupies the main thread,
          * as well as a single worker thread, and possibly other threads created by Qt.
@@ -93,8 +106,12 @@ namespace Bloom
          * std::optional here because the Insight class extends QObject, which disables the copy constructor and
          * the assignment operator. So we use an std::unique_ptr instead, which is perfectly fine for this use case,
          * as we want to manage the lifetime of the object here.
+         *
+         * Headless builds (see the EXCLUDE_INSIGHT CMake option) don't include Insight at all.
          */
+#ifndef BLOOM_EXCLUDE_INSIGHT
         std::unique_ptr<Insight> insight = nullptr;
+#endif
 
         /**
          * Configuration extracted from the user's project configuration file.
@@ -148,7 +165,7 @@ namespace Bloom
         void loadProjectSettings();
 
         /**
-         * Saves the current project settings.
+         * Saves the current project settings, and waits for the settings file to be written.
          */
         void saveProjectSettings();
 
@@ -191,6 +208,56 @@ namespace Bloom
          */
         int initProject();
 
+        /**
+         * Produces the binary form of every TDF in the given directory (or Bloom's TDF resources directory, if no
+         * directory is given). See Targets::TargetDescription::TargetDescriptionFile::compileToBinary() for more.
+         *
+         * The TDFs are compiled in parallel, with one worker per core.
+         *
+         * This is invoked at build time, and is not advertised in the help text.
+         *
+         * @return
+         */
+        int compileTargetDescriptionFiles();
+
+        /**
+         * Runs the hardware benchmark (see the HardwareBenchmark class) against the selected environment's debug
+         * tool and target, and outputs the results in JSON format.
+         *
+         * Usage: bloom --benchmark [ENVIRONMENT_NAME] [--include-flash] [--output=<file>]
+         *
+         * Only the TargetController is started - the debug server and Insight are not.
+         *
+         * @return
+         */
+        int runHardwareBenchmark();
+
+        /**
+         * Writes a program image (ELF or Intel HEX) to the targets of the given environments, in parallel, via the
+         * ParallelProgrammer, and outputs an aggregate report in JSON format.
+         *
+         * Usage: bloom program <IMAGE_FILE> [--environments=<NAME>,<NAME>,...] [--output=<file>]
+         *
+         * If no environments are given, the "default" environment is used. Only the TargetControllers are started -
+         * the debug server and Insight are not.
+         *
+         * @return
+         */
+        int runParallelProgrammer();
+
+        /**
+         * Captures a memory snapshot from the selected environment's target, via the MemorySnapshotService, and
+         * outputs a summary in JSON format. The snapshot is stored with the snapshots captured in Insight.
+         *
+         * Usage: bloom snapshot <NAME> [ram|eeprom|flash] [ENVIRONMENT_NAME] [--description=<text>]
+         *
+         * If the target is running, it's stopped for the duration of the capture, and resumed afterwards. Only the
+         * TargetController is started - the debug server and Insight are not.
+         *
+         * @return
+         */
+        int runSnapshotCapture();
+
         /**
          * Prepares a dedicated thread for the SignalHandler and kicks it off with a call to SignalHandler::run().
          */
@@ -204,9 +271,18 @@ namespace Bloom
         /**
          * Prepares a dedicated thread for the TargetController and kicks it off with a call to
          * TargetControllerComponent::run().
+         *
+         * This doesn't wait for the TargetController to start up - see Application::waitForTargetControllerStartup().
          */
         void startTargetController();
 
+        /**
+         * Waits for the TargetController to finish starting up (which includes acquiring the hardware).
+         *
+         * Throws an exception if the TargetController fails to start up.
+         */
+        void waitForTargetControllerStartup();
+
         /**
          * Invokes a clean shutdown of the TargetController. The TargetController should disconnect from the target
          * and debug tool in a clean and safe manner, ensuring that both are left in a sensible state.
@@ -225,6 +301,17 @@ namespace Bloom
          */
         void stopDebugServer();
 
+        /**
+         * Prepares a dedicated thread for the MetricsExporter and kicks it off with a call to MetricsExporter::run(),
+         * if the user has enabled the exporter in their project configuration.
+         */
+        void startMetricsExporter();
+
+        /**
+         * Sends a shutdown request to the MetricsExporter and waits on the dedicated thread to exit.
+         */
+        void stopMetricsExporter();
+
         /**
          * Triggers a shutdown of Bloom and all of its components.
          */
@@ -0,0 +1,306 @@
+#include "Connection.hpp"
+
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <array>
+#include <QJsonDocument>
+#include <QJsonParseError>
+
+#include "src/DebugServer/Gdb/Exceptions/ClientDisconnected.hpp"
+#include "src/DebugServer/Gdb/Exceptions/DebugServerInterrupted.hpp"
+#include "src/DebugServer/Gdb/Exceptions/ClientCommunicationError.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Dap
+{
+    using namespace Gdb::Exceptions;
+    using namespace Bloom::Exceptions;
+
+    Connection::Connection(int serverSocketFileDescriptor, EventFdNotifier& interruptEventNotifier)
+        : interruptEventNotifier(interruptEventNotifier)
+        , readBuffer(Connection::READ_BUFFER_SIZE, 0x00)
+    {
+        this->accept(serverSocketFileDescriptor);
+
+        ::fcntl(
+            this->socketFileDescriptor.value(),
+            F_SETFL,
+            ::fcntl(this->socketFileDescriptor.value(), F_GETFL, 0) | O_NONBLOCK
+        );
+
+        this->epollInstance.addEntry(
+            this->socketFileDescriptor.value(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
+        );
+
+        this->epollInstance.addEntry(
+            this->interruptEventNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
+        );
+    }
+
+    Connection::~Connection() {
+        this->close();
+    }
+
+    std::string Connection::getClientAddress() const {
+        std::array<char, INET_ADDRSTRLEN> ipAddress = {};
+
+        if (::inet_ntop(AF_INET, &(this->socketAddress.sin_addr), ipAddress.data(), INET_ADDRSTRLEN) == nullptr) {
+            throw Exception("Failed to convert client IP address to text form.");
+        }
+
+        return std::string(ipAddress.data());
+    }
+
+    void Connection::setWakeupNotifier(EventFdNotifier& wakeupNotifier) {
+        if (this->wakeupNotifier != nullptr) {
+            this->epollInstance.removeEntry(this->wakeupNotifier->getFileDescriptor());
+        }
+
+        this->wakeupNotifier = &wakeupNotifier;
+        this->epollInstance.addEntry(
+            this->wakeupNotifier->getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
+        );
+    }
+
+    std::vector<QJsonObject> Connection::readMessages() {
+        auto output = std::vector<QJsonObject>();
+
+        if (this->wakeupPending) {
+            // The wakeup arrived alongside data from the client, in a previous read
+            this->wakeupPending = false;
+            return output;
+        }
+
+        do {
+            const auto bytesRead = this->read();
+
+            if (bytesRead > 0) {
+                this->inputBuffer.append(reinterpret_cast<const char*>(this->readBuffer.data()), bytesRead);
+                this->parseMessages(output);
+            }
+
+            if (output.empty() && this->wakeupPending) {
+                // Any partially received message is retained in the input buffer, until the next call
+                this->wakeupPending = false;
+                break;
+            }
+
+        } while (output.empty());
+
+        return output;
+    }
+
+    void Connection::writeMessage(const QJsonObject& message) {
+        const auto content = QJsonDocument(message).toJson(QJsonDocument::Compact);
+
+        if (Logger::isDebugLoggingEnabled()) {
+            Logger::debug("Writing DAP message: " + content.toStdString());
+        }
+
+        this->write(QByteArray("Content-Length: ") + QByteArray::number(content.size()) + "\r\n\r\n" + content);
+    }
+
+    void Connection::accept(int serverSocketFileDescriptor) {
+        auto socketAddressLength = static_cast<socklen_t>(sizeof(this->socketAddress));
+
+        const auto socketFileDescriptor = ::accept(
+            serverSocketFileDescriptor,
+            reinterpret_cast<sockaddr*>(&(this->socketAddress)),
+            &socketAddressLength
+        );
+
+        if (socketFileDescriptor < 0) {
+            throw Exception("Failed to accept DAP connection");
+        }
+
+        this->socketFileDescriptor = socketFileDescriptor;
+    }
+
+    void Connection::close() noexcept {
+        if (this->socketFileDescriptor.value_or(-1) >= 0) {
+            ::close(this->socketFileDescriptor.value());
+            this->socketFileDescriptor = std::nullopt;
+        }
+    }
+
+    std::size_t Connection::read() {
+        /*
+         * As with Gdb::Connection::read(), we don't clear the interrupt event notifier before waiting, as it could be
+         * carrying a notification for events that have yet to be dispatched.
+         */
+        auto events = std::array<struct ::epoll_event, 3>();
+        const auto eventCount = this->epollInstance.waitForEvents(events);
+
+        auto interrupted = false;
+        auto socketReadable = false;
+
+        for (auto eventIndex = std::size_t(0); eventIndex < eventCount; ++eventIndex) {
+            const auto eventFileDescriptor = events[eventIndex].data.fd;
+
+            if (eventFileDescriptor == this->interruptEventNotifier.getFileDescriptor()) {
+                interrupted = true;
+                continue;
+            }
+
+            if (this->wakeupNotifier != nullptr && eventFileDescriptor == this->wakeupNotifier->getFileDescriptor()) {
+                this->wakeupNotifier->clear();
+                this->wakeupPending = true;
+                continue;
+            }
+
+            socketReadable = true;
+        }
+
+        if (interrupted) {
+            this->interruptEventNotifier.clear();
+            throw DebugServerInterrupted();
+        }
+
+        if (!socketReadable) {
+            return 0;
+        }
+
+        const auto bytesRead = ::read(
+            this->socketFileDescriptor.value(),
+            this->readBuffer.data(),
+            this->readBuffer.size()
+        );
+
+        if (bytesRead < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                // Spurious wakeup - nothing to read
+                return 0;
+            }
+
+            throw ClientCommunicationError(
+                "Failed to read data from DAP client - error code: " + std::to_string(errno)
+            );
+        }
+
+        if (bytesRead == 0) {
+            // Client has disconnected
+            throw ClientDisconnected();
+        }
+
+        return static_cast<std::size_t>(bytesRead);
+    }
+
+    void Connection::parseMessages(std::vector<QJsonObject>& messages) {
+        static const auto headerDelimiter = QByteArray("\r\n\r\n");
+        static const auto contentLengthField = QByteArray("Content-Length:");
+
+        while (!this->inputBuffer.isEmpty()) {
+            const auto headerEnd = this->inputBuffer.indexOf(headerDelimiter);
+
+            if (headerEnd < 0) {
+                if (this->inputBuffer.size() > Connection::MAXIMUM_HEADER_SIZE) {
+                    throw ClientCommunicationError("Invalid DAP message header - header too long");
+                }
+
+                // The rest of the header is yet to arrive
+                return;
+            }
+
+            auto contentLength = std::optional<qsizetype>();
+
+            for (const auto& headerField : this->inputBuffer.left(headerEnd).split('\n')) {
+                const auto field = headerField.trimmed();
+
+                if (field.startsWith(contentLengthField)) {
+                    auto valid = false;
+                    const auto length = field.mid(contentLengthField.size()).trimmed().toLongLong(&valid);
+
+                    if (valid && length >= 0 && length <= Connection::MAXIMUM_MESSAGE_SIZE) {
+                        contentLength = static_cast<qsizetype>(length);
+                    }
+                }
+            }
+
+            if (!contentLength.has_value()) {
+                throw ClientCommunicationError("Invalid DAP message header - missing or invalid Content-Length field");
+            }
+
+            const auto contentStart = headerEnd + headerDelimiter.size();
+
+            if ((this->inputBuffer.size() - contentStart) < *contentLength) {
+                // The rest of the content is yet to arrive
+                return;
+            }
+
+            auto parseError = QJsonParseError();
+            const auto document = QJsonDocument::fromJson(
+                this->inputBuffer.mid(contentStart, *contentLength),
+                &parseError
+            );
+
+            if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
+                throw ClientCommunicationError(
+                    "Failed to parse DAP message - " + parseError.errorString().toStdString()
+                );
+            }
+
+            if (Logger::isDebugLoggingEnabled()) {
+                Logger::debug(
+                    "Read DAP message: " + this->inputBuffer.mid(contentStart, *contentLength).toStdString()
+                );
+            }
+
+            this->inputBuffer.remove(0, contentStart + *contentLength);
+            messages.emplace_back(document.object());
+        }
+    }
+
+    void Connection::write(const QByteArray& data) {
+        auto bytesRemaining = static_cast<std::size_t>(data.size());
+        auto* nextByte = data.constData();
+
+        while (bytesRemaining > 0) {
+            const auto bytesWritten = ::write(this->socketFileDescriptor.value(), nextByte, bytesRemaining);
+
+            if (bytesWritten < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    // The socket's send buffer is full - wait for the client to catch up
+                    auto pollDescriptor = ::pollfd{
+                        .fd = this->socketFileDescriptor.value(),
+                        .events = POLLOUT,
+                        .revents = 0,
+                    };
+
+                    if (::poll(&pollDescriptor, 1, 5000) == 0) {
+                        throw ClientCommunicationError("Timed out waiting for DAP client to accept data");
+                    }
+
+                    if ((pollDescriptor.revents & (POLLERR | POLLHUP)) != 0) {
+                        throw ClientDisconnected();
+                    }
+
+                    continue;
+                }
+
+                if (errno == EPIPE || errno == ECONNRESET) {
+                    throw ClientDisconnected();
+                }
+
+                throw ClientCommunicationError(
+                    "Failed to write to DAP client socket - error no: " + std::to_string(errno)
+                );
+            }
+
+            nextByte += bytesWritten;
+            bytesRemaining -= static_cast<std::size_t>(bytesWritten);
+        }
+    }
+}
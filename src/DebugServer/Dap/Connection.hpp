@@ -0,0 +1,179 @@
+#pragma once
+
+#include <netinet/in.h>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <string>
+#include <QByteArray>
+#include <QJsonObject>
+
+#include "src/Helpers/EventFdNotifier.hpp"
+#include "src/Helpers/EpollInstance.hpp"
+
+namespace Bloom::DebugServer::Dap
+{
+    /**
+     * The Connection class represents an active connection between the DAP server and client.
+     *
+     * DAP messages are JSON objects, each preceded by a header consisting of a Content-Length field, which holds the
+     * size of the JSON content, in bytes:
+     *
+     *  Content-Length: 119\r\n
+     *  \r\n
+     *  {"seq": 1, "type": "request", "command": "initialize", ...}
+     *
+     * See the "Base Protocol" section of https://microsoft.github.io/debug-adapter-protocol/specification for more.
+     */
+    class Connection
+    {
+    public:
+        /**
+         * The maximum number of bytes to read from the socket in a single read() call. Messages larger than this will
+         * be received over numerous reads.
+         */
+        static constexpr auto READ_BUFFER_SIZE = 65536;
+
+        /**
+         * The largest message we'll accept from the client. The largest messages are writeMemory requests, which the
+         * client should split up well before reaching this. In the event that the client sends anything larger, we
+         * assume the worst and kill the connection.
+         */
+        static constexpr auto MAXIMUM_MESSAGE_SIZE = 16 * 1024 * 1024;
+
+        /**
+         * The header only holds a couple of fields, so anything longer than this is garbage.
+         */
+        static constexpr auto MAXIMUM_HEADER_SIZE = 1024;
+
+        explicit Connection(int serverSocketFileDescriptor, EventFdNotifier& interruptEventNotifier);
+
+        Connection() = delete;
+        Connection(const Connection&) = delete;
+        Connection& operator = (Connection&) = delete;
+        Connection& operator = (Connection&&) = delete;
+
+        Connection(Connection&& other) noexcept
+            : socketFileDescriptor(other.socketFileDescriptor)
+            , socketAddress(other.socketAddress)
+            , interruptEventNotifier(other.interruptEventNotifier)
+            , epollInstance(std::move(other.epollInstance))
+            , wakeupNotifier(other.wakeupNotifier)
+            , wakeupPending(other.wakeupPending)
+            , readBuffer(std::move(other.readBuffer))
+            , inputBuffer(std::move(other.inputBuffer))
+        {
+            other.socketFileDescriptor = std::nullopt;
+        }
+
+        ~Connection();
+
+        /**
+         * Obtains the human readable IP address of the connected client.
+         *
+         * @return
+         */
+        [[nodiscard]] std::string getClientAddress() const;
+
+        /**
+         * Sets the wakeup notifier for this connection.
+         *
+         * The wakeup notifier is monitored alongside the client socket, whenever we wait for incoming data from the
+         * client. When the notifier is signalled, Connection::readMessages() will return without any messages,
+         * allowing the caller to service whatever the notifier represents (typically target execution events), before
+         * resuming the wait.
+         *
+         * See Gdb::Connection::setWakeupNotifier() - this works in the same way.
+         *
+         * @param wakeupNotifier
+         */
+        void setWakeupNotifier(EventFdNotifier& wakeupNotifier);
+
+        /**
+         * Waits for incoming data from the client and returns the DAP messages.
+         *
+         * This function will not return until at least one complete message has been received, or the wakeup notifier
+         * has been signalled, in which case an empty vector will be returned.
+         *
+         * @throws ClientCommunicationError
+         *  If the client sent a malformed message.
+         *
+         * @return
+         *  The messages, in the order in which they were received. DAP clients routinely send several requests at once
+         *  (VS Code sends the stackTrace, scopes and variables requests for a stop in quick succession, for example),
+         *  so this will often hold more than one message.
+         */
+        std::vector<QJsonObject> readMessages();
+
+        /**
+         * Sends a message to the client.
+         *
+         * @param message
+         */
+        void writeMessage(const QJsonObject& message);
+
+    private:
+        std::optional<int> socketFileDescriptor;
+
+        struct sockaddr_in socketAddress = {};
+
+        /**
+         * See Gdb::Connection::interruptEventNotifier.
+         */
+        EventFdNotifier& interruptEventNotifier;
+        EpollInstance epollInstance = EpollInstance();
+
+        EventFdNotifier* wakeupNotifier = nullptr;
+        bool wakeupPending = false;
+
+        /**
+         * Buffer for data read from the client socket. This is allocated once and reused for every read.
+         */
+        std::vector<unsigned char> readBuffer;
+
+        /**
+         * Data received from the client that is yet to be parsed - typically the beginning of a message whose
+         * remainder is yet to arrive.
+         */
+        QByteArray inputBuffer;
+
+        /**
+         * Accepts a connection on serverSocketFileDescriptor.
+         *
+         * @param serverSocketFileDescriptor
+         */
+        void accept(int serverSocketFileDescriptor);
+
+        /**
+         * Closes the connection with the client.
+         */
+        void close() noexcept;
+
+        /**
+         * Waits for data from the client and reads it into this->readBuffer.
+         *
+         * @throws DebugServerInterrupted
+         *  If the wait was interrupted via this->interruptEventNotifier.
+         *
+         * @return
+         *  The number of bytes read. Zero if the wait ended without any data (a wakeup, for example).
+         */
+        std::size_t read();
+
+        /**
+         * Extracts all complete messages from this->inputBuffer.
+         *
+         * @param messages
+         *  The vector to append the messages to.
+         */
+        void parseMessages(std::vector<QJsonObject>& messages);
+
+        /**
+         * Writes the given data to the client socket, waiting for the client to accept it if the socket's send buffer
+         * is full.
+         *
+         * @param data
+         */
+        void write(const QByteArray& data);
+    };
+}
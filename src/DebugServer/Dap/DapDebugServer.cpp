@@ -0,0 +1,1159 @@
+#include "DapDebugServer.hpp"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <iomanip>
+#include <QJsonArray>
+#include <QJsonValue>
+#include <QByteArray>
+
+#include "src/EventManager/EventManager.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Services/SymbolService.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Services/MetricsService.hpp"
+#include "src/Services/TraceService.hpp"
+
+#include "src/DebugServer/Gdb/Exceptions/ClientDisconnected.hpp"
+#include "src/DebugServer/Gdb/Exceptions/ClientCommunicationError.hpp"
+#include "src/DebugServer/Gdb/Exceptions/DebugSessionInitialisationFailure.hpp"
+#include "src/DebugServer/Gdb/Exceptions/DebugServerInterrupted.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+#include "src/Exceptions/InvalidConfig.hpp"
+
+#include "src/TargetController/Commands/CommandBatch.hpp"
+#include "src/TargetController/Commands/SetBreakpoint.hpp"
+#include "src/TargetController/Commands/RemoveBreakpoint.hpp"
+
+namespace Bloom::DebugServer::Dap
+{
+    using namespace Gdb::Exceptions;
+    using namespace Bloom::Exceptions;
+
+    using Services::SymbolService;
+
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetRegister;
+    using Targets::TargetRegisterDescriptor;
+    using Targets::TargetRegisterDescriptors;
+
+    using TargetController::TargetControllerState;
+
+    DapDebugServer::DapDebugServer(
+        const DebugServerConfig& debugServerConfig,
+        EventListener& eventListener,
+        EventFdNotifier& eventNotifier
+    )
+        : debugServerConfig(DapDebugServerConfig(debugServerConfig))
+        , eventListener(eventListener)
+        , interruptEventNotifier(eventNotifier)
+    {}
+
+    void DapDebugServer::init() {
+        this->serverSocketFileDescriptor = this->createTcpServerSocket();
+
+        if (::listen(this->serverSocketFileDescriptor.value(), 3) != 0) {
+            throw Exception("Failed to listen on server socket");
+        }
+
+        this->eventLoop.watch(
+            this->serverSocketFileDescriptor.value(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                this->connectionPending = true;
+            }
+        );
+
+        this->eventLoop.watch(
+            this->interruptEventNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                this->interruptEventNotifier.clear();
+                this->interrupted = true;
+            }
+        );
+
+        this->eventLoop.watch(
+            this->executionEventNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                // There is no client to report to - we dispatch the events to prevent them from piling up
+                this->executionEventNotifier.clear();
+                this->executionEventListener->dispatchCurrentEvents();
+                this->interrupted = true;
+            }
+        );
+
+        Logger::info("DAP address: " + this->debugServerConfig.listeningAddress);
+        Logger::info("DAP port: " + std::to_string(this->debugServerConfig.listeningPortNumber));
+
+        this->eventListener.registerCallbackForEventType<Events::TargetControllerStateChanged>(
+            std::bind(&DapDebugServer::onTargetControllerStateChanged, this, std::placeholders::_1)
+        );
+
+        this->executionEventListener->setInterruptEventNotifier(&this->executionEventNotifier);
+
+        this->executionEventListener->registerCallbackForEventType<Events::TargetExecutionStopped>(
+            std::bind(&DapDebugServer::onTargetExecutionStopped, this, std::placeholders::_1)
+        );
+
+        this->executionEventListener->registerCallbackForEventType<Events::TargetExecutionResumed>(
+            std::bind(&DapDebugServer::onTargetExecutionResumed, this, std::placeholders::_1)
+        );
+
+        EventManager::registerListener(this->executionEventListener);
+    }
+
+    void DapDebugServer::close() {
+        this->activeDebugSession.reset();
+
+        EventManager::deregisterListener(this->executionEventListener->getId());
+        this->executionEventListener->setInterruptEventNotifier(nullptr);
+
+        if (this->serverSocketFileDescriptor.has_value()) {
+            this->eventLoop.unwatch(this->serverSocketFileDescriptor.value());
+            ::close(this->serverSocketFileDescriptor.value());
+        }
+    }
+
+    void DapDebugServer::run() {
+        try {
+            if (!this->activeDebugSession.has_value()) {
+                Logger::info("Waiting for DAP connection");
+
+                auto connection = this->waitForConnection();
+                Logger::info("Accepted DAP connection from " + connection.getClientAddress());
+
+                this->startDebugSession(std::move(connection));
+            }
+
+            auto& debugSession = this->activeDebugSession.value();
+            const auto messages = debugSession.connection.readMessages();
+
+            if (messages.empty()) {
+                // A target execution event occurred - service it now, so that the client is notified immediately
+                this->executionEventListener->dispatchCurrentEvents();
+                return;
+            }
+
+            this->prefetchRegisters(debugSession, messages);
+
+            for (const auto& message : messages) {
+                if (message.value("type").toString() != "request") {
+                    // We never send reverse requests, so there should be nothing other than requests
+                    Logger::debug("Ignoring DAP message of type \"" + message.value("type").toString().toStdString()
+                        + "\"");
+                    continue;
+                }
+
+                this->handleRequest(debugSession, message);
+
+                if (debugSession.disconnectRequested) {
+                    Logger::info("DAP client disconnected");
+                    this->endDebugSession();
+                    return;
+                }
+            }
+
+        } catch (const ClientDisconnected&) {
+            Logger::info("DAP client disconnected");
+            this->endDebugSession();
+            return;
+
+        } catch (const ClientCommunicationError& exception) {
+            Logger::error("DAP client communication error - " + exception.getMessage() + " - closing connection");
+            this->endDebugSession();
+            return;
+
+        } catch (const DebugSessionInitialisationFailure& exception) {
+            Logger::warning("DAP debug session initialisation failure - " + exception.getMessage());
+            this->endDebugSession();
+            return;
+
+        } catch (const DebugServerInterrupted&) {
+            // Server was interrupted by an event
+            Logger::debug("DAP server interrupted");
+            return;
+        }
+    }
+
+    int DapDebugServer::createTcpServerSocket() {
+        auto socketAddress = sockaddr_in{};
+        socketAddress.sin_family = AF_INET;
+        socketAddress.sin_port = htons(this->debugServerConfig.listeningPortNumber);
+
+        if (::inet_pton(
+                AF_INET,
+                this->debugServerConfig.listeningAddress.c_str(),
+                &(socketAddress.sin_addr)
+            ) == 0
+        ) {
+            throw InvalidConfig(
+                "Invalid IP address provided in config file: (\"" + this->debugServerConfig.listeningAddress
+                    + "\")"
+            );
+        }
+
+        const auto socketFileDescriptor = ::socket(AF_INET, SOCK_STREAM, 0);
+
+        if (socketFileDescriptor < 0) {
+            throw Exception("Failed to create socket file descriptor.");
+        }
+
+        const auto enableReuseAddressSocketOption = 1;
+
+        if (::setsockopt(
+                socketFileDescriptor,
+                SOL_SOCKET,
+                SO_REUSEADDR,
+                &(enableReuseAddressSocketOption),
+                sizeof(enableReuseAddressSocketOption)
+            ) < 0
+        ) {
+            Logger::error("Failed to set socket SO_REUSEADDR option.");
+        }
+
+        // As with GDB RSP, DAP traffic consists of small request/response exchanges (inherited by client sockets)
+        const auto enableNoDelaySocketOption = 1;
+
+        if (::setsockopt(
+                socketFileDescriptor,
+                IPPROTO_TCP,
+                TCP_NODELAY,
+                &(enableNoDelaySocketOption),
+                sizeof(enableNoDelaySocketOption)
+            ) < 0
+        ) {
+            Logger::error("Failed to set socket TCP_NODELAY option.");
+        }
+
+        if (::bind(
+                socketFileDescriptor,
+                reinterpret_cast<const sockaddr*>(&socketAddress),
+                sizeof(socketAddress)
+            ) < 0
+        ) {
+            ::close(socketFileDescriptor);
+            throw Exception("Failed to bind address. The selected port number ("
+                + std::to_string(this->debugServerConfig.listeningPortNumber) + ") may be in use.");
+        }
+
+        return socketFileDescriptor;
+    }
+
+    Connection DapDebugServer::waitForConnection() {
+        this->connectionPending = false;
+        this->interrupted = false;
+
+        this->eventLoop.runOnce();
+
+        if (this->interrupted || !this->connectionPending) {
+            // Any pending connection will remain in the listen backlog, and we'll accept it on the next call
+            throw DebugServerInterrupted();
+        }
+
+        return Connection(this->serverSocketFileDescriptor.value(), this->interruptEventNotifier);
+    }
+
+    void DapDebugServer::startDebugSession(Connection&& connection) {
+        if (!this->targetControllerService.isTargetControllerInService()) {
+            // The TargetController is suspended - attempt to wake it up
+            try {
+                this->targetControllerService.resumeTargetController();
+
+            } catch (const Exception& exception) {
+                Logger::error("Failed to wake up TargetController - " + exception.getMessage());
+            }
+
+            if (!this->targetControllerService.isTargetControllerInService()) {
+                throw DebugSessionInitialisationFailure("TargetController not in service");
+            }
+        }
+
+        connection.setWakeupNotifier(this->executionEventNotifier);
+
+        this->activeDebugSession.emplace(std::move(connection), this->targetControllerService.getTargetDescriptor());
+
+        // As with GDB RSP sessions, we begin with the target stopped and reset
+        this->targetControllerService.stopTargetExecution();
+        this->targetControllerService.resetTarget();
+        this->activeDebugSession->programCounter = this->targetControllerService.getProgramCounter();
+    }
+
+    void DapDebugServer::endDebugSession() {
+        this->activeDebugSession.reset();
+    }
+
+    void DapDebugServer::prefetchRegisters(DebugSession& debugSession, const std::vector<QJsonObject>& messages) {
+        if (debugSession.targetRunning) {
+            return;
+        }
+
+        auto descriptors = TargetRegisterDescriptors();
+
+        for (const auto& message : messages) {
+            if (message.value("command").toString() != "variables") {
+                continue;
+            }
+
+            const auto* group = debugSession.registerGroup(
+                message.value("arguments").toObject().value("variablesReference").toInteger()
+            );
+
+            if (group == nullptr) {
+                continue;
+            }
+
+            for (const auto& descriptor : group->descriptors) {
+                if (!debugSession.registerValueCache.contains(descriptor)) {
+                    descriptors.insert(descriptor);
+                }
+            }
+        }
+
+        if (descriptors.empty()) {
+            return;
+        }
+
+        try {
+            for (auto& targetRegister : this->targetControllerService.readRegisters(descriptors)) {
+                debugSession.registerValueCache.insert_or_assign(
+                    targetRegister.descriptor,
+                    std::move(targetRegister.value)
+                );
+            }
+
+        } catch (const Exception& exception) {
+            // Each request will attempt its own read, and report its own error
+            Logger::debug("Failed to prefetch registers for DAP variables requests - " + exception.getMessage());
+        }
+    }
+
+    void DapDebugServer::handleRequest(DebugSession& debugSession, const QJsonObject& request) {
+        static const auto requestHandlersByCommand = std::map<std::string, RequestHandler>({
+            {"initialize", &DapDebugServer::handleInitialize},
+            {"launch", &DapDebugServer::handleLaunch},
+            {"attach", &DapDebugServer::handleAttach},
+            {"configurationDone", &DapDebugServer::handleConfigurationDone},
+            {"disconnect", &DapDebugServer::handleDisconnect},
+            {"threads", &DapDebugServer::handleThreads},
+            {"setBreakpoints", &DapDebugServer::handleSetBreakpoints},
+            {"setFunctionBreakpoints", &DapDebugServer::handleSetFunctionBreakpoints},
+            {"setInstructionBreakpoints", &DapDebugServer::handleSetInstructionBreakpoints},
+            {"setExceptionBreakpoints", &DapDebugServer::handleSetExceptionBreakpoints},
+            {"continue", &DapDebugServer::handleContinue},
+            {"next", &DapDebugServer::handleNext},
+            {"stepIn", &DapDebugServer::handleStepIn},
+            {"stepOut", &DapDebugServer::handleStepOut},
+            {"pause", &DapDebugServer::handlePause},
+            {"stackTrace", &DapDebugServer::handleStackTrace},
+            {"scopes", &DapDebugServer::handleScopes},
+            {"variables", &DapDebugServer::handleVariables},
+            {"setVariable", &DapDebugServer::handleSetVariable},
+            {"readMemory", &DapDebugServer::handleReadMemory},
+            {"writeMemory", &DapDebugServer::handleWriteMemory},
+        });
+
+        const auto command = request.value("command").toString().toStdString();
+        const auto handlerIt = requestHandlersByCommand.find(command);
+
+        if (handlerIt == requestHandlersByCommand.end()) {
+            Logger::debug("Unsupported DAP request: \"" + command + "\"");
+            debugSession.writeErrorResponse(request, "Unsupported request");
+            return;
+        }
+
+        Services::MetricsService::counter("dap.requests." + command).increment();
+
+        try {
+            auto responseBody = QJsonObject();
+
+            {
+                const auto traceSpan = Services::TraceService::Span("DapDebugServer::handleRequest", "DebugServer");
+                (this->*(handlerIt->second))(debugSession, request.value("arguments").toObject(), responseBody);
+            }
+
+            debugSession.writeResponse(request, responseBody);
+            debugSession.writeDeferredEvents();
+
+        } catch (const ClientDisconnected&) {
+            throw;
+
+        } catch (const ClientCommunicationError&) {
+            throw;
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to handle DAP \"" + command + "\" request - " + exception.getMessage());
+            debugSession.writeErrorResponse(request, exception.getMessage());
+        }
+    }
+
+    void DapDebugServer::handleInitialize(
+        DebugSession& debugSession,
+        const QJsonObject&,
+        QJsonObject& responseBody
+    ) {
+        responseBody = QJsonObject({
+            {"supportsConfigurationDoneRequest", true},
+            {"supportsFunctionBreakpoints", true},
+            {"supportsInstructionBreakpoints", true},
+            {"supportsSteppingGranularity", true},
+            {"supportsSetVariable", true},
+            {"supportsReadMemoryRequest", true},
+            {"supportsWriteMemoryRequest", true},
+        });
+
+        debugSession.deferEvent("initialized");
+    }
+
+    void DapDebugServer::handleLaunch(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject&) {
+        debugSession.stopOnEntry = arguments.value("stopOnEntry").toBool(false);
+    }
+
+    void DapDebugServer::handleAttach(DebugSession& debugSession, const QJsonObject&, QJsonObject&) {
+        debugSession.stopOnEntry = true;
+    }
+
+    void DapDebugServer::handleConfigurationDone(DebugSession& debugSession, const QJsonObject&, QJsonObject&) {
+        debugSession.configurationDone = true;
+
+        if (debugSession.stopOnEntry) {
+            debugSession.deferEvent("stopped", QJsonObject({
+                {"reason", "entry"},
+                {"threadId", DebugSession::THREAD_ID},
+                {"allThreadsStopped", true},
+            }));
+            return;
+        }
+
+        this->prepareForExecution(debugSession, std::nullopt);
+        this->targetControllerService.continueTargetExecution(std::nullopt, std::nullopt);
+    }
+
+    void DapDebugServer::handleDisconnect(DebugSession& debugSession, const QJsonObject&, QJsonObject&) {
+        // Breakpoints are cleared, and the target is released, by the TargetController, upon DebugSessionFinished
+        debugSession.disconnectRequested = true;
+    }
+
+    void DapDebugServer::handleThreads(DebugSession& debugSession, const QJsonObject&, QJsonObject& responseBody) {
+        responseBody.insert("threads", QJsonArray({
+            QJsonObject({
+                {"id", DebugSession::THREAD_ID},
+                {"name", QString::fromStdString(debugSession.targetDescriptor->name)},
+            }),
+        }));
+    }
+
+    void DapDebugServer::handleSetBreakpoints(DebugSession&, const QJsonObject& arguments, QJsonObject& responseBody) {
+        auto breakpoints = QJsonArray();
+
+        for (const auto& sourceBreakpoint : arguments.value("breakpoints").toArray()) {
+            breakpoints.append(QJsonObject({
+                {"verified", false},
+                {"line", sourceBreakpoint.toObject().value("line")},
+                {
+                    "message",
+                    "Source breakpoints are not supported by Bloom's DAP server - use function or instruction "
+                    "breakpoints"
+                },
+            }));
+        }
+
+        responseBody.insert("breakpoints", breakpoints);
+    }
+
+    void DapDebugServer::handleSetFunctionBreakpoints(
+        DebugSession& debugSession,
+        const QJsonObject& arguments,
+        QJsonObject& responseBody
+    ) {
+        const auto functionBreakpoints = arguments.value("breakpoints").toArray();
+        auto addresses = std::vector<std::optional<TargetMemoryAddress>>();
+        addresses.reserve(static_cast<std::size_t>(functionBreakpoints.size()));
+
+        for (const auto& functionBreakpoint : functionBreakpoints) {
+            const auto symbol = SymbolService::symbolByName(
+                functionBreakpoint.toObject().value("name").toString().toStdString()
+            );
+
+            addresses.emplace_back(
+                symbol.has_value() && symbol->memoryType == TargetMemoryType::FLASH
+                    ? std::optional(symbol->startAddress)
+                    : std::nullopt
+            );
+        }
+
+        auto newBreakpointAddresses = std::set<TargetMemoryAddress>();
+        for (const auto& address : addresses) {
+            if (address.has_value()) {
+                newBreakpointAddresses.insert(*address);
+            }
+        }
+
+        const auto failedAddresses = this->applyBreakpoints(
+            debugSession,
+            debugSession.functionBreakpointAddresses,
+            newBreakpointAddresses
+        );
+
+        auto breakpoints = QJsonArray();
+        for (const auto& address : addresses) {
+            if (!address.has_value()) {
+                breakpoints.append(QJsonObject({
+                    {"verified", false},
+                    {"message", "Function not found in the project's ELF file"},
+                }));
+                continue;
+            }
+
+            breakpoints.append(QJsonObject({
+                {"verified", !failedAddresses.contains(*address)},
+                {"instructionReference", DapDebugServer::addressToString(*address)},
+            }));
+        }
+
+        responseBody.insert("breakpoints", breakpoints);
+    }
+
+    void DapDebugServer::handleSetInstructionBreakpoints(
+        DebugSession& debugSession,
+        const QJsonObject& arguments,
+        QJsonObject& responseBody
+    ) {
+        const auto instructionBreakpoints = arguments.value("breakpoints").toArray();
+        auto addresses = std::vector<std::optional<TargetMemoryAddress>>();
+        addresses.reserve(static_cast<std::size_t>(instructionBreakpoints.size()));
+
+        for (const auto& instructionBreakpoint : instructionBreakpoints) {
+            const auto breakpointObject = instructionBreakpoint.toObject();
+            const auto address = DapDebugServer::parseUnsignedInteger(
+                breakpointObject.value("instructionReference").toString()
+            );
+
+            if (!address.has_value()) {
+                addresses.emplace_back(std::nullopt);
+                continue;
+            }
+
+            addresses.emplace_back(
+                static_cast<TargetMemoryAddress>(
+                    static_cast<std::int64_t>(*address) + breakpointObject.value("offset").toInteger(0)
+                )
+            );
+        }
+
+        auto newBreakpointAddresses = std::set<TargetMemoryAddress>();
+        for (const auto& address : addresses) {
+            if (address.has_value()) {
+                newBreakpointAddresses.insert(*address);
+            }
+        }
+
+        const auto failedAddresses = this->applyBreakpoints(
+            debugSession,
+            debugSession.instructionBreakpointAddresses,
+            newBreakpointAddresses
+        );
+
+        auto breakpoints = QJsonArray();
+        for (const auto& address : addresses) {
+            if (!address.has_value()) {
+                breakpoints.append(QJsonObject({
+                    {"verified", false},
+                    {"message", "Invalid instruction reference"},
+                }));
+                continue;
+            }
+
+            breakpoints.append(QJsonObject({
+                {"verified", !failedAddresses.contains(*address)},
+                {"instructionReference", DapDebugServer::addressToString(*address)},
+            }));
+        }
+
+        responseBody.insert("breakpoints", breakpoints);
+    }
+
+    void DapDebugServer::handleSetExceptionBreakpoints(DebugSession&, const QJsonObject&, QJsonObject&) {
+        // We advertise no exception breakpoint filters, so there's nothing to set
+    }
+
+    void DapDebugServer::handleContinue(DebugSession& debugSession, const QJsonObject&, QJsonObject& responseBody) {
+        this->prepareForExecution(debugSession, std::nullopt);
+        this->targetControllerService.continueTargetExecution(std::nullopt, std::nullopt);
+
+        responseBody.insert("allThreadsContinued", true);
+    }
+
+    void DapDebugServer::handleNext(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject&) {
+        this->prepareForExecution(debugSession, "step");
+
+        if (
+            arguments.value("granularity").toString() == "instruction"
+            || SymbolService::lineTable() == nullptr
+        ) {
+            this->targetControllerService.stepOverInstruction(std::nullopt);
+            return;
+        }
+
+        this->targetControllerService.stepSourceLine(true);
+    }
+
+    void DapDebugServer::handleStepIn(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject&) {
+        this->prepareForExecution(debugSession, "step");
+
+        if (
+            arguments.value("granularity").toString() == "instruction"
+            || SymbolService::lineTable() == nullptr
+        ) {
+            this->targetControllerService.stepTargetExecution(std::nullopt);
+            return;
+        }
+
+        this->targetControllerService.stepSourceLine(false);
+    }
+
+    void DapDebugServer::handleStepOut(DebugSession&, const QJsonObject&, QJsonObject&) {
+        throw Exception("Stepping out of functions is not supported");
+    }
+
+    void DapDebugServer::handlePause(DebugSession& debugSession, const QJsonObject&, QJsonObject&) {
+        if (!debugSession.targetRunning) {
+            return;
+        }
+
+        debugSession.pendingStopReason = "pause";
+        this->targetControllerService.stopTargetExecution();
+    }
+
+    void DapDebugServer::handleStackTrace(
+        DebugSession& debugSession,
+        const QJsonObject&,
+        QJsonObject& responseBody
+    ) {
+        /*
+         * We don't unwind the stack, so we only ever report the current frame. The program counter is taken from
+         * the stop, so this doesn't involve the target.
+         */
+        const auto programCounter = debugSession.programCounter;
+        auto frameName = DapDebugServer::addressToString(programCounter);
+
+        if (const auto symbol = SymbolService::symbolAt(TargetMemoryType::FLASH, programCounter)) {
+            frameName = QString::fromStdString(symbol->name);
+
+            if (programCounter != symbol->startAddress) {
+                frameName += " + " + QString::number(programCounter - symbol->startAddress);
+            }
+        }
+
+        responseBody = QJsonObject({
+            {"stackFrames", QJsonArray({
+                QJsonObject({
+                    {"id", 0},
+                    {"name", frameName},
+                    {"line", 0},
+                    {"column", 0},
+                    {"instructionPointerReference", DapDebugServer::addressToString(programCounter)},
+                }),
+            })},
+            {"totalFrames", 1},
+        });
+    }
+
+    void DapDebugServer::handleScopes(DebugSession& debugSession, const QJsonObject&, QJsonObject& responseBody) {
+        auto scopes = QJsonArray({
+            QJsonObject({
+                {"name", "CPU Registers"},
+                {"presentationHint", "registers"},
+                {"variablesReference", DebugSession::CPU_REGISTERS_VARIABLES_REFERENCE},
+                {"namedVariables", static_cast<qint64>(debugSession.cpuRegisterGroup.descriptors.size())},
+                {"expensive", false},
+            }),
+        });
+
+        if (!debugSession.peripheralRegisterGroups.empty()) {
+            /*
+             * Some peripheral registers have read side effects, so the peripherals scope is marked as expensive, to
+             * prevent the client from expanding it automatically. Expanding the scope itself doesn't involve the
+             * target - only expanding the individual peripherals does.
+             */
+            scopes.append(QJsonObject({
+                {"name", "Peripherals"},
+                {"variablesReference", DebugSession::PERIPHERALS_VARIABLES_REFERENCE},
+                {"namedVariables", static_cast<qint64>(debugSession.peripheralRegisterGroups.size())},
+                {"expensive", true},
+            }));
+        }
+
+        responseBody.insert("scopes", scopes);
+    }
+
+    void DapDebugServer::handleVariables(
+        DebugSession& debugSession,
+        const QJsonObject& arguments,
+        QJsonObject& responseBody
+    ) {
+        const auto variablesReference = arguments.value("variablesReference").toInteger();
+        auto variables = QJsonArray();
+
+        if (variablesReference == DebugSession::PERIPHERALS_VARIABLES_REFERENCE) {
+            for (auto index = std::size_t(0); index < debugSession.peripheralRegisterGroups.size(); ++index) {
+                const auto& group = debugSession.peripheralRegisterGroups[index];
+
+                variables.append(QJsonObject({
+                    {"name", QString::fromStdString(group.name)},
+                    {"value", QString::number(group.descriptors.size()) + " registers"},
+                    {
+                        "variablesReference",
+                        static_cast<qint64>(DebugSession::PERIPHERAL_VARIABLES_REFERENCE_BASE + index)
+                    },
+                    {"namedVariables", static_cast<qint64>(group.descriptors.size())},
+                }));
+            }
+
+            responseBody.insert("variables", variables);
+            return;
+        }
+
+        const auto* group = debugSession.registerGroup(variablesReference);
+        if (group == nullptr) {
+            throw Exception("Invalid variables reference");
+        }
+
+        this->readRegisterGroup(debugSession, *group);
+
+        for (const auto& descriptor : group->descriptors) {
+            const auto& value = debugSession.registerValueCache.at(descriptor);
+
+            auto variable = QJsonObject({
+                {"name", QString::fromStdString(descriptor.name.value_or("?"))},
+                {"value", "0x" + QString::fromStdString(Services::StringService::toHex(value))},
+                {"variablesReference", 0},
+            });
+
+            if (descriptor.memoryType == TargetMemoryType::RAM && descriptor.startAddress.has_value()) {
+                variable.insert(
+                    "memoryReference",
+                    DapDebugServer::addressToString(*descriptor.startAddress | DapDebugServer::RAM_MEMORY_OFFSET)
+                );
+            }
+
+            if (!descriptor.writable) {
+                variable.insert("presentationHint", QJsonObject({
+                    {"attributes", QJsonArray({"readOnly"})},
+                }));
+            }
+
+            variables.append(variable);
+        }
+
+        responseBody.insert("variables", variables);
+    }
+
+    void DapDebugServer::handleSetVariable(
+        DebugSession& debugSession,
+        const QJsonObject& arguments,
+        QJsonObject& responseBody
+    ) {
+        const auto* group = debugSession.registerGroup(arguments.value("variablesReference").toInteger());
+        if (group == nullptr) {
+            throw Exception("Invalid variables reference");
+        }
+
+        const auto name = arguments.value("name").toString().toStdString();
+        const auto descriptorIt = std::find_if(
+            group->descriptors.begin(),
+            group->descriptors.end(),
+            [&name] (const TargetRegisterDescriptor& descriptor) {
+                return descriptor.name.value_or("") == name;
+            }
+        );
+
+        if (descriptorIt == group->descriptors.end()) {
+            throw Exception("Unknown register \"" + name + "\"");
+        }
+
+        const auto& descriptor = *descriptorIt;
+        if (!descriptor.writable) {
+            throw Exception("Register \"" + name + "\" is not writable");
+        }
+
+        const auto value = DapDebugServer::parseUnsignedInteger(arguments.value("value").toString());
+        if (!value.has_value() || (descriptor.size < 8 && (*value >> (descriptor.size * 8)) != 0)) {
+            throw Exception(
+                "Invalid value - expected an unsigned integer that fits in " + std::to_string(descriptor.size)
+                    + " byte(s)"
+            );
+        }
+
+        // Register values are in MSB form
+        auto buffer = TargetMemoryBuffer(descriptor.size, 0x00);
+        for (auto index = std::size_t(0); index < buffer.size() && index < 8; ++index) {
+            buffer[buffer.size() - 1 - index] = static_cast<unsigned char>((*value >> (index * 8)) & 0xFF);
+        }
+
+        this->targetControllerService.writeRegisters({TargetRegister(descriptor, buffer)});
+        debugSession.registerValueCache.insert_or_assign(descriptor, buffer);
+
+        responseBody.insert("value", "0x" + QString::fromStdString(Services::StringService::toHex(buffer)));
+    }
+
+    void DapDebugServer::handleReadMemory(
+        DebugSession& debugSession,
+        const QJsonObject& arguments,
+        QJsonObject& responseBody
+    ) {
+        const auto location = this->resolveMemoryReference(debugSession, arguments);
+        const auto count = static_cast<TargetMemorySize>(std::max(arguments.value("count").toInteger(0), qint64(0)));
+
+        const auto& memoryDescriptor = debugSession.targetDescriptor->memoryDescriptorsByType.at(location.memoryType);
+
+        // In AVR targets, RAM is mapped to many registers and peripherals - these are all accessible
+        const auto permittedStartAddress = location.memoryType == TargetMemoryType::RAM
+            ? TargetMemoryAddress(0)
+            : memoryDescriptor.addressRange.startAddress;
+        const auto permittedEndAddress = memoryDescriptor.addressRange.endAddress;
+
+        auto readableBytes = TargetMemorySize(0);
+        if (location.address >= permittedStartAddress && location.address <= permittedEndAddress && count > 0) {
+            readableBytes = std::min(count, (permittedEndAddress - location.address) + 1);
+        }
+
+        responseBody.insert(
+            "address",
+            DapDebugServer::addressToString(
+                static_cast<TargetMemoryAddress>(
+                    static_cast<std::int64_t>(
+                        DapDebugServer::parseUnsignedInteger(arguments.value("memoryReference").toString()).value()
+                    ) + arguments.value("offset").toInteger(0)
+                )
+            )
+        );
+
+        if (readableBytes > 0) {
+            const auto data = this->targetControllerService.readMemory(
+                location.memoryType,
+                location.address,
+                readableBytes
+            );
+
+            responseBody.insert(
+                "data",
+                QString::fromLatin1(
+                    QByteArray(reinterpret_cast<const char*>(data.data()), static_cast<qsizetype>(data.size()))
+                        .toBase64()
+                )
+            );
+        }
+
+        if (readableBytes < count) {
+            responseBody.insert("unreadableBytes", static_cast<qint64>(count - readableBytes));
+        }
+    }
+
+    void DapDebugServer::handleWriteMemory(
+        DebugSession& debugSession,
+        const QJsonObject& arguments,
+        QJsonObject& responseBody
+    ) {
+        const auto location = this->resolveMemoryReference(debugSession, arguments);
+
+        if (location.memoryType == debugSession.targetDescriptor->programMemoryType) {
+            throw Exception("Program memory cannot be written via the writeMemory request - use \"monitor load\"");
+        }
+
+        const auto decodedData = QByteArray::fromBase64(arguments.value("data").toString().toLatin1());
+        const auto data = TargetMemoryBuffer(decodedData.begin(), decodedData.end());
+
+        const auto& memoryDescriptor = debugSession.targetDescriptor->memoryDescriptorsByType.at(location.memoryType);
+        const auto permittedStartAddress = location.memoryType == TargetMemoryType::RAM
+            ? TargetMemoryAddress(0)
+            : memoryDescriptor.addressRange.startAddress;
+
+        if (
+            !data.empty()
+            && (
+                location.address < permittedStartAddress
+                || (location.address + (data.size() - 1)) > memoryDescriptor.addressRange.endAddress
+            )
+        ) {
+            throw Exception("Memory write exceeds the boundaries of the target's memory");
+        }
+
+        if (!data.empty()) {
+            this->targetControllerService.writeMemory(location.memoryType, location.address, data);
+        }
+
+        // Any of the registers in the cache could be mapped to the memory we've just written to
+        debugSession.registerValueCache.clear();
+
+        responseBody.insert("bytesWritten", static_cast<qint64>(data.size()));
+    }
+
+    std::set<TargetMemoryAddress> DapDebugServer::applyBreakpoints(
+        DebugSession& debugSession,
+        std::set<TargetMemoryAddress>& breakpointAddresses,
+        const std::set<TargetMemoryAddress>& newBreakpointAddresses
+    ) {
+        using TargetController::Commands::SetBreakpoint;
+        using TargetController::Commands::RemoveBreakpoint;
+
+        const auto previousAddresses = debugSession.breakpointAddresses();
+        breakpointAddresses = newBreakpointAddresses;
+        const auto currentAddresses = debugSession.breakpointAddresses();
+
+        auto removedAddresses = std::vector<TargetMemoryAddress>();
+        std::set_difference(
+            previousAddresses.begin(),
+            previousAddresses.end(),
+            currentAddresses.begin(),
+            currentAddresses.end(),
+            std::back_inserter(removedAddresses)
+        );
+
+        auto addedAddresses = std::vector<TargetMemoryAddress>();
+        std::set_difference(
+            currentAddresses.begin(),
+            currentAddresses.end(),
+            previousAddresses.begin(),
+            previousAddresses.end(),
+            std::back_inserter(addedAddresses)
+        );
+
+        auto failedAddresses = std::set<TargetMemoryAddress>();
+
+        if (removedAddresses.empty() && addedAddresses.empty()) {
+            return failedAddresses;
+        }
+
+        auto commandBatch = std::make_unique<TargetController::Commands::CommandBatch>();
+
+        for (const auto address : removedAddresses) {
+            commandBatch->addCommand(std::make_unique<RemoveBreakpoint>(Targets::TargetBreakpoint(address)));
+        }
+
+        auto setBreakpointIndices = std::vector<std::pair<TargetMemoryAddress, std::size_t>>();
+        for (const auto address : addedAddresses) {
+            setBreakpointIndices.emplace_back(
+                address,
+                commandBatch->addCommand(std::make_unique<SetBreakpoint>(Targets::TargetBreakpoint(address)))
+            );
+        }
+
+        auto batchResponses = this->targetControllerService.sendCommandBatch(std::move(commandBatch));
+
+        for (auto index = std::size_t(0); index < removedAddresses.size(); ++index) {
+            try {
+                batchResponses->takeResponse<RemoveBreakpoint>(index);
+
+            } catch (const Exception& exception) {
+                Logger::error(
+                    "Failed to remove breakpoint at " + DapDebugServer::addressToString(removedAddresses[index])
+                        .toStdString() + " - " + exception.getMessage()
+                );
+            }
+        }
+
+        for (const auto& [address, index] : setBreakpointIndices) {
+            try {
+                batchResponses->takeResponse<SetBreakpoint>(index);
+
+            } catch (const Exception& exception) {
+                Logger::error(
+                    "Failed to set breakpoint at " + DapDebugServer::addressToString(address).toStdString() + " - "
+                        + exception.getMessage()
+                );
+                failedAddresses.insert(address);
+                breakpointAddresses.erase(address);
+            }
+        }
+
+        return failedAddresses;
+    }
+
+    void DapDebugServer::prepareForExecution(DebugSession& debugSession, std::optional<QString> stopReason) {
+        debugSession.targetRunning = true;
+        debugSession.pendingStopReason = std::move(stopReason);
+        debugSession.registerValueCache.clear();
+    }
+
+    void DapDebugServer::readRegisterGroup(DebugSession& debugSession, const RegisterGroup& group) {
+        auto descriptors = TargetRegisterDescriptors();
+        for (const auto& descriptor : group.descriptors) {
+            if (!debugSession.registerValueCache.contains(descriptor)) {
+                descriptors.insert(descriptor);
+            }
+        }
+
+        if (descriptors.empty()) {
+            return;
+        }
+
+        for (auto& targetRegister : this->targetControllerService.readRegisters(descriptors)) {
+            debugSession.registerValueCache.insert_or_assign(
+                targetRegister.descriptor,
+                std::move(targetRegister.value)
+            );
+        }
+
+        for (const auto& descriptor : descriptors) {
+            if (!debugSession.registerValueCache.contains(descriptor)) {
+                throw Exception("TargetController returned no value for register " + descriptor.name.value_or("?"));
+            }
+        }
+    }
+
+    DapDebugServer::MemoryLocation DapDebugServer::resolveMemoryReference(
+        const DebugSession& debugSession,
+        const QJsonObject& arguments
+    ) const {
+        const auto reference = DapDebugServer::parseUnsignedInteger(arguments.value("memoryReference").toString());
+        if (!reference.has_value()) {
+            throw Exception("Invalid memory reference");
+        }
+
+        const auto address = static_cast<std::int64_t>(*reference) + arguments.value("offset").toInteger(0);
+        if (address < 0) {
+            throw Exception("Invalid memory reference - negative address");
+        }
+
+        auto location = MemoryLocation();
+        const auto gdbAddress = static_cast<TargetMemoryAddress>(address);
+
+        if (gdbAddress >= DapDebugServer::EEPROM_MEMORY_OFFSET) {
+            location.memoryType = TargetMemoryType::EEPROM;
+            location.address = gdbAddress - DapDebugServer::EEPROM_MEMORY_OFFSET;
+
+        } else if (gdbAddress >= DapDebugServer::RAM_MEMORY_OFFSET) {
+            location.memoryType = TargetMemoryType::RAM;
+            location.address = gdbAddress - DapDebugServer::RAM_MEMORY_OFFSET;
+
+        } else {
+            location.memoryType = debugSession.targetDescriptor->programMemoryType;
+            location.address = gdbAddress;
+        }
+
+        const auto& memoryDescriptorsByType = debugSession.targetDescriptor->memoryDescriptorsByType;
+        const auto memoryDescriptorIt = memoryDescriptorsByType.find(location.memoryType);
+        if (memoryDescriptorIt == memoryDescriptorsByType.end()) {
+            throw Exception("Target does not support the referenced memory type");
+        }
+
+        if (location.memoryType == TargetMemoryType::EEPROM) {
+            // As with GDB, EEPROM addresses are relative to the start of EEPROM
+            location.address += memoryDescriptorIt->second.addressRange.startAddress;
+        }
+
+        return location;
+    }
+
+    std::optional<std::uint64_t> DapDebugServer::parseUnsignedInteger(const QString& value) {
+        auto valid = false;
+        const auto output = value.trimmed().toULongLong(&valid, 0);
+
+        if (!valid) {
+            return std::nullopt;
+        }
+
+        return static_cast<std::uint64_t>(output);
+    }
+
+    QString DapDebugServer::addressToString(TargetMemoryAddress address) {
+        return "0x" + QString::number(address, 16).rightJustified(6, '0');
+    }
+
+    void DapDebugServer::onTargetControllerStateChanged(const Events::TargetControllerStateChanged& event) {
+        if (event.state == TargetControllerState::SUSPENDED && this->activeDebugSession.has_value()) {
+            Logger::warning("TargetController suspended unexpectedly - terminating DAP debug session");
+
+            try {
+                this->activeDebugSession->writeEvent("terminated");
+
+            } catch (const Exception& exception) {
+                Logger::debug("Failed to notify DAP client of session termination - " + exception.getMessage());
+            }
+
+            this->activeDebugSession.reset();
+        }
+    }
+
+    void DapDebugServer::onTargetExecutionStopped(const Events::TargetExecutionStopped& event) {
+        if (!this->activeDebugSession.has_value()) {
+            return;
+        }
+
+        auto& debugSession = *(this->activeDebugSession);
+        debugSession.programCounter = event.programCounter;
+        debugSession.registerValueCache.clear();
+
+        if (!debugSession.targetRunning) {
+            return;
+        }
+
+        const auto stopReason = debugSession.pendingStopReason.value_or(
+            event.breakCause == Targets::TargetBreakCause::BREAKPOINT
+                && debugSession.breakpointAddresses().contains(event.programCounter)
+                ? "breakpoint"
+                : "pause"
+        );
+
+        debugSession.targetRunning = false;
+        debugSession.pendingStopReason = std::nullopt;
+
+        try {
+            debugSession.writeEvent("stopped", QJsonObject({
+                {"reason", stopReason},
+                {"threadId", DebugSession::THREAD_ID},
+                {"allThreadsStopped", true},
+            }));
+
+        } catch (const ClientDisconnected&) {
+            Logger::info("DAP client disconnected");
+            this->endDebugSession();
+
+        } catch (const ClientCommunicationError& exception) {
+            Logger::error("DAP client communication error - " + exception.getMessage() + " - closing connection");
+            this->endDebugSession();
+        }
+    }
+
+    void DapDebugServer::onTargetExecutionResumed(const Events::TargetExecutionResumed&) {
+        if (!this->activeDebugSession.has_value()) {
+            return;
+        }
+
+        auto& debugSession = *(this->activeDebugSession);
+        debugSession.registerValueCache.clear();
+
+        if (debugSession.targetRunning || !debugSession.configurationDone) {
+            return;
+        }
+
+        debugSession.targetRunning = true;
+
+        try {
+            debugSession.writeEvent("continued", QJsonObject({
+                {"threadId", DebugSession::THREAD_ID},
+                {"allThreadsContinued", true},
+            }));
+
+        } catch (const ClientDisconnected&) {
+            Logger::info("DAP client disconnected");
+            this->endDebugSession();
+
+        } catch (const ClientCommunicationError& exception) {
+            Logger::error("DAP client communication error - " + exception.getMessage() + " - closing connection");
+            this->endDebugSession();
+        }
+    }
+}
@@ -0,0 +1,322 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <memory>
+#include <QJsonObject>
+
+#include "src/DebugServer/ServerInterface.hpp"
+
+#include "DapDebugServerConfig.hpp"
+#include "Connection.hpp"
+#include "DebugSession.hpp"
+
+#include "src/EventManager/EventListener.hpp"
+#include "src/Helpers/EventLoop.hpp"
+#include "src/Helpers/EventFdNotifier.hpp"
+#include "src/Services/TargetControllerService.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+#include "src/EventManager/Events/TargetControllerStateChanged.hpp"
+#include "src/EventManager/Events/TargetExecutionStopped.hpp"
+#include "src/EventManager/Events/TargetExecutionResumed.hpp"
+
+namespace Bloom::DebugServer::Dap
+{
+    /**
+     * The DapDebugServer is an implementation of the Debug Adapter Protocol (DAP), for AVR targets.
+     *
+     * DAP clients (VS Code, for example) typically talk to GDB via a debug adapter, which then talks to the GDB RSP
+     * server. This server allows DAP clients to connect to Bloom directly, over a TCP/IP socket. Requests are
+     * serviced via the TargetControllerService, without any of the intermediate translation. The registers for
+     * multiple variables requests are read together, in a single operation.
+     *
+     * Memory references and instruction references are byte addresses in avr-gcc's address space - the same
+     * addresses that are used by GDB (RAM is found at 0x800000, EEPROM at 0x810000).
+     *
+     * The line table that we extract from the project's ELF file (see SymbolService) holds no line numbers, so
+     * source breakpoints are not supported. Function breakpoints and instruction breakpoints are, as is statement
+     * stepping.
+     *
+     * See https://microsoft.github.io/debug-adapter-protocol/specification for more on the Debug Adapter Protocol.
+     */
+    class DapDebugServer: public ServerInterface
+    {
+    public:
+        explicit DapDebugServer(
+            const DebugServerConfig& debugServerConfig,
+            EventListener& eventListener,
+            EventFdNotifier& eventNotifier
+        );
+
+        DapDebugServer() = delete;
+        ~DapDebugServer() override = default;
+
+        DapDebugServer(const DapDebugServer& other) = delete;
+        DapDebugServer(DapDebugServer&& other) = delete;
+
+        DapDebugServer& operator = (const DapDebugServer& other) = delete;
+        DapDebugServer& operator = (DapDebugServer&& other) = delete;
+
+        [[nodiscard]] std::string getName() const override {
+            return "Debug Adapter Protocol (DAP) DebugServer";
+        };
+
+        /**
+         * Prepares the DAP server for listening on the selected address and port.
+         */
+        void init() override;
+
+        /**
+         * Terminates any active debug session and closes the listening socket.
+         */
+        void close() override;
+
+        /**
+         * Waits for a connection from a DAP client or services an active one.
+         *
+         * This function will return when any blocking operation is interrupted via this->interruptEventNotifier.
+         */
+        void run() override;
+
+    private:
+        /**
+         * avr-gcc's (and GDB's) memory offsets. See Gdb::TargetDescriptor::memoryOffsetsByType.
+         */
+        static constexpr auto RAM_MEMORY_OFFSET = Targets::TargetMemoryAddress(0x800000);
+        static constexpr auto EEPROM_MEMORY_OFFSET = Targets::TargetMemoryAddress(0x810000);
+
+        /**
+         * A location in target memory, resolved from a DAP memory reference.
+         */
+        struct MemoryLocation
+        {
+            Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::RAM;
+            Targets::TargetMemoryAddress address = 0;
+        };
+
+        using RequestHandler = void (DapDebugServer::*)(
+            DebugSession& debugSession,
+            const QJsonObject& arguments,
+            QJsonObject& responseBody
+        );
+
+        DapDebugServerConfig debugServerConfig;
+
+        /**
+         * The DebugServerComponent's event listener.
+         */
+        EventListener& eventListener;
+
+        /**
+         * EventFdNotifier object for interrupting blocking I/O operations.
+         *
+         * See documentation in src/DebugServer/README.md for more.
+         */
+        EventFdNotifier& interruptEventNotifier;
+
+        /**
+         * A dedicated event listener for target execution events. See GdbRspDebugServer::executionEventListener -
+         * this serves the same purpose: it allows us to deliver "stopped" events to the client as soon as the target
+         * stops, without unwinding the current operation.
+         */
+        std::shared_ptr<EventListener> executionEventListener = std::make_shared<EventListener>(
+            "DapDebugServerExecutionEventListener"
+        );
+
+        EventFdNotifier executionEventNotifier = EventFdNotifier();
+
+        /**
+         * See GdbRspDebugServer::eventLoop.
+         */
+        EventLoop eventLoop;
+        bool connectionPending = false;
+        bool interrupted = false;
+
+        Services::TargetControllerService targetControllerService = Services::TargetControllerService();
+
+        std::optional<int> serverSocketFileDescriptor;
+
+        std::optional<DebugSession> activeDebugSession;
+
+        /**
+         * Creates and binds a TCP socket, for the configured IP address and port number.
+         *
+         * @return
+         *  The socket's file descriptor.
+         */
+        int createTcpServerSocket();
+
+        /**
+         * Waits for a DAP client to connect on the listening socket.
+         */
+        Connection waitForConnection();
+
+        /**
+         * Establishes a new debug session with a freshly connected client.
+         *
+         * @param connection
+         */
+        void startDebugSession(Connection&& connection);
+
+        void endDebugSession();
+
+        /**
+         * Reads the registers for all of the given variables requests (those that are yet to be cached - see
+         * DebugSession::registerValueCache), in a single operation.
+         *
+         * VS Code requests the variables of each expanded scope and peripheral in quick succession, upon every stop.
+         * We receive these requests together, so we can service all of them with a single register read.
+         *
+         * @param debugSession
+         * @param messages
+         */
+        void prefetchRegisters(DebugSession& debugSession, const std::vector<QJsonObject>& messages);
+
+        /**
+         * Dispatches the given request to the appropriate handler, and sends the response.
+         *
+         * @param debugSession
+         * @param request
+         */
+        void handleRequest(DebugSession& debugSession, const QJsonObject& request);
+
+        void handleInitialize(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleLaunch(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleAttach(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+
+        void handleConfigurationDone(
+            DebugSession& debugSession,
+            const QJsonObject& arguments,
+            QJsonObject& responseBody
+        );
+
+        void handleDisconnect(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleThreads(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+
+        void handleSetBreakpoints(
+            DebugSession& debugSession,
+            const QJsonObject& arguments,
+            QJsonObject& responseBody
+        );
+
+        void handleSetFunctionBreakpoints(
+            DebugSession& debugSession,
+            const QJsonObject& arguments,
+            QJsonObject& responseBody
+        );
+
+        void handleSetInstructionBreakpoints(
+            DebugSession& debugSession,
+            const QJsonObject& arguments,
+            QJsonObject& responseBody
+        );
+
+        void handleSetExceptionBreakpoints(
+            DebugSession& debugSession,
+            const QJsonObject& arguments,
+            QJsonObject& responseBody
+        );
+
+        void handleContinue(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleNext(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleStepIn(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleStepOut(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handlePause(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleStackTrace(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleScopes(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleVariables(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleSetVariable(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleReadMemory(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+        void handleWriteMemory(DebugSession& debugSession, const QJsonObject& arguments, QJsonObject& responseBody);
+
+        /**
+         * Replaces one kind of breakpoint (instruction or function breakpoints - see
+         * DebugSession::instructionBreakpointAddresses), and applies the resulting changes to the target, in a
+         * single command batch.
+         *
+         * @param debugSession
+         *
+         * @param breakpointAddresses
+         *  The breakpoint set to replace - one of debugSession.instructionBreakpointAddresses and
+         *  debugSession.functionBreakpointAddresses.
+         *
+         * @param newBreakpointAddresses
+         *
+         * @return
+         *  The addresses of any breakpoints that could not be set. These will have been removed from
+         *  breakpointAddresses.
+         */
+        std::set<Targets::TargetMemoryAddress> applyBreakpoints(
+            DebugSession& debugSession,
+            std::set<Targets::TargetMemoryAddress>& breakpointAddresses,
+            const std::set<Targets::TargetMemoryAddress>& newBreakpointAddresses
+        );
+
+        /**
+         * Marks the target as running, on behalf of the client, ahead of a request to resume or step execution.
+         *
+         * @param debugSession
+         *
+         * @param stopReason
+         *  The reason to report when the target next stops. If not provided, the reason will be determined from the
+         *  stop itself (see DapDebugServer::onTargetExecutionStopped()).
+         */
+        void prepareForExecution(DebugSession& debugSession, std::optional<QString> stopReason);
+
+        /**
+         * Reads the given register group, via debugSession.registerValueCache.
+         *
+         * @param debugSession
+         * @param group
+         */
+        void readRegisterGroup(DebugSession& debugSession, const RegisterGroup& group);
+
+        /**
+         * Resolves a memory reference and offset, from the arguments of a readMemory or writeMemory request.
+         *
+         * @param debugSession
+         * @param arguments
+         *
+         * @return
+         */
+        MemoryLocation resolveMemoryReference(const DebugSession& debugSession, const QJsonObject& arguments) const;
+
+        /**
+         * Parses an address (or other unsigned integer) from a DAP client - in hexadecimal form ("0x" prefix) or
+         * decimal form.
+         *
+         * @param value
+         *
+         * @return
+         */
+        static std::optional<std::uint64_t> parseUnsignedInteger(const QString& value);
+
+        static QString addressToString(Targets::TargetMemoryAddress address);
+
+        /**
+         * Responds to any unexpected TargetController state changes.
+         *
+         * @param event
+         */
+        void onTargetControllerStateChanged(const Events::TargetControllerStateChanged& event);
+
+        /**
+         * Sends a "stopped" event to the client, if the client believes the target to be running.
+         *
+         * @param event
+         */
+        void onTargetExecutionStopped(const Events::TargetExecutionStopped& event);
+
+        /**
+         * Sends a "continued" event to the client, if the target was resumed by something other than the client
+         * (Insight, for example).
+         */
+        void onTargetExecutionResumed(const Events::TargetExecutionResumed&);
+    };
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "src/ProjectConfig.hpp"
+
+namespace Bloom::DebugServer::Dap
+{
+    /**
+     * Extending the generic DebugServerConfig struct to accommodate DAP debug server configuration parameters.
+     */
+    class DapDebugServerConfig: public DebugServerConfig
+    {
+    public:
+        /**
+         * The port number for the DAP server to listen on.
+         *
+         * This parameter is optional. If not specified, the default value set here will be used.
+         */
+        std::uint16_t listeningPortNumber = 1443;
+
+        /**
+         * The address for the DAP server to listen on.
+         *
+         * This parameter is optional. If not specified, the default value set here will be used.
+         */
+        std::string listeningAddress = "127.0.0.1";
+
+        explicit DapDebugServerConfig(const DebugServerConfig& debugServerConfig);
+    };
+}
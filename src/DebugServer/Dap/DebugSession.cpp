@@ -0,0 +1,158 @@
+#include "DebugSession.hpp"
+
+#include <algorithm>
+#include <QJsonValue>
+
+#include "src/EventManager/EventManager.hpp"
+#include "src/Services/MetricsService.hpp"
+
+namespace Bloom::DebugServer::Dap
+{
+    using Targets::TargetRegisterDescriptor;
+    using Targets::TargetRegisterType;
+
+    DebugSession::DebugSession(
+        Connection&& connection,
+        std::shared_ptr<const Targets::TargetDescriptor> targetDescriptor
+    )
+        : connection(std::move(connection))
+        , targetDescriptor(std::move(targetDescriptor))
+    {
+        const auto& registerDescriptorsByType = this->targetDescriptor->registerDescriptorsByType;
+
+        this->cpuRegisterGroup.name = "CPU";
+        for (const auto registerType : {
+            TargetRegisterType::GENERAL_PURPOSE_REGISTER,
+            TargetRegisterType::PROGRAM_COUNTER,
+            TargetRegisterType::STACK_POINTER,
+            TargetRegisterType::STATUS_REGISTER,
+        }) {
+            const auto descriptorsIt = registerDescriptorsByType.find(registerType);
+            if (descriptorsIt != registerDescriptorsByType.end()) {
+                // The descriptors are ordered by start address, within each type
+                this->cpuRegisterGroup.descriptors.insert(
+                    this->cpuRegisterGroup.descriptors.end(),
+                    descriptorsIt->second.begin(),
+                    descriptorsIt->second.end()
+                );
+            }
+        }
+
+        // Peripheral registers are selected in the same way as for the "monitor svd" and "monitor regdump" commands
+        auto peripheralRegisterGroupsByName = std::map<std::string, RegisterGroup>();
+        for (const auto& [registerType, registerDescriptors] : registerDescriptorsByType) {
+            if (registerType != TargetRegisterType::OTHER && registerType != TargetRegisterType::PORT_REGISTER) {
+                continue;
+            }
+
+            for (const auto& descriptor : registerDescriptors) {
+                if (
+                    !descriptor.startAddress.has_value()
+                    || !descriptor.name.has_value()
+                    || descriptor.name->empty()
+                    || !descriptor.groupName.has_value()
+                    || !descriptor.readable
+                ) {
+                    continue;
+                }
+
+                auto& group = peripheralRegisterGroupsByName[*descriptor.groupName];
+                group.name = *descriptor.groupName;
+                group.descriptors.push_back(descriptor);
+            }
+        }
+
+        for (auto& [groupName, group] : peripheralRegisterGroupsByName) {
+            std::sort(
+                group.descriptors.begin(),
+                group.descriptors.end(),
+                [] (const TargetRegisterDescriptor& descriptorA, const TargetRegisterDescriptor& descriptorB) {
+                    return *descriptorA.startAddress < *descriptorB.startAddress;
+                }
+            );
+
+            this->peripheralRegisterGroups.emplace_back(std::move(group));
+        }
+
+        static auto& sessionCounter = Services::MetricsService::counter("debugServer.dapSessions");
+        sessionCounter.increment();
+
+        EventManager::triggerEvent(Events::makeEvent<Events::DebugSessionStarted>());
+    }
+
+    DebugSession::~DebugSession() {
+        EventManager::triggerEvent(Events::makeEvent<Events::DebugSessionFinished>());
+    }
+
+    std::set<Targets::TargetMemoryAddress> DebugSession::breakpointAddresses() const {
+        auto output = this->instructionBreakpointAddresses;
+        output.insert(this->functionBreakpointAddresses.begin(), this->functionBreakpointAddresses.end());
+        return output;
+    }
+
+    const RegisterGroup* DebugSession::registerGroup(std::int64_t variablesReference) const {
+        if (variablesReference == DebugSession::CPU_REGISTERS_VARIABLES_REFERENCE) {
+            return &(this->cpuRegisterGroup);
+        }
+
+        const auto peripheralIndex = variablesReference - DebugSession::PERIPHERAL_VARIABLES_REFERENCE_BASE;
+        if (
+            peripheralIndex >= 0
+            && peripheralIndex < static_cast<std::int64_t>(this->peripheralRegisterGroups.size())
+        ) {
+            return &(this->peripheralRegisterGroups[static_cast<std::size_t>(peripheralIndex)]);
+        }
+
+        return nullptr;
+    }
+
+    void DebugSession::writeResponse(const QJsonObject& request, const QJsonObject& body) {
+        auto response = QJsonObject({
+            {"seq", static_cast<qint64>(this->nextSequenceNumber++)},
+            {"type", "response"},
+            {"request_seq", request.value("seq")},
+            {"command", request.value("command")},
+            {"success", true},
+        });
+
+        if (!body.isEmpty()) {
+            response.insert("body", body);
+        }
+
+        this->connection.writeMessage(response);
+    }
+
+    void DebugSession::writeErrorResponse(const QJsonObject& request, const std::string& message) {
+        this->connection.writeMessage(QJsonObject({
+            {"seq", static_cast<qint64>(this->nextSequenceNumber++)},
+            {"type", "response"},
+            {"request_seq", request.value("seq")},
+            {"command", request.value("command")},
+            {"success", false},
+            {"message", QString::fromStdString(message)},
+        }));
+    }
+
+    void DebugSession::writeEvent(const QString& event, const QJsonObject& body) {
+        auto message = QJsonObject({
+            {"seq", static_cast<qint64>(this->nextSequenceNumber++)},
+            {"type", "event"},
+            {"event", event},
+        });
+
+        if (!body.isEmpty()) {
+            message.insert("body", body);
+        }
+
+        this->connection.writeMessage(message);
+    }
+
+    void DebugSession::writeDeferredEvents() {
+        auto deferredEvents = std::move(this->deferredEvents);
+        this->deferredEvents.clear();
+
+        for (const auto& [event, body] : deferredEvents) {
+            this->writeEvent(event, body);
+        }
+    }
+}
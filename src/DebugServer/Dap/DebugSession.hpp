@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <memory>
+#include <utility>
+#include <QJsonObject>
+#include <QString>
+
+#include "Connection.hpp"
+
+#include "src/Targets/TargetDescriptor.hpp"
+#include "src/Targets/TargetRegister.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Dap
+{
+    /**
+     * A group of registers, presented to the client as a container variable (a scope, or a peripheral within the
+     * "Peripherals" scope).
+     */
+    struct RegisterGroup
+    {
+        std::string name;
+
+        /**
+         * In ascending order of start address.
+         */
+        std::vector<Targets::TargetRegisterDescriptor> descriptors;
+    };
+
+    /**
+     * The DebugSession class holds the state of an active DAP debug session.
+     */
+    class DebugSession
+    {
+    public:
+        /**
+         * DAP variable references for the containers we expose. The references never change, as the register groups
+         * never change, so the client doesn't need to re-request scopes between stops (although it will).
+         *
+         * Peripheral i (in this->peripheralRegisterGroups) has the variable reference
+         * PERIPHERAL_VARIABLES_REFERENCE_BASE + i.
+         */
+        static constexpr auto CPU_REGISTERS_VARIABLES_REFERENCE = 1;
+        static constexpr auto PERIPHERALS_VARIABLES_REFERENCE = 2;
+        static constexpr auto PERIPHERAL_VARIABLES_REFERENCE_BASE = 1000;
+
+        /**
+         * We don't support RTOS thread awareness via DAP, so there's only ever one thread.
+         */
+        static constexpr auto THREAD_ID = 1;
+
+        Connection connection;
+
+        std::shared_ptr<const Targets::TargetDescriptor> targetDescriptor;
+
+        RegisterGroup cpuRegisterGroup;
+        std::vector<RegisterGroup> peripheralRegisterGroups;
+
+        /**
+         * Set upon the "attach" request. Attaching leaves the target stopped (reporting a stop with reason "entry"),
+         * whereas launching runs the target once the client has finished configuring the session, unless the client
+         * requested otherwise (via the "stopOnEntry" launch argument).
+         */
+        bool stopOnEntry = false;
+
+        /**
+         * True if the client believes the target to be running - that is, we've reported the target as running
+         * ("continue" response, "continued" event), and we're yet to report it as stopped ("stopped" event).
+         */
+        bool targetRunning = false;
+
+        /**
+         * The reason to report in the next "stopped" event, for stops that we initiated ("step", "pause"). Set when
+         * the stop is requested.
+         */
+        std::optional<QString> pendingStopReason = std::nullopt;
+
+        /**
+         * The program counter as of the most recent stop.
+         */
+        Targets::TargetProgramCounter programCounter = 0;
+
+        /**
+         * The client sets instruction breakpoints and function breakpoints independently - each request replaces all
+         * breakpoints of its kind. The two may share addresses, so we track them separately and apply the union of
+         * the two to the target (see DapDebugServer::applyBreakpoints()).
+         */
+        std::set<Targets::TargetMemoryAddress> instructionBreakpointAddresses;
+        std::set<Targets::TargetMemoryAddress> functionBreakpointAddresses;
+
+        /**
+         * Register values read since the most recent stop, mapped by descriptor. This saves us from reading the same
+         * registers repeatedly whilst the target is stopped (the client will re-request the variables of expanded
+         * scopes whenever it's refreshed), and allows us to read the registers for multiple variables requests in a
+         * single operation (see DapDebugServer::prefetchRegisters()).
+         *
+         * Cleared whenever the target stops or resumes execution.
+         */
+        std::map<Targets::TargetRegisterDescriptor, Targets::TargetMemoryBuffer> registerValueCache;
+
+        /**
+         * Set upon the "configurationDone" request. Until then, the client isn't ready to be told about changes to the
+         * target's execution state.
+         */
+        bool configurationDone = false;
+
+        /**
+         * Set upon the "disconnect" request. The session is ended once the response has gone out.
+         */
+        bool disconnectRequested = false;
+
+        DebugSession(Connection&& connection, std::shared_ptr<const Targets::TargetDescriptor> targetDescriptor);
+
+        DebugSession(const DebugSession& other) = delete;
+        DebugSession(DebugSession&& other) = delete;
+
+        DebugSession& operator = (const DebugSession& other) = delete;
+        DebugSession& operator = (DebugSession&& other) = delete;
+
+        ~DebugSession();
+
+        /**
+         * Returns all breakpoint addresses - the union of this->instructionBreakpointAddresses and
+         * this->functionBreakpointAddresses.
+         *
+         * @return
+         */
+        [[nodiscard]] std::set<Targets::TargetMemoryAddress> breakpointAddresses() const;
+
+        /**
+         * Finds the register group with the given variable reference.
+         *
+         * @param variablesReference
+         *
+         * @return
+         *  nullptr if the reference is invalid, or refers to the "Peripherals" scope (which holds no registers).
+         */
+        [[nodiscard]] const RegisterGroup* registerGroup(std::int64_t variablesReference) const;
+
+        void writeResponse(const QJsonObject& request, const QJsonObject& body = {});
+
+        void writeErrorResponse(const QJsonObject& request, const std::string& message);
+
+        void writeEvent(const QString& event, const QJsonObject& body = {});
+
+        /**
+         * Queues an event, to be sent once the response to the current request has gone out (see
+         * DebugSession::writeDeferredEvents()). Some events must follow the response to the request that caused them
+         * (the "initialized" event, for example, must follow the response to the "initialize" request).
+         *
+         * @param event
+         * @param body
+         */
+        void deferEvent(const QString& event, const QJsonObject& body = {}) {
+            this->deferredEvents.emplace_back(event, body);
+        }
+
+        void writeDeferredEvents();
+
+    private:
+        std::int64_t nextSequenceNumber = 1;
+
+        std::vector<std::pair<QString, QJsonObject>> deferredEvents;
+    };
+}
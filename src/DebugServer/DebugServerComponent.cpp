@@ -4,6 +4,8 @@
 
 // Debug server implementations
 #include "Gdb/AvrGdb/AvrGdbRsp.hpp"
+#include "Dap/DapDebugServer.hpp"
+#include "Scripting/ScriptingServer.hpp"
 
 #include "src/Exceptions/InvalidConfig.hpp"
 #include "src/Logger/Logger.hpp"
@@ -49,6 +51,26 @@ namespace Bloom::DebugServer
                     );
                 }
             },
+            {
+                "avr-dap",
+                [this] () -> std::unique_ptr<ServerInterface> {
+                    return std::make_unique<DebugServer::Dap::DapDebugServer>(
+                        this->debugServerConfig,
+                        *(this->eventListener.get()),
+                        this->interruptEventNotifier
+                    );
+                }
+            },
+            {
+                "scripting",
+                [this] () -> std::unique_ptr<ServerInterface> {
+                    return std::make_unique<DebugServer::Scripting::ScriptingServer>(
+                        this->debugServerConfig,
+                        *(this->eventListener.get()),
+                        this->interruptEventNotifier
+                    );
+                }
+            },
         };
     }
 
@@ -103,7 +125,7 @@ namespace Bloom::DebugServer
     void DebugServerComponent::setThreadStateAndEmitEvent(ThreadState state) {
         Thread::setThreadState(state);
         EventManager::triggerEvent(
-            std::make_shared<Events::DebugServerThreadStateChanged>(state)
+            Events::makeEvent<Events::DebugServerThreadStateChanged>(state)
         );
     }
 
@@ -1,12 +1,18 @@
 #include "AvrGdbRsp.hpp"
 
+#include <typeinfo>
+
 // Command packets
 #include "CommandPackets/ReadMemory.hpp"
 #include "CommandPackets/WriteMemory.hpp"
+#include "CommandPackets/WriteMemoryBinary.hpp"
 #include "CommandPackets/ReadMemoryMap.hpp"
+#include "CommandPackets/ReadTargetDescription.hpp"
 #include "CommandPackets/FlashErase.hpp"
 #include "CommandPackets/FlashWrite.hpp"
 #include "CommandPackets/FlashDone.hpp"
+#include "CommandPackets/ComputeMemoryCrc.hpp"
+#include "CommandPackets/SearchMemory.hpp"
 
 namespace Bloom::DebugServer::Gdb::AvrGdb
 {
@@ -23,12 +29,15 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
         : GdbRspDebugServer(debugServerConfig, eventListener, eventNotifier)
     {}
 
-    void AvrGdbRsp::init() {
-        DebugServer::Gdb::GdbRspDebugServer::init();
+    const Gdb::TargetDescriptor& AvrGdbRsp::getGdbTargetDescriptor() {
+        if (!this->gdbTargetDescriptor.has_value()) {
+            this->gdbTargetDescriptor = TargetDescriptor(
+                *(this->targetControllerService.getTargetDescriptor()),
+                this->debugServerConfig.peripheralRegisters
+            );
+        }
 
-        this->gdbTargetDescriptor = TargetDescriptor(
-            this->targetControllerService.getTargetDescriptor()
-        );
+        return this->gdbTargetDescriptor.value();
     }
 
     std::unique_ptr<Gdb::CommandPackets::CommandPacket> AvrGdbRsp::resolveCommandPacket(
@@ -36,13 +45,17 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
     ) {
         using AvrGdb::CommandPackets::ReadMemory;
         using AvrGdb::CommandPackets::WriteMemory;
+        using AvrGdb::CommandPackets::WriteMemoryBinary;
         using AvrGdb::CommandPackets::ReadMemoryMap;
+        using AvrGdb::CommandPackets::ReadTargetDescription;
         using AvrGdb::CommandPackets::FlashErase;
         using AvrGdb::CommandPackets::FlashWrite;
         using AvrGdb::CommandPackets::FlashDone;
+        using AvrGdb::CommandPackets::ComputeMemoryCrc;
+        using AvrGdb::CommandPackets::SearchMemory;
 
         if (rawPacket.size() >= 2) {
-            if (rawPacket[1] == 'm') {
+            if (rawPacket[1] == 'm' || rawPacket[1] == 'x') {
                 return std::make_unique<ReadMemory>(rawPacket, this->gdbTargetDescriptor.value());
             }
 
@@ -50,28 +63,64 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
                 return std::make_unique<WriteMemory>(rawPacket, this->gdbTargetDescriptor.value());
             }
 
-            const auto rawPacketString = std::string(rawPacket.begin() + 1, rawPacket.end());
+            if (rawPacket[1] == 'X') {
+                return std::make_unique<WriteMemoryBinary>(rawPacket, this->gdbTargetDescriptor.value());
+            }
 
-            if (rawPacketString.find("qXfer:memory-map:read::") == 0) {
+            const auto rawPacketString = std::string_view(
+                reinterpret_cast<const char*>(rawPacket.data() + 1),
+                rawPacket.size() - 1
+            );
+
+            if (rawPacketString.starts_with("qXfer:memory-map:read::")) {
                 return std::make_unique<ReadMemoryMap>(rawPacket);
             }
 
-            if (rawPacketString.find("vFlashErase") == 0) {
+            if (rawPacketString.starts_with("qXfer:features:read:")) {
+                return std::make_unique<ReadTargetDescription>(rawPacket, this->gdbTargetDescriptor.value());
+            }
+
+            if (rawPacketString.starts_with("vFlashErase")) {
                 return std::make_unique<FlashErase>(rawPacket);
             }
 
-            if (rawPacketString.find("vFlashWrite") == 0) {
+            if (rawPacketString.starts_with("vFlashWrite")) {
                 return std::make_unique<FlashWrite>(rawPacket);
             }
 
-            if (rawPacketString.find("vFlashDone") == 0) {
+            if (rawPacketString.starts_with("vFlashDone")) {
                 return std::make_unique<FlashDone>(rawPacket);
             }
+
+            if (rawPacketString.starts_with("qCRC:")) {
+                return std::make_unique<ComputeMemoryCrc>(rawPacket, this->gdbTargetDescriptor.value());
+            }
+
+            if (rawPacketString.starts_with("qSearch:memory:")) {
+                return std::make_unique<SearchMemory>(rawPacket, this->gdbTargetDescriptor.value());
+            }
         }
 
         return GdbRspDebugServer::resolveCommandPacket(rawPacket);
     }
 
+    bool AvrGdbRsp::isObserverCommandPacket(const Gdb::CommandPackets::CommandPacket& commandPacket) const {
+        using AvrGdb::CommandPackets::ReadMemory;
+        using AvrGdb::CommandPackets::ReadMemoryMap;
+        using AvrGdb::CommandPackets::ReadTargetDescription;
+        using AvrGdb::CommandPackets::ComputeMemoryCrc;
+        using AvrGdb::CommandPackets::SearchMemory;
+
+        const auto& commandPacketType = typeid(commandPacket);
+
+        return commandPacketType == typeid(ReadMemory)
+            || commandPacketType == typeid(ReadMemoryMap)
+            || commandPacketType == typeid(ReadTargetDescription)
+            || commandPacketType == typeid(ComputeMemoryCrc)
+            || commandPacketType == typeid(SearchMemory)
+            || GdbRspDebugServer::isObserverCommandPacket(commandPacket);
+    }
+
     std::set<std::pair<Feature, std::optional<std::string>>> AvrGdbRsp::getSupportedFeatures() {
         auto supportedFeatures = GdbRspDebugServer::getSupportedFeatures();
 
@@ -80,6 +129,16 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
             Feature::MEMORY_MAP_READ, std::nullopt
         });
 
+        // And the 'qXfer:features:read' GDB command, for the target description (target.xml)
+        supportedFeatures.insert({
+            Feature::TARGET_DESCRIPTION_READ, std::nullopt
+        });
+
+        // And binary memory reads ('x' packets)
+        supportedFeatures.insert({
+            Feature::BINARY_UPLOAD, std::nullopt
+        });
+
         return supportedFeatures;
     }
 }
@@ -22,11 +22,16 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
         }
 
     protected:
-        void init() override;
-
-        const Gdb::TargetDescriptor& getGdbTargetDescriptor() override {
-            return this->gdbTargetDescriptor.value();
-        }
+        /**
+         * Constructs the GDB target descriptor upon first use (which will be when the first GDB client connects).
+         *
+         * The debug server starts up in parallel with the TargetController, and the target descriptor isn't
+         * available until the TargetController has acquired the hardware. Requesting it at init would hold up the
+         * opening of the server socket.
+         *
+         * @return
+         */
+        const Gdb::TargetDescriptor& getGdbTargetDescriptor() override;
 
         std::unique_ptr<Gdb::CommandPackets::CommandPacket> resolveCommandPacket(
             const RawPacket& rawPacket
@@ -34,6 +39,8 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
 
         std::set<std::pair<Feature, std::optional<std::string>>> getSupportedFeatures() override;
 
+        bool isObserverCommandPacket(const Gdb::CommandPackets::CommandPacket& commandPacket) const override;
+
     private:
         std::optional<TargetDescriptor> gdbTargetDescriptor;
     };
@@ -0,0 +1,107 @@
+#include "ComputeMemoryCrc.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ErrorResponsePacket;
+    using ResponsePackets::ResponsePacket;
+
+    using Exceptions::Exception;
+
+    ComputeMemoryCrc::ComputeMemoryCrc(const RawPacket& rawPacket, const TargetDescriptor& gdbTargetDescriptor)
+        : CommandPacket(rawPacket)
+    {
+        if (this->data.size() < 8) {
+            throw Exception("Invalid packet length");
+        }
+
+        /*
+         * The CRC ('qCRC:') packet consists of two segments, an address and a length, separated by a comma.
+         */
+        const auto packetData = this->dataView().substr(5);
+        const auto delimiterPosition = packetData.find(',');
+
+        if (delimiterPosition == std::string_view::npos) {
+            throw Exception("Unexpected number of segments in packet data");
+        }
+
+        const auto gdbStartAddress = Packet::parseHex(packetData.substr(0, delimiterPosition));
+
+        if (!gdbStartAddress.has_value()) {
+            throw Exception("Failed to parse start address from CRC packet data");
+        }
+
+        /*
+         * Extract the memory type from the memory address (see Gdb::TargetDescriptor::memoryOffsetsByType for more on
+         * this).
+         */
+        this->memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(*gdbStartAddress);
+        this->startAddress = *gdbStartAddress & ~(gdbTargetDescriptor.getMemoryOffset(this->memoryType));
+
+        const auto bytes = Packet::parseHex(packetData.substr(delimiterPosition + 1));
+
+        if (!bytes.has_value()) {
+            throw Exception("Failed to parse length from CRC packet data");
+        }
+
+        this->bytes = *bytes;
+    }
+
+    void ComputeMemoryCrc::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling ComputeMemoryCrc packet");
+
+        try {
+            const auto& memoryDescriptorsByType = debugSession.gdbTargetDescriptor.targetDescriptor.memoryDescriptorsByType;
+            const auto memoryDescriptorIt = memoryDescriptorsByType.find(this->memoryType);
+
+            if (memoryDescriptorIt == memoryDescriptorsByType.end()) {
+                throw Exception("Target does not support the requested memory type.");
+            }
+
+            const auto& memoryDescriptor = memoryDescriptorIt->second;
+
+            if (this->memoryType == Targets::TargetMemoryType::EEPROM) {
+                // GDB sends EEPROM addresses in relative form - we convert them to absolute form, here.
+                this->startAddress = memoryDescriptor.addressRange.startAddress + this->startAddress;
+            }
+
+            if (
+                this->bytes > 0
+                && (
+                    this->startAddress < memoryDescriptor.addressRange.startAddress
+                    || (this->startAddress + (this->bytes - 1)) > memoryDescriptor.addressRange.endAddress
+                )
+            ) {
+                throw Exception("Requested memory range is outside the target's memory range.");
+            }
+
+            const auto crc = targetControllerService.computeMemoryCrc(
+                this->memoryType,
+                this->startAddress,
+                this->bytes
+            );
+
+            auto packetData = std::vector<unsigned char>(9, 'C');
+            for (auto i = std::size_t(0); i < 4; ++i) {
+                Packet::byteToHex(
+                    static_cast<unsigned char>(crc >> (24 - (i * 8))),
+                    packetData.data() + 1 + (i * 2)
+                );
+            }
+
+            debugSession.connection.writePacket(ResponsePacket(std::move(packetData)));
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to compute memory CRC - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+#include "src/DebugServer/Gdb/CommandPackets/CommandPacket.hpp"
+#include "src/DebugServer/Gdb/TargetDescriptor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    /**
+     * The ComputeMemoryCrc class implements a structure for "qCRC" packets. Upon receiving these packets, the server
+     * is expected to compute a CRC-32 over a range of the target's memory, and send it to the client.
+     *
+     * GDB uses this packet to verify the target's memory against the sections of the loaded ELF file (see GDB's
+     * "compare-sections" command), which saves it from having to read the entire memory range via "m" packets.
+     */
+    class ComputeMemoryCrc: public Gdb::CommandPackets::CommandPacket
+    {
+    public:
+        /**
+         * Start address of the memory range.
+         */
+        Targets::TargetMemoryAddress startAddress = 0;
+
+        /**
+         * The type of memory to compute the CRC over.
+         */
+        Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::FLASH;
+
+        /**
+         * Size of the memory range, in bytes.
+         */
+        Targets::TargetMemorySize bytes = 0;
+
+        explicit ComputeMemoryCrc(const RawPacket& rawPacket, const Gdb::TargetDescriptor& gdbTargetDescriptor);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
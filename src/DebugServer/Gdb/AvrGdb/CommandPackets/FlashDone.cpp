@@ -24,41 +24,59 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
 
         try {
             if (debugSession.programmingSession.has_value()) {
-                const auto& programmingSession = debugSession.programmingSession.value();
+                auto& programmingSession = debugSession.programmingSession.value();
+
+                if (programmingSession.streamingError.has_value()) {
+                    throw Exception("Failed to write to program memory - " + *(programmingSession.streamingError));
+                }
+
+                debugSession.enableProgrammingMode(targetControllerService);
+
                 Logger::info(
-                    "Flushing " + std::to_string(programmingSession.buffer.size()) + " bytes to target's program memory"
+                    "Flushing " + std::to_string(programmingSession.pendingBytes())
+                        + " bytes to target's program memory"
                 );
 
-                targetControllerService.enableProgrammingMode();
+                // Only the pages that GDB has erased or written to are written to the target
+                for (auto& pageRun : programmingSession.takeAllPages()) {
+                    const auto bytes = static_cast<Targets::TargetMemorySize>(pageRun.buffer.size());
 
-                targetControllerService.writeMemory(
-                    Targets::TargetMemoryType::FLASH,
-                    programmingSession.startAddress,
-                    std::move(programmingSession.buffer)
+                    targetControllerService.writeMemory(
+                        Targets::TargetMemoryType::FLASH,
+                        pageRun.startAddress,
+                        std::move(pageRun.buffer)
+                    );
+
+                    programmingSession.bytesWritten += bytes;
+                }
+
+                Logger::info(
+                    std::to_string(programmingSession.bytesWritten) + " bytes written to target's program memory"
                 );
 
                 debugSession.programmingSession.reset();
+                Logger::warning("Program memory updated");
             }
 
-            Logger::warning("Program memory updated");
-            targetControllerService.disableProgrammingMode();
+            // This is the only point at which a successful programming session leaves programming mode
+            debugSession.disableProgrammingMode(targetControllerService);
 
-            Logger::warning("Resetting target");
-            targetControllerService.resetTarget();
-            Logger::info("Target reset complete");
+            if (debugSession.serverConfig.deferResetAfterProgramming) {
+                // The TargetController will reset the target when it's next resumed, unless GDB resets it first
+                Logger::info("Deferring target reset");
+                targetControllerService.resetTarget(true);
+
+            } else {
+                Logger::warning("Resetting target");
+                targetControllerService.resetTarget();
+                Logger::info("Target reset complete");
+            }
 
             debugSession.connection.writePacket(OkResponsePacket());
 
         } catch (const Exception& exception) {
             Logger::error("Failed to handle FlashDone packet - " + exception.getMessage());
-            debugSession.programmingSession.reset();
-
-            try {
-                targetControllerService.disableProgrammingMode();
-
-            } catch (const Exception& exception) {
-                Logger::error("Failed to disable programming mode - " + exception.getMessage());
-            }
+            debugSession.abortProgrammingSession(targetControllerService);
 
             debugSession.connection.writePacket(ErrorResponsePacket());
         }
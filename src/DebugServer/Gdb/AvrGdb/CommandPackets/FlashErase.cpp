@@ -13,6 +13,10 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
     using ResponsePackets::ErrorResponsePacket;
     using ResponsePackets::OkResponsePacket;
 
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+
     using namespace Bloom::Exceptions;
 
     FlashErase::FlashErase(const RawPacket& rawPacket)
@@ -52,25 +56,38 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
         Logger::info("Handling FlashErase packet");
 
         try {
-            targetControllerService.enableProgrammingMode();
-
-            Logger::warning("Erasing program memory, in preparation for programming");
-
-            // We don't erase a specific address range - we just erase the entire program memory.
-            targetControllerService.eraseMemory(debugSession.gdbTargetDescriptor.targetDescriptor.programMemoryType);
+            auto& programmingSession = debugSession.startProgrammingSession();
+
+            // Programming mode remains enabled until we receive the FlashDone packet
+            debugSession.enableProgrammingMode(targetControllerService);
+
+            /*
+             * We don't erase anything here. Most of the time, the majority of the program memory will be rewritten
+             * with what's already there, so we just record the erased range in the programming session - the range is
+             * held in its erased state (0xFF), and written to the target upon receiving the FlashDone packet, along
+             * with the data that GDB sends via FlashWrite packets. The TargetController determines which pages have
+             * changed, only erasing the pages (or, where the target doesn't support page rewrites, the program
+             * memory) when it needs to.
+             *
+             * GDB erases whole pages (we report the page size as the flash block size, in the memory map), but should
+             * the range only partially cover a page, the rest of the page is read from the target, so that it's
+             * preserved.
+             *
+             * See ProgrammingSession::erase() and TargetControllerComponent::writeProgramMemory() for more.
+             */
+            programmingSession.erase(
+                this->startAddress,
+                this->bytes,
+                [&targetControllerService] (TargetMemoryAddress startAddress, TargetMemorySize bytes) {
+                    return targetControllerService.readMemory(TargetMemoryType::FLASH, startAddress, bytes);
+                }
+            );
 
             debugSession.connection.writePacket(OkResponsePacket());
 
         } catch (const Exception& exception) {
-            Logger::error("Failed to erase flash memory - " + exception.getMessage());
-            debugSession.programmingSession.reset();
-
-            try {
-                targetControllerService.disableProgrammingMode();
-
-            } catch (const Exception& exception) {
-                Logger::error("Failed to disable programming mode - " + exception.getMessage());
-            }
+            Logger::error("Failed to prepare for flash programming - " + exception.getMessage());
+            debugSession.abortProgrammingSession(targetControllerService);
 
             debugSession.connection.writePacket(ErrorResponsePacket());
         }
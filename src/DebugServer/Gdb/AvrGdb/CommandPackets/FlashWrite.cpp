@@ -1,7 +1,5 @@
 #include "FlashWrite.hpp"
 
-#include <QByteArray>
-
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 
@@ -29,23 +27,23 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
          *
          * Seperated by a colon.
          */
-        auto colonIt = std::find(this->data.begin() + 12, this->data.end(), ':');
+        const auto colonPosition = this->dataView().find(':', 12);
 
-        if (colonIt == this->data.end()) {
+        if (colonPosition == std::string_view::npos) {
             throw Exception("Failed to find colon delimiter in write flash packet.");
         }
 
-        bool conversionStatus = false;
-        this->startAddress = QByteArray(
-            reinterpret_cast<const char*>(this->data.data() + 12),
-            std::distance(this->data.begin(), colonIt) - 12
-        ).toUInt(&conversionStatus, 16);
+        const auto startAddress = Packet::parseHex(this->dataView().substr(12, colonPosition - 12));
 
-        if (!conversionStatus) {
+        if (!startAddress.has_value()) {
             throw Exception("Failed to parse start address from flash write packet data");
         }
 
-        this->buffer = Targets::TargetMemoryBuffer(colonIt + 1, this->data.end());
+        this->startAddress = *startAddress;
+        this->buffer = Targets::TargetMemoryBuffer(
+            this->data.begin() + static_cast<long>(colonPosition) + 1,
+            this->data.end()
+        );
     }
 
     void FlashWrite::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
@@ -56,48 +54,63 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
                 throw Exception("Received empty buffer from GDB");
             }
 
-            if (!debugSession.programmingSession.has_value()) {
-                debugSession.programmingSession = ProgrammingSession(this->startAddress, this->buffer);
-
-            } else {
-                auto& programmingSession = debugSession.programmingSession.value();
-                const auto currentEndAddress = programmingSession.startAddress + programmingSession.buffer.size() - 1;
-                const auto expectedStartAddress = (currentEndAddress + 1);
-
-                if (this->startAddress < expectedStartAddress) {
-                    throw Exception("Invalid start address from GDB - the buffer would overlap a previous buffer");
-                }
-
-                if (this->startAddress > expectedStartAddress) {
-                    // There is a gap in the buffer sent by GDB. Fill it with 0xFF
-                    programmingSession.buffer.insert(
-                        programmingSession.buffer.end(),
-                        this->startAddress - expectedStartAddress,
-                        0xFF
-                    );
-                }
-
-                programmingSession.buffer.insert(
-                    programmingSession.buffer.end(),
-                    this->buffer.begin(),
-                    this->buffer.end()
-                );
+            auto& programmingSession = debugSession.startProgrammingSession();
+
+            if (programmingSession.streamingError.has_value()) {
+                throw Exception("Failed to write to program memory - " + *(programmingSession.streamingError));
+            }
+
+            if (programmingSession.streaming) {
+                // GDB usually erases before writing, in which case programming mode will already be enabled
+                debugSession.enableProgrammingMode(targetControllerService);
             }
 
+            programmingSession.insert(this->startAddress, this->buffer);
+
             debugSession.connection.writePacket(OkResponsePacket());
 
+            if (programmingSession.streaming) {
+                /*
+                 * Flush the response before writing to the target, so that GDB can send the next chunk whilst the
+                 * target is being programmed.
+                 */
+                debugSession.connection.flush();
+                FlashWrite::writeCompletePages(programmingSession, targetControllerService);
+            }
+
         } catch (const Exception& exception) {
             Logger::error("Failed to handle FlashWrite packet - " + exception.getMessage());
-            debugSession.programmingSession.reset();
+            debugSession.abortProgrammingSession(targetControllerService);
+
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    void FlashWrite::writeCompletePages(
+        ProgrammingSession& programmingSession,
+        TargetControllerService& targetControllerService
+    ) {
+        for (auto& pageRun : programmingSession.takeCompletePages()) {
+            if (programmingSession.streamingError.has_value()) {
+                // Discard the remaining pages - the programming session will be aborted upon the next packet
+                return;
+            }
 
             try {
-                targetControllerService.disableProgrammingMode();
+                const auto bytes = static_cast<Targets::TargetMemorySize>(pageRun.buffer.size());
+
+                targetControllerService.writeMemory(
+                    Targets::TargetMemoryType::FLASH,
+                    pageRun.startAddress,
+                    std::move(pageRun.buffer)
+                );
+
+                programmingSession.bytesWritten += bytes;
 
             } catch (const Exception& exception) {
-                Logger::error("Failed to disable programming mode - " + exception.getMessage());
+                Logger::error("Failed to write to program memory - " + exception.getMessage());
+                programmingSession.streamingError = exception.getMessage();
             }
-
-            debugSession.connection.writePacket(ErrorResponsePacket());
         }
     }
 }
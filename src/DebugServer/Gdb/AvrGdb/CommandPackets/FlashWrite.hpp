@@ -13,6 +13,9 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
     /**
      * The FlashWrite class implements the structure for the "vFlashWrite" packet. Upon receiving this packet, the
      * server is expected to write to a particular region of the target's flash memory.
+     *
+     * The data is accumulated in a ProgrammingSession. For streaming programming sessions, complete pages are
+     * written to the target as soon as they've been received. See ProgrammingSession for more.
      */
     class FlashWrite: public Gdb::CommandPackets::CommandPacket
     {
@@ -26,5 +29,18 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
             DebugSession& debugSession,
             Services::TargetControllerService& targetControllerService
         ) override;
+
+    private:
+        /**
+         * Writes all complete pages in the (streaming) programming session to the target, and removes them from the
+         * session. Failures are recorded in ProgrammingSession::streamingError.
+         *
+         * @param programmingSession
+         * @param targetControllerService
+         */
+        static void writeCompletePages(
+            ProgrammingSession& programmingSession,
+            Services::TargetControllerService& targetControllerService
+        );
     };
 }
@@ -3,7 +3,7 @@
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
 
-#include "src/Services/StringService.hpp"
+#include "src/Helpers/HexCodec.hpp"
 #include "src/Logger/Logger.hpp"
 
 #include "src/Exceptions/Exception.hpp"
@@ -24,27 +24,22 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
             throw Exception("Invalid packet length");
         }
 
-        const auto packetString = QString::fromLocal8Bit(
-            reinterpret_cast<const char*>(this->data.data() + 1),
-            static_cast<int>(this->data.size() - 1)
-        );
+        this->binary = this->data[0] == 'x';
 
         /*
-         * The read memory ('m') packet consists of two segments, an address and a number of bytes to read.
+         * The read memory ('m' and 'x') packets consist of two segments, an address and a number of bytes to read.
          * These are separated by a comma character.
          */
-        const auto packetSegments = packetString.split(",");
+        const auto packetData = this->dataView().substr(1);
+        const auto delimiterPosition = packetData.find(',');
 
-        if (packetSegments.size() != 2) {
-            throw Exception(
-                "Unexpected number of segments in packet data: " + std::to_string(packetSegments.size())
-            );
+        if (delimiterPosition == std::string_view::npos) {
+            throw Exception("Unexpected number of segments in packet data");
         }
 
-        bool conversionStatus = false;
-        const auto gdbStartAddress = packetSegments.at(0).toUInt(&conversionStatus, 16);
+        const auto gdbStartAddress = Packet::parseHex(packetData.substr(0, delimiterPosition));
 
-        if (!conversionStatus) {
+        if (!gdbStartAddress.has_value()) {
             throw Exception("Failed to parse start address from read memory packet data");
         }
 
@@ -52,14 +47,17 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
          * Extract the memory type from the memory address (see Gdb::TargetDescriptor::memoryOffsetsByType for more on
          * this).
          */
-        this->memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbStartAddress);
-        this->startAddress = gdbStartAddress & ~(gdbTargetDescriptor.getMemoryOffset(this->memoryType));
+        this->gdbStartAddress = *gdbStartAddress;
+        this->memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(*gdbStartAddress);
+        this->startAddress = *gdbStartAddress & ~(gdbTargetDescriptor.getMemoryOffset(this->memoryType));
 
-        this->bytes = packetSegments.at(1).toUInt(&conversionStatus, 16);
+        const auto bytes = Packet::parseHex(packetData.substr(delimiterPosition + 1));
 
-        if (!conversionStatus) {
+        if (!bytes.has_value()) {
             throw Exception("Failed to parse read length from read memory packet data");
         }
+
+        this->bytes = *bytes;
     }
 
     void ReadMemory::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
@@ -74,7 +72,45 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
             }
 
             if (this->bytes == 0) {
-                debugSession.connection.writePacket(ResponsePacket(std::vector<unsigned char>()));
+                this->writeResponse(debugSession, {});
+                return;
+            }
+
+            /*
+             * GDB permits the server to respond with fewer bytes than requested - GDB will issue another packet for
+             * the remaining bytes. We make use of this to ensure that the hex-encoded response fits within the
+             * advertised packet size (excluding the packet framing - the '$' and '#' characters, plus the checksum).
+             *
+             * Binary responses are trimmed further, after escaping (see ReadMemory::writeResponse()).
+             */
+            const auto maximumResponseBytes = this->binary
+                ? debugSession.serverConfig.packetSize - 5
+                : (debugSession.serverConfig.packetSize - 4) / 2;
+
+            if (this->bytes > maximumResponseBytes) {
+                this->bytes = maximumResponseBytes;
+            }
+
+            if (
+                debugSession.selectedTraceFrameIndex.has_value()
+                && this->memoryType != Targets::TargetMemoryType::FLASH
+            ) {
+                /*
+                 * Whilst the client is inspecting a trace frame, we can only serve the memory that was collected in
+                 * the frame. Flash memory doesn't change at runtime, so that's read from the target, as normal.
+                 */
+                const auto frameMemory = debugSession.readTraceFrameMemory(this->gdbStartAddress, this->bytes);
+
+                if (!frameMemory.has_value()) {
+                    Logger::debug(
+                        "GDB requested memory that wasn't collected in the selected trace frame - returning error "
+                        "response"
+                    );
+                    debugSession.connection.writePacket(ErrorResponsePacket());
+                    return;
+                }
+
+                this->writeResponse(debugSession, *frameMemory);
                 return;
             }
 
@@ -143,16 +179,49 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
                 );
             }
 
-            if (bytesToRead < this->bytes) {
-                // GDB requested some out-of-bounds memory - fill the inaccessible bytes with 0x00
-                memoryBuffer.insert(memoryBuffer.end(), (this->bytes - bytesToRead), 0x00);
-            }
-
-            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(memoryBuffer)));
+            // GDB may have requested some out-of-bounds memory - any inaccessible bytes are reported as 0x00.
+            memoryBuffer.resize(this->bytes, 0x00);
+            this->writeResponse(debugSession, memoryBuffer);
 
         } catch (const Exception& exception) {
             Logger::error("Failed to read memory from target - " + exception.getMessage());
             debugSession.connection.writePacket(ErrorResponsePacket());
         }
     }
+
+    void ReadMemory::writeResponse(DebugSession& debugSession, const Targets::TargetMemoryBuffer& buffer) const {
+        if (!this->binary) {
+            // Encode the data straight into the packet buffer
+            auto packetData = std::vector<unsigned char>(buffer.size() * 2, '0');
+            HexCodec::encode(buffer, packetData.data());
+
+            debugSession.connection.writePacket(ResponsePacket(std::move(packetData)));
+            return;
+        }
+
+        /*
+         * Binary responses are prefixed with 'b', as an empty response would indicate that we don't support the
+         * packet. The data is escaped in Packet::toRawPacket() - escaped bytes take two characters.
+         */
+        const auto maximumDataSize = static_cast<std::size_t>(debugSession.serverConfig.packetSize - 4);
+
+        auto packetData = std::vector<unsigned char>();
+        packetData.reserve(std::min(buffer.size() + 1, maximumDataSize));
+        packetData.push_back('b');
+
+        auto encodedSize = packetData.size();
+
+        for (const auto byte : buffer) {
+            const auto byteSize = (byte == '$' || byte == '#' || byte == '}' || byte == '*') ? 2 : 1;
+
+            if ((encodedSize + byteSize) > maximumDataSize) {
+                break;
+            }
+
+            packetData.push_back(byte);
+            encodedSize += byteSize;
+        }
+
+        debugSession.connection.writePacket(ResponsePacket(std::move(packetData)));
+    }
 }
@@ -11,8 +11,12 @@
 namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
 {
     /**
-     * The ReadMemory class implements a structure for "m" packets. Upon receiving these packets, the server is
+     * The ReadMemory class implements a structure for "m" and "x" packets. Upon receiving these packets, the server is
      * expected to read memory from the target and send it the client.
+     *
+     * The two packets differ only in the encoding of the response - "m" responses are hex-encoded, whereas "x"
+     * responses carry the memory as (escaped) binary data, which takes around half the bandwidth. GDB only uses "x"
+     * packets when the server advertises the "binary-upload" feature.
      */
     class ReadMemory: public Gdb::CommandPackets::CommandPacket
     {
@@ -22,6 +26,11 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
          */
         Targets::TargetMemoryAddress startAddress = 0;
 
+        /**
+         * The start address as sent by GDB (including the GDB memory offset).
+         */
+        std::uint32_t gdbStartAddress = 0;
+
         /**
          * The type of memory to read from.
          */
@@ -32,11 +41,29 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
          */
         Targets::TargetMemorySize bytes = 0;
 
+        /**
+         * Whether the response should carry binary data ("x" packet), as opposed to hex-encoded data ("m" packet).
+         */
+        bool binary = false;
+
         explicit ReadMemory(const RawPacket& rawPacket, const Gdb::TargetDescriptor& gdbTargetDescriptor);
 
         void handle(
             DebugSession& debugSession,
             Services::TargetControllerService& targetControllerService
         ) override;
+
+    private:
+        /**
+         * Encodes the given memory into a response packet, as hex or binary data (see ReadMemory::binary), and sends
+         * it to the client.
+         *
+         * Binary responses are trimmed to fit within the advertised packet size, as escaping can double the size of
+         * the data - GDB will request the remaining bytes in another packet.
+         *
+         * @param debugSession
+         * @param buffer
+         */
+        void writeResponse(DebugSession& debugSession, const Targets::TargetMemoryBuffer& buffer) const;
     };
 }
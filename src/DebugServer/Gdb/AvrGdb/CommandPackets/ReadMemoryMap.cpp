@@ -1,6 +1,7 @@
 #include "ReadMemoryMap.hpp"
 
-#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/PartialDocumentResponsePacket.hpp"
+#include "src/DebugServer/Gdb/TargetDocumentCache.hpp"
 
 #include "src/Exceptions/Exception.hpp"
 
@@ -8,7 +9,7 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
 {
     using Services::TargetControllerService;
 
-    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::PartialDocumentResponsePacket;
 
     using Exceptions::Exception;
 
@@ -53,10 +54,22 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
     void ReadMemoryMap::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
         Logger::info("Handling ReadMemoryMap packet");
 
+        const auto& gdbTargetDescriptor = debugSession.gdbTargetDescriptor;
+        const auto memoryMap = TargetDocumentCache::get(
+            gdbTargetDescriptor.targetDescriptor.id,
+            "memory-map.xml",
+            [&gdbTargetDescriptor] {
+                return ReadMemoryMap::generateMemoryMap(gdbTargetDescriptor);
+            }
+        );
+
+        debugSession.connection.writePacket(PartialDocumentResponsePacket(*memoryMap, this->offset, this->length));
+    }
+
+    std::string ReadMemoryMap::generateMemoryMap(const Gdb::TargetDescriptor& gdbTargetDescriptor) {
         using Targets::TargetMemoryType;
-        const auto& memoryDescriptorsByType = debugSession.gdbTargetDescriptor.targetDescriptor.memoryDescriptorsByType;
+        const auto& memoryDescriptorsByType = gdbTargetDescriptor.targetDescriptor.memoryDescriptorsByType;
 
-        const auto& ramDescriptor = memoryDescriptorsByType.at(TargetMemoryType::RAM);
         const auto& flashDescriptor = memoryDescriptorsByType.at(TargetMemoryType::FLASH);
 
         const auto eepromDescriptorIt = memoryDescriptorsByType.find(TargetMemoryType::EEPROM);
@@ -64,17 +77,9 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
             ? std::optional(eepromDescriptorIt->second)
             : std::nullopt;
 
-        const auto ramGdbOffset = debugSession.gdbTargetDescriptor.getMemoryOffset(
-            Targets::TargetMemoryType::RAM
-        );
-
-        const auto eepromGdbOffset = debugSession.gdbTargetDescriptor.getMemoryOffset(
-            Targets::TargetMemoryType::EEPROM
-        );
-
-        const auto flashGdbOffset = debugSession.gdbTargetDescriptor.getMemoryOffset(
-            Targets::TargetMemoryType::FLASH
-        );
+        const auto ramGdbOffset = gdbTargetDescriptor.getMemoryOffset(Targets::TargetMemoryType::RAM);
+        const auto eepromGdbOffset = gdbTargetDescriptor.getMemoryOffset(Targets::TargetMemoryType::EEPROM);
+        const auto flashGdbOffset = gdbTargetDescriptor.getMemoryOffset(Targets::TargetMemoryType::FLASH);
 
         /*
          * We include register and EEPROM memory in our RAM section. This allows GDB to access registers and EEPROM
@@ -93,30 +98,11 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
         const auto flashSize = flashDescriptor.size();
         const auto flashPageSize = flashDescriptor.pageSize.value();
 
-        const auto memoryMap =
-            std::string("<memory-map>")
+        return std::string("<memory-map>")
                 + "<memory type=\"ram\" start=\"" + std::to_string(ramGdbOffset) + "\" length=\"" + std::to_string(ramSectionSize) + "\"/>"
                 + "<memory type=\"flash\" start=\"" + std::to_string(flashGdbOffset) + "\" length=\"" + std::to_string(flashSize) + "\">"
                     + "<property name=\"blocksize\">" + std::to_string(flashPageSize) + "</property>"
                 + "</memory>"
             + "</memory-map>";
-
-        if (this->offset < memoryMap.size() && this->length > 0) {
-            auto memoryMapData = std::vector<unsigned char>(
-                memoryMap.begin() + this->offset,
-                memoryMap.begin() + std::min(
-                    static_cast<long>(this->offset + this->length),
-                    static_cast<long>(memoryMap.size())
-                )
-            );
-
-            auto responseData = std::vector<unsigned char>({'l'});
-            std::move(memoryMapData.begin(), memoryMapData.end(), std::back_inserter(responseData));
-
-            debugSession.connection.writePacket(ResponsePacket(responseData));
-            return;
-        }
-
-        debugSession.connection.writePacket(ResponsePacket(std::vector<unsigned char>({'l'})));
     }
 }
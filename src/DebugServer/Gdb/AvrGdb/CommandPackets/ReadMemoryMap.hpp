@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 
 #include "src/DebugServer/Gdb/CommandPackets/CommandPacket.hpp"
 
@@ -9,6 +10,8 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
     /**
      * The ReadMemoryMap class implements a structure for the "qXfer:memory-map:read::..." packet. Upon receiving this
      * packet, the server is expected to respond with the target's memory map.
+     *
+     * The memory map is generated once per target, and cached (see TargetDocumentCache).
      */
     class ReadMemoryMap: public Gdb::CommandPackets::CommandPacket
     {
@@ -29,5 +32,8 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
             DebugSession& debugSession,
             Services::TargetControllerService& targetControllerService
         ) override;
+
+    private:
+        static std::string generateMemoryMap(const Gdb::TargetDescriptor& gdbTargetDescriptor);
     };
 }
@@ -0,0 +1,151 @@
+#include "ReadTargetDescription.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/PartialDocumentResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/TargetDocumentCache.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::PartialDocumentResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    ReadTargetDescription::ReadTargetDescription(
+        const RawPacket& rawPacket,
+        const TargetDescriptor& gdbTargetDescriptor
+    )
+        : CommandPacket(rawPacket)
+        , gdbTargetDescriptor(gdbTargetDescriptor)
+    {
+        /*
+         * The packet takes the form "qXfer:features:read:<annex>:<offset>,<length>", where the offset and length
+         * are in hexadecimal form.
+         */
+        static constexpr auto PREFIX = std::string_view("qXfer:features:read:");
+
+        const auto packetData = this->dataView().substr(PREFIX.size());
+        const auto annexEndPos = packetData.find(':');
+        const auto separatorPos = packetData.find(',', annexEndPos);
+
+        if (annexEndPos == std::string_view::npos || separatorPos == std::string_view::npos) {
+            throw Exception("Invalid read target description packet");
+        }
+
+        this->annex = std::string(packetData.substr(0, annexEndPos));
+
+        const auto offset = Packet::parseHex<std::uint32_t>(
+            packetData.substr(annexEndPos + 1, separatorPos - annexEndPos - 1)
+        );
+        const auto length = Packet::parseHex<std::uint32_t>(packetData.substr(separatorPos + 1));
+
+        if (!offset.has_value()) {
+            throw Exception("Failed to parse offset from read target description packet data");
+        }
+
+        if (!length.has_value()) {
+            throw Exception("Failed to parse read length from read target description packet data");
+        }
+
+        this->offset = *offset;
+        this->length = *length;
+    }
+
+    void ReadTargetDescription::handle(DebugSession& debugSession, TargetControllerService&) {
+        Logger::info("Handling ReadTargetDescription packet");
+
+        if (this->annex != "target.xml") {
+            Logger::debug("Unknown target description annex requested: \"" + this->annex + "\"");
+            debugSession.connection.writePacket(ErrorResponsePacket());
+            return;
+        }
+
+        const auto& gdbTargetDescriptor = this->gdbTargetDescriptor;
+        const auto targetDescription = TargetDocumentCache::get(
+            gdbTargetDescriptor.targetDescriptor.id,
+            gdbTargetDescriptor.getPeripheralRegisterNumbers().empty() ? "target.xml" : "target-peripherals.xml",
+            [&gdbTargetDescriptor] {
+                return ReadTargetDescription::generateTargetDescription(gdbTargetDescriptor);
+            }
+        );
+
+        debugSession.connection.writePacket(
+            PartialDocumentResponsePacket(*targetDescription, this->offset, this->length)
+        );
+    }
+
+    std::string ReadTargetDescription::generateTargetDescription(const TargetDescriptor& gdbTargetDescriptor) {
+        const auto registerElement = [] (
+            const std::string& name,
+            GdbRegisterNumber number,
+            std::uint16_t size,
+            const std::string& type,
+            const std::string& group
+        ) {
+            return "<reg name=\"" + name + "\" bitsize=\"" + std::to_string(size * 8) + "\" type=\"" + type
+                + "\" regnum=\"" + std::to_string(number) + "\" group=\"" + group + "\"/>";
+        };
+
+        auto output = std::string(
+            "<?xml version=\"1.0\"?>"
+            "<!DOCTYPE target SYSTEM \"gdb-target.dtd\">"
+            "<target version=\"1.0\">"
+            "<architecture>avr</architecture>"
+            "<feature name=\"org.gnu.gdb.avr.core\">"
+        );
+
+        /*
+         * These register names and types match avr-gdb's built-in register set, so the target description is
+         * consistent with what GDB would otherwise assume.
+         */
+        for (const auto& registerNumber : gdbTargetDescriptor.getRegisterNumbers()) {
+            const auto& descriptor = gdbTargetDescriptor.getRegisterDescriptorFromNumber(registerNumber);
+
+            if (registerNumber < 32) {
+                output += registerElement("r" + std::to_string(registerNumber), registerNumber, 1, "uint8", "general");
+
+            } else if (registerNumber == 32) {
+                output += registerElement("SREG", registerNumber, descriptor.size, "uint8", "general");
+
+            } else if (registerNumber == 33) {
+                output += registerElement("SP", registerNumber, descriptor.size, "data_ptr", "general");
+
+            } else if (registerNumber == 34) {
+                output += registerElement("PC2", registerNumber, descriptor.size, "uint32", "general");
+            }
+        }
+
+        output += "</feature>";
+
+        if (!gdbTargetDescriptor.getPeripheralRegisterNumbers().empty()) {
+            /*
+             * Peripheral registers are placed in their own register group, so that they're excluded from "info
+             * registers". Some of them have read side effects.
+             */
+            output += "<feature name=\"io.oscillate.bloom.avr.peripherals\">";
+
+            for (const auto& registerNumber : gdbTargetDescriptor.getPeripheralRegisterNumbers()) {
+                const auto& descriptor = gdbTargetDescriptor.getRegisterDescriptorFromNumber(registerNumber);
+
+                // GDB only provides unsigned integer types for these sizes - "int" is sized by the bitsize attribute
+                const auto type = (
+                    descriptor.size == 1 || descriptor.size == 2 || descriptor.size == 4 || descriptor.size == 8
+                )
+                    ? "uint" + std::to_string(descriptor.size * 8)
+                    : std::string("int");
+
+                output += registerElement(descriptor.name, registerNumber, descriptor.size, type, "peripheral");
+            }
+
+            output += "</feature>";
+        }
+
+        output += "</target>";
+        return output;
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "src/DebugServer/Gdb/CommandPackets/CommandPacket.hpp"
+#include "src/DebugServer/Gdb/AvrGdb/TargetDescriptor.hpp"
+
+namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    /**
+     * The ReadTargetDescription class implements a structure for the "qXfer:features:read:target.xml:..." packet.
+     * Upon receiving this packet, the server is expected to respond with the target description XML.
+     *
+     * The target description describes the layout of the register packet (the response to the 'g' command), so GDB
+     * doesn't have to make any assumptions about it, along with any peripheral registers that have been mapped to
+     * GDB registers (see GdbDebugServerConfig::peripheralRegisters).
+     *
+     * The target description is generated once per target, and cached (see TargetDocumentCache).
+     */
+    class ReadTargetDescription: public Gdb::CommandPackets::CommandPacket
+    {
+    public:
+        /**
+         * The name of the requested document. We only provide "target.xml".
+         */
+        std::string annex;
+
+        /**
+         * The offset of the target description, from which to read.
+         */
+        std::uint32_t offset = 0;
+
+        /**
+         * The length of the target description to read.
+         */
+        std::uint32_t length = 0;
+
+        explicit ReadTargetDescription(const RawPacket& rawPacket, const TargetDescriptor& gdbTargetDescriptor);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        const TargetDescriptor& gdbTargetDescriptor;
+
+        static std::string generateTargetDescription(const TargetDescriptor& gdbTargetDescriptor);
+    };
+}
@@ -0,0 +1,143 @@
+#include "SearchMemory.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ErrorResponsePacket;
+    using ResponsePackets::ResponsePacket;
+
+    using Exceptions::Exception;
+
+    SearchMemory::SearchMemory(const RawPacket& rawPacket, const TargetDescriptor& gdbTargetDescriptor)
+        : CommandPacket(rawPacket)
+    {
+        /*
+         * The search ('qSearch:memory:') packet consists of three segments, an address, a length and a pattern,
+         * separated by semicolons.
+         *
+         * The pattern is binary data, which may contain semicolons, so we only search for the first two. Escaped
+         * bytes will have already been decoded by the RawPacketParser.
+         */
+        static constexpr auto PREFIX_SIZE = std::string_view("qSearch:memory:").size();
+
+        if (this->data.size() < PREFIX_SIZE + 4) {
+            throw Exception("Invalid packet length");
+        }
+
+        const auto packetData = this->dataView().substr(PREFIX_SIZE);
+        const auto firstDelimiterPosition = packetData.find(';');
+        const auto secondDelimiterPosition = firstDelimiterPosition != std::string_view::npos
+            ? packetData.find(';', firstDelimiterPosition + 1)
+            : std::string_view::npos;
+
+        if (secondDelimiterPosition == std::string_view::npos) {
+            throw Exception("Unexpected number of segments in packet data");
+        }
+
+        const auto gdbStartAddress = Packet::parseHex(packetData.substr(0, firstDelimiterPosition));
+
+        if (!gdbStartAddress.has_value()) {
+            throw Exception("Failed to parse start address from search memory packet data");
+        }
+
+        /*
+         * Extract the memory type from the memory address (see Gdb::TargetDescriptor::memoryOffsetsByType for more on
+         * this).
+         */
+        this->memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(*gdbStartAddress);
+        this->startAddress = *gdbStartAddress & ~(gdbTargetDescriptor.getMemoryOffset(this->memoryType));
+
+        const auto bytes = Packet::parseHex(
+            packetData.substr(firstDelimiterPosition + 1, secondDelimiterPosition - (firstDelimiterPosition + 1))
+        );
+
+        if (!bytes.has_value()) {
+            throw Exception("Failed to parse length from search memory packet data");
+        }
+
+        this->bytes = *bytes;
+
+        const auto pattern = packetData.substr(secondDelimiterPosition + 1);
+        this->pattern.assign(pattern.begin(), pattern.end());
+    }
+
+    void SearchMemory::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling SearchMemory packet");
+
+        try {
+            const auto& gdbTargetDescriptor = debugSession.gdbTargetDescriptor;
+            const auto& memoryDescriptorsByType = gdbTargetDescriptor.targetDescriptor.memoryDescriptorsByType;
+            const auto memoryDescriptorIt = memoryDescriptorsByType.find(this->memoryType);
+
+            if (memoryDescriptorIt == memoryDescriptorsByType.end()) {
+                throw Exception("Target does not support the requested memory type.");
+            }
+
+            const auto& memoryDescriptor = memoryDescriptorIt->second;
+
+            if (this->memoryType == Targets::TargetMemoryType::EEPROM) {
+                // GDB sends EEPROM addresses in relative form - we convert them to absolute form, here.
+                this->startAddress = memoryDescriptor.addressRange.startAddress + this->startAddress;
+            }
+
+            if (this->startAddress < memoryDescriptor.addressRange.startAddress) {
+                throw Exception("Requested memory range is outside the target's memory range.");
+            }
+
+            if (this->bytes == 0 || this->startAddress > memoryDescriptor.addressRange.endAddress) {
+                debugSession.connection.writePacket(ResponsePacket(std::vector<unsigned char>({'0'})));
+                return;
+            }
+
+            /*
+             * GDB typically searches up to the end of its address space, so we clamp the range to the end of the
+             * target's memory. A match can't extend past the end of the memory anyway.
+             */
+            const auto endAddress = (this->bytes - 1) > (memoryDescriptor.addressRange.endAddress - this->startAddress)
+                ? memoryDescriptor.addressRange.endAddress
+                : this->startAddress + (this->bytes - 1);
+
+            const auto matchAddress = targetControllerService.searchMemory(
+                this->memoryType,
+                Targets::TargetMemoryAddressRange(this->startAddress, endAddress),
+                std::move(this->pattern)
+            );
+
+            if (!matchAddress.has_value()) {
+                debugSession.connection.writePacket(ResponsePacket(std::vector<unsigned char>({'0'})));
+                return;
+            }
+
+            auto gdbMatchAddress = *matchAddress;
+
+            if (this->memoryType == Targets::TargetMemoryType::EEPROM) {
+                gdbMatchAddress -= memoryDescriptor.addressRange.startAddress;
+            }
+
+            gdbMatchAddress |= gdbTargetDescriptor.getMemoryOffset(this->memoryType);
+
+            auto packetData = std::vector<unsigned char>({'1', ','});
+            for (auto i = std::size_t(0); i < 4; ++i) {
+                packetData.resize(packetData.size() + 2);
+                Packet::byteToHex(
+                    static_cast<unsigned char>(gdbMatchAddress >> (24 - (i * 8))),
+                    packetData.data() + packetData.size() - 2
+                );
+            }
+
+            debugSession.connection.writePacket(ResponsePacket(std::move(packetData)));
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to search memory - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+#include "src/DebugServer/Gdb/CommandPackets/CommandPacket.hpp"
+#include "src/DebugServer/Gdb/TargetDescriptor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    /**
+     * The SearchMemory class implements a structure for "qSearch:memory" packets. Upon receiving these packets, the
+     * server is expected to search a range of the target's memory for a byte pattern, and send the address of the
+     * first match to the client.
+     *
+     * GDB uses this packet for its "find" command. Without it, GDB would read the entire range via "m" packets and
+     * perform the search itself.
+     */
+    class SearchMemory: public Gdb::CommandPackets::CommandPacket
+    {
+    public:
+        /**
+         * Start address of the memory range.
+         */
+        Targets::TargetMemoryAddress startAddress = 0;
+
+        /**
+         * The type of memory to search.
+         */
+        Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::FLASH;
+
+        /**
+         * Size of the memory range, in bytes.
+         */
+        Targets::TargetMemorySize bytes = 0;
+
+        /**
+         * The byte pattern to search for.
+         */
+        Targets::TargetMemoryBuffer pattern;
+
+        explicit SearchMemory(const RawPacket& rawPacket, const Gdb::TargetDescriptor& gdbTargetDescriptor);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
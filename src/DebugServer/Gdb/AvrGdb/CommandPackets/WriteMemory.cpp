@@ -22,52 +22,57 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
             throw Exception("Invalid packet length");
         }
 
-        const auto packetString = QString::fromLocal8Bit(
-            reinterpret_cast<const char*>(this->data.data() + 1),
-            static_cast<int>(this->data.size() - 1)
-        );
-
         /*
          * The write memory ('M') packet consists of three segments, an address, a length and a buffer.
          * The address and length are separated by a comma character, and the buffer proceeds a colon character.
          */
-        const auto packetSegments = packetString.split(",");
-        if (packetSegments.size() != 2) {
-            throw Exception(
-                "Unexpected number of segments in packet data: " + std::to_string(packetSegments.size())
-            );
+        const auto packetData = this->dataView().substr(1);
+        const auto commaPosition = packetData.find(',');
+        const auto colonPosition = packetData.find(':');
+
+        if (
+            commaPosition == std::string_view::npos
+            || colonPosition == std::string_view::npos
+            || colonPosition < commaPosition
+        ) {
+            throw Exception("Unexpected number of segments in packet data");
         }
 
-        bool conversionStatus = false;
-        const auto gdbStartAddress = packetSegments.at(0).toUInt(&conversionStatus, 16);
+        const auto gdbStartAddress = Packet::parseHex(packetData.substr(0, commaPosition));
 
-        if (!conversionStatus) {
+        if (!gdbStartAddress.has_value()) {
             throw Exception("Failed to parse start address from write memory packet data");
         }
 
-        this->memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbStartAddress);
-        this->startAddress = gdbStartAddress & ~(gdbTargetDescriptor.getMemoryOffset(this->memoryType));
+        this->setStartAddressFromGdbAddress(*gdbStartAddress, gdbTargetDescriptor);
 
-        const auto lengthAndBufferSegments = packetSegments.at(1).split(":");
-        if (lengthAndBufferSegments.size() != 2) {
-            throw Exception(
-                "Unexpected number of segments in packet data: "
-                    + std::to_string(lengthAndBufferSegments.size())
-            );
-        }
+        const auto bufferSize = Packet::parseHex(
+            packetData.substr(commaPosition + 1, colonPosition - (commaPosition + 1))
+        );
 
-        const auto bufferSize = lengthAndBufferSegments.at(0).toUInt(&conversionStatus, 16);
-        if (!conversionStatus) {
+        if (!bufferSize.has_value()) {
             throw Exception("Failed to parse write length from write memory packet data");
         }
 
-        this->buffer = Packet::hexToData(lengthAndBufferSegments.at(1).toStdString());
+        this->buffer = Packet::hexToData(packetData.substr(colonPosition + 1));
 
-        if (this->buffer.size() != bufferSize) {
+        if (this->buffer.size() != *bufferSize) {
             throw Exception("Buffer size does not match length value given in write memory packet");
         }
     }
 
+    WriteMemory::WriteMemory(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {}
+
+    void WriteMemory::setStartAddressFromGdbAddress(
+        std::uint32_t gdbStartAddress,
+        const TargetDescriptor& gdbTargetDescriptor
+    ) {
+        this->memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbStartAddress);
+        this->startAddress = gdbStartAddress & ~(gdbTargetDescriptor.getMemoryOffset(this->memoryType));
+    }
+
     void WriteMemory::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
         Logger::info("Handling WriteMemory packet");
 
@@ -38,5 +38,25 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
             DebugSession& debugSession,
             Services::TargetControllerService& targetControllerService
         ) override;
+
+    protected:
+        /**
+         * For derived packets that carry the same information in a different form (see WriteMemoryBinary). Derived
+         * classes are responsible for populating the members.
+         *
+         * @param rawPacket
+         */
+        explicit WriteMemory(const RawPacket& rawPacket);
+
+        /**
+         * Resolves the memory type and start address from the given GDB address.
+         *
+         * @param gdbStartAddress
+         * @param gdbTargetDescriptor
+         */
+        void setStartAddressFromGdbAddress(
+            std::uint32_t gdbStartAddress,
+            const Gdb::TargetDescriptor& gdbTargetDescriptor
+        );
     };
 }
@@ -0,0 +1,59 @@
+#include "WriteMemoryBinary.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    using namespace Bloom::Exceptions;
+
+    WriteMemoryBinary::WriteMemoryBinary(const RawPacket& rawPacket, const TargetDescriptor& gdbTargetDescriptor)
+        : WriteMemory(rawPacket)
+    {
+        if (this->data.size() < 4) {
+            throw Exception("Invalid packet length");
+        }
+
+        /*
+         * The binary write memory ('X') packet consists of three segments, an address, a length and a buffer.
+         * The address and length are separated by a comma character, and the buffer proceeds a colon character.
+         *
+         * The buffer may contain any byte value, including commas and colons, so we must search for the colon
+         * character after the comma. Escaped bytes will have already been decoded by the RawPacketParser.
+         *
+         * GDB will send an 'X' packet with an empty buffer to determine if we support the packet. The empty buffer
+         * is handled in WriteMemory::handle().
+         */
+        const auto packetData = this->dataView().substr(1);
+        const auto commaPosition = packetData.find(',');
+        const auto colonPosition = commaPosition != std::string_view::npos
+            ? packetData.find(':', commaPosition + 1)
+            : std::string_view::npos;
+
+        if (commaPosition == std::string_view::npos || colonPosition == std::string_view::npos) {
+            throw Exception("Unexpected number of segments in packet data");
+        }
+
+        const auto gdbStartAddress = Packet::parseHex(packetData.substr(0, commaPosition));
+
+        if (!gdbStartAddress.has_value()) {
+            throw Exception("Failed to parse start address from binary write memory packet data");
+        }
+
+        this->setStartAddressFromGdbAddress(*gdbStartAddress, gdbTargetDescriptor);
+
+        const auto bufferSize = Packet::parseHex(
+            packetData.substr(commaPosition + 1, colonPosition - (commaPosition + 1))
+        );
+
+        if (!bufferSize.has_value()) {
+            throw Exception("Failed to parse write length from binary write memory packet data");
+        }
+
+        // The packet data begins with the packet type character ('X'), hence the offset of 2.
+        this->buffer.assign(this->data.begin() + static_cast<long>(colonPosition) + 2, this->data.end());
+
+        if (this->buffer.size() != *bufferSize) {
+            throw Exception("Buffer size does not match length value given in binary write memory packet");
+        }
+    }
+}
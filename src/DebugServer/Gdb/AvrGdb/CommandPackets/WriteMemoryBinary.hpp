@@ -0,0 +1,19 @@
+#pragma once
+
+#include "WriteMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    /**
+     * The WriteMemoryBinary class implements the structure for "X" packets. This packet is the binary equivalent of
+     * the "M" packet (WriteMemory) - the data to write is sent in binary form, as opposed to hexadecimal, which halves
+     * the size of the packet.
+     *
+     * Handling of this packet is identical to that of the "M" packet, so we just inherit WriteMemory::handle().
+     */
+    class WriteMemoryBinary: public WriteMemory
+    {
+    public:
+        explicit WriteMemoryBinary(const RawPacket& rawPacket, const Gdb::TargetDescriptor& gdbTargetDescriptor);
+    };
+}
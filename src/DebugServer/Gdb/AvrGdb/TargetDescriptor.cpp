@@ -1,6 +1,9 @@
 #include "TargetDescriptor.hpp"
 
 #include <numeric>
+#include <algorithm>
+#include <set>
+#include <cctype>
 
 #include "src/Exceptions/Exception.hpp"
 #include "src/Logger/Logger.hpp"
@@ -12,7 +15,10 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
 
     using Bloom::Exceptions::Exception;
 
-    TargetDescriptor::TargetDescriptor(const Bloom::Targets::TargetDescriptor& targetDescriptor)
+    TargetDescriptor::TargetDescriptor(
+        const Bloom::Targets::TargetDescriptor& targetDescriptor,
+        bool includePeripheralRegisters
+    )
         : DebugServer::Gdb::TargetDescriptor(
             targetDescriptor,
             {
@@ -23,6 +29,11 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
         )
     {
         this->loadRegisterMappings();
+        this->loadRegisterLayout();
+
+        if (includePeripheralRegisters) {
+            this->loadPeripheralRegisterMappings();
+        }
     }
 
     std::optional<GdbRegisterNumber> TargetDescriptor::getRegisterNumberFromTargetRegisterDescriptor(
@@ -179,4 +190,53 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
             throw Exception("AVR8 program counter size exceeds the GDB register size.");
         }
     }
+
+    void TargetDescriptor::loadPeripheralRegisterMappings() {
+        const auto toGdbName = [] (std::string name) {
+            std::transform(name.begin(), name.end(), name.begin(), [] (unsigned char character) {
+                return std::isalnum(character) ? static_cast<char>(std::tolower(character)) : '_';
+            });
+
+            return name;
+        };
+
+        auto registerNames = std::set<std::string>();
+        auto regNumber = static_cast<GdbRegisterNumber>(this->registerNumbers.size());
+
+        for (const auto& [registerType, registerDescriptors] : this->targetDescriptor.registerDescriptorsByType) {
+            if (
+                registerType != TargetRegisterType::OTHER
+                && registerType != TargetRegisterType::PORT_REGISTER
+            ) {
+                continue;
+            }
+
+            for (const auto& descriptor : registerDescriptors) {
+                if (
+                    !descriptor.startAddress.has_value()
+                    || !descriptor.name.has_value()
+                    || descriptor.name->empty()
+                    || !descriptor.groupName.has_value()
+                    || descriptor.size == 0
+                ) {
+                    continue;
+                }
+
+                const auto gdbName = toGdbName(*descriptor.groupName + "_" + *descriptor.name);
+                if (!registerNames.insert(gdbName).second) {
+                    Logger::debug("Duplicate peripheral register name (\"" + gdbName + "\") - ignoring register");
+                    continue;
+                }
+
+                this->registerDescriptorsByGdbNumber.insert(std::pair(
+                    regNumber,
+                    RegisterDescriptor(regNumber, static_cast<std::uint16_t>(descriptor.size), gdbName)
+                ));
+                this->targetRegisterDescriptorsByGdbNumber.insert(std::pair(regNumber, descriptor));
+                this->peripheralRegisterNumbers.push_back(regNumber);
+
+                regNumber++;
+            }
+        }
+    }
 }
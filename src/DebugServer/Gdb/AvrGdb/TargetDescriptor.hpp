@@ -12,7 +12,17 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
         BiMap<GdbRegisterNumber, RegisterDescriptor> registerDescriptorsByGdbNumber = {};
         BiMap<GdbRegisterNumber, Targets::TargetRegisterDescriptor> targetRegisterDescriptorsByGdbNumber = {};
 
-        explicit TargetDescriptor(const Targets::TargetDescriptor& targetDescriptor);
+        /**
+         * @param targetDescriptor
+         *
+         * @param includePeripheralRegisters
+         *  Whether to map the target's peripheral registers to GDB registers. See
+         *  GdbDebugServerConfig::peripheralRegisters.
+         */
+        explicit TargetDescriptor(
+            const Targets::TargetDescriptor& targetDescriptor,
+            bool includePeripheralRegisters = false
+        );
 
         /**
          * Should retrieve the GDB register number, given a target register descriptor. Or std::nullopt if the target
@@ -45,8 +55,21 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
 
         const std::vector<GdbRegisterNumber>& getRegisterNumbers() const override;
 
+        /**
+         * Returns the GDB register numbers of all mapped peripheral registers, in ascending order.
+         *
+         * Peripheral registers are not included in TargetDescriptor::getRegisterNumbers(), as they're not part of
+         * the register packet. They're only accessible via the 'p' and 'P' commands.
+         *
+         * @return
+         */
+        const std::vector<GdbRegisterNumber>& getPeripheralRegisterNumbers() const {
+            return this->peripheralRegisterNumbers;
+        }
+
     private:
         std::vector<GdbRegisterNumber> registerNumbers = std::vector<GdbRegisterNumber>(35);
+        std::vector<GdbRegisterNumber> peripheralRegisterNumbers;
 
         /**
          * For AVR targets, avr-gdb defines 35 registers in total:
@@ -59,5 +82,12 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
          * This function will prepare the appropriate GDB register numbers and mappings.
          */
         void loadRegisterMappings();
+
+        /**
+         * Maps all named peripheral registers to GDB registers, starting at register number 35. The GDB register
+         * names take the form "<peripheral>_<register>" (in lower case), as register names alone are not unique on
+         * some targets.
+         */
+        void loadPeripheralRegisterMappings();
     };
 }
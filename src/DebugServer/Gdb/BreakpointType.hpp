@@ -1,5 +1,9 @@
 #pragma once
 
+#include <optional>
+
+#include "src/Targets/TargetBreakpoint.hpp"
+
 namespace Bloom::DebugServer::Gdb
 {
     enum class BreakpointType: int
@@ -7,5 +11,61 @@ namespace Bloom::DebugServer::Gdb
         UNKNOWN = 0,
         SOFTWARE_BREAKPOINT = 1,
         HARDWARE_BREAKPOINT = 2,
+        WRITE_WATCHPOINT = 3,
+        READ_WATCHPOINT = 4,
+        ACCESS_WATCHPOINT = 5,
     };
+
+    /**
+     * Maps the type character of a "Z"/"z" packet (Z0 = SW breakpoint, Z1 = HW breakpoint, Z2 = write watchpoint,
+     * Z3 = read watchpoint, Z4 = access watchpoint) to a BreakpointType.
+     *
+     * @param typeCharacter
+     * @return
+     */
+    static inline BreakpointType breakpointTypeFromPacketCharacter(unsigned char typeCharacter) {
+        switch (typeCharacter) {
+            case '0': {
+                return BreakpointType::SOFTWARE_BREAKPOINT;
+            }
+            case '1': {
+                return BreakpointType::HARDWARE_BREAKPOINT;
+            }
+            case '2': {
+                return BreakpointType::WRITE_WATCHPOINT;
+            }
+            case '3': {
+                return BreakpointType::READ_WATCHPOINT;
+            }
+            case '4': {
+                return BreakpointType::ACCESS_WATCHPOINT;
+            }
+            default: {
+                return BreakpointType::UNKNOWN;
+            }
+        }
+    }
+
+    /**
+     * Maps watchpoint breakpoint types to their TargetWatchpointType. Yields std::nullopt for non-watchpoint types.
+     *
+     * @param type
+     * @return
+     */
+    static inline std::optional<Targets::TargetWatchpointType> watchpointTypeFromBreakpointType(BreakpointType type) {
+        switch (type) {
+            case BreakpointType::WRITE_WATCHPOINT: {
+                return Targets::TargetWatchpointType::WRITE;
+            }
+            case BreakpointType::READ_WATCHPOINT: {
+                return Targets::TargetWatchpointType::READ;
+            }
+            case BreakpointType::ACCESS_WATCHPOINT: {
+                return Targets::TargetWatchpointType::ACCESS;
+            }
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
 }
@@ -0,0 +1,34 @@
+#include "AcknowledgeStopNotification.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::OkResponsePacket;
+
+    AcknowledgeStopNotification::AcknowledgeStopNotification(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {}
+
+    void AcknowledgeStopNotification::handle(DebugSession& debugSession, TargetControllerService&) {
+        Logger::info("Handling AcknowledgeStopNotification packet");
+
+        auto& pendingStopReplies = debugSession.pendingStopReplies;
+
+        // The client has consumed the front stop reply
+        if (!pendingStopReplies.empty()) {
+            pendingStopReplies.pop_front();
+        }
+
+        if (!pendingStopReplies.empty()) {
+            debugSession.connection.writePacket(pendingStopReplies.front());
+            return;
+        }
+
+        debugSession.connection.writePacket(OkResponsePacket());
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The AcknowledgeStopNotification class implements a structure for "vStopped" packets.
+     *
+     * In non-stop mode, GDB responds to our "%Stop" notifications with a "vStopped" packet, to acknowledge receipt of
+     * the reported stop reply and request the next one. We respond with the next pending stop reply, or "OK" if there
+     * are none. GDB keeps sending "vStopped" packets until it receives the "OK" response.
+     *
+     * See DebugSession::pendingStopReplies for more.
+     */
+    class AcknowledgeStopNotification: public CommandPacket
+    {
+    public:
+        explicit AcknowledgeStopNotification(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
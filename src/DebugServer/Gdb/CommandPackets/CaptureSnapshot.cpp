@@ -0,0 +1,117 @@
+#include "CaptureSnapshot.hpp"
+
+#include <sstream>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ConsoleProgressReporter.hpp"
+
+#include "src/Services/MemorySnapshotService.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Helpers/EnumToStringMappings.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+    using Services::MemorySnapshotService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    CaptureSnapshot::CaptureSnapshot(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {
+        // Options (and their values, which may contain spaces) follow the positional arguments
+        auto arguments = std::stringstream(this->command.substr(0, this->command.find(" --")));
+        auto argument = std::string();
+
+        // Skip the command name
+        arguments >> argument;
+
+        if (arguments >> argument) {
+            this->name = argument;
+        }
+
+        if (arguments >> argument) {
+            this->memoryTypeName = argument;
+        }
+
+        const auto descriptionOptionIt = this->commandOptions.find("description");
+        if (descriptionOptionIt != this->commandOptions.end() && descriptionOptionIt->second.has_value()) {
+            this->description = *(descriptionOptionIt->second);
+        }
+    }
+
+    void CaptureSnapshot::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling CaptureSnapshot packet");
+
+        const auto writeOutput = [&debugSession] (const std::string& output) {
+            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output + "\n")));
+        };
+
+        if (this->name.empty()) {
+            writeOutput("Usage: monitor snapshot <name> [ram|eeprom|flash] [--description=<text>]");
+            return;
+        }
+
+        const auto memoryType = this->memoryTypeName.has_value()
+            ? EnumToStringMappings::targetMemoryTypes.valueAt(QString::fromStdString(*(this->memoryTypeName)))
+            : std::optional(Targets::TargetMemoryType::RAM);
+
+        if (!memoryType.has_value() || *memoryType == Targets::TargetMemoryType::OTHER) {
+            writeOutput(
+                "Invalid memory type (\"" + this->memoryTypeName.value_or("") + "\") - expected ram, eeprom or flash"
+            );
+            return;
+        }
+
+        const auto& targetDescriptor = debugSession.gdbTargetDescriptor.targetDescriptor;
+        if (!targetDescriptor.memoryDescriptorsByType.contains(*memoryType)) {
+            writeOutput("Target has no " + this->memoryTypeName.value_or("ram") + " memory");
+            return;
+        }
+
+        try {
+            if (targetControllerService.getTargetState() != Targets::TargetState::STOPPED) {
+                writeOutput("The target must be stopped to capture a snapshot");
+                return;
+            }
+
+            const auto progressReporter = ConsoleProgressReporter(
+                debugSession.connection,
+                targetControllerService,
+                "Capturing snapshot"
+            );
+
+            auto snapshot = MemorySnapshotService::capture(
+                targetControllerService,
+                QString::fromStdString(this->name),
+                QString::fromStdString(this->description),
+                *memoryType,
+                {},
+                {}
+            );
+
+            const auto snapshotFilePath = MemorySnapshotService::store(
+                snapshot,
+                MemorySnapshotService::latestFullSnapshot(*memoryType)
+            );
+
+            writeOutput(
+                "Captured " + EnumToStringMappings::targetMemoryTypes.at(*memoryType).toUpper().toStdString()
+                    + " snapshot \"" + this->name + "\" (" + std::to_string(snapshot.data.size()) + " bytes"
+                    + (snapshot.baseSnapshotId.has_value() ? ", stored as a delta" : "") + ") - UUID: "
+                    + snapshot.id.toStdString() + "\nSaved to " + snapshotFilePath.toStdString()
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to capture snapshot - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
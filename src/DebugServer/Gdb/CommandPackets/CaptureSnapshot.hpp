@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+
+#include "Monitor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The CaptureSnapshot class implements a structure for the "monitor snapshot" GDB command.
+     *
+     * "snapshot <name> [ram|eeprom|flash]" captures a snapshot of the given memory (RAM, by default) and stores it
+     * alongside the snapshots captured in Insight, where it can be viewed and compared like any other. A description
+     * can be provided via the --description option.
+     *
+     * The snapshot is captured and stored via the MemorySnapshotService, with a single bulk read of the memory.
+     */
+    class CaptureSnapshot: public Monitor
+    {
+    public:
+        explicit CaptureSnapshot(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        std::string name;
+        std::optional<std::string> memoryTypeName;
+        std::string description;
+    };
+}
@@ -0,0 +1,121 @@
+#include "Checkpoint.hpp"
+
+#include <sstream>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/DebugServer/Gdb/Exceptions/InvalidCommandOption.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+    using Services::StringService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Targets::TargetRegisterDescriptors;
+    using Targets::TargetRegisterType;
+
+    using Bloom::Exceptions::Exception;
+    using Exceptions::InvalidCommandOption;
+
+    Checkpoint::Checkpoint(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {
+        if (this->command.find("checkpoint restore") == 0) {
+            this->action = Action::RESTORE;
+        }
+    }
+
+    void Checkpoint::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling Checkpoint packet");
+
+        try {
+            if (this->action == Action::RESTORE) {
+                targetControllerService.restoreCheckpoint();
+
+                debugSession.connection.writePacket(ResponsePacket(StringService::toHex(
+                    "Target restored to checkpoint. GDB isn't aware that the target has moved - use \"maintenance "
+                    "flush register-cache\" (or \"flushregs\").\n"
+                )));
+                return;
+            }
+
+            const auto peripheralRegisterDescriptors = this->resolvePeripheralRegisterDescriptors(debugSession);
+            targetControllerService.captureCheckpoint(peripheralRegisterDescriptors);
+
+            debugSession.connection.writePacket(ResponsePacket(StringService::toHex(
+                "Checkpoint captured (including " + std::to_string(peripheralRegisterDescriptors.size())
+                    + " peripheral register(s)). Use \"monitor checkpoint restore\" to return to it.\n"
+            )));
+
+        } catch (const InvalidCommandOption& exception) {
+            Logger::error(exception.getMessage());
+            debugSession.connection.writePacket(
+                ResponsePacket(StringService::toHex(exception.getMessage() + "\n"))
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Checkpoint command failed - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    TargetRegisterDescriptors Checkpoint::resolvePeripheralRegisterDescriptors(const DebugSession& debugSession) {
+        auto output = TargetRegisterDescriptors();
+
+        const auto optionIt = this->commandOptions.find("registers");
+        if (optionIt == this->commandOptions.end() || !optionIt->second.has_value()) {
+            return output;
+        }
+
+        const auto& registerDescriptorsByType =
+            debugSession.gdbTargetDescriptor.targetDescriptor.registerDescriptorsByType;
+
+        auto nameStream = std::stringstream(*(optionIt->second));
+        auto name = std::string();
+
+        while (std::getline(nameStream, name, ',')) {
+            if (name.empty()) {
+                continue;
+            }
+
+            const auto lowerName = StringService::asciiToLower(name);
+            auto found = false;
+
+            for (const auto& [registerType, descriptors] : registerDescriptorsByType) {
+                // CPU registers are always captured
+                if (
+                    registerType == TargetRegisterType::GENERAL_PURPOSE_REGISTER
+                    || registerType == TargetRegisterType::STATUS_REGISTER
+                    || registerType == TargetRegisterType::STACK_POINTER
+                    || registerType == TargetRegisterType::PROGRAM_COUNTER
+                ) {
+                    continue;
+                }
+
+                for (const auto& descriptor : descriptors) {
+                    if (
+                        descriptor.name.has_value()
+                        && StringService::asciiToLower(*(descriptor.name)) == lowerName
+                    ) {
+                        output.insert(descriptor);
+                        found = true;
+                    }
+                }
+            }
+
+            if (!found) {
+                throw InvalidCommandOption("Unknown register \"" + name + "\"");
+            }
+        }
+
+        return output;
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Monitor.hpp"
+
+#include "src/Targets/TargetRegister.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The Checkpoint class implements a structure for the "monitor checkpoint" and "monitor checkpoint restore" GDB
+     * commands.
+     *
+     * "checkpoint" instructs the TargetController to capture the target's RAM and CPU registers (see
+     * TargetController::Commands::CaptureCheckpoint). Peripheral registers can be included via the --registers
+     * option, as a comma-separated list of register names: "--registers=TCCR1A,TCCR1B,TIMSK1".
+     *
+     * "checkpoint restore" writes the captured state back to the target, allowing for the firmware to be restarted
+     * from the checkpoint without a reset and re-running its initialisation code.
+     */
+    class Checkpoint: public Monitor
+    {
+    public:
+        enum class Action: std::uint8_t
+        {
+            CAPTURE,
+            RESTORE,
+        };
+
+        Action action = Action::CAPTURE;
+
+        explicit Checkpoint(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        /**
+         * Resolves the register names given via the --registers option to register descriptors.
+         *
+         * @param debugSession
+         *
+         * @return
+         */
+        Targets::TargetRegisterDescriptors resolvePeripheralRegisterDescriptors(const DebugSession& debugSession);
+    };
+}
@@ -24,7 +24,7 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
     using Exceptions::Exception;
 
     void CommandPacket::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
-        const auto packetString = std::string(this->data.begin(), this->data.end());
+        const auto packetString = this->dataView();
 
         if (packetString.empty()) {
             Logger::error("Empty GDB RSP packet received.");
@@ -34,23 +34,41 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
 
         if (packetString[0] == '?') {
             // Status report
-            debugSession.connection.writePacket(TargetStopped(Signal::TRAP));
+            if (!debugSession.nonStopMode) {
+                debugSession.connection.writePacket(TargetStopped(Signal::TRAP));
+                return;
+            }
+
+            /*
+             * In non-stop mode, the status report replaces any pending stop replies. If the target is running, there
+             * is nothing to report. Otherwise, the stop reply is handled like any other pending stop reply - GDB
+             * will follow up with "vStopped" packets.
+             */
+            debugSession.pendingStopReplies.clear();
+
+            if (targetControllerService.getTargetState() != Targets::TargetState::STOPPED) {
+                debugSession.connection.writePacket(OkResponsePacket());
+                return;
+            }
+
+            debugSession.pendingStopReplies.emplace_back(Signal::TRAP);
+            debugSession.connection.writePacket(debugSession.pendingStopReplies.front());
             return;
         }
 
-        if (packetString.find("vMustReplyEmpty") == 0) {
+        if (packetString.starts_with("vMustReplyEmpty")) {
             Logger::info("Handling vMustReplyEmpty");
             debugSession.connection.writePacket(EmptyResponsePacket());
             return;
         }
 
-        if (packetString.find("qAttached") == 0) {
+        if (packetString.starts_with("qAttached")) {
             Logger::info("Handling qAttached");
             debugSession.connection.writePacket(ResponsePacket(std::vector<unsigned char>({1})));
             return;
         }
 
-        Logger::debug("Unknown GDB RSP packet: " + packetString + " - returning empty response");
+        Logger::debug("Unknown GDB RSP packet: " + std::string(packetString) + " - returning empty response");
 
         // Respond with an empty packet
         debugSession.connection.writePacket(EmptyResponsePacket());
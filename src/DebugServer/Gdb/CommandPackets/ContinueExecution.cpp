@@ -1,5 +1,6 @@
 #include "ContinueExecution.hpp"
 
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 
 #include "src/Logger/Logger.hpp"
@@ -9,16 +10,19 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
 {
     using Services::TargetControllerService;
 
+    using ResponsePackets::OkResponsePacket;
     using ResponsePackets::ErrorResponsePacket;
     using Exceptions::Exception;
 
     ContinueExecution::ContinueExecution(const RawPacket& rawPacket)
         : CommandPacket(rawPacket)
     {
-        if (this->data.size() > 2) {
-            this->fromAddress = static_cast<Targets::TargetProgramCounter>(
-                std::stoi(std::string(this->data.begin() + 2, this->data.end()), nullptr, 16)
-            );
+        if (this->data.size() > 1) {
+            this->fromAddress = Packet::parseHex<Targets::TargetMemoryAddress>(this->dataView().substr(1));
+
+            if (!this->fromAddress.has_value()) {
+                throw Exception("Failed to parse address from continue packet data");
+            }
         }
     }
 
@@ -28,6 +32,12 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
         try {
             targetControllerService.continueTargetExecution(this->fromAddress, std::nullopt);
             debugSession.waitingForBreak = true;
+            debugSession.steppingExecution = false;
+
+            if (debugSession.nonStopMode) {
+                // The stop will be reported via a notification
+                debugSession.connection.writePacket(OkResponsePacket());
+            }
 
         } catch (const Exception& exception) {
             Logger::error("Failed to continue execution on target - " + exception.getMessage());
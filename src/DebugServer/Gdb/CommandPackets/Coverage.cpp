@@ -0,0 +1,213 @@
+#include "Coverage.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+#include <chrono>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/ProgramImage/DwarfLineTable.hpp"
+#include "src/Services/PathService.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/DebugServer/Gdb/Exceptions/InvalidCommandOption.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Targets::TargetMemoryAddress;
+
+    using Bloom::Exceptions::Exception;
+    using Exceptions::InvalidCommandOption;
+
+    Coverage::Coverage(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {
+        if (this->command.find("coverage start") == 0) {
+            this->action = Action::START;
+
+        } else if (this->command.find("coverage stop") == 0) {
+            this->action = Action::STOP;
+        }
+    }
+
+    void Coverage::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling Coverage packet");
+
+        try {
+            switch (this->action) {
+                case Action::START: {
+                    this->handleStart(debugSession, targetControllerService);
+                    break;
+                }
+                case Action::STOP: {
+                    this->handleStop(debugSession, targetControllerService);
+                    break;
+                }
+                default: {
+                    throw InvalidCommandOption(
+                        "Unknown coverage action - use \"coverage start\" or \"coverage stop\""
+                    );
+                }
+            }
+
+        } catch (const InvalidCommandOption& exception) {
+            Logger::error(exception.getMessage());
+            debugSession.connection.writePacket(
+                ResponsePacket(Services::StringService::toHex(exception.getMessage() + "\n"))
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to handle coverage command - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    void Coverage::handleStart(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        const auto elfPath = this->getOptionValue("elf");
+        if (!elfPath.has_value()) {
+            throw InvalidCommandOption("ELF file path required - use the --elf option: \"--elf=firmware.elf\"");
+        }
+
+        const auto batchSize = this->getPositiveIntegerOption(
+            "batch",
+            static_cast<std::uint32_t>(Coverage::DEFAULT_BATCH_SIZE)
+        );
+        const auto sweepInterval = std::chrono::milliseconds(
+            this->getPositiveIntegerOption("sweep", Coverage::DEFAULT_SWEEP_INTERVAL_MS)
+        );
+
+        auto addresses = DwarfLineTable::fromFile(*elfPath).statementAddresses();
+        if (addresses.empty()) {
+            throw Exception("The ELF file's line table holds no statement addresses");
+        }
+
+        const auto addressCount = addresses.size();
+        targetControllerService.startCoverageCollection(std::move(addresses), batchSize, sweepInterval);
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+            "Coverage collection started - " + std::to_string(addressCount) + " statement addresses, instrumented in "
+                "batches of " + std::to_string(batchSize) + " (swept every " + std::to_string(sweepInterval.count())
+                + " ms)\n"
+        )));
+    }
+
+    void Coverage::handleStop(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        const auto report = targetControllerService.stopCoverageCollection();
+
+        auto outputFilePath = std::filesystem::path(
+            this->getOptionValue("out").value_or(Coverage::DEFAULT_OUTPUT_FILE_NAME)
+        );
+
+        if (outputFilePath.is_relative()) {
+            outputFilePath = std::filesystem::path(Services::PathService::projectDirPath()) / outputFilePath;
+        }
+
+        Coverage::writeReport(outputFilePath.string(), report->addresses, report->hits);
+
+        const auto addressCount = report->addresses.size();
+        const auto hitCount = static_cast<std::size_t>(std::count(report->hits.begin(), report->hits.end(), true));
+        const auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(report->collectionDuration);
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+            "Coverage collection stopped, after " + std::to_string(durationMs.count()) + " ms ("
+                + std::to_string(report->sweepCount) + " sweeps) - " + std::to_string(hitCount) + " of "
+                + std::to_string(addressCount) + " statement addresses hit ("
+                + std::to_string(addressCount > 0 ? hitCount * 100 / addressCount : 0) + "%)\n"
+                + "Coverage report saved to " + outputFilePath.string() + "\n"
+        )));
+
+        Logger::info("Coverage report saved to " + outputFilePath.string());
+    }
+
+    std::uint32_t Coverage::getPositiveIntegerOption(const std::string& optionName, std::uint32_t defaultValue) const {
+        const auto value = this->getOptionValue(optionName);
+        if (!value.has_value()) {
+            return defaultValue;
+        }
+
+        try {
+            const auto parsedValue = std::stoul(*value);
+            if (parsedValue == 0 || parsedValue > std::numeric_limits<std::uint32_t>::max()) {
+                throw std::out_of_range("Value out of range");
+            }
+
+            return static_cast<std::uint32_t>(parsedValue);
+
+        } catch (const std::logic_error&) {
+            throw InvalidCommandOption("Invalid --" + optionName + " value - the value must be a positive integer");
+        }
+    }
+
+    void Coverage::writeReport(
+        const std::string& filePath,
+        const std::vector<TargetMemoryAddress>& addresses,
+        const std::vector<bool>& hits
+    ) {
+        auto outputFile = std::ofstream(filePath, std::ios::out | std::ios::trunc);
+        if (!outputFile.is_open()) {
+            throw Exception("Failed to open/create coverage output file (" + filePath + "). Check file permissions.");
+        }
+
+        const auto hitCount = static_cast<std::size_t>(std::count(hits.begin(), hits.end(), true));
+
+        outputFile << "# Bloom coverage report\n";
+        outputFile << "# " << hitCount << " of " << addresses.size() << " statement addresses hit\n";
+        outputFile << "# Bitmaps hold one bit per byte address, least significant bit first\n";
+
+        const auto toHex = [] (TargetMemoryAddress address) {
+            auto stream = std::stringstream();
+            stream << "0x" << std::hex << std::uppercase << std::setfill('0') << std::setw(8) << address;
+            return stream.str();
+        };
+
+        auto rangeStartIndex = std::size_t(0);
+
+        while (rangeStartIndex < addresses.size()) {
+            auto rangeEndIndex = rangeStartIndex;
+            while (
+                rangeEndIndex + 1 < addresses.size()
+                && addresses[rangeEndIndex + 1] - addresses[rangeEndIndex] <= Coverage::MAX_RANGE_GAP
+            ) {
+                ++rangeEndIndex;
+            }
+
+            const auto startAddress = addresses[rangeStartIndex];
+            const auto endAddress = addresses[rangeEndIndex];
+
+            auto instrumentedBitmap = std::vector<unsigned char>((endAddress - startAddress) / 8 + 1, 0x00);
+            auto hitBitmap = instrumentedBitmap;
+
+            for (auto index = rangeStartIndex; index <= rangeEndIndex; ++index) {
+                const auto offset = addresses[index] - startAddress;
+                const auto mask = static_cast<unsigned char>(0x01 << (offset % 8));
+
+                instrumentedBitmap[offset / 8] |= mask;
+
+                if (hits[index]) {
+                    hitBitmap[offset / 8] |= mask;
+                }
+            }
+
+            outputFile << "range " << toHex(startAddress) << " " << toHex(endAddress) << "\n";
+            outputFile << "instrumented " << Services::StringService::toHex(instrumentedBitmap) << "\n";
+            outputFile << "hit " << Services::StringService::toHex(hitBitmap) << "\n";
+
+            rangeStartIndex = rangeEndIndex + 1;
+        }
+
+        outputFile.close();
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <optional>
+#include <vector>
+
+#include "Monitor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The Coverage class implements a structure for the "monitor coverage start" and "monitor coverage stop" GDB
+     * commands.
+     *
+     * "coverage start" extracts the statement addresses from the DWARF line table of the ELF file given via the --elf
+     * option, and instructs the TargetController to instrument them with breakpoints, in batches (see
+     * TargetControllerComponent::recordCoverageHit()). "coverage stop" ends the collection and writes the results to
+     * a file, as a pair of bitmaps per address range (see Coverage::writeReport()).
+     */
+    class Coverage: public Monitor
+    {
+    public:
+        static constexpr std::size_t DEFAULT_BATCH_SIZE = 32;
+        static constexpr std::uint32_t DEFAULT_SWEEP_INTERVAL_MS = 500;
+        static constexpr auto DEFAULT_OUTPUT_FILE_NAME = "bloom-coverage.txt";
+
+        /**
+         * Instrumented addresses further apart than this are reported in separate address ranges.
+         */
+        static constexpr Targets::TargetMemorySize MAX_RANGE_GAP = 64;
+
+        enum class Action: std::uint8_t
+        {
+            NONE,
+            START,
+            STOP,
+        };
+
+        Action action = Action::NONE;
+
+        explicit Coverage(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        void handleStart(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+        void handleStop(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Parses a positive integer option value.
+         *
+         * @param optionName
+         * @param defaultValue
+         *
+         * @throws InvalidCommandOption
+         *  If the value is not a positive integer.
+         *
+         * @return
+         */
+        std::uint32_t getPositiveIntegerOption(const std::string& optionName, std::uint32_t defaultValue) const;
+
+        /**
+         * Writes the coverage report.
+         *
+         * The report is a text file. Instrumented addresses are grouped into address ranges, and each range is
+         * described by three lines:
+         *
+         *   range <start address> <end address>
+         *   instrumented <bitmap>
+         *   hit <bitmap>
+         *
+         * Each bitmap holds one bit per byte address in the range, in hexadecimal form. The least significant bit
+         * of the first byte corresponds to the range's start address. Lines beginning with '#' are comments.
+         *
+         * @param filePath
+         * @param addresses
+         * @param hits
+         */
+        static void writeReport(
+            const std::string& filePath,
+            const std::vector<Targets::TargetMemoryAddress>& addresses,
+            const std::vector<bool>& hits
+        );
+    };
+}
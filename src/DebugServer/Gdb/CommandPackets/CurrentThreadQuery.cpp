@@ -0,0 +1,51 @@
+#include "CurrentThreadQuery.hpp"
+
+#include <sstream>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/EmptyResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::EmptyResponsePacket;
+
+    using Exceptions::Exception;
+
+    CurrentThreadQuery::CurrentThreadQuery(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {}
+
+    void CurrentThreadQuery::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling CurrentThreadQuery packet");
+
+        if (!debugSession.rtosThreadAwareness.has_value()) {
+            debugSession.connection.writePacket(EmptyResponsePacket());
+            return;
+        }
+
+        try {
+            const auto threadId = debugSession.rtosThreadAwareness->getCurrentThreadId(targetControllerService);
+
+            if (!threadId.has_value()) {
+                debugSession.connection.writePacket(EmptyResponsePacket());
+                return;
+            }
+
+            auto output = std::stringstream();
+            output << "QC" << std::hex << *threadId;
+
+            debugSession.connection.writePacket(ResponsePacket(output.str()));
+
+        } catch (const Exception& exception) {
+            // GDB will assume a single thread
+            Logger::error("Failed to determine the running RTOS thread - " + exception.getMessage());
+            debugSession.connection.writePacket(EmptyResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The CurrentThreadQuery class implements a structure for "qC" packets. In response to these packets, the server
+     * is expected to send the ID of the current thread ("QC<id>") - for RTOS threads, the running task.
+     */
+    class CurrentThreadQuery: public CommandPacket
+    {
+    public:
+        explicit CurrentThreadQuery(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
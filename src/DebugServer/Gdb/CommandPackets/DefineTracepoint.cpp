@@ -0,0 +1,381 @@
+#include "DefineTracepoint.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/TargetController/Tracepoint.hpp"
+#include "src/TargetController/AgentExpression.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using Targets::TargetRegisterType;
+
+    using TargetController::Tracepoint;
+    using TargetController::AgentExpression;
+
+    using ResponsePackets::OkResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    DefineTracepoint::DefineTracepoint(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        // "QTDP:" is 5 characters long
+        auto packetData = this->dataView();
+        if (packetData.size() < 6) {
+            throw Exception("Unexpected DefineTracepoint packet size");
+        }
+
+        packetData.remove_prefix(5);
+
+        // A trailing '-' indicates that more packets will follow, for the same tracepoint
+        if (packetData.back() == '-') {
+            packetData.remove_suffix(1);
+        }
+
+        this->continuation = packetData.front() == '-';
+        if (this->continuation) {
+            packetData.remove_prefix(1);
+        }
+
+        const auto addressPosition = packetData.find(':');
+        const auto actionsPosition = addressPosition != std::string_view::npos
+            ? packetData.find(':', addressPosition + 1)
+            : std::string_view::npos;
+
+        if (actionsPosition == std::string_view::npos) {
+            throw Exception("Unexpected number of packet segments in DefineTracepoint packet");
+        }
+
+        const auto tracepointNumber = Packet::parseHex<std::uint32_t>(packetData.substr(0, addressPosition));
+        const auto address = Packet::parseHex<Targets::TargetMemoryAddress>(
+            packetData.substr(addressPosition + 1, actionsPosition - (addressPosition + 1))
+        );
+
+        if (!tracepointNumber.has_value() || !address.has_value()) {
+            throw Exception("Failed to parse tracepoint number or address from DefineTracepoint packet");
+        }
+
+        this->tracepointNumber = *tracepointNumber;
+        this->address = *address;
+
+        if (this->continuation) {
+            this->parseActions(packetData.substr(actionsPosition + 1));
+            return;
+        }
+
+        // The remaining segments take the form of "ena:step:pass[:Fflen][:Xlen,cond]"
+        auto segments = std::vector<std::string_view>();
+        auto segmentPosition = actionsPosition;
+        while (segmentPosition != std::string_view::npos) {
+            const auto segmentEndPosition = packetData.find(':', segmentPosition + 1);
+            segments.emplace_back(
+                packetData.substr(segmentPosition + 1, segmentEndPosition - (segmentPosition + 1))
+            );
+            segmentPosition = segmentEndPosition;
+        }
+
+        if (segments.size() < 3 || (segments[0] != "E" && segments[0] != "D")) {
+            throw Exception("Invalid DefineTracepoint packet");
+        }
+
+        this->enabled = segments[0] == "E";
+
+        const auto stepCount = Packet::parseHex<std::uint64_t>(segments[1]);
+        const auto passCount = Packet::parseHex<std::uint64_t>(segments[2]);
+
+        if (!stepCount.has_value() || !passCount.has_value()) {
+            throw Exception("Failed to parse step or pass count from DefineTracepoint packet");
+        }
+
+        this->stepCount = *stepCount;
+        this->passCount = *passCount;
+
+        for (auto segmentIt = segments.begin() + 3; segmentIt != segments.end(); ++segmentIt) {
+            const auto& segment = *segmentIt;
+
+            if (segment.empty() || segment.front() != 'X') {
+                // Fast and static tracepoints - we don't report support for these, so GDB shouldn't request them
+                continue;
+            }
+
+            const auto lengthEndPosition = segment.find(',');
+            const auto length = lengthEndPosition != std::string_view::npos
+                ? Packet::parseHex<std::size_t>(segment.substr(1, lengthEndPosition - 1))
+                : std::nullopt;
+
+            if (!length.has_value() || segment.size() - (lengthEndPosition + 1) != *length * 2) {
+                throw Exception("Invalid tracepoint condition in DefineTracepoint packet");
+            }
+
+            try {
+                this->condition = Packet::hexToData(segment.substr(lengthEndPosition + 1));
+
+            } catch (const std::invalid_argument&) {
+                throw Exception("Invalid tracepoint condition bytecode in DefineTracepoint packet");
+            }
+        }
+    }
+
+    void DefineTracepoint::handle(DebugSession& debugSession, TargetControllerService&) {
+        Logger::info("Handling DefineTracepoint packet");
+
+        try {
+            const auto& gdbTargetDescriptor = debugSession.gdbTargetDescriptor;
+
+            if (!this->continuation) {
+                auto tracepoint = Tracepoint(this->tracepointNumber, this->address);
+                tracepoint.enabled = this->enabled;
+                tracepoint.passCount = this->passCount;
+
+                if (this->condition.has_value()) {
+                    tracepoint.condition = gdbTargetDescriptor.createAgentExpression(std::move(*this->condition));
+                }
+
+                // The program counter is always collected, so that GDB can determine the location of each frame
+                const auto& mappedDescriptors = gdbTargetDescriptor.getMappedTargetRegisterDescriptors();
+                const auto programCounterDescriptorIt = std::find_if(
+                    mappedDescriptors.begin(),
+                    mappedDescriptors.end(),
+                    [] (const Targets::TargetRegisterDescriptor& descriptor) {
+                        return descriptor.type == TargetRegisterType::PROGRAM_COUNTER;
+                    }
+                );
+
+                if (programCounterDescriptorIt != mappedDescriptors.end()) {
+                    tracepoint.registerDescriptors.insert(*programCounterDescriptorIt);
+                }
+
+                if (this->stepCount > 0) {
+                    Logger::warning(
+                        "While-stepping actions are not supported - tracepoint "
+                            + std::to_string(this->tracepointNumber) + " will only collect data at its address"
+                    );
+                }
+
+                debugSession.tracepointsByNumber.insert_or_assign(this->tracepointNumber, std::move(tracepoint));
+                debugSession.steppingTracepointNumbers.erase(this->tracepointNumber);
+
+                debugSession.connection.writePacket(OkResponsePacket());
+                return;
+            }
+
+            const auto tracepointIt = debugSession.tracepointsByNumber.find(this->tracepointNumber);
+            if (tracepointIt == debugSession.tracepointsByNumber.end()) {
+                throw Exception("Unknown tracepoint (number " + std::to_string(this->tracepointNumber) + ")");
+            }
+
+            if (this->steppingActions) {
+                debugSession.steppingTracepointNumbers.insert(this->tracepointNumber);
+            }
+
+            if (debugSession.steppingTracepointNumbers.contains(this->tracepointNumber)) {
+                Logger::debug(
+                    "Ignoring while-stepping actions for tracepoint " + std::to_string(this->tracepointNumber)
+                );
+                debugSession.connection.writePacket(OkResponsePacket());
+                return;
+            }
+
+            auto& tracepoint = tracepointIt->second;
+            const auto& gdbRegisterNumbers = gdbTargetDescriptor.getRegisterNumbers();
+
+            for (const auto registerNumber : this->registerNumbers) {
+                if (
+                    std::find(gdbRegisterNumbers.begin(), gdbRegisterNumbers.end(), registerNumber)
+                    == gdbRegisterNumbers.end()
+                ) {
+                    Logger::debug(
+                        "Ignoring collection of unknown register (number " + std::to_string(registerNumber) + ")"
+                    );
+                    continue;
+                }
+
+                tracepoint.registerDescriptors.insert(
+                    gdbTargetDescriptor.getTargetRegisterDescriptorFromNumber(registerNumber)
+                );
+            }
+
+            const auto dataMemoryOffset = gdbTargetDescriptor.getMemoryOffset(Targets::TargetMemoryType::RAM);
+
+            for (const auto& memoryRange : this->memoryRanges) {
+                tracepoint.collectionExpressions.emplace_back(gdbTargetDescriptor.createAgentExpression(
+                    DefineTracepoint::generateMemoryRangeBytecode(memoryRange, dataMemoryOffset)
+                ));
+            }
+
+            for (auto& bytecode : this->collectionBytecode) {
+                tracepoint.collectionExpressions.emplace_back(
+                    gdbTargetDescriptor.createAgentExpression(std::move(bytecode))
+                );
+            }
+
+            debugSession.connection.writePacket(OkResponsePacket());
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to define tracepoint - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    void DefineTracepoint::parseActions(std::string_view actions) {
+        static constexpr auto HEX_CHARACTERS = std::string_view("0123456789abcdefABCDEF");
+
+        if (!actions.empty() && actions.front() == 'S') {
+            this->steppingActions = true;
+            actions.remove_prefix(1);
+        }
+
+        while (!actions.empty()) {
+            const auto action = actions.front();
+            actions.remove_prefix(1);
+
+            switch (action) {
+                case 'R': {
+                    /*
+                     * "R<mask>" - the mask is a hexadecimal number, where each set bit denotes a GDB register number
+                     * (bit 0 being register 0).
+                     */
+                    const auto maskSize = std::min(actions.find_first_not_of(HEX_CHARACTERS), actions.size());
+                    const auto mask = actions.substr(0, maskSize);
+                    actions.remove_prefix(maskSize);
+
+                    if (mask.empty()) {
+                        throw Exception("Invalid register mask in DefineTracepoint packet");
+                    }
+
+                    for (auto digitIndex = std::size_t(0); digitIndex < mask.size(); ++digitIndex) {
+                        const auto digit = Packet::parseHex<std::uint8_t>(mask.substr(mask.size() - 1 - digitIndex, 1));
+
+                        for (auto bit = std::size_t(0); bit < 4; ++bit) {
+                            if ((*digit & (0x01 << bit)) != 0) {
+                                this->registerNumbers.emplace_back(
+                                    static_cast<GdbRegisterNumber>(digitIndex * 4 + bit)
+                                );
+                            }
+                        }
+                    }
+                    break;
+                }
+                case 'M': {
+                    // "M<basereg>,<offset>,<length>" - a base register of -1 denotes an absolute address
+                    const auto actionSize = std::min(
+                        actions.find_first_not_of("0123456789abcdefABCDEF,-"),
+                        actions.size()
+                    );
+                    const auto actionData = actions.substr(0, actionSize);
+                    actions.remove_prefix(actionSize);
+
+                    const auto offsetPosition = actionData.find(',');
+                    const auto sizePosition = offsetPosition != std::string_view::npos
+                        ? actionData.find(',', offsetPosition + 1)
+                        : std::string_view::npos;
+
+                    if (sizePosition == std::string_view::npos) {
+                        throw Exception("Invalid memory range action in DefineTracepoint packet");
+                    }
+
+                    const auto baseRegister = Packet::parseHex<std::uint32_t>(actionData.substr(0, offsetPosition));
+                    const auto offset = Packet::parseHex<std::uint64_t>(
+                        actionData.substr(offsetPosition + 1, sizePosition - (offsetPosition + 1))
+                    );
+                    const auto size = Packet::parseHex<std::uint32_t>(actionData.substr(sizePosition + 1));
+
+                    if (!baseRegister.has_value() || !offset.has_value() || !size.has_value()) {
+                        throw Exception("Failed to parse memory range action in DefineTracepoint packet");
+                    }
+
+                    this->memoryRanges.emplace_back(
+                        *baseRegister != 0xFFFFFFFF
+                            ? std::optional(static_cast<GdbRegisterNumber>(*baseRegister))
+                            : std::nullopt,
+                        *offset,
+                        *size
+                    );
+                    break;
+                }
+                case 'X': {
+                    // "X<length>,<bytecode>"
+                    const auto lengthEndPosition = actions.find(',');
+                    const auto length = lengthEndPosition != std::string_view::npos
+                        ? Packet::parseHex<std::size_t>(actions.substr(0, lengthEndPosition))
+                        : std::nullopt;
+
+                    if (!length.has_value() || actions.size() - (lengthEndPosition + 1) < *length * 2) {
+                        throw Exception("Invalid expression action in DefineTracepoint packet");
+                    }
+
+                    try {
+                        this->collectionBytecode.emplace_back(
+                            Packet::hexToData(actions.substr(lengthEndPosition + 1, *length * 2))
+                        );
+
+                    } catch (const std::invalid_argument&) {
+                        throw Exception("Invalid expression bytecode in DefineTracepoint packet");
+                    }
+
+                    actions.remove_prefix(lengthEndPosition + 1 + *length * 2);
+                    break;
+                }
+                default: {
+                    throw Exception("Unsupported tracepoint action ('" + std::string(1, action) + "')");
+                }
+            }
+        }
+    }
+
+    std::vector<unsigned char> DefineTracepoint::generateMemoryRangeBytecode(
+        const MemoryRange& memoryRange,
+        std::uint32_t dataMemoryOffset
+    ) {
+        auto output = std::vector<unsigned char>();
+
+        const auto pushOperand = [&output] (std::uint64_t value, std::size_t operandSize) {
+            // Agent expression operands are big-endian
+            for (auto i = operandSize; i > 0; --i) {
+                output.push_back(static_cast<unsigned char>(value >> ((i - 1) * 8)));
+            }
+        };
+
+        // Each trace operation can only record so much, so larger ranges are split into multiple operations
+        const auto size = std::uint64_t(memoryRange.size);
+
+        for (auto chunkOffset = std::uint64_t(0); chunkOffset < size; chunkOffset += AgentExpression::MAX_TRACE_SIZE) {
+            const auto chunkSize = std::min(size - chunkOffset, AgentExpression::MAX_TRACE_SIZE);
+
+            if (memoryRange.baseRegisterNumber.has_value()) {
+                output.push_back(0x26); // reg
+                pushOperand(static_cast<std::uint64_t>(*memoryRange.baseRegisterNumber), 2);
+                output.push_back(0x25); // const64
+                pushOperand(memoryRange.offset + chunkOffset, 8);
+                output.push_back(0x02); // add
+
+                if (dataMemoryOffset != 0) {
+                    output.push_back(0x24); // const32
+                    pushOperand(dataMemoryOffset, 4);
+                    output.push_back(0x10); // bit_or
+                }
+
+            } else {
+                output.push_back(0x25); // const64
+                pushOperand(memoryRange.offset + chunkOffset, 8);
+            }
+
+            output.push_back(0x24); // const32
+            pushOperand(chunkSize, 4);
+            output.push_back(0x0C); // trace
+        }
+
+        output.push_back(0x27); // end
+        return output;
+    }
+}
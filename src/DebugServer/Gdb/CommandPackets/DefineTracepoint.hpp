@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "CommandPacket.hpp"
+#include "src/DebugServer/Gdb/RegisterDescriptor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The DefineTracepoint class implements a structure for "QTDP" packets. GDB sends these packets to define the
+     * tracepoints for the next trace experiment, upon the "tstart" command.
+     *
+     * Each tracepoint is defined by an initial packet ("QTDP:n:addr:ena:step:pass[:Xlen,cond]"), which may be
+     * followed by any number of continuation packets ("QTDP:-n:addr:[S]actions"), to specify the data to collect
+     * when the tracepoint is hit. Only the "R" (registers), "M" (memory range) and "X" (expression) actions are
+     * supported. Memory range actions are converted to agent expressions, here, so that all memory collection is
+     * carried out by the same mechanism, on the TargetController side (see TargetController::AgentExpression).
+     *
+     * While-stepping actions are not supported - they're ignored.
+     *
+     * See https://sourceware.org/gdb/onlinedocs/gdb/Tracepoint-Packets.html for more.
+     */
+    class DefineTracepoint: public CommandPacket
+    {
+    public:
+        /**
+         * A memory range to collect, from an "M" action.
+         */
+        struct MemoryRange
+        {
+            /**
+             * The GDB register holding the base address of the range, or std::nullopt for absolute ranges.
+             */
+            std::optional<GdbRegisterNumber> baseRegisterNumber;
+            std::uint64_t offset = 0;
+            std::uint32_t size = 0;
+
+            MemoryRange(std::optional<GdbRegisterNumber> baseRegisterNumber, std::uint64_t offset, std::uint32_t size)
+                : baseRegisterNumber(baseRegisterNumber)
+                , offset(offset)
+                , size(size)
+            {};
+        };
+
+        std::uint32_t tracepointNumber = 0;
+        Targets::TargetMemoryAddress address = 0;
+
+        /**
+         * Set for continuation packets - these carry actions for a tracepoint that was defined by a previous
+         * packet.
+         */
+        bool continuation = false;
+
+        bool enabled = true;
+
+        /**
+         * The number of while-stepping steps. Only provided in the initial packet.
+         */
+        std::uint64_t stepCount = 0;
+
+        /**
+         * Only provided in the initial packet.
+         */
+        std::uint64_t passCount = 0;
+
+        /**
+         * Agent expression bytecode of the tracepoint's condition, if any. Only provided in the initial packet.
+         */
+        std::optional<std::vector<unsigned char>> condition;
+
+        /**
+         * Set if the actions in this packet are the first of the tracepoint's while-stepping actions.
+         */
+        bool steppingActions = false;
+
+        /**
+         * Numbers of the GDB registers to collect, from all "R" actions in the packet.
+         */
+        std::vector<GdbRegisterNumber> registerNumbers;
+
+        /**
+         * Memory ranges from all "M" actions in the packet.
+         */
+        std::vector<MemoryRange> memoryRanges;
+
+        /**
+         * Agent expression bytecode for each "X" action in the packet.
+         */
+        std::vector<std::vector<unsigned char>> collectionBytecode;
+
+        explicit DefineTracepoint(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        /**
+         * Parses the tracepoint actions from a continuation packet.
+         *
+         * @param actions
+         */
+        void parseActions(std::string_view actions);
+
+        /**
+         * Generates the agent expression bytecode to collect a range of memory (for an "M" action).
+         *
+         * @param memoryRange
+         *
+         * @param dataMemoryOffset
+         *  The GDB memory offset for data memory (RAM). Register-relative ranges are (stack or frame pointer
+         *  relative) data addresses, but the register values carry no GDB memory offset, so we apply it here.
+         *
+         * @return
+         */
+        static std::vector<unsigned char> generateMemoryRangeBytecode(
+            const MemoryRange& memoryRange,
+            std::uint32_t dataMemoryOffset
+        );
+    };
+}
@@ -0,0 +1,158 @@
+#include "DumpMemory.hpp"
+
+#include <sstream>
+#include <fstream>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ConsoleProgressReporter.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Helpers/EnumToStringMappings.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+
+    DumpMemory::DumpMemory(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {
+        auto arguments = std::stringstream(this->command);
+        auto argument = std::string();
+
+        // Skip the command name
+        arguments >> argument;
+
+        if (arguments >> argument) {
+            this->memoryTypeName = argument;
+        }
+
+        if (arguments >> argument) {
+            this->startAddressString = argument;
+        }
+
+        if (arguments >> argument) {
+            this->lengthString = argument;
+        }
+
+        // The file path is the remainder of the command, which may contain spaces
+        std::getline(arguments >> std::ws, this->filePath);
+
+        if (this->filePath.size() >= 2 && this->filePath.front() == '"' && this->filePath.back() == '"') {
+            this->filePath = this->filePath.substr(1, this->filePath.size() - 2);
+        }
+    }
+
+    void DumpMemory::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling DumpMemory packet");
+
+        const auto writeOutput = [&debugSession] (const std::string& output) {
+            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output + "\n")));
+        };
+
+        if (!this->lengthString.has_value() || this->filePath.empty()) {
+            writeOutput("Usage: monitor dump <ram|eeprom|flash> <start> <length> <path>");
+            return;
+        }
+
+        const auto memoryType = EnumToStringMappings::targetMemoryTypes.valueAt(
+            QString::fromStdString(*(this->memoryTypeName))
+        );
+
+        if (!memoryType.has_value() || *memoryType == Targets::TargetMemoryType::OTHER) {
+            writeOutput("Invalid memory type (\"" + *(this->memoryTypeName) + "\") - expected ram, eeprom or flash");
+            return;
+        }
+
+        const auto& gdbTargetDescriptor = debugSession.gdbTargetDescriptor;
+        const auto& memoryDescriptorsByType = gdbTargetDescriptor.targetDescriptor.memoryDescriptorsByType;
+        const auto memoryDescriptorIt = memoryDescriptorsByType.find(*memoryType);
+
+        if (memoryDescriptorIt == memoryDescriptorsByType.end()) {
+            writeOutput("Target has no " + *(this->memoryTypeName) + " memory");
+            return;
+        }
+
+        const auto& memoryDescriptor = memoryDescriptorIt->second;
+
+        auto startAddress = TargetMemoryAddress(0);
+        auto bytes = TargetMemorySize(0);
+
+        try {
+            startAddress = static_cast<TargetMemoryAddress>(std::stoul(*(this->startAddressString), nullptr, 0));
+            bytes = static_cast<TargetMemorySize>(std::stoul(*(this->lengthString), nullptr, 0));
+
+        } catch (const std::logic_error&) {
+            writeOutput("Invalid start address or length - expected decimal or hexadecimal (0x...) values");
+            return;
+        }
+
+        // Addresses may be given as GDB sees them, with the memory offset (see Gdb::TargetDescriptor)
+        startAddress &= ~(gdbTargetDescriptor.getMemoryOffset(*memoryType));
+
+        if (*memoryType == Targets::TargetMemoryType::EEPROM) {
+            // As with GDB, EEPROM addresses are relative to the start of the EEPROM
+            startAddress += memoryDescriptor.addressRange.startAddress;
+        }
+
+        if (
+            bytes == 0
+            || !memoryDescriptor.addressRange.contains(startAddress)
+            || (bytes - 1) > (memoryDescriptor.addressRange.endAddress - startAddress)
+        ) {
+            writeOutput("Requested range is outside the target's " + *(this->memoryTypeName) + " memory");
+            return;
+        }
+
+        try {
+            auto file = std::ofstream(this->filePath, std::ios::binary | std::ios::trunc);
+
+            if (!file.is_open()) {
+                throw Exception("Failed to open \"" + this->filePath + "\" for writing");
+            }
+
+            Logger::info(
+                "Dumping " + std::to_string(bytes) + " bytes of " + *(this->memoryTypeName) + " to " + this->filePath
+            );
+
+            // The memory is read in a single (chunked) TargetController operation, with progress sent to GDB
+            const auto buffer = [&] {
+                const auto progressReporter = ConsoleProgressReporter(
+                    debugSession.connection,
+                    targetControllerService,
+                    "Dumping " + *(this->memoryTypeName)
+                );
+
+                return targetControllerService.readMemory(*memoryType, startAddress, bytes);
+            }();
+
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            file.close();
+
+            if (!file.good()) {
+                throw Exception("Failed to write to \"" + this->filePath + "\"");
+            }
+
+            writeOutput(
+                "Dumped " + std::to_string(bytes) + " bytes of "
+                    + EnumToStringMappings::targetMemoryTypes.at(*memoryType).toUpper().toStdString()
+                    + " to " + this->filePath
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to dump memory - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
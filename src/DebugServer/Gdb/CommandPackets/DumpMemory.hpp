@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+
+#include "Monitor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The DumpMemory class implements a structure for the "monitor dump" GDB command.
+     *
+     * "dump <ram|eeprom|flash> <start> <length> <path>" reads a range of the target's memory and writes it, as raw
+     * binary data, to a file on the host. This bypasses GDB's "dump binary memory" command, which reads the memory
+     * via "m" packets, a few hundred bytes at a time.
+     *
+     * The memory is read in a single bulk TargetController operation, with progress reported to GDB as console
+     * output (see Gdb::ConsoleProgressReporter).
+     */
+    class DumpMemory: public Monitor
+    {
+    public:
+        explicit DumpMemory(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        std::optional<std::string> memoryTypeName;
+        std::optional<std::string> startAddressString;
+        std::optional<std::string> lengthString;
+
+        /**
+         * The path to the output file, relative to the current working directory (if not absolute).
+         */
+        std::string filePath;
+    };
+}
@@ -1,11 +1,10 @@
 #include "EepromFill.hpp"
 
-#include <QByteArray>
-#include <algorithm>
-
 #include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ConsoleProgressReporter.hpp"
 
+#include "src/Helpers/HexCodec.hpp"
 #include "src/Services/StringService.hpp"
 #include "src/Logger/Logger.hpp"
 
@@ -30,8 +29,15 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
             return;
         }
 
-        const auto fillValueByteArray = QByteArray::fromHex(QByteArray::fromStdString(*fillValueOptionIt->second));
-        this->fillValue = Targets::TargetMemoryBuffer(fillValueByteArray.begin(), fillValueByteArray.end());
+        const auto& fillValueHex = *(fillValueOptionIt->second);
+        auto fillValue = Targets::TargetMemoryBuffer(fillValueHex.size() / 2);
+
+        if (!HexCodec::decode(fillValueHex, fillValue.data())) {
+            this->fillValueInvalid = true;
+            return;
+        }
+
+        this->fillValue = std::move(fillValue);
     }
 
     void EepromFill::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
@@ -51,6 +57,10 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
             const auto& eepromDescriptor = eepromDescriptorIt->second;
             const auto eepromSize = eepromDescriptor.size();
 
+            if (this->fillValueInvalid) {
+                throw InvalidCommandOption("Invalid fill value - the value must be in hexadecimal format");
+            }
+
             const auto fillValueSize = this->fillValue.size();
 
             if (fillValueSize == 0) {
@@ -73,31 +83,24 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
 
             Logger::warning("Filling " + std::to_string(eepromSize) + " bytes of EEPROM");
 
-            auto data = Targets::TargetMemoryBuffer();
-            data.reserve(eepromSize);
-
-            // Repeat this->fillValue until we've filled `data`
-            while (data.size() < eepromSize) {
-                data.insert(
-                    data.end(),
-                    this->fillValue.begin(),
-                    this->fillValue.begin() + static_cast<std::int32_t>(
-                        std::min(fillValueSize, (eepromSize - data.size()))
-                    )
-                );
-            }
+            const auto hexValue = Services::StringService::toHex(this->fillValue);
+            Logger::debug("Filling EEPROM with value: " + hexValue);
 
-            const auto hexValues = Services::StringService::toHex(data);
-            Logger::debug("Filling EEPROM with values: " + hexValues);
+            const auto progressReporter = ConsoleProgressReporter(
+                debugSession.connection,
+                targetControllerService,
+                "Filling EEPROM"
+            );
 
-            targetControllerService.writeMemory(
+            const auto bytesWritten = targetControllerService.fillMemory(
                 Targets::TargetMemoryType::EEPROM,
-                eepromDescriptor.addressRange.startAddress,
-                std::move(data)
+                eepromDescriptor.addressRange,
+                this->fillValue
             );
 
             debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
-                "Filled " + std::to_string(eepromSize) + " bytes of EEPROM, with values: " + hexValues + "\n"
+                "Filled " + std::to_string(eepromSize) + " bytes of EEPROM, with value: " + hexValue + " ("
+                    + std::to_string(bytesWritten) + " bytes written - all other bytes already held the fill value)\n"
             )));
 
         } catch (const InvalidCommandOption& exception) {
@@ -11,7 +11,9 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
     /**
      * The EepromFill class implements a structure for the "monitor eeprom fill" GDB command.
      *
-     * This command fills the target's EEPROM with the given value.
+     * This command fills the target's EEPROM with the given value. The fill is performed by the TargetController
+     * (see TargetController::Commands::FillTargetMemory), which only writes to the bytes that don't already hold the
+     * fill value.
      */
     class EepromFill: public Monitor
     {
@@ -25,5 +27,10 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
 
     private:
         Targets::TargetMemoryBuffer fillValue;
+
+        /**
+         * Set if the fill value provided via the --value option is not in hexadecimal format.
+         */
+        bool fillValueInvalid = false;
     };
 }
@@ -5,6 +5,7 @@
 
 #include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/TargetDocumentCache.hpp"
 
 #include "src/Targets/TargetMemory.hpp"
 #include "src/Application.hpp"
@@ -35,16 +36,20 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
             Logger::info("Generating SVD XML for current target");
 
             const auto& targetDescriptor = debugSession.gdbTargetDescriptor.targetDescriptor;
+            const auto baseAddressOffset = debugSession.gdbTargetDescriptor.getMemoryOffset(
+                Targets::TargetMemoryType::RAM
+            );
 
-            const auto svdXml = this->generateSvd(
-                targetDescriptor,
-                debugSession.gdbTargetDescriptor.getMemoryOffset(Targets::TargetMemoryType::RAM)
+            const auto svdXml = TargetDocumentCache::get(
+                targetDescriptor.id,
+                "target.svd",
+                [this, &targetDescriptor, baseAddressOffset] {
+                    return this->generateSvd(targetDescriptor, baseAddressOffset).toByteArray().toStdString();
+                }
             );
 
             if (this->sendOutput) {
-                debugSession.connection.writePacket(
-                    ResponsePacket(Services::StringService::toHex(svdXml.toString().toStdString()))
-                );
+                debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(*svdXml)));
                 return;
             }
 
@@ -57,7 +62,7 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
                 );
             }
 
-            outputFile.write(svdXml.toByteArray());
+            outputFile.write(svdXml->data(), static_cast<qint64>(svdXml->size()));
             outputFile.close();
 
             debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
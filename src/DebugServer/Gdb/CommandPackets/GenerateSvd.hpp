@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <QDomDocument>
 
 #include "Monitor.hpp"
 
@@ -13,6 +14,8 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
      *
      * This command generates XML conforming to the CMSIS-SVD schema, for the connected target. Will output the XML to
      * a file or send it to GDB.
+     *
+     * The SVD is generated once per target, and cached (see TargetDocumentCache).
      */
     class GenerateSvd: public Monitor
     {
@@ -0,0 +1,40 @@
+#include "InitTrace.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::OkResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    InitTrace::InitTrace(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {}
+
+    void InitTrace::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling InitTrace packet");
+
+        try {
+            targetControllerService.stopTracing();
+
+            debugSession.tracepointsByNumber.clear();
+            debugSession.steppingTracepointNumbers.clear();
+            debugSession.traceFrames.clear();
+            debugSession.selectedTraceFrameIndex = std::nullopt;
+
+            debugSession.connection.writePacket(OkResponsePacket());
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to initialise trace experiment - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The InitTrace class implements a structure for "QTinit" packets. GDB sends this packet before defining the
+     * tracepoints for a new trace experiment (via DefineTracepoint packets). Upon receiving it, the server is
+     * expected to clear all tracepoint definitions, and discard any previously collected trace frames.
+     */
+    class InitTrace: public CommandPacket
+    {
+    public:
+        explicit InitTrace(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -23,9 +23,24 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
             return;
         }
 
+        if (debugSession.pendingMonitorStep) {
+            /*
+             * The client is still waiting for the output of a "monitor step-line/step-over" command. The resulting
+             * stop will be reported as that output (see GdbRspDebugServer::onTargetExecutionStopped()).
+             */
+            try {
+                targetControllerService.stopTargetExecution();
+
+            } catch (const Exception& exception) {
+                Logger::error("Failed to interrupt execution - " + exception.getMessage());
+            }
+
+            return;
+        }
+
         try {
             targetControllerService.stopTargetExecution();
-            debugSession.connection.writePacket(TargetStopped(Signal::INTERRUPTED));
+            debugSession.reportTargetStopped(TargetStopped(Signal::INTERRUPTED), targetControllerService);
 
         } catch (const Exception& exception) {
             Logger::error("Failed to interrupt execution - " + exception.getMessage());
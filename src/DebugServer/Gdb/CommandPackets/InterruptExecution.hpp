@@ -10,7 +10,7 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
      *
      * Technically, interrupts are not sent by the client in the form of a typical GDP RSP packet. Instead, they're
      * just sent as a single byte from the client. We fake the packet on our end, to save us the headache of dealing
-     * with this inconsistency. We do this in Connection::readRawPackets().
+     * with this inconsistency. We do this in RawPacketParser::parse().
      */
     class InterruptExecution: public CommandPacket
     {
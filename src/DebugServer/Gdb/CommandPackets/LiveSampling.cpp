@@ -0,0 +1,191 @@
+#include "LiveSampling.hpp"
+
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <iomanip>
+#include <chrono>
+#include <stdexcept>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/TargetController/LiveSampling.hpp"
+#include "src/Services/PathService.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/DebugServer/Gdb/Exceptions/InvalidCommandOption.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using TargetController::LiveSampleVariable;
+
+    using Bloom::Exceptions::Exception;
+    using Exceptions::InvalidCommandOption;
+
+    LiveSampling::LiveSampling(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {
+        if (this->command.find("sample start") == 0) {
+            this->action = Action::START;
+
+        } else if (this->command.find("sample stop") == 0) {
+            this->action = Action::STOP;
+        }
+    }
+
+    void LiveSampling::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling LiveSampling packet");
+
+        try {
+            switch (this->action) {
+                case Action::START: {
+                    this->handleStart(debugSession, targetControllerService);
+                    break;
+                }
+                case Action::STOP: {
+                    this->handleStop(debugSession, targetControllerService);
+                    break;
+                }
+                default: {
+                    throw InvalidCommandOption("Unknown sample action - use \"sample start\" or \"sample stop\"");
+                }
+            }
+
+        } catch (const InvalidCommandOption& exception) {
+            Logger::error(exception.getMessage());
+            debugSession.connection.writePacket(
+                ResponsePacket(Services::StringService::toHex(exception.getMessage() + "\n"))
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to handle sample command - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    void LiveSampling::handleStart(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        const auto variablesValue = this->getOptionValue("vars");
+        if (!variablesValue.has_value()) {
+            throw InvalidCommandOption(
+                "No variables specified - provide them via the --vars option: \"--vars=counter,0x800100:2\""
+            );
+        }
+
+        auto samplingRate = LiveSampling::DEFAULT_SAMPLING_RATE;
+
+        if (const auto rateValue = this->getOptionValue("rate")) {
+            try {
+                const auto parsedRate = std::stoul(*rateValue);
+                if (parsedRate == 0 || parsedRate > LiveSampling::MAX_SAMPLING_RATE) {
+                    throw std::out_of_range("Sampling rate out of range");
+                }
+
+                samplingRate = static_cast<std::uint32_t>(parsedRate);
+
+            } catch (const std::logic_error&) {
+                throw InvalidCommandOption(
+                    "Invalid sampling rate - the rate must be between 1 and "
+                        + std::to_string(LiveSampling::MAX_SAMPLING_RATE) + " Hz"
+                );
+            }
+        }
+
+        const auto regions = Monitor::parseMemoryRegionSpecs(
+            *variablesValue,
+            debugSession.gdbTargetDescriptor,
+            this->getSymbolTable()
+        );
+
+        auto variables = std::vector<LiveSampleVariable>();
+        for (const auto& region : regions) {
+            variables.emplace_back(region.name, region.memoryType, region.startAddress, region.size);
+        }
+
+        if (variables.empty()) {
+            throw InvalidCommandOption("No variables specified");
+        }
+
+        const auto variableCount = variables.size();
+        const auto samplingInterval = std::chrono::milliseconds(1000 / samplingRate);
+        targetControllerService.startLiveSampling(std::move(variables), samplingInterval);
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+            "Live sampling started, for " + std::to_string(variableCount) + " variable(s), at "
+                + std::to_string(samplingRate) + " Hz (every " + std::to_string(samplingInterval.count()) + " ms)\n"
+        )));
+    }
+
+    void LiveSampling::handleStop(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        targetControllerService.stopLiveSampling();
+        const auto liveSamples = targetControllerService.getLiveSamples();
+
+        auto outputFilePath = std::filesystem::path(
+            this->getOptionValue("out").value_or(LiveSampling::DEFAULT_OUTPUT_FILE_NAME)
+        );
+
+        if (outputFilePath.is_relative()) {
+            outputFilePath = std::filesystem::path(Services::PathService::projectDirPath()) / outputFilePath;
+        }
+
+        auto outputFile = std::ofstream(outputFilePath, std::ios::out | std::ios::trunc);
+        if (!outputFile.is_open()) {
+            throw Exception(
+                "Failed to open/create sample output file (" + outputFilePath.string() + "). Check file permissions."
+            );
+        }
+
+        outputFile << "timestamp_us";
+        for (const auto& variable : liveSamples->variables) {
+            outputFile << "," << variable.name;
+        }
+        outputFile << "\n";
+
+        for (const auto& sample : liveSamples->samples) {
+            outputFile << sample.timestamp.count();
+
+            for (const auto& value : sample.values) {
+                outputFile << ",";
+
+                if (value.size() <= LiveSampling::MAX_INTEGER_VALUE_SIZE) {
+                    // AVR targets are little-endian
+                    auto integerValue = std::uint64_t(0);
+                    for (auto byteIndex = value.size(); byteIndex > 0; --byteIndex) {
+                        integerValue = (integerValue << 8) | value[byteIndex - 1];
+                    }
+
+                    outputFile << integerValue;
+                    continue;
+                }
+
+                outputFile << "0x" << Services::StringService::toHex(value);
+            }
+
+            outputFile << "\n";
+        }
+
+        outputFile.close();
+
+        auto output = std::string(
+            "Live sampling stopped - " + std::to_string(liveSamples->samples.size()) + " samples retained, "
+                + std::to_string(liveSamples->skippedSampleCount) + " skipped (target unavailable)\n"
+        );
+
+        if (liveSamples->droppedSampleCount > 0) {
+            output += std::to_string(liveSamples->droppedSampleCount) + " of the earliest samples were discarded, "
+                "as the sample buffer was full\n";
+        }
+
+        output += "Samples saved to " + outputFilePath.string() + "\n";
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output)));
+        Logger::info("Live samples saved to " + outputFilePath.string());
+    }
+}
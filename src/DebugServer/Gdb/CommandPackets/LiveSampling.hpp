@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+
+#include "Monitor.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The LiveSampling class implements a structure for the "monitor sample start" and "monitor sample stop" GDB
+     * commands.
+     *
+     * "sample start" instructs the TargetController to begin reading the given variables periodically, whilst the
+     * target is running (data logging). Variables are given via the --vars option, as a comma-separated list of
+     * symbol names or GDB addresses, each with an optional size: "--vars=adcValue,counter:2,0x800100:4". Symbol names
+     * are resolved via the ELF file given by the --elf option. The sampling rate (in Hz) is given via the --rate
+     * option.
+     *
+     * "sample stop" ends the sampling and writes the samples to a CSV file - one row per sample, with the timestamp
+     * (in microseconds, relative to the start of the sampling) followed by the value of each variable.
+     */
+    class LiveSampling: public Monitor
+    {
+    public:
+        static constexpr std::uint32_t DEFAULT_SAMPLING_RATE = 10;
+        static constexpr std::uint32_t MAX_SAMPLING_RATE = 1000;
+        static constexpr auto DEFAULT_OUTPUT_FILE_NAME = "bloom-samples.csv";
+
+        /**
+         * Values of up to this size (in bytes) are exported as unsigned integers. Larger values are exported as hex
+         * strings.
+         */
+        static constexpr std::size_t MAX_INTEGER_VALUE_SIZE = 8;
+
+        enum class Action: std::uint8_t
+        {
+            NONE,
+            START,
+            STOP,
+        };
+
+        Action action = Action::NONE;
+
+        explicit LiveSampling(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        void handleStart(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+        void handleStop(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+    };
+}
@@ -0,0 +1,97 @@
+#include "LoadProgramImage.hpp"
+
+#include <memory>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ConsoleProgressReporter.hpp"
+
+#include "src/ProgramImage/ProgramImage.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/DebugServer/Gdb/Exceptions/InvalidCommandOption.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ErrorResponsePacket;
+    using ResponsePackets::ResponsePacket;
+
+    using Bloom::Exceptions::Exception;
+    using Exceptions::InvalidCommandOption;
+
+    LoadProgramImage::LoadProgramImage(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {
+        // The image file path is everything between the command name and the first option
+        auto path = this->command.substr(std::string("load").size());
+
+        const auto optionsPos = path.find(" --");
+        if (optionsPos != std::string::npos) {
+            path.erase(optionsPos);
+        }
+
+        const auto pathStartPos = path.find_first_not_of(" \t");
+        const auto pathEndPos = path.find_last_not_of(" \t");
+
+        if (pathStartPos != std::string::npos) {
+            path = path.substr(pathStartPos, pathEndPos - pathStartPos + 1);
+
+            if (path.size() >= 2 && path.front() == '"' && path.back() == '"') {
+                path = path.substr(1, path.size() - 2);
+            }
+
+            this->imageFilePath = path;
+        }
+
+        this->verify = !this->commandOptions.contains("no-verify");
+    }
+
+    void LoadProgramImage::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling LoadProgramImage packet");
+
+        try {
+            if (this->imageFilePath.empty()) {
+                throw InvalidCommandOption("Image file path required");
+            }
+
+            const auto programImage = std::make_shared<const ProgramImage>(
+                ProgramImage::fromFile(this->imageFilePath)
+            );
+
+            Logger::warning(
+                "Loading " + std::to_string(programImage->size()) + " bytes from " + this->imageFilePath
+            );
+
+            const auto bytesWritten = [&] {
+                const auto progressReporter = ConsoleProgressReporter(
+                    debugSession.connection,
+                    targetControllerService,
+                    "Loading"
+                );
+
+                return targetControllerService.loadProgramImage(programImage, this->verify);
+            }();
+            Logger::info("Program image loaded");
+
+            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+                "Loaded " + std::to_string(programImage->size()) + " bytes (" + std::to_string(bytesWritten)
+                    + " bytes written)" + (this->verify ? " and verified" : "")
+                    + " - use the 'reset' command to restart the program.\n"
+            )));
+
+        } catch (const InvalidCommandOption& exception) {
+            Logger::error(exception.getMessage());
+            debugSession.connection.writePacket(
+                ResponsePacket(Services::StringService::toHex(exception.getMessage() + "\n"))
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to load program image - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+
+#include "Monitor.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The LoadProgramImage class implements a structure for the custom load command (triggered via the
+     * "monitor load <path>" GDB command).
+     *
+     * The "monitor load" command loads an ELF or Intel HEX file from the host's file system and writes it to the
+     * target's program memory, via the TargetController. This bypasses GDB's own "load" command (and the vFlash
+     * packets), so the image data isn't transferred over the RSP connection. The image is verified once written,
+     * unless the --no-verify option is provided.
+     */
+    class LoadProgramImage: public Monitor
+    {
+    public:
+        /**
+         * The path to the image file, relative to the current working directory (if not absolute).
+         */
+        std::string imageFilePath;
+
+        bool verify = true;
+
+        explicit LoadProgramImage(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
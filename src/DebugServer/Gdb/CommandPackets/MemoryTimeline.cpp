@@ -0,0 +1,217 @@
+#include "MemoryTimeline.hpp"
+
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <sstream>
+#include <iomanip>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/TargetController/MemoryChangeTimeline.hpp"
+#include "src/Services/PathService.hpp"
+#include "src/Services/SymbolService.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/DebugServer/Gdb/Exceptions/InvalidCommandOption.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+    using Services::SymbolService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using TargetController::MemoryChangeTimelineRegion;
+
+    using Targets::TargetMemoryType;
+    using Targets::TargetProgramCounter;
+
+    using Bloom::Exceptions::Exception;
+    using Exceptions::InvalidCommandOption;
+
+    MemoryTimeline::MemoryTimeline(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {
+        if (this->command.find("timeline start") == 0) {
+            this->action = Action::START;
+
+        } else if (this->command.find("timeline last") == 0) {
+            this->action = Action::LAST;
+
+        } else if (this->command.find("timeline stop") == 0) {
+            this->action = Action::STOP;
+        }
+    }
+
+    void MemoryTimeline::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling MemoryTimeline packet");
+
+        try {
+            switch (this->action) {
+                case Action::START: {
+                    this->handleStart(debugSession, targetControllerService);
+                    break;
+                }
+                case Action::LAST: {
+                    this->handleLast(debugSession, targetControllerService);
+                    break;
+                }
+                case Action::STOP: {
+                    this->handleStop(debugSession, targetControllerService);
+                    break;
+                }
+                default: {
+                    throw InvalidCommandOption(
+                        "Unknown timeline action - use \"timeline start\", \"timeline last\" or \"timeline stop\""
+                    );
+                }
+            }
+
+        } catch (const InvalidCommandOption& exception) {
+            Logger::error(exception.getMessage());
+            debugSession.connection.writePacket(
+                ResponsePacket(Services::StringService::toHex(exception.getMessage() + "\n"))
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to handle timeline command - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    void MemoryTimeline::handleStart(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        const auto regionsValue = this->getOptionValue("regions");
+        if (!regionsValue.has_value()) {
+            throw InvalidCommandOption(
+                "No regions specified - provide them via the --regions option: \"--regions=rxBuffer,0x800100:256\""
+            );
+        }
+
+        const auto regionSpecs = Monitor::parseMemoryRegionSpecs(
+            *regionsValue,
+            debugSession.gdbTargetDescriptor,
+            this->getSymbolTable()
+        );
+
+        auto regions = std::vector<MemoryChangeTimelineRegion>();
+        for (const auto& regionSpec : regionSpecs) {
+            regions.emplace_back(regionSpec.memoryType, regionSpec.startAddress, regionSpec.size);
+        }
+
+        if (regions.empty()) {
+            throw InvalidCommandOption("No regions specified");
+        }
+
+        auto totalSize = std::size_t(0);
+        for (const auto& region : regions) {
+            totalSize += region.size;
+        }
+
+        const auto regionCount = regions.size();
+        targetControllerService.startMemoryChangeTimeline(std::move(regions));
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+            "Memory change timeline started, for " + std::to_string(regionCount) + " region(s) ("
+                + std::to_string(totalSize) + " bytes) - changes will be recorded at each stop\n"
+        )));
+    }
+
+    void MemoryTimeline::handleLast(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        const auto delimiterPos = this->command.find(' ', std::string("timeline last").size());
+        const auto query = delimiterPos != std::string::npos ? this->command.substr(delimiterPos + 1) : std::string();
+
+        if (query.empty()) {
+            throw InvalidCommandOption("Usage: monitor timeline last <symbol|address>");
+        }
+
+        const auto& gdbTargetDescriptor = debugSession.gdbTargetDescriptor;
+        const auto region = Monitor::parseMemoryRegionSpec(query, gdbTargetDescriptor, this->getSymbolTable());
+
+        const auto change = targetControllerService.getLastMemoryChange(region.memoryType, region.startAddress);
+
+        if (!change.has_value()) {
+            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+                query + " has not changed since the timeline was started (or it isn't tracked)\n"
+            )));
+            return;
+        }
+
+        const auto gdbStartAddress = change->addressRange.startAddress
+            | gdbTargetDescriptor.getMemoryOffset(change->memoryType);
+
+        auto output = std::stringstream();
+        output << query << " last changed at stop " << change->stopNumber << " (" << change->timestamp.count()
+            << " us after the timeline was started), at " << MemoryTimeline::describeProgramCounter(
+                change->programCounter
+            ) << "\n";
+        output << "Changed range: 0x" << std::hex << std::setfill('0') << std::setw(6) << gdbStartAddress
+            << std::dec << " (" << change->data.size() << " bytes), new content: 0x"
+            << Services::StringService::toHex(change->data) << "\n";
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output.str())));
+    }
+
+    void MemoryTimeline::handleStop(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        targetControllerService.stopMemoryChangeTimeline();
+        const auto memoryChanges = targetControllerService.getMemoryChanges();
+
+        auto outputFilePath = std::filesystem::path(
+            this->getOptionValue("out").value_or(MemoryTimeline::DEFAULT_OUTPUT_FILE_NAME)
+        );
+
+        if (outputFilePath.is_relative()) {
+            outputFilePath = std::filesystem::path(Services::PathService::projectDirPath()) / outputFilePath;
+        }
+
+        auto outputFile = std::ofstream(outputFilePath, std::ios::out | std::ios::trunc);
+        if (!outputFile.is_open()) {
+            throw Exception(
+                "Failed to open/create memory change output file (" + outputFilePath.string()
+                    + "). Check file permissions."
+            );
+        }
+
+        const auto& gdbTargetDescriptor = debugSession.gdbTargetDescriptor;
+
+        outputFile << "stop,timestamp_us,program_counter,address,data\n";
+        for (const auto& change : memoryChanges->changes) {
+            outputFile << change.stopNumber << "," << change.timestamp.count() << ",0x" << std::hex
+                << change.programCounter << ",0x" << (
+                    change.addressRange.startAddress | gdbTargetDescriptor.getMemoryOffset(change.memoryType)
+                ) << std::dec << ",0x" << Services::StringService::toHex(change.data) << "\n";
+        }
+
+        outputFile.close();
+
+        auto output = std::string(
+            "Memory change timeline stopped - " + std::to_string(memoryChanges->changes.size())
+                + " changes recorded, over " + std::to_string(memoryChanges->stopCount) + " stops\n"
+        );
+
+        if (memoryChanges->full) {
+            output += "The timeline ran out of space - changes beyond that point were not recorded\n";
+        }
+
+        output += "Changes saved to " + outputFilePath.string() + "\n";
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output)));
+        Logger::info("Memory changes saved to " + outputFilePath.string());
+    }
+
+    std::string MemoryTimeline::describeProgramCounter(TargetProgramCounter programCounter) {
+        auto output = std::stringstream();
+        output << "PC 0x" << std::hex << std::setfill('0') << std::setw(4) << programCounter;
+
+        const auto symbol = SymbolService::symbolAt(TargetMemoryType::FLASH, programCounter);
+        if (symbol.has_value()) {
+            output << " (" << symbol->name << " + " << std::dec << (programCounter - symbol->startAddress) << ")";
+        }
+
+        return output.str();
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+
+#include "Monitor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The MemoryTimeline class implements a structure for the "monitor timeline start", "monitor timeline last" and
+     * "monitor timeline stop" GDB commands.
+     *
+     * "timeline start" instructs the TargetController to record the changes made to the given memory regions, at
+     * each target stop (see TargetController::MemoryChangeTimeline). Regions are given via the --regions option, as
+     * a comma-separated list of symbol names or GDB addresses, each with an optional size:
+     * "--regions=rxBuffer,0x800100:256". Symbol names are resolved to variables via the ELF file given by the --elf
+     * option, or the project's ELF file (see Monitor::parseMemoryRegionSpec()).
+     *
+     * "timeline last <symbol|address>" reports the most recent change to the given address - the stop at which it
+     * was detected, and the program counter at that stop.
+     *
+     * "timeline stop" ends the recording and writes the changes to a CSV file - one row per changed range, with the
+     * stop number, the timestamp (in microseconds, relative to the start of the timeline), the program counter, the
+     * GDB address of the range and the new content of the range.
+     */
+    class MemoryTimeline: public Monitor
+    {
+    public:
+        static constexpr auto DEFAULT_OUTPUT_FILE_NAME = "bloom-memory-changes.csv";
+
+        enum class Action: std::uint8_t
+        {
+            NONE,
+            START,
+            LAST,
+            STOP,
+        };
+
+        Action action = Action::NONE;
+
+        explicit MemoryTimeline(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        void handleStart(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+        void handleLast(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+        void handleStop(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Formats a program counter value, along with the name of the function containing it (if known).
+         *
+         * @param programCounter
+         *
+         * @return
+         */
+        static std::string describeProgramCounter(Targets::TargetProgramCounter programCounter);
+    };
+}
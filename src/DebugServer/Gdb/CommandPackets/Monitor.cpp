@@ -1,15 +1,26 @@
 #include "Monitor.hpp"
 
+#include <sstream>
+#include <stdexcept>
+
 #include "src/DebugServer/Gdb/ResponsePackets/EmptyResponsePacket.hpp"
 
+#include "src/Services/SymbolService.hpp"
 #include "src/Logger/Logger.hpp"
 
+#include "src/DebugServer/Gdb/Exceptions/InvalidCommandOption.hpp"
+
 namespace Bloom::DebugServer::Gdb::CommandPackets
 {
     using Services::TargetControllerService;
 
     using ResponsePackets::EmptyResponsePacket;
 
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+
+    using Exceptions::InvalidCommandOption;
+
     Monitor::Monitor(const RawPacket& rawPacket)
         : CommandPacket(rawPacket)
     {
@@ -32,6 +43,98 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
         debugSession.connection.writePacket(EmptyResponsePacket());
     }
 
+    std::optional<std::string> Monitor::getOptionValue(const std::string& optionName) const {
+        const auto optionIt = this->commandOptions.find(optionName);
+
+        if (optionIt == this->commandOptions.end() || !optionIt->second.has_value() || optionIt->second->empty()) {
+            return std::nullopt;
+        }
+
+        return optionIt->second;
+    }
+
+    Monitor::MemoryRegionSpec Monitor::parseMemoryRegionSpec(
+        const std::string& spec,
+        const TargetDescriptor& gdbTargetDescriptor,
+        const std::shared_ptr<const ElfSymbolTable>& symbolTable
+    ) {
+        const auto sizeDelimiterPos = spec.find(':');
+
+        auto output = MemoryRegionSpec();
+        output.name = spec.substr(0, sizeDelimiterPos);
+
+        auto gdbAddress = std::uint32_t(0);
+
+        try {
+            if (output.name.find("0x") == 0) {
+                gdbAddress = static_cast<std::uint32_t>(std::stoul(output.name, nullptr, 16));
+
+            } else {
+                if (symbolTable == nullptr) {
+                    throw InvalidCommandOption(
+                        "Cannot resolve symbol \"" + output.name + "\" - provide the ELF file via the --elf option, "
+                            "or the \"elfFile\" project config parameter"
+                    );
+                }
+
+                const auto symbol = symbolTable->findObject(output.name);
+                if (!symbol.has_value()) {
+                    throw InvalidCommandOption("Variable \"" + output.name + "\" not found in ELF file");
+                }
+
+                gdbAddress = symbol->get().startAddress;
+                output.size = symbol->get().size;
+            }
+
+            if (sizeDelimiterPos != std::string::npos) {
+                output.size = static_cast<TargetMemorySize>(std::stoul(spec.substr(sizeDelimiterPos + 1)));
+            }
+
+        } catch (const std::logic_error&) {
+            throw InvalidCommandOption("Invalid memory region \"" + spec + "\"");
+        }
+
+        if (output.size == 0) {
+            throw InvalidCommandOption("Invalid size for memory region \"" + output.name + "\"");
+        }
+
+        output.memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbAddress);
+        output.startAddress = static_cast<TargetMemoryAddress>(
+            gdbAddress & ~(gdbTargetDescriptor.getMemoryOffset(output.memoryType))
+        );
+
+        return output;
+    }
+
+    std::vector<Monitor::MemoryRegionSpec> Monitor::parseMemoryRegionSpecs(
+        const std::string& specs,
+        const TargetDescriptor& gdbTargetDescriptor,
+        const std::shared_ptr<const ElfSymbolTable>& symbolTable
+    ) {
+        auto output = std::vector<MemoryRegionSpec>();
+
+        auto specStream = std::stringstream(specs);
+        auto spec = std::string();
+
+        while (std::getline(specStream, spec, ',')) {
+            if (spec.empty()) {
+                continue;
+            }
+
+            output.emplace_back(Monitor::parseMemoryRegionSpec(spec, gdbTargetDescriptor, symbolTable));
+        }
+
+        return output;
+    }
+
+    std::shared_ptr<const ElfSymbolTable> Monitor::getSymbolTable() const {
+        if (const auto elfPath = this->getOptionValue("elf")) {
+            return std::make_shared<const ElfSymbolTable>(ElfSymbolTable::fromFile(*elfPath));
+        }
+
+        return Services::SymbolService::symbolTable();
+    }
+
     std::map<std::string, std::optional<std::string>> Monitor::extractCommandOptions(const std::string& command) {
         auto output = std::map<std::string, std::optional<std::string>>();
 
@@ -4,9 +4,15 @@
 #include <string>
 #include <map>
 #include <optional>
+#include <vector>
+#include <memory>
 
 #include "CommandPacket.hpp"
 
+#include "src/DebugServer/Gdb/TargetDescriptor.hpp"
+#include "src/ProgramImage/ElfSymbolTable.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
 namespace Bloom::DebugServer::Gdb::CommandPackets
 {
     /**
@@ -36,6 +42,81 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
             Services::TargetControllerService& targetControllerService
         ) override;
 
+    protected:
+        /**
+         * A memory region given by the GDB user, via a region spec (see Monitor::parseMemoryRegionSpec()).
+         */
+        struct MemoryRegionSpec
+        {
+            /**
+             * The symbol name or GDB address, as given by the user.
+             */
+            std::string name;
+
+            Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::RAM;
+            Targets::TargetMemoryAddress startAddress = 0;
+            Targets::TargetMemorySize size = 1;
+        };
+
+        /**
+         * Parses a memory region spec, of the form "name[:size]" or "0xADDR[:size]".
+         *
+         * Names are resolved to data objects (variables) via the given symbol table, in which case the size defaults
+         * to the size of the object. GDB addresses default to a size of one byte. Both are mapped to target memory
+         * addresses in the same way GDB addresses are - avr-gcc applies the same memory offsets in ELF files.
+         *
+         * @param spec
+         * @param gdbTargetDescriptor
+         * @param symbolTable
+         *  nullptr if no ELF file is available, in which case only GDB addresses can be given.
+         *
+         * @throws Exceptions::InvalidCommandOption
+         *  If the spec is malformed, or the symbol cannot be resolved.
+         *
+         * @return
+         */
+        static MemoryRegionSpec parseMemoryRegionSpec(
+            const std::string& spec,
+            const TargetDescriptor& gdbTargetDescriptor,
+            const std::shared_ptr<const ElfSymbolTable>& symbolTable
+        );
+
+        /**
+         * Parses a comma-separated list of memory region specs (see Monitor::parseMemoryRegionSpec()). Empty specs
+         * are ignored.
+         *
+         * @param specs
+         * @param gdbTargetDescriptor
+         * @param symbolTable
+         *
+         * @return
+         */
+        static std::vector<MemoryRegionSpec> parseMemoryRegionSpecs(
+            const std::string& specs,
+            const TargetDescriptor& gdbTargetDescriptor,
+            const std::shared_ptr<const ElfSymbolTable>& symbolTable
+        );
+
+        /**
+         * Returns the symbol table of the ELF file given via the --elf option, or, if no such option was provided,
+         * the project's symbol table (see Services::SymbolService).
+         *
+         * @return
+         *  nullptr if no ELF file is available.
+         */
+        std::shared_ptr<const ElfSymbolTable> getSymbolTable() const;
+
+        /**
+         * Fetches the value of a command option.
+         *
+         * @param optionName
+         *
+         * @return
+         *  The option value, or std::nullopt if the option wasn't provided, or was provided without a value (or with
+         *  an empty value).
+         */
+        std::optional<std::string> getOptionValue(const std::string& optionName) const;
+
     private:
         /**
          * Extracts command options from a command string.
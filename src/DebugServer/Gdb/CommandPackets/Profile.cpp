@@ -0,0 +1,200 @@
+#include "Profile.hpp"
+
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+#include <filesystem>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <stdexcept>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/ProgramImage/ElfSymbolTable.hpp"
+#include "src/Services/PathService.hpp"
+#include "src/Services/SymbolService.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/DebugServer/Gdb/Exceptions/InvalidCommandOption.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Bloom::Exceptions::Exception;
+    using Exceptions::InvalidCommandOption;
+
+    Profile::Profile(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {
+        if (this->command.find("profile start") == 0) {
+            this->action = Action::START;
+
+        } else if (this->command.find("profile stop") == 0) {
+            this->action = Action::STOP;
+        }
+    }
+
+    void Profile::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling Profile packet");
+
+        try {
+            switch (this->action) {
+                case Action::START: {
+                    this->handleStart(debugSession, targetControllerService);
+                    break;
+                }
+                case Action::STOP: {
+                    this->handleStop(debugSession, targetControllerService);
+                    break;
+                }
+                default: {
+                    throw InvalidCommandOption("Unknown profile action - use \"profile start\" or \"profile stop\"");
+                }
+            }
+
+        } catch (const InvalidCommandOption& exception) {
+            Logger::error(exception.getMessage());
+            debugSession.connection.writePacket(
+                ResponsePacket(Services::StringService::toHex(exception.getMessage() + "\n"))
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to handle profile command - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    void Profile::handleStart(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        auto samplingRate = Profile::DEFAULT_SAMPLING_RATE;
+
+        if (const auto rateValue = this->getOptionValue("rate")) {
+            try {
+                const auto parsedRate = std::stoul(*rateValue);
+                if (parsedRate == 0 || parsedRate > Profile::MAX_SAMPLING_RATE) {
+                    throw std::out_of_range("Sampling rate out of range");
+                }
+
+                samplingRate = static_cast<std::uint32_t>(parsedRate);
+
+            } catch (const std::logic_error&) {
+                throw InvalidCommandOption(
+                    "Invalid sampling rate - the rate must be between 1 and "
+                        + std::to_string(Profile::MAX_SAMPLING_RATE) + " Hz"
+                );
+            }
+        }
+
+        const auto samplingInterval = std::chrono::milliseconds(1000 / samplingRate);
+        targetControllerService.startProgramCounterSampling(samplingInterval);
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+            "Program counter sampling started, at " + std::to_string(samplingRate) + " Hz (every "
+                + std::to_string(samplingInterval.count()) + " ms)\n"
+        )));
+    }
+
+    void Profile::handleStop(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        const auto samples = targetControllerService.stopProgramCounterSampling();
+
+        // Fall back to the project's ELF file (see SymbolService), if one wasn't provided via the --elf option
+        auto symbolTable = Services::SymbolService::symbolTable();
+        if (const auto elfPath = this->getOptionValue("elf")) {
+            symbolTable = std::make_shared<const ElfSymbolTable>(ElfSymbolTable::fromFile(*elfPath));
+
+            if (symbolTable->empty()) {
+                Logger::warning("ELF file (" + *elfPath + ") contains no function symbols - is it stripped?");
+            }
+        }
+
+        // Samples are accumulated per frame, as multiple program counters can resolve to the same function
+        auto sampleCountsByFrame = std::map<std::string, std::uint64_t>();
+        auto totalSampleCount = std::uint64_t(0);
+
+        for (const auto& [programCounter, sampleCount] : samples->sampleCountsByProgramCounter) {
+            auto frame = std::string();
+
+            if (symbolTable != nullptr) {
+                if (const auto symbol = symbolTable->find(programCounter)) {
+                    frame = symbol->get().name;
+                }
+            }
+
+            if (frame.empty()) {
+                auto stream = std::stringstream();
+                stream << "0x" << std::hex << std::setfill('0') << std::setw(8) << programCounter;
+                frame = stream.str();
+            }
+
+            sampleCountsByFrame[frame] += sampleCount;
+            totalSampleCount += sampleCount;
+        }
+
+        auto outputFilePath = std::filesystem::path(
+            this->getOptionValue("out").value_or(Profile::DEFAULT_OUTPUT_FILE_NAME)
+        );
+
+        if (outputFilePath.is_relative()) {
+            outputFilePath = std::filesystem::path(Services::PathService::projectDirPath()) / outputFilePath;
+        }
+
+        auto outputFile = std::ofstream(outputFilePath, std::ios::out | std::ios::trunc);
+        if (!outputFile.is_open()) {
+            throw Exception(
+                "Failed to open/create profile output file (" + outputFilePath.string() + "). Check file permissions."
+            );
+        }
+
+        for (const auto& [frame, sampleCount] : sampleCountsByFrame) {
+            outputFile << frame << " " << sampleCount << "\n";
+        }
+
+        outputFile.close();
+
+        auto sortedFrames = std::vector<std::pair<std::string, std::uint64_t>>(
+            sampleCountsByFrame.begin(),
+            sampleCountsByFrame.end()
+        );
+
+        std::stable_sort(
+            sortedFrames.begin(),
+            sortedFrames.end(),
+            [] (const auto& frameA, const auto& frameB) {
+                return frameA.second > frameB.second;
+            }
+        );
+
+        const auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(samples->samplingDuration);
+
+        auto output = std::string(
+            "Program counter sampling stopped, after " + std::to_string(durationMs.count()) + " ms - "
+                + std::to_string(totalSampleCount) + " samples taken, "
+                + std::to_string(samples->skippedSampleCount) + " skipped (target not running)\n"
+        );
+
+        const auto summaryEntryCount = std::min(sortedFrames.size(), Profile::SUMMARY_ENTRY_COUNT);
+
+        for (auto index = std::size_t(0); index < summaryEntryCount; ++index) {
+            const auto& [frame, sampleCount] = sortedFrames[index];
+            const auto percentage = static_cast<double>(sampleCount) * 100 / static_cast<double>(totalSampleCount);
+
+            auto stream = std::stringstream();
+            stream << "  " << std::fixed << std::setprecision(1) << std::setw(5) << percentage << "%  "
+                << std::setw(8) << sampleCount << "  " << frame << "\n";
+            output += stream.str();
+        }
+
+        output += "Profile saved to " + outputFilePath.string() + "\n";
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output)));
+        Logger::info("Profile saved to " + outputFilePath.string());
+    }
+}
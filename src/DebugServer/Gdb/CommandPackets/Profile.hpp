@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+
+#include "Monitor.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The Profile class implements a structure for the "monitor profile start" and "monitor profile stop" GDB
+     * commands.
+     *
+     * "profile start" instructs the TargetController to begin sampling the target's program counter, at the rate
+     * given via the --rate option (in Hz). "profile stop" ends the sampling and writes the sample counts to a file,
+     * in the folded stack format (one "<frame> <count>" line per program counter), which can be fed into
+     * flamegraph.pl or speedscope. If an ELF file is provided via the --elf option, program counters are resolved to
+     * function names, and the samples are accumulated per function.
+     *
+     * No stack unwinding takes place - each sample consists of a single frame.
+     */
+    class Profile: public Monitor
+    {
+    public:
+        static constexpr std::uint32_t DEFAULT_SAMPLING_RATE = 100;
+        static constexpr std::uint32_t MAX_SAMPLING_RATE = 1000;
+        static constexpr auto DEFAULT_OUTPUT_FILE_NAME = "bloom-profile.folded";
+
+        /**
+         * The number of entries included in the summary sent to GDB.
+         */
+        static constexpr std::size_t SUMMARY_ENTRY_COUNT = 10;
+
+        enum class Action: std::uint8_t
+        {
+            NONE,
+            START,
+            STOP,
+        };
+
+        Action action = Action::NONE;
+
+        explicit Profile(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        void handleStart(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+        void handleStop(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+    };
+}
@@ -1,10 +1,11 @@
 #include "ReadRegisters.hpp"
 
+#include <algorithm>
+
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 
 #include "src/Targets/TargetRegister.hpp"
 
-#include "src/Services/StringService.hpp"
 #include "src/Logger/Logger.hpp"
 
 #include "src/Exceptions/Exception.hpp"
@@ -14,6 +15,7 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
     using Services::TargetControllerService;
 
     using Targets::TargetRegister;
+    using Targets::TargetRegisters;
     using Targets::TargetRegisterDescriptors;
 
     using ResponsePackets::ResponsePacket;
@@ -26,9 +28,13 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
     {
         if (this->data.size() >= 2 && this->data.front() == 'p') {
             // This command packet is requesting a specific register
-            this->registerNumber = static_cast<size_t>(
-                std::stoi(std::string(this->data.begin() + 1, this->data.end()))
-            );
+            const auto registerNumber = Packet::parseHex<GdbRegisterNumber>(this->dataView().substr(1));
+
+            if (!registerNumber.has_value()) {
+                throw Exception("Failed to parse register number from read register packet data");
+            }
+
+            this->registerNumber = *registerNumber;
         }
     }
 
@@ -37,64 +43,142 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
 
         try {
             const auto& targetDescriptor = debugSession.gdbTargetDescriptor;
-            auto descriptors = TargetRegisterDescriptors();
+
+            if (const auto* traceFrame = debugSession.getSelectedTraceFrame()) {
+                debugSession.connection.writePacket(this->readRegistersFrom(traceFrame->registers, targetDescriptor));
+                return;
+            }
+
+            if (
+                debugSession.rtosThreadAwareness.has_value()
+                && debugSession.rtosThreadAwareness->isSuspendedThreadSelected(targetControllerService)
+            ) {
+                auto& rtosThreadAwareness = *(debugSession.rtosThreadAwareness);
+
+                debugSession.connection.writePacket(this->readRegistersFrom(
+                    rtosThreadAwareness.readThreadRegisters(
+                        *(rtosThreadAwareness.selectedThreadId),
+                        targetControllerService
+                    ),
+                    targetDescriptor
+                ));
+                return;
+            }
 
             if (this->registerNumber.has_value()) {
                 Logger::debug("Reading register number: " + std::to_string(this->registerNumber.value()));
-                descriptors.insert(
-                    targetDescriptor.getTargetRegisterDescriptorFromNumber(this->registerNumber.value())
+
+                const auto& targetRegisterDescriptor = targetDescriptor.getTargetRegisterDescriptorFromNumber(
+                    this->registerNumber.value()
+                );
+                const auto& gdbRegisterDescriptor = targetDescriptor.getRegisterDescriptorFromNumber(
+                    this->registerNumber.value()
                 );
 
-            } else {
-                // Read all target registers mapped to a GDB register
-                for (const auto& registerNumber : targetDescriptor.getRegisterNumbers()) {
-                    descriptors.insert(targetDescriptor.getTargetRegisterDescriptorFromNumber(registerNumber));
+                const auto registerSet = targetControllerService.readRegisters({targetRegisterDescriptor});
+
+                if (registerSet.empty()) {
+                    throw Exception("TargetController returned no register values");
                 }
-            }
 
-            auto registerSet = targetControllerService.readRegisters(descriptors);
+                auto output = std::vector<unsigned char>(static_cast<std::size_t>(gdbRegisterDescriptor.size) * 2, '0');
+                ReadRegisters::writeRegisterValue(registerSet.front(), gdbRegisterDescriptor.size, output.data());
 
-            /*
-             * Sort each register by their respective GDB register number - this will leave us with a collection of
-             * registers in the order expected by the GDB client.
-             */
-            std::sort(
-                registerSet.begin(),
-                registerSet.end(),
-                [this, &targetDescriptor] (const TargetRegister& registerA, const TargetRegister& registerB) {
-                    return targetDescriptor.getRegisterNumberFromTargetRegisterDescriptor(registerA.descriptor) <
-                        targetDescriptor.getRegisterNumberFromTargetRegisterDescriptor(registerB.descriptor);
-                }
+                debugSession.connection.writePacket(ResponsePacket(output));
+                return;
+            }
+
+            // Read all target registers mapped to a GDB register, in a single request
+            const auto registerSet = targetControllerService.readRegisters(
+                targetDescriptor.getMappedTargetRegisterDescriptors()
             );
 
             /*
-             * Finally, reverse the register values (as they're all currently in MSB, but GDB expects them in LSB), ensure
-             * that each register value size matches the size in the associated GDB register descriptor, implode the
-             * values, convert to hexadecimal form and send to the GDB client.
+             * The register packet is prepared up front, using the precomputed register layout. Any register values
+             * that aren't returned by the TargetController will be left as zero.
              */
-            auto registers = std::vector<unsigned char>();
-            for (auto& reg : registerSet) {
-                std::reverse(reg.value.begin(), reg.value.end());
+            auto output = std::vector<unsigned char>(targetDescriptor.getRegisterPacketSize() * 2, '0');
 
-                const auto gdbRegisterNumber = targetDescriptor.getRegisterNumberFromTargetRegisterDescriptor(
-                    reg.descriptor
-                ).value();
-                const auto& gdbRegisterDescriptor = targetDescriptor.getRegisterDescriptorFromNumber(gdbRegisterNumber);
+            for (const auto& reg : registerSet) {
+                const auto* layoutEntry = targetDescriptor.findRegisterLayoutEntry(reg.descriptor);
 
-                if (reg.value.size() < gdbRegisterDescriptor.size) {
-                    reg.value.insert(reg.value.end(), (gdbRegisterDescriptor.size - reg.value.size()), 0x00);
+                if (layoutEntry == nullptr) {
+                    continue;
                 }
 
-                registers.insert(registers.end(), reg.value.begin(), reg.value.end());
+                ReadRegisters::writeRegisterValue(reg, layoutEntry->size, output.data() + (layoutEntry->offset * 2));
             }
 
-            debugSession.connection.writePacket(
-                ResponsePacket(Services::StringService::toHex(registers))
-            );
+            debugSession.connection.writePacket(ResponsePacket(output));
 
         } catch (const Exception& exception) {
             Logger::error("Failed to read general registers - " + exception.getMessage());
             debugSession.connection.writePacket(ErrorResponsePacket());
         }
     }
+
+    ResponsePacket ReadRegisters::readRegistersFrom(
+        const TargetRegisters& registers,
+        const TargetDescriptor& targetDescriptor
+    ) const {
+        // Registers that we don't have values for are reported as unavailable, with 'x' characters
+        if (this->registerNumber.has_value()) {
+            const auto& targetRegisterDescriptor = targetDescriptor.getTargetRegisterDescriptorFromNumber(
+                this->registerNumber.value()
+            );
+            const auto& gdbRegisterDescriptor = targetDescriptor.getRegisterDescriptorFromNumber(
+                this->registerNumber.value()
+            );
+
+            auto output = std::vector<unsigned char>(static_cast<std::size_t>(gdbRegisterDescriptor.size) * 2, 'x');
+
+            const auto registerIt = std::find_if(
+                registers.begin(),
+                registers.end(),
+                [&targetRegisterDescriptor] (const TargetRegister& reg) {
+                    return reg.descriptor == targetRegisterDescriptor;
+                }
+            );
+
+            if (registerIt != registers.end()) {
+                std::fill(output.begin(), output.end(), '0');
+                ReadRegisters::writeRegisterValue(*registerIt, gdbRegisterDescriptor.size, output.data());
+            }
+
+            return ResponsePacket(output);
+        }
+
+        auto output = std::vector<unsigned char>(targetDescriptor.getRegisterPacketSize() * 2, 'x');
+
+        for (const auto& reg : registers) {
+            const auto* layoutEntry = targetDescriptor.findRegisterLayoutEntry(reg.descriptor);
+
+            if (layoutEntry == nullptr) {
+                continue;
+            }
+
+            auto* registerOutput = output.data() + (layoutEntry->offset * 2);
+            std::fill(registerOutput, registerOutput + (layoutEntry->size * 2), '0');
+            ReadRegisters::writeRegisterValue(reg, layoutEntry->size, registerOutput);
+        }
+
+        return ResponsePacket(output);
+    }
+
+    void ReadRegisters::writeRegisterValue(
+        const TargetRegister& reg,
+        std::uint16_t gdbRegisterSize,
+        unsigned char* output
+    ) {
+        /*
+         * Register values from the TargetController are in MSB form, but GDB expects them in LSB form. Any
+         * remaining space (where the target register is smaller than the GDB register) is expected to be
+         * pre-filled with zeros.
+         */
+        const auto valueSize = std::min(reg.value.size(), static_cast<std::size_t>(gdbRegisterSize));
+
+        for (std::size_t i = 0; i < valueSize; ++i) {
+            Packet::byteToHex(reg.value[reg.value.size() - 1 - i], output + (i * 2));
+        }
+    }
 }
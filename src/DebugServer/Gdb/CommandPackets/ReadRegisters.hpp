@@ -5,6 +5,10 @@
 #include "CommandPacket.hpp"
 
 #include "src/DebugServer/Gdb/RegisterDescriptor.hpp"
+#include "src/DebugServer/Gdb/TargetDescriptor.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/TargetController/Tracepoint.hpp"
+#include "src/Targets/TargetRegister.hpp"
 
 namespace Bloom::DebugServer::Gdb::CommandPackets
 {
@@ -31,5 +35,34 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
             DebugSession& debugSession,
             Services::TargetControllerService& targetControllerService
         ) override;
+
+    private:
+        /**
+         * Prepares the response from the given register values, as opposed to the target's registers. Used for
+         * the registers collected in a trace frame, and for the registers saved by RTOS threads that aren't running.
+         *
+         * @param registers
+         * @param targetDescriptor
+         *
+         * @return
+         */
+        ResponsePackets::ResponsePacket readRegistersFrom(
+            const Targets::TargetRegisters& registers,
+            const TargetDescriptor& targetDescriptor
+        ) const;
+
+        /**
+         * Writes the hexadecimal form of a register value to the output buffer, in the byte order expected by GDB.
+         *
+         * @param reg
+         * @param gdbRegisterSize
+         * @param output
+         *  Must have room for (gdbRegisterSize * 2) characters.
+         */
+        static void writeRegisterValue(
+            const Targets::TargetRegister& reg,
+            std::uint16_t gdbRegisterSize,
+            unsigned char* output
+        );
     };
 }
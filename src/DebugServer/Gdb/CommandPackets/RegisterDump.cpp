@@ -0,0 +1,167 @@
+#include "RegisterDump.hpp"
+
+#include <map>
+#include <set>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cctype>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Targets/TargetRegister.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Targets::TargetRegisterDescriptor;
+    using Targets::TargetRegisterDescriptors;
+    using Targets::TargetRegisterType;
+
+    using Exceptions::Exception;
+
+    RegisterDump::RegisterDump(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {}
+
+    void RegisterDump::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling RegisterDump packet");
+
+        const auto writeOutput = [&debugSession] (const std::string& output) {
+            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output)));
+        };
+
+        try {
+            // Everything after "regdump", other than options, is a peripheral name
+            auto requestedPeripheralNames = std::set<std::string>();
+            auto commandStream = std::stringstream(this->command);
+            auto argument = std::string();
+
+            commandStream >> argument;
+            while (commandStream >> argument) {
+                if (argument.find("--") != 0) {
+                    requestedPeripheralNames.insert(RegisterDump::svdName(argument));
+                }
+            }
+
+            /*
+             * We select registers in the same way as GenerateSvd, so that the output corresponds to the SVD, but we
+             * leave out registers that aren't readable.
+             */
+            const auto& targetDescriptor = debugSession.gdbTargetDescriptor.targetDescriptor;
+            auto descriptors = TargetRegisterDescriptors();
+            auto peripheralNamesByDescriptor = std::map<TargetRegisterDescriptor, std::string>();
+            auto foundPeripheralNames = std::set<std::string>();
+
+            for (const auto& [registerType, registerDescriptors] : targetDescriptor.registerDescriptorsByType) {
+                if (registerType != TargetRegisterType::OTHER && registerType != TargetRegisterType::PORT_REGISTER) {
+                    continue;
+                }
+
+                for (const auto& descriptor : registerDescriptors) {
+                    if (
+                        !descriptor.startAddress.has_value()
+                        || !descriptor.name.has_value()
+                        || descriptor.name->empty()
+                        || !descriptor.groupName.has_value()
+                        || !descriptor.readable
+                    ) {
+                        continue;
+                    }
+
+                    const auto peripheralName = RegisterDump::svdName(*descriptor.groupName);
+
+                    if (!requestedPeripheralNames.empty() && !requestedPeripheralNames.contains(peripheralName)) {
+                        continue;
+                    }
+
+                    descriptors.insert(descriptor);
+                    peripheralNamesByDescriptor.emplace(descriptor, peripheralName);
+                    foundPeripheralNames.insert(peripheralName);
+                }
+            }
+
+            for (const auto& peripheralName : requestedPeripheralNames) {
+                if (!foundPeripheralNames.contains(peripheralName)) {
+                    writeOutput("Unknown peripheral \"" + peripheralName + "\" - see \"monitor svd\"\n");
+                    return;
+                }
+            }
+
+            if (descriptors.empty()) {
+                writeOutput("No readable peripheral registers\n");
+                return;
+            }
+
+            auto registers = targetControllerService.readRegisters(descriptors);
+            std::sort(
+                registers.begin(),
+                registers.end(),
+                [] (const Targets::TargetRegister& registerA, const Targets::TargetRegister& registerB) {
+                    return *registerA.descriptor.startAddress < *registerB.descriptor.startAddress;
+                }
+            );
+
+            const auto addressOffset = debugSession.gdbTargetDescriptor.getMemoryOffset(
+                Targets::TargetMemoryType::RAM
+            );
+
+            auto output = std::stringstream();
+            output << std::hex << std::setfill('0');
+
+            if (this->commandOptions.contains("raw")) {
+                for (const auto& targetRegister : registers) {
+                    output << std::setw(6) << (*targetRegister.descriptor.startAddress | addressOffset) << ":"
+                        << Services::StringService::toHex(targetRegister.value) << ";";
+                }
+
+                output << "\n";
+                writeOutput(output.str());
+                return;
+            }
+
+            auto registersByPeripheralName = std::map<std::string, std::vector<const Targets::TargetRegister*>>();
+            for (const auto& targetRegister : registers) {
+                registersByPeripheralName[peripheralNamesByDescriptor.at(targetRegister.descriptor)].push_back(
+                    &targetRegister
+                );
+            }
+
+            for (const auto& [peripheralName, peripheralRegisters] : registersByPeripheralName) {
+                output << peripheralName << "\n";
+
+                for (const auto* targetRegister : peripheralRegisters) {
+                    output << "  0x" << std::setw(6) << (*targetRegister->descriptor.startAddress | addressOffset)
+                        << "  " << std::setw(20) << std::setfill(' ') << std::left
+                        << RegisterDump::svdName(*targetRegister->descriptor.name) << std::right << std::setfill('0')
+                        << "  0x" << Services::StringService::toHex(targetRegister->value) << "\n";
+                }
+            }
+
+            writeOutput(output.str());
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to dump peripheral registers - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    std::string RegisterDump::svdName(const std::string& name) {
+        auto output = name;
+        std::transform(output.begin(), output.end(), output.begin(), [] (unsigned char character) {
+            return character == ' ' ? '_' : static_cast<char>(std::toupper(character));
+        });
+
+        return output;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+
+#include "Monitor.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The RegisterDump class implements a structure for the "monitor regdump [PERIPHERAL...]" GDB command.
+     *
+     * Reads the values of every readable register in the given peripherals (or in all peripherals, if none are
+     * given), via a single TargetController command. The peripherals and their register names are those of the SVD
+     * generated by the "monitor svd" command (see GenerateSvd).
+     *
+     * Reading the registers in one command lets debug tool drivers coalesce the reads (the EDBG AVR8 driver merges
+     * adjacent registers into scatter-gather reads, skipping the gaps between them). IDE peripheral views can refresh
+     * with this command after each stop, instead of sending a memory read packet per register block.
+     *
+     * With the --raw option, the output is a single line of ADDRESS:VALUE pairs, separated by semicolons, in
+     * ascending address order. Addresses are in GDB's address space (as they are in the SVD), and values are in
+     * hexadecimal, most significant byte first. Otherwise, the output is a table, grouped by peripheral.
+     */
+    class RegisterDump: public Monitor
+    {
+    public:
+        explicit RegisterDump(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        /**
+         * Generates the name of a peripheral or register, as it appears in the generated SVD.
+         *
+         * @param name
+         *
+         * @return
+         */
+        static std::string svdName(const std::string& name);
+    };
+}
@@ -1,7 +1,5 @@
 #include "RemoveBreakpoint.hpp"
 
-#include <QtCore/QString>
-
 #include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 
@@ -15,6 +13,8 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
     using Services::TargetControllerService;
 
     using Targets::TargetBreakpoint;
+    using Targets::TargetWatchpoint;
+    using Targets::TargetMemoryType;
 
     using ResponsePackets::OkResponsePacket;
     using ResponsePackets::ErrorResponsePacket;
@@ -29,34 +29,63 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
         }
 
         // z0 = SW breakpoint, z1 = HW breakpoint
-        this->type = (this->data[1] == '0') ? BreakpointType::SOFTWARE_BREAKPOINT : (this->data[1] == '1') ?
-            BreakpointType::HARDWARE_BREAKPOINT : BreakpointType::UNKNOWN;
+        this->type = breakpointTypeFromPacketCharacter(this->data[1]);
+
+        /*
+         * The packet data takes the form of "type,address,kind". The kind is only relevant for watchpoints, where it
+         * specifies the number of bytes to watch.
+         */
+        const auto packetData = this->dataView().substr(1);
+        const auto addressPosition = packetData.find(',');
+        const auto kindPosition = addressPosition != std::string_view::npos
+            ? packetData.find(',', addressPosition + 1)
+            : std::string_view::npos;
+
+        if (kindPosition == std::string_view::npos) {
+            throw Exception("Unexpected number of packet segments in RemoveBreakpoint packet");
+        }
 
-        const auto packetData = QString::fromLocal8Bit(
-            reinterpret_cast<const char*>(this->data.data() + 2),
-            static_cast<int>(this->data.size() - 2)
+        const auto address = Packet::parseHex<Targets::TargetMemoryAddress>(
+            packetData.substr(addressPosition + 1, kindPosition - (addressPosition + 1))
         );
 
-        auto packetSegments = packetData.split(",");
-        if (packetSegments.size() < 3) {
-            throw Exception("Unexpected number of packet segments in RemoveBreakpoint packet");
+        if (!address.has_value()) {
+            throw Exception("Failed to convert address hex value from RemoveBreakpoint packet.");
         }
 
-        bool conversionStatus = true;
-        this->address = packetSegments.at(1).toUInt(&conversionStatus, 16);
+        this->address = *address;
 
-        if (!conversionStatus) {
-            throw Exception("Failed to convert address hex value from RemoveBreakpoint packet.");
+        const auto kind = Packet::parseHex<std::uint32_t>(packetData.substr(kindPosition + 1));
+
+        if (!kind.has_value()) {
+            throw Exception("Failed to convert kind hex value from RemoveBreakpoint packet.");
         }
+
+        this->kind = *kind;
     }
 
     void RemoveBreakpoint::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
         Logger::info("Handling RemoveBreakpoint packet");
 
         try {
+            const auto watchpointType = watchpointTypeFromBreakpointType(this->type);
+
+            if (watchpointType.has_value()) {
+                Logger::debug("Removing watchpoint at address " + std::to_string(this->address));
+
+                const auto ramOffset = debugSession.gdbTargetDescriptor.getMemoryOffset(TargetMemoryType::RAM);
+                targetControllerService.removeWatchpoint(
+                    TargetWatchpoint(this->address & ~ramOffset, this->kind, *watchpointType)
+                );
+                debugSession.watchpoints.erase({this->address, this->type});
+                debugSession.connection.writePacket(OkResponsePacket());
+                return;
+            }
+
             Logger::debug("Removing breakpoint at address " + std::to_string(this->address));
 
             targetControllerService.removeBreakpoint(TargetBreakpoint(this->address));
+            debugSession.breakpointAddresses.erase(this->address);
             debugSession.connection.writePacket(OkResponsePacket());
 
         } catch (const Exception& exception) {
@@ -19,15 +19,22 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
     {
     public:
         /**
-         * Breakpoint type (Software or Hardware)
+         * Breakpoint type (Software or Hardware breakpoint, or Write, Read or Access watchpoint)
          */
         BreakpointType type = BreakpointType::UNKNOWN;
 
         /**
-         * Address at which the breakpoint should be located.
+         * Address at which the breakpoint should be located. For watchpoints, this is the GDB address of the watched
+         * data (including the GDB memory offset).
          */
         Targets::TargetMemoryAddress address = 0;
 
+        /**
+         * For watchpoints, the number of bytes to watch. For breakpoints, this is the size of the breakpoint
+         * instruction, which we don't use.
+         */
+        std::uint32_t kind = 0;
+
         explicit RemoveBreakpoint(const RawPacket& rawPacket);
 
         void handle(
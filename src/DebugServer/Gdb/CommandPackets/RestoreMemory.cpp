@@ -0,0 +1,176 @@
+#include "RestoreMemory.hpp"
+
+#include <sstream>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Helpers/EnumToStringMappings.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+    using Targets::TargetMemoryBuffer;
+
+    RestoreMemory::RestoreMemory(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {
+        auto arguments = std::stringstream(this->command);
+        auto argument = std::string();
+
+        // Skip the command name
+        arguments >> argument;
+
+        if (arguments >> argument) {
+            this->memoryTypeName = argument;
+        }
+
+        if (arguments >> argument) {
+            this->startAddressString = argument;
+        }
+
+        // The file path is the remainder of the command, which may contain spaces
+        std::getline(arguments >> std::ws, this->filePath);
+
+        if (this->filePath.size() >= 2 && this->filePath.front() == '"' && this->filePath.back() == '"') {
+            this->filePath = this->filePath.substr(1, this->filePath.size() - 2);
+        }
+    }
+
+    void RestoreMemory::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling RestoreMemory packet");
+
+        const auto writeOutput = [&debugSession] (const std::string& output) {
+            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output + "\n")));
+        };
+
+        if (!this->startAddressString.has_value() || this->filePath.empty()) {
+            writeOutput("Usage: monitor restore <ram|eeprom> <start> <path>");
+            return;
+        }
+
+        const auto memoryType = EnumToStringMappings::targetMemoryTypes.valueAt(
+            QString::fromStdString(*(this->memoryTypeName))
+        );
+
+        if (
+            !memoryType.has_value()
+            || (*memoryType != Targets::TargetMemoryType::RAM && *memoryType != Targets::TargetMemoryType::EEPROM)
+        ) {
+            writeOutput(
+                "Invalid memory type (\"" + *(this->memoryTypeName) + "\") - expected ram or eeprom (use the 'load' "
+                    "command for program memory)"
+            );
+            return;
+        }
+
+        const auto& gdbTargetDescriptor = debugSession.gdbTargetDescriptor;
+        const auto& memoryDescriptorsByType = gdbTargetDescriptor.targetDescriptor.memoryDescriptorsByType;
+        const auto memoryDescriptorIt = memoryDescriptorsByType.find(*memoryType);
+
+        if (memoryDescriptorIt == memoryDescriptorsByType.end()) {
+            writeOutput("Target has no " + *(this->memoryTypeName) + " memory");
+            return;
+        }
+
+        const auto& memoryDescriptor = memoryDescriptorIt->second;
+
+        auto startAddress = TargetMemoryAddress(0);
+
+        try {
+            startAddress = static_cast<TargetMemoryAddress>(std::stoul(*(this->startAddressString), nullptr, 0));
+
+        } catch (const std::logic_error&) {
+            writeOutput("Invalid start address - expected a decimal or hexadecimal (0x...) value");
+            return;
+        }
+
+        // Addresses may be given as GDB sees them, with the memory offset (see Gdb::TargetDescriptor)
+        startAddress &= ~(gdbTargetDescriptor.getMemoryOffset(*memoryType));
+
+        if (*memoryType == Targets::TargetMemoryType::EEPROM) {
+            // As with GDB, EEPROM addresses are relative to the start of the EEPROM
+            startAddress += memoryDescriptor.addressRange.startAddress;
+        }
+
+        try {
+            auto file = std::ifstream(this->filePath, std::ios::binary);
+
+            if (!file.is_open()) {
+                throw Exception("Failed to open \"" + this->filePath + "\" for reading");
+            }
+
+            const auto buffer = TargetMemoryBuffer(
+                std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>()
+            );
+            const auto bytes = static_cast<TargetMemorySize>(buffer.size());
+
+            if (
+                bytes == 0
+                || !memoryDescriptor.addressRange.contains(startAddress)
+                || (bytes - 1) > (memoryDescriptor.addressRange.endAddress - startAddress)
+            ) {
+                writeOutput(
+                    "The file (" + std::to_string(bytes) + " bytes) does not fit within the target's "
+                        + *(this->memoryTypeName) + " memory, at the given start address"
+                );
+                return;
+            }
+
+            Logger::warning(
+                "Restoring " + std::to_string(bytes) + " bytes of " + *(this->memoryTypeName) + " from "
+                    + this->filePath
+            );
+
+            auto bytesWritten = TargetMemorySize(0);
+
+            while (bytesWritten < bytes) {
+                const auto chunkSize = std::min(RestoreMemory::CHUNK_SIZE, bytes - bytesWritten);
+
+                targetControllerService.writeMemory(
+                    *memoryType,
+                    startAddress + bytesWritten,
+                    TargetMemoryBuffer(
+                        buffer.begin() + bytesWritten,
+                        buffer.begin() + bytesWritten + chunkSize
+                    )
+                );
+
+                bytesWritten += chunkSize;
+
+                if (bytesWritten < bytes) {
+                    debugSession.connection.writeConsoleOutput(
+                        "Restored " + std::to_string(bytesWritten) + " of " + std::to_string(bytes) + " bytes ("
+                            + std::to_string((bytesWritten * 100) / bytes) + "%)\n"
+                    );
+                }
+            }
+
+            writeOutput(
+                "Restored " + std::to_string(bytes) + " bytes of "
+                    + EnumToStringMappings::targetMemoryTypes.at(*memoryType).toUpper().toStdString()
+                    + " from " + this->filePath
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to restore memory - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
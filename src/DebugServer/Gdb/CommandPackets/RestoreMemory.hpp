@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+
+#include "Monitor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The RestoreMemory class implements a structure for the "monitor restore" GDB command.
+     *
+     * "restore <ram|eeprom> <start> <path>" writes the content of a raw binary file on the host (such as one produced
+     * by the "monitor dump" command) to the target's memory, starting at the given address. This bypasses GDB's
+     * "restore" command, which writes the memory via "M"/"X" packets, a few hundred bytes at a time.
+     *
+     * Program memory cannot be restored via this command - use "monitor load" instead.
+     */
+    class RestoreMemory: public Monitor
+    {
+    public:
+        explicit RestoreMemory(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        /**
+         * The number of bytes to write to the target before reporting progress.
+         *
+         * This is smaller than DumpMemory::CHUNK_SIZE, as writes (particularly to EEPROM) are much slower than
+         * reads, and each chunk must complete within the TargetController's default response timeout.
+         */
+        static constexpr auto CHUNK_SIZE = Targets::TargetMemorySize(1024);
+
+        std::optional<std::string> memoryTypeName;
+        std::optional<std::string> startAddressString;
+
+        /**
+         * The path to the input file, relative to the current working directory (if not absolute).
+         */
+        std::string filePath;
+    };
+}
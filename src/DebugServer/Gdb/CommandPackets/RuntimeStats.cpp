@@ -0,0 +1,26 @@
+#include "RuntimeStats.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Services/MetricsService.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+
+    RuntimeStats::RuntimeStats(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {}
+
+    void RuntimeStats::handle(DebugSession& debugSession, TargetControllerService&) {
+        Logger::info("Handling RuntimeStats packet");
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+            Services::MetricsService::generateReport()
+        )));
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Monitor.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The RuntimeStats class implements a structure for the "monitor stats" GDB command.
+     *
+     * We output the current value of every runtime performance counter and histogram (see MetricsService).
+     */
+    class RuntimeStats: public Monitor
+    {
+    public:
+        explicit RuntimeStats(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -0,0 +1,74 @@
+#include "SelectThread.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/EmptyResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::OkResponsePacket;
+    using ResponsePackets::EmptyResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    SelectThread::SelectThread(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        const auto packetData = this->dataView();
+
+        if (packetData.size() < 3) {
+            throw Exception("Invalid H packet");
+        }
+
+        this->operation = packetData[1];
+
+        const auto threadIdString = packetData.substr(2);
+        if (threadIdString == "-1" || threadIdString == "0") {
+            return;
+        }
+
+        this->threadId = Packet::parseHex<std::uint32_t>(threadIdString);
+
+        if (!this->threadId.has_value()) {
+            throw Exception("Failed to parse thread ID from H packet");
+        }
+    }
+
+    void SelectThread::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling SelectThread packet");
+
+        if (!debugSession.rtosThreadAwareness.has_value()) {
+            debugSession.connection.writePacket(EmptyResponsePacket());
+            return;
+        }
+
+        if (this->operation != 'g') {
+            debugSession.connection.writePacket(OkResponsePacket());
+            return;
+        }
+
+        auto& rtosThreadAwareness = *(debugSession.rtosThreadAwareness);
+
+        try {
+            if (
+                this->threadId.has_value()
+                && rtosThreadAwareness.findThread(*(this->threadId), targetControllerService) == nullptr
+            ) {
+                throw Exception("Unknown thread ID " + std::to_string(*(this->threadId)));
+            }
+
+            rtosThreadAwareness.selectedThreadId = this->threadId;
+            debugSession.connection.writePacket(OkResponsePacket());
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to select thread - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
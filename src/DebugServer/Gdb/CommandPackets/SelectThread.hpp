@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The SelectThread class implements a structure for "H<op><id>" packets. GDB uses these to select the thread
+     * for subsequent operations - "Hg" selects the thread for register access, "Hc" selects the thread for
+     * (deprecated) continue and step packets.
+     *
+     * Only "Hg" is meaningful to us - the target has one CPU, so execution operations always apply to the target.
+     * Register reads for a thread that isn't running are served from the context saved on the thread's stack (see
+     * FreeRtosThreadAwareness::readThreadRegisters()).
+     */
+    class SelectThread: public CommandPacket
+    {
+    public:
+        /**
+         * The operation character - 'g' or 'c'.
+         */
+        char operation = 'g';
+
+        /**
+         * The selected thread, or std::nullopt for any thread (IDs 0 and -1).
+         */
+        std::optional<std::uint32_t> threadId;
+
+        explicit SelectThread(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
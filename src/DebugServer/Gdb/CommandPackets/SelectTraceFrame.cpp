@@ -0,0 +1,166 @@
+#include "SelectTraceFrame.hpp"
+
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/TargetController/Tracepoint.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using TargetController::TraceFrame;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::OkResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    SelectTraceFrame::SelectTraceFrame(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        // "QTFrame:" is 8 characters long
+        auto packetData = this->dataView();
+        if (packetData.size() < 9) {
+            throw Exception("Unexpected SelectTraceFrame packet size");
+        }
+
+        packetData.remove_prefix(8);
+
+        auto segments = std::vector<std::string_view>();
+        auto segmentPosition = std::size_t(0);
+        while (segmentPosition != std::string_view::npos) {
+            const auto segmentEndPosition = packetData.find(':', segmentPosition);
+            segments.emplace_back(packetData.substr(segmentPosition, segmentEndPosition - segmentPosition));
+            segmentPosition = segmentEndPosition != std::string_view::npos
+                ? segmentEndPosition + 1
+                : std::string_view::npos;
+        }
+
+        if (segments.size() == 1) {
+            const auto frameNumber = Packet::parseHex<std::uint32_t>(segments[0]);
+            if (!frameNumber.has_value()) {
+                throw Exception("Failed to parse frame number from SelectTraceFrame packet");
+            }
+
+            this->mode = Mode::NUMBER;
+            if (*frameNumber != 0xFFFFFFFF) {
+                this->frameNumber = *frameNumber;
+            }
+
+            return;
+        }
+
+        if (segments.size() == 2 && (segments[0] == "pc" || segments[0] == "tdp")) {
+            const auto value = Packet::parseHex<std::uint32_t>(segments[1]);
+            if (!value.has_value()) {
+                throw Exception("Failed to parse value from SelectTraceFrame packet");
+            }
+
+            this->mode = segments[0] == "pc" ? Mode::PROGRAM_COUNTER : Mode::TRACEPOINT;
+            this->value = *value;
+            return;
+        }
+
+        if (segments.size() == 3 && (segments[0] == "range" || segments[0] == "outside")) {
+            const auto startAddress = Packet::parseHex<Targets::TargetMemoryAddress>(segments[1]);
+            const auto endAddress = Packet::parseHex<Targets::TargetMemoryAddress>(segments[2]);
+            if (!startAddress.has_value() || !endAddress.has_value()) {
+                throw Exception("Failed to parse address range from SelectTraceFrame packet");
+            }
+
+            this->mode = segments[0] == "range" ? Mode::RANGE : Mode::OUTSIDE_RANGE;
+            this->startAddress = *startAddress;
+            this->endAddress = *endAddress;
+            return;
+        }
+
+        throw Exception("Unsupported SelectTraceFrame packet");
+    }
+
+    void SelectTraceFrame::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling SelectTraceFrame packet");
+
+        try {
+            if (this->mode == Mode::NUMBER && !this->frameNumber.has_value()) {
+                debugSession.selectedTraceFrameIndex = std::nullopt;
+                debugSession.connection.writePacket(OkResponsePacket());
+                return;
+            }
+
+            // Top up our copy of the trace frames, in case the TargetController has collected more since the last time
+            auto& traceFrames = debugSession.traceFrames;
+            for (auto& frame : targetControllerService.readTraceFrames(traceFrames.size())) {
+                traceFrames.emplace_back(std::move(frame));
+            }
+
+            const auto matchesFrame = [this] (const TraceFrame& frame) {
+                switch (this->mode) {
+                    case Mode::PROGRAM_COUNTER: {
+                        return frame.programCounter == this->value;
+                    }
+                    case Mode::TRACEPOINT: {
+                        return frame.tracepointNumber == this->value;
+                    }
+                    case Mode::RANGE: {
+                        return frame.programCounter >= this->startAddress && frame.programCounter <= this->endAddress;
+                    }
+                    case Mode::OUTSIDE_RANGE: {
+                        return frame.programCounter < this->startAddress || frame.programCounter > this->endAddress;
+                    }
+                    default: {
+                        return false;
+                    }
+                }
+            };
+
+            auto frameIndex = std::optional<std::size_t>();
+
+            if (this->mode == Mode::NUMBER) {
+                if (*this->frameNumber < traceFrames.size()) {
+                    frameIndex = *this->frameNumber;
+                }
+
+            } else {
+                // Searches begin at the frame following the currently selected frame
+                for (
+                    auto index = debugSession.selectedTraceFrameIndex.has_value()
+                        ? *debugSession.selectedTraceFrameIndex + 1
+                        : std::size_t(0);
+                    index < traceFrames.size();
+                    ++index
+                ) {
+                    if (matchesFrame(traceFrames[index])) {
+                        frameIndex = index;
+                        break;
+                    }
+                }
+            }
+
+            debugSession.selectedTraceFrameIndex = frameIndex;
+
+            if (!frameIndex.has_value()) {
+                debugSession.connection.writePacket(ResponsePacket("F-1"));
+                return;
+            }
+
+            auto output = std::stringstream();
+            output << std::hex << "F" << *frameIndex << "T" << traceFrames[*frameIndex].tracepointNumber;
+
+            debugSession.connection.writePacket(ResponsePacket(output.str()));
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to select trace frame - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "CommandPacket.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The SelectTraceFrame class implements a structure for "QTFrame" packets. GDB sends these packets for the
+     * "tfind" command, to select a trace frame for inspection. The frame can be selected by number ("QTFrame:n"), or
+     * by searching, from the currently selected frame onwards, for the next frame that was collected at a given
+     * address ("QTFrame:pc:addr"), by a given tracepoint ("QTFrame:tdp:t"), or at an address inside
+     * ("QTFrame:range:start:end") or outside ("QTFrame:outside:start:end") a given range.
+     *
+     * Whilst a frame is selected, register and memory reads are served from the frame. See
+     * DebugSession::selectedTraceFrameIndex.
+     */
+    class SelectTraceFrame: public CommandPacket
+    {
+    public:
+        enum class Mode: std::uint8_t
+        {
+            NUMBER,
+            PROGRAM_COUNTER,
+            TRACEPOINT,
+            RANGE,
+            OUTSIDE_RANGE,
+        };
+
+        Mode mode = Mode::NUMBER;
+
+        /**
+         * For Mode::NUMBER, the frame number, or std::nullopt if the client is deselecting the current frame
+         * ("QTFrame:ffffffff").
+         */
+        std::optional<std::size_t> frameNumber;
+
+        /**
+         * For Mode::PROGRAM_COUNTER, the address. For Mode::TRACEPOINT, the tracepoint number.
+         */
+        std::uint32_t value = 0;
+
+        /**
+         * For Mode::RANGE and Mode::OUTSIDE_RANGE. The range is inclusive.
+         */
+        Targets::TargetMemoryAddress startAddress = 0;
+        Targets::TargetMemoryAddress endAddress = 0;
+
+        explicit SelectTraceFrame(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -1,6 +1,6 @@
 #include "SetBreakpoint.hpp"
 
-#include <QtCore/QString>
+#include <stdexcept>
 
 #include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/EmptyResponsePacket.hpp"
@@ -16,6 +16,10 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
     using Services::TargetControllerService;
 
     using Targets::TargetBreakpoint;
+    using Targets::TargetWatchpoint;
+    using Targets::TargetMemoryType;
+
+    using TargetController::AgentExpression;
 
     using ResponsePackets::OkResponsePacket;
     using ResponsePackets::ErrorResponsePacket;
@@ -31,24 +35,70 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
         }
 
         // Z0 = SW breakpoint, Z1 = HW breakpoint
-        this->type = (this->data[1] == '0') ? BreakpointType::SOFTWARE_BREAKPOINT : (this->data[1] == '1') ?
-            BreakpointType::HARDWARE_BREAKPOINT : BreakpointType::UNKNOWN;
+        this->type = breakpointTypeFromPacketCharacter(this->data[1]);
+
+        /*
+         * The packet data takes the form of "type,address,kind[;cond_list]". The kind is only relevant for
+         * watchpoints, where it specifies the number of bytes to watch. The (optional) condition list takes the form
+         * of "X<length>,<bytecode>[;X<length>,<bytecode>...]", with the length and bytecode in hexadecimal form.
+         */
+        const auto packetData = this->dataView().substr(1);
+        const auto addressPosition = packetData.find(',');
+        const auto kindPosition = addressPosition != std::string_view::npos
+            ? packetData.find(',', addressPosition + 1)
+            : std::string_view::npos;
+
+        if (kindPosition == std::string_view::npos) {
+            throw Exception("Unexpected number of packet segments in SetBreakpoint packet");
+        }
 
-        auto packetData = QString::fromLocal8Bit(
-            reinterpret_cast<const char*>(this->data.data() + 2),
-            static_cast<int>(this->data.size() - 2)
+        const auto address = Packet::parseHex<Targets::TargetMemoryAddress>(
+            packetData.substr(addressPosition + 1, kindPosition - (addressPosition + 1))
         );
 
-        auto packetSegments = packetData.split(",");
-        if (packetSegments.size() < 3) {
-            throw Exception("Unexpected number of packet segments in SetBreakpoint packet");
+        if (!address.has_value()) {
+            throw Exception("Failed to convert address hex value from SetBreakpoint packet.");
         }
 
-        bool conversionStatus = true;
-        this->address = packetSegments.at(1).toUInt(&conversionStatus, 16);
+        this->address = *address;
 
-        if (!conversionStatus) {
-            throw Exception("Failed to convert address hex value from SetBreakpoint packet.");
+        const auto conditionListPosition = packetData.find(';', kindPosition + 1);
+        const auto kind = Packet::parseHex<std::uint32_t>(
+            packetData.substr(kindPosition + 1, conditionListPosition - (kindPosition + 1))
+        );
+
+        if (!kind.has_value()) {
+            throw Exception("Failed to convert kind hex value from SetBreakpoint packet.");
+        }
+
+        this->kind = *kind;
+
+        auto segmentPosition = conditionListPosition;
+        while (segmentPosition != std::string_view::npos) {
+            const auto segmentEndPosition = packetData.find(';', segmentPosition + 1);
+            const auto segment = packetData.substr(segmentPosition + 1, segmentEndPosition - (segmentPosition + 1));
+            segmentPosition = segmentEndPosition;
+
+            if (segment.empty() || segment.front() != 'X') {
+                // Breakpoint commands ("cmds:...") - we don't report support for these, so GDB shouldn't send them
+                continue;
+            }
+
+            const auto lengthEndPosition = segment.find(',');
+            const auto length = lengthEndPosition != std::string_view::npos
+                ? Packet::parseHex<std::size_t>(segment.substr(1, lengthEndPosition - 1))
+                : std::nullopt;
+
+            if (!length.has_value() || segment.size() - (lengthEndPosition + 1) != *length * 2) {
+                throw Exception("Invalid breakpoint condition in SetBreakpoint packet");
+            }
+
+            try {
+                this->conditions.emplace_back(Packet::hexToData(segment.substr(lengthEndPosition + 1)));
+
+            } catch (const std::invalid_argument&) {
+                throw Exception("Invalid breakpoint condition bytecode in SetBreakpoint packet");
+            }
         }
     }
 
@@ -65,7 +115,40 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
                 return;
             }
 
-            targetControllerService.setBreakpoint(TargetBreakpoint(this->address));
+            const auto watchpointType = watchpointTypeFromBreakpointType(this->type);
+
+            if (watchpointType.has_value()) {
+                const auto ramOffset = debugSession.gdbTargetDescriptor.getMemoryOffset(TargetMemoryType::RAM);
+
+                if (
+                    debugSession.gdbTargetDescriptor.getMemoryTypeFromGdbAddress(this->address)
+                    != TargetMemoryType::RAM
+                ) {
+                    // Data breakpoints can only watch RAM
+                    Logger::debug(
+                        "Rejecting watchpoint at address " + std::to_string(this->address) + " - not a RAM address"
+                    );
+                    debugSession.connection.writePacket(EmptyResponsePacket());
+                    return;
+                }
+
+                targetControllerService.setWatchpoint(
+                    TargetWatchpoint(this->address & ~ramOffset, this->kind, *watchpointType)
+                );
+                debugSession.watchpoints.emplace(this->address, this->type);
+                debugSession.connection.writePacket(OkResponsePacket());
+                return;
+            }
+
+            auto conditions = std::vector<AgentExpression>();
+            conditions.reserve(this->conditions.size());
+
+            for (auto bytecode : this->conditions) {
+                conditions.emplace_back(debugSession.gdbTargetDescriptor.createAgentExpression(std::move(bytecode)));
+            }
+
+            targetControllerService.setBreakpoint(TargetBreakpoint(this->address), std::move(conditions));
+            debugSession.breakpointAddresses.insert(this->address);
             debugSession.connection.writePacket(OkResponsePacket());
 
         } catch (const Exception& exception) {
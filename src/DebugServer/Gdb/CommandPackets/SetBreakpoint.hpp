@@ -3,10 +3,10 @@
 #include <cstdint>
 #include <string>
 #include <set>
+#include <vector>
 
 #include "CommandPacket.hpp"
 #include "src/DebugServer/Gdb/BreakpointType.hpp"
-
 #include "src/Targets/TargetMemory.hpp"
 
 namespace Bloom::DebugServer::Gdb::CommandPackets
@@ -19,15 +19,29 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
     {
     public:
         /**
-         * Breakpoint type (Software or Hardware)
+         * Breakpoint type (Software or Hardware breakpoint, or Write, Read or Access watchpoint)
          */
         BreakpointType type = BreakpointType::UNKNOWN;
 
         /**
-         * Address at which the breakpoint should be located.
+         * Address at which the breakpoint should be located. For watchpoints, this is the GDB address of the watched
+         * data (including the GDB memory offset).
          */
         Targets::TargetMemoryAddress address = 0;
 
+        /**
+         * For watchpoints, the number of bytes to watch. For breakpoints, this is the size of the breakpoint
+         * instruction, which we don't use.
+         */
+        std::uint32_t kind = 0;
+
+        /**
+         * The agent expression bytecode of each of the breakpoint's conditions, if any (see the "cond_list" in the
+         * documentation for the "Z0" packet). These are only sent by GDB if we report the "ConditionalBreakpoints"
+         * feature.
+         */
+        std::vector<std::vector<unsigned char>> conditions;
+
         explicit SetBreakpoint(const RawPacket& rawPacket);
 
         void handle(
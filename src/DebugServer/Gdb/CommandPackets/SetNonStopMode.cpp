@@ -0,0 +1,39 @@
+#include "SetNonStopMode.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::OkResponsePacket;
+
+    using Exceptions::Exception;
+
+    SetNonStopMode::SetNonStopMode(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        const auto packetData = this->dataView();
+
+        // "QNonStop:" is 9 characters long
+        if (packetData.size() != 10 || (packetData[9] != '0' && packetData[9] != '1')) {
+            throw Exception("Invalid QNonStop packet");
+        }
+
+        this->enable = packetData[9] == '1';
+    }
+
+    void SetNonStopMode::handle(DebugSession& debugSession, TargetControllerService&) {
+        Logger::info("Handling SetNonStopMode packet");
+
+        debugSession.nonStopMode = this->enable;
+        debugSession.pendingStopReplies.clear();
+
+        debugSession.connection.writePacket(OkResponsePacket());
+
+        Logger::debug(std::string("Non-stop mode ") + (this->enable ? "enabled" : "disabled"));
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The SetNonStopMode class implements a structure for "QNonStop:..." packets. These packets enable ("QNonStop:1")
+     * or disable ("QNonStop:0") non-stop mode, for the remainder of the debug session (or until the next QNonStop
+     * packet).
+     *
+     * See DebugSession::nonStopMode and https://sourceware.org/gdb/onlinedocs/gdb/Remote-Non_002dStop.html for more.
+     */
+    class SetNonStopMode: public CommandPacket
+    {
+    public:
+        bool enable = false;
+
+        explicit SetNonStopMode(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
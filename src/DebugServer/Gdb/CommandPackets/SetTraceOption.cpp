@@ -0,0 +1,43 @@
+#include "SetTraceOption.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::OkResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    SetTraceOption::SetTraceOption(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        const auto packetData = this->dataView();
+
+        // "QTro:..." or "QTBuffer:<option>:<value>"
+        const auto valuePosition = packetData.starts_with("QTBuffer:")
+            ? packetData.find(':', 9)
+            : packetData.find(':');
+
+        this->option = std::string(packetData.substr(0, valuePosition));
+        this->value = valuePosition != std::string_view::npos
+            ? std::string(packetData.substr(valuePosition + 1))
+            : std::string();
+    }
+
+    void SetTraceOption::handle(DebugSession& debugSession, TargetControllerService&) {
+        Logger::info("Handling SetTraceOption packet");
+
+        if (this->option == "QTBuffer:circular" && this->value != "0") {
+            Logger::warning("Circular trace buffers are not supported");
+            debugSession.connection.writePacket(ErrorResponsePacket());
+            return;
+        }
+
+        Logger::debug("Ignoring trace option \"" + this->option + "\"");
+        debugSession.connection.writePacket(OkResponsePacket());
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The SetTraceOption class implements a structure for the trace configuration packets that GDB sends upon
+     * starting a trace experiment: "QTro:..." (read-only memory regions) and "QTBuffer:..." (trace buffer
+     * configuration).
+     *
+     * The trace buffer lives in the TargetController and is of fixed size, and it isn't circular. Read-only regions
+     * are of no consequence to us, as flash memory is always read from the target.
+     */
+    class SetTraceOption: public CommandPacket
+    {
+    public:
+        /**
+         * The option name (e.g. "QTro" or "QTBuffer:circular") and value.
+         */
+        std::string option;
+        std::string value;
+
+        explicit SetTraceOption(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -0,0 +1,54 @@
+#include "SourceLineStep.hpp"
+
+#include <sstream>
+#include <iomanip>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Services/SymbolService.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+    using Services::SymbolService;
+
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    SourceLineStep::SourceLineStep(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {}
+
+    void SourceLineStep::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling SourceLineStep packet");
+
+        try {
+            targetControllerService.stepSourceLine(this->commandOptions.contains("over"));
+
+            // We respond once the target has stopped
+            debugSession.waitingForBreak = true;
+            debugSession.steppingExecution = true;
+            debugSession.pendingMonitorStep = true;
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to step source line - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    std::string SourceLineStep::stopDescription(Targets::TargetProgramCounter programCounter) {
+        auto output = std::stringstream();
+        output << "Stopped at 0x" << std::hex << std::setfill('0') << std::setw(6) << programCounter << std::dec;
+
+        if (const auto symbol = SymbolService::symbolAt(Targets::TargetMemoryType::FLASH, programCounter)) {
+            output << " (" << symbol->name << " + " << (programCounter - symbol->startAddress) << ")";
+        }
+
+        output << "\nGDB's register cache is now stale - use \"maintenance flush register-cache\" (or \"flushregs\")"
+            << " to refresh it.\n";
+        return output.str();
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+
+#include "Monitor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The SourceLineStep class implements a structure for the "monitor step-line" GDB command.
+     *
+     * The TargetController steps execution until the program counter reaches the beginning of another source
+     * statement, according to the line table of the project's ELF file. The whole step is carried out with a single
+     * command, no matter how many instructions the statement consists of. With the --over option, calls made from
+     * within the statement are stepped over, by running to their return address.
+     *
+     * GDB waits for the command's output, not a stop reply, so we hold off responding until the target has stopped
+     * (see DebugSession::pendingMonitorStep and GdbRspDebugServer::onTargetExecutionStopped()).
+     */
+    class SourceLineStep: public Monitor
+    {
+    public:
+        explicit SourceLineStep(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+        /**
+         * Generates the command output for the end of a source-line step.
+         *
+         * @param programCounter
+         *  The program counter at which the target stopped.
+         *
+         * @return
+         */
+        static std::string stopDescription(Targets::TargetProgramCounter programCounter);
+    };
+}
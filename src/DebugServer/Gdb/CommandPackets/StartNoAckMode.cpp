@@ -0,0 +1,26 @@
+#include "StartNoAckMode.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::OkResponsePacket;
+
+    StartNoAckMode::StartNoAckMode(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {}
+
+    void StartNoAckMode::handle(DebugSession& debugSession, TargetControllerService&) {
+        Logger::info("Handling StartNoAckMode packet");
+
+        // This response packet will be acknowledged by GDB, as we're still in acknowledgement mode at this point.
+        debugSession.connection.writePacket(OkResponsePacket());
+        debugSession.connection.disableAcknowledgements();
+
+        Logger::debug("Packet acknowledgement disabled for this debug session");
+    }
+}
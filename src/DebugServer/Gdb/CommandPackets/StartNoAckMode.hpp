@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The StartNoAckMode class implements a structure for "QStartNoAckMode" packets. Upon receiving this packet, the
+     * server is expected to stop sending and expecting '+' acknowledgements, for the remainder of the debug session.
+     *
+     * The exchange of this packet and its response is carried out in acknowledgement mode. Acknowledgements are only
+     * disabled once GDB has acknowledged our "OK" response.
+     *
+     * See https://sourceware.org/gdb/onlinedocs/gdb/Packet-Acknowledgment.html for more.
+     */
+    class StartNoAckMode: public CommandPacket
+    {
+    public:
+        explicit StartNoAckMode(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -0,0 +1,52 @@
+#include "StartTrace.hpp"
+
+#include <vector>
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/TargetController/Tracepoint.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using TargetController::Tracepoint;
+
+    using ResponsePackets::OkResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    StartTrace::StartTrace(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {}
+
+    void StartTrace::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling StartTrace packet");
+
+        try {
+            auto tracepoints = std::vector<Tracepoint>();
+            tracepoints.reserve(debugSession.tracepointsByNumber.size());
+
+            for (const auto& [number, tracepoint] : debugSession.tracepointsByNumber) {
+                tracepoints.emplace_back(tracepoint);
+            }
+
+            targetControllerService.startTracing(std::move(tracepoints));
+
+            // The TargetController discards the previous experiment's frames upon starting a new one
+            debugSession.traceFrames.clear();
+            debugSession.selectedTraceFrameIndex = std::nullopt;
+
+            debugSession.connection.writePacket(OkResponsePacket());
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to start trace experiment - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The StartTrace class implements a structure for "QTStart" packets. Upon receiving this packet, the server is
+     * expected to start a trace experiment, with the tracepoints defined via previous DefineTracepoint packets.
+     *
+     * The tracepoints are handed to the TargetController, which collects the trace frames from then on, without any
+     * involvement from the GDB server. See TargetControllerComponent::recordTraceFrames() for more.
+     */
+    class StartTrace: public CommandPacket
+    {
+    public:
+        explicit StartTrace(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -1,5 +1,6 @@
 #include "StepExecution.hpp"
 
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 
 #include "src/Logger/Logger.hpp"
@@ -9,6 +10,7 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
 {
     using Services::TargetControllerService;
 
+    using ResponsePackets::OkResponsePacket;
     using ResponsePackets::ErrorResponsePacket;
 
     using Exceptions::Exception;
@@ -16,10 +18,12 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
     StepExecution::StepExecution(const RawPacket& rawPacket)
         : CommandPacket(rawPacket)
     {
-        if (this->data.size() > 2) {
-            this->fromAddress = static_cast<Targets::TargetProgramCounter>(
-                std::stoi(std::string(this->data.begin() + 2, this->data.end()), nullptr, 16)
-            );
+        if (this->data.size() > 1) {
+            this->fromAddress = Packet::parseHex<Targets::TargetMemoryAddress>(this->dataView().substr(1));
+
+            if (!this->fromAddress.has_value()) {
+                throw Exception("Failed to parse address from step packet data");
+            }
         }
     }
 
@@ -29,6 +33,12 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
         try {
             targetControllerService.stepTargetExecution(this->fromAddress);
             debugSession.waitingForBreak = true;
+            debugSession.steppingExecution = true;
+
+            if (debugSession.nonStopMode) {
+                // The stop will be reported via a notification
+                debugSession.connection.writePacket(OkResponsePacket());
+            }
 
         } catch (const Exception& exception) {
             Logger::error("Failed to step execution on target - " + exception.getMessage());
@@ -0,0 +1,36 @@
+#include "StepOverInstruction.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    StepOverInstruction::StepOverInstruction(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {}
+
+    void StepOverInstruction::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling StepOverInstruction packet");
+
+        try {
+            targetControllerService.stepOverInstruction(std::nullopt);
+
+            // We respond once the target has stopped
+            debugSession.waitingForBreak = true;
+            debugSession.steppingExecution = true;
+            debugSession.pendingMonitorStep = true;
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to step over instruction - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Monitor.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The StepOverInstruction class implements a structure for the "monitor step-over" GDB command.
+     *
+     * The TargetController steps a single instruction. If the instruction is a call (CALL, RCALL, ICALL or EICALL),
+     * the TargetController runs the target to the instruction that follows it, instead of stepping into the callee.
+     * The whole step is carried out with a single command, no matter how long the callee takes to return.
+     *
+     * As with "monitor step-line", GDB waits for the command's output, not a stop reply, so we hold off responding
+     * until the target has stopped (see DebugSession::pendingMonitorStep).
+     */
+    class StepOverInstruction: public Monitor
+    {
+    public:
+        explicit StepOverInstruction(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
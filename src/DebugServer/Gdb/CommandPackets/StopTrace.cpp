@@ -0,0 +1,34 @@
+#include "StopTrace.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::OkResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    StopTrace::StopTrace(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {}
+
+    void StopTrace::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling StopTrace packet");
+
+        try {
+            targetControllerService.stopTracing();
+            debugSession.connection.writePacket(OkResponsePacket());
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to stop trace experiment - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The StopTrace class implements a structure for "QTStop" packets. Upon receiving this packet, the server is
+     * expected to stop the current trace experiment. The collected trace frames are retained, for inspection.
+     */
+    class StopTrace: public CommandPacket
+    {
+    public:
+        explicit StopTrace(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
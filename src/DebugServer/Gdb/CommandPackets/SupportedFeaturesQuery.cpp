@@ -37,14 +37,13 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
             );
 
             const auto featureList = packetData.split(";");
-            static const auto gdbFeatureMapping = getGdbFeatureToNameMapping();
 
             for (auto featureName : featureList) {
                 // We only care about supported features. Supported features will precede a '+' character.
                 if (featureName[featureName.size() - 1] == '+') {
                     featureName.remove('+');
 
-                    const auto feature = gdbFeatureMapping.valueAt(featureName.toStdString());
+                    const auto feature = GDB_FEATURE_NAMES.valueAt(featureName.toStdString());
                     if (feature.has_value()) {
                         this->supportedFeatures.insert(feature.value());
                     }
@@ -0,0 +1,94 @@
+#include "SymbolLookup.hpp"
+
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Services/SymbolService.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+    using Services::SymbolService;
+
+    using ResponsePackets::ResponsePacket;
+
+    using Targets::TargetMemoryAddress;
+
+    SymbolLookup::SymbolLookup(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {}
+
+    void SymbolLookup::handle(DebugSession& debugSession, TargetControllerService&) {
+        Logger::info("Handling SymbolLookup packet");
+
+        const auto writeOutput = [&debugSession] (const std::string& output) {
+            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output + "\n")));
+        };
+
+        const auto delimiterPos = this->command.find(' ');
+        const auto query = delimiterPos != std::string::npos ? this->command.substr(delimiterPos + 1) : std::string();
+
+        if (query.empty()) {
+            writeOutput("Usage: monitor symbol <name|address>");
+            return;
+        }
+
+        if (SymbolService::symbolTable() == nullptr) {
+            writeOutput("No ELF file loaded - set the \"elfFile\" parameter in your project config");
+            return;
+        }
+
+        const auto& gdbTargetDescriptor = debugSession.gdbTargetDescriptor;
+        const auto toGdbAddressString = [&gdbTargetDescriptor] (const SymbolService::Symbol& symbol) {
+            auto stream = std::stringstream();
+            stream << "0x" << std::hex << std::setfill('0') << std::setw(6)
+                << (symbol.startAddress | gdbTargetDescriptor.getMemoryOffset(symbol.memoryType));
+            return stream.str();
+        };
+
+        if (query.find("0x") == 0) {
+            auto gdbAddress = std::uint32_t(0);
+
+            try {
+                gdbAddress = static_cast<std::uint32_t>(std::stoul(query, nullptr, 16));
+
+            } catch (const std::logic_error&) {
+                writeOutput("Invalid address \"" + query + "\"");
+                return;
+            }
+
+            const auto memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbAddress);
+            const auto address = static_cast<TargetMemoryAddress>(
+                gdbAddress & ~(gdbTargetDescriptor.getMemoryOffset(memoryType))
+            );
+
+            const auto symbol = SymbolService::symbolAt(memoryType, address);
+            if (!symbol.has_value()) {
+                writeOutput("No symbol found at " + query);
+                return;
+            }
+
+            writeOutput(
+                query + " is in " + symbol->name + " + " + std::to_string(address - symbol->startAddress) + " ("
+                    + toGdbAddressString(*symbol) + ", " + std::to_string(symbol->size) + " bytes)"
+            );
+            return;
+        }
+
+        const auto symbol = SymbolService::symbolByName(query);
+        if (!symbol.has_value()) {
+            writeOutput("Symbol \"" + query + "\" not found");
+            return;
+        }
+
+        writeOutput(
+            symbol->name + " is at " + toGdbAddressString(*symbol) + " (" + std::to_string(symbol->size) + " bytes)"
+        );
+    }
+}
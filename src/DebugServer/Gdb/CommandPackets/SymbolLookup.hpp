@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Monitor.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The SymbolLookup class implements a structure for the "monitor symbol" GDB command.
+     *
+     * "symbol <name>" reports the address and size of the named function or data object. "symbol <address>" (a GDB
+     * address, in hexadecimal: "symbol 0x800105") reports the symbol containing the address, and the offset into it.
+     *
+     * Lookups are performed against the project's ELF file - see SymbolService.
+     */
+    class SymbolLookup: public Monitor
+    {
+    public:
+        explicit SymbolLookup(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -0,0 +1,80 @@
+#include "SymbolQuery.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::OkResponsePacket;
+
+    using Exceptions::Exception;
+
+    SymbolQuery::SymbolQuery(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        auto packetData = this->dataView();
+
+        // "qSymbol:" is 8 characters long
+        if (packetData.size() < 9) {
+            throw Exception("Invalid qSymbol packet");
+        }
+
+        packetData.remove_prefix(8);
+
+        const auto delimiterPosition = packetData.find(':');
+        if (delimiterPosition == std::string_view::npos) {
+            throw Exception("Invalid qSymbol packet - missing delimiter");
+        }
+
+        const auto decodedName = Packet::hexToData(packetData.substr(delimiterPosition + 1));
+        this->symbolName = std::string(decodedName.begin(), decodedName.end());
+
+        if (delimiterPosition > 0) {
+            this->symbolValue = Packet::parseHex<std::uint32_t>(packetData.substr(0, delimiterPosition));
+
+            if (!this->symbolValue.has_value()) {
+                throw Exception("Invalid qSymbol packet - failed to parse symbol value");
+            }
+        }
+    }
+
+    void SymbolQuery::handle(DebugSession& debugSession, TargetControllerService&) {
+        Logger::info("Handling SymbolQuery packet");
+
+        if (!debugSession.rtosThreadAwareness.has_value()) {
+            // We have no symbols to look up
+            debugSession.connection.writePacket(OkResponsePacket());
+            return;
+        }
+
+        auto& rtosThreadAwareness = *(debugSession.rtosThreadAwareness);
+
+        if (this->symbolName.empty()) {
+            rtosThreadAwareness.restartSymbolLookup();
+
+        } else {
+            Logger::debug(
+                "GDB " + std::string(this->symbolValue.has_value() ? "resolved" : "failed to resolve")
+                    + " symbol \"" + this->symbolName + "\""
+            );
+            rtosThreadAwareness.setSymbolAddress(this->symbolName, this->symbolValue);
+        }
+
+        const auto nextSymbolName = rtosThreadAwareness.nextSymbolRequest();
+        if (!nextSymbolName.has_value()) {
+            debugSession.connection.writePacket(OkResponsePacket());
+            return;
+        }
+
+        debugSession.connection.writePacket(
+            ResponsePacket("qSymbol:" + Services::StringService::toHex(*nextSymbolName))
+        );
+    }
+}
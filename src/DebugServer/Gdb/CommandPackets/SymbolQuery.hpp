@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The SymbolQuery class implements a structure for "qSymbol" packets. GDB sends "qSymbol::" to offer to look
+     * up symbols on the server's behalf (upon connecting, and whenever it loads new symbols). The server responds
+     * with the name of a symbol it wants ("qSymbol:<name>"), and GDB replies with another qSymbol packet, carrying
+     * the symbol's value ("qSymbol:<value>:<name>", or "qSymbol::<name>" if GDB doesn't know the symbol). This
+     * continues until the server responds with "OK".
+     *
+     * We use this to obtain the addresses of the FreeRTOS kernel's variables (see FreeRtosThreadAwareness).
+     */
+    class SymbolQuery: public CommandPacket
+    {
+    public:
+        /**
+         * The name of the symbol that GDB has looked up. Empty for the initial "qSymbol::" packet.
+         */
+        std::string symbolName;
+
+        /**
+         * The value of the symbol, or std::nullopt if GDB couldn't find it.
+         */
+        std::optional<std::uint32_t> symbolValue;
+
+        explicit SymbolQuery(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
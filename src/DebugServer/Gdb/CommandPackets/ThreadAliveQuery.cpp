@@ -0,0 +1,56 @@
+#include "ThreadAliveQuery.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/EmptyResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::OkResponsePacket;
+    using ResponsePackets::EmptyResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    ThreadAliveQuery::ThreadAliveQuery(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        const auto packetData = this->dataView();
+        const auto threadId = packetData.size() > 1
+            ? Packet::parseHex<std::uint32_t>(packetData.substr(1))
+            : std::nullopt;
+
+        if (!threadId.has_value()) {
+            throw Exception("Failed to parse thread ID from T packet");
+        }
+
+        this->threadId = *threadId;
+    }
+
+    void ThreadAliveQuery::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling ThreadAliveQuery packet");
+
+        if (!debugSession.rtosThreadAwareness.has_value()) {
+            debugSession.connection.writePacket(EmptyResponsePacket());
+            return;
+        }
+
+        try {
+            if (debugSession.rtosThreadAwareness->findThread(this->threadId, targetControllerService) == nullptr) {
+                debugSession.connection.writePacket(ErrorResponsePacket());
+                return;
+            }
+
+            debugSession.connection.writePacket(OkResponsePacket());
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to check RTOS thread - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The ThreadAliveQuery class implements a structure for "T<id>" packets. In response to these packets, the
+     * server is expected to respond with "OK" if the thread is still alive, or an error response if it isn't.
+     */
+    class ThreadAliveQuery: public CommandPacket
+    {
+    public:
+        std::uint32_t threadId = 0;
+
+        explicit ThreadAliveQuery(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -0,0 +1,74 @@
+#include "ThreadExtraInfoQuery.hpp"
+
+#include <string>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/EmptyResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::EmptyResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    ThreadExtraInfoQuery::ThreadExtraInfoQuery(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        const auto packetData = this->dataView();
+
+        // "qThreadExtraInfo," is 17 characters long
+        const auto threadId = packetData.size() > 17
+            ? Packet::parseHex<std::uint32_t>(packetData.substr(17))
+            : std::nullopt;
+
+        if (!threadId.has_value()) {
+            throw Exception("Failed to parse thread ID from qThreadExtraInfo packet");
+        }
+
+        this->threadId = *threadId;
+    }
+
+    void ThreadExtraInfoQuery::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        using ThreadState = FreeRtosThreadAwareness::ThreadState;
+
+        Logger::info("Handling ThreadExtraInfoQuery packet");
+
+        if (!debugSession.rtosThreadAwareness.has_value()) {
+            debugSession.connection.writePacket(EmptyResponsePacket());
+            return;
+        }
+
+        try {
+            const auto* thread = debugSession.rtosThreadAwareness->findThread(this->threadId, targetControllerService);
+
+            if (thread == nullptr) {
+                throw Exception("Unknown thread ID " + std::to_string(this->threadId));
+            }
+
+            const auto stateName = std::string(
+                thread->state == ThreadState::RUNNING ? "Running"
+                    : thread->state == ThreadState::READY ? "Ready"
+                    : thread->state == ThreadState::BLOCKED ? "Blocked"
+                    : thread->state == ThreadState::SUSPENDED ? "Suspended"
+                    : "Deleted"
+            );
+
+            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+                thread->name + " (" + stateName + ", priority " + std::to_string(thread->priority) + ")"
+            )));
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to describe RTOS thread - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
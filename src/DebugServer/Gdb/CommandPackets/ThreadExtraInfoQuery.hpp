@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The ThreadExtraInfoQuery class implements a structure for "qThreadExtraInfo,<id>" packets. In response to these
+     * packets, the server is expected to send a printable description of the thread, which GDB includes in the
+     * output of its "info threads" command.
+     *
+     * For RTOS threads, we report the task's name, state and priority.
+     */
+    class ThreadExtraInfoQuery: public CommandPacket
+    {
+    public:
+        std::uint32_t threadId = 0;
+
+        explicit ThreadExtraInfoQuery(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -0,0 +1,67 @@
+#include "ThreadListQuery.hpp"
+
+#include <sstream>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/EmptyResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::EmptyResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    ThreadListQuery::ThreadListQuery(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        this->firstBatch = this->dataView().starts_with("qfThreadInfo");
+    }
+
+    void ThreadListQuery::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling ThreadListQuery packet");
+
+        if (!debugSession.rtosThreadAwareness.has_value()) {
+            debugSession.connection.writePacket(EmptyResponsePacket());
+            return;
+        }
+
+        try {
+            const auto& threads = debugSession.rtosThreadAwareness->getThreads(targetControllerService);
+
+            if (threads.empty()) {
+                debugSession.connection.writePacket(EmptyResponsePacket());
+                return;
+            }
+
+            if (!this->firstBatch) {
+                debugSession.connection.writePacket(ResponsePacket(std::string("l")));
+                return;
+            }
+
+            auto output = std::stringstream();
+            output << "m" << std::hex;
+
+            for (auto threadIt = threads.begin(); threadIt != threads.end(); ++threadIt) {
+                if (threadIt != threads.begin()) {
+                    output << ",";
+                }
+
+                output << threadIt->id;
+            }
+
+            debugSession.connection.writePacket(ResponsePacket(output.str()));
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to list RTOS threads - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The ThreadListQuery class implements a structure for "qfThreadInfo" and "qsThreadInfo" packets. In response to
+     * these packets, the server is expected to send the IDs of the threads on the target - the first batch in
+     * response to "qfThreadInfo", and any subsequent batches in response to "qsThreadInfo", until it responds with
+     * "l" (end of list).
+     *
+     * The RTOS thread list is small, so we send the whole list in the first batch.
+     *
+     * If RTOS thread awareness is disabled (or there are no threads), we respond with an empty packet, and GDB will
+     * treat the target as single-threaded.
+     */
+    class ThreadListQuery: public CommandPacket
+    {
+    public:
+        /**
+         * Set for "qfThreadInfo" packets.
+         */
+        bool firstBatch = false;
+
+        explicit ThreadListQuery(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
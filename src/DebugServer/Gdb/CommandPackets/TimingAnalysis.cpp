@@ -0,0 +1,217 @@
+#include "TimingAnalysis.hpp"
+
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+#include <limits>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/TargetController/TimingAnalysis.hpp"
+#include "src/Services/SymbolService.hpp"
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/DebugServer/Gdb/Exceptions/InvalidCommandOption.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+    using Services::SymbolService;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using TargetController::TimingTimerRegister;
+
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+
+    using Bloom::Exceptions::Exception;
+    using Exceptions::InvalidCommandOption;
+
+    TimingAnalysis::TimingAnalysis(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {
+        if (this->command.find("timing start") == 0) {
+            this->action = Action::START;
+
+        } else if (this->command.find("timing status") == 0) {
+            this->action = Action::STATUS;
+
+        } else if (this->command.find("timing stop") == 0) {
+            this->action = Action::STOP;
+        }
+    }
+
+    void TimingAnalysis::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling TimingAnalysis packet");
+
+        try {
+            switch (this->action) {
+                case Action::START: {
+                    this->handleStart(debugSession, targetControllerService);
+                    break;
+                }
+                case Action::STATUS: {
+                    debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+                        targetControllerService.getTimingAnalysisReport().summary()
+                    )));
+                    break;
+                }
+                case Action::STOP: {
+                    debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(
+                        "Timing analysis stopped\n" + targetControllerService.stopTimingAnalysis().summary()
+                    )));
+                    break;
+                }
+                default: {
+                    throw InvalidCommandOption(
+                        "Unknown timing action - use \"timing start\", \"timing status\" or \"timing stop\""
+                    );
+                }
+            }
+
+        } catch (const InvalidCommandOption& exception) {
+            Logger::error(exception.getMessage());
+            debugSession.connection.writePacket(
+                ResponsePacket(Services::StringService::toHex(exception.getMessage() + "\n"))
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to handle timing command - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    void TimingAnalysis::handleStart(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        const auto startAddress = this->resolveProgramAddress(debugSession, "start");
+        const auto endAddress = this->resolveProgramAddress(debugSession, "end");
+
+        if (startAddress == endAddress) {
+            throw InvalidCommandOption("The start and end addresses must differ");
+        }
+
+        auto iterationCount = TimingAnalysis::DEFAULT_ITERATION_COUNT;
+
+        if (const auto iterationsValue = this->getOptionValue("iterations")) {
+            try {
+                const auto parsedCount = std::stoul(*iterationsValue);
+                if (parsedCount == 0 || parsedCount > std::numeric_limits<std::uint32_t>::max()) {
+                    throw std::out_of_range("Iteration count out of range");
+                }
+
+                iterationCount = static_cast<std::uint32_t>(parsedCount);
+
+            } catch (const std::logic_error&) {
+                throw InvalidCommandOption("Invalid iteration count \"" + *iterationsValue + "\"");
+            }
+        }
+
+        auto timerRegister = std::optional<TimingTimerRegister>();
+
+        if (const auto timerValue = this->getOptionValue("timer")) {
+            const auto sizeDelimiterPos = timerValue->find(':');
+            auto gdbAddress = std::uint32_t(0);
+            auto size = TargetMemorySize(1);
+
+            try {
+                gdbAddress = static_cast<std::uint32_t>(
+                    std::stoul(timerValue->substr(0, sizeDelimiterPos), nullptr, 16)
+                );
+
+                if (sizeDelimiterPos != std::string::npos) {
+                    size = static_cast<TargetMemorySize>(std::stoul(timerValue->substr(sizeDelimiterPos + 1)));
+                }
+
+            } catch (const std::logic_error&) {
+                throw InvalidCommandOption("Invalid timer register \"" + *timerValue + "\"");
+            }
+
+            if (size == 0 || size > 8) {
+                throw InvalidCommandOption("Invalid timer register size - must be between 1 and 8 bytes");
+            }
+
+            const auto& gdbTargetDescriptor = debugSession.gdbTargetDescriptor;
+            const auto memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbAddress);
+
+            if (memoryType == TargetMemoryType::FLASH) {
+                throw InvalidCommandOption(
+                    "Invalid timer register address - the timer register must be given as a RAM (data) address"
+                );
+            }
+
+            timerRegister = TimingTimerRegister(
+                memoryType,
+                static_cast<TargetMemoryAddress>(gdbAddress & ~(gdbTargetDescriptor.getMemoryOffset(memoryType))),
+                size
+            );
+        }
+
+        targetControllerService.startTimingAnalysis(startAddress, endAddress, iterationCount, timerRegister);
+
+        auto output = std::stringstream();
+        output << "Timing analysis started, for " << iterationCount << " iteration(s), between 0x" << std::hex
+            << std::setfill('0') << std::setw(6) << startAddress << " and 0x" << std::setw(6) << endAddress << "\n";
+
+        if (!timerRegister.has_value()) {
+            output << "No timer register given - durations will be measured on the host, and will include the "
+                "latency of detecting each halt (typically around 1 ms)\n";
+        }
+
+        output << "Continue execution to collect measurements, then use \"monitor timing status\" to view them\n";
+
+        debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output.str())));
+    }
+
+    TargetMemoryAddress TimingAnalysis::resolveProgramAddress(
+        const DebugSession& debugSession,
+        const std::string& optionName
+    ) const {
+        const auto value = this->getOptionValue(optionName);
+        if (!value.has_value()) {
+            throw InvalidCommandOption(
+                "No " + optionName + " address specified - provide it via the --" + optionName + " option, as a "
+                    "function name or GDB address"
+            );
+        }
+
+        if (value->find("0x") == 0) {
+            auto gdbAddress = std::uint32_t(0);
+
+            try {
+                gdbAddress = static_cast<std::uint32_t>(std::stoul(*value, nullptr, 16));
+
+            } catch (const std::logic_error&) {
+                throw InvalidCommandOption("Invalid " + optionName + " address \"" + *value + "\"");
+            }
+
+            const auto& gdbTargetDescriptor = debugSession.gdbTargetDescriptor;
+            if (gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbAddress) != TargetMemoryType::FLASH) {
+                throw InvalidCommandOption("The " + optionName + " address must be a program memory address");
+            }
+
+            return static_cast<TargetMemoryAddress>(gdbAddress);
+        }
+
+        if (SymbolService::symbolTable() == nullptr) {
+            throw InvalidCommandOption(
+                "Cannot resolve symbol \"" + *value + "\" - set the \"elfFile\" parameter in your project config"
+            );
+        }
+
+        const auto symbol = SymbolService::symbolByName(*value);
+        if (!symbol.has_value()) {
+            throw InvalidCommandOption("Symbol \"" + *value + "\" not found");
+        }
+
+        if (symbol->memoryType != TargetMemoryType::FLASH) {
+            throw InvalidCommandOption("Symbol \"" + *value + "\" is not in program memory");
+        }
+
+        return symbol->startAddress;
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+
+#include "Monitor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The TimingAnalysis class implements a structure for the "monitor timing start", "monitor timing status" and
+     * "monitor timing stop" GDB commands.
+     *
+     * "timing start" instructs the TargetController to measure the time taken for execution to get from one program
+     * memory address to another (an ISR's entry and exit, for example), over a number of iterations. The addresses
+     * are given via the --start and --end options, as function names or GDB addresses. The number of iterations is
+     * given via the --iterations option.
+     *
+     * The TargetController timestamps each interval on the host, which includes the latency of detecting the halt.
+     * For tick-accurate measurements, a free-running target timer register can be given via the --timer option, as
+     * a GDB address with an optional size: "--timer=0x800084:2" (TCNT1, on most ATmega targets).
+     *
+     * "timing status" reports the results collected so far. "timing stop" ends the analysis and reports the results.
+     */
+    class TimingAnalysis: public Monitor
+    {
+    public:
+        static constexpr std::uint32_t DEFAULT_ITERATION_COUNT = 100;
+
+        enum class Action: std::uint8_t
+        {
+            NONE,
+            START,
+            STATUS,
+            STOP,
+        };
+
+        Action action = Action::NONE;
+
+        explicit TimingAnalysis(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        void handleStart(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Resolves a function name or GDB address (given via the option of the given name) to a program memory
+         * address.
+         *
+         * @param debugSession
+         * @param optionName
+         *
+         * @return
+         */
+        Targets::TargetMemoryAddress resolveProgramAddress(
+            const DebugSession& debugSession,
+            const std::string& optionName
+        ) const;
+    };
+}
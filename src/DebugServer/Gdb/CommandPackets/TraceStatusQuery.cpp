@@ -0,0 +1,70 @@
+#include "TraceStatusQuery.hpp"
+
+#include <sstream>
+#include <algorithm>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/TargetController/Tracepoint.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using TargetController::TraceStopReason;
+
+    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    TraceStatusQuery::TraceStatusQuery(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {}
+
+    void TraceStatusQuery::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling TraceStatusQuery packet");
+
+        try {
+            const auto status = targetControllerService.getTraceStatus();
+
+            auto output = std::stringstream();
+            output << std::hex << "T" << (status->running ? "1" : "0") << ";";
+
+            switch (status->stopReason) {
+                case TraceStopReason::NOT_RUN: {
+                    output << "tnotrun:0";
+                    break;
+                }
+                case TraceStopReason::STOPPED: {
+                    output << "tstop:0";
+                    break;
+                }
+                case TraceStopReason::BUFFER_FULL: {
+                    output << "tfull:0";
+                    break;
+                }
+                case TraceStopReason::PASS_COUNT: {
+                    output << "tpasscount:" << status->stopTracepointNumber;
+                    break;
+                }
+            }
+
+            output << ";tframes:" << status->frameCount;
+            output << ";tcreated:" << status->frameCount;
+            output << ";tfree:" << (status->bufferSize - std::min(status->bufferUsed, status->bufferSize));
+            output << ";tsize:" << status->bufferSize;
+            output << ";circular:0;disconn:0";
+
+            debugSession.connection.writePacket(ResponsePacket(output.str()));
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to retrieve trace status - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
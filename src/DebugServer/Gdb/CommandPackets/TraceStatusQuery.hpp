@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The TraceStatusQuery class implements a structure for "qTStatus" packets. Upon receiving this packet, the
+     * server is expected to respond with the status of the current (or last) trace experiment, in the form of
+     * "T<running>;<stop-reason>;tframes:<n>;tcreated:<n>;tfree:<n>;tsize:<n>;circular:0;disconn:0".
+     *
+     * GDB sends this packet upon connecting, as well as for the "tstatus" command.
+     */
+    class TraceStatusQuery: public CommandPacket
+    {
+    public:
+        explicit TraceStatusQuery(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -0,0 +1,145 @@
+#include "VContExecution.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/TargetStopped.hpp"
+#include "src/DebugServer/Gdb/Signal.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::OkResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    VContExecution::VContExecution(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        auto packetData = this->dataView();
+
+        // Skip the "vCont;" prefix
+        if (packetData.size() < 7) {
+            throw Exception("Invalid vCont packet - no actions");
+        }
+
+        packetData.remove_prefix(6);
+
+        // We only care about the first action. Strip the others, along with any thread ID.
+        auto action = packetData.substr(0, packetData.find(';'));
+        action = action.substr(0, action.find(':'));
+
+        switch (action[0]) {
+            case 'c':
+            case 'C': {
+                this->actionType = ActionType::CONTINUE;
+                break;
+            }
+            case 's':
+            case 'S': {
+                this->actionType = ActionType::STEP;
+                break;
+            }
+            case 't': {
+                this->actionType = ActionType::STOP;
+                break;
+            }
+            case 'r': {
+                const auto delimiterPosition = action.find(',');
+
+                if (delimiterPosition == std::string_view::npos) {
+                    throw Exception("Invalid vCont range step action - missing delimiter");
+                }
+
+                const auto startAddress = Packet::parseHex<Targets::TargetMemoryAddress>(
+                    action.substr(1, delimiterPosition - 1)
+                );
+                const auto endAddress = Packet::parseHex<Targets::TargetMemoryAddress>(
+                    action.substr(delimiterPosition + 1)
+                );
+
+                if (!startAddress.has_value() || !endAddress.has_value()) {
+                    throw Exception("Failed to parse vCont range step addresses");
+                }
+
+                this->actionType = ActionType::RANGE_STEP;
+
+                /*
+                 * If the range is empty, GDB expects us to behave as if we received a step action (the GDB
+                 * documentation says as much).
+                 */
+                if (*endAddress > *startAddress) {
+                    this->stepRange = Targets::TargetMemoryAddressRange(*startAddress, *endAddress - 1);
+                }
+
+                break;
+            }
+            default: {
+                throw Exception("Unsupported vCont action");
+            }
+        }
+    }
+
+    void VContExecution::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling VContExecution packet");
+
+        try {
+            if (this->actionType == ActionType::STOP) {
+                this->handleStopAction(debugSession, targetControllerService);
+                return;
+            }
+
+            if (this->actionType == ActionType::CONTINUE) {
+                targetControllerService.continueTargetExecution(std::nullopt, std::nullopt);
+
+            } else {
+                targetControllerService.stepTargetExecution(std::nullopt, this->stepRange);
+            }
+
+            debugSession.waitingForBreak = true;
+            debugSession.steppingExecution = this->actionType != ActionType::CONTINUE;
+
+            if (debugSession.nonStopMode) {
+                // The stop will be reported via a notification
+                debugSession.connection.writePacket(OkResponsePacket());
+            }
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to resume execution on target - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+
+    void VContExecution::handleStopAction(
+        DebugSession& debugSession,
+        TargetControllerService& targetControllerService
+    ) {
+        /*
+         * The stop action is only relevant in non-stop mode. GDB expects an "OK" response, followed by a stop
+         * notification with signal 0 - unless the target was already stopped, in which case there's nothing to
+         * report.
+         */
+        if (!debugSession.nonStopMode) {
+            debugSession.connection.writePacket(OkResponsePacket());
+            return;
+        }
+
+        const auto alreadyStopped = targetControllerService.getTargetState() == Targets::TargetState::STOPPED;
+
+        if (!alreadyStopped) {
+            targetControllerService.stopTargetExecution();
+        }
+
+        debugSession.connection.writePacket(OkResponsePacket());
+
+        if (!alreadyStopped) {
+            // We report the stop here, so that it's reported with the correct signal
+            debugSession.waitingForBreak = false;
+            debugSession.reportTargetStopped(ResponsePackets::TargetStopped(Signal::NONE), targetControllerService);
+        }
+    }
+}
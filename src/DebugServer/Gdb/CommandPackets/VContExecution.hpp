@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "CommandPacket.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The VContExecution class implements the structure for "vCont;..." packets. These packets carry a list of
+     * actions (continue, step or range step), each of which applies to a set of threads. We only have one thread, so
+     * only the first action is of any relevance to us.
+     *
+     * The range step action ("r<start>,<end>") allows GDB to step over an entire source line with a single packet.
+     * The TargetController keeps stepping until the program counter leaves the range, so we only respond to GDB
+     * when stepping has finished. If the project's ELF file is available, the TargetController also steps over any
+     * calls into code without line information (library routines, for example), which saves GDB from having to do
+     * it with a series of further packets.
+     *
+     * The stop action ("t") is used by GDB in non-stop mode, to interrupt target execution.
+     */
+    class VContExecution: public CommandPacket
+    {
+    public:
+        enum class ActionType: std::uint8_t
+        {
+            CONTINUE,
+            STEP,
+            RANGE_STEP,
+            STOP,
+        };
+
+        ActionType actionType = ActionType::CONTINUE;
+
+        /**
+         * The address range for range steps. The end address is inclusive (GDB's end address is exclusive - we
+         * convert it at construction).
+         */
+        std::optional<Targets::TargetMemoryAddressRange> stepRange;
+
+        explicit VContExecution(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        void handleStopAction(DebugSession& debugSession, Services::TargetControllerService& targetControllerService);
+    };
+}
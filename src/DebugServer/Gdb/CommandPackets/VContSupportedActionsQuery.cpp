@@ -0,0 +1,28 @@
+#include "VContSupportedActionsQuery.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ResponsePacket;
+
+    VContSupportedActionsQuery::VContSupportedActionsQuery(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {}
+
+    void VContSupportedActionsQuery::handle(DebugSession& debugSession, TargetControllerService&) {
+        Logger::info("Handling VContSupportedActionsQuery packet");
+
+        /*
+         * We don't do anything with signals, so the 'C' and 'S' actions are treated as 'c' and 's' respectively.
+         * GDB requires support for all four before it will make use of vCont.
+         *
+         * The 't' (stop) action is used in non-stop mode.
+         */
+        debugSession.connection.writePacket(ResponsePacket(std::string("vCont;c;C;s;S;t;r")));
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The VContSupportedActionsQuery class implements the structure for "vCont?" packets. Upon receiving this
+     * packet, the server is expected to respond with the vCont actions that it supports.
+     */
+    class VContSupportedActionsQuery: public CommandPacket
+    {
+    public:
+        explicit VContSupportedActionsQuery(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -26,19 +26,22 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
         : CommandPacket(rawPacket)
     {
         // The P packet updates a single register
-        auto packet = std::string(this->data.begin(), this->data.end());
+        const auto packet = this->dataView();
 
         if (packet.size() < 4) {
             throw Exception("Invalid P command packet - insufficient data in packet.");
         }
 
-        if (packet.find('=') == std::string::npos) {
+        const auto delimiterPosition = packet.find('=');
+
+        if (delimiterPosition == std::string_view::npos) {
             throw Exception("Invalid P command packet - unexpected format");
         }
 
-        auto packetSegments = QString::fromStdString(packet).split("=");
-        this->registerNumber = static_cast<int>(packetSegments.front().mid(1).toUInt(nullptr, 16));
-        this->registerValue = Packet::hexToData(packetSegments.back().toStdString());
+        this->registerNumber = Packet::parseHex<GdbRegisterNumber>(
+            packet.substr(1, delimiterPosition - 1)
+        ).value_or(0);
+        this->registerValue = Packet::hexToData(packet.substr(delimiterPosition + 1));
         std::reverse(this->registerValue.begin(), this->registerValue.end());
     }
 
@@ -46,6 +49,13 @@ namespace Bloom::DebugServer::Gdb::CommandPackets
         Logger::info("Handling WriteRegister packet");
 
         try {
+            if (
+                debugSession.rtosThreadAwareness.has_value()
+                && debugSession.rtosThreadAwareness->isSuspendedThreadSelected(targetControllerService)
+            ) {
+                throw Exception("Cannot write registers of an RTOS thread that isn't running");
+            }
+
             auto targetRegisterDescriptor = debugSession.gdbTargetDescriptor.getTargetRegisterDescriptorFromNumber(
                 this->registerNumber
             );
@@ -1,6 +1,9 @@
 #include "Connection.hpp"
 
 #include <arpa/inet.h>
+#include <sys/uio.h>
+#include <poll.h>
+#include <climits>
 #include <unistd.h>
 #include <cerrno>
 #include <fcntl.h>
@@ -14,6 +17,7 @@
 
 #include "src/Logger/Logger.hpp"
 #include "src/Services/StringService.hpp"
+#include "src/Services/TraceService.hpp"
 
 namespace Bloom::DebugServer::Gdb
 {
@@ -22,8 +26,14 @@ namespace Bloom::DebugServer::Gdb
 
     using ResponsePackets::ResponsePacket;
 
-    Connection::Connection(int serverSocketFileDescriptor, EventFdNotifier& interruptEventNotifier)
+    Connection::Connection(
+        int serverSocketFileDescriptor,
+        EventFdNotifier& interruptEventNotifier,
+        std::size_t maximumPacketSize
+    )
         : interruptEventNotifier(interruptEventNotifier)
+        , packetParser(RawPacketParser(maximumPacketSize))
+        , readBuffer(std::min(maximumPacketSize, static_cast<std::size_t>(Connection::READ_BUFFER_SIZE)), 0x00)
     {
         this->accept(serverSocketFileDescriptor);
 
@@ -44,103 +54,109 @@ namespace Bloom::DebugServer::Gdb
         this->close();
     }
 
-    std::string Connection::getIpAddress() const {
+    std::string Connection::getClientAddress() const {
+        if (this->socketAddress.ss_family == AF_UNIX) {
+            return "Unix domain socket";
+        }
+
+        const auto& inetSocketAddress = reinterpret_cast<const sockaddr_in&>(this->socketAddress);
         std::array<char, INET_ADDRSTRLEN> ipAddress = {};
 
-        if (::inet_ntop(AF_INET, &(socketAddress.sin_addr), ipAddress.data(), INET_ADDRSTRLEN) == nullptr) {
+        if (::inet_ntop(AF_INET, &(inetSocketAddress.sin_addr), ipAddress.data(), INET_ADDRSTRLEN) == nullptr) {
             throw Exception("Failed to convert client IP address to text form.");
         }
 
         return std::string(ipAddress.data());
     }
 
+    void Connection::setWakeupNotifier(EventFdNotifier& wakeupNotifier) {
+        if (this->wakeupNotifier != nullptr) {
+            if (this->readInterruptEnabled) {
+                this->epollInstance.removeEntry(this->wakeupNotifier->getFileDescriptor());
+            }
+        }
+
+        this->wakeupNotifier = &wakeupNotifier;
+
+        if (this->readInterruptEnabled) {
+            this->epollInstance.addEntry(
+                this->wakeupNotifier->getFileDescriptor(),
+                static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
+            );
+        }
+    }
+
     std::vector<RawPacket> Connection::readRawPackets() {
         std::vector<RawPacket> output;
 
-        do {
-            const auto bytes = this->read();
+        if (this->wakeupPending) {
+            // The wakeup arrived alongside data from the client, in a previous read
+            this->wakeupPending = false;
+            return output;
+        }
 
-            std::size_t bufferSize = bytes.size();
-            for (std::size_t byteIndex = 0; byteIndex < bufferSize; byteIndex++) {
-                auto byte = bytes[byteIndex];
+        do {
+            const auto bytesRead = this->read(this->readBuffer.data(), this->readBuffer.size());
 
-                if (byte == 0x03) {
+            if (bytesRead == 0) {
+                if (this->wakeupPending) {
                     /*
-                     * This is an interrupt packet - it doesn't carry any of the usual packet frame bytes, so we'll
-                     * just add them here, in order to keep things consistent.
-                     *
-                     * Because we're effectively faking the packet frame, we can use any value for the checksum.
+                     * Any partially received packet is retained by the parser, so we can return without waiting for
+                     * the rest of it.
                      */
-                    output.push_back({'$', byte, '#', 'F', 'F'});
-                    continue;
+                    this->wakeupPending = false;
+                    break;
+                }
+
+                continue;
+            }
+
+            // We don't trace the wait for data, as that's just the client being idle
+            const auto traceSpan = Services::TraceService::Span("Connection::readRawPackets", "DebugServer");
+            const auto readTime = std::chrono::steady_clock::now();
+
+            auto parseResult = this->packetParser.parse(this->readBuffer.data(), bytesRead);
+
+            if (this->acknowledgementsEnabled) {
+                for (std::size_t i = 0; i < parseResult.invalidPacketCount; ++i) {
+                    // Request retransmission
+                    this->queueWrite({'-'});
                 }
+            }
 
-                if (byte == '$') {
-                    // Beginning of packet
-                    RawPacket rawPacket;
-                    rawPacket.push_back('$');
-
-                    auto packetIndex = byteIndex;
-                    bool validPacket = false;
-                    bool isByteEscaped = false;
-
-                    for (packetIndex++; packetIndex < bufferSize; packetIndex++) {
-                        byte = bytes[packetIndex];
-
-                        if (byte == '}' && !isByteEscaped) {
-                            isByteEscaped = true;
-                            continue;
-                        }
-
-                        if (!isByteEscaped) {
-                            if (byte == '$') {
-                                // Unexpected end of packet
-                                break;
-                            }
-
-                            if (byte == '#') {
-                                // End of packet data
-                                if ((bufferSize - 1) < (packetIndex + 2)) {
-                                    // There should be at least two more bytes in the buffer, for the checksum.
-                                    break;
-                                }
-
-                                rawPacket.push_back(byte);
-
-                                // Add the checksum bytes and break the loop
-                                rawPacket.push_back(bytes[++packetIndex]);
-                                rawPacket.push_back(bytes[++packetIndex]);
-                                validPacket = true;
-                                break;
-                            }
-
-                        } else {
-                            // Escaped bytes are XOR'd with a 0x20 mask.
-                            byte ^= 0x20;
-                            isByteEscaped = false;
-                        }
-
-                        rawPacket.push_back(byte);
-                    }
-
-                    if (!validPacket) {
-                        Logger::warning("GDB client sent invalid packet data - ignoring");
-                        continue;
-                    }
+            for (auto& rawPacket : parseResult.packets) {
+                if (this->packetCapture != nullptr) {
+                    this->packetCapture->record(PacketDirection::FROM_CLIENT, rawPacket, readTime);
+                }
 
+                if (Logger::isDebugLoggingEnabled()) {
                     Logger::debug(
-                        "Read GDB packet: "
-                            + Services::StringService::replaceUnprintable(
-                                std::string(rawPacket.begin(), rawPacket.end())
-                            )
+                        "Read GDB packet: ",
+                        Services::StringService::replaceUnprintable(std::string(rawPacket.begin(), rawPacket.end()))
                     );
+                }
 
-                    // Acknowledge receipt
-                    this->write({'+'});
-
-                    output.emplace_back(std::move(rawPacket));
-                    byteIndex = packetIndex;
+                if (this->acknowledgementsEnabled) {
+                    // Acknowledge receipt - see below
+                    this->queueWrite({'+'});
                 }
+
+                output.emplace_back(std::move(rawPacket));
+            }
+
+            if (this->acknowledgementsEnabled && (!parseResult.packets.empty() || parseResult.invalidPacketCount > 0)) {
+                /*
+                 * The acknowledgements for the packets received in this read are sent together, before any of the
+                 * packets are handled. We must never hold an acknowledgement across the handling of a command - a
+                 * slow command (program memory erasure, for example) could exceed GDB's timeout, resulting in GDB
+                 * retransmitting the packet, and the command being executed twice.
+                 */
+                this->flush();
+            }
+
+            if (this->wakeupPending && output.empty()) {
+                this->wakeupPending = false;
+                break;
             }
 
         } while (output.empty());
@@ -149,11 +165,29 @@ namespace Bloom::DebugServer::Gdb
     }
 
     void Connection::writePacket(const ResponsePacket& packet) {
+        const auto traceSpan = Services::TraceService::Span("Connection::writePacket", "DebugServer");
+
         // Write the packet repeatedly until the GDB client acknowledges it.
         int attempts = 0;
-        const auto rawPacket = packet.toRawPacket();
+        auto rawPacket = packet.toRawPacket();
+
+        if (this->packetCapture != nullptr) {
+            this->packetCapture->record(PacketDirection::TO_CLIENT, rawPacket);
+        }
+
+        Logger::debug(
+            "Writing GDB packet: ",
+            std::string_view(reinterpret_cast<const char*>(rawPacket.data()), rawPacket.size())
+        );
 
-        Logger::debug("Writing GDB packet: " + std::string(rawPacket.begin(), rawPacket.end()));
+        if (!this->acknowledgementsEnabled) {
+            /*
+             * The client will not acknowledge the packet, so there is no need to wait around. The packet will be
+             * flushed before we next wait for incoming data, along with any other packets written in the meantime.
+             */
+            this->queueWrite(std::move(rawPacket));
+            return;
+        }
 
         do {
             if (attempts > 10) {
@@ -162,11 +196,41 @@ namespace Bloom::DebugServer::Gdb
                 );
             }
 
-            this->write(rawPacket);
+            this->queueWrite(RawPacket(rawPacket));
+            this->flush();
             attempts++;
         } while (this->readSingleByte(false).value_or(0) != '+');
     }
 
+    void Connection::writeNotification(const std::string& name, const ResponsePacket& packet) {
+        auto notificationData = std::vector<unsigned char>(name.begin(), name.end());
+        notificationData.push_back(':');
+
+        const auto& packetData = packet.getData();
+        notificationData.insert(notificationData.end(), packetData.begin(), packetData.end());
+
+        // Notifications are framed like packets, but with a '%' in place of the '$'
+        auto rawPacket = ResponsePacket(std::move(notificationData)).toRawPacket();
+        rawPacket.front() = '%';
+
+        if (this->packetCapture != nullptr) {
+            this->packetCapture->record(PacketDirection::TO_CLIENT, rawPacket);
+        }
+
+        Logger::debug(
+            "Writing GDB notification: ",
+            std::string_view(reinterpret_cast<const char*>(rawPacket.data()), rawPacket.size())
+        );
+
+        this->queueWrite(std::move(rawPacket));
+        this->flush();
+    }
+
+    void Connection::writeConsoleOutput(const std::string& output) {
+        this->writePacket(ResponsePacket("O" + Services::StringService::toHex(output)));
+        this->flush();
+    }
+
     void Connection::accept(int serverSocketFileDescriptor) {
         int socketAddressLength = sizeof(this->socketAddress);
 
@@ -185,18 +249,24 @@ namespace Bloom::DebugServer::Gdb
 
     void Connection::close() noexcept {
         if (this->socketFileDescriptor.value_or(-1) >= 0) {
+            try {
+                this->flush();
+
+            } catch (const Exception& exception) {
+                Logger::debug("Failed to flush output before closing GDB connection - " + exception.getMessage());
+            }
+
             ::close(this->socketFileDescriptor.value());
             this->socketFileDescriptor = std::nullopt;
         }
     }
 
-    std::vector<unsigned char> Connection::read(
-        std::optional<std::size_t> bytes,
+    std::size_t Connection::read(
+        unsigned char* buffer,
+        std::size_t bytes,
         bool interruptible,
         std::optional<std::chrono::milliseconds> timeout
     ) {
-        auto output = std::vector<unsigned char>();
-
         if (this->readInterruptEnabled != interruptible) {
             if (interruptible) {
                 this->enableReadInterrupts();
@@ -206,32 +276,70 @@ namespace Bloom::DebugServer::Gdb
             }
         }
 
-        // Clear any previous interrupts that are still hanging around
-        this->interruptEventNotifier.clear();
+        // Any queued output must reach the client before we wait for it to send us anything
+        this->flush();
 
-        const auto eventFileDescriptor = this->epollInstance.waitForEvent(timeout);
+        /*
+         * We don't clear the interrupt event notifier here, as it could be carrying a notification for events that
+         * have yet to be dispatched. The EventListener will not notify again until those events have been taken, so
+         * clearing the notifier would mean missing every event until the client sends something. At worst, a
+         * notification for events that have already been dispatched will cause one spurious interruption.
+         */
 
-        if (!eventFileDescriptor.has_value()) {
+        /*
+         * We collect the events for all monitored files (the socket, the interrupt notifier and the wakeup notifier)
+         * in one go, so that data from the client and a wakeup that arrive together can be handled together.
+         */
+        auto events = std::array<struct ::epoll_event, 3>();
+        const auto eventCount = this->epollInstance.waitForEvents(events, timeout);
+
+        if (eventCount == 0) {
             // Timed out
-            return output;
+            return 0;
+        }
+
+        auto interrupted = false;
+        auto socketReadable = false;
+
+        for (auto eventIndex = std::size_t(0); eventIndex < eventCount; ++eventIndex) {
+            const auto eventFileDescriptor = events[eventIndex].data.fd;
+
+            if (eventFileDescriptor == this->interruptEventNotifier.getFileDescriptor()) {
+                interrupted = true;
+                continue;
+            }
+
+            if (this->wakeupNotifier != nullptr && eventFileDescriptor == this->wakeupNotifier->getFileDescriptor()) {
+                // The caller is responsible for servicing whatever signalled the wakeup notifier
+                this->wakeupNotifier->clear();
+                this->wakeupPending = true;
+                continue;
+            }
+
+            socketReadable = true;
         }
 
-        if (eventFileDescriptor.value() == this->interruptEventNotifier.getFileDescriptor()) {
-            // Interrupted
+        if (interrupted) {
             this->interruptEventNotifier.clear();
             throw DebugServerInterrupted();
         }
 
-        const auto bytesToRead = bytes.value_or(Connection::ABSOLUTE_MAXIMUM_PACKET_READ_SIZE);
-        output.resize(bytesToRead, 0x00);
+        if (!socketReadable) {
+            return 0;
+        }
 
         const auto bytesRead = ::read(
             this->socketFileDescriptor.value(),
-            output.data(),
-            bytesToRead
+            buffer,
+            bytes
         );
 
         if (bytesRead < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                // Spurious wakeup - nothing to read
+                return 0;
+            }
+
             throw ClientCommunicationError(
                 "Failed to read data from GDB client - error code: " + std::to_string(errno)
             );
@@ -242,40 +350,137 @@ namespace Bloom::DebugServer::Gdb
             throw ClientDisconnected();
         }
 
-        if (bytesRead != output.size()) {
-            output.resize(static_cast<unsigned long>(std::max(ssize_t{0}, bytesRead)));
-        }
-
-        return output;
+        return static_cast<std::size_t>(bytesRead);
     }
 
     std::optional<unsigned char> Connection::readSingleByte(bool interruptible) {
-        auto bytes = this->read(1, interruptible, std::chrono::milliseconds(300));
+        auto byte = static_cast<unsigned char>(0x00);
 
-        if (!bytes.empty()) {
-            return bytes.front();
+        if (this->read(&byte, 1, interruptible, std::chrono::milliseconds(300)) > 0) {
+            return byte;
         }
 
         return std::nullopt;
     }
 
-    void Connection::write(const std::vector<unsigned char>& buffer) {
-        if (::write(this->socketFileDescriptor.value(), buffer.data(), buffer.size()) == -1) {
-            if (errno == EPIPE || errno == ECONNRESET) {
-                // Connection was closed
-                throw ClientDisconnected();
+    void Connection::queueWrite(std::vector<unsigned char>&& buffer) {
+        if (!buffer.empty()) {
+            this->outputQueue.emplace_back(std::move(buffer));
+        }
+    }
+
+    void Connection::flush() {
+        if (this->outputQueue.empty() || !this->socketFileDescriptor.has_value()) {
+            return;
+        }
+
+        auto ioVectors = std::vector<::iovec>();
+        ioVectors.reserve(std::min(this->outputQueue.size(), static_cast<std::size_t>(IOV_MAX)));
+
+        // Index of the next buffer to write, and the number of bytes from that buffer that have already been written
+        std::size_t bufferIndex = 0;
+        std::size_t bufferOffset = 0;
+
+        while (bufferIndex < this->outputQueue.size()) {
+            ioVectors.clear();
+
+            for (
+                auto i = bufferIndex;
+                i < this->outputQueue.size() && ioVectors.size() < static_cast<std::size_t>(IOV_MAX);
+                ++i
+            ) {
+                auto& buffer = this->outputQueue[i];
+                const auto offset = (i == bufferIndex) ? bufferOffset : 0;
+
+                ioVectors.push_back(::iovec{
+                    .iov_base = buffer.data() + offset,
+                    .iov_len = buffer.size() - offset,
+                });
+            }
+
+            const auto bytesWritten = ::writev(
+                this->socketFileDescriptor.value(),
+                ioVectors.data(),
+                static_cast<int>(ioVectors.size())
+            );
+
+            if (bytesWritten < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    // The socket's send buffer is full - wait for the client to catch up
+                    this->waitForWritable(std::chrono::milliseconds(5000));
+                    continue;
+                }
+
+                this->outputQueue.clear();
+
+                if (errno == EPIPE || errno == ECONNRESET) {
+                    // Connection was closed
+                    throw ClientDisconnected();
+                }
+
+                throw ClientCommunicationError(
+                    "Failed to write to GDP client socket - error no: " + std::to_string(errno)
+                );
+            }
+
+            // Account for partial writes
+            auto remainingBytes = static_cast<std::size_t>(bytesWritten);
+
+            while (remainingBytes > 0 && bufferIndex < this->outputQueue.size()) {
+                const auto bufferBytes = this->outputQueue[bufferIndex].size() - bufferOffset;
+
+                if (remainingBytes < bufferBytes) {
+                    bufferOffset += remainingBytes;
+                    break;
+                }
+
+                remainingBytes -= bufferBytes;
+                bufferOffset = 0;
+                ++bufferIndex;
             }
+        }
 
+        this->outputQueue.clear();
+    }
+
+    void Connection::waitForWritable(std::chrono::milliseconds timeout) {
+        auto pollDescriptor = ::pollfd{
+            .fd = this->socketFileDescriptor.value(),
+            .events = POLLOUT,
+            .revents = 0,
+        };
+
+        const auto result = ::poll(&pollDescriptor, 1, static_cast<int>(timeout.count()));
+
+        if (result == 0) {
+            this->outputQueue.clear();
+            throw ClientCommunicationError("Timed out waiting for GDB client to accept data");
+        }
+
+        if (result < 0 && errno != EINTR) {
+            this->outputQueue.clear();
             throw ClientCommunicationError(
-                "Failed to write " + std::to_string(buffer.size()) + " bytes to GDP client socket - error no: "
-                    + std::to_string(errno)
+                "Failed to poll GDB client socket - error no: " + std::to_string(errno)
             );
         }
+
+        if ((pollDescriptor.revents & (POLLERR | POLLHUP)) != 0) {
+            this->outputQueue.clear();
+            throw ClientDisconnected();
+        }
     }
 
     void Connection::disableReadInterrupts() {
         this->epollInstance.removeEntry(this->interruptEventNotifier.getFileDescriptor());
 
+        if (this->wakeupNotifier != nullptr) {
+            this->epollInstance.removeEntry(this->wakeupNotifier->getFileDescriptor());
+        }
+
         this->readInterruptEnabled = false;
     }
 
@@ -285,6 +490,13 @@ namespace Bloom::DebugServer::Gdb
             static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
         );
 
+        if (this->wakeupNotifier != nullptr) {
+            this->epollInstance.addEntry(
+                this->wakeupNotifier->getFileDescriptor(),
+                static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
+            );
+        }
+
         this->readInterruptEnabled = true;
     }
 }
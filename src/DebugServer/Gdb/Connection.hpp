@@ -14,6 +14,8 @@
 #include "src/Helpers/EpollInstance.hpp"
 
 #include "src/DebugServer/Gdb/Packet.hpp"
+#include "src/DebugServer/Gdb/RawPacketParser.hpp"
+#include "src/DebugServer/Gdb/PacketCapture.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
 
 namespace Bloom::DebugServer::Gdb
@@ -24,14 +26,24 @@ namespace Bloom::DebugServer::Gdb
     class Connection
     {
     public:
-        /*
-         * GDB should never attempt to send more than this in a single instance.
-         *
-         * In the event that it does, we assume the worst and kill the connection.
+        /**
+         * The maximum number of bytes to read from the socket in a single read() call. Packets larger than this will
+         * be received over numerous reads.
          */
-        static constexpr auto ABSOLUTE_MAXIMUM_PACKET_READ_SIZE = 2097000; // 2MiB
+        static constexpr auto READ_BUFFER_SIZE = 65536;
 
-        explicit Connection(int serverSocketFileDescriptor, EventFdNotifier& interruptEventNotifier);
+        /**
+         * @param serverSocketFileDescriptor
+         * @param interruptEventNotifier
+         * @param maximumPacketSize
+         *  The packet size advertised to the client (see GdbDebugServerConfig::packetSize). The client should never
+         *  send a packet larger than this. In the event that it does, we assume the worst and kill the connection.
+         */
+        explicit Connection(
+            int serverSocketFileDescriptor,
+            EventFdNotifier& interruptEventNotifier,
+            std::size_t maximumPacketSize
+        );
 
         Connection() = delete;
         Connection(const Connection&) = delete;
@@ -46,7 +58,14 @@ namespace Bloom::DebugServer::Gdb
             : interruptEventNotifier(other.interruptEventNotifier)
             , socketFileDescriptor(other.socketFileDescriptor)
             , epollInstance(std::move(other.epollInstance))
+            , wakeupNotifier(other.wakeupNotifier)
+            , wakeupPending(other.wakeupPending)
+            , packetCapture(other.packetCapture)
             , readInterruptEnabled(other.readInterruptEnabled)
+            , acknowledgementsEnabled(other.acknowledgementsEnabled)
+            , packetParser(std::move(other.packetParser))
+            , readBuffer(std::move(other.readBuffer))
+            , outputQueue(std::move(other.outputQueue))
         {
             other.socketFileDescriptor = std::nullopt;
         }
@@ -54,19 +73,74 @@ namespace Bloom::DebugServer::Gdb
         ~Connection();
 
         /**
-         * Obtains the human readable IP address of the connected client.
+         * Obtains the human readable address of the connected client - the client's IP address, or "Unix domain
+         * socket" for clients connected via a Unix domain socket (which have no meaningful address).
          *
          * @return
          */
-        [[nodiscard]] std::string getIpAddress() const;
+        [[nodiscard]] std::string getClientAddress() const;
+
+        /**
+         * Returns the file descriptor of the client socket, for monitoring the socket in an EventLoop (see
+         * ObserverServer). The socket must not be read from (or written to) directly.
+         *
+         * @return
+         */
+        [[nodiscard]] int getFileDescriptor() const {
+            return this->socketFileDescriptor.value();
+        }
+
+        /**
+         * Sets the wakeup notifier for this connection.
+         *
+         * The wakeup notifier is monitored alongside the client socket, whenever we wait for incoming data from the
+         * client. When the notifier is signalled, Connection::readRawPackets() will return without any packets,
+         * allowing the caller to service whatever the notifier represents (typically target execution events), before
+         * resuming the wait.
+         *
+         * Unlike interrupts (via the interruptEventNotifier), wakeups do not result in a DebugServerInterrupted
+         * exception.
+         *
+         * @param wakeupNotifier
+         */
+        void setWakeupNotifier(EventFdNotifier& wakeupNotifier);
+
+        /**
+         * Sets the packet capture for this connection. All packets received from and sent to the client will be
+         * recorded to the capture.
+         *
+         * @param packetCapture
+         *  The capture must outlive the connection. Pass nullptr to stop recording.
+         */
+        void setPacketCapture(PacketCapture* packetCapture) {
+            this->packetCapture = packetCapture;
+        }
 
         /**
          * Waits for incoming data from the client and returns the raw GDB packets.
          *
+         * Packets that are split across numerous reads are reassembled by this->packetParser. This function will
+         * not return until at least one complete packet has been received, or the wakeup notifier has been signalled
+         * (see Connection::setWakeupNotifier()), in which case an empty vector will be returned. If the wakeup
+         * arrives alongside a complete packet, the packet is returned, and the next call will return an empty vector
+         * without waiting.
+         *
          * @return
          */
         std::vector<RawPacket> readRawPackets();
 
+        /**
+         * Returns raw packet buffers (previously obtained via Connection::readRawPackets()) to the connection, for
+         * reuse when reading subsequent packets.
+         *
+         * @param rawPackets
+         */
+        void recycleRawPackets(std::vector<RawPacket>&& rawPackets) {
+            for (auto& rawPacket : rawPackets) {
+                this->packetParser.recycleBuffer(std::move(rawPacket));
+            }
+        }
+
         /**
          * Sends a response packet to the client.
          *
@@ -74,10 +148,59 @@ namespace Bloom::DebugServer::Gdb
          */
         void writePacket(const ResponsePackets::ResponsePacket& packet);
 
+        /**
+         * Sends an asynchronous notification to the client ("%<name>:<data>#<checksum>").
+         *
+         * Notifications are not acknowledged by the client, so they're written immediately, without waiting for an
+         * acknowledgement.
+         *
+         * See https://sourceware.org/gdb/onlinedocs/gdb/Notification-Packets.html for more.
+         *
+         * @param name
+         * @param packet
+         */
+        void writeNotification(const std::string& name, const ResponsePackets::ResponsePacket& packet);
+
+        /**
+         * Sends console output to the client, via an 'O' packet.
+         *
+         * The client only accepts console output whilst it's waiting for the response to a monitor ("qRcmd")
+         * command, or for the target to stop. Unlike other response packets, console output is flushed immediately,
+         * even in no-acknowledgement mode, as it's typically sent whilst we're busy handling a long-running command.
+         *
+         * @param output
+         */
+        void writeConsoleOutput(const std::string& output);
+
+        /**
+         * Disables packet acknowledgement for the remainder of the connection. After calling this, we will not send
+         * '+' acknowledgements for received packets, nor will we wait for the client to acknowledge our response
+         * packets.
+         *
+         * This should only be called once the client has negotiated no-acknowledgement mode (via the
+         * "QStartNoAckMode" packet). See CommandPackets::StartNoAckMode for more.
+         */
+        void disableAcknowledgements() {
+            this->acknowledgementsEnabled = false;
+        }
+
+        [[nodiscard]] bool areAcknowledgementsEnabled() const {
+            return this->acknowledgementsEnabled;
+        }
+
+        /**
+         * Writes all queued output (acknowledgements and response packets) to the client, in as few system calls as
+         * possible (via writev()).
+         *
+         * Queued output is flushed automatically before we wait for incoming data, so there is rarely a need to call
+         * this directly.
+         */
+        void flush();
+
     private:
         std::optional<int> socketFileDescriptor;
 
-        struct sockaddr_in socketAddress = {};
+        struct sockaddr_storage socketAddress = {};
 
         /**
          * The interruptEventNotifier (instance of EventFdNotifier) allows us to interrupt blocking I/O calls on this
@@ -94,8 +217,44 @@ namespace Bloom::DebugServer::Gdb
         EventFdNotifier& interruptEventNotifier;
         EpollInstance epollInstance = EpollInstance();
 
+        /**
+         * See Connection::setWakeupNotifier().
+         */
+        EventFdNotifier* wakeupNotifier = nullptr;
+
+        /**
+         * Set by Connection::read() when the wakeup notifier was signalled during the wait for incoming data.
+         */
+        bool wakeupPending = false;
+
+        /**
+         * See Connection::setPacketCapture().
+         */
+        PacketCapture* packetCapture = nullptr;
+
         bool readInterruptEnabled = false;
 
+        /**
+         * GDB RSP packets are acknowledged with a '+' byte, unless no-acknowledgement mode has been negotiated with the
+         * client. See Connection::disableAcknowledgements().
+         */
+        bool acknowledgementsEnabled = true;
+
+        /**
+         * Incremental packet parser. Partially received packets are retained here, between reads.
+         */
+        RawPacketParser packetParser;
+
+        /**
+         * Buffer for data read from the client socket. This is allocated once and reused for every read.
+         */
+        std::vector<unsigned char> readBuffer;
+
+        /**
+         * Output that is yet to be written to the client. See Connection::queueWrite() and Connection::flush().
+         */
+        std::vector<std::vector<unsigned char>> outputQueue;
+
         /**
          * Accepts a connection on serverSocketFileDescriptor.
          *
@@ -111,8 +270,11 @@ namespace Bloom::DebugServer::Gdb
         /**
          * Reads data from the client into a raw buffer.
          *
+         * @param buffer
+         *  The buffer to read into.
+         *
          * @param bytes
-         *  Number of bytes to read.
+         *  Maximum number of bytes to read. The buffer must be at least this size.
          *
          * @param interruptible
          *  If this flag is set to false, no other component within Bloom will be able to gracefully interrupt
@@ -123,9 +285,11 @@ namespace Bloom::DebugServer::Gdb
          *  The timeout in milliseconds. If not supplied, no timeout will be applied.
          *
          * @return
+         *  The number of bytes read. Zero if the timeout was reached.
          */
-        std::vector<unsigned char> read(
-            std::optional<std::size_t> bytes = std::nullopt,
+        std::size_t read(
+            unsigned char* buffer,
+            std::size_t bytes,
             bool interruptible = true,
             std::optional<std::chrono::milliseconds> timeout = std::nullopt
         );
@@ -141,21 +305,31 @@ namespace Bloom::DebugServer::Gdb
         std::optional<unsigned char> readSingleByte(bool interruptible = true);
 
         /**
-         * Writes data from a raw buffer to the client connection.
+         * Appends a raw buffer to the output queue. The buffer will be written to the client upon the next call to
+         * Connection::flush().
          *
          * @param buffer
          */
-        void write(const std::vector<unsigned char>& buffer);
+        void queueWrite(std::vector<unsigned char>&& buffer);
+
+        /**
+         * Waits (for no longer than the given timeout) for the client socket to become writable.
+         *
+         * @param timeout
+         */
+        void waitForWritable(std::chrono::milliseconds timeout);
 
         /**
-         * Removes this->interruptEventNotifier's file descriptor from the EpollInstance (this->epollInstance),
-         * preventing subsequent I/O operations on this->socketFileDescriptor from being interrupted.
+         * Removes this->interruptEventNotifier's file descriptor (and that of the wakeup notifier, if one has been set)
+         * from the EpollInstance (this->epollInstance), preventing subsequent I/O operations on
+         * this->socketFileDescriptor from being interrupted.
          */
         void disableReadInterrupts();
 
         /**
-         * Inserts this->interruptEventNotifier's file descriptor into the EpollInstance (this->epollInstance),
-         * allowing for subsequent I/O operations on this->socketFileDescriptor to be interrupted.
+         * Inserts this->interruptEventNotifier's file descriptor (and that of the wakeup notifier, if one has been
+         * set) into the EpollInstance (this->epollInstance), allowing for subsequent I/O operations on
+         * this->socketFileDescriptor to be interrupted.
          */
         void enableReadInterrupts();
     };
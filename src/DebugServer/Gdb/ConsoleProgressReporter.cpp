@@ -0,0 +1,44 @@
+#include "ConsoleProgressReporter.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    using Services::TargetControllerService;
+
+    using Targets::TargetMemorySize;
+
+    ConsoleProgressReporter::ConsoleProgressReporter(
+        Connection& connection,
+        TargetControllerService& targetControllerService,
+        std::string operationName
+    )
+        : connection(connection)
+        , targetControllerService(targetControllerService)
+        , operationName(std::move(operationName))
+        , lastReportTime(std::chrono::steady_clock::now())
+    {
+        this->targetControllerService.setOperationProgressHandler(
+            [this] (TargetMemorySize bytesCompleted, TargetMemorySize bytesTotal) {
+                this->report(bytesCompleted, bytesTotal);
+            }
+        );
+    }
+
+    ConsoleProgressReporter::~ConsoleProgressReporter() {
+        this->targetControllerService.setOperationProgressHandler({});
+    }
+
+    void ConsoleProgressReporter::report(TargetMemorySize bytesCompleted, TargetMemorySize bytesTotal) {
+        const auto now = std::chrono::steady_clock::now();
+
+        if (bytesTotal == 0 || (now - this->lastReportTime) < ConsoleProgressReporter::MINIMUM_REPORT_INTERVAL) {
+            return;
+        }
+
+        this->lastReportTime = now;
+        this->connection.writeConsoleOutput(
+            this->operationName + ": " + std::to_string(bytesCompleted) + " of " + std::to_string(bytesTotal)
+                + " bytes (" + std::to_string((static_cast<std::uint64_t>(bytesCompleted) * 100) / bytesTotal)
+                + "%)\n"
+        );
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <chrono>
+
+#include "Connection.hpp"
+
+#include "src/Services/TargetControllerService.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    /**
+     * Reports the progress of long-running TargetController operations (chunked memory reads, writes and fills, and
+     * program image loads) to the GDB client, as console output, for as long as the reporter lives.
+     *
+     * This is intended for monitor commands - GDB resets its remote timeout upon receiving console output, so long
+     * operations don't require the user to raise the timeout (which would slow the detection of genuine failures).
+     *
+     * Usage:
+     *
+     *   const auto progressReporter = ConsoleProgressReporter(
+     *       debugSession.connection,
+     *       targetControllerService,
+     *       "Filling EEPROM"
+     *   );
+     *
+     *   targetControllerService.fillMemory(...);
+     */
+    class ConsoleProgressReporter
+    {
+    public:
+        /**
+         * @param connection
+         * @param targetControllerService
+         * @param operationName
+         *  Prefixes each progress report, e.g. "Filling EEPROM: 1024 of 4096 bytes (25%)".
+         */
+        ConsoleProgressReporter(
+            Connection& connection,
+            Services::TargetControllerService& targetControllerService,
+            std::string operationName
+        );
+
+        ~ConsoleProgressReporter();
+
+        ConsoleProgressReporter(const ConsoleProgressReporter& other) = delete;
+        ConsoleProgressReporter(ConsoleProgressReporter&& other) = delete;
+        ConsoleProgressReporter& operator = (const ConsoleProgressReporter& other) = delete;
+        ConsoleProgressReporter& operator = (ConsoleProgressReporter&& other) = delete;
+
+    private:
+        /**
+         * Progress is reported no more than once per interval, regardless of how often the TargetController reports
+         * it. This keeps the console readable, whilst still being well within GDB's default remote timeout (2
+         * seconds).
+         */
+        static constexpr auto MINIMUM_REPORT_INTERVAL = std::chrono::seconds(1);
+
+        Connection& connection;
+        Services::TargetControllerService& targetControllerService;
+        std::string operationName;
+        std::chrono::steady_clock::time_point lastReportTime;
+
+        void report(Targets::TargetMemorySize bytesCompleted, Targets::TargetMemorySize bytesTotal);
+    };
+}
@@ -1,6 +1,11 @@
 #include "DebugSession.hpp"
 
+#include <algorithm>
+
 #include "src/EventManager/EventManager.hpp"
+#include "src/Services/MetricsService.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
 
 namespace Bloom::DebugServer::Gdb
 {
@@ -8,21 +13,180 @@ namespace Bloom::DebugServer::Gdb
         Connection&& connection,
         const std::set<std::pair<Feature, std::optional<std::string>>>& supportedFeatures,
         const TargetDescriptor& targetDescriptor,
-        const GdbDebugServerConfig& serverConfig
+        const GdbDebugServerConfig& serverConfig,
+        bool observer
     )
         : connection(std::move(connection))
         , supportedFeatures(supportedFeatures)
         , gdbTargetDescriptor(targetDescriptor)
         , serverConfig(serverConfig)
+        , observer(observer)
     {
         this->supportedFeatures.insert({
-            Feature::PACKET_SIZE, std::to_string(Connection::ABSOLUTE_MAXIMUM_PACKET_READ_SIZE)
+            Feature::PACKET_SIZE, std::to_string(this->serverConfig.packetSize)
         });
 
-        EventManager::triggerEvent(std::make_shared<Events::DebugSessionStarted>());
+        if (this->serverConfig.freeRtosThreadAwareness) {
+            this->rtosThreadAwareness.emplace(this->gdbTargetDescriptor);
+        }
+
+        if (this->observer) {
+            return;
+        }
+
+        static auto& sessionCounter = Services::MetricsService::counter("debugServer.sessions");
+        static auto& reconnectCounter = Services::MetricsService::counter("debugServer.reconnects");
+
+        if (sessionCounter.getValue() > 0) {
+            reconnectCounter.increment();
+        }
+
+        sessionCounter.increment();
+
+        EventManager::triggerEvent(Events::makeEvent<Events::DebugSessionStarted>());
     }
 
     DebugSession::~DebugSession() {
-        EventManager::triggerEvent(std::make_shared<Events::DebugSessionFinished>());
+        if (this->observer) {
+            return;
+        }
+
+        if (Logger::isDebugLoggingEnabled()) {
+            Logger::debug("Runtime performance counters at end of debug session:\n"
+                + Services::MetricsService::generateReport());
+        }
+
+        EventManager::triggerEvent(Events::makeEvent<Events::DebugSessionFinished>());
+    }
+
+    void DebugSession::reportTargetStopped(
+        ResponsePackets::TargetStopped stopReply,
+        Services::TargetControllerService& targetControllerService
+    ) {
+        if (this->rtosThreadAwareness.has_value()) {
+            // The thread list must be constructed afresh, for this stop
+            this->rtosThreadAwareness->invalidate();
+
+            try {
+                const auto threadId = this->rtosThreadAwareness->getCurrentThreadId(targetControllerService);
+
+                if (threadId.has_value()) {
+                    stopReply.setThreadId(*threadId);
+                }
+
+            } catch (const Exceptions::Exception& exception) {
+                Logger::error("Failed to determine the running RTOS thread - " + exception.getMessage());
+            }
+        }
+
+        if (!this->nonStopMode) {
+            this->connection.writePacket(stopReply);
+            return;
+        }
+
+        this->pendingStopReplies.push_back(stopReply);
+
+        if (this->pendingStopReplies.size() == 1) {
+            // The client isn't aware of any other pending stop replies, so we must notify it of this one
+            this->connection.writeNotification("Stop", stopReply);
+        }
+    }
+
+    ProgrammingSession& DebugSession::startProgrammingSession() {
+        if (this->programmingSession.has_value()) {
+            return *(this->programmingSession);
+        }
+
+        const auto& targetDescriptor = this->gdbTargetDescriptor.targetDescriptor;
+        const auto flashDescriptorIt = targetDescriptor.memoryDescriptorsByType.find(Targets::TargetMemoryType::FLASH);
+
+        if (
+            flashDescriptorIt == targetDescriptor.memoryDescriptorsByType.end()
+            || flashDescriptorIt->second.pageSize.value_or(0) == 0
+        ) {
+            throw Exceptions::Exception("Program memory page size unknown");
+        }
+
+        /*
+         * We can only stream the image to the target if the target can rewrite individual pages. Otherwise, the
+         * TargetController may have to erase the entire program memory upon each write.
+         */
+        return this->programmingSession.emplace(
+            flashDescriptorIt->second.pageSize.value(),
+            targetDescriptor.programMemoryPageRewritesSupported
+        );
+    }
+
+    void DebugSession::enableProgrammingMode(Services::TargetControllerService& targetControllerService) {
+        if (this->programmingModeEnabled) {
+            return;
+        }
+
+        targetControllerService.enableProgrammingMode();
+        this->programmingModeEnabled = true;
+    }
+
+    void DebugSession::disableProgrammingMode(Services::TargetControllerService& targetControllerService) {
+        if (!this->programmingModeEnabled) {
+            return;
+        }
+
+        targetControllerService.disableProgrammingMode();
+        this->programmingModeEnabled = false;
+    }
+
+    void DebugSession::abortProgrammingSession(Services::TargetControllerService& targetControllerService) {
+        this->programmingSession.reset();
+
+        try {
+            this->disableProgrammingMode(targetControllerService);
+
+        } catch (const Exceptions::Exception& exception) {
+            Logger::error("Failed to disable programming mode - " + exception.getMessage());
+        }
+    }
+
+    const TargetController::TraceFrame* DebugSession::getSelectedTraceFrame() const {
+        if (!this->selectedTraceFrameIndex.has_value() || *this->selectedTraceFrameIndex >= this->traceFrames.size()) {
+            return nullptr;
+        }
+
+        return &(this->traceFrames[*this->selectedTraceFrameIndex]);
+    }
+
+    std::optional<Targets::TargetMemoryBuffer> DebugSession::readTraceFrameMemory(
+        std::uint32_t gdbAddress,
+        Targets::TargetMemorySize bytes
+    ) const {
+        const auto* traceFrame = this->getSelectedTraceFrame();
+
+        if (traceFrame == nullptr) {
+            return std::nullopt;
+        }
+
+        auto output = Targets::TargetMemoryBuffer();
+        output.reserve(bytes);
+
+        /*
+         * The range may span multiple (adjacent or overlapping) blocks, so we look up each byte. Frames rarely hold
+         * more than a handful of blocks.
+         */
+        for (auto address = std::uint64_t(gdbAddress); address < std::uint64_t(gdbAddress) + bytes; ++address) {
+            const auto blockIt = std::find_if(
+                traceFrame->memoryBlocks.begin(),
+                traceFrame->memoryBlocks.end(),
+                [address] (const TargetController::TraceMemoryBlock& block) {
+                    return address >= block.address && address < std::uint64_t(block.address) + block.data.size();
+                }
+            );
+
+            if (blockIt == traceFrame->memoryBlocks.end()) {
+                return std::nullopt;
+            }
+
+            output.push_back(blockIt->data[address - blockIt->address]);
+        }
+
+        return output;
     }
 }
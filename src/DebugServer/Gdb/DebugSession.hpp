@@ -2,14 +2,24 @@
 
 #include <cstdint>
 #include <optional>
+#include <set>
+#include <map>
+#include <vector>
+#include <deque>
+#include <utility>
 
 #include "TargetDescriptor.hpp"
 #include "GdbDebugServerConfig.hpp"
 #include "Connection.hpp"
 #include "Feature.hpp"
 #include "ProgrammingSession.hpp"
+#include "BreakpointType.hpp"
+#include "FreeRtosThreadAwareness.hpp"
+#include "ResponsePackets/TargetStopped.hpp"
 
+#include "src/Services/TargetControllerService.hpp"
 #include "src/Targets/TargetMemory.hpp"
+#include "src/TargetController/Tracepoint.hpp"
 
 namespace Bloom::DebugServer::Gdb
 {
@@ -37,6 +47,13 @@ namespace Bloom::DebugServer::Gdb
          */
         const GdbDebugServerConfig& serverConfig;
 
+        /**
+         * Set for observer debug sessions (see ObserverServer). Observer sessions are confined to read operations,
+         * and they don't trigger the DebugSessionStarted and DebugSessionFinished events (or count towards the
+         * "debugServer.sessions" counter) - the primary session owns the target.
+         */
+        const bool observer = false;
+
         /**
          * When the GDB client is waiting for the target to halt, this is set to true so we know when to notify the
          * client.
@@ -46,25 +63,118 @@ namespace Bloom::DebugServer::Gdb
         bool pendingInterrupt = false;
 
         /**
-         * When the user attempts to program the target via GDB's 'load' command, GDB will send a number of
-         * FlashWrite (vFlashWrite) packets to Bloom. We group the data in these packets and flush it all at once, upon
-         * receiving a FlashDone (vFlashDone) packet.
+         * Set when the GDB client most recently resumed target execution with a step (or range step) action, as
+         * opposed to a continue action.
+         */
+        bool steppingExecution = false;
+
+        /**
+         * Set whilst a "monitor step-line" or "monitor step-over" command is in progress. The client is waiting for
+         * the command's output, as opposed to a stop reply, so the stop is reported as command output. See
+         * CommandPackets::SourceLineStep and CommandPackets::StepOverInstruction.
+         */
+        bool pendingMonitorStep = false;
+
+        /**
+         * Addresses of the breakpoints that the GDB client has inserted.
          *
-         * The grouped data is held in a ProgrammingSession object, against the active debug session. Once the data has
-         * been flushed, the ProgrammingSession object is destroyed.
+         * Along with DebugSession::watchpoints, this is used to determine whether the target stopped due to a
+         * watchpoint. The debug tool doesn't tell us which comparator triggered the break, so when the target
+         * stops during a continue action, at an address that isn't a breakpoint, whilst watchpoints are in place, we
+         * report the stop as a watchpoint hit.
+         */
+        std::set<Targets::TargetMemoryAddress> breakpointAddresses;
+
+        /**
+         * The watchpoints that the GDB client has inserted, as (GDB address, type) pairs.
+         */
+        std::set<std::pair<std::uint32_t, BreakpointType>> watchpoints;
+
+        /**
+         * When the user attempts to program the target via GDB's 'load' command, GDB will send a number of
+         * FlashErase (vFlashErase) and FlashWrite (vFlashWrite) packets to Bloom. The erased ranges and the data in
+         * these packets are held in a ProgrammingSession object, against the active debug session, as a sparse map of
+         * program memory pages. The pages are flushed to the target as they're completed (when streaming) or upon
+         * receiving a FlashDone (vFlashDone) packet. Once all data has been flushed, the ProgrammingSession object is
+         * destroyed.
          *
-         * See the ProgrammingSession struct and GDB RSP documentation for more.
+         * See the ProgrammingSession class and GDB RSP documentation for more.
          *
          * This member holds the current (if any) ProgrammingSession object. It should only be populated during
          * programming.
          */
         std::optional<ProgrammingSession> programmingSession = std::nullopt;
 
+        /**
+         * Whether programming mode was enabled on behalf of the current programming session.
+         *
+         * Entering and leaving programming mode can be costly (on some targets, it involves re-attaching to the
+         * target and re-sending the session parameters), so a programming session enters programming mode once,
+         * upon the first packet that requires it, and leaves it once, upon the FlashDone (vFlashDone) packet.
+         *
+         * See DebugSession::enableProgrammingMode() and DebugSession::disableProgrammingMode().
+         */
+        bool programmingModeEnabled = false;
+
+        /**
+         * Set when the GDB client has enabled non-stop mode (via the "QNonStop:1" packet).
+         *
+         * In non-stop mode, execution packets (continue, step, etc) are acknowledged with an "OK" response, and the
+         * client is free to send further packets whilst the target is running. When the target stops, we notify the
+         * client via a "%Stop" notification. See DebugSession::reportTargetStopped().
+         */
+        bool nonStopMode = false;
+
+        /**
+         * Stop replies that have been reported to (but not yet consumed by) the client, in non-stop mode.
+         *
+         * The first stop reply is sent with the "%Stop" notification. The client then retrieves any subsequent stop
+         * replies via "vStopped" packets, until we respond with "OK". The front stop reply is removed upon receipt of
+         * the "vStopped" packet that follows it.
+         *
+         * See https://sourceware.org/gdb/onlinedocs/gdb/Remote-Non_002dStop.html for more.
+         */
+        std::deque<ResponsePackets::TargetStopped> pendingStopReplies;
+
+        /**
+         * The tracepoints defined by the client (via "QTDP" packets), for the next trace experiment, mapped by
+         * tracepoint number. These are handed to the TargetController upon receipt of a "QTStart" packet.
+         */
+        std::map<std::uint32_t, TargetController::Tracepoint> tracepointsByNumber;
+
+        /**
+         * Numbers of the tracepoints for which the client has begun sending while-stepping actions. GDB only
+         * marks the first of these actions, so we need to keep track of them, in order to ignore the rest.
+         */
+        std::set<std::uint32_t> steppingTracepointNumbers;
+
+        /**
+         * Local copy of the trace frames collected by the TargetController, during the current (or last) trace
+         * experiment. Frames are only ever appended to the TargetController's trace buffer, so this is topped up as
+         * and when the client selects a frame (see the SelectTraceFrame command packet).
+         */
+        std::vector<TargetController::TraceFrame> traceFrames;
+
+        /**
+         * Index of the trace frame currently selected by the client (via a "QTFrame" packet), if any.
+         *
+         * Whilst a trace frame is selected, register and memory reads are served from the frame, as opposed to the
+         * target.
+         */
+        std::optional<std::size_t> selectedTraceFrameIndex;
+
+        /**
+         * RTOS thread awareness, if enabled in the server configuration (see
+         * GdbDebugServerConfig::freeRtosThreadAwareness).
+         */
+        std::optional<FreeRtosThreadAwareness> rtosThreadAwareness;
+
         DebugSession(
             Connection&& connection,
             const std::set<std::pair<Feature, std::optional<std::string>>>& supportedFeatures,
             const TargetDescriptor& targetDescriptor,
-            const GdbDebugServerConfig& serverConfig
+            const GdbDebugServerConfig& serverConfig,
+            bool observer = false
         );
 
         DebugSession(const DebugSession& other) = delete;
@@ -74,5 +184,77 @@ namespace Bloom::DebugServer::Gdb
         DebugSession& operator = (DebugSession&& other) = delete;
 
         ~DebugSession();
+
+        /**
+         * Reports a target stop to the client.
+         *
+         * In all-stop mode, the stop reply is sent as the response to the last execution packet. In non-stop mode,
+         * it's queued and the client is notified via a "%Stop" notification, if it isn't already aware of a pending
+         * stop reply.
+         *
+         * If RTOS thread awareness is enabled, the running thread is identified in the stop reply.
+         *
+         * @param stopReply
+         * @param targetControllerService
+         */
+        void reportTargetStopped(
+            ResponsePackets::TargetStopped stopReply,
+            Services::TargetControllerService& targetControllerService
+        );
+
+        /**
+         * Returns the current programming session, starting a new one if there isn't one.
+         *
+         * @throws Exceptions::Exception
+         *  If the target's program memory page size is unknown.
+         *
+         * @return
+         */
+        ProgrammingSession& startProgrammingSession();
+
+        /**
+         * Enables programming mode, if it hasn't already been enabled for the current programming session.
+         *
+         * @param targetControllerService
+         */
+        void enableProgrammingMode(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Disables programming mode, if it was enabled via DebugSession::enableProgrammingMode().
+         *
+         * @param targetControllerService
+         */
+        void disableProgrammingMode(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Discards the current programming session (if any) and disables programming mode (if it was enabled for
+         * the session). Failures are logged, not thrown - this is used in the handling of other failures.
+         *
+         * @param targetControllerService
+         */
+        void abortProgrammingSession(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Returns the trace frame currently selected by the client.
+         *
+         * @return
+         *  A nullptr if no trace frame is selected.
+         */
+        const TargetController::TraceFrame* getSelectedTraceFrame() const;
+
+        /**
+         * Reads memory from the selected trace frame.
+         *
+         * @param gdbAddress
+         * @param bytes
+         *
+         * @return
+         *  The memory, or std::nullopt if no trace frame is selected, or if any part of the range wasn't collected in
+         *  the selected frame.
+         */
+        std::optional<Targets::TargetMemoryBuffer> readTraceFrameMemory(
+            std::uint32_t gdbAddress,
+            Targets::TargetMemorySize bytes
+        ) const;
     };
 }
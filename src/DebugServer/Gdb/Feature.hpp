@@ -1,6 +1,9 @@
 #pragma once
 
-#include "src/Helpers/BiMap.hpp"
+#include <array>
+#include <string_view>
+
+#include "src/Helpers/FlatBiMap.hpp"
 
 namespace Bloom::DebugServer::Gdb
 {
@@ -10,14 +13,27 @@ namespace Bloom::DebugServer::Gdb
         HARDWARE_BREAKPOINTS,
         PACKET_SIZE,
         MEMORY_MAP_READ,
+        TARGET_DESCRIPTION_READ,
+        NO_ACK_MODE,
+        NON_STOP_MODE,
+        CONDITIONAL_BREAKPOINTS,
+        CONDITIONAL_TRACEPOINTS,
+        BINARY_UPLOAD,
     };
 
-    static inline BiMap<Feature, std::string> getGdbFeatureToNameMapping() {
-        return BiMap<Feature, std::string>{
-            {Feature::HARDWARE_BREAKPOINTS, "hwbreak"},
-            {Feature::SOFTWARE_BREAKPOINTS, "swbreak"},
-            {Feature::PACKET_SIZE, "PacketSize"},
-            {Feature::MEMORY_MAP_READ, "qXfer:memory-map:read"},
-        };
-    }
+    /**
+     * The names of the features, as they appear in the qSupported packet.
+     */
+    static constexpr auto GDB_FEATURE_NAMES = FlatBiMap(std::to_array<std::pair<Feature, std::string_view>>({
+        {Feature::HARDWARE_BREAKPOINTS, "hwbreak"},
+        {Feature::SOFTWARE_BREAKPOINTS, "swbreak"},
+        {Feature::PACKET_SIZE, "PacketSize"},
+        {Feature::MEMORY_MAP_READ, "qXfer:memory-map:read"},
+        {Feature::TARGET_DESCRIPTION_READ, "qXfer:features:read"},
+        {Feature::NO_ACK_MODE, "QStartNoAckMode"},
+        {Feature::NON_STOP_MODE, "QNonStop"},
+        {Feature::CONDITIONAL_BREAKPOINTS, "ConditionalBreakpoints"},
+        {Feature::CONDITIONAL_TRACEPOINTS, "ConditionalTracepoints"},
+        {Feature::BINARY_UPLOAD, "binary-upload"},
+    }));
 }
@@ -0,0 +1,434 @@
+#include "FreeRtosThreadAwareness.hpp"
+
+#include <algorithm>
+
+#include "src/TargetController/Commands/CommandBatch.hpp"
+#include "src/TargetController/Commands/ReadTargetMemory.hpp"
+
+#include "src/Services/SymbolService.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    using Services::TargetControllerService;
+    using Services::SymbolService;
+
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetRegisters;
+
+    using Exceptions::Exception;
+
+    FreeRtosThreadAwareness::FreeRtosThreadAwareness(const TargetDescriptor& gdbTargetDescriptor)
+        : gdbTargetDescriptor(gdbTargetDescriptor)
+    {
+        const auto& memoryDescriptorsByType = this->gdbTargetDescriptor.targetDescriptor.memoryDescriptorsByType;
+        const auto flashDescriptorIt = memoryDescriptorsByType.find(TargetMemoryType::FLASH);
+        const auto flashSize = flashDescriptorIt != memoryDescriptorsByType.end()
+            ? flashDescriptorIt->second.size()
+            : TargetMemorySize{0};
+
+        /*
+         * The ports save RAMPZ on targets with more than 64KiB of program memory, and EIND on targets with more than
+         * 128KiB (which also push 3-byte return addresses).
+         */
+        if (flashSize > 0x10000) {
+            this->additionalContextSize += 1;
+        }
+
+        if (flashSize > 0x20000) {
+            this->additionalContextSize += 1;
+            this->returnAddressSize = 3;
+        }
+    }
+
+    void FreeRtosThreadAwareness::restartSymbolLookup() {
+        this->requestedSymbolNames.clear();
+    }
+
+    std::optional<std::string> FreeRtosThreadAwareness::nextSymbolRequest() {
+        for (const auto& symbolName : FreeRtosThreadAwareness::SYMBOL_NAMES) {
+            if (!this->requestedSymbolNames.contains(symbolName)) {
+                this->requestedSymbolNames.insert(symbolName);
+                return symbolName;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    void FreeRtosThreadAwareness::setSymbolAddress(
+        const std::string& name,
+        const std::optional<std::uint32_t>& gdbAddress
+    ) {
+        this->symbolAddressesByName[name] = gdbAddress.has_value()
+            ? std::optional(static_cast<TargetMemoryAddress>(
+                *gdbAddress & ~(this->gdbTargetDescriptor.getMemoryOffset(TargetMemoryType::RAM))
+            ))
+            : std::nullopt;
+
+        this->invalidate();
+    }
+
+    void FreeRtosThreadAwareness::invalidate() {
+        this->cachedThreads = std::nullopt;
+        this->cachedCurrentThreadId = std::nullopt;
+        this->cachedRegistersByThreadId.clear();
+        this->selectedThreadId = std::nullopt;
+    }
+
+    const std::vector<FreeRtosThreadAwareness::Thread>& FreeRtosThreadAwareness::getThreads(
+        TargetControllerService& targetControllerService
+    ) {
+        if (!this->cachedThreads.has_value()) {
+            this->cachedThreads = this->walkTaskLists(targetControllerService);
+        }
+
+        return *(this->cachedThreads);
+    }
+
+    std::optional<FreeRtosThreadAwareness::ThreadId> FreeRtosThreadAwareness::getCurrentThreadId(
+        TargetControllerService& targetControllerService
+    ) {
+        this->getThreads(targetControllerService);
+        return this->cachedCurrentThreadId;
+    }
+
+    const FreeRtosThreadAwareness::Thread* FreeRtosThreadAwareness::findThread(
+        ThreadId threadId,
+        TargetControllerService& targetControllerService
+    ) {
+        const auto& threads = this->getThreads(targetControllerService);
+        const auto threadIt = std::find_if(
+            threads.begin(),
+            threads.end(),
+            [threadId] (const Thread& thread) {
+                return thread.id == threadId;
+            }
+        );
+
+        return threadIt != threads.end() ? &(*threadIt) : nullptr;
+    }
+
+    bool FreeRtosThreadAwareness::isSuspendedThreadSelected(TargetControllerService& targetControllerService) {
+        return this->selectedThreadId.has_value()
+            && this->selectedThreadId != this->getCurrentThreadId(targetControllerService);
+    }
+
+    TargetRegisters FreeRtosThreadAwareness::readThreadRegisters(
+        ThreadId threadId,
+        TargetControllerService& targetControllerService
+    ) {
+        const auto cachedRegistersIt = this->cachedRegistersByThreadId.find(threadId);
+        if (cachedRegistersIt != this->cachedRegistersByThreadId.end()) {
+            return cachedRegistersIt->second;
+        }
+
+        const auto* thread = this->findThread(threadId, targetControllerService);
+        if (thread == nullptr) {
+            throw Exception("Unknown thread ID " + std::to_string(threadId));
+        }
+
+        /*
+         * The port pushes r0, SREG, RAMPZ and EIND (if present), and r1 through r31, before storing the stack
+         * pointer in pxTopOfStack. AVR stack pointers point to the next free byte, so the context begins at the
+         * byte after pxTopOfStack, with r31. The return address (a word address, most significant byte first)
+         * follows the context.
+         */
+        const auto contextSize = TargetMemorySize{33} + this->additionalContextSize;
+        const auto context = targetControllerService.readMemory(
+            TargetMemoryType::RAM,
+            thread->topOfStackAddress + 1,
+            contextSize + this->returnAddressSize
+        );
+
+        const auto& descriptor = this->gdbTargetDescriptor;
+        auto registers = TargetRegisters();
+        registers.reserve(35);
+
+        registers.emplace_back(descriptor.getTargetRegisterDescriptorFromNumber(0), TargetMemoryBuffer({
+            context[contextSize - 1]
+        }));
+
+        for (auto registerNumber = GdbRegisterNumber{1}; registerNumber < 32; ++registerNumber) {
+            registers.emplace_back(
+                descriptor.getTargetRegisterDescriptorFromNumber(registerNumber),
+                TargetMemoryBuffer({context[31 - registerNumber]})
+            );
+        }
+
+        registers.emplace_back(descriptor.getTargetRegisterDescriptorFromNumber(32), TargetMemoryBuffer({
+            context[contextSize - 2]
+        }));
+
+        // The stack pointer, as it will be when the task resumes (after the context and return address are popped)
+        const auto stackPointer = thread->topOfStackAddress + contextSize + this->returnAddressSize;
+        registers.emplace_back(descriptor.getTargetRegisterDescriptorFromNumber(33), TargetMemoryBuffer({
+            static_cast<unsigned char>(stackPointer >> 8),
+            static_cast<unsigned char>(stackPointer),
+        }));
+
+        auto programCounter = std::uint32_t{0};
+        for (auto i = contextSize; i < context.size(); ++i) {
+            programCounter = (programCounter << 8) | context[i];
+        }
+
+        programCounter *= 2;
+        registers.emplace_back(descriptor.getTargetRegisterDescriptorFromNumber(34), TargetMemoryBuffer({
+            static_cast<unsigned char>(programCounter >> 24),
+            static_cast<unsigned char>(programCounter >> 16),
+            static_cast<unsigned char>(programCounter >> 8),
+            static_cast<unsigned char>(programCounter),
+        }));
+
+        this->cachedRegistersByThreadId.emplace(threadId, registers);
+        return registers;
+    }
+
+    std::optional<TargetMemoryAddress> FreeRtosThreadAwareness::getSymbolAddress(const std::string& name) const {
+        const auto symbolAddressIt = this->symbolAddressesByName.find(name);
+        if (symbolAddressIt != this->symbolAddressesByName.end() && symbolAddressIt->second.has_value()) {
+            return symbolAddressIt->second;
+        }
+
+        const auto symbol = SymbolService::symbolByName(name);
+        if (symbol.has_value() && symbol->memoryType == TargetMemoryType::RAM) {
+            return symbol->startAddress;
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<std::size_t> FreeRtosThreadAwareness::getPriorityCount(
+        TargetMemorySize listSize,
+        TargetControllerService& targetControllerService
+    ) const {
+        // uxTopUsedPriority (configMAX_PRIORITIES - 1) exists for the benefit of debuggers
+        const auto topUsedPriorityAddress = this->getSymbolAddress("uxTopUsedPriority");
+        if (topUsedPriorityAddress.has_value()) {
+            const auto topUsedPriority = targetControllerService.readMemory(
+                TargetMemoryType::RAM,
+                *topUsedPriorityAddress,
+                1
+            );
+
+            return static_cast<std::size_t>(topUsedPriority.front()) + 1;
+        }
+
+        const auto readyListsSymbol = SymbolService::symbolByName("pxReadyTasksLists");
+        if (readyListsSymbol.has_value() && readyListsSymbol->size >= listSize) {
+            return readyListsSymbol->size / listSize;
+        }
+
+        return std::nullopt;
+    }
+
+    std::vector<FreeRtosThreadAwareness::Thread> FreeRtosThreadAwareness::walkTaskLists(
+        TargetControllerService& targetControllerService
+    ) {
+        auto threads = std::vector<Thread>();
+        this->cachedCurrentThreadId = std::nullopt;
+
+        const auto currentTcbAddress = this->getSymbolAddress("pxCurrentTCB");
+        const auto readyListsAddress = this->getSymbolAddress("pxReadyTasksLists");
+
+        if (!currentTcbAddress.has_value() || !readyListsAddress.has_value()) {
+            Logger::debug("FreeRTOS kernel symbols not found - no RTOS threads to report");
+            return threads;
+        }
+
+        const auto tickCountSymbol = SymbolService::symbolByName("xTickCount");
+        const auto tickSize = tickCountSymbol.has_value() && (tickCountSymbol->size == 2 || tickCountSymbol->size == 4)
+            ? tickCountSymbol->size
+            : FreeRtosThreadAwareness::DEFAULT_TICK_SIZE;
+
+        /*
+         * List_t:      uxNumberOfItems, pxIndex, xListEnd (xItemValue, pxNext, pxPrevious)
+         * ListItem_t:  xItemValue, pxNext, pxPrevious, pvOwner, pvContainer
+         * TCB_t:       pxTopOfStack, xStateListItem, xEventListItem, uxPriority, pxStack, pcTaskName[]
+         */
+        const auto listEndOffset = TargetMemorySize{1} + FreeRtosThreadAwareness::POINTER_SIZE;
+        const auto listSize = listEndOffset + tickSize + (FreeRtosThreadAwareness::POINTER_SIZE * 2);
+        const auto listItemSize = tickSize + (FreeRtosThreadAwareness::POINTER_SIZE * 4);
+
+        const auto stateListItemOffset = FreeRtosThreadAwareness::POINTER_SIZE;
+        const auto nextItemOffset = stateListItemOffset + tickSize;
+        const auto ownerOffset = nextItemOffset + (FreeRtosThreadAwareness::POINTER_SIZE * 2);
+        const auto priorityOffset = stateListItemOffset + (listItemSize * 2);
+        const auto nameOffset = priorityOffset + 1 + FreeRtosThreadAwareness::POINTER_SIZE;
+        const auto tcbReadSize = nameOffset + FreeRtosThreadAwareness::MAXIMUM_TASK_NAME_LENGTH;
+
+        const auto priorityCount = this->getPriorityCount(listSize, targetControllerService);
+        if (!priorityCount.has_value()) {
+            Logger::debug("Unable to determine the number of FreeRTOS task priorities - no RTOS threads to report");
+            return threads;
+        }
+
+        auto taskLists = std::vector<TaskList>();
+        for (auto priority = std::size_t{0}; priority < *priorityCount; ++priority) {
+            taskLists.emplace_back(TaskList{
+                .address = *readyListsAddress + static_cast<TargetMemoryAddress>(priority * listSize),
+                .state = ThreadState::READY,
+            });
+        }
+
+        for (const auto& [symbolName, state] : std::vector<std::pair<std::string, ThreadState>>({
+            {"xPendingReadyList", ThreadState::READY},
+            {"xDelayedTaskList1", ThreadState::BLOCKED},
+            {"xDelayedTaskList2", ThreadState::BLOCKED},
+            {"xSuspendedTaskList", ThreadState::SUSPENDED},
+            {"xTasksWaitingTermination", ThreadState::DELETED},
+        })) {
+            const auto listAddress = this->getSymbolAddress(symbolName);
+
+            if (listAddress.has_value()) {
+                taskLists.emplace_back(TaskList{
+                    .address = *listAddress,
+                    .state = state,
+                });
+            }
+        }
+
+        // Read pxCurrentTCB and all of the list headers in a single batch
+        auto headerRanges = std::vector<std::pair<TargetMemoryAddress, TargetMemorySize>>({
+            {*currentTcbAddress, FreeRtosThreadAwareness::POINTER_SIZE}
+        });
+
+        for (const auto& taskList : taskLists) {
+            headerRanges.emplace_back(taskList.address, listSize);
+        }
+
+        const auto headerBuffers = FreeRtosThreadAwareness::readMemoryRanges(headerRanges, targetControllerService);
+        const auto currentTcb = FreeRtosThreadAwareness::readPointer(headerBuffers.front(), 0);
+
+        if (currentTcb == 0) {
+            Logger::debug("FreeRTOS has no tasks - no RTOS threads to report");
+            return threads;
+        }
+
+        struct ListCursor
+        {
+            const TaskList* taskList;
+            TargetMemoryAddress itemAddress;
+            std::size_t remainingItems;
+        };
+
+        auto cursors = std::vector<ListCursor>();
+        for (auto i = std::size_t{0}; i < taskLists.size(); ++i) {
+            const auto& header = headerBuffers[i + 1];
+
+            if (header.front() > 0) {
+                cursors.emplace_back(ListCursor{
+                    .taskList = &(taskLists[i]),
+                    .itemAddress = FreeRtosThreadAwareness::readPointer(header, listEndOffset + tickSize),
+                    .remainingItems = header.front(),
+                });
+            }
+        }
+
+        // Walk all of the lists in lockstep - each batch reads the next TCB in every list
+        auto threadIds = std::set<ThreadId>();
+
+        while (!cursors.empty() && threads.size() < FreeRtosThreadAwareness::MAXIMUM_THREAD_COUNT) {
+            auto tcbRanges = std::vector<std::pair<TargetMemoryAddress, TargetMemorySize>>();
+            for (const auto& cursor : cursors) {
+                tcbRanges.emplace_back(cursor.itemAddress - stateListItemOffset, tcbReadSize);
+            }
+
+            const auto tcbBuffers = FreeRtosThreadAwareness::readMemoryRanges(tcbRanges, targetControllerService);
+            auto nextCursors = std::vector<ListCursor>();
+
+            for (auto i = std::size_t{0}; i < cursors.size(); ++i) {
+                const auto& cursor = cursors[i];
+                const auto& tcb = tcbBuffers[i];
+                const auto tcbAddress = tcbRanges[i].first;
+
+                if (
+                    FreeRtosThreadAwareness::readPointer(tcb, ownerOffset) != tcbAddress
+                    || threadIds.contains(tcbAddress)
+                ) {
+                    Logger::debug("Unexpected FreeRTOS list item - abandoning walk of the list");
+                    continue;
+                }
+
+                const auto nameBegin = tcb.begin() + static_cast<std::ptrdiff_t>(nameOffset);
+                threads.emplace_back(Thread{
+                    .id = tcbAddress,
+                    .name = std::string(nameBegin, std::find(nameBegin, tcb.end(), 0x00)),
+                    .priority = tcb[priorityOffset],
+                    .state = tcbAddress == currentTcb ? ThreadState::RUNNING : cursor.taskList->state,
+                    .topOfStackAddress = FreeRtosThreadAwareness::readPointer(tcb, 0),
+                });
+                threadIds.insert(tcbAddress);
+
+                const auto nextItemAddress = FreeRtosThreadAwareness::readPointer(tcb, nextItemOffset);
+                if (cursor.remainingItems > 1 && nextItemAddress != cursor.taskList->address + listEndOffset) {
+                    nextCursors.emplace_back(ListCursor{
+                        .taskList = cursor.taskList,
+                        .itemAddress = nextItemAddress,
+                        .remainingItems = cursor.remainingItems - 1,
+                    });
+                }
+            }
+
+            cursors = std::move(nextCursors);
+        }
+
+        if (threadIds.contains(currentTcb)) {
+            this->cachedCurrentThreadId = currentTcb;
+
+        } else {
+            // The running task wasn't found in any list, so we can't present a consistent view of the threads
+            Logger::debug("Running FreeRTOS task not found in task lists - no RTOS threads to report");
+            threads.clear();
+        }
+
+        return threads;
+    }
+
+    std::vector<TargetMemoryBuffer> FreeRtosThreadAwareness::readMemoryRanges(
+        const std::vector<std::pair<TargetMemoryAddress, TargetMemorySize>>& ranges,
+        TargetControllerService& targetControllerService
+    ) {
+        using TargetController::Commands::ReadTargetMemory;
+
+        auto commandBatch = std::make_unique<TargetController::Commands::CommandBatch>();
+        for (const auto& [startAddress, bytes] : ranges) {
+            commandBatch->addCommand(std::make_unique<ReadTargetMemory>(
+                TargetMemoryType::RAM,
+                startAddress,
+                bytes,
+                std::set<Targets::TargetMemoryAddressRange>()
+            ));
+        }
+
+        auto batchResponses = targetControllerService.sendCommandBatch(std::move(commandBatch));
+
+        auto buffers = std::vector<TargetMemoryBuffer>();
+        buffers.reserve(ranges.size());
+
+        for (auto i = std::size_t{0}; i < ranges.size(); ++i) {
+            auto buffer = batchResponses->takeResponse<ReadTargetMemory>(i)->takeData();
+
+            if (buffer.size() != ranges[i].second) {
+                throw Exception("Unexpected response size for FreeRTOS task list read");
+            }
+
+            buffers.emplace_back(std::move(buffer));
+        }
+
+        return buffers;
+    }
+
+    TargetMemoryAddress FreeRtosThreadAwareness::readPointer(
+        const TargetMemoryBuffer& buffer,
+        TargetMemorySize offset
+    ) {
+        // Pointers are little-endian
+        return static_cast<TargetMemoryAddress>(buffer[offset])
+            | (static_cast<TargetMemoryAddress>(buffer[offset + 1]) << 8);
+    }
+}
@@ -0,0 +1,269 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+
+#include "TargetDescriptor.hpp"
+
+#include "src/Services/TargetControllerService.hpp"
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetRegister.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    /**
+     * FreeRTOS thread awareness, for AVR targets running the AVR_Mega or AVR_Dx port of the FreeRTOS kernel.
+     *
+     * Each FreeRTOS task is presented to GDB as a thread, identified by the address of its task control block (TCB).
+     * The thread list is constructed by walking the kernel's task lists (the ready lists, the delayed lists, etc),
+     * via batched memory reads (see FreeRtosThreadAwareness::readMemoryRanges()). It's cached until the target
+     * resumes execution, so GDB's thread queries (qfThreadInfo, qThreadExtraInfo, etc) only cost one walk per stop.
+     *
+     * The registers of the running task are the target's registers. The registers of every other task are taken
+     * from the context that the kernel saved on the task's stack, when the task was switched out.
+     *
+     * The addresses of the kernel's (static) variables are obtained from GDB, via the qSymbol protocol, or,
+     * failing that, from the project's ELF file (see SymbolService).
+     *
+     * This relies on the kernel's default data structure layout - the thread list will be empty if the kernel was
+     * built with configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES, for example.
+     */
+    class FreeRtosThreadAwareness
+    {
+    public:
+        using ThreadId = std::uint32_t;
+
+        enum class ThreadState: std::uint8_t
+        {
+            RUNNING,
+            READY,
+            BLOCKED,
+            SUSPENDED,
+            DELETED,
+        };
+
+        struct Thread
+        {
+            ThreadId id = 0;
+            std::string name;
+            std::uint8_t priority = 0;
+            ThreadState state = ThreadState::READY;
+
+            /**
+             * The task's saved stack pointer (pxTopOfStack). Only meaningful for tasks that aren't running.
+             */
+            Targets::TargetMemoryAddress topOfStackAddress = 0;
+        };
+
+        /**
+         * The thread selected for register access, via the "Hg" packet. std::nullopt means the running thread.
+         */
+        std::optional<ThreadId> selectedThreadId;
+
+        explicit FreeRtosThreadAwareness(const TargetDescriptor& gdbTargetDescriptor);
+
+        /**
+         * Forgets the symbols requested from GDB, so that they can be requested again (GDB sends a "qSymbol::"
+         * packet whenever it loads new symbols).
+         */
+        void restartSymbolLookup();
+
+        /**
+         * Returns the name of the next symbol to request from GDB, via the qSymbol protocol.
+         *
+         * @return
+         *  std::nullopt if all symbols have been requested.
+         */
+        std::optional<std::string> nextSymbolRequest();
+
+        /**
+         * Records the value of a symbol, as provided by GDB.
+         *
+         * @param name
+         * @param gdbAddress
+         *  std::nullopt if GDB couldn't find the symbol.
+         */
+        void setSymbolAddress(const std::string& name, const std::optional<std::uint32_t>& gdbAddress);
+
+        /**
+         * Discards the cached thread list. Must be called whenever the target resumes execution.
+         */
+        void invalidate();
+
+        /**
+         * Returns the RTOS threads, walking the task lists if the thread list isn't cached.
+         *
+         * @param targetControllerService
+         *
+         * @return
+         *  An empty vector if the kernel's symbols couldn't be resolved, or the scheduler hasn't created any tasks.
+         */
+        const std::vector<Thread>& getThreads(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Returns the running thread.
+         *
+         * @param targetControllerService
+         *
+         * @return
+         *  std::nullopt if there are no RTOS threads (see FreeRtosThreadAwareness::getThreads()).
+         */
+        std::optional<ThreadId> getCurrentThreadId(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Finds a thread by its ID.
+         *
+         * @param threadId
+         * @param targetControllerService
+         *
+         * @return
+         *  A nullptr if there is no such thread.
+         */
+        const Thread* findThread(ThreadId threadId, Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Returns true if a thread other than the running thread has been selected (via "Hg"), in which case register
+         * access must be serviced via FreeRtosThreadAwareness::readThreadRegisters().
+         *
+         * @param targetControllerService
+         *
+         * @return
+         */
+        bool isSuspendedThreadSelected(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Returns the registers of a thread that isn't running, from the context saved on its stack.
+         *
+         * @param threadId
+         * @param targetControllerService
+         *
+         * @return
+         *  The values of all GDB registers (GPRs, SREG, SP and PC).
+         */
+        Targets::TargetRegisters readThreadRegisters(
+            ThreadId threadId,
+            Services::TargetControllerService& targetControllerService
+        );
+
+    private:
+        /**
+         * Pointers are 16 bits wide, on AVR targets.
+         */
+        static constexpr Targets::TargetMemorySize POINTER_SIZE = 2;
+
+        /**
+         * The size of TickType_t, if it can't be determined from the ELF file (the AVR ports default to 16-bit
+         * ticks).
+         */
+        static constexpr Targets::TargetMemorySize DEFAULT_TICK_SIZE = 2;
+
+        /**
+         * configMAX_TASK_NAME_LEN defaults to 16. Names are NUL-terminated, so we don't need to know the actual
+         * length - we just read this many bytes and stop at the terminator.
+         */
+        static constexpr Targets::TargetMemorySize MAXIMUM_TASK_NAME_LENGTH = 16;
+
+        /**
+         * The task lists are walked in lockstep, one TCB per list, per batch. This bounds the walk, in case the
+         * lists are corrupt (or the kernel's data structure layout isn't what we expect).
+         */
+        static constexpr std::size_t MAXIMUM_THREAD_COUNT = 256;
+
+        /**
+         * The kernel variables that we need, in the order in which they're requested from GDB.
+         */
+        static inline const std::vector<std::string> SYMBOL_NAMES = {
+            "pxCurrentTCB",
+            "pxReadyTasksLists",
+            "xDelayedTaskList1",
+            "xDelayedTaskList2",
+            "xPendingReadyList",
+            "xSuspendedTaskList",
+            "xTasksWaitingTermination",
+            "uxTopUsedPriority",
+        };
+
+        struct TaskList
+        {
+            Targets::TargetMemoryAddress address = 0;
+            ThreadState state = ThreadState::READY;
+        };
+
+        const TargetDescriptor& gdbTargetDescriptor;
+
+        std::map<std::string, std::optional<Targets::TargetMemoryAddress>> symbolAddressesByName;
+        std::set<std::string> requestedSymbolNames;
+
+        std::optional<std::vector<Thread>> cachedThreads;
+        std::optional<ThreadId> cachedCurrentThreadId;
+        std::map<ThreadId, Targets::TargetRegisters> cachedRegistersByThreadId;
+
+        /**
+         * Number of context bytes that the port saves on a task's stack, in addition to the 32 GPRs and SREG
+         * (RAMPZ and EIND, on targets that have them).
+         */
+        Targets::TargetMemorySize additionalContextSize = 0;
+
+        /**
+         * Size of return addresses on the stack (3 bytes on targets with more than 128KiB of program memory).
+         */
+        Targets::TargetMemorySize returnAddressSize = 2;
+
+        /**
+         * Resolves the address of a kernel variable, from the values provided by GDB or from the project's ELF file.
+         *
+         * @param name
+         *
+         * @return
+         */
+        std::optional<Targets::TargetMemoryAddress> getSymbolAddress(const std::string& name) const;
+
+        /**
+         * Determines the number of task priorities (configMAX_PRIORITIES), from the value of uxTopUsedPriority or
+         * the size of pxReadyTasksLists.
+         *
+         * @param listSize
+         * @param targetControllerService
+         *
+         * @return
+         */
+        std::optional<std::size_t> getPriorityCount(
+            Targets::TargetMemorySize listSize,
+            Services::TargetControllerService& targetControllerService
+        ) const;
+
+        /**
+         * Walks the kernel's task lists.
+         *
+         * @param targetControllerService
+         *
+         * @return
+         */
+        std::vector<Thread> walkTaskLists(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Reads a number of RAM ranges, as a single batch of commands to the TargetController.
+         *
+         * @param ranges
+         *  (start address, size) pairs.
+         *
+         * @param targetControllerService
+         *
+         * @return
+         *  The data for each range, in the order given.
+         */
+        static std::vector<Targets::TargetMemoryBuffer> readMemoryRanges(
+            const std::vector<std::pair<Targets::TargetMemoryAddress, Targets::TargetMemorySize>>& ranges,
+            Services::TargetControllerService& targetControllerService
+        );
+
+        static Targets::TargetMemoryAddress readPointer(
+            const Targets::TargetMemoryBuffer& buffer,
+            Targets::TargetMemorySize offset
+        );
+    };
+}
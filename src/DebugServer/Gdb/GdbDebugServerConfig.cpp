@@ -17,6 +17,23 @@ namespace Bloom::DebugServer::Gdb
             }
 
             this->listeningAddress = debugServerConfig.debugServerNode["ipAddress"].as<std::string>();
+
+            if (this->listeningAddress.starts_with(GdbDebugServerConfig::UNIX_SOCKET_ADDRESS_PREFIX)) {
+                const auto socketPath = this->listeningAddress.substr(
+                    GdbDebugServerConfig::UNIX_SOCKET_ADDRESS_PREFIX.size()
+                );
+
+                if (!socketPath.empty()) {
+                    this->unixSocketPath = socketPath;
+
+                } else {
+                    Logger::error(
+                        "Invalid GDB debug server config parameter ('ipAddress') provided - no Unix domain socket "
+                        "path given. The parameter will be ignored."
+                    );
+                    this->listeningAddress = "127.0.0.1";
+                }
+            }
         }
 
         if (debugServerConfig.debugServerNode["port"]) {
@@ -30,5 +47,140 @@ namespace Bloom::DebugServer::Gdb
                 );
             }
         }
+
+        if (debugServerConfig.debugServerNode["observerPort"]) {
+            if (YamlUtilities::isCastable<std::uint16_t>(debugServerConfig.debugServerNode["observerPort"])) {
+                this->observerPortNumber = debugServerConfig.debugServerNode["observerPort"].as<std::uint16_t>();
+
+            } else {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('observerPort') provided - value must be castable to "
+                    "a 16-bit unsigned integer. The parameter will be ignored."
+                );
+            }
+
+            if (this->observerPortNumber.has_value() && this->unixSocketPath.has_value()) {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('observerPort') provided - observer connections are "
+                    "only supported over TCP. The parameter will be ignored."
+                );
+                this->observerPortNumber = std::nullopt;
+            }
+
+            if (this->observerPortNumber == this->listeningPortNumber) {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('observerPort') provided - the observer port must "
+                    "differ from the listening port. The parameter will be ignored."
+                );
+                this->observerPortNumber = std::nullopt;
+            }
+        }
+
+        if (debugServerConfig.debugServerNode["packetSize"]) {
+            if (YamlUtilities::isCastable<std::uint32_t>(debugServerConfig.debugServerNode["packetSize"])) {
+                const auto packetSize = debugServerConfig.debugServerNode["packetSize"].as<std::uint32_t>();
+
+                if (
+                    packetSize >= GdbDebugServerConfig::MINIMUM_PACKET_SIZE
+                    && packetSize <= GdbDebugServerConfig::MAXIMUM_PACKET_SIZE
+                ) {
+                    this->packetSize = packetSize;
+
+                } else {
+                    Logger::error(
+                        "Invalid GDB debug server config parameter ('packetSize') provided - value must be between "
+                        + std::to_string(GdbDebugServerConfig::MINIMUM_PACKET_SIZE) + " and "
+                        + std::to_string(GdbDebugServerConfig::MAXIMUM_PACKET_SIZE)
+                        + ". The parameter will be ignored."
+                    );
+                }
+
+            } else {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('packetSize') provided - value must be castable to a "
+                    "32-bit unsigned integer. The parameter will be ignored."
+                );
+            }
+        }
+
+        if (debugServerConfig.debugServerNode["socketSendBufferSize"]) {
+            if (YamlUtilities::isCastable<std::uint32_t>(debugServerConfig.debugServerNode["socketSendBufferSize"])) {
+                this->socketSendBufferSize = debugServerConfig.debugServerNode["socketSendBufferSize"].as<std::uint32_t>();
+
+            } else {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('socketSendBufferSize') provided - value must be "
+                    "castable to a 32-bit unsigned integer. The parameter will be ignored."
+                );
+            }
+        }
+
+        if (debugServerConfig.debugServerNode["socketReceiveBufferSize"]) {
+            if (
+                YamlUtilities::isCastable<std::uint32_t>(debugServerConfig.debugServerNode["socketReceiveBufferSize"])
+            ) {
+                this->socketReceiveBufferSize = debugServerConfig.debugServerNode["socketReceiveBufferSize"].as<
+                    std::uint32_t
+                >();
+
+            } else {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('socketReceiveBufferSize') provided - value must be "
+                    "castable to a 32-bit unsigned integer. The parameter will be ignored."
+                );
+            }
+        }
+
+        if (debugServerConfig.debugServerNode["peripheralRegisters"]) {
+            if (YamlUtilities::isCastable<bool>(debugServerConfig.debugServerNode["peripheralRegisters"])) {
+                this->peripheralRegisters = debugServerConfig.debugServerNode["peripheralRegisters"].as<bool>();
+
+            } else {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('peripheralRegisters') provided - value must be "
+                    "castable to a boolean. The parameter will be ignored."
+                );
+            }
+        }
+
+        if (debugServerConfig.debugServerNode["rtos"]) {
+            if (
+                YamlUtilities::isCastable<std::string>(debugServerConfig.debugServerNode["rtos"])
+                && debugServerConfig.debugServerNode["rtos"].as<std::string>() == "freertos"
+            ) {
+                this->freeRtosThreadAwareness = true;
+
+            } else {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('rtos') provided - the only supported RTOS is "
+                    "\"freertos\". The parameter will be ignored."
+                );
+            }
+        }
+
+        if (debugServerConfig.debugServerNode["deferResetAfterProgramming"]) {
+            if (YamlUtilities::isCastable<bool>(debugServerConfig.debugServerNode["deferResetAfterProgramming"])) {
+                this->deferResetAfterProgramming = debugServerConfig.debugServerNode["deferResetAfterProgramming"]
+                    .as<bool>();
+
+            } else {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('deferResetAfterProgramming') provided - value must "
+                    "be castable to a boolean. The parameter will be ignored."
+                );
+            }
+        }
+
+        if (debugServerConfig.debugServerNode["packetCaptureFile"]) {
+            if (YamlUtilities::isCastable<std::string>(debugServerConfig.debugServerNode["packetCaptureFile"])) {
+                this->packetCaptureFilePath = debugServerConfig.debugServerNode["packetCaptureFile"].as<std::string>();
+
+            } else {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('packetCaptureFile') provided - value must be "
+                    "castable to a string. The parameter will be ignored."
+                );
+            }
+        }
     }
 }
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
 #include "src/ProjectConfig.hpp"
 
 namespace Bloom::DebugServer::Gdb
@@ -24,6 +28,98 @@ namespace Bloom::DebugServer::Gdb
          */
         std::string listeningAddress = "127.0.0.1";
 
+        /**
+         * The path of the Unix domain socket for the GDB server to listen on, instead of a TCP socket. Set when the
+         * listening address is given in the form "unix:<path>" (e.g. "unix:/tmp/bloom.sock").
+         *
+         * Paths beginning with '@' refer to the abstract socket namespace ("unix:@bloom"), which doesn't involve the
+         * filesystem - the socket disappears with the server, so there's nothing to clean up.
+         *
+         * GDB connects to Unix domain sockets via "target remote /tmp/bloom.sock", or, for abstract sockets (which
+         * GDB cannot connect to directly), via socat: "target remote | socat - ABSTRACT-CONNECT:bloom".
+         */
+        std::optional<std::string> unixSocketPath;
+
+        static constexpr auto UNIX_SOCKET_ADDRESS_PREFIX = std::string_view("unix:");
+
+        /**
+         * The port number on which to accept observer connections - read-only connections for watching the target
+         * whilst it's being debugged by the primary GDB client (see ObserverServer). Observers connect to the same
+         * address as the primary client.
+         *
+         * This parameter is optional. If not specified, observer connections will not be accepted. Observer
+         * connections are only supported over TCP.
+         */
+        std::optional<std::uint16_t> observerPortNumber;
+
+        /**
+         * The maximum size of packets that GDB can send to the server (advertised via the "PacketSize" feature).
+         *
+         * GDB uses this to determine how much data it can request or send in a single memory access or flash write
+         * packet. Larger packets mean fewer round trips to the target.
+         *
+         * This parameter is optional. If not specified, the default value set here will be used.
+         */
+        std::uint32_t packetSize = GdbDebugServerConfig::MAXIMUM_PACKET_SIZE;
+
+        /**
+         * Sizes (in bytes) of the kernel send and receive buffers for client sockets (SO_SNDBUF and SO_RCVBUF).
+         *
+         * These parameters are optional. If not specified, the system defaults will be used.
+         */
+        std::optional<std::uint32_t> socketSendBufferSize;
+        std::optional<std::uint32_t> socketReceiveBufferSize;
+
+        /**
+         * Whether to expose the target's peripheral registers to GDB, as GDB registers in the target description
+         * (target.xml). Peripheral registers are never included in the register packet (the response to the 'g'
+         * command) - GDB will only read them upon request (e.g. "info registers peripheral" or "p $portb_pinb").
+         *
+         * Some peripheral registers have read side effects (e.g. reading a UART data register clears its receive
+         * flag), so this is disabled by default.
+         *
+         * This parameter is optional. If not specified, the default value set here will be used.
+         */
+        bool peripheralRegisters = false;
+
+        /**
+         * Whether to present the tasks of a FreeRTOS application to GDB as threads (see FreeRtosThreadAwareness).
+         * Enabled via the 'rtos' parameter ("rtos: freertos"). FreeRTOS is the only supported RTOS, at present.
+         *
+         * This parameter is optional. If not specified, the default value set here will be used.
+         */
+        bool freeRtosThreadAwareness = false;
+
+        /**
+         * Whether to defer the target reset that follows the programming of the target (upon receiving a FlashDone
+         * (vFlashDone) packet), until the target is next resumed or stepped. If GDB resets the target itself before
+         * then ("monitor reset"), the deferred reset is skipped. See Commands::ResetTarget::deferred.
+         *
+         * GDB clients often reset or resume the target immediately after loading a program, in which case the target
+         * is reset only once.
+         *
+         * This parameter is optional. If not specified, the default value set here will be used.
+         */
+        bool deferResetAfterProgramming = false;
+
+        /**
+         * The path of the file to capture all GDB RSP packets to, with timestamps, for offline latency analysis (see
+         * PacketCapture). Relative paths are resolved against the project directory.
+         *
+         * This parameter is optional. If not specified, packets will not be captured.
+         */
+        std::optional<std::string> packetCaptureFilePath;
+
+        /**
+         * GDB should never attempt to send more than this in a single instance.
+         */
+        static constexpr std::uint32_t MAXIMUM_PACKET_SIZE = 2097000; // 2MiB
+
+        /**
+         * Enough for the largest register packet we'd ever have to deal with.
+         */
+        static constexpr std::uint32_t MINIMUM_PACKET_SIZE = 512;
+
         explicit GdbDebugServerConfig(const DebugServerConfig& debugServerConfig);
     };
 }
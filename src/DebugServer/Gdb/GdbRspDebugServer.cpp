@@ -1,10 +1,23 @@
 #include "GdbRspDebugServer.hpp"
 
 #include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <netinet/tcp.h>
+#include <cstddef>
+#include <algorithm>
 #include <unistd.h>
+#include <typeinfo>
+#include <typeindex>
+#include <unordered_map>
+#include <set>
+#include <cstdlib>
+#include <utility>
+#include <cxxabi.h>
 
 #include "src/EventManager/EventManager.hpp"
 #include "src/Logger/Logger.hpp"
+#include "src/Services/StringService.hpp"
 
 #include "Exceptions/ClientDisconnected.hpp"
 #include "Exceptions/ClientNotSupported.hpp"
@@ -21,6 +34,8 @@
 #include "CommandPackets/InterruptExecution.hpp"
 #include "CommandPackets/ContinueExecution.hpp"
 #include "CommandPackets/StepExecution.hpp"
+#include "CommandPackets/VContSupportedActionsQuery.hpp"
+#include "CommandPackets/VContExecution.hpp"
 #include "CommandPackets/ReadRegisters.hpp"
 #include "CommandPackets/WriteRegister.hpp"
 #include "CommandPackets/SetBreakpoint.hpp"
@@ -30,14 +45,48 @@
 #include "CommandPackets/HelpMonitorInfo.hpp"
 #include "CommandPackets/BloomVersion.hpp"
 #include "CommandPackets/BloomVersionMachine.hpp"
+#include "CommandPackets/RuntimeStats.hpp"
 #include "CommandPackets/GenerateSvd.hpp"
 #include "CommandPackets/Detach.hpp"
 #include "CommandPackets/EepromFill.hpp"
+#include "CommandPackets/DumpMemory.hpp"
+#include "CommandPackets/RestoreMemory.hpp"
+#include "CommandPackets/CaptureSnapshot.hpp"
+#include "CommandPackets/LoadProgramImage.hpp"
+#include "CommandPackets/Profile.hpp"
+#include "CommandPackets/Coverage.hpp"
+#include "CommandPackets/LiveSampling.hpp"
+#include "CommandPackets/SymbolLookup.hpp"
+#include "CommandPackets/SourceLineStep.hpp"
+#include "CommandPackets/StepOverInstruction.hpp"
+#include "CommandPackets/RegisterDump.hpp"
+#include "CommandPackets/TimingAnalysis.hpp"
+#include "CommandPackets/Checkpoint.hpp"
+#include "CommandPackets/MemoryTimeline.hpp"
+#include "CommandPackets/StartNoAckMode.hpp"
+#include "CommandPackets/SetNonStopMode.hpp"
+#include "CommandPackets/AcknowledgeStopNotification.hpp"
+#include "CommandPackets/InitTrace.hpp"
+#include "CommandPackets/DefineTracepoint.hpp"
+#include "CommandPackets/StartTrace.hpp"
+#include "CommandPackets/StopTrace.hpp"
+#include "CommandPackets/TraceStatusQuery.hpp"
+#include "CommandPackets/SelectTraceFrame.hpp"
+#include "CommandPackets/SetTraceOption.hpp"
+#include "CommandPackets/SymbolQuery.hpp"
+#include "CommandPackets/ThreadListQuery.hpp"
+#include "CommandPackets/ThreadExtraInfoQuery.hpp"
+#include "CommandPackets/CurrentThreadQuery.hpp"
+#include "CommandPackets/SelectThread.hpp"
+#include "CommandPackets/ThreadAliveQuery.hpp"
 
 // Response packets
 #include "ResponsePackets/TargetStopped.hpp"
+#include "ResponsePackets/ResponsePacket.hpp"
 
 #include "src/Services/ProcessService.hpp"
+#include "src/Services/TraceService.hpp"
+#include "src/Services/MetricsService.hpp"
 
 namespace Bloom::DebugServer::Gdb
 {
@@ -59,13 +108,176 @@ namespace Bloom::DebugServer::Gdb
     {}
 
     void GdbRspDebugServer::init() {
-        this->socketAddress.sin_family = AF_INET;
-        this->socketAddress.sin_port = htons(this->debugServerConfig.listeningPortNumber);
+        const auto socketFileDescriptor = this->debugServerConfig.unixSocketPath.has_value()
+            ? this->createUnixServerSocket(*(this->debugServerConfig.unixSocketPath))
+            : this->createTcpServerSocket(this->debugServerConfig.listeningPortNumber);
+
+        // These options are inherited by the client sockets accepted on this socket
+        if (this->debugServerConfig.socketSendBufferSize.has_value()) {
+            const auto sendBufferSize = static_cast<int>(this->debugServerConfig.socketSendBufferSize.value());
+
+            if (::setsockopt(
+                    socketFileDescriptor,
+                    SOL_SOCKET,
+                    SO_SNDBUF,
+                    &(sendBufferSize),
+                    sizeof(sendBufferSize)
+                ) < 0
+            ) {
+                Logger::error("Failed to set socket SO_SNDBUF option.");
+            }
+        }
+
+        if (this->debugServerConfig.socketReceiveBufferSize.has_value()) {
+            const auto receiveBufferSize = static_cast<int>(this->debugServerConfig.socketReceiveBufferSize.value());
+
+            if (::setsockopt(
+                    socketFileDescriptor,
+                    SOL_SOCKET,
+                    SO_RCVBUF,
+                    &(receiveBufferSize),
+                    sizeof(receiveBufferSize)
+                ) < 0
+            ) {
+                Logger::error("Failed to set socket SO_RCVBUF option.");
+            }
+        }
+
+        this->serverSocketFileDescriptor = socketFileDescriptor;
+
+        /*
+         * We start listening straight away, so that GDB can connect whilst the TargetController is still acquiring
+         * the hardware. The connection will be serviced once the TargetController is ready.
+         */
+        if (::listen(this->serverSocketFileDescriptor.value(), 3) != 0) {
+            throw Exception("Failed to listen on server socket");
+        }
+
+        this->eventLoop.watch(
+            this->serverSocketFileDescriptor.value(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                this->connectionPending = true;
+            }
+        );
+
+        this->eventLoop.watch(
+            this->interruptEventNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                this->interruptEventNotifier.clear();
+                this->interrupted = true;
+            }
+        );
+
+        this->eventLoop.watch(
+            this->executionEventNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                /*
+                 * There is no GDB client waiting on the target, so there's not much to do here - the event handlers
+                 * will just discard these events, but we must dispatch them to prevent them from piling up in the
+                 * queue.
+                 */
+                this->executionEventNotifier.clear();
+                this->executionEventListener->dispatchCurrentEvents();
+                this->interrupted = true;
+            }
+        );
+
+        if (this->debugServerConfig.unixSocketPath.has_value()) {
+            Logger::info("GDB RSP Unix domain socket: " + *(this->debugServerConfig.unixSocketPath));
+
+        } else {
+            Logger::info("GDB RSP address: " + this->debugServerConfig.listeningAddress);
+            Logger::info("GDB RSP port: " + std::to_string(this->debugServerConfig.listeningPortNumber));
+        }
+
+        if (this->debugServerConfig.observerPortNumber.has_value()) {
+            try {
+                const auto observerSocketFileDescriptor = this->createTcpServerSocket(
+                    *(this->debugServerConfig.observerPortNumber)
+                );
+
+                if (::listen(observerSocketFileDescriptor, 3) != 0) {
+                    ::close(observerSocketFileDescriptor);
+                    throw Exception("Failed to listen on observer socket");
+                }
+
+                this->observerServerSocketFileDescriptor = observerSocketFileDescriptor;
+                Logger::info("GDB RSP observer port: " + std::to_string(*(this->debugServerConfig.observerPortNumber)));
+
+            } catch (const Exception& exception) {
+                Logger::error(exception.getMessage() + " - observer connections will not be accepted");
+            }
+        }
+
+        this->eventListener.registerCallbackForEventType<Events::TargetControllerStateChanged>(
+            std::bind(&GdbRspDebugServer::onTargetControllerStateChanged, this, std::placeholders::_1)
+        );
+
+        this->executionEventListener->setInterruptEventNotifier(&this->executionEventNotifier);
+
+        this->executionEventListener->registerCallbackForEventType<Events::TargetExecutionStopped>(
+            std::bind(&GdbRspDebugServer::onTargetExecutionStopped, this, std::placeholders::_1)
+        );
+
+        this->executionEventListener->registerCallbackForEventType<Events::TargetExecutionResumed>(
+            std::bind(&GdbRspDebugServer::onTargetExecutionResumed, this, std::placeholders::_1)
+        );
+
+        EventManager::registerListener(this->executionEventListener);
+
+        if (this->debugServerConfig.packetCaptureFilePath.has_value()) {
+            try {
+                this->packetCapture = std::make_unique<PacketCapture>(*(this->debugServerConfig.packetCaptureFilePath));
+
+            } catch (const Exception& exception) {
+                Logger::error(exception.getMessage() + " - packets will not be captured");
+            }
+        }
+
+        if (Services::ProcessService::isManagedByClion()) {
+            Logger::warning(
+                "Bloom's process is being managed by CLion - Bloom will automatically shutdown upon detaching from GDB."
+            );
+        }
+    }
+
+    void GdbRspDebugServer::close() {
+        this->observerServer.reset();
+        this->activeDebugSession.reset();
+        this->packetCapture.reset();
+
+        EventManager::deregisterListener(this->executionEventListener->getId());
+        this->executionEventListener->setInterruptEventNotifier(nullptr);
+
+        if (this->serverSocketFileDescriptor.has_value()) {
+            this->eventLoop.unwatch(this->serverSocketFileDescriptor.value());
+            ::close(this->serverSocketFileDescriptor.value());
+
+            const auto& unixSocketPath = this->debugServerConfig.unixSocketPath;
+            if (unixSocketPath.has_value() && !unixSocketPath->starts_with('@')) {
+                ::unlink(unixSocketPath->c_str());
+            }
+        }
+
+        if (this->observerServerSocketFileDescriptor.has_value()) {
+            // The observer server was never started
+            ::close(this->observerServerSocketFileDescriptor.value());
+            this->observerServerSocketFileDescriptor = std::nullopt;
+        }
+    }
+
+    int GdbRspDebugServer::createTcpServerSocket(std::uint16_t portNumber) {
+        auto socketAddress = sockaddr_in{};
+        socketAddress.sin_family = AF_INET;
+        socketAddress.sin_port = htons(portNumber);
 
         if (::inet_pton(
                 AF_INET,
                 this->debugServerConfig.listeningAddress.c_str(),
-                &(this->socketAddress.sin_addr)
+                &(socketAddress.sin_addr)
             ) == 0
         ) {
             // Invalid IP address
@@ -75,9 +287,9 @@ namespace Bloom::DebugServer::Gdb
             );
         }
 
-        int socketFileDescriptor = 0;
+        const auto socketFileDescriptor = ::socket(AF_INET, SOCK_STREAM, 0);
 
-        if ((socketFileDescriptor = ::socket(AF_INET, SOCK_STREAM, 0)) == 0) {
+        if (socketFileDescriptor < 0) {
             throw Exception("Failed to create socket file descriptor.");
         }
 
@@ -94,55 +306,94 @@ namespace Bloom::DebugServer::Gdb
             Logger::error("Failed to set socket SO_REUSEADDR option.");
         }
 
+        /*
+         * The options below are inherited by the client sockets accepted on this socket.
+         *
+         * GDB RSP traffic consists of small request/response exchanges, so we disable Nagle's algorithm to prevent
+         * small packets from being held back. Connection::flush() coalesces our output, to keep the number of
+         * segments down.
+         */
+        const auto enableNoDelaySocketOption = 1;
+
+        if (::setsockopt(
+                socketFileDescriptor,
+                IPPROTO_TCP,
+                TCP_NODELAY,
+                &(enableNoDelaySocketOption),
+                sizeof(enableNoDelaySocketOption)
+            ) < 0
+        ) {
+            Logger::error("Failed to set socket TCP_NODELAY option.");
+        }
+
         if (::bind(
                 socketFileDescriptor,
-                reinterpret_cast<const sockaddr*>(&(this->socketAddress)),
-                sizeof(this->socketAddress)
+                reinterpret_cast<const sockaddr*>(&socketAddress),
+                sizeof(socketAddress)
             ) < 0
         ) {
+            ::close(socketFileDescriptor);
             throw Exception("Failed to bind address. The selected port number ("
-                + std::to_string(this->debugServerConfig.listeningPortNumber) + ") may be in use.");
+                + std::to_string(portNumber) + ") may be in use.");
         }
 
-        this->serverSocketFileDescriptor = socketFileDescriptor;
+        return socketFileDescriptor;
+    }
 
-        this->epollInstance.addEntry(
-            this->serverSocketFileDescriptor.value(),
-            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
-        );
+    int GdbRspDebugServer::createUnixServerSocket(const std::string& socketPath) {
+        auto socketAddress = sockaddr_un{};
+        socketAddress.sun_family = AF_UNIX;
 
-        this->epollInstance.addEntry(
-            this->interruptEventNotifier.getFileDescriptor(),
-            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
-        );
+        // The path must fit in sun_path, along with the (non-abstract) null terminator
+        if (socketPath.size() >= sizeof(socketAddress.sun_path)) {
+            throw InvalidConfig(
+                "Unix domain socket path provided in config file is too long: (\"" + socketPath + "\"). The path "
+                    "must not exceed " + std::to_string(sizeof(socketAddress.sun_path) - 1) + " characters."
+            );
+        }
 
-        Logger::info("GDB RSP address: " + this->debugServerConfig.listeningAddress);
-        Logger::info("GDB RSP port: " + std::to_string(this->debugServerConfig.listeningPortNumber));
+        const auto abstract = socketPath.starts_with('@');
+        std::copy(socketPath.begin(), socketPath.end(), socketAddress.sun_path);
 
-        this->eventListener.registerCallbackForEventType<Events::TargetControllerStateChanged>(
-            std::bind(&GdbRspDebugServer::onTargetControllerStateChanged, this, std::placeholders::_1)
-        );
+        if (abstract) {
+            // Abstract socket names begin with a null byte, and are not null terminated
+            socketAddress.sun_path[0] = '\0';
 
-        this->eventListener.registerCallbackForEventType<Events::TargetExecutionStopped>(
-            std::bind(&GdbRspDebugServer::onTargetExecutionStopped, this, std::placeholders::_1)
-        );
+        } else {
+            /*
+             * A socket file left behind by a previous instance (one that didn't shut down cleanly, for example)
+             * would cause the bind to fail. We only remove sockets - never regular files.
+             */
+            struct stat fileStatus = {};
+            if (::stat(socketPath.c_str(), &fileStatus) == 0 && S_ISSOCK(fileStatus.st_mode)) {
+                ::unlink(socketPath.c_str());
+            }
+        }
 
-        this->eventListener.registerCallbackForEventType<Events::TargetExecutionResumed>(
-            std::bind(&GdbRspDebugServer::onTargetExecutionResumed, this, std::placeholders::_1)
+        const auto socketFileDescriptor = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (socketFileDescriptor < 0) {
+            throw Exception("Failed to create socket file descriptor.");
+        }
+
+        const auto addressLength = static_cast<socklen_t>(
+            offsetof(sockaddr_un, sun_path) + socketPath.size() + (abstract ? 0 : 1)
         );
 
-        if (Services::ProcessService::isManagedByClion()) {
-            Logger::warning(
-                "Bloom's process is being managed by CLion - Bloom will automatically shutdown upon detaching from GDB."
-            );
+        if (::bind(socketFileDescriptor, reinterpret_cast<const sockaddr*>(&socketAddress), addressLength) < 0) {
+            ::close(socketFileDescriptor);
+            throw Exception("Failed to bind Unix domain socket (\"" + socketPath + "\") - the path may be in use.");
         }
+
+        return socketFileDescriptor;
     }
 
-    void GdbRspDebugServer::close() {
+    void GdbRspDebugServer::endDebugSession() {
         this->activeDebugSession.reset();
 
-        if (this->serverSocketFileDescriptor.has_value()) {
-            ::close(this->serverSocketFileDescriptor.value());
+        if (this->debugServerConfig.sessionLingerPeriod > 0) {
+            this->debugSessionLingerDeadline = std::chrono::steady_clock::now()
+                + std::chrono::milliseconds(this->debugServerConfig.sessionLingerPeriod);
         }
     }
 
@@ -153,7 +404,9 @@ namespace Bloom::DebugServer::Gdb
 
                 auto connection = this->waitForConnection();
 
-                Logger::info("Accepted GDP RSP connection from " + connection.getIpAddress());
+                Logger::info("Accepted GDP RSP connection from " + connection.getClientAddress());
+                connection.setWakeupNotifier(this->executionEventNotifier);
+                connection.setPacketCapture(this->packetCapture.get());
 
                 this->activeDebugSession.emplace(
                     std::move(connection),
@@ -181,19 +434,63 @@ namespace Bloom::DebugServer::Gdb
                     }
                 }
 
-                this->targetControllerService.stopTargetExecution();
-                this->targetControllerService.resetTarget();
+                const auto lingerDeadline = std::exchange(this->debugSessionLingerDeadline, std::nullopt);
+
+                /*
+                 * The TargetController holds the target stopped for the duration of the linger period. If the target
+                 * isn't stopped, the period must have expired (or the TargetController was suspended in the meantime).
+                 */
+                if (
+                    lingerDeadline.has_value()
+                    && std::chrono::steady_clock::now() < *lingerDeadline
+                    && this->targetControllerService.getTargetState() == Targets::TargetState::STOPPED
+                ) {
+                    Logger::info("Resuming lingering debug session");
+
+                } else {
+                    this->targetControllerService.stopTargetExecution();
+                    this->targetControllerService.resetTarget();
+                }
+
+                if (this->observerServerSocketFileDescriptor.has_value()) {
+                    /*
+                     * The GDB target descriptor has been constructed by now, so the observer thread's use of
+                     * GdbRspDebugServer::resolveCommandPacket() doesn't conflict with the DebugServer thread.
+                     */
+                    this->observerServer = std::make_unique<ObserverServer>(
+                        std::exchange(this->observerServerSocketFileDescriptor, std::nullopt).value(),
+                        this->debugServerConfig,
+                        this->getGdbTargetDescriptor(),
+                        this->getSupportedFeatures(),
+                        [this] (const RawPacket& rawPacket) {
+                            return this->resolveCommandPacket(rawPacket);
+                        },
+                        [this] (const CommandPacket& commandPacket) {
+                            return this->isObserverCommandPacket(commandPacket);
+                        }
+                    );
+                }
             }
 
             const auto commandPacket = this->waitForCommandPacket();
 
-            if (commandPacket) {
+            if (commandPacket == nullptr) {
+                // A target execution event occurred - service it now, so that any stop reply goes out immediately
+                this->executionEventListener->dispatchCurrentEvents();
+                return;
+            }
+
+            {
+                this->packetCounter(typeid(*commandPacket)).increment();
+
+                // The (mangled) type name identifies the packet. It has static storage duration.
+                const auto traceSpan = Services::TraceService::Span(typeid(*commandPacket).name(), "CommandPacket");
                 commandPacket->handle(this->activeDebugSession.value(), this->targetControllerService);
             }
 
         } catch (const ClientDisconnected&) {
             Logger::info("GDB RSP client disconnected");
-            this->activeDebugSession.reset();
+            this->endDebugSession();
             return;
 
         } catch (const ClientCommunicationError& exception) {
@@ -221,28 +518,59 @@ namespace Bloom::DebugServer::Gdb
     }
 
     Connection GdbRspDebugServer::waitForConnection() {
-        if (::listen(this->serverSocketFileDescriptor.value(), 3) != 0) {
-            throw Exception("Failed to listen on server socket");
-        }
+        this->connectionPending = false;
+        this->interrupted = false;
 
-        const auto eventFileDescriptor = this->epollInstance.waitForEvent();
+        this->eventLoop.runOnce();
 
-        if (
-            !eventFileDescriptor.has_value()
-            || eventFileDescriptor.value() == this->interruptEventNotifier.getFileDescriptor()
-        ) {
-            this->interruptEventNotifier.clear();
+        if (this->interrupted || !this->connectionPending) {
+            /*
+             * If a connection arrived in the same batch as the interruption, it will remain in the listen backlog,
+             * and we'll accept it on the next call.
+             */
             throw DebugServerInterrupted();
         }
 
         return Connection(
             this->serverSocketFileDescriptor.value(),
-            this->interruptEventNotifier
+            this->interruptEventNotifier,
+            this->debugServerConfig.packetSize
         );
     }
 
+    Services::MetricsService::Counter& GdbRspDebugServer::packetCounter(const std::type_info& packetType) {
+        const auto counterIt = this->packetCountersByType.find(std::type_index(packetType));
+        if (counterIt != this->packetCountersByType.end()) {
+            return *(counterIt->second);
+        }
+
+        auto packetName = std::string(packetType.name());
+
+        auto demangleStatus = int(0);
+        auto* demangledName = ::abi::__cxa_demangle(packetType.name(), nullptr, nullptr, &demangleStatus);
+        if (demangleStatus == 0 && demangledName != nullptr) {
+            packetName = demangledName;
+
+            const auto namespaceDelimiterPos = packetName.rfind("::");
+            if (namespaceDelimiterPos != std::string::npos) {
+                packetName = packetName.substr(namespaceDelimiterPos + 2);
+            }
+        }
+
+        std::free(demangledName);
+
+        auto& counter = Services::MetricsService::counter("gdb.packets." + packetName);
+        this->packetCountersByType.emplace(std::type_index(packetType), &counter);
+        return counter;
+    }
+
     std::unique_ptr<CommandPacket> GdbRspDebugServer::waitForCommandPacket() {
-        const auto rawPackets = this->activeDebugSession->connection.readRawPackets();
+        auto& connection = this->activeDebugSession->connection;
+        auto rawPackets = connection.readRawPackets();
+
+        if (rawPackets.empty()) {
+            return nullptr;
+        }
 
         if (rawPackets.size() > 1) {
             const auto& firstRawPacket = rawPackets.front();
@@ -256,7 +584,12 @@ namespace Bloom::DebugServer::Gdb
             Logger::warning("Multiple packets received from GDB - only the most recent will be processed");
         }
 
-        return this->resolveCommandPacket(rawPackets.back());
+        auto commandPacket = this->resolveCommandPacket(rawPackets.back());
+
+        // The command packet holds its own copy of the packet data, so the raw packet buffers can be reused.
+        connection.recycleRawPackets(std::move(rawPackets));
+
+        return commandPacket;
     }
 
     std::unique_ptr<CommandPacket> GdbRspDebugServer::resolveCommandPacket(const RawPacket& rawPacket) {
@@ -269,7 +602,10 @@ namespace Bloom::DebugServer::Gdb
             return std::make_unique<CommandPackets::Detach>(rawPacket);
         }
 
-        const auto rawPacketString = std::string(rawPacket.begin(), rawPacket.end());
+        const auto rawPacketString = std::string_view(
+            reinterpret_cast<const char*>(rawPacket.data()),
+            rawPacket.size()
+        );
 
         if (rawPacketString.size() >= 2) {
             /*
@@ -280,6 +616,70 @@ namespace Bloom::DebugServer::Gdb
                 return std::make_unique<CommandPackets::SupportedFeaturesQuery>(rawPacket);
             }
 
+            if (rawPacketString.find("QStartNoAckMode") == 1) {
+                return std::make_unique<CommandPackets::StartNoAckMode>(rawPacket);
+            }
+
+            if (rawPacketString.find("QNonStop:") == 1) {
+                return std::make_unique<CommandPackets::SetNonStopMode>(rawPacket);
+            }
+
+            if (rawPacketString.find("vStopped") == 1) {
+                return std::make_unique<CommandPackets::AcknowledgeStopNotification>(rawPacket);
+            }
+
+            if (rawPacketString.find("QTinit") == 1) {
+                return std::make_unique<CommandPackets::InitTrace>(rawPacket);
+            }
+
+            if (rawPacketString.find("QTDP:") == 1) {
+                return std::make_unique<CommandPackets::DefineTracepoint>(rawPacket);
+            }
+
+            if (rawPacketString.find("QTStart") == 1) {
+                return std::make_unique<CommandPackets::StartTrace>(rawPacket);
+            }
+
+            if (rawPacketString.find("QTStop") == 1) {
+                return std::make_unique<CommandPackets::StopTrace>(rawPacket);
+            }
+
+            if (rawPacketString.find("qTStatus") == 1) {
+                return std::make_unique<CommandPackets::TraceStatusQuery>(rawPacket);
+            }
+
+            if (rawPacketString.find("QTFrame:") == 1) {
+                return std::make_unique<CommandPackets::SelectTraceFrame>(rawPacket);
+            }
+
+            if (rawPacketString.find("QTro") == 1 || rawPacketString.find("QTBuffer:") == 1) {
+                return std::make_unique<CommandPackets::SetTraceOption>(rawPacket);
+            }
+
+            if (rawPacketString.find("qSymbol:") == 1) {
+                return std::make_unique<CommandPackets::SymbolQuery>(rawPacket);
+            }
+
+            if (rawPacketString.find("qfThreadInfo") == 1 || rawPacketString.find("qsThreadInfo") == 1) {
+                return std::make_unique<CommandPackets::ThreadListQuery>(rawPacket);
+            }
+
+            if (rawPacketString.find("qThreadExtraInfo,") == 1) {
+                return std::make_unique<CommandPackets::ThreadExtraInfoQuery>(rawPacket);
+            }
+
+            if (rawPacketString.find("qC#") == 1) {
+                return std::make_unique<CommandPackets::CurrentThreadQuery>(rawPacket);
+            }
+
+            if (rawPacketString[1] == 'H') {
+                return std::make_unique<CommandPackets::SelectThread>(rawPacket);
+            }
+
+            if (rawPacketString[1] == 'T') {
+                return std::make_unique<CommandPackets::ThreadAliveQuery>(rawPacket);
+            }
+
             if (rawPacketString[1] == 'g' || rawPacketString[1] == 'p') {
                 return std::make_unique<CommandPackets::ReadRegisters>(rawPacket);
             }
@@ -296,6 +696,14 @@ namespace Bloom::DebugServer::Gdb
                 return std::make_unique<CommandPackets::StepExecution>(rawPacket);
             }
 
+            if (rawPacketString.find("vCont?") == 1) {
+                return std::make_unique<CommandPackets::VContSupportedActionsQuery>(rawPacket);
+            }
+
+            if (rawPacketString.find("vCont;") == 1) {
+                return std::make_unique<CommandPackets::VContExecution>(rawPacket);
+            }
+
             if (rawPacketString[1] == 'Z') {
                 return std::make_unique<CommandPackets::SetBreakpoint>(rawPacket);
             }
@@ -320,6 +728,10 @@ namespace Bloom::DebugServer::Gdb
                     return std::make_unique<CommandPackets::BloomVersionMachine>(std::move(*(monitorCommand.release())));
                 }
 
+                if (monitorCommand->command == "stats") {
+                    return std::make_unique<CommandPackets::RuntimeStats>(std::move(*(monitorCommand.release())));
+                }
+
                 if (monitorCommand->command == "reset") {
                     return std::make_unique<CommandPackets::ResetTarget>(std::move(*(monitorCommand.release())));
                 }
@@ -332,6 +744,64 @@ namespace Bloom::DebugServer::Gdb
                     return std::make_unique<CommandPackets::EepromFill>(std::move(*(monitorCommand.release())));
                 }
 
+                if (monitorCommand->command == "dump" || monitorCommand->command.find("dump ") == 0) {
+                    return std::make_unique<CommandPackets::DumpMemory>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command == "restore" || monitorCommand->command.find("restore ") == 0) {
+                    return std::make_unique<CommandPackets::RestoreMemory>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command == "snapshot" || monitorCommand->command.find("snapshot ") == 0) {
+                    return std::make_unique<CommandPackets::CaptureSnapshot>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command.find("profile") == 0) {
+                    return std::make_unique<CommandPackets::Profile>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command.find("coverage") == 0) {
+                    return std::make_unique<CommandPackets::Coverage>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command.find("sample") == 0) {
+                    return std::make_unique<CommandPackets::LiveSampling>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command.find("step-line") == 0) {
+                    return std::make_unique<CommandPackets::SourceLineStep>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command.find("step-over") == 0) {
+                    return std::make_unique<CommandPackets::StepOverInstruction>(
+                        std::move(*(monitorCommand.release()))
+                    );
+                }
+
+                if (monitorCommand->command == "regdump" || monitorCommand->command.find("regdump ") == 0) {
+                    return std::make_unique<CommandPackets::RegisterDump>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command.find("timing") == 0) {
+                    return std::make_unique<CommandPackets::TimingAnalysis>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command.find("checkpoint") == 0) {
+                    return std::make_unique<CommandPackets::Checkpoint>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command.find("timeline") == 0) {
+                    return std::make_unique<CommandPackets::MemoryTimeline>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command == "symbol" || monitorCommand->command.find("symbol ") == 0) {
+                    return std::make_unique<CommandPackets::SymbolLookup>(std::move(*(monitorCommand.release())));
+                }
+
+                if (monitorCommand->command == "load" || monitorCommand->command.find("load ") == 0) {
+                    return std::make_unique<CommandPackets::LoadProgramImage>(std::move(*(monitorCommand.release())));
+                }
+
                 return monitorCommand;
             }
         }
@@ -342,9 +812,34 @@ namespace Bloom::DebugServer::Gdb
     std::set<std::pair<Feature, std::optional<std::string>>> GdbRspDebugServer::getSupportedFeatures() {
         return {
             {Feature::SOFTWARE_BREAKPOINTS, std::nullopt},
+            {Feature::NO_ACK_MODE, std::nullopt},
+            {Feature::NON_STOP_MODE, std::nullopt},
+            {Feature::CONDITIONAL_BREAKPOINTS, std::nullopt},
+            {Feature::CONDITIONAL_TRACEPOINTS, std::nullopt},
         };
     }
 
+    bool GdbRspDebugServer::isObserverCommandPacket(const CommandPacket& commandPacket) const {
+        static const auto observerCommandPacketTypes = std::set<std::type_index>({
+            // The base class handles status reports ('?'), qAttached, vMustReplyEmpty and unknown packets
+            typeid(CommandPacket),
+            typeid(CommandPackets::SupportedFeaturesQuery),
+            typeid(CommandPackets::StartNoAckMode),
+            typeid(CommandPackets::SetNonStopMode),
+            typeid(CommandPackets::AcknowledgeStopNotification),
+            typeid(CommandPackets::VContSupportedActionsQuery),
+            typeid(CommandPackets::ReadRegisters),
+            typeid(CommandPackets::SymbolQuery),
+            typeid(CommandPackets::ThreadListQuery),
+            typeid(CommandPackets::ThreadExtraInfoQuery),
+            typeid(CommandPackets::CurrentThreadQuery),
+            typeid(CommandPackets::SelectThread),
+            typeid(CommandPackets::ThreadAliveQuery),
+        });
+
+        return observerCommandPacketTypes.contains(std::type_index(typeid(commandPacket)));
+    }
+
     void GdbRspDebugServer::onTargetControllerStateChanged(const Events::TargetControllerStateChanged& event) {
         if (event.state == TargetControllerState::SUSPENDED && this->activeDebugSession.has_value()) {
             Logger::warning("TargetController suspended unexpectedly - terminating debug session");
@@ -352,18 +847,62 @@ namespace Bloom::DebugServer::Gdb
         }
     }
 
-    void GdbRspDebugServer::onTargetExecutionStopped(const Events::TargetExecutionStopped&) {
+    void GdbRspDebugServer::onTargetExecutionStopped(const Events::TargetExecutionStopped& event) {
         try {
             if (this->activeDebugSession.has_value() && this->activeDebugSession->waitingForBreak) {
-                this->activeDebugSession->connection.writePacket(
-                    ResponsePackets::TargetStopped(Signal::TRAP)
-                );
-                this->activeDebugSession->waitingForBreak = false;
+                auto& debugSession = *(this->activeDebugSession);
+
+                if (debugSession.pendingMonitorStep) {
+                    // The client is waiting for the output of a "monitor step-line/step-over" command, not a stop reply
+                    debugSession.connection.writePacket(ResponsePackets::ResponsePacket(
+                        Services::StringService::toHex(
+                            CommandPackets::SourceLineStep::stopDescription(event.programCounter)
+                        )
+                    ));
+
+                    debugSession.pendingMonitorStep = false;
+                    debugSession.waitingForBreak = false;
+                    return;
+                }
+
+                if (
+                    !debugSession.steppingExecution
+                    && !debugSession.watchpoints.empty()
+                    && !debugSession.breakpointAddresses.contains(event.programCounter)
+                ) {
+                    /*
+                     * The debug tool doesn't tell us which comparator triggered the break, so we report the first
+                     * watchpoint. For write watchpoints, GDB will check the values of all watched expressions
+                     * anyway.
+                     */
+                    const auto& [watchpointAddress, watchpointType] = *(debugSession.watchpoints.begin());
+
+                    debugSession.reportTargetStopped(
+                        ResponsePackets::TargetStopped(
+                            Signal::TRAP,
+                            watchpointType == BreakpointType::READ_WATCHPOINT
+                                ? StopReason::READ_WATCHPOINT
+                                : watchpointType == BreakpointType::ACCESS_WATCHPOINT
+                                    ? StopReason::ACCESS_WATCHPOINT
+                                    : StopReason::WRITE_WATCHPOINT,
+                            watchpointAddress
+                        ),
+                        this->targetControllerService
+                    );
+
+                } else {
+                    debugSession.reportTargetStopped(
+                        ResponsePackets::TargetStopped(Signal::TRAP),
+                        this->targetControllerService
+                    );
+                }
+
+                debugSession.waitingForBreak = false;
             }
 
         } catch (const ClientDisconnected&) {
             Logger::info("GDB RSP client disconnected");
-            this->activeDebugSession.reset();
+            this->endDebugSession();
             return;
 
         } catch (const ClientCommunicationError& exception) {
@@ -382,6 +921,10 @@ namespace Bloom::DebugServer::Gdb
 
     void GdbRspDebugServer::onTargetExecutionResumed(const Events::TargetExecutionResumed&) {
         try {
+            if (this->activeDebugSession.has_value() && this->activeDebugSession->rtosThreadAwareness.has_value()) {
+                this->activeDebugSession->rtosThreadAwareness->invalidate();
+            }
+
             if (
                 this->activeDebugSession.has_value()
                 && this->activeDebugSession->pendingInterrupt
@@ -390,8 +933,9 @@ namespace Bloom::DebugServer::Gdb
                 Logger::info("Servicing pending interrupt");
                 this->targetControllerService.stopTargetExecution();
 
-                this->activeDebugSession->connection.writePacket(
-                    ResponsePackets::TargetStopped(Signal::INTERRUPTED)
+                this->activeDebugSession->reportTargetStopped(
+                    ResponsePackets::TargetStopped(Signal::INTERRUPTED),
+                    this->targetControllerService
                 );
 
                 this->activeDebugSession->pendingInterrupt = false;
@@ -400,7 +944,7 @@ namespace Bloom::DebugServer::Gdb
 
         } catch (const ClientDisconnected&) {
             Logger::info("GDB RSP client disconnected");
-            this->activeDebugSession.reset();
+            this->endDebugSession();
             return;
 
         } catch (const ClientCommunicationError& exception) {
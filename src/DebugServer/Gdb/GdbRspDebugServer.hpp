@@ -6,18 +6,24 @@
 #include <vector>
 #include <queue>
 #include <optional>
+#include <chrono>
+#include <typeindex>
+#include <unordered_map>
 
 #include "src/DebugServer/ServerInterface.hpp"
 
 #include "GdbDebugServerConfig.hpp"
 #include "src/EventManager/EventListener.hpp"
-#include "src/Helpers/EpollInstance.hpp"
+#include "src/Helpers/EventLoop.hpp"
 #include "src/Helpers/EventFdNotifier.hpp"
 #include "src/Services/TargetControllerService.hpp"
+#include "src/Services/MetricsService.hpp"
 
 #include "Connection.hpp"
+#include "PacketCapture.hpp"
 #include "TargetDescriptor.hpp"
 #include "DebugSession.hpp"
+#include "ObserverServer.hpp"
 #include "Signal.hpp"
 #include "RegisterDescriptor.hpp"
 #include "Feature.hpp"
@@ -97,18 +103,37 @@ namespace Bloom::DebugServer::Gdb
          */
         EventFdNotifier& interruptEventNotifier;
 
+        /**
+         * A dedicated event listener for target execution events (TargetExecutionStopped and TargetExecutionResumed).
+         *
+         * Unlike this->eventListener, this listener doesn't interrupt the server. Instead, it signals
+         * this->executionEventNotifier, which is monitored alongside the client socket (see
+         * Connection::setWakeupNotifier()). This allows us to service execution events (and deliver stop replies to
+         * the GDB client) as soon as they occur, without unwinding the current operation.
+         */
+        std::shared_ptr<EventListener> executionEventListener = std::make_shared<EventListener>(
+            "GdbRspDebugServerExecutionEventListener"
+        );
+
+        EventFdNotifier executionEventNotifier = EventFdNotifier();
+
         /**
          * When waiting for a connection, we don't listen on the this->serverSocketFileDescriptor directly. Instead,
-         * we use an EpollInstance to monitor both this->serverSocketFileDescriptor and this->interruptEventNotifier.
-         * This allows us to interrupt any blocking socket IO calls when EventFdNotifier::notify() is called on
-         * this->interruptEventNotifier.
+         * we use an EventLoop to monitor this->serverSocketFileDescriptor, this->interruptEventNotifier and
+         * this->executionEventNotifier. This allows us to interrupt any blocking socket IO calls when
+         * EventFdNotifier::notify() is called on this->interruptEventNotifier.
+         *
+         * The callbacks only record what happened, in the flags below. GdbRspDebugServer::waitForConnection() acts
+         * on them once the batch of events has been processed.
          *
          * See GdbRspDebugServer::init()
          * See DebugServer::interruptEventNotifier
-         * See EpollInstance
+         * See EventLoop
          * See EventFdNotifier
          */
-        EpollInstance epollInstance = EpollInstance();
+        EventLoop eventLoop;
+        bool connectionPending = false;
+        bool interrupted = false;
 
         /**
          * Passed to command handlers (see CommandPacket::handle()).
@@ -118,14 +143,23 @@ namespace Bloom::DebugServer::Gdb
         Services::TargetControllerService targetControllerService = Services::TargetControllerService();
 
         /**
-         * Listening socket address
+         * Listening socket file descriptor
          */
-        struct sockaddr_in socketAddress = {};
+        std::optional<int> serverSocketFileDescriptor;
 
         /**
-         * Listening socket file descriptor
+         * The listening socket for observer connections, if enabled (see GdbDebugServerConfig::observerPortNumber).
+         * Ownership of the socket passes to this->observerServer, once it's been started.
          */
-        std::optional<int> serverSocketFileDescriptor;
+        std::optional<int> observerServerSocketFileDescriptor;
+
+        /**
+         * Services observer connections, on its own thread. Started once the first debug session has been
+         * established, as the GDB target descriptor isn't available before then (and observers have nothing to
+         * watch until the target has been prepared for debugging). Connections made in the meantime wait in the
+         * listen backlog.
+         */
+        std::unique_ptr<ObserverServer> observerServer;
 
         /**
          * When a connection with a GDB client is established, a new instance of the DebugSession class is created and
@@ -133,15 +167,69 @@ namespace Bloom::DebugServer::Gdb
          */
         std::optional<DebugSession> activeDebugSession;
 
+        /**
+         * If the last debug session is lingering (see DebugServerConfig::sessionLingerPeriod), this holds the end of
+         * its linger period. A client that connects before then will not have the target reset on it.
+         */
+        std::optional<std::chrono::steady_clock::time_point> debugSessionLingerDeadline;
+
+        /**
+         * Present when packet capture is enabled (see GdbDebugServerConfig::packetCaptureFilePath). The capture
+         * covers all debug sessions, for the lifetime of the server.
+         */
+        std::unique_ptr<PacketCapture> packetCapture;
+
+        /**
+         * The "gdb.packets.*" counters, mapped by command packet type. See GdbRspDebugServer::packetCounter().
+         */
+        std::unordered_map<std::type_index, Services::MetricsService::Counter*> packetCountersByType;
+
+        /**
+         * Creates and binds a TCP socket, for the configured IP address and the given port number.
+         *
+         * @param portNumber
+         *
+         * @return
+         *  The socket's file descriptor.
+         */
+        int createTcpServerSocket(std::uint16_t portNumber);
+
+        /**
+         * Creates and binds a Unix domain socket, at the given path (or in the abstract namespace, if the path begins
+         * with '@'). See GdbDebugServerConfig::unixSocketPath.
+         *
+         * @param socketPath
+         *
+         * @return
+         *  The socket's file descriptor.
+         */
+        int createUnixServerSocket(const std::string& socketPath);
+
         /**
          * Waits for a GDB client to connect on the listening socket.
          */
         Connection waitForConnection();
 
+        /**
+         * Ends the active debug session, after the client disconnected, and starts its linger period (if configured).
+         */
+        void endDebugSession();
+
+        /**
+         * Returns the counter for the given command packet type. The counter is named after the (demangled and
+         * unqualified) class name of the command packet.
+         *
+         * @param packetType
+         * @return
+         */
+        Services::MetricsService::Counter& packetCounter(const std::type_info& packetType);
+
         /**
          * Waits for a command packet from the connected GDB client.
          *
          * @return
+         *  The command packet, or a nullptr if the wait was cut short by a target execution event (in which case, the
+         *  event should be dispatched via this->executionEventListener).
          */
         std::unique_ptr<CommandPackets::CommandPacket> waitForCommandPacket();
 
@@ -175,6 +263,20 @@ namespace Bloom::DebugServer::Gdb
          */
         virtual std::set<std::pair<Feature, std::optional<std::string>>> getSupportedFeatures();
 
+        /**
+         * Should determine whether the given command packet can be handled for an observer (see ObserverServer).
+         * Only command packets that have no effect on the target (or on the primary debug session) are permitted.
+         *
+         * Derived GDB server implementations should override this function to permit any read-only command packets
+         * that are specific to those implementations.
+         *
+         * This function is invoked on the observer thread.
+         *
+         * @param commandPacket
+         * @return
+         */
+        virtual bool isObserverCommandPacket(const CommandPackets::CommandPacket& commandPacket) const;
+
         /**
          * Should return the GDB target descriptor for the connected target.
          *
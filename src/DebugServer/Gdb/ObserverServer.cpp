@@ -0,0 +1,266 @@
+#include "ObserverServer.hpp"
+
+#include <unistd.h>
+#include <pthread.h>
+#include <typeinfo>
+#include <vector>
+
+#include "src/EventManager/EventManager.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "Signal.hpp"
+
+#include "Exceptions/ClientDisconnected.hpp"
+#include "Exceptions/ClientNotSupported.hpp"
+#include "Exceptions/ClientCommunicationError.hpp"
+
+#include "CommandPackets/Detach.hpp"
+#include "CommandPackets/InterruptExecution.hpp"
+
+#include "ResponsePackets/TargetStopped.hpp"
+#include "ResponsePackets/OkResponsePacket.hpp"
+#include "ResponsePackets/ErrorResponsePacket.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    using namespace Exceptions;
+
+    ObserverServer::Observer::Observer(
+        int serverSocketFileDescriptor,
+        const GdbDebugServerConfig& serverConfig,
+        const TargetDescriptor& gdbTargetDescriptor,
+        const std::set<std::pair<Feature, std::optional<std::string>>>& supportedFeatures
+    )
+        : debugSession(
+            Connection(serverSocketFileDescriptor, this->interruptEventNotifier, serverConfig.packetSize),
+            supportedFeatures,
+            gdbTargetDescriptor,
+            serverConfig,
+            true
+        )
+    {}
+
+    ObserverServer::ObserverServer(
+        int serverSocketFileDescriptor,
+        const GdbDebugServerConfig& serverConfig,
+        const TargetDescriptor& gdbTargetDescriptor,
+        const std::set<std::pair<Feature, std::optional<std::string>>>& supportedFeatures,
+        CommandPacketResolver resolveCommandPacket,
+        CommandPacketFilter isObserverCommandPacket
+    )
+        : serverSocketFileDescriptor(serverSocketFileDescriptor)
+        , serverConfig(serverConfig)
+        , gdbTargetDescriptor(gdbTargetDescriptor)
+        , supportedFeatures(supportedFeatures)
+        , resolveCommandPacket(std::move(resolveCommandPacket))
+        , isObserverCommandPacket(std::move(isObserverCommandPacket))
+    {
+        this->executionEventListener->setInterruptEventNotifier(&this->executionEventNotifier);
+
+        this->executionEventListener->registerCallbackForEventType<Events::TargetExecutionStopped>(
+            std::bind(&ObserverServer::onTargetExecutionStopped, this, std::placeholders::_1)
+        );
+
+        this->executionEventListener->registerCallbackForEventType<Events::TargetExecutionResumed>(
+            std::bind(&ObserverServer::onTargetExecutionResumed, this, std::placeholders::_1)
+        );
+
+        EventManager::registerListener(this->executionEventListener);
+
+        this->running = true;
+        this->observerThread = std::thread(&ObserverServer::run, this);
+    }
+
+    ObserverServer::~ObserverServer() {
+        this->running = false;
+        this->eventLoop.notify();
+
+        if (this->observerThread.joinable()) {
+            this->observerThread.join();
+        }
+
+        EventManager::deregisterListener(this->executionEventListener->getId());
+        this->executionEventListener->setInterruptEventNotifier(nullptr);
+
+        ::close(this->serverSocketFileDescriptor);
+    }
+
+    void ObserverServer::run() {
+        ::pthread_setname_np(::pthread_self(), "DS-OBSERVER");
+
+        // Observers must never hold up the primary client
+        this->targetControllerService.setCommandPriority(TargetController::Commands::CommandPriority::BACKGROUND);
+
+        this->eventLoop.watch(
+            this->serverSocketFileDescriptor,
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                this->acceptObserver();
+            }
+        );
+
+        this->eventLoop.watch(
+            this->executionEventNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                this->executionEventNotifier.clear();
+                this->executionEventListener->dispatchCurrentEvents();
+            }
+        );
+
+        while (this->running) {
+            this->eventLoop.runOnce();
+        }
+
+        for (const auto& [fileDescriptor, observer] : this->observersByFileDescriptor) {
+            this->eventLoop.unwatch(fileDescriptor);
+        }
+
+        this->observersByFileDescriptor.clear();
+
+        this->eventLoop.unwatch(this->executionEventNotifier.getFileDescriptor());
+        this->eventLoop.unwatch(this->serverSocketFileDescriptor);
+    }
+
+    void ObserverServer::acceptObserver() {
+        try {
+            auto observer = std::make_unique<Observer>(
+                this->serverSocketFileDescriptor,
+                this->serverConfig,
+                this->gdbTargetDescriptor,
+                this->supportedFeatures
+            );
+
+            const auto clientAddress = observer->debugSession.connection.getClientAddress();
+
+            if (this->observersByFileDescriptor.size() >= ObserverServer::MAXIMUM_OBSERVERS) {
+                Logger::warning(
+                    "Refused GDB RSP observer connection from " + clientAddress + " - too many observers connected "
+                        "(maximum: " + std::to_string(ObserverServer::MAXIMUM_OBSERVERS) + ")"
+                );
+                return;
+            }
+
+            const auto fileDescriptor = observer->debugSession.connection.getFileDescriptor();
+
+            this->eventLoop.watch(
+                fileDescriptor,
+                static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+                [this, fileDescriptor] (std::uint32_t) {
+                    const auto observerIt = this->observersByFileDescriptor.find(fileDescriptor);
+                    if (observerIt != this->observersByFileDescriptor.end()) {
+                        this->serviceObserver(*(observerIt->second));
+                    }
+                }
+            );
+
+            this->observersByFileDescriptor.emplace(fileDescriptor, std::move(observer));
+            Logger::info("Accepted GDB RSP observer connection from " + clientAddress);
+
+        } catch (const Bloom::Exceptions::Exception& exception) {
+            Logger::error("Failed to accept GDB RSP observer connection - " + exception.getMessage());
+        }
+    }
+
+    void ObserverServer::serviceObserver(Observer& observer) {
+        auto& debugSession = observer.debugSession;
+        const auto fileDescriptor = debugSession.connection.getFileDescriptor();
+
+        try {
+            /*
+             * The socket is readable, so this won't block for long - at worst, until the rest of a partially
+             * received packet arrives.
+             */
+            auto rawPackets = debugSession.connection.readRawPackets();
+
+            for (const auto& rawPacket : rawPackets) {
+                const auto commandPacket = this->resolveCommandPacket(rawPacket);
+                const auto& commandPacketType = typeid(*commandPacket);
+
+                if (commandPacketType == typeid(CommandPackets::InterruptExecution)) {
+                    // Observers have no control over target execution, so they have nothing to interrupt
+                    continue;
+                }
+
+                if (commandPacketType == typeid(CommandPackets::Detach)) {
+                    debugSession.connection.writePacket(ResponsePackets::OkResponsePacket());
+                    throw ClientDisconnected();
+                }
+
+                if (!this->isObserverCommandPacket(*commandPacket)) {
+                    Logger::debug("Refused " + std::string(commandPacketType.name()) + " packet from GDB RSP observer");
+                    debugSession.connection.writePacket(ResponsePackets::ErrorResponsePacket());
+                    continue;
+                }
+
+                commandPacket->handle(debugSession, this->targetControllerService);
+            }
+
+            debugSession.connection.recycleRawPackets(std::move(rawPackets));
+
+            // We won't read from the observer again until it sends something, so the responses must go out now
+            debugSession.connection.flush();
+
+        } catch (const ClientDisconnected&) {
+            Logger::info("GDB RSP observer disconnected");
+            this->disconnectObserver(fileDescriptor);
+
+        } catch (const ClientCommunicationError& exception) {
+            Logger::error(
+                "GDB RSP observer communication error - " + exception.getMessage() + " - closing connection"
+            );
+            this->disconnectObserver(fileDescriptor);
+
+        } catch (const ClientNotSupported& exception) {
+            Logger::error("Invalid GDB RSP observer - " + exception.getMessage() + " - closing connection");
+            this->disconnectObserver(fileDescriptor);
+        }
+    }
+
+    void ObserverServer::disconnectObserver(int fileDescriptor) {
+        this->eventLoop.unwatch(fileDescriptor);
+        this->observersByFileDescriptor.erase(fileDescriptor);
+    }
+
+    void ObserverServer::onTargetExecutionStopped(const Events::TargetExecutionStopped&) {
+        auto disconnectedFileDescriptors = std::vector<int>();
+
+        for (auto& [fileDescriptor, observer] : this->observersByFileDescriptor) {
+            auto& debugSession = observer->debugSession;
+
+            // All-stop observers never resume the target, so they're not waiting on a stop reply
+            if (!debugSession.nonStopMode) {
+                continue;
+            }
+
+            try {
+                debugSession.reportTargetStopped(
+                    ResponsePackets::TargetStopped(Signal::TRAP),
+                    this->targetControllerService
+                );
+
+            } catch (const ClientDisconnected&) {
+                Logger::info("GDB RSP observer disconnected");
+                disconnectedFileDescriptors.push_back(fileDescriptor);
+
+            } catch (const ClientCommunicationError& exception) {
+                Logger::error(
+                    "GDB RSP observer communication error - " + exception.getMessage() + " - closing connection"
+                );
+                disconnectedFileDescriptors.push_back(fileDescriptor);
+            }
+        }
+
+        for (const auto fileDescriptor : disconnectedFileDescriptors) {
+            this->disconnectObserver(fileDescriptor);
+        }
+    }
+
+    void ObserverServer::onTargetExecutionResumed(const Events::TargetExecutionResumed&) {
+        for (auto& [fileDescriptor, observer] : this->observersByFileDescriptor) {
+            if (observer->debugSession.rtosThreadAwareness.has_value()) {
+                observer->debugSession.rtosThreadAwareness->invalidate();
+            }
+        }
+    }
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <map>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <functional>
+
+#include "GdbDebugServerConfig.hpp"
+#include "TargetDescriptor.hpp"
+#include "DebugSession.hpp"
+#include "Feature.hpp"
+#include "CommandPackets/CommandPacket.hpp"
+
+#include "src/EventManager/EventListener.hpp"
+#include "src/Helpers/EventLoop.hpp"
+#include "src/Helpers/EventFdNotifier.hpp"
+#include "src/Services/TargetControllerService.hpp"
+
+#include "src/EventManager/Events/TargetExecutionStopped.hpp"
+#include "src/EventManager/Events/TargetExecutionResumed.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    /**
+     * Services observer connections - GDB clients (or scripts) that watch the target whilst it's being debugged by
+     * the primary client. Enabled via the 'observerPort' GDB debug server config parameter.
+     *
+     * Observers are confined to read operations (memory and register reads, target description and memory map
+     * transfers, thread queries, etc). Any other packet (execution, breakpoint and write packets, monitor commands)
+     * is refused with an error response. Run control stays with the primary debug session.
+     *
+     * All observers are serviced on a single thread ("DS-OBSERVER"), via an EventLoop, with their own
+     * TargetControllerService. Their commands are issued with the background priority, so they never hold up the
+     * primary client's commands, and they're mostly served from the TargetController's stop snapshot and memory
+     * caches - an observer typically reads what the primary client has just read.
+     *
+     * Observers in non-stop mode are notified of target stops, via "%Stop" notifications.
+     *
+     * Observer debug sessions do not trigger the DebugSessionStarted and DebugSessionFinished events, so connecting
+     * and disconnecting observers has no effect on the target (see DebugSession::observer).
+     */
+    class ObserverServer
+    {
+    public:
+        using CommandPacketResolver = std::function<
+            std::unique_ptr<CommandPackets::CommandPacket>(const RawPacket& rawPacket)
+        >;
+
+        using CommandPacketFilter = std::function<bool(const CommandPackets::CommandPacket& commandPacket)>;
+
+        /**
+         * The maximum number of concurrent observers. Any further connections are closed as soon as they're
+         * accepted.
+         */
+        static constexpr std::size_t MAXIMUM_OBSERVERS = 8;
+
+        /**
+         * Starts the observer thread.
+         *
+         * @param serverSocketFileDescriptor
+         *  The (listening) observer socket. The ObserverServer takes ownership of the socket.
+         *
+         * @param serverConfig
+         * @param gdbTargetDescriptor
+         * @param supportedFeatures
+         *
+         * @param resolveCommandPacket
+         *  Constructs command packets from raw packets. Invoked on the observer thread, so it must not modify any
+         *  state shared with the DebugServer thread.
+         *
+         * @param isObserverCommandPacket
+         *  Determines whether the given command packet can be handled for an observer. Invoked on the observer
+         *  thread.
+         */
+        ObserverServer(
+            int serverSocketFileDescriptor,
+            const GdbDebugServerConfig& serverConfig,
+            const TargetDescriptor& gdbTargetDescriptor,
+            const std::set<std::pair<Feature, std::optional<std::string>>>& supportedFeatures,
+            CommandPacketResolver resolveCommandPacket,
+            CommandPacketFilter isObserverCommandPacket
+        );
+
+        /**
+         * Stops the observer thread, disconnects all observers and closes the observer socket.
+         */
+        ~ObserverServer();
+
+        ObserverServer(const ObserverServer& other) = delete;
+        ObserverServer(ObserverServer&& other) = delete;
+
+        ObserverServer& operator = (const ObserverServer& other) = delete;
+        ObserverServer& operator = (ObserverServer&& other) = delete;
+
+    private:
+        struct Observer
+        {
+            /**
+             * Connection objects require an interrupt notifier. Observer connections are never interrupted - we only
+             * read from them when the EventLoop reports that the socket is readable.
+             */
+            EventFdNotifier interruptEventNotifier;
+            DebugSession debugSession;
+
+            Observer(
+                int serverSocketFileDescriptor,
+                const GdbDebugServerConfig& serverConfig,
+                const TargetDescriptor& gdbTargetDescriptor,
+                const std::set<std::pair<Feature, std::optional<std::string>>>& supportedFeatures
+            );
+        };
+
+        int serverSocketFileDescriptor;
+        const GdbDebugServerConfig& serverConfig;
+        const TargetDescriptor& gdbTargetDescriptor;
+        std::set<std::pair<Feature, std::optional<std::string>>> supportedFeatures;
+        CommandPacketResolver resolveCommandPacket;
+        CommandPacketFilter isObserverCommandPacket;
+
+        /**
+         * Observers, mapped by socket file descriptor. Only accessed on the observer thread.
+         */
+        std::map<int, std::unique_ptr<Observer>> observersByFileDescriptor;
+
+        Services::TargetControllerService targetControllerService = Services::TargetControllerService();
+
+        std::shared_ptr<EventListener> executionEventListener = std::make_shared<EventListener>(
+            "GdbObserverExecutionEventListener"
+        );
+
+        EventFdNotifier executionEventNotifier = EventFdNotifier();
+
+        std::atomic<bool> running = false;
+        std::thread observerThread;
+        EventLoop eventLoop;
+
+        void run();
+
+        void acceptObserver();
+
+        /**
+         * Reads and handles the pending packets from the given observer.
+         *
+         * @param observer
+         */
+        void serviceObserver(Observer& observer);
+
+        void disconnectObserver(int fileDescriptor);
+
+        void onTargetExecutionStopped(const Events::TargetExecutionStopped& event);
+
+        void onTargetExecutionResumed(const Events::TargetExecutionResumed& event);
+    };
+}
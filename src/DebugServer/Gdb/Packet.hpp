@@ -3,10 +3,16 @@
 #include <vector>
 #include <memory>
 #include <numeric>
+#include <optional>
+#include <string_view>
+#include <charconv>
+#include <stdexcept>
 #include <QString>
 #include <sstream>
 #include <iomanip>
 
+#include "src/Helpers/HexCodec.hpp"
+
 namespace Bloom::DebugServer::Gdb
 {
     using RawPacket = std::vector<unsigned char>;
@@ -35,65 +41,151 @@ namespace Bloom::DebugServer::Gdb
         /**
          * Generates a raw packet.
          *
+         * Runs of repeated characters are compressed using the RSP run-length encoding ("<char>*<count>"), which GDB
+         * supports in all packets sent by the server. Hex-encoded memory and register data often contains long runs
+         * (erased flash reads as "ffff...", zeroed RAM as "0000..."), so this can save a great deal of bandwidth.
+         *
          * @return
          */
         [[nodiscard]] RawPacket toRawPacket() const {
-            std::vector<unsigned char> packet = {'$'};
+            auto packet = RawPacket();
+            packet.reserve(this->data.size() + 4);
+            packet.push_back('$');
+
+            for (std::size_t index = 0; index < this->data.size();) {
+                const auto byte = this->data[index];
 
-            for (const auto& byte : this->data) {
-                // Escape $ and # characters
                 switch (byte) {
                     case '$':
-                    case '#': {
+                    case '#':
+                    case '}':
+                    case '*': {
+                        // These characters must be escaped, and we never run-length encode escaped characters
                         packet.push_back('}');
                         packet.push_back(byte ^ 0x20);
+                        ++index;
+                        continue;
                     }
                     default: {
-                        packet.push_back(byte);
+                        break;
                     }
                 }
-            }
 
-            auto dataSum = std::accumulate(packet.begin() + 1, packet.end(), 0);
-            packet.push_back('#');
-            auto checkSum = QStringLiteral("%1").arg(dataSum % 256, 2, 16, QLatin1Char('0')).toStdString();
+                auto repeatCount = std::size_t(0);
+                while (
+                    repeatCount < Packet::MAXIMUM_REPEAT_COUNT
+                    && (index + repeatCount + 1) < this->data.size()
+                    && this->data[index + repeatCount + 1] == byte
+                ) {
+                    ++repeatCount;
+                }
+
+                packet.push_back(byte);
 
-            if (checkSum.size() < 2) {
-                packet.push_back('0');
+                if (repeatCount < Packet::MINIMUM_REPEAT_COUNT) {
+                    ++index;
+                    continue;
+                }
 
-                if (checkSum.size() < 1) {
-                    packet.push_back('0');
-                } else {
-                    packet.push_back(static_cast<unsigned char>(checkSum[0]));
+                /*
+                 * The repeat count is encoded as a printable character (count + 29), which must not be '#' or '$'.
+                 * Runs of six or seven repeats are encoded as five repeats - the remaining characters will be
+                 * picked up on the next iteration.
+                 */
+                if (repeatCount == 6 || repeatCount == 7) {
+                    repeatCount = 5;
                 }
+
+                packet.push_back('*');
+                packet.push_back(static_cast<unsigned char>(repeatCount + 29));
+                index += repeatCount + 1;
             }
 
-            packet.push_back(static_cast<unsigned char>(checkSum[0]));
-            packet.push_back(static_cast<unsigned char>(checkSum[1]));
+            const auto dataSum = std::accumulate(packet.begin() + 1, packet.end(), 0);
+            packet.push_back('#');
+            packet.resize(packet.size() + 2);
+            Packet::byteToHex(static_cast<unsigned char>(dataSum % 256), packet.data() + packet.size() - 2);
 
             return packet;
         }
 
+        /**
+         * Returns the packet data (excluding the framing and checksum).
+         *
+         * @return
+         */
+        [[nodiscard]] const std::vector<unsigned char>& getData() const {
+            return this->data;
+        }
+
         /**
          * Converts data in hexadecimal form to raw data.
          *
          * @param hexData
          * @return
          */
-        static std::vector<unsigned char> hexToData(const std::string& hexData) {
-            std::vector<unsigned char> output;
+        static std::vector<unsigned char> hexToData(std::string_view hexData) {
+            // Any trailing half byte is ignored
+            auto output = std::vector<unsigned char>(hexData.size() / 2);
 
-            for (auto i = 0; i < hexData.size(); i += 2) {
-                auto hexByte = std::string((hexData.begin() + i), (hexData.begin() + i + 2));
-                output.push_back(static_cast<unsigned char>(std::stoi(hexByte, nullptr, 16)));
+            if (!HexCodec::decode(hexData.substr(0, output.size() * 2), output.data())) {
+                throw std::invalid_argument("Invalid hexadecimal data");
             }
 
             return output;
         }
 
+        /**
+         * Writes the hexadecimal form of a single byte to the given output buffer. The output buffer must have room
+         * for at least two characters.
+         *
+         * @param byte
+         * @param output
+         */
+        static void byteToHex(unsigned char byte, unsigned char* output) {
+            HexCodec::encodeByte(byte, output);
+        }
+
+        /**
+         * Parses an unsigned integer in hexadecimal form.
+         *
+         * @param hexValue
+         *
+         * @return
+         *  The parsed value, or std::nullopt if hexValue is empty or contains anything other than hexadecimal digits.
+         */
+        template <typename IntegerType = std::uint32_t>
+        static std::optional<IntegerType> parseHex(std::string_view hexValue) {
+            auto value = IntegerType{0};
+            const auto* end = hexValue.data() + hexValue.size();
+            const auto result = std::from_chars(hexValue.data(), end, value, 16);
+
+            if (hexValue.empty() || result.ec != std::errc() || result.ptr != end) {
+                return std::nullopt;
+            }
+
+            return value;
+        }
+
     protected:
+        /**
+         * The range of repeat counts that can be run-length encoded. Shorter runs don't benefit from the encoding,
+         * and longer runs would require a repeat count character beyond '~' (126).
+         */
+        static constexpr std::size_t MINIMUM_REPEAT_COUNT = 3;
+        static constexpr std::size_t MAXIMUM_REPEAT_COUNT = 97;
+
         std::vector<unsigned char> data;
 
+        /**
+         * Provides a read-only string view of the packet data, for parsing without copying.
+         *
+         * @return
+         */
+        [[nodiscard]] std::string_view dataView() const {
+            return std::string_view(reinterpret_cast<const char*>(this->data.data()), this->data.size());
+        }
+
         void init(const RawPacket& rawPacket) {
             this->data.insert(
                 this->data.begin(),
@@ -0,0 +1,135 @@
+#include "PacketCapture.hpp"
+
+#include <array>
+#include <filesystem>
+#include <pthread.h>
+
+#include "src/Services/PathService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    using namespace Bloom::Exceptions;
+
+    PacketCapture::PacketCapture(const std::string& filePath) {
+        auto captureFilePath = std::filesystem::path(filePath);
+        if (captureFilePath.is_relative()) {
+            captureFilePath = std::filesystem::path(Services::PathService::projectDirPath()) / captureFilePath;
+        }
+
+        this->filePath = captureFilePath.string();
+        this->file.open(captureFilePath, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        if (!this->file.is_open()) {
+            throw Exception("Failed to open GDB packet capture file " + this->filePath);
+        }
+
+        auto fileHeader = std::array<char, PACKET_CAPTURE_FILE_HEADER_SIZE>();
+        std::copy(PACKET_CAPTURE_MAGIC.begin(), PACKET_CAPTURE_MAGIC.end(), fileHeader.begin());
+
+        for (auto byteIndex = std::size_t(0); byteIndex < 4; ++byteIndex) {
+            fileHeader[PACKET_CAPTURE_MAGIC.size() + byteIndex] = static_cast<char>(
+                PACKET_CAPTURE_VERSION >> (byteIndex * 8)
+            );
+        }
+
+        this->file.write(fileHeader.data(), static_cast<std::streamsize>(fileHeader.size()));
+
+        this->startTime = std::chrono::steady_clock::now();
+        this->running = true;
+        this->writerThread = std::thread(&PacketCapture::runWriter, this);
+
+        Logger::warning("GDB packet capture enabled - packets will be written to " + this->filePath);
+    }
+
+    PacketCapture::~PacketCapture() {
+        this->running = false;
+        this->writerNotifier.notify();
+
+        if (this->writerThread.joinable()) {
+            this->writerThread.join();
+        }
+
+        this->file.close();
+
+        const auto droppedPacketCount = this->droppedPacketCount.load(std::memory_order_relaxed);
+        if (droppedPacketCount > 0) {
+            Logger::warning(
+                std::to_string(droppedPacketCount) + " GDB packets were dropped from the capture, as the writer "
+                    "couldn't keep up"
+            );
+        }
+    }
+
+    void PacketCapture::record(
+        PacketDirection direction,
+        std::span<const unsigned char> packet,
+        std::chrono::steady_clock::time_point timestamp
+    ) {
+        if (
+            this->pendingBytes.fetch_add(packet.size(), std::memory_order_relaxed) + packet.size()
+                > PacketCapture::MAXIMUM_PENDING_BYTES
+        ) {
+            this->pendingBytes.fetch_sub(packet.size(), std::memory_order_relaxed);
+            this->droppedPacketCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        this->records.push(Record{
+            .timestamp = timestamp,
+            .direction = direction,
+            .data = std::vector<unsigned char>(packet.begin(), packet.end()),
+        });
+    }
+
+    void PacketCapture::runWriter() {
+        ::pthread_setname_np(::pthread_self(), "DS-CAPTURE");
+
+        auto buffer = std::vector<Record>();
+
+        while (this->running) {
+            this->writerNotifier.waitForNotification(PacketCapture::WRITER_INTERVAL);
+            this->writeRecords(buffer);
+        }
+
+        // The DebugServer has stopped recording by now - write whatever it left in the queue
+        this->writeRecords(buffer);
+        this->file.flush();
+    }
+
+    void PacketCapture::writeRecords(std::vector<Record>& buffer) {
+        this->records.takeAll(buffer);
+
+        if (buffer.empty()) {
+            return;
+        }
+
+        auto output = std::vector<char>();
+        auto writtenBytes = std::size_t(0);
+
+        for (const auto& record : buffer) {
+            const auto timestamp = static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(record.timestamp - this->startTime).count()
+            );
+            const auto size = static_cast<std::uint32_t>(record.data.size());
+
+            for (auto byteIndex = std::size_t(0); byteIndex < 8; ++byteIndex) {
+                output.push_back(static_cast<char>(timestamp >> (byteIndex * 8)));
+            }
+
+            output.push_back(static_cast<char>(record.direction));
+
+            for (auto byteIndex = std::size_t(0); byteIndex < 4; ++byteIndex) {
+                output.push_back(static_cast<char>(size >> (byteIndex * 8)));
+            }
+
+            output.insert(output.end(), record.data.begin(), record.data.end());
+            writtenBytes += record.data.size();
+        }
+
+        this->file.write(output.data(), static_cast<std::streamsize>(output.size()));
+        this->pendingBytes.fetch_sub(writtenBytes, std::memory_order_relaxed);
+    }
+}
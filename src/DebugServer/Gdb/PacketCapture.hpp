@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <span>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+
+#include "PacketCaptureFormat.hpp"
+
+#include "src/Helpers/MpscQueue.hpp"
+#include "src/Helpers/ConditionVariableNotifier.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    /**
+     * Records every GDB RSP packet, in both directions, with monotonic timestamps, to a binary capture file (see
+     * PacketCaptureFormat.hpp). Enabled via the 'packetCaptureFile' GDB debug server config parameter.
+     *
+     * Debug logging isn't suitable for latency analysis - formatting the packets as text is slow enough to distort
+     * the timings being investigated, and the log timestamps are too coarse. Here, the DebugServer thread only copies
+     * the packet and takes a timestamp. The writing is done by a background writer thread.
+     *
+     * The capture can be summarised with bloom-rsp-capture-summary (see benchmarks/RspCaptureSummary), which reports
+     * the per-packet-type response latency and the gaps between packets.
+     */
+    class PacketCapture
+    {
+    public:
+        /**
+         * How long the writer thread sleeps between passes over the record queue.
+         */
+        static constexpr auto WRITER_INTERVAL = std::chrono::milliseconds(100);
+
+        /**
+         * Once this much packet data is waiting to be written, any further packets are dropped (and counted), so
+         * that a stalled disk cannot consume all memory.
+         */
+        static constexpr std::size_t MAXIMUM_PENDING_BYTES = 64 * 1024 * 1024;
+
+        /**
+         * Opens the capture file (truncating any existing file) and starts the writer thread.
+         *
+         * @param filePath
+         */
+        explicit PacketCapture(const std::string& filePath);
+
+        /**
+         * Stops the writer thread, once it has written all pending records, and closes the capture file.
+         */
+        ~PacketCapture();
+
+        PacketCapture(const PacketCapture& other) = delete;
+        PacketCapture(PacketCapture&& other) = delete;
+
+        PacketCapture& operator = (const PacketCapture& other) = delete;
+        PacketCapture& operator = (PacketCapture&& other) = delete;
+
+        /**
+         * Queues a packet for writing to the capture file.
+         *
+         * @param direction
+         * @param packet
+         * @param timestamp
+         */
+        void record(
+            PacketDirection direction,
+            std::span<const unsigned char> packet,
+            std::chrono::steady_clock::time_point timestamp = std::chrono::steady_clock::now()
+        );
+
+    private:
+        struct Record
+        {
+            std::chrono::steady_clock::time_point timestamp;
+            PacketDirection direction = PacketDirection::FROM_CLIENT;
+            std::vector<unsigned char> data;
+        };
+
+        std::string filePath;
+        std::ofstream file;
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        MpscQueue<Record> records;
+        std::atomic<std::size_t> pendingBytes = 0;
+        std::atomic<std::uint64_t> droppedPacketCount = 0;
+
+        std::atomic<bool> running = false;
+        std::thread writerThread;
+        ConditionVariableNotifier writerNotifier;
+
+        void runWriter();
+
+        /**
+         * Writes all queued records to the capture file. Invoked on the writer thread.
+         *
+         * @param buffer
+         *  Reused between calls, to save reallocating it.
+         */
+        void writeRecords(std::vector<Record>& buffer);
+    };
+}
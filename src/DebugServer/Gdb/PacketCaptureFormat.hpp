@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+namespace Bloom::DebugServer::Gdb
+{
+    /**
+     * The layout of GDB RSP packet capture files (see PacketCapture). All integers are little-endian.
+     *
+     * A capture file begins with the 8-byte magic ("BLRSPCAP"), followed by a u32 format version. Then follows a
+     * record for each packet:
+     *
+     *  u64 timestamp   - Nanoseconds since the start of the capture (steady clock)
+     *  u8  direction   - See PacketDirection
+     *  u32 size        - The size of the packet data
+     *  ... data        - The raw packet, including framing ('$', '#' and the checksum)
+     *
+     * Acknowledgements ('+' and '-') are not recorded.
+     *
+     * This header is shared with the capture summariser (benchmarks/RspCaptureSummary), so it must not depend on
+     * anything else in the tree.
+     */
+    static constexpr auto PACKET_CAPTURE_MAGIC = std::array<unsigned char, 8>({
+        'B', 'L', 'R', 'S', 'P', 'C', 'A', 'P'
+    });
+    static constexpr std::uint32_t PACKET_CAPTURE_VERSION = 1;
+
+    static constexpr std::size_t PACKET_CAPTURE_FILE_HEADER_SIZE = PACKET_CAPTURE_MAGIC.size() + 4;
+    static constexpr std::size_t PACKET_CAPTURE_RECORD_HEADER_SIZE = 8 + 1 + 4;
+
+    enum class PacketDirection: std::uint8_t
+    {
+        /**
+         * A packet received from the GDB client. The timestamp is the time at which the data was read from the
+         * socket.
+         */
+        FROM_CLIENT = 0x00,
+
+        /**
+         * A packet (or notification) sent to the GDB client. The timestamp is the time at which the packet was
+         * written to the connection (see Gdb::Connection::writePacket()).
+         */
+        TO_CLIENT = 0x01,
+    };
+}
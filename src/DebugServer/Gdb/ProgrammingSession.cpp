@@ -0,0 +1,125 @@
+#include "ProgrammingSession.hpp"
+
+#include <algorithm>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetMemorySize;
+
+    using Exceptions::Exception;
+
+    void ProgrammingSession::insert(TargetMemoryAddress startAddress, const TargetMemoryBuffer& buffer) {
+        if (this->nextAddress.has_value() && startAddress < *(this->nextAddress)) {
+            throw Exception("Invalid start address from GDB - the buffer would overlap a previous buffer");
+        }
+
+        auto address = startAddress;
+        auto bufferIt = buffer.begin();
+
+        while (bufferIt != buffer.end()) {
+            const auto pageStartAddress = (address / this->pageSize) * this->pageSize;
+            const auto pageOffset = static_cast<long>(address - pageStartAddress);
+            const auto bytes = std::min(
+                static_cast<long>(this->pageSize) - pageOffset,
+                static_cast<long>(std::distance(bufferIt, buffer.end()))
+            );
+
+            auto pageIt = this->pagesByStartAddress.find(pageStartAddress);
+            if (pageIt == this->pagesByStartAddress.end()) {
+                pageIt = this->pagesByStartAddress.emplace(
+                    pageStartAddress,
+                    TargetMemoryBuffer(this->pageSize, 0xFF)
+                ).first;
+            }
+
+            std::copy(bufferIt, bufferIt + bytes, pageIt->second.begin() + pageOffset);
+
+            bufferIt += bytes;
+            address += static_cast<TargetMemoryAddress>(bytes);
+        }
+
+        this->nextAddress = address;
+    }
+
+    void ProgrammingSession::erase(
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes,
+        const std::function<TargetMemoryBuffer(TargetMemoryAddress, TargetMemorySize)>& readMemory
+    ) {
+        const auto endAddress = static_cast<std::uint64_t>(startAddress) + bytes;
+
+        for (
+            auto pageStartAddress = static_cast<std::uint64_t>((startAddress / this->pageSize) * this->pageSize);
+            pageStartAddress < endAddress;
+            pageStartAddress += this->pageSize
+        ) {
+            const auto pageEndAddress = pageStartAddress + this->pageSize;
+            const auto eraseStartAddress = std::max(pageStartAddress, static_cast<std::uint64_t>(startAddress));
+            const auto eraseEndAddress = std::min(pageEndAddress, endAddress);
+
+            auto pageIt = this->pagesByStartAddress.find(static_cast<TargetMemoryAddress>(pageStartAddress));
+            if (pageIt == this->pagesByStartAddress.end()) {
+                const auto partial = eraseStartAddress != pageStartAddress || eraseEndAddress != pageEndAddress;
+
+                pageIt = this->pagesByStartAddress.emplace(
+                    static_cast<TargetMemoryAddress>(pageStartAddress),
+                    partial
+                        ? readMemory(static_cast<TargetMemoryAddress>(pageStartAddress), this->pageSize)
+                        : TargetMemoryBuffer(this->pageSize, 0xFF)
+                ).first;
+
+                if (pageIt->second.size() != this->pageSize) {
+                    this->pagesByStartAddress.erase(pageIt);
+                    throw Exception("Unexpected page size from program memory read");
+                }
+            }
+
+            std::fill(
+                pageIt->second.begin() + static_cast<long>(eraseStartAddress - pageStartAddress),
+                pageIt->second.begin() + static_cast<long>(eraseEndAddress - pageStartAddress),
+                0xFF
+            );
+        }
+    }
+
+    std::vector<ProgrammingSession::PageRun> ProgrammingSession::takeCompletePages() {
+        if (!this->nextAddress.has_value()) {
+            return {};
+        }
+
+        return this->takePages(this->nextAddress);
+    }
+
+    std::vector<ProgrammingSession::PageRun> ProgrammingSession::takeAllPages() {
+        return this->takePages(std::nullopt);
+    }
+
+    std::vector<ProgrammingSession::PageRun> ProgrammingSession::takePages(
+        std::optional<TargetMemoryAddress> endAddress
+    ) {
+        auto runs = std::vector<PageRun>();
+
+        auto pageIt = this->pagesByStartAddress.begin();
+        while (
+            pageIt != this->pagesByStartAddress.end()
+            && (!endAddress.has_value() || pageIt->first + this->pageSize <= *endAddress)
+        ) {
+            auto& [pageStartAddress, pageBuffer] = *pageIt;
+
+            if (!runs.empty() && runs.back().startAddress + runs.back().buffer.size() == pageStartAddress) {
+                runs.back().buffer.insert(runs.back().buffer.end(), pageBuffer.begin(), pageBuffer.end());
+
+            } else {
+                runs.push_back(PageRun{.startAddress = pageStartAddress, .buffer = std::move(pageBuffer)});
+            }
+
+            pageIt = this->pagesByStartAddress.erase(pageIt);
+        }
+
+        return runs;
+    }
+}
@@ -1,29 +1,151 @@
 #pragma once
 
+#include <map>
+#include <vector>
+#include <optional>
+#include <string>
+#include <functional>
+
 #include "src/Targets/TargetMemory.hpp"
 
 namespace Bloom::DebugServer::Gdb
 {
     /**
-     * A programming session is created upon receiving the first FlashWrite (vFlashWrite) packet from GDB.
+     * A programming session is created upon receiving the first FlashErase (vFlashErase) or FlashWrite (vFlashWrite)
+     * packet from GDB.
+     *
+     * The programming session holds the data received from GDB (via multiple FlashWrite packets) in a sparse page
+     * map - only the pages that GDB has erased or written to are held. Gaps between those regions (e.g. between an
+     * application at the start of program memory and a bootloader at the end) occupy no memory, and are never
+     * written to the target. Erased ranges, and any bytes of a page that GDB didn't write to, are held in their erased
+     * state (0xFF) - with the exception of the bytes outside of a partially erased page (see
+     * ProgrammingSession::erase()).
+     *
+     * Programming sessions operate in one of two modes:
+     *
+     *  - Buffered: all pages are written to the target's program memory upon receiving a FlashDone (vFlashDone)
+     *    packet.
+     *
+     *  - Streaming: pages are written to the target as soon as they're complete (GDB writes in ascending address
+     *    order, so a page is complete once GDB has written beyond it). We respond to GDB before writing the pages,
+     *    so that GDB can transfer the next chunk whilst the target is being programmed. Any remaining pages are
+     *    written upon receiving the FlashDone packet. Streaming requires a target that can rewrite individual pages.
      *
-     * The programming session holds the start address and a single buffer, which contains the sum of the numerous
-     * buffers received by GDB (via multiple FlashWrite packets). Upon receiving a FlashDone (vFlashDone) packet, we
-     * write the whole buffer to the target's program memory and then destroy the programming session.
+     * Either way, the TargetController will skip any pages that already hold the desired content.
      *
      * See FlashWrite::handle() and FlashDone::handle() for more.
      */
-    struct ProgrammingSession
+    class ProgrammingSession
     {
-        Targets::TargetMemoryAddress startAddress = 0x00;
-        Targets::TargetMemoryBuffer buffer;
+    public:
+        /**
+         * A run of consecutive pages, to be written to the target in a single operation.
+         */
+        struct PageRun
+        {
+            Targets::TargetMemoryAddress startAddress;
+            Targets::TargetMemoryBuffer buffer;
+        };
 
-        ProgrammingSession(
-            Targets::TargetMemoryAddress startAddress,
-            const Targets::TargetMemoryBuffer& initialBuffer
-        )
-            : startAddress(startAddress)
-            , buffer(initialBuffer)
+        /**
+         * Whether this is a streaming programming session.
+         */
+        const bool streaming = false;
+
+        /**
+         * The number of bytes that have been written to the target, so far.
+         */
+        Targets::TargetMemorySize bytesWritten = 0;
+
+        /**
+         * In streaming mode, page writes take place after we've responded to the corresponding FlashWrite packet,
+         * so we can't report failures immediately. Failures are recorded here and reported in response to the next
+         * FlashWrite or FlashDone packet.
+         */
+        std::optional<std::string> streamingError;
+
+        ProgrammingSession(Targets::TargetMemorySize pageSize, bool streaming)
+            : streaming(streaming)
+            , pageSize(pageSize)
         {};
+
+        /**
+         * Inserts data received from GDB into the page map.
+         *
+         * @param startAddress
+         * @param buffer
+         *
+         * @throws Exception
+         *  If the data overlaps data that was previously inserted. GDB always writes in ascending address order.
+         */
+        void insert(Targets::TargetMemoryAddress startAddress, const Targets::TargetMemoryBuffer& buffer);
+
+        /**
+         * Records the erasure of the given range, by setting the range to its erased state (0xFF) in the page map.
+         * Erased pages are written to the target along with the rest of the pages, so that whatever GDB erased but
+         * didn't write to ends up in its erased state.
+         *
+         * Pages that are entirely within the range are inserted as erased pages. Pages that are only partially
+         * within the range, and not already held, are inserted with their current content (obtained via
+         * readMemory), so that the bytes outside of the range are preserved.
+         *
+         * @param startAddress
+         * @param bytes
+         * @param readMemory
+         *  Returns the current content of the given range (start address and size) of program memory.
+         */
+        void erase(
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes,
+            const std::function<
+                Targets::TargetMemoryBuffer(Targets::TargetMemoryAddress, Targets::TargetMemorySize)
+            >& readMemory
+        );
+
+        /**
+         * Removes the complete pages (those that GDB has written beyond) from the page map, and returns them as runs
+         * of consecutive pages.
+         *
+         * @return
+         */
+        std::vector<PageRun> takeCompletePages();
+
+        /**
+         * Removes all pages from the page map, and returns them as runs of consecutive pages.
+         *
+         * @return
+         */
+        std::vector<PageRun> takeAllPages();
+
+        /**
+         * Returns the number of bytes that are yet to be written to the target.
+         *
+         * @return
+         */
+        [[nodiscard]] Targets::TargetMemorySize pendingBytes() const {
+            return static_cast<Targets::TargetMemorySize>(this->pagesByStartAddress.size()) * this->pageSize;
+        }
+
+    private:
+        Targets::TargetMemorySize pageSize = 0;
+
+        /**
+         * Page data, mapped by page start address.
+         */
+        std::map<Targets::TargetMemoryAddress, Targets::TargetMemoryBuffer> pagesByStartAddress;
+
+        /**
+         * The address following the last byte received from GDB.
+         */
+        std::optional<Targets::TargetMemoryAddress> nextAddress;
+
+        /**
+         * Removes all pages that end at or before the given address, and returns them as runs of consecutive pages.
+         *
+         * @param endAddress
+         *
+         * @return
+         */
+        std::vector<PageRun> takePages(std::optional<Targets::TargetMemoryAddress> endAddress);
     };
 }
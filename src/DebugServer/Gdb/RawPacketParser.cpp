@@ -0,0 +1,173 @@
+#include "RawPacketParser.hpp"
+
+#include "Exceptions/ClientCommunicationError.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    using Exceptions::ClientCommunicationError;
+
+    RawPacketParser::RawPacketParser(std::size_t maximumPacketSize)
+        : maximumPacketSize(maximumPacketSize)
+    {}
+
+    RawPacketParser::ParseResult RawPacketParser::parse(const unsigned char* data, std::size_t size) {
+        auto result = ParseResult();
+
+        for (std::size_t index = 0; index < size; ++index) {
+            const auto byte = data[index];
+
+            switch (this->state) {
+                case State::IDLE: {
+                    if (byte == 0x03) {
+                        /*
+                         * This is an interrupt packet - it doesn't carry any of the usual packet frame bytes, so we'll
+                         * just add them here, in order to keep things consistent.
+                         *
+                         * Because we're effectively faking the packet frame, we can use any value for the checksum.
+                         */
+                        result.packets.push_back({'$', byte, '#', 'F', 'F'});
+                        break;
+                    }
+
+                    if (byte == '$') {
+                        this->beginPacket();
+                    }
+
+                    /*
+                     * Anything else received outside of a packet frame ('+'/'-' acknowledgements, etc) is of no
+                     * interest to us, so we just discard it.
+                     */
+                    break;
+                }
+                case State::PACKET_DATA: {
+                    if (byte == '$') {
+                        // Unexpected start of a new packet - the current packet was truncated.
+                        Logger::warning("GDB client sent invalid packet data - ignoring");
+                        this->beginPacket();
+                        break;
+                    }
+
+                    if (byte == '#') {
+                        // End of packet data - the checksum should follow
+                        this->currentPacket.push_back(byte);
+                        this->state = State::CHECKSUM_HIGH;
+                        break;
+                    }
+
+                    this->runningChecksum += byte;
+
+                    if (byte == '}') {
+                        this->state = State::ESCAPED_BYTE;
+                        break;
+                    }
+
+                    this->pushPacketByte(byte);
+                    break;
+                }
+                case State::ESCAPED_BYTE: {
+                    this->runningChecksum += byte;
+
+                    // Escaped bytes are XOR'd with a 0x20 mask.
+                    this->pushPacketByte(byte ^ 0x20);
+                    this->state = State::PACKET_DATA;
+                    break;
+                }
+                case State::CHECKSUM_HIGH:
+                case State::CHECKSUM_LOW: {
+                    const auto value = RawPacketParser::hexCharToValue(byte);
+
+                    if (!value.has_value()) {
+                        Logger::warning("GDB client sent invalid packet checksum - ignoring");
+                        ++(result.invalidPacketCount);
+                        this->reset();
+
+                        if (byte == '$') {
+                            this->beginPacket();
+                        }
+
+                        break;
+                    }
+
+                    this->currentPacket.push_back(byte);
+
+                    if (this->state == State::CHECKSUM_HIGH) {
+                        this->receivedChecksum = static_cast<std::uint8_t>(*value << 4);
+                        this->state = State::CHECKSUM_LOW;
+                        break;
+                    }
+
+                    this->receivedChecksum |= *value;
+
+                    if (this->receivedChecksum != this->runningChecksum) {
+                        Logger::warning("GDB packet checksum mismatch - ignoring packet");
+                        ++(result.invalidPacketCount);
+                        this->reset();
+                        break;
+                    }
+
+                    result.packets.emplace_back(std::move(this->currentPacket));
+                    this->currentPacket = RawPacket();
+                    this->reset();
+                    break;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    void RawPacketParser::reset() {
+        this->state = State::IDLE;
+        this->currentPacket.clear();
+        this->runningChecksum = 0;
+        this->receivedChecksum = 0;
+    }
+
+    void RawPacketParser::recycleBuffer(RawPacket&& buffer) {
+        if (this->bufferPool.size() >= RawPacketParser::BUFFER_POOL_SIZE || buffer.capacity() == 0) {
+            return;
+        }
+
+        buffer.clear();
+        this->bufferPool.emplace_back(std::move(buffer));
+    }
+
+    std::optional<std::uint8_t> RawPacketParser::hexCharToValue(unsigned char character) {
+        if (character >= '0' && character <= '9') {
+            return static_cast<std::uint8_t>(character - '0');
+        }
+
+        if (character >= 'a' && character <= 'f') {
+            return static_cast<std::uint8_t>(character - 'a' + 10);
+        }
+
+        if (character >= 'A' && character <= 'F') {
+            return static_cast<std::uint8_t>(character - 'A' + 10);
+        }
+
+        return std::nullopt;
+    }
+
+    void RawPacketParser::beginPacket() {
+        this->reset();
+
+        if (this->currentPacket.capacity() == 0 && !this->bufferPool.empty()) {
+            this->currentPacket = std::move(this->bufferPool.back());
+            this->bufferPool.pop_back();
+        }
+
+        this->currentPacket.push_back('$');
+        this->state = State::PACKET_DATA;
+    }
+
+    void RawPacketParser::pushPacketByte(unsigned char byte) {
+        if (this->currentPacket.size() >= this->maximumPacketSize) {
+            this->reset();
+            throw ClientCommunicationError("GDB client sent a packet that exceeds the maximum packet size");
+        }
+
+        this->currentPacket.push_back(byte);
+    }
+}
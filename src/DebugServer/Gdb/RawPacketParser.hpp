@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <optional>
+
+#include "Packet.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    /**
+     * The RawPacketParser is an incremental GDB RSP packet parser. It accepts data from the client as it arrives and
+     * extracts complete raw packets from it.
+     *
+     * The parser state is retained between calls to RawPacketParser::parse(), so packets that are split across
+     * numerous socket reads are reconstructed, without having to rescan any data. Escaped bytes are decoded and the
+     * packet checksum is verified as the data arrives.
+     *
+     * Each Connection holds a single instance of this class, for the lifetime of the connection.
+     */
+    class RawPacketParser
+    {
+    public:
+        struct ParseResult
+        {
+            /**
+             * Complete raw packets with valid checksums, in the order in which they were received.
+             */
+            std::vector<RawPacket> packets;
+
+            /**
+             * The number of complete packets that were discarded due to checksum mismatches.
+             */
+            std::size_t invalidPacketCount = 0;
+        };
+
+        /**
+         * @param maximumPacketSize
+         *  The maximum size of a single packet. Packets exceeding this size will result in a
+         *  ClientCommunicationError exception being thrown.
+         */
+        explicit RawPacketParser(std::size_t maximumPacketSize);
+
+        /**
+         * Parses the given data, resuming from the state in which the previous call left the parser.
+         *
+         * Any incomplete packet at the end of the data will be retained in the parser, to be completed in a
+         * subsequent call.
+         *
+         * @param data
+         * @param size
+         *
+         * @return
+         */
+        ParseResult parse(const unsigned char* data, std::size_t size);
+
+        /**
+         * Discards any partially parsed packet.
+         */
+        void reset();
+
+        /**
+         * Returns a packet buffer to the parser's buffer pool. Pooled buffers retain their capacity, so subsequent
+         * packets can usually be constructed without any heap allocations.
+         *
+         * @param buffer
+         */
+        void recycleBuffer(RawPacket&& buffer);
+
+    private:
+        enum class State: std::uint8_t
+        {
+            IDLE,
+            PACKET_DATA,
+            ESCAPED_BYTE,
+            CHECKSUM_HIGH,
+            CHECKSUM_LOW,
+        };
+
+        /**
+         * The maximum number of buffers to retain in the buffer pool.
+         */
+        static constexpr auto BUFFER_POOL_SIZE = 4;
+
+        std::size_t maximumPacketSize = 0;
+
+        /**
+         * Previously used packet buffers, available for reuse. See RawPacketParser::recycleBuffer().
+         */
+        std::vector<RawPacket> bufferPool;
+
+        State state = State::IDLE;
+
+        /**
+         * The packet currently being constructed (opening '$' and any decoded data received so far).
+         */
+        RawPacket currentPacket;
+
+        /**
+         * Running sum of the raw (escaped) packet data, used to verify the packet checksum.
+         */
+        std::uint8_t runningChecksum = 0;
+
+        /**
+         * The checksum byte received from the client (populated in two halves).
+         */
+        std::uint8_t receivedChecksum = 0;
+
+        static std::optional<std::uint8_t> hexCharToValue(unsigned char character);
+
+        void beginPacket();
+        void pushPacketByte(unsigned char byte);
+    };
+}
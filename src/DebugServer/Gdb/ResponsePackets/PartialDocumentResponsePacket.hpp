@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <algorithm>
+
+#include "ResponsePacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::ResponsePackets
+{
+    /**
+     * Response packet for "qXfer:<object>:read:<annex>:<offset>,<length>" commands.
+     *
+     * The packet carries the requested slice of the document, prefixed with 'm' if there's more of the document to
+     * read, or 'l' if the slice reaches the end of the document. The slice is copied straight from the document into
+     * the packet - no intermediate buffers are constructed.
+     */
+    class PartialDocumentResponsePacket: public ResponsePacket
+    {
+    public:
+        PartialDocumentResponsePacket(std::string_view document, std::uint32_t offset, std::uint32_t length) {
+            if (offset >= document.size() || length == 0) {
+                this->data = {'l'};
+                return;
+            }
+
+            const auto slice = document.substr(offset, length);
+            const auto lastSlice = offset + slice.size() >= document.size();
+
+            this->data.reserve(slice.size() + 1);
+            this->data.push_back(lastSlice ? 'l' : 'm');
+            this->data.insert(this->data.end(), slice.begin(), slice.end());
+        }
+    };
+}
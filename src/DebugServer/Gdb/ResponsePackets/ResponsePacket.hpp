@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <string>
+#include <utility>
 
 #include "src/DebugServer/Gdb/Packet.hpp"
 
@@ -19,6 +20,10 @@ namespace Bloom::DebugServer::Gdb::ResponsePackets
             this->data = data;
         }
 
+        explicit ResponsePacket(std::vector<unsigned char>&& data) {
+            this->data = std::move(data);
+        }
+
         explicit ResponsePacket(const std::string& data) {
             this->data = std::vector<unsigned char>(data.begin(), data.end());
         }
@@ -8,17 +8,18 @@ namespace Bloom::DebugServer::Gdb::ResponsePackets
         : supportedFeatures(supportedFeatures)
     {
         auto output = std::string("qSupported:");
-        static const auto gdbFeatureMapping = getGdbFeatureToNameMapping();
 
         for (const auto& supportedFeature : this->supportedFeatures) {
-            const auto featureString = gdbFeatureMapping.valueAt(supportedFeature.first);
+            const auto featureString = GDB_FEATURE_NAMES.valueAt(supportedFeature.first);
 
             if (featureString.has_value()) {
+                output.append(featureString.value());
+
                 if (supportedFeature.second.has_value()) {
-                    output.append(featureString.value() + "=" + supportedFeature.second.value() + ";");
+                    output.append("=" + supportedFeature.second.value() + ";");
 
                 } else {
-                    output.append(featureString.value() + "+;");
+                    output.append("+;");
                 }
 
             }
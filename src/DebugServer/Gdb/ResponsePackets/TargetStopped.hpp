@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
+#include <sstream>
 
 #include "ResponsePacket.hpp"
 
@@ -21,22 +23,53 @@ namespace Bloom::DebugServer::Gdb::ResponsePackets
         Signal signal;
         std::optional<StopReason> stopReason;
 
-        explicit TargetStopped(Signal signal, const std::optional<StopReason>& stopReason = std::nullopt)
+        /**
+         * For watchpoint stop reasons, the (GDB) address of the watchpoint that was triggered.
+         */
+        std::optional<std::uint32_t> watchpointAddress;
+
+        explicit TargetStopped(
+            Signal signal,
+            const std::optional<StopReason>& stopReason = std::nullopt,
+            const std::optional<std::uint32_t>& watchpointAddress = std::nullopt
+        )
             : signal(signal)
             , stopReason(stopReason)
+            , watchpointAddress(watchpointAddress)
         {
             std::string packetData = "T" + Services::StringService::toHex(static_cast<unsigned char>(this->signal));
 
             if (this->stopReason.has_value()) {
-                static const auto stopReasonMapping = getStopReasonToNameMapping();
-                const auto stopReasonName = stopReasonMapping.valueAt(this->stopReason.value());
+                const auto stopReasonName = STOP_REASON_NAMES.valueAt(this->stopReason.value());
 
                 if (stopReasonName.has_value()) {
-                    packetData += stopReasonName.value() + ":;";
+                    packetData += stopReasonName.value();
+                    packetData += ":";
+
+                    if (this->watchpointAddress.has_value()) {
+                        auto stream = std::stringstream();
+                        stream << std::hex << *(this->watchpointAddress);
+                        packetData += stream.str();
+                    }
+
+                    packetData += ";";
                 }
             }
 
             this->data = {packetData.begin(), packetData.end()};
         }
+
+        /**
+         * Identifies the thread that stopped (the running RTOS task - see FreeRtosThreadAwareness).
+         *
+         * @param threadId
+         */
+        void setThreadId(std::uint32_t threadId) {
+            auto stream = std::stringstream();
+            stream << "thread:" << std::hex << threadId << ";";
+
+            const auto threadField = stream.str();
+            this->data.insert(this->data.end(), threadField.begin(), threadField.end());
+        }
     };
 }
@@ -4,6 +4,7 @@ namespace Bloom::DebugServer::Gdb
 {
     enum class Signal: unsigned char
     {
+        NONE = 0,
         TRAP = 5,
         INTERRUPTED = 2,
     };
@@ -1,6 +1,9 @@
 #pragma once
 
-#include "src/Helpers/BiMap.hpp"
+#include <array>
+#include <string_view>
+
+#include "src/Helpers/FlatBiMap.hpp"
 
 namespace Bloom::DebugServer::Gdb
 {
@@ -8,12 +11,19 @@ namespace Bloom::DebugServer::Gdb
     {
         SOFTWARE_BREAKPOINT = 0,
         HARDWARE_BREAKPOINT = 1,
+        WRITE_WATCHPOINT = 2,
+        READ_WATCHPOINT = 3,
+        ACCESS_WATCHPOINT = 4,
     };
 
-    static inline BiMap<StopReason, std::string> getStopReasonToNameMapping() {
-        return BiMap<StopReason, std::string>({
-            {StopReason::HARDWARE_BREAKPOINT, "hwbreak"},
-            {StopReason::SOFTWARE_BREAKPOINT, "swbreak"},
-        });
-    }
+    /**
+     * The names of the stop reasons, as they appear in stop reply packets.
+     */
+    static constexpr auto STOP_REASON_NAMES = FlatBiMap(std::to_array<std::pair<StopReason, std::string_view>>({
+        {StopReason::HARDWARE_BREAKPOINT, "hwbreak"},
+        {StopReason::SOFTWARE_BREAKPOINT, "swbreak"},
+        {StopReason::WRITE_WATCHPOINT, "watch"},
+        {StopReason::READ_WATCHPOINT, "rwatch"},
+        {StopReason::ACCESS_WATCHPOINT, "awatch"},
+    }));
 }
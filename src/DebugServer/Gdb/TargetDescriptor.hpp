@@ -4,16 +4,49 @@
 #include <optional>
 #include <vector>
 #include <set>
+#include <algorithm>
 
 #include "src/Helpers/BiMap.hpp"
 #include "src/Targets/TargetDescriptor.hpp"
 #include "src/Targets/TargetRegister.hpp"
 #include "src/Targets/TargetMemory.hpp"
+#include "src/TargetController/AgentExpression.hpp"
 
 #include "RegisterDescriptor.hpp"
 
 namespace Bloom::DebugServer::Gdb
 {
+    /**
+     * Describes the position of a GDB register within the register packet (the response to the 'g' command).
+     */
+    struct RegisterLayoutEntry
+    {
+        Targets::TargetRegisterDescriptor targetRegisterDescriptor;
+        GdbRegisterNumber number;
+
+        /**
+         * Byte offset of the register value, within the (binary form of the) register packet.
+         */
+        std::size_t offset;
+
+        /**
+         * Size of the GDB register, in bytes.
+         */
+        std::uint16_t size;
+
+        RegisterLayoutEntry(
+            const Targets::TargetRegisterDescriptor& targetRegisterDescriptor,
+            GdbRegisterNumber number,
+            std::size_t offset,
+            std::uint16_t size
+        )
+            : targetRegisterDescriptor(targetRegisterDescriptor)
+            , number(number)
+            , offset(offset)
+            , size(size)
+        {};
+    };
+
     /**
      * GDB target descriptor.
      */
@@ -94,6 +127,142 @@ namespace Bloom::DebugServer::Gdb
          */
         virtual const std::vector<GdbRegisterNumber>& getRegisterNumbers() const = 0;
 
+        /**
+         * Returns the target register descriptors for all target registers that are mapped to GDB registers.
+         *
+         * See TargetDescriptor::loadRegisterLayout().
+         *
+         * @return
+         */
+        const Targets::TargetRegisterDescriptors& getMappedTargetRegisterDescriptors() const {
+            return this->mappedTargetRegisterDescriptors;
+        }
+
+        /**
+         * Returns the size of the register packet (the response to the 'g' command), in binary form.
+         *
+         * @return
+         */
+        std::size_t getRegisterPacketSize() const {
+            return this->registerPacketSize;
+        }
+
+        /**
+         * Finds the register layout entry for the given target register descriptor.
+         *
+         * @param targetRegisterDescriptor
+         *
+         * @return
+         *  The layout entry, or a nullptr if the target register isn't mapped to any GDB register.
+         */
+        const RegisterLayoutEntry* findRegisterLayoutEntry(
+            const Targets::TargetRegisterDescriptor& targetRegisterDescriptor
+        ) const {
+            const auto entryIt = std::lower_bound(
+                this->registerLayout.begin(),
+                this->registerLayout.end(),
+                targetRegisterDescriptor,
+                [] (const RegisterLayoutEntry& entry, const Targets::TargetRegisterDescriptor& descriptor) {
+                    return entry.targetRegisterDescriptor < descriptor;
+                }
+            );
+
+            if (entryIt == this->registerLayout.end() || entryIt->targetRegisterDescriptor != targetRegisterDescriptor) {
+                return nullptr;
+            }
+
+            return &(*entryIt);
+        }
+
+        /**
+         * Constructs an agent expression, to be evaluated by the TargetController, along with the mappings of the
+         * GDB register numbers and memory addresses that the expression references.
+         *
+         * References to registers that don't exist are left unmapped - evaluation will fail upon reaching them.
+         *
+         * @param bytecode
+         *
+         * @throws Exception
+         *  If the bytecode is malformed.
+         *
+         * @return
+         */
+        TargetController::AgentExpression createAgentExpression(std::vector<unsigned char>&& bytecode) const {
+            auto expression = TargetController::AgentExpression(std::move(bytecode));
+
+            /*
+             * GDB addresses are mapped to memory types in the same way as getMemoryTypeFromGdbAddress() does it -
+             * largest offset first, falling back to flash.
+             */
+            for (auto offsetIt = this->memoryOffsets.rbegin(); offsetIt != this->memoryOffsets.rend(); ++offsetIt) {
+                if (*offsetIt != 0) {
+                    expression.memorySegments.emplace_back(*offsetIt, this->memoryOffsetsByType.at(*offsetIt));
+                }
+            }
+
+            expression.memorySegments.emplace_back(0, Targets::TargetMemoryType::FLASH);
+
+            const auto& registerNumbers = this->getRegisterNumbers();
+
+            for (const auto registerNumber : expression.getReferencedRegisterNumbers()) {
+                const auto registerNumberIt = std::find(registerNumbers.begin(), registerNumbers.end(), registerNumber);
+                if (registerNumberIt == registerNumbers.end()) {
+                    continue;
+                }
+
+                expression.registerDescriptorsByNumber.emplace(
+                    registerNumber,
+                    this->getTargetRegisterDescriptorFromNumber(registerNumber)
+                );
+            }
+
+            return expression;
+        }
+
+    protected:
+        /**
+         * Precomputes the register packet layout, from the GDB register mappings. Derived classes must call this
+         * once their register mappings have been loaded.
+         *
+         * The layout entries are held in a flat vector, ordered by target register descriptor, so that the registers
+         * returned by the TargetController can be placed in the register packet without any map lookups or sorting.
+         */
+        void loadRegisterLayout() {
+            this->registerLayout.clear();
+            this->mappedTargetRegisterDescriptors.clear();
+
+            std::size_t offset = 0;
+
+            // GDB expects the registers to be ordered by their GDB register number
+            auto registerNumbers = this->getRegisterNumbers();
+            std::sort(registerNumbers.begin(), registerNumbers.end());
+
+            for (const auto& registerNumber : registerNumbers) {
+                const auto& registerDescriptor = this->getRegisterDescriptorFromNumber(registerNumber);
+                const auto& targetRegisterDescriptor = this->getTargetRegisterDescriptorFromNumber(registerNumber);
+
+                this->registerLayout.emplace_back(
+                    targetRegisterDescriptor,
+                    registerNumber,
+                    offset,
+                    registerDescriptor.size
+                );
+                this->mappedTargetRegisterDescriptors.insert(targetRegisterDescriptor);
+
+                offset += registerDescriptor.size;
+            }
+
+            this->registerPacketSize = offset;
+
+            std::sort(
+                this->registerLayout.begin(),
+                this->registerLayout.end(),
+                [] (const RegisterLayoutEntry& entryA, const RegisterLayoutEntry& entryB) {
+                    return entryA.targetRegisterDescriptor < entryB.targetRegisterDescriptor;
+                }
+            );
+        }
+
     private:
         /**
          * When GDB sends us a memory address, the memory type (Flash, RAM, EEPROM, etc) is embedded within. This is
@@ -109,5 +278,12 @@ namespace Bloom::DebugServer::Gdb
          * Sorted set of the known memory offsets (see memoryOffsetsByType).
          */
         std::set<std::uint32_t> memoryOffsets;
+
+        /**
+         * See TargetDescriptor::loadRegisterLayout().
+         */
+        std::vector<RegisterLayoutEntry> registerLayout;
+        Targets::TargetRegisterDescriptors mappedTargetRegisterDescriptors;
+        std::size_t registerPacketSize = 0;
     };
 }
@@ -0,0 +1,96 @@
+#include "TargetDocumentCache.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "src/Application.hpp"
+#include "src/Services/PathService.hpp"
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    TargetDocumentCache::Document TargetDocumentCache::get(
+        const std::string& targetId,
+        const std::string& documentName,
+        const std::function<std::string()>& generator
+    ) {
+        const auto lock = std::unique_lock(TargetDocumentCache::mutex);
+
+        const auto key = targetId + "/" + documentName;
+        const auto documentIt = TargetDocumentCache::documentsByKey.find(key);
+
+        if (documentIt != TargetDocumentCache::documentsByKey.end()) {
+            return documentIt->second;
+        }
+
+        const auto filePath = TargetDocumentCache::cacheFilePath(targetId, documentName);
+        auto document = TargetDocumentCache::loadFromDisk(filePath);
+
+        if (document == nullptr) {
+            Logger::debug("Generating " + documentName + " for target " + targetId);
+            document = std::make_shared<const std::string>(generator());
+            TargetDocumentCache::writeToDisk(filePath, *document);
+        }
+
+        TargetDocumentCache::documentsByKey.emplace(key, document);
+        return document;
+    }
+
+    std::string TargetDocumentCache::cacheFilePath(const std::string& targetId, const std::string& documentName) {
+        return Services::PathService::projectCacheDirPath() + "/gdb/" + Application::VERSION.toString() + "/"
+            + targetId + "/" + documentName;
+    }
+
+    TargetDocumentCache::Document TargetDocumentCache::loadFromDisk(const std::string& filePath) {
+        auto file = std::ifstream(filePath, std::ios::binary);
+
+        if (!file.is_open()) {
+            return nullptr;
+        }
+
+        auto stream = std::ostringstream();
+        stream << file.rdbuf();
+
+        if (file.bad()) {
+            Logger::debug("Failed to read cached document from " + filePath);
+            return nullptr;
+        }
+
+        return std::make_shared<const std::string>(stream.str());
+    }
+
+    void TargetDocumentCache::writeToDisk(const std::string& filePath, const std::string& document) {
+        auto errorCode = std::error_code();
+        const auto path = std::filesystem::path(filePath);
+
+        std::filesystem::create_directories(path.parent_path(), errorCode);
+        if (errorCode) {
+            Logger::debug("Failed to create document cache directory - " + errorCode.message());
+            return;
+        }
+
+        /*
+         * We write to a temporary file and then rename it, so that other Bloom instances (or a crash part way
+         * through the write) can't leave a truncated document in the cache.
+         */
+        const auto tempPath = std::filesystem::path(filePath + ".tmp");
+
+        {
+            auto file = std::ofstream(tempPath, std::ios::binary | std::ios::trunc);
+            file.write(document.data(), static_cast<std::streamsize>(document.size()));
+
+            if (!file.good()) {
+                Logger::debug("Failed to write cached document to " + tempPath.string());
+                std::filesystem::remove(tempPath, errorCode);
+                return;
+            }
+        }
+
+        std::filesystem::rename(tempPath, path, errorCode);
+        if (errorCode) {
+            Logger::debug("Failed to write cached document to " + filePath + " - " + errorCode.message());
+            std::filesystem::remove(tempPath, errorCode);
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <functional>
+
+namespace Bloom::DebugServer::Gdb
+{
+    /**
+     * Some of the documents we serve to GDB (the memory map, SVD, etc) are generated from the target descriptor.
+     * Generating them is not free - the SVD for a large XMEGA target takes a noticeable amount of time and memory to
+     * build. But the documents only ever vary with the target and the Bloom version, so we generate each document
+     * once and cache it, both in memory and on disk (in the project's settings directory).
+     *
+     * Documents are keyed by target ID (the target's signature, for AVR targets) and document name. The on-disk
+     * cache is namespaced by the Bloom version, so that cached documents are regenerated upon upgrading Bloom.
+     *
+     * This class is thread-safe.
+     */
+    class TargetDocumentCache
+    {
+    public:
+        using Document = std::shared_ptr<const std::string>;
+
+        /**
+         * Returns the cached document, generating it (and populating the cache) if it hasn't been cached yet.
+         *
+         * @param targetId
+         * @param documentName
+         *  Must be a valid file name.
+         *
+         * @param generator
+         *  Will be invoked to generate the document, on a cache miss.
+         *
+         * @return
+         */
+        static Document get(
+            const std::string& targetId,
+            const std::string& documentName,
+            const std::function<std::string()>& generator
+        );
+
+    private:
+        static inline std::mutex mutex;
+        static inline std::map<std::string, Document> documentsByKey;
+
+        /**
+         * Returns the path to the on-disk cache file for the given document.
+         *
+         * @param targetId
+         * @param documentName
+         *
+         * @return
+         */
+        static std::string cacheFilePath(const std::string& targetId, const std::string& documentName);
+
+        /**
+         * Loads the given document from the on-disk cache.
+         *
+         * @param filePath
+         *
+         * @return
+         *  A null pointer if the document isn't present in the on-disk cache, or couldn't be read.
+         */
+        static Document loadFromDisk(const std::string& filePath);
+
+        /**
+         * Writes the given document to the on-disk cache. Failures are logged and otherwise ignored - the on-disk
+         * cache is best-effort.
+         *
+         * @param filePath
+         * @param document
+         */
+        static void writeToDisk(const std::string& filePath, const std::string& document);
+    };
+}
@@ -0,0 +1,261 @@
+#include "Connection.hpp"
+
+#include <sys/socket.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <array>
+
+#include "src/DebugServer/Gdb/Exceptions/ClientDisconnected.hpp"
+#include "src/DebugServer/Gdb/Exceptions/DebugServerInterrupted.hpp"
+#include "src/DebugServer/Gdb/Exceptions/ClientCommunicationError.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Scripting
+{
+    using namespace Gdb::Exceptions;
+    using namespace Bloom::Exceptions;
+
+    Connection::Connection(int serverSocketFileDescriptor, EventFdNotifier& interruptEventNotifier)
+        : interruptEventNotifier(interruptEventNotifier)
+        , readBuffer(Connection::READ_BUFFER_SIZE, 0x00)
+    {
+        this->accept(serverSocketFileDescriptor);
+
+        ::fcntl(
+            this->socketFileDescriptor.value(),
+            F_SETFL,
+            ::fcntl(this->socketFileDescriptor.value(), F_GETFL, 0) | O_NONBLOCK
+        );
+
+        this->epollInstance.addEntry(
+            this->socketFileDescriptor.value(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
+        );
+
+        this->epollInstance.addEntry(
+            this->interruptEventNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
+        );
+    }
+
+    Connection::~Connection() {
+        this->close();
+    }
+
+    void Connection::setWakeupNotifier(EventFdNotifier& wakeupNotifier) {
+        if (this->wakeupNotifier != nullptr) {
+            this->epollInstance.removeEntry(this->wakeupNotifier->getFileDescriptor());
+        }
+
+        this->wakeupNotifier = &wakeupNotifier;
+        this->epollInstance.addEntry(
+            this->wakeupNotifier->getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
+        );
+    }
+
+    std::vector<Message> Connection::readMessages() {
+        auto output = std::vector<Message>();
+
+        if (this->wakeupPending) {
+            this->wakeupPending = false;
+            return output;
+        }
+
+        do {
+            const auto bytesRead = this->read();
+
+            if (bytesRead > 0) {
+                this->inputBuffer.insert(
+                    this->inputBuffer.end(),
+                    this->readBuffer.begin(),
+                    this->readBuffer.begin() + static_cast<long>(bytesRead)
+                );
+                this->parseMessages(output);
+            }
+
+            if (output.empty() && this->wakeupPending) {
+                this->wakeupPending = false;
+                break;
+            }
+
+        } while (output.empty());
+
+        return output;
+    }
+
+    void Connection::writeMessage(
+        MessageType type,
+        std::uint32_t requestId,
+        const std::vector<unsigned char>& payload
+    ) {
+        const auto length = static_cast<std::uint32_t>(MESSAGE_HEADER_SIZE - 4 + payload.size());
+
+        auto frame = PayloadWriter();
+        frame.payload.reserve(MESSAGE_HEADER_SIZE + payload.size());
+        frame.writeUint32(length).writeUint8(static_cast<std::uint8_t>(type)).writeUint32(requestId);
+        frame.writeBytes(payload);
+
+        this->write(frame.payload);
+    }
+
+    void Connection::accept(int serverSocketFileDescriptor) {
+        const auto socketFileDescriptor = ::accept(serverSocketFileDescriptor, nullptr, nullptr);
+
+        if (socketFileDescriptor < 0) {
+            throw Exception("Failed to accept scripting connection");
+        }
+
+        this->socketFileDescriptor = socketFileDescriptor;
+    }
+
+    void Connection::close() noexcept {
+        if (this->socketFileDescriptor.value_or(-1) >= 0) {
+            ::close(this->socketFileDescriptor.value());
+            this->socketFileDescriptor = std::nullopt;
+        }
+    }
+
+    std::size_t Connection::read() {
+        auto events = std::array<struct ::epoll_event, 3>();
+        const auto eventCount = this->epollInstance.waitForEvents(events);
+
+        auto interrupted = false;
+        auto socketReadable = false;
+
+        for (auto eventIndex = std::size_t(0); eventIndex < eventCount; ++eventIndex) {
+            const auto eventFileDescriptor = events[eventIndex].data.fd;
+
+            if (eventFileDescriptor == this->interruptEventNotifier.getFileDescriptor()) {
+                interrupted = true;
+                continue;
+            }
+
+            if (this->wakeupNotifier != nullptr && eventFileDescriptor == this->wakeupNotifier->getFileDescriptor()) {
+                this->wakeupNotifier->clear();
+                this->wakeupPending = true;
+                continue;
+            }
+
+            socketReadable = true;
+        }
+
+        if (interrupted) {
+            this->interruptEventNotifier.clear();
+            throw DebugServerInterrupted();
+        }
+
+        if (!socketReadable) {
+            return 0;
+        }
+
+        const auto bytesRead = ::read(
+            this->socketFileDescriptor.value(),
+            this->readBuffer.data(),
+            this->readBuffer.size()
+        );
+
+        if (bytesRead < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return 0;
+            }
+
+            throw ClientCommunicationError(
+                "Failed to read data from scripting client - error code: " + std::to_string(errno)
+            );
+        }
+
+        if (bytesRead == 0) {
+            throw ClientDisconnected();
+        }
+
+        return static_cast<std::size_t>(bytesRead);
+    }
+
+    void Connection::parseMessages(std::vector<Message>& messages) {
+        auto position = std::size_t(0);
+
+        while ((this->inputBuffer.size() - position) >= MESSAGE_HEADER_SIZE) {
+            auto header = PayloadReader(
+                std::span(this->inputBuffer.begin() + static_cast<long>(position), MESSAGE_HEADER_SIZE)
+            );
+            const auto length = header.readUint32();
+
+            if (length < (MESSAGE_HEADER_SIZE - 4) || length > Connection::MAXIMUM_MESSAGE_SIZE) {
+                throw ClientCommunicationError("Invalid scripting message length (" + std::to_string(length) + ")");
+            }
+
+            if ((this->inputBuffer.size() - position - 4) < length) {
+                // The rest of the message is yet to arrive
+                break;
+            }
+
+            auto& message = messages.emplace_back();
+            message.type = static_cast<MessageType>(header.readUint8());
+            message.requestId = header.readUint32();
+
+            const auto payloadBegin = this->inputBuffer.begin() + static_cast<long>(position + MESSAGE_HEADER_SIZE);
+            message.payload.assign(
+                payloadBegin,
+                payloadBegin + static_cast<long>(length - (MESSAGE_HEADER_SIZE - 4))
+            );
+
+            position += 4 + length;
+        }
+
+        this->inputBuffer.erase(this->inputBuffer.begin(), this->inputBuffer.begin() + static_cast<long>(position));
+    }
+
+    void Connection::write(const std::vector<unsigned char>& data) {
+        auto bytesRemaining = data.size();
+        const auto* nextByte = data.data();
+
+        while (bytesRemaining > 0) {
+            const auto bytesWritten = ::send(
+                this->socketFileDescriptor.value(),
+                nextByte,
+                bytesRemaining,
+                MSG_NOSIGNAL
+            );
+
+            if (bytesWritten < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    // The socket's send buffer is full - wait for the client to catch up
+                    auto pollDescriptor = ::pollfd{
+                        .fd = this->socketFileDescriptor.value(),
+                        .events = POLLOUT,
+                        .revents = 0,
+                    };
+
+                    if (::poll(&pollDescriptor, 1, 5000) == 0) {
+                        throw ClientCommunicationError("Timed out waiting for scripting client to accept data");
+                    }
+
+                    if ((pollDescriptor.revents & (POLLERR | POLLHUP)) != 0) {
+                        throw ClientDisconnected();
+                    }
+
+                    continue;
+                }
+
+                if (errno == EPIPE || errno == ECONNRESET) {
+                    throw ClientDisconnected();
+                }
+
+                throw ClientCommunicationError(
+                    "Failed to write to scripting client socket - error no: " + std::to_string(errno)
+                );
+            }
+
+            nextByte += bytesWritten;
+            bytesRemaining -= static_cast<std::size_t>(bytesWritten);
+        }
+    }
+}
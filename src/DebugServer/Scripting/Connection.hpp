@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "Protocol.hpp"
+
+#include "src/Helpers/EventFdNotifier.hpp"
+#include "src/Helpers/EpollInstance.hpp"
+
+namespace Bloom::DebugServer::Scripting
+{
+    /**
+     * The Connection class represents an active connection between the scripting server and a client, over a Unix
+     * domain socket. It deals with the framing of messages (see Protocol.hpp).
+     *
+     * This is largely the same as Dap::Connection, minus the JSON.
+     */
+    class Connection
+    {
+    public:
+        /**
+         * The maximum number of bytes to read from the socket in a single read() call.
+         */
+        static constexpr auto READ_BUFFER_SIZE = 65536;
+
+        /**
+         * The largest message we'll accept from the client. Anything larger is assumed to be garbage, and the
+         * connection is closed.
+         */
+        static constexpr std::uint32_t MAXIMUM_MESSAGE_SIZE = 16 * 1024 * 1024;
+
+        explicit Connection(int serverSocketFileDescriptor, EventFdNotifier& interruptEventNotifier);
+
+        Connection() = delete;
+        Connection(const Connection&) = delete;
+        Connection& operator = (Connection&) = delete;
+        Connection& operator = (Connection&&) = delete;
+
+        Connection(Connection&& other) noexcept
+            : socketFileDescriptor(other.socketFileDescriptor)
+            , interruptEventNotifier(other.interruptEventNotifier)
+            , epollInstance(std::move(other.epollInstance))
+            , wakeupNotifier(other.wakeupNotifier)
+            , wakeupPending(other.wakeupPending)
+            , readBuffer(std::move(other.readBuffer))
+            , inputBuffer(std::move(other.inputBuffer))
+        {
+            other.socketFileDescriptor = std::nullopt;
+        }
+
+        ~Connection();
+
+        /**
+         * Sets the wakeup notifier for this connection. See Dap::Connection::setWakeupNotifier().
+         *
+         * @param wakeupNotifier
+         */
+        void setWakeupNotifier(EventFdNotifier& wakeupNotifier);
+
+        /**
+         * Waits for incoming data from the client and returns the complete messages.
+         *
+         * This function will not return until at least one complete message has been received, or the wakeup notifier
+         * has been signalled, in which case an empty vector will be returned.
+         *
+         * @throws ClientCommunicationError
+         *  If the client sent a malformed frame.
+         *
+         * @return
+         */
+        std::vector<Message> readMessages();
+
+        /**
+         * Sends a message to the client.
+         *
+         * @param type
+         * @param requestId
+         * @param payload
+         */
+        void writeMessage(MessageType type, std::uint32_t requestId, const std::vector<unsigned char>& payload);
+
+    private:
+        std::optional<int> socketFileDescriptor;
+
+        EventFdNotifier& interruptEventNotifier;
+        EpollInstance epollInstance = EpollInstance();
+
+        EventFdNotifier* wakeupNotifier = nullptr;
+        bool wakeupPending = false;
+
+        /**
+         * Buffer for data read from the client socket. This is allocated once and reused for every read.
+         */
+        std::vector<unsigned char> readBuffer;
+
+        /**
+         * Data received from the client that is yet to be parsed.
+         */
+        std::vector<unsigned char> inputBuffer;
+
+        void accept(int serverSocketFileDescriptor);
+        void close() noexcept;
+
+        /**
+         * See Dap::Connection::read().
+         *
+         * @return
+         */
+        std::size_t read();
+
+        /**
+         * Extracts all complete messages from this->inputBuffer.
+         *
+         * @param messages
+         */
+        void parseMessages(std::vector<Message>& messages);
+
+        void write(const std::vector<unsigned char>& data);
+    };
+}
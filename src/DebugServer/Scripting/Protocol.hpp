@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <span>
+#include <algorithm>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Scripting
+{
+    /**
+     * The scripting protocol is a binary request/response protocol. All integers are little-endian.
+     *
+     * Each message (in either direction) is framed as:
+     *
+     *  u32 length          - The size of everything that follows this field
+     *  u8  messageType     - See MessageType
+     *  u32 requestId       - Chosen by the client, echoed in the response. Zero for events.
+     *  ... payload
+     *
+     * Clients can send any number of requests without waiting for responses (pipelining). Requests are serviced in
+     * the order in which they were received.
+     *
+     * See src/DebugServer/Scripting/README.md for the payload of each request and response.
+     */
+    static constexpr std::size_t MESSAGE_HEADER_SIZE = 4 + 1 + 4;
+
+    enum class MessageType: std::uint8_t
+    {
+        /*
+         * Client -> server (requests)
+         */
+        GET_STATE = 0x01,
+        READ_MEMORY = 0x02,
+        WRITE_MEMORY = 0x03,
+        LIST_REGISTERS = 0x04,
+        READ_REGISTERS = 0x05,
+        WRITE_REGISTERS = 0x06,
+        STOP = 0x07,
+        CONTINUE = 0x08,
+        STEP = 0x09,
+        RESET = 0x0A,
+        SET_PROGRAM_COUNTER = 0x0B,
+        SET_BREAKPOINTS = 0x0C,
+        REMOVE_BREAKPOINTS = 0x0D,
+        SUBSCRIBE = 0x0E,
+
+        /*
+         * Server -> client
+         */
+        RESPONSE = 0x80,
+        ERROR = 0x81,
+        EVENT = 0x82,
+    };
+
+    enum class EventType: std::uint8_t
+    {
+        TARGET_STOPPED = 0x01,
+        TARGET_RESUMED = 0x02,
+    };
+
+    /**
+     * Event subscription flags, for the SUBSCRIBE request. Clients receive no events until they subscribe.
+     */
+    static constexpr std::uint8_t EVENT_SUBSCRIPTION_TARGET_STOPPED = 0x01;
+    static constexpr std::uint8_t EVENT_SUBSCRIPTION_TARGET_RESUMED = 0x02;
+
+    struct Message
+    {
+        MessageType type;
+        std::uint32_t requestId = 0;
+        std::vector<unsigned char> payload;
+    };
+
+    /**
+     * Extracts fields from a request payload.
+     *
+     * Requests with truncated payloads are answered with an error response - the connection is kept.
+     */
+    class PayloadReader
+    {
+    public:
+        explicit PayloadReader(std::span<const unsigned char> payload)
+            : payload(payload)
+        {}
+
+        std::uint8_t readUint8() {
+            return static_cast<std::uint8_t>(this->readUnsigned(1));
+        }
+
+        std::uint16_t readUint16() {
+            return static_cast<std::uint16_t>(this->readUnsigned(2));
+        }
+
+        std::uint32_t readUint32() {
+            return static_cast<std::uint32_t>(this->readUnsigned(4));
+        }
+
+        std::span<const unsigned char> readBytes(std::size_t size) {
+            this->checkRemaining(size);
+
+            const auto bytes = this->payload.subspan(this->position, size);
+            this->position += size;
+            return bytes;
+        }
+
+        [[nodiscard]] bool atEnd() const {
+            return this->position >= this->payload.size();
+        }
+
+    private:
+        std::span<const unsigned char> payload;
+        std::size_t position = 0;
+
+        std::uint64_t readUnsigned(std::size_t size) {
+            this->checkRemaining(size);
+
+            auto value = std::uint64_t(0);
+            for (auto byteIndex = std::size_t(0); byteIndex < size; ++byteIndex) {
+                value |= static_cast<std::uint64_t>(this->payload[this->position + byteIndex]) << (byteIndex * 8);
+            }
+
+            this->position += size;
+            return value;
+        }
+
+        void checkRemaining(std::size_t size) const {
+            if ((this->payload.size() - this->position) < size) {
+                throw Exceptions::Exception("Malformed request - payload too short");
+            }
+        }
+    };
+
+    /**
+     * Constructs a response or event payload.
+     */
+    class PayloadWriter
+    {
+    public:
+        std::vector<unsigned char> payload;
+
+        PayloadWriter& writeUint8(std::uint8_t value) {
+            this->payload.push_back(value);
+            return *this;
+        }
+
+        PayloadWriter& writeUint16(std::uint16_t value) {
+            return this->writeUnsigned(value, 2);
+        }
+
+        PayloadWriter& writeUint32(std::uint32_t value) {
+            return this->writeUnsigned(value, 4);
+        }
+
+        PayloadWriter& writeBytes(std::span<const unsigned char> bytes) {
+            this->payload.insert(this->payload.end(), bytes.begin(), bytes.end());
+            return *this;
+        }
+
+        /**
+         * Strings are length-prefixed (u16), with no terminator.
+         *
+         * @param value
+         * @return
+         */
+        PayloadWriter& writeString(const std::string& value) {
+            const auto size = std::min(value.size(), std::size_t(0xFFFF));
+            this->writeUint16(static_cast<std::uint16_t>(size));
+            this->payload.insert(this->payload.end(), value.begin(), value.begin() + static_cast<long>(size));
+            return *this;
+        }
+
+    private:
+        PayloadWriter& writeUnsigned(std::uint64_t value, std::size_t size) {
+            for (auto byteIndex = std::size_t(0); byteIndex < size; ++byteIndex) {
+                this->payload.push_back(static_cast<unsigned char>(value >> (byteIndex * 8)));
+            }
+
+            return *this;
+        }
+    };
+}
@@ -0,0 +1,662 @@
+#include "ScriptingServer.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cstring>
+#include <map>
+
+#include "src/EventManager/EventManager.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Services/MetricsService.hpp"
+#include "src/Services/TraceService.hpp"
+
+#include "src/DebugServer/Gdb/Exceptions/ClientDisconnected.hpp"
+#include "src/DebugServer/Gdb/Exceptions/ClientCommunicationError.hpp"
+#include "src/DebugServer/Gdb/Exceptions/DebugSessionInitialisationFailure.hpp"
+#include "src/DebugServer/Gdb/Exceptions/DebugServerInterrupted.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+#include "src/Exceptions/InvalidConfig.hpp"
+
+#include "src/TargetController/Commands/CommandBatch.hpp"
+#include "src/TargetController/Commands/ReadTargetMemory.hpp"
+#include "src/TargetController/Commands/WriteTargetMemory.hpp"
+#include "src/TargetController/Commands/SetBreakpoint.hpp"
+#include "src/TargetController/Commands/RemoveBreakpoint.hpp"
+
+namespace Bloom::DebugServer::Scripting
+{
+    using namespace Gdb::Exceptions;
+    using namespace Bloom::Exceptions;
+
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetRegister;
+    using Targets::TargetRegisters;
+    using Targets::TargetRegisterDescriptor;
+    using Targets::TargetRegisterDescriptors;
+
+    using TargetController::TargetControllerState;
+    using TargetController::Commands::CommandBatch;
+    using TargetController::Commands::ReadTargetMemory;
+    using TargetController::Commands::WriteTargetMemory;
+    using TargetController::Commands::SetBreakpoint;
+    using TargetController::Commands::RemoveBreakpoint;
+
+    ScriptingServer::Session::Session(
+        Connection&& connection,
+        std::shared_ptr<const Targets::TargetDescriptor> targetDescriptor
+    )
+        : connection(std::move(connection))
+        , targetDescriptor(std::move(targetDescriptor))
+    {
+        for (const auto& [registerType, descriptors] : this->targetDescriptor->registerDescriptorsByType) {
+            this->registerDescriptors.insert(this->registerDescriptors.end(), descriptors.begin(), descriptors.end());
+        }
+    }
+
+    ScriptingServer::ScriptingServer(
+        const DebugServerConfig& debugServerConfig,
+        EventListener& eventListener,
+        EventFdNotifier& eventNotifier
+    )
+        : debugServerConfig(ScriptingServerConfig(debugServerConfig))
+        , eventListener(eventListener)
+        , interruptEventNotifier(eventNotifier)
+    {}
+
+    void ScriptingServer::init() {
+        this->serverSocketFileDescriptor = this->createUnixServerSocket();
+
+        if (::listen(this->serverSocketFileDescriptor.value(), 3) != 0) {
+            throw Exception("Failed to listen on server socket");
+        }
+
+        this->eventLoop.watch(
+            this->serverSocketFileDescriptor.value(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                this->connectionPending = true;
+            }
+        );
+
+        this->eventLoop.watch(
+            this->interruptEventNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                this->interruptEventNotifier.clear();
+                this->interrupted = true;
+            }
+        );
+
+        this->eventLoop.watch(
+            this->executionEventNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                // There is no client to report to - we dispatch the events to prevent them from piling up
+                this->executionEventNotifier.clear();
+                this->executionEventListener->dispatchCurrentEvents();
+                this->interrupted = true;
+            }
+        );
+
+        Logger::info("Scripting socket: " + this->debugServerConfig.socketPath);
+
+        this->eventListener.registerCallbackForEventType<Events::TargetControllerStateChanged>(
+            std::bind(&ScriptingServer::onTargetControllerStateChanged, this, std::placeholders::_1)
+        );
+
+        this->executionEventListener->setInterruptEventNotifier(&this->executionEventNotifier);
+
+        this->executionEventListener->registerCallbackForEventType<Events::TargetExecutionStopped>(
+            std::bind(&ScriptingServer::onTargetExecutionStopped, this, std::placeholders::_1)
+        );
+
+        this->executionEventListener->registerCallbackForEventType<Events::TargetExecutionResumed>(
+            std::bind(&ScriptingServer::onTargetExecutionResumed, this, std::placeholders::_1)
+        );
+
+        EventManager::registerListener(this->executionEventListener);
+    }
+
+    void ScriptingServer::close() {
+        if (this->activeSession.has_value()) {
+            this->endSession();
+        }
+
+        EventManager::deregisterListener(this->executionEventListener->getId());
+        this->executionEventListener->setInterruptEventNotifier(nullptr);
+
+        if (this->serverSocketFileDescriptor.has_value()) {
+            this->eventLoop.unwatch(this->serverSocketFileDescriptor.value());
+            ::close(this->serverSocketFileDescriptor.value());
+            ::unlink(this->debugServerConfig.socketPath.c_str());
+        }
+    }
+
+    void ScriptingServer::run() {
+        try {
+            if (!this->activeSession.has_value()) {
+                Logger::info("Waiting for scripting connection");
+
+                auto connection = this->waitForConnection();
+                Logger::info("Accepted scripting connection");
+
+                this->startSession(std::move(connection));
+            }
+
+            auto& session = this->activeSession.value();
+            const auto messages = session.connection.readMessages();
+
+            if (messages.empty()) {
+                // A target execution event occurred - service it now, so that the client is notified immediately
+                this->executionEventListener->dispatchCurrentEvents();
+                return;
+            }
+
+            for (const auto& message : messages) {
+                this->handleRequest(session, message);
+            }
+
+        } catch (const ClientDisconnected&) {
+            Logger::info("Scripting client disconnected");
+            this->endSession();
+            return;
+
+        } catch (const ClientCommunicationError& exception) {
+            Logger::error(
+                "Scripting client communication error - " + exception.getMessage() + " - closing connection"
+            );
+            this->endSession();
+            return;
+
+        } catch (const DebugSessionInitialisationFailure& exception) {
+            Logger::warning("Scripting session initialisation failure - " + exception.getMessage());
+            this->endSession();
+            return;
+
+        } catch (const DebugServerInterrupted&) {
+            // Server was interrupted by an event
+            Logger::debug("Scripting server interrupted");
+            return;
+        }
+    }
+
+    int ScriptingServer::createUnixServerSocket() {
+        const auto& socketPath = this->debugServerConfig.socketPath;
+        auto socketAddress = sockaddr_un{};
+        socketAddress.sun_family = AF_UNIX;
+
+        if (socketPath.empty() || socketPath.size() >= sizeof(socketAddress.sun_path)) {
+            throw InvalidConfig(
+                "Invalid scripting socket path (\"" + socketPath + "\") - the path must be no longer than "
+                    + std::to_string(sizeof(socketAddress.sun_path) - 1) + " characters. Please set a shorter path "
+                    "via the 'socketPath' debug server parameter."
+            );
+        }
+
+        std::memcpy(socketAddress.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+        const auto socketFileDescriptor = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (socketFileDescriptor < 0) {
+            throw Exception("Failed to create socket file descriptor.");
+        }
+
+        // Remove any stale socket file, left behind by a previous instance that didn't shut down cleanly
+        ::unlink(socketPath.c_str());
+
+        if (::bind(
+                socketFileDescriptor,
+                reinterpret_cast<const sockaddr*>(&socketAddress),
+                sizeof(socketAddress)
+            ) < 0
+        ) {
+            ::close(socketFileDescriptor);
+            throw Exception(
+                "Failed to bind scripting socket (\"" + socketPath + "\") - " + std::string(std::strerror(errno))
+            );
+        }
+
+        return socketFileDescriptor;
+    }
+
+    Connection ScriptingServer::waitForConnection() {
+        this->connectionPending = false;
+        this->interrupted = false;
+
+        this->eventLoop.runOnce();
+
+        if (this->interrupted || !this->connectionPending) {
+            throw DebugServerInterrupted();
+        }
+
+        return Connection(this->serverSocketFileDescriptor.value(), this->interruptEventNotifier);
+    }
+
+    void ScriptingServer::startSession(Connection&& connection) {
+        if (!this->targetControllerService.isTargetControllerInService()) {
+            try {
+                this->targetControllerService.resumeTargetController();
+
+            } catch (const Exception& exception) {
+                Logger::error("Failed to wake up TargetController - " + exception.getMessage());
+            }
+
+            if (!this->targetControllerService.isTargetControllerInService()) {
+                throw DebugSessionInitialisationFailure("TargetController not in service");
+            }
+        }
+
+        connection.setWakeupNotifier(this->executionEventNotifier);
+
+        /*
+         * Unlike GDB and DAP sessions, we don't stop or reset the target at the start of the session. Scripts can
+         * attach to a running target, and issue a RESET request if they need one.
+         */
+        this->activeSession.emplace(std::move(connection), this->targetControllerService.getTargetDescriptor());
+    }
+
+    void ScriptingServer::endSession() {
+        if (this->activeSession.has_value() && !this->activeSession->breakpointAddresses.empty()) {
+            try {
+                auto commandBatch = std::make_unique<CommandBatch>();
+
+                for (const auto address : this->activeSession->breakpointAddresses) {
+                    commandBatch->addCommand(std::make_unique<RemoveBreakpoint>(Targets::TargetBreakpoint(address)));
+                }
+
+                this->targetControllerService.sendCommandBatch(std::move(commandBatch));
+
+            } catch (const Exception& exception) {
+                Logger::error("Failed to remove scripting client's breakpoints - " + exception.getMessage());
+            }
+        }
+
+        this->activeSession.reset();
+    }
+
+    void ScriptingServer::handleRequest(Session& session, const Message& request) {
+        static const auto requestHandlersByType = std::map<MessageType, RequestHandler>({
+            {MessageType::GET_STATE, &ScriptingServer::handleGetState},
+            {MessageType::READ_MEMORY, &ScriptingServer::handleReadMemory},
+            {MessageType::WRITE_MEMORY, &ScriptingServer::handleWriteMemory},
+            {MessageType::LIST_REGISTERS, &ScriptingServer::handleListRegisters},
+            {MessageType::READ_REGISTERS, &ScriptingServer::handleReadRegisters},
+            {MessageType::WRITE_REGISTERS, &ScriptingServer::handleWriteRegisters},
+            {MessageType::STOP, &ScriptingServer::handleStop},
+            {MessageType::CONTINUE, &ScriptingServer::handleContinue},
+            {MessageType::STEP, &ScriptingServer::handleStep},
+            {MessageType::RESET, &ScriptingServer::handleReset},
+            {MessageType::SET_PROGRAM_COUNTER, &ScriptingServer::handleSetProgramCounter},
+            {MessageType::SET_BREAKPOINTS, &ScriptingServer::handleSetBreakpoints},
+            {MessageType::REMOVE_BREAKPOINTS, &ScriptingServer::handleRemoveBreakpoints},
+            {MessageType::SUBSCRIBE, &ScriptingServer::handleSubscribe},
+        });
+
+        static auto& requestCounter = Services::MetricsService::counter("scripting.requests");
+        requestCounter.increment();
+
+        const auto handlerIt = requestHandlersByType.find(request.type);
+
+        if (handlerIt == requestHandlersByType.end()) {
+            Logger::debug(
+                "Unsupported scripting request type: " + std::to_string(static_cast<int>(request.type))
+            );
+
+            session.connection.writeMessage(
+                MessageType::ERROR,
+                request.requestId,
+                PayloadWriter().writeString("Unsupported request").payload
+            );
+            return;
+        }
+
+        try {
+            auto requestReader = PayloadReader(request.payload);
+            auto response = PayloadWriter();
+
+            {
+                const auto traceSpan = Services::TraceService::Span("ScriptingServer::handleRequest", "DebugServer");
+                (this->*(handlerIt->second))(session, requestReader, response);
+            }
+
+            session.connection.writeMessage(MessageType::RESPONSE, request.requestId, response.payload);
+
+        } catch (const ClientDisconnected&) {
+            throw;
+
+        } catch (const ClientCommunicationError&) {
+            throw;
+
+        } catch (const Exception& exception) {
+            Logger::debug("Failed to handle scripting request - " + exception.getMessage());
+            session.connection.writeMessage(
+                MessageType::ERROR,
+                request.requestId,
+                PayloadWriter().writeString(exception.getMessage()).payload
+            );
+        }
+    }
+
+    void ScriptingServer::handleGetState(Session&, PayloadReader&, PayloadWriter& response) {
+        const auto targetState = this->targetControllerService.getTargetState();
+
+        response.writeUint8(static_cast<std::uint8_t>(targetState));
+        response.writeUint32(
+            targetState == Targets::TargetState::STOPPED ? this->targetControllerService.getProgramCounter() : 0
+        );
+    }
+
+    void ScriptingServer::handleReadMemory(Session& session, PayloadReader& request, PayloadWriter& response) {
+        const auto readCount = request.readUint16();
+
+        auto commandBatch = std::make_unique<CommandBatch>();
+        auto totalSize = TargetMemorySize(0);
+
+        for (auto readIndex = std::uint16_t(0); readIndex < readCount; ++readIndex) {
+            const auto memoryType = ScriptingServer::readMemoryType(session, request);
+            const auto startAddress = request.readUint32();
+            const auto bytes = request.readUint32();
+
+            totalSize += bytes;
+            if (totalSize > ScriptingServer::MAXIMUM_READ_SIZE) {
+                throw Exception(
+                    "Read size exceeds maximum (" + std::to_string(ScriptingServer::MAXIMUM_READ_SIZE) + " bytes)"
+                );
+            }
+
+            commandBatch->addCommand(
+                std::make_unique<ReadTargetMemory>(
+                    memoryType,
+                    startAddress,
+                    bytes,
+                    std::set<Targets::TargetMemoryAddressRange>()
+                )
+            );
+        }
+
+        if (readCount == 0) {
+            return;
+        }
+
+        auto batchResponses = this->targetControllerService.sendCommandBatch(std::move(commandBatch));
+        response.payload.reserve(totalSize);
+
+        for (auto readIndex = std::size_t(0); readIndex < readCount; ++readIndex) {
+            response.writeBytes(batchResponses->takeResponse<ReadTargetMemory>(readIndex)->takeData());
+        }
+    }
+
+    void ScriptingServer::handleWriteMemory(Session& session, PayloadReader& request, PayloadWriter&) {
+        const auto writeCount = request.readUint16();
+
+        auto commandBatch = std::make_unique<CommandBatch>();
+
+        for (auto writeIndex = std::uint16_t(0); writeIndex < writeCount; ++writeIndex) {
+            const auto memoryType = ScriptingServer::readMemoryType(session, request);
+            const auto startAddress = request.readUint32();
+            const auto data = request.readBytes(request.readUint32());
+
+            commandBatch->addCommand(
+                std::make_unique<WriteTargetMemory>(
+                    memoryType,
+                    startAddress,
+                    TargetMemoryBuffer(data.begin(), data.end())
+                )
+            );
+        }
+
+        if (writeCount == 0) {
+            return;
+        }
+
+        auto batchResponses = this->targetControllerService.sendCommandBatch(std::move(commandBatch));
+
+        for (auto writeIndex = std::size_t(0); writeIndex < writeCount; ++writeIndex) {
+            batchResponses->takeResponse<WriteTargetMemory>(writeIndex);
+        }
+    }
+
+    void ScriptingServer::handleListRegisters(Session& session, PayloadReader&, PayloadWriter& response) {
+        response.writeUint16(static_cast<std::uint16_t>(session.registerDescriptors.size()));
+
+        for (const auto& descriptor : session.registerDescriptors) {
+            response.writeUint8(static_cast<std::uint8_t>(descriptor.type));
+            response.writeUint8(static_cast<std::uint8_t>(descriptor.memoryType));
+            response.writeUint32(descriptor.startAddress.value_or(0));
+            response.writeUint16(static_cast<std::uint16_t>(descriptor.size));
+            response.writeUint8(
+                static_cast<std::uint8_t>((descriptor.readable ? 0x01 : 0x00) | (descriptor.writable ? 0x02 : 0x00))
+            );
+            response.writeString(descriptor.name.value_or(""));
+            response.writeString(descriptor.groupName.value_or(""));
+        }
+    }
+
+    void ScriptingServer::handleReadRegisters(Session& session, PayloadReader& request, PayloadWriter& response) {
+        const auto registerCount = request.readUint16();
+
+        auto requestedDescriptors = std::vector<TargetRegisterDescriptor>();
+        auto descriptors = TargetRegisterDescriptors();
+
+        for (auto registerIndex = std::uint16_t(0); registerIndex < registerCount; ++registerIndex) {
+            const auto& descriptor = ScriptingServer::readRegisterDescriptor(session, request);
+            requestedDescriptors.push_back(descriptor);
+            descriptors.insert(descriptor);
+        }
+
+        if (descriptors.empty()) {
+            return;
+        }
+
+        const auto registers = this->targetControllerService.readRegisters(descriptors);
+
+        // The values are returned in the order in which they were requested, regardless of the order of the read
+        for (const auto& descriptor : requestedDescriptors) {
+            const auto registerIt = std::find_if(
+                registers.begin(),
+                registers.end(),
+                [&descriptor] (const TargetRegister& targetRegister) {
+                    return targetRegister.descriptor == descriptor;
+                }
+            );
+
+            if (registerIt == registers.end() || registerIt->value.size() != descriptor.size) {
+                throw Exception("Failed to read register \"" + descriptor.name.value_or("") + "\"");
+            }
+
+            response.writeBytes(registerIt->value);
+        }
+    }
+
+    void ScriptingServer::handleWriteRegisters(Session& session, PayloadReader& request, PayloadWriter&) {
+        const auto registerCount = request.readUint16();
+
+        auto registers = TargetRegisters();
+        registers.reserve(registerCount);
+
+        for (auto registerIndex = std::uint16_t(0); registerIndex < registerCount; ++registerIndex) {
+            const auto& descriptor = ScriptingServer::readRegisterDescriptor(session, request);
+
+            if (!descriptor.writable) {
+                throw Exception("Register \"" + descriptor.name.value_or("") + "\" is not writable");
+            }
+
+            const auto value = request.readBytes(descriptor.size);
+            registers.emplace_back(descriptor, TargetMemoryBuffer(value.begin(), value.end()));
+        }
+
+        if (!registers.empty()) {
+            this->targetControllerService.writeRegisters(registers);
+        }
+    }
+
+    void ScriptingServer::handleStop(Session&, PayloadReader&, PayloadWriter& response) {
+        this->targetControllerService.stopTargetExecution();
+        response.writeUint32(this->targetControllerService.getProgramCounter());
+    }
+
+    void ScriptingServer::handleContinue(Session&, PayloadReader& request, PayloadWriter&) {
+        auto toAddress = std::optional<TargetMemoryAddress>();
+
+        if (!request.atEnd()) {
+            toAddress = request.readUint32();
+        }
+
+        this->targetControllerService.continueTargetExecution(std::nullopt, toAddress);
+    }
+
+    void ScriptingServer::handleStep(Session&, PayloadReader&, PayloadWriter&) {
+        this->targetControllerService.stepTargetExecution(std::nullopt);
+    }
+
+    void ScriptingServer::handleReset(Session&, PayloadReader&, PayloadWriter&) {
+        this->targetControllerService.resetTarget();
+    }
+
+    void ScriptingServer::handleSetProgramCounter(Session&, PayloadReader& request, PayloadWriter&) {
+        this->targetControllerService.setProgramCounter(request.readUint32());
+    }
+
+    void ScriptingServer::handleSetBreakpoints(Session& session, PayloadReader& request, PayloadWriter& response) {
+        const auto breakpointCount = request.readUint16();
+
+        auto commandBatch = std::make_unique<CommandBatch>();
+        auto addresses = std::vector<TargetMemoryAddress>();
+
+        for (auto breakpointIndex = std::uint16_t(0); breakpointIndex < breakpointCount; ++breakpointIndex) {
+            const auto address = request.readUint32();
+            addresses.push_back(address);
+            commandBatch->addCommand(std::make_unique<SetBreakpoint>(Targets::TargetBreakpoint(address)));
+        }
+
+        if (addresses.empty()) {
+            return;
+        }
+
+        auto batchResponses = this->targetControllerService.sendCommandBatch(std::move(commandBatch));
+
+        // One status byte per breakpoint - 0x00 for success, 0x01 for failure
+        for (auto breakpointIndex = std::size_t(0); breakpointIndex < addresses.size(); ++breakpointIndex) {
+            try {
+                batchResponses->takeResponse<SetBreakpoint>(breakpointIndex);
+                session.breakpointAddresses.insert(addresses[breakpointIndex]);
+                response.writeUint8(0x00);
+
+            } catch (const Exception& exception) {
+                Logger::debug(
+                    "Failed to set breakpoint at byte address " + std::to_string(addresses[breakpointIndex]) + " - "
+                        + exception.getMessage()
+                );
+                response.writeUint8(0x01);
+            }
+        }
+    }
+
+    void ScriptingServer::handleRemoveBreakpoints(Session& session, PayloadReader& request, PayloadWriter&) {
+        const auto breakpointCount = request.readUint16();
+
+        auto commandBatch = std::make_unique<CommandBatch>();
+        auto addresses = std::vector<TargetMemoryAddress>();
+
+        for (auto breakpointIndex = std::uint16_t(0); breakpointIndex < breakpointCount; ++breakpointIndex) {
+            const auto address = request.readUint32();
+            addresses.push_back(address);
+            commandBatch->addCommand(std::make_unique<RemoveBreakpoint>(Targets::TargetBreakpoint(address)));
+        }
+
+        if (addresses.empty()) {
+            return;
+        }
+
+        auto batchResponses = this->targetControllerService.sendCommandBatch(std::move(commandBatch));
+
+        for (auto breakpointIndex = std::size_t(0); breakpointIndex < addresses.size(); ++breakpointIndex) {
+            batchResponses->takeResponse<RemoveBreakpoint>(breakpointIndex);
+            session.breakpointAddresses.erase(addresses[breakpointIndex]);
+        }
+    }
+
+    void ScriptingServer::handleSubscribe(Session& session, PayloadReader& request, PayloadWriter&) {
+        session.eventSubscriptions = request.readUint8();
+    }
+
+    TargetMemoryType ScriptingServer::readMemoryType(const Session& session, PayloadReader& request) {
+        const auto memoryType = static_cast<TargetMemoryType>(request.readUint8());
+
+        if (!session.targetDescriptor->memoryDescriptorsByType.contains(memoryType)) {
+            throw Exception(
+                "Invalid memory type (" + std::to_string(static_cast<int>(memoryType)) + ") - the target has no such "
+                    "memory"
+            );
+        }
+
+        return memoryType;
+    }
+
+    const TargetRegisterDescriptor& ScriptingServer::readRegisterDescriptor(
+        const Session& session,
+        PayloadReader& request
+    ) {
+        const auto registerNumber = request.readUint16();
+
+        if (registerNumber >= session.registerDescriptors.size()) {
+            throw Exception("Invalid register number (" + std::to_string(registerNumber) + ")");
+        }
+
+        return session.registerDescriptors[registerNumber];
+    }
+
+    void ScriptingServer::writeEvent(Session& session, EventType eventType, const std::vector<unsigned char>& payload) {
+        auto event = PayloadWriter();
+        event.writeUint8(static_cast<std::uint8_t>(eventType)).writeBytes(payload);
+
+        try {
+            session.connection.writeMessage(MessageType::EVENT, 0, event.payload);
+
+        } catch (const Exception& exception) {
+            // Any connection problems will be picked up upon the next read
+            Logger::debug("Failed to deliver scripting event - " + exception.getMessage());
+        }
+    }
+
+    void ScriptingServer::onTargetControllerStateChanged(const Events::TargetControllerStateChanged& event) {
+        if (event.state == TargetControllerState::SUSPENDED && this->activeSession.has_value()) {
+            Logger::warning("TargetController suspended unexpectedly - terminating scripting session");
+            this->activeSession.reset();
+        }
+    }
+
+    void ScriptingServer::onTargetExecutionStopped(const Events::TargetExecutionStopped& event) {
+        if (
+            !this->activeSession.has_value()
+            || (this->activeSession->eventSubscriptions & EVENT_SUBSCRIPTION_TARGET_STOPPED) == 0
+        ) {
+            return;
+        }
+
+        auto payload = PayloadWriter();
+        payload.writeUint32(event.programCounter);
+        payload.writeUint8(event.breakCause == Targets::TargetBreakCause::BREAKPOINT ? 0x01 : 0x00);
+
+        this->writeEvent(*(this->activeSession), EventType::TARGET_STOPPED, payload.payload);
+    }
+
+    void ScriptingServer::onTargetExecutionResumed(const Events::TargetExecutionResumed& event) {
+        if (
+            !this->activeSession.has_value()
+            || (this->activeSession->eventSubscriptions & EVENT_SUBSCRIPTION_TARGET_RESUMED) == 0
+        ) {
+            return;
+        }
+
+        auto payload = PayloadWriter();
+        payload.writeUint8(event.stepping ? 0x01 : 0x00);
+
+        this->writeEvent(*(this->activeSession), EventType::TARGET_RESUMED, payload.payload);
+    }
+}
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <set>
+#include <optional>
+#include <memory>
+
+#include "src/DebugServer/ServerInterface.hpp"
+
+#include "ScriptingServerConfig.hpp"
+#include "Connection.hpp"
+#include "Protocol.hpp"
+
+#include "src/EventManager/EventListener.hpp"
+#include "src/Helpers/EventLoop.hpp"
+#include "src/Helpers/EventFdNotifier.hpp"
+#include "src/Services/TargetControllerService.hpp"
+
+#include "src/Targets/TargetDescriptor.hpp"
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetRegister.hpp"
+
+#include "src/EventManager/Events/TargetControllerStateChanged.hpp"
+#include "src/EventManager/Events/TargetExecutionStopped.hpp"
+#include "src/EventManager/Events/TargetExecutionResumed.hpp"
+
+namespace Bloom::DebugServer::Scripting
+{
+    /**
+     * The ScriptingServer exposes the TargetControllerService to test automation scripts, via a compact binary
+     * protocol (see Protocol.hpp), over a Unix domain socket.
+     *
+     * Scripts that drive the target via GDB/MI pay for GDB's startup and for the parsing of GDB/MI records, on every
+     * operation. This server maps its requests directly onto the TargetControllerService, and batched requests (memory
+     * reads/writes, register reads/writes and breakpoint changes) are serviced with a single TargetController command
+     * batch. Clients may also pipeline requests.
+     *
+     * Addresses are target addresses (not avr-gcc's address space), and memory types are given explicitly. See
+     * src/DebugServer/Scripting/README.md for the request and response payloads.
+     */
+    class ScriptingServer: public ServerInterface
+    {
+    public:
+        explicit ScriptingServer(
+            const DebugServerConfig& debugServerConfig,
+            EventListener& eventListener,
+            EventFdNotifier& eventNotifier
+        );
+
+        ScriptingServer() = delete;
+        ~ScriptingServer() override = default;
+
+        ScriptingServer(const ScriptingServer& other) = delete;
+        ScriptingServer(ScriptingServer&& other) = delete;
+
+        ScriptingServer& operator = (const ScriptingServer& other) = delete;
+        ScriptingServer& operator = (ScriptingServer&& other) = delete;
+
+        [[nodiscard]] std::string getName() const override {
+            return "Scripting DebugServer";
+        };
+
+        /**
+         * Creates the Unix domain socket and starts listening on it.
+         */
+        void init() override;
+
+        /**
+         * Ends any active session, closes the listening socket and removes the socket file.
+         */
+        void close() override;
+
+        /**
+         * Waits for a connection from a client or services an active one.
+         *
+         * This function will return when any blocking operation is interrupted via this->interruptEventNotifier.
+         */
+        void run() override;
+
+    private:
+        /**
+         * The maximum total size of the data in a single READ_MEMORY request.
+         */
+        static constexpr Targets::TargetMemorySize MAXIMUM_READ_SIZE = 8 * 1024 * 1024;
+
+        struct Session
+        {
+            Connection connection;
+
+            std::shared_ptr<const Targets::TargetDescriptor> targetDescriptor;
+
+            /**
+             * All of the target's register descriptors, indexed by the register numbers that we report in response
+             * to LIST_REGISTERS requests.
+             */
+            std::vector<Targets::TargetRegisterDescriptor> registerDescriptors;
+
+            /**
+             * The breakpoints set by the client. These are removed when the session ends.
+             */
+            std::set<Targets::TargetMemoryAddress> breakpointAddresses;
+
+            /**
+             * See EVENT_SUBSCRIPTION_TARGET_STOPPED and EVENT_SUBSCRIPTION_TARGET_RESUMED.
+             */
+            std::uint8_t eventSubscriptions = 0;
+
+            Session(Connection&& connection, std::shared_ptr<const Targets::TargetDescriptor> targetDescriptor);
+        };
+
+        using RequestHandler = void (ScriptingServer::*)(
+            Session& session,
+            PayloadReader& request,
+            PayloadWriter& response
+        );
+
+        ScriptingServerConfig debugServerConfig;
+
+        /**
+         * The DebugServerComponent's event listener.
+         */
+        EventListener& eventListener;
+
+        /**
+         * See Dap::DapDebugServer::interruptEventNotifier.
+         */
+        EventFdNotifier& interruptEventNotifier;
+
+        /**
+         * A dedicated event listener for target execution events, which wakes the connection so that events are
+         * delivered to the client without delay. See Dap::DapDebugServer::executionEventListener.
+         */
+        std::shared_ptr<EventListener> executionEventListener = std::make_shared<EventListener>(
+            "ScriptingServerExecutionEventListener"
+        );
+
+        EventFdNotifier executionEventNotifier = EventFdNotifier();
+
+        EventLoop eventLoop;
+        bool connectionPending = false;
+        bool interrupted = false;
+
+        Services::TargetControllerService targetControllerService = Services::TargetControllerService();
+
+        std::optional<int> serverSocketFileDescriptor;
+
+        std::optional<Session> activeSession;
+
+        int createUnixServerSocket();
+
+        Connection waitForConnection();
+
+        void startSession(Connection&& connection);
+
+        /**
+         * Removes the client's breakpoints and ends the session.
+         */
+        void endSession();
+
+        /**
+         * Dispatches the given request to the appropriate handler, and sends the response.
+         *
+         * @param session
+         * @param request
+         */
+        void handleRequest(Session& session, const Message& request);
+
+        void handleGetState(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleReadMemory(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleWriteMemory(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleListRegisters(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleReadRegisters(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleWriteRegisters(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleStop(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleContinue(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleStep(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleReset(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleSetProgramCounter(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleSetBreakpoints(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleRemoveBreakpoints(Session& session, PayloadReader& request, PayloadWriter& response);
+        void handleSubscribe(Session& session, PayloadReader& request, PayloadWriter& response);
+
+        /**
+         * Reads a memory type from the request, rejecting any memory types that the target doesn't have.
+         *
+         * @param session
+         * @param request
+         *
+         * @return
+         */
+        static Targets::TargetMemoryType readMemoryType(const Session& session, PayloadReader& request);
+
+        /**
+         * Reads a register number from the request, and returns the corresponding descriptor.
+         *
+         * @param session
+         * @param request
+         *
+         * @return
+         */
+        static const Targets::TargetRegisterDescriptor& readRegisterDescriptor(
+            const Session& session,
+            PayloadReader& request
+        );
+
+        void writeEvent(Session& session, EventType eventType, const std::vector<unsigned char>& payload);
+
+        void onTargetControllerStateChanged(const Events::TargetControllerStateChanged& event);
+        void onTargetExecutionStopped(const Events::TargetExecutionStopped& event);
+        void onTargetExecutionResumed(const Events::TargetExecutionResumed& event);
+    };
+}
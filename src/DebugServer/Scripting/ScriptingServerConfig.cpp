@@ -0,0 +1,25 @@
+#include "ScriptingServerConfig.hpp"
+
+#include "src/Services/PathService.hpp"
+#include "src/Helpers/YamlUtilities.hpp"
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Scripting
+{
+    ScriptingServerConfig::ScriptingServerConfig(const DebugServerConfig& debugServerConfig)
+        : DebugServerConfig(debugServerConfig)
+        , socketPath(Services::PathService::projectSettingsDirPath() + "/scripting.sock")
+    {
+        if (debugServerConfig.debugServerNode["socketPath"]) {
+            if (YamlUtilities::isCastable<std::string>(debugServerConfig.debugServerNode["socketPath"])) {
+                this->socketPath = debugServerConfig.debugServerNode["socketPath"].as<std::string>();
+
+            } else {
+                Logger::error(
+                    "Invalid scripting server config parameter ('socketPath') provided - must be a string. The "
+                    "parameter will be ignored."
+                );
+            }
+        }
+    }
+}
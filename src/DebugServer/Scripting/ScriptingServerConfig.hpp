@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+#include "src/ProjectConfig.hpp"
+
+namespace Bloom::DebugServer::Scripting
+{
+    /**
+     * Extending the generic DebugServerConfig struct to accommodate scripting server configuration parameters.
+     */
+    class ScriptingServerConfig: public DebugServerConfig
+    {
+    public:
+        /**
+         * The path of the Unix domain socket for the scripting server to listen on.
+         *
+         * This parameter is optional. If not specified, the socket will be created in the project's settings
+         * directory (.bloom/scripting.sock).
+         */
+        std::string socketPath;
+
+        explicit ScriptingServerConfig(const DebugServerConfig& debugServerConfig);
+    };
+}
@@ -11,3 +11,6 @@
 #include "src/DebugToolDrivers/Microchip/XplainedNano/XplainedNano.hpp"
 #include "src/DebugToolDrivers/Microchip/CuriosityNano/CuriosityNano.hpp"
 #include "src/DebugToolDrivers/Microchip/JtagIce3/JtagIce3.hpp"
+#include "src/DebugToolDrivers/Mock/MockDebugTool.hpp"
+#include "src/DebugToolDrivers/Simulator/SimulatorDebugTool.hpp"
+#include "src/DebugToolDrivers/Microchip/EdbgReplay/EdbgReplayDevice.hpp"
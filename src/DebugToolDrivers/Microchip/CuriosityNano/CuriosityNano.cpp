@@ -9,5 +9,7 @@ namespace Bloom::DebugToolDrivers
             CuriosityNano::CMSIS_HID_INTERFACE_NUMBER,
             true
         )
-    {}
+    {
+        this->preferCmsisBulkInterface = true;
+    }
 }
@@ -1,17 +1,27 @@
 #include "EdbgDevice.hpp"
 
+#include <string>
+#include <array>
+#include <vector>
+#include <algorithm>
+
 #include "src/DebugToolDrivers/USB/HID/HidInterface.hpp"
+#include "src/DebugToolDrivers/USB/Trace/RecordingPacketInterface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AvrCommandFrames.hpp"
 
 #include "src/TargetController/Exceptions/DeviceFailure.hpp"
 #include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
 
+#include "src/Logger/Logger.hpp"
+
 namespace Bloom::DebugToolDrivers
 {
     using namespace Protocols::CmsisDap::Edbg::Avr;
     using namespace Bloom::Exceptions;
 
     using Protocols::CmsisDap::Edbg::EdbgInterface;
+    using Protocols::CmsisDap::Edbg::EdbgToolCapabilities;
+    using Protocols::CmsisDap::Edbg::ProtocolHandlerId;
     using Protocols::CmsisDap::Edbg::EdbgTargetPowerManagementInterface;
 
     EdbgDevice::EdbgDevice(
@@ -36,52 +46,105 @@ namespace Bloom::DebugToolDrivers
             this->setConfiguration(this->configurationIndex.value());
         }
 
-        auto cmsisHidInterface = Usb::HidInterface(
-            this->cmsisHidInterfaceNumber,
-            this->getCmsisHidReportSize(),
-            this->vendorId,
-            this->productId
+        auto cmsisUsbInterface = std::unique_ptr<Usb::PacketInterface>(
+            this->preferCmsisBulkInterface ? this->findCmsisBulkInterface() : nullptr
         );
 
-        cmsisHidInterface.init();
+        if (cmsisUsbInterface != nullptr) {
+            Logger::debug(
+                "Using CMSIS-DAP bulk interface (packet size: " + std::to_string(cmsisUsbInterface->getPacketSize())
+                    + " bytes)"
+            );
+
+        } else {
+            cmsisUsbInterface = std::make_unique<Usb::HidInterface>(
+                this->cmsisHidInterfaceNumber,
+                this->getCmsisHidReportSize(),
+                this->vendorId,
+                this->productId
+            );
+        }
+
+        cmsisUsbInterface->init();
+
+        if (this->usbTraceRecordingFilePath.has_value()) {
+            cmsisUsbInterface = std::make_unique<Usb::RecordingPacketInterface>(
+                std::move(cmsisUsbInterface),
+                *(this->usbTraceRecordingFilePath)
+            );
+        }
+
+        this->initEdbgInterface(std::move(cmsisUsbInterface));
+    }
+
+    void EdbgDevice::close() {
+        if (this->sessionStarted) {
+            this->endSession();
+        }
 
-        this->edbgInterface = std::make_unique<EdbgInterface>(std::move(cmsisHidInterface));
+        this->edbgInterface->getUsbInterface().close();
+        UsbDevice::close();
+    }
+
+    void EdbgDevice::recordUsbTrace(const std::string& traceFilePath) {
+        this->usbTraceRecordingFilePath = traceFilePath;
+    }
+
+    void EdbgDevice::initEdbgInterface(std::unique_ptr<Usb::PacketInterface> cmsisUsbInterface) {
+        this->edbgInterface = std::make_unique<EdbgInterface>(std::move(cmsisUsbInterface));
 
         /*
          * The EDBG/CMSIS-DAP interface doesn't operate properly when sending commands too quickly.
          *
          * Because of this, we have to enforce a minimum time gap between commands. See comment
          * in CmsisDapInterface class declaration for more info.
+         *
+         * With adaptive pacing, the gap is only enforced whilst the tool indicates that it's busy, so we're not
+         * throttled when the tool is idle.
          */
         this->edbgInterface->setMinimumCommandTimeGap(std::chrono::milliseconds(35));
+        this->edbgInterface->setAdaptiveCommandPacing(true);
 
         // We don't need to claim the CMSISDAP interface here as the HIDAPI will have already done so.
         if (!this->sessionStarted) {
             this->startSession();
         }
 
-        if (this->supportsTargetPowerManagement) {
+        this->toolCapabilities = this->probeToolCapabilities();
+
+        const auto firmwareVersion = this->toolCapabilities.getFirmwareVersionString();
+        if (firmwareVersion.has_value()) {
+            Logger::debug("Debug tool firmware version: " + *firmwareVersion);
+        }
+
+        if (
+            this->supportsTargetPowerManagement
+            && this->toolCapabilities.supportsProtocol(ProtocolHandlerId::EDBG_CONTROL)
+        ) {
             this->targetPowerManagementInterface = std::make_unique<EdbgTargetPowerManagementInterface>(
                 this->edbgInterface.get()
             );
         }
 
         this->edbgAvr8Interface = std::make_unique<EdbgAvr8Interface>(this->edbgInterface.get());
-        this->edbgAvrIspInterface = std::make_unique<EdbgAvrIspInterface>(this->edbgInterface.get());
+        this->edbgAvr8Interface->setMaximumFrameSize(this->toolCapabilities.maximumAvrFrameSize);
+        this->edbgAvr8Interface->setToolSerialNumber(this->toolCapabilities.serialNumber);
 
-        this->setInitialised(true);
-    }
+        if (this->toolCapabilities.supportsProtocol(ProtocolHandlerId::AVRISP)) {
+            this->edbgAvrIspInterface = std::make_unique<EdbgAvrIspInterface>(this->edbgInterface.get());
 
-    void EdbgDevice::close() {
-        if (this->sessionStarted) {
-            this->endSession();
+        } else {
+            Logger::debug("Debug tool firmware doesn't implement the AVRISP protocol - ISP interface unavailable");
         }
 
-        this->edbgInterface->getUsbHidInterface().close();
-        UsbDevice::close();
+        this->setInitialised(true);
     }
 
     std::string EdbgDevice::getSerialNumber() {
+        if (this->toolCapabilities.serialNumber.has_value()) {
+            return *this->toolCapabilities.serialNumber;
+        }
+
         using namespace CommandFrames::Discovery;
         using ResponseFrames::Discovery::ResponseId;
 
@@ -131,6 +194,95 @@ namespace Bloom::DebugToolDrivers
         this->sessionStarted = false;
     }
 
+    EdbgToolCapabilities EdbgDevice::probeToolCapabilities() {
+        using namespace CommandFrames::Discovery;
+        using CommandFrames::HouseKeeping::GetParameter;
+        using CommandFrames::HouseKeeping::Parameter;
+        using CommandFrames::HouseKeeping::Parameters;
+        using DiscoveryResponseId = ResponseFrames::Discovery::ResponseId;
+        using HouseKeepingResponseId = ResponseFrames::HouseKeeping::ResponseId;
+
+        const auto query = [this] (QueryContext context) -> std::optional<std::vector<unsigned char>> {
+            const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+                Query(context)
+            );
+
+            if (responseFrame.id != DiscoveryResponseId::OK) {
+                return std::nullopt;
+            }
+
+            return responseFrame.getPayloadData();
+        };
+
+        auto capabilities = EdbgToolCapabilities();
+
+        const auto serialNumberData = query(QueryContext::SERIAL_NUMBER);
+        if (serialNumberData.has_value()) {
+            capabilities.serialNumber = std::string(serialNumberData->begin(), serialNumberData->end());
+
+            const auto cachedCapabilitiesIt = EdbgDevice::toolCapabilitiesBySerialNumber.find(
+                *capabilities.serialNumber
+            );
+
+            if (cachedCapabilitiesIt != EdbgDevice::toolCapabilitiesBySerialNumber.end()) {
+                return cachedCapabilitiesIt->second;
+            }
+        }
+
+        // Parameter values are little-endian
+        const auto getParameter = [this] (const Parameter& parameter) -> std::optional<std::uint16_t> {
+            const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+                GetParameter(parameter, parameter.size)
+            );
+
+            if (responseFrame.id != HouseKeepingResponseId::DATA) {
+                return std::nullopt;
+            }
+
+            const auto data = responseFrame.getPayloadData();
+            if (data.size() < parameter.size) {
+                return std::nullopt;
+            }
+
+            return parameter.size > 1
+                ? static_cast<std::uint16_t>(data[0] | (data[1] << 8))
+                : static_cast<std::uint16_t>(data[0]);
+        };
+
+        const auto toByte = [] (std::optional<std::uint16_t> value) -> std::optional<std::uint8_t> {
+            return value.has_value() ? std::optional(static_cast<std::uint8_t>(*value)) : std::nullopt;
+        };
+
+        capabilities.hardwareVersion = toByte(getParameter(Parameters::CONFIG_HARDWARE_VERSION));
+        capabilities.firmwareMajorVersion = toByte(getParameter(Parameters::CONFIG_FIRMWARE_MAJOR_VERSION));
+        capabilities.firmwareMinorVersion = toByte(getParameter(Parameters::CONFIG_FIRMWARE_MINOR_VERSION));
+        capabilities.firmwareBuildNumber = getParameter(Parameters::CONFIG_FIRMWARE_BUILD_NUMBER);
+
+        const auto commandHandlerData = query(QueryContext::COMMAND_HANDLERS);
+        if (commandHandlerData.has_value()) {
+            for (const auto handlerId : *commandHandlerData) {
+                capabilities.protocolHandlerIds.insert(static_cast<ProtocolHandlerId>(handlerId));
+            }
+        }
+
+        const auto maximumReadSize = getParameter(Parameters::USB_MAX_READ);
+        const auto maximumWriteSize = getParameter(Parameters::USB_MAX_WRITE);
+
+        if (maximumReadSize.has_value() && maximumWriteSize.has_value()) {
+            capabilities.maximumAvrFrameSize = std::min(*maximumReadSize, *maximumWriteSize);
+
+            Logger::debug(
+                "Debug tool maximum AVR frame size: " + std::to_string(*capabilities.maximumAvrFrameSize) + " bytes"
+            );
+        }
+
+        if (capabilities.serialNumber.has_value()) {
+            EdbgDevice::toolCapabilitiesBySerialNumber.insert(std::pair(*capabilities.serialNumber, capabilities));
+        }
+
+        return capabilities;
+    }
+
     std::uint16_t EdbgDevice::getCmsisHidReportSize() {
         const auto activeConfigDescriptor = this->getConfigDescriptor();
 
@@ -159,4 +311,74 @@ namespace Bloom::DebugToolDrivers
             + ") and interface number (" + std::to_string(this->cmsisHidInterfaceNumber) + ")"
         );
     }
+
+    std::unique_ptr<Usb::UsbBulkInterface> EdbgDevice::findCmsisBulkInterface() {
+        return this->findBulkInterface("CMSIS-DAP");
+    }
+
+    std::unique_ptr<Usb::UsbBulkInterface> EdbgDevice::findBulkInterface(const std::string& interfaceName) {
+        const auto activeConfigDescriptor = this->getConfigDescriptor();
+
+        for (auto interfaceIndex = 0; interfaceIndex < activeConfigDescriptor->bNumInterfaces; ++interfaceIndex) {
+            const auto* interfaceDescriptor = (activeConfigDescriptor->interface + interfaceIndex)->altsetting;
+
+            if (interfaceDescriptor->bInterfaceClass != LIBUSB_CLASS_VENDOR_SPEC) {
+                continue;
+            }
+
+            auto inEndpointDescriptor = std::optional<const ::libusb_endpoint_descriptor*>();
+            auto outEndpointDescriptor = std::optional<const ::libusb_endpoint_descriptor*>();
+
+            for (auto endpointIndex = 0; endpointIndex < interfaceDescriptor->bNumEndpoints; ++endpointIndex) {
+                const auto* endpointDescriptor = (interfaceDescriptor->endpoint + endpointIndex);
+
+                if ((endpointDescriptor->bmAttributes & LIBUSB_TRANSFER_TYPE_MASK) != LIBUSB_TRANSFER_TYPE_BULK) {
+                    continue;
+                }
+
+                if ((endpointDescriptor->bEndpointAddress & LIBUSB_ENDPOINT_DIR_MASK) == LIBUSB_ENDPOINT_IN) {
+                    if (!inEndpointDescriptor.has_value()) {
+                        inEndpointDescriptor = endpointDescriptor;
+                    }
+
+                } else if (!outEndpointDescriptor.has_value()) {
+                    outEndpointDescriptor = endpointDescriptor;
+                }
+            }
+
+            if (!inEndpointDescriptor.has_value() || !outEndpointDescriptor.has_value()) {
+                continue;
+            }
+
+            auto interfaceString = std::array<unsigned char, 256>();
+            const auto interfaceStringLength = ::libusb_get_string_descriptor_ascii(
+                this->libusbDeviceHandle.get(),
+                interfaceDescriptor->iInterface,
+                interfaceString.data(),
+                static_cast<int>(interfaceString.size())
+            );
+
+            if (
+                interfaceStringLength <= 0
+                || std::string(
+                    interfaceString.begin(),
+                    interfaceString.begin() + interfaceStringLength
+                ).find(interfaceName) == std::string::npos
+            ) {
+                continue;
+            }
+
+            this->detachKernelDriverFromInterface(interfaceDescriptor->bInterfaceNumber);
+
+            return std::make_unique<Usb::UsbBulkInterface>(
+                this->libusbDeviceHandle.get(),
+                interfaceDescriptor->bInterfaceNumber,
+                (*inEndpointDescriptor)->bEndpointAddress,
+                (*outEndpointDescriptor)->bEndpointAddress,
+                (*inEndpointDescriptor)->wMaxPacketSize
+            );
+        }
+
+        return nullptr;
+    }
 }
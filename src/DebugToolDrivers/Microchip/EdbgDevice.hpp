@@ -3,11 +3,15 @@
 #include <cstdint>
 #include <optional>
 #include <memory>
+#include <map>
+#include <string>
 
 #include "src/DebugToolDrivers/DebugTool.hpp"
 #include "src/DebugToolDrivers/USB/UsbDevice.hpp"
+#include "src/DebugToolDrivers/USB/UsbBulkInterface.hpp"
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/EdbgInterface.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/EdbgToolCapabilities.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/EdbgAvr8Interface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/EdbgAvrIspInterface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/EdbgTargetPowerManagementInterface.hpp"
@@ -69,6 +73,23 @@ namespace Bloom::DebugToolDrivers
          */
         std::string getSerialNumber() override;
 
+        /**
+         * Returns the capabilities reported by the device's firmware, as probed upon initialisation.
+         *
+         * @return
+         */
+        const Protocols::CmsisDap::Edbg::EdbgToolCapabilities& getToolCapabilities() const {
+            return this->toolCapabilities;
+        }
+
+        /**
+         * Enables recording of all packets exchanged over the CMSIS-DAP interface, to the given trace file (see
+         * Usb::RecordingPacketInterface). Must be called before EdbgDevice::init().
+         *
+         * @param traceFilePath
+         */
+        void recordUsbTrace(const std::string& traceFilePath);
+
         /**
          * Starts a session with the EDBG device using the "Housekeeping" EDBG sub-protocol.
          */
@@ -103,6 +124,21 @@ namespace Bloom::DebugToolDrivers
          */
         std::optional<std::uint8_t> configurationIndex = std::nullopt;
 
+        /**
+         * Some EDBG devices (those with CMSIS-DAP v2 firmware) expose a vendor-specific CMSIS-DAP interface, with a
+         * pair of bulk endpoints, alongside the CMSIS-DAP HID interface. The bulk interface allows for larger packets
+         * and isn't subject to the HID interrupt polling interval.
+         *
+         * If this is set to true, we'll look for the bulk interface upon device initialisation, and use it in place
+         * of the HID interface, if found. Otherwise, or if the interface cannot be found, we use the HID interface.
+         */
+        bool preferCmsisBulkInterface = false;
+
+        /**
+         * See EdbgDevice::recordUsbTrace().
+         */
+        std::optional<std::string> usbTraceRecordingFilePath;
+
         /**
          * The EdbgInterface class provides the ability to communicate with the EDBG device, using any of the EDBG
          * sub-protocols.
@@ -143,6 +179,20 @@ namespace Bloom::DebugToolDrivers
 
         bool sessionStarted = false;
 
+        /**
+         * See EdbgDevice::probeToolCapabilities().
+         */
+        Protocols::CmsisDap::Edbg::EdbgToolCapabilities toolCapabilities;
+
+        /**
+         * Probed tool capabilities, mapped by serial number.
+         *
+         * This is retained for the lifetime of the process, so that we don't have to probe the tool again when the
+         * TargetController reconnects to it.
+         */
+        static inline std::map<std::string, Protocols::CmsisDap::Edbg::EdbgToolCapabilities>
+            toolCapabilitiesBySerialNumber = {};
+
         /**
          * Because EDBG devices require fixed-length reports to be transmitted to/from their HID interface, we must
          * know the HID report size (as it differs across EDBG devices).
@@ -153,5 +203,52 @@ namespace Bloom::DebugToolDrivers
          * @return
          */
         std::uint16_t getCmsisHidReportSize();
+
+        /**
+         * Looks for a CMSIS-DAP v2 bulk interface in the active configuration: a vendor-specific interface with a
+         * bulk IN and bulk OUT endpoint, and an interface string containing "CMSIS-DAP" (as required by the
+         * CMSIS-DAP v2 specification).
+         *
+         * @return
+         *  The (unclaimed) bulk interface, or nullptr if the device doesn't have one.
+         */
+        std::unique_ptr<Usb::UsbBulkInterface> findCmsisBulkInterface();
+
+        /**
+         * Looks for a vendor-specific interface in the active configuration, with a bulk IN and bulk OUT endpoint, and
+         * an interface string containing the given name.
+         *
+         * @param interfaceName
+         *
+         * @return
+         *  The (unclaimed) bulk interface, or nullptr if the device doesn't have one.
+         */
+        std::unique_ptr<Usb::UsbBulkInterface> findBulkInterface(const std::string& interfaceName);
+
+        /**
+         * Establishes the EDBG interface over the given (initialised) CMSIS-DAP USB interface, starts a session with
+         * the device and prepares the sub-protocol interfaces.
+         *
+         * This is the part of EdbgDevice::init() that doesn't involve the USB device itself, which allows for the
+         * EDBG interface to be driven by something other than a real device (see EdbgReplayDevice).
+         *
+         * @param cmsisUsbInterface
+         */
+        void initEdbgInterface(std::unique_ptr<Usb::PacketInterface> cmsisUsbInterface);
+
+        /**
+         * Queries the device's firmware for its capabilities: hardware and firmware versions (HouseKeeping CONFIG
+         * parameters), supported sub-protocol handlers (Discovery COMMAND_HANDLERS query) and the maximum AVR frame
+         * size (HouseKeeping USB parameters).
+         *
+         * This requires an active session. The result is cached per serial number (see
+         * EdbgDevice::toolCapabilitiesBySerialNumber), so only the serial number is queried for tools that have
+         * already been probed.
+         *
+         * Queries that the firmware rejects are not treated as errors - the capability is just left unset.
+         *
+         * @return
+         */
+        Protocols::CmsisDap::Edbg::EdbgToolCapabilities probeToolCapabilities();
     };
 }
@@ -0,0 +1,35 @@
+#include "EdbgReplayDevice.hpp"
+
+#include "src/DebugToolDrivers/USB/Trace/ReplayPacketInterface.hpp"
+#include "src/Services/PathService.hpp"
+#include "src/Helpers/YamlUtilities.hpp"
+
+#include "src/Exceptions/InvalidConfig.hpp"
+
+namespace Bloom::DebugToolDrivers
+{
+    EdbgReplayDevice::EdbgReplayDevice(const DebugToolConfig& debugToolConfig)
+        : EdbgDevice(0, 0, 0, true)
+    {
+        const auto& traceFileNode = debugToolConfig.debugToolNode["usbTraceFile"];
+
+        if (!traceFileNode || !YamlUtilities::isCastable<std::string>(traceFileNode)) {
+            throw Exceptions::InvalidConfig(
+                "The \"edbg-replay\" debug tool requires a USB trace file, via the \"usbTraceFile\" parameter"
+            );
+        }
+
+        this->traceFilePath = traceFileNode.as<std::string>();
+
+        if (!this->traceFilePath.starts_with('/')) {
+            this->traceFilePath = Services::PathService::projectDirPath() + "/" + this->traceFilePath;
+        }
+    }
+
+    void EdbgReplayDevice::init() {
+        auto cmsisUsbInterface = std::make_unique<Usb::ReplayPacketInterface>(this->traceFilePath);
+        cmsisUsbInterface->init();
+
+        this->initEdbgInterface(std::move(cmsisUsbInterface));
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+
+#include "src/DebugToolDrivers/Microchip/EdbgDevice.hpp"
+#include "src/ProjectConfig.hpp"
+
+namespace Bloom::DebugToolDrivers
+{
+    /**
+     * The EdbgReplayDevice stands in for an EDBG device, by serving a USB packet trace that was recorded from a real
+     * device (see Usb::RecordingPacketInterface and Usb::ReplayPacketInterface). No hardware is involved.
+     *
+     * This allows for a recorded sequence of operations to be repeated deterministically, in CI, to catch
+     * regressions in the number of USB transactions (reported via the "usb.replay.*" counters) and in host-side
+     * overhead. The replay fails if Bloom's exchange with the device diverges from the recording.
+     *
+     * The replay device is selected via the "edbg-replay" debug tool name, with the trace file given via the
+     * "usbTraceFile" parameter. The rest of the project configuration (target, physical interface, etc) must match
+     * that of the recording.
+     */
+    class EdbgReplayDevice: public EdbgDevice
+    {
+    public:
+        explicit EdbgReplayDevice(const DebugToolConfig& debugToolConfig);
+
+        /**
+         * Loads the trace and initialises the EDBG interface over it. The USB device (UsbDevice::init()) is not
+         * initialised - there isn't one.
+         */
+        void init() override;
+
+        std::string getName() override {
+            return "EDBG replay";
+        }
+
+    private:
+        std::string traceFilePath;
+    };
+}
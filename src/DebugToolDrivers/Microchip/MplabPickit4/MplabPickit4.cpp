@@ -11,7 +11,9 @@ namespace Bloom::DebugToolDrivers
             MplabPickit4::USB_PRODUCT_ID,
             MplabPickit4::CMSIS_HID_INTERFACE_NUMBER
         )
-    {}
+    {
+        this->preferCmsisBulkInterface = true;
+    }
 
     void MplabPickit4::init() {
         using Exceptions::DeviceNotFound;
@@ -11,7 +11,9 @@ namespace Bloom::DebugToolDrivers
             MplabSnap::USB_PRODUCT_ID,
             MplabSnap::CMSIS_HID_INTERFACE_NUMBER
         )
-    {}
+    {
+        this->preferCmsisBulkInterface = true;
+    }
 
     void MplabSnap::init() {
         using Exceptions::DeviceNotFound;
@@ -1,8 +1,13 @@
 #include "PowerDebugger.hpp"
 
+#include "src/Exceptions/InvalidConfig.hpp"
+#include "src/Logger/Logger.hpp"
+
 namespace Bloom::DebugToolDrivers
 {
-    PowerDebugger::PowerDebugger()
+    using Exceptions::InvalidConfig;
+
+    PowerDebugger::PowerDebugger(const DebugToolConfig& debugToolConfig)
         : EdbgDevice(
             PowerDebugger::USB_VENDOR_ID,
             PowerDebugger::USB_PRODUCT_ID,
@@ -10,5 +15,71 @@ namespace Bloom::DebugToolDrivers
             false,
             PowerDebugger::USB_CONFIGURATION_INDEX
         )
-    {}
+    {
+        const auto& powerMeasurementNode = debugToolConfig.debugToolNode["powerMeasurement"];
+
+        if (!powerMeasurementNode) {
+            return;
+        }
+
+        if (powerMeasurementNode["enabled"]) {
+            this->powerMeasurementConfig.enabled = powerMeasurementNode["enabled"].as<bool>();
+        }
+
+        if (powerMeasurementNode["exportFile"]) {
+            this->powerMeasurementConfig.exportFilePath = powerMeasurementNode["exportFile"].as<std::string>();
+        }
+
+        if (powerMeasurementNode["decimationFactor"]) {
+            const auto decimationFactor = powerMeasurementNode["decimationFactor"].as<int>();
+
+            if (decimationFactor < 1) {
+                throw InvalidConfig("The Power Debugger's 'decimationFactor' parameter must be greater than 0.");
+            }
+
+            this->powerMeasurementConfig.decimationFactor = static_cast<std::uint32_t>(decimationFactor);
+        }
+    }
+
+    void PowerDebugger::init() {
+        EdbgDevice::init();
+
+        if (!this->powerMeasurementConfig.enabled) {
+            return;
+        }
+
+        auto dgiUsbInterface = this->findBulkInterface(PowerDebugger::DGI_INTERFACE_NAME);
+        if (dgiUsbInterface == nullptr) {
+            Logger::warning("Failed to find the Power Debugger's DGI - power measurement will be unavailable");
+            return;
+        }
+
+        this->powerMeasurementStream = std::make_unique<PowerMeasurementStream>(
+            std::make_unique<Protocols::Dgi::DataGatewayInterface>(std::move(dgiUsbInterface)),
+            this->powerMeasurementConfig
+        );
+
+        try {
+            this->powerMeasurementStream->start();
+
+        } catch (const Exceptions::Exception& exception) {
+            Logger::warning("Failed to start power measurement streaming - " + exception.getMessage());
+            this->powerMeasurementStream.reset();
+        }
+    }
+
+    void PowerDebugger::close() {
+        if (this->powerMeasurementStream != nullptr) {
+            try {
+                this->powerMeasurementStream->stop();
+
+            } catch (const Exceptions::Exception& exception) {
+                Logger::warning("Failed to stop power measurement streaming - " + exception.getMessage());
+            }
+
+            this->powerMeasurementStream.reset();
+        }
+
+        EdbgDevice::close();
+    }
 }
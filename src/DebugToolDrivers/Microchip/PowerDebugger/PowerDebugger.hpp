@@ -2,14 +2,22 @@
 
 #include <cstdint>
 #include <string>
+#include <memory>
 
 #include "src/DebugToolDrivers/Microchip/EdbgDevice.hpp"
+#include "src/DebugToolDrivers/Microchip/PowerDebugger/PowerMeasurementStream.hpp"
+
+#include "src/ProjectConfig.hpp"
 
 namespace Bloom::DebugToolDrivers
 {
     /**
      * The Power Debugger device is very similar to the Atmel-ICE. It is an EDBG device.
      *
+     * As well as the CMSIS-DAP interface, the Power Debugger exposes a Data Gateway Interface (DGI), through which it
+     * streams current and voltage measurements. If enabled via the "powerMeasurement" debug tool config parameter,
+     * we stream these measurements alongside debugging. See PowerMeasurementStream.
+     *
      * USB:
      *  Vendor ID: 0x03eb (1003)
      *  Product ID: 0x2141 (8513)
@@ -22,10 +30,32 @@ namespace Bloom::DebugToolDrivers
         static const inline std::uint8_t USB_CONFIGURATION_INDEX = 0;
         static const inline std::uint8_t CMSIS_HID_INTERFACE_NUMBER = 0;
 
-        PowerDebugger();
+        /**
+         * The DGI is a vendor-specific interface, identified by its interface string.
+         */
+        static const inline std::string DGI_INTERFACE_NAME = "Data Gateway";
+
+        explicit PowerDebugger(const DebugToolConfig& debugToolConfig);
+
+        void init() override;
+
+        void close() override;
 
         std::string getName() override {
             return "Power Debugger";
         }
+
+        /**
+         * Returns the power measurement stream, or nullptr if power measurement isn't enabled.
+         *
+         * @return
+         */
+        PowerMeasurementStream* getPowerMeasurementStream() {
+            return this->powerMeasurementStream.get();
+        }
+
+    private:
+        PowerMeasurementConfig powerMeasurementConfig;
+        std::unique_ptr<PowerMeasurementStream> powerMeasurementStream = nullptr;
     };
 }
@@ -0,0 +1,247 @@
+#include "PowerMeasurementStream.hpp"
+
+#include <array>
+#include <algorithm>
+#include <filesystem>
+#include <pthread.h>
+
+#include "src/Services/PathService.hpp"
+#include "src/Services/MetricsService.hpp"
+#include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugToolDrivers
+{
+    using namespace Bloom::Exceptions;
+
+    using Protocols::Dgi::DataGatewayInterface;
+    using Protocols::Dgi::InterfaceId;
+
+    PowerMeasurementStream::PowerMeasurementStream(
+        std::unique_ptr<DataGatewayInterface> dataGatewayInterface,
+        const PowerMeasurementConfig& config
+    )
+        : dataGatewayInterface(std::move(dataGatewayInterface))
+        , config(config)
+    {
+        this->config.decimationFactor = std::max(this->config.decimationFactor, std::uint32_t(1));
+    }
+
+    PowerMeasurementStream::~PowerMeasurementStream() {
+        try {
+            this->stop();
+
+        } catch (const std::exception& exception) {
+            Logger::debug("Failed to stop power measurement stream - " + std::string(exception.what()));
+        }
+    }
+
+    void PowerMeasurementStream::start() {
+        if (this->running) {
+            return;
+        }
+
+        this->dataGatewayInterface->init();
+
+        const auto interfaceIds = this->dataGatewayInterface->listInterfaces();
+        if (std::find(interfaceIds.begin(), interfaceIds.end(), InterfaceId::POWER_DATA) == interfaceIds.end()) {
+            this->dataGatewayInterface->close();
+            throw DeviceInitializationFailure("Debug tool DGI does not provide a power data interface");
+        }
+
+        if (this->config.exportFilePath.has_value()) {
+            auto exportFilePath = std::filesystem::path(*this->config.exportFilePath);
+            if (exportFilePath.is_relative()) {
+                exportFilePath = std::filesystem::path(Services::PathService::projectDirPath()) / exportFilePath;
+            }
+
+            this->exportFile.open(exportFilePath, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!this->exportFile.is_open()) {
+                Logger::error(
+                    "Failed to open power measurement export file " + exportFilePath.string()
+                        + " - samples will not be exported"
+                );
+            }
+        }
+
+        this->dataGatewayInterface->setInterfaceEnabled(InterfaceId::POWER_DATA, true);
+
+        this->pendingAggregate = PowerSampleAggregate();
+        this->pendingAggregateSum = 0;
+        this->droppedSampleCount = 0;
+
+        this->running = true;
+        this->readerThread = std::thread(&PowerMeasurementStream::runReader, this);
+        this->processorThread = std::thread(&PowerMeasurementStream::runProcessor, this);
+
+        Logger::info("Power measurement streaming started");
+    }
+
+    void PowerMeasurementStream::stop() {
+        if (!this->readerThread.joinable() && !this->processorThread.joinable()) {
+            return;
+        }
+
+        this->running = false;
+
+        if (this->readerThread.joinable()) {
+            this->readerThread.join();
+        }
+
+        this->processorNotifier.notify();
+
+        if (this->processorThread.joinable()) {
+            this->processorThread.join();
+        }
+
+        if (this->exportFile.is_open()) {
+            this->exportFile.close();
+        }
+
+        const auto droppedSampleCount = this->getDroppedSampleCount();
+        if (droppedSampleCount > 0) {
+            Logger::warning(
+                std::to_string(droppedSampleCount) + " power measurement samples were dropped, as the sample "
+                    "buffer was full"
+            );
+        }
+
+        this->dataGatewayInterface->setInterfaceEnabled(InterfaceId::POWER_DATA, false);
+        this->dataGatewayInterface->close();
+
+        Logger::info("Power measurement streaming stopped");
+    }
+
+    std::vector<PowerSampleAggregate> PowerMeasurementStream::getRecentAggregates() const {
+        const auto lock = std::unique_lock(this->recentAggregatesMutex);
+        return std::vector<PowerSampleAggregate>(this->recentAggregates.begin(), this->recentAggregates.end());
+    }
+
+    void PowerMeasurementStream::runReader() {
+        ::pthread_setname_np(::pthread_self(), "PWR-RD");
+
+        static auto& samplesRead = Services::MetricsService::counter("power.samplesRead");
+
+        try {
+            while (this->running) {
+                const auto data = this->dataGatewayInterface->pollData(InterfaceId::POWER_DATA);
+
+                if (data.size() < 2) {
+                    std::this_thread::sleep_for(this->config.pollInterval);
+                    continue;
+                }
+
+                auto droppedSampleCount = std::uint64_t(0);
+
+                for (auto byteIndex = std::size_t(0); byteIndex + 1 < data.size(); byteIndex += 2) {
+                    const auto sample = static_cast<std::uint16_t>(data[byteIndex] | (data[byteIndex + 1] << 8));
+
+                    if (!this->sampleBuffer.push(sample)) {
+                        ++droppedSampleCount;
+                    }
+                }
+
+                samplesRead.increment(data.size() / 2);
+
+                if (droppedSampleCount > 0) {
+                    this->droppedSampleCount.fetch_add(droppedSampleCount, std::memory_order_relaxed);
+                }
+            }
+
+        } catch (const std::exception& exception) {
+            Logger::error("Power measurement streaming failed - " + std::string(exception.what()));
+            this->running = false;
+        }
+    }
+
+    void PowerMeasurementStream::runProcessor() {
+        ::pthread_setname_np(::pthread_self(), "PWR-PROC");
+
+        while (this->running) {
+            this->processorNotifier.waitForNotification(PowerMeasurementStream::PROCESSOR_INTERVAL);
+            this->processSamples();
+        }
+
+        // The reader has stopped by now - process whatever it left in the buffer
+        this->processSamples();
+
+        if (this->exportFile.is_open()) {
+            this->exportFile.flush();
+        }
+    }
+
+    void PowerMeasurementStream::processSamples() {
+        auto samples = std::array<std::uint16_t, 4096>();
+
+        while (true) {
+            const auto sampleCount = this->sampleBuffer.pop(samples);
+            if (sampleCount == 0) {
+                break;
+            }
+
+            const auto poppedSamples = std::span<const std::uint16_t>(samples.data(), sampleCount);
+            this->aggregateSamples(poppedSamples);
+            this->exportSamples(poppedSamples);
+        }
+    }
+
+    void PowerMeasurementStream::aggregateSamples(std::span<const std::uint16_t> samples) {
+        auto completedAggregates = std::vector<PowerSampleAggregate>();
+
+        for (const auto sample : samples) {
+            auto& aggregate = this->pendingAggregate;
+
+            if (aggregate.sampleCount == 0) {
+                aggregate.minimum = sample;
+                aggregate.maximum = sample;
+
+            } else {
+                aggregate.minimum = std::min(aggregate.minimum, sample);
+                aggregate.maximum = std::max(aggregate.maximum, sample);
+            }
+
+            this->pendingAggregateSum += sample;
+            ++aggregate.sampleCount;
+
+            if (aggregate.sampleCount >= this->config.decimationFactor) {
+                aggregate.mean = static_cast<std::uint16_t>(this->pendingAggregateSum / aggregate.sampleCount);
+                completedAggregates.emplace_back(aggregate);
+
+                aggregate = PowerSampleAggregate();
+                this->pendingAggregateSum = 0;
+            }
+        }
+
+        if (completedAggregates.empty()) {
+            return;
+        }
+
+        const auto lock = std::unique_lock(this->recentAggregatesMutex);
+        this->recentAggregates.insert(
+            this->recentAggregates.end(),
+            completedAggregates.begin(),
+            completedAggregates.end()
+        );
+
+        while (this->recentAggregates.size() > PowerMeasurementStream::MAX_RETAINED_AGGREGATES) {
+            this->recentAggregates.pop_front();
+        }
+    }
+
+    void PowerMeasurementStream::exportSamples(std::span<const std::uint16_t> samples) {
+        if (!this->exportFile.is_open()) {
+            return;
+        }
+
+        // Samples are exported as 16-bit little-endian values, written in one block per pass
+        auto bytes = std::vector<char>();
+        bytes.reserve(samples.size() * 2);
+
+        for (const auto sample : samples) {
+            bytes.push_back(static_cast<char>(sample & 0xFF));
+            bytes.push_back(static_cast<char>(sample >> 8));
+        }
+
+        this->exportFile.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <fstream>
+#include <span>
+
+#include "src/DebugToolDrivers/Protocols/DGI/DataGatewayInterface.hpp"
+#include "src/Helpers/SpscRingBuffer.hpp"
+#include "src/Helpers/ConditionVariableNotifier.hpp"
+
+namespace Bloom::DebugToolDrivers
+{
+    struct PowerMeasurementConfig
+    {
+        /**
+         * Power measurement is disabled by default - the streaming threads and export file have a cost that most
+         * users don't need to pay.
+         */
+        bool enabled = false;
+
+        /**
+         * Path of the file to export raw samples to (relative paths are resolved against the project directory).
+         * If not provided, samples are only aggregated.
+         */
+        std::optional<std::string> exportFilePath;
+
+        /**
+         * The number of consecutive samples reduced to a single PowerSampleAggregate.
+         */
+        std::uint32_t decimationFactor = 64;
+
+        /**
+         * How long the reader thread waits before polling the tool again, after a poll that yielded no data.
+         */
+        std::chrono::milliseconds pollInterval = std::chrono::milliseconds(5);
+    };
+
+    /**
+     * A decimated block of consecutive power samples.
+     */
+    struct PowerSampleAggregate
+    {
+        std::uint16_t minimum = 0;
+        std::uint16_t maximum = 0;
+        std::uint16_t mean = 0;
+        std::uint32_t sampleCount = 0;
+    };
+
+    /**
+     * Streams power measurement samples from the Power Debugger's Data Gateway Interface (DGI), alongside debugging.
+     *
+     * Two threads are involved:
+     *  - The reader thread polls the DGI power data interface and pushes each sample into a lock-free ring buffer.
+     *    It does nothing else, so that it can keep up with the tool's sample rate.
+     *  - The processor thread drains the ring buffer, reduces the samples to min/max/mean aggregates (for display)
+     *    and appends the raw samples to the export file, if one was configured.
+     *
+     * If the processor falls behind and the ring buffer fills up, the reader drops samples, and counts them (see
+     * PowerMeasurementStream::getDroppedSampleCount()). It never blocks on the processor.
+     *
+     * Samples are the raw values reported by the tool. The DGI's power data encoding (and the tool's calibration
+     * data) isn't covered by the public protocol documentation, so we treat the power data as a stream of 16-bit
+     * little-endian ADC counts, and we don't attempt to convert them to amps. The export file holds the samples in
+     * that same form.
+     */
+    class PowerMeasurementStream
+    {
+    public:
+        /**
+         * Capacity of the ring buffer, in samples. Must be a power of two.
+         */
+        static constexpr std::size_t SAMPLE_BUFFER_CAPACITY = 1 << 18;
+
+        /**
+         * The number of most recent aggregates retained for display.
+         */
+        static constexpr std::size_t MAX_RETAINED_AGGREGATES = 4096;
+
+        /**
+         * How long the processor thread sleeps between passes over the ring buffer.
+         */
+        static constexpr auto PROCESSOR_INTERVAL = std::chrono::milliseconds(20);
+
+        PowerMeasurementStream(
+            std::unique_ptr<Protocols::Dgi::DataGatewayInterface> dataGatewayInterface,
+            const PowerMeasurementConfig& config
+        );
+
+        ~PowerMeasurementStream();
+
+        PowerMeasurementStream(const PowerMeasurementStream& other) = delete;
+        PowerMeasurementStream(PowerMeasurementStream&& other) = delete;
+
+        PowerMeasurementStream& operator = (const PowerMeasurementStream& other) = delete;
+        PowerMeasurementStream& operator = (PowerMeasurementStream&& other) = delete;
+
+        /**
+         * Signs on to the DGI, enables the power data interface and starts the reader and processor threads.
+         */
+        void start();
+
+        /**
+         * Stops both threads (processing any samples that are still in the ring buffer), disables the power data
+         * interface and signs off from the DGI.
+         */
+        void stop();
+
+        /**
+         * Returns the most recent aggregates, oldest first. Safe to call from any thread.
+         *
+         * @return
+         */
+        std::vector<PowerSampleAggregate> getRecentAggregates() const;
+
+        std::uint64_t getDroppedSampleCount() const {
+            return this->droppedSampleCount.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::unique_ptr<Protocols::Dgi::DataGatewayInterface> dataGatewayInterface;
+        PowerMeasurementConfig config;
+
+        SpscRingBuffer<std::uint16_t> sampleBuffer = SpscRingBuffer<std::uint16_t>(
+            PowerMeasurementStream::SAMPLE_BUFFER_CAPACITY
+        );
+
+        std::atomic<bool> running = false;
+        std::atomic<std::uint64_t> droppedSampleCount = 0;
+
+        std::thread readerThread;
+        std::thread processorThread;
+        ConditionVariableNotifier processorNotifier;
+
+        mutable std::mutex recentAggregatesMutex;
+        std::deque<PowerSampleAggregate> recentAggregates;
+
+        std::ofstream exportFile;
+
+        /**
+         * The aggregate currently being accumulated by the processor thread, along with its running sum.
+         */
+        PowerSampleAggregate pendingAggregate;
+        std::uint64_t pendingAggregateSum = 0;
+
+        void runReader();
+        void runProcessor();
+
+        /**
+         * Drains the ring buffer. Invoked on the processor thread.
+         */
+        void processSamples();
+
+        void aggregateSamples(std::span<const std::uint16_t> samples);
+        void exportSamples(std::span<const std::uint16_t> samples);
+    };
+}
@@ -0,0 +1,548 @@
+#include "MockDebugTool.hpp"
+
+#include <thread>
+#include <algorithm>
+#include <span>
+
+#include "src/Targets/Microchip/AVR/AVR8/TargetDescription/TargetDescriptionIndex.hpp"
+#include "src/Targets/TargetMemoryAddressRangeIndex.hpp"
+#include "src/Helpers/Crc32.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+#include "src/Exceptions/InvalidConfig.hpp"
+
+namespace Bloom::DebugToolDrivers
+{
+    using namespace Targets;
+    using namespace Targets::Microchip::Avr;
+    using namespace Targets::Microchip::Avr::Avr8Bit;
+
+    using Exceptions::Exception;
+    using Exceptions::InvalidConfig;
+
+    MockDebugTool::MockDebugTool(const DebugToolConfig& debugToolConfig) {
+        const auto& debugToolNode = debugToolConfig.debugToolNode;
+
+        if (debugToolNode["roundTripLatency"]) {
+            const auto latency = debugToolNode["roundTripLatency"].as<int>();
+
+            if (latency < 0) {
+                throw InvalidConfig("The mock debug tool's 'roundTripLatency' parameter cannot be negative.");
+            }
+
+            this->roundTripLatency = std::chrono::microseconds(latency);
+        }
+
+        if (debugToolNode["maxPacketSize"]) {
+            this->maxPacketSize = debugToolNode["maxPacketSize"].as<TargetMemorySize>();
+
+            if (this->maxPacketSize == 0) {
+                throw InvalidConfig("The mock debug tool's 'maxPacketSize' parameter must be greater than 0.");
+            }
+        }
+
+        if (debugToolNode["signature"]) {
+            const auto signatureHex = debugToolNode["signature"].as<std::string>();
+
+            try {
+                this->signature = TargetSignature(signatureHex);
+
+            } catch (const std::exception&) {
+                throw InvalidConfig(
+                    "Invalid target signature (\"" + signatureHex + "\") provided for the mock debug tool."
+                );
+            }
+        }
+    }
+
+    void MockDebugTool::init() {
+        this->setInitialised(true);
+    }
+
+    void MockDebugTool::close() {
+        this->setInitialised(false);
+    }
+
+    void MockDebugTool::configure(const Avr8TargetConfig& targetConfig) {
+        this->targetConfig = targetConfig;
+
+        if (this->signature.has_value()) {
+            return;
+        }
+
+        // Resolve the signature from the target name, so that the target passes the signature check upon activation
+        for (const auto& indexEntry : TargetDescription::TargetDescriptionIndex::getEntries()) {
+            if (indexEntry.targetName == targetConfig.name) {
+                this->signature = indexEntry.getTargetSignature();
+                break;
+            }
+        }
+    }
+
+    void MockDebugTool::setTargetParameters(const TargetParameters& config) {
+        this->targetParameters = config;
+
+        if (this->activated && !this->memoryImagesInitialised) {
+            this->initMemoryImages();
+        }
+    }
+
+    void MockDebugTool::stop() {
+        this->simulateLatency();
+
+        this->targetState = TargetState::STOPPED;
+        this->pendingStopAddress = std::nullopt;
+    }
+
+    void MockDebugTool::run() {
+        this->simulateLatency();
+
+        this->pendingStopAddress = this->nextBreakpointAddress();
+        this->targetState = TargetState::RUNNING;
+    }
+
+    void MockDebugTool::runTo(TargetMemoryAddress address) {
+        this->simulateLatency();
+
+        const auto breakpointAddress = this->nextBreakpointAddress();
+        const auto distance = [this] (TargetMemoryAddress stopAddress) {
+            // The distance the program counter would have to travel, to reach the given address
+            return stopAddress > this->programCounter
+                ? stopAddress - this->programCounter
+                : stopAddress + static_cast<TargetMemoryAddress>(this->programMemory.size()) - this->programCounter;
+        };
+
+        this->pendingStopAddress = breakpointAddress.has_value() && distance(*breakpointAddress) < distance(address)
+            ? *breakpointAddress
+            : address;
+        this->targetState = TargetState::RUNNING;
+    }
+
+    void MockDebugTool::step() {
+        this->simulateLatency();
+
+        if (this->targetState != TargetState::STOPPED) {
+            throw Exception("Cannot step target - target is running");
+        }
+
+        this->programCounter = this->programMemory.empty()
+            ? 0
+            : (this->programCounter + 2) % static_cast<TargetProgramCounter>(this->programMemory.size());
+    }
+
+    void MockDebugTool::reset() {
+        this->simulateLatency();
+
+        this->targetState = TargetState::STOPPED;
+        this->pendingStopAddress = std::nullopt;
+        this->programCounter = 0;
+    }
+
+    void MockDebugTool::activate() {
+        this->simulateLatency();
+
+        if (this->activated) {
+            return;
+        }
+
+        this->targetState = TargetState::STOPPED;
+        this->programCounter = 0;
+        this->activated = true;
+
+        if (this->targetParameters.ramSize.has_value()) {
+            this->initMemoryImages();
+        }
+
+        Logger::debug(
+            "Mock target activated - simulated round trip latency: "
+                + std::to_string(this->roundTripLatency.count()) + "us"
+        );
+    }
+
+    void MockDebugTool::deactivate() {
+        this->activated = false;
+        this->programmingModeEnabled = false;
+    }
+
+    TargetSignature MockDebugTool::getDeviceId() {
+        this->simulateLatency();
+
+        if (!this->signature.has_value()) {
+            throw InvalidConfig(
+                "The mock debug tool could not determine a signature for the target. Please specify the exact target "
+                    "name, or provide the 'signature' parameter in the debug tool config."
+            );
+        }
+
+        return *(this->signature);
+    }
+
+    void MockDebugTool::setSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        this->simulateLatency();
+        this->softwareBreakpoints.insert(addresses.begin(), addresses.end());
+    }
+
+    void MockDebugTool::clearSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        this->simulateLatency();
+
+        for (const auto address : addresses) {
+            this->softwareBreakpoints.erase(address);
+        }
+    }
+
+    void MockDebugTool::setHardwareBreakpoint(std::uint16_t index, TargetMemoryAddress address) {
+        this->simulateLatency();
+
+        if (index >= MockDebugTool::HARDWARE_BREAKPOINT_COUNT) {
+            throw Exception("Invalid hardware breakpoint index (" + std::to_string(index) + ")");
+        }
+
+        this->hardwareBreakpointsByIndex[index] = address;
+    }
+
+    void MockDebugTool::clearHardwareBreakpoint(std::uint16_t index) {
+        this->simulateLatency();
+        this->hardwareBreakpointsByIndex.erase(index);
+    }
+
+    void MockDebugTool::setDataBreakpoint(std::uint16_t, TargetMemoryAddress, TargetWatchpointType) {
+        throw Exception("The mock debug tool does not support data breakpoints");
+    }
+
+    void MockDebugTool::clearDataBreakpoint(std::uint16_t) {
+        throw Exception("The mock debug tool does not support data breakpoints");
+    }
+
+    void MockDebugTool::clearAllBreakpoints() {
+        this->simulateLatency();
+
+        this->softwareBreakpoints.clear();
+        this->hardwareBreakpointsByIndex.clear();
+    }
+
+    TargetProgramCounter MockDebugTool::getProgramCounter() {
+        if (this->targetState != TargetState::STOPPED) {
+            this->stop();
+        }
+
+        this->simulateLatency();
+        return this->programCounter;
+    }
+
+    void MockDebugTool::setProgramCounter(TargetProgramCounter programCounter) {
+        if (this->targetState != TargetState::STOPPED) {
+            this->stop();
+        }
+
+        this->simulateLatency();
+        this->programCounter = programCounter;
+    }
+
+    void MockDebugTool::readRegisters(TargetRegisterDescriptorSelection descriptors, TargetRegisters& output) {
+        auto totalBytes = TargetMemorySize(0);
+
+        for (const auto* descriptorPtr : descriptors) {
+            const auto& descriptor = *descriptorPtr;
+
+            if (!descriptor.startAddress.has_value()) {
+                continue;
+            }
+
+            const auto [image, imageStartAddress] = this->resolveImage(
+                TargetMemoryType::RAM,
+                descriptor.type == TargetRegisterType::GENERAL_PURPOSE_REGISTER
+            );
+            const auto offset = MockDebugTool::resolveImageOffset(
+                image,
+                imageStartAddress,
+                descriptor.startAddress.value(),
+                descriptor.size
+            );
+
+            // Multibyte AVR8 registers are stored in LSB form, but TargetRegister values are expected in MSB form
+            const auto valueBegin = image.begin() + static_cast<std::ptrdiff_t>(offset);
+            output.emplace_back(
+                descriptor,
+                TargetMemoryBuffer(
+                    std::make_reverse_iterator(valueBegin + descriptor.size),
+                    std::make_reverse_iterator(valueBegin)
+                )
+            );
+
+            totalBytes += descriptor.size;
+        }
+
+        // Real debug tools read all registers in a single batch of commands
+        this->simulateLatency(totalBytes);
+    }
+
+    void MockDebugTool::writeRegisters(TargetRegisterSelection registers) {
+        for (const auto* reg : registers) {
+            const auto& descriptor = reg->descriptor;
+
+            if (reg->value.empty() || reg->value.size() > descriptor.size) {
+                throw Exception("Invalid register value size");
+            }
+
+            const auto [image, imageStartAddress] = this->resolveImage(
+                TargetMemoryType::RAM,
+                descriptor.type == TargetRegisterType::GENERAL_PURPOSE_REGISTER
+            );
+            const auto offset = MockDebugTool::resolveImageOffset(
+                image,
+                imageStartAddress,
+                descriptor.startAddress.value(),
+                descriptor.size
+            );
+
+            // Store the value in LSB form, filling the missing most-significant bytes with 0x00
+            const auto valueBegin = image.begin() + static_cast<std::ptrdiff_t>(offset);
+            const auto valueEnd = std::copy(reg->value.rbegin(), reg->value.rend(), valueBegin);
+            std::fill(valueEnd, valueBegin + descriptor.size, 0x00);
+
+            this->simulateLatency(descriptor.size);
+        }
+    }
+
+    TargetMemoryBuffer MockDebugTool::readMemory(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
+        if (this->programmingModeEnabled && memoryType == TargetMemoryType::RAM) {
+            throw Exception("Cannot access RAM when programming mode is enabled");
+        }
+
+        const auto [image, imageStartAddress] = this->resolveImage(memoryType);
+        const auto offset = MockDebugTool::resolveImageOffset(image, imageStartAddress, startAddress, bytes);
+
+        auto output = TargetMemoryBuffer(
+            image.begin() + static_cast<std::ptrdiff_t>(offset),
+            image.begin() + static_cast<std::ptrdiff_t>(offset + bytes)
+        );
+
+        // As with the masked read memory command on EDBG tools, excluded addresses are read as 0x00
+        if (!excludedAddressRanges.empty() && bytes > 0) {
+            const auto readAddressRange = TargetMemoryAddressRange(startAddress, startAddress + bytes - 1);
+
+            TargetMemoryAddressRangeIndex(excludedAddressRanges).forEachIntersecting(
+                readAddressRange,
+                [&output, &readAddressRange] (const TargetMemoryAddressRange& excludedRange, std::size_t) {
+                    std::fill(
+                        output.begin() + (
+                            std::max(excludedRange.startAddress, readAddressRange.startAddress)
+                                - readAddressRange.startAddress
+                        ),
+                        output.begin() + (
+                            std::min(excludedRange.endAddress, readAddressRange.endAddress)
+                                - readAddressRange.startAddress + 1
+                        ),
+                        0x00
+                    );
+                }
+            );
+        }
+
+        this->simulateLatency(bytes);
+        return output;
+    }
+
+    std::vector<TargetMemoryBuffer> MockDebugTool::readMemoryRanges(
+        TargetMemoryType memoryType,
+        const std::vector<TargetMemoryAddressRange>& addressRanges
+    ) {
+        auto output = std::vector<TargetMemoryBuffer>();
+        output.reserve(addressRanges.size());
+
+        for (const auto& addressRange : addressRanges) {
+            output.push_back(this->readMemory(
+                memoryType,
+                addressRange.startAddress,
+                addressRange.endAddress - addressRange.startAddress + 1
+            ));
+        }
+
+        return output;
+    }
+
+    void MockDebugTool::writeMemory(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        const TargetMemoryBuffer& buffer
+    ) {
+        if (this->programmingModeEnabled && memoryType == TargetMemoryType::RAM) {
+            throw Exception("Cannot access RAM when programming mode is enabled");
+        }
+
+        const auto bytes = static_cast<TargetMemorySize>(buffer.size());
+        const auto [image, imageStartAddress] = this->resolveImage(memoryType);
+        const auto offset = MockDebugTool::resolveImageOffset(image, imageStartAddress, startAddress, bytes);
+
+        std::copy(buffer.begin(), buffer.end(), image.begin() + static_cast<std::ptrdiff_t>(offset));
+
+        this->simulateLatency(bytes);
+    }
+
+    std::uint32_t MockDebugTool::computeMemoryCrc(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes
+    ) {
+        const auto [image, imageStartAddress] = this->resolveImage(memoryType);
+        const auto offset = MockDebugTool::resolveImageOffset(image, imageStartAddress, startAddress, bytes);
+
+        this->simulateLatency();
+        return Crc32::update(Crc32::INITIAL_VALUE, std::span(image).subspan(offset, bytes));
+    }
+
+    void MockDebugTool::eraseProgramMemory(std::optional<ProgramMemorySection> section) {
+        const auto flashStartAddress = this->targetParameters.flashStartAddress.value_or(0);
+        const auto bootSectionOffset = std::min(
+            static_cast<std::size_t>(
+                this->targetParameters.bootSectionStartAddress.value_or(flashStartAddress) - flashStartAddress
+            ),
+            this->programMemory.size()
+        );
+
+        auto eraseBegin = this->programMemory.begin();
+        auto eraseEnd = this->programMemory.end();
+
+        if (section.has_value() && this->targetParameters.bootSectionStartAddress.has_value()) {
+            if (*section == ProgramMemorySection::APPLICATION) {
+                eraseEnd = this->programMemory.begin() + static_cast<std::ptrdiff_t>(bootSectionOffset);
+
+            } else {
+                eraseBegin = this->programMemory.begin() + static_cast<std::ptrdiff_t>(bootSectionOffset);
+            }
+        }
+
+        std::fill(eraseBegin, eraseEnd, 0xFF);
+        this->simulateLatency();
+    }
+
+    TargetState MockDebugTool::getTargetState() {
+        this->simulateLatency();
+
+        if (this->targetState == TargetState::RUNNING && this->pendingStopAddress.has_value()) {
+            this->programCounter = *(this->pendingStopAddress);
+            this->pendingStopAddress = std::nullopt;
+            this->targetState = TargetState::STOPPED;
+        }
+
+        return this->targetState;
+    }
+
+    void MockDebugTool::enableProgrammingMode() {
+        this->simulateLatency();
+        this->programmingModeEnabled = true;
+    }
+
+    void MockDebugTool::disableProgrammingMode() {
+        this->simulateLatency();
+        this->programmingModeEnabled = false;
+
+        // As with physical targets, the target is reset upon leaving programming mode
+        this->reset();
+    }
+
+    void MockDebugTool::initMemoryImages() {
+        const auto& parameters = this->targetParameters;
+
+        if (!parameters.ramStartAddress.has_value() || !parameters.ramSize.has_value()) {
+            throw Exception("Missing required RAM parameters for mock target");
+        }
+
+        if (!parameters.flashSize.has_value()) {
+            throw Exception("Missing required program memory parameters for mock target");
+        }
+
+        this->dataSpace = TargetMemoryBuffer(*parameters.ramStartAddress + *parameters.ramSize, 0x00);
+        this->registerFile = TargetMemoryBuffer(parameters.gpRegisterSize.value_or(32), 0x00);
+        this->programMemory = TargetMemoryBuffer(*parameters.flashSize, 0xFF);
+        this->eeprom = TargetMemoryBuffer(parameters.eepromSize.value_or(0), 0xFF);
+        this->fuses = TargetMemoryBuffer(MockDebugTool::FUSE_MEMORY_SIZE, 0xFF);
+
+        this->memoryImagesInitialised = true;
+    }
+
+    void MockDebugTool::simulateLatency(TargetMemorySize bytes) const {
+        if (this->roundTripLatency.count() == 0) {
+            return;
+        }
+
+        const auto roundTrips = bytes > 0 ? (bytes + this->maxPacketSize - 1) / this->maxPacketSize : 1;
+        std::this_thread::sleep_for(this->roundTripLatency * roundTrips);
+    }
+
+    std::pair<TargetMemoryBuffer&, TargetMemoryAddress> MockDebugTool::resolveImage(
+        TargetMemoryType memoryType,
+        bool registerFile
+    ) {
+        if (!this->activated || !this->memoryImagesInitialised) {
+            throw Exception("Mock target is not activated");
+        }
+
+        switch (memoryType) {
+            case TargetMemoryType::RAM: {
+                if (registerFile && this->hasSeparateRegisterFile()) {
+                    return {this->registerFile, 0};
+                }
+
+                return {this->dataSpace, 0};
+            }
+            case TargetMemoryType::FLASH: {
+                return {this->programMemory, this->targetParameters.flashStartAddress.value_or(0)};
+            }
+            case TargetMemoryType::EEPROM: {
+                return {this->eeprom, this->targetParameters.eepromStartAddress.value_or(0)};
+            }
+            case TargetMemoryType::FUSES: {
+                return {this->fuses, 0};
+            }
+            default: {
+                throw Exception("Unsupported memory type");
+            }
+        }
+    }
+
+    std::size_t MockDebugTool::resolveImageOffset(
+        const TargetMemoryBuffer& image,
+        TargetMemoryAddress imageStartAddress,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes
+    ) {
+        if (
+            startAddress < imageStartAddress
+            || (static_cast<std::size_t>(startAddress - imageStartAddress) + bytes) > image.size()
+        ) {
+            throw Exception(
+                "Invalid memory access - " + std::to_string(bytes) + " byte(s) at address "
+                    + std::to_string(startAddress) + " exceeds the bounds of the mock target's memory"
+            );
+        }
+
+        return static_cast<std::size_t>(startAddress - imageStartAddress);
+    }
+
+    bool MockDebugTool::hasSeparateRegisterFile() const {
+        return (this->family.has_value() && *(this->family) == Family::XMEGA)
+            || (this->targetConfig.has_value() && this->targetConfig->physicalInterface == PhysicalInterface::UPDI);
+    }
+
+    std::optional<TargetMemoryAddress> MockDebugTool::nextBreakpointAddress() const {
+        auto breakpointAddresses = this->softwareBreakpoints;
+        for (const auto& [index, address] : this->hardwareBreakpointsByIndex) {
+            breakpointAddresses.insert(address);
+        }
+
+        if (breakpointAddresses.empty()) {
+            return std::nullopt;
+        }
+
+        // The first breakpoint after the program counter - or, failing that, the first breakpoint (wrapping around)
+        const auto breakpointIt = breakpointAddresses.upper_bound(this->programCounter);
+        return breakpointIt != breakpointAddresses.end() ? *breakpointIt : *(breakpointAddresses.begin());
+    }
+}
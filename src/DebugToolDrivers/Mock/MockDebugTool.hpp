@@ -0,0 +1,286 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <map>
+#include <set>
+#include <vector>
+#include <chrono>
+#include <optional>
+
+#include "src/DebugToolDrivers/DebugTool.hpp"
+#include "src/DebugToolDrivers/TargetInterfaces/Microchip/AVR/AVR8/Avr8DebugInterface.hpp"
+
+#include "src/ProjectConfig.hpp"
+
+namespace Bloom::DebugToolDrivers
+{
+    /**
+     * The mock debug tool simulates a debug tool and an AVR8 target, entirely in memory. It doesn't require any
+     * hardware, which allows for reproducible end-to-end load tests and benchmarks of Bloom's host-side overhead (the
+     * GDB server -> TargetController -> driver pipeline).
+     *
+     * The target's RAM (data space), program memory, EEPROM and fuses are held in in-memory images, which are
+     * initialised upon activation (data space zeroed, everything else erased to 0xFF). The target doesn't execute any
+     * instructions. Instead:
+     *  - Each step advances the program counter by one instruction word.
+     *  - Resuming execution with a breakpoint set results in the target stopping at the next breakpoint address
+     *    after the program counter (wrapping around, if necessary).
+     *  - Resuming execution with a "run to" address results in the target stopping at that address.
+     *  - Resuming execution without any breakpoints leaves the target running until it's stopped.
+     *
+     * To simulate the cost of USB round trips, every operation can be delayed by a configurable latency. See the
+     * constructor for the supported config parameters.
+     *
+     * The mock debug tool is selected via the "mock" debug tool name, in the user's project configuration file.
+     */
+    class MockDebugTool
+        : public DebugTool
+        , public TargetInterfaces::Microchip::Avr::Avr8::Avr8DebugInterface
+    {
+    public:
+        /**
+         * Extracts the following (optional) parameters from the debug tool config node:
+         *  - roundTripLatency: the simulated latency of a single USB round trip, in microseconds. Defaults to 0.
+         *  - maxPacketSize: the number of bytes that can be transferred in a single round trip. Memory accesses
+         *    larger than this incur multiple round trips. Defaults to 512.
+         *  - signature: the signature to report for the target, in the form 0xAABBCC. Only required when the target
+         *    name in the config is ambiguous (e.g. "avr8") - otherwise the signature is resolved from the target
+         *    name.
+         *
+         * @param debugToolConfig
+         */
+        explicit MockDebugTool(const DebugToolConfig& debugToolConfig);
+
+        /**
+         * Both DebugTool::init() and Avr8DebugInterface::init() are implemented by this member function. There's
+         * nothing to connect to, so it just marks the tool as initialised.
+         */
+        void init() override;
+
+        void close() override;
+
+        std::string getName() override {
+            return "Mock";
+        }
+
+        std::string getSerialNumber() override {
+            return "MOCK0000";
+        }
+
+        TargetInterfaces::Microchip::Avr::Avr8::Avr8DebugInterface* getAvr8DebugInterface() override {
+            return this;
+        }
+
+        void configure(const Targets::Microchip::Avr::Avr8Bit::Avr8TargetConfig& targetConfig) override;
+
+        void setFamily(Targets::Microchip::Avr::Avr8Bit::Family family) override {
+            this->family = family;
+        }
+
+        void setTargetParameters(const Targets::Microchip::Avr::Avr8Bit::TargetParameters& config) override;
+
+        void stop() override;
+
+        void run() override;
+
+        void runTo(Targets::TargetMemoryAddress address) override;
+
+        void step() override;
+
+        void reset() override;
+
+        void activate() override;
+
+        void deactivate() override;
+
+        void disableDebugWire() override {};
+
+        Targets::Microchip::Avr::TargetSignature getDeviceId() override;
+
+        void setSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) override;
+
+        void clearSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) override;
+
+        std::uint16_t getHardwareBreakpointCount() override {
+            return MockDebugTool::HARDWARE_BREAKPOINT_COUNT;
+        }
+
+        void setHardwareBreakpoint(std::uint16_t index, Targets::TargetMemoryAddress address) override;
+
+        void clearHardwareBreakpoint(std::uint16_t index) override;
+
+        std::uint16_t getDataBreakpointCount() override {
+            return 0;
+        }
+
+        void setDataBreakpoint(
+            std::uint16_t index,
+            Targets::TargetMemoryAddress address,
+            Targets::TargetWatchpointType type
+        ) override;
+
+        void clearDataBreakpoint(std::uint16_t index) override;
+
+        void clearAllBreakpoints() override;
+
+        Targets::TargetProgramCounter getProgramCounter() override;
+
+        void setProgramCounter(Targets::TargetProgramCounter programCounter) override;
+
+        void readRegisters(
+            Targets::TargetRegisterDescriptorSelection descriptors,
+            Targets::TargetRegisters& output
+        ) override;
+
+        void writeRegisters(Targets::TargetRegisterSelection registers) override;
+
+        Targets::TargetMemoryBuffer readMemory(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {}
+        ) override;
+
+        std::vector<Targets::TargetMemoryBuffer> readMemoryRanges(
+            Targets::TargetMemoryType memoryType,
+            const std::vector<Targets::TargetMemoryAddressRange>& addressRanges
+        ) override;
+
+        void writeMemory(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            const Targets::TargetMemoryBuffer& buffer
+        ) override;
+
+        std::uint32_t computeMemoryCrc(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes
+        ) override;
+
+        void eraseProgramMemory(
+            std::optional<Targets::Microchip::Avr::Avr8Bit::ProgramMemorySection> section = std::nullopt
+        ) override;
+
+        bool programMemoryPageRewritesSupported() override {
+            return true;
+        }
+
+        bool eepromPageWritesSupported() override {
+            return true;
+        }
+
+        bool runtimeMemoryAccessSupported() override {
+            return true;
+        }
+
+        Targets::TargetState getTargetState() override;
+
+        void enableProgrammingMode() override;
+
+        void disableProgrammingMode() override;
+
+    protected:
+        static constexpr std::uint16_t HARDWARE_BREAKPOINT_COUNT = 3;
+        static constexpr Targets::TargetMemorySize FUSE_MEMORY_SIZE = 16;
+
+        std::chrono::microseconds roundTripLatency = std::chrono::microseconds(0);
+        Targets::TargetMemorySize maxPacketSize = 512;
+        std::optional<Targets::Microchip::Avr::TargetSignature> signature;
+
+        std::optional<Targets::Microchip::Avr::Avr8Bit::Avr8TargetConfig> targetConfig;
+        std::optional<Targets::Microchip::Avr::Avr8Bit::Family> family;
+        Targets::Microchip::Avr::Avr8Bit::TargetParameters targetParameters;
+
+        /**
+         * The data space image holds the target's GP registers and I/O registers, as well as its RAM. On XMEGA and
+         * UPDI targets, the GP registers are not mapped to the data space, so they're held in a separate image
+         * (this->registerFile).
+         */
+        Targets::TargetMemoryBuffer dataSpace;
+        Targets::TargetMemoryBuffer registerFile;
+        Targets::TargetMemoryBuffer programMemory;
+        Targets::TargetMemoryBuffer eeprom;
+        Targets::TargetMemoryBuffer fuses;
+
+        Targets::TargetState targetState = Targets::TargetState::STOPPED;
+        Targets::TargetProgramCounter programCounter = 0;
+
+        /**
+         * The address at which the target will stop, upon the next call to getTargetState(), if it's running.
+         */
+        std::optional<Targets::TargetMemoryAddress> pendingStopAddress;
+
+        std::set<Targets::TargetMemoryAddress> softwareBreakpoints;
+        std::map<std::uint16_t, Targets::TargetMemoryAddress> hardwareBreakpointsByIndex;
+
+        bool activated = false;
+        bool memoryImagesInitialised = false;
+        bool programmingModeEnabled = false;
+
+        /**
+         * Allocates and initialises the memory images, using the target parameters.
+         *
+         * For ambiguous target names (e.g. "avr8"), the target parameters are only provided after activation (once
+         * the target signature has been read), so we can't always do this upon activation.
+         */
+        void initMemoryImages();
+
+        /**
+         * Simulates the latency of communicating with a physical debug tool, for an operation that transfers the
+         * given number of bytes.
+         *
+         * @param bytes
+         */
+        void simulateLatency(Targets::TargetMemorySize bytes = 0) const;
+
+        /**
+         * Returns the image that holds the given memory type, along with the address at which the image starts.
+         *
+         * @param memoryType
+         * @param registerFile
+         *  Whether to return the GP register file image (when memoryType is RAM), on targets where the register file
+         *  is not mapped to the data space.
+         *
+         * @return
+         */
+        std::pair<Targets::TargetMemoryBuffer&, Targets::TargetMemoryAddress> resolveImage(
+            Targets::TargetMemoryType memoryType,
+            bool registerFile = false
+        );
+
+        /**
+         * Checks that the given range falls within the given image, and returns the offset of the range in the image.
+         *
+         * @param image
+         * @param imageStartAddress
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         */
+        static std::size_t resolveImageOffset(
+            const Targets::TargetMemoryBuffer& image,
+            Targets::TargetMemoryAddress imageStartAddress,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes
+        );
+
+        /**
+         * Determines whether the GP registers are held in a separate register file (as opposed to being mapped to
+         * the data space).
+         *
+         * @return
+         */
+        [[nodiscard]] bool hasSeparateRegisterFile() const;
+
+        /**
+         * Returns the address at which the target would stop, if it were to resume execution from the current
+         * program counter, or std::nullopt if no breakpoints are set.
+         *
+         * @return
+         */
+        [[nodiscard]] std::optional<Targets::TargetMemoryAddress> nextBreakpointAddress() const;
+    };
+}
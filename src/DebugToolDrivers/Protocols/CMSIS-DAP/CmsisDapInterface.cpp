@@ -1,6 +1,7 @@
 #include "CmsisDapInterface.hpp"
 
 #include <thread>
+#include <algorithm>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Command.hpp"
 
@@ -8,23 +9,62 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
 {
     using namespace Bloom::Exceptions;
 
-    CmsisDapInterface::CmsisDapInterface(Usb::HidInterface&& usbHidInterface)
-        : usbHidInterface(std::move(usbHidInterface))
+    CmsisDapInterface::CmsisDapInterface(std::unique_ptr<Usb::PacketInterface> usbInterface)
+        : usbInterface(std::move(usbInterface))
     {}
 
     void CmsisDapInterface::sendCommand(const Command& cmsisDapCommand) {
-        if (this->msSendCommandDelay.count() > 0) {
-            using namespace std::chrono;
-            std::int64_t now = duration_cast<milliseconds>(high_resolution_clock::now().time_since_epoch()).count();
-            std::int64_t difference = (now - this->lastCommandSentTimeStamp);
+        this->waitForCommandTimeGap();
+        this->getUsbInterface().write(cmsisDapCommand.rawCommand());
+    }
+
+    void CmsisDapInterface::sendReport(std::span<const unsigned char> report) {
+        this->waitForCommandTimeGap();
+        this->getUsbInterface().writePacket(report);
+    }
+
+    void CmsisDapInterface::waitForCommandTimeGap() {
+        const auto commandTimeGap = this->adaptiveCommandPacing ? this->adaptiveCommandTimeGap : this->commandTimeGap;
+
+        if (commandTimeGap.count() > 0) {
+            const auto earliestSendTime = this->lastCommandSentTime + commandTimeGap;
 
-            if (difference < this->msSendCommandDelay.count()) {
-                std::this_thread::sleep_for(milliseconds(this->msSendCommandDelay.count() - difference));
+            if (std::chrono::steady_clock::now() < earliestSendTime) {
+                std::this_thread::sleep_until(earliestSendTime);
             }
+        }
+
+        this->lastCommandSentTime = std::chrono::steady_clock::now();
+    }
+
+    void CmsisDapInterface::reportDeviceBusy() {
+        this->consecutiveReadyResponseCount = 0;
 
-            this->lastCommandSentTimeStamp = now;
+        if (!this->adaptiveCommandPacing) {
+            return;
         }
 
-        this->getUsbHidInterface().write(cmsisDapCommand.rawCommand());
+        // Start at an eighth of the maximum gap, and double upon each subsequent report
+        this->adaptiveCommandTimeGap = std::min(
+            std::max(this->adaptiveCommandTimeGap * 2, this->commandTimeGap / 8),
+            this->commandTimeGap
+        );
+    }
+
+    void CmsisDapInterface::reportDeviceReady() {
+        if (!this->adaptiveCommandPacing || this->adaptiveCommandTimeGap.count() == 0) {
+            return;
+        }
+
+        if (++this->consecutiveReadyResponseCount < CmsisDapInterface::ADAPTIVE_PACING_READY_RESPONSE_THRESHOLD) {
+            return;
+        }
+
+        this->consecutiveReadyResponseCount = 0;
+        this->adaptiveCommandTimeGap /= 2;
+
+        if (this->adaptiveCommandTimeGap < std::chrono::microseconds(100)) {
+            this->adaptiveCommandTimeGap = std::chrono::microseconds(0);
+        }
     }
 }
@@ -3,8 +3,9 @@
 #include <memory>
 #include <chrono>
 #include <cstdint>
+#include <span>
 
-#include "src/DebugToolDrivers/USB/HID/HidInterface.hpp"
+#include "src/DebugToolDrivers/USB/PacketInterface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Response.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Command.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrCommand.hpp"
@@ -21,7 +22,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
     class CmsisDapInterface
     {
     public:
-        explicit CmsisDapInterface(Usb::HidInterface&& usbHidInterface);
+        explicit CmsisDapInterface(std::unique_ptr<Usb::PacketInterface> usbInterface);
 
         virtual ~CmsisDapInterface() = default;
 
@@ -30,16 +31,38 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
         CmsisDapInterface& operator = (const CmsisDapInterface& other) = delete;
         CmsisDapInterface& operator = (CmsisDapInterface&& other) = delete;
 
-        Usb::HidInterface& getUsbHidInterface() {
-            return this->usbHidInterface;
+        Usb::PacketInterface& getUsbInterface() {
+            return *(this->usbInterface);
         }
 
-        std::size_t getUsbHidInputReportSize() {
-            return this->usbHidInterface.inputReportSize;
+        /**
+         * The size of the packets exchanged with the device (for HID interfaces, the report size). CMSIS-DAP
+         * commands and responses are each confined to a single packet.
+         *
+         * @return
+         */
+        std::size_t getUsbPacketSize() {
+            return this->usbInterface->getPacketSize();
         }
 
-        void setMinimumCommandTimeGap(std::chrono::milliseconds commandTimeGap) {
-            this->msSendCommandDelay = commandTimeGap;
+        void setMinimumCommandTimeGap(std::chrono::microseconds commandTimeGap) {
+            this->commandTimeGap = commandTimeGap;
+        }
+
+        /**
+         * Enables or disables adaptive command pacing.
+         *
+         * With adaptive pacing, the minimum command time gap (see CmsisDapInterface::setMinimumCommandTimeGap()) is
+         * treated as an upper bound. We only enforce a gap between commands when the device indicates that it's
+         * busy (see CmsisDapInterface::reportDeviceBusy()), and we back off again once the device has been ready
+         * for a while.
+         *
+         * @param enabled
+         */
+        void setAdaptiveCommandPacing(bool enabled) {
+            this->adaptiveCommandPacing = enabled;
+            this->adaptiveCommandTimeGap = std::chrono::microseconds(0);
+            this->consecutiveReadyResponseCount = 0;
         }
 
         /**
@@ -49,6 +72,17 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
          */
         virtual void sendCommand(const Command& cmsisDapCommand);
 
+        /**
+         * Sends a raw CMSIS-DAP command to the device, in the form of a complete packet (command ID, followed by the
+         * command data, padded to the packet size).
+         *
+         * This is for callers that construct their commands in place, in a reusable report buffer, to avoid the
+         * allocations involved in constructing Command objects (see EdbgInterface::sendAvrCommandFrameSegments()).
+         *
+         * @param report
+         */
+        void sendReport(std::span<const unsigned char> report);
+
         /**
          * Listens for a CMSIS-DAP response from the device.
          *
@@ -65,7 +99,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
                 "CMSIS Response type must be derived from the Response class."
             );
 
-            const auto rawResponse = this->getUsbHidInterface().read(std::chrono::milliseconds(60000));
+            const auto rawResponse = this->getUsbInterface().read(std::chrono::milliseconds(60000));
 
             if (rawResponse.empty()) {
                 throw Exceptions::DeviceCommunicationFailure("Empty CMSIS-DAP response received");
@@ -105,25 +139,59 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
             return response;
         }
 
+    protected:
+        /**
+         * When adaptive command pacing is enabled, this many consecutive "ready" responses will halve the current
+         * command time gap.
+         */
+        static constexpr std::uint16_t ADAPTIVE_PACING_READY_RESPONSE_THRESHOLD = 16;
+
+        /**
+         * Should be called when the device responds in a way that indicates it wasn't ready for the command (a
+         * rejected command, or a poll that returned nothing because the device is still processing). This
+         * increases the current command time gap, when adaptive pacing is enabled.
+         */
+        void reportDeviceBusy();
+
+        /**
+         * Should be called when the device responds in a way that indicates it was ready for the command.
+         */
+        void reportDeviceReady();
+
     private:
         /**
-         * All CMSIS-DAP devices employ the USB HID interface for communication.
+         * Enforces the command time gap (see CmsisDapInterface::setMinimumCommandTimeGap()). Must be called
+         * immediately before sending any command.
+         */
+        void waitForCommandTimeGap();
+
+        /**
+         * CMSIS-DAP v1 devices employ the USB HID interface for communication (see Usb::HidInterface). CMSIS-DAP v2
+         * devices can also employ a pair of bulk endpoints (see Usb::UsbBulkInterface).
          *
-         * For many CMSIS-DAP devices, the USB HID interface parameters (interface number, endpoint config, etc) vary
+         * For many CMSIS-DAP devices, the USB interface parameters (interface number, endpoint config, etc) vary
          * amongst devices, so we'll need to be able to preActivationConfigure the CMSISDAPInterface from a
-         * higher level. For an example, see the constructor of the AtmelIce device class.
+         * higher level. For an example, see EdbgDevice::init().
          */
-        Usb::HidInterface usbHidInterface;
+        std::unique_ptr<Usb::PacketInterface> usbInterface;
 
         /**
          * Some CMSIS-DAP debug tools fail to operate properly when we send commands too quickly. Even if we've
          * received a response from every previous command.
          *
          * Because of this, we may need to enforce a minimum time gap between sending CMSIS commands.
-         * Setting msSendCommandDelay to any value above 0 will enforce an x millisecond gap between each command
-         * being sent, where x is the value of msSendCommandDelay.
+         * Setting commandTimeGap to any value above 0 will enforce a gap of that duration between each command
+         * being sent. If adaptive pacing is enabled, this is the maximum gap (see setAdaptiveCommandPacing()).
+         */
+        std::chrono::microseconds commandTimeGap = std::chrono::microseconds(0);
+        std::chrono::steady_clock::time_point lastCommandSentTime;
+
+        bool adaptiveCommandPacing = false;
+
+        /**
+         * The gap currently being enforced, when adaptive pacing is enabled. Always within [0, commandTimeGap].
          */
-        std::chrono::milliseconds msSendCommandDelay = std::chrono::milliseconds(0);
-        std::int64_t lastCommandSentTimeStamp = 0;
+        std::chrono::microseconds adaptiveCommandTimeGap = std::chrono::microseconds(0);
+        std::uint16_t consecutiveReadyResponseCount = 0;
     };
 }
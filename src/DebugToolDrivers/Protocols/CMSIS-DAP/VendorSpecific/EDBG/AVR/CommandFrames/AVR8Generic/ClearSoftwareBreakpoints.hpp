@@ -1,16 +1,22 @@
 #pragma once
 
 #include <cstdint>
-#include <utility>
+#include <span>
 
 #include "Avr8GenericCommandFrame.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::Avr8Generic
 {
-    class ClearSoftwareBreakpoints: public Avr8GenericCommandFrame<std::vector<unsigned char>>
+    class ClearSoftwareBreakpoints: public Avr8GenericCommandFrame<BoundedPayload<2 + (4 * 32)>>
     {
     public:
-        explicit ClearSoftwareBreakpoints(const std::vector<std::uint32_t>& addresses)
+        /**
+         * The maximum number of breakpoints that can be cleared with a single command frame. Larger batches must
+         * be split across multiple frames.
+         */
+        static constexpr std::size_t MAXIMUM_ADDRESS_COUNT = 32;
+
+        explicit ClearSoftwareBreakpoints(std::span<const std::uint32_t> addresses)
             : Avr8GenericCommandFrame()
         {
             /*
@@ -27,10 +33,10 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
             };
 
             for (const auto& address : addresses) {
-                this->payload.emplace_back(static_cast<unsigned char>(address));
-                this->payload.emplace_back(static_cast<unsigned char>(address >> 8));
-                this->payload.emplace_back(static_cast<unsigned char>(address >> 16));
-                this->payload.emplace_back(static_cast<unsigned char>(address >> 24));
+                this->payload.push_back(static_cast<unsigned char>(address));
+                this->payload.push_back(static_cast<unsigned char>(address >> 8));
+                this->payload.push_back(static_cast<unsigned char>(address >> 16));
+                this->payload.push_back(static_cast<unsigned char>(address >> 24));
             }
         }
     };
@@ -9,7 +9,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
     class EraseMemory: public Avr8GenericCommandFrame<std::array<unsigned char, 7>>
     {
     public:
-        EraseMemory(Avr8EraseMemoryMode mode)
+        explicit EraseMemory(Avr8EraseMemoryMode mode, std::uint32_t address = 0)
             : Avr8GenericCommandFrame()
         {
             /*
@@ -17,16 +17,16 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
              * 1. Command ID (0x20)
              * 2. Version (0x00)
              * 3. Erase mode (see Avr8EraseMemoryMode enum)
-             * 4. Start address (4 bytes) - this is just hardcoded to 0x00000000 for now.
+             * 4. Start address (4 bytes) - only used by the page erase modes, to identify the page to erase.
              */
             this->payload = {
                 0x20,
                 0x00,
                 static_cast<unsigned char>(mode),
-                0x00,
-                0x00,
-                0x00,
-                0x00,
+                static_cast<unsigned char>(address),
+                static_cast<unsigned char>(address >> 8),
+                static_cast<unsigned char>(address >> 16),
+                static_cast<unsigned char>(address >> 24),
             };
         }
     };
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Avr8GenericCommandFrame.hpp"
+
+#include "src/Targets/TargetBreakpoint.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::Avr8Generic
+{
+    class SetDataBreakpoint: public Avr8GenericCommandFrame<std::array<unsigned char, 9>>
+    {
+    public:
+        SetDataBreakpoint(std::uint8_t number, std::uint32_t address, Targets::TargetWatchpointType type)
+            : Avr8GenericCommandFrame()
+        {
+            /*
+             * Data breakpoints are set via the same command as hardware (program) breakpoints, but with a different
+             * breakpoint type and mode:
+             * 1. Command ID (0x40)
+             * 2. Version (0x00)
+             * 3. Breakpoint type (0x02 for data breakpoint)
+             * 4. Breakpoint number (1, 2 or 3)
+             * 5. Address (4 bytes, LSB)
+             * 6. Mode (0x00 for read, 0x01 for write, 0x02 for read or write)
+             */
+            this->payload = {
+                0x40,
+                0x00,
+                0x02,
+                number,
+                static_cast<unsigned char>(address),
+                static_cast<unsigned char>(address >> 8),
+                static_cast<unsigned char>(address >> 16),
+                static_cast<unsigned char>(address >> 24),
+                type == Targets::TargetWatchpointType::READ
+                    ? static_cast<unsigned char>(0x00)
+                    : type == Targets::TargetWatchpointType::WRITE
+                        ? static_cast<unsigned char>(0x01)
+                        : static_cast<unsigned char>(0x02),
+            };
+        }
+    };
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Avr8GenericCommandFrame.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::Avr8Generic
+{
+    class SetHardwareBreakpoint: public Avr8GenericCommandFrame<std::array<unsigned char, 9>>
+    {
+    public:
+        SetHardwareBreakpoint(std::uint8_t number, std::uint32_t address)
+            : Avr8GenericCommandFrame()
+        {
+            /*
+             * The set hardware breakpoint command consists of 9 bytes:
+             * 1. Command ID (0x40)
+             * 2. Version (0x00)
+             * 3. Breakpoint type (0x01 for program breakpoint)
+             * 4. Breakpoint number (1, 2 or 3)
+             * 5. Address (4 bytes, LSB)
+             * 6. Mode (0x03 for program breakpoint)
+             */
+            this->payload = {
+                0x40,
+                0x00,
+                0x01,
+                number,
+                static_cast<unsigned char>(address),
+                static_cast<unsigned char>(address >> 8),
+                static_cast<unsigned char>(address >> 16),
+                static_cast<unsigned char>(address >> 24),
+                0x03,
+            };
+        }
+    };
+}
@@ -1,13 +1,21 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
+
 #include "Avr8GenericCommandFrame.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::Avr8Generic
 {
-    class SetParameter: public Avr8GenericCommandFrame<std::vector<unsigned char>>
+    class SetParameter: public Avr8GenericCommandFrame<BoundedPayload<5 + 255>>
     {
     public:
-        SetParameter(const Avr8EdbgParameter& parameter, const std::vector<unsigned char>& value)
+        /**
+         * The maximum size of a parameter value. The value length is encoded in a single byte.
+         */
+        static constexpr std::size_t MAXIMUM_VALUE_SIZE = 255;
+
+        SetParameter(const Avr8EdbgParameter& parameter, std::span<const unsigned char> value)
             : Avr8GenericCommandFrame()
         {
             /*
@@ -17,15 +25,16 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
              * 3. Param context (Avr8EdbgParameter::context)
              * 4. Param ID (Avr8EdbgParameter::id)
              * 5. Param value length (value.size()) - this is only one byte in size, so its value should
-             *    never exceed 255.
+             *    never exceed SetParameter::MAXIMUM_VALUE_SIZE.
              */
-            this->payload = std::vector<unsigned char>(5, 0x00);
-            this->payload[0] = 0x01;
-            this->payload[1] = 0x00;
-            this->payload[2] = static_cast<unsigned char>(parameter.context);
-            this->payload[3] = static_cast<unsigned char>(parameter.id);
-            this->payload[4] = static_cast<unsigned char>(value.size());
-            this->payload.insert(this->payload.end(), value.begin(), value.end());
+            this->payload = {
+                0x01,
+                0x00,
+                static_cast<unsigned char>(parameter.context),
+                static_cast<unsigned char>(parameter.id),
+                static_cast<unsigned char>(value.size()),
+            };
+            this->payload.append(value);
         }
     };
 }
@@ -1,16 +1,26 @@
 #pragma once
 
 #include <cstdint>
+#include <array>
+#include <span>
 
 #include "Avr8GenericCommandFrame.hpp"
 #include "src/Targets/TargetMemory.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::Avr8Generic
 {
-    class WriteMemory: public Avr8GenericCommandFrame<std::vector<unsigned char>>
+    class WriteMemory: public Avr8GenericCommandFrame<std::array<unsigned char, 12>>
     {
     public:
-        WriteMemory(const Avr8MemoryType& type, std::uint32_t address, const Targets::TargetMemoryBuffer& buffer)
+        /**
+         * The buffer is not copied into the command frame - it's sent straight from the given span, so it must
+         * outlive the command frame.
+         *
+         * @param type
+         * @param address
+         * @param buffer
+         */
+        WriteMemory(const Avr8MemoryType& type, std::uint32_t address, std::span<const unsigned char> buffer)
             : Avr8GenericCommandFrame()
         {
             /*
@@ -21,9 +31,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
              * 4. Start address (4 bytes)
              * 5. Number of bytes to write (4 bytes)
              * 6. Asynchronous flag (0x00 for "write first, then reply" and 0x01 for "reply first, then write")
-             * 7. Buffer
+             * 7. Buffer (see AvrCommandFrame::externalPayload)
              */
-            this->payload = std::vector<unsigned char>(12, 0x00);
             this->payload[0] = 0x23;
             this->payload[1] = 0x00;
             this->payload[2] = static_cast<unsigned char>(type);
@@ -41,7 +50,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
             // We always set the async flag to 0x00 ("write first, then reply")
             this->payload[11] = 0x00;
 
-            this->payload.insert(this->payload.end(), buffer.begin(), buffer.end());
+            this->externalPayload = buffer;
         }
     };
 }
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#include "AvrIspCommandFrame.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::AvrIsp
+{
+    class ChipErase: public AvrIspCommandFrame<std::array<unsigned char, 7>>
+    {
+    public:
+        ChipErase(std::uint8_t eraseDelay, std::uint8_t pollMethod)
+            : AvrIspCommandFrame()
+        {
+            /*
+             * The chip erase command consists of 7 bytes:
+             *
+             * 1. Command ID (0x12)
+             * 2. Erase delay
+             * 3. Poll method (0x00 for delay, 0x01 for RDY/BSY polling)
+             * 4. CMD1
+             * 5. CMD2
+             * 6. CMD3
+             * 7. CMD4
+             */
+            this->payload = {
+                0x12,
+                eraseDelay,
+                pollMethod,
+                0xAC,
+                0x80,
+                0x00,
+                0x00,
+            };
+        }
+    };
+}
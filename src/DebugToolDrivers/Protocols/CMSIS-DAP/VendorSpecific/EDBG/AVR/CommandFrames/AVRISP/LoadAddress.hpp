@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+#include "AvrIspCommandFrame.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::AvrIsp
+{
+    class LoadAddress: public AvrIspCommandFrame<std::array<unsigned char, 5>>
+    {
+    public:
+        /**
+         * The address is a word address for program memory, and a byte address for EEPROM. It's used (and
+         * incremented) by the subsequent read/program memory commands.
+         *
+         * Bit 31 of the address instructs the debug tool to issue a "load extended address" command to the target,
+         * which is required for program memory word addresses beyond 0xFFFF.
+         *
+         * @param address
+         */
+        explicit LoadAddress(std::uint32_t address)
+            : AvrIspCommandFrame()
+        {
+            /*
+             * The load address command consists of 5 bytes:
+             *
+             * 1. Command ID (0x06)
+             * 2. Address (4 bytes, MSB first)
+             */
+            this->payload = {
+                0x06,
+                static_cast<unsigned char>(address >> 24),
+                static_cast<unsigned char>(address >> 16),
+                static_cast<unsigned char>(address >> 8),
+                static_cast<unsigned char>(address),
+            };
+        }
+    };
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "AvrIspCommandFrame.hpp"
+
+#include "src/Targets/Microchip/AVR/IspParameters.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::AvrIsp
+{
+    class ProgramFlash: public AvrIspCommandFrame<std::array<unsigned char, 10>>
+    {
+    public:
+        /**
+         * Writes the given buffer to the target's program memory, starting at the address given in the preceding
+         * LoadAddress command.
+         *
+         * The buffer is not copied into the command frame - it's sent straight from the given span, so it must
+         * outlive the command frame.
+         *
+         * @param parameters
+         * @param writePage
+         *  For paged memories, whether the debug tool should commit the loaded page to the target's memory, once the
+         *  buffer has been loaded.
+         *
+         * @param buffer
+         */
+        ProgramFlash(
+            const Targets::Microchip::Avr::IspMemoryProgrammingParameters& parameters,
+            bool writePage,
+            std::span<const unsigned char> buffer
+        )
+            : AvrIspCommandFrame()
+        {
+            /*
+             * The program program memory command consists of 10 bytes + the buffer size:
+             *
+             * 1. Command ID (0x13)
+             * 2. Number of bytes to write (2 bytes, MSB first)
+             * 3. Mode (bit 7 instructs the debug tool to write the page)
+             * 4. Delay
+             * 5. CMD1 (load page)
+             * 6. CMD2 (write page)
+             * 7. CMD3 (read, for polling)
+             * 8. Poll value 1
+             * 9. Poll value 2
+             * 10. Buffer (see AvrCommandFrame::externalPayload)
+             */
+            const auto bytesToWrite = static_cast<std::uint16_t>(buffer.size());
+
+            this->payload = {
+                0x13,
+                static_cast<unsigned char>(bytesToWrite >> 8),
+                static_cast<unsigned char>(bytesToWrite),
+                static_cast<unsigned char>(writePage ? (parameters.mode | 0x80) : parameters.mode),
+                parameters.delay,
+                parameters.loadPageCommand,
+                parameters.writePageCommand,
+                parameters.readCommand,
+                parameters.pollValue1,
+                parameters.pollValue2,
+            };
+
+            this->externalPayload = buffer;
+        }
+    };
+}
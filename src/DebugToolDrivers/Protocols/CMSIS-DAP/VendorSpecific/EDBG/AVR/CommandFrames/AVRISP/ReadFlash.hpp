@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#include "AvrIspCommandFrame.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::AvrIsp
+{
+    class ReadFlash: public AvrIspCommandFrame<std::array<unsigned char, 4>>
+    {
+    public:
+        /**
+         * Reads from the target's program memory, starting at the address given in the preceding LoadAddress command.
+         *
+         * The response payload consists of the command ID, a status code, the data and a final status code.
+         *
+         * @param bytes
+         */
+        explicit ReadFlash(std::uint16_t bytes)
+            : AvrIspCommandFrame()
+        {
+            /*
+             * The read program memory command consists of 4 bytes:
+             *
+             * 1. Command ID (0x14)
+             * 2. Number of bytes to read (2 bytes, MSB first)
+             * 3. CMD1 (0x20)
+             */
+            this->payload = {
+                0x14,
+                static_cast<unsigned char>(bytes >> 8),
+                static_cast<unsigned char>(bytes),
+                0x20,
+            };
+        }
+    };
+}
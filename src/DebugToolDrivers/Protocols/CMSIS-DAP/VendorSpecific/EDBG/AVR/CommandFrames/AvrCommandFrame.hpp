@@ -7,10 +7,13 @@
 #include <cmath>
 #include <atomic>
 #include <array>
+#include <span>
+#include <algorithm>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Command.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/Edbg.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrCommand.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/BoundedPayload.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/ResponseFrames/AvrResponseFrame.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
@@ -35,8 +38,13 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          * For the above reason, the AvrCommandFrame class is a template class in which the payload container type can
          * be specified for individual commands.
          *
-         * For now, we only permit two payload container types:
-         *  - std::array<unsigned char> for payloads with automatic storage duration.
+         * Some payload sizes are determined at runtime, but have a small upper bound. Consider the Set Parameter
+         * command - its payload size depends on the size of the parameter value, which can never exceed 255 bytes.
+         * For such commands, we use a BoundedPayload, which has automatic storage duration.
+         *
+         * For now, we only permit three payload container types:
+         *  - std::array<unsigned char> for fixed size payloads.
+         *  - BoundedPayload<X> for payloads with an upper bound.
          *  - std::vector<unsigned char> for payloads with dynamic storage duration.
          */
         static_assert(
@@ -44,7 +52,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
                 std::is_same_v<PayloadContainerType, std::vector<unsigned char>>
                 || std::is_same_v<typename PayloadContainerType::value_type, unsigned char>
             ),
-            "Invalid payload container type - must be an std::array<unsigned char, X> or an std::vector<unsigned char>"
+            "Invalid payload container type - must be an std::array<unsigned char, X>, a BoundedPayload<X> or an "
+                "std::vector<unsigned char>"
         );
 
     public:
@@ -88,6 +97,14 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
 
         PayloadContainerType payload;
 
+        /**
+         * Payload data that follows this->payload in the raw command frame, without being copied into the frame.
+         *
+         * This allows for large blocks of data (such as those sent with the Write Memory command) to be sent
+         * straight from the caller's buffer. The referenced data must outlive the command frame.
+         */
+        std::span<const unsigned char> externalPayload;
+
         explicit AvrCommandFrame(ProtocolHandlerId protocolHandlerId)
             : sequenceId(++lastSequenceId)
             , protocolHandlerId(protocolHandlerId)
@@ -110,23 +127,33 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          * @return
          */
         [[nodiscard]] auto getRawCommandFrame() const {
-            auto rawCommand = std::vector<unsigned char>(5 + this->payload.size());
-
-            rawCommand[0] = 0x0E; // Start of frame (SOF) byte
-            rawCommand[1] = 0x00; // Protocol version
-
-            rawCommand[2] = static_cast<unsigned char>(this->sequenceId);
-            rawCommand[3] = static_cast<unsigned char>(this->sequenceId >> 8);
+            const auto header = this->getRawCommandFrameHeader();
 
-            rawCommand[4] = static_cast<unsigned char>(this->protocolHandlerId);
+            auto rawCommand = std::vector<unsigned char>();
+            rawCommand.reserve(header.size() + this->payload.size() + this->externalPayload.size());
 
-            if (!this->payload.empty()) {
-                std::copy(this->payload.begin(), this->payload.end(), rawCommand.begin() + 5);
-            }
+            rawCommand.insert(rawCommand.end(), header.begin(), header.end());
+            rawCommand.insert(rawCommand.end(), this->payload.begin(), this->payload.end());
+            rawCommand.insert(rawCommand.end(), this->externalPayload.begin(), this->externalPayload.end());
 
             return rawCommand;
         }
 
+        /**
+         * Generates the raw command frame header, which precedes the payload.
+         *
+         * @return
+         */
+        [[nodiscard]] std::array<unsigned char, 5> getRawCommandFrameHeader() const {
+            return {
+                0x0E, // Start of frame (SOF) byte
+                0x00, // Protocol version
+                static_cast<unsigned char>(this->sequenceId),
+                static_cast<unsigned char>(this->sequenceId >> 8),
+                static_cast<unsigned char>(this->protocolHandlerId),
+            };
+        }
+
         /**
          * AvrCommandFrames are sent to the device via AvrCommands (CMSIS-DAP vendor commands).
          *
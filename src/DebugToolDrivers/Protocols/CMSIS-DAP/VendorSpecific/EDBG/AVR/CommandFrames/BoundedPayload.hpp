@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <span>
+#include <string>
+#include <algorithm>
+#include <initializer_list>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
+{
+    /**
+     * A payload container with a fixed capacity, for AvrCommandFrames whose payload size is only known at runtime,
+     * but has a small upper bound (e.g. the SetParameter command, where the payload size depends on the size of the
+     * parameter value).
+     *
+     * The payload is held in automatic storage, so constructing (and sending) the command frame doesn't allocate.
+     * See AvrCommandFrame for more.
+     */
+    template <std::size_t Capacity>
+    class BoundedPayload
+    {
+    public:
+        using value_type = unsigned char;
+
+        static constexpr std::size_t CAPACITY = Capacity;
+
+        BoundedPayload() = default;
+
+        BoundedPayload(std::initializer_list<unsigned char> bytes) {
+            this->append(std::span<const unsigned char>(bytes.begin(), bytes.size()));
+        }
+
+        /**
+         * Appends to the payload.
+         *
+         * @param data
+         *  Must fit within the remaining capacity of the payload. Otherwise, an exception is thrown.
+         */
+        void append(std::span<const unsigned char> data) {
+            if (data.size() > (Capacity - this->payloadSize)) {
+                throw Exceptions::Exception(
+                    "AVR command frame payload exceeds maximum size (" + std::to_string(Capacity) + " bytes)"
+                );
+            }
+
+            std::copy(data.begin(), data.end(), this->bytes.begin() + this->payloadSize);
+            this->payloadSize += data.size();
+        }
+
+        void push_back(unsigned char byte) {
+            this->append(std::span<const unsigned char>(&byte, 1));
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return this->payloadSize;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return this->payloadSize == 0;
+        }
+
+        [[nodiscard]] const unsigned char* data() const {
+            return this->bytes.data();
+        }
+
+        [[nodiscard]] const unsigned char* begin() const {
+            return this->bytes.data();
+        }
+
+        [[nodiscard]] const unsigned char* end() const {
+            return this->bytes.data() + this->payloadSize;
+        }
+
+        unsigned char operator [] (std::size_t index) const {
+            return this->bytes[index];
+        }
+
+    private:
+        std::array<unsigned char, Capacity> bytes = {};
+        std::size_t payloadSize = 0;
+    };
+}
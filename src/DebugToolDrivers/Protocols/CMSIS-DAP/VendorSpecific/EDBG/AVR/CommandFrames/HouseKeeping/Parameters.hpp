@@ -28,6 +28,11 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
 
     struct Parameters
     {
+        static constexpr Parameter CONFIG_HARDWARE_VERSION{ParameterContext::CONFIG, 0x00, 1};
+        static constexpr Parameter CONFIG_FIRMWARE_MAJOR_VERSION{ParameterContext::CONFIG, 0x01, 1};
+        static constexpr Parameter CONFIG_FIRMWARE_MINOR_VERSION{ParameterContext::CONFIG, 0x02, 1};
+        static constexpr Parameter CONFIG_FIRMWARE_BUILD_NUMBER{ParameterContext::CONFIG, 0x03, 2};
+
         static constexpr Parameter USB_MAX_READ{ParameterContext::USB, 0x00, 2};
         static constexpr Parameter USB_MAX_WRITE{ParameterContext::USB, 0x01, 2};
     };
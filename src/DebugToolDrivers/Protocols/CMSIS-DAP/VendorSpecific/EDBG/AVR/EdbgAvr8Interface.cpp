@@ -1,10 +1,16 @@
 #include "EdbgAvr8Interface.hpp"
 
 #include <thread>
-#include <cmath>
+#include <numeric>
+#include <algorithm>
+#include <fstream>
+#include <filesystem>
+#include <span>
 
 #include "src/Services/PathService.hpp"
 #include "src/Services/StringService.hpp"
+#include "src/Helpers/Crc32.hpp"
+#include "src/Targets/TargetMemoryAddressRangeIndex.hpp"
 #include "src/Logger/Logger.hpp"
 
 #include "src/Exceptions/InvalidConfig.hpp"
@@ -33,6 +39,9 @@
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/SetSoftwareBreakpoints.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/ClearAllSoftwareBreakpoints.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/ClearSoftwareBreakpoints.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/SetHardwareBreakpoint.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/ClearHardwareBreakpoint.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/SetDataBreakpoint.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/EnterProgrammingMode.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/LeaveProgrammingMode.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/EraseMemory.hpp"
@@ -57,6 +66,9 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     using CommandFrames::Avr8Generic::SetSoftwareBreakpoints;
     using CommandFrames::Avr8Generic::ClearSoftwareBreakpoints;
     using CommandFrames::Avr8Generic::ClearAllSoftwareBreakpoints;
+    using CommandFrames::Avr8Generic::SetHardwareBreakpoint;
+    using CommandFrames::Avr8Generic::ClearHardwareBreakpoint;
+    using CommandFrames::Avr8Generic::SetDataBreakpoint;
     using CommandFrames::Avr8Generic::ReadMemory;
     using CommandFrames::Avr8Generic::EnterProgrammingMode;
     using CommandFrames::Avr8Generic::LeaveProgrammingMode;
@@ -74,14 +86,18 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     using Bloom::Targets::TargetState;
     using Bloom::Targets::TargetMemoryType;
     using Bloom::Targets::TargetMemoryBuffer;
+    using Bloom::Targets::TargetMemoryAddressRange;
+    using Bloom::Targets::TargetMemoryAddressRangeIndex;
     using Bloom::Targets::TargetMemoryAddress;
     using Bloom::Targets::TargetMemorySize;
     using Bloom::Targets::TargetProgramCounter;
     using Bloom::Targets::TargetRegister;
     using Bloom::Targets::TargetRegisterDescriptor;
     using Bloom::Targets::TargetRegisterDescriptors;
+    using Bloom::Targets::TargetRegisterDescriptorSelection;
     using Bloom::Targets::TargetRegisterType;
     using Bloom::Targets::TargetRegisters;
+    using Bloom::Targets::TargetRegisterSelection;
 
     EdbgAvr8Interface::EdbgAvr8Interface(EdbgInterface* edbgInterface)
         : edbgInterface(edbgInterface)
@@ -125,43 +141,61 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             this->configVariant = configVariant.value();
         }
 
-        switch (this->configVariant) {
-            case Avr8ConfigVariant::DEBUG_WIRE:
-            case Avr8ConfigVariant::MEGAJTAG: {
-                this->setDebugWireAndJtagParameters();
-                break;
-            }
-            case Avr8ConfigVariant::XMEGA: {
-                this->setPdiParameters();
-                break;
-            }
-            case Avr8ConfigVariant::UPDI: {
-                this->setUpdiParameters();
-                break;
-            }
-            default: {
-                break;
+        /*
+         * Setting each device parameter individually would cost us a command frame round trip per parameter. So we
+         * collect them, and send them in as few commands as possible.
+         */
+        this->pendingParameterValuesByKey.emplace();
+
+        try {
+            switch (this->configVariant) {
+                case Avr8ConfigVariant::DEBUG_WIRE:
+                case Avr8ConfigVariant::MEGAJTAG: {
+                    this->setDebugWireAndJtagParameters();
+                    break;
+                }
+                case Avr8ConfigVariant::XMEGA: {
+                    this->setPdiParameters();
+                    break;
+                }
+                case Avr8ConfigVariant::UPDI: {
+                    this->setUpdiParameters();
+                    break;
+                }
+                default: {
+                    break;
+                }
             }
+
+        } catch (...) {
+            this->pendingParameterValuesByKey = std::nullopt;
+            throw;
         }
+
+        this->setPendingParameters();
     }
 
     void EdbgAvr8Interface::init() {
-        if (this->configVariant == Avr8ConfigVariant::XMEGA) {
-            // Default PDI clock to 4MHz
-            // TODO: Make this adjustable via a target config parameter
-            this->setParameter(Avr8EdbgParameters::PDI_CLOCK_SPEED, static_cast<std::uint16_t>(4000));
+        const auto clockParameter = this->interfaceClockParameter();
+
+        if (clockParameter.has_value()) {
+            /*
+             * Until the interface clock has been tuned (see EdbgAvr8Interface::tuneInterfaceClock()), we use the
+             * user's clock speed, or the default (conservative) clock speed for the config variant.
+             */
+            this->setParameter(
+                *clockParameter,
+                this->interfaceClockSpeed.value_or(
+                    this->targetConfig->interfaceClockSpeed.value_or(this->interfaceClockSpeedSteps().front())
+                )
+            );
         }
 
         if (this->configVariant == Avr8ConfigVariant::UPDI) {
-            // Default UPDI clock to 1.8MHz
-            this->setParameter(Avr8EdbgParameters::PDI_CLOCK_SPEED, static_cast<std::uint16_t>(1800));
             this->setParameter(Avr8EdbgParameters::ENABLE_HIGH_VOLTAGE_UPDI, static_cast<std::uint8_t>(0));
         }
 
         if (this->configVariant == Avr8ConfigVariant::MEGAJTAG) {
-            // Default clock value for mega debugging is 200KHz
-            // TODO: Make this adjustable via a target config parameter
-            this->setParameter(Avr8EdbgParameters::MEGA_DEBUG_CLOCK, static_cast<std::uint16_t>(200));
             this->setParameter(Avr8EdbgParameters::JTAG_DAISY_CHAIN_SETTINGS, static_cast<std::uint32_t>(0));
         }
 
@@ -230,6 +264,19 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             throw Avr8CommandFailure("AVR8 Step target command failed", responseFrame);
         }
 
+        /*
+         * Most steps complete within microseconds, so the BREAK event is usually queued on the tool by the time we
+         * ask for it. Waiting for it here means the TargetController doesn't have to wait for its next poll to find
+         * out that the target has stopped.
+         *
+         * If the step takes longer (e.g. stepping over a SLEEP instruction), we leave the event for
+         * refreshTargetState() to pick up.
+         */
+        if (this->waitForAvrEvent<BreakEvent>(EdbgAvr8Interface::STEP_BREAK_EVENT_TIMEOUT) != nullptr) {
+            this->targetState = TargetState::STOPPED;
+            return;
+        }
+
         this->targetState = TargetState::RUNNING;
     }
 
@@ -254,10 +301,50 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          * Issuing another command immediately after reset sometimes results in an 'illegal target state' error from
          * the EDBG debug tool. Even though we waited for the break event.
          *
-         * All we can really do here is introduce a small delay, to ensure that we're not issuing commands too quickly
-         * after reset.
+         * So we probe the tool until it accepts commands again.
          */
-        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        this->waitForTargetReadiness();
+    }
+
+    void EdbgAvr8Interface::waitForTargetReadiness() {
+        const auto deadline = std::chrono::steady_clock::now() + EdbgAvr8Interface::TARGET_READINESS_TIMEOUT;
+        auto retryDelay = EdbgAvr8Interface::TARGET_READINESS_INITIAL_RETRY_DELAY;
+        auto attempts = std::size_t(0);
+
+        while (true) {
+            ++attempts;
+
+            /*
+             * Reading the program counter has no side effects, and the target is stopped at this point, so the
+             * command can only fail if the tool isn't ready.
+             */
+            const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+                GetProgramCounter()
+            );
+
+            if (responseFrame.id != Avr8ResponseId::FAILED) {
+                if (attempts > 1) {
+                    Logger::debug("AVR8 target ready after " + std::to_string(attempts) + " readiness probe(s)");
+                }
+
+                return;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                // Give up - if the tool still isn't ready, the next command will report the failure
+                Logger::debug("AVR8 target readiness probe timed out");
+                return;
+            }
+
+            std::this_thread::sleep_for(
+                std::min(
+                    retryDelay,
+                    std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now)
+                )
+            );
+            retryDelay = std::min(retryDelay * 2, EdbgAvr8Interface::TARGET_READINESS_MAXIMUM_RETRY_DELAY);
+        }
     }
 
     void EdbgAvr8Interface::activate() {
@@ -266,6 +353,12 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
                 this->activatePhysical();
 
             } catch (const Avr8CommandFailure& activationException) {
+                /*
+                 * The caller may go on to access the target via other means (such as the ISP interface), before
+                 * retrying. We can no longer be sure of what parameters the tool holds.
+                 */
+                this->parameterValuesByKey.clear();
+
                 if (
                     this->targetConfig->physicalInterface == PhysicalInterface::DEBUG_WIRE
                     && (
@@ -287,6 +380,15 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         if (!this->targetAttached) {
             this->attach();
         }
+
+        if (
+            !this->interfaceClockSpeed.has_value()
+            && this->interfaceClockParameter().has_value()
+            && this->targetParameters.flashStartAddress.has_value()
+            && this->targetParameters.flashSize.has_value()
+        ) {
+            this->tuneInterfaceClock();
+        }
     }
 
     void EdbgAvr8Interface::deactivate() {
@@ -388,27 +490,154 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         return responseFrame.extractSignature(this->targetConfig->physicalInterface);
     }
 
-    void EdbgAvr8Interface::setBreakpoint(TargetMemoryAddress address) {
+    void EdbgAvr8Interface::setSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        if (addresses.empty()) {
+            return;
+        }
+
+        const auto addressSpan = std::span<const TargetMemoryAddress>(addresses);
+
+        // The SetSoftwareBreakpoints command frame has a fixed capacity - we may need more than one
+        for (
+            auto offset = std::size_t(0);
+            offset < addressSpan.size();
+            offset += SetSoftwareBreakpoints::MAXIMUM_ADDRESS_COUNT
+        ) {
+            const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+                SetSoftwareBreakpoints(addressSpan.subspan(
+                    offset,
+                    std::min(SetSoftwareBreakpoints::MAXIMUM_ADDRESS_COUNT, addressSpan.size() - offset)
+                ))
+            );
+
+            if (responseFrame.id == Avr8ResponseId::FAILED) {
+                throw Avr8CommandFailure("AVR8 Set software breakpoint command failed", responseFrame);
+            }
+        }
+    }
+
+    void EdbgAvr8Interface::clearSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        if (addresses.empty()) {
+            return;
+        }
+
+        const auto addressSpan = std::span<const TargetMemoryAddress>(addresses);
+
+        // The ClearSoftwareBreakpoints command frame has a fixed capacity - we may need more than one
+        for (
+            auto offset = std::size_t(0);
+            offset < addressSpan.size();
+            offset += ClearSoftwareBreakpoints::MAXIMUM_ADDRESS_COUNT
+        ) {
+            const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+                ClearSoftwareBreakpoints(addressSpan.subspan(
+                    offset,
+                    std::min(ClearSoftwareBreakpoints::MAXIMUM_ADDRESS_COUNT, addressSpan.size() - offset)
+                ))
+            );
+
+            if (responseFrame.id == Avr8ResponseId::FAILED) {
+                throw Avr8CommandFailure("AVR8 Clear software breakpoint command failed", responseFrame);
+            }
+        }
+    }
+
+    std::uint16_t EdbgAvr8Interface::getHardwareBreakpointCount() {
+        /*
+         * The number of program breakpoint comparators available to us depends on the debug interface. debugWire
+         * targets have a single comparator, the (mega) JTAG OCD has three, and the PDI/UPDI OCDs have two.
+         */
+        switch (this->configVariant) {
+            case Avr8ConfigVariant::DEBUG_WIRE: {
+                return 1;
+            }
+            case Avr8ConfigVariant::MEGAJTAG: {
+                return 3;
+            }
+            case Avr8ConfigVariant::XMEGA:
+            case Avr8ConfigVariant::UPDI: {
+                return 2;
+            }
+            default: {
+                return 0;
+            }
+        }
+    }
+
+    void EdbgAvr8Interface::setHardwareBreakpoint(std::uint16_t index, TargetMemoryAddress address) {
+        // EDBG hardware breakpoint numbers start from 1
+        const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+            SetHardwareBreakpoint(static_cast<std::uint8_t>(index + 1), address)
+        );
+
+        if (responseFrame.id == Avr8ResponseId::FAILED) {
+            throw Avr8CommandFailure("AVR8 Set hardware breakpoint command failed", responseFrame);
+        }
+
+        this->activeHardwareBreakpointIndices.insert(index);
+    }
+
+    void EdbgAvr8Interface::clearHardwareBreakpoint(std::uint16_t index) {
         const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
-            SetSoftwareBreakpoints({address})
+            ClearHardwareBreakpoint(static_cast<std::uint8_t>(index + 1))
         );
 
         if (responseFrame.id == Avr8ResponseId::FAILED) {
-            throw Avr8CommandFailure("AVR8 Set software breakpoint command failed", responseFrame);
+            throw Avr8CommandFailure("AVR8 Clear hardware breakpoint command failed", responseFrame);
+        }
+
+        this->activeHardwareBreakpointIndices.erase(index);
+    }
+
+    std::uint16_t EdbgAvr8Interface::getDataBreakpointCount() {
+        /*
+         * debugWire targets have no data comparators. On the (mega) JTAG OCD, only one of the three comparators can
+         * be configured for data access. The PDI and UPDI OCDs allow both of their comparators to be used for data
+         * access.
+         */
+        switch (this->configVariant) {
+            case Avr8ConfigVariant::MEGAJTAG: {
+                return 1;
+            }
+            case Avr8ConfigVariant::XMEGA:
+            case Avr8ConfigVariant::UPDI: {
+                return 2;
+            }
+            default: {
+                return 0;
+            }
         }
     }
 
-    void EdbgAvr8Interface::clearBreakpoint(TargetMemoryAddress address) {
+    void EdbgAvr8Interface::setDataBreakpoint(
+        std::uint16_t index,
+        TargetMemoryAddress address,
+        Targets::TargetWatchpointType type
+    ) {
+        // Data breakpoints share numbering with hardware breakpoints, which start from 1
         const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
-            ClearSoftwareBreakpoints({address})
+            SetDataBreakpoint(static_cast<std::uint8_t>(index + 1), address, type)
         );
 
         if (responseFrame.id == Avr8ResponseId::FAILED) {
-            throw Avr8CommandFailure("AVR8 Clear software breakpoint command failed", responseFrame);
+            throw Avr8CommandFailure("AVR8 Set data breakpoint command failed", responseFrame);
         }
+
+        // This allows EdbgAvr8Interface::clearAllBreakpoints() to clear data breakpoints too
+        this->activeHardwareBreakpointIndices.insert(index);
+    }
+
+    void EdbgAvr8Interface::clearDataBreakpoint(std::uint16_t index) {
+        this->clearHardwareBreakpoint(index);
     }
 
     void EdbgAvr8Interface::clearAllBreakpoints() {
+        // The "Software Breakpoint Clear All" command doesn't touch hardware breakpoints
+        const auto hardwareBreakpointIndices = this->activeHardwareBreakpointIndices;
+        for (const auto index : hardwareBreakpointIndices) {
+            this->clearHardwareBreakpoint(index);
+        }
+
         const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
             ClearAllSoftwareBreakpoints()
         );
@@ -418,39 +647,29 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
     }
 
-    TargetRegisters EdbgAvr8Interface::readRegisters(const TargetRegisterDescriptors& descriptors) {
+    void EdbgAvr8Interface::readRegisters(TargetRegisterDescriptorSelection descriptors, TargetRegisters& output) {
         /*
          * This function needs to be fast. Insight eagerly requests the values of all known registers that it can
          * present to the user. It does this on numerous occasions (target stopped, user clicked refresh, etc). This
          * means we will be frequently loading over 100 register values in a single instance.
          *
          * For the above reason, we do not read each register value individually. That would take far too long if we
-         * have over 100 registers to read. Instead, we group the register descriptors into collections by register
-         * type, and resolve the address range for each collection. We then perform a single read operation for
-         * each collection and hold the memory buffer in a random access container (std::vector). Finally, we extract
-         * the data for each register descriptor, from the memory buffer, and construct the relevant TargetRegister
-         * object.
-         *
-         * TODO: We should be grouping the register descriptors by memory type, as opposed to register type. This
-         *       isn't much of a problem ATM, as currently, we only work with registers that are stored in the data
-         *       address space or the register file. This will need to be addressed before we can work with any other
-         *       registers stored elsewhere.
+         * have over 100 registers to read. Instead, we group the register descriptors by memory type, and read the
+         * address ranges of each group via EdbgAvr8Interface::readMemoryRanges(). That function merges nearby ranges
+         * and sends all of the reads in a single batch. Finally, we construct the relevant TargetRegister objects
+         * from the buffers it returns.
          */
-        auto output = TargetRegisters();
+        struct RegisterReadGroup
+        {
+            std::vector<const TargetRegisterDescriptor*> descriptors;
+            std::vector<TargetMemoryAddressRange> addressRanges;
+        };
 
-        // Group descriptors by type and resolve the address range for each type
-        auto descriptorsByType = std::map<TargetRegisterType, std::set<const TargetRegisterDescriptor*>>();
+        auto groupsByMemoryType = std::map<Avr8MemoryType, RegisterReadGroup>();
 
-        /*
-         * An address range is just an std::pair of addresses - the first being the start address, the second being
-         * the end address.
-         *
-         * TODO: Can't we just use the TargetMemoryAddressRange struct here? Review
-         */
-        using AddressRange = std::pair<TargetMemoryAddress, TargetMemoryAddress>;
-        auto addressRangeByType = std::map<TargetRegisterType, AddressRange>();
+        for (const auto* descriptorPtr : descriptors) {
+            const auto& descriptor = *descriptorPtr;
 
-        for (const auto& descriptor : descriptors) {
             if (!descriptor.startAddress.has_value()) {
                 Logger::debug(
                     "Attempted to read register in the absence of a start address - register name: "
@@ -459,46 +678,21 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
                 continue;
             }
 
-            descriptorsByType[descriptor.type].insert(&descriptor);
+            const auto memoryType = (descriptor.type != TargetRegisterType::GENERAL_PURPOSE_REGISTER) ?
+                Avr8MemoryType::SRAM
+                : (this->configVariant == Avr8ConfigVariant::XMEGA || this->configVariant == Avr8ConfigVariant::UPDI
+                ? Avr8MemoryType::REGISTER_FILE : Avr8MemoryType::SRAM);
 
             const auto startAddress = descriptor.startAddress.value();
-            const auto endAddress = startAddress + (descriptor.size - 1);
-
-            const auto addressRangeit = addressRangeByType.find(descriptor.type);
-
-            if (addressRangeit == addressRangeByType.end()) {
-                addressRangeByType[descriptor.type] = AddressRange(startAddress, endAddress);
-
-            } else {
-                auto& addressRange = addressRangeit->second;
 
-                if (startAddress < addressRange.first) {
-                    addressRange.first = startAddress;
-                }
-
-                if (endAddress > addressRange.second) {
-                    addressRange.second = endAddress;
-                }
-            }
+            auto& group = groupsByMemoryType[memoryType];
+            group.descriptors.push_back(descriptorPtr);
+            group.addressRanges.emplace_back(startAddress, startAddress + (descriptor.size - 1));
         }
 
-        /*
-         * Now that we have our address ranges and grouped descriptors, we can perform a single read call for each
-         * register type.
-         */
-        for (const auto&[registerType, descriptors] : descriptorsByType) {
-            const auto& addressRange = addressRangeByType[registerType];
-            const auto startAddress = addressRange.first;
-            const auto endAddress = addressRange.second;
-            const auto bufferSize = (endAddress - startAddress) + 1;
-
-            const auto memoryType = (registerType != TargetRegisterType::GENERAL_PURPOSE_REGISTER) ?
-                Avr8MemoryType::SRAM
-                : (this->configVariant == Avr8ConfigVariant::XMEGA || this->configVariant == Avr8ConfigVariant::UPDI
-                ? Avr8MemoryType::REGISTER_FILE : Avr8MemoryType::SRAM);
-
+        for (const auto& [memoryType, group] : groupsByMemoryType) {
             /*
-             * When reading the entire range, we must avoid any attempts to access the OCD data register (OCDDR), as
+             * When reading the merged ranges, we must avoid any attempts to access the OCD data register (OCDDR), as
              * the debug tool will reject the command and respond with a 0x36 error code (invalid address error).
              *
              * For this reason, we specify the OCDDR address as an excluded address. This will mean
@@ -526,66 +720,72 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
                 );
             }
 
-            const auto flatMemoryBuffer = this->readMemory(
-                memoryType,
-                startAddress,
-                bufferSize,
-                excludedAddresses
-            );
+            const auto buffers = this->readMemoryRanges(memoryType, group.addressRanges, excludedAddresses);
 
-            if (flatMemoryBuffer.size() != bufferSize) {
-                throw Exception(
-                    "Failed to read memory within register type address range (" + std::to_string(startAddress)
-                        + " - " + std::to_string(endAddress) + "). Expected " + std::to_string(bufferSize)
-                        + " bytes, got " + std::to_string(flatMemoryBuffer.size())
-                );
-            }
+            for (auto i = std::size_t(0); i < group.descriptors.size(); ++i) {
+                const auto& descriptor = *(group.descriptors[i]);
+                const auto& buffer = buffers[i];
+
+                if (buffer.size() != descriptor.size) {
+                    throw Exception(
+                        "Failed to read memory for register at address " + std::to_string(
+                            descriptor.startAddress.value()
+                        ) + ". Expected " + std::to_string(descriptor.size) + " bytes, got "
+                            + std::to_string(buffer.size())
+                    );
+                }
 
-            // Construct our TargetRegister objects directly from the flat memory buffer
-            for (const auto& descriptor : descriptors) {
                 /*
                  * Multibyte AVR8 registers are stored in LSB form.
                  *
-                 * This is why we use reverse iterators when extracting our data from flatMemoryBuffer. Doing so allows
+                 * This is why we use reverse iterators when extracting our data from the buffer. Doing so allows
                  * us to extract the data in MSB form (as is expected for all register values held in TargetRegister
                  * objects).
                  */
-                const auto bufferStartIt = flatMemoryBuffer.rend() - (descriptor->startAddress.value() - startAddress)
-                    - descriptor->size;
-
                 output.emplace_back(
-                    TargetRegister(
-                        *descriptor,
-                        TargetMemoryBuffer(bufferStartIt, bufferStartIt + descriptor->size)
-                    )
+                    descriptor,
+                    TargetMemoryBuffer(buffer.rbegin(), buffer.rend())
                 );
             }
         }
-
-        return output;
     }
 
-    void EdbgAvr8Interface::writeRegisters(const Targets::TargetRegisters& registers) {
-        for (const auto& reg : registers) {
-            const auto& registerDescriptor = reg.descriptor;
-            auto registerValue = reg.value;
+    void EdbgAvr8Interface::writeRegisters(TargetRegisterSelection registers) {
+        /*
+         * Writing each register individually would cost a round trip per register, which adds up when GDB writes
+         * all registers in one go. Instead, we sort the registers by memory type and address, and merge the values
+         * of adjacent registers into write spans. Each span is written via a single command frame (or as few as the
+         * maximum access size allows), and all frames are sent in a single pipelined batch.
+         *
+         * We only merge registers that are directly adjacent (or overlapping) - we never fill gaps between
+         * registers, as writing to an IO register that wasn't requested could have side effects.
+         */
+        struct RegisterWrite
+        {
+            Avr8MemoryType memoryType;
+            TargetMemoryAddress startAddress;
+            const TargetRegister* reg;
+        };
+
+        auto registerWrites = std::vector<RegisterWrite>();
+        registerWrites.reserve(registers.size());
+
+        for (const auto* reg : registers) {
+            const auto& registerDescriptor = reg->descriptor;
 
-            if (registerValue.empty()) {
+            if (reg->value.empty()) {
                 throw Exception("Cannot write empty register value");
             }
 
-            if (registerValue.size() > registerDescriptor.size) {
+            if (reg->value.size() > registerDescriptor.size) {
                 throw Exception("Register value exceeds size specified by register descriptor.");
             }
 
-            if (registerValue.size() < registerDescriptor.size) {
-                // Fill the missing most-significant bytes with 0x00
-                registerValue.insert(registerValue.begin(), registerDescriptor.size - registerValue.size(), 0x00);
-            }
-
-            if (registerValue.size() > 1) {
-                // AVR8 registers are stored in LSB
-                std::reverse(registerValue.begin(), registerValue.end());
+            if (!registerDescriptor.startAddress.has_value()) {
+                throw Exception(
+                    "Cannot write register in the absence of a start address - register name: "
+                        + registerDescriptor.name.value_or("unknown")
+                );
             }
 
             auto memoryType = Avr8MemoryType::SRAM;
@@ -596,13 +796,98 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
                 memoryType = Avr8MemoryType::REGISTER_FILE;
             }
 
-            // TODO: This can be inefficient when updating many registers, maybe do something a little smarter here.
-            this->writeMemory(
-                memoryType,
-                registerDescriptor.startAddress.value(),
-                registerValue
+            registerWrites.emplace_back(RegisterWrite{
+                .memoryType = memoryType,
+                .startAddress = *(registerDescriptor.startAddress),
+                .reg = reg,
+            });
+        }
+
+        // Stable, so that if the same register is written more than once, the last value wins
+        std::stable_sort(
+            registerWrites.begin(),
+            registerWrites.end(),
+            [] (const RegisterWrite& writeA, const RegisterWrite& writeB) {
+                return writeA.memoryType != writeB.memoryType
+                    ? writeA.memoryType < writeB.memoryType
+                    : writeA.startAddress < writeB.startAddress;
+            }
+        );
+
+        struct WriteSpan
+        {
+            Avr8MemoryType memoryType;
+            TargetMemoryAddress startAddress;
+
+            /**
+             * The span's data, in spanData.
+             */
+            std::size_t dataOffset;
+            TargetMemorySize size;
+        };
+
+        // The data for all spans is held in a single buffer
+        auto spanData = TargetMemoryBuffer();
+        auto spans = std::vector<WriteSpan>();
+
+        for (const auto& registerWrite : registerWrites) {
+            const auto registerSize = registerWrite.reg->descriptor.size;
+
+            if (
+                spans.empty()
+                || spans.back().memoryType != registerWrite.memoryType
+                || registerWrite.startAddress > spans.back().startAddress + spans.back().size
+            ) {
+                spans.emplace_back(WriteSpan{
+                    .memoryType = registerWrite.memoryType,
+                    .startAddress = registerWrite.startAddress,
+                    .dataOffset = spanData.size(),
+                    .size = 0,
+                });
+            }
+
+            auto& span = spans.back();
+            const auto registerOffset = registerWrite.startAddress - span.startAddress;
+            span.size = std::max(span.size, static_cast<TargetMemorySize>(registerOffset + registerSize));
+            spanData.resize(span.dataOffset + span.size, 0x00);
+
+            /*
+             * AVR8 registers are stored in LSB form, so we reverse the value. Any missing most-significant bytes are
+             * filled with 0x00.
+             */
+            const auto registerData = spanData.begin() + static_cast<std::ptrdiff_t>(
+                span.dataOffset + registerOffset
             );
+            const auto& value = registerWrite.reg->value;
+            std::fill(std::copy(value.rbegin(), value.rend(), registerData), registerData + registerSize, 0x00);
+        }
+
+        auto commandFrames = std::vector<WriteMemory>();
+        commandFrames.reserve(spans.size());
+
+        for (const auto& span : spans) {
+            const auto maximumWriteSize = this->maximumMemoryAccessSize(span.memoryType).value_or(span.size);
+
+            for (auto bytesQueued = TargetMemorySize(0); bytesQueued < span.size; bytesQueued += maximumWriteSize) {
+                commandFrames.emplace_back(
+                    span.memoryType,
+                    span.startAddress + bytesQueued,
+                    std::span<const unsigned char>(
+                        spanData.data() + span.dataOffset + bytesQueued,
+                        std::min(static_cast<TargetMemorySize>(span.size - bytesQueued), maximumWriteSize)
+                    )
+                );
+            }
         }
+
+        this->edbgInterface->sendAvrCommandFramesAndProcessResponseFrames(
+            commandFrames,
+            [] (const WriteMemory::ExpectedResponseFrameType& responseFrame, std::size_t) {
+                if (responseFrame.id == Avr8ResponseId::FAILED) {
+                    throw Avr8CommandFailure("AVR8 Write memory command failed", responseFrame);
+                }
+            }
+        );
     }
 
     TargetMemoryBuffer EdbgAvr8Interface::readMemory(
@@ -615,177 +900,167 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             throw Exception("Cannot access RAM when programming mode is enabled");
         }
 
-        auto avr8MemoryType = Avr8MemoryType::SRAM;
-
-        switch (memoryType) {
-            case TargetMemoryType::RAM: {
-                avr8MemoryType = Avr8MemoryType::SRAM;
-                break;
-            }
-            case TargetMemoryType::FLASH: {
-                if (
-                    this->configVariant == Avr8ConfigVariant::DEBUG_WIRE
-                    || this->configVariant == Avr8ConfigVariant::UPDI
-                ) {
-                    avr8MemoryType = Avr8MemoryType::FLASH_PAGE;
-
-                } else if (this->configVariant == Avr8ConfigVariant::MEGAJTAG) {
-                    avr8MemoryType = this->programmingModeEnabled ? Avr8MemoryType::FLASH_PAGE : Avr8MemoryType::SPM;
-
-                } else if (this->configVariant == Avr8ConfigVariant::XMEGA) {
-                    const auto bootSectionStartAddress = this->targetParameters.bootSectionStartAddress.value();
-                    if (startAddress >= bootSectionStartAddress) {
-                        avr8MemoryType = Avr8MemoryType::BOOT_FLASH;
-
-                        /*
-                         * When using the BOOT_FLASH memory type, the address should be relative to the start of the
-                         * boot section.
-                         */
-                        startAddress -= bootSectionStartAddress;
-
-                    } else {
-                        /*
-                         * When using the APPL_FLASH memory type, the address should be relative to the start of the
-                         * application section.
-                         */
-                        startAddress -= this->targetParameters.appSectionStartAddress.value();
-                        avr8MemoryType = Avr8MemoryType::APPL_FLASH;
-                    }
-                }
-                break;
-            }
-            case TargetMemoryType::EEPROM: {
-                // For JTAG targets, we must use the EEPROM_PAGE memory type when in programming mode.
-                avr8MemoryType = (this->configVariant == Avr8ConfigVariant::MEGAJTAG && this->programmingModeEnabled)
-                    ? Avr8MemoryType::EEPROM_PAGE
-                    : Avr8MemoryType::EEPROM;
-
-                if (this->configVariant == Avr8ConfigVariant::XMEGA) {
-                    // EEPROM addresses should be in relative form, for XMEGA (PDI) targets
-                    startAddress -= this->targetParameters.eepromStartAddress.value();
-                }
-                break;
-            }
-            case TargetMemoryType::FUSES: {
-                avr8MemoryType = Avr8MemoryType::FUSES;
-                break;
-            }
-            default: {
-                break;
-            }
-        }
+        const auto [avr8MemoryType, avr8StartAddress] = this->resolveReadMemoryType(memoryType, startAddress);
 
         /*
          * The internal readMemory() function accepts excluded addresses in the form of a set of addresses, as
          * opposed to a set of address ranges.
          *
-         * We will perform the conversion here.
+         * We will perform the conversion here. Only the parts of the excluded ranges that fall within the range
+         * from which we will be reading are converted - projects can have hundreds of excluded ranges, and reads are
+         * often split into chunks, so converting every range in its entirety, for every read, adds up.
          */
         auto excludedAddresses = std::set<TargetMemoryAddress>();
-        auto endAddress = startAddress + bytes - 1;
 
-        for (const auto& addressRange : excludedAddressRanges) {
-            if (addressRange.startAddress > endAddress) {
-                // This address range is outside of the range from which we will be reading
-                continue;
-            }
+        if (!excludedAddressRanges.empty()) {
+            const auto readAddressRange = TargetMemoryAddressRange(avr8StartAddress, avr8StartAddress + bytes - 1);
 
-            for (auto i = addressRange.startAddress; i <= addressRange.endAddress; i++) {
-                excludedAddresses.insert(i);
-            }
+            TargetMemoryAddressRangeIndex(excludedAddressRanges).forEachIntersecting(
+                readAddressRange,
+                [&excludedAddresses, &readAddressRange] (const TargetMemoryAddressRange& addressRange, std::size_t) {
+                    const auto startAddress = std::max(addressRange.startAddress, readAddressRange.startAddress);
+                    const auto endAddress = std::min(addressRange.endAddress, readAddressRange.endAddress);
+
+                    for (auto address = startAddress; address <= endAddress; ++address) {
+                        excludedAddresses.insert(excludedAddresses.end(), address);
+                    }
+                }
+            );
         }
 
-        return this->readMemory(avr8MemoryType, startAddress, bytes, excludedAddresses);
+        return this->readMemory(avr8MemoryType, avr8StartAddress, bytes, excludedAddresses);
     }
 
-    void EdbgAvr8Interface::writeMemory(
+    std::vector<TargetMemoryBuffer> EdbgAvr8Interface::readMemoryRanges(
         TargetMemoryType memoryType,
-        TargetMemoryAddress startAddress,
-        const TargetMemoryBuffer& buffer
+        const std::vector<TargetMemoryAddressRange>& addressRanges
     ) {
-        auto avr8MemoryType = Avr8MemoryType::SRAM;
+        if (this->programmingModeEnabled && memoryType == TargetMemoryType::RAM) {
+            throw Exception("Cannot access RAM when programming mode is enabled");
+        }
 
-        switch (memoryType) {
-            case TargetMemoryType::RAM: {
-                avr8MemoryType = Avr8MemoryType::SRAM;
-                break;
-            }
-            case TargetMemoryType::FLASH: {
-                if (
-                    this->configVariant == Avr8ConfigVariant::DEBUG_WIRE
-                    || this->configVariant == Avr8ConfigVariant::UPDI
-                    || this->configVariant == Avr8ConfigVariant::MEGAJTAG
-                ) {
-                    avr8MemoryType = Avr8MemoryType::FLASH_PAGE;
+        /*
+         * Address ranges can map to different Avr8MemoryTypes (e.g. the APPL_FLASH and BOOT_FLASH memory types for
+         * XMEGA targets), so we group them by type and perform the reads for each group separately.
+         */
+        auto rangeIndicesByType = std::map<Avr8MemoryType, std::vector<std::size_t>>();
+        auto resolvedRanges = std::vector<TargetMemoryAddressRange>();
+        resolvedRanges.reserve(addressRanges.size());
 
-                } else if (this->configVariant == Avr8ConfigVariant::XMEGA) {
-                    const auto bootSectionStartAddress = this->targetParameters.bootSectionStartAddress.value();
-                    if (startAddress >= bootSectionStartAddress) {
-                        avr8MemoryType = Avr8MemoryType::BOOT_FLASH;
-
-                        /*
-                         * When using the BOOT_FLASH memory type, the address should be relative to the start of the
-                         * boot section.
-                         */
-                        startAddress -= bootSectionStartAddress;
-
-                    } else {
-                        /*
-                         * When using the APPL_FLASH memory type, the address should be relative to the start of the
-                         * application section.
-                         */
-                        startAddress -= this->targetParameters.appSectionStartAddress.value();
-                        avr8MemoryType = Avr8MemoryType::APPL_FLASH;
-                    }
-                }
-                break;
-            }
-            case TargetMemoryType::EEPROM: {
-                switch (this->configVariant) {
-                    case Avr8ConfigVariant::UPDI:
-                    case Avr8ConfigVariant::XMEGA: {
-                        avr8MemoryType = Avr8MemoryType::EEPROM_ATOMIC;
+        for (auto rangeIndex = std::size_t(0); rangeIndex < addressRanges.size(); ++rangeIndex) {
+            const auto& addressRange = addressRanges[rangeIndex];
+            const auto [avr8MemoryType, startAddress] = this->resolveReadMemoryType(
+                memoryType,
+                addressRange.startAddress
+            );
 
-                        if (this->configVariant == Avr8ConfigVariant::XMEGA) {
-                            // EEPROM addresses should be in relative form, for XMEGA (PDI) targets
-                            startAddress -= this->targetParameters.eepromStartAddress.value();
-                        }
+            resolvedRanges.emplace_back(
+                startAddress,
+                startAddress + (addressRange.endAddress - addressRange.startAddress)
+            );
+            rangeIndicesByType[avr8MemoryType].push_back(rangeIndex);
+        }
 
-                        break;
-                    }
-                    case Avr8ConfigVariant::MEGAJTAG: {
-                        avr8MemoryType = this->programmingModeEnabled
-                            ? Avr8MemoryType::EEPROM_PAGE
-                            : Avr8MemoryType::EEPROM;
-                        break;
-                    }
-                    default: {
-                        avr8MemoryType = Avr8MemoryType::EEPROM;
-                        break;
-                    }
-                }
-                break;
+        auto output = std::vector<TargetMemoryBuffer>(addressRanges.size());
+
+        for (const auto& [avr8MemoryType, rangeIndices] : rangeIndicesByType) {
+            auto typeRanges = std::vector<TargetMemoryAddressRange>();
+            typeRanges.reserve(rangeIndices.size());
+
+            for (const auto rangeIndex : rangeIndices) {
+                typeRanges.push_back(resolvedRanges[rangeIndex]);
             }
-            case TargetMemoryType::FUSES: {
-                avr8MemoryType = Avr8MemoryType::FUSES;
-                break;
+
+            auto buffers = this->readMemoryRanges(avr8MemoryType, typeRanges);
+
+            for (auto i = std::size_t(0); i < rangeIndices.size(); ++i) {
+                output[rangeIndices[i]] = std::move(buffers[i]);
             }
-            default: {
-                break;
+        }
+
+        return output;
+    }
+
+    void EdbgAvr8Interface::writeMemory(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        const TargetMemoryBuffer& buffer
+    ) {
+        const auto [avr8MemoryType, avr8StartAddress] = this->resolveWriteMemoryType(memoryType, startAddress);
+        return this->writeMemory(avr8MemoryType, avr8StartAddress, buffer);
+    }
+
+    std::uint32_t EdbgAvr8Interface::computeMemoryCrc(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes
+    ) {
+        auto crc = Crc32::INITIAL_VALUE;
+        const auto endAddress = startAddress + bytes;
+
+        /*
+         * On XMEGA targets, the application and boot sections are accessed via different memory types, so a read
+         * cannot span both sections.
+         */
+        const auto sectionBoundary = memoryType == TargetMemoryType::FLASH
+            && this->configVariant == Avr8ConfigVariant::XMEGA
+                ? this->targetParameters.bootSectionStartAddress
+                : std::nullopt;
+
+        auto address = startAddress;
+        while (address < endAddress) {
+            auto blockEndAddress = std::min(
+                static_cast<TargetMemoryAddress>(address + EdbgAvr8Interface::MEMORY_CRC_BLOCK_SIZE),
+                endAddress
+            );
+
+            if (sectionBoundary.has_value() && address < *sectionBoundary && blockEndAddress > *sectionBoundary) {
+                blockEndAddress = *sectionBoundary;
             }
+
+            const auto block = this->readMemory(memoryType, address, blockEndAddress - address);
+            crc = Crc32::update(crc, block);
+
+            address = blockEndAddress;
         }
 
-        return this->writeMemory(avr8MemoryType, startAddress, buffer);
+        return crc;
     }
 
     void EdbgAvr8Interface::eraseProgramMemory(std::optional<Avr8Bit::ProgramMemorySection> section) {
         if (this->configVariant == Avr8ConfigVariant::DEBUG_WIRE) {
-            // The EDBG erase command does not work on debugWire targets - we'll just write to the memory instead
-            return this->writeMemory(
-                TargetMemoryType::FLASH,
-                this->targetParameters.flashStartAddress.value(),
-                TargetMemoryBuffer(this->targetParameters.flashSize.value(), 0xFF)
-            );
+            /*
+             * The EDBG erase command does not work on debugWire targets - we'll just write to the memory instead.
+             *
+             * Reading flash is much cheaper than writing to it, so we only write to the pages that aren't already
+             * erased.
+             */
+            const auto flashStartAddress = this->targetParameters.flashStartAddress.value();
+            const auto flashSize = this->targetParameters.flashSize.value();
+            const auto pageSize = static_cast<TargetMemorySize>(this->targetParameters.flashPageSize.value());
+
+            const auto flashContents = this->readMemory(TargetMemoryType::FLASH, flashStartAddress, flashSize);
+            const auto erasedPage = TargetMemoryBuffer(pageSize, 0xFF);
+            auto pagesErased = std::size_t(0);
+
+            for (auto offset = TargetMemorySize(0); offset < flashSize; offset += pageSize) {
+                const auto pageEnd = flashContents.begin() + std::min(offset + pageSize, flashSize);
+                const auto pageErased = std::all_of(
+                    flashContents.begin() + offset,
+                    pageEnd,
+                    [] (unsigned char byte) {
+                        return byte == 0xFF;
+                    }
+                );
+
+                if (!pageErased) {
+                    this->writeMemory(TargetMemoryType::FLASH, flashStartAddress + offset, erasedPage);
+                    ++pagesErased;
+                }
+            }
+
+            Logger::debug("Erased " + std::to_string(pagesErased) + " flash page(s)");
+            return;
         }
 
         if (this->configVariant == Avr8ConfigVariant::XMEGA) {
@@ -818,8 +1093,10 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
 
         /*
-         * For JTAG and UPDI targets, the erase command can only erase the entire chip (including EEPROM). This
-         * violates the Avr8DebugInterface contract - as this member function should only ever erase program memory.
+         * For JTAG and UPDI targets, the only erase command we can use to erase the program memory in full is a chip
+         * erase (which includes EEPROM). Individual UPDI flash pages can be erased, where the debug tool supports it
+         * (see EdbgAvr8Interface::eraseAndWriteFlashPage()), but that's of no use here. The chip erase violates the
+         * Avr8DebugInterface contract - as this member function should only ever erase program memory.
          *
          * All we can do here is take a copy of EEPROM and restore it after the erase operation.
          *
@@ -857,6 +1134,29 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
     }
 
+    bool EdbgAvr8Interface::programMemoryPageRewritesSupported() {
+        return
+            this->configVariant == Avr8ConfigVariant::DEBUG_WIRE
+            || this->configVariant == Avr8ConfigVariant::XMEGA
+            || (this->configVariant == Avr8ConfigVariant::UPDI && this->updiPageEraseSupported.value_or(true))
+        ;
+    }
+
+    bool EdbgAvr8Interface::eepromPageWritesSupported() {
+        return
+            this->configVariant == Avr8ConfigVariant::UPDI
+            || this->configVariant == Avr8ConfigVariant::XMEGA
+            || (this->configVariant == Avr8ConfigVariant::MEGAJTAG && this->programmingModeEnabled)
+        ;
+    }
+
+    bool EdbgAvr8Interface::runtimeMemoryAccessSupported() {
+        return
+            this->configVariant == Avr8ConfigVariant::UPDI
+            || this->configVariant == Avr8ConfigVariant::XMEGA
+        ;
+    }
+
     TargetState EdbgAvr8Interface::getTargetState() {
         /*
          * We are not informed when a target goes from a stopped state to a running state, so there is no need
@@ -1011,18 +1311,118 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     void EdbgAvr8Interface::setParameter(const Avr8EdbgParameter& parameter, const std::vector<unsigned char>& value) {
         using Services::StringService;
 
+        const auto parameterKey = std::pair(parameter.context, parameter.id);
+        const auto currentValueIt = this->parameterValuesByKey.find(parameterKey);
+
+        if (currentValueIt != this->parameterValuesByKey.end() && currentValueIt->second == value) {
+            return;
+        }
+
+        if (this->pendingParameterValuesByKey.has_value()) {
+            (*this->pendingParameterValuesByKey)[parameterKey] = value;
+            return;
+        }
+
         const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
             SetParameter(parameter, value)
         );
 
-        Logger::debug(
-            "Setting AVR8 EDBG parameter (context: 0x" + StringService::toHex(parameter.context) + ", id: 0x"
-                + StringService::toHex(parameter.id) + ", value: 0x" + StringService::toHex(value) + ")"
-        );
+        if (Logger::isDebugLoggingEnabled()) {
+            Logger::debug(
+                "Setting AVR8 EDBG parameter (context: 0x", StringService::toHex(parameter.context), ", id: 0x",
+                StringService::toHex(parameter.id), ", value: 0x", StringService::toHex(value), ")"
+            );
+        }
 
         if (responseFrame.id == Avr8ResponseId::FAILED) {
+            this->parameterValuesByKey.erase(parameterKey);
             throw Avr8CommandFailure("Failed to set parameter on device!", responseFrame);
         }
+
+        this->parameterValuesByKey[parameterKey] = value;
+    }
+
+    void EdbgAvr8Interface::setPendingParameters() {
+        if (!this->pendingParameterValuesByKey.has_value()) {
+            return;
+        }
+
+        const auto pendingValuesByKey = std::move(*(this->pendingParameterValuesByKey));
+        this->pendingParameterValuesByKey = std::nullopt;
+
+        auto valueIt = pendingValuesByKey.begin();
+        while (valueIt != pendingValuesByKey.end()) {
+            const auto& [firstKey, firstValue] = *valueIt;
+            auto adjacentValuesByKey = ParameterValuesByKey({*valueIt});
+            auto nextId = static_cast<std::size_t>(firstKey.second) + firstValue.size();
+            auto combinedSize = firstValue.size();
+
+            for (++valueIt; valueIt != pendingValuesByKey.end(); ++valueIt) {
+                const auto& [key, value] = *valueIt;
+
+                if (
+                    !this->combinedParameterWritesSupported
+                    || key.first != firstKey.first
+                    || key.second != nextId
+                    || (combinedSize + value.size()) > EdbgAvr8Interface::MAXIMUM_PARAMETER_VALUE_SIZE
+                ) {
+                    break;
+                }
+
+                adjacentValuesByKey.insert(*valueIt);
+                nextId += value.size();
+                combinedSize += value.size();
+            }
+
+            this->setAdjacentParameters(adjacentValuesByKey);
+        }
+    }
+
+    void EdbgAvr8Interface::setAdjacentParameters(const ParameterValuesByKey& parameterValuesByKey) {
+        using Services::StringService;
+
+        assert(!parameterValuesByKey.empty());
+
+        const auto& firstKey = parameterValuesByKey.begin()->first;
+        const auto firstParameter = Avr8EdbgParameter(firstKey.first, firstKey.second);
+
+        if (parameterValuesByKey.size() == 1) {
+            this->setParameter(firstParameter, parameterValuesByKey.begin()->second);
+            return;
+        }
+
+        auto combinedValue = std::vector<unsigned char>();
+        for (const auto& [key, value] : parameterValuesByKey) {
+            combinedValue.insert(combinedValue.end(), value.begin(), value.end());
+        }
+
+        const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+            SetParameter(firstParameter, combinedValue)
+        );
+
+        if (Logger::isDebugLoggingEnabled()) {
+            Logger::debug(
+                "Setting ", std::to_string(parameterValuesByKey.size()), " adjacent AVR8 EDBG parameters (context: 0x",
+                StringService::toHex(firstParameter.context), ", first id: 0x", StringService::toHex(firstParameter.id),
+                ", value: 0x", StringService::toHex(combinedValue), ")"
+            );
+        }
+
+        if (responseFrame.id == Avr8ResponseId::FAILED) {
+            Logger::debug("Debug tool rejected combined parameter write - setting parameters individually");
+            this->combinedParameterWritesSupported = false;
+
+            for (const auto& [key, value] : parameterValuesByKey) {
+                this->parameterValuesByKey.erase(key);
+                this->setParameter(Avr8EdbgParameter(key.first, key.second), value);
+            }
+
+            return;
+        }
+
+        for (const auto& [key, value] : parameterValuesByKey) {
+            this->parameterValuesByKey[key] = value;
+        }
     }
 
     std::vector<unsigned char> EdbgAvr8Interface::getParameter(const Avr8EdbgParameter& parameter, std::uint8_t size) {
@@ -1510,6 +1910,217 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
 
         this->physicalInterfaceActivated = false;
+        this->parameterValuesByKey.clear();
+    }
+
+    std::optional<Avr8EdbgParameter> EdbgAvr8Interface::interfaceClockParameter() const {
+        switch (this->configVariant) {
+            case Avr8ConfigVariant::XMEGA:
+            case Avr8ConfigVariant::UPDI: {
+                return Avr8EdbgParameters::PDI_CLOCK_SPEED;
+            }
+            case Avr8ConfigVariant::MEGAJTAG: {
+                return Avr8EdbgParameters::MEGA_DEBUG_CLOCK;
+            }
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+
+    std::vector<std::uint16_t> EdbgAvr8Interface::interfaceClockSpeedSteps() const {
+        switch (this->configVariant) {
+            case Avr8ConfigVariant::XMEGA: {
+                return {4000, 6000, 7500};
+            }
+            case Avr8ConfigVariant::UPDI: {
+                return {1800, 2700, 3600};
+            }
+            case Avr8ConfigVariant::MEGAJTAG: {
+                /*
+                 * The JTAG clock must not exceed a quarter of the target's clock, which we don't know. Targets
+                 * running from a slow clock will simply fail the read-back tests at the higher steps.
+                 */
+                return {200, 500, 1000, 2000, 4000};
+            }
+            default: {
+                return {};
+            }
+        }
+    }
+
+    void EdbgAvr8Interface::applyInterfaceClockSpeed(std::uint16_t clockSpeed) {
+        this->interfaceClockSpeed = clockSpeed;
+
+        if (this->physicalInterfaceActivated) {
+            this->deactivatePhysical();
+        }
+
+        this->targetAttached = false;
+
+        this->setParameter(this->interfaceClockParameter().value(), clockSpeed);
+        this->activate();
+    }
+
+    void EdbgAvr8Interface::tuneInterfaceClock() {
+        const auto clockSpeedSteps = this->interfaceClockSpeedSteps();
+        const auto defaultClockSpeed = clockSpeedSteps.front();
+
+        // Setting this first also ensures we don't re-enter the tuning, when reactivating the target from here
+        this->interfaceClockSpeed = this->targetConfig->interfaceClockSpeed.value_or(defaultClockSpeed);
+
+        if (this->targetConfig->interfaceClockSpeed.has_value() || !this->targetConfig->tuneInterfaceClock) {
+            return;
+        }
+
+        const auto expectedSignature = this->getDeviceId();
+        const auto expectedProgramMemory = this->readMemory(
+            TargetMemoryType::FLASH,
+            this->targetParameters.flashStartAddress.value(),
+            std::min(EdbgAvr8Interface::INTERFACE_CLOCK_TEST_BLOCK_SIZE, this->targetParameters.flashSize.value())
+        );
+
+        const auto cacheKey = this->interfaceClockCacheKey(expectedSignature);
+        const auto cachedClockSpeed = EdbgAvr8Interface::cachedInterfaceClockSpeed(cacheKey);
+
+        if (cachedClockSpeed.has_value()) {
+            if (*cachedClockSpeed == defaultClockSpeed) {
+                return;
+            }
+
+            try {
+                this->applyInterfaceClockSpeed(*cachedClockSpeed);
+
+                if (this->interfaceClockStable(expectedSignature, expectedProgramMemory)) {
+                    Logger::debug("Using cached interface clock speed: " + std::to_string(*cachedClockSpeed) + " kHz");
+                    return;
+                }
+
+            } catch (const Exception& exception) {
+                Logger::debug("Failed to apply cached interface clock speed - " + exception.getMessage());
+            }
+
+            Logger::warning(
+                "Cached interface clock speed (" + std::to_string(*cachedClockSpeed) + " kHz) is no longer stable "
+                    "- retuning interface clock"
+            );
+            this->applyInterfaceClockSpeed(defaultClockSpeed);
+        }
+
+        Logger::info("Tuning interface clock speed");
+        auto stableClockSpeed = defaultClockSpeed;
+
+        for (auto stepIt = std::next(clockSpeedSteps.begin()); stepIt != clockSpeedSteps.end(); ++stepIt) {
+            auto stable = false;
+
+            try {
+                this->applyInterfaceClockSpeed(*stepIt);
+                stable = this->interfaceClockStable(expectedSignature, expectedProgramMemory);
+
+            } catch (const Exception& exception) {
+                Logger::debug(
+                    "Interface clock speed " + std::to_string(*stepIt) + " kHz failed - " + exception.getMessage()
+                );
+            }
+
+            if (!stable) {
+                break;
+            }
+
+            stableClockSpeed = *stepIt;
+        }
+
+        if (this->interfaceClockSpeed != stableClockSpeed) {
+            this->applyInterfaceClockSpeed(stableClockSpeed);
+        }
+
+        Logger::info("Interface clock speed: " + std::to_string(stableClockSpeed) + " kHz");
+
+        if (this->toolSerialNumber.has_value()) {
+            EdbgAvr8Interface::cacheInterfaceClockSpeed(cacheKey, stableClockSpeed);
+        }
+    }
+
+    bool EdbgAvr8Interface::interfaceClockStable(
+        const TargetSignature& expectedSignature,
+        const TargetMemoryBuffer& expectedProgramMemory
+    ) {
+        for (auto testIndex = std::size_t(0); testIndex < EdbgAvr8Interface::INTERFACE_CLOCK_TEST_COUNT; ++testIndex) {
+            if (this->getDeviceId() != expectedSignature) {
+                return false;
+            }
+
+            const auto programMemory = this->readMemory(
+                TargetMemoryType::FLASH,
+                this->targetParameters.flashStartAddress.value(),
+                static_cast<TargetMemorySize>(expectedProgramMemory.size())
+            );
+
+            if (programMemory != expectedProgramMemory) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::string EdbgAvr8Interface::interfaceClockCacheKey(const TargetSignature& targetSignature) const {
+        return this->toolSerialNumber.value_or("unknown") + "/"
+            + std::to_string(static_cast<int>(this->configVariant)) + "/" + targetSignature.toHex();
+    }
+
+    std::optional<std::uint16_t> EdbgAvr8Interface::cachedInterfaceClockSpeed(const std::string& cacheKey) {
+        const auto lock = std::unique_lock(EdbgAvr8Interface::tunedInterfaceClockSpeedsMutex);
+
+        const auto& clockSpeedsByKey = EdbgAvr8Interface::tunedInterfaceClockSpeeds();
+        const auto clockSpeedIt = clockSpeedsByKey.find(cacheKey);
+
+        return clockSpeedIt != clockSpeedsByKey.end()
+            ? std::optional<std::uint16_t>(clockSpeedIt->second)
+            : std::nullopt;
+    }
+
+    std::string EdbgAvr8Interface::interfaceClockCacheFilePath() {
+        return Services::PathService::projectCacheDirPath() + "/avr8-interface-clocks";
+    }
+
+    std::map<std::string, std::uint16_t>& EdbgAvr8Interface::tunedInterfaceClockSpeeds() {
+        if (!EdbgAvr8Interface::tunedInterfaceClockSpeedsByKey.has_value()) {
+            auto& clockSpeedsByKey = EdbgAvr8Interface::tunedInterfaceClockSpeedsByKey.emplace();
+
+            // Each line of the cache file holds a cache key and a clock speed (in kHz), separated by a space
+            auto cacheFile = std::ifstream(EdbgAvr8Interface::interfaceClockCacheFilePath());
+            auto key = std::string();
+            auto clockSpeed = std::uint32_t(0);
+
+            while (cacheFile >> key >> clockSpeed) {
+                if (clockSpeed > 0 && clockSpeed <= 0xFFFF) {
+                    clockSpeedsByKey[key] = static_cast<std::uint16_t>(clockSpeed);
+                }
+            }
+        }
+
+        return *(EdbgAvr8Interface::tunedInterfaceClockSpeedsByKey);
+    }
+
+    void EdbgAvr8Interface::cacheInterfaceClockSpeed(const std::string& cacheKey, std::uint16_t clockSpeed) {
+        const auto lock = std::unique_lock(EdbgAvr8Interface::tunedInterfaceClockSpeedsMutex);
+
+        auto& clockSpeedsByKey = EdbgAvr8Interface::tunedInterfaceClockSpeeds();
+        clockSpeedsByKey[cacheKey] = clockSpeed;
+
+        auto errorCode = std::error_code();
+        std::filesystem::create_directories(Services::PathService::projectCacheDirPath(), errorCode);
+
+        auto cacheFile = std::ofstream(EdbgAvr8Interface::interfaceClockCacheFilePath(), std::ios::trunc);
+        for (const auto& [key, cachedClockSpeed] : clockSpeedsByKey) {
+            cacheFile << key << " " << cachedClockSpeed << "\n";
+        }
+
+        if (!cacheFile) {
+            // The cache is just an optimisation - failing to write it shouldn't prevent us from proceeding
+            Logger::debug("Failed to write interface clock cache file");
+        }
     }
 
     void EdbgAvr8Interface::attach() {
@@ -1593,12 +2204,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         ;
     }
 
-    TargetMemoryAddress EdbgAvr8Interface::alignMemoryAddress(
-        Avr8MemoryType memoryType,
-        TargetMemoryAddress address
-    ) {
-        std::uint16_t alignTo = 1;
-
+    std::uint16_t EdbgAvr8Interface::memoryAlignment(Avr8MemoryType memoryType) {
         switch (memoryType) {
             case Avr8MemoryType::FLASH_PAGE:
             case Avr8MemoryType::SPM:
@@ -1612,60 +2218,34 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
                  * align them - we've tried only word aligning them - the debug tool reports a "Too many or too few
                  * bytes" error.
                  */
-                alignTo = this->targetParameters.flashPageSize.value();
-                break;
+                return this->targetParameters.flashPageSize.value();
             }
             case Avr8MemoryType::EEPROM_ATOMIC:
             case Avr8MemoryType::EEPROM_PAGE: {
-                alignTo = this->targetParameters.eepromPageSize.value();
-                break;
+                return this->targetParameters.eepromPageSize.value();
             }
             default: {
-                break;
+                return 1;
             }
         }
+    }
 
-        if ((address % alignTo) != 0) {
-            return static_cast<TargetMemoryAddress>(std::floor(
-                static_cast<float>(address) / static_cast<float>(alignTo)
-            ) * alignTo);
-        }
-
-        return address;
+    TargetMemoryAddress EdbgAvr8Interface::alignMemoryAddress(
+        Avr8MemoryType memoryType,
+        TargetMemoryAddress address
+    ) {
+        const auto alignTo = this->memoryAlignment(memoryType);
+        return address - (address % alignTo);
     }
 
     TargetMemorySize EdbgAvr8Interface::alignMemoryBytes(
         Avr8MemoryType memoryType,
         TargetMemorySize bytes
     ) {
-        std::uint16_t alignTo = 1;
+        const auto alignTo = this->memoryAlignment(memoryType);
+        const auto remainder = bytes % alignTo;
 
-        switch (memoryType) {
-            case Avr8MemoryType::FLASH_PAGE:
-            case Avr8MemoryType::SPM:
-            case Avr8MemoryType::APPL_FLASH:
-            case Avr8MemoryType::BOOT_FLASH: {
-                // See comment in EdbgAvr8Interface::alignMemoryAddress()
-                alignTo = this->targetParameters.flashPageSize.value();
-                break;
-            }
-            case Avr8MemoryType::EEPROM_ATOMIC:
-            case Avr8MemoryType::EEPROM_PAGE: {
-                alignTo = this->targetParameters.eepromPageSize.value();
-                break;
-            }
-            default: {
-                break;
-            }
-        }
-
-        if ((bytes % alignTo) != 0) {
-            return static_cast<TargetMemorySize>(std::ceil(
-                static_cast<float>(bytes) / static_cast<float>(alignTo)
-            ) * alignTo);
-        }
-
-        return bytes;
+        return remainder != 0 ? bytes + (alignTo - remainder) : bytes;
     }
 
     std::optional<Targets::TargetMemorySize> EdbgAvr8Interface::maximumMemoryAccessSize(Avr8MemoryType memoryType) {
@@ -1692,17 +2272,37 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             return this->maximumMemoryAccessSizePerRequest;
         }
 
+        /*
+         * The -30 is to accommodate for the bytes in the command that are not part of the main payload of the command.
+         */
+        if (
+            this->maximumFrameSize.has_value()
+            && *this->maximumFrameSize > EdbgAvr8Interface::MEMORY_ACCESS_FRAME_OVERHEAD
+        ) {
+            /*
+             * The tool has told us how large a frame it can service, so we use frames of that size. We're also
+             * limited by the number of fragments (CMSIS-DAP vendor commands) an AVR frame can be split into.
+             */
+            const auto maximumFragmentedFrameSize = static_cast<std::size_t>(
+                (this->edbgInterface->getUsbPacketSize() - 4) * EdbgAvr8Interface::MAXIMUM_FRAME_FRAGMENT_COUNT
+            );
+
+            return static_cast<Targets::TargetMemorySize>(
+                std::min(static_cast<std::size_t>(*this->maximumFrameSize), maximumFragmentedFrameSize)
+                    - EdbgAvr8Interface::MEMORY_ACCESS_FRAME_OVERHEAD
+            );
+        }
+
         /*
          * EDBG AVR8 debug tools behave in a really weird way when receiving or responding with more than two packets
-         * for a single memory access command. The data they read/write in this case appears to be wrong.
-         *
-         * To address this, we make sure we only issue memory access commands that will result in no more than two
-         * packets being sent to and from the debug tool.
+         * for a single memory access command, beyond the size they're able to service. The data they read/write in
+         * this case appears to be wrong.
          *
-         * The -30 is to accommodate for the bytes in the command that are not part of the main payload of the command.
+         * For tools that don't report their maximum frame size, we make sure we only issue memory access commands
+         * that will result in no more than two packets being sent to and from the debug tool.
          */
         return static_cast<Targets::TargetMemorySize>(
-            (this->edbgInterface->getUsbHidInputReportSize() - 30) * 2
+            (this->edbgInterface->getUsbPacketSize() - EdbgAvr8Interface::MEMORY_ACCESS_FRAME_OVERHEAD) * 2
         );
     }
 
@@ -1722,49 +2322,66 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             /*
              * Driver-side masked memory read.
              *
-             * Split the read into numerous reads, whenever we encounter an excluded address.
-             *
              * All values for bytes located at excluded addresses will be returned as 0x00 - this mirrors the behaviour
              * of the masked read memory EDBG command.
              */
-            auto output = TargetMemoryBuffer();
-            output.reserve(bytes);
-
-            auto segmentStartAddress = startAddress;
             const auto endAddress = startAddress + bytes - 1;
+            const auto firstExcludedIt = excludedAddresses.lower_bound(startAddress);
+            const auto lastExcludedIt = excludedAddresses.upper_bound(endAddress);
+
+            if (firstExcludedIt == lastExcludedIt) {
+                // None of the excluded addresses are within the range from which we are reading
+                return this->readMemory(type, startAddress, bytes);
+            }
+
+            if (!this->memoryReadsHaveSideEffects(
+                type,
+                TargetMemoryAddressRange(*firstExcludedIt, *std::prev(lastExcludedIt))
+            )) {
+                /*
+                 * Reading the excluded addresses is harmless, so we read the whole range in one go, and blank the
+                 * excluded bytes ourselves.
+                 */
+                auto output = this->readMemory(type, startAddress, bytes);
 
-            for (const auto excludedAddress : excludedAddresses) {
-                if (excludedAddress < startAddress || excludedAddress > endAddress) {
-                    // This excluded address is outside of the range from which we are reading, so it can be ignored.
-                    continue;
+                for (auto excludedIt = firstExcludedIt; excludedIt != lastExcludedIt; ++excludedIt) {
+                    output[*excludedIt - startAddress] = 0x00;
                 }
 
-                const auto segmentSize = excludedAddress - segmentStartAddress;
-                if (segmentSize > 0) {
-                    auto segmentBuffer = this->readMemory(
-                        type,
-                        segmentStartAddress,
-                        segmentSize
-                    );
+                return output;
+            }
+
+            /*
+             * We must not touch the excluded addresses, so we read the segments between them. Consecutive excluded
+             * addresses are coalesced into a single gap, and all segments are read in a single batch (see
+             * EdbgAvr8Interface::readMemoryRanges()).
+             */
+            auto segments = std::vector<TargetMemoryAddressRange>();
+            auto segmentStartAddress = startAddress;
 
-                    std::move(segmentBuffer.begin(), segmentBuffer.end(), std::back_inserter(output));
+            for (auto excludedIt = firstExcludedIt; excludedIt != lastExcludedIt; ++excludedIt) {
+                if (*excludedIt > segmentStartAddress) {
+                    segments.emplace_back(segmentStartAddress, *excludedIt - 1);
                 }
 
-                output.emplace_back(0x00);
+                segmentStartAddress = *excludedIt + 1;
+            }
 
-                segmentStartAddress = excludedAddress + 1;
+            if (segmentStartAddress <= endAddress) {
+                segments.emplace_back(segmentStartAddress, endAddress);
             }
 
-            // Read final segment
-            const auto finalReadBytes = (endAddress - segmentStartAddress) + 1;
-            if (finalReadBytes > 0) {
-                auto segmentBuffer = this->readMemory(
-                    type,
-                    segmentStartAddress,
-                    finalReadBytes
-                );
+            const auto segmentBuffers = this->readMemoryRanges(type, segments, excludedAddresses);
 
-                std::move(segmentBuffer.begin(), segmentBuffer.end(), std::back_inserter(output));
+            auto output = TargetMemoryBuffer(bytes, 0x00);
+            for (auto segmentIndex = std::size_t(0); segmentIndex < segments.size(); ++segmentIndex) {
+                const auto& segmentBuffer = segmentBuffers[segmentIndex];
+
+                std::copy(
+                    segmentBuffer.begin(),
+                    segmentBuffer.end(),
+                    output.begin() + (segments[segmentIndex].startAddress - startAddress)
+                );
             }
 
             return output;
@@ -1788,23 +2405,46 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
 
         const auto maximumReadSize = this->maximumMemoryAccessSize(type);
         if (maximumReadSize.has_value() && bytes > *maximumReadSize) {
+            /*
+             * The read has to be split into numerous command frames. We send them all in one go, so that the frames
+             * can be pipelined (see EdbgInterface::sendAvrCommandFramesAndProcessResponseFrames()).
+             */
+            const auto frameCount = (bytes + *maximumReadSize - 1) / *maximumReadSize;
+
+            auto commandFrames = std::vector<ReadMemory>();
+            auto frameReadSizes = std::vector<TargetMemorySize>();
+            commandFrames.reserve(frameCount);
+            frameReadSizes.reserve(frameCount);
+
+            for (auto bytesQueued = TargetMemorySize(0); bytesQueued < bytes; bytesQueued += *maximumReadSize) {
+                const auto bytesToRead = std::min(static_cast<TargetMemorySize>(bytes - bytesQueued), *maximumReadSize);
+
+                commandFrames.emplace_back(type, startAddress + bytesQueued, bytesToRead, excludedAddresses);
+                frameReadSizes.push_back(bytesToRead);
+            }
+
             auto output = Targets::TargetMemoryBuffer();
             output.reserve(bytes);
 
-            while (output.size() < bytes) {
-                const auto bytesToRead = std::min(
-                    static_cast<TargetMemorySize>(bytes - output.size()),
-                    *maximumReadSize
-                );
+            this->edbgInterface->sendAvrCommandFramesAndProcessResponseFrames(
+                commandFrames,
+                [&output, &frameReadSizes] (
+                    const ReadMemory::ExpectedResponseFrameType& responseFrame,
+                    std::size_t frameIndex
+                ) {
+                    if (responseFrame.id == Avr8ResponseId::FAILED) {
+                        throw Avr8CommandFailure("AVR8 Read memory command failed", responseFrame);
+                    }
 
-                auto data = this->readMemory(
-                    type,
-                    static_cast<TargetMemoryAddress>(startAddress + output.size()),
-                    bytesToRead,
-                    excludedAddresses
-                );
-                std::move(data.begin(), data.end(), std::back_inserter(output));
-            }
+                    const auto data = responseFrame.getMemoryData();
+
+                    if (data.size() != frameReadSizes[frameIndex]) {
+                        throw Avr8CommandFailure("Unexpected number of bytes returned from EDBG debug tool");
+                    }
+
+                    output.insert(output.end(), data.begin(), data.end());
+                }
+            );
 
             return output;
         }
@@ -1828,7 +2468,296 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             throw Avr8CommandFailure("Unexpected number of bytes returned from EDBG debug tool");
         }
 
-        return data;
+        return Targets::TargetMemoryBuffer(data.begin(), data.end());
+    }
+
+    std::vector<TargetMemoryBuffer> EdbgAvr8Interface::readMemoryRanges(
+        Avr8MemoryType type,
+        const std::vector<TargetMemoryAddressRange>& addressRanges,
+        const std::set<TargetMemoryAddress>& excludedAddresses
+    ) {
+        auto output = std::vector<TargetMemoryBuffer>(addressRanges.size());
+
+        if (addressRanges.empty()) {
+            return output;
+        }
+
+        auto sortedRangeIndices = std::vector<std::size_t>(addressRanges.size());
+        std::iota(sortedRangeIndices.begin(), sortedRangeIndices.end(), 0);
+        std::sort(
+            sortedRangeIndices.begin(),
+            sortedRangeIndices.end(),
+            [&addressRanges] (std::size_t indexA, std::size_t indexB) {
+                return addressRanges[indexA].startAddress < addressRanges[indexB].startAddress;
+            }
+        );
+
+        /*
+         * Merge overlapping and nearby ranges into read blocks. Each block is read in one go, and the data for each
+         * of its ranges is extracted from the block afterwards.
+         */
+        struct ReadBlock
+        {
+            TargetMemoryAddressRange addressRange;
+            std::vector<std::size_t> rangeIndices;
+            TargetMemoryBuffer data;
+        };
+
+        const auto maskedReadSupported = !this->avoidMaskedMemoryRead && type == Avr8MemoryType::SRAM;
+
+        /*
+         * Without the masked read command, merging ranges across an excluded address would mean reading that address,
+         * so we don't merge in that case.
+         */
+        const auto gapContainsExcludedAddress = [&excludedAddresses] (
+            const TargetMemoryAddressRange& blockRange,
+            const TargetMemoryAddressRange& nextRange
+        ) {
+            const auto excludedIt = excludedAddresses.upper_bound(blockRange.endAddress);
+            return excludedIt != excludedAddresses.end() && *excludedIt < nextRange.startAddress;
+        };
+
+        auto blocks = std::vector<ReadBlock>();
+
+        for (const auto rangeIndex : sortedRangeIndices) {
+            const auto& addressRange = addressRanges[rangeIndex];
+
+            if (
+                !blocks.empty()
+                && addressRange.startAddress <= (
+                    blocks.back().addressRange.endAddress + EdbgAvr8Interface::MEMORY_RANGE_MERGE_GAP + 1
+                )
+                && (maskedReadSupported || !gapContainsExcludedAddress(blocks.back().addressRange, addressRange))
+            ) {
+                auto& block = blocks.back();
+                block.addressRange.endAddress = std::max(block.addressRange.endAddress, addressRange.endAddress);
+                block.rangeIndices.push_back(rangeIndex);
+                continue;
+            }
+
+            blocks.push_back(ReadBlock{addressRange, {rangeIndex}, {}});
+        }
+
+        /*
+         * Construct the command frames for all blocks, so that they can be sent in a single batch. Blocks that
+         * require special handling (alignment or driver-side masking) are read separately, via readMemory().
+         */
+        const auto maximumReadSize = this->maximumMemoryAccessSize(type);
+
+        auto commandFrames = std::vector<ReadMemory>();
+        auto frameBlockIndices = std::vector<std::size_t>();
+        auto frameReadSizes = std::vector<TargetMemorySize>();
+
+        for (auto blockIndex = std::size_t(0); blockIndex < blocks.size(); ++blockIndex) {
+            auto& block = blocks[blockIndex];
+            const auto startAddress = block.addressRange.startAddress;
+            const auto bytes = (block.addressRange.endAddress - startAddress) + 1;
+
+            auto blockExcludedAddresses = std::set<TargetMemoryAddress>(
+                excludedAddresses.lower_bound(startAddress),
+                excludedAddresses.upper_bound(block.addressRange.endAddress)
+            );
+
+            if (this->alignmentRequired(type) || (!blockExcludedAddresses.empty() && !maskedReadSupported)) {
+                block.data = this->readMemory(type, startAddress, bytes, blockExcludedAddresses);
+                continue;
+            }
+
+            const auto frameSize = maximumReadSize.value_or(bytes);
+            for (auto bytesQueued = TargetMemorySize(0); bytesQueued < bytes; bytesQueued += frameSize) {
+                const auto bytesToRead = std::min(static_cast<TargetMemorySize>(bytes - bytesQueued), frameSize);
+
+                commandFrames.emplace_back(type, startAddress + bytesQueued, bytesToRead, blockExcludedAddresses);
+                frameBlockIndices.push_back(blockIndex);
+                frameReadSizes.push_back(bytesToRead);
+            }
+
+            block.data.reserve(bytes);
+        }
+
+        if (!commandFrames.empty()) {
+            this->edbgInterface->sendAvrCommandFramesAndProcessResponseFrames(
+                commandFrames,
+                [&blocks, &frameBlockIndices, &frameReadSizes] (
+                    const ReadMemory::ExpectedResponseFrameType& responseFrame,
+                    std::size_t frameIndex
+                ) {
+                    if (responseFrame.id == Avr8ResponseId::FAILED) {
+                        throw Avr8CommandFailure("AVR8 Read memory command failed", responseFrame);
+                    }
+
+                    const auto data = responseFrame.getMemoryData();
+
+                    if (data.size() != frameReadSizes[frameIndex]) {
+                        throw Avr8CommandFailure("Unexpected number of bytes returned from EDBG debug tool");
+                    }
+
+                    auto& blockData = blocks[frameBlockIndices[frameIndex]].data;
+                    blockData.insert(blockData.end(), data.begin(), data.end());
+                }
+            );
+        }
+
+        for (const auto& block : blocks) {
+            for (const auto rangeIndex : block.rangeIndices) {
+                const auto& addressRange = addressRanges[rangeIndex];
+                const auto offset = block.data.begin() + (addressRange.startAddress - block.addressRange.startAddress);
+
+                output[rangeIndex] = TargetMemoryBuffer(
+                    offset,
+                    offset + (addressRange.endAddress - addressRange.startAddress) + 1
+                );
+            }
+        }
+
+        return output;
+    }
+
+    bool EdbgAvr8Interface::memoryReadsHaveSideEffects(
+        Avr8MemoryType type,
+        const TargetMemoryAddressRange& addressRange
+    ) {
+        if (type != Avr8MemoryType::SRAM) {
+            // Reading from the register file, flash, EEPROM or fuses has no side effects
+            return false;
+        }
+
+        /*
+         * Everything below the start of internal SRAM (as defined in the TDF) is register space, where reads can have
+         * side effects (clearing interrupt flags, consuming data from peripheral buffers, etc). Accessing the OCDDR
+         * is also illegal.
+         */
+        return !this->targetParameters.ramStartAddress.has_value()
+            || addressRange.startAddress < *(this->targetParameters.ramStartAddress);
+    }
+
+    std::pair<Avr8MemoryType, TargetMemoryAddress> EdbgAvr8Interface::resolveReadMemoryType(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress address
+    ) {
+        auto avr8MemoryType = Avr8MemoryType::SRAM;
+
+        switch (memoryType) {
+            case TargetMemoryType::RAM: {
+                avr8MemoryType = Avr8MemoryType::SRAM;
+                break;
+            }
+            case TargetMemoryType::FLASH: {
+                if (
+                    this->configVariant == Avr8ConfigVariant::DEBUG_WIRE
+                    || this->configVariant == Avr8ConfigVariant::UPDI
+                ) {
+                    avr8MemoryType = Avr8MemoryType::FLASH_PAGE;
+
+                } else if (this->configVariant == Avr8ConfigVariant::MEGAJTAG) {
+                    avr8MemoryType = this->programmingModeEnabled ? Avr8MemoryType::FLASH_PAGE : Avr8MemoryType::SPM;
+
+                } else if (this->configVariant == Avr8ConfigVariant::XMEGA) {
+                    return this->resolveXmegaFlashMemoryType(address);
+                }
+                break;
+            }
+            case TargetMemoryType::EEPROM: {
+                // For JTAG targets, we must use the EEPROM_PAGE memory type when in programming mode.
+                avr8MemoryType = (this->configVariant == Avr8ConfigVariant::MEGAJTAG && this->programmingModeEnabled)
+                    ? Avr8MemoryType::EEPROM_PAGE
+                    : Avr8MemoryType::EEPROM;
+
+                if (this->configVariant == Avr8ConfigVariant::XMEGA) {
+                    // EEPROM addresses should be in relative form, for XMEGA (PDI) targets
+                    address -= this->targetParameters.eepromStartAddress.value();
+                }
+                break;
+            }
+            case TargetMemoryType::FUSES: {
+                avr8MemoryType = Avr8MemoryType::FUSES;
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+
+        return {avr8MemoryType, address};
+    }
+
+    std::pair<Avr8MemoryType, TargetMemoryAddress> EdbgAvr8Interface::resolveWriteMemoryType(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress address
+    ) {
+        auto avr8MemoryType = Avr8MemoryType::SRAM;
+
+        switch (memoryType) {
+            case TargetMemoryType::RAM: {
+                avr8MemoryType = Avr8MemoryType::SRAM;
+                break;
+            }
+            case TargetMemoryType::FLASH: {
+                if (
+                    this->configVariant == Avr8ConfigVariant::DEBUG_WIRE
+                    || this->configVariant == Avr8ConfigVariant::UPDI
+                    || this->configVariant == Avr8ConfigVariant::MEGAJTAG
+                ) {
+                    avr8MemoryType = Avr8MemoryType::FLASH_PAGE;
+
+                } else if (this->configVariant == Avr8ConfigVariant::XMEGA) {
+                    return this->resolveXmegaFlashMemoryType(address);
+                }
+                break;
+            }
+            case TargetMemoryType::EEPROM: {
+                switch (this->configVariant) {
+                    case Avr8ConfigVariant::UPDI:
+                    case Avr8ConfigVariant::XMEGA: {
+                        avr8MemoryType = Avr8MemoryType::EEPROM_ATOMIC;
+
+                        if (this->configVariant == Avr8ConfigVariant::XMEGA) {
+                            // EEPROM addresses should be in relative form, for XMEGA (PDI) targets
+                            address -= this->targetParameters.eepromStartAddress.value();
+                        }
+
+                        break;
+                    }
+                    case Avr8ConfigVariant::MEGAJTAG: {
+                        avr8MemoryType = this->programmingModeEnabled
+                            ? Avr8MemoryType::EEPROM_PAGE
+                            : Avr8MemoryType::EEPROM;
+                        break;
+                    }
+                    default: {
+                        avr8MemoryType = Avr8MemoryType::EEPROM;
+                        break;
+                    }
+                }
+                break;
+            }
+            case TargetMemoryType::FUSES: {
+                avr8MemoryType = Avr8MemoryType::FUSES;
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+
+        return {avr8MemoryType, address};
+    }
+
+    std::pair<Avr8MemoryType, TargetMemoryAddress> EdbgAvr8Interface::resolveXmegaFlashMemoryType(
+        TargetMemoryAddress address
+    ) {
+        const auto bootSectionStartAddress = this->targetParameters.bootSectionStartAddress.value();
+
+        if (address >= bootSectionStartAddress) {
+            // When using the BOOT_FLASH memory type, the address should be relative to the start of the boot section.
+            return {Avr8MemoryType::BOOT_FLASH, address - bootSectionStartAddress};
+        }
+
+        /*
+         * When using the APPL_FLASH memory type, the address should be relative to the start of the application
+         * section.
+         */
+        return {Avr8MemoryType::APPL_FLASH, address - this->targetParameters.appSectionStartAddress.value()};
     }
 
     void EdbgAvr8Interface::writeMemory(
@@ -1892,6 +2821,20 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             return;
         }
 
+        if (
+            (
+                this->configVariant == Avr8ConfigVariant::XMEGA
+                && (type == Avr8MemoryType::APPL_FLASH || type == Avr8MemoryType::BOOT_FLASH)
+            )
+            || (
+                this->configVariant == Avr8ConfigVariant::UPDI
+                && type == Avr8MemoryType::FLASH_PAGE
+                && this->updiPageEraseSupported.value_or(true)
+            )
+        ) {
+            return this->eraseAndWriteFlashPage(type, startAddress, buffer);
+        }
+
         const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
             WriteMemory(
                 type,
@@ -1905,6 +2848,74 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
     }
 
+    void EdbgAvr8Interface::eraseAndWriteFlashPage(
+        Avr8MemoryType type,
+        TargetMemoryAddress startAddress,
+        const TargetMemoryBuffer& buffer
+    ) {
+        const auto bootSection = type == Avr8MemoryType::BOOT_FLASH;
+
+        /*
+         * The page erase command takes the absolute address of the page, as opposed to a section-relative address.
+         * On UPDI targets, that's the address at which the program memory is mapped into the data address space.
+         *
+         * UPDI targets have no separate boot section memory type - we always use the application section page erase
+         * mode, which the NVM controller applies to whichever section the page resides in.
+         */
+        const auto pageAddress = startAddress + (
+            this->configVariant == Avr8ConfigVariant::UPDI
+                ? this->targetParameters.programMemoryUpdiStartAddress.value_or(0)
+                : bootSection
+                    ? this->targetParameters.bootSectionStartAddress.value()
+                    : this->targetParameters.appSectionStartAddress.value()
+        );
+
+        const auto eraseResponseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+            EraseMemory(
+                bootSection ? Avr8EraseMemoryMode::BOOT_SECTION_PAGE : Avr8EraseMemoryMode::APPLICATION_SECTION_PAGE,
+                pageAddress
+            )
+        );
+
+        if (eraseResponseFrame.id == Avr8ResponseId::FAILED) {
+            if (this->configVariant == Avr8ConfigVariant::UPDI && !this->updiPageEraseSupported.has_value()) {
+                /*
+                 * The debug tool doesn't support page erases for UPDI targets. From now on, we report that page
+                 * rewrites are not supported, so the TargetController will fall back to erasing the entire program
+                 * memory (see EdbgAvr8Interface::eraseProgramMemory()). This is the first page erase, so nothing has
+                 * been written yet.
+                 */
+                this->updiPageEraseSupported = false;
+                Logger::warning(
+                    "Debug tool does not support UPDI flash page erases - program memory will be erased in full"
+                );
+            }
+
+            throw Avr8CommandFailure("AVR8 erase memory command (for flash page) failed", eraseResponseFrame);
+        }
+
+        if (this->configVariant == Avr8ConfigVariant::UPDI) {
+            this->updiPageEraseSupported = true;
+        }
+
+        if (std::all_of(buffer.begin(), buffer.end(), [] (unsigned char byte) { return byte == 0xFF; })) {
+            // The page is already in its desired state - there's no need to write to it
+            return;
+        }
+
+        const auto writeResponseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+            WriteMemory(
+                type,
+                startAddress,
+                buffer
+            )
+        );
+
+        if (writeResponseFrame.id == Avr8ResponseId::FAILED) {
+            throw Avr8CommandFailure("AVR8 Write memory command failed", writeResponseFrame);
+        }
+    }
+
     void EdbgAvr8Interface::refreshTargetState() {
         const auto avrEvent = this->getAvrEvent();
 
@@ -4,7 +4,13 @@
 #include <chrono>
 #include <thread>
 #include <optional>
+#include <set>
+#include <map>
+#include <string>
+#include <vector>
 #include <cassert>
+#include <algorithm>
+#include <mutex>
 
 #include "src/DebugToolDrivers/TargetInterfaces/Microchip/AVR/AVR8/Avr8DebugInterface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/Avr8Generic.hpp"
@@ -74,6 +80,30 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             this->maximumMemoryAccessSizePerRequest = maximumSize;
         }
 
+        /**
+         * The largest AVR command/response frame the debug tool can service, as reported by the tool's firmware (see
+         * EdbgDevice::probeToolCapabilities()). Memory access requests are sized to fill this frame size.
+         *
+         * Not all tools (or firmware versions) report this. If not set, we fall back to conservative memory access
+         * sizes (see EdbgAvr8Interface::maximumMemoryAccessSize()).
+         *
+         * @param maximumFrameSize
+         */
+        void setMaximumFrameSize(std::optional<std::uint16_t> maximumFrameSize) {
+            this->maximumFrameSize = maximumFrameSize;
+        }
+
+        /**
+         * The serial number of the debug tool. Tuned interface clock speeds are cached per debug tool and target, so
+         * that the tuning doesn't have to be repeated upon every activation. See
+         * EdbgAvr8Interface::tuneInterfaceClock().
+         *
+         * @param toolSerialNumber
+         */
+        void setToolSerialNumber(std::optional<std::string> toolSerialNumber) {
+            this->toolSerialNumber = std::move(toolSerialNumber);
+        }
+
         void setReactivateJtagTargetPostProgrammingMode(bool reactivateJtagTargetPostProgrammingMode) {
             this->reactivateJtagTargetPostProgrammingMode = reactivateJtagTargetPostProgrammingMode;
         }
@@ -156,6 +186,12 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         void deactivate() override;
 
+        /**
+         * Temporarily disables the debugWire module on the target. This does not affect the DWEN fuse. The module
+         * will be reactivated upon the cycling of the target power.
+         */
+        void disableDebugWire() override;
+
         /**
          * Issues the "PC Read" command to the debug tool, to extract the current program counter.
          *
@@ -179,26 +215,82 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         Targets::Microchip::Avr::TargetSignature getDeviceId() override;
 
         /**
-         * Issues the "Software Breakpoint Set" command to the debug tool, setting a software breakpoint at the given
-         * byte address.
+         * Issues the "Software Breakpoint Set" command to the debug tool, setting software breakpoints at the given
+         * byte addresses.
+         *
+         * All of the breakpoints are sent in a single command, which allows the debug tool to insert any breakpoints
+         * that reside in the same flash page with a single page write.
          *
+         * @param addresses
+         *  The byte addresses to position the breakpoints.
+         */
+        void setSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) override;
+
+        /**
+         * Issues the "Software Breakpoint Clear" command to the debug tool, clearing any breakpoints at the given
+         * byte addresses.
+         *
+         * @param addresses
+         *  The byte addresses of the breakpoints to clear.
+         */
+        void clearSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) override;
+
+        /**
+         * Returns the number of hardware breakpoints available for the current config variant.
+         *
+         * @return
+         */
+        std::uint16_t getHardwareBreakpointCount() override;
+
+        /**
+         * Issues the "Hardware Breakpoint Set" command to the debug tool.
+         *
+         * @param index
          * @param address
          *  The byte address to position the breakpoint.
          */
-        void setBreakpoint(Targets::TargetMemoryAddress address) override;
+        void setHardwareBreakpoint(std::uint16_t index, Targets::TargetMemoryAddress address) override;
+
+        /**
+         * Issues the "Hardware Breakpoint Clear" command to the debug tool.
+         *
+         * @param index
+         */
+        void clearHardwareBreakpoint(std::uint16_t index) override;
+
+        /**
+         * Returns the number of hardware breakpoints that can be used as data breakpoints, for the current config
+         * variant.
+         *
+         * @return
+         */
+        std::uint16_t getDataBreakpointCount() override;
 
         /**
-         * Issues the "Software Breakpoint Clear" command to the debug tool, clearing any breakpoint at the given
-         * byte address.
+         * Issues the "Hardware Breakpoint Set" command to the debug tool, with the data breakpoint type.
          *
+         * @param index
          * @param address
-         *  The byte address of the breakpoint to clear.
+         *  The RAM address to watch.
+         *
+         * @param type
+         */
+        void setDataBreakpoint(
+            std::uint16_t index,
+            Targets::TargetMemoryAddress address,
+            Targets::TargetWatchpointType type
+        ) override;
+
+        /**
+         * Issues the "Hardware Breakpoint Clear" command to the debug tool.
+         *
+         * @param index
          */
-        void clearBreakpoint(Targets::TargetMemoryAddress address) override;
+        void clearDataBreakpoint(std::uint16_t index) override;
 
         /**
          * Issues the "Software Breakpoint Clear All" command to the debug tool, clearing all software breakpoints
-         * that were set *in the current debug session*.
+         * that were set *in the current debug session*, and clears any hardware breakpoints that we've set.
          *
          * If the debug session ended before any of the set breakpoints were cleared, this will *not* clear them.
          */
@@ -208,16 +300,19 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          * Reads registers from the target.
          *
          * @param descriptors
-         * @return
+         * @param output
          */
-        Targets::TargetRegisters readRegisters(const Targets::TargetRegisterDescriptors& descriptors) override;
+        void readRegisters(
+            Targets::TargetRegisterDescriptorSelection descriptors,
+            Targets::TargetRegisters& output
+        ) override;
 
         /**
          * Writes registers to target.
          *
          * @param registers
          */
-        void writeRegisters(const Targets::TargetRegisters& registers) override;
+        void writeRegisters(Targets::TargetRegisterSelection registers) override;
 
         /**
          * This is an overloaded method.
@@ -236,6 +331,21 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {}
         ) override;
 
+        /**
+         * This is an overloaded method.
+         *
+         * Resolves the correct Avr8MemoryType for each address range, from the given TargetMemoryType, and calls
+         * readMemoryRanges().
+         *
+         * @param memoryType
+         * @param addressRanges
+         * @return
+         */
+        std::vector<Targets::TargetMemoryBuffer> readMemoryRanges(
+            Targets::TargetMemoryType memoryType,
+            const std::vector<Targets::TargetMemoryAddressRange>& addressRanges
+        ) override;
+
         /**
          * This is an overloaded method.
          *
@@ -251,6 +361,25 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             const Targets::TargetMemoryBuffer& buffer
         ) override;
 
+        /**
+         * Computes a CRC-32 over the given memory range.
+         *
+         * The EDBG AVR8 protocol doesn't provide a command that produces the CRC expected by our callers, so the CRC
+         * is computed on the host, as the memory is streamed from the target, one block (of MEMORY_CRC_BLOCK_SIZE
+         * bytes) at a time. This keeps the host's memory usage constant, regardless of the size of the range.
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         */
+        std::uint32_t computeMemoryCrc(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes
+        ) override;
+
         /**
          * Issues the "Erase" command to erase a particular section of program memory, or the entire chip.
          *
@@ -260,6 +389,38 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             std::optional<Targets::Microchip::Avr::Avr8Bit::ProgramMemorySection> section = std::nullopt
         ) override;
 
+        /**
+         * On debugWire targets, the debug tool erases each flash page before writing to it. On PDI (XMEGA) and UPDI
+         * targets, we erase each page ourselves, just before writing to it (see
+         * EdbgAvr8Interface::eraseAndWriteFlashPage()). For JTAG targets, the only erase available to us is a full
+         * chip erase.
+         *
+         * For UPDI targets, this returns false once the debug tool has rejected a page erase (see
+         * EdbgAvr8Interface::updiPageEraseSupported) - from then on, the program memory can only be erased in full.
+         *
+         * @return
+         */
+        bool programMemoryPageRewritesSupported() override;
+
+        /**
+         * On UPDI and PDI (XMEGA) targets, EEPROM is written via the EEPROM_ATOMIC memory type, which erases and
+         * writes a whole page in one go. On JTAG targets, the EEPROM_PAGE memory type can only be used in
+         * programming mode. All other EEPROM writes are performed one byte at a time.
+         *
+         * See EdbgAvr8Interface::resolveWriteMemoryType().
+         *
+         * @return
+         */
+        bool eepromPageWritesSupported() override;
+
+        /**
+         * The UPDI and PDI (XMEGA) debug modules can access the data space whilst the CPU is running. On debugWire
+         * and JTAG targets, the OCD can only access memory whilst the target is stopped.
+         *
+         * @return
+         */
+        bool runtimeMemoryAccessSupported() override;
+
         /**
          * Returns the current state of the target.
          *
@@ -278,6 +439,91 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         void disableProgrammingMode() override;
 
     private:
+        /**
+         * The number of bytes in a memory access command/response frame that are not part of the memory buffer.
+         */
+        static constexpr std::size_t MEMORY_ACCESS_FRAME_OVERHEAD = 30;
+
+        /**
+         * AVR frames can be split into no more than 15 fragments - the fragment count occupies four bits in the
+         * AVR command.
+         */
+        static constexpr std::size_t MAXIMUM_FRAME_FRAGMENT_COUNT = 15;
+
+        /**
+         * When reading numerous address ranges (see EdbgAvr8Interface::readMemoryRanges()), ranges separated by no
+         * more than this number of bytes will be merged into a single read. Reading a few unwanted bytes is cheaper
+         * than another round trip to the debug tool.
+         */
+        static constexpr Targets::TargetMemorySize MEMORY_RANGE_MERGE_GAP = 16;
+
+        /**
+         * When computing a memory CRC (see EdbgAvr8Interface::computeMemoryCrc()), the memory is read in blocks of
+         * this size. Each block is read via a pipelined batch of command frames, and folded into the CRC before the
+         * next block is read.
+         */
+        static constexpr Targets::TargetMemorySize MEMORY_CRC_BLOCK_SIZE = 0x2000;
+
+        /**
+         * When waiting for an AVR event, we poll the debug tool back-to-back for this period, before backing off.
+         *
+         * Events that are raised shortly after a command (such as the BREAK event that follows a single step) are
+         * usually available within a couple of USB round trips, so the wait is bounded by the USB latency, rather
+         * than by the sleep granularity.
+         */
+        static constexpr auto AVR_EVENT_SPIN_DURATION = std::chrono::milliseconds(5);
+
+        /**
+         * After the spin period, the interval between polls doubles upon each attempt, up to this maximum.
+         */
+        static constexpr auto AVR_EVENT_MAXIMUM_POLL_INTERVAL = std::chrono::milliseconds(50);
+
+        /**
+         * How long we're willing to wait for the BREAK event after a single step, before leaving it to the
+         * TargetController to poll for the event (see EdbgAvr8Interface::step()).
+         */
+        static constexpr auto STEP_BREAK_EVENT_TIMEOUT = std::chrono::milliseconds(10);
+
+        /**
+         * The maximum time we'll spend waiting for the target to become ready after a reset. See
+         * EdbgAvr8Interface::waitForTargetReadiness().
+         *
+         * This used to be a fixed delay, following every reset.
+         */
+        static constexpr auto TARGET_READINESS_TIMEOUT = std::chrono::milliseconds(250);
+
+        /**
+         * The delay between readiness probes starts at TARGET_READINESS_INITIAL_RETRY_DELAY, and doubles after each
+         * failed probe, up to TARGET_READINESS_MAXIMUM_RETRY_DELAY.
+         */
+        static constexpr auto TARGET_READINESS_INITIAL_RETRY_DELAY = std::chrono::milliseconds(2);
+        static constexpr auto TARGET_READINESS_MAXIMUM_RETRY_DELAY = std::chrono::milliseconds(50);
+
+        /**
+         * The number of read-back tests that must pass at a given interface clock speed, before we consider the clock
+         * speed to be stable. See EdbgAvr8Interface::tuneInterfaceClock().
+         */
+        static constexpr std::size_t INTERFACE_CLOCK_TEST_COUNT = 3;
+
+        /**
+         * The number of bytes of program memory to read, in each interface clock read-back test.
+         */
+        static constexpr Targets::TargetMemorySize INTERFACE_CLOCK_TEST_BLOCK_SIZE = 256;
+
+        /**
+         * Tuned interface clock speeds (in kHz), mapped by cache key. See
+         * EdbgAvr8Interface::interfaceClockCacheKey().
+         *
+         * This is populated from (and persisted to) the interface clock cache file, in the project's cache directory.
+         */
+        static inline std::optional<std::map<std::string, std::uint16_t>> tunedInterfaceClockSpeedsByKey;
+
+        /**
+         * Guards EdbgAvr8Interface::tunedInterfaceClockSpeedsByKey and the cache file - there may be multiple
+         * instances of this class, on separate threads (e.g. when programming several targets in parallel).
+         */
+        static inline std::mutex tunedInterfaceClockSpeedsMutex;
+
         /**
          * The AVR8 Generic protocol is a sub-protocol of the EDBG AVR protocol, which is served via CMSIS-DAP vendor
          * commands.
@@ -332,6 +578,56 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         std::optional<Targets::TargetMemorySize> maximumMemoryAccessSizePerRequest;
 
+        /**
+         * See the comment for EdbgAvr8Interface::setMaximumFrameSize().
+         */
+        std::optional<std::uint16_t> maximumFrameSize;
+
+        /**
+         * See the comment for EdbgAvr8Interface::setToolSerialNumber().
+         */
+        std::optional<std::string> toolSerialNumber;
+
+        /**
+         * The interface clock speed (in kHz) that we've settled on - either from the user's target config, or from
+         * tuning. Unset until the tuning has taken place.
+         */
+        std::optional<std::uint16_t> interfaceClockSpeed;
+
+        /**
+         * The maximum size of a SetParameter command's value. The value length is encoded in a single byte.
+         */
+        static constexpr auto MAXIMUM_PARAMETER_VALUE_SIZE = std::size_t(255);
+
+        using ParameterValuesByKey = std::map<std::pair<unsigned char, unsigned char>, std::vector<unsigned char>>;
+
+        /**
+         * The values of the AVR8 parameters that we've set on the debug tool, mapped by parameter context and ID.
+         *
+         * Target activation pushes the same target parameters to the tool more than once - before activation and
+         * again after target promotion (see Avr8::activate() and Avr8::postPromotionConfigure()). We use this to skip
+         * parameters that the tool already holds. See EdbgAvr8Interface::setParameter().
+         *
+         * This is cleared upon deactivation of the physical interface, or a failed attempt to activate it.
+         */
+        ParameterValuesByKey parameterValuesByKey;
+
+        /**
+         * Parameter values that are yet to be sent to the debug tool. See EdbgAvr8Interface::setTargetParameters()
+         * and EdbgAvr8Interface::setPendingParameters().
+         *
+         * This is std::nullopt when we're not collecting parameters, in which case EdbgAvr8Interface::setParameter()
+         * sends them immediately.
+         */
+        std::optional<ParameterValuesByKey> pendingParameterValuesByKey;
+
+        /**
+         * Parameter IDs are byte offsets within their context, so adjacent parameters can be set with a single
+         * SetParameter command. If the tool rejects such a command, we fall back to setting them individually, and
+         * stop attempting to combine them.
+         */
+        bool combinedParameterWritesSupported = true;
+
         bool reactivateJtagTargetPostProgrammingMode = false;
 
         /**
@@ -357,6 +653,19 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
 
         bool programmingModeEnabled = false;
 
+        /**
+         * Whether the debug tool accepts the APPLICATION_SECTION_PAGE erase mode for UPDI targets. Not all tools (or
+         * firmware versions) do, and there's no way to tell other than by trying it, so this remains std::nullopt
+         * until the first page erase. See EdbgAvr8Interface::eraseAndWriteFlashPage().
+         */
+        std::optional<bool> updiPageEraseSupported;
+
+        /**
+         * Indices of the hardware breakpoints (including those configured as data breakpoints) that are currently set.
+         * See EdbgAvr8Interface::clearAllBreakpoints().
+         */
+        std::set<std::uint16_t> activeHardwareBreakpointIndices;
+
         /**
          * This mapping allows us to determine which config variant to select, based on the target family and the
          * selected physical interface.
@@ -377,11 +686,33 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          * Sets an AVR8 parameter on the debug tool. See the Avr8EdbgParameters class and protocol documentation
          * for more on available parameters.
          *
+         * If the tool already holds the given value for the parameter, no command is sent. See
+         * EdbgAvr8Interface::parameterValuesByKey.
+         *
+         * If we're collecting parameters (see EdbgAvr8Interface::pendingParameterValuesByKey), the value is only
+         * recorded, to be sent by EdbgAvr8Interface::setPendingParameters().
+         *
          * @param parameter
          * @param value
          */
         void setParameter(const Avr8EdbgParameter& parameter, const std::vector<unsigned char>& value);
 
+        /**
+         * Sends all pending parameter values to the debug tool, combining adjacent parameters (within the same
+         * context) into single SetParameter commands.
+         *
+         * This ends the collection of parameters - subsequent calls to EdbgAvr8Interface::setParameter() will send
+         * their values immediately.
+         */
+        void setPendingParameters();
+
+        /**
+         * Sets a series of adjacent parameters, of the same context, with a single SetParameter command.
+         *
+         * @param parameterValuesByKey
+         */
+        void setAdjacentParameters(const ParameterValuesByKey& parameterValuesByKey);
+
         /**
          * Overload for setting parameters with single byte values.
          *
@@ -466,6 +797,97 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         void deactivatePhysical();
 
+        /**
+         * Returns the AVR8 parameter that holds the interface clock speed for the current config variant, if any.
+         *
+         * debugWire has no such parameter - the debugWire baud rate is derived from the target's clock.
+         *
+         * @return
+         */
+        [[nodiscard]] std::optional<Avr8EdbgParameter> interfaceClockParameter() const;
+
+        /**
+         * Returns the interface clock speeds (in kHz) that we step through when tuning the interface clock, in
+         * ascending order. The first is the default (conservative) clock speed.
+         *
+         * @return
+         */
+        [[nodiscard]] std::vector<std::uint16_t> interfaceClockSpeedSteps() const;
+
+        /**
+         * Sets the interface clock speed, reactivating the physical interface and the target, for the new clock
+         * speed to take effect.
+         *
+         * @param clockSpeed
+         */
+        void applyInterfaceClockSpeed(std::uint16_t clockSpeed);
+
+        /**
+         * Steps up the interface clock speed, validating each step with a series of read-back tests (reading the
+         * target signature and a block of program memory, and comparing them with what was read at the default
+         * clock speed). We settle on the highest clock speed that passes all tests.
+         *
+         * The result is cached per debug tool and target. A cached clock speed is validated in the same way, before
+         * we use it.
+         *
+         * This is only performed once per EdbgAvr8Interface instance, and only once the target parameters are known.
+         */
+        void tuneInterfaceClock();
+
+        /**
+         * Performs the read-back tests for the interface clock tuning.
+         *
+         * @param expectedSignature
+         * @param expectedProgramMemory
+         *
+         * @return
+         *  True if all tests passed. False if any read failed or yielded unexpected data.
+         */
+        bool interfaceClockStable(
+            const Targets::Microchip::Avr::TargetSignature& expectedSignature,
+            const Targets::TargetMemoryBuffer& expectedProgramMemory
+        );
+
+        /**
+         * Returns the key under which the tuned interface clock speed is cached, for the current debug tool, target
+         * and config variant.
+         *
+         * @param targetSignature
+         *
+         * @return
+         */
+        [[nodiscard]] std::string interfaceClockCacheKey(
+            const Targets::Microchip::Avr::TargetSignature& targetSignature
+        ) const;
+
+        /**
+         * Looks up a tuned interface clock speed in the cache, loading the cache file upon first access.
+         *
+         * @param cacheKey
+         *
+         * @return
+         */
+        static std::optional<std::uint16_t> cachedInterfaceClockSpeed(const std::string& cacheKey);
+
+        /**
+         * Stores a tuned interface clock speed in the cache, and rewrites the cache file.
+         *
+         * @param cacheKey
+         * @param clockSpeed
+         */
+        static void cacheInterfaceClockSpeed(const std::string& cacheKey, std::uint16_t clockSpeed);
+
+        static std::string interfaceClockCacheFilePath();
+
+        /**
+         * Returns the interface clock cache, loading it from the cache file upon first access.
+         *
+         * The caller must hold EdbgAvr8Interface::tunedInterfaceClockSpeedsMutex.
+         *
+         * @return
+         */
+        static std::map<std::string, std::uint16_t>& tunedInterfaceClockSpeeds();
+
         /**
          * Sends the "Attach" command to the debug tool, which starts a debug session on the target.
          */
@@ -496,6 +918,15 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         bool alignmentRequired(Avr8MemoryType memoryType);
 
+        /**
+         * Returns the alignment (in bytes) required for memory access via a given Avr8MemoryType. Memory types that
+         * don't require alignment will yield 1.
+         *
+         * @param memoryType
+         * @return
+         */
+        std::uint16_t memoryAlignment(Avr8MemoryType memoryType);
+
         /**
          * Aligns a memory address for a given memory type's page size.
          *
@@ -553,6 +984,88 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             const std::set<Targets::TargetMemoryAddress>& excludedAddresses = {}
         );
 
+        /**
+         * Reads numerous address ranges from the target, for the given memory type.
+         *
+         * Nearby ranges (those separated by no more than MEMORY_RANGE_MERGE_GAP bytes) are merged into a single
+         * read, and the reads are sent to the debug tool in a single batch of command frames, so that they can be
+         * pipelined (see EdbgInterface::sendAvrCommandFramesAndProcessResponseFrames()).
+         *
+         * Memory types that require alignment, and reads that cannot be serviced with a single masked read command,
+         * are delegated to EdbgAvr8Interface::readMemory().
+         *
+         * @param type
+         * @param addressRanges
+         *
+         * @param excludedAddresses
+         *  See EdbgAvr8Interface::readMemory().
+         *
+         * @return
+         *  A buffer for each of the given address ranges, in the same order as the ranges.
+         */
+        std::vector<Targets::TargetMemoryBuffer> readMemoryRanges(
+            Avr8MemoryType type,
+            const std::vector<Targets::TargetMemoryAddressRange>& addressRanges,
+            const std::set<Targets::TargetMemoryAddress>& excludedAddresses = {}
+        );
+
+        /**
+         * Checks if reading from the given address range could have side effects on the target.
+         *
+         * This determines whether we can read excluded addresses and discard their values, in place of a masked read
+         * (see EdbgAvr8Interface::readMemory()).
+         *
+         * @param type
+         * @param addressRange
+         *
+         * @return
+         */
+        bool memoryReadsHaveSideEffects(Avr8MemoryType type, const Targets::TargetMemoryAddressRange& addressRange);
+
+        /**
+         * Resolves the Avr8MemoryType to use when reading from the given TargetMemoryType, along with the address
+         * to use with that memory type (some memory types require relative addresses).
+         *
+         * @param memoryType
+         * @param address
+         *
+         * @return
+         */
+        std::pair<Avr8MemoryType, Targets::TargetMemoryAddress> resolveReadMemoryType(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress address
+        );
+
+        /**
+         * Resolves the Avr8MemoryType to use when writing to the given TargetMemoryType, along with the address to
+         * use with that memory type.
+         *
+         * This differs from EdbgAvr8Interface::resolveReadMemoryType(), as some memory types (such as EEPROM_ATOMIC)
+         * can only be used for writing, and others (such as SPM) only for reading.
+         *
+         * @param memoryType
+         * @param address
+         *
+         * @return
+         */
+        std::pair<Avr8MemoryType, Targets::TargetMemoryAddress> resolveWriteMemoryType(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress address
+        );
+
+        /**
+         * XMEGA flash is accessed via separate memory types for the application and boot sections, with
+         * section-relative addresses. This resolves the memory type and relative address for an absolute flash
+         * address.
+         *
+         * @param address
+         *
+         * @return
+         */
+        std::pair<Avr8MemoryType, Targets::TargetMemoryAddress> resolveXmegaFlashMemoryType(
+            Targets::TargetMemoryAddress address
+        );
+
         /**
          * Writes memory to the target.
          *
@@ -566,6 +1079,27 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         void writeMemory(Avr8MemoryType type, Targets::TargetMemoryAddress address, const Targets::TargetMemoryBuffer& buffer);
 
+        /**
+         * Erases and then writes a single flash page, on a PDI (XMEGA) or UPDI target. The page erase and write
+         * commands are issued back to back. If the page is to be left in its erased state (all 0xFF), the write is
+         * skipped.
+         *
+         * @param type
+         *  APPL_FLASH or BOOT_FLASH, for PDI targets. FLASH_PAGE, for UPDI targets.
+         *
+         * @param startAddress
+         *  The address of the page, in the form expected by the write memory command (section-relative, for PDI
+         *  targets).
+         *
+         * @param buffer
+         *  The page data. Must be exactly one page in size.
+         */
+        void eraseAndWriteFlashPage(
+            Avr8MemoryType type,
+            Targets::TargetMemoryAddress startAddress,
+            const Targets::TargetMemoryBuffer& buffer
+        );
+
         /**
          * Fetches the current target state.
          *
@@ -574,30 +1108,34 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         void refreshTargetState();
 
-        /**
-         * Temporarily disables the debugWire module on the target. This does not affect the DWEN fuse. The module
-         * will be reactivated upon the cycling of the target power.
-         */
-        void disableDebugWire();
-
         /**
          * Waits for an AVR event of a specific type.
          *
          * @tparam AvrEventType
          *  Type of AVR event to wait for. See AvrEvent class for more.
          *
-         * @param maximumAttempts
-         *  Maximum number of attempts to poll the debug tool for the expected event.
+         * The EDBG protocol provides no means of blocking on the event channel - events can only be obtained by
+         * polling the tool. So we poll back-to-back for a short period (AVR_EVENT_SPIN_DURATION), and then back off
+         * with an increasing interval (up to AVR_EVENT_MAXIMUM_POLL_INTERVAL), until the timeout is reached.
+         *
+         * Events of any other type are discarded.
+         *
+         * @param timeout
+         *  Maximum duration to wait for the expected event.
          *
          * @return
-         *  If an event is found before maximumAttempts is reached, the event will be returned. Otherwise a nullptr
+         *  If an event is found before the timeout is reached, the event will be returned. Otherwise a nullptr
          *  will be returned.
          */
         template <class AvrEventType>
-        std::unique_ptr<AvrEventType> waitForAvrEvent(int maximumAttempts = 20) {
-            int attemptCount = 0;
-
-            while (attemptCount <= maximumAttempts) {
+        std::unique_ptr<AvrEventType> waitForAvrEvent(
+            std::chrono::milliseconds timeout = std::chrono::milliseconds(1000)
+        ) {
+            const auto startTime = std::chrono::steady_clock::now();
+            const auto deadline = startTime + timeout;
+            auto pollInterval = std::chrono::milliseconds(1);
+
+            while (true) {
                 auto genericEvent = this->getAvrEvent();
 
                 if (genericEvent != nullptr) {
@@ -607,13 +1145,23 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
                     if (event != nullptr) {
                         return event;
                     }
+
+                    // Another event may already be queued - check again before waiting
+                    continue;
                 }
 
-                std::this_thread::sleep_for(std::chrono::milliseconds(50));
-                attemptCount++;
-            }
+                const auto now = std::chrono::steady_clock::now();
+                if (now >= deadline) {
+                    return nullptr;
+                }
 
-            return nullptr;
+                if ((now - startTime) < EdbgAvr8Interface::AVR_EVENT_SPIN_DURATION) {
+                    continue;
+                }
+
+                std::this_thread::sleep_until(std::min(now + pollInterval, deadline));
+                pollInterval = std::min(pollInterval * 2, EdbgAvr8Interface::AVR_EVENT_MAXIMUM_POLL_INTERVAL);
+            }
         }
 
         /**
@@ -625,5 +1173,13 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          * This should only be used when a BreakEvent is always expected.
          */
         void waitForStoppedEvent();
+
+        /**
+         * Probes the debug tool with a side-effect free command, until it accepts commands, or until
+         * TARGET_READINESS_TIMEOUT has elapsed. Used after a target reset, in place of a fixed delay.
+         *
+         * This function will not throw an exception if the timeout is reached - it just returns.
+         */
+        void waitForTargetReadiness();
     };
 }
@@ -1,5 +1,7 @@
 #include "EdbgAvrIspInterface.hpp"
 
+#include <algorithm>
+
 #include "src/TargetController/Exceptions/TargetOperationFailure.hpp"
 #include "src/Logger/Logger.hpp"
 
@@ -10,6 +12,12 @@
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVRISP/ReadFuse.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVRISP/ReadLock.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVRISP/ProgramFuse.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVRISP/ChipErase.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVRISP/LoadAddress.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVRISP/ReadFlash.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVRISP/ProgramFlash.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVRISP/ReadEeprom.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVRISP/ProgramEeprom.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
 {
@@ -21,6 +29,12 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     using CommandFrames::AvrIsp::ReadFuse;
     using CommandFrames::AvrIsp::ReadLock;
     using CommandFrames::AvrIsp::ProgramFuse;
+    using CommandFrames::AvrIsp::ChipErase;
+    using CommandFrames::AvrIsp::LoadAddress;
+    using CommandFrames::AvrIsp::ReadFlash;
+    using CommandFrames::AvrIsp::ProgramFlash;
+    using CommandFrames::AvrIsp::ReadEeprom;
+    using CommandFrames::AvrIsp::ProgramEeprom;
 
     using ResponseFrames::AvrIsp::StatusCode;
 
@@ -125,6 +139,151 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
     }
 
+    void EdbgAvrIspInterface::eraseChip() {
+        if (!this->ispParameters.chipEraseDelay.has_value() || !this->ispParameters.chipErasePollMethod.has_value()) {
+            throw TargetOperationFailure("Missing chip erase parameters - cannot perform a chip erase via ISP");
+        }
+
+        const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+            ChipErase(*(this->ispParameters.chipEraseDelay), *(this->ispParameters.chipErasePollMethod))
+        );
+
+        if (responseFrame.statusCode != StatusCode::OK) {
+            throw TargetOperationFailure(
+                "Failed to erase chip via ISP - response frame status code indicates a failure."
+            );
+        }
+    }
+
+    Targets::TargetMemoryBuffer EdbgAvrIspInterface::readProgramMemory(
+        std::uint32_t startAddress,
+        std::uint32_t bytes
+    ) {
+        auto output = Targets::TargetMemoryBuffer();
+        output.reserve(bytes);
+
+        // The program memory is word addressed, and the read command reads whole words
+        assert((startAddress % 2) == 0 && (bytes % 2) == 0);
+        this->loadAddress(startAddress / 2);
+
+        while (output.size() < bytes) {
+            const auto readSize = static_cast<std::uint16_t>(
+                std::min(
+                    bytes - static_cast<std::uint32_t>(output.size()),
+                    static_cast<std::uint32_t>(this->ispParameters.programMemoryReadBlockSize)
+                )
+            );
+
+            const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+                ReadFlash(readSize)
+            );
+
+            if (
+                responseFrame.statusCode != StatusCode::OK
+                || responseFrame.payload.size() < static_cast<std::size_t>(readSize) + 3
+                || static_cast<StatusCode>(responseFrame.payload[readSize + 2]) != StatusCode::OK
+            ) {
+                throw TargetOperationFailure(
+                    "Failed to read program memory via ISP - response frame status code/size indicates a failure."
+                );
+            }
+
+            output.insert(
+                output.end(),
+                responseFrame.payload.begin() + 2,
+                responseFrame.payload.begin() + 2 + readSize
+            );
+        }
+
+        return output;
+    }
+
+    void EdbgAvrIspInterface::writeProgramMemory(std::uint32_t startAddress, std::span<const unsigned char> buffer) {
+        const auto& parameters = EdbgAvrIspInterface::getProgrammingParameters(
+            this->ispParameters.programMemoryProgramming,
+            "program memory"
+        );
+
+        assert((startAddress % parameters.blockSize) == 0 && (buffer.size() % parameters.blockSize) == 0);
+
+        for (auto offset = std::size_t(0); offset < buffer.size(); offset += parameters.blockSize) {
+            this->loadAddress(static_cast<std::uint32_t>(startAddress + offset) / 2);
+
+            const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+                ProgramFlash(parameters, true, buffer.subspan(offset, parameters.blockSize))
+            );
+
+            if (responseFrame.statusCode != StatusCode::OK) {
+                throw TargetOperationFailure(
+                    "Failed to write program memory page (address: " + std::to_string(startAddress + offset)
+                        + ") via ISP - response frame status code indicates a failure."
+                );
+            }
+        }
+    }
+
+    Targets::TargetMemoryBuffer EdbgAvrIspInterface::readEeprom(std::uint32_t startAddress, std::uint32_t bytes) {
+        auto output = Targets::TargetMemoryBuffer();
+        output.reserve(bytes);
+
+        this->loadAddress(startAddress);
+
+        while (output.size() < bytes) {
+            const auto readSize = static_cast<std::uint16_t>(
+                std::min(
+                    bytes - static_cast<std::uint32_t>(output.size()),
+                    static_cast<std::uint32_t>(this->ispParameters.eepromReadBlockSize)
+                )
+            );
+
+            const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+                ReadEeprom(readSize)
+            );
+
+            if (
+                responseFrame.statusCode != StatusCode::OK
+                || responseFrame.payload.size() < static_cast<std::size_t>(readSize) + 3
+                || static_cast<StatusCode>(responseFrame.payload[readSize + 2]) != StatusCode::OK
+            ) {
+                throw TargetOperationFailure(
+                    "Failed to read EEPROM via ISP - response frame status code/size indicates a failure."
+                );
+            }
+
+            output.insert(
+                output.end(),
+                responseFrame.payload.begin() + 2,
+                responseFrame.payload.begin() + 2 + readSize
+            );
+        }
+
+        return output;
+    }
+
+    void EdbgAvrIspInterface::writeEeprom(std::uint32_t startAddress, std::span<const unsigned char> buffer) {
+        const auto& parameters = EdbgAvrIspInterface::getProgrammingParameters(
+            this->ispParameters.eepromProgramming,
+            "EEPROM"
+        );
+
+        assert((startAddress % parameters.blockSize) == 0 && (buffer.size() % parameters.blockSize) == 0);
+
+        for (auto offset = std::size_t(0); offset < buffer.size(); offset += parameters.blockSize) {
+            this->loadAddress(static_cast<std::uint32_t>(startAddress + offset));
+
+            const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+                ProgramEeprom(parameters, true, buffer.subspan(offset, parameters.blockSize))
+            );
+
+            if (responseFrame.statusCode != StatusCode::OK) {
+                throw TargetOperationFailure(
+                    "Failed to write EEPROM (address: " + std::to_string(startAddress + offset)
+                        + ") via ISP - response frame status code indicates a failure."
+                );
+            }
+        }
+    }
+
     unsigned char EdbgAvrIspInterface::readSignatureByte(std::uint8_t signatureByteAddress) {
         const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
             ReadSignature(signatureByteAddress, this->ispParameters.readSignaturePollIndex)
@@ -143,4 +302,31 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
 
         return responseFrame.payload[2];
     }
+
+    void EdbgAvrIspInterface::loadAddress(std::uint32_t address) {
+        // Bit 31 instructs the debug tool to issue the "load extended address" command, for word addresses > 0xFFFF
+        const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+            LoadAddress(address > 0xFFFF ? (address | 0x80000000) : address)
+        );
+
+        if (responseFrame.statusCode != StatusCode::OK) {
+            throw TargetOperationFailure(
+                "Failed to load address (" + std::to_string(address) + ") via ISP - response frame status code "
+                    "indicates a failure."
+            );
+        }
+    }
+
+    const IspMemoryProgrammingParameters& EdbgAvrIspInterface::getProgrammingParameters(
+        const std::optional<IspMemoryProgrammingParameters>& parameters,
+        const std::string& memoryName
+    ) {
+        if (!parameters.has_value()) {
+            throw TargetOperationFailure(
+                "Missing " + memoryName + " programming parameters - cannot program " + memoryName + " via ISP"
+            );
+        }
+
+        return *parameters;
+    }
 }
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
+#include <optional>
+#include <span>
 #include <chrono>
 #include <thread>
 #include <cassert>
@@ -80,6 +83,47 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         void programFuse(Targets::Microchip::Avr::Fuse fuse) override;
 
+        /**
+         * Performs a chip erase, using the erase delay and poll method from the target's ISP parameters.
+         */
+        void eraseChip() override;
+
+        /**
+         * Reads from the target's program memory, in blocks of IspParameters::programMemoryReadBlockSize bytes.
+         *
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         */
+        Targets::TargetMemoryBuffer readProgramMemory(std::uint32_t startAddress, std::uint32_t bytes) override;
+
+        /**
+         * Writes to the target's program memory, one page at a time.
+         *
+         * @param startAddress
+         * @param buffer
+         */
+        void writeProgramMemory(std::uint32_t startAddress, std::span<const unsigned char> buffer) override;
+
+        /**
+         * Reads from the target's EEPROM, in blocks of IspParameters::eepromReadBlockSize bytes.
+         *
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         */
+        Targets::TargetMemoryBuffer readEeprom(std::uint32_t startAddress, std::uint32_t bytes) override;
+
+        /**
+         * Writes to the target's EEPROM, one page (or block) at a time.
+         *
+         * @param startAddress
+         * @param buffer
+         */
+        void writeEeprom(std::uint32_t startAddress, std::span<const unsigned char> buffer) override;
+
     private:
         /**
          * The AVRISP protocol is a sub-protocol of the EDBG AVR protocol, which is served via CMSIS-DAP vendor
@@ -100,5 +144,27 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          * @return
          */
         [[nodiscard]] unsigned char readSignatureByte(std::uint8_t signatureByteAddress);
+
+        /**
+         * Sets the address for the next read/program memory command.
+         *
+         * @param address
+         *  Word address for program memory, byte address for EEPROM.
+         */
+        void loadAddress(std::uint32_t address);
+
+        /**
+         * Obtains the program memory/EEPROM programming parameters, or throws an exception if the target's TDF
+         * didn't provide them.
+         *
+         * @param parameters
+         * @param memoryName
+         *
+         * @return
+         */
+        static const Targets::Microchip::Avr::IspMemoryProgrammingParameters& getProgrammingParameters(
+            const std::optional<Targets::Microchip::Avr::IspMemoryProgrammingParameters>& parameters,
+            const std::string& memoryName
+        );
     };
 }
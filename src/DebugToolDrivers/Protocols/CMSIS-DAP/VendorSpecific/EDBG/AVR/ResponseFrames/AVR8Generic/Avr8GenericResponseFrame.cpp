@@ -6,8 +6,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
 {
     using namespace Bloom::Exceptions;
 
-    Avr8GenericResponseFrame::Avr8GenericResponseFrame(const std::vector<AvrResponse>& avrResponses)
-        : AvrResponseFrame(avrResponses)
+    Avr8GenericResponseFrame::Avr8GenericResponseFrame(std::span<const unsigned char> rawFrame)
+        : AvrResponseFrame(rawFrame)
     {
         if (this->payload.empty()) {
             throw Exception("Response ID missing from AVR8 Generic response frame payload.");
@@ -10,7 +10,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
     public:
         Avr8ResponseId id;
 
-        explicit Avr8GenericResponseFrame(const std::vector<AvrResponse>& avrResponses);
+        explicit Avr8GenericResponseFrame(std::span<const unsigned char> rawFrame);
 
         [[nodiscard]] std::vector<unsigned char> getPayloadData() const;
     };
@@ -2,8 +2,8 @@
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrames::Avr8Generic
 {
-    GetDeviceId::GetDeviceId(const std::vector<AvrResponse>& AvrResponses)
-        : Avr8GenericResponseFrame(AvrResponses)
+    GetDeviceId::GetDeviceId(std::span<const unsigned char> rawFrame)
+        : Avr8GenericResponseFrame(rawFrame)
     {}
 
     Targets::Microchip::Avr::TargetSignature GetDeviceId::extractSignature(
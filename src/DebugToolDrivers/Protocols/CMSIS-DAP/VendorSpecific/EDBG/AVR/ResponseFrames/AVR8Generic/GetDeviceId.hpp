@@ -10,7 +10,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
     class GetDeviceId: public Avr8GenericResponseFrame
     {
     public:
-        explicit GetDeviceId(const std::vector<AvrResponse>& AvrResponses);
+        explicit GetDeviceId(std::span<const unsigned char> rawFrame);
 
         Targets::Microchip::Avr::TargetSignature extractSignature(
             Targets::Microchip::Avr::Avr8Bit::PhysicalInterface physicalInterface
@@ -13,8 +13,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
     class GetProgramCounter: public Avr8GenericResponseFrame
     {
     public:
-        explicit GetProgramCounter(const std::vector<AvrResponse>& avrResponses)
-            : Avr8GenericResponseFrame(avrResponses)
+        explicit GetProgramCounter(std::span<const unsigned char> rawFrame)
+            : Avr8GenericResponseFrame(rawFrame)
         {}
 
         Targets::TargetProgramCounter extractProgramCounter() const {
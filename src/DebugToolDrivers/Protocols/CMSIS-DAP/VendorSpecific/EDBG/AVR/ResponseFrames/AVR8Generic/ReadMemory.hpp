@@ -1,26 +1,34 @@
 #pragma once
 
+#include <span>
+
 #include "Avr8GenericResponseFrame.hpp"
-#include "src/Targets/TargetMemory.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrames::Avr8Generic
 {
     class ReadMemory: public Avr8GenericResponseFrame
     {
     public:
-        explicit ReadMemory(const std::vector<AvrResponse>& avrResponses)
-            : Avr8GenericResponseFrame(avrResponses)
+        explicit ReadMemory(std::span<const unsigned char> rawFrame)
+            : Avr8GenericResponseFrame(rawFrame)
         {}
 
-        Targets::TargetMemoryBuffer getMemoryData() const {
+        /**
+         * Returns a view of the memory data, within the frame's payload. Like the payload, the view is only valid
+         * until the next response frame is collected - the data should be copied straight into its destination.
+         *
+         * @return
+         */
+        std::span<const unsigned char> getMemoryData() const {
             /*
              * AVR8 data payloads are typically in little endian form, but this does not apply to the data returned
              * from the READ MEMORY commands.
              */
-            return std::vector<unsigned char>(
-                this->payload.begin() + 2,
-                this->payload.end() - 1
-            );
+            if (this->payload.size() < 3) {
+                return {};
+            }
+
+            return this->payload.subspan(2, this->payload.size() - 3);
         }
     };
 }
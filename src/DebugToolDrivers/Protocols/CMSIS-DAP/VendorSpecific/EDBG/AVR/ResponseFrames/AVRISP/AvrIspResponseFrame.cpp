@@ -6,8 +6,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
 {
     using namespace Bloom::Exceptions;
 
-    AvrIspResponseFrame::AvrIspResponseFrame(const std::vector<AvrResponse>& avrResponses)
-        : AvrResponseFrame(avrResponses)
+    AvrIspResponseFrame::AvrIspResponseFrame(std::span<const unsigned char> rawFrame)
+        : AvrResponseFrame(rawFrame)
     {
         if (this->payload.size() < 2) {
             throw Exception("Status code missing from AVRISP response frame payload.");
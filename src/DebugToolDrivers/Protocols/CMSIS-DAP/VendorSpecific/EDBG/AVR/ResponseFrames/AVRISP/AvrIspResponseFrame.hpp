@@ -16,6 +16,6 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
     public:
         StatusCode statusCode;
 
-        explicit AvrIspResponseFrame(const std::vector<AvrResponse>& avrResponses);
+        explicit AvrIspResponseFrame(std::span<const unsigned char> rawFrame);
     };
 }
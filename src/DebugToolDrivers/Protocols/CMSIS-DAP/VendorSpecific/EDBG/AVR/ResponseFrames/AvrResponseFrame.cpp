@@ -6,18 +6,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
 {
     using namespace Bloom::Exceptions;
 
-    void AvrResponseFrame::initFromAvrResponses(const std::vector<AvrResponse>& avrResponses) {
-        // Build a raw frame buffer from the AvrResponse objects and just call initFromRawFrame()
-        auto rawFrame = std::vector<unsigned char>();
-
-        for (const auto& avrResponse : avrResponses) {
-            rawFrame.insert(rawFrame.end(), avrResponse.responsePacket.begin(), avrResponse.responsePacket.end());
-        }
-
-        return this->initFromRawFrame(rawFrame);
-    }
-
-    void AvrResponseFrame::initFromRawFrame(const std::vector<unsigned char>& rawFrame) {
+    void AvrResponseFrame::initFromRawFrame(std::span<const unsigned char> rawFrame) {
         if (rawFrame.size() < 4) {
             /*
              * All AVR response frames must consist of at least four bytes (SOF, sequence ID (two bytes) and
@@ -34,6 +23,6 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         this->sequenceId = static_cast<std::uint16_t>((rawFrame[2] << 8) + rawFrame[1]);
         this->protocolHandlerId = static_cast<ProtocolHandlerId>(rawFrame[3]);
 
-        this->payload.insert(payload.begin(), rawFrame.begin() + 4, rawFrame.end());
+        this->payload = rawFrame.subspan(4);
     }
 }
@@ -2,15 +2,22 @@
 
 #include <cstdint>
 #include <vector>
+#include <span>
 #include <algorithm>
 #include <memory>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Command.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/Edbg.hpp"
-#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrResponse.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
 {
+    /**
+     * AvrResponseFrame objects do not own their data. The payload is a view into the buffer that the frame was
+     * reassembled in (see EdbgInterface::requestAvrResponseFrame()), which is reused for the next response frame.
+     *
+     * So an AvrResponseFrame must be consumed before any other AVR command frame is sent to the debug tool. Any
+     * data that is to be kept beyond that point must be copied out of the frame.
+     */
     class AvrResponseFrame
     {
     public:
@@ -24,10 +31,14 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         ProtocolHandlerId protocolHandlerId = ProtocolHandlerId::AVR8_GENERIC;
 
-        std::vector<unsigned char> payload;
+        std::span<const unsigned char> payload;
 
-        explicit AvrResponseFrame(const std::vector<AvrResponse>& avrResponses) {
-            this->initFromAvrResponses(avrResponses);
+        /**
+         * @param rawFrame
+         *  The reassembled frame, consisting of the SOF byte, sequence ID, protocol handler ID and payload.
+         */
+        explicit AvrResponseFrame(std::span<const unsigned char> rawFrame) {
+            this->initFromRawFrame(rawFrame);
         }
 
         virtual ~AvrResponseFrame() = default;
@@ -38,16 +49,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         AvrResponseFrame& operator = (const AvrResponseFrame& other) = default;
         AvrResponseFrame& operator = (AvrResponseFrame&& other) = default;
 
-        /**
-         * An AvrResponse contains a single fragment of an AvrResponseFrame.
-         *
-         * This method will construct an AvrResponseFrame from a vector of AvrResponse.
-         *
-         * @param avrResponses
-         */
-        void initFromAvrResponses(const std::vector<AvrResponse>& avrResponses);
-
     private:
-        virtual void initFromRawFrame(const std::vector<unsigned char>& rawFrame);
+        void initFromRawFrame(std::span<const unsigned char> rawFrame);
     };
 }
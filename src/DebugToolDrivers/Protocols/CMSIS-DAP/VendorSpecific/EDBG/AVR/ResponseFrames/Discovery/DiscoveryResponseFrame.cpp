@@ -6,8 +6,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
 {
     using namespace Bloom::Exceptions;
 
-    DiscoveryResponseFrame::DiscoveryResponseFrame(const std::vector<AvrResponse>& avrResponses)
-        : AvrResponseFrame(avrResponses)
+    DiscoveryResponseFrame::DiscoveryResponseFrame(std::span<const unsigned char> rawFrame)
+        : AvrResponseFrame(rawFrame)
     {
         if (this->payload.empty()) {
             throw Exception("Response ID missing from DISCOVERY response frame payload.");
@@ -22,7 +22,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
     public:
         ResponseId id;
 
-        explicit DiscoveryResponseFrame(const std::vector<AvrResponse>& avrResponses);
+        explicit DiscoveryResponseFrame(std::span<const unsigned char> rawFrame);
 
         std::vector<unsigned char> getPayloadData() const;
     };
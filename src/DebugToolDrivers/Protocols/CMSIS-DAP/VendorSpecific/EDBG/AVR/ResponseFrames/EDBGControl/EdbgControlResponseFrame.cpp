@@ -6,8 +6,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
 {
     using namespace Bloom::Exceptions;
 
-    EdbgControlResponseFrame::EdbgControlResponseFrame(const std::vector<AvrResponse>& avrResponses)
-        : AvrResponseFrame(avrResponses)
+    EdbgControlResponseFrame::EdbgControlResponseFrame(std::span<const unsigned char> rawFrame)
+        : AvrResponseFrame(rawFrame)
     {
         if (this->payload.empty()) {
             throw Exception("Response ID missing from EDBG Control response frame payload.");
@@ -16,7 +16,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
     public:
         EdbgControlResponseId id;
 
-        explicit EdbgControlResponseFrame(const std::vector<AvrResponse>& avrResponses);
+        explicit EdbgControlResponseFrame(std::span<const unsigned char> rawFrame);
 
         [[nodiscard]] std::vector<unsigned char> getPayloadData();
     };
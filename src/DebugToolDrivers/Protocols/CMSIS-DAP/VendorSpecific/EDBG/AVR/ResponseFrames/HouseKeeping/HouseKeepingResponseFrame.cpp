@@ -6,8 +6,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
 {
     using namespace Bloom::Exceptions;
 
-    HouseKeepingResponseFrame::HouseKeepingResponseFrame(const std::vector<AvrResponse>& avrResponses)
-        : AvrResponseFrame(avrResponses)
+    HouseKeepingResponseFrame::HouseKeepingResponseFrame(std::span<const unsigned char> rawFrame)
+        : AvrResponseFrame(rawFrame)
     {
         if (this->payload.empty()) {
             throw Exception("Response ID missing from HOUSEKEEPING response frame payload.");
@@ -15,4 +15,16 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
 
         this->id = static_cast<ResponseId>(this->payload[0]);
     }
+
+    std::vector<unsigned char> HouseKeepingResponseFrame::getPayloadData() const {
+        if (this->payload.size() <= 2) {
+            return {};
+        }
+
+        // HOUSEKEEPING payloads include two bytes before the data (response ID and version byte).
+        return std::vector<unsigned char>(
+            this->payload.begin() + 2,
+            this->payload.end()
+        );
+    }
 }
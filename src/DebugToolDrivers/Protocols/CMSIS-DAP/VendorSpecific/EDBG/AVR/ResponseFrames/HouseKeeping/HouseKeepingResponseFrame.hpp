@@ -18,6 +18,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::ResponseFrame
     public:
         ResponseId id;
 
-        explicit HouseKeepingResponseFrame(const std::vector<AvrResponse>& avrResponses);
+        explicit HouseKeepingResponseFrame(std::span<const unsigned char> rawFrame);
+
+        [[nodiscard]] std::vector<unsigned char> getPayloadData() const;
     };
 }
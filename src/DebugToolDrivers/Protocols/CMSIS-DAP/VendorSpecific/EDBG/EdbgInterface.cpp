@@ -1,20 +1,27 @@
 #include "EdbgInterface.hpp"
 
 #include <memory>
+#include <chrono>
+#include <algorithm>
+#include <string>
 
 #include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+#include "src/Services/TraceService.hpp"
+#include "src/Services/MetricsService.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
 {
     using namespace Bloom::Exceptions;
 
-    EdbgInterface::EdbgInterface(Usb::HidInterface&& cmsisHidInterface)
-        : CmsisDapInterface(std::move(cmsisHidInterface))
+    EdbgInterface::EdbgInterface(std::unique_ptr<Usb::PacketInterface> cmsisUsbInterface)
+        : CmsisDapInterface(std::move(cmsisUsbInterface))
     {}
 
     Protocols::CmsisDap::Response EdbgInterface::sendAvrCommandsAndWaitForResponse(
         const std::vector<Avr::AvrCommand>& avrCommands
     ) {
+        const auto traceSpan = Services::TraceService::Span("EdbgInterface::sendAvrCommandsAndWaitForResponse", "EDBG");
+
         for (const auto& avrCommand : avrCommands) {
             // Send command to device
             auto response = this->sendCommandAndWaitForResponse(avrCommand);
@@ -30,6 +37,89 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
         );
     }
 
+    Protocols::CmsisDap::Response EdbgInterface::sendAvrCommandFrameSegments(
+        const std::array<std::span<const unsigned char>, 3>& segments
+    ) {
+        const auto traceSpan = Services::TraceService::Span("EdbgInterface::sendAvrCommandFrameSegments", "EDBG");
+
+        static auto& framesIssued = Services::MetricsService::counter("edbg.avrFramesIssued");
+        framesIssued.increment();
+
+        const auto reportSize = static_cast<std::size_t>(this->getUsbPacketSize());
+
+        // Minus 4 to accommodate AVR command bytes (command ID, fragment info and size)
+        const auto maximumFragmentSize = reportSize - 4;
+
+        auto frameSize = std::size_t(0);
+        for (const auto& segment : segments) {
+            frameSize += segment.size();
+        }
+
+        // The fragment count and number share a single byte in the AVR command
+        const auto fragmentCount = (frameSize + maximumFragmentSize - 1) / maximumFragmentSize;
+        if (fragmentCount == 0 || fragmentCount > 0x0F) {
+            throw DeviceCommunicationFailure(
+                "Cannot send AVR command frame - invalid frame size (" + std::to_string(frameSize) + " bytes)"
+            );
+        }
+
+        auto& report = this->avrCommandReportBuffer;
+        report.resize(reportSize);
+
+        auto segmentIndex = std::size_t(0);
+        auto segmentOffset = std::size_t(0);
+
+        for (auto fragmentNumber = std::size_t(1); fragmentNumber <= fragmentCount; ++fragmentNumber) {
+            const auto fragmentSize = std::min(
+                maximumFragmentSize,
+                frameSize - (maximumFragmentSize * (fragmentNumber - 1))
+            );
+
+            report[0] = 0x80;
+            report[1] = static_cast<unsigned char>((fragmentNumber << 4) | fragmentCount);
+            report[2] = static_cast<unsigned char>(fragmentSize >> 8);
+            report[3] = static_cast<unsigned char>(fragmentSize & 0xFF);
+
+            auto reportOffset = std::size_t(4);
+            while (reportOffset < (fragmentSize + 4)) {
+                const auto& segment = segments[segmentIndex];
+                const auto copySize = std::min(fragmentSize + 4 - reportOffset, segment.size() - segmentOffset);
+
+                std::copy_n(
+                    segment.begin() + static_cast<std::int64_t>(segmentOffset),
+                    copySize,
+                    report.begin() + static_cast<std::int64_t>(reportOffset)
+                );
+
+                reportOffset += copySize;
+                segmentOffset += copySize;
+
+                if (segmentOffset == segment.size()) {
+                    ++segmentIndex;
+                    segmentOffset = 0;
+                }
+            }
+
+            std::fill(report.begin() + static_cast<std::int64_t>(reportOffset), report.end(), 0x00);
+
+            this->sendReport(report);
+            auto response = this->getResponse<Protocols::CmsisDap::Response>();
+
+            if (response.id != 0x80) {
+                throw DeviceCommunicationFailure("Unexpected response to CMSIS-DAP command.");
+            }
+
+            if (fragmentNumber == fragmentCount) {
+                return response;
+            }
+        }
+
+        // This should never happen
+        throw DeviceCommunicationFailure(
+            "Cannot send AVR command frame - failed to generate CMSIS-DAP Vendor (AVR) commands"
+        );
+    }
+
     std::optional<Protocols::CmsisDap::Edbg::Avr::AvrEvent> EdbgInterface::requestAvrEvent() {
         auto avrEventResponse = this->sendCommandAndWaitForResponse(Avr::AvrEventCommand());
 
@@ -40,40 +130,101 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
         return !avrEventResponse.eventData.empty() ? std::optional(avrEventResponse) : std::nullopt;
     }
 
-    std::vector<Protocols::CmsisDap::Edbg::Avr::AvrResponse> EdbgInterface::requestAvrResponses() {
-        using Protocols::CmsisDap::Edbg::Avr::AvrResponseCommand;
+    EdbgInterface::AvrResponseFragment EdbgInterface::requestAvrResponseFragment() {
+        const auto reportSize = static_cast<std::size_t>(this->getUsbPacketSize());
 
-        std::vector<Protocols::CmsisDap::Edbg::Avr::AvrResponse> responses;
-        AvrResponseCommand responseCommand;
+        // The AvrResponseCommand consists of the command ID and nothing more
+        auto& commandReport = this->avrCommandReportBuffer;
+        commandReport.assign(reportSize, 0x00);
+        commandReport[0] = 0x81;
 
-        auto avrResponse = this->sendCommandAndWaitForResponse(responseCommand);
-        responses.push_back(avrResponse);
-        const auto fragmentCount = avrResponse.fragmentCount;
+        auto& responseReport = this->avrResponseReportBuffer;
+        responseReport.resize(reportSize);
 
-        while (responses.size() < fragmentCount) {
-            // There are more response packets
-            auto avrResponse = this->sendCommandAndWaitForResponse(responseCommand);
+        this->sendReport(commandReport);
+        const auto responseSize = this->getUsbInterface().readPacket(
+            responseReport,
+            EdbgInterface::AVR_RESPONSE_TIMEOUT
+        );
 
-            if (avrResponse.fragmentCount != fragmentCount) {
-                throw DeviceCommunicationFailure(
-                    "Failed to fetch AvrResponse objects - invalid fragment count returned."
-                );
+        if (responseSize == 0) {
+            throw DeviceCommunicationFailure("Empty CMSIS-DAP response received");
+        }
+
+        if (responseReport[0] != 0x81) {
+            throw DeviceCommunicationFailure("Unexpected response to AvrResponseCommand from device");
+        }
+
+        if (responseSize < 2) {
+            // All AVR responses should contain at least one byte (the fragment info byte) after the response ID
+            throw DeviceCommunicationFailure("Failed to process AvrResponse - malformed AVR_RSP data");
+        }
+
+        auto fragment = AvrResponseFragment();
+
+        if (responseReport[1] == 0x00) {
+            // The device had no data to send
+            return fragment;
+        }
+
+        fragment.fragmentCount = static_cast<std::uint8_t>(responseReport[1] & 0x0FU);
+        fragment.fragmentNumber = static_cast<std::uint8_t>(responseReport[1] >> 4);
+
+        // Fragment size is two bytes, MSB
+        const auto packetSize = static_cast<std::size_t>((responseReport[2] << 8U) + responseReport[3]);
+        if (responseSize < 4 || packetSize > responseSize - 4) {
+            throw DeviceCommunicationFailure("Failed to process AvrResponse - invalid fragment size");
+        }
+
+        fragment.packet = std::span<const unsigned char>(responseReport).subspan(4, packetSize);
+        return fragment;
+    }
+
+    std::span<const unsigned char> EdbgInterface::requestAvrResponseFrame() {
+        auto& frame = this->avrResponseFrameBuffer;
+        frame.clear();
+
+        auto fragment = this->requestAvrResponseFragment();
+
+        /*
+         * If the tool is still processing the command frame (which is common when frames are pipelined), it will
+         * respond with an empty AVR response. We keep asking until the response frame is ready.
+         */
+        const auto pollDeadline = std::chrono::steady_clock::now() + EdbgInterface::AVR_RESPONSE_TIMEOUT;
+        while (fragment.fragmentCount == 0) {
+            if (std::chrono::steady_clock::now() >= pollDeadline) {
+                throw DeviceCommunicationFailure("Timed out waiting for AvrResponse from device");
             }
 
-            if (avrResponse.fragmentCount == 0 && avrResponse.fragmentNumber == 0) {
+            this->reportDeviceBusy();
+            fragment = this->requestAvrResponseFragment();
+        }
+
+        this->reportDeviceReady();
+
+        frame.insert(frame.end(), fragment.packet.begin(), fragment.packet.end());
+        const auto fragmentCount = fragment.fragmentCount;
+        auto fragmentsReceived = std::size_t(1);
+
+        while (fragmentsReceived < fragmentCount) {
+            // There are more fragments
+            fragment = this->requestAvrResponseFragment();
+
+            if (fragment.fragmentCount != fragmentCount) {
                 throw DeviceCommunicationFailure(
-                    "Failed to fetch AvrResponse objects - unexpected empty response"
+                    "Failed to fetch AvrResponse objects - invalid fragment count returned."
                 );
             }
 
-            if (avrResponse.fragmentNumber == 0) {
+            if (fragment.fragmentNumber == 0) {
                 // End of response data ( &this packet can be ignored)
                 break;
             }
 
-            responses.push_back(avrResponse);
+            frame.insert(frame.end(), fragment.packet.begin(), fragment.packet.end());
+            ++fragmentsReceived;
         }
 
-        return responses;
+        return frame;
     }
 }
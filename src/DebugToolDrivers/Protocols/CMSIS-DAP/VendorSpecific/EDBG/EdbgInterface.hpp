@@ -3,14 +3,18 @@
 #include <memory>
 #include <optional>
 #include <vector>
+#include <queue>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <array>
+#include <span>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/CmsisDapInterface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrCommand.hpp"
-#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrResponse.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrEventCommand.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrEvent.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AvrCommandFrame.hpp"
-#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrResponseCommand.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/ResponseFrames/AvrResponseFrame.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AvrCommandFrame.hpp"
 #include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
@@ -24,7 +28,19 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
     class EdbgInterface: public CmsisDapInterface
     {
     public:
-        explicit EdbgInterface(Usb::HidInterface&& cmsisHidInterface);
+        /**
+         * The maximum number of AvrCommandFrames that we allow to be in flight at any one time, when pipelining
+         * frames (see EdbgInterface::sendAvrCommandFramesAndProcessResponseFrames()). One frame being processed by
+         * the tool, and one waiting behind it.
+         */
+        static constexpr std::size_t MAXIMUM_AVR_COMMAND_FRAMES_IN_FLIGHT = 2;
+
+        /**
+         * How long we're willing to wait for the tool to produce a response frame.
+         */
+        static constexpr auto AVR_RESPONSE_TIMEOUT = std::chrono::milliseconds(60000);
+
+        explicit EdbgInterface(std::unique_ptr<Usb::PacketInterface> cmsisUsbInterface);
 
         /**
          * Send an AvrCommandFrame to the debug tool and wait for a response.
@@ -44,9 +60,12 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
              * An AVR command frame can be split into multiple CMSIS-DAP commands. Each command containing a fragment
              * of the AvrCommandFrame.
              */
-            return this->sendAvrCommandsAndWaitForResponse(avrCommandFrame.generateAvrCommands(
-                this->getUsbHidInputReportSize() - 4 // Minus 4 to accommodate AVR command bytes
-            ));
+            const auto header = avrCommandFrame.getRawCommandFrameHeader();
+            return this->sendAvrCommandFrameSegments({
+                std::span<const unsigned char>(header),
+                std::span<const unsigned char>(avrCommandFrame.payload),
+                avrCommandFrame.externalPayload,
+            });
         }
 
         virtual Protocols::CmsisDap::Response sendAvrCommandsAndWaitForResponse(
@@ -65,21 +84,225 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
                 "AVR Command must specify a valid response frame type, derived from AvrResponseFrame."
             );
 
-            const auto response = this->sendAvrCommandFrameAndWaitForResponse(avrCommandFrame);
-
-            if (response.data[0] != 0x01) {
-                // The last response packet should always acknowledge receipt of the AvrCommandFrame
+            if (!this->sendAvrCommandFrame(avrCommandFrame)) {
                 throw Exceptions::DeviceCommunicationFailure(
                     "Failed to send AvrCommandFrame to device - device did not acknowledge receipt."
                 );
             }
 
-            return typename CommandFrameType::ExpectedResponseFrameType(this->requestAvrResponses());
+            return this->collectAvrResponseFrame<typename CommandFrameType::ExpectedResponseFrameType>(
+                avrCommandFrame.sequenceId
+            );
+        }
+
+        /**
+         * Sends numerous AvrCommandFrames to the debug tool and processes their response frames, as they arrive.
+         *
+         * Where the debug tool allows it, the frames are pipelined: the next frame is sent whilst the tool is still
+         * processing the previous one, before we collect the previous frame's response. This allows the tool to get
+         * on with the next frame whilst we're waiting on the USB round trips for the previous one. Responses are
+         * matched to their command frames via sequence IDs.
+         *
+         * If the tool refuses to accept a frame whilst another is in progress, we fall back to sending one frame at a
+         * time, for the remainder of the session.
+         *
+         * Response frames are views into a buffer that is reused for every frame (see AvrResponseFrame), so they
+         * cannot be collected and returned to the caller. Instead, each frame is handed to the given handler, which
+         * must copy out any data it needs before returning.
+         *
+         * @param avrCommandFrames
+         *
+         * @param responseFrameHandler
+         *  Invoked with each response frame and the index of its command frame, in the same order as the command
+         *  frames. If the handler throws, any outstanding response frames will be discarded upon the next
+         *  collection (see EdbgInterface::collectAvrResponseFrame()).
+         */
+        template<class CommandFrameType, class ResponseFrameHandlerType>
+        void sendAvrCommandFramesAndProcessResponseFrames(
+            const std::vector<CommandFrameType>& avrCommandFrames,
+            ResponseFrameHandlerType&& responseFrameHandler
+        ) {
+            using ResponseFrameType = typename CommandFrameType::ExpectedResponseFrameType;
+
+            // Sequence IDs of the frames that the tool has accepted, but whose responses we're yet to collect
+            auto pendingSequenceIds = std::queue<std::uint16_t>();
+            auto nextResponseFrameIndex = std::size_t(0);
+
+            const auto collectNextResponseFrame = [
+                this,
+                &responseFrameHandler,
+                &pendingSequenceIds,
+                &nextResponseFrameIndex
+            ] {
+                const auto responseFrame = this->collectAvrResponseFrame<ResponseFrameType>(
+                    pendingSequenceIds.front()
+                );
+                pendingSequenceIds.pop();
+
+                responseFrameHandler(responseFrame, nextResponseFrameIndex++);
+            };
+
+            for (const auto& avrCommandFrame : avrCommandFrames) {
+                if (!pendingSequenceIds.empty() && !this->avrCommandFramePipeliningSupported.value_or(true)) {
+                    collectNextResponseFrame();
+                }
+
+                while (!this->sendAvrCommandFrame(avrCommandFrame)) {
+                    if (pendingSequenceIds.empty()) {
+                        throw Exceptions::DeviceCommunicationFailure(
+                            "Failed to send AvrCommandFrame to device - device did not acknowledge receipt."
+                        );
+                    }
+
+                    // The tool is still busy with the previous frame, and is unable to queue this one.
+                    this->avrCommandFramePipeliningSupported = false;
+                    collectNextResponseFrame();
+                }
+
+                if (!pendingSequenceIds.empty()) {
+                    this->avrCommandFramePipeliningSupported = true;
+                }
+
+                pendingSequenceIds.push(avrCommandFrame.sequenceId);
+
+                if (pendingSequenceIds.size() >= EdbgInterface::MAXIMUM_AVR_COMMAND_FRAMES_IN_FLIGHT) {
+                    collectNextResponseFrame();
+                }
+            }
+
+            while (!pendingSequenceIds.empty()) {
+                collectNextResponseFrame();
+            }
         }
 
         virtual std::optional<Protocols::CmsisDap::Edbg::Avr::AvrEvent> requestAvrEvent();
 
     private:
-        virtual std::vector<Protocols::CmsisDap::Edbg::Avr::AvrResponse> requestAvrResponses();
+        /**
+         * Report buffer for AVR commands, reused for every fragment of every AvrCommandFrame we send. See
+         * EdbgInterface::sendAvrCommandFrameSegments().
+         */
+        std::vector<unsigned char> avrCommandReportBuffer;
+
+        /**
+         * Report buffer for AVR responses (CMSIS-DAP responses to AvrResponseCommands), reused for every fragment of
+         * every AvrResponseFrame we receive. See EdbgInterface::requestAvrResponseFragment().
+         */
+        std::vector<unsigned char> avrResponseReportBuffer;
+
+        /**
+         * The buffer in which AvrResponseFrames are reassembled from their fragments. This is reused for every
+         * response frame - AvrResponseFrame objects hold views into it. See EdbgInterface::requestAvrResponseFrame().
+         */
+        std::vector<unsigned char> avrResponseFrameBuffer;
+
+        /**
+         * Whether the debug tool accepts AvrCommandFrames whilst it's still processing a previous frame. This is
+         * determined on the first attempt to pipeline frames. See
+         * EdbgInterface::sendAvrCommandFramesAndProcessResponseFrames().
+         */
+        std::optional<bool> avrCommandFramePipeliningSupported;
+
+        /**
+         * Sends an AvrCommandFrame to the debug tool, without waiting for the response frame.
+         *
+         * @param avrCommandFrame
+         *
+         * @return
+         *  True if the tool acknowledged receipt of the frame. Otherwise, false.
+         */
+        template <class PayloadContainerType>
+        bool sendAvrCommandFrame(
+            const Protocols::CmsisDap::Edbg::Avr::AvrCommandFrame<PayloadContainerType>& avrCommandFrame
+        ) {
+            const auto response = this->sendAvrCommandFrameAndWaitForResponse(avrCommandFrame);
+
+            // The last response packet should always acknowledge receipt of the AvrCommandFrame
+            if (response.data.empty() || response.data[0] != 0x01) {
+                this->reportDeviceBusy();
+                return false;
+            }
+
+            this->reportDeviceReady();
+            return true;
+        }
+
+        /**
+         * Collects the response frame for a previously sent AvrCommandFrame.
+         *
+         * Any stale response frame (one that doesn't match the given sequence ID) is discarded. This can happen when
+         * we fail to collect the response of a previous frame (due to an exception, for example).
+         *
+         * @param sequenceId
+         *  The sequence ID of the AvrCommandFrame.
+         *
+         * @return
+         */
+        template<class ResponseFrameType>
+        ResponseFrameType collectAvrResponseFrame(std::uint16_t sequenceId) {
+            auto responseFrame = ResponseFrameType(this->requestAvrResponseFrame());
+
+            if (responseFrame.sequenceId != sequenceId) {
+                responseFrame = ResponseFrameType(this->requestAvrResponseFrame());
+
+                if (responseFrame.sequenceId != sequenceId) {
+                    throw Exceptions::DeviceCommunicationFailure(
+                        "Unexpected AvrResponseFrame sequence ID - expected " + std::to_string(sequenceId)
+                            + ", got " + std::to_string(responseFrame.sequenceId)
+                    );
+                }
+            }
+
+            return responseFrame;
+        }
+
+        /**
+         * A single fragment of an AvrResponseFrame, as received in a CMSIS-DAP response to an AvrResponseCommand.
+         */
+        struct AvrResponseFragment
+        {
+            std::uint8_t fragmentNumber = 0;
+            std::uint8_t fragmentCount = 0;
+
+            /**
+             * The fragment data - a view into this->avrResponseReportBuffer.
+             */
+            std::span<const unsigned char> packet;
+        };
+
+        /**
+         * Sends an AvrResponseCommand and reads the response straight into this->avrResponseReportBuffer, without
+         * constructing AvrResponseCommand or AvrResponse objects.
+         *
+         * @return
+         *  The fragment. A fragment count of zero indicates that the tool had no response data to send.
+         */
+        AvrResponseFragment requestAvrResponseFragment();
+
+        /**
+         * Requests all fragments of the next AvrResponseFrame from the debug tool, and reassembles them in
+         * this->avrResponseFrameBuffer. Each fragment is copied straight from the report buffer, into the frame
+         * buffer.
+         *
+         * @return
+         *  A view of the raw frame. This is only valid until the next call to this function.
+         */
+        virtual std::span<const unsigned char> requestAvrResponseFrame();
+
+        /**
+         * Sends a raw AvrCommandFrame, fragmented into as many AVR commands (CMSIS-DAP vendor commands) as required.
+         *
+         * The frame is given as a sequence of segments (header, payload and external payload), which are written
+         * straight into this->avrCommandReportBuffer, one report at a time. This avoids constructing the whole raw
+         * frame, and an AvrCommand object for each fragment.
+         *
+         * @param segments
+         *
+         * @return
+         *  The response to the last AVR command.
+         */
+        Protocols::CmsisDap::Response sendAvrCommandFrameSegments(
+            const std::array<std::span<const unsigned char>, 3>& segments
+        );
     };
 }
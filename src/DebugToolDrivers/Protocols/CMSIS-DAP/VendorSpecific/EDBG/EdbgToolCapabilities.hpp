@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <set>
+
+#include "Edbg.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
+{
+    /**
+     * Capabilities of an EDBG debug tool, as reported by the tool's firmware via the Discovery and HouseKeeping
+     * sub-protocols.
+     *
+     * These are probed once per tool, upon initialisation (see EdbgDevice::probeToolCapabilities()), and cached per
+     * serial number. Any capability that the tool doesn't report is left unset, in which case the driver should
+     * fall back to its conservative defaults.
+     */
+    struct EdbgToolCapabilities
+    {
+        std::optional<std::string> serialNumber;
+        std::optional<std::uint8_t> hardwareVersion;
+        std::optional<std::uint8_t> firmwareMajorVersion;
+        std::optional<std::uint8_t> firmwareMinorVersion;
+        std::optional<std::uint16_t> firmwareBuildNumber;
+
+        /**
+         * The EDBG sub-protocol handlers implemented by the tool's firmware.
+         *
+         * If the tool doesn't report its handlers, this will be empty and EdbgToolCapabilities::supportsProtocol()
+         * will assume that all handlers are supported.
+         */
+        std::set<ProtocolHandlerId> protocolHandlerIds;
+
+        /**
+         * The largest AVR command/response frame the tool can service - the smaller of the USB_MAX_READ and
+         * USB_MAX_WRITE HouseKeeping parameters.
+         */
+        std::optional<std::uint16_t> maximumAvrFrameSize;
+
+        [[nodiscard]] bool supportsProtocol(ProtocolHandlerId handlerId) const {
+            return this->protocolHandlerIds.empty() || this->protocolHandlerIds.contains(handlerId);
+        }
+
+        /**
+         * Returns the tool's firmware version, in the form "<major>.<minor>.<build>", or std::nullopt if the tool
+         * doesn't report it.
+         *
+         * @return
+         */
+        [[nodiscard]] std::optional<std::string> getFirmwareVersionString() const {
+            if (!this->firmwareMajorVersion.has_value() || !this->firmwareMinorVersion.has_value()) {
+                return std::nullopt;
+            }
+
+            return std::to_string(*this->firmwareMajorVersion) + "." + std::to_string(*this->firmwareMinorVersion)
+                + (this->firmwareBuildNumber.has_value() ? "." + std::to_string(*this->firmwareBuildNumber) : "");
+        }
+    };
+}
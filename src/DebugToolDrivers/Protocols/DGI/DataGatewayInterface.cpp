@@ -0,0 +1,115 @@
+#include "DataGatewayInterface.hpp"
+
+#include <array>
+#include <algorithm>
+
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+#include "src/Services/TraceService.hpp"
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::Dgi
+{
+    using namespace Bloom::Exceptions;
+
+    DataGatewayInterface::DataGatewayInterface(std::unique_ptr<Usb::PacketInterface> usbInterface)
+        : usbInterface(std::move(usbInterface))
+    {}
+
+    void DataGatewayInterface::init() {
+        this->usbInterface->init();
+        this->packetBuffer.resize(this->usbInterface->getPacketSize());
+
+        const auto response = this->sendCommand(CommandId::SIGN_ON);
+        Logger::debug("Signed on to DGI - " + std::string(response.begin(), response.end()));
+    }
+
+    void DataGatewayInterface::close() {
+        try {
+            this->sendCommand(CommandId::SIGN_OFF);
+
+        } catch (const DeviceCommunicationFailure& exception) {
+            Logger::debug("Failed to sign off from DGI - " + exception.getMessage());
+        }
+
+        this->usbInterface->close();
+    }
+
+    std::vector<InterfaceId> DataGatewayInterface::listInterfaces() {
+        const auto response = this->sendCommand(CommandId::INTERFACES_LIST);
+
+        if (response.empty()) {
+            return {};
+        }
+
+        // The first byte holds the number of interfaces, followed by their IDs
+        const auto interfaceCount = std::min(static_cast<std::size_t>(response[0]), response.size() - 1);
+
+        auto output = std::vector<InterfaceId>();
+        output.reserve(interfaceCount);
+
+        for (auto i = std::size_t(1); i <= interfaceCount; ++i) {
+            output.emplace_back(static_cast<InterfaceId>(response[i]));
+        }
+
+        return output;
+    }
+
+    void DataGatewayInterface::setInterfaceEnabled(InterfaceId interfaceId, bool enable) {
+        const auto payload = std::array<unsigned char, 2>({
+            static_cast<unsigned char>(interfaceId),
+            static_cast<unsigned char>(enable ? 0x01 : 0x00),
+        });
+
+        this->sendCommand(CommandId::INTERFACES_ENABLE, payload);
+    }
+
+    std::span<const unsigned char> DataGatewayInterface::pollData(InterfaceId interfaceId) {
+        const auto payload = std::array<unsigned char, 1>({static_cast<unsigned char>(interfaceId)});
+        const auto response = this->sendCommand(CommandId::INTERFACES_POLL_DATA, payload);
+
+        // The data is preceded by a 16-bit length (MSB first)
+        if (response.size() < 2) {
+            return {};
+        }
+
+        const auto length = static_cast<std::size_t>((response[0] << 8) | response[1]);
+        return response.subspan(2, std::min(length, response.size() - 2));
+    }
+
+    std::span<const unsigned char> DataGatewayInterface::sendCommand(
+        CommandId commandId,
+        std::span<const unsigned char> payload
+    ) {
+        const auto traceSpan = Services::TraceService::Span("DataGatewayInterface::sendCommand", "DGI");
+
+        if (payload.size() + 3 > this->packetBuffer.size()) {
+            throw DeviceCommunicationFailure("DGI command payload exceeds packet size");
+        }
+
+        this->packetBuffer[0] = static_cast<unsigned char>(commandId);
+        this->packetBuffer[1] = static_cast<unsigned char>(payload.size() >> 8);
+        this->packetBuffer[2] = static_cast<unsigned char>(payload.size());
+        std::copy(payload.begin(), payload.end(), this->packetBuffer.begin() + 3);
+
+        this->usbInterface->writePacket(
+            std::span<const unsigned char>(this->packetBuffer.data(), payload.size() + 3)
+        );
+
+        const auto responseSize = this->usbInterface->readPacket(
+            this->packetBuffer,
+            DataGatewayInterface::RESPONSE_TIMEOUT
+        );
+
+        if (responseSize == 0) {
+            throw DeviceCommunicationFailure("DGI command timed out");
+        }
+
+        if (this->packetBuffer[0] != static_cast<unsigned char>(ResponseCode::OK)) {
+            throw DeviceCommunicationFailure(
+                "DGI command failed - response code " + std::to_string(this->packetBuffer[0]) + " returned"
+            );
+        }
+
+        return std::span<const unsigned char>(this->packetBuffer.data() + 1, responseSize - 1);
+    }
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <string>
+#include <span>
+#include <chrono>
+
+#include "src/DebugToolDrivers/USB/PacketInterface.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::Dgi
+{
+    enum class CommandId: unsigned char
+    {
+        SIGN_ON = 0x00,
+        SIGN_OFF = 0x01,
+        GET_VERSION = 0x02,
+        INTERFACES_LIST = 0x08,
+        SET_MODE = 0x0A,
+        INTERFACES_ENABLE = 0x10,
+        INTERFACES_STATUS = 0x11,
+        INTERFACES_SET_CONFIG = 0x12,
+        INTERFACES_GET_CONFIG = 0x13,
+        INTERFACES_SEND_DATA = 0x14,
+        INTERFACES_POLL_DATA = 0x15,
+    };
+
+    enum class ResponseCode: unsigned char
+    {
+        OK = 0x80,
+    };
+
+    enum class InterfaceId: unsigned char
+    {
+        TIMESTAMP = 0x00,
+        SPI = 0x20,
+        USART = 0x21,
+        I2C = 0x22,
+        GPIO = 0x30,
+        POWER_DATA = 0x40,
+        POWER_SYNC = 0x41,
+    };
+
+    /**
+     * The Data Gateway Interface (DGI) is a vendor-specific USB interface, found on some EDBG devices (like the Power
+     * Debugger), for streaming data from the target's peripherals (SPI, USART, GPIO, etc) and, on the Power
+     * Debugger, from the tool's current and voltage measurement circuitry.
+     *
+     * The DGI is entirely separate from the CMSIS-DAP interface - it has its own pair of bulk endpoints, so it can be
+     * serviced from a separate thread, without interfering with debugging operations.
+     *
+     * Each DGI command consists of a command ID, a 16-bit payload length (MSB first) and the payload. Each response
+     * begins with a response code.
+     *
+     * For more information, see the 'Data Gateway Interface' section of the 'Embedded Debugger-Based Tools Protocols
+     * User's Guide' document by Microchip.
+     * @link http://ww1.microchip.com/downloads/en/DeviceDoc/50002630A.pdf
+     */
+    class DataGatewayInterface
+    {
+    public:
+        static constexpr auto RESPONSE_TIMEOUT = std::chrono::milliseconds(1000);
+
+        explicit DataGatewayInterface(std::unique_ptr<Usb::PacketInterface> usbInterface);
+
+        /**
+         * Claims the DGI USB interface and signs on.
+         */
+        void init();
+
+        /**
+         * Signs off and releases the DGI USB interface.
+         */
+        void close();
+
+        /**
+         * Returns the IDs of the interfaces supported by the tool.
+         *
+         * @return
+         */
+        std::vector<InterfaceId> listInterfaces();
+
+        /**
+         * Enables or disables streaming from an interface.
+         *
+         * @param interfaceId
+         * @param enable
+         */
+        void setInterfaceEnabled(InterfaceId interfaceId, bool enable);
+
+        /**
+         * Polls an enabled interface for any data that has been buffered by the tool, since the last poll.
+         *
+         * @param interfaceId
+         *
+         * @return
+         *  A view of the data, which is only valid until the next DGI command. Empty if the tool had no data.
+         */
+        std::span<const unsigned char> pollData(InterfaceId interfaceId);
+
+    private:
+        std::unique_ptr<Usb::PacketInterface> usbInterface;
+
+        /**
+         * Packet buffer, reused for every command and response.
+         */
+        std::vector<unsigned char> packetBuffer;
+
+        /**
+         * Sends a DGI command and reads the response into this->packetBuffer.
+         *
+         * @param commandId
+         * @param payload
+         *
+         * @throws DeviceCommunicationFailure
+         *  If the tool fails to respond, or responds with anything other than ResponseCode::OK.
+         *
+         * @return
+         *  A view of the response, excluding the response code.
+         */
+        std::span<const unsigned char> sendCommand(CommandId commandId, std::span<const unsigned char> payload = {});
+    };
+}
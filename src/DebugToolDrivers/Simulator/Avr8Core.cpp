@@ -0,0 +1,882 @@
+#include "Avr8Core.hpp"
+
+namespace Bloom::DebugToolDrivers::Simulator
+{
+    using namespace Targets;
+    using Targets::Microchip::Avr::Avr8Bit::TargetParameters;
+
+    Avr8Core::Avr8Core(
+        TargetMemoryBuffer& dataSpace,
+        TargetMemoryBuffer& registerFile,
+        TargetMemoryBuffer& programMemory,
+        TargetProgramCounter& programCounter
+    )
+        : dataSpace(dataSpace)
+        , registerFile(registerFile)
+        , programMemory(programMemory)
+        , programCounter(programCounter)
+    {}
+
+    void Avr8Core::configure(const TargetParameters& parameters, bool separateRegisterFile) {
+        this->separateRegisterFile = separateRegisterFile;
+
+        // On XMEGA and UPDI targets, the I/O registers are mapped to the start of the data space
+        this->ioOffset = parameters.mappedIoSegmentStartAddress.value_or(separateRegisterFile ? 0x00 : 0x20);
+
+        this->statusRegisterAddress = parameters.statusRegisterStartAddress.value_or(this->ioOffset + 0x3F);
+        this->stackPointerAddress = parameters.stackPointerRegisterLowAddress.value_or(this->ioOffset + 0x3D);
+        this->stackPointerSize = parameters.stackPointerRegisterSize.value_or(2);
+        this->rampzAddress = this->ioOffset + 0x3B;
+        this->eindAddress = this->ioOffset + 0x3C;
+
+        this->stackPointerResetValue = static_cast<std::uint16_t>(
+            parameters.ramStartAddress.value_or(0x0100) + parameters.ramSize.value_or(0x0800) - 1
+        );
+
+        this->returnAddressSize = parameters.flashSize.value_or(0) > 0x20000 ? 3 : 2;
+    }
+
+    void Avr8Core::reset() {
+        const auto write = [this] (std::uint32_t address, std::uint8_t value) {
+            if (address < this->dataSpace.size()) {
+                this->dataSpace[address] = value;
+            }
+        };
+
+        write(this->statusRegisterAddress, 0x00);
+        write(this->stackPointerAddress, static_cast<std::uint8_t>(this->stackPointerResetValue));
+
+        if (this->stackPointerSize > 1) {
+            write(this->stackPointerAddress + 1, static_cast<std::uint8_t>(this->stackPointerResetValue >> 8));
+        }
+    }
+
+    Avr8CoreStopReason Avr8Core::step() {
+        if (!this->prepare()) {
+            return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+        }
+
+        const auto stopReason = this->execute();
+        this->commit();
+
+        return stopReason;
+    }
+
+    Avr8CoreStopReason Avr8Core::run(
+        std::uint64_t instructionLimit,
+        const std::vector<bool>& breakpointMap,
+        bool ignoreInitialBreakpoint
+    ) {
+        if (!this->prepare()) {
+            return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+        }
+
+        auto stopReason = Avr8CoreStopReason::NONE;
+        const auto breakpointMapSize = static_cast<std::uint32_t>(breakpointMap.size());
+
+        for (auto i = std::uint64_t(0); i < instructionLimit; ++i) {
+            if (
+                (i > 0 || !ignoreInitialBreakpoint)
+                && this->pc < breakpointMapSize
+                && breakpointMap[this->pc]
+            ) {
+                stopReason = Avr8CoreStopReason::BREAKPOINT;
+                break;
+            }
+
+            stopReason = this->execute();
+            if (stopReason != Avr8CoreStopReason::NONE) {
+                break;
+            }
+        }
+
+        this->commit();
+        return stopReason;
+    }
+
+    bool Avr8Core::prepare() {
+        if (this->programMemory.size() < 2 || this->dataSpace.empty()) {
+            return false;
+        }
+
+        if (this->separateRegisterFile && this->registerFile.size() < 32) {
+            return false;
+        }
+
+        if (!this->separateRegisterFile && this->dataSpace.size() < 32) {
+            return false;
+        }
+
+        this->data = this->dataSpace.data();
+        this->dataSize = static_cast<std::uint32_t>(this->dataSpace.size());
+        this->registers = this->separateRegisterFile ? this->registerFile.data() : this->data;
+        this->program = this->programMemory.data();
+        this->programWords = static_cast<std::uint32_t>(this->programMemory.size() / 2);
+
+        if (this->statusRegisterAddress >= this->dataSize) {
+            return false;
+        }
+
+        this->statusRegister = this->data + this->statusRegisterAddress;
+        this->pc = (this->programCounter / 2) % this->programWords;
+
+        return true;
+    }
+
+    void Avr8Core::commit() {
+        this->programCounter = static_cast<TargetProgramCounter>(this->pc) * 2;
+    }
+
+    Avr8CoreStopReason Avr8Core::execute() {
+        const auto opcode = this->fetch(this->pc);
+        auto nextPc = this->pc + 1;
+
+        // Common operand encodings
+        const auto rd5 = static_cast<std::uint8_t>((opcode >> 4) & 0x1F);
+        const auto rr5 = static_cast<std::uint8_t>((opcode & 0x0F) | ((opcode >> 5) & 0x10));
+        const auto rd4 = static_cast<std::uint8_t>(16 + ((opcode >> 4) & 0x0F));
+        const auto immediate8 = static_cast<std::uint8_t>(((opcode >> 4) & 0xF0) | (opcode & 0x0F));
+
+        auto* r = this->registers;
+
+        switch (opcode >> 12) {
+            case 0x0: {
+                if (opcode == 0x0000) {
+                    // NOP
+                    break;
+                }
+
+                switch ((opcode >> 10) & 0x03) {
+                    case 0x0: {
+                        switch ((opcode >> 8) & 0x03) {
+                            case 0x1: {
+                                // MOVW
+                                const auto d = static_cast<std::uint8_t>(((opcode >> 4) & 0x0F) * 2);
+                                const auto s = static_cast<std::uint8_t>((opcode & 0x0F) * 2);
+                                r[d] = r[s];
+                                r[d + 1] = r[s + 1];
+                                break;
+                            }
+                            case 0x2: {
+                                // MULS
+                                const auto result = static_cast<std::uint16_t>(
+                                    static_cast<std::int8_t>(r[rd4]) * static_cast<std::int8_t>(r[16 + (opcode & 0x0F)])
+                                );
+                                this->writeRegisterPair(0, result);
+                                this->setFlags(
+                                    SREG_C | SREG_Z,
+                                    ((result & 0x8000) != 0 ? SREG_C : 0) | (result == 0 ? SREG_Z : 0)
+                                );
+                                break;
+                            }
+                            case 0x3: {
+                                // MULSU, FMUL, FMULS and FMULSU
+                                const auto d = static_cast<std::uint8_t>(16 + ((opcode >> 4) & 0x07));
+                                const auto s = static_cast<std::uint8_t>(16 + (opcode & 0x07));
+                                const auto variant = ((opcode >> 6) & 0x02) | ((opcode >> 3) & 0x01);
+
+                                auto product = std::int32_t(0);
+                                switch (variant) {
+                                    case 0x0: // MULSU
+                                    case 0x3: { // FMULSU
+                                        product = static_cast<std::int8_t>(r[d]) * static_cast<std::int32_t>(r[s]);
+                                        break;
+                                    }
+                                    case 0x1: { // FMUL
+                                        product = static_cast<std::int32_t>(r[d]) * static_cast<std::int32_t>(r[s]);
+                                        break;
+                                    }
+                                    default: { // FMULS
+                                        product = static_cast<std::int8_t>(r[d]) * static_cast<std::int8_t>(r[s]);
+                                        break;
+                                    }
+                                }
+
+                                auto result = static_cast<std::uint16_t>(product);
+                                const auto carry = (result & 0x8000) != 0;
+
+                                if (variant != 0x0) {
+                                    // The fractional multiplications shift the result left by one
+                                    result = static_cast<std::uint16_t>(result << 1);
+                                }
+
+                                this->writeRegisterPair(0, result);
+                                this->setFlags(SREG_C | SREG_Z, (carry ? SREG_C : 0) | (result == 0 ? SREG_Z : 0));
+                                break;
+                            }
+                            default: {
+                                return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+                            }
+                        }
+                        break;
+                    }
+                    case 0x1: {
+                        // CPC
+                        this->subtract(r[rd5], r[rr5], true);
+                        break;
+                    }
+                    case 0x2: {
+                        // SBC
+                        r[rd5] = this->subtract(r[rd5], r[rr5], true);
+                        break;
+                    }
+                    case 0x3: {
+                        // ADD (and LSL)
+                        r[rd5] = this->add(r[rd5], r[rr5], false);
+                        break;
+                    }
+                }
+                break;
+            }
+            case 0x1: {
+                switch ((opcode >> 10) & 0x03) {
+                    case 0x0: {
+                        // CPSE
+                        if (r[rd5] == r[rr5]) {
+                            nextPc += this->isTwoWordInstruction(nextPc) ? 2 : 1;
+                        }
+                        break;
+                    }
+                    case 0x1: {
+                        // CP
+                        this->subtract(r[rd5], r[rr5], false);
+                        break;
+                    }
+                    case 0x2: {
+                        // SUB
+                        r[rd5] = this->subtract(r[rd5], r[rr5], false);
+                        break;
+                    }
+                    case 0x3: {
+                        // ADC (and ROL)
+                        r[rd5] = this->add(r[rd5], r[rr5], true);
+                        break;
+                    }
+                }
+                break;
+            }
+            case 0x2: {
+                switch ((opcode >> 10) & 0x03) {
+                    case 0x0: {
+                        // AND (and TST)
+                        r[rd5] &= r[rr5];
+                        this->setResultFlags(r[rd5], false);
+                        break;
+                    }
+                    case 0x1: {
+                        // EOR (and CLR)
+                        r[rd5] ^= r[rr5];
+                        this->setResultFlags(r[rd5], false);
+                        break;
+                    }
+                    case 0x2: {
+                        // OR
+                        r[rd5] |= r[rr5];
+                        this->setResultFlags(r[rd5], false);
+                        break;
+                    }
+                    case 0x3: {
+                        // MOV
+                        r[rd5] = r[rr5];
+                        break;
+                    }
+                }
+                break;
+            }
+            case 0x3: {
+                // CPI
+                this->subtract(r[rd4], immediate8, false);
+                break;
+            }
+            case 0x4: {
+                // SBCI
+                r[rd4] = this->subtract(r[rd4], immediate8, true);
+                break;
+            }
+            case 0x5: {
+                // SUBI
+                r[rd4] = this->subtract(r[rd4], immediate8, false);
+                break;
+            }
+            case 0x6: {
+                // ORI (and SBR)
+                r[rd4] |= immediate8;
+                this->setResultFlags(r[rd4], false);
+                break;
+            }
+            case 0x7: {
+                // ANDI (and CBR)
+                r[rd4] &= immediate8;
+                this->setResultFlags(r[rd4], false);
+                break;
+            }
+            case 0x8:
+            case 0xA: {
+                // LDD and STD (and LD/ST via Y and Z, without displacement)
+                const auto displacement = static_cast<std::uint16_t>(
+                    (opcode & 0x07) | ((opcode >> 7) & 0x18) | ((opcode >> 8) & 0x20)
+                );
+                const auto address = static_cast<std::uint32_t>(
+                    this->readRegisterPair((opcode & 0x0008) != 0 ? 28 : 30) + displacement
+                );
+
+                if ((opcode & 0x0200) != 0) {
+                    this->writeData(address, r[rd5]);
+
+                } else {
+                    r[rd5] = this->readData(address);
+                }
+                break;
+            }
+            case 0x9: {
+                switch ((opcode >> 9) & 0x07) {
+                    case 0x0:
+                    case 0x1: {
+                        const auto store = (opcode & 0x0200) != 0;
+                        const auto mode = opcode & 0x000F;
+
+                        if (mode == 0x0) {
+                            // LDS and STS
+                            const auto address = static_cast<std::uint32_t>(this->fetch(nextPc));
+                            nextPc += 1;
+
+                            if (store) {
+                                this->writeData(address, r[rd5]);
+
+                            } else {
+                                r[rd5] = this->readData(address);
+                            }
+                            break;
+                        }
+
+                        if (mode == 0xF) {
+                            // PUSH and POP
+                            if (store) {
+                                this->push(r[rd5]);
+
+                            } else {
+                                r[rd5] = this->pop();
+                            }
+                            break;
+                        }
+
+                        if (!store && mode >= 0x4 && mode <= 0x7) {
+                            // LPM and ELPM (with the Z and Z+ operands)
+                            auto address = static_cast<std::uint32_t>(this->readRegisterPair(30));
+                            if (mode >= 0x6) {
+                                address |= static_cast<std::uint32_t>(this->readData(this->rampzAddress)) << 16;
+                            }
+
+                            r[rd5] = this->program[address % (this->programWords * 2)];
+
+                            if ((mode & 0x1) != 0) {
+                                ++address;
+                                this->writeRegisterPair(30, static_cast<std::uint16_t>(address));
+
+                                if (mode == 0x7) {
+                                    this->writeData(this->rampzAddress, static_cast<std::uint8_t>(address >> 16));
+                                }
+                            }
+                            break;
+                        }
+
+                        if (store && mode >= 0x4 && mode <= 0x7) {
+                            // XCH, LAS, LAC and LAT
+                            const auto address = static_cast<std::uint32_t>(this->readRegisterPair(30));
+                            const auto memoryValue = this->readData(address);
+
+                            switch (mode) {
+                                case 0x4: {
+                                    this->writeData(address, r[rd5]);
+                                    break;
+                                }
+                                case 0x5: {
+                                    this->writeData(address, static_cast<std::uint8_t>(memoryValue | r[rd5]));
+                                    break;
+                                }
+                                case 0x6: {
+                                    this->writeData(address, static_cast<std::uint8_t>(memoryValue & ~r[rd5]));
+                                    break;
+                                }
+                                default: {
+                                    this->writeData(address, static_cast<std::uint8_t>(memoryValue ^ r[rd5]));
+                                    break;
+                                }
+                            }
+
+                            r[rd5] = memoryValue;
+                            break;
+                        }
+
+                        // LD and ST via X, Y and Z, with post-increment or pre-decrement
+                        auto pointerRegister = std::uint8_t(0);
+                        switch (mode) {
+                            case 0x1:
+                            case 0x2: {
+                                pointerRegister = 30;
+                                break;
+                            }
+                            case 0x9:
+                            case 0xA: {
+                                pointerRegister = 28;
+                                break;
+                            }
+                            case 0xC:
+                            case 0xD:
+                            case 0xE: {
+                                pointerRegister = 26;
+                                break;
+                            }
+                            default: {
+                                return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+                            }
+                        }
+
+                        auto address = this->readRegisterPair(pointerRegister);
+                        const auto preDecrement = (mode & 0x3) == 0x2;
+                        const auto postIncrement = (mode & 0x3) == 0x1;
+
+                        if (preDecrement) {
+                            --address;
+                        }
+
+                        if (store) {
+                            this->writeData(address, r[rd5]);
+
+                        } else {
+                            r[rd5] = this->readData(address);
+                        }
+
+                        if (postIncrement) {
+                            ++address;
+                        }
+
+                        if (preDecrement || postIncrement) {
+                            this->writeRegisterPair(pointerRegister, address);
+                        }
+                        break;
+                    }
+                    case 0x2: {
+                        // Single operand instructions, and those without operands
+                        switch (opcode & 0x000F) {
+                            case 0x0: {
+                                // COM
+                                r[rd5] = static_cast<std::uint8_t>(~r[rd5]);
+                                this->setResultFlags(r[rd5], false);
+                                this->setFlags(SREG_C, SREG_C);
+                                break;
+                            }
+                            case 0x1: {
+                                // NEG
+                                const auto rd = r[rd5];
+                                const auto result = static_cast<std::uint8_t>(0 - rd);
+                                r[rd5] = result;
+                                this->setResultFlags(result, result == 0x80);
+                                this->setFlags(
+                                    SREG_C | SREG_H,
+                                    (result != 0 ? SREG_C : 0) | (((result | rd) & 0x08) != 0 ? SREG_H : 0)
+                                );
+                                break;
+                            }
+                            case 0x2: {
+                                // SWAP
+                                r[rd5] = static_cast<std::uint8_t>((r[rd5] << 4) | (r[rd5] >> 4));
+                                break;
+                            }
+                            case 0x3: {
+                                // INC
+                                ++r[rd5];
+                                this->setResultFlags(r[rd5], r[rd5] == 0x80);
+                                break;
+                            }
+                            case 0x5:
+                            case 0x6:
+                            case 0x7: {
+                                // ASR, LSR and ROR
+                                const auto rd = r[rd5];
+                                const auto carry = (rd & 0x01) != 0;
+                                auto result = static_cast<std::uint8_t>(rd >> 1);
+
+                                if ((opcode & 0x000F) == 0x5) {
+                                    result |= static_cast<std::uint8_t>(rd & 0x80);
+
+                                } else if ((opcode & 0x000F) == 0x7 && this->flag(SREG_C)) {
+                                    result |= 0x80;
+                                }
+
+                                r[rd5] = result;
+
+                                // V = N ^ C, for shifts
+                                this->setResultFlags(result, ((result & 0x80) != 0) != carry);
+                                this->setFlags(SREG_C, carry ? SREG_C : 0);
+                                break;
+                            }
+                            case 0x8: {
+                                if ((opcode & 0x0100) == 0) {
+                                    // BSET and BCLR (SEC, CLI, etc)
+                                    const auto mask = static_cast<std::uint8_t>(1 << ((opcode >> 4) & 0x07));
+                                    this->setFlags(mask, (opcode & 0x0080) == 0 ? mask : 0);
+                                    break;
+                                }
+
+                                switch ((opcode >> 4) & 0x0F) {
+                                    case 0x0: // RET
+                                    case 0x1: { // RETI
+                                        nextPc = this->popReturnAddress();
+
+                                        if ((opcode & 0x0010) != 0) {
+                                            this->setFlags(SREG_I, SREG_I);
+                                        }
+                                        break;
+                                    }
+                                    case 0x8: // SLEEP - there are no interrupts to wake the core, so we don't sleep
+                                    case 0xA: { // WDR
+                                        break;
+                                    }
+                                    case 0x9: {
+                                        // BREAK
+                                        return Avr8CoreStopReason::BREAK_INSTRUCTION;
+                                    }
+                                    case 0xC: {
+                                        // LPM (R0 implied)
+                                        r[0] = this->program[this->readRegisterPair(30) % (this->programWords * 2)];
+                                        break;
+                                    }
+                                    case 0xD: {
+                                        // ELPM (R0 implied)
+                                        const auto address = static_cast<std::uint32_t>(this->readRegisterPair(30))
+                                            | (static_cast<std::uint32_t>(this->readData(this->rampzAddress)) << 16);
+                                        r[0] = this->program[address % (this->programWords * 2)];
+                                        break;
+                                    }
+                                    default: {
+                                        // SPM is not supported
+                                        return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+                                    }
+                                }
+                                break;
+                            }
+                            case 0x9: {
+                                // IJMP, EIJMP, ICALL and EICALL
+                                if ((opcode & 0xFEEF) != 0x9409) {
+                                    return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+                                }
+
+                                auto destination = static_cast<std::uint32_t>(this->readRegisterPair(30));
+                                if ((opcode & 0x0010) != 0) {
+                                    destination |= static_cast<std::uint32_t>(this->readData(this->eindAddress)) << 16;
+                                }
+
+                                if ((opcode & 0x0100) != 0) {
+                                    this->pushReturnAddress(nextPc);
+                                }
+
+                                nextPc = destination;
+                                break;
+                            }
+                            case 0xA: {
+                                // DEC
+                                --r[rd5];
+                                this->setResultFlags(r[rd5], r[rd5] == 0x7F);
+                                break;
+                            }
+                            case 0xC:
+                            case 0xD:
+                            case 0xE:
+                            case 0xF: {
+                                // JMP and CALL
+                                const auto destination = (
+                                    static_cast<std::uint32_t>(((opcode >> 3) & 0x3E) | (opcode & 0x01)) << 16
+                                ) | this->fetch(nextPc);
+                                nextPc += 1;
+
+                                if ((opcode & 0x0002) != 0) {
+                                    this->pushReturnAddress(nextPc);
+                                }
+
+                                nextPc = destination;
+                                break;
+                            }
+                            default: {
+                                // DES (0xB) isn't supported, and 0x4 is undefined
+                                return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+                            }
+                        }
+                        break;
+                    }
+                    case 0x3: {
+                        // ADIW and SBIW
+                        const auto d = static_cast<std::uint8_t>(24 + ((opcode >> 4) & 0x03) * 2);
+                        const auto constant = static_cast<std::uint16_t>(((opcode >> 2) & 0x30) | (opcode & 0x0F));
+                        const auto value = this->readRegisterPair(d);
+                        const auto subtraction = (opcode & 0x0100) != 0;
+                        const auto result = static_cast<std::uint16_t>(
+                            subtraction ? value - constant : value + constant
+                        );
+
+                        this->writeRegisterPair(d, result);
+
+                        const auto resultNegative = (result & 0x8000) != 0;
+                        const auto valueNegative = (value & 0x8000) != 0;
+                        const auto overflow = subtraction
+                            ? (valueNegative && !resultNegative)
+                            : (!valueNegative && resultNegative);
+                        const auto carry = subtraction
+                            ? (resultNegative && !valueNegative)
+                            : (!resultNegative && valueNegative);
+
+                        this->setFlags(
+                            SREG_C | SREG_Z | SREG_N | SREG_V | SREG_S,
+                            (carry ? SREG_C : 0)
+                                | (result == 0 ? SREG_Z : 0)
+                                | (resultNegative ? SREG_N : 0)
+                                | (overflow ? SREG_V : 0)
+                                | (resultNegative != overflow ? SREG_S : 0)
+                        );
+                        break;
+                    }
+                    case 0x4:
+                    case 0x5: {
+                        // CBI, SBIC, SBI and SBIS
+                        const auto address = this->ioOffset + ((opcode >> 3) & 0x1F);
+                        const auto mask = static_cast<std::uint8_t>(1 << (opcode & 0x07));
+                        const auto value = this->readData(address);
+
+                        switch ((opcode >> 8) & 0x03) {
+                            case 0x0: {
+                                this->writeData(address, static_cast<std::uint8_t>(value & ~mask));
+                                break;
+                            }
+                            case 0x1: {
+                                if ((value & mask) == 0) {
+                                    nextPc += this->isTwoWordInstruction(nextPc) ? 2 : 1;
+                                }
+                                break;
+                            }
+                            case 0x2: {
+                                this->writeData(address, static_cast<std::uint8_t>(value | mask));
+                                break;
+                            }
+                            default: {
+                                if ((value & mask) != 0) {
+                                    nextPc += this->isTwoWordInstruction(nextPc) ? 2 : 1;
+                                }
+                                break;
+                            }
+                        }
+                        break;
+                    }
+                    default: {
+                        // MUL
+                        this->writeRegisterPair(0, static_cast<std::uint16_t>(r[rd5] * r[rr5]));
+
+                        const auto result = this->readRegisterPair(0);
+                        this->setFlags(
+                            SREG_C | SREG_Z,
+                            ((result & 0x8000) != 0 ? SREG_C : 0) | (result == 0 ? SREG_Z : 0)
+                        );
+                        break;
+                    }
+                }
+                break;
+            }
+            case 0xB: {
+                // IN and OUT
+                const auto address = this->ioOffset + ((opcode & 0x0F) | ((opcode >> 5) & 0x30));
+
+                if ((opcode & 0x0800) != 0) {
+                    this->writeData(address, r[rd5]);
+
+                } else {
+                    r[rd5] = this->readData(address);
+                }
+                break;
+            }
+            case 0xC:
+            case 0xD: {
+                // RJMP and RCALL
+                auto offset = static_cast<std::int32_t>(opcode & 0x0FFF);
+                if ((offset & 0x0800) != 0) {
+                    offset -= 0x1000;
+                }
+
+                if ((opcode & 0x1000) != 0) {
+                    this->pushReturnAddress(nextPc);
+                }
+
+                nextPc = static_cast<std::uint32_t>(static_cast<std::int32_t>(nextPc) + offset);
+                break;
+            }
+            case 0xE: {
+                // LDI (and SER)
+                r[rd4] = immediate8;
+                break;
+            }
+            case 0xF: {
+                const auto bit = static_cast<std::uint8_t>(opcode & 0x07);
+
+                switch ((opcode >> 9) & 0x07) {
+                    case 0x0:
+                    case 0x1:
+                    case 0x2:
+                    case 0x3: {
+                        // BRBS and BRBC (BREQ, BRNE, etc)
+                        const auto branchIfSet = (opcode & 0x0400) == 0;
+
+                        if (this->flag(static_cast<std::uint8_t>(1 << bit)) == branchIfSet) {
+                            auto offset = static_cast<std::int32_t>((opcode >> 3) & 0x7F);
+                            if ((offset & 0x40) != 0) {
+                                offset -= 0x80;
+                            }
+
+                            nextPc = static_cast<std::uint32_t>(static_cast<std::int32_t>(nextPc) + offset);
+                        }
+                        break;
+                    }
+                    case 0x4: {
+                        // BLD
+                        if ((opcode & 0x0008) != 0) {
+                            return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+                        }
+
+                        const auto mask = static_cast<std::uint8_t>(1 << bit);
+                        r[rd5] = static_cast<std::uint8_t>(this->flag(SREG_T) ? (r[rd5] | mask) : (r[rd5] & ~mask));
+                        break;
+                    }
+                    case 0x5: {
+                        // BST
+                        if ((opcode & 0x0008) != 0) {
+                            return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+                        }
+
+                        this->setFlags(SREG_T, (r[rd5] & (1 << bit)) != 0 ? SREG_T : 0);
+                        break;
+                    }
+                    default: {
+                        // SBRC and SBRS
+                        if ((opcode & 0x0008) != 0) {
+                            return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+                        }
+
+                        const auto bitSet = (r[rd5] & (1 << bit)) != 0;
+                        if (bitSet == ((opcode & 0x0200) != 0)) {
+                            nextPc += this->isTwoWordInstruction(nextPc) ? 2 : 1;
+                        }
+                        break;
+                    }
+                }
+                break;
+            }
+            default: {
+                return Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION;
+            }
+        }
+
+        this->pc = nextPc % this->programWords;
+        ++this->instructionCount;
+
+        return Avr8CoreStopReason::NONE;
+    }
+
+    std::uint16_t Avr8Core::readStackPointer() const {
+        auto value = static_cast<std::uint16_t>(this->readData(this->stackPointerAddress));
+
+        if (this->stackPointerSize > 1) {
+            value |= static_cast<std::uint16_t>(this->readData(this->stackPointerAddress + 1) << 8);
+        }
+
+        return value;
+    }
+
+    void Avr8Core::writeStackPointer(std::uint16_t value) {
+        this->writeData(this->stackPointerAddress, static_cast<std::uint8_t>(value));
+
+        if (this->stackPointerSize > 1) {
+            this->writeData(this->stackPointerAddress + 1, static_cast<std::uint8_t>(value >> 8));
+        }
+    }
+
+    void Avr8Core::push(std::uint8_t value) {
+        const auto stackPointer = this->readStackPointer();
+        this->writeData(stackPointer, value);
+        this->writeStackPointer(static_cast<std::uint16_t>(stackPointer - 1));
+    }
+
+    std::uint8_t Avr8Core::pop() {
+        const auto stackPointer = static_cast<std::uint16_t>(this->readStackPointer() + 1);
+        this->writeStackPointer(stackPointer);
+        return this->readData(stackPointer);
+    }
+
+    void Avr8Core::pushReturnAddress(std::uint32_t wordAddress) {
+        // As with the hardware, the return address is pushed LSB first, leaving it in MSB form on the stack
+        this->push(static_cast<std::uint8_t>(wordAddress));
+        this->push(static_cast<std::uint8_t>(wordAddress >> 8));
+
+        if (this->returnAddressSize > 2) {
+            this->push(static_cast<std::uint8_t>(wordAddress >> 16));
+        }
+    }
+
+    std::uint32_t Avr8Core::popReturnAddress() {
+        auto wordAddress = std::uint32_t(0);
+
+        if (this->returnAddressSize > 2) {
+            wordAddress = static_cast<std::uint32_t>(this->pop()) << 16;
+        }
+
+        wordAddress |= static_cast<std::uint32_t>(this->pop()) << 8;
+        wordAddress |= this->pop();
+
+        return wordAddress;
+    }
+
+    void Avr8Core::setResultFlags(std::uint8_t result, bool overflow) {
+        const auto negative = (result & 0x80) != 0;
+
+        this->setFlags(
+            SREG_Z | SREG_N | SREG_V | SREG_S,
+            (result == 0 ? SREG_Z : 0)
+                | (negative ? SREG_N : 0)
+                | (overflow ? SREG_V : 0)
+                | (negative != overflow ? SREG_S : 0)
+        );
+    }
+
+    std::uint8_t Avr8Core::add(std::uint8_t rd, std::uint8_t rr, bool withCarry) {
+        const auto result = static_cast<std::uint8_t>(rd + rr + (withCarry && this->flag(SREG_C) ? 1 : 0));
+        const auto carries = static_cast<std::uint8_t>((rd & rr) | (rr & ~result) | (~result & rd));
+
+        this->setResultFlags(result, (((rd & rr & ~result) | (~rd & ~rr & result)) & 0x80) != 0);
+        this->setFlags(
+            SREG_C | SREG_H,
+            ((carries & 0x80) != 0 ? SREG_C : 0) | ((carries & 0x08) != 0 ? SREG_H : 0)
+        );
+
+        return result;
+    }
+
+    std::uint8_t Avr8Core::subtract(std::uint8_t rd, std::uint8_t rr, bool withCarry) {
+        const auto previousZero = this->flag(SREG_Z);
+        const auto result = static_cast<std::uint8_t>(rd - rr - (withCarry && this->flag(SREG_C) ? 1 : 0));
+        const auto borrows = static_cast<std::uint8_t>((~rd & rr) | (rr & result) | (result & ~rd));
+
+        this->setResultFlags(result, (((rd & ~rr & ~result) | (~rd & rr & result)) & 0x80) != 0);
+        this->setFlags(
+            SREG_C | SREG_H,
+            ((borrows & 0x80) != 0 ? SREG_C : 0) | ((borrows & 0x08) != 0 ? SREG_H : 0)
+        );
+
+        if (withCarry && !previousZero) {
+            // SBC, SBCI and CPC only ever clear the Z flag, for multibyte comparisons
+            this->setFlags(SREG_Z, 0);
+        }
+
+        return result;
+    }
+
+    bool Avr8Core::isTwoWordInstruction(std::uint32_t wordAddress) const {
+        const auto opcode = this->fetch(wordAddress);
+        return (opcode & 0xFE0E) == 0x940C || (opcode & 0xFC0F) == 0x9000;
+    }
+}
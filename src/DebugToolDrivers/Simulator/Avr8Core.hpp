@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/Microchip/AVR/AVR8/TargetParameters.hpp"
+
+namespace Bloom::DebugToolDrivers::Simulator
+{
+    enum class Avr8CoreStopReason: std::uint8_t
+    {
+        /**
+         * The core didn't stop - the instruction limit was reached.
+         */
+        NONE,
+
+        /**
+         * The program counter reached an address in the breakpoint map.
+         */
+        BREAKPOINT,
+
+        /**
+         * The core encountered a BREAK instruction.
+         */
+        BREAK_INSTRUCTION,
+
+        /**
+         * The core encountered an undefined opcode, or an instruction that isn't supported by the simulator (SPM and
+         * DES).
+         */
+        UNSUPPORTED_INSTRUCTION,
+    };
+
+    /**
+     * An AVR8 instruction-set simulator.
+     *
+     * The core executes instructions directly on the given memory images (owned by the caller), so memory accesses
+     * from the debug tool always reflect the state of the simulated target, without any synchronisation.
+     *
+     * Only the CPU is simulated - there are no peripherals and no interrupts. The I/O registers behave as plain
+     * memory, which allows firmware to write results to memory (or registers) for inspection via GDB. SLEEP and WDR
+     * are executed as NOPs.
+     *
+     * All instructions of the AVR instruction set are supported, with the exception of SPM and DES. The core doesn't
+     * check whether an instruction is available on the particular target (MUL on a tinyAVR, for example). The reduced
+     * core tinyAVR targets aren't supported by Bloom, so their 16-bit LDS/STS variants aren't either.
+     */
+    class Avr8Core
+    {
+    public:
+        /**
+         * @param dataSpace
+         *  The data space image - the GP registers (on targets where they're mapped to the data space), the I/O
+         *  registers and RAM. Index 0 corresponds to data space address 0.
+         *
+         * @param registerFile
+         *  The GP register file, for targets where the GP registers are not mapped to the data space (see
+         *  Avr8Core::configure()).
+         *
+         * @param programMemory
+         * @param programCounter
+         *  The byte address of the next instruction to execute.
+         */
+        Avr8Core(
+            Targets::TargetMemoryBuffer& dataSpace,
+            Targets::TargetMemoryBuffer& registerFile,
+            Targets::TargetMemoryBuffer& programMemory,
+            Targets::TargetProgramCounter& programCounter
+        );
+
+        /**
+         * Resolves the addresses of the CPU registers (SREG, SP, RAMPZ and EIND) from the target parameters.
+         *
+         * @param parameters
+         * @param separateRegisterFile
+         *  Whether the GP registers are held in the register file image, as opposed to the data space.
+         */
+        void configure(const Targets::Microchip::Avr::Avr8Bit::TargetParameters& parameters, bool separateRegisterFile);
+
+        /**
+         * Puts the CPU registers into their reset state - SREG is cleared and the stack pointer is set to the end of
+         * RAM. The GP registers and RAM are left untouched, as they are on a physical target.
+         *
+         * This doesn't affect the program counter.
+         */
+        void reset();
+
+        /**
+         * Executes a single instruction. The program counter is left at the offending instruction, if the core stops.
+         *
+         * @return
+         */
+        Avr8CoreStopReason step();
+
+        /**
+         * Executes instructions until the program counter reaches a breakpoint, the core stops or the instruction
+         * limit is reached.
+         *
+         * @param instructionLimit
+         * @param breakpointMap
+         *  A flag for each instruction word in program memory (indexed by word address), indicating whether the core
+         *  should stop upon reaching it. May be shorter than the program memory, or empty.
+         *
+         * @param ignoreInitialBreakpoint
+         *  Whether to execute the instruction at the program counter, even if there's a breakpoint at that address.
+         *  This should be set when resuming execution from a breakpoint.
+         *
+         * @return
+         */
+        Avr8CoreStopReason run(
+            std::uint64_t instructionLimit,
+            const std::vector<bool>& breakpointMap,
+            bool ignoreInitialBreakpoint
+        );
+
+        /**
+         * The total number of instructions executed by the core.
+         */
+        [[nodiscard]] std::uint64_t getInstructionCount() const {
+            return this->instructionCount;
+        }
+
+    private:
+        static constexpr std::uint8_t SREG_C = 0x01;
+        static constexpr std::uint8_t SREG_Z = 0x02;
+        static constexpr std::uint8_t SREG_N = 0x04;
+        static constexpr std::uint8_t SREG_V = 0x08;
+        static constexpr std::uint8_t SREG_S = 0x10;
+        static constexpr std::uint8_t SREG_H = 0x20;
+        static constexpr std::uint8_t SREG_T = 0x40;
+        static constexpr std::uint8_t SREG_I = 0x80;
+
+        Targets::TargetMemoryBuffer& dataSpace;
+        Targets::TargetMemoryBuffer& registerFile;
+        Targets::TargetMemoryBuffer& programMemory;
+        Targets::TargetProgramCounter& programCounter;
+
+        bool separateRegisterFile = false;
+        std::uint32_t ioOffset = 0x20;
+        std::uint32_t statusRegisterAddress = 0x5F;
+        std::uint32_t stackPointerAddress = 0x5D;
+        std::uint32_t stackPointerSize = 2;
+        std::uint32_t rampzAddress = 0x5B;
+        std::uint32_t eindAddress = 0x5C;
+        std::uint16_t stackPointerResetValue = 0x08FF;
+
+        /**
+         * The size of return addresses on the stack - 3 bytes on targets with more than 128KiB of program memory.
+         */
+        std::uint8_t returnAddressSize = 2;
+
+        std::uint64_t instructionCount = 0;
+
+        /**
+         * Resolved by Avr8Core::prepare(), before each execution, as the memory images may have been reallocated.
+         */
+        std::uint8_t* registers = nullptr;
+        std::uint8_t* data = nullptr;
+        std::uint32_t dataSize = 0;
+        const std::uint8_t* program = nullptr;
+        std::uint32_t programWords = 0;
+        std::uint8_t* statusRegister = nullptr;
+        std::uint32_t pc = 0;
+
+        bool prepare();
+        void commit();
+
+        Avr8CoreStopReason execute();
+
+        [[nodiscard]] std::uint16_t fetch(std::uint32_t wordAddress) const {
+            const auto byteAddress = (wordAddress % this->programWords) * 2;
+            return static_cast<std::uint16_t>(this->program[byteAddress] | (this->program[byteAddress + 1] << 8));
+        }
+
+        [[nodiscard]] std::uint8_t readData(std::uint32_t address) const {
+            return address < this->dataSize ? this->data[address] : 0x00;
+        }
+
+        void writeData(std::uint32_t address, std::uint8_t value) {
+            if (address < this->dataSize) {
+                this->data[address] = value;
+            }
+        }
+
+        [[nodiscard]] std::uint16_t readRegisterPair(std::uint8_t low) const {
+            return static_cast<std::uint16_t>(this->registers[low] | (this->registers[low + 1] << 8));
+        }
+
+        void writeRegisterPair(std::uint8_t low, std::uint16_t value) {
+            this->registers[low] = static_cast<std::uint8_t>(value);
+            this->registers[low + 1] = static_cast<std::uint8_t>(value >> 8);
+        }
+
+        [[nodiscard]] std::uint16_t readStackPointer() const;
+        void writeStackPointer(std::uint16_t value);
+
+        void push(std::uint8_t value);
+        std::uint8_t pop();
+
+        void pushReturnAddress(std::uint32_t wordAddress);
+        std::uint32_t popReturnAddress();
+
+        void setFlags(std::uint8_t mask, std::uint8_t values) {
+            *(this->statusRegister) = static_cast<std::uint8_t>((*(this->statusRegister) & ~mask) | (values & mask));
+        }
+
+        [[nodiscard]] bool flag(std::uint8_t mask) const {
+            return (*(this->statusRegister) & mask) != 0;
+        }
+
+        /**
+         * Sets the N, Z, V and S flags for the given result.
+         *
+         * @param result
+         * @param overflow
+         */
+        void setResultFlags(std::uint8_t result, bool overflow);
+
+        std::uint8_t add(std::uint8_t rd, std::uint8_t rr, bool withCarry);
+        std::uint8_t subtract(std::uint8_t rd, std::uint8_t rr, bool withCarry);
+
+        /**
+         * Checks if the instruction at the given word address occupies two words (LDS, STS, JMP and CALL).
+         *
+         * @param wordAddress
+         * @return
+         */
+        [[nodiscard]] bool isTwoWordInstruction(std::uint32_t wordAddress) const;
+    };
+}
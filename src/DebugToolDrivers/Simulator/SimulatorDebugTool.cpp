@@ -0,0 +1,200 @@
+#include "SimulatorDebugTool.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugToolDrivers::Simulator
+{
+    using namespace Targets;
+    using namespace Targets::Microchip::Avr::Avr8Bit;
+
+    using Exceptions::Exception;
+
+    SimulatorDebugTool::SimulatorDebugTool(const DebugToolConfig& debugToolConfig)
+        : MockDebugTool(debugToolConfig)
+        , core(this->dataSpace, this->registerFile, this->programMemory, this->programCounter)
+    {}
+
+    void SimulatorDebugTool::setTargetParameters(const TargetParameters& config) {
+        MockDebugTool::setTargetParameters(config);
+        this->configureCore();
+    }
+
+    void SimulatorDebugTool::stop() {
+        MockDebugTool::stop();
+
+        this->runToAddress = std::nullopt;
+        this->breakpointMapStale = true;
+        this->resumed = false;
+    }
+
+    void SimulatorDebugTool::run() {
+        this->simulateLatency();
+        this->resume();
+    }
+
+    void SimulatorDebugTool::runTo(TargetMemoryAddress address) {
+        this->simulateLatency();
+
+        this->runToAddress = address;
+        this->breakpointMapStale = true;
+        this->resume();
+    }
+
+    void SimulatorDebugTool::step() {
+        this->simulateLatency();
+
+        if (this->targetState != TargetState::STOPPED) {
+            throw Exception("Cannot step target - target is running");
+        }
+
+        const auto stopReason = this->core.step();
+        if (stopReason == Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION) {
+            Logger::warning(
+                "Simulator cannot step over the instruction at byte address "
+                    + std::to_string(this->programCounter) + " - the instruction is not supported"
+            );
+        }
+    }
+
+    void SimulatorDebugTool::reset() {
+        MockDebugTool::reset();
+
+        this->runToAddress = std::nullopt;
+        this->breakpointMapStale = true;
+        this->resumed = false;
+
+        if (this->coreConfigured) {
+            this->core.reset();
+        }
+    }
+
+    void SimulatorDebugTool::activate() {
+        MockDebugTool::activate();
+        this->configureCore();
+    }
+
+    void SimulatorDebugTool::setSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        MockDebugTool::setSoftwareBreakpoints(addresses);
+        this->breakpointMapStale = true;
+    }
+
+    void SimulatorDebugTool::clearSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        MockDebugTool::clearSoftwareBreakpoints(addresses);
+        this->breakpointMapStale = true;
+    }
+
+    void SimulatorDebugTool::setHardwareBreakpoint(std::uint16_t index, TargetMemoryAddress address) {
+        MockDebugTool::setHardwareBreakpoint(index, address);
+        this->breakpointMapStale = true;
+    }
+
+    void SimulatorDebugTool::clearHardwareBreakpoint(std::uint16_t index) {
+        MockDebugTool::clearHardwareBreakpoint(index);
+        this->breakpointMapStale = true;
+    }
+
+    void SimulatorDebugTool::clearAllBreakpoints() {
+        MockDebugTool::clearAllBreakpoints();
+        this->breakpointMapStale = true;
+    }
+
+    TargetState SimulatorDebugTool::getTargetState() {
+        this->simulateLatency();
+
+        if (this->targetState != TargetState::RUNNING) {
+            return this->targetState;
+        }
+
+        if (this->breakpointMapStale) {
+            this->rebuildBreakpointMap();
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + SimulatorDebugTool::EXECUTION_TIME_SLICE;
+
+        do {
+            const auto stopReason = this->core.run(
+                SimulatorDebugTool::EXECUTION_BATCH_SIZE,
+                this->breakpointMap,
+                this->resumed
+            );
+            this->resumed = false;
+
+            if (stopReason != Avr8CoreStopReason::NONE) {
+                this->halt(stopReason);
+                break;
+            }
+
+        } while (std::chrono::steady_clock::now() < deadline);
+
+        return this->targetState;
+    }
+
+    void SimulatorDebugTool::configureCore() {
+        if (!this->memoryImagesInitialised || this->coreConfigured) {
+            return;
+        }
+
+        this->core.configure(this->targetParameters, this->hasSeparateRegisterFile());
+        this->core.reset();
+        this->coreConfigured = true;
+        this->breakpointMapStale = true;
+
+        Logger::debug("Simulator core configured");
+    }
+
+    void SimulatorDebugTool::rebuildBreakpointMap() {
+        this->breakpointMap.assign(this->programMemory.size() / 2, false);
+
+        const auto flag = [this] (TargetMemoryAddress byteAddress) {
+            const auto wordAddress = static_cast<std::size_t>(byteAddress / 2);
+
+            if (wordAddress < this->breakpointMap.size()) {
+                this->breakpointMap[wordAddress] = true;
+            }
+        };
+
+        for (const auto address : this->softwareBreakpoints) {
+            flag(address);
+        }
+
+        for (const auto& [index, address] : this->hardwareBreakpointsByIndex) {
+            flag(address);
+        }
+
+        if (this->runToAddress.has_value()) {
+            flag(*(this->runToAddress));
+        }
+
+        this->breakpointMapStale = false;
+    }
+
+    void SimulatorDebugTool::resume() {
+        if (!this->coreConfigured) {
+            throw Exception("Cannot resume execution - the simulator has not been configured for the target");
+        }
+
+        this->resumed = true;
+        this->targetState = TargetState::RUNNING;
+    }
+
+    void SimulatorDebugTool::halt(Avr8CoreStopReason stopReason) {
+        this->targetState = TargetState::STOPPED;
+        this->resumed = false;
+
+        if (this->runToAddress.has_value()) {
+            this->runToAddress = std::nullopt;
+            this->breakpointMapStale = true;
+        }
+
+        if (stopReason == Avr8CoreStopReason::UNSUPPORTED_INSTRUCTION) {
+            Logger::warning(
+                "Simulated target stopped at unsupported instruction (byte address "
+                    + std::to_string(this->programCounter) + ")"
+            );
+        }
+
+        Logger::debug("Simulated instructions executed: " + std::to_string(this->core.getInstructionCount()));
+    }
+}
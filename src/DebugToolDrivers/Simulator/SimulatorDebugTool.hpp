@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <chrono>
+#include <optional>
+
+#include "src/DebugToolDrivers/Mock/MockDebugTool.hpp"
+#include "Avr8Core.hpp"
+
+namespace Bloom::DebugToolDrivers::Simulator
+{
+    /**
+     * The simulator debug tool runs the user's firmware on a built-in AVR8 instruction-set simulator (see Avr8Core),
+     * instead of a physical target. It allows for debugging sessions (and automated tests of firmware and of Bloom
+     * itself) on CI runners that have no hardware attached.
+     *
+     * The simulator builds on the mock debug tool - the memory images, breakpoint bookkeeping and the target
+     * parameters (from the TDF) are all inherited. Unlike the mock debug tool, the simulated target actually executes
+     * instructions:
+     *  - Steps execute a single instruction.
+     *  - Whilst the target is running, instructions are executed in time slices, upon each call to
+     *    getTargetState(). The target stops upon reaching a breakpoint, a "run to" address, a BREAK instruction or an
+     *    instruction that the simulator doesn't support.
+     *
+     * Only the CPU is simulated. There are no peripherals, no interrupts and no timing - see Avr8Core for more.
+     *
+     * The simulator is selected via the "simulator" debug tool name, in the user's project configuration file. It
+     * accepts the same config parameters as the mock debug tool.
+     */
+    class SimulatorDebugTool: public MockDebugTool
+    {
+    public:
+        explicit SimulatorDebugTool(const DebugToolConfig& debugToolConfig);
+
+        std::string getName() override {
+            return "Simulator";
+        }
+
+        std::string getSerialNumber() override {
+            return "SIM0000";
+        }
+
+        void setTargetParameters(const Targets::Microchip::Avr::Avr8Bit::TargetParameters& config) override;
+
+        void stop() override;
+
+        void run() override;
+
+        void runTo(Targets::TargetMemoryAddress address) override;
+
+        void step() override;
+
+        void reset() override;
+
+        void activate() override;
+
+        void setSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) override;
+
+        void clearSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) override;
+
+        void setHardwareBreakpoint(std::uint16_t index, Targets::TargetMemoryAddress address) override;
+
+        void clearHardwareBreakpoint(std::uint16_t index) override;
+
+        void clearAllBreakpoints() override;
+
+        Targets::TargetState getTargetState() override;
+
+    private:
+        /**
+         * The maximum amount of time to spend executing instructions, per call to getTargetState(). This keeps the
+         * TargetController responsive to other commands (memory reads, stop requests, etc) whilst the target is
+         * running.
+         */
+        static constexpr auto EXECUTION_TIME_SLICE = std::chrono::milliseconds(5);
+
+        /**
+         * The number of instructions to execute between checks of the time slice.
+         */
+        static constexpr std::uint64_t EXECUTION_BATCH_SIZE = 20000;
+
+        Avr8Core core;
+        bool coreConfigured = false;
+
+        /**
+         * The breakpoint addresses (software, hardware and the "run to" address), as a flag per instruction word.
+         * Rebuilt before execution resumes, whenever a breakpoint has been set or cleared.
+         */
+        std::vector<bool> breakpointMap;
+        bool breakpointMapStale = true;
+
+        std::optional<Targets::TargetMemoryAddress> runToAddress;
+
+        /**
+         * Set when execution has been resumed but no instructions have been executed yet. A breakpoint at the
+         * program counter should not stop the target before it has executed the instruction at that address.
+         */
+        bool resumed = false;
+
+        /**
+         * Configures the core, once the memory images have been initialised (see MockDebugTool::initMemoryImages()).
+         */
+        void configureCore();
+
+        void rebuildBreakpointMap();
+
+        void resume();
+
+        void halt(Avr8CoreStopReason stopReason);
+    };
+}
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <set>
+#include <vector>
 #include <optional>
 
 #include "src/Targets/Microchip/AVR/AVR8/Avr8TargetConfig.hpp"
@@ -15,6 +16,7 @@
 #include "src/Targets/TargetState.hpp"
 #include "src/Targets/TargetRegister.hpp"
 #include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetBreakpoint.hpp"
 
 namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
 {
@@ -107,6 +109,15 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
          */
         virtual void deactivate() = 0;
 
+        /**
+         * Should temporarily disable the debugWire module on the target, releasing the RESET pin (and thus allowing
+         * access to the target via the ISP interface). This must not affect the DWEN fuse - the module should be
+         * reactivated upon the next target power cycle.
+         *
+         * Only applicable to debugWire targets.
+         */
+        virtual void disableDebugWire() = 0;
+
         /**
          * Should retrieve the AVR8 target signature of the AVR8 target.
          *
@@ -118,18 +129,76 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
         virtual Targets::Microchip::Avr::TargetSignature getDeviceId() = 0;
 
         /**
-         * Should set a software breakpoint at a given address.
+         * Should set software breakpoints at the given addresses.
+         *
+         * Software breakpoints are written to the target's program memory, so implementations should set all of the
+         * given breakpoints in as few operations as possible.
+         *
+         * @param addresses
+         */
+        virtual void setSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) = 0;
+
+        /**
+         * Should remove the software breakpoints at the given addresses.
+         *
+         * @param addresses
+         */
+        virtual void clearSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) = 0;
+
+        /**
+         * Should return the number of hardware breakpoints that are available for use, given the current
+         * configuration.
+         *
+         * @return
+         */
+        virtual std::uint16_t getHardwareBreakpointCount() = 0;
+
+        /**
+         * Should set a hardware breakpoint at the given address.
+         *
+         * @param index
+         *  The zero-based index of the hardware breakpoint to use. Must be less than getHardwareBreakpointCount().
          *
          * @param address
          */
-        virtual void setBreakpoint(Targets::TargetMemoryAddress address) = 0;
+        virtual void setHardwareBreakpoint(std::uint16_t index, Targets::TargetMemoryAddress address) = 0;
+
+        /**
+         * Should clear the hardware breakpoint with the given index.
+         *
+         * @param index
+         */
+        virtual void clearHardwareBreakpoint(std::uint16_t index) = 0;
+
+        /**
+         * Should return the number of hardware breakpoints that can be configured as data breakpoints, given the
+         * current configuration. Data breakpoints occupy the same indices as hardware breakpoints.
+         *
+         * @return
+         */
+        virtual std::uint16_t getDataBreakpointCount() = 0;
 
         /**
-         * Should remove a software breakpoint at a given address.
+         * Should set a data breakpoint for the given RAM address.
+         *
+         * @param index
+         *  The zero-based index of the hardware breakpoint to use. Must be less than getDataBreakpointCount().
          *
          * @param address
+         * @param type
          */
-        virtual void clearBreakpoint(Targets::TargetMemoryAddress address) = 0;
+        virtual void setDataBreakpoint(
+            std::uint16_t index,
+            Targets::TargetMemoryAddress address,
+            Targets::TargetWatchpointType type
+        ) = 0;
+
+        /**
+         * Should clear the data breakpoint with the given index.
+         *
+         * @param index
+         */
+        virtual void clearDataBreakpoint(std::uint16_t index) = 0;
 
         /**
          * Should remove all software and hardware breakpoints on the target.
@@ -154,18 +223,23 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
          * Should read the requested registers from the target.
          *
          * @param descriptors
-         *  A collection of register descriptors, for the registers to be read.
+         *  The descriptors of the registers to be read.
          *
-         * @return
+         * @param output
+         *  The registers should be appended to this collection. The caller is expected to have reserved the space
+         *  for them.
          */
-        virtual Targets::TargetRegisters readRegisters(const Targets::TargetRegisterDescriptors& descriptors) = 0;
+        virtual void readRegisters(
+            Targets::TargetRegisterDescriptorSelection descriptors,
+            Targets::TargetRegisters& output
+        ) = 0;
 
         /**
          * Should update the value of the given registers.
          *
          * @param registers
          */
-        virtual void writeRegisters(const Targets::TargetRegisters& registers) = 0;
+        virtual void writeRegisters(Targets::TargetRegisterSelection registers) = 0;
 
         /**
          * Should read memory from the target, for the given memory type.
@@ -183,6 +257,21 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
             const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {}
         ) = 0;
 
+        /**
+         * Should read numerous (possibly disjoint) address ranges from the target, for the given memory type, in as
+         * few operations as possible.
+         *
+         * @param memoryType
+         * @param addressRanges
+         *
+         * @return
+         *  A buffer for each of the given address ranges, in the same order as the ranges.
+         */
+        virtual std::vector<Targets::TargetMemoryBuffer> readMemoryRanges(
+            Targets::TargetMemoryType memoryType,
+            const std::vector<Targets::TargetMemoryAddressRange>& addressRanges
+        ) = 0;
+
         /**
          * Should write memory to the target, for a given memory type.
          *
@@ -196,6 +285,21 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
             const Targets::TargetMemoryBuffer& buffer
         ) = 0;
 
+        /**
+         * Should compute a CRC-32 (see Bloom::Crc32) over the given range of the target's memory.
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         */
+        virtual std::uint32_t computeMemoryCrc(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes
+        ) = 0;
+
         /**
          * Should erase the target's entire program memory, or a specific section where applicable.
          *
@@ -206,6 +310,30 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
             std::optional<Targets::Microchip::Avr::Avr8Bit::ProgramMemorySection> section = std::nullopt
         ) = 0;
 
+        /**
+         * Should determine whether individual program memory pages can be rewritten, without erasing the entire
+         * program memory first. See Target::programMemoryPageRewritesSupported().
+         *
+         * @return
+         */
+        virtual bool programMemoryPageRewritesSupported() = 0;
+
+        /**
+         * Should determine whether whole EEPROM pages can be written in a single operation, in the current mode
+         * (debug or programming). See Target::eepromPageWritesSupported().
+         *
+         * @return
+         */
+        virtual bool eepromPageWritesSupported() = 0;
+
+        /**
+         * Should determine whether RAM can be read whilst the target is running. See
+         * Target::runtimeMemoryAccessSupported().
+         *
+         * @return
+         */
+        virtual bool runtimeMemoryAccessSupported() = 0;
+
         /**
          * Should obtain the current target state.
          *
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 
+#include "src/Targets/TargetMemory.hpp"
 #include "src/Targets/Microchip/AVR/TargetSignature.hpp"
 #include "src/Targets/Microchip/AVR/IspParameters.hpp"
 #include "src/Targets/Microchip/AVR/Fuse.hpp"
@@ -14,13 +16,15 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr
      * Many AVRs can be programmed via an SPI interface. Some debug tools provide access to this interface via the AVR
      * In-System Programming (ISP) protocol.
      *
-     * This interface class is incomplete - it only provides the ability to read the device ID and access AVR fuses and
-     * lockbit bytes (as that's all we need, for now).
+     * This interface class is incomplete - it only provides the ability to read the device ID, access AVR fuses and
+     * lockbit bytes, and read/program the program memory and EEPROM (as that's all we need, for now).
      *
-     * Currently, Bloom only uses the ISP interface for accessing fuses and lockbits on debugWire targets. We can't
-     * access fuses via the debugWire interface, so we have to use the ISP interface.
+     * Currently, Bloom only uses the ISP interface on debugWire targets. We can't access fuses via the debugWire
+     * interface, so we have to use the ISP interface. And programming the program memory via the ISP interface is
+     * much faster than programming it via the debugWire interface (where each page is written via the debug
+     * monitor).
      *
-     * @see Avr8::updateDwenFuseBit() for more.
+     * @see Avr8::updateDwenFuseBit() and Avr8::programProgramMemoryViaIsp() for more.
      */
     class AvrIspInterface
     {
@@ -86,5 +90,53 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr
          * @param fuse
          */
         virtual void programFuse(Targets::Microchip::Avr::Fuse fuse) = 0;
+
+        /**
+         * Should perform a chip erase - erasing the program memory and, unless the EESAVE fuse bit is programmed,
+         * the EEPROM. The lock bits are also cleared.
+         */
+        virtual void eraseChip() = 0;
+
+        /**
+         * Should read from the target's program memory.
+         *
+         * @param startAddress
+         *  Byte address.
+         *
+         * @param bytes
+         *
+         * @return
+         */
+        virtual Targets::TargetMemoryBuffer readProgramMemory(std::uint32_t startAddress, std::uint32_t bytes) = 0;
+
+        /**
+         * Should write the given buffer to the target's program memory. The start address and buffer size must be
+         * aligned to the program memory page size. The pages must have been erased beforehand (via a chip erase).
+         *
+         * @param startAddress
+         *  Byte address.
+         *
+         * @param buffer
+         */
+        virtual void writeProgramMemory(std::uint32_t startAddress, std::span<const unsigned char> buffer) = 0;
+
+        /**
+         * Should read from the target's EEPROM.
+         *
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         */
+        virtual Targets::TargetMemoryBuffer readEeprom(std::uint32_t startAddress, std::uint32_t bytes) = 0;
+
+        /**
+         * Should write the given buffer to the target's EEPROM. The start address and buffer size must be aligned to
+         * the EEPROM page size (for targets with paged EEPROM).
+         *
+         * @param startAddress
+         * @param buffer
+         */
+        virtual void writeEeprom(std::uint32_t startAddress, std::span<const unsigned char> buffer) = 0;
     };
 }
@@ -1,6 +1,9 @@
 #include "HidInterface.hpp"
 
+#include "src/DebugToolDrivers/USB/UsbDeviceRegistry.hpp"
 #include "src/Logger/Logger.hpp"
+#include "src/Services/TraceService.hpp"
+#include "src/Services/MetricsService.hpp"
 
 #include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
 #include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
@@ -25,6 +28,27 @@ namespace Bloom::Usb
         ::hid_init();
         ::hid_device* hidDevice = nullptr;
 
+        /*
+         * Enumerating HID devices is slow, so we reuse the path from the last enumeration, as long as the device
+         * hasn't been reconnected since (according to the UsbDeviceRegistry).
+         */
+        const auto cacheKey = CachedDevicePathKey(this->vendorId, this->productId, this->interfaceNumber);
+        const auto generation = UsbDeviceRegistry::getGeneration(this->vendorId, this->productId);
+        const auto cachedPathIt = HidInterface::cachedDevicePaths.find(cacheKey);
+
+        if (
+            generation.has_value()
+            && cachedPathIt != HidInterface::cachedDevicePaths.end()
+            && cachedPathIt->second.generation == *generation
+        ) {
+            if ((hidDevice = ::hid_open_path(cachedPathIt->second.path.c_str())) != nullptr) {
+                this->hidDevice.reset(hidDevice);
+                return;
+            }
+
+            Logger::debug("Failed to open HID device via cached path - enumerating HID devices");
+        }
+
         const auto hidInterfacePath = this->getHidDevicePath();
         Logger::debug("HID device path: " + hidInterfacePath);
 
@@ -33,6 +57,10 @@ namespace Bloom::Usb
         }
 
         this->hidDevice.reset(hidDevice);
+
+        if (generation.has_value()) {
+            HidInterface::cachedDevicePaths[cacheKey] = CachedDevicePath{hidInterfacePath, *generation};
+        }
     }
 
     void HidInterface::close() {
@@ -40,63 +68,55 @@ namespace Bloom::Usb
         ::hid_exit();
     }
 
-    std::vector<unsigned char> HidInterface::read(std::optional<std::chrono::milliseconds> timeout) {
-        auto output = std::vector<unsigned char>();
-
-        const auto readSize = this->inputReportSize;
-        auto transferredByteCount = int(0);
-        auto totalByteCount = std::size_t(0);
-
-        do {
-            output.resize(totalByteCount + readSize, 0x00);
+    std::size_t HidInterface::readPacket(
+        std::span<unsigned char> packet,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        const auto traceSpan = Services::TraceService::Span("HidInterface::read", "USB");
 
-            transferredByteCount = ::hid_read_timeout(
-                this->hidDevice.get(),
-                output.data() + totalByteCount,
-                readSize,
-                timeout.has_value() ? static_cast<int>(timeout->count()) : -1
-            );
-
-            if (transferredByteCount == -1) {
-                throw DeviceCommunicationFailure("Failed to read from HID device.");
-            }
+        if (packet.size() < this->inputReportSize) {
+            throw DeviceCommunicationFailure("Cannot read from HID interface - report buffer too small.");
+        }
 
-            if (totalByteCount == 0) {
-                // After the first read, set the timeout to 1 millisecond, as we don't want to wait for subsequent data
-                timeout = std::chrono::milliseconds(1);
-            }
+        /*
+         * We used to keep reading (with a 1ms timeout) until we received a short report. But our devices always send
+         * full size reports, so that just added a millisecond to every read.
+         */
+        const auto transferredByteCount = ::hid_read_timeout(
+            this->hidDevice.get(),
+            packet.data(),
+            this->inputReportSize,
+            timeout.has_value() ? static_cast<int>(timeout->count()) : -1
+        );
 
-            totalByteCount += static_cast<std::size_t>(transferredByteCount);
+        if (transferredByteCount == -1) {
+            throw DeviceCommunicationFailure("Failed to read from HID device.");
+        }
 
-        } while (transferredByteCount >= readSize);
+        static auto& reportsReceived = Services::MetricsService::counter("usb.reportsReceived");
+        reportsReceived.increment();
 
-        output.resize(totalByteCount, 0x00);
-        return output;
+        return static_cast<std::size_t>(transferredByteCount);
     }
 
-    void HidInterface::write(std::vector<unsigned char>&& buffer) {
-        if (buffer.size() > this->inputReportSize) {
-            throw DeviceCommunicationFailure(
-                "Cannot send data via HID interface - data exceeds maximum packet size."
-            );
-        }
+    void HidInterface::writePacket(std::span<const unsigned char> packet) {
+        const auto traceSpan = Services::TraceService::Span("HidInterface::write", "USB");
 
-        if (buffer.size() < this->inputReportSize) {
-            /*
-             * Every report we send via the USB HID interface should be of a fixed size.
-             * In the event of a report being too small, we just fill the buffer vector with 0.
-             */
-            buffer.resize(this->inputReportSize, 0);
+        if (packet.size() != this->inputReportSize) {
+            throw DeviceCommunicationFailure("Cannot send data via HID interface - invalid report size.");
         }
 
         int transferred = 0;
-        const auto length = buffer.size();
+        const auto length = packet.size();
 
-        if ((transferred = ::hid_write(this->hidDevice.get(), buffer.data(), length)) != length) {
+        if ((transferred = ::hid_write(this->hidDevice.get(), packet.data(), length)) != length) {
             Logger::debug("Attempted to write " + std::to_string(length)
                 + " bytes to HID interface. Bytes written: " + std::to_string(transferred));
             throw DeviceCommunicationFailure("Failed to write data to HID interface.");
         }
+
+        static auto& reportsSent = Services::MetricsService::counter("usb.reportsSent");
+        reportsSent.increment();
     }
 
     std::string HidInterface::getHidDevicePath() {
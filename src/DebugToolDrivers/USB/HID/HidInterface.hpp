@@ -6,10 +6,15 @@
 #include <vector>
 #include <optional>
 #include <chrono>
+#include <span>
+#include <map>
+#include <tuple>
 
 #include <hidapi/hidapi.h>
 #include <hidapi/hidapi_libusb.h>
 
+#include "src/DebugToolDrivers/USB/PacketInterface.hpp"
+
 namespace Bloom::Usb
 {
     /**
@@ -18,7 +23,7 @@ namespace Bloom::Usb
      * Currently, this interface only supports single-report HID implementations. HID interfaces with
      * multiple reports will be supported as-and-when we need it.
      */
-    class HidInterface
+    class HidInterface: public PacketInterface
     {
     public:
         std::uint8_t interfaceNumber = 0;
@@ -40,34 +45,62 @@ namespace Bloom::Usb
         /**
          * Obtains a hid_device instance and claims the HID interface on the device.
          */
-        void init();
+        void init() override;
 
         /**
          * Releases any claimed interfaces and closes the hid_device.
          */
-        void close();
+        void close() override;
+
+        [[nodiscard]] std::size_t getPacketSize() const override {
+            return this->inputReportSize;
+        }
 
         /**
-         * Reads as much data as the device has to offer, into a vector.
+         * Reads a single input report from the device.
          *
+         * The HIDAPI (libusb backend) receives input reports on its own thread, via asynchronous interrupt
+         * transfers, and queues them for us. So this will return as soon as the report is available - there is no
+         * need to wait for any more data.
+         *
+         * @param packet
          * @param timeout
          *
          * @return
-         *  A vector of the data received from the device.
          */
-        std::vector<unsigned char> read(std::optional<std::chrono::milliseconds> timeout = std::nullopt);
+        std::size_t readPacket(
+            std::span<unsigned char> packet,
+            std::optional<std::chrono::milliseconds> timeout
+        ) override;
 
         /**
-         * Writes buffer to HID output endpoint.
+         * Writes a single, complete report to the HID output endpoint.
          *
-         * @param buffer
+         * @param packet
          */
-        void write(std::vector<unsigned char>&& buffer);
+        void writePacket(std::span<const unsigned char> packet) override;
 
         std::string getHidDevicePath();
 
     private:
         using HidDevice = std::unique_ptr<::hid_device, decltype(&::hid_close)>;
+        using CachedDevicePathKey = std::tuple<std::uint16_t, std::uint16_t, std::uint8_t>;
+
+        struct CachedDevicePath
+        {
+            std::string path;
+
+            /**
+             * The UsbDeviceRegistry generation of the device, at the time the path was obtained. See
+             * UsbDeviceRegistry::getGeneration().
+             */
+            std::uint64_t generation = 0;
+        };
+
+        /**
+         * HID device paths from previous enumerations, mapped by vendor ID, product ID and interface number.
+         */
+        static inline std::map<CachedDevicePathKey, CachedDevicePath> cachedDevicePaths;
 
         HidDevice hidDevice = HidDevice(nullptr, ::hid_close);
 
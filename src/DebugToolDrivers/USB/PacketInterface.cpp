@@ -0,0 +1,34 @@
+#include "PacketInterface.hpp"
+
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+
+namespace Bloom::Usb
+{
+    using namespace Bloom::Exceptions;
+
+    std::vector<unsigned char> PacketInterface::read(std::optional<std::chrono::milliseconds> timeout) {
+        auto output = std::vector<unsigned char>(this->getPacketSize(), 0x00);
+        output.resize(this->readPacket(output, timeout));
+        return output;
+    }
+
+    void PacketInterface::write(std::vector<unsigned char>&& buffer) {
+        const auto packetSize = this->getPacketSize();
+
+        if (buffer.size() > packetSize) {
+            throw DeviceCommunicationFailure(
+                "Cannot send data via USB interface - data exceeds maximum packet size."
+            );
+        }
+
+        if (buffer.size() < packetSize) {
+            /*
+             * Every packet we send should be of a fixed size (for HID interfaces, this is a requirement). In the
+             * event of a packet being too small, we just fill the buffer vector with 0.
+             */
+            buffer.resize(packetSize, 0);
+        }
+
+        this->writePacket(buffer);
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <optional>
+#include <chrono>
+#include <span>
+
+namespace Bloom::Usb
+{
+    /**
+     * A USB interface over which fixed size packets are exchanged with a device.
+     *
+     * CMSIS-DAP devices can expose their CMSIS-DAP interface as a HID interface (CMSIS-DAP v1, see HidInterface),
+     * or as a vendor-specific interface with a pair of bulk endpoints (CMSIS-DAP v2, see UsbBulkInterface). The
+     * CmsisDapInterface operates over either, via this class.
+     */
+    class PacketInterface
+    {
+    public:
+        PacketInterface() = default;
+        virtual ~PacketInterface() = default;
+
+        PacketInterface(const PacketInterface& other) = delete;
+        PacketInterface& operator = (const PacketInterface& other) = delete;
+
+        PacketInterface(PacketInterface&& other) = default;
+        PacketInterface& operator = (PacketInterface&& other) = default;
+
+        /**
+         * Claims the interface on the device.
+         */
+        virtual void init() = 0;
+
+        /**
+         * Releases the interface.
+         */
+        virtual void close() = 0;
+
+        /**
+         * The maximum size of a single packet, in bytes. For HID interfaces, this is the report size.
+         *
+         * @return
+         */
+        [[nodiscard]] virtual std::size_t getPacketSize() const = 0;
+
+        /**
+         * Reads a single packet from the device, into the given buffer.
+         *
+         * @param packet
+         *  Must be at least getPacketSize() bytes in size.
+         *
+         * @param timeout
+         *  If not provided, we'll wait indefinitely.
+         *
+         * @return
+         *  The number of bytes read into the buffer. Zero if the timeout was reached.
+         */
+        virtual std::size_t readPacket(
+            std::span<unsigned char> packet,
+            std::optional<std::chrono::milliseconds> timeout
+        ) = 0;
+
+        /**
+         * Writes a single, complete packet to the device, without copying it.
+         *
+         * @param packet
+         *  Must be exactly getPacketSize() bytes in size.
+         */
+        virtual void writePacket(std::span<const unsigned char> packet) = 0;
+
+        /**
+         * Reads a single packet from the device.
+         *
+         * @param timeout
+         *  If not provided, we'll wait indefinitely.
+         *
+         * @return
+         *  The packet data, or an empty vector if the timeout was reached.
+         */
+        std::vector<unsigned char> read(std::optional<std::chrono::milliseconds> timeout = std::nullopt);
+
+        /**
+         * Writes buffer to the device, as a single packet. Buffers smaller than the packet size are padded with
+         * zeros.
+         *
+         * @param buffer
+         */
+        void write(std::vector<unsigned char>&& buffer);
+    };
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <vector>
+
+namespace Bloom::Usb
+{
+    /**
+     * USB packet trace files, as written by the RecordingPacketInterface and served by the ReplayPacketInterface.
+     *
+     * A trace file begins with a header, consisting of the magic bytes ("BLMUSBTR"), the format version (2 bytes) and
+     * the packet size of the recorded interface (2 bytes). The header is followed by one record for each packet
+     * written to, or read from, the device. Each record consists of:
+     *  - The record type (1 byte, see PacketTrace::RecordType)
+     *  - A timestamp, in microseconds since the start of the recording (8 bytes)
+     *  - The length of the packet (2 bytes)
+     *  - The number of bytes stored in the record (2 bytes)
+     *  - The stored bytes
+     *
+     * Packets are padded to the packet size, so they usually end in a long run of zeros. The trailing zeros are not
+     * stored - readers restore them from the packet length. Reads that timed out are recorded as zero-length reads.
+     *
+     * All integers are little-endian.
+     */
+    struct PacketTrace
+    {
+        enum class RecordType: std::uint8_t
+        {
+            WRITE = 0x01,
+            READ = 0x02,
+        };
+
+        struct Record
+        {
+            RecordType type = RecordType::WRITE;
+            std::uint64_t timestamp = 0;
+
+            /**
+             * The packet data, including any trailing zeros.
+             */
+            std::vector<unsigned char> data;
+        };
+
+        static constexpr auto MAGIC = std::to_array<unsigned char>({'B', 'L', 'M', 'U', 'S', 'B', 'T', 'R'});
+        static constexpr std::uint16_t VERSION = 1;
+
+        static constexpr std::size_t HEADER_SIZE = PacketTrace::MAGIC.size() + 2 + 2;
+        static constexpr std::size_t RECORD_HEADER_SIZE = 1 + 8 + 2 + 2;
+    };
+}
@@ -0,0 +1,93 @@
+#include "RecordingPacketInterface.hpp"
+
+#include <algorithm>
+
+#include "src/Logger/Logger.hpp"
+
+#include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
+
+namespace Bloom::Usb
+{
+    using namespace Bloom::Exceptions;
+
+    namespace
+    {
+        template <typename IntegerType>
+        void appendLittleEndian(std::vector<unsigned char>& buffer, IntegerType value) {
+            for (auto byteIndex = std::size_t(0); byteIndex < sizeof(IntegerType); ++byteIndex) {
+                buffer.push_back(static_cast<unsigned char>(value >> (byteIndex * 8)));
+            }
+        }
+    }
+
+    RecordingPacketInterface::RecordingPacketInterface(
+        std::unique_ptr<PacketInterface> packetInterface,
+        const std::string& traceFilePath
+    )
+        : packetInterface(std::move(packetInterface))
+        , traceFile(traceFilePath, std::ios::binary | std::ios::trunc)
+    {
+        if (!this->traceFile.is_open()) {
+            throw DeviceInitializationFailure("Failed to create USB trace file (\"" + traceFilePath + "\")");
+        }
+
+        auto header = std::vector<unsigned char>(PacketTrace::MAGIC.begin(), PacketTrace::MAGIC.end());
+        appendLittleEndian(header, PacketTrace::VERSION);
+        appendLittleEndian(header, static_cast<std::uint16_t>(this->packetInterface->getPacketSize()));
+
+        this->traceFile.write(
+            reinterpret_cast<const char*>(header.data()),
+            static_cast<std::streamsize>(header.size())
+        );
+
+        Logger::warning("Recording USB trace to \"" + traceFilePath + "\"");
+    }
+
+    void RecordingPacketInterface::init() {
+        this->packetInterface->init();
+    }
+
+    void RecordingPacketInterface::close() {
+        this->packetInterface->close();
+        this->traceFile.flush();
+    }
+
+    std::size_t RecordingPacketInterface::readPacket(
+        std::span<unsigned char> packet,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        const auto bytesRead = this->packetInterface->readPacket(packet, timeout);
+        this->writeRecord(PacketTrace::RecordType::READ, packet.first(bytesRead));
+        return bytesRead;
+    }
+
+    void RecordingPacketInterface::writePacket(std::span<const unsigned char> packet) {
+        this->writeRecord(PacketTrace::RecordType::WRITE, packet);
+        this->packetInterface->writePacket(packet);
+    }
+
+    void RecordingPacketInterface::writeRecord(PacketTrace::RecordType type, std::span<const unsigned char> packet) {
+        // Trailing zeros (padding) are not stored - see PacketTrace
+        const auto lastNonZeroIt = std::find_if(packet.rbegin(), packet.rend(), [] (unsigned char byte) {
+            return byte != 0x00;
+        });
+        const auto storedSize = static_cast<std::size_t>(std::distance(lastNonZeroIt, packet.rend()));
+
+        const auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - this->startTime
+        ).count();
+
+        auto record = std::vector<unsigned char>();
+        record.reserve(PacketTrace::RECORD_HEADER_SIZE + storedSize);
+        record.push_back(static_cast<unsigned char>(type));
+        appendLittleEndian(record, static_cast<std::uint64_t>(timestamp));
+        appendLittleEndian(record, static_cast<std::uint16_t>(packet.size()));
+        appendLittleEndian(record, static_cast<std::uint16_t>(storedSize));
+        record.insert(record.end(), packet.begin(), packet.begin() + static_cast<std::ptrdiff_t>(storedSize));
+
+        this->traceFile.write(
+            reinterpret_cast<const char*>(record.data()),
+            static_cast<std::streamsize>(record.size())
+        );
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <fstream>
+#include <chrono>
+#include <span>
+
+#include "src/DebugToolDrivers/USB/PacketInterface.hpp"
+#include "PacketTrace.hpp"
+
+namespace Bloom::Usb
+{
+    /**
+     * Wraps another PacketInterface, recording every packet written to and read from the device, with timestamps,
+     * to a trace file (see PacketTrace for the format).
+     *
+     * Recorded traces can be replayed without the device, via the ReplayPacketInterface. This allows for USB
+     * transaction counts and host-side overhead to be measured for a recorded sequence of operations (a program
+     * memory write, a number of steps, etc), without a board attached.
+     *
+     * Recording is enabled via the "recordUsbTrace" debug tool config parameter.
+     */
+    class RecordingPacketInterface: public PacketInterface
+    {
+    public:
+        /**
+         * Creates the trace file and writes the header. The wrapped interface must already be initialised (its
+         * packet size is recorded in the header).
+         *
+         * @param packetInterface
+         * @param traceFilePath
+         */
+        RecordingPacketInterface(std::unique_ptr<PacketInterface> packetInterface, const std::string& traceFilePath);
+
+        /**
+         * Initialises the wrapped interface.
+         */
+        void init() override;
+
+        /**
+         * Closes the wrapped interface and flushes the trace file.
+         */
+        void close() override;
+
+        [[nodiscard]] std::size_t getPacketSize() const override {
+            return this->packetInterface->getPacketSize();
+        }
+
+        std::size_t readPacket(
+            std::span<unsigned char> packet,
+            std::optional<std::chrono::milliseconds> timeout
+        ) override;
+
+        void writePacket(std::span<const unsigned char> packet) override;
+
+    private:
+        std::unique_ptr<PacketInterface> packetInterface;
+        std::ofstream traceFile;
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        void writeRecord(PacketTrace::RecordType type, std::span<const unsigned char> packet);
+    };
+}
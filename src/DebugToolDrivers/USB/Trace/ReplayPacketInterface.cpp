@@ -0,0 +1,151 @@
+#include "ReplayPacketInterface.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+
+#include "src/Logger/Logger.hpp"
+#include "src/Services/MetricsService.hpp"
+
+#include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+
+namespace Bloom::Usb
+{
+    using namespace Bloom::Exceptions;
+
+    namespace
+    {
+        template <typename IntegerType>
+        IntegerType readLittleEndian(const unsigned char* data) {
+            auto value = IntegerType(0);
+
+            for (auto byteIndex = std::size_t(0); byteIndex < sizeof(IntegerType); ++byteIndex) {
+                value |= static_cast<IntegerType>(static_cast<IntegerType>(data[byteIndex]) << (byteIndex * 8));
+            }
+
+            return value;
+        }
+    }
+
+    ReplayPacketInterface::ReplayPacketInterface(std::string traceFilePath)
+        : traceFilePath(std::move(traceFilePath))
+    {}
+
+    void ReplayPacketInterface::init() {
+        auto traceFile = std::ifstream(this->traceFilePath, std::ios::binary);
+
+        if (!traceFile.is_open()) {
+            throw DeviceInitializationFailure("Failed to open USB trace file (\"" + this->traceFilePath + "\")");
+        }
+
+        const auto content = std::vector<unsigned char>(
+            std::istreambuf_iterator<char>(traceFile),
+            std::istreambuf_iterator<char>()
+        );
+
+        if (
+            content.size() < PacketTrace::HEADER_SIZE
+            || !std::equal(PacketTrace::MAGIC.begin(), PacketTrace::MAGIC.end(), content.begin())
+        ) {
+            throw DeviceInitializationFailure("Invalid USB trace file (\"" + this->traceFilePath + "\")");
+        }
+
+        const auto version = readLittleEndian<std::uint16_t>(content.data() + PacketTrace::MAGIC.size());
+        if (version != PacketTrace::VERSION) {
+            throw DeviceInitializationFailure(
+                "Unsupported USB trace file version (" + std::to_string(version) + ")"
+            );
+        }
+
+        this->packetSize = readLittleEndian<std::uint16_t>(content.data() + PacketTrace::MAGIC.size() + 2);
+        this->records.clear();
+        this->nextRecordIndex = 0;
+
+        auto offset = PacketTrace::HEADER_SIZE;
+
+        while (offset < content.size()) {
+            if ((content.size() - offset) < PacketTrace::RECORD_HEADER_SIZE) {
+                throw DeviceInitializationFailure("Truncated USB trace file - incomplete record header");
+            }
+
+            const auto* recordHeader = content.data() + offset;
+            const auto packetLength = readLittleEndian<std::uint16_t>(recordHeader + 9);
+            const auto storedLength = readLittleEndian<std::uint16_t>(recordHeader + 11);
+
+            offset += PacketTrace::RECORD_HEADER_SIZE;
+
+            if ((content.size() - offset) < storedLength || storedLength > packetLength) {
+                throw DeviceInitializationFailure("Truncated USB trace file - incomplete record data");
+            }
+
+            auto record = PacketTrace::Record();
+            record.type = static_cast<PacketTrace::RecordType>(recordHeader[0]);
+            record.timestamp = readLittleEndian<std::uint64_t>(recordHeader + 1);
+            record.data = std::vector<unsigned char>(packetLength, 0x00);
+            std::copy_n(content.begin() + static_cast<std::ptrdiff_t>(offset), storedLength, record.data.begin());
+
+            this->records.emplace_back(std::move(record));
+            offset += storedLength;
+        }
+
+        Logger::warning(
+            "Replaying USB trace from \"" + this->traceFilePath + "\" (" + std::to_string(this->records.size())
+                + " records)"
+        );
+    }
+
+    void ReplayPacketInterface::close() {
+        Logger::info(
+            "USB trace replay consumed " + std::to_string(this->nextRecordIndex) + " of "
+                + std::to_string(this->records.size()) + " records"
+        );
+    }
+
+    std::size_t ReplayPacketInterface::readPacket(
+        std::span<unsigned char> packet,
+        std::optional<std::chrono::milliseconds>
+    ) {
+        const auto& record = this->takeRecord(PacketTrace::RecordType::READ);
+        const auto bytes = std::min(record.data.size(), packet.size());
+        std::copy_n(record.data.begin(), bytes, packet.begin());
+
+        static auto& packetsReceived = Services::MetricsService::counter("usb.replay.packetsReceived");
+        packetsReceived.increment();
+
+        return bytes;
+    }
+
+    void ReplayPacketInterface::writePacket(std::span<const unsigned char> packet) {
+        const auto& record = this->takeRecord(PacketTrace::RecordType::WRITE);
+
+        if (!std::equal(packet.begin(), packet.end(), record.data.begin(), record.data.end())) {
+            throw DeviceCommunicationFailure(
+                "USB trace replay diverged at record " + std::to_string(this->nextRecordIndex - 1)
+                    + " - the written packet doesn't match the recorded packet"
+            );
+        }
+
+        static auto& packetsSent = Services::MetricsService::counter("usb.replay.packetsSent");
+        packetsSent.increment();
+    }
+
+    const PacketTrace::Record& ReplayPacketInterface::takeRecord(PacketTrace::RecordType type) {
+        if (this->nextRecordIndex >= this->records.size()) {
+            throw DeviceCommunicationFailure("USB trace replay diverged - the trace has been exhausted");
+        }
+
+        const auto& record = this->records[this->nextRecordIndex];
+
+        if (record.type != type) {
+            throw DeviceCommunicationFailure(
+                "USB trace replay diverged at record " + std::to_string(this->nextRecordIndex) + " - expected a "
+                    + (type == PacketTrace::RecordType::WRITE ? "write" : "read") + ", but the trace holds a "
+                    + (record.type == PacketTrace::RecordType::WRITE ? "write" : "read")
+            );
+        }
+
+        ++(this->nextRecordIndex);
+        return record;
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <span>
+
+#include "src/DebugToolDrivers/USB/PacketInterface.hpp"
+#include "PacketTrace.hpp"
+
+namespace Bloom::Usb
+{
+    /**
+     * Serves a USB packet trace (recorded via the RecordingPacketInterface) in place of a real device.
+     *
+     * Packets are served in the order in which they were recorded. Every packet written to the interface must match
+     * the next recorded write, and every read is served with the next recorded read. If the host's exchange diverges
+     * from the recording (e.g. because a change to Bloom altered the fragmentation of a memory access), a
+     * DeviceCommunicationFailure is thrown, identifying the offending record.
+     *
+     * Replay is as fast as the host allows - the recorded timestamps are not honoured. Exchanges whose shape depends
+     * on timing (such as polling for break events whilst the target is running) are not reproducible, so a trace
+     * should only cover operations that are driven by the host.
+     */
+    class ReplayPacketInterface: public PacketInterface
+    {
+    public:
+        explicit ReplayPacketInterface(std::string traceFilePath);
+
+        /**
+         * Loads the trace file.
+         */
+        void init() override;
+
+        /**
+         * Reports how much of the trace was consumed.
+         */
+        void close() override;
+
+        [[nodiscard]] std::size_t getPacketSize() const override {
+            return this->packetSize;
+        }
+
+        /**
+         * Serves the next recorded read. Replay never blocks, so there's nothing to time out - the timeout is
+         * ignored.
+         *
+         * @param packet
+         *
+         * @return
+         */
+        std::size_t readPacket(
+            std::span<unsigned char> packet,
+            std::optional<std::chrono::milliseconds> timeout
+        ) override;
+
+        void writePacket(std::span<const unsigned char> packet) override;
+
+    private:
+        std::string traceFilePath;
+        std::size_t packetSize = 0;
+
+        std::vector<PacketTrace::Record> records;
+        std::size_t nextRecordIndex = 0;
+
+        /**
+         * Returns the next record, provided it's of the given type.
+         *
+         * @param type
+         *
+         * @throws DeviceCommunicationFailure
+         *  If the trace has been exhausted, or if the next record is of a different type.
+         *
+         * @return
+         */
+        const PacketTrace::Record& takeRecord(PacketTrace::RecordType type);
+    };
+}
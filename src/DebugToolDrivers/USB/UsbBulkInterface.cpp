@@ -0,0 +1,122 @@
+#include "UsbBulkInterface.hpp"
+
+#include <string>
+#include <algorithm>
+
+#include "src/Logger/Logger.hpp"
+#include "src/Services/TraceService.hpp"
+#include "src/Services/MetricsService.hpp"
+
+#include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+
+namespace Bloom::Usb
+{
+    using namespace Bloom::Exceptions;
+
+    UsbBulkInterface::UsbBulkInterface(
+        ::libusb_device_handle* deviceHandle,
+        std::uint8_t interfaceNumber,
+        std::uint8_t inEndpointAddress,
+        std::uint8_t outEndpointAddress,
+        std::uint16_t packetSize
+    )
+        : interfaceNumber(interfaceNumber)
+        , inEndpointAddress(inEndpointAddress)
+        , outEndpointAddress(outEndpointAddress)
+        , packetSize(packetSize)
+        , deviceHandle(deviceHandle)
+    {}
+
+    UsbBulkInterface::~UsbBulkInterface() {
+        this->close();
+    }
+
+    void UsbBulkInterface::init() {
+        const auto libusbStatusCode = ::libusb_claim_interface(this->deviceHandle, this->interfaceNumber);
+
+        if (libusbStatusCode < 0) {
+            throw DeviceInitializationFailure(
+                "Failed to claim USB interface " + std::to_string(this->interfaceNumber) + " - error code "
+                    + std::to_string(libusbStatusCode) + " returned."
+            );
+        }
+
+        this->claimed = true;
+    }
+
+    void UsbBulkInterface::close() {
+        if (this->claimed) {
+            ::libusb_release_interface(this->deviceHandle, this->interfaceNumber);
+            this->claimed = false;
+        }
+    }
+
+    std::size_t UsbBulkInterface::readPacket(
+        std::span<unsigned char> packet,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        const auto traceSpan = Services::TraceService::Span("UsbBulkInterface::read", "USB");
+
+        if (packet.size() < this->packetSize) {
+            throw DeviceCommunicationFailure("Cannot read from USB bulk interface - packet buffer too small.");
+        }
+
+        auto transferredByteCount = 0;
+
+        // A timeout of 0 means no timeout, with libusb
+        const auto libusbStatusCode = ::libusb_bulk_transfer(
+            this->deviceHandle,
+            this->inEndpointAddress,
+            packet.data(),
+            static_cast<int>(this->packetSize),
+            &transferredByteCount,
+            timeout.has_value() ? std::max(static_cast<unsigned int>(timeout->count()), 1U) : 0
+        );
+
+        if (libusbStatusCode < 0 && libusbStatusCode != ::LIBUSB_ERROR_TIMEOUT) {
+            throw DeviceCommunicationFailure(
+                "Failed to read from USB bulk endpoint - error code " + std::to_string(libusbStatusCode)
+                    + " returned."
+            );
+        }
+
+        static auto& packetsReceived = Services::MetricsService::counter("usb.bulkPacketsReceived");
+        packetsReceived.increment();
+
+        return static_cast<std::size_t>(transferredByteCount);
+    }
+
+    void UsbBulkInterface::writePacket(std::span<const unsigned char> packet) {
+        const auto traceSpan = Services::TraceService::Span("UsbBulkInterface::write", "USB");
+
+        if (packet.size() > this->packetSize) {
+            throw DeviceCommunicationFailure("Cannot send data via USB bulk interface - invalid packet size.");
+        }
+
+        auto transferredByteCount = 0;
+        const auto length = static_cast<int>(packet.size());
+
+        /*
+         * libusb takes a non-const buffer, as it uses the same function for both directions. It doesn't modify the
+         * buffer for OUT transfers.
+         */
+        const auto libusbStatusCode = ::libusb_bulk_transfer(
+            this->deviceHandle,
+            this->outEndpointAddress,
+            const_cast<unsigned char*>(packet.data()),
+            length,
+            &transferredByteCount,
+            0
+        );
+
+        if (libusbStatusCode < 0 || transferredByteCount != length) {
+            Logger::debug("Attempted to write " + std::to_string(length)
+                + " bytes to USB bulk endpoint. Bytes written: " + std::to_string(transferredByteCount));
+            throw DeviceCommunicationFailure("Failed to write data to USB bulk endpoint.");
+        }
+
+        static auto& packetsSent = Services::MetricsService::counter("usb.bulkPacketsSent");
+        packetsSent.increment();
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <chrono>
+#include <span>
+#include <libusb-1.0/libusb.h>
+
+#include "src/DebugToolDrivers/USB/PacketInterface.hpp"
+
+namespace Bloom::Usb
+{
+    /**
+     * The UsbBulkInterface uses libusb to implement communication with a pair of bulk endpoints (one IN, one OUT),
+     * on a single USB interface.
+     *
+     * Newer CMSIS-DAP (v2) devices expose their CMSIS-DAP interface in this form, alongside the HID interface.
+     * Compared to HID, bulk endpoints typically allow for larger packets (512 bytes on high-speed devices), and
+     * transfers aren't subject to the polling interval of an interrupt endpoint.
+     */
+    class UsbBulkInterface: public PacketInterface
+    {
+    public:
+        std::uint8_t interfaceNumber = 0;
+        std::uint8_t inEndpointAddress = 0;
+        std::uint8_t outEndpointAddress = 0;
+        std::uint16_t packetSize = 64;
+
+        /**
+         * @param deviceHandle
+         *  The handle of the open USB device. The interface does not take ownership of the handle - it must remain
+         *  open until the interface has been closed.
+         *
+         * @param interfaceNumber
+         * @param inEndpointAddress
+         * @param outEndpointAddress
+         *
+         * @param packetSize
+         *  The maximum packet size of the endpoints.
+         */
+        UsbBulkInterface(
+            ::libusb_device_handle* deviceHandle,
+            std::uint8_t interfaceNumber,
+            std::uint8_t inEndpointAddress,
+            std::uint8_t outEndpointAddress,
+            std::uint16_t packetSize
+        );
+
+        ~UsbBulkInterface() override;
+
+        UsbBulkInterface(const UsbBulkInterface& other) = delete;
+        UsbBulkInterface& operator = (const UsbBulkInterface& other) = delete;
+
+        UsbBulkInterface(UsbBulkInterface&& other) = delete;
+        UsbBulkInterface& operator = (UsbBulkInterface&& other) = delete;
+
+        /**
+         * Claims the USB interface.
+         */
+        void init() override;
+
+        /**
+         * Releases the USB interface, if it has been claimed.
+         */
+        void close() override;
+
+        [[nodiscard]] std::size_t getPacketSize() const override {
+            return this->packetSize;
+        }
+
+        std::size_t readPacket(
+            std::span<unsigned char> packet,
+            std::optional<std::chrono::milliseconds> timeout
+        ) override;
+
+        void writePacket(std::span<const unsigned char> packet) override;
+
+    private:
+        ::libusb_device_handle* deviceHandle = nullptr;
+        bool claimed = false;
+    };
+}
@@ -2,6 +2,8 @@
 
 #include <libusb-1.0/libusb.h>
 
+#include "UsbDeviceRegistry.hpp"
+
 #include "src/Logger/Logger.hpp"
 #include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
 #include "src/TargetController/Exceptions/DeviceNotFound.hpp"
@@ -14,11 +16,7 @@ namespace Bloom::Usb
         : vendorId(vendorId)
         , productId(productId)
     {
-        if (!UsbDevice::libusbContext) {
-            ::libusb_context* libusbContext = nullptr;
-            ::libusb_init(&libusbContext);
-            UsbDevice::libusbContext.reset(libusbContext);
-        }
+        UsbDevice::getLibusbContext();
     }
 
     void UsbDevice::init() {
@@ -34,9 +32,18 @@ namespace Bloom::Usb
 
         if (devices.size() > 1) {
             // TODO: implement support for multiple devices via serial number matching?
+            auto serialNumbers = std::string();
+            for (const auto& device : devices) {
+                const auto serialNumber = UsbDeviceRegistry::getSerialNumber(device.get());
+                if (serialNumber.has_value()) {
+                    serialNumbers += "\n - " + *serialNumber;
+                }
+            }
+
             throw DeviceInitializationFailure(
                 "Numerous devices of matching vendor and product ID found.\n"
                 "Please ensure that only one debug tool is connected and then try again."
+                    + (!serialNumbers.empty() ? "\nSerial numbers of connected devices:" + serialNumbers : "")
             );
         }
 
@@ -71,7 +78,30 @@ namespace Bloom::Usb
         }
     }
 
+    ::libusb_context* UsbDevice::getLibusbContext() {
+        if (!UsbDevice::libusbContext) {
+            ::libusb_context* libusbContext = nullptr;
+            ::libusb_init(&libusbContext);
+            UsbDevice::libusbContext.reset(libusbContext);
+        }
+
+        return UsbDevice::libusbContext.get();
+    }
+
     std::vector<LibusbDevice> UsbDevice::findMatchingDevices(std::uint16_t vendorId, std::uint16_t productId) {
+        if (UsbDeviceRegistry::hotplugSupported()) {
+            try {
+                return UsbDeviceRegistry::getDevices(vendorId, productId);
+
+            } catch (const DeviceInitializationFailure& exception) {
+                Logger::debug("USB device registry lookup failed - " + exception.getMessage());
+            }
+        }
+
+        return this->enumerateMatchingDevices(vendorId, productId);
+    }
+
+    std::vector<LibusbDevice> UsbDevice::enumerateMatchingDevices(std::uint16_t vendorId, std::uint16_t productId) {
         ::libusb_device** devices = nullptr;
         ::libusb_device* device;
         std::vector<LibusbDevice> matchedDevices;
@@ -40,14 +40,35 @@ namespace Bloom::Usb
 
         virtual ~UsbDevice();
 
+        /**
+         * Returns the libusb context shared by all UsbDevice objects (and the UsbDeviceRegistry), initialising it
+         * upon the first call.
+         *
+         * @return
+         */
+        static ::libusb_context* getLibusbContext();
+
     protected:
         static inline LibusbContext libusbContext = LibusbContext(nullptr, ::libusb_exit);
 
         LibusbDevice libusbDevice = LibusbDevice(nullptr, ::libusb_unref_device);
         LibusbDeviceHandle libusbDeviceHandle = LibusbDeviceHandle(nullptr, ::libusb_close);
 
+        /**
+         * Finds the connected devices with the given vendor and product ID.
+         *
+         * Where hotplug events are supported, the devices are obtained from the UsbDeviceRegistry, which avoids
+         * enumerating the bus for every lookup. Otherwise, we enumerate the bus.
+         *
+         * @param vendorId
+         * @param productId
+         *
+         * @return
+         */
         std::vector<LibusbDevice> findMatchingDevices(std::uint16_t vendorId, std::uint16_t productId);
 
+        std::vector<LibusbDevice> enumerateMatchingDevices(std::uint16_t vendorId, std::uint16_t productId);
+
         LibusbConfigDescriptor getConfigDescriptor(std::optional<std::uint8_t> configurationIndex = std::nullopt);
 
         void detachKernelDriverFromInterface(std::uint8_t interfaceNumber);
@@ -0,0 +1,209 @@
+#include "UsbDeviceRegistry.hpp"
+
+#include <sys/time.h>
+#include <algorithm>
+#include <array>
+
+#include "src/Logger/Logger.hpp"
+#include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
+
+namespace Bloom::Usb
+{
+    using namespace Bloom::Exceptions;
+
+    bool UsbDeviceRegistry::hotplugSupported() {
+        return ::libusb_has_capability(::LIBUSB_CAP_HAS_HOTPLUG) != 0;
+    }
+
+    std::vector<LibusbDevice> UsbDeviceRegistry::getDevices(std::uint16_t vendorId, std::uint16_t productId) {
+        const auto deviceId = DeviceId(vendorId, productId);
+        auto recordIt = UsbDeviceRegistry::recordsByDeviceId.find(deviceId);
+
+        if (recordIt == UsbDeviceRegistry::recordsByDeviceId.end()) {
+            recordIt = UsbDeviceRegistry::recordsByDeviceId.emplace(deviceId, DeviceIdRecord()).first;
+
+            /*
+             * With LIBUSB_HOTPLUG_ENUMERATE, libusb invokes our callback for every matching device that is already
+             * connected, before returning.
+             */
+            UsbDeviceRegistry::enumerating = true;
+            const auto libusbStatusCode = ::libusb_hotplug_register_callback(
+                UsbDevice::getLibusbContext(),
+                ::LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | ::LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT,
+                ::LIBUSB_HOTPLUG_ENUMERATE,
+                vendorId,
+                productId,
+                ::LIBUSB_HOTPLUG_MATCH_ANY,
+                &UsbDeviceRegistry::onHotplugEvent,
+                nullptr,
+                &(recordIt->second.callbackHandle)
+            );
+            UsbDeviceRegistry::enumerating = false;
+
+            if (libusbStatusCode < 0) {
+                UsbDeviceRegistry::recordsByDeviceId.erase(recordIt);
+                throw DeviceInitializationFailure(
+                    "Failed to register USB hotplug callback - error code " + std::to_string(libusbStatusCode)
+                        + " returned."
+                );
+            }
+        }
+
+        auto devices = std::vector<LibusbDevice>();
+        devices.reserve(recordIt->second.devices.size());
+
+        for (const auto& deviceRecord : recordIt->second.devices) {
+            devices.emplace_back(::libusb_ref_device(deviceRecord.device.get()), ::libusb_unref_device);
+        }
+
+        return devices;
+    }
+
+    std::optional<std::string> UsbDeviceRegistry::getSerialNumber(::libusb_device* device) {
+        for (auto& [deviceId, record] : UsbDeviceRegistry::recordsByDeviceId) {
+            for (auto& deviceRecord : record.devices) {
+                if (deviceRecord.device.get() != device) {
+                    continue;
+                }
+
+                if (!deviceRecord.serialNumberRead) {
+                    deviceRecord.serialNumberRead = true;
+
+                    struct ::libusb_device_descriptor descriptor = {};
+                    ::libusb_device_handle* deviceHandle = nullptr;
+
+                    if (
+                        ::libusb_get_device_descriptor(device, &descriptor) == 0
+                        && descriptor.iSerialNumber != 0
+                        && ::libusb_open(device, &deviceHandle) == 0
+                    ) {
+                        auto serialNumber = std::array<unsigned char, 256>();
+                        const auto length = ::libusb_get_string_descriptor_ascii(
+                            deviceHandle,
+                            descriptor.iSerialNumber,
+                            serialNumber.data(),
+                            static_cast<int>(serialNumber.size())
+                        );
+                        ::libusb_close(deviceHandle);
+
+                        if (length > 0) {
+                            deviceRecord.serialNumber = std::string(
+                                serialNumber.begin(),
+                                serialNumber.begin() + length
+                            );
+                        }
+                    }
+                }
+
+                return deviceRecord.serialNumber;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<std::uint64_t> UsbDeviceRegistry::getGeneration(std::uint16_t vendorId, std::uint16_t productId) {
+        const auto recordIt = UsbDeviceRegistry::recordsByDeviceId.find(DeviceId(vendorId, productId));
+        return recordIt != UsbDeviceRegistry::recordsByDeviceId.end()
+            ? std::optional(recordIt->second.generation)
+            : std::nullopt;
+    }
+
+    std::vector<UsbDeviceRegistry::EventFileDescriptor> UsbDeviceRegistry::getEventFileDescriptors() {
+        auto output = std::vector<EventFileDescriptor>();
+
+        const auto** pollFileDescriptors = ::libusb_get_pollfds(UsbDevice::getLibusbContext());
+        if (pollFileDescriptors == nullptr) {
+            return output;
+        }
+
+        for (auto index = std::size_t(0); pollFileDescriptors[index] != nullptr; ++index) {
+            output.emplace_back(EventFileDescriptor{
+                .fileDescriptor = pollFileDescriptors[index]->fd,
+                .eventMask = static_cast<std::uint16_t>(pollFileDescriptors[index]->events),
+            });
+        }
+
+        ::libusb_free_pollfds(pollFileDescriptors);
+        return output;
+    }
+
+    void UsbDeviceRegistry::handleEvents() {
+        auto timeout = (struct ::timeval) {.tv_sec = 0, .tv_usec = 0};
+        ::libusb_handle_events_timeout_completed(UsbDevice::getLibusbContext(), &timeout, nullptr);
+
+        if (UsbDeviceRegistry::pendingArrivals.empty()) {
+            return;
+        }
+
+        auto arrivals = std::vector<DeviceId>();
+        arrivals.swap(UsbDeviceRegistry::pendingArrivals);
+
+        if (!UsbDeviceRegistry::arrivalCallback) {
+            return;
+        }
+
+        for (const auto& [vendorId, productId] : arrivals) {
+            UsbDeviceRegistry::arrivalCallback(vendorId, productId);
+        }
+    }
+
+    void UsbDeviceRegistry::setArrivalCallback(ArrivalCallback callback) {
+        UsbDeviceRegistry::arrivalCallback = std::move(callback);
+    }
+
+    int UsbDeviceRegistry::onHotplugEvent(
+        ::libusb_context*,
+        ::libusb_device* device,
+        ::libusb_hotplug_event event,
+        void*
+    ) {
+        /*
+         * We're within libusb's event handling here, so we mustn't do any I/O on the device. We just update the
+         * record, and defer the arrival callback to UsbDeviceRegistry::handleEvents().
+         */
+        struct ::libusb_device_descriptor descriptor = {};
+        if (::libusb_get_device_descriptor(device, &descriptor) != 0) {
+            return 0;
+        }
+
+        const auto deviceId = DeviceId(descriptor.idVendor, descriptor.idProduct);
+        const auto recordIt = UsbDeviceRegistry::recordsByDeviceId.find(deviceId);
+        if (recordIt == UsbDeviceRegistry::recordsByDeviceId.end()) {
+            return 0;
+        }
+
+        auto& record = recordIt->second;
+        ++record.generation;
+
+        if (event == ::LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED) {
+            auto deviceRecord = DeviceRecord();
+            deviceRecord.device.reset(::libusb_ref_device(device));
+            record.devices.emplace_back(std::move(deviceRecord));
+
+            if (!UsbDeviceRegistry::enumerating) {
+                Logger::debug("USB device connected (" + std::to_string(descriptor.idVendor) + ":"
+                    + std::to_string(descriptor.idProduct) + ")");
+                UsbDeviceRegistry::pendingArrivals.push_back(deviceId);
+            }
+
+            return 0;
+        }
+
+        Logger::debug("USB device disconnected (" + std::to_string(descriptor.idVendor) + ":"
+            + std::to_string(descriptor.idProduct) + ")");
+
+        record.devices.erase(
+            std::remove_if(
+                record.devices.begin(),
+                record.devices.end(),
+                [device] (const DeviceRecord& deviceRecord) {
+                    return deviceRecord.device.get() == device;
+                }
+            ),
+            record.devices.end()
+        );
+
+        return 0;
+    }
+}
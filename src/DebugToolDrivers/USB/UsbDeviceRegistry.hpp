@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <map>
+#include <utility>
+#include <optional>
+#include <string>
+#include <functional>
+#include <libusb-1.0/libusb.h>
+
+#include "src/DebugToolDrivers/USB/UsbDevice.hpp"
+
+namespace Bloom::Usb
+{
+    /**
+     * The UsbDeviceRegistry keeps an up-to-date record of the connected USB devices of interest (the debug tools
+     * that we've been asked to look for), via a libusb hotplug listener.
+     *
+     * Upon the first request for devices with a given vendor and product ID, we register a hotplug callback for the
+     * ID pair, which populates the record with any matching devices that are already connected. From then on, the
+     * record is maintained by hotplug events, so subsequent lookups (like those made when reconnecting to a debug
+     * tool) don't have to enumerate the bus.
+     *
+     * Hotplug events are only delivered when libusb events are handled. The owning thread must monitor the file
+     * descriptors returned by UsbDeviceRegistry::getEventFileDescriptors() and call UsbDeviceRegistry::handleEvents()
+     * when any of them become readable. The TargetController does this via its event loop. Events are also handled
+     * by libusb during synchronous transfers made on the same context.
+     *
+     * If the platform doesn't support hotplug events, the registry does nothing, and UsbDevice falls back to
+     * enumerating the bus.
+     *
+     * Like UsbDevice, this class is not thread-safe. It must only be used from the TargetController thread.
+     */
+    class UsbDeviceRegistry
+    {
+    public:
+        using ArrivalCallback = std::function<void(std::uint16_t vendorId, std::uint16_t productId)>;
+
+        struct EventFileDescriptor
+        {
+            int fileDescriptor = -1;
+
+            /**
+             * The poll events of interest (e.g. POLLIN). These have the same values as their epoll counterparts.
+             */
+            std::uint16_t eventMask = 0;
+        };
+
+        /**
+         * Checks if the platform (and libusb build) supports hotplug events.
+         *
+         * @return
+         */
+        static bool hotplugSupported();
+
+        /**
+         * Returns the connected devices with the given vendor and product ID, from the record. If the ID pair isn't
+         * already being monitored, a hotplug callback is registered for it, and the record is populated with any
+         * matching devices that are already connected.
+         *
+         * This must not be called if hotplug events are not supported (see UsbDeviceRegistry::hotplugSupported()).
+         *
+         * @param vendorId
+         * @param productId
+         *
+         * @return
+         *  A new reference to each matching device.
+         */
+        static std::vector<LibusbDevice> getDevices(std::uint16_t vendorId, std::uint16_t productId);
+
+        /**
+         * Returns the serial number of a device in the record. The serial number is read from the device upon the
+         * first request, and cached for the lifetime of the record.
+         *
+         * @param device
+         *
+         * @return
+         *  The serial number, or std::nullopt if the device isn't in the record, or doesn't have a serial number.
+         */
+        static std::optional<std::string> getSerialNumber(::libusb_device* device);
+
+        /**
+         * Returns the number of changes (arrivals and departures) that have been recorded for the given vendor and
+         * product ID. This allows for other USB interfaces (like HidInterface) to cache device lookups of their own,
+         * and to discard them when the device has been reconnected.
+         *
+         * @param vendorId
+         * @param productId
+         *
+         * @return
+         *  The number of changes, or std::nullopt if the ID pair isn't being monitored.
+         */
+        static std::optional<std::uint64_t> getGeneration(std::uint16_t vendorId, std::uint16_t productId);
+
+        /**
+         * Returns the libusb file descriptors that should be monitored by the owning thread, for the delivery of
+         * hotplug events.
+         *
+         * These are the context's own file descriptors, obtained upon the first call. File descriptors of open
+         * devices are excluded - events on those are handled during the synchronous transfers we make.
+         *
+         * @return
+         */
+        static std::vector<EventFileDescriptor> getEventFileDescriptors();
+
+        /**
+         * Handles any pending libusb events (without blocking), and invokes the arrival callback for any device of
+         * interest that has been connected since the last call.
+         */
+        static void handleEvents();
+
+        /**
+         * Sets a callback to be invoked upon the arrival of a device of interest. The callback is invoked from
+         * UsbDeviceRegistry::handleEvents(), outside of libusb's event handling, so it can safely open the device.
+         *
+         * @param callback
+         */
+        static void setArrivalCallback(ArrivalCallback callback);
+
+    private:
+        using DeviceId = std::pair<std::uint16_t, std::uint16_t>;
+
+        struct DeviceRecord
+        {
+            LibusbDevice device = LibusbDevice(nullptr, ::libusb_unref_device);
+            std::optional<std::string> serialNumber;
+            bool serialNumberRead = false;
+        };
+
+        struct DeviceIdRecord
+        {
+            ::libusb_hotplug_callback_handle callbackHandle = {};
+            std::vector<DeviceRecord> devices;
+            std::uint64_t generation = 0;
+        };
+
+        static inline std::map<DeviceId, DeviceIdRecord> recordsByDeviceId;
+        static inline std::vector<DeviceId> pendingArrivals;
+        static inline ArrivalCallback arrivalCallback;
+
+        /**
+         * Set whilst registering a hotplug callback. The arrival of devices that are already connected shouldn't
+         * be reported as new arrivals.
+         */
+        static inline bool enumerating = false;
+
+        static int onHotplugEvent(
+            ::libusb_context* context,
+            ::libusb_device* device,
+            ::libusb_hotplug_event event,
+            void* userData
+        );
+    };
+}
@@ -12,10 +12,9 @@ namespace Bloom
     }
 
     void EventListener::registerEvent(SharedGenericEventPointer event) {
-        Logger::debug(
-            "Event \"" + event->getName() + "\" (" + std::to_string(event->id) + ") registered for listener "
-                + this->name
-        );
+        if (Logger::isDebugLoggingEnabled()) {
+            Logger::debug("Event \"", event->getName(), "\" (", event->id, ") registered for listener ", this->name);
+        }
 
         const auto queueLock = this->eventQueueByEventType.acquireLock();
         auto& eventQueueByType = this->eventQueueByEventType.getValue();
@@ -23,7 +22,8 @@ namespace Bloom
         eventQueueByType[event->getType()].push(std::move(event));
         this->eventQueueByEventTypeCV.notify_all();
 
-        if (this->interruptEventNotifier != nullptr) {
+        if (this->interruptEventNotifier != nullptr && !this->interruptEventNotificationPending) {
+            this->interruptEventNotificationPending = true;
             this->interruptEventNotifier->notify();
         }
     }
@@ -56,7 +56,9 @@ namespace Bloom
     }
 
     void EventListener::dispatchEvent(const SharedGenericEventPointer& event) {
-        Logger::debug("Dispatching event " + event->getName() + " (" + std::to_string(event->id) + ").");
+        if (Logger::isDebugLoggingEnabled()) {
+            Logger::debug("Dispatching event ", event->getName(), " (", event->id, ").");
+        }
 
         // Dispatch the event to all registered handlers
         auto callbacks = std::vector<std::function<void(const Events::Event&)>>();
@@ -84,6 +86,9 @@ namespace Bloom
         auto& eventQueueByType = this->eventQueueByEventType.getValue();
         std::vector<SharedGenericEventPointer> output;
 
+        // Any events registered after this point must trigger a new notification
+        this->interruptEventNotificationPending = false;
+
         for (auto& eventQueue: eventQueueByType) {
             while (!eventQueue.second.empty()) {
                 output.push_back(std::move(eventQueue.second.front()));
@@ -12,6 +12,8 @@
 #include <iostream>
 #include <condition_variable>
 #include <set>
+#include <atomic>
+#include <cstdint>
 
 #include "src/EventManager/Events/Events.hpp"
 #include "src/Helpers/SyncSafe.hpp"
@@ -55,13 +57,23 @@ namespace Bloom
          */
         std::set<Events::EventType> getRegisteredEventTypes();
 
+        /**
+         * Checks if an event type is registered in the listener.
+         *
+         * This function is wait-free, as it's called for every listener, upon every event being triggered (see
+         * EventManager::triggerEvent()).
+         *
+         * @tparam EventType
+         * @return
+         */
         template <class EventType>
         bool isEventTypeRegistered() {
-            return this->registeredEventTypes.getValue().contains(EventType::type);
+            return this->isEventTypeRegistered(EventType::type);
         }
 
         bool isEventTypeRegistered(Events::EventType eventType) {
-            return this->registeredEventTypes.getValue().contains(eventType);
+            return (this->registeredEventTypeMask.load(std::memory_order_acquire)
+                & EventListener::eventTypeMaskBit(eventType)) != 0;
         };
 
         /**
@@ -76,13 +88,19 @@ namespace Bloom
         template<class EventType>
         void registerEventType() {
             const auto registeredEventTypesLock = this->registeredEventTypes.acquireLock();
-            this->registeredEventTypes.getValue().insert(EventType::type);
+            auto& registeredEventTypes = this->registeredEventTypes.getValue();
+
+            registeredEventTypes.insert(EventType::type);
+            this->updateRegisteredEventTypeMask(registeredEventTypes);
         }
 
         template<class EventType>
         void deRegisterEventType() {
             const auto registeredEventTypesLock = this->registeredEventTypes.acquireLock();
-            this->registeredEventTypes.getValue().erase(EventType::type);
+            auto& registeredEventTypes = this->registeredEventTypes.getValue();
+
+            registeredEventTypes.erase(EventType::type);
+            this->updateRegisteredEventTypeMask(registeredEventTypes);
         }
 
         /**
@@ -147,7 +165,10 @@ namespace Bloom
 
             {
                 auto registeredEventTypesLock = this->registeredEventTypes.acquireLock();
-                this->registeredEventTypes.getValue().erase(EventType::type);
+                auto& registeredEventTypes = this->registeredEventTypes.getValue();
+
+                registeredEventTypes.erase(EventType::type);
+                this->updateRegisteredEventTypeMask(registeredEventTypes);
             }
 
             const auto queueLock = this->eventQueueByEventType.acquireLock();
@@ -242,6 +263,8 @@ namespace Bloom
                         eventTypesToDeRegister.insert(eventType);
                     }
                 }
+
+                this->updateRegisteredEventTypeMask(registeredEventTypes);
             }
 
             Events::SharedGenericEventPointer foundEvent = nullptr;
@@ -269,6 +292,11 @@ namespace Bloom
                 this->eventQueueByEventTypeCV.wait(queueLock, eventsFound);
             }
 
+            if (foundEvent != nullptr) {
+                // See EventListener::interruptEventNotificationPending
+                this->interruptEventNotificationPending = false;
+            }
+
             if (!eventTypesToDeRegister.empty()) {
                 auto registeredEventTypesLock = this->registeredEventTypes.acquireLock();
                 auto& registeredEventTypes = this->registeredEventTypes.getValue();
@@ -276,6 +304,8 @@ namespace Bloom
                 for (const auto& eventType : eventTypesToDeRegister) {
                     registeredEventTypes.erase(eventType);
                 }
+
+                this->updateRegisteredEventTypeMask(registeredEventTypes);
             }
 
             if (foundEvent != nullptr) {
@@ -360,9 +390,47 @@ namespace Bloom
         SyncSafe<std::map<Events::EventType, std::vector<std::function<void(const Events::Event&)>>>> eventTypeToCallbacksMapping;
         SyncSafe<std::set<Events::EventType>> registeredEventTypes;
 
+        /**
+         * A bitmap of the event types in this->registeredEventTypes, with one bit per event type (see
+         * EventListener::eventTypeMaskBit()). This allows for wait-free checks of registered event types.
+         *
+         * Must be updated (via EventListener::updateRegisteredEventTypeMask()) upon every change to
+         * this->registeredEventTypes, whilst holding its lock.
+         */
+        std::atomic<std::uint64_t> registeredEventTypeMask = 0;
+
         NotifierInterface* interruptEventNotifier = nullptr;
 
+        /**
+         * Whether this->interruptEventNotifier has been notified since the listener's events were last taken (via
+         * EventListener::getEvents()). We only notify upon the first event after that - the notifier would already be
+         * in a notified state, for any subsequent events, so notifying again would be a waste of a system call.
+         *
+         * Guarded by the this->eventQueueByEventType lock.
+         */
+        bool interruptEventNotificationPending = false;
+
         std::vector<Events::SharedGenericEventPointer> getEvents();
+
+        /**
+         * The event type bitmap can accommodate up to 64 event types.
+         *
+         * @param eventType
+         * @return
+         */
+        static constexpr std::uint64_t eventTypeMaskBit(Events::EventType eventType) {
+            return std::uint64_t{1} << static_cast<std::uint8_t>(eventType);
+        }
+
+        void updateRegisteredEventTypeMask(const std::set<Events::EventType>& eventTypes) {
+            auto mask = std::uint64_t{0};
+
+            for (const auto& eventType : eventTypes) {
+                mask |= EventListener::eventTypeMaskBit(eventType);
+            }
+
+            this->registeredEventTypeMask.store(mask, std::memory_order_release);
+        }
     };
 
     /**
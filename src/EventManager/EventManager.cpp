@@ -1,36 +1,56 @@
 #include "EventManager.hpp"
 
+#include <algorithm>
+
 namespace Bloom
 {
     void EventManager::registerListener(std::shared_ptr<EventListener> listener) {
-        auto registerListenersLock = std::unique_lock(EventManager::registerListenerMutex);
-        EventManager::registeredListeners.insert(std::pair(listener->getId(), std::move(listener)));
+        const auto registerListenersLock = std::unique_lock(EventManager::registerListenerMutex);
+        const auto currentListeners = EventManager::registeredListeners.load();
+
+        for (const auto& registeredListener : *currentListeners) {
+            if (registeredListener->getId() == listener->getId()) {
+                return;
+            }
+        }
+
+        auto listeners = ListenerList(*currentListeners);
+        listeners.emplace_back(std::move(listener));
+
+        EventManager::registeredListeners.store(std::make_shared<const ListenerList>(std::move(listeners)));
     }
 
     void EventManager::deregisterListener(size_t listenerId) {
-        auto registerListenersLock = std::unique_lock(EventManager::registerListenerMutex);
-        EventManager::registeredListeners.erase(listenerId);
+        const auto registerListenersLock = std::unique_lock(EventManager::registerListenerMutex);
+
+        auto listeners = ListenerList(*(EventManager::registeredListeners.load()));
+        std::erase_if(listeners, [listenerId] (const std::shared_ptr<EventListener>& listener) {
+            return listener->getId() == listenerId;
+        });
+
+        EventManager::registeredListeners.store(std::make_shared<const ListenerList>(std::move(listeners)));
     }
 
     void EventManager::triggerEvent(const std::shared_ptr<const Events::Event>& event) {
-        auto registerListenersLock = std::unique_lock(EventManager::registerListenerMutex);
+        const auto listeners = EventManager::registeredListeners.load();
+        const auto eventType = event->getType();
 
-        for (const auto&[listenerId, listener] : EventManager::registeredListeners) {
-            if (listener->isEventTypeRegistered(event->getType())) {
+        for (const auto& listener : *listeners) {
+            if (listener->isEventTypeRegistered(eventType)) {
                 listener->registerEvent(event);
             }
         }
     }
 
     bool EventManager::isEventTypeListenedFor(Events::EventType eventType) {
-        auto registerListenersLock = std::unique_lock(EventManager::registerListenerMutex);
+        const auto listeners = EventManager::registeredListeners.load();
 
-        for (const auto& [listenerId, listener] : EventManager::registeredListeners) {
-            if (listener->isEventTypeRegistered(eventType)) {
-                return true;
+        return std::any_of(
+            listeners->begin(),
+            listeners->end(),
+            [eventType] (const std::shared_ptr<EventListener>& listener) {
+                return listener->isEventTypeRegistered(eventType);
             }
-        }
-
-        return false;
+        );
     }
 }
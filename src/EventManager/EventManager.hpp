@@ -1,6 +1,8 @@
 #pragma once
 
-#include <map>
+#include <vector>
+#include <memory>
+#include <atomic>
 #include <mutex>
 
 #include "Events/Events.hpp"
@@ -38,6 +40,9 @@ namespace Bloom
          * Dispatches an event to all registered listeners, if they have registered an interest in the event type.
          * See EventListener::registeredEventTypes for more.
          *
+         * This function does not acquire EventManager::registerListenerMutex - it works on a snapshot of the
+         * registered listeners.
+         *
          * @param event
          */
         static void triggerEvent(const Events::SharedGenericEventPointer& event);
@@ -51,10 +56,21 @@ namespace Bloom
         static bool isEventTypeListenedFor(Events::EventType eventType);
 
     private:
+        using ListenerList = std::vector<std::shared_ptr<EventListener>>;
+
+        /**
+         * An immutable snapshot of the registered listeners.
+         *
+         * Triggering an event is far more frequent than (de)registering a listener, so the listener list is
+         * copy-on-write: registerListener() and deregisterListener() replace the snapshot with a modified copy,
+         * whilst triggerEvent() and isEventTypeListenedFor() just load the current snapshot, without taking any locks.
+         */
+        static inline std::atomic<std::shared_ptr<const ListenerList>> registeredListeners =
+            std::make_shared<const ListenerList>();
+
         /**
-         * A mapping of listener IDs to registered listeners. Each registered listener is given an interger ID.
+         * Serialises changes to EventManager::registeredListeners. Only acquired by writers.
          */
-        static inline std::map<size_t, std::shared_ptr<EventListener>> registeredListeners;
         static inline std::mutex registerListenerMutex;
     };
 }
@@ -32,6 +32,9 @@ namespace Bloom::Events
         TARGET_RESET,
         PROGRAMMING_MODE_ENABLED,
         PROGRAMMING_MODE_DISABLED,
+        TARGET_MEMORY_OPERATION_PROGRESS,
+        TARGET_PIN_STATES_CHANGED,
+        TIMING_ANALYSIS_COMPLETED,
     };
 
     class Event
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <utility>
+
+#include "src/Helpers/MemoryPool.hpp"
 
 #include "Event.hpp"
 #include "DebugSessionStarted.hpp"
@@ -20,6 +23,9 @@
 #include "TargetReset.hpp"
 #include "ProgrammingModeEnabled.hpp"
 #include "ProgrammingModeDisabled.hpp"
+#include "TargetMemoryOperationProgress.hpp"
+#include "TargetPinStatesChanged.hpp"
+#include "TimingAnalysisCompleted.hpp"
 
 namespace Bloom::Events
 {
@@ -27,4 +33,29 @@ namespace Bloom::Events
     using SharedEventPointer = std::shared_ptr<const EventType>;
 
     using SharedGenericEventPointer = SharedEventPointer<Event>;
+
+    /**
+     * Constructs an event, for EventManager::triggerEvent().
+     *
+     * Events are triggered at a high rate (an event for every memory write, every time the target stops, etc.), and
+     * are typically freed on a different thread (by the last listener to process them). So, like TargetController
+     * commands, they're allocated from a pool. The event and its shared_ptr control block are held in a single
+     * pooled block.
+     *
+     * All events should be constructed via this function, as opposed to std::make_shared().
+     *
+     * @tparam EventType
+     * @tparam ArgumentTypes
+     *
+     * @param arguments
+     *
+     * @return
+     */
+    template <class EventType, typename... ArgumentTypes>
+    std::shared_ptr<EventType> makeEvent(ArgumentTypes&&... arguments) {
+        return std::allocate_shared<EventType>(
+            MemoryPoolAllocator<EventType, Event>(),
+            std::forward<ArgumentTypes>(arguments)...
+        );
+    }
 }
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+
+#include "Event.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::Events
+{
+    /**
+     * Emitted by the TargetController during large memory reads and writes, after each chunk of the operation has
+     * been completed.
+     */
+    class TargetMemoryOperationProgress: public Event
+    {
+    public:
+        static constexpr EventType type = EventType::TARGET_MEMORY_OPERATION_PROGRESS;
+        static const inline std::string name = "TargetMemoryOperationProgress";
+
+        /**
+         * The ID of the TargetController command that initiated the operation. This can be used to cancel the
+         * operation (see TargetControllerService::cancelCommand()).
+         */
+        int commandId;
+
+        Targets::TargetMemoryType memoryType;
+        Targets::TargetMemorySize bytesCompleted;
+        Targets::TargetMemorySize bytesTotal;
+
+        TargetMemoryOperationProgress(
+            int commandId,
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemorySize bytesCompleted,
+            Targets::TargetMemorySize bytesTotal
+        )
+            : commandId(commandId)
+            , memoryType(memoryType)
+            , bytesCompleted(bytesCompleted)
+            , bytesTotal(bytesTotal)
+        {};
+
+        [[nodiscard]] EventType getType() const override {
+            return TargetMemoryOperationProgress::type;
+        }
+
+        [[nodiscard]] std::string getName() const override {
+            return TargetMemoryOperationProgress::name;
+        }
+    };
+}
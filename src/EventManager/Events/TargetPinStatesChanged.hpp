@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+
+#include "Event.hpp"
+#include "src/Targets/TargetPinDescriptor.hpp"
+
+namespace Bloom::Events
+{
+    /**
+     * Emitted by the TargetController whilst it's streaming pin states (see
+     * TargetController::Commands::SetTargetPinStateStreaming).
+     */
+    class TargetPinStatesChanged: public Event
+    {
+    public:
+        static constexpr EventType type = EventType::TARGET_PIN_STATES_CHANGED;
+        static const inline std::string name = "TargetPinStatesChanged";
+
+        int variantId = 0;
+
+        /**
+         * Only the pins whose state has changed since the previous event (for the same variant). The first event
+         * after streaming begins carries the state of every pin.
+         */
+        Targets::TargetPinStateMapping pinStatesByNumber;
+
+        TargetPinStatesChanged(int variantId, Targets::TargetPinStateMapping pinStatesByNumber)
+            : variantId(variantId)
+            , pinStatesByNumber(std::move(pinStatesByNumber))
+        {};
+
+        [[nodiscard]] EventType getType() const override {
+            return TargetPinStatesChanged::type;
+        }
+
+        [[nodiscard]] std::string getName() const override {
+            return TargetPinStatesChanged::name;
+        }
+    };
+}
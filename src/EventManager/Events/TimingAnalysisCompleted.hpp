@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+#include "Event.hpp"
+#include "src/TargetController/TimingAnalysis.hpp"
+
+namespace Bloom::Events
+{
+    /**
+     * Triggered by the TargetController, when a timing analysis has measured all of its iterations.
+     */
+    class TimingAnalysisCompleted: public Event
+    {
+    public:
+        static constexpr EventType type = EventType::TIMING_ANALYSIS_COMPLETED;
+        static const inline std::string name = "TimingAnalysisCompleted";
+
+        TargetController::TimingAnalysisResults results;
+
+        explicit TimingAnalysisCompleted(const TargetController::TimingAnalysisResults& results)
+            : results(results)
+        {};
+
+        [[nodiscard]] EventType getType() const override {
+            return TimingAnalysisCompleted::type;
+        }
+
+        [[nodiscard]] std::string getName() const override {
+            return TimingAnalysisCompleted::name;
+        }
+    };
+}
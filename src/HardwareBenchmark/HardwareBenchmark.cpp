@@ -0,0 +1,340 @@
+#include "HardwareBenchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <thread>
+#include <QString>
+
+#include "src/EventManager/EventManager.hpp"
+#include "src/EventManager/Events/Events.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom
+{
+    using namespace Targets;
+    using Exceptions::Exception;
+
+    using std::chrono::steady_clock;
+
+    HardwareBenchmark::HardwareBenchmark(bool includeProgramMemory, std::function<bool()> shouldAbort)
+        : includeProgramMemory(includeProgramMemory)
+        , shouldAbort(std::move(shouldAbort))
+    {}
+
+    QJsonObject HardwareBenchmark::run() {
+        EventManager::registerListener(this->eventListener);
+        this->eventListener->registerEventType<Events::TargetExecutionStopped>();
+
+        const auto targetDescriptor = this->targetControllerService.getTargetDescriptor();
+
+        try {
+            Logger::info("Running hardware benchmark");
+
+            if (this->targetControllerService.getTargetState() != TargetState::STOPPED) {
+                this->targetControllerService.stopTargetExecution();
+            }
+
+            const auto ramDescriptorIt = targetDescriptor->memoryDescriptorsByType.find(TargetMemoryType::RAM);
+            if (ramDescriptorIt != targetDescriptor->memoryDescriptorsByType.end()) {
+                this->benchmarkMemory(
+                    ramDescriptorIt->second,
+                    {16, 64, 256, 1024},
+                    HardwareBenchmark::MEMORY_ITERATIONS
+                );
+            }
+
+            const auto eepromDescriptorIt = targetDescriptor->memoryDescriptorsByType.find(TargetMemoryType::EEPROM);
+            if (eepromDescriptorIt != targetDescriptor->memoryDescriptorsByType.end()) {
+                this->benchmarkMemory(
+                    eepromDescriptorIt->second,
+                    {16, 64},
+                    HardwareBenchmark::EEPROM_WRITE_ITERATIONS
+                );
+            }
+
+            this->benchmarkRegisterRead(*targetDescriptor);
+            this->benchmarkStep();
+            this->benchmarkBreakToStop();
+
+            if (this->includeProgramMemory) {
+                const auto flashDescriptorIt = targetDescriptor->memoryDescriptorsByType.find(TargetMemoryType::FLASH);
+                if (flashDescriptorIt != targetDescriptor->memoryDescriptorsByType.end()) {
+                    this->benchmarkProgramMemoryPageWrite(flashDescriptorIt->second);
+                }
+            }
+
+        } catch (const Exception& exception) {
+            Logger::error("Hardware benchmark failed - " + exception.getMessage());
+        }
+
+        EventManager::deregisterListener(this->eventListener->getId());
+
+        auto output = QJsonObject();
+        output.insert("complete", !this->shouldAbort());
+        output.insert("results", this->results);
+        return output;
+    }
+
+    void HardwareBenchmark::benchmarkMemory(
+        const TargetMemoryDescriptor& memoryDescriptor,
+        const std::vector<TargetMemorySize>& sizes,
+        int writeIterations
+    ) {
+        const auto memoryTypeName = memoryDescriptor.type == TargetMemoryType::EEPROM
+            ? std::string("eeprom")
+            : std::string("ram");
+        const auto startAddress = memoryDescriptor.addressRange.startAddress;
+
+        /*
+         * The TargetController serves memory reads from its cache, where it can. Reads with a non-empty set of
+         * excluded address ranges always go to the target, so we exclude a range that lies beyond the end of the
+         * memory, which has no effect on the read itself.
+         */
+        const auto cacheBypassRanges = std::set<TargetMemoryAddressRange>({
+            TargetMemoryAddressRange(
+                memoryDescriptor.addressRange.endAddress + 1,
+                memoryDescriptor.addressRange.endAddress + 1
+            )
+        });
+
+        for (const auto size : sizes) {
+            if (size > memoryDescriptor.size()) {
+                continue;
+            }
+
+            Logger::info("Benchmarking " + memoryTypeName + " access (" + std::to_string(size) + " bytes)");
+
+            auto originalData = TargetMemoryBuffer();
+            const auto readSamples = this->measure(HardwareBenchmark::MEMORY_ITERATIONS, [&] {
+                const auto startTime = steady_clock::now();
+                originalData = this->targetControllerService.readMemory(
+                    memoryDescriptor.type,
+                    startAddress,
+                    size,
+                    cacheBypassRanges
+                );
+                return steady_clock::now() - startTime;
+            });
+
+            this->addResult(memoryTypeName + ".read." + std::to_string(size), readSamples, size);
+
+            if (originalData.size() != size) {
+                continue;
+            }
+
+            // We write back the data we just read, so the content of the memory is preserved
+            const auto writeSamples = this->measure(writeIterations, [&] {
+                const auto startTime = steady_clock::now();
+                this->targetControllerService.writeMemory(memoryDescriptor.type, startAddress, originalData);
+                return steady_clock::now() - startTime;
+            });
+
+            this->addResult(memoryTypeName + ".write." + std::to_string(size), writeSamples, size);
+        }
+    }
+
+    void HardwareBenchmark::benchmarkProgramMemoryPageWrite(const TargetMemoryDescriptor& memoryDescriptor) {
+        if (!memoryDescriptor.pageSize.has_value() || memoryDescriptor.pageSize.value() > memoryDescriptor.size()) {
+            return;
+        }
+
+        const auto pageSize = memoryDescriptor.pageSize.value();
+        const auto pageAddress = memoryDescriptor.addressRange.endAddress + 1 - pageSize;
+
+        Logger::warning(
+            "Benchmarking program memory page writes - the final page of program memory will be rewritten"
+        );
+
+        this->targetControllerService.enableProgrammingMode();
+
+        try {
+            const auto originalData = this->targetControllerService.readMemory(
+                memoryDescriptor.type,
+                pageAddress,
+                pageSize
+            );
+
+            auto alternateData = originalData;
+            std::transform(
+                alternateData.begin(),
+                alternateData.end(),
+                alternateData.begin(),
+                [] (unsigned char byte) {
+                    return static_cast<unsigned char>(~byte);
+                }
+            );
+
+            /*
+             * The TargetController skips writes to pages whose content hasn't changed, so we alternate between the
+             * original data and its complement. We always finish with the original data.
+             */
+            auto iteration = 0;
+            const auto samples = this->measure(HardwareBenchmark::PROGRAM_MEMORY_ITERATIONS * 2, [&] {
+                const auto& data = (iteration++ % 2 == 0) ? alternateData : originalData;
+
+                const auto startTime = steady_clock::now();
+                this->targetControllerService.writeMemory(memoryDescriptor.type, pageAddress, data);
+                return steady_clock::now() - startTime;
+            });
+
+            if (iteration % 2 != 0) {
+                // The benchmark was aborted part way through - restore the original content
+                this->targetControllerService.writeMemory(memoryDescriptor.type, pageAddress, originalData);
+            }
+
+            this->addResult("flash.pageWrite", samples, pageSize);
+
+        } catch (const Exception&) {
+            this->targetControllerService.disableProgrammingMode();
+            throw;
+        }
+
+        this->targetControllerService.disableProgrammingMode();
+    }
+
+    void HardwareBenchmark::benchmarkStep() {
+        Logger::info("Benchmarking single-step latency");
+
+        const auto samples = this->measure(HardwareBenchmark::STEP_ITERATIONS, [this] {
+            this->discardStopEvents();
+
+            const auto startTime = steady_clock::now();
+            this->targetControllerService.stepTargetExecution(std::nullopt);
+            return this->waitForStop() - startTime;
+        });
+
+        this->addResult("step", samples);
+    }
+
+    void HardwareBenchmark::benchmarkBreakToStop() {
+        Logger::info("Benchmarking break-to-stop latency");
+
+        const auto samples = this->measure(HardwareBenchmark::BREAK_ITERATIONS, [this] {
+            this->targetControllerService.continueTargetExecution(std::nullopt, std::nullopt);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+            // Discard any stop that occurred before we issued the break (e.g. the program hit a breakpoint)
+            this->discardStopEvents();
+
+            const auto startTime = steady_clock::now();
+            this->targetControllerService.stopTargetExecution();
+            return this->waitForStop() - startTime;
+        });
+
+        this->addResult("breakToStop", samples);
+    }
+
+    void HardwareBenchmark::benchmarkRegisterRead(const TargetDescriptor& targetDescriptor) {
+        const auto descriptorsIt = targetDescriptor.registerDescriptorsByType.find(
+            TargetRegisterType::GENERAL_PURPOSE_REGISTER
+        );
+
+        if (descriptorsIt == targetDescriptor.registerDescriptorsByType.end() || descriptorsIt->second.empty()) {
+            return;
+        }
+
+        Logger::info("Benchmarking register block read");
+
+        const auto& descriptors = descriptorsIt->second;
+        const auto blockSize = std::accumulate(
+            descriptors.begin(),
+            descriptors.end(),
+            TargetMemorySize(0),
+            [] (TargetMemorySize size, const TargetRegisterDescriptor& descriptor) {
+                return size + descriptor.size;
+            }
+        );
+
+        const auto samples = this->measure(HardwareBenchmark::REGISTER_ITERATIONS, [&] {
+            const auto startTime = steady_clock::now();
+            this->targetControllerService.readRegisters(descriptors);
+            return steady_clock::now() - startTime;
+        });
+
+        this->addResult("registers.generalPurpose.read", samples, blockSize);
+    }
+
+    HardwareBenchmark::Samples HardwareBenchmark::measure(
+        int iterations,
+        const std::function<steady_clock::duration()>& operation
+    ) {
+        auto samples = Samples();
+        samples.reserve(static_cast<std::size_t>(iterations));
+
+        for (auto iteration = 0; iteration < iterations && !this->shouldAbort(); ++iteration) {
+            samples.push_back(operation());
+        }
+
+        return samples;
+    }
+
+    steady_clock::time_point HardwareBenchmark::waitForStop() {
+        const auto event = this->eventListener->waitForEvent<Events::TargetExecutionStopped>(
+            HardwareBenchmark::STOP_TIMEOUT
+        );
+        const auto stopTime = steady_clock::now();
+
+        if (!event.has_value()) {
+            throw Exception("Timed out waiting for the target to stop");
+        }
+
+        return stopTime;
+    }
+
+    void HardwareBenchmark::discardStopEvents() {
+        while (
+            this->eventListener->waitForEvent<Events::TargetExecutionStopped>(std::chrono::milliseconds(0)).has_value()
+        ) {}
+    }
+
+    void HardwareBenchmark::addResult(
+        const std::string& name,
+        const Samples& samples,
+        std::optional<TargetMemorySize> bytesPerSample
+    ) {
+        if (samples.empty()) {
+            return;
+        }
+
+        auto sortedSamplesUs = std::vector<double>();
+        sortedSamplesUs.reserve(samples.size());
+
+        for (const auto& sample : samples) {
+            sortedSamplesUs.push_back(std::chrono::duration<double, std::micro>(sample).count());
+        }
+
+        std::sort(sortedSamplesUs.begin(), sortedSamplesUs.end());
+
+        const auto percentile = [&sortedSamplesUs] (double percentile) {
+            // Nearest-rank
+            const auto rank = static_cast<std::size_t>(
+                std::ceil(percentile / 100 * static_cast<double>(sortedSamplesUs.size()))
+            );
+            return sortedSamplesUs[std::clamp(rank, std::size_t(1), sortedSamplesUs.size()) - 1];
+        };
+
+        const auto totalUs = std::accumulate(sortedSamplesUs.begin(), sortedSamplesUs.end(), 0.0);
+
+        auto result = QJsonObject();
+        result.insert("name", QString::fromStdString(name));
+        result.insert("iterations", static_cast<qint64>(samples.size()));
+        result.insert("meanUs", totalUs / static_cast<double>(samples.size()));
+        result.insert("p50Us", percentile(50));
+        result.insert("p99Us", percentile(99));
+
+        if (bytesPerSample.has_value()) {
+            result.insert("bytes", static_cast<qint64>(bytesPerSample.value()));
+            result.insert(
+                "throughputMBps",
+                totalUs > 0
+                    ? static_cast<double>(bytesPerSample.value()) * static_cast<double>(samples.size()) / totalUs
+                    : 0.0
+            );
+        }
+
+        this->results.append(result);
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <QJsonObject>
+#include <QJsonArray>
+
+#include "src/Services/TargetControllerService.hpp"
+#include "src/EventManager/EventListener.hpp"
+
+#include "src/Targets/TargetDescriptor.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom
+{
+    /**
+     * The HardwareBenchmark runs a standard battery of operations on the connected debug tool and target, via the
+     * TargetController, and reports the throughput and latency of each. It's invoked via the "--benchmark" command
+     * (see Application::runHardwareBenchmark()).
+     *
+     * The results allow for an objective comparison of debug tools, tool firmware versions and Bloom versions.
+     *
+     * The benchmark is non-destructive: all memory that is written to is restored to its original content. The
+     * target will be stepped and resumed, however, so the program state will not be preserved. The program memory
+     * benchmark is opt-in, as it reprograms the final page of program memory. On targets that don't support page
+     * rewrites, the TargetController will have to erase the entire program memory to do so.
+     */
+    class HardwareBenchmark
+    {
+    public:
+        /**
+         * @param includeProgramMemory
+         *  Whether to include the program memory page write benchmark.
+         *
+         * @param shouldAbort
+         *  Invoked between iterations. If it returns true, the benchmark will be aborted.
+         */
+        HardwareBenchmark(bool includeProgramMemory, std::function<bool()> shouldAbort);
+
+        /**
+         * Runs all benchmarks.
+         *
+         * @return
+         *  The results, as JSON.
+         */
+        QJsonObject run();
+
+    private:
+        using Samples = std::vector<std::chrono::steady_clock::duration>;
+
+        static constexpr auto MEMORY_ITERATIONS = 20;
+        static constexpr auto EEPROM_WRITE_ITERATIONS = 5;
+        static constexpr auto PROGRAM_MEMORY_ITERATIONS = 3;
+        static constexpr auto STEP_ITERATIONS = 50;
+        static constexpr auto BREAK_ITERATIONS = 20;
+        static constexpr auto REGISTER_ITERATIONS = 50;
+
+        static constexpr auto STOP_TIMEOUT = std::chrono::milliseconds(5000);
+
+        bool includeProgramMemory = false;
+        std::function<bool()> shouldAbort;
+
+        Services::TargetControllerService targetControllerService = Services::TargetControllerService();
+        EventListenerPointer eventListener = std::make_shared<EventListener>("HardwareBenchmarkEventListener");
+
+        QJsonArray results;
+
+        void benchmarkMemory(
+            const Targets::TargetMemoryDescriptor& memoryDescriptor,
+            const std::vector<Targets::TargetMemorySize>& sizes,
+            int writeIterations
+        );
+
+        void benchmarkProgramMemoryPageWrite(const Targets::TargetMemoryDescriptor& memoryDescriptor);
+        void benchmarkStep();
+        void benchmarkBreakToStop();
+        void benchmarkRegisterRead(const Targets::TargetDescriptor& targetDescriptor);
+
+        /**
+         * Measures the given operation over the given number of iterations.
+         *
+         * @param iterations
+         * @param operation
+         *  Should return the duration of the measured portion of the operation.
+         *
+         * @return
+         */
+        Samples measure(int iterations, const std::function<std::chrono::steady_clock::duration()>& operation);
+
+        /**
+         * Waits for the target to stop, and returns the time at which the TargetExecutionStopped event was received.
+         *
+         * @return
+         */
+        std::chrono::steady_clock::time_point waitForStop();
+
+        /**
+         * Discards any TargetExecutionStopped events that have already been received.
+         */
+        void discardStopEvents();
+
+        /**
+         * Records the result of a benchmark.
+         *
+         * @param name
+         * @param samples
+         * @param bytesPerSample
+         *  If provided, the throughput will be included in the result.
+         */
+        void addResult(
+            const std::string& name,
+            const Samples& samples,
+            std::optional<Targets::TargetMemorySize> bytesPerSample = std::nullopt
+        );
+    };
+}
@@ -1,8 +1,13 @@
 #pragma once
 
-#include <memory>
-#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
 #include <optional>
+#include <functional>
+#include <limits>
+#include <stdexcept>
 #include <set>
 
 namespace Bloom
@@ -10,10 +15,13 @@ namespace Bloom
     /**
      * Simple bidirectional map
      *
-     * This should only be used for small maps, with small elements (enums, string literals, etc).
+     * The elements are held in a single contiguous vector. Each direction is indexed by an open addressing hash
+     * table (with linear probing), which holds indices into that vector. Lookups don't allocate, and only touch two
+     * contiguous arrays.
      *
-     * TODO: This needs some work - was written as a quick implementation with minimal requirements.
-     * TODO: Add support for inserting/deleting elements (outside of construction).
+     * For small, fixed tables (enums mapped to names, etc), see FlatBiMap, which can be constructed at compile time.
+     *
+     * TODO: Add support for deleting elements.
      *
      * @tparam TypeA
      * @tparam TypeB
@@ -22,69 +30,87 @@ namespace Bloom
     class BiMap
     {
     public:
+        BiMap() = default;
+
         BiMap(std::initializer_list<std::pair<TypeA, TypeB>> elements) {
-            for (auto it = elements.begin(); it != elements.end(); ++it) {
-                this->map.insert(std::pair<TypeA, TypeB>{it->first, it->second});
-                this->flippedMap.insert(std::pair<TypeB, TypeA>(it->second, it->first));
+            this->elements.reserve(elements.size());
+            this->growTables(elements.size());
+
+            for (const auto& element : elements) {
+                this->insert(element);
             }
         }
 
         bool contains(const TypeA& key) const {
-            return this->map.find(key) != this->map.end();
+            return this->findIndex(key).has_value();
         }
 
         bool contains(const TypeB& key) const {
-            return this->flippedMap.find(key) != this->flippedMap.end();
+            return this->findIndex(key).has_value();
         }
 
-        auto find(const TypeA& key) const {
-            const auto valueIt = this->map.find(key);
-            return valueIt != this->map.end() ? std::optional(valueIt) : std::nullopt;
+        /**
+         * Both overloads of find() yield a pointer to the stored (TypeA, TypeB) pair, or std::nullopt if the key
+         * isn't mapped.
+         *
+         * @param key
+         * @return
+         */
+        std::optional<const std::pair<TypeA, TypeB>*> find(const TypeA& key) const {
+            const auto index = this->findIndex(key);
+            return index.has_value() ? std::optional(&(this->elements[*index])) : std::nullopt;
         }
 
-        auto find(const TypeB& key) const {
-            const auto valueIt = this->flippedMap.find(key);
-            return valueIt != this->flippedMap.end() ? std::optional(valueIt) : std::nullopt;
+        std::optional<const std::pair<TypeA, TypeB>*> find(const TypeB& key) const {
+            const auto index = this->findIndex(key);
+            return index.has_value() ? std::optional(&(this->elements[*index])) : std::nullopt;
         }
 
         std::optional<TypeB> valueAt(const TypeA& key) const {
-            std::optional<TypeB> output;
-
-            const auto valueIt = this->map.find(key);
-            if (valueIt != this->map.end()) {
-                output = valueIt->second;
-            }
-
-            return output;
+            const auto index = this->findIndex(key);
+            return index.has_value() ? std::optional(this->elements[*index].second) : std::nullopt;
         }
 
         std::optional<TypeA> valueAt(const TypeB& key) const {
-            std::optional<TypeA> output;
-
-            const auto valueIt = this->flippedMap.find(key);
-            if (valueIt != this->flippedMap.end()) {
-                output = valueIt->second;
-            }
-
-            return output;
+            const auto index = this->findIndex(key);
+            return index.has_value() ? std::optional(this->elements[*index].first) : std::nullopt;
         }
 
+        /**
+         * @throws std::out_of_range
+         *  If the key isn't mapped.
+         */
         const TypeB& at(const TypeA& key) const {
-            return this->map.at(key);
+            const auto index = this->findIndex(key);
+            if (!index.has_value()) {
+                throw std::out_of_range("BiMap key not found");
+            }
+
+            return this->elements[*index].second;
         }
 
         const TypeA& at(const TypeB& key) const {
-            return this->flippedMap.at(key);
+            const auto index = this->findIndex(key);
+            if (!index.has_value()) {
+                throw std::out_of_range("BiMap key not found");
+            }
+
+            return this->elements[*index].first;
         }
 
-        [[nodiscard]] std::unordered_map<TypeA, TypeB> getMap() const {
-            return this->map;
+        /**
+         * Returns all elements, in insertion order.
+         *
+         * @return
+         */
+        [[nodiscard]] const std::vector<std::pair<TypeA, TypeB>>& getElements() const {
+            return this->elements;
         }
 
-        [[nodiscard]] std::set<TypeB> getKeys() const {
-            auto keys = std::set<TypeB>();
+        [[nodiscard]] std::set<TypeA> getKeys() const {
+            auto keys = std::set<TypeA>();
 
-            for (const auto& [key, value] : this->map) {
+            for (const auto& [key, value] : this->elements) {
                 keys.insert(key);
             }
 
@@ -94,20 +120,148 @@ namespace Bloom
         [[nodiscard]] std::set<TypeB> getValues() const {
             auto values = std::set<TypeB>();
 
-            for (const auto& [key, value] : this->map) {
+            for (const auto& [key, value] : this->elements) {
                 values.insert(value);
             }
 
             return values;
         }
 
+        /**
+         * Inserts an element. Existing mappings are never overwritten - if only one side of the pair is already
+         * mapped, the element will only be reachable via the other side.
+         *
+         * @param pair
+         */
         void insert(const std::pair<TypeA, TypeB>& pair) {
-            auto insertResultPair = this->map.insert(pair);
-            this->flippedMap.insert(std::pair<TypeB, TypeA>(pair.second, pair.first));
+            if ((this->elements.size() + 1) * 2 > this->slotsByA.size()) {
+                this->growTables(this->elements.size() + 1);
+            }
+
+            const auto slotA = this->probe(this->slotsByA, pair.first, this->aMatcher(pair.first));
+            const auto slotB = this->probe(this->slotsByB, pair.second, this->bMatcher(pair.second));
+
+            const auto aMapped = this->slotsByA[slotA] != BiMap::EMPTY_SLOT;
+            const auto bMapped = this->slotsByB[slotB] != BiMap::EMPTY_SLOT;
+
+            if (aMapped && bMapped) {
+                return;
+            }
+
+            const auto index = static_cast<std::uint32_t>(this->elements.size());
+            this->elements.emplace_back(pair);
+
+            if (!aMapped) {
+                this->slotsByA[slotA] = index;
+            }
+
+            if (!bMapped) {
+                this->slotsByB[slotB] = index;
+            }
         }
 
     private:
-        std::unordered_map<TypeA, TypeB> map = {};
-        std::unordered_map<TypeB, TypeA> flippedMap = {};
+        static constexpr auto EMPTY_SLOT = std::numeric_limits<std::uint32_t>::max();
+
+        std::vector<std::pair<TypeA, TypeB>> elements;
+
+        /*
+         * The hash tables. Each slot holds an index into this->elements, or EMPTY_SLOT. The number of slots is
+         * always a power of two, and at least twice the number of elements.
+         */
+        std::vector<std::uint32_t> slotsByA;
+        std::vector<std::uint32_t> slotsByB;
+
+        template<typename KeyType>
+        static std::size_t slotFor(const KeyType& key, std::size_t slotCount) {
+            /*
+             * Fibonacci hashing, to spread out sequential keys (like register numbers), for which std::hash is often
+             * the identity function.
+             */
+            const auto hash = static_cast<std::uint64_t>(std::hash<KeyType>()(key)) * 0x9E3779B97F4A7C15ULL;
+            return static_cast<std::size_t>(hash >> 32) & (slotCount - 1);
+        }
+
+        auto aMatcher(const TypeA& key) const {
+            return [this, &key] (std::uint32_t index) {
+                return this->elements[index].first == key;
+            };
+        }
+
+        auto bMatcher(const TypeB& key) const {
+            return [this, &key] (std::uint32_t index) {
+                return this->elements[index].second == key;
+            };
+        }
+
+        /**
+         * Returns the slot holding the given key, or the empty slot where the key would be inserted.
+         */
+        template<typename KeyType, typename MatcherType>
+        static std::size_t probe(const std::vector<std::uint32_t>& table, const KeyType& key, MatcherType matcher) {
+            auto slot = BiMap::slotFor(key, table.size());
+
+            while (table[slot] != BiMap::EMPTY_SLOT && !matcher(table[slot])) {
+                slot = (slot + 1) & (table.size() - 1);
+            }
+
+            return slot;
+        }
+
+        std::optional<std::uint32_t> findIndex(const TypeA& key) const {
+            if (this->slotsByA.empty()) {
+                return std::nullopt;
+            }
+
+            const auto index = this->slotsByA[BiMap::probe(this->slotsByA, key, this->aMatcher(key))];
+            return index != BiMap::EMPTY_SLOT ? std::optional(index) : std::nullopt;
+        }
+
+        std::optional<std::uint32_t> findIndex(const TypeB& key) const {
+            if (this->slotsByB.empty()) {
+                return std::nullopt;
+            }
+
+            const auto index = this->slotsByB[BiMap::probe(this->slotsByB, key, this->bMatcher(key))];
+            return index != BiMap::EMPTY_SLOT ? std::optional(index) : std::nullopt;
+        }
+
+        /**
+         * Grows the hash tables to accommodate at least elementCount elements, and rebuilds them.
+         */
+        void growTables(std::size_t elementCount) {
+            auto slotCount = std::size_t(8);
+            while (slotCount < elementCount * 2) {
+                slotCount *= 2;
+            }
+
+            if (slotCount <= this->slotsByA.size()) {
+                return;
+            }
+
+            const auto previousSlotsByA = std::move(this->slotsByA);
+            const auto previousSlotsByB = std::move(this->slotsByB);
+
+            this->slotsByA.assign(slotCount, BiMap::EMPTY_SLOT);
+            this->slotsByB.assign(slotCount, BiMap::EMPTY_SLOT);
+
+            /*
+             * We re-insert the indices held by the previous tables, as opposed to all elements, as some elements may
+             * only be reachable from one side.
+             */
+            for (const auto index : previousSlotsByA) {
+                if (index != BiMap::EMPTY_SLOT) {
+                    const auto& key = this->elements[index].first;
+                    this->slotsByA[BiMap::probe(this->slotsByA, key, this->aMatcher(key))] = index;
+                }
+            }
+
+            for (const auto index : previousSlotsByB) {
+                if (index != BiMap::EMPTY_SLOT) {
+                    const auto& key = this->elements[index].second;
+                    this->slotsByB[BiMap::probe(this->slotsByB, key, this->bMatcher(key))] = index;
+                }
+            }
+        }
     };
 }
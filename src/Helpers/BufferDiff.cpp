@@ -0,0 +1,70 @@
+#include "BufferDiff.hpp"
+
+#include <cstring>
+#include <cassert>
+#include <optional>
+#include <algorithm>
+
+namespace Bloom
+{
+    using Targets::TargetMemoryAddressRange;
+
+    std::vector<TargetMemoryAddressRange> BufferDiff::differingRanges(
+        std::span<const unsigned char> bufferA,
+        std::span<const unsigned char> bufferB,
+        Targets::TargetMemoryAddress startAddress
+    ) {
+        assert(bufferA.size() == bufferB.size());
+
+        auto output = std::vector<TargetMemoryAddressRange>();
+
+        const auto size = std::min(bufferA.size(), bufferB.size());
+        const auto* dataA = bufferA.data();
+        const auto* dataB = bufferB.data();
+
+        // The index at which the current differing range starts, if we're within one
+        auto rangeStartIndex = std::optional<std::size_t>();
+
+        const auto closeRange = [&output, &rangeStartIndex, startAddress] (std::size_t endIndex) {
+            output.emplace_back(
+                startAddress + static_cast<Targets::TargetMemoryAddress>(*rangeStartIndex),
+                startAddress + static_cast<Targets::TargetMemoryAddress>(endIndex)
+            );
+            rangeStartIndex = std::nullopt;
+        };
+
+        auto index = std::size_t(0);
+        while (index < size) {
+            const auto blockEnd = std::min(index + BufferDiff::BLOCK_SIZE, size);
+
+            if (
+                (blockEnd - index) == BufferDiff::BLOCK_SIZE
+                && std::memcmp(dataA + index, dataB + index, BufferDiff::BLOCK_SIZE) == 0
+            ) {
+                if (rangeStartIndex.has_value()) {
+                    closeRange(index - 1);
+                }
+
+                index = blockEnd;
+                continue;
+            }
+
+            for (; index < blockEnd; ++index) {
+                const auto differs = dataA[index] != dataB[index];
+
+                if (differs && !rangeStartIndex.has_value()) {
+                    rangeStartIndex = index;
+
+                } else if (!differs && rangeStartIndex.has_value()) {
+                    closeRange(index - 1);
+                }
+            }
+        }
+
+        if (rangeStartIndex.has_value()) {
+            closeRange(size - 1);
+        }
+
+        return output;
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <span>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom
+{
+    class BufferDiff
+    {
+    public:
+        /**
+         * Compares two equally sized memory buffers and returns the address ranges (in ascending order) at which they
+         * differ. Adjacent differing bytes are merged into a single range.
+         *
+         * The buffers are compared in blocks of BufferDiff::BLOCK_SIZE bytes. Identical blocks (which make up the
+         * bulk of most diffs) are skipped with a single std::memcmp() call, which is vectorised by the standard
+         * library. Only the blocks that contain differences are compared byte by byte.
+         *
+         * @param bufferA
+         * @param bufferB
+         *
+         * @param startAddress
+         *  The address of the first byte in both buffers.
+         *
+         * @return
+         */
+        static std::vector<Targets::TargetMemoryAddressRange> differingRanges(
+            std::span<const unsigned char> bufferA,
+            std::span<const unsigned char> bufferB,
+            Targets::TargetMemoryAddress startAddress
+        );
+
+    private:
+        static constexpr std::size_t BLOCK_SIZE = 64;
+    };
+}
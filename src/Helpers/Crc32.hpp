@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <span>
+
+namespace Bloom
+{
+    /**
+     * CRC-32 (polynomial 0x04C11DB7), computed MSB first, with no input/output reflection and no final XOR. This is
+     * the variant that GDB uses for the "qCRC" packet (see GDB's xcrc32() implementation).
+     *
+     * The CRC can be computed incrementally, by feeding the result of each call to Crc32::update() into the next.
+     */
+    class Crc32
+    {
+    public:
+        static constexpr std::uint32_t INITIAL_VALUE = 0xFFFFFFFF;
+
+        static constexpr std::uint32_t update(std::uint32_t crc, std::span<const unsigned char> data) {
+            for (const auto byte : data) {
+                crc = (crc << 8) ^ Crc32::TABLE[((crc >> 24) ^ byte) & 0xFF];
+            }
+
+            return crc;
+        }
+
+    private:
+        static constexpr std::uint32_t POLYNOMIAL = 0x04C11DB7;
+
+        static constexpr std::array<std::uint32_t, 256> TABLE = [] {
+            auto table = std::array<std::uint32_t, 256>();
+
+            for (auto i = std::uint32_t(0); i < 256; ++i) {
+                auto value = i << 24;
+
+                for (auto bit = 0; bit < 8; ++bit) {
+                    value = (value & 0x80000000) != 0 ? (value << 1) ^ Crc32::POLYNOMIAL : (value << 1);
+                }
+
+                table[i] = value;
+            }
+
+            return table;
+        }();
+    };
+}
@@ -49,18 +49,25 @@ namespace Bloom
     std::optional<int> EpollInstance::waitForEvent(std::optional<std::chrono::milliseconds> timeout) const {
         std::array<struct epoll_event, 1> events = {};
 
+        if (this->waitForEvents(events, timeout) < 1) {
+            return std::nullopt;
+        }
+
+        return static_cast<int>(events.at(0).data.fd);
+    }
+
+    std::size_t EpollInstance::waitForEvents(
+        std::span<struct ::epoll_event> events,
+        std::optional<std::chrono::milliseconds> timeout
+    ) const {
         const auto eventCount = ::epoll_wait(
             this->fileDescriptor.value(),
             events.data(),
-            1,
+            static_cast<int>(events.size()),
             timeout.has_value() ? static_cast<int>(timeout->count()) : -1
         );
 
-        if (eventCount < 1) {
-            return std::nullopt;
-        }
-
-        return static_cast<int>(events.at(0).data.fd);
+        return eventCount > 0 ? static_cast<std::size_t>(eventCount) : 0;
     }
 
     EpollInstance::EpollInstance(EpollInstance&& other) noexcept
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <optional>
 #include <chrono>
+#include <span>
 
 namespace Bloom
 {
@@ -46,6 +47,28 @@ namespace Bloom
             std::optional<std::chrono::milliseconds> timeout = std::nullopt
         ) const;
 
+        /**
+         * Waits on the epoll instance until an event occurs for any of the registered files, and collects all events
+         * that are ready at that point, in a single call to epoll_wait().
+         *
+         * Each event's data.fd member holds the file descriptor of the file for which the event occurred, and its
+         * events member holds the mask of events that occurred.
+         *
+         * @param events
+         *  The buffer that will receive the events. No more than events.size() events will be collected.
+         *
+         * @param timeout
+         *  Millisecond timeout. If not provided, no timeout will be applied and this function will block until an
+         *  event occurs.
+         *
+         * @return
+         *  The number of events written to the buffer. Zero if the timeout was reached.
+         */
+        [[nodiscard]] std::size_t waitForEvents(
+            std::span<struct ::epoll_event> events,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        ) const;
+
         /*
          * EpollInstance objects should not be copied.
          */
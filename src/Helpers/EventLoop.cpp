@@ -0,0 +1,164 @@
+#include "EventLoop.hpp"
+
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <array>
+#include <string>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom
+{
+    using Exceptions::Exception;
+
+    EventLoop::EventLoop() {
+        this->epollInstance.addEntry(
+            this->wakeupNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
+        );
+    }
+
+    EventLoop::~EventLoop() noexcept {
+        for (const auto& [timerId, timer] : this->timersById) {
+            ::close(timerId);
+        }
+    }
+
+    void EventLoop::watch(int fileDescriptor, std::uint16_t eventMask, FileDescriptorCallback callback) {
+        this->epollInstance.addEntry(fileDescriptor, eventMask);
+        this->callbacksByFileDescriptor.insert_or_assign(fileDescriptor, std::move(callback));
+    }
+
+    void EventLoop::unwatch(int fileDescriptor) {
+        if (this->callbacksByFileDescriptor.erase(fileDescriptor) > 0) {
+            this->epollInstance.removeEntry(fileDescriptor);
+        }
+    }
+
+    EventLoop::TimerId EventLoop::addTimer(
+        std::chrono::milliseconds interval,
+        TimerCallback callback,
+        bool periodic
+    ) {
+        const auto timerFileDescriptor = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+        if (timerFileDescriptor < 0) {
+            throw Exception("Failed to create timerfd object - error number " + std::to_string(errno) + " returned.");
+        }
+
+        // A zeroed it_value would disarm the timer, so we use the smallest possible value for a zero interval
+        const auto intervalTime = interval.count() > 0
+            ? (struct ::timespec) {
+                .tv_sec = static_cast<::time_t>(interval.count() / 1000),
+                .tv_nsec = static_cast<long>((interval.count() % 1000) * 1000000),
+            }
+            : (struct ::timespec) {.tv_sec = 0, .tv_nsec = 1};
+
+        const auto timerSpec = (struct ::itimerspec) {
+            .it_interval = periodic ? intervalTime : (struct ::timespec) {},
+            .it_value = intervalTime,
+        };
+
+        if (::timerfd_settime(timerFileDescriptor, 0, &timerSpec, nullptr) != 0) {
+            ::close(timerFileDescriptor);
+            throw Exception("Failed to arm timerfd object - error number " + std::to_string(errno) + " returned.");
+        }
+
+        try {
+            this->epollInstance.addEntry(timerFileDescriptor, static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN));
+
+        } catch (const Exception&) {
+            ::close(timerFileDescriptor);
+            throw;
+        }
+
+        this->timersById.insert(std::pair(timerFileDescriptor, Timer{std::move(callback), periodic}));
+        return timerFileDescriptor;
+    }
+
+    void EventLoop::removeTimer(TimerId timerId) {
+        if (this->timersById.erase(timerId) > 0) {
+            this->epollInstance.removeEntry(timerId);
+            ::close(timerId);
+        }
+    }
+
+    void EventLoop::post(std::function<void()> task) {
+        {
+            const auto lock = std::unique_lock(this->postedTasksMutex);
+            this->postedTasks.emplace_back(std::move(task));
+        }
+
+        this->wakeupNotifier.notify();
+    }
+
+    void EventLoop::notify() {
+        this->wakeupNotifier.notify();
+    }
+
+    std::size_t EventLoop::runOnce(std::optional<std::chrono::milliseconds> timeout) {
+        auto events = std::array<struct ::epoll_event, EventLoop::MAX_EVENTS>();
+        const auto eventCount = this->epollInstance.waitForEvents(events, timeout);
+
+        for (auto eventIndex = std::size_t(0); eventIndex < eventCount; ++eventIndex) {
+            const auto& event = events[eventIndex];
+            const auto fileDescriptor = event.data.fd;
+
+            if (fileDescriptor == this->wakeupNotifier.getFileDescriptor()) {
+                this->wakeupNotifier.clear();
+                this->runPostedTasks();
+                continue;
+            }
+
+            if (this->timersById.contains(fileDescriptor)) {
+                this->handleTimerExpiry(fileDescriptor);
+                continue;
+            }
+
+            /*
+             * An earlier callback in this batch may have removed the file descriptor, in which case we discard the
+             * event. We copy the callback, as the callback may remove itself.
+             */
+            const auto callbackIt = this->callbacksByFileDescriptor.find(fileDescriptor);
+            if (callbackIt == this->callbacksByFileDescriptor.end()) {
+                continue;
+            }
+
+            const auto callback = callbackIt->second;
+            callback(event.events);
+        }
+
+        return eventCount;
+    }
+
+    void EventLoop::runPostedTasks() {
+        auto tasks = std::vector<std::function<void()>>();
+
+        {
+            const auto lock = std::unique_lock(this->postedTasksMutex);
+            tasks.swap(this->postedTasks);
+        }
+
+        for (const auto& task : tasks) {
+            task();
+        }
+    }
+
+    void EventLoop::handleTimerExpiry(TimerId timerId) {
+        auto expirations = std::uint64_t(0);
+        if (::read(timerId, &expirations, sizeof(expirations)) != sizeof(expirations)) {
+            // Spurious wakeup - the timer hasn't expired
+            return;
+        }
+
+        const auto timerIt = this->timersById.find(timerId);
+        const auto callback = timerIt->second.callback;
+
+        if (!timerIt->second.periodic) {
+            this->removeTimer(timerId);
+        }
+
+        callback();
+    }
+}
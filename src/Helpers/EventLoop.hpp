@@ -0,0 +1,156 @@
+#pragma once
+
+#include <sys/epoll.h>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <chrono>
+#include <map>
+#include <vector>
+#include <mutex>
+
+#include "NotifierInterface.hpp"
+#include "EpollInstance.hpp"
+#include "EventFdNotifier.hpp"
+
+namespace Bloom
+{
+    /**
+     * A single-threaded event loop, built on an EpollInstance, for Bloom's component threads.
+     *
+     * The loop monitors any number of file descriptors, each with its own callback, along with timers (backed by
+     * Linux timerfd objects) and tasks posted from other threads (via an eventfd object). All events that are ready
+     * when the loop wakes up are collected in a single call to epoll_wait(), and their callbacks are invoked in one
+     * pass.
+     *
+     * The loop is driven by its owning thread, via EventLoop::runOnce(). Callbacks are always invoked on that thread.
+     * Only EventLoop::post() and EventLoop::notify() are safe to call from other threads.
+     *
+     * The EventLoop implements the NotifierInterface, so it can be given to an EventListener (see
+     * EventListener::setInterruptEventNotifier()) to have the loop woken up upon the registration of new events.
+     */
+    class EventLoop: public NotifierInterface
+    {
+    public:
+        using FileDescriptorCallback = std::function<void(std::uint32_t eventMask)>;
+        using TimerCallback = std::function<void()>;
+        using TimerId = int;
+
+        /**
+         * The maximum number of events collected in a single call to epoll_wait(). Any other events will be
+         * collected in the next call to EventLoop::runOnce().
+         */
+        static constexpr std::size_t MAX_EVENTS = 16;
+
+        EventLoop();
+        ~EventLoop() noexcept override;
+
+        /*
+         * EventLoop objects should not be copied or moved - callers hold references to them.
+         */
+        EventLoop(EventLoop& other) = delete;
+        EventLoop& operator = (EventLoop& other) = delete;
+        EventLoop(EventLoop&& other) = delete;
+        EventLoop& operator = (EventLoop&& other) = delete;
+
+        /**
+         * Starts monitoring the given file descriptor.
+         *
+         * @param fileDescriptor
+         *  The loop does not take ownership of the file descriptor. It must remain open until it has been removed
+         *  from the loop (via EventLoop::unwatch()).
+         *
+         * @param eventMask
+         *  The epoll events of interest (e.g. EPOLLIN).
+         *
+         * @param callback
+         *  Invoked with the mask of events that occurred.
+         */
+        void watch(int fileDescriptor, std::uint16_t eventMask, FileDescriptorCallback callback);
+
+        /**
+         * Stops monitoring the given file descriptor. This can be called from within a callback, in which case any
+         * pending events for the file descriptor will be discarded.
+         *
+         * @param fileDescriptor
+         */
+        void unwatch(int fileDescriptor);
+
+        /**
+         * Adds a timer to the loop.
+         *
+         * @param interval
+         *  The time until the timer expires. For periodic timers, this is also the time between subsequent
+         *  expirations.
+         *
+         * @param callback
+         *  Invoked once per wakeup, even if the timer has expired more than once since the last wakeup.
+         *
+         * @param periodic
+         *  If false, the timer will be removed after it has expired.
+         *
+         * @return
+         *  The ID of the timer, for EventLoop::removeTimer().
+         */
+        TimerId addTimer(std::chrono::milliseconds interval, TimerCallback callback, bool periodic = false);
+
+        /**
+         * Removes a timer from the loop, if the timer still exists.
+         *
+         * @param timerId
+         */
+        void removeTimer(TimerId timerId);
+
+        /**
+         * Queues a task, to be invoked on the loop's thread, and wakes the loop up.
+         *
+         * This can be called from any thread.
+         *
+         * @param task
+         */
+        void post(std::function<void()> task);
+
+        /**
+         * Wakes the loop up, without queueing a task.
+         *
+         * This can be called from any thread.
+         */
+        void notify() override;
+
+        /**
+         * Waits for the next batch of events and invokes their callbacks, along with any posted tasks.
+         *
+         * @param timeout
+         *  Millisecond timeout. If not provided, this function will block until an event occurs, or until the loop
+         *  is woken up (via EventLoop::notify() or EventLoop::post()).
+         *
+         * @return
+         *  The number of events collected. Zero if the timeout was reached.
+         */
+        std::size_t runOnce(std::optional<std::chrono::milliseconds> timeout = std::nullopt);
+
+    private:
+        struct Timer
+        {
+            TimerCallback callback;
+            bool periodic = false;
+        };
+
+        EpollInstance epollInstance = EpollInstance();
+        EventFdNotifier wakeupNotifier = EventFdNotifier();
+
+        std::map<int, FileDescriptorCallback> callbacksByFileDescriptor;
+
+        /**
+         * Timers, mapped by their timerfd file descriptor (which doubles as the timer ID).
+         */
+        std::map<TimerId, Timer> timersById;
+
+        std::mutex postedTasksMutex;
+        std::vector<std::function<void()>> postedTasks;
+
+        void runPostedTasks();
+        void handleTimerExpiry(TimerId timerId);
+    };
+}
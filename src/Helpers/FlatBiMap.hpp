@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <utility>
+#include <optional>
+#include <stdexcept>
+
+namespace Bloom
+{
+    /**
+     * Fixed size bidirectional map, for small tables of literal types (enums mapped to std::string_view names, etc).
+     *
+     * The elements are held in an std::array, and looked up via a linear search. For a handful of elements, this
+     * beats hashing. FlatBiMap objects can be constructed at compile time:
+     *
+     *  static constexpr auto COLOUR_NAMES = FlatBiMap(std::to_array<std::pair<Colour, std::string_view>>({
+     *      {Colour::RED, "red"},
+     *      {Colour::GREEN, "green"},
+     *  }));
+     *
+     * For larger tables, or tables that are populated at runtime, see BiMap.
+     *
+     * @tparam TypeA
+     * @tparam TypeB
+     * @tparam size
+     */
+    template<typename TypeA, typename TypeB, std::size_t size>
+    class FlatBiMap
+    {
+    public:
+        constexpr explicit FlatBiMap(const std::array<std::pair<TypeA, TypeB>, size>& elements)
+            : elements(elements)
+        {}
+
+        constexpr bool contains(const TypeA& key) const {
+            return this->find(key) != nullptr;
+        }
+
+        constexpr bool contains(const TypeB& key) const {
+            return this->find(key) != nullptr;
+        }
+
+        /**
+         * Both overloads of find() return a pointer to the stored (TypeA, TypeB) pair, or nullptr if the key isn't
+         * mapped.
+         *
+         * @param key
+         * @return
+         */
+        constexpr const std::pair<TypeA, TypeB>* find(const TypeA& key) const {
+            for (const auto& element : this->elements) {
+                if (element.first == key) {
+                    return &element;
+                }
+            }
+
+            return nullptr;
+        }
+
+        constexpr const std::pair<TypeA, TypeB>* find(const TypeB& key) const {
+            for (const auto& element : this->elements) {
+                if (element.second == key) {
+                    return &element;
+                }
+            }
+
+            return nullptr;
+        }
+
+        constexpr std::optional<TypeB> valueAt(const TypeA& key) const {
+            const auto* element = this->find(key);
+            return element != nullptr ? std::optional(element->second) : std::nullopt;
+        }
+
+        constexpr std::optional<TypeA> valueAt(const TypeB& key) const {
+            const auto* element = this->find(key);
+            return element != nullptr ? std::optional(element->first) : std::nullopt;
+        }
+
+        /**
+         * @throws std::out_of_range
+         *  If the key isn't mapped.
+         */
+        constexpr const TypeB& at(const TypeA& key) const {
+            const auto* element = this->find(key);
+            if (element == nullptr) {
+                throw std::out_of_range("FlatBiMap key not found");
+            }
+
+            return element->second;
+        }
+
+        constexpr const TypeA& at(const TypeB& key) const {
+            const auto* element = this->find(key);
+            if (element == nullptr) {
+                throw std::out_of_range("FlatBiMap key not found");
+            }
+
+            return element->first;
+        }
+
+        constexpr auto begin() const {
+            return this->elements.begin();
+        }
+
+        constexpr auto end() const {
+            return this->elements.end();
+        }
+
+    private:
+        std::array<std::pair<TypeA, TypeB>, size> elements;
+    };
+
+    template<typename TypeA, typename TypeB, std::size_t size>
+    FlatBiMap(std::array<std::pair<TypeA, TypeB>, size>) -> FlatBiMap<TypeA, TypeB, size>;
+}
@@ -0,0 +1,383 @@
+#include "HexCodec.hpp"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom
+{
+    using Exceptions::Exception;
+
+    namespace
+    {
+        /**
+         * A hex codec implementation. The encode function encodes `bytes` bytes, and the decode function decodes
+         * `bytes` bytes (from (bytes * 2) characters).
+         */
+        struct Implementation
+        {
+            std::string_view name;
+            void (*encode)(const unsigned char* data, std::size_t bytes, unsigned char* output);
+            bool (*decode)(const char* hexData, std::size_t bytes, unsigned char* output);
+        };
+
+        constexpr auto ENCODE_TABLE = [] {
+            constexpr auto digits = std::string_view("0123456789abcdef");
+            auto table = std::array<std::array<unsigned char, 2>, 256>();
+
+            for (auto byte = std::size_t(0); byte < table.size(); ++byte) {
+                table[byte][0] = static_cast<unsigned char>(digits[byte >> 4]);
+                table[byte][1] = static_cast<unsigned char>(digits[byte & 0x0F]);
+            }
+
+            return table;
+        }();
+
+        // Maps characters to their hex digit values. Anything that isn't a hex digit maps to -1.
+        constexpr auto DECODE_TABLE = [] {
+            auto table = std::array<std::int8_t, 256>();
+            table.fill(-1);
+
+            for (auto digit = 0; digit < 10; ++digit) {
+                table['0' + digit] = static_cast<std::int8_t>(digit);
+            }
+
+            for (auto digit = 0; digit < 6; ++digit) {
+                table['a' + digit] = static_cast<std::int8_t>(10 + digit);
+                table['A' + digit] = static_cast<std::int8_t>(10 + digit);
+            }
+
+            return table;
+        }();
+
+        void encodeScalar(const unsigned char* data, std::size_t bytes, unsigned char* output) {
+            for (auto i = std::size_t(0); i < bytes; ++i) {
+                std::memcpy(output + (i * 2), ENCODE_TABLE[data[i]].data(), 2);
+            }
+        }
+
+        bool decodeScalar(const char* hexData, std::size_t bytes, unsigned char* output) {
+            // The sign bit of `invalid` will be set if we encounter any invalid characters
+            auto invalid = 0;
+
+            for (auto i = std::size_t(0); i < bytes; ++i) {
+                const auto high = DECODE_TABLE[static_cast<unsigned char>(hexData[i * 2])];
+                const auto low = DECODE_TABLE[static_cast<unsigned char>(hexData[(i * 2) + 1])];
+
+                invalid |= high | low;
+                output[i] = static_cast<unsigned char>((high << 4) | low);
+            }
+
+            return invalid >= 0;
+        }
+
+#if defined(__x86_64__)
+        /*
+         * The x86-64 baseline only guarantees SSE2, so the SSSE3 and AVX2 implementations are compiled for their
+         * instruction sets individually, and only selected if the host CPU supports them (see
+         * resolveImplementation()).
+         */
+
+        /**
+         * Converts 16 hex digit characters to their values, and clears the corresponding bytes in `valid`, for any
+         * characters that aren't hex digits.
+         *
+         * Only SSE2 instructions are used here, so this serves the SSSE3 implementation.
+         */
+        __attribute__((target("ssse3")))
+        inline __m128i hexDigitValues128(__m128i characters, __m128i& valid) {
+            // Setting bit 5 maps upper case letters to lower case, and leaves the digits untouched
+            const auto lowerCharacters = _mm_or_si128(characters, _mm_set1_epi8(0x20));
+
+            // These comparisons are signed, so characters above 0x7F are rejected along with everything else
+            const auto isDigit = _mm_and_si128(
+                _mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)),
+                _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), characters)
+            );
+
+            const auto isLetter = _mm_and_si128(
+                _mm_cmpgt_epi8(lowerCharacters, _mm_set1_epi8('a' - 1)),
+                _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lowerCharacters)
+            );
+
+            valid = _mm_and_si128(valid, _mm_or_si128(isDigit, isLetter));
+
+            return _mm_or_si128(
+                _mm_and_si128(isDigit, _mm_sub_epi8(characters, _mm_set1_epi8('0'))),
+                _mm_and_si128(isLetter, _mm_sub_epi8(lowerCharacters, _mm_set1_epi8('a' - 10)))
+            );
+        }
+
+        __attribute__((target("ssse3")))
+        void encodeSsse3(const unsigned char* data, std::size_t bytes, unsigned char* output) {
+            const auto digits = _mm_setr_epi8(
+                '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+            );
+            const auto nibbleMask = _mm_set1_epi8(0x0F);
+
+            auto i = std::size_t(0);
+            for (; i + 16 <= bytes; i += 16) {
+                const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const auto high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask));
+                const auto low = _mm_shuffle_epi8(digits, _mm_and_si128(input, nibbleMask));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + (i * 2)), _mm_unpacklo_epi8(high, low));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + (i * 2) + 16), _mm_unpackhi_epi8(high, low));
+            }
+
+            encodeScalar(data + i, bytes - i, output + (i * 2));
+        }
+
+        __attribute__((target("ssse3")))
+        bool decodeSsse3(const char* hexData, std::size_t bytes, unsigned char* output) {
+            // Multiplies the high nibble (even bytes) by 16 and adds the low nibble (odd bytes), for each pair
+            const auto pairWeights = _mm_set1_epi16(0x0110);
+            auto valid = _mm_set1_epi8(-1);
+
+            auto i = std::size_t(0);
+            for (; i + 16 <= bytes; i += 16) {
+                const auto first = hexDigitValues128(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(hexData + (i * 2))),
+                    valid
+                );
+                const auto second = hexDigitValues128(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(hexData + (i * 2) + 16)),
+                    valid
+                );
+
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(output + i),
+                    _mm_packus_epi16(_mm_maddubs_epi16(first, pairWeights), _mm_maddubs_epi16(second, pairWeights))
+                );
+            }
+
+            if (_mm_movemask_epi8(valid) != 0xFFFF) {
+                return false;
+            }
+
+            return decodeScalar(hexData + (i * 2), bytes - i, output + i);
+        }
+
+        /**
+         * The AVX2 equivalent of hexDigitValues128().
+         */
+        __attribute__((target("avx2")))
+        inline __m256i hexDigitValues256(__m256i characters, __m256i& valid) {
+            const auto lowerCharacters = _mm256_or_si256(characters, _mm256_set1_epi8(0x20));
+
+            const auto isDigit = _mm256_and_si256(
+                _mm256_cmpgt_epi8(characters, _mm256_set1_epi8('0' - 1)),
+                _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), characters)
+            );
+
+            const auto isLetter = _mm256_and_si256(
+                _mm256_cmpgt_epi8(lowerCharacters, _mm256_set1_epi8('a' - 1)),
+                _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lowerCharacters)
+            );
+
+            valid = _mm256_and_si256(valid, _mm256_or_si256(isDigit, isLetter));
+
+            return _mm256_or_si256(
+                _mm256_and_si256(isDigit, _mm256_sub_epi8(characters, _mm256_set1_epi8('0'))),
+                _mm256_and_si256(isLetter, _mm256_sub_epi8(lowerCharacters, _mm256_set1_epi8('a' - 10)))
+            );
+        }
+
+        __attribute__((target("avx2")))
+        void encodeAvx2(const unsigned char* data, std::size_t bytes, unsigned char* output) {
+            // Byte shuffles operate within each 128-bit lane, so both lanes need a copy of the digits
+            const auto digits = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+                '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+            ));
+            const auto nibbleMask = _mm256_set1_epi8(0x0F);
+
+            auto i = std::size_t(0);
+            for (; i + 32 <= bytes; i += 32) {
+                const auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const auto high = _mm256_shuffle_epi8(
+                    digits,
+                    _mm256_and_si256(_mm256_srli_epi16(input, 4), nibbleMask)
+                );
+                const auto low = _mm256_shuffle_epi8(digits, _mm256_and_si256(input, nibbleMask));
+
+                /*
+                 * The unpack instructions also operate within each lane, so the output of the first holds the
+                 * characters for bytes 0-7 and 16-23, and the output of the second holds those for bytes 8-15 and
+                 * 24-31. We recombine the lanes to put them back in order.
+                 */
+                const auto interleavedLow = _mm256_unpacklo_epi8(high, low);
+                const auto interleavedHigh = _mm256_unpackhi_epi8(high, low);
+
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + (i * 2)),
+                    _mm256_permute2x128_si256(interleavedLow, interleavedHigh, 0x20)
+                );
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + (i * 2) + 32),
+                    _mm256_permute2x128_si256(interleavedLow, interleavedHigh, 0x31)
+                );
+            }
+
+            encodeSsse3(data + i, bytes - i, output + (i * 2));
+        }
+
+        __attribute__((target("avx2")))
+        bool decodeAvx2(const char* hexData, std::size_t bytes, unsigned char* output) {
+            const auto pairWeights = _mm256_set1_epi16(0x0110);
+            auto valid = _mm256_set1_epi8(-1);
+
+            auto i = std::size_t(0);
+            for (; i + 32 <= bytes; i += 32) {
+                const auto first = hexDigitValues256(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hexData + (i * 2))),
+                    valid
+                );
+                const auto second = hexDigitValues256(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hexData + (i * 2) + 32)),
+                    valid
+                );
+
+                // As with the unpack instructions, packing operates within each lane, hence the permutation
+                const auto packed = _mm256_packus_epi16(
+                    _mm256_maddubs_epi16(first, pairWeights),
+                    _mm256_maddubs_epi16(second, pairWeights)
+                );
+
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + i),
+                    _mm256_permute4x64_epi64(packed, 0xD8)
+                );
+            }
+
+            if (_mm256_movemask_epi8(valid) != -1) {
+                return false;
+            }
+
+            return decodeSsse3(hexData + (i * 2), bytes - i, output + i);
+        }
+
+#elif defined(__aarch64__)
+        // NEON is part of the AArch64 baseline, so there's no need for runtime detection here.
+
+        void encodeNeon(const unsigned char* data, std::size_t bytes, unsigned char* output) {
+            const auto digits = vld1q_u8(reinterpret_cast<const std::uint8_t*>("0123456789abcdef"));
+            const auto nibbleMask = vdupq_n_u8(0x0F);
+
+            auto i = std::size_t(0);
+            for (; i + 16 <= bytes; i += 16) {
+                const auto input = vld1q_u8(data + i);
+
+                // The interleaving store places each high nibble character before its low nibble character
+                auto characters = uint8x16x2_t();
+                characters.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(input, 4));
+                characters.val[1] = vqtbl1q_u8(digits, vandq_u8(input, nibbleMask));
+                vst2q_u8(output + (i * 2), characters);
+            }
+
+            encodeScalar(data + i, bytes - i, output + (i * 2));
+        }
+
+        /**
+         * Converts 16 hex digit characters to their values, and clears the corresponding bytes in `valid`, for any
+         * characters that aren't hex digits.
+         */
+        inline uint8x16_t hexDigitValuesNeon(uint8x16_t characters, uint8x16_t& valid) {
+            // Setting bit 5 maps upper case letters to lower case, and leaves the digits untouched
+            const auto lowerCharacters = vorrq_u8(characters, vdupq_n_u8(0x20));
+
+            // Anything below the range wraps around, so a single unsigned comparison is enough for each range
+            const auto digitValues = vsubq_u8(characters, vdupq_n_u8('0'));
+            const auto letterValues = vsubq_u8(lowerCharacters, vdupq_n_u8('a'));
+            const auto isDigit = vcltq_u8(digitValues, vdupq_n_u8(10));
+            const auto isLetter = vcltq_u8(letterValues, vdupq_n_u8(6));
+
+            valid = vandq_u8(valid, vorrq_u8(isDigit, isLetter));
+            return vbslq_u8(isDigit, digitValues, vaddq_u8(letterValues, vdupq_n_u8(10)));
+        }
+
+        bool decodeNeon(const char* hexData, std::size_t bytes, unsigned char* output) {
+            auto valid = vdupq_n_u8(0xFF);
+
+            auto i = std::size_t(0);
+            for (; i + 16 <= bytes; i += 16) {
+                // The deinterleaving load separates the high nibble characters from the low nibble characters
+                const auto characters = vld2q_u8(reinterpret_cast<const std::uint8_t*>(hexData + (i * 2)));
+                const auto high = hexDigitValuesNeon(characters.val[0], valid);
+                const auto low = hexDigitValuesNeon(characters.val[1], valid);
+
+                vst1q_u8(output + i, vorrq_u8(vshlq_n_u8(high, 4), low));
+            }
+
+            if (vminvq_u8(valid) == 0) {
+                return false;
+            }
+
+            return decodeScalar(hexData + (i * 2), bytes - i, output + i);
+        }
+#endif
+
+        const Implementation& resolveImplementation() {
+            static const auto implementation = [] () -> Implementation {
+#if defined(__x86_64__)
+                __builtin_cpu_init();
+
+                if (__builtin_cpu_supports("avx2")) {
+                    return {"AVX2", encodeAvx2, decodeAvx2};
+                }
+
+                if (__builtin_cpu_supports("ssse3")) {
+                    return {"SSSE3", encodeSsse3, decodeSsse3};
+                }
+#elif defined(__aarch64__)
+                return {"NEON", encodeNeon, decodeNeon};
+#endif
+                return {"scalar", encodeScalar, decodeScalar};
+            }();
+
+            return implementation;
+        }
+    }
+
+    void HexCodec::encode(std::span<const unsigned char> data, unsigned char* output) {
+        resolveImplementation().encode(data.data(), data.size(), output);
+    }
+
+    void HexCodec::encode(std::span<const unsigned char> data, char* output) {
+        HexCodec::encode(data, reinterpret_cast<unsigned char*>(output));
+    }
+
+    std::string HexCodec::encode(std::span<const unsigned char> data) {
+        auto output = std::string(data.size() * 2, '\0');
+        HexCodec::encode(data, output.data());
+        return output;
+    }
+
+    bool HexCodec::decode(std::string_view hexData, unsigned char* output) {
+        if ((hexData.size() % 2) != 0) {
+            return false;
+        }
+
+        return resolveImplementation().decode(hexData.data(), hexData.size() / 2, output);
+    }
+
+    std::vector<unsigned char> HexCodec::decode(std::string_view hexData) {
+        auto output = std::vector<unsigned char>(hexData.size() / 2);
+
+        if (!HexCodec::decode(hexData, output.data())) {
+            throw Exception("Invalid hexadecimal data");
+        }
+
+        return output;
+    }
+
+    std::string_view HexCodec::implementationName() {
+        return resolveImplementation().name;
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+
+namespace Bloom
+{
+    /**
+     * Encodes and decodes data in hexadecimal form (two characters per byte, most significant nibble first).
+     *
+     * Hex is the currency of the GDB RSP - every memory read response, every register read response and every
+     * memory write command carries its data in this form. Encoding and decoding are performed with SIMD
+     * instructions, where available (AVX2 or SSSE3 on x86-64, selected at runtime, or NEON on AArch64). Everything
+     * else, including the tail of each buffer, goes through a lookup table.
+     *
+     * Output is always in lowercase. Input can be in either case.
+     */
+    class HexCodec
+    {
+    public:
+        /**
+         * Writes the hexadecimal form of the given data to the output buffer.
+         *
+         * @param data
+         *
+         * @param output
+         *  Must have room for at least (data.size() * 2) characters. The output is not null-terminated.
+         */
+        static void encode(std::span<const unsigned char> data, unsigned char* output);
+        static void encode(std::span<const unsigned char> data, char* output);
+
+        static std::string encode(std::span<const unsigned char> data);
+
+        /**
+         * Writes the hexadecimal form of a single byte to the output buffer.
+         *
+         * @param byte
+         *
+         * @param output
+         *  Must have room for at least two characters.
+         */
+        static void encodeByte(unsigned char byte, unsigned char* output) {
+            output[0] = static_cast<unsigned char>(HexCodec::DIGITS[byte >> 4]);
+            output[1] = static_cast<unsigned char>(HexCodec::DIGITS[byte & 0x0F]);
+        }
+
+        /**
+         * Decodes the given hexadecimal data into the output buffer.
+         *
+         * @param hexData
+         *  Must consist of an even number of hexadecimal digits.
+         *
+         * @param output
+         *  Must have room for at least (hexData.size() / 2) bytes. The content of the buffer is unspecified if
+         *  decoding fails.
+         *
+         * @return
+         *  True if the data was decoded successfully. False if hexData has an odd length or contains anything other
+         *  than hexadecimal digits.
+         */
+        [[nodiscard]] static bool decode(std::string_view hexData, unsigned char* output);
+
+        /**
+         * Decodes the given hexadecimal data.
+         *
+         * @param hexData
+         *
+         * @throws Exceptions::Exception
+         *  If hexData has an odd length or contains anything other than hexadecimal digits.
+         *
+         * @return
+         */
+        static std::vector<unsigned char> decode(std::string_view hexData);
+
+        /**
+         * Returns the name of the implementation selected for the host CPU ("AVX2", "SSSE3", "NEON" or "scalar").
+         *
+         * @return
+         */
+        static std::string_view implementationName();
+
+    private:
+        static constexpr auto DIGITS = std::string_view("0123456789abcdef");
+    };
+}
@@ -0,0 +1,26 @@
+#include "InternedString.hpp"
+
+#include <set>
+#include <mutex>
+#include <functional>
+
+namespace Bloom
+{
+    const std::string* InternedString::intern(std::string_view value) {
+        /*
+         * std::set never relocates its elements, so the pointers we hand out remain valid for the lifetime of the
+         * process. The transparent comparator allows us to look up string views without constructing a string.
+         */
+        static auto mutex = std::mutex();
+        static auto pool = std::set<std::string, std::less<>>();
+
+        const auto lock = std::unique_lock(mutex);
+
+        auto stringIt = pool.find(value);
+        if (stringIt == pool.end()) {
+            stringIt = pool.emplace(value).first;
+        }
+
+        return &(*stringIt);
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <optional>
+
+namespace Bloom
+{
+    /**
+     * An optional, immutable string, held in a process-wide pool of unique strings.
+     *
+     * Copying an InternedString copies a pointer, and comparing two InternedStrings compares pointers, as each
+     * distinct string is stored exactly once. Nothing is ever removed from the pool, so this should only be used for
+     * strings that come from a bounded set, such as the register names and captions in a target description file.
+     *
+     * The interface mirrors that of std::optional<std::string>, so that an InternedString can be dropped in as a
+     * replacement for one.
+     *
+     * Interning is thread-safe. Reading an interned string requires no synchronisation.
+     */
+    class InternedString
+    {
+    public:
+        InternedString() = default;
+        InternedString(std::nullopt_t) {}
+
+        InternedString(std::string_view value)
+            : string(InternedString::intern(value))
+        {}
+
+        InternedString(const std::string& value)
+            : InternedString(std::string_view(value))
+        {}
+
+        InternedString(const char* value)
+            : InternedString(std::string_view(value))
+        {}
+
+        InternedString(const std::optional<std::string>& value) {
+            if (value.has_value()) {
+                this->string = InternedString::intern(*value);
+            }
+        }
+
+        [[nodiscard]] bool has_value() const {
+            return this->string != nullptr;
+        }
+
+        explicit operator bool () const {
+            return this->has_value();
+        }
+
+        /**
+         * @throws std::bad_optional_access
+         *  If there is no value.
+         *
+         * @return
+         */
+        [[nodiscard]] const std::string& value() const {
+            if (this->string == nullptr) {
+                throw std::bad_optional_access();
+            }
+
+            return *(this->string);
+        }
+
+        [[nodiscard]] std::string value_or(std::string_view defaultValue) const {
+            return this->string != nullptr ? *(this->string) : std::string(defaultValue);
+        }
+
+        const std::string& operator * () const {
+            return *(this->string);
+        }
+
+        const std::string* operator -> () const {
+            return this->string;
+        }
+
+        bool operator == (const InternedString& other) const {
+            return this->string == other.string;
+        }
+
+    private:
+        const std::string* string = nullptr;
+
+        /**
+         * Returns the pooled copy of the given string, adding it to the pool if it isn't already there.
+         *
+         * @param value
+         *
+         * @return
+         */
+        static const std::string* intern(std::string_view value);
+    };
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <mutex>
+#include <new>
+
+namespace Bloom
+{
+    /**
+     * A pool of recycled memory blocks, for small objects that are allocated and freed at a high rate - typically on
+     * different threads (like TargetController commands, which are allocated by the issuing thread and freed by the
+     * TargetController).
+     *
+     * Freed blocks are retained in one of a number of size classes, and handed out again by subsequent allocations
+     * of the same size class. Once the pool has warmed up, allocations don't reach the heap. Each size class retains
+     * up to MAX_RETAINED_BLOCKS blocks - beyond that, freed blocks are returned to the heap. Allocations larger than
+     * the largest size class bypass the pool.
+     *
+     * Each class of objects should use its own pool, via the Tag parameter. To pool all instances of a class and its
+     * derived classes, define class-specific operator new and operator delete functions in the base class:
+     *
+     *  static void* operator new(std::size_t size) {
+     *      return MemoryPool<Base>::allocate(size);
+     *  }
+     *
+     *  static void operator delete(void* pointer, std::size_t size) {
+     *      MemoryPool<Base>::deallocate(pointer, size);
+     *  }
+     *
+     * The sized operator delete receives the size of the most derived class, as long as the base class has a virtual
+     * destructor.
+     *
+     * Retained blocks are never freed - they're reclaimed when the process exits.
+     *
+     * @tparam Tag
+     */
+    template<typename Tag>
+    class MemoryPool
+    {
+    public:
+        static constexpr std::size_t SIZE_CLASS_GRANULARITY = 32;
+        static constexpr std::size_t SIZE_CLASS_COUNT = 16;
+        static constexpr std::size_t MAX_BLOCK_SIZE = SIZE_CLASS_GRANULARITY * SIZE_CLASS_COUNT;
+        static constexpr std::size_t MAX_RETAINED_BLOCKS = 256;
+
+        /**
+         * Allocates a block of at least the given size, aligned for any fundamental type.
+         *
+         * @param size
+         *
+         * @throws std::bad_alloc
+         *  If the pool is empty and the heap allocation fails.
+         *
+         * @return
+         */
+        static void* allocate(std::size_t size) {
+            if (size == 0 || size > MemoryPool::MAX_BLOCK_SIZE) {
+                return ::operator new(size);
+            }
+
+            const auto sizeClassIndex = MemoryPool::sizeClassIndex(size);
+            auto& sizeClass = MemoryPool::sizeClasses[sizeClassIndex];
+
+            {
+                const auto lock = std::unique_lock(sizeClass.mutex);
+
+                if (sizeClass.head != nullptr) {
+                    auto* block = sizeClass.head;
+                    sizeClass.head = block->next;
+                    --sizeClass.blockCount;
+                    return block;
+                }
+            }
+
+            return ::operator new((sizeClassIndex + 1) * MemoryPool::SIZE_CLASS_GRANULARITY);
+        }
+
+        /**
+         * Returns a block to the pool.
+         *
+         * @param pointer
+         *
+         * @param size
+         *  Must be the size given to the MemoryPool::allocate() call that allocated the block.
+         */
+        static void deallocate(void* pointer, std::size_t size) noexcept {
+            if (pointer == nullptr) {
+                return;
+            }
+
+            if (size == 0 || size > MemoryPool::MAX_BLOCK_SIZE) {
+                ::operator delete(pointer);
+                return;
+            }
+
+            auto& sizeClass = MemoryPool::sizeClasses[MemoryPool::sizeClassIndex(size)];
+
+            {
+                const auto lock = std::unique_lock(sizeClass.mutex);
+
+                if (sizeClass.blockCount < MemoryPool::MAX_RETAINED_BLOCKS) {
+                    sizeClass.head = ::new (pointer) FreeBlock{sizeClass.head};
+                    ++sizeClass.blockCount;
+                    return;
+                }
+            }
+
+            ::operator delete(pointer);
+        }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next = nullptr;
+        };
+
+        struct SizeClass
+        {
+            std::mutex mutex;
+            FreeBlock* head = nullptr;
+            std::size_t blockCount = 0;
+        };
+
+        static inline std::array<SizeClass, SIZE_CLASS_COUNT> sizeClasses;
+
+        static constexpr std::size_t sizeClassIndex(std::size_t size) {
+            return (size - 1) / MemoryPool::SIZE_CLASS_GRANULARITY;
+        }
+    };
+
+    /**
+     * Standard allocator adapter for MemoryPool, for use with std::allocate_shared(), std::promise, etc.
+     *
+     * @tparam Type
+     * @tparam Tag
+     */
+    template<typename Type, typename Tag>
+    class MemoryPoolAllocator
+    {
+    public:
+        using value_type = Type;
+
+        template<typename OtherType>
+        struct rebind
+        {
+            using other = MemoryPoolAllocator<OtherType, Tag>;
+        };
+
+        MemoryPoolAllocator() = default;
+
+        template<typename OtherType>
+        MemoryPoolAllocator(const MemoryPoolAllocator<OtherType, Tag>&) noexcept {}
+
+        Type* allocate(std::size_t count) {
+            return static_cast<Type*>(MemoryPool<Tag>::allocate(count * sizeof(Type)));
+        }
+
+        void deallocate(Type* pointer, std::size_t count) noexcept {
+            MemoryPool<Tag>::deallocate(pointer, count * sizeof(Type));
+        }
+
+        template<typename OtherType>
+        bool operator == (const MemoryPoolAllocator<OtherType, Tag>&) const noexcept {
+            return true;
+        }
+    };
+}
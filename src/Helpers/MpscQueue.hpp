@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+
+#include "MemoryPool.hpp"
+
+namespace Bloom
+{
+    /**
+     * A lock-free, multi-producer single-consumer queue.
+     *
+     * Any number of threads can push items onto the queue, without taking a lock. A single consumer thread takes
+     * all queued items in one go, via MpscQueue::takeAll(), which returns them in the order in which they were pushed.
+     *
+     * Under the hood, this is an intrusive Treiber stack. Producers push nodes onto the head of the stack, with a CAS
+     * loop. The consumer detaches the entire stack with a single atomic exchange, and then reverses it. Because the
+     * consumer never removes individual nodes, the queue is not susceptible to the ABA problem.
+     *
+     * @tparam Type
+     */
+    template<typename Type>
+    class MpscQueue
+    {
+    public:
+        MpscQueue() = default;
+
+        MpscQueue(const MpscQueue& other) = delete;
+        MpscQueue(MpscQueue&& other) = delete;
+
+        MpscQueue& operator = (const MpscQueue& other) = delete;
+        MpscQueue& operator = (MpscQueue&& other) = delete;
+
+        ~MpscQueue() {
+            auto* node = this->head.exchange(nullptr, std::memory_order_acquire);
+
+            while (node != nullptr) {
+                auto* next = node->next;
+                delete node;
+                node = next;
+            }
+        }
+
+        /**
+         * Pushes an item onto the queue. Safe to call from any thread.
+         *
+         * @param item
+         */
+        void push(Type&& item) {
+            auto* node = new Node{std::move(item), this->head.load(std::memory_order_relaxed)};
+
+            while (!this->head.compare_exchange_weak(
+                node->next,
+                node,
+                std::memory_order_release,
+                std::memory_order_relaxed
+            )) {}
+        }
+
+        /**
+         * Takes all items currently in the queue. Must only be called from the consumer thread.
+         *
+         * @return
+         *  The items, in the order in which they were pushed.
+         */
+        std::vector<Type> takeAll() {
+            auto output = std::vector<Type>();
+            this->takeAll(output);
+            return output;
+        }
+
+        /**
+         * Takes all items currently in the queue, into the given vector. Must only be called from the consumer
+         * thread.
+         *
+         * This allows the consumer to reuse the same vector (and its capacity) for every call.
+         *
+         * @param output
+         *  Will be cleared, and then populated with the items, in the order in which they were pushed.
+         */
+        void takeAll(std::vector<Type>& output) {
+            auto* node = this->head.exchange(nullptr, std::memory_order_acquire);
+            output.clear();
+
+            while (node != nullptr) {
+                auto* next = node->next;
+                output.emplace_back(std::move(node->item));
+                delete node;
+                node = next;
+            }
+
+            // The stack is in LIFO order
+            std::reverse(output.begin(), output.end());
+        }
+
+    private:
+        struct Node
+        {
+            Type item;
+            Node* next = nullptr;
+
+            // Nodes are recycled via a pool, as one is allocated for every push
+            static void* operator new(std::size_t size) {
+                return MemoryPool<Node>::allocate(size);
+            }
+
+            static void operator delete(void* pointer, std::size_t size) {
+                MemoryPool<Node>::deallocate(pointer, size);
+            }
+        };
+
+        std::atomic<Node*> head = nullptr;
+    };
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <span>
+#include <cstddef>
+#include <algorithm>
+#include <cassert>
+
+namespace Bloom
+{
+    /**
+     * A lock-free, single-producer single-consumer ring buffer, of fixed capacity.
+     *
+     * One thread pushes items, and one (other) thread pops them. Neither thread ever blocks or allocates. When the
+     * buffer is full, new items are rejected (SpscRingBuffer::push() returns false) - it's up to the producer to
+     * account for the dropped items.
+     *
+     * The read and write indices increase monotonically, and are reduced to buffer positions via a mask, which is why
+     * the capacity must be a power of two. Each index is only ever written by one side, and they're kept on separate
+     * cache lines, to prevent the producer and consumer from contending for the same line.
+     *
+     * @tparam Type
+     */
+    template<typename Type>
+    class SpscRingBuffer
+    {
+    public:
+        /**
+         * @param capacity
+         *  Must be a power of two.
+         */
+        explicit SpscRingBuffer(std::size_t capacity)
+            : items(capacity)
+            , mask(capacity - 1)
+        {
+            assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+        }
+
+        SpscRingBuffer(const SpscRingBuffer& other) = delete;
+        SpscRingBuffer(SpscRingBuffer&& other) = delete;
+
+        SpscRingBuffer& operator = (const SpscRingBuffer& other) = delete;
+        SpscRingBuffer& operator = (SpscRingBuffer&& other) = delete;
+
+        /**
+         * Pushes an item into the buffer. Must only be called from the producer thread.
+         *
+         * @param item
+         *
+         * @return
+         *  False if the buffer was full, in which case the item is discarded.
+         */
+        bool push(const Type& item) {
+            const auto writeIndex = this->writeIndex.load(std::memory_order_relaxed);
+
+            if (writeIndex - this->readIndex.load(std::memory_order_acquire) >= this->items.size()) {
+                return false;
+            }
+
+            this->items[writeIndex & this->mask] = item;
+            this->writeIndex.store(writeIndex + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Pops as many items as are available (up to the size of the output buffer). Must only be called from the
+         * consumer thread.
+         *
+         * @param output
+         *
+         * @return
+         *  The number of items popped into the output buffer.
+         */
+        std::size_t pop(std::span<Type> output) {
+            const auto readIndex = this->readIndex.load(std::memory_order_relaxed);
+            const auto available = this->writeIndex.load(std::memory_order_acquire) - readIndex;
+            const auto count = std::min(available, output.size());
+
+            for (auto i = std::size_t(0); i < count; ++i) {
+                output[i] = this->items[(readIndex + i) & this->mask];
+            }
+
+            this->readIndex.store(readIndex + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * The number of items in the buffer. This is only a snapshot - the buffer may be modified by the other side
+         * at any time.
+         *
+         * @return
+         */
+        [[nodiscard]] std::size_t size() const {
+            return this->writeIndex.load(std::memory_order_acquire) - this->readIndex.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] std::size_t capacity() const {
+            return this->items.size();
+        }
+
+    private:
+        static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+        std::vector<Type> items;
+        std::size_t mask;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> writeIndex = 0;
+        alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> readIndex = 0;
+    };
+}
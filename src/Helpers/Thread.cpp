@@ -0,0 +1,51 @@
+#include "Thread.hpp"
+
+#include <cstring>
+#include <cerrno>
+
+#include "src/ProjectConfig.hpp"
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom
+{
+    void Thread::applySchedulingConfig(const ThreadSchedulingConfig& config, const std::string& threadLabel) {
+        if (!config.cpuAffinity.empty()) {
+            if (this->setCpuAffinity(config.cpuAffinity)) {
+                auto cpuList = std::string();
+                for (const auto cpuIndex : config.cpuAffinity) {
+                    cpuList += (cpuList.empty() ? "" : ", ") + std::to_string(cpuIndex);
+                }
+
+                Logger::debug(threadLabel + " pinned to CPU(s) " + cpuList);
+
+            } else {
+                Logger::warning(
+                    "Failed to apply " + threadLabel + " CPU affinity - check that the given CPUs are available"
+                );
+            }
+        }
+
+        if (config.realtimePriority.has_value()) {
+            if (this->setRealtimePriority(*(config.realtimePriority))) {
+                Logger::debug(
+                    threadLabel + " running with real-time priority " + std::to_string(*(config.realtimePriority))
+                );
+                return;
+            }
+
+            Logger::warning(
+                "Failed to apply real-time scheduling to the " + threadLabel + " - the CAP_SYS_NICE capability, or "
+                    "a sufficient RLIMIT_RTPRIO limit, is required"
+            );
+        }
+
+        if (config.niceValue.has_value()) {
+            if (this->setNiceValue(*(config.niceValue))) {
+                Logger::debug(threadLabel + " nice value set to " + std::to_string(*(config.niceValue)));
+
+            } else {
+                Logger::warning("Failed to set " + threadLabel + " nice value - " + std::string(strerror(errno)));
+            }
+        }
+    }
+}
@@ -2,11 +2,20 @@
 
 #include <csignal>
 #include <cassert>
+#include <string>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
 
 #include "SyncSafe.hpp"
 
 namespace Bloom
 {
+    struct ThreadSchedulingConfig;
+
     enum class ThreadState
     {
         UNINITIALISED,
@@ -54,6 +63,70 @@ namespace Bloom
             pthread_setname_np(pthread_self(), name.c_str());
         }
 
+        /**
+         * Moves the current thread to the SCHED_FIFO real-time scheduling policy, with the given priority.
+         *
+         * @param priority
+         *
+         * @return
+         *  False if the policy could not be applied - typically as a result of insufficient privileges.
+         */
+        bool setRealtimePriority(int priority) {
+            auto parameters = sched_param{};
+            parameters.sched_priority = priority;
+
+            return pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters) == 0;
+        }
+
+        /**
+         * Sets the nice value of the current thread.
+         *
+         * On Linux, the nice value is a per-thread attribute, so this has no effect on the rest of the process.
+         *
+         * @param niceValue
+         *
+         * @return
+         *  False if the nice value could not be applied. Lowering a thread's nice value requires privileges.
+         */
+        bool setNiceValue(int niceValue) {
+            return setpriority(PRIO_PROCESS, static_cast<id_t>(::syscall(SYS_gettid)), niceValue) == 0;
+        }
+
+        /**
+         * Restricts the current thread to the given CPUs.
+         *
+         * @param cpuIndices
+         *
+         * @return
+         *  False if the affinity could not be applied (e.g. none of the given CPUs are available).
+         */
+        bool setCpuAffinity(const std::vector<unsigned int>& cpuIndices) {
+            auto cpuSet = cpu_set_t{};
+            CPU_ZERO(&cpuSet);
+
+            for (const auto cpuIndex : cpuIndices) {
+                if (cpuIndex >= CPU_SETSIZE) {
+                    return false;
+                }
+
+                CPU_SET(cpuIndex, &cpuSet);
+            }
+
+            return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+        }
+
+        /**
+         * Applies the user's scheduling parameters to the current thread.
+         *
+         * Failing to apply any of the parameters is not fatal - we just log a warning and carry on with the default
+         * scheduling. A nice value is only applied if no real-time priority was given, or it couldn't be applied.
+         *
+         * @param config
+         * @param threadLabel
+         *  Used in log messages - e.g. "TargetController thread".
+         */
+        void applySchedulingConfig(const ThreadSchedulingConfig& config, const std::string& threadLabel);
+
     private:
         SyncSafe<ThreadState> state = SyncSafe<ThreadState>(ThreadState::UNINITIALISED);
     };
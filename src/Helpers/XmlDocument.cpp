@@ -0,0 +1,390 @@
+#include "XmlDocument.hpp"
+
+#include <algorithm>
+#include <charconv>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom
+{
+    using Exceptions::Exception;
+
+    namespace
+    {
+        bool isWhitespace(char character) {
+            return character == ' ' || character == '\t' || character == '\n' || character == '\r';
+        }
+
+        bool isNameCharacter(char character) {
+            return (character >= 'a' && character <= 'z')
+                || (character >= 'A' && character <= 'Z')
+                || (character >= '0' && character <= '9')
+                || character == '-'
+                || character == '_'
+                || character == '.'
+                || character == ':'
+                || static_cast<unsigned char>(character) >= 0x80;
+        }
+
+        void appendUtf8(std::string& output, std::uint32_t codePoint) {
+            if (codePoint < 0x80) {
+                output.push_back(static_cast<char>(codePoint));
+
+            } else if (codePoint < 0x800) {
+                output.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+
+            } else if (codePoint < 0x10000) {
+                output.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+
+            } else {
+                output.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                output.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+        }
+    }
+
+    std::string_view XmlDocument::Element::name() const {
+        return this->document != nullptr ? this->document->nodes[this->index].name : std::string_view();
+    }
+
+    bool XmlDocument::Element::hasAttribute(std::string_view name) const {
+        return this->document != nullptr && this->document->findAttribute(this->index, name) != nullptr;
+    }
+
+    std::optional<std::string> XmlDocument::Element::attribute(std::string_view name) const {
+        const auto* attribute = this->document != nullptr
+            ? this->document->findAttribute(this->index, name)
+            : nullptr;
+
+        if (attribute == nullptr) {
+            return std::nullopt;
+        }
+
+        return XmlDocument::decodeEntities(attribute->rawValue);
+    }
+
+    std::string XmlDocument::Element::attributeOrEmpty(std::string_view name) const {
+        return this->attribute(name).value_or(std::string());
+    }
+
+    XmlDocument::Element XmlDocument::Element::firstDescendant(std::string_view name) const {
+        if (this->document == nullptr) {
+            return Element();
+        }
+
+        const auto& nodes = this->document->nodes;
+
+        for (auto nodeIndex = this->index + 1; nodeIndex < nodes[this->index].endIndex; ++nodeIndex) {
+            if (nodes[nodeIndex].name == name) {
+                return Element(this->document, nodeIndex);
+            }
+        }
+
+        return Element();
+    }
+
+    std::vector<XmlDocument::Element> XmlDocument::Element::descendants(std::string_view name) const {
+        auto output = std::vector<Element>();
+
+        if (this->document == nullptr) {
+            return output;
+        }
+
+        const auto& nodes = this->document->nodes;
+
+        for (auto nodeIndex = this->index + 1; nodeIndex < nodes[this->index].endIndex; ++nodeIndex) {
+            if (nodes[nodeIndex].name == name) {
+                output.emplace_back(Element(this->document, nodeIndex));
+            }
+        }
+
+        return output;
+    }
+
+    XmlDocument::XmlDocument(std::string content)
+        : content(std::move(content))
+    {
+        this->parse();
+    }
+
+    void XmlDocument::parse() {
+        const auto content = std::string_view(this->content);
+        auto position = std::size_t(0);
+
+        const auto fail = [&position] (const std::string& message) {
+            throw Exception("Malformed XML at offset " + std::to_string(position) + " - " + message);
+        };
+
+        const auto skipPast = [&content, &position, &fail] (std::string_view terminator) {
+            const auto terminatorPosition = content.find(terminator, position);
+
+            if (terminatorPosition == std::string_view::npos) {
+                fail("unterminated markup");
+            }
+
+            position = terminatorPosition + terminator.size();
+        };
+
+        const auto skipWhitespace = [&content, &position] {
+            while (position < content.size() && isWhitespace(content[position])) {
+                ++position;
+            }
+        };
+
+        const auto readName = [&content, &position, &fail] {
+            const auto start = position;
+
+            while (position < content.size() && isNameCharacter(content[position])) {
+                ++position;
+            }
+
+            if (position == start) {
+                fail("expected a name");
+            }
+
+            return content.substr(start, position - start);
+        };
+
+        /*
+         * Every element and attribute is preceded by a '<' or followed by a '=', respectively, so counting those
+         * gives us an upper bound, allowing us to allocate all the storage we need upfront.
+         */
+        this->nodes.reserve(static_cast<std::size_t>(std::count(content.begin(), content.end(), '<')) + 1);
+        this->attributes.reserve(static_cast<std::size_t>(std::count(content.begin(), content.end(), '=')));
+
+        // The document node
+        this->nodes.emplace_back();
+
+        auto openNodeIndices = std::vector<std::uint32_t>({0});
+
+        while ((position = content.find('<', position)) != std::string_view::npos) {
+            const auto markup = content.substr(position);
+
+            if (markup.starts_with("<!--")) {
+                skipPast("-->");
+                continue;
+            }
+
+            if (markup.starts_with("<![CDATA[")) {
+                skipPast("]]>");
+                continue;
+            }
+
+            if (markup.starts_with("<?")) {
+                skipPast("?>");
+                continue;
+            }
+
+            if (markup.starts_with("<!")) {
+                // Document type declaration - which may contain an internal subset, in square brackets
+                auto bracketDepth = 0;
+
+                for (++position; position < content.size(); ++position) {
+                    const auto character = content[position];
+
+                    if (character == '[') {
+                        ++bracketDepth;
+
+                    } else if (character == ']') {
+                        --bracketDepth;
+
+                    } else if (character == '>' && bracketDepth <= 0) {
+                        break;
+                    }
+                }
+
+                if (position >= content.size()) {
+                    fail("unterminated document type declaration");
+                }
+
+                ++position;
+                continue;
+            }
+
+            if (markup.starts_with("</")) {
+                position += 2;
+                const auto name = readName();
+                skipWhitespace();
+
+                if (position >= content.size() || content[position] != '>') {
+                    fail("expected '>'");
+                }
+
+                ++position;
+
+                if (openNodeIndices.size() < 2 || this->nodes[openNodeIndices.back()].name != name) {
+                    fail("unexpected closing tag </" + std::string(name) + ">");
+                }
+
+                this->nodes[openNodeIndices.back()].endIndex = static_cast<std::uint32_t>(this->nodes.size());
+                openNodeIndices.pop_back();
+                continue;
+            }
+
+            ++position;
+
+            const auto nodeIndex = static_cast<std::uint32_t>(this->nodes.size());
+            auto& node = this->nodes.emplace_back();
+            node.name = readName();
+            node.firstAttributeIndex = static_cast<std::uint32_t>(this->attributes.size());
+
+            while (true) {
+                skipWhitespace();
+
+                if (position >= content.size()) {
+                    fail("unterminated start tag");
+                }
+
+                if (content[position] == '>') {
+                    ++position;
+                    openNodeIndices.push_back(nodeIndex);
+                    break;
+                }
+
+                if (content[position] == '/') {
+                    if (position + 1 >= content.size() || content[position + 1] != '>') {
+                        fail("expected '>'");
+                    }
+
+                    position += 2;
+                    node.endIndex = nodeIndex + 1;
+                    break;
+                }
+
+                const auto attributeName = readName();
+                skipWhitespace();
+
+                if (position >= content.size() || content[position] != '=') {
+                    fail("expected '='");
+                }
+
+                ++position;
+                skipWhitespace();
+
+                if (position >= content.size() || (content[position] != '"' && content[position] != '\'')) {
+                    fail("expected a quoted attribute value");
+                }
+
+                const auto quote = content[position++];
+                const auto valueEnd = content.find(quote, position);
+
+                if (valueEnd == std::string_view::npos) {
+                    fail("unterminated attribute value");
+                }
+
+                this->attributes.emplace_back(Attribute{
+                    .name = attributeName,
+                    .rawValue = content.substr(position, valueEnd - position),
+                });
+
+                position = valueEnd + 1;
+                ++node.attributeCount;
+            }
+        }
+
+        if (openNodeIndices.size() > 1) {
+            fail("unclosed element <" + std::string(this->nodes[openNodeIndices.back()].name) + ">");
+        }
+
+        if (this->nodes.size() < 2) {
+            throw Exception("Malformed XML - no root element");
+        }
+
+        this->nodes.front().endIndex = static_cast<std::uint32_t>(this->nodes.size());
+    }
+
+    const XmlDocument::Attribute* XmlDocument::findAttribute(std::uint32_t nodeIndex, std::string_view name) const {
+        const auto& node = this->nodes[nodeIndex];
+        const auto attributesEnd = node.firstAttributeIndex + node.attributeCount;
+
+        for (auto attributeIndex = node.firstAttributeIndex; attributeIndex < attributesEnd; ++attributeIndex) {
+            if (this->attributes[attributeIndex].name == name) {
+                return &(this->attributes[attributeIndex]);
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::string XmlDocument::decodeEntities(std::string_view rawValue) {
+        auto referencePosition = rawValue.find('&');
+
+        if (referencePosition == std::string_view::npos) {
+            return std::string(rawValue);
+        }
+
+        auto output = std::string();
+        output.reserve(rawValue.size());
+
+        auto position = std::size_t(0);
+
+        while (referencePosition != std::string_view::npos) {
+            output.append(rawValue.substr(position, referencePosition - position));
+
+            const auto referenceEnd = rawValue.find(';', referencePosition);
+
+            if (referenceEnd == std::string_view::npos) {
+                // Not a reference - just a stray ampersand
+                position = referencePosition;
+                break;
+            }
+
+            const auto entity = rawValue.substr(referencePosition + 1, referenceEnd - referencePosition - 1);
+            position = referenceEnd + 1;
+
+            if (entity == "lt") {
+                output.push_back('<');
+
+            } else if (entity == "gt") {
+                output.push_back('>');
+
+            } else if (entity == "amp") {
+                output.push_back('&');
+
+            } else if (entity == "quot") {
+                output.push_back('"');
+
+            } else if (entity == "apos") {
+                output.push_back('\'');
+
+            } else if (entity.starts_with('#')) {
+                const auto hex = entity.starts_with("#x") || entity.starts_with("#X");
+                const auto digits = entity.substr(hex ? 2 : 1);
+
+                auto codePoint = std::uint32_t(0);
+                const auto result = std::from_chars(
+                    digits.data(),
+                    digits.data() + digits.size(),
+                    codePoint,
+                    hex ? 16 : 10
+                );
+
+                if (
+                    digits.empty()
+                    || result.ec != std::errc()
+                    || result.ptr != digits.data() + digits.size()
+                    || codePoint > 0x10FFFF
+                ) {
+                    output.append(rawValue.substr(referencePosition, position - referencePosition));
+
+                } else {
+                    appendUtf8(output, codePoint);
+                }
+
+            } else {
+                // Unknown entity - leave it as is
+                output.append(rawValue.substr(referencePosition, position - referencePosition));
+            }
+
+            referencePosition = rawValue.find('&', position);
+        }
+
+        output.append(rawValue.substr(position));
+        return output;
+    }
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+
+namespace Bloom
+{
+    /**
+     * A minimal, read-only XML document, for parsing the XML files that Bloom ships with (TDFs).
+     *
+     * The document is parsed in situ, in a single pass. Element and attribute names, and raw attribute values, are
+     * held as views into the document's content, and all elements are stored in one flat vector, in document order.
+     * So parsing a document costs two vector allocations (elements and attributes), regardless of its size. Entity
+     * references in attribute values are only decoded when the value is requested.
+     *
+     * Only elements and attributes are retained - text, comments, CDATA sections, processing instructions and the
+     * document type declaration are skipped. Namespaces are not interpreted.
+     */
+    class XmlDocument
+    {
+    public:
+        /**
+         * A handle to an element in the document. Handles are only valid for as long as the document is alive.
+         */
+        class Element
+        {
+        public:
+            /**
+             * Returns false if this handle doesn't refer to an element (e.g. if it was returned by
+             * Element::firstDescendant() and no matching element was found).
+             *
+             * @return
+             */
+            [[nodiscard]] bool isElement() const {
+                return this->document != nullptr;
+            }
+
+            [[nodiscard]] std::string_view name() const;
+
+            [[nodiscard]] bool hasAttribute(std::string_view name) const;
+
+            /**
+             * Returns the value of the given attribute, with any entity references decoded.
+             *
+             * @param name
+             *
+             * @return
+             *  std::nullopt if the element has no such attribute.
+             */
+            [[nodiscard]] std::optional<std::string> attribute(std::string_view name) const;
+
+            /**
+             * Returns the value of the given attribute, or an empty string if the element has no such attribute.
+             *
+             * @param name
+             *
+             * @return
+             */
+            [[nodiscard]] std::string attributeOrEmpty(std::string_view name) const;
+
+            /**
+             * Returns the first element (in document order) with the given name, at any depth below this element.
+             *
+             * @param name
+             *
+             * @return
+             *  An invalid handle (see Element::isElement()) if there is no such element.
+             */
+            [[nodiscard]] Element firstDescendant(std::string_view name) const;
+
+            /**
+             * Returns all elements with the given name, at any depth below this element, in document order.
+             *
+             * Equivalent to QDomElement::elementsByTagName().
+             *
+             * @param name
+             *
+             * @return
+             */
+            [[nodiscard]] std::vector<Element> descendants(std::string_view name) const;
+
+        private:
+            friend class XmlDocument;
+
+            const XmlDocument* document = nullptr;
+            std::uint32_t index = 0;
+
+            Element() = default;
+            Element(const XmlDocument* document, std::uint32_t index)
+                : document(document)
+                , index(index)
+            {}
+        };
+
+        /**
+         * Parses the given XML.
+         *
+         * @param content
+         *
+         * @throws Exceptions::Exception
+         *  If the XML is malformed.
+         */
+        explicit XmlDocument(std::string content);
+
+        /*
+         * Elements hold views into the document's content, so the document cannot be copied or moved.
+         */
+        XmlDocument(const XmlDocument& other) = delete;
+        XmlDocument(XmlDocument&& other) = delete;
+        XmlDocument& operator = (const XmlDocument& other) = delete;
+        XmlDocument& operator = (XmlDocument&& other) = delete;
+
+        /**
+         * Returns a handle to the document node - the (nameless) parent of the document's root element.
+         *
+         * @return
+         */
+        [[nodiscard]] Element document() const {
+            return Element(this, 0);
+        }
+
+    private:
+        struct Node
+        {
+            std::string_view name;
+            std::uint32_t firstAttributeIndex = 0;
+            std::uint32_t attributeCount = 0;
+
+            /**
+             * The index of the first node that follows this node's last descendant.
+             */
+            std::uint32_t endIndex = 0;
+        };
+
+        struct Attribute
+        {
+            std::string_view name;
+
+            /**
+             * The value as it appears in the document, without the quotes. Entity references aren't decoded.
+             */
+            std::string_view rawValue;
+        };
+
+        std::string content;
+        std::vector<Node> nodes;
+        std::vector<Attribute> attributes;
+
+        void parse();
+
+        [[nodiscard]] const Attribute* findAttribute(std::uint32_t nodeIndex, std::string_view name) const;
+
+        static std::string decodeEntities(std::string_view rawValue);
+    };
+}
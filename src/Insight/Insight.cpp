@@ -8,8 +8,11 @@
 #include <QUrl>
 #include <QUrlQuery>
 #include <QJsonDocument>
+#include <QThread>
+#include <algorithm>
 
 #include "src/Services/PathService.hpp"
+#include "src/Services/StartupProfilingService.hpp"
 #include "src/Logger/Logger.hpp"
 #include "UserInterfaces/InsightWindow/BloomProxyStyle.hpp"
 
@@ -28,13 +31,14 @@ namespace Bloom
         const ProjectConfig& projectConfig,
         const EnvironmentConfig& environmentConfig,
         const InsightConfig& insightConfig,
-        InsightProjectSettings& insightProjectSettings
+        ProjectSettings& projectSettings
     )
         : eventListener(eventListener)
         , projectConfig(projectConfig)
         , environmentConfig(environmentConfig)
         , insightConfig(insightConfig)
-        , insightProjectSettings(insightProjectSettings)
+        , projectSettings(projectSettings)
+        , insightProjectSettings(projectSettings.insightSettings())
         , application(
             (
                 QCoreApplication::setAttribute(Qt::AA_ShareOpenGLContexts, true),
@@ -44,64 +48,12 @@ namespace Bloom
                 QApplication(this->qtApplicationArgc, this->qtApplicationArgv.data())
             )
         )
-    {}
-
-    void Insight::run() {
-        try {
-            this->startup();
-
-            this->setThreadState(ThreadState::READY);
-            Logger::info("Insight ready");
-            this->application.exec();
-
-        } catch (const Exception& exception) {
-            Logger::error("Insight encountered a fatal error. See below for errors:");
-            Logger::error(exception.getMessage());
-
-        } catch (const std::exception& exception) {
-            Logger::error("Insight encountered a fatal error. See below for errors:");
-            Logger::error(std::string(exception.what()));
-        }
-
-        this->shutdown();
-    }
-
-    void Insight::startup() {
-        Logger::info("Starting Insight");
-        this->setThreadState(ThreadState::STARTING);
-
-        this->eventListener.registerCallbackForEventType<Events::TargetControllerStateChanged>(
-            std::bind(&Insight::onTargetControllerStateChangedEvent, this, std::placeholders::_1)
-        );
-
-        this->eventListener.registerCallbackForEventType<Events::TargetExecutionStopped>(
-            std::bind(&Insight::onTargetStoppedEvent, this, std::placeholders::_1)
-        );
-
-        this->eventListener.registerCallbackForEventType<Events::TargetExecutionResumed>(
-            std::bind(&Insight::onTargetResumedEvent, this, std::placeholders::_1)
-        );
-
-        this->eventListener.registerCallbackForEventType<Events::TargetReset>(
-            std::bind(&Insight::onTargetResetEvent, this, std::placeholders::_1)
-        );
-
-        this->eventListener.registerCallbackForEventType<Events::RegistersWrittenToTarget>(
-            std::bind(&Insight::onTargetRegistersWrittenEvent, this, std::placeholders::_1)
-        );
-
-        this->eventListener.registerCallbackForEventType<Events::MemoryWrittenToTarget>(
-            std::bind(&Insight::onTargetMemoryWrittenEvent, this, std::placeholders::_1)
-        );
-
-        this->eventListener.registerCallbackForEventType<Events::ProgrammingModeEnabled>(
-            std::bind(&Insight::onProgrammingModeEnabledEvent, this, std::placeholders::_1)
-        );
-
-        this->eventListener.registerCallbackForEventType<Events::ProgrammingModeDisabled>(
-            std::bind(&Insight::onProgrammingModeDisabledEvent, this, std::placeholders::_1)
-        );
-
+    {
+        /*
+         * Insight is constructed whilst the TargetController is acquiring the hardware (see Application::startup()),
+         * so we load our resources here, as opposed to in Insight::startup(), to get them out of the way in the
+         * meantime.
+         */
         QApplication::setQuitOnLastWindowClosed(true);
         QApplication::setStyle(new BloomProxyStyle());
 
@@ -121,6 +73,7 @@ namespace Bloom
         qRegisterMetaType<Bloom::Targets::TargetPinDescriptor>();
         qRegisterMetaType<Bloom::Targets::TargetPinState>();
         qRegisterMetaType<Bloom::Targets::TargetState>();
+        qRegisterMetaType<Bloom::Targets::SharedTargetMemoryBuffer>();
         qRegisterMetaType<std::map<int, Bloom::Targets::TargetPinState>>();
 
         // Load Ubuntu fonts
@@ -166,6 +119,80 @@ namespace Bloom
         QFontDatabase::addApplicationFont(
             QString::fromStdString(Services::PathService::resourcesDirPath() + "/fonts/Ubuntu/Ubuntu-Th.ttf")
         );
+    }
+
+    void Insight::run() {
+        try {
+            this->startup();
+
+            this->setThreadState(ThreadState::READY);
+            Logger::info("Insight ready");
+            Services::StartupProfilingService::complete();
+
+            this->application.exec();
+
+        } catch (const Exception& exception) {
+            Logger::error("Insight encountered a fatal error. See below for errors:");
+            Logger::error(exception.getMessage());
+
+        } catch (const std::exception& exception) {
+            Logger::error("Insight encountered a fatal error. See below for errors:");
+            Logger::error(std::string(exception.what()));
+        }
+
+        this->shutdown();
+    }
+
+    void Insight::startup() {
+        const auto startupPhase = Services::StartupProfilingService::ScopedPhase("Insight startup");
+        Logger::info("Starting Insight");
+        this->setThreadState(ThreadState::STARTING);
+
+        /*
+         * This must be done before the Insight workers are started, as their threads inherit the scheduling
+         * parameters.
+         */
+        this->applySchedulingConfig(this->insightConfig.schedulingConfig, "Insight threads");
+
+        this->eventListener.registerCallbackForEventType<Events::TargetControllerStateChanged>(
+            std::bind(&Insight::onTargetControllerStateChangedEvent, this, std::placeholders::_1)
+        );
+
+        this->eventListener.registerCallbackForEventType<Events::TargetExecutionStopped>(
+            std::bind(&Insight::onTargetStoppedEvent, this, std::placeholders::_1)
+        );
+
+        this->eventListener.registerCallbackForEventType<Events::TargetExecutionResumed>(
+            std::bind(&Insight::onTargetResumedEvent, this, std::placeholders::_1)
+        );
+
+        this->eventListener.registerCallbackForEventType<Events::TargetReset>(
+            std::bind(&Insight::onTargetResetEvent, this, std::placeholders::_1)
+        );
+
+        this->eventListener.registerCallbackForEventType<Events::RegistersWrittenToTarget>(
+            std::bind(&Insight::onTargetRegistersWrittenEvent, this, std::placeholders::_1)
+        );
+
+        this->eventListener.registerCallbackForEventType<Events::MemoryWrittenToTarget>(
+            std::bind(&Insight::onTargetMemoryWrittenEvent, this, std::placeholders::_1)
+        );
+
+        this->eventListener.registerCallbackForEventType<Events::TargetPinStatesChanged>(
+            std::bind(&Insight::onTargetPinStatesChangedEvent, this, std::placeholders::_1)
+        );
+
+        this->eventListener.registerCallbackForEventType<Events::ProgrammingModeEnabled>(
+            std::bind(&Insight::onProgrammingModeEnabledEvent, this, std::placeholders::_1)
+        );
+
+        this->eventListener.registerCallbackForEventType<Events::ProgrammingModeDisabled>(
+            std::bind(&Insight::onProgrammingModeDisabledEvent, this, std::placeholders::_1)
+        );
+
+        this->eventListener.registerCallbackForEventType<Events::TimingAnalysisCompleted>(
+            std::bind(&Insight::onTimingAnalysisCompletedEvent, this, std::placeholders::_1)
+        );
 
         /*
          * We can't run our own event loop here - we have to use Qt's event loop. But we still need to be able to
@@ -177,6 +204,17 @@ namespace Bloom
         QObject::connect(eventDispatchTimer, &QTimer::timeout, this, &Insight::dispatchEvents);
         eventDispatchTimer->start(100);
 
+        /*
+         * Save the project settings periodically, so that the user's window state isn't lost if Bloom doesn't get
+         * the chance to shut down cleanly. Unchanged settings aren't written, and the writing is done off the GUI
+         * thread (see ProjectSettingsService).
+         */
+        auto* settingsSaveTimer = new QTimer(&(this->application));
+        QObject::connect(settingsSaveTimer, &QTimer::timeout, this, [this] {
+            Services::ProjectSettingsService::save(this->projectSettings);
+        });
+        settingsSaveTimer->start(Insight::PROJECT_SETTINGS_SAVE_INTERVAL);
+
         QObject::connect(
             this->mainWindow,
             &InsightWindow::activatedSignal,
@@ -187,9 +225,20 @@ namespace Bloom
         this->mainWindow->setInsightConfig(this->insightConfig);
         this->mainWindow->setEnvironmentConfig(this->environmentConfig);
 
-        // Construct and start worker threads
-        for (std::uint8_t i = 0; i < Insight::INSIGHT_WORKER_COUNT; ++i) {
-            auto* insightWorker = new InsightWorker();
+        /*
+         * Construct and start worker threads - a single worker for tasks that use the TargetController (the
+         * TargetController processes one command at a time anyway), and a pool of workers for everything else.
+         */
+        const auto generalWorkerCount = std::clamp(
+            QThread::idealThreadCount() - 1,
+            static_cast<int>(Insight::MIN_GENERAL_INSIGHT_WORKER_COUNT),
+            static_cast<int>(Insight::MAX_GENERAL_INSIGHT_WORKER_COUNT)
+        );
+
+        for (auto i = 0; i < generalWorkerCount + 1; ++i) {
+            auto* insightWorker = new InsightWorker(
+                i == 0 ? InsightWorkerLane::TARGET_CONTROLLER : InsightWorkerLane::GENERAL
+            );
             auto* workerThread = new QThread();
 
             workerThread->setObjectName("IW" + QString::number(insightWorker->id));
@@ -206,8 +255,15 @@ namespace Bloom
 
         this->checkBloomVersion();
 
-        this->mainWindow->init(this->targetControllerService.getTargetDescriptor());
-        this->mainWindow->show();
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Construct Insight window");
+            this->mainWindow->init(*(this->targetControllerService.getTargetDescriptor(true)));
+        }
+
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Show Insight window");
+            this->mainWindow->show();
+        }
     }
 
     void Insight::shutdown() {
@@ -335,16 +391,20 @@ namespace Bloom
     }
 
     void Insight::onTargetRegistersWrittenEvent(const Events::RegistersWrittenToTarget& event) {
-        emit this->insightSignals->targetRegistersWritten(event.registers, event.createdTimestamp);
+        this->insightSignals->publishTargetRegistersWritten(event.registers, event.createdTimestamp);
     }
 
     void Insight::onTargetMemoryWrittenEvent(const Events::MemoryWrittenToTarget& event) {
-        emit this->insightSignals->targetMemoryWritten(
+        this->insightSignals->publishTargetMemoryWritten(
             event.memoryType,
             Targets::TargetMemoryAddressRange(event.startAddress, event.startAddress + (event.size - 1))
         );
     }
 
+    void Insight::onTargetPinStatesChangedEvent(const Events::TargetPinStatesChanged& event) {
+        emit this->insightSignals->targetPinStatesChanged(event.variantId, event.pinStatesByNumber);
+    }
+
     void Insight::onTargetControllerStateChangedEvent(const Events::TargetControllerStateChanged& event) {
         using TargetController::TargetControllerState;
 
@@ -379,4 +439,8 @@ namespace Bloom
     void Insight::onProgrammingModeDisabledEvent(const Events::ProgrammingModeDisabled& event) {
         emit this->insightSignals->programmingModeDisabled();
     }
+
+    void Insight::onTimingAnalysisCompletedEvent(const Events::TimingAnalysisCompleted& event) {
+        emit this->insightSignals->timingAnalysisCompleted(QString::fromStdString(event.results.summary()));
+    }
 }
@@ -5,11 +5,13 @@
 #include <cstdint>
 #include <map>
 #include <utility>
+#include <chrono>
 #include <QThread>
 #include <QTimer>
 
 #include "src/Helpers/Thread.hpp"
 #include "src/Services/PathService.hpp"
+#include "src/Services/ProjectSettingsService.hpp"
 #include "src/ProjectConfig.hpp"
 #include "src/ProjectSettings.hpp"
 
@@ -53,7 +55,7 @@ namespace Bloom
             const ProjectConfig& projectConfig,
             const EnvironmentConfig& environmentConfig,
             const InsightConfig& insightConfig,
-            InsightProjectSettings& insightProjectSettings
+            ProjectSettings& projectSettings
         );
 
         /**
@@ -67,7 +69,9 @@ namespace Bloom
         void shutdown();
 
     private:
-        static constexpr std::uint8_t INSIGHT_WORKER_COUNT = 3;
+        static constexpr std::uint8_t MIN_GENERAL_INSIGHT_WORKER_COUNT = 2;
+        static constexpr std::uint8_t MAX_GENERAL_INSIGHT_WORKER_COUNT = 4;
+        static constexpr auto PROJECT_SETTINGS_SAVE_INTERVAL = std::chrono::seconds(10);
         std::string qtApplicationName = "Bloom";
         std::array<char*, 1> qtApplicationArgv = {this->qtApplicationName.data()};
         int qtApplicationArgc = 1;
@@ -76,6 +80,7 @@ namespace Bloom
         EnvironmentConfig environmentConfig;
         InsightConfig insightConfig;
 
+        ProjectSettings& projectSettings;
         InsightProjectSettings& insightProjectSettings;
 
         EventListener& eventListener;
@@ -124,8 +129,10 @@ namespace Bloom
         void onTargetResetEvent(const Events::TargetReset& event);
         void onTargetRegistersWrittenEvent(const Events::RegistersWrittenToTarget& event);
         void onTargetMemoryWrittenEvent(const Events::MemoryWrittenToTarget& event);
+        void onTargetPinStatesChangedEvent(const Events::TargetPinStatesChanged& event);
         void onTargetControllerStateChangedEvent(const Events::TargetControllerStateChanged& event);
         void onProgrammingModeEnabledEvent(const Events::ProgrammingModeEnabled& event);
         void onProgrammingModeDisabledEvent(const Events::ProgrammingModeDisabled& event);
+        void onTimingAnalysisCompletedEvent(const Events::TimingAnalysisCompleted& event);
     };
 }
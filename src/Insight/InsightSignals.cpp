@@ -0,0 +1,238 @@
+#include "InsightSignals.hpp"
+
+#include <algorithm>
+
+namespace Bloom
+{
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAddressRange;
+    using Targets::TargetRegisterDescriptors;
+    using Targets::TargetRegisterType;
+    using Targets::TargetRegisters;
+
+    InsightSignals::SubscriptionId InsightSignals::subscribeToMemoryWrites(
+        QObject* receiver,
+        TargetMemoryType memoryType,
+        const TargetMemoryAddressRange& addressRange,
+        MemoryWriteCallback callback
+    ) {
+        const auto subscriptionId = ++(this->lastSubscriptionId);
+
+        this->memoryWriteSubscriptionsById.emplace(
+            subscriptionId,
+            MemoryWriteSubscription{
+                .memoryType = memoryType,
+                .addressRange = addressRange,
+                .callback = std::move(callback),
+            }
+        );
+
+        auto& index = this->memoryWriteSubscriptionIndicesByType[memoryType];
+        index.subscriptionIdsByStartAddress.emplace(addressRange.startAddress, subscriptionId);
+        index.maximumSpan = std::max(index.maximumSpan, addressRange.endAddress - addressRange.startAddress);
+
+        this->removeSubscriptionOnDestruction(receiver, subscriptionId);
+        return subscriptionId;
+    }
+
+    InsightSignals::SubscriptionId InsightSignals::subscribeToRegisterWrites(
+        QObject* receiver,
+        const TargetRegisterDescriptors& descriptors,
+        RegisterWriteCallback callback
+    ) {
+        const auto subscriptionId = ++(this->lastSubscriptionId);
+
+        for (const auto& descriptor : descriptors) {
+            this->registerWriteSubscriptionIdsByDescriptor[descriptor].push_back(subscriptionId);
+        }
+
+        this->registerWriteSubscriptionsById.emplace(
+            subscriptionId,
+            RegisterWriteSubscription{
+                .descriptors = descriptors,
+                .registerType = std::nullopt,
+                .callback = std::move(callback),
+            }
+        );
+
+        this->removeSubscriptionOnDestruction(receiver, subscriptionId);
+        return subscriptionId;
+    }
+
+    InsightSignals::SubscriptionId InsightSignals::subscribeToRegisterWrites(
+        QObject* receiver,
+        TargetRegisterType registerType,
+        RegisterWriteCallback callback
+    ) {
+        const auto subscriptionId = ++(this->lastSubscriptionId);
+
+        this->registerWriteSubscriptionIdsByType[registerType].push_back(subscriptionId);
+        this->registerWriteSubscriptionsById.emplace(
+            subscriptionId,
+            RegisterWriteSubscription{
+                .descriptors = {},
+                .registerType = registerType,
+                .callback = std::move(callback),
+            }
+        );
+
+        this->removeSubscriptionOnDestruction(receiver, subscriptionId);
+        return subscriptionId;
+    }
+
+    void InsightSignals::unsubscribe(SubscriptionId subscriptionId) {
+        const auto memorySubscriptionIt = this->memoryWriteSubscriptionsById.find(subscriptionId);
+
+        if (memorySubscriptionIt != this->memoryWriteSubscriptionsById.end()) {
+            const auto& subscription = memorySubscriptionIt->second;
+            auto& subscriptionIds = this->memoryWriteSubscriptionIndicesByType[subscription.memoryType]
+                .subscriptionIdsByStartAddress;
+
+            const auto [first, last] = subscriptionIds.equal_range(subscription.addressRange.startAddress);
+            for (auto subscriptionIdIt = first; subscriptionIdIt != last; ++subscriptionIdIt) {
+                if (subscriptionIdIt->second == subscriptionId) {
+                    subscriptionIds.erase(subscriptionIdIt);
+                    break;
+                }
+            }
+
+            this->memoryWriteSubscriptionsById.erase(memorySubscriptionIt);
+            return;
+        }
+
+        const auto registerSubscriptionIt = this->registerWriteSubscriptionsById.find(subscriptionId);
+
+        if (registerSubscriptionIt != this->registerWriteSubscriptionsById.end()) {
+            const auto& subscription = registerSubscriptionIt->second;
+
+            const auto removeId = [subscriptionId] (std::vector<SubscriptionId>& subscriptionIds) {
+                subscriptionIds.erase(
+                    std::remove(subscriptionIds.begin(), subscriptionIds.end(), subscriptionId),
+                    subscriptionIds.end()
+                );
+            };
+
+            for (const auto& descriptor : subscription.descriptors) {
+                const auto subscriptionIdsIt = this->registerWriteSubscriptionIdsByDescriptor.find(descriptor);
+
+                if (subscriptionIdsIt != this->registerWriteSubscriptionIdsByDescriptor.end()) {
+                    removeId(subscriptionIdsIt->second);
+
+                    if (subscriptionIdsIt->second.empty()) {
+                        this->registerWriteSubscriptionIdsByDescriptor.erase(subscriptionIdsIt);
+                    }
+                }
+            }
+
+            if (subscription.registerType.has_value()) {
+                removeId(this->registerWriteSubscriptionIdsByType[*(subscription.registerType)]);
+            }
+
+            this->registerWriteSubscriptionsById.erase(registerSubscriptionIt);
+        }
+    }
+
+    void InsightSignals::publishTargetMemoryWritten(
+        TargetMemoryType memoryType,
+        const TargetMemoryAddressRange& addressRange
+    ) {
+        emit this->targetMemoryWritten(memoryType, addressRange);
+
+        const auto indexIt = this->memoryWriteSubscriptionIndicesByType.find(memoryType);
+        if (indexIt == this->memoryWriteSubscriptionIndicesByType.end()) {
+            return;
+        }
+
+        const auto& index = indexIt->second;
+
+        /*
+         * No subscribed range is wider than the maximum span, so any subscription starting before this address
+         * cannot reach the write.
+         */
+        const auto lowestStartAddress = addressRange.startAddress >= index.maximumSpan
+            ? addressRange.startAddress - index.maximumSpan
+            : Targets::TargetMemoryAddress{0};
+
+        /*
+         * The callbacks may subscribe or unsubscribe (or destroy their receivers), so we collect the matching IDs
+         * first, and look each subscription up again before invoking it.
+         */
+        auto matchingSubscriptionIds = std::vector<SubscriptionId>();
+
+        const auto subscriptionIdsEnd = index.subscriptionIdsByStartAddress.upper_bound(addressRange.endAddress);
+        auto subscriptionIdIt = index.subscriptionIdsByStartAddress.lower_bound(lowestStartAddress);
+
+        for (; subscriptionIdIt != subscriptionIdsEnd; ++subscriptionIdIt) {
+            const auto& subscription = this->memoryWriteSubscriptionsById.at(subscriptionIdIt->second);
+
+            if (subscription.addressRange.endAddress >= addressRange.startAddress) {
+                matchingSubscriptionIds.push_back(subscriptionIdIt->second);
+            }
+        }
+
+        for (const auto subscriptionId : matchingSubscriptionIds) {
+            const auto subscriptionIt = this->memoryWriteSubscriptionsById.find(subscriptionId);
+
+            if (subscriptionIt != this->memoryWriteSubscriptionsById.end()) {
+                // Copy the callback, in case it removes its own subscription
+                const auto callback = subscriptionIt->second.callback;
+                callback(addressRange);
+            }
+        }
+    }
+
+    void InsightSignals::publishTargetRegistersWritten(
+        const TargetRegisters& targetRegisters,
+        const QDateTime& timestamp
+    ) {
+        emit this->targetRegistersWritten(targetRegisters, timestamp);
+
+        if (this->registerWriteSubscriptionsById.empty()) {
+            return;
+        }
+
+        auto registersBySubscriptionId = std::map<SubscriptionId, TargetRegisters>();
+
+        for (const auto& targetRegister : targetRegisters) {
+            const auto descriptorSubscriptionIdsIt = this->registerWriteSubscriptionIdsByDescriptor.find(
+                targetRegister.descriptor
+            );
+
+            if (descriptorSubscriptionIdsIt != this->registerWriteSubscriptionIdsByDescriptor.end()) {
+                for (const auto subscriptionId : descriptorSubscriptionIdsIt->second) {
+                    registersBySubscriptionId[subscriptionId].push_back(targetRegister);
+                }
+            }
+
+            const auto typeSubscriptionIdsIt = this->registerWriteSubscriptionIdsByType.find(
+                targetRegister.descriptor.type
+            );
+
+            if (typeSubscriptionIdsIt != this->registerWriteSubscriptionIdsByType.end()) {
+                for (const auto subscriptionId : typeSubscriptionIdsIt->second) {
+                    registersBySubscriptionId[subscriptionId].push_back(targetRegister);
+                }
+            }
+        }
+
+        for (const auto& [subscriptionId, registers] : registersBySubscriptionId) {
+            const auto subscriptionIt = this->registerWriteSubscriptionsById.find(subscriptionId);
+
+            if (subscriptionIt != this->registerWriteSubscriptionsById.end()) {
+                const auto callback = subscriptionIt->second.callback;
+                callback(registers, timestamp);
+            }
+        }
+    }
+
+    void InsightSignals::removeSubscriptionOnDestruction(QObject* receiver, SubscriptionId subscriptionId) {
+        QObject::connect(
+            receiver,
+            &QObject::destroyed,
+            this,
+            [this, subscriptionId] {
+                this->unsubscribe(subscriptionId);
+            }
+        );
+    }
+}
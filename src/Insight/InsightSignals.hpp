@@ -1,5 +1,11 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 #include <QObject>
 #include <QDateTime>
 #include <QSharedPointer>
@@ -7,6 +13,8 @@
 #include "src/Targets/TargetState.hpp"
 #include "src/Targets/TargetDescriptor.hpp"
 #include "src/Targets/TargetRegister.hpp"
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetPinDescriptor.hpp"
 
 #include "InsightWorker/Tasks/InsightWorkerTask.hpp"
 
@@ -15,6 +23,13 @@ namespace Bloom
     /**
      * Singleton class providing global signals to all Insight widgets that require them. The signals are emitted via
      * the Insight class and InsightWorkerTasks.
+     *
+     * Widgets that are only concerned with particular memory ranges or registers should use the filtered
+     * subscriptions (InsightSignals::subscribeToMemoryWrites() and InsightSignals::subscribeToRegisterWrites()),
+     * as opposed to connecting to the targetMemoryWritten() and targetRegistersWritten() signals and working out
+     * relevance themselves. That way, a write to EEPROM doesn't have every RAM view re-evaluate.
+     *
+     * Subscriptions must only be made and used from the GUI thread.
      */
     class InsightSignals: public QObject
     {
@@ -26,9 +41,94 @@ namespace Bloom
             return &instance;
         }
 
+        using SubscriptionId = std::uint64_t;
+        using MemoryWriteCallback = std::function<void(const Targets::TargetMemoryAddressRange&)>;
+        using RegisterWriteCallback = std::function<void(const Targets::TargetRegisters&, const QDateTime&)>;
+
         InsightSignals(const InsightSignals&) = delete;
         void operator = (const InsightSignals&) = delete;
 
+        /**
+         * Subscribes to writes to the given range of target memory.
+         *
+         * The subscription is removed when the receiver is destroyed, or via InsightSignals::unsubscribe().
+         *
+         * @param receiver
+         * @param memoryType
+         * @param addressRange
+         *
+         * @param callback
+         *  Invoked with the address range of each write that intersects the subscribed range.
+         *
+         * @return
+         */
+        SubscriptionId subscribeToMemoryWrites(
+            QObject* receiver,
+            Targets::TargetMemoryType memoryType,
+            const Targets::TargetMemoryAddressRange& addressRange,
+            MemoryWriteCallback callback
+        );
+
+        /**
+         * Subscribes to writes to the given registers.
+         *
+         * The subscription is removed when the receiver is destroyed, or via InsightSignals::unsubscribe().
+         *
+         * @param receiver
+         * @param descriptors
+         *
+         * @param callback
+         *  Invoked with the subscribed registers (and only those) of each write that includes at least one of them.
+         *
+         * @return
+         */
+        SubscriptionId subscribeToRegisterWrites(
+            QObject* receiver,
+            const Targets::TargetRegisterDescriptors& descriptors,
+            RegisterWriteCallback callback
+        );
+
+        /**
+         * Subscribes to writes to registers of the given type.
+         *
+         * @param receiver
+         * @param registerType
+         *
+         * @param callback
+         *  Invoked with the registers of the given type (and only those) of each write that includes at least one
+         *  of them.
+         *
+         * @return
+         */
+        SubscriptionId subscribeToRegisterWrites(
+            QObject* receiver,
+            Targets::TargetRegisterType registerType,
+            RegisterWriteCallback callback
+        );
+
+        void unsubscribe(SubscriptionId subscriptionId);
+
+        /**
+         * Emits the targetMemoryWritten() signal and invokes the callbacks of all intersecting memory write
+         * subscriptions.
+         *
+         * @param memoryType
+         * @param addressRange
+         */
+        void publishTargetMemoryWritten(
+            Targets::TargetMemoryType memoryType,
+            const Targets::TargetMemoryAddressRange& addressRange
+        );
+
+        /**
+         * Emits the targetRegistersWritten() signal and invokes the callbacks of all matching register write
+         * subscriptions.
+         *
+         * @param targetRegisters
+         * @param timestamp
+         */
+        void publishTargetRegistersWritten(const Targets::TargetRegisters& targetRegisters, const QDateTime& timestamp);
+
     signals:
         void taskQueued(QSharedPointer<InsightWorkerTask> task);
         void taskProcessed(QSharedPointer<InsightWorkerTask> task);
@@ -37,12 +137,60 @@ namespace Bloom
         void targetReset();
         void targetRegistersWritten(const Bloom::Targets::TargetRegisters& targetRegisters, const QDateTime& timestamp);
         void targetMemoryWritten(Bloom::Targets::TargetMemoryType memoryType, Targets::TargetMemoryAddressRange addressRange);
+        void targetPinStatesChanged(int variantId, const Bloom::Targets::TargetPinStateMapping& pinStatesByNumber);
         void targetControllerSuspended();
         void targetControllerResumed(const Bloom::Targets::TargetDescriptor& targetDescriptor);
         void programmingModeEnabled();
         void programmingModeDisabled();
+        void timingAnalysisCompleted(const QString& summary);
 
     private:
+        struct MemoryWriteSubscription
+        {
+            Targets::TargetMemoryType memoryType;
+            Targets::TargetMemoryAddressRange addressRange;
+            MemoryWriteCallback callback;
+        };
+
+        /**
+         * An interval index of memory write subscriptions, for a single memory type.
+         *
+         * Subscriptions are ordered by the start address of their range. We also track the span of the largest
+         * subscribed range, which bounds how far below a write's start address an intersecting subscription can
+         * start. So a lookup only visits the subscriptions that start within that window.
+         */
+        struct MemoryWriteSubscriptionIndex
+        {
+            std::multimap<Targets::TargetMemoryAddress, SubscriptionId> subscriptionIdsByStartAddress;
+
+            /**
+             * The largest (endAddress - startAddress) of all subscriptions ever added to the index. This is never
+             * reduced when subscriptions are removed, which is harmless - it only widens the lookup window.
+             */
+            Targets::TargetMemoryAddress maximumSpan = 0;
+        };
+
+        struct RegisterWriteSubscription
+        {
+            Targets::TargetRegisterDescriptors descriptors;
+            std::optional<Targets::TargetRegisterType> registerType;
+            RegisterWriteCallback callback;
+        };
+
+        SubscriptionId lastSubscriptionId = 0;
+
+        std::map<SubscriptionId, MemoryWriteSubscription> memoryWriteSubscriptionsById;
+        std::map<Targets::TargetMemoryType, MemoryWriteSubscriptionIndex> memoryWriteSubscriptionIndicesByType;
+
+        std::map<SubscriptionId, RegisterWriteSubscription> registerWriteSubscriptionsById;
+        std::unordered_map<
+            Targets::TargetRegisterDescriptor,
+            std::vector<SubscriptionId>
+        > registerWriteSubscriptionIdsByDescriptor;
+        std::map<Targets::TargetRegisterType, std::vector<SubscriptionId>> registerWriteSubscriptionIdsByType;
+
         InsightSignals() = default;
+
+        void removeSubscriptionOnDestruction(QObject* receiver, SubscriptionId subscriptionId);
     };
 }
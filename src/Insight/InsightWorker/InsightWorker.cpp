@@ -14,6 +14,14 @@ namespace Bloom
     void InsightWorker::startup() {
         auto* insightSignals = InsightSignals::instance();
 
+        /*
+         * Insight tasks are background work - they shouldn't hold up commands from the debug client (e.g. GDB
+         * interrupting target execution mid-way through a memory snapshot capture).
+         */
+        this->targetControllerService.setCommandPriority(
+            TargetController::Commands::CommandPriority::BACKGROUND
+        );
+
         QObject::connect(
             insightSignals,
             &InsightSignals::taskQueued,
@@ -38,14 +46,32 @@ namespace Bloom
 
         {
             const auto taskQueueLock = InsightWorker::queuedTasksById.acquireLock();
-            InsightWorker::queuedTasksById.getValue().emplace(task->id, task);
+            auto& queuedTasks = InsightWorker::queuedTasksById.getValue();
+
+            const auto coalescingKey = task->coalescingKey();
+
+            if (coalescingKey.has_value()) {
+                /*
+                 * The new task is queued at the back, in place of the superseded task - it may depend on tasks queued
+                 * in between (e.g. a memory read queued after a memory write).
+                 */
+                for (auto queuedTaskIt = queuedTasks.begin(); queuedTaskIt != queuedTasks.end(); ++queuedTaskIt) {
+                    if (queuedTaskIt->second->coalescingKey() == coalescingKey) {
+                        task->supersede(queuedTaskIt->second);
+                        queuedTasks.erase(queuedTaskIt);
+                        break;
+                    }
+                }
+            }
+
+            queuedTasks.emplace(task->id, task);
         }
 
         emit InsightSignals::instance()->taskQueued(task);
     }
 
     void InsightWorker::executeTasks() {
-        static const auto getQueuedTask = [] () -> std::optional<QSharedPointer<InsightWorkerTask>> {
+        const auto getQueuedTask = [this] () -> std::optional<QSharedPointer<InsightWorkerTask>> {
             const auto taskQueueLock = InsightWorker::queuedTasksById.acquireLock();
             auto& queuedTasks = InsightWorker::queuedTasksById.getValue();
 
@@ -53,8 +79,19 @@ namespace Bloom
                 const auto taskGroupsLock = InsightWorker::taskGroupsInExecution.acquireLock();
                 auto& taskGroupsInExecution = InsightWorker::taskGroupsInExecution.getValue();
 
-                const auto canExecuteTask = [&taskGroupsInExecution] (const QSharedPointer<InsightWorkerTask>& task) {
-                    for (const auto taskGroup : task->taskGroups()) {
+                const auto canExecuteTask = [this, &taskGroupsInExecution] (
+                    const QSharedPointer<InsightWorkerTask>& task
+                ) {
+                    const auto taskGroups = task->taskGroups();
+                    const auto taskLane = taskGroups.contains(TaskGroup::USES_TARGET_CONTROLLER)
+                        ? InsightWorkerLane::TARGET_CONTROLLER
+                        : InsightWorkerLane::GENERAL;
+
+                    if (taskLane != this->lane) {
+                        return false;
+                    }
+
+                    for (const auto taskGroup : taskGroups) {
                         if (taskGroupsInExecution.contains(taskGroup)) {
                             return false;
                         }
@@ -81,6 +118,10 @@ namespace Bloom
         while ((queuedTask = getQueuedTask())) {
             auto& task = *queuedTask;
             task->moveToThread(this->thread());
+
+            for (auto& supersededTask : task->getSupersededTasks()) {
+                supersededTask->moveToThread(this->thread());
+            }
             task->execute(this->targetControllerService);
 
             {
@@ -93,6 +134,10 @@ namespace Bloom
             }
 
             emit InsightSignals::instance()->taskProcessed(task);
+
+            for (const auto& supersededTask : task->getSupersededTasks()) {
+                emit InsightSignals::instance()->taskProcessed(supersededTask);
+            }
         }
     }
 }
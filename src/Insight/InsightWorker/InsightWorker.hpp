@@ -16,6 +16,20 @@ namespace Bloom
 {
     static_assert(std::atomic<std::uint8_t>::is_always_lock_free);
 
+    /**
+     * Each InsightWorker services a single lane of tasks.
+     *
+     * Tasks that use the TargetController (see TaskGroup::USES_TARGET_CONTROLLER) are serviced by the
+     * TARGET_CONTROLLER lane. All other tasks (file I/O, parsing, diff computation, hex viewer construction, etc) are
+     * serviced by the GENERAL lane, which usually consists of multiple workers. This prevents CPU or disk bound tasks
+     * from queueing behind (or holding up) target operations.
+     */
+    enum class InsightWorkerLane: std::uint8_t
+    {
+        TARGET_CONTROLLER,
+        GENERAL,
+    };
+
     /**
      * The InsightWorker runs on a separate thread to the main GUI thread. Its purpose is to handle any
      * blocking/time-expensive operations.
@@ -26,8 +40,12 @@ namespace Bloom
 
     public:
         const std::uint8_t id = ++(InsightWorker::lastWorkerId);
+        const InsightWorkerLane lane;
+
+        explicit InsightWorker(InsightWorkerLane lane)
+            : lane(lane)
+        {};
 
-        InsightWorker() = default;
         void startup();
         static void queueTask(const QSharedPointer<InsightWorkerTask>& task);
 
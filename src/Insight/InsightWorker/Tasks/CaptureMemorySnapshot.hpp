@@ -21,7 +21,8 @@ namespace Bloom
             Targets::TargetMemoryType memoryType,
             const std::vector<FocusedMemoryRegion>& focusedRegions,
             const std::vector<ExcludedMemoryRegion>& excludedRegions,
-            const std::optional<Targets::TargetMemoryBuffer>& data
+            const std::optional<SharedMemoryBuffer>& data,
+            const std::optional<MemorySnapshot>& baseSnapshot = std::nullopt
         );
 
         QString brief() const override {
@@ -47,6 +48,11 @@ namespace Bloom
         std::vector<FocusedMemoryRegion> focusedRegions;
         std::vector<ExcludedMemoryRegion> excludedRegions;
 
-        std::optional<Targets::TargetMemoryBuffer> data;
+        std::optional<SharedMemoryBuffer> data;
+
+        /**
+         * If provided, the snapshot will be stored as a delta of this snapshot, where worthwhile.
+         */
+        std::optional<MemorySnapshot> baseSnapshot;
     };
 }
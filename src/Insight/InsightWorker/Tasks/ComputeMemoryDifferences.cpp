@@ -0,0 +1,73 @@
+#include "ComputeMemoryDifferences.hpp"
+
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/MemoryDiff.hpp"
+
+namespace Bloom
+{
+    ComputeMemoryDifferences::ComputeMemoryDifferences(
+        const SharedMemoryBuffer& dataA,
+        const SharedMemoryBuffer& dataB,
+        Targets::TargetMemoryAddress startAddress,
+        const std::vector<ExcludedMemoryRegion>& excludedRegions
+    )
+        : dataA(dataA)
+        , dataB(dataB)
+        , startAddress(startAddress)
+    {
+        auto excludedRanges = std::vector<Targets::TargetMemoryAddressRange>();
+        excludedRanges.reserve(excludedRegions.size());
+
+        for (const auto& excludedRegion : excludedRegions) {
+            excludedRanges.push_back(excludedRegion.addressRange);
+        }
+
+        this->excludedRangeIndex = Targets::TargetMemoryAddressRangeIndex(excludedRanges);
+    }
+
+    void ComputeMemoryDifferences::run(Services::TargetControllerService&) {
+        auto differences = std::vector<Targets::TargetMemoryAddressRange>();
+        auto differenceCount = std::size_t{0};
+
+        if (this->dataA.size() == this->dataB.size()) {
+            for (const auto& range : MemoryDiff::differingRanges(this->dataA, this->dataB, this->startAddress)) {
+                /*
+                 * Carve the excluded regions out of the differing range. The intersecting excluded ranges are
+                 * visited in order of start address, but they may overlap, so some of them may end before the part
+                 * of the range that remains.
+                 */
+                auto remainingStart = range.startAddress;
+                auto remaining = true;
+
+                this->excludedRangeIndex.forEachIntersecting(
+                    range,
+                    [&] (const Targets::TargetMemoryAddressRange& excludedRange, std::size_t) {
+                        if (!remaining || excludedRange.endAddress < remainingStart) {
+                            return;
+                        }
+
+                        if (excludedRange.startAddress > remainingStart) {
+                            differences.emplace_back(remainingStart, excludedRange.startAddress - 1);
+                        }
+
+                        if (excludedRange.endAddress >= range.endAddress) {
+                            remaining = false;
+                            return;
+                        }
+
+                        remainingStart = excludedRange.endAddress + 1;
+                    }
+                );
+
+                if (remaining) {
+                    differences.emplace_back(remainingStart, range.endAddress);
+                }
+            }
+
+            for (const auto& range : differences) {
+                differenceCount += range.endAddress - range.startAddress + 1;
+            }
+        }
+
+        emit this->memoryDifferencesComputed(std::move(differences), differenceCount);
+    }
+}
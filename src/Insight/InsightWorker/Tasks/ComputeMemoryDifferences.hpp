@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+#include "InsightWorkerTask.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetMemoryAddressRangeIndex.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/ExcludedMemoryRegion.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/SharedMemoryBuffer.hpp"
+
+namespace Bloom
+{
+    /**
+     * Computes the differences between two memory buffers, in the form of a sorted list of differing address ranges.
+     *
+     * The buffers are shared with the snapshot diff (see SharedMemoryBuffer), so the task holds copies of them at no
+     * cost, and pages that are shared by the two buffers are skipped entirely.
+     *
+     * Bytes that reside in any of the given excluded regions are not considered to be differences.
+     */
+    class ComputeMemoryDifferences: public InsightWorkerTask
+    {
+        Q_OBJECT
+
+    public:
+        ComputeMemoryDifferences(
+            const SharedMemoryBuffer& dataA,
+            const SharedMemoryBuffer& dataB,
+            Targets::TargetMemoryAddress startAddress,
+            const std::vector<ExcludedMemoryRegion>& excludedRegions
+        );
+
+        QString brief() const override {
+            return "Comparing memory";
+        }
+
+        TaskGroups taskGroups() const override {
+            return TaskGroups();
+        };
+
+    signals:
+        /**
+         * @param differences
+         *  The differing address ranges, in ascending order. Adjacent differences are merged into a single range.
+         *
+         * @param differenceCount
+         *  The total number of differing bytes.
+         */
+        void memoryDifferencesComputed(
+            std::vector<Targets::TargetMemoryAddressRange> differences,
+            std::size_t differenceCount
+        );
+
+    protected:
+        void run(Services::TargetControllerService&) override;
+
+    private:
+        SharedMemoryBuffer dataA;
+        SharedMemoryBuffer dataB;
+        Targets::TargetMemoryAddress startAddress;
+        Targets::TargetMemoryAddressRangeIndex excludedRangeIndex;
+    };
+}
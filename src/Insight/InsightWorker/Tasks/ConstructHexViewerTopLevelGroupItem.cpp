@@ -5,21 +5,35 @@ namespace Bloom
     ConstructHexViewerTopLevelGroupItem::ConstructHexViewerTopLevelGroupItem(
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
-        const Widgets::HexViewerSharedState& hexViewerState
+        const Widgets::HexViewerSharedState& hexViewerState,
+        const QPoint& position,
+        int maximumWidth
     )
         : focusedMemoryRegions(focusedMemoryRegions)
         , excludedMemoryRegions(excludedMemoryRegions)
-        , hexViewerState(hexViewerState)
-    {}
+        , data(hexViewerState.data)
+        , settings(hexViewerState.settings)
+        , hexViewerState(hexViewerState.memoryDescriptor, this->data, this->settings)
+        , position(position)
+        , maximumWidth(maximumWidth)
+    {
+        this->hexViewerState.currentStackPointer = hexViewerState.currentStackPointer;
+    }
 
     void ConstructHexViewerTopLevelGroupItem::run(Services::TargetControllerService&) {
-        auto* item = new Widgets::TopLevelGroupItem(
+        auto item = std::make_unique<Widgets::TopLevelGroupItem>(
             this->focusedMemoryRegions,
             this->excludedMemoryRegions,
-            this->hexViewerState
+            this->hexViewerState.memoryDescriptor.addressRange
         );
-        item->rebuildItemHierarchy();
 
-        emit this->topLevelGroupItem(item);
+        item->rebuildItemHierarchy(this->hexViewerState);
+        item->setPosition(this->position);
+        item->adjustItemPositions(this->maximumWidth, this->hexViewerState);
+
+        auto itemIndex = std::make_unique<Widgets::HexViewerItemIndex>(item.get());
+        itemIndex->refreshIndex();
+
+        emit this->topLevelGroupItem(item.release(), itemIndex.release());
     }
 }
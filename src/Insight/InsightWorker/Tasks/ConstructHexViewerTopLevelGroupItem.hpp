@@ -1,24 +1,49 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+#include <optional>
+#include <QPoint>
 
 #include "InsightWorkerTask.hpp"
 #include "src/Targets/TargetMemory.hpp"
 
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/HexViewerWidget/TopLevelGroupItem.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/HexViewerWidget/HexViewerItemIndex.hpp"
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/HexViewerWidget/HexViewerSharedState.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/HexViewerWidget/HexViewerWidgetSettings.hpp"
 
 namespace Bloom
 {
+    /**
+     * Constructs a hex viewer item hierarchy, positions its items and indexes them.
+     *
+     * All inputs are copied at construction, on the GUI thread, so the GUI is free to modify the hex viewer's state
+     * while the task is running. The task hands ownership of the new hierarchy and index to the receiver of the
+     * ConstructHexViewerTopLevelGroupItem::topLevelGroupItem() signal.
+     */
     class ConstructHexViewerTopLevelGroupItem: public InsightWorkerTask
     {
         Q_OBJECT
 
     public:
+        /**
+         * @param focusedMemoryRegions
+         * @param excludedMemoryRegions
+         * @param hexViewerState
+         *
+         * @param position
+         *  The position of the top level group item, within the scene.
+         *
+         * @param maximumWidth
+         *  The width available to the top level group item.
+         */
         ConstructHexViewerTopLevelGroupItem(
             const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
             const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
-            const Widgets::HexViewerSharedState& hexViewerState
+            const Widgets::HexViewerSharedState& hexViewerState,
+            const QPoint& position,
+            int maximumWidth
         );
 
         QString brief() const override {
@@ -30,14 +55,23 @@ namespace Bloom
         };
 
     signals:
-        void topLevelGroupItem(Widgets::TopLevelGroupItem* item);
+        void topLevelGroupItem(Widgets::TopLevelGroupItem* item, Widgets::HexViewerItemIndex* itemIndex);
 
     protected:
         void run(Services::TargetControllerService&) override;
 
     private:
-        const Widgets::HexViewerSharedState& hexViewerState;
-        const std::vector<FocusedMemoryRegion>& focusedMemoryRegions;
-        const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions;
+        std::vector<FocusedMemoryRegion> focusedMemoryRegions;
+        std::vector<ExcludedMemoryRegion> excludedMemoryRegions;
+
+        /**
+         * Snapshot of the hex viewer state. The memory descriptor is never modified, so we don't copy it.
+         */
+        std::optional<SharedMemoryBuffer> data;
+        Widgets::HexViewerWidgetSettings settings;
+        Widgets::HexViewerSharedState hexViewerState;
+
+        QPoint position;
+        int maximumWidth;
     };
 }
@@ -1,10 +1,6 @@
 #include "DeleteMemorySnapshot.hpp"
 
-#include <QFile>
-
-#include "src/Services/PathService.hpp"
-#include "src/Helpers/EnumToStringMappings.hpp"
-#include "src/Logger/Logger.hpp"
+#include "src/Services/MemorySnapshotService.hpp"
 
 namespace Bloom
 {
@@ -19,24 +15,6 @@ namespace Bloom
     {}
 
     void DeleteMemorySnapshot::run(TargetControllerService&) {
-        using Targets::TargetMemorySize;
-
-        Logger::info("Deleting snapshot " + this->snapshotId.toStdString());
-
-        const auto snapshotFilePath = QString::fromStdString(Services::PathService::projectSettingsDirPath())
-            + "/memory_snapshots/" + EnumToStringMappings::targetMemoryTypes.at(this->memoryType) + "/"
-                + this->snapshotId + ".json";
-
-        auto snapshotFile = QFile(snapshotFilePath);
-
-        if (!snapshotFile.exists()) {
-            Logger::warning(
-                "Could not find snapshot file for " + this->snapshotId.toStdString() + " - expected path: "
-                    + snapshotFilePath.toStdString()
-            );
-            return;
-        }
-
-        snapshotFile.remove();
+        Services::MemorySnapshotService::remove(this->snapshotId, this->memoryType);
     }
 }
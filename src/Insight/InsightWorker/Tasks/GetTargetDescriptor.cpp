@@ -5,6 +5,6 @@ namespace Bloom
     using Services::TargetControllerService;
 
     void GetTargetDescriptor::run(TargetControllerService& targetControllerService) {
-        emit this->targetDescriptor(targetControllerService.getTargetDescriptor());
+        emit this->targetDescriptor(*(targetControllerService.getTargetDescriptor(true)));
     }
 }
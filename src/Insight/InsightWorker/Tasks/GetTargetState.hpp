@@ -23,10 +23,24 @@ namespace Bloom
             });
         };
 
+        std::optional<QString> coalescingKey() const override {
+            return "GetTargetState";
+        }
+
     signals:
         void targetState(Targets::TargetState state);
 
     protected:
         void run(Services::TargetControllerService& targetControllerService) override;
+
+        void relayResults(InsightWorkerTask* supersededTask) override {
+            QObject::connect(
+                this,
+                &GetTargetState::targetState,
+                static_cast<GetTargetState*>(supersededTask),
+                &GetTargetState::targetState,
+                Qt::ConnectionType::DirectConnection
+            );
+        }
     };
 }
@@ -10,19 +10,74 @@ namespace Bloom
         : QObject(nullptr)
     {}
 
+    void InsightWorkerTask::supersede(const QSharedPointer<InsightWorkerTask>& task) {
+        /*
+         * The superseded task has no thread affinity (see InsightWorker::queueTask()), so the relays must be direct
+         * connections. Any queued connections to the superseded task's listeners will still be honoured.
+         */
+        const auto connectionType = Qt::ConnectionType::DirectConnection;
+        auto* supersededTask = task.get();
+
+        QObject::connect(
+            this,
+            &InsightWorkerTask::started,
+            supersededTask,
+            &InsightWorkerTask::started,
+            connectionType
+        );
+        QObject::connect(
+            this,
+            &InsightWorkerTask::progressUpdate,
+            supersededTask,
+            &InsightWorkerTask::progressUpdate,
+            connectionType
+        );
+        QObject::connect(
+            this,
+            &InsightWorkerTask::completed,
+            supersededTask,
+            &InsightWorkerTask::completed,
+            connectionType
+        );
+        QObject::connect(
+            this,
+            &InsightWorkerTask::failed,
+            supersededTask,
+            &InsightWorkerTask::failed,
+            connectionType
+        );
+        QObject::connect(
+            this,
+            &InsightWorkerTask::finished,
+            supersededTask,
+            &InsightWorkerTask::finished,
+            connectionType
+        );
+
+        this->relayResults(supersededTask);
+
+        this->supersededTasks.insert(
+            this->supersededTasks.end(),
+            task->supersededTasks.begin(),
+            task->supersededTasks.end()
+        );
+        this->supersededTasks.push_back(task);
+        task->supersededTasks.clear();
+    }
+
     void InsightWorkerTask::execute(TargetControllerService& targetControllerService) {
         try {
-            this->state = InsightWorkerTaskState::STARTED;
+            this->setState(InsightWorkerTaskState::STARTED);
             emit this->started();
 
             this->run(targetControllerService);
 
-            this->state = InsightWorkerTaskState::COMPLETED;
+            this->setState(InsightWorkerTaskState::COMPLETED);
             this->setProgressPercentage(100);
             emit this->completed();
 
         } catch (std::exception& exception) {
-            this->state = InsightWorkerTaskState::FAILED;
+            this->setState(InsightWorkerTaskState::FAILED);
             Logger::debug("InsightWorker task failed - " + std::string(exception.what()));
             emit this->failed(QString::fromStdString(exception.what()));
         }
@@ -32,6 +87,19 @@ namespace Bloom
 
     void InsightWorkerTask::setProgressPercentage(std::uint8_t percentage) {
         this->progressPercentage = percentage;
+
+        for (auto& supersededTask : this->supersededTasks) {
+            supersededTask->progressPercentage = percentage;
+        }
+
         emit this->progressUpdate(this->progressPercentage);
     }
+
+    void InsightWorkerTask::setState(InsightWorkerTaskState state) {
+        this->state = state;
+
+        for (auto& supersededTask : this->supersededTasks) {
+            supersededTask->state = state;
+        }
+    }
 }
@@ -2,8 +2,11 @@
 
 #include <cstdint>
 #include <atomic>
+#include <vector>
+#include <optional>
 #include <QObject>
 #include <QString>
+#include <QSharedPointer>
 
 #include "TaskGroup.hpp"
 #include "src/Services/TargetControllerService.hpp"
@@ -39,6 +42,35 @@ namespace Bloom
             return TaskGroups();
         };
 
+        /**
+         * Tasks that return a coalescing key can be superseded. If a task is queued whilst another task with the same
+         * key is still waiting in the queue, the waiting task is removed from the queue and the new task takes over
+         * its listeners (see InsightWorkerTask::supersede()). This prevents Insight from flooding the
+         * TargetController with redundant reads, during rapid stepping, for example.
+         *
+         * Tasks with the same key must be interchangeable - executing one must produce the results that executing the
+         * other would have produced at the same point in time. Tasks that modify target state must not be coalesced.
+         *
+         * @return
+         *  std::nullopt if the task cannot be coalesced (the default).
+         */
+        virtual std::optional<QString> coalescingKey() const {
+            return std::nullopt;
+        }
+
+        /**
+         * Takes over the listeners of a queued task with the same coalescing key. From here on, all signals emitted
+         * by this task will be relayed to the superseded task, and the superseded task's state will mirror the state
+         * of this task.
+         *
+         * @param task
+         */
+        void supersede(const QSharedPointer<InsightWorkerTask>& task);
+
+        const std::vector<QSharedPointer<InsightWorkerTask>>& getSupersededTasks() const {
+            return this->supersededTasks;
+        }
+
         void execute(Services::TargetControllerService& targetControllerService);
 
     signals:
@@ -82,7 +114,26 @@ namespace Bloom
         virtual void run(Services::TargetControllerService& targetControllerService) = 0;
         void setProgressPercentage(std::uint8_t percentage);
 
+        /**
+         * Relays the task-specific result signals of this task to the given superseded task. Tasks that implement
+         * InsightWorkerTask::coalescingKey() must override this.
+         *
+         * The superseded task will always be of the same type as this task, as the coalescing key identifies the
+         * type of the task.
+         *
+         * @param supersededTask
+         */
+        virtual void relayResults(InsightWorkerTask* supersededTask) {}
+
     private:
         static inline std::atomic<InsightWorkerTask::IdType> lastId = 0;
+
+        /**
+         * All tasks superseded by this task, including those that were superseded by the tasks that this task
+         * superseded.
+         */
+        std::vector<QSharedPointer<InsightWorkerTask>> supersededTasks;
+
+        void setState(InsightWorkerTaskState state);
     };
 }
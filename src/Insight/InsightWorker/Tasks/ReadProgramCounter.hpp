@@ -23,10 +23,24 @@ namespace Bloom
             });
         };
 
+        std::optional<QString> coalescingKey() const override {
+            return "ReadProgramCounter";
+        }
+
     signals:
         void programCounterRead(Targets::TargetProgramCounter programCounter);
 
     protected:
         void run(Services::TargetControllerService& targetControllerService) override;
+
+        void relayResults(InsightWorkerTask* supersededTask) override {
+            QObject::connect(
+                this,
+                &ReadProgramCounter::programCounterRead,
+                static_cast<ReadProgramCounter*>(supersededTask),
+                &ReadProgramCounter::programCounterRead,
+                Qt::ConnectionType::DirectConnection
+            );
+        }
     };
 }
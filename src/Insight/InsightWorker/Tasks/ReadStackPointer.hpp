@@ -23,10 +23,24 @@ namespace Bloom
             });
         };
 
+        std::optional<QString> coalescingKey() const override {
+            return "ReadStackPointer";
+        }
+
     signals:
         void stackPointerRead(Targets::TargetStackPointer stackPointer);
 
     protected:
         void run(Services::TargetControllerService& targetControllerService) override;
+
+        void relayResults(InsightWorkerTask* supersededTask) override {
+            QObject::connect(
+                this,
+                &ReadStackPointer::stackPointerRead,
+                static_cast<ReadStackPointer*>(supersededTask),
+                &ReadStackPointer::stackPointerRead,
+                Qt::ConnectionType::DirectConnection
+            );
+        }
     };
 }
@@ -0,0 +1,68 @@
+#include "ReadStackWatermark.hpp"
+
+#include <algorithm>
+
+namespace Bloom
+{
+    using Services::TargetControllerService;
+
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+
+    void ReadStackWatermark::run(TargetControllerService& targetControllerService) {
+        const auto startAddress = this->canaryAddressRange.startAddress;
+        const auto endAddress = this->canaryAddressRange.endAddress;
+
+        const auto canaryIntact = [this, &targetControllerService, endAddress] (TargetMemoryAddress address) {
+            const auto probeSize = std::min(ReadStackWatermark::PROBE_SIZE, endAddress - address + 1);
+            const auto data = targetControllerService.readMemory(this->memoryType, address, probeSize);
+
+            return std::all_of(data.begin(), data.end(), [this] (unsigned char value) {
+                return value == this->canaryValue;
+            });
+        };
+
+        if (canaryIntact(endAddress - std::min(ReadStackWatermark::PROBE_SIZE - 1, endAddress - startAddress))) {
+            // The stack hasn't reached the region
+            emit this->stackWatermarkRead(std::nullopt);
+            return;
+        }
+
+        auto highAddress = endAddress;
+
+        if (!canaryIntact(startAddress)) {
+            // The stack has reached (and possibly overrun) the bottom of the region
+            highAddress = startAddress;
+
+        } else {
+            // Invariant: the probe at lowAddress is intact and the probe at highAddress is not
+            auto lowAddress = startAddress;
+
+            while (highAddress - lowAddress > 1) {
+                const auto midAddress = lowAddress + (highAddress - lowAddress) / 2;
+
+                if (canaryIntact(midAddress)) {
+                    lowAddress = midAddress;
+
+                } else {
+                    highAddress = midAddress;
+                }
+            }
+        }
+
+        /*
+         * The first overwritten byte is within the probe block at highAddress (the block one byte lower was intact,
+         * or it's the bottom of the region). We read that block once more, to find the exact byte.
+         */
+        const auto probeSize = std::min(ReadStackWatermark::PROBE_SIZE, endAddress - highAddress + 1);
+        const auto data = targetControllerService.readMemory(this->memoryType, highAddress, probeSize);
+
+        const auto overwrittenIt = std::find_if(data.begin(), data.end(), [this] (unsigned char value) {
+            return value != this->canaryValue;
+        });
+
+        emit this->stackWatermarkRead(
+            highAddress + static_cast<TargetMemorySize>(std::distance(data.begin(), overwrittenIt))
+        );
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "InsightWorkerTask.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom
+{
+    /**
+     * Determines the stack high-water mark, within a region that was previously painted with a canary value.
+     *
+     * The stack grows downwards, into the painted region, so every byte above the deepest point the stack has
+     * reached will have been overwritten, and every byte below it will still hold the canary value. We binary search
+     * for that boundary, reading a small probe block at each step, so that the task costs a handful of small reads,
+     * as opposed to a full read of the region.
+     *
+     * The probe block guards against false boundaries, where the stack happens to hold the canary value.
+     */
+    class ReadStackWatermark: public InsightWorkerTask
+    {
+        Q_OBJECT
+
+    public:
+        static constexpr Targets::TargetMemorySize PROBE_SIZE = 4;
+
+        ReadStackWatermark(
+            Targets::TargetMemoryType memoryType,
+            const Targets::TargetMemoryAddressRange& canaryAddressRange,
+            unsigned char canaryValue
+        )
+            : memoryType(memoryType)
+            , canaryAddressRange(canaryAddressRange)
+            , canaryValue(canaryValue)
+        {}
+
+        QString brief() const override {
+            return "Reading stack watermark";
+        }
+
+        TaskGroups taskGroups() const override {
+            return TaskGroups({
+                TaskGroup::USES_TARGET_CONTROLLER,
+            });
+        };
+
+    signals:
+        /**
+         * @param watermarkAddress
+         *  The lowest address the stack has reached, within the canary region, or std::nullopt if the stack hasn't
+         *  reached the region at all. If the stack has overrun the region, this will be the region's start address.
+         */
+        void stackWatermarkRead(std::optional<Targets::TargetMemoryAddress> watermarkAddress);
+
+    protected:
+        void run(Services::TargetControllerService& targetControllerService) override;
+
+    private:
+        Targets::TargetMemoryType memoryType;
+        Targets::TargetMemoryAddressRange canaryAddressRange;
+        unsigned char canaryValue;
+    };
+}
@@ -5,6 +5,7 @@
 #include "InsightWorkerTask.hpp"
 
 #include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/SharedTargetMemoryBuffer.hpp"
 #include "src/Helpers/EnumToStringMappings.hpp"
 
 namespace Bloom
@@ -36,12 +37,37 @@ namespace Bloom
             });
         };
 
+        std::optional<QString> coalescingKey() const override {
+            auto key = "ReadTargetMemory:" + QString::number(static_cast<int>(this->memoryType)) + ":"
+                + QString::number(this->startAddress) + ":" + QString::number(this->size);
+
+            for (const auto& excludedAddressRange : this->excludedAddressRanges) {
+                key += ":" + QString::number(excludedAddressRange.startAddress) + "-"
+                    + QString::number(excludedAddressRange.endAddress);
+            }
+
+            return key;
+        }
+
     signals:
-        void targetMemoryRead(Targets::TargetMemoryBuffer buffer);
+        /**
+         * The buffer is shared by all receivers - the data is not copied for each connection.
+         */
+        void targetMemoryRead(Targets::SharedTargetMemoryBuffer buffer);
 
     protected:
         void run(Services::TargetControllerService& targetControllerService) override;
 
+        void relayResults(InsightWorkerTask* supersededTask) override {
+            QObject::connect(
+                this,
+                &ReadTargetMemory::targetMemoryRead,
+                static_cast<ReadTargetMemory*>(supersededTask),
+                &ReadTargetMemory::targetMemoryRead,
+                Qt::ConnectionType::DirectConnection
+            );
+        }
+
     private:
         Targets::TargetMemoryType memoryType;
         Targets::TargetMemoryAddress startAddress;
@@ -24,12 +24,32 @@ namespace Bloom
             });
         };
 
+        std::optional<QString> coalescingKey() const override {
+            auto key = QString("ReadTargetRegisters");
+
+            for (const auto& descriptor : this->descriptors) {
+                key += ":" + QString::number(std::hash<Targets::TargetRegisterDescriptor>()(descriptor));
+            }
+
+            return key;
+        }
+
     signals:
         void targetRegistersRead(Targets::TargetRegisters registers);
 
     protected:
         void run(Services::TargetControllerService& targetControllerService) override;
 
+        void relayResults(InsightWorkerTask* supersededTask) override {
+            QObject::connect(
+                this,
+                &ReadTargetRegisters::targetRegistersRead,
+                static_cast<ReadTargetRegisters*>(supersededTask),
+                &ReadTargetRegisters::targetRegistersRead,
+                Qt::ConnectionType::DirectConnection
+            );
+        }
+
     private:
         Targets::TargetRegisterDescriptors descriptors;
     };
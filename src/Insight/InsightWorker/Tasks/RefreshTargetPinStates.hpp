@@ -25,12 +25,26 @@ namespace Bloom
             });
         };
 
+        std::optional<QString> coalescingKey() const override {
+            return "RefreshTargetPinStates:" + QString::number(this->variantId);
+        }
+
     signals:
         void targetPinStatesRetrieved(Bloom::Targets::TargetPinStateMapping pinStatesByNumber);
 
     protected:
         void run(Services::TargetControllerService& targetControllerService) override;
 
+        void relayResults(InsightWorkerTask* supersededTask) override {
+            QObject::connect(
+                this,
+                &RefreshTargetPinStates::targetPinStatesRetrieved,
+                static_cast<RefreshTargetPinStates*>(supersededTask),
+                &RefreshTargetPinStates::targetPinStatesRetrieved,
+                Qt::ConnectionType::DirectConnection
+            );
+        }
+
     private:
         int variantId;
     };
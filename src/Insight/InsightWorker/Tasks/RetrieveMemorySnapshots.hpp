@@ -30,7 +30,5 @@ namespace Bloom
 
     private:
         Targets::TargetMemoryType memoryType;
-
-        std::vector<MemorySnapshot> getSnapshots(Targets::TargetMemoryType memoryType);
     };
 }
@@ -0,0 +1,82 @@
+#include "SearchMemoryBuffer.hpp"
+
+#include <cstring>
+
+namespace Bloom
+{
+    SearchMemoryBuffer::SearchMemoryBuffer(
+        const SharedMemoryBuffer& data,
+        Targets::TargetMemoryAddress startAddress,
+        const std::vector<unsigned char>& pattern,
+        const std::vector<ExcludedMemoryRegion>& excludedRegions
+    )
+        : data(data)
+        , startAddress(startAddress)
+        , pattern(pattern)
+    {
+        auto excludedRanges = std::vector<Targets::TargetMemoryAddressRange>();
+        excludedRanges.reserve(excludedRegions.size());
+
+        for (const auto& excludedRegion : excludedRegions) {
+            excludedRanges.push_back(excludedRegion.addressRange);
+        }
+
+        this->excludedRangeIndex = Targets::TargetMemoryAddressRangeIndex(excludedRanges);
+    }
+
+    void SearchMemoryBuffer::run(Services::TargetControllerService&) {
+        auto matches = std::vector<Targets::TargetMemoryAddressRange>();
+        auto truncated = false;
+
+        const auto patternSize = this->pattern.size();
+
+        if (patternSize > 0 && patternSize <= this->data.size()) {
+            /*
+             * Matches can span page boundaries, so we scan a contiguous copy of the buffer. The copy is cheap in
+             * comparison to the scan (a 256KiB flash buffer is copied in microseconds).
+             */
+            const auto content = this->data.toBuffer();
+
+            const auto* const begin = content.data();
+            const auto* const lastCandidate = begin + (content.size() - patternSize);
+            const auto* position = begin;
+
+            while (position <= lastCandidate) {
+                const auto* candidate = static_cast<const unsigned char*>(
+                    std::memchr(position, this->pattern.front(), static_cast<std::size_t>(lastCandidate - position) + 1)
+                );
+
+                if (candidate == nullptr) {
+                    break;
+                }
+
+                if (std::memcmp(candidate + 1, this->pattern.data() + 1, patternSize - 1) != 0) {
+                    position = candidate + 1;
+                    continue;
+                }
+
+                const auto matchStartAddress = this->startAddress
+                    + static_cast<Targets::TargetMemoryAddress>(candidate - begin);
+                const auto matchRange = Targets::TargetMemoryAddressRange(
+                    matchStartAddress,
+                    matchStartAddress + static_cast<Targets::TargetMemoryAddress>(patternSize) - 1
+                );
+
+                position = candidate + patternSize;
+
+                if (this->excludedRangeIndex.intersects(matchRange)) {
+                    continue;
+                }
+
+                if (matches.size() >= SearchMemoryBuffer::MAXIMUM_MATCHES) {
+                    truncated = true;
+                    break;
+                }
+
+                matches.push_back(matchRange);
+            }
+        }
+
+        emit this->searchCompleted(std::move(matches), truncated);
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+#include "InsightWorkerTask.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetMemoryAddressRangeIndex.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/ExcludedMemoryRegion.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/SharedMemoryBuffer.hpp"
+
+namespace Bloom
+{
+    /**
+     * Searches a loaded memory buffer for all occurrences of a byte pattern. The target is not accessed.
+     *
+     * The scan is driven by memchr() (for the first byte of the pattern) and memcmp() (for the rest), both of which
+     * are vectorised in glibc, so even a full flash buffer is searched in a few milliseconds.
+     *
+     * Matches are non-overlapping. Matches that intersect any of the given excluded regions are discarded, as the
+     * content of those regions was never read from the target.
+     */
+    class SearchMemoryBuffer: public InsightWorkerTask
+    {
+        Q_OBJECT
+
+    public:
+        /**
+         * The search stops after this many matches, to bound the size of the resulting selection.
+         */
+        static constexpr std::size_t MAXIMUM_MATCHES = 65536;
+
+        SearchMemoryBuffer(
+            const SharedMemoryBuffer& data,
+            Targets::TargetMemoryAddress startAddress,
+            const std::vector<unsigned char>& pattern,
+            const std::vector<ExcludedMemoryRegion>& excludedRegions
+        );
+
+        QString brief() const override {
+            return "Searching memory";
+        }
+
+        TaskGroups taskGroups() const override {
+            return TaskGroups();
+        };
+
+    signals:
+        /**
+         * @param matches
+         *  The address ranges of the matches, in ascending order.
+         *
+         * @param truncated
+         *  True if the search was stopped at SearchMemoryBuffer::MAXIMUM_MATCHES.
+         */
+        void searchCompleted(std::vector<Targets::TargetMemoryAddressRange> matches, bool truncated);
+
+    protected:
+        void run(Services::TargetControllerService&) override;
+
+    private:
+        SharedMemoryBuffer data;
+        Targets::TargetMemoryAddress startAddress;
+        std::vector<unsigned char> pattern;
+        Targets::TargetMemoryAddressRangeIndex excludedRangeIndex;
+    };
+}
@@ -0,0 +1,15 @@
+#include "SetTargetPinStateStreaming.hpp"
+
+namespace Bloom
+{
+    using Services::TargetControllerService;
+
+    void SetTargetPinStateStreaming::run(TargetControllerService& targetControllerService) {
+        if (this->variantId.has_value()) {
+            targetControllerService.startPinStateStreaming(*(this->variantId));
+            return;
+        }
+
+        targetControllerService.stopPinStateStreaming();
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <optional>
+
+#include "InsightWorkerTask.hpp"
+
+namespace Bloom
+{
+    /**
+     * Starts (for the given variant) or stops (given std::nullopt) pin state streaming. See
+     * TargetController::Commands::SetTargetPinStateStreaming.
+     */
+    class SetTargetPinStateStreaming: public InsightWorkerTask
+    {
+        Q_OBJECT
+
+    public:
+        explicit SetTargetPinStateStreaming(std::optional<int> variantId)
+            : variantId(variantId)
+        {}
+
+        QString brief() const override {
+            return this->variantId.has_value()
+                ? "Starting target pin state streaming"
+                : "Stopping target pin state streaming";
+        }
+
+        TaskGroups taskGroups() const override {
+            return TaskGroups({
+                TaskGroup::USES_TARGET_CONTROLLER,
+            });
+        };
+
+    protected:
+        void run(Services::TargetControllerService& targetControllerService) override;
+
+    private:
+        std::optional<int> variantId;
+    };
+}
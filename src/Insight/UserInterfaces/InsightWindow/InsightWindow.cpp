@@ -6,6 +6,7 @@
 
 #include "UiLoader.hpp"
 #include "Widgets/RotatableLabel.hpp"
+#include "Widgets/Dialog/Dialog.hpp"
 
 #include "Widgets/TargetWidgets/DIP/DualInlinePackageWidget.hpp"
 #include "Widgets/TargetWidgets/QFP/QuadFlatPackageWidget.hpp"
@@ -297,6 +298,12 @@ namespace Bloom
             this,
             &InsightWindow::onProgrammingModeDisabled
         );
+        QObject::connect(
+            insightSignals,
+            &InsightSignals::timingAnalysisCompleted,
+            this,
+            &InsightWindow::onTimingAnalysisCompleted
+        );
     }
 
     void InsightWindow::init(TargetDescriptor targetDescriptor) {
@@ -589,6 +596,7 @@ namespace Bloom
         auto* leftPanelLayout = this->leftPanel->layout();
         this->targetRegistersSidePane = new TargetRegistersPaneWidget(
             this->targetDescriptor,
+            this->insightConfig.registerHistoryCapacity,
             *(this->insightProjectSettings.registersPaneState),
             this->leftPanel
         );
@@ -610,9 +618,6 @@ namespace Bloom
         this->targetRegistersButton->setDisabled(false);
         this->onRegistersPaneStateChanged();
 
-        auto& memoryInspectionPaneSettingsByMemoryType =
-            this->insightProjectSettings.memoryInspectionPaneSettingsByMemoryType;
-
         // Target memory inspection panes
         auto* bottomPanelLayout = this->bottomPanel->layout();
 
@@ -625,13 +630,10 @@ namespace Bloom
                 this->insightProjectSettings.ramInspectionPaneState = PaneState(false, true, std::nullopt);
             }
 
-            if (!memoryInspectionPaneSettingsByMemoryType.contains(TargetMemoryType::RAM)) {
-                memoryInspectionPaneSettingsByMemoryType[TargetMemoryType::RAM] = TargetMemoryInspectionPaneSettings();
-            }
-
             this->ramInspectionPane = new TargetMemoryInspectionPane(
                 ramDescriptorIt->second,
-                memoryInspectionPaneSettingsByMemoryType[TargetMemoryType::RAM],
+                this->targetDescriptor.runtimeMemoryAccessSupported,
+                this->insightProjectSettings.memoryInspectionPaneSettings(TargetMemoryType::RAM),
                 *(this->insightProjectSettings.ramInspectionPaneState),
                 this->bottomPanel
             );
@@ -666,13 +668,10 @@ namespace Bloom
                 this->insightProjectSettings.eepromInspectionPaneState = PaneState(false, true, std::nullopt);
             }
 
-            if (!memoryInspectionPaneSettingsByMemoryType.contains(TargetMemoryType::EEPROM)) {
-                memoryInspectionPaneSettingsByMemoryType[TargetMemoryType::EEPROM] = TargetMemoryInspectionPaneSettings();
-            }
-
             this->eepromInspectionPane = new TargetMemoryInspectionPane(
                 eepromDescriptorIt->second,
-                memoryInspectionPaneSettingsByMemoryType[TargetMemoryType::EEPROM],
+                this->targetDescriptor.runtimeMemoryAccessSupported,
+                this->insightProjectSettings.memoryInspectionPaneSettings(TargetMemoryType::EEPROM),
                 *(this->insightProjectSettings.eepromInspectionPaneState),
                 this->bottomPanel
             );
@@ -707,13 +706,10 @@ namespace Bloom
                 this->insightProjectSettings.flashInspectionPaneState = PaneState(false, true, std::nullopt);
             }
 
-            if (!memoryInspectionPaneSettingsByMemoryType.contains(TargetMemoryType::FLASH)) {
-                memoryInspectionPaneSettingsByMemoryType[TargetMemoryType::FLASH] = TargetMemoryInspectionPaneSettings();
-            }
-
             this->flashInspectionPane = new TargetMemoryInspectionPane(
                 flashDescriptorIt->second,
-                memoryInspectionPaneSettingsByMemoryType[TargetMemoryType::FLASH],
+                this->targetDescriptor.runtimeMemoryAccessSupported,
+                this->insightProjectSettings.memoryInspectionPaneSettings(TargetMemoryType::FLASH),
                 *(this->insightProjectSettings.flashInspectionPaneState),
                 this->bottomPanel
             );
@@ -1234,4 +1230,10 @@ namespace Bloom
     void InsightWindow::onProgrammingModeDisabled() {
         this->onTargetStateUpdate(this->targetState);
     }
+
+    void InsightWindow::onTimingAnalysisCompleted(const QString& summary) {
+        // The summary's histogram is aligned with spaces, so it must be rendered in a monospace font
+        auto* dialog = new Dialog("Timing Analysis", "<pre>" + summary.toHtmlEscaped() + "</pre>", this);
+        dialog->show();
+    }
 }
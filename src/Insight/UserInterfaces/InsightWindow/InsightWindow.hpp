@@ -146,5 +146,6 @@ namespace Bloom
         void onFlashInspectionPaneStateChanged();
         void onProgrammingModeEnabled();
         void onProgrammingModeDisabled();
+        void onTimingAnalysisCompleted(const QString& summary);
     };
 }
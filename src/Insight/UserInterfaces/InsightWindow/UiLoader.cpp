@@ -1,6 +1,10 @@
 #include "UiLoader.hpp"
 
 #include <QtUiTools>
+#include <QFile>
+#include <QBuffer>
+
+#include "src/Exceptions/Exception.hpp"
 
 // Custom widgets
 #include "Widgets/Label.hpp"
@@ -18,11 +22,37 @@ namespace Bloom
 {
     using namespace Bloom::Widgets;
 
-    UiLoader::UiLoader(QObject* parent): QUiLoader(parent) {
-        this->customWidgetConstructorsByWidgetName = {
+    UiLoader::UiLoader(QObject* parent): QUiLoader(parent) {}
+
+    QWidget* UiLoader::load(const QString& uiFilePath, QWidget* parentWidget) {
+        auto uiBuffer = QBuffer();
+        uiBuffer.setData(UiLoader::readFile(uiFilePath));
+        uiBuffer.open(QIODevice::ReadOnly);
+
+        return this->load(&uiBuffer, parentWidget);
+    }
+
+    QString UiLoader::loadStylesheet(const QString& stylesheetFilePath) {
+        return QString::fromUtf8(UiLoader::readFile(stylesheetFilePath));
+    }
+
+    QWidget* UiLoader::createWidget(const QString& className, QWidget* parent, const QString& name) {
+        const auto& customWidgetConstructorsByWidgetName = UiLoader::customWidgetConstructorsByWidgetName();
+        const auto widgetConstructorIt = customWidgetConstructorsByWidgetName.find(className);
+
+        if (widgetConstructorIt != customWidgetConstructorsByWidgetName.end()) {
+            // This is a custom widget - call the mapped constructor
+            return widgetConstructorIt->second(parent, name);
+        }
+
+        return QUiLoader::createWidget(className, parent, name);
+    }
+
+    const std::map<QString, UiLoader::CustomWidgetConstructor>& UiLoader::customWidgetConstructorsByWidgetName() {
+        static const auto customWidgetConstructorsByWidgetName = std::map<QString, CustomWidgetConstructor>({
             {
                 "Label",
-                [this] (QWidget* parent, const QString& name) {
+                [] (QWidget* parent, const QString& name) {
                     auto* widget = new Label(parent);
                     widget->setObjectName(name);
                     widget->setStyleSheet(parent->styleSheet());
@@ -31,7 +61,7 @@ namespace Bloom
             },
             {
                 "RotatableLabel",
-                [this] (QWidget* parent, const QString& name) {
+                [] (QWidget* parent, const QString& name) {
                     auto* widget = new RotatableLabel("", parent);
                     widget->setObjectName(name);
                     widget->setStyleSheet(parent->styleSheet());
@@ -40,7 +70,7 @@ namespace Bloom
             },
             {
                 "LabeledSeparator",
-                [this] (QWidget* parent, const QString& name) {
+                [] (QWidget* parent, const QString& name) {
                     auto* widget = new LabeledSeparator(parent);
                     widget->setObjectName(name);
                     widget->setStyleSheet(parent->styleSheet());
@@ -49,7 +79,7 @@ namespace Bloom
             },
             {
                 "TextInput",
-                [this] (QWidget* parent, const QString& name) {
+                [] (QWidget* parent, const QString& name) {
                     auto* widget = new TextInput(parent);
                     widget->setObjectName(name);
                     widget->setStyleSheet(parent->styleSheet());
@@ -58,7 +88,7 @@ namespace Bloom
             },
             {
                 "PlainTextEdit",
-                [this] (QWidget* parent, const QString& name) {
+                [] (QWidget* parent, const QString& name) {
                     auto* widget = new PlainTextEdit(parent);
                     widget->setObjectName(name);
                     widget->setStyleSheet(parent->styleSheet());
@@ -67,7 +97,7 @@ namespace Bloom
             },
             {
                 "PushButton",
-                [this] (QWidget* parent, const QString& name) {
+                [] (QWidget* parent, const QString& name) {
                     auto* widget = new PushButton(parent);
                     widget->setObjectName(name);
                     widget->setStyleSheet(parent->styleSheet());
@@ -76,7 +106,7 @@ namespace Bloom
             },
             {
                 "ExpandingHeightScrollAreaWidget",
-                [this] (QWidget* parent, const QString& name) {
+                [] (QWidget* parent, const QString& name) {
                     auto* widget = new ExpandingHeightScrollAreaWidget(parent);
                     widget->setObjectName(name);
                     widget->setStyleSheet(parent->styleSheet());
@@ -85,7 +115,7 @@ namespace Bloom
             },
             {
                 "SvgWidget",
-                [this] (QWidget* parent, const QString& name) {
+                [] (QWidget* parent, const QString& name) {
                     auto* widget = new SvgWidget(parent);
                     widget->setObjectName(name);
                     widget->setStyleSheet(parent->styleSheet());
@@ -94,7 +124,7 @@ namespace Bloom
             },
             {
                 "SvgToolButton",
-                [this] (QWidget* parent, const QString& name) {
+                [] (QWidget* parent, const QString& name) {
                     auto* widget = new SvgToolButton(parent);
                     widget->setObjectName(name);
                     widget->setStyleSheet(parent->styleSheet());
@@ -103,24 +133,40 @@ namespace Bloom
             },
             {
                 "TargetPackageWidgetContainer",
-                [this] (QWidget* parent, const QString& name) {
+                [] (QWidget* parent, const QString& name) {
                     auto* widget = new InsightTargetWidgets::TargetPackageWidgetContainer(parent);
                     widget->setObjectName(name);
                     widget->setStyleSheet(parent->styleSheet());
                     return widget;
                 }
             },
-        };
+        });
+
+        return customWidgetConstructorsByWidgetName;
     }
 
-    QWidget* UiLoader::createWidget(const QString& className, QWidget* parent, const QString& name) {
-        const auto widgetConstructorIt = this->customWidgetConstructorsByWidgetName.find(className);
+    const QByteArray& UiLoader::readFile(const QString& filePath) {
+        static auto fileContentsByFilePath = std::map<QString, QByteArray>();
 
-        if (widgetConstructorIt != this->customWidgetConstructorsByWidgetName.end()) {
-            // This is a custom widget - call the mapped constructor
-            return widgetConstructorIt->second(parent, name);
+#ifdef BLOOM_DEBUG_BUILD
+        /*
+         * Debug builds load resources from the source tree (see BLOOM_COMPILED_RESOURCES_PATH_OVERRIDE), to allow
+         * for tweaks without recompiling. We read the files each time, so that tweaks don't require a restart either.
+         */
+        fileContentsByFilePath.erase(filePath);
+#endif
+
+        auto fileContentsIt = fileContentsByFilePath.find(filePath);
+        if (fileContentsIt == fileContentsByFilePath.end()) {
+            auto file = QFile(filePath);
+
+            if (!file.open(QFile::ReadOnly)) {
+                throw Exceptions::Exception("Failed to open file \"" + filePath.toStdString() + "\"");
+            }
+
+            fileContentsIt = fileContentsByFilePath.emplace(filePath, file.readAll()).first;
         }
 
-        return QUiLoader::createWidget(className, parent, name);
+        return fileContentsIt->second;
     }
 }
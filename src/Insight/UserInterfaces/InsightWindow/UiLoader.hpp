@@ -2,6 +2,10 @@
 
 #include <QUiLoader>
 #include <QSize>
+#include <QString>
+#include <QByteArray>
+#include <map>
+#include <functional>
 
 namespace Bloom
 {
@@ -12,12 +16,52 @@ namespace Bloom
     public:
         explicit UiLoader(QObject* parent);
 
+        using QUiLoader::load;
+
+        /**
+         * Loads a form from the given UI file.
+         *
+         * The content of each UI file is read once and retained, for subsequent loads. Some forms are loaded many
+         * times (one per list item, for example).
+         *
+         * @param uiFilePath
+         * @param parentWidget
+         *
+         * @return
+         */
+        QWidget* load(const QString& uiFilePath, QWidget* parentWidget);
+
+        /**
+         * Reads the given stylesheet file. As with UI files, the content of each stylesheet file is read once and
+         * retained.
+         *
+         * @param stylesheetFilePath
+         *
+         * @return
+         */
+        static QString loadStylesheet(const QString& stylesheetFilePath);
+
         QWidget* createWidget(const QString& className, QWidget* parent, const QString& name) override;
 
     private:
-        std::map<
-            QString,
-            std::function<QWidget*(QWidget* parent, const QString& name)>
-        > customWidgetConstructorsByWidgetName = {};
+        using CustomWidgetConstructor = std::function<QWidget*(QWidget* parent, const QString& name)>;
+
+        /**
+         * The custom widget constructors don't depend on the loader, so they're constructed once, for all loaders.
+         *
+         * @return
+         */
+        static const std::map<QString, CustomWidgetConstructor>& customWidgetConstructorsByWidgetName();
+
+        /**
+         * Returns the content of the given file, reading it if it hasn't been read before.
+         *
+         * Insight's widgets are only constructed on the GUI thread, so no synchronisation is required here.
+         *
+         * @param filePath
+         *
+         * @return
+         */
+        static const QByteArray& readFile(const QString& filePath);
     };
 }
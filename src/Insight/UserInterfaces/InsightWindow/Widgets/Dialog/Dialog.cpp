@@ -1,15 +1,10 @@
 #include "Dialog.hpp"
 
-#include <QFile>
-
 #include "src/Insight/UserInterfaces/InsightWindow/UiLoader.hpp"
 #include "src/Services/PathService.hpp"
-#include "src/Exceptions/Exception.hpp"
 
 namespace Bloom::Widgets
 {
-    using Bloom::Exceptions::Exception;
-
     Dialog::Dialog(
         const QString& windowTitle,
         const QString& text,
@@ -21,30 +16,19 @@ namespace Bloom::Widgets
         this->setAttribute(Qt::WA_DeleteOnClose, true);
         this->setWindowTitle(windowTitle);
 
-        auto dialogUiFile = QFile(
-            QString::fromStdString(Services::PathService::compiledResourcesPath()
-                + "/src/Insight/UserInterfaces/InsightWindow/Widgets/Dialog/UiFiles/Dialog.ui"
-            )
-        );
-
-        auto dialogStylesheet = QFile(
+        this->setStyleSheet(UiLoader::loadStylesheet(
             QString::fromStdString(Services::PathService::compiledResourcesPath()
                 + "/src/Insight/UserInterfaces/InsightWindow/Widgets/Dialog/Stylesheets/Dialog.qss"
             )
-        );
-
-        if (!dialogUiFile.open(QFile::ReadOnly)) {
-            throw Exception("Failed to open Dialog UI file");
-        }
-
-        if (!dialogStylesheet.open(QFile::ReadOnly)) {
-            throw Exception("Failed to open Dialog stylesheet file");
-        }
-
-        this->setStyleSheet(dialogStylesheet.readAll());
+        ));
 
         auto uiLoader = UiLoader(this);
-        this->container = uiLoader.load(&dialogUiFile, this);
+        this->container = uiLoader.load(
+            QString::fromStdString(Services::PathService::compiledResourcesPath()
+                + "/src/Insight/UserInterfaces/InsightWindow/Widgets/Dialog/UiFiles/Dialog.ui"
+            ),
+            this
+        );
 
         this->textLabel = this->container->findChild<Label*>("text-label");
         this->actionLayout = this->container->findChild<QHBoxLayout*>("actions-layout");
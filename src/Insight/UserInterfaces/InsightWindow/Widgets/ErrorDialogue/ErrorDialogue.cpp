@@ -1,16 +1,12 @@
 #include "ErrorDialogue.hpp"
 
 #include <QHBoxLayout>
-#include <QFile>
 
 #include "src/Insight/UserInterfaces/InsightWindow/UiLoader.hpp"
 #include "src/Services/PathService.hpp"
-#include "src/Exceptions/Exception.hpp"
 
 namespace Bloom::Widgets
 {
-    using Bloom::Exceptions::Exception;
-
     ErrorDialogue::ErrorDialogue(
         const QString& windowTitle,
         const QString& errorMessage,
@@ -22,30 +18,19 @@ namespace Bloom::Widgets
         this->setAttribute(Qt::WA_DeleteOnClose, true);
         this->setWindowTitle(windowTitle);
 
-        auto dialogueUiFile = QFile(
-            QString::fromStdString(Services::PathService::compiledResourcesPath()
-                + "/src/Insight/UserInterfaces/InsightWindow/Widgets/ErrorDialogue/UiFiles/ErrorDialogue.ui"
-            )
-        );
-
-        auto dialogueStylesheet = QFile(
+        this->setStyleSheet(UiLoader::loadStylesheet(
             QString::fromStdString(Services::PathService::compiledResourcesPath()
                 + "/src/Insight/UserInterfaces/InsightWindow/Widgets/ErrorDialogue/Stylesheets/ErrorDialogue.qss"
             )
-        );
-
-        if (!dialogueUiFile.open(QFile::ReadOnly)) {
-            throw Exception("Failed to open ErrorDialogue UI file");
-        }
-
-        if (!dialogueStylesheet.open(QFile::ReadOnly)) {
-            throw Exception("Failed to open ErrorDialogue stylesheet file");
-        }
-
-        this->setStyleSheet(dialogueStylesheet.readAll());
+        ));
 
         auto uiLoader = UiLoader(this);
-        this->container = uiLoader.load(&dialogueUiFile, this);
+        this->container = uiLoader.load(
+            QString::fromStdString(Services::PathService::compiledResourcesPath()
+                + "/src/Insight/UserInterfaces/InsightWindow/Widgets/ErrorDialogue/UiFiles/ErrorDialogue.ui"
+            ),
+            this
+        );
 
         this->errorMessageDescriptionLabel = this->container->findChild<Label*>(
             "error-message-description-label"
@@ -1,6 +1,7 @@
 #include "SvgWidget.hpp"
 
 #include <QPainter>
+#include <QPixmapCache>
 #include <cmath>
 
 namespace Bloom::Widgets
@@ -32,8 +33,13 @@ namespace Bloom::Widgets
     }
 
     void SvgWidget::paintEvent(QPaintEvent* paintEvent) {
+        const auto pixmap = this->getPixmap(this->devicePixelRatioF());
+        if (pixmap.isNull()) {
+            return;
+        }
+
         auto painter = QPainter(this);
-        auto svgSize = this->renderer.defaultSize();
+        const auto svgSize = (QSizeF(pixmap.size()) / pixmap.devicePixelRatio()).toSize();
         auto margins = this->contentsMargins();
         const auto containerSize = this->frameSize();
 
@@ -51,7 +57,7 @@ namespace Bloom::Widgets
             );
         }
 
-        this->renderer.render(&painter, QRectF(
+        painter.drawPixmap(QRectF(
             std::ceil(
                 static_cast<float>(containerSize.width() - svgSize.width()) / 2 + static_cast<float>(margins.left())
             ),
@@ -60,19 +66,55 @@ namespace Bloom::Widgets
             ),
             svgSize.width(),
             svgSize.height()
-        ));
+        ), pixmap, QRectF(pixmap.rect()));
     }
 
     void SvgWidget::changeEvent(QEvent* event) {
         if (event->type() == QEvent::EnabledChange && !this->disabledSvgFilePath.isEmpty()) {
-            if (!this->isEnabled()) {
-                this->renderer.load(this->disabledSvgFilePath);
+            this->update();
+        }
+    }
 
-            } else {
-                this->renderer.load(this->svgFilePath);
-            }
+    QPixmap SvgWidget::getPixmap(qreal devicePixelRatio) {
+        const auto& filePath = !this->isEnabled() && !this->disabledSvgFilePath.isEmpty()
+            ? this->disabledSvgFilePath
+            : this->svgFilePath;
 
-            this->repaint();
+        if (filePath.isEmpty()) {
+            return QPixmap();
         }
+
+        const auto cacheKey = filePath + "@" + QString::number(devicePixelRatio);
+
+        auto pixmap = QPixmap();
+        if (QPixmapCache::find(cacheKey, &pixmap)) {
+            return pixmap;
+        }
+
+        if (this->loadedSvgFilePath != filePath) {
+            this->renderer.load(filePath);
+            this->loadedSvgFilePath = filePath;
+        }
+
+        if (!this->renderer.isValid()) {
+            return QPixmap();
+        }
+
+        const auto svgSize = this->renderer.defaultSize();
+        pixmap = QPixmap(
+            static_cast<int>(std::ceil(svgSize.width() * devicePixelRatio)),
+            static_cast<int>(std::ceil(svgSize.height() * devicePixelRatio))
+        );
+        pixmap.setDevicePixelRatio(devicePixelRatio);
+        pixmap.fill(Qt::GlobalColor::transparent);
+
+        {
+            auto painter = QPainter(&pixmap);
+            painter.setRenderHint(QPainter::RenderHint::Antialiasing, true);
+            this->renderer.render(&painter, QRectF(0, 0, svgSize.width(), svgSize.height()));
+        }
+
+        QPixmapCache::insert(cacheKey, pixmap);
+        return pixmap;
     }
 }
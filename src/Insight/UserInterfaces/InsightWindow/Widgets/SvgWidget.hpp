@@ -2,6 +2,7 @@
 
 #include <QFrame>
 #include <QSvgRenderer>
+#include <QPixmap>
 #include <QString>
 #include <QEvent>
 #include <QSize>
@@ -23,7 +24,7 @@ namespace Bloom::Widgets
 
         void setSvgFilePath(const QString& svgFilePath) {
             this->svgFilePath = svgFilePath;
-            this->renderer.load(this->svgFilePath);
+            this->update();
         }
 
         QString getSvgFilePath() {
@@ -32,6 +33,7 @@ namespace Bloom::Widgets
 
         void setDisabledSvgFilePath(const QString& disabledSvgFilePath) {
             this->disabledSvgFilePath = disabledSvgFilePath;
+            this->update();
         }
 
         [[nodiscard]] QString getDisabledSvgFilePath() const {
@@ -89,9 +91,30 @@ namespace Bloom::Widgets
         QSvgRenderer renderer = new QSvgRenderer(this);
         QString svgFilePath;
         QString disabledSvgFilePath;
+
+        /**
+         * The file currently loaded into the renderer. The renderer is only used when the rasterised SVG isn't in
+         * the pixmap cache, so we load the file lazily.
+         */
+        QString loadedSvgFilePath;
         int containerWidth = 0;
         int containerHeight = 0;
         int angle = 0;
         QPropertyAnimation* spinningAnimation = nullptr;
+
+        /**
+         * Returns the SVG for the widget's current state (enabled/disabled), rasterised at the given device pixel
+         * ratio.
+         *
+         * Rasterised SVGs are kept in the global QPixmapCache, keyed by file path and device pixel ratio, so they're
+         * shared between all SvgWidget instances (every SvgToolButton with the same icon, for example). This means
+         * paint events (of which there are many, during spin animations) only cost a blit.
+         *
+         * @param devicePixelRatio
+         *
+         * @return
+         *  A null pixmap if the SVG file couldn't be loaded.
+         */
+        QPixmap getPixmap(qreal devicePixelRatio);
     };
 }
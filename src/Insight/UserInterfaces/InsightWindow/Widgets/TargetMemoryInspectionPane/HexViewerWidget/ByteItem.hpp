@@ -10,6 +10,12 @@
 
 namespace Bloom::Widgets
 {
+    /**
+     * A byte item exists for every address in the hex viewer, so we keep it small. The value of the byte lives in the
+     * hex viewer's shared memory buffer, and its selection state in the ByteSelection (both looked up by address, at
+     * paint time). All that remains here is the item's place in the hierarchy (parent and relative position), and
+     * its flags, as bit-fields.
+     */
 #pragma pack(push, 1)
     class ByteItem: public HexViewerItem
     {
@@ -20,7 +26,6 @@ namespace Bloom::Widgets
         static constexpr int RIGHT_MARGIN = 6;
         static constexpr int BOTTOM_MARGIN = 6;
 
-        bool selected:1 = false;
         bool excluded:1 = false;
         bool grouped:1 = false;
         bool stackMemory:1 = false;
@@ -33,4 +38,10 @@ namespace Bloom::Widgets
         }
     };
 #pragma pack(pop)
+
+    /*
+     * A vtable pointer, a parent pointer, the address, the relative position and a byte of flags. Anything more will
+     * be multiplied by the size of the memory (over 256K byte items for some flash memories).
+     */
+    static_assert(sizeof(ByteItem) <= 32);
 }
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <vector>
+#include <cassert>
+
+#include "ByteItem.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::Widgets
+{
+    /**
+     * Holds a ByteItem for every address in a contiguous range of memory.
+     *
+     * The hex viewer can present hundreds of thousands of bytes. Holding the byte items in a node-based map would
+     * mean one heap allocation per byte, and pointer chasing on every lookup. Instead, we hold them in a single
+     * contiguous block, and compute their position from the address.
+     *
+     * Only the item itself is held per byte - see ByteItem for what that consists of.
+     *
+     * The container never reallocates after construction, so references and pointers to the byte items remain valid
+     * for its lifetime.
+     */
+    class ByteItemContainer
+    {
+    public:
+        using IteratorType = std::vector<ByteItem>::iterator;
+        using ConstIteratorType = std::vector<ByteItem>::const_iterator;
+
+        explicit ByteItemContainer(const Targets::TargetMemoryAddressRange& addressRange)
+            : startAddress(addressRange.startAddress)
+        {
+            const auto itemCount = addressRange.endAddress - addressRange.startAddress + 1;
+            this->byteItems.reserve(itemCount);
+
+            for (auto address = addressRange.startAddress; address <= addressRange.endAddress; ++address) {
+                this->byteItems.emplace_back(address);
+            }
+        }
+
+        [[nodiscard]] bool contains(Targets::TargetMemoryAddress address) const {
+            return address >= this->startAddress && (address - this->startAddress) < this->byteItems.size();
+        }
+
+        ByteItem& at(Targets::TargetMemoryAddress address) {
+            assert(this->contains(address));
+            return this->byteItems[address - this->startAddress];
+        }
+
+        const ByteItem& at(Targets::TargetMemoryAddress address) const {
+            assert(this->contains(address));
+            return this->byteItems[address - this->startAddress];
+        }
+
+        /**
+         * Returns a pointer to the byte item for the given address, or a nullptr if the address is out of range.
+         *
+         * @param address
+         * @return
+         */
+        ByteItem* find(Targets::TargetMemoryAddress address) {
+            return this->contains(address) ? &(this->byteItems[address - this->startAddress]) : nullptr;
+        }
+
+        /**
+         * Returns the offset of the given address from the start of the range. The byte item for the address resides
+         * at this offset.
+         *
+         * @param address
+         * @return
+         */
+        [[nodiscard]] std::size_t offsetOf(Targets::TargetMemoryAddress address) const {
+            assert(this->contains(address));
+            return address - this->startAddress;
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return this->byteItems.size();
+        }
+
+        IteratorType begin() {
+            return this->byteItems.begin();
+        }
+
+        IteratorType end() {
+            return this->byteItems.end();
+        }
+
+        [[nodiscard]] ConstIteratorType begin() const {
+            return this->byteItems.begin();
+        }
+
+        [[nodiscard]] ConstIteratorType end() const {
+            return this->byteItems.end();
+        }
+
+    private:
+        Targets::TargetMemoryAddress startAddress = 0;
+        std::vector<ByteItem> byteItems;
+    };
+}
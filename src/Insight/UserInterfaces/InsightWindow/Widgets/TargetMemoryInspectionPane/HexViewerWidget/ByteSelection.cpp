@@ -0,0 +1,167 @@
+#include "ByteSelection.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace Bloom::Widgets
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryAddressRange;
+
+    bool ByteSelection::contains(TargetMemoryAddress address) const {
+        // Find the last range that starts at or before the address
+        auto rangeIt = this->rangeEndAddressesByStartAddress.upper_bound(address);
+        if (rangeIt == this->rangeEndAddressesByStartAddress.begin()) {
+            return false;
+        }
+
+        --rangeIt;
+        return address <= rangeIt->second;
+    }
+
+    std::vector<TargetMemoryAddressRange> ByteSelection::ranges() const {
+        auto output = std::vector<TargetMemoryAddressRange>();
+        output.reserve(this->rangeEndAddressesByStartAddress.size());
+
+        for (const auto& [startAddress, endAddress] : this->rangeEndAddressesByStartAddress) {
+            output.emplace_back(startAddress, endAddress);
+        }
+
+        return output;
+    }
+
+    std::vector<TargetMemoryAddressRange> ByteSelection::rangesWithin(
+        const TargetMemoryAddressRange& addressRange
+    ) const {
+        auto output = std::vector<TargetMemoryAddressRange>();
+
+        auto rangeIt = this->rangeEndAddressesByStartAddress.upper_bound(addressRange.startAddress);
+        if (rangeIt != this->rangeEndAddressesByStartAddress.begin()) {
+            // The preceding range may extend into the given range
+            --rangeIt;
+        }
+
+        for (; rangeIt != this->rangeEndAddressesByStartAddress.end(); ++rangeIt) {
+            const auto& [startAddress, endAddress] = *rangeIt;
+
+            if (startAddress > addressRange.endAddress) {
+                break;
+            }
+
+            if (endAddress < addressRange.startAddress) {
+                continue;
+            }
+
+            output.emplace_back(
+                std::max(startAddress, addressRange.startAddress),
+                std::min(endAddress, addressRange.endAddress)
+            );
+        }
+
+        return output;
+    }
+
+    std::optional<TargetMemoryAddressRange> ByteSelection::boundingRange() const {
+        if (this->rangeEndAddressesByStartAddress.empty()) {
+            return std::nullopt;
+        }
+
+        return TargetMemoryAddressRange(
+            this->rangeEndAddressesByStartAddress.begin()->first,
+            this->rangeEndAddressesByStartAddress.rbegin()->second
+        );
+    }
+
+    std::optional<TargetMemoryAddress> ByteSelection::closestAddressBelow(TargetMemoryAddress address) const {
+        auto rangeIt = this->rangeEndAddressesByStartAddress.lower_bound(address);
+        if (rangeIt == this->rangeEndAddressesByStartAddress.begin()) {
+            return std::nullopt;
+        }
+
+        --rangeIt;
+
+        // The range starts below the address, so it can't underflow here
+        return std::min(rangeIt->second, address - 1);
+    }
+
+    void ByteSelection::add(const TargetMemoryAddressRange& addressRange) {
+        auto startAddress = addressRange.startAddress;
+        auto endAddress = addressRange.endAddress;
+
+        auto& ranges = this->rangeEndAddressesByStartAddress;
+
+        /*
+         * Absorb all ranges that overlap with, or are adjacent to, the new range. The first candidate is the last
+         * range that starts at or before the new range.
+         */
+        auto rangeIt = ranges.upper_bound(startAddress);
+        if (rangeIt != ranges.begin()) {
+            const auto previousIt = std::prev(rangeIt);
+
+            if (startAddress == 0 || previousIt->second >= startAddress - 1) {
+                rangeIt = previousIt;
+            }
+        }
+
+        while (
+            rangeIt != ranges.end()
+            && (
+                endAddress == std::numeric_limits<TargetMemoryAddress>::max()
+                || rangeIt->first <= endAddress + 1
+            )
+        ) {
+            startAddress = std::min(startAddress, rangeIt->first);
+            endAddress = std::max(endAddress, rangeIt->second);
+
+            this->selectedByteCount -= rangeIt->second - rangeIt->first + 1;
+            rangeIt = ranges.erase(rangeIt);
+        }
+
+        ranges.emplace_hint(rangeIt, startAddress, endAddress);
+        this->selectedByteCount += endAddress - startAddress + 1;
+    }
+
+    void ByteSelection::remove(const TargetMemoryAddressRange& addressRange) {
+        auto& ranges = this->rangeEndAddressesByStartAddress;
+
+        auto rangeIt = ranges.upper_bound(addressRange.startAddress);
+        if (rangeIt != ranges.begin()) {
+            --rangeIt;
+        }
+
+        while (rangeIt != ranges.end() && rangeIt->first <= addressRange.endAddress) {
+            const auto startAddress = rangeIt->first;
+            const auto endAddress = rangeIt->second;
+
+            if (endAddress < addressRange.startAddress) {
+                ++rangeIt;
+                continue;
+            }
+
+            this->selectedByteCount -= endAddress - startAddress + 1;
+            rangeIt = ranges.erase(rangeIt);
+
+            // Retain whatever lies outside the removed range
+            if (startAddress < addressRange.startAddress) {
+                ranges.emplace_hint(rangeIt, startAddress, addressRange.startAddress - 1);
+                this->selectedByteCount += addressRange.startAddress - startAddress;
+            }
+
+            if (endAddress > addressRange.endAddress) {
+                ranges.emplace_hint(rangeIt, addressRange.endAddress + 1, endAddress);
+                this->selectedByteCount += endAddress - addressRange.endAddress;
+                break;
+            }
+        }
+    }
+
+    void ByteSelection::toggle(TargetMemoryAddress address) {
+        if (this->contains(address)) {
+            this->remove(address);
+            return;
+        }
+
+        this->add(address);
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <vector>
+#include <optional>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::Widgets
+{
+    /**
+     * The set of bytes selected in a hex viewer, held as disjoint address ranges.
+     *
+     * Selections are typically made up of a handful of contiguous runs (a select-all on a 256KiB flash memory is a
+     * single range), so the cost of every operation depends on the number of ranges, as opposed to the number of
+     * selected bytes. Adjacent and overlapping ranges are merged as they're added.
+     */
+    class ByteSelection
+    {
+    public:
+        ByteSelection() = default;
+
+        [[nodiscard]] bool empty() const {
+            return this->rangeEndAddressesByStartAddress.empty();
+        }
+
+        /**
+         * The total number of selected bytes.
+         *
+         * @return
+         */
+        [[nodiscard]] std::size_t byteCount() const {
+            return this->selectedByteCount;
+        }
+
+        [[nodiscard]] bool contains(Targets::TargetMemoryAddress address) const;
+
+        /**
+         * Returns the selected address ranges, in ascending order.
+         *
+         * @return
+         */
+        [[nodiscard]] std::vector<Targets::TargetMemoryAddressRange> ranges() const;
+
+        /**
+         * Returns the selected address ranges that intersect with the given range, in ascending order. Ranges are
+         * clipped to the given range.
+         *
+         * @param addressRange
+         *
+         * @return
+         */
+        [[nodiscard]] std::vector<Targets::TargetMemoryAddressRange> rangesWithin(
+            const Targets::TargetMemoryAddressRange& addressRange
+        ) const;
+
+        /**
+         * Returns the range spanning the lowest and highest selected addresses.
+         *
+         * @return
+         *  std::nullopt if the selection is empty.
+         */
+        [[nodiscard]] std::optional<Targets::TargetMemoryAddressRange> boundingRange() const;
+
+        /**
+         * Returns the highest selected address that is below the given address.
+         *
+         * @param address
+         *
+         * @return
+         *  std::nullopt if no selected address is below the given address.
+         */
+        [[nodiscard]] std::optional<Targets::TargetMemoryAddress> closestAddressBelow(
+            Targets::TargetMemoryAddress address
+        ) const;
+
+        void add(const Targets::TargetMemoryAddressRange& addressRange);
+        void remove(const Targets::TargetMemoryAddressRange& addressRange);
+
+        void add(Targets::TargetMemoryAddress address) {
+            this->add(Targets::TargetMemoryAddressRange(address, address));
+        }
+
+        void remove(Targets::TargetMemoryAddress address) {
+            this->remove(Targets::TargetMemoryAddressRange(address, address));
+        }
+
+        void toggle(Targets::TargetMemoryAddress address);
+
+        void clear() {
+            this->rangeEndAddressesByStartAddress.clear();
+            this->selectedByteCount = 0;
+        }
+
+    private:
+        /**
+         * Inclusive end addresses of the selected ranges, mapped by their start addresses.
+         */
+        std::map<Targets::TargetMemoryAddress, Targets::TargetMemoryAddress> rangeEndAddressesByStartAddress;
+        std::size_t selectedByteCount = 0;
+    };
+}
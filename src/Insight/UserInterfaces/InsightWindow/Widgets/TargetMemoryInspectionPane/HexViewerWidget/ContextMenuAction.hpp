@@ -7,7 +7,7 @@
 #include <optional>
 
 #include "src/Targets/TargetMemory.hpp"
-#include "ByteItem.hpp"
+#include "ByteSelection.hpp"
 
 namespace Bloom::Widgets
 {
@@ -27,9 +27,7 @@ namespace Bloom::Widgets
          * If no callback is specified (ContextMenuAction::isEnabledCallback == std::nullopt), the menu action will
          * always be enabled.
          */
-        using IsEnabledCallbackType = std::function<
-            bool(const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>&)
-        >;
+        using IsEnabledCallbackType = std::function<bool(const ByteSelection&)>;
 
     public:
         std::optional<IsEnabledCallbackType> isEnabledCallback;
@@ -41,6 +39,6 @@ namespace Bloom::Widgets
         );
 
     signals:
-        void invoked(const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress);
+        void invoked(const ByteSelection& selection);
     };
 }
@@ -6,7 +6,7 @@ namespace Bloom::Widgets
 {
     FocusedRegionGroupItem::FocusedRegionGroupItem(
         const FocusedMemoryRegion& focusedRegion,
-        std::unordered_map<Targets::TargetMemoryAddress, ByteItem>& byteItemsByAddress,
+        ByteItemContainer& byteItemsByAddress,
         HexViewerItem* parent
     )
         : GroupItem(focusedRegion.addressRange.startAddress, parent)
@@ -57,10 +57,7 @@ namespace Bloom::Widgets
         const auto regionStartAddress = this->focusedMemoryRegion.addressRange.startAddress;
         const auto regionEndAddress = this->focusedMemoryRegion.addressRange.endAddress;
         const auto startIndex = regionStartAddress - hexViewerState.memoryDescriptor.addressRange.startAddress;
-        auto value = Targets::TargetMemoryBuffer(
-            hexViewerState.data->begin() + startIndex,
-            hexViewerState.data->begin() + startIndex + (regionEndAddress - regionStartAddress + 1)
-        );
+        auto value = hexViewerState.data->read(startIndex, regionEndAddress - regionStartAddress + 1);
 
         if (this->focusedMemoryRegion.endianness == Targets::TargetMemoryEndianness::LITTLE) {
             std::reverse(value.begin(), value.end());
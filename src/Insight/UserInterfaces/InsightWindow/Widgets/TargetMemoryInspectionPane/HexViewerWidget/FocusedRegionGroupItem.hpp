@@ -5,6 +5,7 @@
 
 #include "GroupItem.hpp"
 #include "ByteItem.hpp"
+#include "ByteItemContainer.hpp"
 
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/FocusedMemoryRegion.hpp"
 #include "src/Targets/TargetMemory.hpp"
@@ -21,7 +22,7 @@ namespace Bloom::Widgets
 
         FocusedRegionGroupItem(
             const FocusedMemoryRegion& focusedRegion,
-            std::unordered_map<Targets::TargetMemoryAddress, ByteItem>& byteItemsByAddress,
+            ByteItemContainer& byteItemsByAddress,
             HexViewerItem* parent
         );
 
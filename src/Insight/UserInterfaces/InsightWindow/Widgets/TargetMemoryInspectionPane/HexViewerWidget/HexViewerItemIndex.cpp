@@ -5,12 +5,8 @@
 
 namespace Bloom::Widgets
 {
-    HexViewerItemIndex::HexViewerItemIndex(
-        const TopLevelGroupItem* topLevelGroupItem,
-        const QGraphicsScene* hexViewerScene
-    )
+    HexViewerItemIndex::HexViewerItemIndex(const TopLevelGroupItem* topLevelGroupItem)
         : topLevelGroupItem(topLevelGroupItem)
-        , hexViewerScene(hexViewerScene)
     {
         this->refreshFlattenedItems();
     }
@@ -152,14 +148,16 @@ namespace Bloom::Widgets
 
     void HexViewerItemIndex::refreshIndex() {
         const auto pointsRequired = static_cast<std::uint32_t>(
-            this->hexViewerScene->sceneRect().height() / HexViewerItemIndex::GRID_SIZE
+            this->topLevelGroupItem->size().height() / HexViewerItemIndex::GRID_SIZE + 1
         );
 
         this->byteItemGrid.clear();
         this->byteItemGrid.reserve(pointsRequired);
 
         this->byteItemLines.clear();
-        this->byteItemYStartPositionsByAddress.clear();
+
+        const auto& byteItemsByAddress = this->topLevelGroupItem->byteItemsByAddress;
+        this->byteItemYStartPositions.assign(byteItemsByAddress.size(), 0);
 
         auto currentByteItemGridPoint = 0;
         auto currentLineYPosition = 0;
@@ -176,7 +174,7 @@ namespace Bloom::Widgets
             const auto itemYStartPosition = byteItem->position().y();
             const auto itemYEndPosition = itemYStartPosition + byteItem->size().height();
 
-            this->byteItemYStartPositionsByAddress.emplace(byteItem->startAddress, itemYStartPosition);
+            this->byteItemYStartPositions[byteItemsByAddress.offsetOf(byteItem->startAddress)] = itemYStartPosition;
 
             if (itemYStartPosition > currentLineYPosition) {
                 this->byteItemLines.push_back(byteItem);
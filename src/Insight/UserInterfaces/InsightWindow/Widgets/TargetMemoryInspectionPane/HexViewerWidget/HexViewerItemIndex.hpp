@@ -2,9 +2,7 @@
 
 #include <vector>
 #include <ranges>
-#include <QGraphicsScene>
 #include <QPointF>
-#include <unordered_map>
 
 #include "HexViewerItem.hpp"
 #include "TopLevelGroupItem.hpp"
@@ -15,6 +13,10 @@ namespace Bloom::Widgets
     /**
      * This class maintains indices of hex viewer item positions and provides fast lookups for items within certain
      * positions.
+     *
+     * The index only depends on the item hierarchy, so it can be built along with the hierarchy, on an InsightWorker
+     * thread. Move-assigning an index preserves the validity of its internal iterators, which allows the hex viewer to
+     * swap in a new index without invalidating references to the index object itself (held by the renderer).
      */
     class HexViewerItemIndex
     {
@@ -24,12 +26,8 @@ namespace Bloom::Widgets
         using ItemRangeType = std::ranges::subrange<FlattenedItemItType>;
 
         std::vector<const ByteItem*> byteItemLines;
-        std::unordered_map<Targets::TargetMemoryAddress, int> byteItemYStartPositionsByAddress;
 
-        explicit HexViewerItemIndex(
-            const TopLevelGroupItem* topLevelGroupItem,
-            const QGraphicsScene* hexViewerScene
-        );
+        explicit HexViewerItemIndex(const TopLevelGroupItem* topLevelGroupItem);
 
         /**
          * Identifies the items between two points on the Y axis, and returns them in the form of a subrange, in
@@ -74,6 +72,16 @@ namespace Bloom::Widgets
          */
         std::vector<ByteItem*> intersectingByteItems(const QRectF& rect) const;
 
+        /**
+         * Returns the Y-axis start position of the byte item for the given address, as of the last index refresh.
+         *
+         * @param address
+         * @return
+         */
+        int byteItemYStartPosition(Targets::TargetMemoryAddress address) const {
+            return this->byteItemYStartPositions[this->topLevelGroupItem->byteItemsByAddress.offsetOf(address)];
+        }
+
         void refreshFlattenedItems();
         void refreshIndex();
 
@@ -81,7 +89,6 @@ namespace Bloom::Widgets
         static constexpr auto GRID_SIZE = 100;
 
         const TopLevelGroupItem* topLevelGroupItem;
-        const QGraphicsScene* hexViewerScene;
 
         /**
          * An std::vector of all HexViewerItems along with their parents and children, sorted by position.
@@ -104,5 +111,11 @@ namespace Bloom::Widgets
          * We use an std::vector here because it provides constant-time access to any element.
          */
         std::vector<FlattenedItemItType> byteItemGrid;
+
+        /**
+         * Y-axis start positions of all byte items, indexed by their offset in the top level group item's
+         * ByteItemContainer (see ByteItemContainer::offsetOf()).
+         */
+        std::vector<int> byteItemYStartPositions;
     };
 }
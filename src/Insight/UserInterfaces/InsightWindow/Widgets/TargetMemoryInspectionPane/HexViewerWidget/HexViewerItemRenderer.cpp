@@ -1,7 +1,9 @@
 #include "HexViewerItemRenderer.hpp"
 
 #include <QScrollBar>
+#include <QStyleOptionGraphicsItem>
 #include <QColor>
+#include <algorithm>
 
 namespace Bloom::Widgets
 {
@@ -18,17 +20,34 @@ namespace Bloom::Widgets
         this->setAcceptHoverEvents(true);
         this->setCacheMode(QGraphicsItem::CacheMode::NoCache);
 
-        if (!HexViewerItemRenderer::pixmapCachesGenerated) {
-            HexViewerItemRenderer::generatePixmapCaches();
+        // We need an accurate exposed rect in order to skip painting items that haven't been invalidated
+        this->setFlag(QGraphicsItem::ItemUsesExtendedStyleOption, true);
+
+        if (!HexViewerItemRenderer::glyphAtlasGenerated) {
+            HexViewerItemRenderer::generateGlyphAtlas();
         }
     }
 
     void HexViewerItemRenderer::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) {
         const auto vScrollBarValue = this->view->verticalScrollBar()->value();
-        const auto visibleItems = this->itemIndex.items(
-            vScrollBarValue,
-            vScrollBarValue + this->viewport->size().height()
-        );
+
+        /*
+         * When only some items have been invalidated (see ItemGraphicsScene::refreshChangedValues()), the exposed rect
+         * will only cover those items, so there's no need to paint the rest of the viewport.
+         */
+        const auto exposedRect = option->exposedRect.toAlignedRect();
+        const auto yStart = std::max(vScrollBarValue, exposedRect.top());
+        const auto yEnd = std::min(vScrollBarValue + this->viewport->size().height(), exposedRect.bottom());
+
+        if (yStart > yEnd) {
+            return;
+        }
+
+        const auto visibleItems = this->itemIndex.items(yStart, yEnd);
+
+        if (visibleItems.empty()) {
+            return;
+        }
 
         painter->setRenderHints(QPainter::RenderHint::Antialiasing, false);
 
@@ -46,6 +65,8 @@ namespace Bloom::Widgets
             painter->setOpacity(1);
             this->paintItem(item, painter);
         }
+
+        this->paintByteItems(painter);
     }
 
     void HexViewerItemRenderer::paintItem(const HexViewerItem* item, QPainter* painter) {
@@ -68,116 +89,105 @@ namespace Bloom::Widgets
         }
     }
 
+    void HexViewerItemRenderer::paintByteItems(QPainter* painter) {
+        if (this->byteItemFragments.empty()) {
+            return;
+        }
+
+        if (!this->selectionRects.empty()) {
+            painter->setOpacity(this->isEnabled() ? 1 : 0.6);
+
+            for (const auto& rect : this->selectionRects) {
+                painter->fillRect(rect, HexViewerItemRenderer::SELECTED_BACKGROUND_COLOR);
+            }
+
+            this->selectionRects.clear();
+        }
+
+        painter->setOpacity(1);
+        painter->drawPixmapFragments(
+            this->byteItemFragments.data(),
+            static_cast<int>(this->byteItemFragments.size()),
+            HexViewerItemRenderer::glyphAtlas.value()
+        );
+
+        this->byteItemFragments.clear();
+    }
+
     void HexViewerItemRenderer::paintByteItem(const ByteItem* item, QPainter* painter) {
         const auto position = item->position();
-        const auto boundingRect = QRect(position.x(), position.y(), ByteItem::WIDTH, ByteItem::HEIGHT);
 
-        painter->setOpacity(!this->isEnabled() || (item->excluded && !item->selected) ? 0.6 : 1);
+        // Fragments are positioned by their centre point
+        const auto centre = QPointF(
+            position.x() + static_cast<qreal>(ByteItem::WIDTH) / 2,
+            position.y() + static_cast<qreal>(ByteItem::HEIGHT) / 2
+        );
+
+        const auto selected = this->hexViewerState.selection.contains(item->startAddress);
+        const auto opacity = !this->isEnabled() || (item->excluded && !selected) ? 0.6 : 1;
 
-        if (item->excluded || !this->hexViewerState.data.has_value()) {
-            if (item->selected) {
-                painter->drawPixmap(boundingRect, HexViewerItemRenderer::selectedMissingDataPixmap.value());
-                return;
-            }
+        if (selected) {
+            this->addSelectionRect(position);
+        }
 
-            painter->drawPixmap(boundingRect, HexViewerItemRenderer::missingDataPixmap.value());
+        if (item->excluded || !this->hexViewerState.data.has_value()) {
+            this->byteItemFragments.emplace_back(QPainter::PixmapFragment::create(
+                centre,
+                HexViewerItemRenderer::missingDataGlyphRect(),
+                1,
+                1,
+                0,
+                opacity
+            ));
             return;
         }
 
         const auto byteIndex = item->startAddress - this->hexViewerState.memoryDescriptor.addressRange.startAddress;
         const auto value = (*(this->hexViewerState.data))[byteIndex];
 
-        const auto hoveredPrimary = this->hexViewerState.hoveredByteItem == item;
+        const auto& settings = this->hexViewerState.settings;
+        const auto ascii = settings.displayAsciiValues;
 
-        if (this->hexViewerState.settings.displayAsciiValues) {
-            if (item->selected) {
-                painter->drawPixmap(
-                    boundingRect,
-                    HexViewerItemRenderer::selectedAsciiPixmapsByValue[value]
-                );
-                return;
-            }
+        auto style = ascii ? GlyphStyle::STANDARD_ASCII : GlyphStyle::STANDARD;
 
-            if (item->changed) {
-                painter->drawPixmap(
-                    boundingRect,
-                    HexViewerItemRenderer::changedMemoryAsciiPixmapsByValue[value]
-                );
-                return;
-            }
+        if (selected) {
+            // The selection rect provides the background
 
-            if (item->stackMemory && this->hexViewerState.settings.groupStackMemory) {
-                painter->drawPixmap(
-                    boundingRect,
-                    HexViewerItemRenderer::stackMemoryAsciiPixmapsByValue[value]
-                );
-                return;
-            }
+        } else if (item->changed) {
+            style = ascii ? GlyphStyle::CHANGED_MEMORY_ASCII : GlyphStyle::CHANGED_MEMORY;
 
-            if (item->grouped && this->hexViewerState.settings.highlightFocusedMemory) {
-                painter->drawPixmap(
-                    boundingRect,
-                    HexViewerItemRenderer::groupedAsciiPixmapsByValue[value]
-                );
-                return;
-            }
+        } else if (item->stackMemory && settings.groupStackMemory) {
+            style = ascii ? GlyphStyle::STACK_MEMORY_ASCII : GlyphStyle::STACK_MEMORY;
 
-            if (hoveredPrimary) {
-                painter->drawPixmap(
-                    boundingRect,
-                    HexViewerItemRenderer::hoveredPrimaryAsciiPixmapsByValue[value]
-                );
-                return;
-            }
+        } else if (item->grouped && settings.highlightFocusedMemory) {
+            style = ascii ? GlyphStyle::GROUPED_ASCII : GlyphStyle::GROUPED;
 
-            painter->drawPixmap(boundingRect, HexViewerItemRenderer::standardAsciiPixmapsByValue[value]);
-            return;
+        } else if (this->hexViewerState.hoveredByteItem == item) {
+            style = ascii ? GlyphStyle::HOVERED_PRIMARY_ASCII : GlyphStyle::HOVERED_PRIMARY;
         }
 
-        if (item->selected) {
-            painter->drawPixmap(
-                boundingRect,
-                HexViewerItemRenderer::selectedPixmapsByValue[value]
-            );
-            return;
-        }
-
-        if (item->changed) {
-            painter->drawPixmap(
-                boundingRect,
-                HexViewerItemRenderer::changedMemoryPixmapsByValue[value]
-            );
-            return;
-        }
-
-        if (item->stackMemory && this->hexViewerState.settings.groupStackMemory) {
-            painter->drawPixmap(
-                boundingRect,
-                HexViewerItemRenderer::stackMemoryPixmapsByValue[value]
-            );
-            return;
-        }
+        this->byteItemFragments.emplace_back(QPainter::PixmapFragment::create(
+            centre,
+            HexViewerItemRenderer::glyphRect(style, value),
+            1,
+            1,
+            0,
+            opacity
+        ));
+    }
 
-        if (item->grouped && this->hexViewerState.settings.highlightFocusedMemory) {
-            painter->drawPixmap(
-                boundingRect,
-                HexViewerItemRenderer::groupedPixmapsByValue[value]
-            );
-            return;
-        }
+    void HexViewerItemRenderer::addSelectionRect(const QPoint& position) {
+        if (!this->selectionRects.empty()) {
+            auto& lastRect = this->selectionRects.back();
+            const auto gap = position.x() - lastRect.right() - 1;
 
-        if (hoveredPrimary) {
-            painter->drawPixmap(
-                boundingRect,
-                HexViewerItemRenderer::hoveredPrimaryPixmapsByValue[value]
-            );
-            return;
+            if (lastRect.top() == position.y() && gap >= 0 && gap <= ByteItem::RIGHT_MARGIN) {
+                lastRect.setRight(position.x() + ByteItem::WIDTH - 1);
+                return;
+            }
         }
 
-        painter->drawPixmap(
-            boundingRect,
-            HexViewerItemRenderer::standardPixmapsByValue[value]
-        );
+        this->selectionRects.emplace_back(position.x(), position.y(), ByteItem::WIDTH, ByteItem::HEIGHT);
     }
 
     void HexViewerItemRenderer::paintFocusedRegionGroupItem(const FocusedRegionGroupItem* item, QPainter* painter) {
@@ -374,10 +384,19 @@ namespace Bloom::Widgets
         const auto& memoryCapacity = this->hexViewerState.memoryDescriptor.size();
 
         const auto stackSizeHeadingText = QString("Stack size:");
-        const auto stackSizeValueText = QString::number(stackSize) + " byte(s) ("
+        auto stackSizeValueText = QString::number(stackSize) + " byte(s) ("
             + QString::number(static_cast<float>(stackSize) / static_cast<float>(memoryCapacity / 100), 'f' , 1)
             + "% of memory capacity)";
 
+        const auto& stackWatermark = this->hexViewerState.stackWatermark;
+        if (stackWatermark.has_value()) {
+            const auto peakStackSize = this->hexViewerState.memoryDescriptor.addressRange.endAddress
+                - *stackWatermark + 1;
+
+            stackSizeValueText += " - peak: " + QString::number(peakStackSize) + " byte(s), at 0x"
+                + QString::number(*stackWatermark, 16).rightJustified(8, '0').toUpper();
+        }
+
         const auto stackPointerHeadingText = QString("Stack pointer:");
         const auto stackPointerValueText = "0x" + QString::number(
             item->stackPointer,
@@ -503,29 +522,19 @@ namespace Bloom::Widgets
         painter->drawText(stackPointerValueLabelRect, Qt::AlignCenter, stackPointerValueText);
     }
 
-    void HexViewerItemRenderer::generatePixmapCaches() {
-        const auto lock = std::unique_lock(HexViewerItemRenderer::pixmapCacheMutex);
+    void HexViewerItemRenderer::generateGlyphAtlas() {
+        const auto lock = std::unique_lock(HexViewerItemRenderer::glyphAtlasMutex);
 
-        if (HexViewerItemRenderer::pixmapCachesGenerated) {
+        if (HexViewerItemRenderer::glyphAtlasGenerated) {
             return;
         }
 
         static constexpr auto standardBackgroundColor = QColor(0x32, 0x33, 0x30, 0);
-        static constexpr auto highlightedBackgroundColor = QColor(0x3C, 0x59, 0x5C, 255);
-        static constexpr auto selectedBackgroundColor = QColor(0x3C, 0x59, 0x5C, 255);
         static constexpr auto groupedBackgroundColor = QColor(0x44, 0x44, 0x41, 255);
         static constexpr auto stackMemoryBackgroundColor = QColor(0x44, 0x44, 0x41, 200);
         static constexpr auto stackMemoryBarColor = QColor(0x67, 0x57, 0x20, 255);
         static constexpr auto changedMemoryBackgroundColor = QColor(0x5C, 0x49, 0x5D, 200);
         static constexpr auto changedMemoryFadedBackgroundColor = QColor(0x5C, 0x49, 0x5D, 125);
-
-        static const auto hoveredStackMemoryBackgroundColor = QColor(
-            stackMemoryBackgroundColor.red(),
-            stackMemoryBackgroundColor.green(),
-            stackMemoryBackgroundColor.blue(),
-            255
-        );
-
         static constexpr auto hoveredBackgroundColor = QColor(0x8E, 0x8B, 0x83, 70);
 
         static constexpr auto standardFontColor = QColor(0xAF, 0xB1, 0xB3);
@@ -533,191 +542,83 @@ namespace Bloom::Widgets
         static constexpr auto asciiFontColor = QColor(0xA7, 0x77, 0x26);
         static constexpr auto changedMemoryAsciiFontColor = QColor(0xB7, 0x7F, 0x21);
 
-        const auto byteItemRect = QRect(0, 0, ByteItem::WIDTH, ByteItem::HEIGHT);
-        const auto byteItemSize = byteItemRect.size();
-
-        auto standardTemplatePixmap = QPixmap(byteItemSize);
-        standardTemplatePixmap.fill(standardBackgroundColor);
-
-        auto highlightedTemplatePixmap = QPixmap(byteItemSize);
-        highlightedTemplatePixmap.fill(highlightedBackgroundColor);
-
-        auto selectedTemplatePixmap = QPixmap(byteItemSize);
-        selectedTemplatePixmap.fill(selectedBackgroundColor);
-
-        auto groupedTemplatePixmap = QPixmap(byteItemSize);
-        groupedTemplatePixmap.fill(groupedBackgroundColor);
-
-        auto stackMemoryTemplatePixmap = QPixmap(byteItemSize);
-        stackMemoryTemplatePixmap.fill(stackMemoryBackgroundColor);
-
-        {
-            auto painter = QPainter(&stackMemoryTemplatePixmap);
-            painter.setBrush(stackMemoryBarColor);
-            painter.setPen(Qt::PenStyle::NoPen);
-            painter.drawRect(0, byteItemSize.height() - 3, byteItemSize.width(), 3);
-        }
-
-        auto changedMemoryTemplatePixmap = QPixmap(byteItemSize);
-        changedMemoryTemplatePixmap.fill(changedMemoryBackgroundColor);
+        static auto font = QFont("'Ubuntu', sans-serif", 8);
 
-        auto changedMemoryFadedTemplatePixmap = QPixmap(byteItemSize);
-        changedMemoryFadedTemplatePixmap.fill(changedMemoryFadedBackgroundColor);
+        auto atlas = QPixmap(
+            16 * ByteItem::WIDTH,
+            (HexViewerItemRenderer::GLYPH_STYLE_COUNT * 16 + 1) * ByteItem::HEIGHT
+        );
+        atlas.fill(Qt::transparent);
 
-        auto hoveredStackMemoryTemplatePixmap = QPixmap(byteItemSize);
-        hoveredStackMemoryTemplatePixmap.fill(hoveredStackMemoryBackgroundColor);
+        auto painter = QPainter(&atlas);
+        painter.setFont(font);
 
-        auto hoveredPrimaryTemplatePixmap = QPixmap(byteItemSize);
-        hoveredPrimaryTemplatePixmap.fill(hoveredBackgroundColor);
+        const auto paintBackground = [&painter] (const QRect& rect, const QColor& color) {
+            // Replace, rather than blend with, the transparent atlas background
+            painter.setCompositionMode(QPainter::CompositionMode::CompositionMode_Source);
+            painter.fillRect(rect, color);
+            painter.setCompositionMode(QPainter::CompositionMode::CompositionMode_SourceOver);
+        };
 
-        static auto font = QFont("'Ubuntu', sans-serif", 8);
+        const auto paintStackMemoryBar = [&painter] (const QRect& rect) {
+            painter.fillRect(rect.left(), rect.bottom() - 2, rect.width(), 3, stackMemoryBarColor);
+        };
 
         for (std::uint16_t value = 0x00; value <= 0xFF; ++value) {
+            const auto byteValue = static_cast<unsigned char>(value);
             const auto hexValue = QString::number(value, 16).rightJustified(2, '0').toUpper();
             const auto asciiValue = value >= 32 && value <= 126
                 ? std::optional("'" + QString(QChar(value)) + "'")
                 : std::nullopt;
 
-            {
-                auto standardPixmap = standardTemplatePixmap;
-                auto painter = QPainter(&standardPixmap);
-                painter.setFont(font);
-                painter.setPen(standardFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, hexValue);
-
-                HexViewerItemRenderer::standardPixmapsByValue.emplace_back(std::move(standardPixmap));
-            }
-
-            {
-                auto selectedPixmap = selectedTemplatePixmap;
-                auto painter = QPainter(&selectedPixmap);
-                painter.setFont(font);
-                painter.setPen(standardFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, hexValue);
-
-                HexViewerItemRenderer::selectedPixmapsByValue.emplace_back(std::move(selectedPixmap));
-            }
-
-            {
-                auto groupedPixmap = groupedTemplatePixmap;
-                auto painter = QPainter(&groupedPixmap);
-                painter.setFont(font);
-                painter.setPen(standardFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, hexValue);
-
-                HexViewerItemRenderer::groupedPixmapsByValue.emplace_back(std::move(groupedPixmap));
-            }
-
-            {
-                auto stackMemoryPixmap = stackMemoryTemplatePixmap;
-                auto painter = QPainter(&stackMemoryPixmap);
-                painter.setFont(font);
-                painter.setPen(standardFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, hexValue);
-
-                HexViewerItemRenderer::stackMemoryPixmapsByValue.emplace_back(std::move(stackMemoryPixmap));
-            }
-
-            {
-                auto changedMemoryPixmap = changedMemoryTemplatePixmap;
-                auto painter = QPainter(&changedMemoryPixmap);
-                painter.setFont(font);
-                painter.setPen(standardFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, hexValue);
-
-                HexViewerItemRenderer::changedMemoryPixmapsByValue.emplace_back(std::move(changedMemoryPixmap));
-            }
-
-            {
-                auto hoveredPrimaryPixmap = hoveredPrimaryTemplatePixmap;
-                auto painter = QPainter(&hoveredPrimaryPixmap);
-                painter.setFont(font);
-                painter.setPen(standardFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, hexValue);
-
-                HexViewerItemRenderer::hoveredPrimaryPixmapsByValue.emplace_back(std::move(hoveredPrimaryPixmap));
-            }
-
-            {
-                auto standardAsciiPixmap = standardTemplatePixmap;
-                auto painter = QPainter(&standardAsciiPixmap);
-                painter.setFont(font);
-                painter.setPen(asciiValue.has_value() ? asciiFontColor : fadedFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, asciiValue.value_or(hexValue));
-
-                HexViewerItemRenderer::standardAsciiPixmapsByValue.emplace_back(std::move(standardAsciiPixmap));
-            }
-
-            {
-                auto selectedAsciiPixmap = selectedTemplatePixmap;
-                auto painter = QPainter(&selectedAsciiPixmap);
-                painter.setFont(font);
-                painter.setPen(asciiValue.has_value() ? asciiFontColor : fadedFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, asciiValue.value_or(hexValue));
-
-                HexViewerItemRenderer::selectedAsciiPixmapsByValue.emplace_back(std::move(selectedAsciiPixmap));
-            }
-
-            {
-                auto groupedAsciiPixmap = groupedTemplatePixmap;
-                auto painter = QPainter(&groupedAsciiPixmap);
-                painter.setFont(font);
-                painter.setPen(asciiValue.has_value() ? asciiFontColor : fadedFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, asciiValue.value_or(hexValue));
-
-                HexViewerItemRenderer::groupedAsciiPixmapsByValue.emplace_back(std::move(groupedAsciiPixmap));
-            }
-
-            {
-                auto stackMemoryAsciiPixmap = stackMemoryTemplatePixmap;
-                auto painter = QPainter(&stackMemoryAsciiPixmap);
-                painter.setFont(font);
-                painter.setPen(asciiValue.has_value() ? asciiFontColor : fadedFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, asciiValue.value_or(hexValue));
-
-                HexViewerItemRenderer::stackMemoryAsciiPixmapsByValue.emplace_back(std::move(stackMemoryAsciiPixmap));
-            }
-
-            {
-                auto changedMemoryAsciiPixmap = asciiValue.has_value()
-                    ? changedMemoryTemplatePixmap
-                    : changedMemoryFadedTemplatePixmap;
-
-                auto painter = QPainter(&changedMemoryAsciiPixmap);
-                painter.setFont(font);
-                painter.setPen(asciiValue.has_value() ? changedMemoryAsciiFontColor : fadedFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, asciiValue.value_or(hexValue));
-
-                HexViewerItemRenderer::changedMemoryAsciiPixmapsByValue.emplace_back(std::move(changedMemoryAsciiPixmap));
-            }
-
-            {
-                auto hoveredPrimaryAsciiPixmap = hoveredPrimaryTemplatePixmap;
-                auto painter = QPainter(&hoveredPrimaryAsciiPixmap);
-                painter.setFont(font);
-                painter.setPen(asciiValue.has_value() ? asciiFontColor : fadedFontColor);
-                painter.drawText(byteItemRect, Qt::AlignCenter, asciiValue.value_or(hexValue));
-
-                HexViewerItemRenderer::hoveredPrimaryAsciiPixmapsByValue.emplace_back(std::move(hoveredPrimaryAsciiPixmap));
-            }
+            const auto asciiText = asciiValue.value_or(hexValue);
+            const auto asciiFont = asciiValue.has_value() ? asciiFontColor : fadedFontColor;
+
+            const auto paintGlyph = [&] (
+                GlyphStyle style,
+                const QColor& backgroundColor,
+                const QColor& fontColor,
+                const QString& text
+            ) {
+                const auto rect = HexViewerItemRenderer::glyphRect(style, byteValue);
+                paintBackground(rect, backgroundColor);
+
+                if (style == GlyphStyle::STACK_MEMORY || style == GlyphStyle::STACK_MEMORY_ASCII) {
+                    paintStackMemoryBar(rect);
+                }
+
+                painter.setPen(fontColor);
+                painter.drawText(rect, Qt::AlignCenter, text);
+            };
+
+            paintGlyph(GlyphStyle::STANDARD, standardBackgroundColor, standardFontColor, hexValue);
+            paintGlyph(GlyphStyle::GROUPED, groupedBackgroundColor, standardFontColor, hexValue);
+            paintGlyph(GlyphStyle::STACK_MEMORY, stackMemoryBackgroundColor, standardFontColor, hexValue);
+            paintGlyph(GlyphStyle::CHANGED_MEMORY, changedMemoryBackgroundColor, standardFontColor, hexValue);
+            paintGlyph(GlyphStyle::HOVERED_PRIMARY, hoveredBackgroundColor, standardFontColor, hexValue);
+
+            paintGlyph(GlyphStyle::STANDARD_ASCII, standardBackgroundColor, asciiFont, asciiText);
+            paintGlyph(GlyphStyle::GROUPED_ASCII, groupedBackgroundColor, asciiFont, asciiText);
+            paintGlyph(GlyphStyle::STACK_MEMORY_ASCII, stackMemoryBackgroundColor, asciiFont, asciiText);
+            paintGlyph(
+                GlyphStyle::CHANGED_MEMORY_ASCII,
+                asciiValue.has_value() ? changedMemoryBackgroundColor : changedMemoryFadedBackgroundColor,
+                asciiValue.has_value() ? changedMemoryAsciiFontColor : fadedFontColor,
+                asciiText
+            );
+            paintGlyph(GlyphStyle::HOVERED_PRIMARY_ASCII, hoveredBackgroundColor, asciiFont, asciiText);
         }
 
         {
-            HexViewerItemRenderer::missingDataPixmap = standardTemplatePixmap;
-            auto painter = QPainter(&HexViewerItemRenderer::missingDataPixmap.value());
-            painter.setFont(font);
+            const auto rect = HexViewerItemRenderer::missingDataGlyphRect();
+            paintBackground(rect, standardBackgroundColor);
             painter.setPen(standardFontColor);
-            painter.drawText(byteItemRect, Qt::AlignCenter, "??");
+            painter.drawText(rect, Qt::AlignCenter, "??");
         }
 
-        {
-            HexViewerItemRenderer::selectedMissingDataPixmap = selectedTemplatePixmap;
-            auto painter = QPainter(&HexViewerItemRenderer::selectedMissingDataPixmap.value());
-            painter.setFont(font);
-            painter.setPen(standardFontColor);
-            painter.drawText(byteItemRect, Qt::AlignCenter, "??");
-        }
+        painter.end();
 
-        HexViewerItemRenderer::pixmapCachesGenerated = true;
+        HexViewerItemRenderer::glyphAtlas = std::move(atlas);
+        HexViewerItemRenderer::glyphAtlasGenerated = true;
     }
 }
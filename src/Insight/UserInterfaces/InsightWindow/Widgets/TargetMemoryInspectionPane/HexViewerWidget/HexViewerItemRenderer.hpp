@@ -8,8 +8,11 @@
 #include <atomic>
 #include <mutex>
 #include <QPixmap>
+#include <QRect>
+#include <QColor>
 #include <vector>
 #include <optional>
+#include <cstdint>
 
 #include "HexViewerItemIndex.hpp"
 #include "HexViewerSharedState.hpp"
@@ -27,6 +30,8 @@ namespace Bloom::Widgets
     class HexViewerItemRenderer: public QGraphicsItem
     {
     public:
+        static constexpr auto SELECTED_BACKGROUND_COLOR = QColor(0x3C, 0x59, 0x5C, 255);
+
         QSize size;
 
         HexViewerItemRenderer(
@@ -48,25 +53,92 @@ namespace Bloom::Widgets
         const QGraphicsView* view;
         const QWidget* viewport;
 
-        static inline std::atomic<bool> pixmapCachesGenerated = false;
-        static inline std::mutex pixmapCacheMutex;
-
-        static inline std::vector<QPixmap> standardPixmapsByValue = {};
-        static inline std::vector<QPixmap> selectedPixmapsByValue = {};
-        static inline std::vector<QPixmap> groupedPixmapsByValue = {};
-        static inline std::vector<QPixmap> stackMemoryPixmapsByValue = {};
-        static inline std::vector<QPixmap> changedMemoryPixmapsByValue = {};
-        static inline std::vector<QPixmap> standardAsciiPixmapsByValue = {};
-        static inline std::vector<QPixmap> selectedAsciiPixmapsByValue = {};
-        static inline std::vector<QPixmap> groupedAsciiPixmapsByValue = {};
-        static inline std::vector<QPixmap> stackMemoryAsciiPixmapsByValue = {};
-        static inline std::vector<QPixmap> changedMemoryAsciiPixmapsByValue = {};
-        static inline std::vector<QPixmap> hoveredPrimaryPixmapsByValue = {};
-        static inline std::vector<QPixmap> hoveredPrimaryAsciiPixmapsByValue = {};
-        static inline std::optional<QPixmap> missingDataPixmap = {};
-        static inline std::optional<QPixmap> selectedMissingDataPixmap = {};
+        /**
+         * The styles in which byte items can be rendered. Each style occupies a 16x16 grid of cells (one per byte
+         * value) in the glyph atlas.
+         */
+        enum class GlyphStyle: std::uint8_t
+        {
+            STANDARD,
+            GROUPED,
+            STACK_MEMORY,
+            CHANGED_MEMORY,
+            HOVERED_PRIMARY,
+            STANDARD_ASCII,
+            GROUPED_ASCII,
+            STACK_MEMORY_ASCII,
+            CHANGED_MEMORY_ASCII,
+            HOVERED_PRIMARY_ASCII,
+        };
+
+        static constexpr std::uint8_t GLYPH_STYLE_COUNT = 10;
+
+        static inline std::atomic<bool> glyphAtlasGenerated = false;
+        static inline std::mutex glyphAtlasMutex;
+
+        /**
+         * A single pixmap holding a rendered byte item for every value, in every style (see
+         * HexViewerItemRenderer::glyphRect()), followed by a row holding the missing data cell (see
+         * HexViewerItemRenderer::missingDataGlyphRect()).
+         *
+         * Byte items are drawn as fragments of this pixmap, in a single QPainter::drawPixmapFragments() call per
+         * paint, instead of a separate drawPixmap() call for each byte.
+         */
+        static inline std::optional<QPixmap> glyphAtlas = {};
 
+        /**
+         * The byte items to be drawn at the end of the current paint. See HexViewerItemRenderer::paintByteItems().
+         *
+         * This is a member, as opposed to a local, so that its capacity is retained between paints.
+         */
+        std::vector<QPainter::PixmapFragment> byteItemFragments;
+
+        /**
+         * The selection is painted as one rectangle per run of horizontally adjacent selected byte items, beneath
+         * the byte items themselves (which are drawn with a transparent background). Like the fragments above, the
+         * rectangles are batched and painted via HexViewerItemRenderer::paintByteItems().
+         */
+        std::vector<QRect> selectionRects;
+
+        static QRect glyphRect(GlyphStyle style, unsigned char value) {
+            const auto column = value % 16;
+            const auto row = static_cast<int>(style) * 16 + value / 16;
+            return QRect(column * ByteItem::WIDTH, row * ByteItem::HEIGHT, ByteItem::WIDTH, ByteItem::HEIGHT);
+        }
+
+        static QRect missingDataGlyphRect() {
+            return QRect(
+                0,
+                HexViewerItemRenderer::GLYPH_STYLE_COUNT * 16 * ByteItem::HEIGHT,
+                ByteItem::WIDTH,
+                ByteItem::HEIGHT
+            );
+        }
+
+        /**
+         * Paints the given item. Byte items are not painted immediately - they're batched, to be painted via
+         * HexViewerItemRenderer::paintByteItems().
+         *
+         * @param item
+         * @param painter
+         */
         void paintItem(const HexViewerItem* item, QPainter* painter);
+
+        /**
+         * Paints all byte items batched since the last call, in a single draw call.
+         *
+         * @param painter
+         */
+        void paintByteItems(QPainter* painter);
+
+        /**
+         * Extends the last selection rectangle to cover the byte item at the given position, or begins a new one, if
+         * the byte item isn't adjacent to it.
+         *
+         * @param position
+         */
+        inline void addSelectionRect(const QPoint& position) __attribute__((__always_inline__));
+
         inline void paintByteItem(const ByteItem* item, QPainter* painter) __attribute__((__always_inline__));
         inline void paintFocusedRegionGroupItem(
             const FocusedRegionGroupItem* item,
@@ -77,6 +149,6 @@ namespace Bloom::Widgets
             QPainter* painter
         ) __attribute__((__always_inline__));
 
-        static void generatePixmapCaches();
+        static void generateGlyphAtlas();
     };
 }
@@ -3,7 +3,9 @@
 #include <optional>
 
 #include "src/Targets/TargetMemory.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/SharedMemoryBuffer.hpp"
 #include "HexViewerWidgetSettings.hpp"
+#include "ByteSelection.hpp"
 
 namespace Bloom::Widgets
 {
@@ -13,16 +15,22 @@ namespace Bloom::Widgets
     {
     public:
         const Targets::TargetMemoryDescriptor& memoryDescriptor;
-        const std::optional<Targets::TargetMemoryBuffer>& data;
+        const std::optional<SharedMemoryBuffer>& data;
 
         HexViewerWidgetSettings& settings;
 
         ByteItem* hoveredByteItem = nullptr;
+        ByteSelection selection;
         std::optional<Targets::TargetStackPointer> currentStackPointer;
 
+        /**
+         * The lowest address the stack has reached, as determined via the stack canary (see ReadStackWatermark).
+         */
+        std::optional<Targets::TargetMemoryAddress> stackWatermark;
+
         HexViewerSharedState(
             const Targets::TargetMemoryDescriptor& memoryDescriptor,
-            const std::optional<Targets::TargetMemoryBuffer>& data,
+            const std::optional<SharedMemoryBuffer>& data,
             HexViewerWidgetSettings& settings
         )
             : memoryDescriptor(memoryDescriptor)
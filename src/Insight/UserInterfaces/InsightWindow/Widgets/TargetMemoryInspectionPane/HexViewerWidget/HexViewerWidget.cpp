@@ -3,9 +3,13 @@
 #include <QFile>
 #include <QVBoxLayout>
 #include <QLocale>
+#include <map>
+#include <algorithm>
 
 #include "src/Insight/UserInterfaces/InsightWindow/UiLoader.hpp"
 #include "src/Insight/InsightSignals.hpp"
+#include "src/Insight/InsightWorker/InsightWorker.hpp"
+#include "src/Insight/InsightWorker/Tasks/SearchMemoryBuffer.hpp"
 
 #include "src/Services/PathService.hpp"
 #include "src/Exceptions/Exception.hpp"
@@ -18,7 +22,7 @@ namespace Bloom::Widgets
 
     HexViewerWidget::HexViewerWidget(
         const TargetMemoryDescriptor& targetMemoryDescriptor,
-        const std::optional<Targets::TargetMemoryBuffer>& data,
+        const std::optional<SharedMemoryBuffer>& data,
         HexViewerWidgetSettings& settings,
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
@@ -78,6 +82,7 @@ namespace Bloom::Widgets
         this->displayAsciiButton = this->container->findChild<SvgToolButton*>("display-ascii-btn");
 
         this->goToAddressInput = this->container->findChild<TextInput*>("go-to-address-input");
+        this->searchInput = this->container->findChild<TextInput*>("search-input");
 
         this->toolBar->setContentsMargins(0, 0, 0, 0);
         this->toolBar->layout()->setContentsMargins(5, 0, 5, 1);
@@ -87,6 +92,7 @@ namespace Bloom::Widgets
 
         this->hoveredAddressLabel = this->bottomBar->findChild<Label*>("byte-address-label");
         this->selectionCountLabel = this->bottomBar->findChild<Label*>("selection-count-label");
+        this->searchMatchCountLabel = this->bottomBar->findChild<Label*>("search-match-count-label");
 
         this->loadingHexViewerLabel = this->container->findChild<Label*>("loading-hex-viewer-label");
 
@@ -163,6 +169,25 @@ namespace Bloom::Widgets
             &HexViewerWidget::onGoToAddressInputChanged
         );
 
+        QObject::connect(
+            this->searchInput,
+            &QLineEdit::returnPressed,
+            this,
+            &HexViewerWidget::onSearchInputSubmitted
+        );
+
+        QObject::connect(
+            this->searchInput,
+            &QLineEdit::textEdited,
+            this,
+            [this] {
+                if (this->searchInput->text().isEmpty()) {
+                    this->searchTaskId = std::nullopt;
+                    this->searchMatchCountLabel->hide();
+                }
+            }
+        );
+
         QObject::connect(
             InsightSignals::instance(),
             &InsightSignals::targetStateUpdated,
@@ -225,6 +250,20 @@ namespace Bloom::Widgets
         }
     }
 
+    void HexViewerWidget::updateChangedValues(const std::vector<Targets::TargetMemoryAddressRange>& changedRanges) {
+        if (this->byteItemGraphicsScene != nullptr) {
+            this->byteItemGraphicsScene->refreshChangedValues(changedRanges);
+        }
+    }
+
+    std::optional<Targets::TargetMemoryAddressRange> HexViewerWidget::visibleAddressRange() const {
+        if (this->byteItemGraphicsScene == nullptr) {
+            return std::nullopt;
+        }
+
+        return this->byteItemGraphicsScene->visibleAddressRange();
+    }
+
     void HexViewerWidget::refreshRegions() {
         if (this->byteItemGraphicsScene != nullptr) {
             this->byteItemGraphicsScene->rebuildItemHierarchy();
@@ -237,6 +276,12 @@ namespace Bloom::Widgets
         }
     }
 
+    void HexViewerWidget::setStackWatermark(std::optional<Targets::TargetMemoryAddress> stackWatermark) {
+        if (this->byteItemGraphicsScene != nullptr) {
+            this->byteItemGraphicsScene->updateStackWatermark(stackWatermark);
+        }
+    }
+
     void HexViewerWidget::addExternalContextMenuAction(ContextMenuAction* action) {
         assert(this->byteItemGraphicsScene != nullptr);
         this->byteItemGraphicsScene->addExternalContextMenuAction(action);
@@ -296,7 +341,8 @@ namespace Bloom::Widgets
         this->settings.displayAnnotations = enabled;
 
         if (this->byteItemGraphicsScene != nullptr) {
-            this->byteItemGraphicsScene->adjustSize();
+            // Annotations occupy space in the layout
+            this->byteItemGraphicsScene->rebuildItemHierarchy();
         }
 
         emit this->settingsChanged(this->settings);
@@ -324,12 +370,91 @@ namespace Bloom::Widgets
         const auto& memoryAddressRange = this->targetMemoryDescriptor.addressRange;
 
         if (addressConversionOk && memoryAddressRange.contains(address) && this->goToAddressInput->hasFocus()) {
-            this->byteItemGraphicsScene->selectByteItems({address});
+            auto selection = ByteSelection();
+            selection.add(address);
+
+            this->byteItemGraphicsScene->selectByteItems(selection);
             this->byteItemGraphicsView->scrollToByteItemAtAddress(address);
             return;
         }
 
-        this->byteItemGraphicsScene->selectByteItems({});
+        this->byteItemGraphicsScene->selectByteItems(ByteSelection());
+    }
+
+    void HexViewerWidget::onSearchInputSubmitted() {
+        if (this->byteItemGraphicsScene == nullptr || !this->data.has_value()) {
+            return;
+        }
+
+        const auto pattern = HexViewerWidget::parseSearchPattern(this->searchInput->text().trimmed());
+
+        if (!pattern.has_value()) {
+            this->searchTaskId = std::nullopt;
+            this->searchMatchCountLabel->setText("Invalid search pattern");
+            this->searchMatchCountLabel->show();
+            return;
+        }
+
+        const auto searchTask = QSharedPointer<SearchMemoryBuffer>(
+            new SearchMemoryBuffer(
+                *(this->data),
+                this->targetMemoryDescriptor.addressRange.startAddress,
+                *pattern,
+                this->excludedMemoryRegions
+            ),
+            &QObject::deleteLater
+        );
+
+        const auto taskId = searchTask->id;
+        this->searchTaskId = taskId;
+
+        QObject::connect(
+            searchTask.get(),
+            &SearchMemoryBuffer::searchCompleted,
+            this,
+            [this, taskId] (std::vector<Targets::TargetMemoryAddressRange> matches, bool truncated) {
+                this->onSearchCompleted(taskId, std::move(matches), truncated);
+            }
+        );
+
+        this->searchMatchCountLabel->setText("Searching...");
+        this->searchMatchCountLabel->show();
+
+        InsightWorker::queueTask(searchTask);
+    }
+
+    void HexViewerWidget::onSearchCompleted(
+        InsightWorkerTask::IdType taskId,
+        std::vector<Targets::TargetMemoryAddressRange> matches,
+        bool truncated
+    ) {
+        if (this->searchTaskId != taskId || this->byteItemGraphicsScene == nullptr) {
+            // A more recent search is pending, or the search was cleared - these results are stale
+            return;
+        }
+
+        this->searchTaskId = std::nullopt;
+
+        const auto matchCount = matches.size();
+        this->searchMatchCountLabel->setText(
+            matchCount == 0
+                ? "No matches"
+                : QLocale(QLocale::English).toString(static_cast<qulonglong>(matchCount))
+                    + (truncated ? "+" : "") + (matchCount == 1 ? " match" : " matches")
+        );
+        this->searchMatchCountLabel->show();
+
+        // The matches are presented as a selection, so that they can be copied or exported like any other selection
+        auto selection = ByteSelection();
+        for (const auto& match : matches) {
+            selection.add(match);
+        }
+
+        this->byteItemGraphicsScene->selectByteItems(selection);
+
+        if (!matches.empty()) {
+            this->byteItemGraphicsView->scrollToByteItemAtAddress(matches.front().startAddress);
+        }
     }
 
     void HexViewerWidget::onHoveredAddress(const std::optional<Targets::TargetMemoryAddress>& address) {
@@ -354,10 +479,8 @@ namespace Bloom::Widgets
         );
     }
 
-    void HexViewerWidget::onByteSelectionChanged(
-        const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress
-    ) {
-        const auto selectionCount = selectedByteItemsByAddress.size();
+    void HexViewerWidget::onByteSelectionChanged(const ByteSelection& selection) {
+        const auto selectionCount = selection.byteCount();
 
         if (selectionCount == 0) {
             this->selectionCountLabel->hide();
@@ -370,4 +493,83 @@ namespace Bloom::Widgets
         );
         this->selectionCountLabel->show();
     }
+
+    std::optional<std::vector<unsigned char>> HexViewerWidget::parseSearchPattern(const QString& input) {
+        if (input.isEmpty()) {
+            return std::nullopt;
+        }
+
+        if (input.startsWith('"')) {
+            const auto text = input.endsWith('"') && input.size() > 1
+                ? input.mid(1, input.size() - 2)
+                : input.mid(1);
+
+            if (text.isEmpty()) {
+                return std::nullopt;
+            }
+
+            const auto bytes = text.toLatin1();
+            return std::vector<unsigned char>(bytes.begin(), bytes.end());
+        }
+
+        static const auto integerWidthsByPrefix = std::map<QString, std::pair<int, bool>>({
+            {"u8:", {1, false}},
+            {"u16:", {2, false}},
+            {"u32:", {4, false}},
+            {"u16be:", {2, true}},
+            {"u32be:", {4, true}},
+        });
+
+        for (const auto& [prefix, format] : integerWidthsByPrefix) {
+            if (!input.startsWith(prefix, Qt::CaseInsensitive)) {
+                continue;
+            }
+
+            const auto& [width, bigEndian] = format;
+
+            auto conversionOk = false;
+            const auto value = input.mid(prefix.size()).trimmed().toULongLong(&conversionOk, 0);
+
+            if (!conversionOk || value >= (1ULL << (width * 8))) {
+                return std::nullopt;
+            }
+
+            auto bytes = std::vector<unsigned char>();
+            for (auto byteIndex = 0; byteIndex < width; ++byteIndex) {
+                bytes.push_back(static_cast<unsigned char>(value >> (byteIndex * 8)));
+            }
+
+            if (bigEndian) {
+                std::reverse(bytes.begin(), bytes.end());
+            }
+
+            return bytes;
+        }
+
+        auto hex = input;
+        hex.remove(' ');
+        if (hex.startsWith("0x", Qt::CaseInsensitive)) {
+            hex = hex.mid(2);
+        }
+
+        if (hex.isEmpty() || (hex.size() % 2) != 0) {
+            return std::nullopt;
+        }
+
+        auto bytes = std::vector<unsigned char>();
+        bytes.reserve(static_cast<std::size_t>(hex.size() / 2));
+
+        for (auto charIndex = 0; charIndex < hex.size(); charIndex += 2) {
+            auto conversionOk = false;
+            const auto byte = hex.mid(charIndex, 2).toUShort(&conversionOk, 16);
+
+            if (!conversionOk) {
+                return std::nullopt;
+            }
+
+            bytes.push_back(static_cast<unsigned char>(byte));
+        }
+
+        return bytes;
+    }
 }
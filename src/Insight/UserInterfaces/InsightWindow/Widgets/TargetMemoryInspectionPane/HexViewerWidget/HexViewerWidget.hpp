@@ -12,6 +12,7 @@
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/Label.hpp"
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/SvgToolButton.hpp"
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/TextInput.hpp"
+#include "src/Insight/InsightWorker/Tasks/InsightWorkerTask.hpp"
 
 #include "HexViewerWidgetSettings.hpp"
 #include "ItemGraphicsView.hpp"
@@ -30,7 +31,7 @@ namespace Bloom::Widgets
     public:
         HexViewerWidget(
             const Targets::TargetMemoryDescriptor& targetMemoryDescriptor,
-            const std::optional<Targets::TargetMemoryBuffer>& data,
+            const std::optional<SharedMemoryBuffer>& data,
             HexViewerWidgetSettings& settings,
             const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
             const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
@@ -39,9 +40,19 @@ namespace Bloom::Widgets
 
         virtual void init();
         virtual void updateValues();
+
+        /**
+         * Updates the hex viewer following a change to a subset of the memory buffer. Only the byte items within the
+         * given ranges will be repainted, and marked as changed.
+         *
+         * @param changedRanges
+         */
+        void updateChangedValues(const std::vector<Targets::TargetMemoryAddressRange>& changedRanges);
         void refreshRegions();
         void setStackPointer(Targets::TargetStackPointer stackPointer);
+        void setStackWatermark(std::optional<Targets::TargetMemoryAddress> stackWatermark);
         void addExternalContextMenuAction(ContextMenuAction* action);
+        std::optional<Targets::TargetMemoryAddressRange> visibleAddressRange() const;
 
     signals:
         void ready();
@@ -49,7 +60,7 @@ namespace Bloom::Widgets
 
     protected:
         const Targets::TargetMemoryDescriptor& targetMemoryDescriptor;
-        const std::optional<Targets::TargetMemoryBuffer>& data;
+        const std::optional<SharedMemoryBuffer>& data;
 
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions;
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions;
@@ -65,6 +76,7 @@ namespace Bloom::Widgets
         ItemGraphicsScene* byteItemGraphicsScene = nullptr;
         Label* hoveredAddressLabel = nullptr;
         Label* selectionCountLabel = nullptr;
+        Label* searchMatchCountLabel = nullptr;
 
         SvgToolButton* groupStackMemoryButton = nullptr;
         SvgToolButton* highlightFocusedMemoryButton = nullptr;
@@ -73,6 +85,12 @@ namespace Bloom::Widgets
         SvgToolButton* displayAsciiButton = nullptr;
 
         TextInput* goToAddressInput = nullptr;
+        TextInput* searchInput = nullptr;
+
+        /**
+         * The ID of the most recent search task (see SearchMemoryBuffer). Results from any other search are stale.
+         */
+        std::optional<InsightWorkerTask::IdType> searchTaskId;
 
         Targets::TargetState targetState = Targets::TargetState::UNKNOWN;
 
@@ -85,9 +103,27 @@ namespace Bloom::Widgets
         void setAnnotationsEnabled(bool enabled);
         void setDisplayAsciiEnabled(bool enabled);
         void onGoToAddressInputChanged();
-        void onHoveredAddress(const std::optional<Targets::TargetMemoryAddress>& address);
-        void onByteSelectionChanged(
-            const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress
+        void onSearchInputSubmitted();
+        void onSearchCompleted(
+            InsightWorkerTask::IdType taskId,
+            std::vector<Targets::TargetMemoryAddressRange> matches,
+            bool truncated
         );
+        void onHoveredAddress(const std::optional<Targets::TargetMemoryAddress>& address);
+        void onByteSelectionChanged(const ByteSelection& selection);
+
+        /**
+         * Converts the search input to the byte pattern to search for.
+         *
+         * Accepts hex bytes ("DE AD BE EF" or "0xDEADBEEF"), quoted ASCII text ("\"text\"") and integers, prefixed
+         * with their width and byte order ("u8:", "u16:", "u32:" for little-endian, "u16be:", "u32be:" for
+         * big-endian). Integers can be given in decimal or hexadecimal (with a "0x" prefix).
+         *
+         * @param input
+         *
+         * @return
+         *  std::nullopt if the input is not a valid pattern.
+         */
+        static std::optional<std::vector<unsigned char>> parseSearchPattern(const QString& input);
     };
 }
@@ -4,10 +4,12 @@
 #include <QMenu>
 #include <QApplication>
 #include <QClipboard>
+#include <QToolTip>
 #include <QByteArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <map>
+#include <set>
 #include <algorithm>
 
 #include "src/Insight/InsightWorker/InsightWorker.hpp"
@@ -15,11 +17,13 @@
 
 #include "src/Insight/InsightWorker/Tasks/ConstructHexViewerTopLevelGroupItem.hpp"
 
+#include "src/Services/SymbolService.hpp"
+
 namespace Bloom::Widgets
 {
     ItemGraphicsScene::ItemGraphicsScene(
         const Targets::TargetMemoryDescriptor& targetMemoryDescriptor,
-        const std::optional<Targets::TargetMemoryBuffer>& data,
+        const std::optional<SharedMemoryBuffer>& data,
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
         HexViewerWidgetSettings& settings,
@@ -162,6 +166,16 @@ namespace Bloom::Widgets
             &ItemGraphicsScene::copyAsciiValueToClipboard
         );
 
+        this->resizeDebounceTimer->setSingleShot(true);
+        this->resizeDebounceTimer->setInterval(ItemGraphicsScene::RESIZE_DEBOUNCE_INTERVAL);
+
+        QObject::connect(
+            this->resizeDebounceTimer,
+            &QTimer::timeout,
+            this,
+            &ItemGraphicsScene::rebuildItemHierarchy
+        );
+
         this->setSceneRect(0, 0, this->getSceneWidth(), 0);
 
         static const auto hoverRectBackgroundColor = QColor(0x8E, 0x8B, 0x83, 45);
@@ -183,12 +197,50 @@ namespace Bloom::Widgets
 
     void ItemGraphicsScene::init() {
         this->byteAddressContainer->setPos(this->addressContainerPosition());
+        this->rebuildItemHierarchy();
+    }
+
+    void ItemGraphicsScene::updateStackPointer(std::uint32_t stackPointer) {
+        this->state.currentStackPointer = stackPointer;
+        this->rebuildItemHierarchy();
+    }
+
+    void ItemGraphicsScene::updateStackWatermark(std::optional<Targets::TargetMemoryAddress> stackWatermark) {
+        // The watermark is only presented in the stack memory group's heading, so a repaint will do
+        this->state.stackWatermark = stackWatermark;
+        this->update();
+    }
+
+    void ItemGraphicsScene::selectByteItems(const ByteSelection& selection) {
+        this->state.selection = selection;
+
+        this->update();
+        emit this->selectionChanged(this->state.selection);
+    }
+
+    void ItemGraphicsScene::rebuildItemHierarchy() {
+        // Any pending resize will be accounted for by this rebuild
+        this->resizeDebounceTimer->stop();
+
+        if (this->itemHierarchyRebuildInProgress) {
+            // The hierarchy under construction is already stale - we'll construct another once it's finished
+            this->itemHierarchyRebuildPending = true;
+            return;
+        }
+
+        this->itemHierarchyRebuildInProgress = true;
+        this->itemHierarchyRebuildPending = false;
+
+        const auto margins = this->margins();
+        const auto width = this->getSceneWidth();
 
         const auto constructHexViewerTopLevelGroupItem = QSharedPointer<ConstructHexViewerTopLevelGroupItem>(
             new ConstructHexViewerTopLevelGroupItem(
                 this->focusedMemoryRegions,
                 this->excludedMemoryRegions,
-                this->state
+                this->state,
+                QPoint(ByteAddressContainer::WIDTH + margins.left(), margins.top()),
+                width - ByteAddressContainer::WIDTH - margins.left() - margins.right()
             ),
             &QObject::deleteLater
         );
@@ -197,56 +249,222 @@ namespace Bloom::Widgets
             constructHexViewerTopLevelGroupItem.get(),
             &ConstructHexViewerTopLevelGroupItem::topLevelGroupItem,
             this,
-            [this] (TopLevelGroupItem* item) {
-                const auto margins = this->margins();
+            [this, width] (TopLevelGroupItem* item, HexViewerItemIndex* itemIndex) {
+                auto topLevelGroupItem = std::unique_ptr<TopLevelGroupItem>(item);
+                auto newItemIndex = std::unique_ptr<HexViewerItemIndex>(itemIndex);
 
-                this->topLevelGroup.reset(item);
-                this->topLevelGroup->setPosition(
-                    QPoint(ByteAddressContainer::WIDTH + margins.left(), margins.top())
-                );
+                if (this->itemHierarchyRebuildPending) {
+                    // Stale - discard it
+                    return;
+                }
 
-                this->itemIndex = std::make_unique<HexViewerItemIndex>(this->topLevelGroup.get(), this);
-                this->initRenderer();
+                this->itemHierarchyWidth = width;
+                this->applyItemHierarchy(std::move(topLevelGroupItem), std::move(newItemIndex));
+            }
+        );
 
-                emit this->ready();
+        QObject::connect(
+            constructHexViewerTopLevelGroupItem.get(),
+            &InsightWorkerTask::finished,
+            this,
+            [this] {
+                this->itemHierarchyRebuildInProgress = false;
+
+                if (this->itemHierarchyRebuildPending) {
+                    this->rebuildItemHierarchy();
+                }
             }
         );
 
         InsightWorker::queueTask(constructHexViewerTopLevelGroupItem);
     }
 
-    void ItemGraphicsScene::updateStackPointer(std::uint32_t stackPointer) {
-        this->state.currentStackPointer = stackPointer;
-        this->rebuildItemHierarchy();
+    void ItemGraphicsScene::adjustSize() {
+        if (this->topLevelGroup == nullptr) {
+            return;
+        }
+
+        this->refreshSceneRect();
+
+        if (this->getSceneWidth() != this->itemHierarchyWidth) {
+            this->resizeDebounceTimer->start();
+        }
+    }
+
+    void ItemGraphicsScene::setEnabled(bool enabled) {
+        if (this->enabled == enabled) {
+            return;
+        }
+
+        this->enabled = enabled;
+
+        if (this->renderer != nullptr) {
+            this->renderer->setEnabled(this->enabled);
+        }
+
+        this->byteAddressContainer->setEnabled(enabled);
+        this->byteAddressContainer->update();
+        this->update();
     }
 
-    void ItemGraphicsScene::selectByteItems(const std::set<std::uint32_t>& addresses) {
-        this->selectedByteItemsByAddress.clear();
+    void ItemGraphicsScene::refreshValues() {
+        this->topLevelGroup->refreshValues(this->state);
+        this->update();
+    }
+
+    void ItemGraphicsScene::refreshChangedValues(const std::vector<Targets::TargetMemoryAddressRange>& changedRanges) {
+        /*
+         * Beyond this number of changed bytes, invalidating each byte item's rect individually would cost more than
+         * repainting the whole viewport.
+         */
+        static constexpr auto MAX_INDIVIDUAL_UPDATES = std::size_t(512);
+
+        if (this->topLevelGroup == nullptr) {
+            return;
+        }
+
+        this->topLevelGroup->refreshValues(this->state);
+
+        auto dirtyItems = std::set<const HexViewerItem*>();
+
+        for (auto* byteItem : this->changedByteItems) {
+            byteItem->changed = false;
+            dirtyItems.insert(byteItem);
+        }
+
+        this->changedByteItems.clear();
+
+        for (const auto& range : changedRanges) {
+            for (auto address = range.startAddress; address <= range.endAddress; ++address) {
+                auto& byteItem = this->topLevelGroup->byteItemsByAddress.at(address);
+
+                if (byteItem.excluded) {
+                    continue;
+                }
+
+                byteItem.changed = true;
+                this->changedByteItems.push_back(&byteItem);
 
-        for (auto& [address, byteItem] : this->topLevelGroup->byteItemsByAddress) {
-            if (addresses.contains(address)) {
-                byteItem.selected = true;
-                this->selectedByteItemsByAddress.insert(std::pair(byteItem.startAddress, &byteItem));
+                if (dirtyItems.size() <= MAX_INDIVIDUAL_UPDATES) {
+                    dirtyItems.insert(&byteItem);
 
-            } else if (byteItem.selected) {
-                byteItem.selected = false;
+                    // Focused region groups display the value of the region, which may have changed
+                    for (const auto* parent = byteItem.parent; parent != nullptr; parent = parent->parent) {
+                        if (dynamic_cast<const FocusedRegionGroupItem*>(parent) != nullptr) {
+                            dirtyItems.insert(parent);
+                        }
+                    }
+                }
             }
         }
 
-        this->update();
-        emit this->selectionChanged(this->selectedByteItemsByAddress);
+        if (dirtyItems.size() > MAX_INDIVIDUAL_UPDATES) {
+            this->update();
+            return;
+        }
+
+        for (const auto* item : dirtyItems) {
+            this->update(QRectF(item->position(), item->size()));
+        }
     }
 
-    void ItemGraphicsScene::rebuildItemHierarchy() {
-        this->topLevelGroup->rebuildItemHierarchy();
-        this->itemIndex->refreshFlattenedItems();
-        this->adjustSize();
+    QPointF ItemGraphicsScene::getByteItemPositionByAddress(std::uint32_t address) {
+        const auto* byteItem = this->topLevelGroup->byteItemsByAddress.find(address);
+        if (byteItem != nullptr) {
+            return byteItem->position();
+        }
+
+        return QPointF();
     }
 
-    void ItemGraphicsScene::adjustSize() {
+    std::optional<Targets::TargetMemoryAddressRange> ItemGraphicsScene::visibleAddressRange() const {
+        if (this->itemIndex == nullptr) {
+            return std::nullopt;
+        }
+
+        const auto scrollbarValue = this->parent->verticalScrollBar()->value();
+        const auto visibleByteItems = this->itemIndex->intersectingByteItems(QRectF(
+            0,
+            scrollbarValue,
+            this->width(),
+            this->parent->viewport()->height()
+        ));
+
+        if (visibleByteItems.empty()) {
+            return std::nullopt;
+        }
+
+        // Byte items may be grouped (and therefore not in address order), so we can't just take the first and last
+        const auto [minIt, maxIt] = std::minmax_element(
+            visibleByteItems.begin(),
+            visibleByteItems.end(),
+            [] (const ByteItem* byteItemA, const ByteItem* byteItemB) {
+                return byteItemA->startAddress < byteItemB->startAddress;
+            }
+        );
+
+        return Targets::TargetMemoryAddressRange((*minIt)->startAddress, (*maxIt)->startAddress);
+    }
+
+    void ItemGraphicsScene::addExternalContextMenuAction(ContextMenuAction* action) {
+        QObject::connect(action, &QAction::triggered, this, [this, action] () {
+            emit action->invoked(this->state.selection);
+        });
+
+        this->externalContextMenuActions.push_back(action);
+    }
+
+    void ItemGraphicsScene::applyItemHierarchy(
+        std::unique_ptr<TopLevelGroupItem> topLevelGroupItem,
+        std::unique_ptr<HexViewerItemIndex> itemIndex
+    ) {
+        // The hovered and changed byte items belong to the old hierarchy
+        if (this->state.hoveredByteItem != nullptr) {
+            this->onByteItemLeave();
+        }
+
+        auto changedByteItems = std::vector<ByteItem*>();
+        changedByteItems.reserve(this->changedByteItems.size());
+
+        for (const auto* byteItem : this->changedByteItems) {
+            auto& newByteItem = topLevelGroupItem->byteItemsByAddress.at(byteItem->startAddress);
+            newByteItem.changed = true;
+            changedByteItems.push_back(&newByteItem);
+        }
+
+        this->changedByteItems = std::move(changedByteItems);
+
+        /*
+         * The renderer holds a reference to the index object, so we move the new index into the existing object,
+         * instead of replacing it. This must be done before the old hierarchy is destroyed.
+         */
+        if (this->itemIndex == nullptr) {
+            this->itemIndex = std::move(itemIndex);
+
+        } else {
+            *(this->itemIndex) = std::move(*itemIndex);
+        }
+
+        this->topLevelGroup = std::move(topLevelGroupItem);
+
+        const auto initialHierarchy = this->renderer == nullptr;
+        if (initialHierarchy) {
+            this->initRenderer();
+        }
+
+        this->refreshSceneRect();
+        this->byteAddressContainer->adjustAddressLabels(this->itemIndex->byteItemLines);
+        this->onItemHierarchyReplaced();
+        this->update();
+
+        if (initialHierarchy) {
+            emit this->ready();
+        }
+    }
+
+    void ItemGraphicsScene::refreshSceneRect() {
         const auto margins = this->margins();
         const auto width = this->getSceneWidth();
-        const auto availableWidth = width - ByteAddressContainer::WIDTH - margins.left() - margins.right();
 
         auto hoverRectX = this->hoverRectX->rect();
         hoverRectX.setWidth(width);
@@ -256,9 +474,6 @@ namespace Bloom::Widgets
         hoverRectY.setHeight(this->views().first()->viewport()->height() + (ByteItem::HEIGHT * 2));
         this->hoverRectY->setRect(hoverRectY);
 
-        this->topLevelGroup->adjustItemPositions(availableWidth);
-        this->itemIndex->refreshIndex();
-
         const auto sceneSize = QSize(
             width,
             std::max(
@@ -277,47 +492,6 @@ namespace Bloom::Widgets
         if (this->renderer != nullptr) {
             this->renderer->size = sceneSize;
         }
-
-        this->byteAddressContainer->adjustAddressLabels(this->itemIndex->byteItemLines);
-        this->update();
-    }
-
-    void ItemGraphicsScene::setEnabled(bool enabled) {
-        if (this->enabled == enabled) {
-            return;
-        }
-
-        this->enabled = enabled;
-
-        if (this->renderer != nullptr) {
-            this->renderer->setEnabled(this->enabled);
-        }
-
-        this->byteAddressContainer->setEnabled(enabled);
-        this->byteAddressContainer->update();
-        this->update();
-    }
-
-    void ItemGraphicsScene::refreshValues() {
-        this->topLevelGroup->refreshValues();
-        this->update();
-    }
-
-    QPointF ItemGraphicsScene::getByteItemPositionByAddress(std::uint32_t address) {
-        const auto byteItemIt = this->topLevelGroup->byteItemsByAddress.find(address);
-        if (byteItemIt != this->topLevelGroup->byteItemsByAddress.end()) {
-            return byteItemIt->second.position();
-        }
-
-        return QPointF();
-    }
-
-    void ItemGraphicsScene::addExternalContextMenuAction(ContextMenuAction* action) {
-        QObject::connect(action, &QAction::triggered, this, [this, action] () {
-            emit action->invoked(this->selectedByteItemsByAddress);
-        });
-
-        this->externalContextMenuActions.push_back(action);
     }
 
     void ItemGraphicsScene::initRenderer() {
@@ -366,7 +540,7 @@ namespace Bloom::Widgets
         if (button == Qt::MouseButton::RightButton) {
             ByteItem* clickedByteItem = this->itemIndex->byteItemAt(mousePosition);
 
-            if (clickedByteItem == nullptr || clickedByteItem->selected) {
+            if (clickedByteItem == nullptr || this->state.selection.contains(clickedByteItem->startAddress)) {
                 return;
             }
         }
@@ -393,29 +567,28 @@ namespace Bloom::Widgets
 
         auto* clickedByteItem = this->itemIndex->byteItemAt(mousePosition);
         if (clickedByteItem != nullptr) {
-            if ((modifiers & Qt::ShiftModifier) != 0) {
-                for (
-                    auto i = static_cast<std::int64_t>(clickedByteItem->startAddress);
-                    i >= this->state.memoryDescriptor.addressRange.startAddress;
-                    --i
-                ) {
-                    auto& byteItem = this->topLevelGroup->byteItemsByAddress.at(
-                        static_cast<Targets::TargetMemoryAddress>(i)
-                    );
-
-                    if (byteItem.selected) {
-                        break;
-                    }
+            auto& selection = this->state.selection;
+            const auto clickedAddress = clickedByteItem->startAddress;
 
-                    this->toggleByteItemSelection(byteItem);
+            if ((modifiers & Qt::ShiftModifier) != 0) {
+                // Extend the selection from the closest selected byte below the clicked byte
+                if (!selection.contains(clickedAddress)) {
+                    const auto closestSelectedAddress = selection.closestAddressBelow(clickedAddress);
+
+                    selection.add(Targets::TargetMemoryAddressRange(
+                        closestSelectedAddress.has_value()
+                            ? *closestSelectedAddress + 1
+                            : this->state.memoryDescriptor.addressRange.startAddress,
+                        clickedAddress
+                    ));
                 }
 
-                emit this->selectionChanged(this->selectedByteItemsByAddress);
+                emit this->selectionChanged(selection);
                 return;
             }
 
-            this->toggleByteItemSelection(*clickedByteItem);
-            emit this->selectionChanged(this->selectedByteItemsByAddress);
+            selection.toggle(clickedAddress);
+            emit this->selectionChanged(selection);
         }
     }
 
@@ -438,18 +611,16 @@ namespace Bloom::Widgets
 
             } else {
                 const auto oldItems = this->itemIndex->intersectingByteItems(oldRect);
-                for (auto* byteItem : oldItems) {
-                    if (byteItem->selected) {
-                        this->deselectByteItem(*byteItem);
-                    }
+                for (const auto* byteItem : oldItems) {
+                    this->state.selection.remove(byteItem->startAddress);
                 }
             }
 
             const auto items = this->itemIndex->intersectingByteItems(this->rubberBandRectItem->rect());
-            for (auto& byteItem : items) {
-                this->selectByteItem(*byteItem);
+            for (const auto* byteItem : items) {
+                this->state.selection.add(byteItem->startAddress);
             }
-            emit this->selectionChanged(this->selectedByteItemsByAddress);
+            emit this->selectionChanged(this->state.selection);
         }
 
         auto* hoveredByteItem = this->itemIndex->byteItemAt(mousePosition);
@@ -485,6 +656,30 @@ namespace Bloom::Widgets
         QGraphicsScene::keyPressEvent(keyEvent);
     }
 
+    void ItemGraphicsScene::helpEvent(QGraphicsSceneHelpEvent* event) {
+        const auto* byteItem = this->itemIndex != nullptr
+            ? this->itemIndex->byteItemAt(event->scenePos())
+            : nullptr;
+
+        const auto symbol = byteItem != nullptr
+            ? Services::SymbolService::symbolAt(this->state.memoryDescriptor.type, byteItem->startAddress)
+            : std::nullopt;
+
+        if (!symbol.has_value()) {
+            QToolTip::hideText();
+            event->ignore();
+            return;
+        }
+
+        const auto offset = byteItem->startAddress - symbol->startAddress;
+        QToolTip::showText(
+            event->screenPos(),
+            QString::fromStdString(symbol->name) + " + " + QString::number(offset) + " ("
+                + QString::number(symbol->size) + " bytes)"
+        );
+        event->accept();
+    }
+
     void ItemGraphicsScene::contextMenuEvent(QGraphicsSceneContextMenuEvent* event) {
         if (event->scenePos().x() <= ByteAddressContainer::WIDTH) {
             auto* menu = new QMenu(this->parent);
@@ -500,7 +695,7 @@ namespace Bloom::Widgets
             return;
         }
 
-        const auto itemsSelected = !this->selectedByteItemsByAddress.empty();
+        const auto itemsSelected = !this->state.selection.empty();
 
         auto* menu = new QMenu(this->parent);
         menu->setLayoutDirection(Qt::LayoutDirection::LeftToRight);
@@ -534,7 +729,7 @@ namespace Bloom::Widgets
                     itemsSelected
                     && (
                         !externalAction->isEnabledCallback.has_value()
-                        || externalAction->isEnabledCallback.value()(this->selectedByteItemsByAddress)
+                        || externalAction->isEnabledCallback.value()(this->state.selection)
                     )
 
                 );
@@ -604,43 +799,16 @@ namespace Bloom::Widgets
         }
     }
 
-    void ItemGraphicsScene::selectByteItem(ByteItem& byteItem) {
-        byteItem.selected = true;
-        this->selectedByteItemsByAddress.insert(std::pair(byteItem.startAddress, &byteItem));
-    }
-
-    void ItemGraphicsScene::deselectByteItem(ByteItem& byteItem) {
-        byteItem.selected = false;
-        this->selectedByteItemsByAddress.erase(byteItem.startAddress);
-    }
-
-    void ItemGraphicsScene::toggleByteItemSelection(ByteItem& byteItem) {
-        if (byteItem.selected) {
-            this->deselectByteItem(byteItem);
-            return;
-        }
-
-        this->selectByteItem(byteItem);
-    }
-
     void ItemGraphicsScene::clearByteItemSelection() {
-        for (auto& [address, byteItem] : this->selectedByteItemsByAddress) {
-            byteItem->selected = false;
-        }
-
-        this->selectedByteItemsByAddress.clear();
+        this->state.selection.clear();
         this->update();
-        emit this->selectionChanged(this->selectedByteItemsByAddress);
+        emit this->selectionChanged(this->state.selection);
     }
 
     void ItemGraphicsScene::selectAllByteItems() {
-        for (auto& [address, byteItem] : this->topLevelGroup->byteItemsByAddress) {
-            byteItem.selected = true;
-            this->selectedByteItemsByAddress.insert(std::pair(byteItem.startAddress, &byteItem));
-        }
-
+        this->state.selection.add(this->state.memoryDescriptor.addressRange);
         this->update();
-        emit this->selectionChanged(this->selectedByteItemsByAddress);
+        emit this->selectionChanged(this->state.selection);
     }
 
     void ItemGraphicsScene::setAddressType(AddressType type) {
@@ -652,141 +820,141 @@ namespace Bloom::Widgets
         this->byteAddressContainer->invalidateChildItemCaches();
     }
 
-    std::map<Targets::TargetMemoryAddress, ByteItem*> ItemGraphicsScene::sortedByteItemsByAddress() {
-        auto sortedByteItemsByAddress = std::map<Targets::TargetMemoryAddress, ByteItem*>();
-        std::transform(
-            this->selectedByteItemsByAddress.begin(),
-            this->selectedByteItemsByAddress.end(),
-            std::inserter(sortedByteItemsByAddress, sortedByteItemsByAddress.end()),
-            [] (const decltype(this->selectedByteItemsByAddress)::value_type& pair) {
-                return pair;
-            }
-        );
+    void ItemGraphicsScene::forEachSelectedByteItem(const std::function<void(const ByteItem&)>& callback) const {
+        const auto& byteItemsByAddress = this->topLevelGroup->byteItemsByAddress;
 
-        return sortedByteItemsByAddress;
+        for (const auto& addressRange : this->state.selection.ranges()) {
+            for (auto address = addressRange.startAddress; address <= addressRange.endAddress; ++address) {
+                callback(byteItemsByAddress.at(address));
+            }
+        }
     }
 
     void ItemGraphicsScene::copyAddressesToClipboard(AddressType type) {
-        if (this->selectedByteItemsByAddress.empty()) {
+        if (this->state.selection.empty()) {
             return;
         }
 
         auto data = QString();
         const auto memoryStartAddress = this->state.memoryDescriptor.addressRange.startAddress;
 
-        for (const auto& [address, byteItem] : this->sortedByteItemsByAddress()) {
+        this->forEachSelectedByteItem([&data, type, memoryStartAddress] (const ByteItem& byteItem) {
             data.append(
                 "0x" + QString::number(
                     type == AddressType::RELATIVE
-                        ? byteItem->startAddress - memoryStartAddress
-                        : byteItem->startAddress,
+                        ? byteItem.startAddress - memoryStartAddress
+                        : byteItem.startAddress,
                     16
-                ).rightJustified(8, '0').toUpper() + "\n"
+                ).rightJustified(8, '0').toUpper() + "
+"
             );
-        }
+        });
 
         QApplication::clipboard()->setText(std::move(data));
     }
 
     void ItemGraphicsScene::copyHexValuesToClipboard(bool withDelimiters) {
-        if (this->selectedByteItemsByAddress.empty()) {
+        if (this->state.selection.empty() || !this->state.data.has_value()) {
             return;
         }
 
         auto data = QString();
 
-        for (const auto& [address, byteItem] : this->sortedByteItemsByAddress()) {
-            const unsigned char byteValue = byteItem->excluded
+        this->forEachSelectedByteItem([this, &data, withDelimiters] (const ByteItem& byteItem) {
+            const unsigned char byteValue = byteItem.excluded
                 ? 0x00
-                : (*this->state.data)[byteItem->startAddress - this->state.memoryDescriptor.addressRange.startAddress];
+                : (*this->state.data)[byteItem.startAddress - this->state.memoryDescriptor.addressRange.startAddress];
 
             data.append(
                 withDelimiters
-                    ? "0x" + QString::number(byteValue, 16).rightJustified(2, '0').toUpper() + "\n"
+                    ? "0x" + QString::number(byteValue, 16).rightJustified(2, '0').toUpper() + "
+"
                     : QString::number(byteValue, 16).rightJustified(2, '0').toUpper()
             );
-        }
+        });
 
         QApplication::clipboard()->setText(std::move(data));
     }
 
     void ItemGraphicsScene::copyDecimalValuesToClipboard() {
-        if (this->selectedByteItemsByAddress.empty() || !this->state.data.has_value()) {
+        if (this->state.selection.empty() || !this->state.data.has_value()) {
             return;
         }
 
         auto data = QString();
 
-        for (const auto& [address, byteItem] : this->sortedByteItemsByAddress()) {
-            const unsigned char byteValue = byteItem->excluded
+        this->forEachSelectedByteItem([this, &data] (const ByteItem& byteItem) {
+            const unsigned char byteValue = byteItem.excluded
                 ? 0x00
-                : (*this->state.data)[byteItem->startAddress - this->state.memoryDescriptor.addressRange.startAddress];
-            data.append(QString::number(byteValue, 10) + "\n");
-        }
+                : (*this->state.data)[byteItem.startAddress - this->state.memoryDescriptor.addressRange.startAddress];
+            data.append(QString::number(byteValue, 10) + "
+");
+        });
 
         QApplication::clipboard()->setText(std::move(data));
     }
 
     void ItemGraphicsScene::copyBinaryBitStringToClipboard(bool withDelimiters) {
-        if (this->selectedByteItemsByAddress.empty()) {
+        if (this->state.selection.empty() || !this->state.data.has_value()) {
             return;
         }
 
         auto data = QString();
 
-        for (const auto& [address, byteItem] : this->sortedByteItemsByAddress()) {
-            const unsigned char byteValue = byteItem->excluded
+        this->forEachSelectedByteItem([this, &data, withDelimiters] (const ByteItem& byteItem) {
+            const unsigned char byteValue = byteItem.excluded
                 ? 0x00
-                : (*this->state.data)[byteItem->startAddress - this->state.memoryDescriptor.addressRange.startAddress];
+                : (*this->state.data)[byteItem.startAddress - this->state.memoryDescriptor.addressRange.startAddress];
 
             data.append(
                 withDelimiters
-                    ? "0b" + QString::number(byteValue, 2).rightJustified(8, '0') + "\n"
+                    ? "0b" + QString::number(byteValue, 2).rightJustified(8, '0') + "
+"
                     : QString::number(byteValue, 2).rightJustified(8, '0') + " "
             );
-        }
+        });
 
         QApplication::clipboard()->setText(std::move(data));
     }
 
     void ItemGraphicsScene::copyValueMappingToClipboard() {
-        if (this->selectedByteItemsByAddress.empty() || !this->state.data.has_value()) {
+        if (this->state.selection.empty() || !this->state.data.has_value()) {
             return;
         }
 
         auto data = QJsonObject();
 
-        for (const auto& [address, byteItem] : this->sortedByteItemsByAddress()) {
-            const unsigned char byteValue = byteItem->excluded
+        this->forEachSelectedByteItem([this, &data] (const ByteItem& byteItem) {
+            const unsigned char byteValue = byteItem.excluded
                 ? 0x00
-                : (*this->state.data)[byteItem->startAddress - this->state.memoryDescriptor.addressRange.startAddress];
+                : (*this->state.data)[byteItem.startAddress - this->state.memoryDescriptor.addressRange.startAddress];
 
             data.insert(
-                "0x" + QString::number(address, 16).rightJustified(8, '0').toUpper(),
+                "0x" + QString::number(byteItem.startAddress, 16).rightJustified(8, '0').toUpper(),
                 "0x" + QString::number(byteValue, 16).rightJustified(2, '0').toUpper()
             );
-        }
+        });
 
         QApplication::clipboard()->setText(QJsonDocument(data).toJson(QJsonDocument::JsonFormat::Indented));
     }
 
     void ItemGraphicsScene::copyAsciiValueToClipboard() {
-        if (this->selectedByteItemsByAddress.empty() || !this->state.data.has_value()) {
+        if (this->state.selection.empty() || !this->state.data.has_value()) {
             return;
         }
 
         auto data = QString();
 
-        for (const auto& [address, byteItem] : this->sortedByteItemsByAddress()) {
+        this->forEachSelectedByteItem([this, &data] (const ByteItem& byteItem) {
             const unsigned char byteValue =
-                (*this->state.data)[byteItem->startAddress - this->state.memoryDescriptor.addressRange.startAddress];
+                (*this->state.data)[byteItem.startAddress - this->state.memoryDescriptor.addressRange.startAddress];
 
-            if (byteItem->excluded || byteValue < 32 || byteValue > 126) {
-                continue;
+            if (byteItem.excluded || byteValue < 32 || byteValue > 126) {
+                return;
             }
 
             data.append(QChar(byteValue));
-        }
+        });
 
         QApplication::clipboard()->setText(std::move(data));
     }
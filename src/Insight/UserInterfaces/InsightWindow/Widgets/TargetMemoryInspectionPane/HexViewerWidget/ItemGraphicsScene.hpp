@@ -4,13 +4,14 @@
 #include <QGraphicsView>
 #include <QScrollBar>
 #include <optional>
-#include <set>
-#include <unordered_map>
 #include <memory>
 #include <vector>
+#include <functional>
+#include <chrono>
 #include <QGraphicsSceneMouseEvent>
 #include <QGraphicsSceneWheelEvent>
 #include <QGraphicsSceneContextMenuEvent>
+#include <QGraphicsSceneHelpEvent>
 #include <QKeyEvent>
 #include <QGraphicsRectItem>
 #include <QPointF>
@@ -27,6 +28,7 @@
 #include "TopLevelGroupItem.hpp"
 #include "GroupItem.hpp"
 #include "ByteItem.hpp"
+#include "ByteSelection.hpp"
 #include "ByteAddressContainer.hpp"
 #include "ContextMenuAction.hpp"
 
@@ -46,7 +48,7 @@ namespace Bloom::Widgets
     public:
         ItemGraphicsScene(
             const Targets::TargetMemoryDescriptor& targetMemoryDescriptor,
-            const std::optional<Targets::TargetMemoryBuffer>& data,
+            const std::optional<SharedMemoryBuffer>& data,
             const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
             const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
             HexViewerWidgetSettings& settings,
@@ -55,20 +57,45 @@ namespace Bloom::Widgets
 
         void init();
         void updateStackPointer(Targets::TargetStackPointer stackPointer);
-        void selectByteItems(const std::set<Targets::TargetMemoryAddress>& addresses);
+        void updateStackWatermark(std::optional<Targets::TargetMemoryAddress> stackWatermark);
+        void selectByteItems(const ByteSelection& selection);
+
+        /**
+         * Queues the construction of a new item hierarchy (and index) on an InsightWorker thread. The current
+         * hierarchy remains in place until the new one is ready - see ItemGraphicsScene::applyItemHierarchy().
+         *
+         * There is only ever one construction in progress. Requests made while one is in progress are coalesced
+         * into a single rebuild, which begins once the in-progress construction has finished.
+         */
         void rebuildItemHierarchy();
+
+        /**
+         * Adjusts the scene to the size of the view. If the width has changed, the item hierarchy is rebuilt, once
+         * the view has stopped changing size for ItemGraphicsScene::RESIZE_DEBOUNCE_INTERVAL.
+         */
         void adjustSize();
         void setEnabled(bool enabled);
         void refreshValues();
+        void refreshChangedValues(const std::vector<Targets::TargetMemoryAddressRange>& changedRanges);
         QPointF getByteItemPositionByAddress(Targets::TargetMemoryAddress address);
+
+        /**
+         * Returns the address range spanned by the byte items currently visible in the viewport.
+         *
+         * @return
+         *  std::nullopt if no byte items are visible.
+         */
+        std::optional<Targets::TargetMemoryAddressRange> visibleAddressRange() const;
         void addExternalContextMenuAction(ContextMenuAction* action);
 
     signals:
         void ready();
         void hoveredAddress(const std::optional<Targets::TargetMemoryAddress>& address);
-        void selectionChanged(const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress);
+        void selectionChanged(const ByteSelection& selection);
 
     protected:
+        static constexpr auto RESIZE_DEBOUNCE_INTERVAL = std::chrono::milliseconds(100);
+
         bool enabled = true;
 
         HexViewerSharedState state;
@@ -79,6 +106,16 @@ namespace Bloom::Widgets
         std::unique_ptr<TopLevelGroupItem> topLevelGroup = nullptr;
         std::unique_ptr<HexViewerItemIndex> itemIndex = nullptr;
 
+        bool itemHierarchyRebuildInProgress = false;
+        bool itemHierarchyRebuildPending = false;
+
+        /**
+         * The scene width for which the current item hierarchy was laid out.
+         */
+        int itemHierarchyWidth = 0;
+
+        QTimer* resizeDebounceTimer = new QTimer(this);
+
         HexViewerItemRenderer* renderer = nullptr;
 
         Targets::TargetState targetState = Targets::TargetState::UNKNOWN;
@@ -87,7 +124,10 @@ namespace Bloom::Widgets
 
         ByteAddressContainer* byteAddressContainer = nullptr;
 
-        std::unordered_map<Targets::TargetMemoryAddress, ByteItem*> selectedByteItemsByAddress;
+        /**
+         * Byte items that were marked as changed by the last call to ItemGraphicsScene::refreshChangedValues().
+         */
+        std::vector<ByteItem*> changedByteItems;
 
         QGraphicsRectItem* rubberBandRectItem = nullptr;
         std::optional<QPointF> rubberBandInitPoint = std::nullopt;
@@ -130,6 +170,29 @@ namespace Bloom::Widgets
             return std::max(this->parent->viewport()->width(), 200) - 2;
         }
 
+        /**
+         * Replaces the current item hierarchy and index with the ones constructed by
+         * ConstructHexViewerTopLevelGroupItem.
+         *
+         * @param topLevelGroupItem
+         * @param itemIndex
+         */
+        void applyItemHierarchy(
+            std::unique_ptr<TopLevelGroupItem> topLevelGroupItem,
+            std::unique_ptr<HexViewerItemIndex> itemIndex
+        );
+
+        /**
+         * Adjusts the scene rect, the renderer and the hover rects to the size of the view and the item hierarchy.
+         */
+        void refreshSceneRect();
+
+        /**
+         * Called after the item hierarchy has been replaced. Derived scenes should reapply any state they hold on
+         * the byte items, as the new hierarchy has its own set of byte items.
+         */
+        virtual void onItemHierarchyReplaced() {}
+
         virtual void initRenderer();
         virtual QMargins margins();
         virtual QPointF addressContainerPosition();
@@ -140,18 +203,29 @@ namespace Bloom::Widgets
         void mouseReleaseEvent(QGraphicsSceneMouseEvent* mouseEvent) override;
         void keyPressEvent(QKeyEvent* keyEvent) override;
         void contextMenuEvent(QGraphicsSceneContextMenuEvent* event) override;
+
+        /**
+         * Shows the symbol (from the project's ELF file - see SymbolService) containing the hovered byte, as a
+         * tooltip.
+         *
+         * @param event
+         */
+        void helpEvent(QGraphicsSceneHelpEvent* event) override;
         int getScrollbarValue();
         void onTargetStateChanged(Targets::TargetState newState);
         void onByteItemEnter(ByteItem& byteItem);
         void onByteItemLeave();
         void clearSelectionRectItem();
-        void selectByteItem(ByteItem& byteItem);
-        void deselectByteItem(ByteItem& byteItem);
-        void toggleByteItemSelection(ByteItem& byteItem);
         void clearByteItemSelection();
         void selectAllByteItems();
         void setAddressType(AddressType type);
-        std::map<Targets::TargetMemoryAddress, ByteItem*> sortedByteItemsByAddress();
+
+        /**
+         * Invokes the given callback for each selected byte item, in ascending address order.
+         *
+         * @param callback
+         */
+        void forEachSelectedByteItem(const std::function<void(const ByteItem&)>& callback) const;
         void copyAddressesToClipboard(AddressType type);
         void copyHexValuesToClipboard(bool withDelimiters);
         void copyDecimalValuesToClipboard();
@@ -10,7 +10,7 @@ namespace Bloom::Widgets
 
     ItemGraphicsView::ItemGraphicsView(
         const TargetMemoryDescriptor& targetMemoryDescriptor,
-        const std::optional<Targets::TargetMemoryBuffer>& data,
+        const std::optional<SharedMemoryBuffer>& data,
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
         HexViewerWidgetSettings& settings,
@@ -19,7 +19,7 @@ namespace Bloom::Widgets
     public:
         ItemGraphicsView(
             const Targets::TargetMemoryDescriptor& targetMemoryDescriptor,
-            const std::optional<Targets::TargetMemoryBuffer>& data,
+            const std::optional<SharedMemoryBuffer>& data,
             const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
             const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
             HexViewerWidgetSettings& settings,
@@ -39,7 +39,7 @@ namespace Bloom::Widgets
 
     protected:
         const Targets::TargetMemoryDescriptor& targetMemoryDescriptor;
-        const std::optional<Targets::TargetMemoryBuffer>& data;
+        const std::optional<SharedMemoryBuffer>& data;
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions;
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions;
         HexViewerWidgetSettings& settings;
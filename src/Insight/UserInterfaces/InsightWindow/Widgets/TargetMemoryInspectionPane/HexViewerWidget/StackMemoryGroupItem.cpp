@@ -8,15 +8,14 @@ namespace Bloom::Widgets
         Targets::TargetStackPointer stackPointer,
         const HexViewerSharedState& hexViewerState,
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
-        std::unordered_map<Targets::TargetMemoryAddress, ByteItem>& byteItemsByAddress,
+        ByteItemContainer& byteItemsByAddress,
         HexViewerItem* parent
     )
         : GroupItem(stackPointer + 1, parent)
         , stackPointer(stackPointer)
-        , hexViewerState(hexViewerState)
     {
         const auto startAddress = this->startAddress;
-        const auto endAddress = this->hexViewerState.memoryDescriptor.addressRange.endAddress;
+        const auto endAddress = hexViewerState.memoryDescriptor.addressRange.endAddress;
 
         // Sanity check
         assert(byteItemsByAddress.contains(startAddress) && byteItemsByAddress.contains(endAddress));
@@ -82,9 +81,9 @@ namespace Bloom::Widgets
         this->groupSize.setWidth(maximumWidth);
     }
 
-    void StackMemoryGroupItem::refreshValues() {
+    void StackMemoryGroupItem::refreshValues(const HexViewerSharedState& hexViewerState) {
         for (auto& focusedRegionItem : this->focusedRegionGroupItems) {
-            focusedRegionItem.refreshValue(this->hexViewerState);
+            focusedRegionItem.refreshValue(hexViewerState);
         }
     }
 
@@ -20,7 +20,7 @@ namespace Bloom::Widgets
             Targets::TargetStackPointer stackPointer,
             const HexViewerSharedState& hexViewerState,
             const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
-            std::unordered_map<Targets::TargetMemoryAddress, ByteItem>& byteItemsByAddress,
+            ByteItemContainer& byteItemsByAddress,
             HexViewerItem* parent
         );
 
@@ -28,7 +28,7 @@ namespace Bloom::Widgets
 
         void adjustItemPositions(const int maximumWidth, const HexViewerSharedState* hexViewerState) override;
 
-        void refreshValues();
+        void refreshValues(const HexViewerSharedState& hexViewerState);
 
     protected:
         QMargins groupMargins(const HexViewerSharedState* hexViewerState, const int maximumWidth) const override;
@@ -38,7 +38,6 @@ namespace Bloom::Widgets
         }
 
     private:
-        const HexViewerSharedState& hexViewerState;
         std::list<FocusedRegionGroupItem> focusedRegionGroupItems;
     };
 }
@@ -5,32 +5,32 @@ namespace Bloom::Widgets
     TopLevelGroupItem::TopLevelGroupItem(
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
-        const HexViewerSharedState& hexViewerState
+        const Targets::TargetMemoryAddressRange& addressRange
     )
         : GroupItem(0, nullptr)
+        , byteItemsByAddress(addressRange)
         , focusedMemoryRegions(focusedMemoryRegions)
         , excludedMemoryRegions(excludedMemoryRegions)
-        , hexViewerState(hexViewerState)
-    {
-        const auto memorySize = this->hexViewerState.memoryDescriptor.size();
-        const auto startAddress = this->hexViewerState.memoryDescriptor.addressRange.startAddress;
-
-        for (Targets::TargetMemorySize i = 0; i < memorySize; i++) {
-            const auto address = startAddress + i;
-            this->byteItemsByAddress.emplace(address, ByteItem(address));
-        }
+    {}
+
+    TopLevelGroupItem::~TopLevelGroupItem() {
+        /*
+         * Our members (including the byte items) are destroyed before the GroupItem destructor runs, so it mustn't
+         * touch any of our child items.
+         */
+        this->items.clear();
     }
 
-    void TopLevelGroupItem::rebuildItemHierarchy() {
+    void TopLevelGroupItem::rebuildItemHierarchy(const HexViewerSharedState& hexViewerState) {
         this->items.clear();
         this->focusedRegionGroupItems.clear();
         this->stackMemoryGroupItem.reset();
 
-        const auto& currentStackPointer = this->hexViewerState.currentStackPointer;
+        const auto& currentStackPointer = hexViewerState.currentStackPointer;
         const auto stackGroupingRequired = currentStackPointer.has_value()
-            && this->hexViewerState.settings.groupStackMemory
-            && *currentStackPointer >= this->hexViewerState.memoryDescriptor.addressRange.startAddress
-            && (*currentStackPointer + 1) <= this->hexViewerState.memoryDescriptor.addressRange.endAddress;
+            && hexViewerState.settings.groupStackMemory
+            && *currentStackPointer >= hexViewerState.memoryDescriptor.addressRange.startAddress
+            && (*currentStackPointer + 1) <= hexViewerState.memoryDescriptor.addressRange.endAddress;
 
         for (const auto& focusedRegion : this->focusedMemoryRegions) {
             if (
@@ -54,7 +54,7 @@ namespace Bloom::Widgets
         if (stackGroupingRequired) {
             this->stackMemoryGroupItem.emplace(
                 *(currentStackPointer),
-                this->hexViewerState,
+                hexViewerState,
                 this->focusedMemoryRegions,
                 this->byteItemsByAddress,
                 this
@@ -63,7 +63,9 @@ namespace Bloom::Widgets
             items.emplace_back(&*(this->stackMemoryGroupItem));
         }
 
-        for (auto& [address, byteItem] : this->byteItemsByAddress) {
+        this->items.reserve(this->items.size() + this->byteItemsByAddress.size());
+
+        for (auto& byteItem : this->byteItemsByAddress) {
             byteItem.excluded = false;
 
             if (byteItem.parent != nullptr && byteItem.parent != this) {
@@ -89,16 +91,16 @@ namespace Bloom::Widgets
         }
 
         this->sortItems();
-        this->refreshValues();
+        this->refreshValues(hexViewerState);
     }
 
-    void TopLevelGroupItem::refreshValues() {
+    void TopLevelGroupItem::refreshValues(const HexViewerSharedState& hexViewerState) {
         for (auto& focusedRegionItem : this->focusedRegionGroupItems) {
-            focusedRegionItem.refreshValue(this->hexViewerState);
+            focusedRegionItem.refreshValue(hexViewerState);
         }
 
         if (this->stackMemoryGroupItem.has_value()) {
-            this->stackMemoryGroupItem->refreshValues();
+            this->stackMemoryGroupItem->refreshValues(hexViewerState);
         }
     }
 }
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <unordered_map>
 #include <vector>
 #include <list>
 #include <optional>
@@ -9,6 +8,7 @@
 #include "FocusedRegionGroupItem.hpp"
 #include "StackMemoryGroupItem.hpp"
 #include "ByteItem.hpp"
+#include "ByteItemContainer.hpp"
 
 #include "src/Targets/TargetMemory.hpp"
 
@@ -17,23 +17,32 @@
 
 namespace Bloom::Widgets
 {
+    /**
+     * The root of the hex viewer item hierarchy.
+     *
+     * The top level group item holds its own copy of the focused and excluded regions, and it only accesses the hex
+     * viewer state when it's given it. This allows us to construct the hierarchy (and position its items) from a
+     * snapshot of the state, on an InsightWorker thread - see ConstructHexViewerTopLevelGroupItem.
+     */
     class TopLevelGroupItem: public GroupItem
     {
     public:
-        std::unordered_map<Targets::TargetMemoryAddress, ByteItem> byteItemsByAddress;
+        ByteItemContainer byteItemsByAddress;
 
         TopLevelGroupItem(
             const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
             const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
-            const HexViewerSharedState& hexViewerState
+            const Targets::TargetMemoryAddressRange& addressRange
         );
 
-        void rebuildItemHierarchy();
+        ~TopLevelGroupItem();
 
-        void refreshValues();
+        void rebuildItemHierarchy(const HexViewerSharedState& hexViewerState);
 
-        void adjustItemPositions(const int maximumWidth) {
-            GroupItem::adjustItemPositions(maximumWidth, &(this->hexViewerState));
+        void refreshValues(const HexViewerSharedState& hexViewerState);
+
+        void adjustItemPositions(const int maximumWidth, const HexViewerSharedState& hexViewerState) {
+            GroupItem::adjustItemPositions(maximumWidth, &hexViewerState);
         }
 
         void setPosition(const QPoint& position) {
@@ -41,9 +50,8 @@ namespace Bloom::Widgets
         }
 
     private:
-        const std::vector<FocusedMemoryRegion>& focusedMemoryRegions;
-        const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions;
-        const HexViewerSharedState& hexViewerState;
+        std::vector<FocusedMemoryRegion> focusedMemoryRegions;
+        std::vector<ExcludedMemoryRegion> excludedMemoryRegions;
 
         std::list<FocusedRegionGroupItem> focusedRegionGroupItems;
         std::optional<StackMemoryGroupItem> stackMemoryGroupItem;
@@ -0,0 +1,133 @@
+#include "LiveRefreshScheduler.hpp"
+
+#include <algorithm>
+
+namespace Bloom
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+    using Targets::TargetMemoryAddressRange;
+
+    LiveRefreshScheduler::LiveRefreshScheduler(const TargetMemoryAddressRange& memoryAddressRange)
+        : memoryAddressRange(memoryAddressRange)
+        , sweepAddress(memoryAddressRange.startAddress)
+    {}
+
+    void LiveRefreshScheduler::setBandwidthBudget(std::uint32_t bytesPerSecond) {
+        this->bandwidthBudget = bytesPerSecond;
+        this->allowance = std::min(this->allowance, static_cast<double>(this->bandwidthBudget));
+    }
+
+    void LiveRefreshScheduler::setPriorityRanges(std::vector<TargetMemoryAddressRange> priorityRanges) {
+        this->priorityRanges.clear();
+
+        std::sort(priorityRanges.begin(), priorityRanges.end());
+
+        for (auto range : priorityRanges) {
+            if (!this->memoryAddressRange.intersectsWith(range)) {
+                continue;
+            }
+
+            range.startAddress = std::max(range.startAddress, this->memoryAddressRange.startAddress);
+            range.endAddress = std::min(range.endAddress, this->memoryAddressRange.endAddress);
+
+            if (!this->priorityRanges.empty() && this->priorityRanges.back().endAddress + 1 >= range.startAddress) {
+                auto& lastRange = this->priorityRanges.back();
+                lastRange.endAddress = std::max(lastRange.endAddress, range.endAddress);
+                continue;
+            }
+
+            this->priorityRanges.push_back(range);
+        }
+    }
+
+    void LiveRefreshScheduler::reset() {
+        this->allowance = 0;
+        this->sweepAddress = this->memoryAddressRange.startAddress;
+    }
+
+    std::vector<TargetMemoryAddressRange> LiveRefreshScheduler::schedule(std::chrono::milliseconds elapsed) {
+        auto output = std::vector<TargetMemoryAddressRange>();
+
+        this->allowance = std::min(
+            this->allowance + static_cast<double>(this->bandwidthBudget) * static_cast<double>(elapsed.count())
+                / 1000,
+            static_cast<double>(this->bandwidthBudget)
+        );
+
+        if (this->allowance < LiveRefreshScheduler::MIN_READ_SIZE) {
+            return output;
+        }
+
+        auto remaining = static_cast<TargetMemorySize>(this->allowance);
+
+        for (const auto& range : this->priorityRanges) {
+            if (remaining < LiveRefreshScheduler::MIN_READ_SIZE) {
+                break;
+            }
+
+            const auto rangeSize = range.endAddress - range.startAddress + 1;
+            const auto readSize = std::min(rangeSize, remaining);
+
+            LiveRefreshScheduler::appendReadRanges(
+                TargetMemoryAddressRange(range.startAddress, range.startAddress + readSize - 1),
+                output
+            );
+            remaining -= readSize;
+        }
+
+        // Spend whatever is left on the sweep, wrapping around at the end of the memory (but never reading past
+        // where the sweep started, in a single call)
+        const auto memorySize = this->memoryAddressRange.endAddress - this->memoryAddressRange.startAddress + 1;
+        auto sweepRemaining = std::min(remaining, memorySize);
+        remaining -= sweepRemaining;
+
+        while (sweepRemaining >= LiveRefreshScheduler::MIN_READ_SIZE) {
+            const auto readSize = std::min(
+                sweepRemaining,
+                this->memoryAddressRange.endAddress - this->sweepAddress + 1
+            );
+
+            LiveRefreshScheduler::appendReadRanges(
+                TargetMemoryAddressRange(this->sweepAddress, this->sweepAddress + readSize - 1),
+                output
+            );
+
+            sweepRemaining -= readSize;
+            this->sweepAddress += readSize;
+
+            if (this->sweepAddress > this->memoryAddressRange.endAddress) {
+                this->sweepAddress = this->memoryAddressRange.startAddress;
+            }
+        }
+
+        // Unspent allowance (from either stage) carries over to the next call
+        remaining += sweepRemaining;
+        this->allowance -= static_cast<double>(static_cast<TargetMemorySize>(this->allowance) - remaining);
+
+        return output;
+    }
+
+    void LiveRefreshScheduler::appendReadRanges(
+        const TargetMemoryAddressRange& range,
+        std::vector<TargetMemoryAddressRange>& output
+    ) {
+        for (
+            auto startAddress = range.startAddress;
+            startAddress <= range.endAddress;
+            startAddress += LiveRefreshScheduler::MAX_READ_SIZE
+        ) {
+            output.emplace_back(
+                startAddress,
+                std::min(
+                    static_cast<TargetMemoryAddress>(startAddress + LiveRefreshScheduler::MAX_READ_SIZE - 1),
+                    range.endAddress
+                )
+            );
+
+            if (range.endAddress - startAddress < LiveRefreshScheduler::MAX_READ_SIZE) {
+                break;
+            }
+        }
+    }
+}
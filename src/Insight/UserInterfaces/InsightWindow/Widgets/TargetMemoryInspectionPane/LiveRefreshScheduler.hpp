@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <chrono>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom
+{
+    /**
+     * Decides which parts of a memory should be read, and when, to keep a memory inspection pane up to date whilst
+     * the target is running, without exceeding a bandwidth budget.
+     *
+     * The budget is enforced via a token bucket - each call to LiveRefreshScheduler::schedule() accrues an allowance
+     * for the time that has elapsed since the previous call, which is then spent on reads. The allowance is capped at
+     * one second's worth of the budget, so that idle periods don't result in bursts.
+     *
+     * The allowance is spent on the priority ranges (the rows that are currently visible, and any focused memory
+     * regions) first. Each priority range is read at most once per call, and any allowance left over is spent on
+     * sweeping the rest of the memory, from where the previous sweep left off.
+     *
+     * Reads are split into blocks of no more than LiveRefreshScheduler::MAX_READ_SIZE bytes. Insight issues its
+     * commands to the TargetController with a lower priority than the debug client, so keeping the reads small means
+     * the debug client never has to wait long for the debug tool.
+     */
+    class LiveRefreshScheduler
+    {
+    public:
+        static constexpr Targets::TargetMemorySize MAX_READ_SIZE = 256;
+
+        /**
+         * Reads smaller than this aren't worth the USB round trip. The scheduler waits until it has accrued enough
+         * allowance for at least this many bytes.
+         */
+        static constexpr Targets::TargetMemorySize MIN_READ_SIZE = 16;
+
+        explicit LiveRefreshScheduler(const Targets::TargetMemoryAddressRange& memoryAddressRange);
+
+        /**
+         * @param bytesPerSecond
+         */
+        void setBandwidthBudget(std::uint32_t bytesPerSecond);
+
+        /**
+         * Sets the ranges that should be refreshed before any others. The ranges will be clipped to the memory's
+         * address range, and merged where they overlap.
+         *
+         * @param priorityRanges
+         */
+        void setPriorityRanges(std::vector<Targets::TargetMemoryAddressRange> priorityRanges);
+
+        /**
+         * Clears the accrued allowance and restarts the sweep.
+         */
+        void reset();
+
+        /**
+         * Accrues the allowance for the given elapsed time and returns the address ranges that should be read now.
+         *
+         * @param elapsed
+         *
+         * @return
+         */
+        std::vector<Targets::TargetMemoryAddressRange> schedule(std::chrono::milliseconds elapsed);
+
+    private:
+        Targets::TargetMemoryAddressRange memoryAddressRange;
+        std::uint32_t bandwidthBudget = 0;
+
+        /**
+         * Sorted and non-overlapping.
+         */
+        std::vector<Targets::TargetMemoryAddressRange> priorityRanges;
+
+        double allowance = 0;
+        Targets::TargetMemoryAddress sweepAddress = 0;
+
+        /**
+         * Splits the given range into blocks of no more than MAX_READ_SIZE bytes and appends them to the output.
+         *
+         * @param range
+         * @param output
+         */
+        static void appendReadRanges(
+            const Targets::TargetMemoryAddressRange& range,
+            std::vector<Targets::TargetMemoryAddressRange>& output
+        );
+    };
+}
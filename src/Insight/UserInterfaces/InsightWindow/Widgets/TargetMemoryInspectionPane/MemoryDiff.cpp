@@ -0,0 +1,53 @@
+#include "MemoryDiff.hpp"
+
+#include <cassert>
+
+#include "src/Helpers/BufferDiff.hpp"
+
+namespace Bloom
+{
+    using Targets::TargetMemoryAddressRange;
+
+    std::vector<TargetMemoryAddressRange> MemoryDiff::differingRanges(
+        std::span<const unsigned char> bufferA,
+        std::span<const unsigned char> bufferB,
+        Targets::TargetMemoryAddress startAddress
+    ) {
+        return BufferDiff::differingRanges(bufferA, bufferB, startAddress);
+    }
+
+    std::vector<TargetMemoryAddressRange> MemoryDiff::differingRanges(
+        const SharedMemoryBuffer& bufferA,
+        const SharedMemoryBuffer& bufferB,
+        Targets::TargetMemoryAddress startAddress
+    ) {
+        assert(bufferA.size() == bufferB.size());
+
+        auto output = std::vector<TargetMemoryAddressRange>();
+
+        const auto pageCount = std::min(bufferA.pageCount(), bufferB.pageCount());
+        for (auto pageIndex = std::size_t(0); pageIndex < pageCount; ++pageIndex) {
+            if (bufferA.sharesPage(pageIndex, bufferB)) {
+                continue;
+            }
+
+            const auto pageRanges = MemoryDiff::differingRanges(
+                bufferA.page(pageIndex),
+                bufferB.page(pageIndex),
+                startAddress + static_cast<Targets::TargetMemoryAddress>(pageIndex * SharedMemoryBuffer::PAGE_SIZE)
+            );
+
+            for (const auto& range : pageRanges) {
+                // Merge ranges that span a page boundary
+                if (!output.empty() && output.back().endAddress + 1 == range.startAddress) {
+                    output.back().endAddress = range.endAddress;
+                    continue;
+                }
+
+                output.push_back(range);
+            }
+        }
+
+        return output;
+    }
+}
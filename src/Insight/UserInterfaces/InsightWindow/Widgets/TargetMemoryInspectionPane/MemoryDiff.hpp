@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <span>
+
+#include "src/Targets/TargetMemory.hpp"
+#include "SharedMemoryBuffer.hpp"
+
+namespace Bloom
+{
+    class MemoryDiff
+    {
+    public:
+        /**
+         * Compares two equally sized memory buffers and returns the address ranges (in ascending order) at which they
+         * differ. Adjacent differing bytes are merged into a single range. See BufferDiff::differingRanges().
+         *
+         * @param bufferA
+         * @param bufferB
+         *
+         * @param startAddress
+         *  The address of the first byte in both buffers.
+         *
+         * @return
+         */
+        static std::vector<Targets::TargetMemoryAddressRange> differingRanges(
+            std::span<const unsigned char> bufferA,
+            std::span<const unsigned char> bufferB,
+            Targets::TargetMemoryAddress startAddress
+        );
+
+        /**
+         * Compares two equally sized shared memory buffers, as above.
+         *
+         * Pages that are shared between the two buffers are identical, so they're skipped without comparing their
+         * content. When one buffer is a (modified) copy of the other, only the modified pages are compared.
+         *
+         * @param bufferA
+         * @param bufferB
+         * @param startAddress
+         *
+         * @return
+         */
+        static std::vector<Targets::TargetMemoryAddressRange> differingRanges(
+            const SharedMemoryBuffer& bufferA,
+            const SharedMemoryBuffer& bufferB,
+            Targets::TargetMemoryAddress startAddress
+        );
+    };
+}
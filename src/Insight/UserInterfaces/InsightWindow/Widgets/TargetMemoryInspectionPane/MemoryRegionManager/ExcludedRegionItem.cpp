@@ -1,9 +1,6 @@
 #include "ExcludedRegionItem.hpp"
 
-#include <QFile>
-
 #include "src/Services/PathService.hpp"
-#include "src/Exceptions/Exception.hpp"
 #include "src/Insight/UserInterfaces/InsightWindow/UiLoader.hpp"
 
 namespace Bloom::Widgets
@@ -15,20 +12,15 @@ namespace Bloom::Widgets
     )
         : memoryRegion(region), RegionItem(region, memoryDescriptor, parent)
     {
-        auto formUiFile = QFile(
+        auto uiLoader = UiLoader(this);
+        this->formWidget = uiLoader.load(
             QString::fromStdString(Services::PathService::compiledResourcesPath()
                 + "/src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane"
                     + "/MemoryRegionManager/UiFiles/ExcludedMemoryRegionForm.ui"
-            )
+            ),
+            this
         );
 
-        if (!formUiFile.open(QFile::ReadOnly)) {
-            throw Bloom::Exceptions::Exception("Failed to open excluded region item form UI file");
-        }
-
-        auto uiLoader = UiLoader(this);
-        this->formWidget = uiLoader.load(&formUiFile, this);
-
         this->initFormInputs();
     }
 
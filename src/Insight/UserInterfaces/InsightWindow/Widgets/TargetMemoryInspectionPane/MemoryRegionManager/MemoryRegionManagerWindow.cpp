@@ -3,10 +3,12 @@
 #include <QFile>
 #include <QSize>
 #include <QDesktopServices>
+#include <optional>
 
 #include "src/Insight/UserInterfaces/InsightWindow/UiLoader.hpp"
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/ErrorDialogue/ErrorDialogue.hpp"
 
+#include "src/Targets/TargetMemoryAddressRangeIndex.hpp"
 #include "src/Services/PathService.hpp"
 #include "src/Helpers/EnumToStringMappings.hpp"
 #include "src/Exceptions/Exception.hpp"
@@ -318,84 +320,80 @@ namespace Bloom::Widgets
         auto processedFocusedMemoryRegions = std::vector<FocusedMemoryRegion>();
         auto processedExcludedMemoryRegions = std::vector<ExcludedMemoryRegion>();
 
-        for (auto* focusedRegionItem : this->focusedRegionItems) {
-            const auto validationFailures = focusedRegionItem->getValidationFailures();
+        /*
+         * All region items, focused regions first, and their address ranges, for the intersection checks below.
+         */
+        auto regionItems = std::vector<RegionItem*>();
+        auto regionAddressRanges = std::vector<Targets::TargetMemoryAddressRange>();
+
+        const auto validateRegionItem = [this] (RegionItem* regionItem) {
+            const auto validationFailures = regionItem->getValidationFailures();
 
             if (!validationFailures.empty()) {
                 auto* errorDialogue = new ErrorDialogue(
                     "Invalid Memory Region",
-                    "Invalid memory region \"" + focusedRegionItem->getRegionNameInputValue() + "\""
-                        + "\n\n- " + validationFailures.join("\n- "),
+                    "Invalid memory region \"" + regionItem->getRegionNameInputValue() + "\""
+                        + "<br/><br/>- " + validationFailures.join("<br/>- "),
                     this
                 );
                 errorDialogue->show();
+                return false;
+            }
+
+            return true;
+        };
+
+        for (auto* focusedRegionItem : this->focusedRegionItems) {
+            if (!validateRegionItem(focusedRegionItem)) {
                 return;
             }
 
             focusedRegionItem->applyChanges();
-            const auto& focusedRegion = focusedRegionItem->getMemoryRegion();
-            for (const auto& processedFocusedRegion : processedFocusedMemoryRegions) {
-                if (processedFocusedRegion.intersectsWith(focusedRegion)) {
-                    auto* errorDialogue = new ErrorDialogue(
-                        "Intersecting Region Found",
-                        "Region \"" + focusedRegionItem->getRegionNameInputValue()
-                            + "\" intersects with region \"" + processedFocusedRegion.name + "\". "
-                            + "Regions cannot intersect. Please review the relevant address ranges.",
-                        this
-                    );
-                    errorDialogue->show();
-                    return;
-                }
+            processedFocusedMemoryRegions.emplace_back(focusedRegionItem->getMemoryRegion());
+            regionItems.push_back(focusedRegionItem);
+            regionAddressRanges.push_back(focusedRegionItem->getMemoryRegion().addressRange);
+        }
+
+        for (auto* excludedRegionItem : this->excludedRegionItems) {
+            if (!validateRegionItem(excludedRegionItem)) {
+                return;
             }
 
-            processedFocusedMemoryRegions.emplace_back(focusedRegion);
+            excludedRegionItem->applyChanges();
+            processedExcludedMemoryRegions.emplace_back(excludedRegionItem->getMemoryRegion());
+            regionItems.push_back(excludedRegionItem);
+            regionAddressRanges.push_back(excludedRegionItem->getMemoryRegion().addressRange);
         }
 
-        for (auto* excludedRegionItem : this->excludedRegionItems) {
-            const auto validationFailures = excludedRegionItem->getValidationFailures();
+        /*
+         * Regions cannot intersect. We report each intersection against the region that precedes it, to keep the
+         * error consistent with the order in which the regions are listed.
+         */
+        const auto regionIndex = Targets::TargetMemoryAddressRangeIndex(regionAddressRanges);
 
-            if (!validationFailures.empty()) {
+        for (auto itemIndex = std::size_t(0); itemIndex < regionItems.size(); ++itemIndex) {
+            auto intersectingItemIndex = std::optional<std::size_t>();
+
+            regionIndex.forEachIntersecting(
+                regionAddressRanges[itemIndex],
+                [itemIndex, &intersectingItemIndex] (const Targets::TargetMemoryAddressRange&, std::size_t index) {
+                    if (index < itemIndex && (!intersectingItemIndex.has_value() || index < *intersectingItemIndex)) {
+                        intersectingItemIndex = index;
+                    }
+                }
+            );
+
+            if (intersectingItemIndex.has_value()) {
                 auto* errorDialogue = new ErrorDialogue(
-                    "Invalid Memory Region",
-                    "Invalid memory region \"" + excludedRegionItem->getRegionNameInputValue() + "\""
-                        + "<br/><br/>- " + validationFailures.join("<br/>- "),
+                    "Intersecting Region Found",
+                    "Region \"" + regionItems[itemIndex]->getRegionNameInputValue()
+                        + "\" intersects with region \"" + regionItems[*intersectingItemIndex]->getMemoryRegion().name
+                        + "\". Regions cannot intersect. Please review the relevant address ranges.",
                     this
                 );
                 errorDialogue->show();
                 return;
             }
-
-            excludedRegionItem->applyChanges();
-            auto excludedRegion = excludedRegionItem->getMemoryRegion();
-            for (const auto& processedFocusedRegion : processedFocusedMemoryRegions) {
-                if (processedFocusedRegion.intersectsWith(excludedRegion)) {
-                    auto* errorDialogue = new ErrorDialogue(
-                        "Intersecting Region Found",
-                        "Region \"" + excludedRegionItem->getRegionNameInputValue()
-                            + "\" intersects with region \"" + processedFocusedRegion.name + "\". "
-                            + "Regions cannot intersect. Please review the relevant address ranges.",
-                        this
-                    );
-                    errorDialogue->show();
-                    return;
-                }
-            }
-
-            for (const auto& processedExcludedRegion : processedExcludedMemoryRegions) {
-                if (processedExcludedRegion.intersectsWith(excludedRegion)) {
-                    auto* errorDialogue = new ErrorDialogue(
-                        "Intersecting Region Found",
-                        "Region \"" + excludedRegionItem->getRegionNameInputValue()
-                            + "\" intersects with region \"" + processedExcludedRegion.name + "\". "
-                            + "Regions cannot intersect. Please review the relevant address ranges.",
-                        this
-                    );
-                    errorDialogue->show();
-                    return;
-                }
-            }
-
-            processedExcludedMemoryRegions.emplace_back(excludedRegion);
         }
 
         this->focusedMemoryRegions = std::move(processedFocusedMemoryRegions);
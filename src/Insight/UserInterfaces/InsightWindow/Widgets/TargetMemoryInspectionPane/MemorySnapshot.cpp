@@ -3,8 +3,16 @@
 #include <QUuid>
 #include <QByteArray>
 #include <QJsonArray>
+#include <QJsonDocument>
+#include <QFile>
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+
+#include "MemoryDiff.hpp"
 
 #include "src/Helpers/EnumToStringMappings.hpp"
+#include "src/Helpers/HexCodec.hpp"
 #include "src/Exceptions/Exception.hpp"
 
 namespace Bloom
@@ -13,7 +21,7 @@ namespace Bloom
         const QString& name,
         const QString& description,
         Targets::TargetMemoryType memoryType,
-        const Targets::TargetMemoryBuffer& data,
+        const SharedMemoryBuffer& data,
         Targets::TargetProgramCounter programCounter,
         Targets::TargetStackPointer stackPointer,
         const std::vector<FocusedMemoryRegion>& focusedRegions,
@@ -31,6 +39,268 @@ namespace Bloom
     {}
 
     MemorySnapshot::MemorySnapshot(const QJsonObject& jsonObject) {
+        if (!jsonObject.contains("hexData")) {
+            throw Exceptions::Exception("Missing data");
+        }
+
+        this->loadMetadata(jsonObject);
+
+        const auto hexData = jsonObject.find("hexData")->toString().toStdString();
+        this->data = SharedMemoryBuffer(HexCodec::decode(hexData));
+    }
+
+    MemorySnapshot::MemorySnapshot(const QByteArray& binary) {
+        using Exceptions::Exception;
+
+        auto header = BinaryHeader();
+
+        if (static_cast<std::size_t>(binary.size()) < sizeof(header)) {
+            throw Exception("Invalid snapshot file - missing header");
+        }
+
+        std::memcpy(&header, binary.constData(), sizeof(header));
+
+        if (header.magic != MemorySnapshot::BINARY_MAGIC || header.version != MemorySnapshot::BINARY_VERSION) {
+            throw Exception("Unsupported snapshot file format");
+        }
+
+        if (
+            static_cast<std::size_t>(binary.size())
+                < sizeof(header) + static_cast<std::size_t>(header.metadataSize) + header.payloadSize
+        ) {
+            throw Exception("Invalid snapshot file - truncated");
+        }
+
+        const auto metadata = QJsonDocument::fromJson(binary.mid(sizeof(header), header.metadataSize));
+
+        if (!metadata.isObject()) {
+            throw Exception("Invalid snapshot metadata");
+        }
+
+        this->loadMetadata(metadata.object());
+
+        const auto payloadOffset = static_cast<qsizetype>(sizeof(header) + header.metadataSize);
+        auto payload = QByteArray::fromRawData(
+            binary.constData() + payloadOffset,
+            static_cast<qsizetype>(header.payloadSize)
+        );
+
+        if ((header.flags & MemorySnapshot::BINARY_FLAG_COMPRESSED) != 0) {
+            payload = qUncompress(payload);
+
+            if (payload.isEmpty() && header.dataSize > 0) {
+                throw Exception("Failed to decompress snapshot data");
+            }
+        }
+
+        if ((header.flags & MemorySnapshot::BINARY_FLAG_DELTA) == 0) {
+            if (static_cast<std::size_t>(payload.size()) != header.dataSize) {
+                throw Exception("Invalid snapshot file - unexpected payload size");
+            }
+
+            this->data = SharedMemoryBuffer(std::span<const unsigned char>(
+                reinterpret_cast<const unsigned char*>(payload.constData()),
+                static_cast<std::size_t>(payload.size())
+            ));
+            this->baseSnapshotId = std::nullopt;
+            return;
+        }
+
+        if (!this->baseSnapshotId.has_value()) {
+            throw Exception("Invalid snapshot file - missing base snapshot ID for delta");
+        }
+
+        // The data will be reconstructed from the base snapshot. See MemorySnapshot::resolveDelta()
+        this->data = SharedMemoryBuffer(Targets::TargetMemoryBuffer(header.dataSize, 0x00));
+        this->deltaBlocks = std::vector<DeltaBlock>();
+
+        auto position = qsizetype{0};
+        while (position < payload.size()) {
+            auto offset = std::uint32_t{0};
+            auto size = std::uint32_t{0};
+
+            if (payload.size() - position < static_cast<qsizetype>(sizeof(offset) + sizeof(size))) {
+                throw Exception("Invalid snapshot file - truncated delta block");
+            }
+
+            std::memcpy(&offset, payload.constData() + position, sizeof(offset));
+            std::memcpy(&size, payload.constData() + position + sizeof(offset), sizeof(size));
+            position += static_cast<qsizetype>(sizeof(offset) + sizeof(size));
+
+            if (
+                payload.size() - position < static_cast<qsizetype>(size)
+                || static_cast<std::size_t>(offset) + size > header.dataSize
+            ) {
+                throw Exception("Invalid snapshot file - invalid delta block");
+            }
+
+            const auto* blockBegin = reinterpret_cast<const unsigned char*>(payload.constData() + position);
+            this->deltaBlocks->emplace_back(
+                DeltaBlock{offset, Targets::TargetMemoryBuffer(blockBegin, blockBegin + size)}
+            );
+            position += static_cast<qsizetype>(size);
+        }
+    }
+
+    MemorySnapshot MemorySnapshot::fromFile(const QString& filePath) {
+        using Exceptions::Exception;
+
+        auto snapshotFile = QFile(filePath);
+
+        if (!filePath.endsWith("." + MemorySnapshot::BINARY_FILE_EXTENSION)) {
+            if (!snapshotFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+                throw Exception("Failed to open snapshot file");
+            }
+
+            return MemorySnapshot(QJsonDocument::fromJson(snapshotFile.readAll()).object());
+        }
+
+        if (!snapshotFile.open(QIODevice::ReadOnly)) {
+            throw Exception("Failed to open snapshot file");
+        }
+
+        /*
+         * We map the snapshot file into memory and construct the snapshot directly from the mapping, to avoid reading
+         * the whole file into an intermediate buffer.
+         */
+        const auto fileSize = snapshotFile.size();
+        auto* mappedFile = snapshotFile.map(0, fileSize);
+
+        if (mappedFile == nullptr) {
+            throw Exception("Failed to map snapshot file");
+        }
+
+        try {
+            auto snapshot = MemorySnapshot(
+                QByteArray::fromRawData(reinterpret_cast<const char*>(mappedFile), fileSize)
+            );
+            snapshotFile.unmap(mappedFile);
+            return snapshot;
+
+        } catch (...) {
+            snapshotFile.unmap(mappedFile);
+            throw;
+        }
+    }
+
+    QJsonObject MemorySnapshot::toJson() const {
+        auto jsonObject = this->metadataToJson();
+        jsonObject.insert("hexData", QString::fromStdString(HexCodec::encode(this->data.toBuffer())));
+
+        return jsonObject;
+    }
+
+    QByteArray MemorySnapshot::toBinary() const {
+        const auto data = this->data.toBuffer();
+
+        return MemorySnapshot::toBinary(
+            this->metadataToJson(),
+            0,
+            static_cast<std::uint32_t>(data.size()),
+            QByteArray(reinterpret_cast<const char*>(data.data()), static_cast<qsizetype>(data.size()))
+        );
+    }
+
+    QByteArray MemorySnapshot::toDeltaBinary(const MemorySnapshot& baseSnapshot) const {
+        assert(!baseSnapshot.baseSnapshotId.has_value());
+        assert(baseSnapshot.data.size() == this->data.size());
+
+        auto payload = QByteArray();
+
+        const auto appendBlock = [this, &payload] (std::uint32_t offset, std::uint32_t size) {
+            payload.append(reinterpret_cast<const char*>(&offset), sizeof(offset));
+            payload.append(reinterpret_cast<const char*>(&size), sizeof(size));
+            const auto block = this->data.read(offset, size);
+            payload.append(reinterpret_cast<const char*>(block.data()), static_cast<qsizetype>(block.size()));
+        };
+
+        auto blockStart = std::optional<std::uint32_t>();
+        auto blockEnd = std::uint32_t{0};
+
+        for (const auto& range : MemoryDiff::differingRanges(baseSnapshot.data, this->data, 0)) {
+            if (blockStart.has_value() && range.startAddress - blockEnd > MemorySnapshot::DELTA_BLOCK_MERGE_GAP) {
+                appendBlock(*blockStart, blockEnd - *blockStart + 1);
+                blockStart = std::nullopt;
+            }
+
+            if (!blockStart.has_value()) {
+                blockStart = range.startAddress;
+            }
+
+            blockEnd = range.endAddress;
+        }
+
+        if (blockStart.has_value()) {
+            appendBlock(*blockStart, blockEnd - *blockStart + 1);
+        }
+
+        auto metadata = this->metadataToJson();
+        metadata.insert("baseSnapshotId", baseSnapshot.id);
+
+        auto output = MemorySnapshot::toBinary(
+            metadata,
+            MemorySnapshot::BINARY_FLAG_DELTA,
+            static_cast<std::uint32_t>(this->data.size()),
+            std::move(payload)
+        );
+
+        if (static_cast<std::size_t>(output.size()) * MemorySnapshot::DELTA_SIZE_RATIO > this->data.size()) {
+            return {};
+        }
+
+        return output;
+    }
+
+    void MemorySnapshot::resolveDelta(const MemorySnapshot& baseSnapshot) {
+        using Exceptions::Exception;
+
+        assert(this->deltaBlocks.has_value());
+
+        if (baseSnapshot.isDeltaPending() || baseSnapshot.data.size() != this->data.size()) {
+            throw Exception("Incompatible base snapshot " + baseSnapshot.id.toStdString());
+        }
+
+        this->data = baseSnapshot.data;
+
+        // Only the pages touched by the delta blocks are copied - the rest remain shared with the base snapshot
+        for (const auto& block : *(this->deltaBlocks)) {
+            this->data.write(block.offset, block.data);
+        }
+
+        this->deltaBlocks = std::nullopt;
+    }
+
+    QByteArray MemorySnapshot::toBinary(
+        const QJsonObject& metadata,
+        std::uint32_t flags,
+        std::uint32_t dataSize,
+        QByteArray&& payload
+    ) {
+        const auto metadataJson = QJsonDocument(metadata).toJson(QJsonDocument::JsonFormat::Compact);
+
+        auto header = BinaryHeader();
+        header.flags = flags;
+        header.dataSize = dataSize;
+        header.metadataSize = static_cast<std::uint32_t>(metadataJson.size());
+
+        auto compressedPayload = qCompress(payload);
+
+        if (compressedPayload.size() < payload.size()) {
+            header.flags |= MemorySnapshot::BINARY_FLAG_COMPRESSED;
+            payload = std::move(compressedPayload);
+        }
+
+        header.payloadSize = static_cast<std::uint32_t>(payload.size());
+
+        auto output = QByteArray(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.reserve(static_cast<qsizetype>(sizeof(header)) + metadataJson.size() + payload.size());
+        output.append(metadataJson);
+        output.append(payload);
+
+        return output;
+    }
+
+    void MemorySnapshot::loadMetadata(const QJsonObject& jsonObject) {
         using Exceptions::Exception;
 
         if (
@@ -38,7 +308,6 @@ namespace Bloom
             || !jsonObject.contains("name")
             || !jsonObject.contains("description")
             || !jsonObject.contains("memoryType")
-            || !jsonObject.contains("hexData")
             || !jsonObject.contains("programCounter")
             || !jsonObject.contains("stackPointer")
             || !jsonObject.contains("createdTimestamp")
@@ -56,8 +325,9 @@ namespace Bloom
         this->stackPointer = static_cast<Targets::TargetStackPointer>(jsonObject.find("stackPointer")->toInteger());
         this->createdDate.setSecsSinceEpoch(jsonObject.find("createdTimestamp")->toInteger());
 
-        const auto hexData = QByteArray::fromHex(jsonObject.find("hexData")->toString().toUtf8());
-        this->data = Targets::TargetMemoryBuffer(hexData.begin(), hexData.end());
+        if (jsonObject.contains("baseSnapshotId")) {
+            this->baseSnapshotId = jsonObject.find("baseSnapshotId")->toString();
+        }
 
         if (jsonObject.contains("focusedRegions")) {
             for (const auto& regionValue : jsonObject.find("focusedRegions")->toArray()) {
@@ -82,7 +352,7 @@ namespace Bloom
         }
     }
 
-    QJsonObject MemorySnapshot::toJson() const {
+    QJsonObject MemorySnapshot::metadataToJson() const {
         auto focusedRegions = QJsonArray();
         for (const auto& focusedRegion : this->focusedRegions) {
             focusedRegions.push_back(focusedRegion.toJson());
@@ -98,10 +368,6 @@ namespace Bloom
             {"name", this->name},
             {"description", this->description},
             {"memoryType", EnumToStringMappings::targetMemoryTypes.at(this->memoryType)},
-            {"hexData", QString(QByteArray(
-                reinterpret_cast<const char*>(this->data.data()),
-                static_cast<qsizetype>(this->data.size())
-            ).toHex())},
             {"programCounter", static_cast<qint64>(this->programCounter)},
             {"stackPointer", static_cast<qint64>(this->stackPointer)},
             {"createdTimestamp", this->createdDate.toSecsSinceEpoch()},
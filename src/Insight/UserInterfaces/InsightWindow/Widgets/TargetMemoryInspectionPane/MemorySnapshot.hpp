@@ -4,24 +4,60 @@
 #include <QString>
 #include <utility>
 #include <vector>
+#include <optional>
 #include <QJsonObject>
+#include <QByteArray>
 
 #include "src/Targets/TargetMemory.hpp"
 #include "src/Services/DateTimeService.hpp"
 
 #include "FocusedMemoryRegion.hpp"
 #include "ExcludedMemoryRegion.hpp"
+#include "SharedMemoryBuffer.hpp"
 
 namespace Bloom
 {
     struct MemorySnapshot
     {
     public:
+        /**
+         * Snapshots are stored in a compact binary format (in files with the MemorySnapshot::BINARY_FILE_EXTENSION
+         * extension), consisting of a BinaryHeader, followed by the snapshot metadata (in JSON, excluding the memory
+         * data), followed by the payload. The payload holds the memory data, either raw or compressed (via
+         * qCompress()), depending on BinaryHeader::flags.
+         *
+         * Delta snapshots (BINARY_FLAG_DELTA) reference a base snapshot (MemorySnapshot::baseSnapshotId) and only
+         * store the blocks of memory that differ from the base. Their payload is a sequence of blocks, each consisting
+         * of a 32-bit offset (relative to the start of the memory), a 32-bit size, and the block data.
+         *
+         * Older snapshots, stored entirely in JSON (with the memory data hex-encoded), are still supported.
+         */
+        static constexpr std::uint32_t BINARY_MAGIC = 0x504E5342; // "BSNP", in little-endian byte order
+        static constexpr std::uint32_t BINARY_VERSION = 1;
+        static constexpr std::uint32_t BINARY_FLAG_COMPRESSED = 0x01;
+        static constexpr std::uint32_t BINARY_FLAG_DELTA = 0x02;
+        static inline const QString BINARY_FILE_EXTENSION = "snapshot";
+
+        struct BinaryHeader
+        {
+            std::uint32_t magic = MemorySnapshot::BINARY_MAGIC;
+            std::uint32_t version = MemorySnapshot::BINARY_VERSION;
+            std::uint32_t flags = 0;
+            std::uint32_t metadataSize = 0;
+            std::uint32_t payloadSize = 0;
+            std::uint32_t dataSize = 0;
+        };
+
         QString id;
         QString name;
         QString description;
         Targets::TargetMemoryType memoryType;
-        Targets::TargetMemoryBuffer data;
+
+        /**
+         * Snapshots share their data with the memory they were captured from, and with any viewers of the snapshot.
+         * Delta snapshots share the unchanged pages of their base snapshot. See SharedMemoryBuffer.
+         */
+        SharedMemoryBuffer data;
         Targets::TargetProgramCounter programCounter;
         Targets::TargetStackPointer stackPointer;
         QDateTime createdDate = Services::DateTimeService::currentDateTime();
@@ -29,11 +65,18 @@ namespace Bloom
         std::vector<FocusedMemoryRegion> focusedRegions;
         std::vector<ExcludedMemoryRegion> excludedRegions;
 
+        /**
+         * The ID of the snapshot that this snapshot is stored as a delta of, if any.
+         *
+         * Base snapshots are always stored in full, so delta chains never exceed a single level.
+         */
+        std::optional<QString> baseSnapshotId;
+
         MemorySnapshot(
             const QString& name,
             const QString& description,
             Targets::TargetMemoryType memoryType,
-            const Targets::TargetMemoryBuffer& data,
+            const SharedMemoryBuffer& data,
             Targets::TargetProgramCounter programCounter,
             Targets::TargetStackPointer stackPointer,
             const std::vector<FocusedMemoryRegion>& focusedRegions,
@@ -42,8 +85,66 @@ namespace Bloom
 
         MemorySnapshot(const QJsonObject& jsonObject);
 
+        /**
+         * Constructs a snapshot from its binary form.
+         *
+         * The binary form is usually memory-mapped straight from the snapshot file, so the buffer should not be
+         * copied. See QByteArray::fromRawData().
+         *
+         * If the binary form is that of a delta snapshot, the snapshot's data will not be available until the delta
+         * has been resolved against the base snapshot. See MemorySnapshot::resolveDelta().
+         *
+         * @param binary
+         */
+        explicit MemorySnapshot(const QByteArray& binary);
+
+        /**
+         * Loads a snapshot from the given file (either binary or JSON, depending on the file extension). Binary
+         * snapshot files are memory-mapped.
+         *
+         * @param filePath
+         *
+         * @return
+         */
+        static MemorySnapshot fromFile(const QString& filePath);
+
         QJsonObject toJson() const;
 
+        /**
+         * Produces the binary form of the snapshot. The payload will only be compressed if doing so reduces its size.
+         *
+         * @return
+         */
+        QByteArray toBinary() const;
+
+        /**
+         * Produces the binary form of the snapshot, as a delta of the given base snapshot.
+         *
+         * @param baseSnapshot
+         *  Must be a full (non-delta) snapshot, of the same size.
+         *
+         * @return
+         *  The binary form of the delta snapshot, or an empty byte array if the delta would be too large to be
+         *  worthwhile (see MemorySnapshot::DELTA_SIZE_RATIO).
+         */
+        QByteArray toDeltaBinary(const MemorySnapshot& baseSnapshot) const;
+
+        /**
+         * Checks if this snapshot was loaded from a delta, which has not yet been resolved against its base.
+         *
+         * @return
+         */
+        bool isDeltaPending() const {
+            return this->deltaBlocks.has_value();
+        }
+
+        /**
+         * Reconstructs the snapshot's data from the base snapshot and the stored delta.
+         *
+         * @param baseSnapshot
+         */
+        void resolveDelta(const MemorySnapshot& baseSnapshot);
+
         bool isCompatible(const Targets::TargetMemoryDescriptor& memoryDescriptor) const;
 
         virtual ~MemorySnapshot() = default;
@@ -53,5 +154,37 @@ namespace Bloom
 
         MemorySnapshot& operator = (const MemorySnapshot& other) = default;
         MemorySnapshot& operator = (MemorySnapshot&& other) = default;
+
+    private:
+        struct DeltaBlock
+        {
+            std::uint32_t offset = 0;
+            Targets::TargetMemoryBuffer data;
+        };
+
+        /**
+         * The blocks of a delta snapshot that is yet to be resolved (see MemorySnapshot::resolveDelta()).
+         */
+        std::optional<std::vector<DeltaBlock>> deltaBlocks;
+
+        /**
+         * Deltas are only stored if the encoded blocks are no larger than this fraction (1/n) of the full data.
+         */
+        static constexpr std::size_t DELTA_SIZE_RATIO = 2;
+
+        /**
+         * Differing ranges separated by fewer than this number of identical bytes are stored in a single delta block,
+         * as the identical bytes take up no more space than a new block header.
+         */
+        static constexpr std::uint32_t DELTA_BLOCK_MERGE_GAP = 8;
+
+        QJsonObject metadataToJson() const;
+        void loadMetadata(const QJsonObject& jsonObject);
+        static QByteArray toBinary(
+            const QJsonObject& metadata,
+            std::uint32_t flags,
+            std::uint32_t dataSize,
+            QByteArray&& payload
+        );
     };
 }
@@ -0,0 +1,134 @@
+#include "SharedMemoryBuffer.hpp"
+
+#include <algorithm>
+
+namespace Bloom
+{
+    SharedMemoryBuffer::SharedMemoryBuffer(std::span<const unsigned char> data)
+        : bufferSize(data.size())
+    {
+        this->pages.reserve((data.size() + SharedMemoryBuffer::PAGE_SIZE - 1) / SharedMemoryBuffer::PAGE_SIZE);
+
+        for (auto offset = std::size_t(0); offset < data.size(); offset += SharedMemoryBuffer::PAGE_SIZE) {
+            this->pages.emplace_back(SharedMemoryBuffer::copyPage(
+                data.subspan(offset, std::min(SharedMemoryBuffer::PAGE_SIZE, data.size() - offset))
+            ));
+        }
+    }
+
+    SharedMemoryBuffer::SharedMemoryBuffer(const Targets::SharedTargetMemoryBuffer& data)
+        : bufferSize(data.size())
+    {
+        this->pages.reserve((data.size() + SharedMemoryBuffer::PAGE_SIZE - 1) / SharedMemoryBuffer::PAGE_SIZE);
+
+        for (auto offset = std::size_t(0); offset < data.size(); offset += SharedMemoryBuffer::PAGE_SIZE) {
+            const auto pageSize = std::min(SharedMemoryBuffer::PAGE_SIZE, data.size() - offset);
+
+            /*
+             * A partial (last) page must be copied, as page reads are not bounded by the end of the buffer, and its
+             * unused portion must be zero-filled.
+             */
+            this->pages.emplace_back(
+                pageSize == SharedMemoryBuffer::PAGE_SIZE
+                    ? data.share(offset)
+                    : SharedMemoryBuffer::copyPage(data.subspan(offset, pageSize))
+            );
+        }
+    }
+
+    Targets::TargetMemoryBuffer SharedMemoryBuffer::read(std::size_t offset, std::size_t size) const {
+        assert(offset + size <= this->bufferSize);
+
+        auto output = Targets::TargetMemoryBuffer();
+        output.reserve(size);
+
+        const auto endOffset = offset + size;
+        while (offset < endOffset) {
+            const auto* page = this->pages[offset / SharedMemoryBuffer::PAGE_SIZE].get();
+            const auto pageOffset = offset % SharedMemoryBuffer::PAGE_SIZE;
+            const auto chunkSize = std::min(SharedMemoryBuffer::PAGE_SIZE - pageOffset, endOffset - offset);
+
+            output.insert(output.end(), page + pageOffset, page + pageOffset + chunkSize);
+
+            offset += chunkSize;
+        }
+
+        return output;
+    }
+
+    bool SharedMemoryBuffer::write(std::size_t offset, std::span<const unsigned char> data) {
+        return this->write(offset, data, nullptr);
+    }
+
+    bool SharedMemoryBuffer::write(std::size_t offset, const Targets::SharedTargetMemoryBuffer& data) {
+        return this->write(offset, data.span(), &data);
+    }
+
+    std::span<const unsigned char> SharedMemoryBuffer::page(std::size_t pageIndex) const {
+        assert(pageIndex < this->pages.size());
+
+        const auto pageOffset = pageIndex * SharedMemoryBuffer::PAGE_SIZE;
+        return std::span<const unsigned char>(
+            this->pages[pageIndex].get(),
+            std::min(SharedMemoryBuffer::PAGE_SIZE, this->bufferSize - pageOffset)
+        );
+    }
+
+    SharedMemoryBuffer::PagePointer SharedMemoryBuffer::copyPage(std::span<const unsigned char> data) {
+        assert(data.size() <= SharedMemoryBuffer::PAGE_SIZE);
+
+        // std::make_shared<T[]>() value-initialises the array, so the unused portion of the page is zero-filled
+        auto page = std::make_shared<unsigned char[]>(SharedMemoryBuffer::PAGE_SIZE);
+        std::copy(data.begin(), data.end(), page.get());
+
+        const auto* pageData = page.get();
+        return PagePointer(std::move(page), pageData);
+    }
+
+    bool SharedMemoryBuffer::write(
+        std::size_t offset,
+        std::span<const unsigned char> data,
+        const Targets::SharedTargetMemoryBuffer* owner
+    ) {
+        assert(offset + data.size() <= this->bufferSize);
+
+        auto changed = false;
+
+        auto dataOffset = std::size_t(0);
+        while (dataOffset < data.size()) {
+            const auto bufferOffset = offset + dataOffset;
+            const auto pageIndex = bufferOffset / SharedMemoryBuffer::PAGE_SIZE;
+            const auto pageOffset = bufferOffset % SharedMemoryBuffer::PAGE_SIZE;
+            const auto chunk = data.subspan(
+                dataOffset,
+                std::min(SharedMemoryBuffer::PAGE_SIZE - pageOffset, data.size() - dataOffset)
+            );
+
+            const auto* page = this->pages[pageIndex].get();
+
+            if (!std::equal(chunk.begin(), chunk.end(), page + pageOffset)) {
+                if (owner != nullptr && chunk.size() == SharedMemoryBuffer::PAGE_SIZE) {
+                    this->pages[pageIndex] = owner->share(dataOffset);
+
+                } else {
+                    /*
+                     * The page may be shared with other buffers (possibly on other threads), so we never modify it in
+                     * place. We replace it with a modified copy.
+                     */
+                    auto newPage = std::make_shared<unsigned char[]>(SharedMemoryBuffer::PAGE_SIZE);
+                    std::copy(page, page + SharedMemoryBuffer::PAGE_SIZE, newPage.get());
+                    std::copy(chunk.begin(), chunk.end(), newPage.get() + pageOffset);
+
+                    const auto* newPageData = newPage.get();
+                    this->pages[pageIndex] = PagePointer(std::move(newPage), newPageData);
+                }
+
+                changed = true;
+            }
+
+            dataOffset += chunk.size();
+        }
+
+        return changed;
+    }
+}
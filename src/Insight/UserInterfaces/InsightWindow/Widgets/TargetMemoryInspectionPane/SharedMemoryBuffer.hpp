@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include <span>
+#include <cassert>
+
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/SharedTargetMemoryBuffer.hpp"
+
+namespace Bloom
+{
+    /**
+     * A reference-counted, copy-on-write memory buffer.
+     *
+     * The buffer is split into pages of SharedMemoryBuffer::PAGE_SIZE bytes. Pages are never modified once they've
+     * been created, so they can be shared between any number of copies of a buffer - copying a buffer only copies
+     * its page table. Writing to a buffer replaces the pages that the write changes. Pages whose content is
+     * unchanged by the write remain shared.
+     *
+     * This allows the memory inspection pane, its snapshots, the snapshot viewers and the snapshot diffs to each
+     * hold their own copy of the same memory, without duplicating its storage. Refreshing the pane's memory only
+     * allocates the pages that have changed since the last refresh.
+     *
+     * Because pages are immutable, a copy of a buffer can be read on an InsightWorker thread while the GUI thread
+     * writes to the original.
+     *
+     * Pages can also refer directly to the storage of a Targets::SharedTargetMemoryBuffer, so memory that was read
+     * from the target can be adopted without being copied. The adopted buffer is kept alive for as long as any of
+     * its pages remain in use.
+     */
+    class SharedMemoryBuffer
+    {
+    public:
+        static constexpr std::size_t PAGE_SIZE = 1024;
+
+        SharedMemoryBuffer() = default;
+        explicit SharedMemoryBuffer(std::span<const unsigned char> data);
+
+        /**
+         * Adopts the data, without copying it (aside from the last page, if it's partial).
+         *
+         * @param data
+         */
+        explicit SharedMemoryBuffer(const Targets::SharedTargetMemoryBuffer& data);
+
+        [[nodiscard]] std::size_t size() const {
+            return this->bufferSize;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return this->bufferSize == 0;
+        }
+
+        unsigned char operator [] (std::size_t index) const {
+            assert(index < this->bufferSize);
+            return this->pages[index / SharedMemoryBuffer::PAGE_SIZE].get()[index % SharedMemoryBuffer::PAGE_SIZE];
+        }
+
+        /**
+         * Copies a range of the buffer to a contiguous buffer.
+         *
+         * @param offset
+         * @param size
+         *
+         * @return
+         */
+        [[nodiscard]] Targets::TargetMemoryBuffer read(std::size_t offset, std::size_t size) const;
+
+        [[nodiscard]] Targets::TargetMemoryBuffer toBuffer() const {
+            return this->read(0, this->bufferSize);
+        }
+
+        /**
+         * Writes to the buffer, replacing any pages that are changed by the write.
+         *
+         * @param offset
+         *  The write must not exceed the end of the buffer.
+         *
+         * @param data
+         *
+         * @return
+         *  True if the write changed the content of the buffer.
+         */
+        bool write(std::size_t offset, std::span<const unsigned char> data);
+
+        /**
+         * Writes to the buffer, as above, but changed pages that are fully covered by the write refer to the given
+         * data instead of copying it.
+         *
+         * @param offset
+         * @param data
+         *
+         * @return
+         */
+        bool write(std::size_t offset, const Targets::SharedTargetMemoryBuffer& data);
+
+        [[nodiscard]] std::size_t pageCount() const {
+            return this->pages.size();
+        }
+
+        /**
+         * Returns a view of the content of a page. The last page may be shorter than SharedMemoryBuffer::PAGE_SIZE.
+         *
+         * @param pageIndex
+         * @return
+         */
+        [[nodiscard]] std::span<const unsigned char> page(std::size_t pageIndex) const;
+
+        /**
+         * Checks if this buffer and another hold the same page at the given index, in which case the content of the
+         * page is identical in both buffers.
+         *
+         * @param pageIndex
+         * @param other
+         *
+         * @return
+         */
+        [[nodiscard]] bool sharesPage(std::size_t pageIndex, const SharedMemoryBuffer& other) const {
+            return pageIndex < this->pages.size()
+                && pageIndex < other.pages.size()
+                && this->pages[pageIndex] == other.pages[pageIndex];
+        }
+
+    private:
+        /**
+         * Points to the first of the page's SharedMemoryBuffer::PAGE_SIZE bytes.
+         */
+        using PagePointer = std::shared_ptr<const unsigned char>;
+
+        std::vector<PagePointer> pages;
+        std::size_t bufferSize = 0;
+
+        /**
+         * Allocates a zero-filled page, with the given data at its start.
+         *
+         * @param data
+         *
+         * @return
+         */
+        static PagePointer copyPage(std::span<const unsigned char> data);
+
+        /**
+         * @param offset
+         * @param data
+         *
+         * @param owner
+         *  The buffer holding the data, if the changed pages can refer to it. Otherwise, nullptr.
+         *
+         * @return
+         */
+        bool write(
+            std::size_t offset,
+            std::span<const unsigned char> data,
+            const Targets::SharedTargetMemoryBuffer* owner
+        );
+    };
+}
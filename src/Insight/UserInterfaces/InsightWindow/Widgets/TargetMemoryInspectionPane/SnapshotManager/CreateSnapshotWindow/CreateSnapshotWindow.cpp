@@ -18,7 +18,7 @@ namespace Bloom::Widgets
 
     CreateSnapshotWindow::CreateSnapshotWindow(
         Targets::TargetMemoryType memoryType,
-        const std::optional<Targets::TargetMemoryBuffer>& data,
+        const std::optional<SharedMemoryBuffer>& data,
         const bool& staleData,
         QWidget* parent
     )
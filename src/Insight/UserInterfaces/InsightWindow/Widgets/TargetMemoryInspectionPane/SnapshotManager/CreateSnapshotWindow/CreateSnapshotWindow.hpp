@@ -11,6 +11,7 @@
 
 #include "src/Targets/TargetMemory.hpp"
 #include "src/Targets/TargetState.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/SharedMemoryBuffer.hpp"
 
 namespace Bloom::Widgets
 {
@@ -21,7 +22,7 @@ namespace Bloom::Widgets
     public:
         explicit CreateSnapshotWindow(
             Targets::TargetMemoryType memoryType,
-            const std::optional<Targets::TargetMemoryBuffer>& data,
+            const std::optional<SharedMemoryBuffer>& data,
             const bool& staleData,
             QWidget* parent = nullptr
         );
@@ -52,7 +53,7 @@ namespace Bloom::Widgets
         PushButton* captureButton = nullptr;
         PushButton* closeButton = nullptr;
 
-        const std::optional<Targets::TargetMemoryBuffer>& data;
+        const std::optional<SharedMemoryBuffer>& data;
         const bool& staleData;
         Targets::TargetState targetState = Targets::TargetState::UNKNOWN;
 
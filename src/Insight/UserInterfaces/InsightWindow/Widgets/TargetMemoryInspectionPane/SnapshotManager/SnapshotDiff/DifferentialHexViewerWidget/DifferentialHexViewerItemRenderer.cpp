@@ -60,7 +60,6 @@ namespace Bloom::Widgets
         const ByteItem* previousLineLastByteItem = nullptr;
         auto changedByteOnCurrentLine = false;
 
-        const auto& byteItemYPosByAddress = this->itemIndex.byteItemYStartPositionsByAddress;
         painter->setOpacity(1);
 
         for (auto& item : visibleItems) {
@@ -69,7 +68,8 @@ namespace Bloom::Widgets
             if (byteItem != nullptr) {
                 if (
                     previousLineLastByteItem == nullptr
-                    || previousLineLastByteItem->position().y() != byteItemYPosByAddress.at(byteItem->startAddress)
+                    || previousLineLastByteItem->position().y()
+                        != this->itemIndex.byteItemYStartPosition(byteItem->startAddress)
                 ) {
                     if (changedByteOnCurrentLine) {
                         this->paintChangedLinePolygon(
@@ -107,6 +107,8 @@ namespace Bloom::Widgets
             painter->setOpacity(1);
             this->paintItem(item, painter);
         }
+
+        this->paintByteItems(painter);
     }
 
     void DifferentialHexViewerItemRenderer::paintChangedLinePolygon(
@@ -122,7 +124,7 @@ namespace Bloom::Widgets
         painter->setBrush(backgroundColor);
         painter->setPen(Qt::NoPen);
 
-        const auto firstByteItemYPos = this->itemIndex.byteItemYStartPositionsByAddress.at(firstByteItem->startAddress);
+        const auto firstByteItemYPos = this->itemIndex.byteItemYStartPosition(firstByteItem->startAddress);
 
         if (this->differentialHexViewerWidgetType == DifferentialHexViewerWidgetType::SECONDARY) {
             painter->drawRect(
@@ -138,14 +140,12 @@ namespace Bloom::Widgets
         static constexpr auto rightSpacing = 20;
         const auto vScrollDifference = otherVScrollBarValue - vScrollBarValue;
 
-        const auto& otherByteItemYPosByAddress = this->other->itemIndex.byteItemYStartPositionsByAddress;
+        const auto& otherItemIndex = this->other->itemIndex;
 
-        const auto otherFirstByteItemYPos = otherByteItemYPosByAddress.at(
-            firstByteItem->startAddress
-        ) - vScrollDifference;
-        const auto otherLastByteItemYPos = otherByteItemYPosByAddress.at(
-            lastByteItem->startAddress
-        ) - vScrollDifference;
+        const auto otherFirstByteItemYPos = otherItemIndex.byteItemYStartPosition(firstByteItem->startAddress)
+            - vScrollDifference;
+        const auto otherLastByteItemYPos = otherItemIndex.byteItemYStartPosition(lastByteItem->startAddress)
+            - vScrollDifference;
 
         const auto otherYStart = std::max(
             vScrollBarValue,
@@ -1,12 +1,18 @@
 #pragma once
 
-#include <unordered_set>
+#include <vector>
+
+#include "src/Targets/TargetMemory.hpp"
 
 namespace Bloom::Widgets
 {
     struct DifferentialHexViewerSharedState
     {
-        std::unordered_set<Targets::TargetMemoryAddress> differences;
+        /**
+         * The differing address ranges between the two snapshots, in ascending order, as computed by the
+         * ComputeMemoryDifferences task.
+         */
+        std::vector<Targets::TargetMemoryAddressRange> differences;
 
         bool syncingSettings = false;
         bool syncingScroll = false;
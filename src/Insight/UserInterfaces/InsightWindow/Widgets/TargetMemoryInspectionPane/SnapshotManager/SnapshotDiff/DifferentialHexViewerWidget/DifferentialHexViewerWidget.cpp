@@ -10,7 +10,7 @@ namespace Bloom::Widgets
         DifferentialHexViewerSharedState& state,
         const SnapshotDiffSettings& snapshotDiffSettings,
         const Targets::TargetMemoryDescriptor& targetMemoryDescriptor,
-        const std::optional<Targets::TargetMemoryBuffer>& data,
+        const std::optional<SharedMemoryBuffer>& data,
         HexViewerWidgetSettings& settings,
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
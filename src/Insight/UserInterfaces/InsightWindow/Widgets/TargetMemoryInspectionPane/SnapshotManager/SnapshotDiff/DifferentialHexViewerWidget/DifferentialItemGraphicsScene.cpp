@@ -11,7 +11,7 @@ namespace Bloom::Widgets
         DifferentialHexViewerSharedState& state,
         const SnapshotDiffSettings& snapshotDiffSettings,
         const Targets::TargetMemoryDescriptor& targetMemoryDescriptor,
-        const std::optional<Targets::TargetMemoryBuffer>& data,
+        const std::optional<SharedMemoryBuffer>& data,
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
         HexViewerWidgetSettings& settings,
@@ -59,13 +59,30 @@ namespace Bloom::Widgets
     }
 
     void DifferentialItemGraphicsScene::updateByteItemChangedStates() {
-        for (auto& [address, byteItem] : this->topLevelGroup->byteItemsByAddress) {
-            byteItem.changed = !byteItem.excluded && this->diffHexViewerState.differences.contains(address);
+        const auto& differences = this->diffHexViewerState.differences;
+        auto differenceIt = differences.begin();
+
+        /*
+         * Both the byte items and the differing ranges are in ascending address order, so we can walk through them
+         * together, instead of looking up each byte.
+         */
+        for (auto& byteItem : this->topLevelGroup->byteItemsByAddress) {
+            while (differenceIt != differences.end() && differenceIt->endAddress < byteItem.startAddress) {
+                ++differenceIt;
+            }
+
+            byteItem.changed = !byteItem.excluded
+                && differenceIt != differences.end()
+                && differenceIt->contains(byteItem.startAddress);
         }
 
         this->update();
     }
 
+    void DifferentialItemGraphicsScene::onItemHierarchyReplaced() {
+        this->updateByteItemChangedStates();
+    }
+
     void DifferentialItemGraphicsScene::initRenderer() {
         this->differentialHexViewerItemRenderer = new DifferentialHexViewerItemRenderer(
             this->differentialHexViewerWidgetType,
@@ -104,7 +121,7 @@ namespace Bloom::Widgets
             return;
         }
 
-        auto& byteItem = this->topLevelGroup->byteItemsByAddress.find(*address)->second;
+        auto& byteItem = this->topLevelGroup->byteItemsByAddress.at(*address);
         const auto itemPosition = byteItem.position().y();
         const auto scrollbarValue = this->getScrollbarValue();
 
@@ -121,25 +138,14 @@ namespace Bloom::Widgets
         this->diffHexViewerState.syncingHover = false;
     }
 
-    void DifferentialItemGraphicsScene::onOtherSelectionChanged(
-        const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress
-    ) {
+    void DifferentialItemGraphicsScene::onOtherSelectionChanged(const ByteSelection& selection) {
         if (!this->snapshotDiffSettings.syncHexViewerSelection || this->diffHexViewerState.syncingSelection) {
             return;
         }
 
+        // Both hex viewers present the same memory, so the other viewer's selection applies as is
         this->diffHexViewerState.syncingSelection = true;
-        this->clearByteItemSelection();
-
-        for (const auto& [address, otherByteItem] : selectedByteItemsByAddress) {
-            auto& byteItem = this->topLevelGroup->byteItemsByAddress.at(address);
-            byteItem.selected = true;
-            this->selectedByteItemsByAddress.insert(std::pair(byteItem.startAddress, &byteItem));
-        }
-
-        emit this->selectionChanged(this->selectedByteItemsByAddress);
+        this->selectByteItems(selection);
         this->diffHexViewerState.syncingSelection = false;
-
-        this->update();
     }
 }
@@ -20,7 +20,7 @@ namespace Bloom::Widgets
             DifferentialHexViewerSharedState& state,
             const SnapshotDiffSettings& snapshotDiffSettings,
             const Targets::TargetMemoryDescriptor& targetMemoryDescriptor,
-            const std::optional<Targets::TargetMemoryBuffer>& data,
+            const std::optional<SharedMemoryBuffer>& data,
             const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
             const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
             HexViewerWidgetSettings& settings,
@@ -40,12 +40,11 @@ namespace Bloom::Widgets
         DifferentialHexViewerItemRenderer* differentialHexViewerItemRenderer = nullptr;
         DifferentialItemGraphicsScene* other = nullptr;
 
+        void onItemHierarchyReplaced() override;
         void initRenderer() override;
         QMargins margins() override;
 
         void onOtherHoveredAddress(const std::optional<Targets::TargetMemoryAddress>& address);
-        void onOtherSelectionChanged(
-            const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress
-        );
+        void onOtherSelectionChanged(const ByteSelection& selection);
     };
 }
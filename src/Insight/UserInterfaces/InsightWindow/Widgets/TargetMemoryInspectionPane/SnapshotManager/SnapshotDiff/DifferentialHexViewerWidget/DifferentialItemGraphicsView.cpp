@@ -7,7 +7,7 @@ namespace Bloom::Widgets
         DifferentialHexViewerSharedState& state,
         const SnapshotDiffSettings& snapshotDiffSettings,
         const Targets::TargetMemoryDescriptor& targetMemoryDescriptor,
-        const std::optional<Targets::TargetMemoryBuffer>& data,
+        const std::optional<SharedMemoryBuffer>& data,
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
         HexViewerWidgetSettings& settings,
@@ -47,7 +47,6 @@ namespace Bloom::Widgets
             &ItemGraphicsScene::ready,
             this,
             [this] {
-            this->differentialScene->updateByteItemChangedStates();
                 this->scene->setEnabled(this->isEnabled());
                 emit this->sceneReady();
             }
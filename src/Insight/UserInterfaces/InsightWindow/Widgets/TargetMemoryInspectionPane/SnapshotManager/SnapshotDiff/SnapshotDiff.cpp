@@ -6,6 +6,7 @@
 #include <algorithm>
 
 #include "src/Insight/InsightWorker/Tasks/WriteTargetMemory.hpp"
+#include "src/Insight/InsightWorker/Tasks/ComputeMemoryDifferences.hpp"
 #include "src/Insight/InsightWorker/InsightWorker.hpp"
 
 #include "src/Insight/UserInterfaces/InsightWindow/UiLoader.hpp"
@@ -54,7 +55,7 @@ namespace Bloom::Widgets
 
     SnapshotDiff::SnapshotDiff(
         MemorySnapshot& snapshotA,
-        Targets::TargetMemoryBuffer dataB,
+        const SharedMemoryBuffer& dataB,
         std::vector<FocusedMemoryRegion> focusedRegionsB,
         std::vector<ExcludedMemoryRegion> excludedRegionsB,
         Targets::TargetStackPointer stackPointerB,
@@ -85,7 +86,7 @@ namespace Bloom::Widgets
 
         this->restoreBytesAction = new ContextMenuAction(
             "Restore Selection",
-            [this] (const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>&) {
+            [this] (const ByteSelection&) {
                 return this->memoryDescriptor.access.writeableDuringDebugSession;
             },
             this
@@ -95,14 +96,14 @@ namespace Bloom::Widgets
             this->restoreBytesAction,
             &ContextMenuAction::invoked,
             this,
-            [this] (const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress) {
-                this->restoreSelectedBytes(selectedByteItemsByAddress, true);
+            [this] (const ByteSelection& selection) {
+                this->restoreSelectedBytes(selection, true);
             }
         );
     }
 
     void SnapshotDiff::refreshB(
-        Targets::TargetMemoryBuffer data,
+        const SharedMemoryBuffer& data,
         std::vector<FocusedMemoryRegion> focusedRegions,
         std::vector<ExcludedMemoryRegion> excludedRegions,
         Targets::TargetStackPointer stackPointer
@@ -116,11 +117,8 @@ namespace Bloom::Widgets
             this->hexViewerWidgetB->setStackPointer(this->stackPointerB);
         }
 
-        this->refreshDifferences();
         this->hexViewerWidgetB->refreshRegions();
-        this->hexViewerWidgetB->updateValues();
-
-        this->hexViewerWidgetA->updateValues();
+        this->refreshDifferences();
     }
 
     void SnapshotDiff::showEvent(QShowEvent* event) {
@@ -311,43 +309,59 @@ namespace Bloom::Widgets
         assert(this->hexViewerDataA.has_value());
         assert(this->hexViewerDataB.has_value());
 
-        this->differentialHexViewerSharedState.differences.clear();
+        auto excludedRegions = this->excludedRegionsA;
+        excludedRegions.insert(excludedRegions.end(), this->excludedRegionsB.begin(), this->excludedRegionsB.end());
 
-        const auto& dataA = *(this->hexViewerDataA);
-        const auto& dataB = *(this->hexViewerDataB);
+        const auto computeDifferencesTask = QSharedPointer<ComputeMemoryDifferences>(
+            new ComputeMemoryDifferences(
+                *(this->hexViewerDataA),
+                *(this->hexViewerDataB),
+                this->memoryDescriptor.addressRange.startAddress,
+                excludedRegions
+            ),
+            &QObject::deleteLater
+        );
 
-        static const auto isAddressExcluded = [this] (Targets::TargetMemoryAddress address) {
-            for (const auto& excludedRegion : this->excludedRegionsA) {
-                if (excludedRegion.addressRange.contains(address)) {
-                    return true;
-                }
-            }
+        const auto taskId = computeDifferencesTask->id;
+        this->differencesTaskId = taskId;
 
-            for (const auto& excludedRegion : this->excludedRegionsB) {
-                if (excludedRegion.addressRange.contains(address)) {
-                    return true;
-                }
+        QObject::connect(
+            computeDifferencesTask.get(),
+            &ComputeMemoryDifferences::memoryDifferencesComputed,
+            this,
+            [this, taskId] (
+                std::vector<Targets::TargetMemoryAddressRange> differences,
+                std::size_t differenceCount
+            ) {
+                this->onDifferencesComputed(taskId, std::move(differences), differenceCount);
             }
+        );
 
-            return false;
-        };
-
-        const auto& memoryStartAddress = this->memoryDescriptor.addressRange.startAddress;
-
-        for (Targets::TargetMemoryBuffer::size_type i = 0; i < dataA.size(); ++i) {
-            const auto address = memoryStartAddress + static_cast<Targets::TargetMemoryAddress>(i);
+        InsightWorker::queueTask(computeDifferencesTask);
+    }
 
-            if (dataA[i] != dataB[i] && !isAddressExcluded(address)) {
-                this->differentialHexViewerSharedState.differences.insert(address);
-            }
+    void SnapshotDiff::onDifferencesComputed(
+        InsightWorkerTask::IdType taskId,
+        std::vector<Targets::TargetMemoryAddressRange> differences,
+        std::size_t differenceCount
+    ) {
+        if (this->differencesTaskId != taskId) {
+            // A more recent comparison is pending - these results are stale
+            return;
         }
 
-        const auto count = this->differentialHexViewerSharedState.differences.size();
+        this->differencesTaskId = std::nullopt;
+        this->differentialHexViewerSharedState.differences = std::move(differences);
+
         this->diffCountLabel->setText(
-            count == 0
+            differenceCount == 0
                 ? "Contents are identical"
-                : QLocale(QLocale::English).toString(count) + (count == 1 ? " difference" : " differences")
+                : QLocale(QLocale::English).toString(static_cast<qulonglong>(differenceCount))
+                    + (differenceCount == 1 ? " difference" : " differences")
         );
+
+        this->hexViewerWidgetA->updateValues();
+        this->hexViewerWidgetB->updateValues();
     }
 
     void SnapshotDiff::setSyncHexViewerSettingsEnabled(bool enabled) {
@@ -371,20 +385,16 @@ namespace Bloom::Widgets
     }
 
     void SnapshotDiff::restoreSelectedBytes(
-        const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress,
+        const ByteSelection& selection,
         bool confirmationPromptEnabled
     ) {
-        auto sortedByteItemsByAddress = std::map<Targets::TargetMemoryAddress, ByteItem*>();
+        auto restorableSelection = selection;
 
-        for (const auto& pair : selectedByteItemsByAddress) {
-            if (pair.second->excluded) {
-                continue;
-            }
-
-            sortedByteItemsByAddress.insert(pair);
+        for (const auto& excludedRegion : this->excludedRegionsA) {
+            restorableSelection.remove(excludedRegion.addressRange);
         }
 
-        if (sortedByteItemsByAddress.empty()) {
+        if (restorableSelection.empty()) {
             // The user has only selected bytes that are within an excluded region - nothing to do here
             return;
         }
@@ -392,7 +402,7 @@ namespace Bloom::Widgets
         if (confirmationPromptEnabled) {
             auto* confirmationDialog = new ConfirmationDialog(
                 "Restore selected bytes",
-                "This operation will write " + QString::number(sortedByteItemsByAddress.size())
+                "This operation will write " + QString::number(restorableSelection.byteCount())
                     + " byte(s) to the target's "
                     + EnumToStringMappings::targetMemoryTypes.at(this->memoryDescriptor.type).toUpper()
                     + ".<br/><br/>Are you sure you want to proceed?",
@@ -405,8 +415,8 @@ namespace Bloom::Widgets
                 confirmationDialog,
                 &ConfirmationDialog::confirmed,
                 this,
-                [this, selectedByteItemsByAddress] {
-                    this->restoreSelectedBytes(selectedByteItemsByAddress, false);
+                [this, restorableSelection] {
+                    this->restoreSelectedBytes(restorableSelection, false);
                 }
             );
 
@@ -414,43 +424,16 @@ namespace Bloom::Widgets
             return;
         }
 
+        // Each selected range is written as a single block
         auto writeBlocks = std::vector<WriteTargetMemory::Block>();
 
-        Targets::TargetMemoryAddress blockStartAddress = sortedByteItemsByAddress.begin()->first;
-        Targets::TargetMemoryAddress blockEndAddress = blockStartAddress;
-
-        for (const auto& [address, byteItem] : sortedByteItemsByAddress) {
-            if (address > (blockEndAddress + 1)) {
-                // Commit the block
-                const auto dataBeginOffset = blockStartAddress - this->memoryDescriptor.addressRange.startAddress;
-                const auto dataEndOffset = blockEndAddress - this->memoryDescriptor.addressRange.startAddress + 1;
-
-                writeBlocks.emplace_back(
-                    blockStartAddress,
-                    Targets::TargetMemoryBuffer(
-                        this->hexViewerDataA->begin() + dataBeginOffset,
-                        this->hexViewerDataA->begin() + dataEndOffset
-                    )
-                );
-
-                blockStartAddress = address;
-                blockEndAddress = address;
-                continue;
-            }
-
-            blockEndAddress = address;
-        }
-
-        {
-            const auto dataBeginOffset = blockStartAddress - this->memoryDescriptor.addressRange.startAddress;
-            const auto dataEndOffset = blockEndAddress - this->memoryDescriptor.addressRange.startAddress + 1;
+        for (const auto& addressRange : restorableSelection.ranges()) {
+            const auto dataBeginOffset = addressRange.startAddress - this->memoryDescriptor.addressRange.startAddress;
+            const auto dataEndOffset = addressRange.endAddress - this->memoryDescriptor.addressRange.startAddress + 1;
 
             writeBlocks.emplace_back(
-                blockStartAddress,
-                Targets::TargetMemoryBuffer(
-                    this->hexViewerDataA->begin() + dataBeginOffset,
-                    this->hexViewerDataA->begin() + dataEndOffset
-                )
+                addressRange.startAddress,
+                this->hexViewerDataA->read(dataBeginOffset, dataEndOffset - dataBeginOffset)
             );
         }
 
@@ -458,17 +441,13 @@ namespace Bloom::Widgets
             auto& hexViewerDataB = this->hexViewerDataB.value();
 
             for (const auto& writeBlock : writeBlocks) {
-                std::copy(
-                    writeBlock.data.begin(),
-                    writeBlock.data.end(),
-                    hexViewerDataB.begin()
-                        + (writeBlock.startAddress - this->memoryDescriptor.addressRange.startAddress)
+                hexViewerDataB.write(
+                    writeBlock.startAddress - this->memoryDescriptor.addressRange.startAddress,
+                    writeBlock.data
                 );
             }
 
             this->refreshDifferences();
-            this->hexViewerWidgetA->updateValues();
-            this->hexViewerWidgetB->updateValues();
         };
 
         const auto writeMemoryTask = QSharedPointer<WriteTargetMemory>(
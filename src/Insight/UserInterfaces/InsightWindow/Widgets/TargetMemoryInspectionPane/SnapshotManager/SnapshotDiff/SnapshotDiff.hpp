@@ -14,6 +14,7 @@
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/TaskProgressIndicator/TaskProgressIndicator.hpp"
 
 #include "src/Targets/TargetMemory.hpp"
+#include "src/Insight/InsightWorker/Tasks/InsightWorkerTask.hpp"
 
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/MemorySnapshot.hpp"
 #include "DifferentialHexViewerWidget/DifferentialHexViewerWidget.hpp"
@@ -35,7 +36,7 @@ namespace Bloom::Widgets
 
         SnapshotDiff(
             MemorySnapshot& snapshotA,
-            Targets::TargetMemoryBuffer dataB,
+            const SharedMemoryBuffer& dataB,
             std::vector<FocusedMemoryRegion> focusedRegionsB,
             std::vector<ExcludedMemoryRegion> excludedRegionsB,
             Targets::TargetStackPointer stackPointerB,
@@ -44,7 +45,7 @@ namespace Bloom::Widgets
         );
 
         void refreshB(
-            Targets::TargetMemoryBuffer data,
+            const SharedMemoryBuffer& data,
             std::vector<FocusedMemoryRegion> focusedRegions,
             std::vector<ExcludedMemoryRegion> excludedRegions,
             Targets::TargetStackPointer stackPointer
@@ -77,14 +78,14 @@ namespace Bloom::Widgets
 
         DifferentialHexViewerSharedState differentialHexViewerSharedState;
 
-        std::optional<Targets::TargetMemoryBuffer> hexViewerDataA;
+        std::optional<SharedMemoryBuffer> hexViewerDataA;
         std::vector<FocusedMemoryRegion> focusedRegionsA;
         std::vector<ExcludedMemoryRegion> excludedRegionsA;
         Targets::TargetStackPointer stackPointerA;
         DifferentialHexViewerWidget* hexViewerWidgetA = nullptr;
         HexViewerWidgetSettings hexViewerWidgetSettingsA = HexViewerWidgetSettings();
 
-        std::optional<Targets::TargetMemoryBuffer> hexViewerDataB;
+        std::optional<SharedMemoryBuffer> hexViewerDataB;
         std::vector<FocusedMemoryRegion> focusedRegionsB;
         std::vector<ExcludedMemoryRegion> excludedRegionsB;
         Targets::TargetStackPointer stackPointerB;
@@ -101,12 +102,27 @@ namespace Bloom::Widgets
 
         TaskProgressIndicator* taskProgressIndicator = nullptr;
 
+        /**
+         * The ID of the most recently queued ComputeMemoryDifferences task. Results from any older tasks are
+         * discarded, as they may complete out of order.
+         */
+        std::optional<InsightWorkerTask::IdType> differencesTaskId;
+
         void init();
 
         void onHexViewerAReady();
         void onHexViewerBReady();
 
+        /**
+         * Queues a ComputeMemoryDifferences task to compare the two buffers, off the GUI thread. The hex viewers and
+         * the difference count label are updated once the task completes.
+         */
         void refreshDifferences();
+        void onDifferencesComputed(
+            InsightWorkerTask::IdType taskId,
+            std::vector<Targets::TargetMemoryAddressRange> differences,
+            std::size_t differenceCount
+        );
 
         void setSyncHexViewerSettingsEnabled(bool enabled);
         void setSyncHexViewerScrollEnabled(bool enabled);
@@ -114,7 +130,7 @@ namespace Bloom::Widgets
         void setSyncHexViewerSelectionEnabled(bool enabled);
 
         void restoreSelectedBytes(
-            const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress,
+            const ByteSelection& selection,
             bool confirmationPromptEnabled
         );
     };
@@ -24,7 +24,7 @@ namespace Bloom::Widgets
 
     SnapshotManager::SnapshotManager(
         const Targets::TargetMemoryDescriptor& memoryDescriptor,
-        const std::optional<Targets::TargetMemoryBuffer>& data,
+        const std::optional<SharedMemoryBuffer>& data,
         const bool& staleData,
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
         const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
@@ -275,6 +275,21 @@ namespace Bloom::Widgets
         bool captureFocusedRegions,
         bool captureDirectlyFromTarget
     ) {
+        /*
+         * New snapshots are stored as deltas of the most recent full snapshot, where worthwhile. We never use delta
+         * snapshots as bases, to keep reconstruction to a single step.
+         */
+        const MemorySnapshot* baseSnapshot = nullptr;
+
+        for (const auto& snapshot : this->snapshotsById) {
+            if (
+                !snapshot.baseSnapshotId.has_value()
+                && (baseSnapshot == nullptr || snapshot.createdDate > baseSnapshot->createdDate)
+            ) {
+                baseSnapshot = &snapshot;
+            }
+        }
+
         const auto captureTask = QSharedPointer<CaptureMemorySnapshot>(
             new CaptureMemorySnapshot(
                 std::move(name),
@@ -282,7 +297,8 @@ namespace Bloom::Widgets
                 this->memoryDescriptor.type,
                 captureFocusedRegions ? this->focusedMemoryRegions : std::vector<FocusedMemoryRegion>(),
                 this->excludedMemoryRegions,
-                captureDirectlyFromTarget ? std::nullopt : this->data
+                captureDirectlyFromTarget ? std::nullopt : this->data,
+                baseSnapshot != nullptr ? std::optional(*baseSnapshot) : std::nullopt
             ),
             &QObject::deleteLater
         );
@@ -461,6 +477,13 @@ namespace Bloom::Widgets
             &InsightWorkerTask::completed,
             this,
             [this, snapshotId] () {
+                // Any snapshots that were stored as deltas of the deleted snapshot have been stored in full
+                for (auto& snapshot : this->snapshotsById) {
+                    if (snapshot.baseSnapshotId == snapshotId) {
+                        snapshot.baseSnapshotId = std::nullopt;
+                    }
+                }
+
                 const auto& snapshotViewerIt = this->snapshotViewersById.find(snapshotId);
                 const auto& snapshotItemIt = this->snapshotItemsById.find(snapshotId);
 
@@ -556,22 +579,18 @@ namespace Bloom::Widgets
 
             writeBlocks.emplace_back(
                 blockStartAddress,
-                Targets::TargetMemoryBuffer(
-                    snapshot.data.begin() + dataBeginOffset,
-                    snapshot.data.begin() + dataEndOffset
-                )
+                snapshot.data.read(dataBeginOffset, dataEndOffset - dataBeginOffset)
             );
 
             blockStartAddress = excludedRegion->addressRange.endAddress + 1;
         }
 
         if (blockStartAddress < this->memoryDescriptor.addressRange.endAddress) {
+            const auto dataBeginOffset = blockStartAddress - this->memoryDescriptor.addressRange.startAddress;
+
             writeBlocks.emplace_back(
                 blockStartAddress,
-                Targets::TargetMemoryBuffer(
-                    snapshot.data.begin() + (blockStartAddress - this->memoryDescriptor.addressRange.startAddress),
-                    snapshot.data.end()
-                )
+                snapshot.data.read(dataBeginOffset, snapshot.data.size() - dataBeginOffset)
             );
         }
 
@@ -36,7 +36,7 @@ namespace Bloom::Widgets
 
         explicit SnapshotManager(
             const Targets::TargetMemoryDescriptor& memoryDescriptor,
-            const std::optional<Targets::TargetMemoryBuffer>& data,
+            const std::optional<SharedMemoryBuffer>& data,
             const bool& staleData,
             const std::vector<FocusedMemoryRegion>& focusedMemoryRegions,
             const std::vector<ExcludedMemoryRegion>& excludedMemoryRegions,
@@ -57,7 +57,7 @@ namespace Bloom::Widgets
 
     private:
         const Targets::TargetMemoryDescriptor& memoryDescriptor;
-        const std::optional<Targets::TargetMemoryBuffer>& data;
+        const std::optional<SharedMemoryBuffer>& data;
         const bool& staleData;
 
         const std::vector<FocusedMemoryRegion>& focusedMemoryRegions;
@@ -126,7 +126,7 @@ namespace Bloom::Widgets
 
         this->restoreBytesAction = new ContextMenuAction(
             "Restore Selection",
-            [this] (const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>&) {
+            [this] (const ByteSelection&) {
                 return this->memoryDescriptor.access.writeableDuringDebugSession;
             },
             this
@@ -170,8 +170,8 @@ namespace Bloom::Widgets
             this->restoreBytesAction,
             &ContextMenuAction::invoked,
             this,
-            [this] (const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress) {
-                this->restoreSelectedBytes(selectedByteItemsByAddress, true);
+            [this] (const ByteSelection& selection) {
+                this->restoreSelectedBytes(selection, true);
             }
         );
 
@@ -197,21 +197,16 @@ namespace Bloom::Widgets
     }
 
     void SnapshotViewer::restoreSelectedBytes(
-        const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress,
+        const ByteSelection& selection,
         bool confirmationPromptEnabled
     ) {
-        auto sortedByteItemsByAddress = std::map<Targets::TargetMemoryAddress, ByteItem*>();
+        auto restorableSelection = selection;
 
-        // Ideally, we'd use std::transform here, but that would require an additional pass to remove excluded bytes
-        for (const auto& pair : selectedByteItemsByAddress) {
-            if (pair.second->excluded) {
-                continue;
-            }
-
-            sortedByteItemsByAddress.insert(pair);
+        for (const auto& excludedRegion : this->snapshot.excludedRegions) {
+            restorableSelection.remove(excludedRegion.addressRange);
         }
 
-        if (sortedByteItemsByAddress.empty()) {
+        if (restorableSelection.empty()) {
             // The user has only selected bytes that are within an excluded region - nothing to do here
             return;
         }
@@ -219,7 +214,7 @@ namespace Bloom::Widgets
         if (confirmationPromptEnabled) {
             auto* confirmationDialog = new ConfirmationDialog(
                 "Restore selected bytes",
-                "This operation will write " + QString::number(sortedByteItemsByAddress.size())
+                "This operation will write " + QString::number(restorableSelection.byteCount())
                     + " byte(s) to the target's "
                     + EnumToStringMappings::targetMemoryTypes.at(this->memoryDescriptor.type).toUpper()
                     + ".<br/><br/>Are you sure you want to proceed?",
@@ -232,8 +227,8 @@ namespace Bloom::Widgets
                 confirmationDialog,
                 &ConfirmationDialog::confirmed,
                 this,
-                [this, selectedByteItemsByAddress] {
-                    this->restoreSelectedBytes(selectedByteItemsByAddress, false);
+                [this, restorableSelection] {
+                    this->restoreSelectedBytes(restorableSelection, false);
                 }
             );
 
@@ -241,43 +236,16 @@ namespace Bloom::Widgets
             return;
         }
 
+        // Each selected range is written as a single block
         auto writeBlocks = std::vector<WriteTargetMemory::Block>();
 
-        Targets::TargetMemoryAddress blockStartAddress = sortedByteItemsByAddress.begin()->first;
-        Targets::TargetMemoryAddress blockEndAddress = blockStartAddress;
-
-        for (const auto& [address, byteItem] : sortedByteItemsByAddress) {
-            if (address > (blockEndAddress + 1)) {
-                // Commit the block
-                const auto dataBeginOffset = blockStartAddress - this->memoryDescriptor.addressRange.startAddress;
-                const auto dataEndOffset = blockEndAddress - this->memoryDescriptor.addressRange.startAddress + 1;
-
-                writeBlocks.emplace_back(
-                    blockStartAddress,
-                    Targets::TargetMemoryBuffer(
-                        this->snapshot.data.begin() + dataBeginOffset,
-                        this->snapshot.data.begin() + dataEndOffset
-                    )
-                );
-
-                blockStartAddress = address;
-                blockEndAddress = address;
-                continue;
-            }
-
-            blockEndAddress = address;
-        }
-
-        {
-            const auto dataBeginOffset = blockStartAddress - this->memoryDescriptor.addressRange.startAddress;
-            const auto dataEndOffset = blockEndAddress - this->memoryDescriptor.addressRange.startAddress + 1;
+        for (const auto& addressRange : restorableSelection.ranges()) {
+            const auto dataBeginOffset = addressRange.startAddress - this->memoryDescriptor.addressRange.startAddress;
+            const auto dataEndOffset = addressRange.endAddress - this->memoryDescriptor.addressRange.startAddress + 1;
 
             writeBlocks.emplace_back(
-                blockStartAddress,
-                Targets::TargetMemoryBuffer(
-                    this->snapshot.data.begin() + dataBeginOffset,
-                    this->snapshot.data.begin() + dataEndOffset
-                )
+                addressRange.startAddress,
+                this->snapshot.data.read(dataBeginOffset, dataEndOffset - dataBeginOffset)
             );
         }
 
@@ -50,7 +50,7 @@ namespace Bloom::Widgets
         ListScene* memoryRegionListScene = nullptr;
         std::vector<MemoryRegionItem*> memoryRegionItems;
 
-        std::optional<Targets::TargetMemoryBuffer> hexViewerData;
+        std::optional<SharedMemoryBuffer> hexViewerData;
         HexViewerWidget* hexViewerWidget = nullptr;
         HexViewerWidgetSettings hexViewerWidgetSettings = HexViewerWidgetSettings();
 
@@ -63,7 +63,7 @@ namespace Bloom::Widgets
 
         void onHexViewerReady();
         void restoreSelectedBytes(
-            const std::unordered_map<Targets::TargetMemoryAddress, ByteItem*>& selectedByteItemsByAddress,
+            const ByteSelection& selection,
             bool confirmationPromptEnabled
         );
     };
@@ -8,12 +8,20 @@
 #include "src/Insight/InsightSignals.hpp"
 #include "src/Insight/InsightWorker/InsightWorker.hpp"
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/Label.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/ConfirmationDialog.hpp"
 
 #include "src/Insight/InsightWorker/Tasks/ReadTargetMemory.hpp"
 #include "src/Insight/InsightWorker/Tasks/ReadStackPointer.hpp"
+#include "src/Insight/InsightWorker/Tasks/ReadStackWatermark.hpp"
+#include "src/Insight/InsightWorker/Tasks/WriteTargetMemory.hpp"
+
+#include "MemoryDiff.hpp"
+
+#include "src/Targets/TargetMemoryAddressRangeIndex.hpp"
 
 #include "src/Services/PathService.hpp"
 #include "src/Helpers/EnumToStringMappings.hpp"
+#include "src/Logger/Logger.hpp"
 #include "src/Exceptions/Exception.hpp"
 
 namespace Bloom::Widgets
@@ -26,13 +34,16 @@ namespace Bloom::Widgets
 
     TargetMemoryInspectionPane::TargetMemoryInspectionPane(
         const TargetMemoryDescriptor& targetMemoryDescriptor,
+        bool runtimeMemoryAccessSupported,
         TargetMemoryInspectionPaneSettings& settings,
         PaneState& paneState,
         PanelWidget* parent
     )
         : PaneWidget(paneState, parent)
         , targetMemoryDescriptor(targetMemoryDescriptor)
+        , runtimeMemoryAccessSupported(runtimeMemoryAccessSupported)
         , settings(settings)
+        , liveRefreshScheduler(targetMemoryDescriptor.addressRange)
     {
         this->setObjectName("target-memory-inspection-pane");
 
@@ -81,6 +92,7 @@ namespace Bloom::Widgets
         this->refreshButton = this->container->findChild<SvgToolButton*>("refresh-memory-btn");
         this->refreshOnTargetStopAction = this->refreshButton->findChild<QAction*>("refresh-target-stopped");
         this->refreshOnActivationAction = this->refreshButton->findChild<QAction*>("refresh-activation");
+        this->refreshWhileRunningAction = this->refreshButton->findChild<QAction*>("refresh-while-running");
 
         this->detachPaneButton = this->container->findChild<SvgToolButton*>("detach-pane-btn");
         this->attachPaneButton = this->container->findChild<SvgToolButton*>("attach-pane-btn");
@@ -111,6 +123,47 @@ namespace Bloom::Widgets
 
         this->subContainerLayout->insertWidget(1, this->hexViewerWidget);
 
+        if (this->targetMemoryDescriptor.type == TargetMemoryType::RAM) {
+            this->trackStackWatermarkAction = new ContextMenuAction(
+                "Track Stack Watermark In Selection",
+                [this] (const ByteSelection& selection) {
+                    return this->targetState == Targets::TargetState::STOPPED && !selection.empty();
+                },
+                this
+            );
+
+            this->stopTrackingStackWatermarkAction = new ContextMenuAction(
+                "Stop Tracking Stack Watermark",
+                [this] (const ByteSelection&) {
+                    return this->settings.stackCanaryAddressRange.has_value();
+                },
+                this
+            );
+
+            QObject::connect(
+                this->trackStackWatermarkAction,
+                &ContextMenuAction::invoked,
+                this,
+                [this] (const ByteSelection& selection) {
+                    this->trackStackWatermark(selection);
+                }
+            );
+
+            QObject::connect(
+                this->stopTrackingStackWatermarkAction,
+                &ContextMenuAction::invoked,
+                this,
+                &TargetMemoryInspectionPane::stopTrackingStackWatermark
+            );
+
+            QObject::connect(
+                this->hexViewerWidget,
+                &HexViewerWidget::ready,
+                this,
+                &TargetMemoryInspectionPane::onHexViewerReady
+            );
+        }
+
         this->hexViewerWidget->init();
 
         this->rightPanel = new PanelWidget(PanelWidgetType::RIGHT, this->settings.rightPanelState, this);
@@ -134,6 +187,21 @@ namespace Bloom::Widgets
         this->setRefreshOnTargetStopEnabled(this->settings.refreshOnTargetStop);
         this->setRefreshOnActivationEnabled(this->settings.refreshOnActivation);
 
+        this->refreshWhileRunningAction->setVisible(this->runtimeMemoryAccessSupported);
+        this->setRefreshWhileRunningEnabled(this->settings.refreshWhileRunning);
+
+        this->liveRefreshScheduler.setBandwidthBudget(this->settings.liveRefreshBandwidthBudget);
+
+        this->liveRefreshTimer = new QTimer(this);
+        this->liveRefreshTimer->setInterval(TargetMemoryInspectionPane::LIVE_REFRESH_INTERVAL);
+
+        QObject::connect(
+            this->liveRefreshTimer,
+            &QTimer::timeout,
+            this,
+            &TargetMemoryInspectionPane::onLiveRefreshTimeout
+        );
+
         this->taskProgressIndicator = new TaskProgressIndicator(this);
         this->bottomBarLayout->insertWidget(5, this->taskProgressIndicator);
 
@@ -238,6 +306,15 @@ namespace Bloom::Widgets
             }
         );
 
+        QObject::connect(
+            this->refreshWhileRunningAction,
+            &QAction::triggered,
+            this,
+            [this] (bool checked) {
+                this->setRefreshWhileRunningEnabled(checked);
+            }
+        );
+
         QObject::connect(
             this->detachPaneButton,
             &QToolButton::clicked,
@@ -282,11 +359,13 @@ namespace Bloom::Widgets
             &TargetMemoryInspectionPane::onProgrammingModeDisabled
         );
 
-        QObject::connect(
-            insightSignals,
-            &InsightSignals::targetMemoryWritten,
+        insightSignals->subscribeToMemoryWrites(
             this,
-            &TargetMemoryInspectionPane::onTargetMemoryWritten
+            this->targetMemoryDescriptor.type,
+            this->targetMemoryDescriptor.addressRange,
+            [this] (const TargetMemoryAddressRange& addressRange) {
+                this->onTargetMemoryWritten(addressRange);
+            }
         );
 
         // Restore the state
@@ -311,22 +390,12 @@ namespace Bloom::Widgets
         this->refreshButton->setDisabled(true);
         this->refreshButton->startSpin();
 
-        auto excludedAddressRanges = std::set<Targets::TargetMemoryAddressRange>();
-        std::transform(
-            this->settings.excludedMemoryRegions.begin(),
-            this->settings.excludedMemoryRegions.end(),
-            std::inserter(excludedAddressRanges, excludedAddressRanges.begin()),
-            [this] (const ExcludedMemoryRegion& excludedRegion) {
-                return excludedRegion.addressRange;
-            }
-        );
-
         const auto readMemoryTask = QSharedPointer<ReadTargetMemory>(
             new ReadTargetMemory(
                 this->targetMemoryDescriptor.type,
                 this->targetMemoryDescriptor.addressRange.startAddress,
                 this->targetMemoryDescriptor.size(),
-                excludedAddressRanges
+                this->excludedAddressRanges()
             ),
             &QObject::deleteLater
         );
@@ -335,7 +404,7 @@ namespace Bloom::Widgets
             readMemoryTask.get(),
             &ReadTargetMemory::targetMemoryRead,
             this,
-            [this, callback] (const Targets::TargetMemoryBuffer& data) {
+            [this, callback] (const Targets::SharedTargetMemoryBuffer& data) {
                 this->onMemoryRead(data);
 
                 // Refresh the stack pointer if this is RAM.
@@ -474,10 +543,12 @@ namespace Bloom::Widgets
                 this->refreshButton->setDisabled(false);
             }
         }
+
+        this->updateLiveRefreshTimer();
     }
 
     void TargetMemoryInspectionPane::postDeactivate() {
-
+        this->updateLiveRefreshTimer();
     }
 
     void TargetMemoryInspectionPane::postAttach() {
@@ -495,30 +566,56 @@ namespace Bloom::Widgets
         auto processedFocusedMemoryRegions = std::vector<FocusedMemoryRegion>();
         auto processedExcludedMemoryRegions = std::vector<ExcludedMemoryRegion>();
 
-        const auto regionIntersects = [
-            &processedFocusedMemoryRegions,
-            &processedExcludedMemoryRegions
-        ] (const MemoryRegion& region) {
-            for (const auto& processedFocusedRegion : processedFocusedMemoryRegions) {
-                if (processedFocusedRegion.intersectsWith(region)) {
-                    return true;
-                }
+        /*
+         * A region is retained if it resides within the target memory and doesn't intersect with any of the
+         * regions retained before it (focused regions are considered first).
+         */
+        auto regionAddressRanges = std::vector<TargetMemoryAddressRange>();
+        regionAddressRanges.reserve(
+            this->settings.focusedMemoryRegions.size() + this->settings.excludedMemoryRegions.size()
+        );
+
+        for (const auto& focusedRegion : this->settings.focusedMemoryRegions) {
+            regionAddressRanges.push_back(focusedRegion.addressRange);
+        }
+
+        for (const auto& excludedRegion : this->settings.excludedMemoryRegions) {
+            regionAddressRanges.push_back(excludedRegion.addressRange);
+        }
+
+        const auto regionIndex = Targets::TargetMemoryAddressRangeIndex(regionAddressRanges);
+        auto retainedRegions = std::vector<bool>(regionAddressRanges.size(), false);
+
+        const auto retainRegion = [this, &regionIndex, &retainedRegions] (
+            const MemoryRegion& region,
+            std::size_t regionPosition
+        ) {
+            if (!this->targetMemoryDescriptor.addressRange.contains(region.addressRange)) {
+                return false;
             }
 
-            for (const auto& processedExcludedRegion : processedExcludedMemoryRegions) {
-                if (processedExcludedRegion.intersectsWith(region)) {
-                    return true;
+            auto intersects = false;
+
+            regionIndex.forEachIntersecting(
+                region.addressRange,
+                [regionPosition, &retainedRegions, &intersects] (
+                    const TargetMemoryAddressRange&,
+                    std::size_t index
+                ) {
+                    if (index < regionPosition && retainedRegions[index]) {
+                        intersects = true;
+                    }
                 }
-            }
+            );
 
-            return false;
+            retainedRegions[regionPosition] = !intersects;
+            return !intersects;
         };
 
+        auto regionPosition = std::size_t(0);
+
         for (const auto& focusedRegion : this->settings.focusedMemoryRegions) {
-            if (
-                !this->targetMemoryDescriptor.addressRange.contains(focusedRegion.addressRange)
-                || regionIntersects(focusedRegion)
-            ) {
+            if (!retainRegion(focusedRegion, regionPosition++)) {
                 continue;
             }
 
@@ -526,10 +623,7 @@ namespace Bloom::Widgets
         }
 
         for (const auto& excludedRegion : this->settings.excludedMemoryRegions) {
-            if (
-                !this->targetMemoryDescriptor.addressRange.contains(excludedRegion.addressRange)
-                || regionIntersects(excludedRegion)
-            ) {
+            if (!retainRegion(excludedRegion, regionPosition++)) {
                 continue;
             }
 
@@ -538,6 +632,22 @@ namespace Bloom::Widgets
 
         this->settings.focusedMemoryRegions = std::move(processedFocusedMemoryRegions);
         this->settings.excludedMemoryRegions = std::move(processedExcludedMemoryRegions);
+
+        if (
+            this->settings.stackCanaryAddressRange.has_value()
+            && (
+                this->targetMemoryDescriptor.type != TargetMemoryType::RAM
+                || !this->targetMemoryDescriptor.addressRange.contains(*(this->settings.stackCanaryAddressRange))
+            )
+        ) {
+            this->settings.stackCanaryAddressRange.reset();
+        }
+
+        this->settings.liveRefreshBandwidthBudget = std::clamp(
+            this->settings.liveRefreshBandwidthBudget,
+            TargetMemoryInspectionPane::MIN_LIVE_REFRESH_BANDWIDTH_BUDGET,
+            TargetMemoryInspectionPane::MAX_LIVE_REFRESH_BANDWIDTH_BUDGET
+        );
     }
 
     void TargetMemoryInspectionPane::onTargetStateChanged(Targets::TargetState newState) {
@@ -549,6 +659,15 @@ namespace Bloom::Widgets
         this->targetState = newState;
 
         if (newState == TargetState::STOPPED) {
+            if (this->settings.stackCanaryAddressRange.has_value()) {
+                if (!this->stackCanaryPainted) {
+                    this->paintStackCanary();
+
+                } else {
+                    this->refreshStackWatermark();
+                }
+            }
+
             if (this->state.activated && (this->settings.refreshOnTargetStop || !this->data.has_value())) {
                 this->refreshMemoryValues([this] {
                     this->hexViewerWidget->setDisabled(false);
@@ -561,14 +680,21 @@ namespace Bloom::Widgets
         }
 
         if (newState == TargetState::RUNNING) {
-            this->hexViewerWidget->setDisabled(true);
             this->refreshButton->setDisabled(true);
 
-            if (this->data.has_value()) {
-                this->setStaleData(true);
+            if (this->liveRefreshActive()) {
+                this->hexViewerWidget->setDisabled(false);
+
+            } else {
+                this->hexViewerWidget->setDisabled(true);
+
+                if (this->data.has_value()) {
+                    this->setStaleData(true);
+                }
             }
         }
 
+        this->updateLiveRefreshTimer();
         this->snapshotManager->createSnapshotWindow->refreshForm();
     }
 
@@ -582,11 +708,193 @@ namespace Bloom::Widgets
         this->settings.refreshOnActivation = enabled;
     }
 
-    void TargetMemoryInspectionPane::onMemoryRead(const Targets::TargetMemoryBuffer& data) {
+    void TargetMemoryInspectionPane::setRefreshWhileRunningEnabled(bool enabled) {
+        this->refreshWhileRunningAction->setChecked(enabled);
+        this->settings.refreshWhileRunning = enabled;
+
+        if (this->targetState == Targets::TargetState::RUNNING && this->data.has_value()) {
+            const auto liveRefreshActive = this->liveRefreshActive();
+            this->hexViewerWidget->setDisabled(!liveRefreshActive);
+            this->setStaleData(!liveRefreshActive);
+        }
+
+        this->updateLiveRefreshTimer();
+    }
+
+    std::set<Targets::TargetMemoryAddressRange> TargetMemoryInspectionPane::excludedAddressRanges() const {
+        auto excludedAddressRanges = std::set<Targets::TargetMemoryAddressRange>();
+        std::transform(
+            this->settings.excludedMemoryRegions.begin(),
+            this->settings.excludedMemoryRegions.end(),
+            std::inserter(excludedAddressRanges, excludedAddressRanges.begin()),
+            [] (const ExcludedMemoryRegion& excludedRegion) {
+                return excludedRegion.addressRange;
+            }
+        );
+
+        return excludedAddressRanges;
+    }
+
+    bool TargetMemoryInspectionPane::liveRefreshActive() const {
+        return
+            this->settings.refreshWhileRunning
+            && this->runtimeMemoryAccessSupported
+            && this->targetState == Targets::TargetState::RUNNING
+            && !this->programmingModeEnabled
+            && this->data.has_value()
+        ;
+    }
+
+    void TargetMemoryInspectionPane::updateLiveRefreshTimer() {
+        if (this->liveRefreshTimer == nullptr) {
+            return;
+        }
+
+        if (!this->liveRefreshActive() || !this->state.activated) {
+            this->liveRefreshTimer->stop();
+            return;
+        }
+
+        if (!this->liveRefreshTimer->isActive()) {
+            this->liveRefreshScheduler.reset();
+            this->lastLiveRefreshTime = std::chrono::steady_clock::now();
+            this->liveRefreshTimer->start();
+        }
+    }
+
+    void TargetMemoryInspectionPane::onLiveRefreshTimeout() {
+        const auto now = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - this->lastLiveRefreshTime);
+        this->lastLiveRefreshTime = now;
+
+        /*
+         * If the reads from the previous interval are still pending, the TargetController is busy (most likely with
+         * commands from the debug client, which take priority over ours). We don't accrue any allowance for the time
+         * we spend waiting, so we back off, instead of catching up with a burst of reads.
+         */
+        if (this->pendingLiveReadCount > 0 || !this->liveRefreshActive()) {
+            return;
+        }
+
+        auto priorityRanges = std::vector<TargetMemoryAddressRange>();
+
+        if (const auto visibleAddressRange = this->hexViewerWidget->visibleAddressRange()) {
+            priorityRanges.push_back(*visibleAddressRange);
+        }
+
+        for (const auto& focusedRegion : this->settings.focusedMemoryRegions) {
+            priorityRanges.push_back(focusedRegion.addressRange);
+        }
+
+        this->liveRefreshScheduler.setPriorityRanges(std::move(priorityRanges));
+
+        const auto readRanges = this->liveRefreshScheduler.schedule(elapsed);
+        if (readRanges.empty()) {
+            return;
+        }
+
+        const auto excludedAddressRanges = this->excludedAddressRanges();
+
+        for (const auto& readRange : readRanges) {
+            const auto readMemoryTask = QSharedPointer<ReadTargetMemory>(
+                new ReadTargetMemory(
+                    this->targetMemoryDescriptor.type,
+                    readRange.startAddress,
+                    readRange.endAddress - readRange.startAddress + 1,
+                    excludedAddressRanges
+                ),
+                &QObject::deleteLater
+            );
+
+            QObject::connect(
+                readMemoryTask.get(),
+                &ReadTargetMemory::targetMemoryRead,
+                this,
+                [this, startAddress = readRange.startAddress] (const Targets::SharedTargetMemoryBuffer& data) {
+                    this->onLiveMemoryRead(startAddress, data);
+                }
+            );
+
+            QObject::connect(
+                readMemoryTask.get(),
+                &InsightWorkerTask::finished,
+                this,
+                [this] {
+                    if (--this->pendingLiveReadCount > 0) {
+                        return;
+                    }
+
+                    if (!this->pendingLiveChangedRanges.empty()) {
+                        this->hexViewerWidget->updateChangedValues(this->pendingLiveChangedRanges);
+                        this->pendingLiveChangedRanges.clear();
+                    }
+                }
+            );
+
+            ++this->pendingLiveReadCount;
+            InsightWorker::queueTask(readMemoryTask);
+        }
+    }
+
+    void TargetMemoryInspectionPane::onLiveMemoryRead(
+        Targets::TargetMemoryAddress startAddress,
+        const Targets::SharedTargetMemoryBuffer& data
+    ) {
+        // If the target has stopped in the meantime, a full refresh will take care of things
+        if (!this->liveRefreshActive()) {
+            return;
+        }
+
+        const auto offset = startAddress - this->targetMemoryDescriptor.addressRange.startAddress;
+        if (offset + data.size() > this->data->size()) {
+            return;
+        }
+
+        const auto changedRanges = MemoryDiff::differingRanges(
+            this->data->read(offset, data.size()),
+            data.span(),
+            startAddress
+        );
+
+        if (changedRanges.empty()) {
+            return;
+        }
+
+        // Only the pages touched by the changes are replaced - the rest remain shared with any snapshots
+        this->data->write(offset, data);
+        this->pendingLiveChangedRanges.insert(
+            this->pendingLiveChangedRanges.end(),
+            changedRanges.begin(),
+            changedRanges.end()
+        );
+    }
+
+    void TargetMemoryInspectionPane::onMemoryRead(const Targets::SharedTargetMemoryBuffer& data) {
         assert(data.size() == this->targetMemoryDescriptor.size());
 
-        this->data = data;
-        this->hexViewerWidget->updateValues();
+        if (this->data.has_value() && this->data->size() == data.size()) {
+            /*
+             * Writing the new data over a copy of the old data replaces only the pages that have changed, so the
+             * differences can be found without comparing the pages that haven't.
+             */
+            auto newData = *(this->data);
+            newData.write(0, data);
+
+            // Only the bytes that have changed since the last read need repainting
+            const auto changedRanges = MemoryDiff::differingRanges(
+                *(this->data),
+                newData,
+                this->targetMemoryDescriptor.addressRange.startAddress
+            );
+
+            this->data = std::move(newData);
+            this->hexViewerWidget->updateChangedValues(changedRanges);
+
+        } else {
+            this->data = SharedMemoryBuffer(data);
+            this->hexViewerWidget->updateValues();
+        }
+
         this->setStaleData(false);
     }
 
@@ -636,6 +944,9 @@ namespace Bloom::Widgets
     }
 
     void TargetMemoryInspectionPane::onProgrammingModeEnabled() {
+        this->programmingModeEnabled = true;
+        this->updateLiveRefreshTimer();
+
         this->hexViewerWidget->setDisabled(true);
         this->refreshButton->setDisabled(true);
 
@@ -645,16 +956,16 @@ namespace Bloom::Widgets
     }
 
     void TargetMemoryInspectionPane::onProgrammingModeDisabled() {
+        this->programmingModeEnabled = false;
+        this->updateLiveRefreshTimer();
+
         const auto disabled = this->targetState != Targets::TargetState::STOPPED || !this->data.has_value();
-        this->hexViewerWidget->setDisabled(disabled);
+        this->hexViewerWidget->setDisabled(disabled && !this->liveRefreshActive());
         this->refreshButton->setDisabled(disabled);
     }
 
-    void TargetMemoryInspectionPane::onTargetMemoryWritten(
-        TargetMemoryType memoryType,
-        TargetMemoryAddressRange
-    ) {
-        if (memoryType == this->targetMemoryDescriptor.type && this->data.has_value()) {
+    void TargetMemoryInspectionPane::onTargetMemoryWritten(const TargetMemoryAddressRange&) {
+        if (this->data.has_value()) {
             this->setStaleData(true);
             this->snapshotManager->createSnapshotWindow->refreshForm();
         }
@@ -672,4 +983,130 @@ namespace Bloom::Widgets
         this->staleData = staleData;
         this->staleDataLabelContainer->setVisible(this->staleData);
     }
+
+    void TargetMemoryInspectionPane::onHexViewerReady() {
+        this->hexViewerWidget->addExternalContextMenuAction(this->trackStackWatermarkAction);
+        this->hexViewerWidget->addExternalContextMenuAction(this->stopTrackingStackWatermarkAction);
+    }
+
+    void TargetMemoryInspectionPane::trackStackWatermark(const ByteSelection& selection) {
+        const auto selectionRange = selection.boundingRange();
+        if (!selectionRange.has_value()) {
+            return;
+        }
+
+        const auto canaryAddressRange = *selectionRange;
+        const auto canarySize = canaryAddressRange.endAddress - canaryAddressRange.startAddress + 1;
+
+        auto* confirmationDialog = new ConfirmationDialog(
+            "Track stack watermark",
+            "This operation will fill " + QString::number(canarySize)
+                + " byte(s) of the target's RAM with the stack canary value (0x"
+                + QString::number(TargetMemoryInspectionPane::STACK_CANARY_VALUE, 16).toUpper() + "). The selected "
+                "region must not be in use by the program (other than by the stack)."
+                "<br/><br/>Are you sure you want to proceed?",
+            "Proceed",
+            std::nullopt,
+            this
+        );
+
+        QObject::connect(
+            confirmationDialog,
+            &ConfirmationDialog::confirmed,
+            this,
+            [this, canaryAddressRange] {
+                this->settings.stackCanaryAddressRange = canaryAddressRange;
+                this->stackCanaryPainted = false;
+                this->paintStackCanary();
+            }
+        );
+
+        confirmationDialog->show();
+    }
+
+    void TargetMemoryInspectionPane::stopTrackingStackWatermark() {
+        this->settings.stackCanaryAddressRange.reset();
+        this->stackCanaryPainted = false;
+        this->hexViewerWidget->setStackWatermark(std::nullopt);
+    }
+
+    void TargetMemoryInspectionPane::paintStackCanary() {
+        assert(this->settings.stackCanaryAddressRange.has_value());
+        const auto canaryAddressRange = *(this->settings.stackCanaryAddressRange);
+
+        const auto readStackPointerTask = QSharedPointer<ReadStackPointer>(
+            new ReadStackPointer(),
+            &QObject::deleteLater
+        );
+
+        QObject::connect(
+            readStackPointerTask.get(),
+            &ReadStackPointer::stackPointerRead,
+            this,
+            [this, canaryAddressRange] (Targets::TargetStackPointer stackPointer) {
+                // Painting over memory that's currently in use by the stack would corrupt it
+                if (stackPointer <= canaryAddressRange.endAddress) {
+                    Logger::warning(
+                        "The stack canary region overlaps the current stack (stack pointer: 0x"
+                            + QString::number(stackPointer, 16).toUpper().toStdString()
+                            + ") - the canary will not be painted"
+                    );
+                    return;
+                }
+
+                const auto writeMemoryTask = QSharedPointer<WriteTargetMemory>(
+                    new WriteTargetMemory(
+                        this->targetMemoryDescriptor,
+                        canaryAddressRange.startAddress,
+                        Targets::TargetMemoryBuffer(
+                            canaryAddressRange.endAddress - canaryAddressRange.startAddress + 1,
+                            TargetMemoryInspectionPane::STACK_CANARY_VALUE
+                        )
+                    ),
+                    &QObject::deleteLater
+                );
+
+                QObject::connect(
+                    writeMemoryTask.get(),
+                    &InsightWorkerTask::completed,
+                    this,
+                    [this] {
+                        this->stackCanaryPainted = true;
+                        this->hexViewerWidget->setStackWatermark(std::nullopt);
+                    }
+                );
+
+                this->taskProgressIndicator->addTask(writeMemoryTask);
+                InsightWorker::queueTask(writeMemoryTask);
+            }
+        );
+
+        this->taskProgressIndicator->addTask(readStackPointerTask);
+        InsightWorker::queueTask(readStackPointerTask);
+    }
+
+    void TargetMemoryInspectionPane::refreshStackWatermark() {
+        assert(this->settings.stackCanaryAddressRange.has_value());
+
+        const auto readStackWatermarkTask = QSharedPointer<ReadStackWatermark>(
+            new ReadStackWatermark(
+                this->targetMemoryDescriptor.type,
+                *(this->settings.stackCanaryAddressRange),
+                TargetMemoryInspectionPane::STACK_CANARY_VALUE
+            ),
+            &QObject::deleteLater
+        );
+
+        QObject::connect(
+            readStackWatermarkTask.get(),
+            &ReadStackWatermark::stackWatermarkRead,
+            this,
+            [this] (std::optional<Targets::TargetMemoryAddress> stackWatermark) {
+                this->hexViewerWidget->setStackWatermark(stackWatermark);
+            }
+        );
+
+        this->taskProgressIndicator->addTask(readStackWatermarkTask);
+        InsightWorker::queueTask(readStackWatermarkTask);
+    }
 }
@@ -3,7 +3,10 @@
 #include <QWidget>
 #include <optional>
 #include <vector>
+#include <set>
+#include <chrono>
 #include <QResizeEvent>
+#include <QTimer>
 #include <QHBoxLayout>
 #include <QToolButton>
 #include <QSpacerItem>
@@ -12,6 +15,7 @@
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/PaneWidget.hpp"
 
 #include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/SharedTargetMemoryBuffer.hpp"
 
 #include "src/Targets/TargetState.hpp"
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/PanelWidget.hpp"
@@ -23,10 +27,13 @@
 #include "src/Insight/InsightWorker/Tasks/ReadTargetMemory.hpp"
 
 #include "HexViewerWidget/HexViewerWidget.hpp"
+#include "HexViewerWidget/ContextMenuAction.hpp"
 #include "MemoryRegionManager/MemoryRegionManagerWindow.hpp"
 #include "SnapshotManager/SnapshotManager.hpp"
 
 #include "TargetMemoryInspectionPaneSettings.hpp"
+#include "SharedMemoryBuffer.hpp"
+#include "LiveRefreshScheduler.hpp"
 
 namespace Bloom::Widgets
 {
@@ -35,10 +42,37 @@ namespace Bloom::Widgets
         Q_OBJECT
 
     public:
+        /**
+         * The value painted over the stack canary region. Any value will do, as long as it's unlikely to be pushed
+         * onto the stack. 0xC5 is the value commonly used by AVR stack painting routines.
+         */
+        static constexpr unsigned char STACK_CANARY_VALUE = 0xC5;
+
+        /**
+         * How often the live refresh scheduler is invoked, whilst the target is running.
+         */
+        static constexpr auto LIVE_REFRESH_INTERVAL = std::chrono::milliseconds(200);
+
+        /**
+         * Bounds for TargetMemoryInspectionPaneSettings::liveRefreshBandwidthBudget, which is provided by the user.
+         */
+        static constexpr std::uint32_t MIN_LIVE_REFRESH_BANDWIDTH_BUDGET = 256;
+        static constexpr std::uint32_t MAX_LIVE_REFRESH_BANDWIDTH_BUDGET = 65536;
+
         TargetMemoryInspectionPaneSettings& settings;
 
+        /**
+         * @param targetMemoryDescriptor
+         * @param runtimeMemoryAccessSupported
+         *  Whether the target allows memory access whilst it's running. Continuous refreshing is only offered if so.
+         *
+         * @param settings
+         * @param paneState
+         * @param parent
+         */
         TargetMemoryInspectionPane(
             const Targets::TargetMemoryDescriptor& targetMemoryDescriptor,
+            bool runtimeMemoryAccessSupported,
             TargetMemoryInspectionPaneSettings& settings,
             PaneState& paneState,
             PanelWidget* parent
@@ -57,8 +91,9 @@ namespace Bloom::Widgets
 
     private:
         const Targets::TargetMemoryDescriptor& targetMemoryDescriptor;
+        const bool runtimeMemoryAccessSupported;
 
-        std::optional<Targets::TargetMemoryBuffer> data;
+        std::optional<SharedMemoryBuffer> data;
         std::optional<Targets::TargetStackPointer> stackPointer;
         std::optional<QSharedPointer<ReadTargetMemory>> activeRefreshTask;
 
@@ -75,6 +110,7 @@ namespace Bloom::Widgets
         SvgToolButton* refreshButton = nullptr;
         QAction* refreshOnTargetStopAction = nullptr;
         QAction* refreshOnActivationAction = nullptr;
+        QAction* refreshWhileRunningAction = nullptr;
 
         SvgToolButton* detachPaneButton = nullptr;
         SvgToolButton* attachPaneButton = nullptr;
@@ -91,24 +127,71 @@ namespace Bloom::Widgets
         MemoryRegionManagerWindow* memoryRegionManagerWindow = nullptr;
 
         bool staleData = false;
+        bool programmingModeEnabled = false;
+
+        LiveRefreshScheduler liveRefreshScheduler;
+        QTimer* liveRefreshTimer = nullptr;
+        std::chrono::steady_clock::time_point lastLiveRefreshTime;
+
+        /**
+         * The number of live refresh reads that have been queued but not yet completed. We don't queue any more
+         * until they've all completed, so that we back off when the TargetController is busy.
+         */
+        std::size_t pendingLiveReadCount = 0;
+
+        /**
+         * Ranges that have changed since the last live refresh update. These are accumulated across all of the reads
+         * in a single scheduling interval, and applied to the hex viewer in one go, once the reads have completed.
+         */
+        std::vector<Targets::TargetMemoryAddressRange> pendingLiveChangedRanges;
+
+        ContextMenuAction* trackStackWatermarkAction = nullptr;
+        ContextMenuAction* stopTrackingStackWatermarkAction = nullptr;
+
+        /**
+         * The stack canary is painted once per session, upon the first target stop (or when the user selects a new
+         * canary region).
+         */
+        bool stackCanaryPainted = false;
 
         void sanitiseSettings();
         void onTargetStateChanged(Targets::TargetState newState);
         void setRefreshOnTargetStopEnabled(bool enabled);
         void setRefreshOnActivationEnabled(bool enabled);
-        void onMemoryRead(const Targets::TargetMemoryBuffer& data);
+        void setRefreshWhileRunningEnabled(bool enabled);
+        std::set<Targets::TargetMemoryAddressRange> excludedAddressRanges() const;
+
+        /**
+         * Whether continuous refreshing is enabled and possible, in the current state of the target.
+         *
+         * @return
+         */
+        bool liveRefreshActive() const;
+
+        /**
+         * Starts or stops the live refresh timer, depending on liveRefreshActive() and whether the pane is activated.
+         */
+        void updateLiveRefreshTimer();
+        void onLiveRefreshTimeout();
+        void onLiveMemoryRead(
+            Targets::TargetMemoryAddress startAddress,
+            const Targets::SharedTargetMemoryBuffer& data
+        );
+        void onMemoryRead(const Targets::SharedTargetMemoryBuffer& data);
         void openMemoryRegionManagerWindow();
         void toggleMemorySnapshotManagerPane();
         void onMemoryRegionsChange();
         void onTargetReset();
         void onProgrammingModeEnabled();
         void onProgrammingModeDisabled();
-        void onTargetMemoryWritten(
-            Bloom::Targets::TargetMemoryType memoryType,
-            Targets::TargetMemoryAddressRange addressRange
-        );
+        void onTargetMemoryWritten(const Targets::TargetMemoryAddressRange& addressRange);
         void onSubtaskCreated(const QSharedPointer<InsightWorkerTask>& task);
         void onSnapshotRestored(const QString& snapshotId);
         void setStaleData(bool staleData);
+        void onHexViewerReady();
+        void trackStackWatermark(const ByteSelection& selection);
+        void stopTrackingStackWatermark();
+        void paintStackCanary();
+        void refreshStackWatermark();
     };
 }
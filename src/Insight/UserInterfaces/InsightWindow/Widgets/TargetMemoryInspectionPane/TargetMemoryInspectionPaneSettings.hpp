@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
+#include <optional>
 
 #include "FocusedMemoryRegion.hpp"
 #include "ExcludedMemoryRegion.hpp"
@@ -17,11 +19,27 @@ namespace Bloom::Widgets
         bool refreshOnTargetStop = false;
         bool refreshOnActivation = false;
 
+        /**
+         * Whether to keep refreshing the memory whilst the target is running, on targets that allow memory access
+         * during execution. See LiveRefreshScheduler.
+         */
+        bool refreshWhileRunning = false;
+
+        /**
+         * The maximum amount of memory to read whilst the target is running, in bytes per second.
+         */
+        std::uint32_t liveRefreshBandwidthBudget = 4096;
+
         HexViewerWidgetSettings hexViewerWidgetSettings;
 
         std::vector<FocusedMemoryRegion> focusedMemoryRegions;
         std::vector<ExcludedMemoryRegion> excludedMemoryRegions;
 
+        /**
+         * The region painted with the stack canary, for stack watermark tracking. Only applicable to RAM.
+         */
+        std::optional<Targets::TargetMemoryAddressRange> stackCanaryAddressRange;
+
         PanelState rightPanelState = PanelState(300, true);
         PaneState snapshotManagerState = PaneState(true, true, std::nullopt);
     };
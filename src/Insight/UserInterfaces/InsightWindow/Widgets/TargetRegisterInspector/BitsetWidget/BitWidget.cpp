@@ -45,4 +45,8 @@ namespace Bloom::Widgets
             });
         }
     }
+
+    void BitWidget::updateBody() {
+        this->body->update();
+    }
 }
@@ -37,6 +37,11 @@ namespace Bloom::Widgets
             QWidget* parent
         );
 
+        /**
+         * Repaints the bit body, to reflect a change to the bit's value.
+         */
+        void updateBody();
+
     signals:
         void bitChanged();
 
@@ -31,6 +31,7 @@ namespace Bloom::Widgets
                 this
             );
 
+            this->bitWidgets[static_cast<std::size_t>(bitIndex)] = bitWidget;
             bitLayout->addWidget(bitWidget, 0, Qt::AlignmentFlag::AlignHCenter | Qt::AlignmentFlag::AlignTop);
             QObject::connect(
                 bitWidget,
@@ -46,8 +47,23 @@ namespace Bloom::Widgets
     }
 
     void BitsetWidget::updateValue() {
-        this->bitset = {this->byte};
-        this->update();
+        const auto newBitset = decltype(this->bitset)(this->byte);
+        const auto changedBits = this->bitset ^ newBitset;
+
+        if (changedBits.none()) {
+            return;
+        }
+
+        this->bitset = newBitset;
+
+        for (auto bitIndex = std::size_t(0); bitIndex < changedBits.size(); ++bitIndex) {
+            if (changedBits[bitIndex]) {
+                this->bitWidgets[bitIndex]->updateBody();
+            }
+        }
+
+        // The byte value graphic (and its hex label) sits beneath the bit widgets
+        this->update(0, BitWidget::HEIGHT, this->width(), this->height() - BitWidget::HEIGHT);
     }
 
     void BitsetWidget::paintEvent(QPaintEvent* event) {
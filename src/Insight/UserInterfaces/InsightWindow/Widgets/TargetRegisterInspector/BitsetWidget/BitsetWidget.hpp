@@ -2,6 +2,7 @@
 
 #include <QWidget>
 #include <bitset>
+#include <array>
 #include <QSize>
 #include <QString>
 #include <QEvent>
@@ -21,6 +22,13 @@ namespace Bloom::Widgets
 
         BitsetWidget(int byteNumber, unsigned char& byte, bool readOnly, QWidget* parent);
 
+        /**
+         * Refreshes the widget after the byte has been changed externally (e.g. via the register value input field,
+         * or a register history item).
+         *
+         * Only the bits that have changed are repainted - this is called for every byte in the register, upon every
+         * change to the register value, and it's typically the case that most bytes (and bits) are unchanged.
+         */
         void updateValue();
 
     signals:
@@ -36,6 +44,11 @@ namespace Bloom::Widgets
         std::bitset<std::numeric_limits<unsigned char>::digits> bitset = {byte};
         bool readOnly = true;
 
+        /**
+         * Indexed by bit index (bitWidgets[0] is the widget for the LSB).
+         */
+        std::array<BitWidget*, std::numeric_limits<unsigned char>::digits> bitWidgets = {};
+
         QWidget* container = nullptr;
     };
 }
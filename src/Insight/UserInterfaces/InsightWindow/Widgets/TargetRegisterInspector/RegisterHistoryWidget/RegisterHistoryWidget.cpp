@@ -1,6 +1,5 @@
 #include "RegisterHistoryWidget.hpp"
 
-#include <QFile>
 #include <QVBoxLayout>
 #include <QMargins>
 #include <QTableWidget>
@@ -12,12 +11,9 @@
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/Label.hpp"
 
 #include "src/Services/PathService.hpp"
-#include "src/Exceptions/Exception.hpp"
 
 namespace Bloom::Widgets
 {
-    using namespace Bloom::Exceptions;
-
     using Bloom::Targets::TargetRegisterDescriptor;
     using Bloom::Targets::TargetRegisterDescriptors;
     using Bloom::Targets::TargetRegisterType;
@@ -25,29 +21,26 @@ namespace Bloom::Widgets
     RegisterHistoryWidget::RegisterHistoryWidget(
         const Targets::TargetRegisterDescriptor& registerDescriptor,
         const Targets::TargetMemoryBuffer& currentValue,
+        std::uint32_t capacity,
         QWidget* parent
     )
         : QWidget(parent)
         , registerDescriptor(registerDescriptor)
+        , capacity(capacity)
     {
         this->setObjectName("target-register-history-widget");
         this->setFixedWidth(300);
 
         this->setSizePolicy(QSizePolicy::MinimumExpanding, QSizePolicy::MinimumExpanding);
 
-        auto widgetUiFile = QFile(
+        auto uiLoader = UiLoader(this);
+        this->container = uiLoader.load(
             QString::fromStdString(Services::PathService::compiledResourcesPath()
                 + "/src/Insight/UserInterfaces/InsightWindow/Widgets/TargetRegisterInspector/RegisterHistoryWidget"
                 + "/UiFiles/RegisterHistoryWidget.ui"
-            )
+            ),
+            this
         );
-
-        if (!widgetUiFile.open(QFile::ReadOnly)) {
-            throw Exception("Failed to open RegisterHistoryWidget UI file");
-        }
-
-        auto uiLoader = UiLoader(this);
-        this->container = uiLoader.load(&widgetUiFile, this);
         this->container->setMinimumSize(this->size());
         this->container->setContentsMargins(1, 1, 1, 1);
 
@@ -68,11 +61,12 @@ namespace Bloom::Widgets
             &RegisterHistoryWidget::onTargetStateChanged
         );
 
-        QObject::connect(
-            insightSignals,
-            &InsightSignals::targetRegistersWritten,
+        insightSignals->subscribeToRegisterWrites(
             this,
-            &RegisterHistoryWidget::onRegistersWritten
+            {this->registerDescriptor},
+            [this] (const Targets::TargetRegisters& targetRegisters, const QDateTime& changeDate) {
+                this->onRegistersWritten(targetRegisters, changeDate);
+            }
         );
 
         this->currentItem = new CurrentItem(currentValue, this);
@@ -109,6 +103,19 @@ namespace Bloom::Widgets
         auto* item = new RegisterHistoryItem(registerValue, changeDate, this->itemContainer);
         QObject::connect(item, &Item::selected, this, &RegisterHistoryWidget::onItemSelectionChange);
         this->itemContainerLayout->insertWidget(2, item);
+        this->historyItems.push_front(item);
+
+        while (this->historyItems.size() > this->capacity) {
+            auto* oldestItem = this->historyItems.back();
+            this->historyItems.pop_back();
+
+            if (this->selectedItemWidget == oldestItem) {
+                this->selectCurrentItem();
+            }
+
+            this->itemContainerLayout->removeWidget(oldestItem);
+            oldestItem->deleteLater();
+        }
     }
 
     void RegisterHistoryWidget::resizeEvent(QResizeEvent* event) {
@@ -136,7 +143,7 @@ namespace Bloom::Widgets
     }
 
     void RegisterHistoryWidget::onRegistersWritten(
-        Targets::TargetRegisters targetRegisters,
+        const Targets::TargetRegisters& targetRegisters,
         const QDateTime& changeDate
     ) {
         for (const auto& targetRegister : targetRegisters) {
@@ -7,6 +7,8 @@
 #include <QString>
 #include <QEvent>
 #include <optional>
+#include <deque>
+#include <cstdint>
 
 #include "src/Targets/TargetRegister.hpp"
 #include "src/Targets/TargetMemory.hpp"
@@ -26,6 +28,7 @@ namespace Bloom::Widgets
         RegisterHistoryWidget(
             const Targets::TargetRegisterDescriptor& registerDescriptor,
             const Targets::TargetMemoryBuffer& currentValue,
+            std::uint32_t capacity,
             QWidget* parent
         );
 
@@ -48,6 +51,11 @@ namespace Bloom::Widgets
     private:
         Targets::TargetRegisterDescriptor registerDescriptor;
 
+        /**
+         * The maximum number of history items. See InsightConfig::registerHistoryCapacity.
+         */
+        std::uint32_t capacity;
+
         QWidget* container = nullptr;
         QWidget* itemContainer = nullptr;
         QVBoxLayout* itemContainerLayout = nullptr;
@@ -56,9 +64,14 @@ namespace Bloom::Widgets
         CurrentItem* currentItem = nullptr;
         Item* selectedItemWidget = nullptr;
 
+        /**
+         * History items, most recent first.
+         */
+        std::deque<RegisterHistoryItem*> historyItems;
+
     private slots:
         void onTargetStateChanged(Targets::TargetState newState);
         void onItemSelectionChange(Item* newlySelectedWidget);
-        void onRegistersWritten(Targets::TargetRegisters targetRegisters, const QDateTime& changeDate);
+        void onRegistersWritten(const Targets::TargetRegisters& targetRegisters, const QDateTime& changeDate);
     };
 }
@@ -10,16 +10,13 @@
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/PlainTextEdit.hpp"
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/ErrorDialogue/ErrorDialogue.hpp"
 
-
 #include "src/Services/PathService.hpp"
-#include "src/Exceptions/Exception.hpp"
 
 #include "src/Insight/InsightWorker/Tasks/ReadTargetRegisters.hpp"
 #include "src/Insight/InsightWorker/Tasks/WriteTargetRegister.hpp"
 
 namespace Bloom::Widgets
 {
-    using Bloom::Exceptions::Exception;
     using Bloom::Targets::TargetRegisterDescriptor;
     using Bloom::Targets::TargetRegisterDescriptors;
     using Bloom::Targets::TargetRegisterType;
@@ -27,6 +24,7 @@ namespace Bloom::Widgets
 
     TargetRegisterInspectorWindow::TargetRegisterInspectorWindow(
         const Targets::TargetRegisterDescriptor& registerDescriptor,
+        std::uint32_t historyCapacity,
         TargetState currentTargetState,
         QWidget* parent
     )
@@ -39,33 +37,22 @@ namespace Bloom::Widgets
         this->setObjectName("target-register-inspector-window");
         this->setWindowTitle("Inspect Register");
 
-        auto windowUiFile = QFile(
-            QString::fromStdString(Services::PathService::compiledResourcesPath()
-                + "/src/Insight/UserInterfaces/InsightWindow/Widgets/TargetRegisterInspector/UiFiles/"
-                  "TargetRegisterInspectorWindow.ui"
-            )
-        );
-
-        auto windowStylesheet = QFile(
+        this->setStyleSheet(UiLoader::loadStylesheet(
             QString::fromStdString(Services::PathService::compiledResourcesPath()
                 + "/src/Insight/UserInterfaces/InsightWindow/Widgets/TargetRegisterInspector/Stylesheets/"
                   "TargetRegisterInspectorWindow.qss"
             )
-        );
-
-        if (!windowUiFile.open(QFile::ReadOnly)) {
-            throw Exception("Failed to open TargetRegisterInspectorWindow UI file");
-        }
-
-        if (!windowStylesheet.open(QFile::ReadOnly)) {
-            throw Exception("Failed to open TargetRegisterInspectorWindow stylesheet file");
-        }
-
-        this->setStyleSheet(windowStylesheet.readAll());
+        ));
         this->setFixedSize(1120, 610);
 
         auto uiLoader = UiLoader(this);
-        this->container = uiLoader.load(&windowUiFile, this);
+        this->container = uiLoader.load(
+            QString::fromStdString(Services::PathService::compiledResourcesPath()
+                + "/src/Insight/UserInterfaces/InsightWindow/Widgets/TargetRegisterInspector/UiFiles/"
+                  "TargetRegisterInspectorWindow.ui"
+            ),
+            this
+        );
 
         this->container->setMinimumSize(this->size());
         this->container->setContentsMargins(QMargins(0, 0, 0, 0));
@@ -89,6 +76,7 @@ namespace Bloom::Widgets
         this->registerHistoryWidget = new RegisterHistoryWidget(
             this->registerDescriptor,
             this->registerValue,
+            historyCapacity,
             this->container
         );
 
@@ -26,6 +26,7 @@ namespace Bloom::Widgets
     public:
         TargetRegisterInspectorWindow(
             const Targets::TargetRegisterDescriptor& registerDescriptor,
+            std::uint32_t historyCapacity,
             Targets::TargetState currentTargetState,
             QWidget* parent = nullptr
         );
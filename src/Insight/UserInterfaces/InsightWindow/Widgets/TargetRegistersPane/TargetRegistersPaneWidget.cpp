@@ -26,11 +26,13 @@ namespace Bloom::Widgets
 
     TargetRegistersPaneWidget::TargetRegistersPaneWidget(
         const TargetDescriptor& targetDescriptor,
+        std::uint32_t registerHistoryCapacity,
         PaneState& paneState,
         PanelWidget* parent
     )
         : PaneWidget(paneState, parent)
         , targetDescriptor(targetDescriptor)
+        , registerHistoryCapacity(registerHistoryCapacity)
     {
         this->setObjectName("target-registers-side-pane");
 
@@ -202,11 +204,12 @@ namespace Bloom::Widgets
             &TargetRegistersPaneWidget::onTargetStateChanged
         );
 
-        QObject::connect(
-            insightSignals,
-            &InsightSignals::targetRegistersWritten,
+        insightSignals->subscribeToRegisterWrites(
             this,
-            &TargetRegistersPaneWidget::onRegistersRead
+            this->registerDescriptors,
+            [this] (const Targets::TargetRegisters& targetRegisters, const QDateTime&) {
+                this->onRegistersRead(targetRegisters);
+            }
         );
 
         // Restore the state
@@ -240,6 +243,7 @@ namespace Bloom::Widgets
         }
 
         this->registerListScene->refreshGeometry();
+        this->refreshStaleRegisterValues();
     }
 
     void TargetRegistersPaneWidget::collapseAllRegisterGroups() {
@@ -256,22 +260,82 @@ namespace Bloom::Widgets
         }
 
         this->registerListScene->refreshGeometry();
+        this->refreshStaleRegisterValues();
     }
 
     void TargetRegistersPaneWidget::refreshRegisterValues(
         std::optional<Targets::TargetRegisterDescriptor> registerDescriptor,
         std::optional<std::function<void(void)>> callback
     ) {
-        if (!registerDescriptor.has_value() && this->registerDescriptors.empty()) {
+        if (registerDescriptor.has_value()) {
+            this->queueReadRegistersTask({*registerDescriptor}, std::move(callback));
+            return;
+        }
+
+        /*
+         * We only read the registers that the user can see. The rest are marked as stale, to be read when their
+         * group is expanded.
+         *
+         * There's no need to coalesce the registers into address ranges here - the debug tool driver already merges
+         * nearby registers into as few reads as possible (see EdbgAvr8Interface::readRegisters()).
+         */
+        auto descriptors = TargetRegisterDescriptors();
+        this->staleRegisterDescriptors.clear();
+
+        for (const auto& registerGroupItem : this->registerGroupItems) {
+            auto& groupDescriptors = registerGroupItem->isExpanded()
+                ? descriptors
+                : this->staleRegisterDescriptors;
+
+            for (const auto& registerItem : registerGroupItem->registerItems) {
+                groupDescriptors.insert(registerItem->registerDescriptor);
+            }
+        }
+
+        if (descriptors.empty()) {
+            if (callback.has_value()) {
+                callback.value()();
+            }
+
+            return;
+        }
+
+        this->queueReadRegistersTask(descriptors, std::move(callback));
+    }
+
+    void TargetRegistersPaneWidget::refreshStaleRegisterValues() {
+        if (this->targetState != Targets::TargetState::STOPPED || this->staleRegisterDescriptors.empty()) {
             return;
         }
 
+        auto descriptors = TargetRegisterDescriptors();
+
+        for (const auto& registerGroupItem : this->registerGroupItems) {
+            if (!registerGroupItem->isExpanded()) {
+                continue;
+            }
+
+            for (const auto& registerItem : registerGroupItem->registerItems) {
+                const auto& descriptorIt = this->staleRegisterDescriptors.find(registerItem->registerDescriptor);
+
+                if (descriptorIt != this->staleRegisterDescriptors.end()) {
+                    descriptors.insert(*descriptorIt);
+                    this->staleRegisterDescriptors.erase(descriptorIt);
+                }
+            }
+        }
+
+        if (!descriptors.empty()) {
+            this->queueReadRegistersTask(descriptors);
+        }
+    }
+
+    void TargetRegistersPaneWidget::queueReadRegistersTask(
+        const TargetRegisterDescriptors& descriptors,
+        std::optional<std::function<void(void)>> callback
+    ) {
         const auto readRegisterTask = QSharedPointer<ReadTargetRegisters>(
-            new ReadTargetRegisters(
-                registerDescriptor.has_value()
-                    ? Targets::TargetRegisterDescriptors({*registerDescriptor})
-                    : this->registerDescriptors
-            ),
+            new ReadTargetRegisters(descriptors),
             &QObject::deleteLater
         );
 
@@ -315,6 +379,7 @@ namespace Bloom::Widgets
         if (registerGroupItem != nullptr) {
             registerGroupItem->setExpanded(!registerGroupItem->isExpanded());
             this->registerListScene->refreshGeometry();
+            this->refreshStaleRegisterValues();
         }
 
         auto* registerItem = dynamic_cast<RegisterItem*>(clickedItem);
@@ -372,6 +437,7 @@ namespace Bloom::Widgets
 
         if (this->targetState == Targets::TargetState::RUNNING) {
             this->clearInlineRegisterValues();
+            this->staleRegisterDescriptors = this->registerDescriptors;
         }
     }
 
@@ -391,6 +457,7 @@ namespace Bloom::Widgets
             }
 
             this->currentRegisterValues[descriptor] = targetRegister.value;
+            this->staleRegisterDescriptors.erase(descriptor);
         }
 
         this->registerListScene->update();
@@ -420,6 +487,7 @@ namespace Bloom::Widgets
         } else {
             inspectionWindow = new TargetRegisterInspectorWindow(
                 registerDescriptor,
+                this->registerHistoryCapacity,
                 this->targetState,
                 this
             );
@@ -31,6 +31,7 @@ namespace Bloom::Widgets
     public:
         TargetRegistersPaneWidget(
             const Targets::TargetDescriptor& targetDescriptor,
+            std::uint32_t registerHistoryCapacity,
             PaneState& paneState,
             PanelWidget *parent
         );
@@ -39,6 +40,16 @@ namespace Bloom::Widgets
         void collapseAllRegisterGroups();
         void expandAllRegisterGroups();
 
+        /**
+         * Refreshes the values of the registers in the expanded register groups, or the value of a single register,
+         * if a descriptor is provided.
+         *
+         * The registers in collapsed groups are not read - they're marked as stale and read upon expansion of their
+         * group (see refreshStaleRegisterValues()).
+         *
+         * @param registerDescriptor
+         * @param callback
+         */
         void refreshRegisterValues(
             std::optional<Targets::TargetRegisterDescriptor> registerDescriptor = std::nullopt,
             std::optional<std::function<void(void)>> callback = std::nullopt
@@ -49,6 +60,7 @@ namespace Bloom::Widgets
 
     private:
         const Targets::TargetDescriptor& targetDescriptor;
+        std::uint32_t registerHistoryCapacity;
 
         QWidget* container = nullptr;
 
@@ -66,6 +78,11 @@ namespace Bloom::Widgets
         std::unordered_map<Targets::TargetRegisterDescriptor, TargetRegisterInspectorWindow*> inspectionWindowsByDescriptor;
         std::unordered_map<Targets::TargetRegisterDescriptor, Targets::TargetMemoryBuffer> currentRegisterValues;
 
+        /**
+         * Registers that were not read upon the last refresh, as their groups were collapsed at the time.
+         */
+        Targets::TargetRegisterDescriptors staleRegisterDescriptors;
+
         Targets::TargetState targetState = Targets::TargetState::UNKNOWN;
 
         // Context-menu actions
@@ -82,6 +99,15 @@ namespace Bloom::Widgets
         void onItemContextMenu(ListItem* item, QPoint sourcePosition);
         void onTargetStateChanged(Targets::TargetState newState);
         void onRegistersRead(const Targets::TargetRegisters& registers);
+
+        /**
+         * Reads the stale registers in the expanded register groups. Should be called after expanding any groups.
+         */
+        void refreshStaleRegisterValues();
+        void queueReadRegistersTask(
+            const Targets::TargetRegisterDescriptors& descriptors,
+            std::optional<std::function<void(void)>> callback = std::nullopt
+        );
         void clearInlineRegisterValues();
         void openInspectionWindow(const Targets::TargetRegisterDescriptor& registerDescriptor);
         void copyRegisterName(const Targets::TargetRegisterDescriptor& registerDescriptor);
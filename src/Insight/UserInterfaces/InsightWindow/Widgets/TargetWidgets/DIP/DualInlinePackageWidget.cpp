@@ -102,12 +102,72 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
         );
     }
 
-    void DualInlinePackageWidget::paintEvent(QPaintEvent* event) {
-        auto painter = QPainter(this);
-        this->drawWidget(painter);
+    QRect DualInlinePackageWidget::getPinArea(const TargetPinWidget* pinWidget) const {
+        /*
+         * The pin's labels are drawn in line with the pin - above it for top pins and below it for bottom pins. The
+         * package body and the opposite side are excluded, so that they're not repainted with the pin.
+         */
+        const auto* dipPinWidget = static_cast<const PinWidget*>(pinWidget);
+        const auto pinGeometry = pinWidget->geometry();
+        const auto labelX = pinGeometry.x() + (PinWidget::MINIMUM_WIDTH / 2) - (PinWidget::MAXIMUM_LABEL_WIDTH / 2);
+
+        if (dipPinWidget->position == Position::TOP) {
+            return pinGeometry.united(QRect(labelX, 0, PinWidget::MAXIMUM_LABEL_WIDTH, pinGeometry.y()));
+        }
+
+        return pinGeometry.united(QRect(
+            labelX,
+            pinGeometry.y(),
+            PinWidget::MAXIMUM_LABEL_WIDTH,
+            this->height() - pinGeometry.y()
+        ));
+    }
+
+    void DualInlinePackageWidget::drawStaticLayer(QPainter& painter) {
+        static auto pinNumberFont = QFont("'Ubuntu', sans-serif");
+        pinNumberFont.setPixelSize(13);
+
+        static const auto lineColor = QColor(0x4F, 0x4F, 0x4F);
+        static const auto pinNumberFontColor = QColor(0xAF, 0xB1, 0xB3);
+
+        painter.setFont(pinNumberFont);
+
+        for (const auto* pinWidget : this->pinWidgets) {
+            const auto pinGeoPosition = pinWidget->pos();
+            const auto pinNameLabelLineLength = (pinWidget->getPinNumber() % 2 == 0
+                ? PinWidget::PIN_NAME_LABEL_LONG_LINE_LENGTH
+                : PinWidget::PIN_NAME_LABEL_SHORT_LINE_LENGTH
+            );
+
+            painter.setPen(pinNumberFontColor);
+            painter.drawText(
+                pinWidget->pinNumberLabelRect.translated(pinGeoPosition),
+                Qt::AlignCenter,
+                pinWidget->pinNumberLabelText
+            );
+
+            painter.setPen(lineColor);
+
+            if (pinWidget->position == Position::TOP) {
+                painter.drawLine(QLine(
+                    pinGeoPosition.x() + (PinWidget::MINIMUM_WIDTH / 2),
+                    pinGeoPosition.y() - pinNameLabelLineLength,
+                    pinGeoPosition.x() + (PinWidget::MINIMUM_WIDTH / 2),
+                    pinGeoPosition.y()
+                ));
+
+            } else {
+                painter.drawLine(QLine(
+                    pinGeoPosition.x() + (PinWidget::MINIMUM_WIDTH / 2),
+                    pinGeoPosition.y() + PinWidget::MAXIMUM_HEIGHT,
+                    pinGeoPosition.x() + (PinWidget::MINIMUM_WIDTH / 2),
+                    pinGeoPosition.y() + PinWidget::MAXIMUM_HEIGHT + pinNameLabelLineLength
+                ));
+            }
+        }
     }
 
-    void DualInlinePackageWidget::drawWidget(QPainter& painter) {
+    void DualInlinePackageWidget::drawDynamicLayer(QPainter& painter, const QRect& exposedRect) {
         using Targets::TargetPinState;
 
         static auto pinNameFont = QFont("'Ubuntu', sans-serif");
@@ -124,6 +184,10 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
         static const auto outDirectionText = QString("OUT");
 
         for (const auto* pinWidget : this->pinWidgets) {
+            if (!exposedRect.intersects(this->getPinArea(pinWidget))) {
+                continue;
+            }
+
             const auto pinGeoPosition = pinWidget->pos();
             const auto& pinState = pinWidget->getPinState();
             const auto pinStateChanged = pinWidget->hasPinStateChanged();
@@ -131,7 +195,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
             painter.setFont(pinNameFont);
 
             if (pinWidget->position == Position::TOP) {
-                painter.setPen(lineColor);
                 const auto pinNameLabelLineLength = (pinWidget->getPinNumber() % 2 == 0
                     ? PinWidget::PIN_NAME_LABEL_LONG_LINE_LENGTH
                     : PinWidget::PIN_NAME_LABEL_SHORT_LINE_LENGTH
@@ -141,13 +204,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
                     : PinWidget::PIN_DIRECTION_LABEL_LONG_LINE_LENGTH
                 );
 
-                painter.drawLine(QLine(
-                    pinGeoPosition.x() + (PinWidget::MINIMUM_WIDTH / 2),
-                    pinGeoPosition.y() - pinNameLabelLineLength,
-                    pinGeoPosition.x() + (PinWidget::MINIMUM_WIDTH / 2),
-                    pinGeoPosition.y()
-                ));
-
                 painter.setPen(pinStateChanged ? pinChangedFontColor : pinNameFontColor);
                 painter.drawText(
                     QRect(
@@ -189,7 +245,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
                 }
 
             } else if (pinWidget->position == Position::BOTTOM) {
-                painter.setPen(lineColor);
                 const auto pinNameLabelLineLength = (pinWidget->getPinNumber() % 2 == 0
                     ? PinWidget::PIN_NAME_LABEL_LONG_LINE_LENGTH
                     : PinWidget::PIN_NAME_LABEL_SHORT_LINE_LENGTH
@@ -199,13 +254,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
                     : PinWidget::PIN_DIRECTION_LABEL_LONG_LINE_LENGTH
                 );
 
-                painter.drawLine(QLine(
-                    pinGeoPosition.x() + (PinWidget::MINIMUM_WIDTH / 2),
-                    pinGeoPosition.y() + PinWidget::MAXIMUM_HEIGHT,
-                    pinGeoPosition.x() + (PinWidget::MINIMUM_WIDTH / 2),
-                    pinGeoPosition.y() + PinWidget::MAXIMUM_HEIGHT + pinNameLabelLineLength
-                ));
-
                 painter.setPen(pinStateChanged ? pinChangedFontColor : pinNameFontColor);
                 painter.drawText(
                     QRect(
@@ -29,8 +29,9 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
         );
 
     protected:
-        void paintEvent(QPaintEvent* event) override;
-        void drawWidget(QPainter& painter);
+        QRect getPinArea(const TargetPinWidget* pinWidget) const override;
+        void drawStaticLayer(QPainter& painter) override;
+        void drawDynamicLayer(QPainter& painter, const QRect& exposedRect) override;
 
     private:
         QVBoxLayout* layout = nullptr;
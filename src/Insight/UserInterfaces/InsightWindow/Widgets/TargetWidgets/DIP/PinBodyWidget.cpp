@@ -21,9 +21,8 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
             QPainter::RenderHint::Antialiasing | QPainter::RenderHint::SmoothPixmapTransform,
             true
         );
-        auto pinWidth = PinBodyWidget::WIDTH;
-        auto pinHeight = PinBodyWidget::HEIGHT;
-        this->setFixedSize(pinWidth, pinHeight);
+        const auto pinWidth = PinBodyWidget::WIDTH;
+        const auto pinHeight = PinBodyWidget::HEIGHT;
 
         auto pinColor = this->getBodyColor();
 
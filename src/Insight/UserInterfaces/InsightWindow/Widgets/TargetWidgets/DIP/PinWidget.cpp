@@ -29,19 +29,25 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
         this->pinNameLabelText = QString::fromStdString(pinDescriptor.name).toUpper();
         this->pinNameLabelText.truncate(5);
 
-        this->pinNumberLabel = new Label(this);
-        this->pinNumberLabel->setObjectName("target-pin-number");
-        this->pinNumberLabel->setText(QString::number(pinDescriptor.number));
-        this->pinNumberLabel->setAlignment(Qt::AlignmentFlag::AlignCenter);
+        this->pinNumberLabelText = QString::number(pinDescriptor.number);
 
         if (isTopWidget) {
             this->layout->setDirection(QBoxLayout::Direction::BottomToTop);
         }
 
+        /*
+         * The pin number label is drawn by the package widget, as part of its static layer, so we just reserve the
+         * space for it here.
+         */
         this->layout->addWidget(this->bodyWidget, 0, Qt::AlignmentFlag::AlignHCenter);
-        this->layout->insertSpacing(1, PinWidget::PIN_LABEL_SPACING);
-        this->layout->addWidget(this->pinNumberLabel, 0, Qt::AlignmentFlag::AlignHCenter);
-        this->pinNumberLabel->setFixedHeight(PinWidget::LABEL_HEIGHT);
+        this->layout->addSpacing(PinWidget::PIN_LABEL_SPACING + PinWidget::LABEL_HEIGHT);
+
+        this->pinNumberLabelRect = QRect(
+            0,
+            isTopWidget ? 0 : PinBodyWidget::HEIGHT + PinWidget::PIN_LABEL_SPACING,
+            PinWidget::MINIMUM_WIDTH,
+            PinWidget::LABEL_HEIGHT
+        );
 
         this->setLayout(this->layout);
 
@@ -4,8 +4,8 @@
 #include <cstdint>
 #include <QVBoxLayout>
 #include <QPainter>
+#include <QRect>
 
-#include "src/Insight/UserInterfaces/InsightWindow/Widgets/Label.hpp"
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetWidgets/TargetPinWidget.hpp"
 
 #include "PinBodyWidget.hpp"
@@ -39,6 +39,12 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
 
         Position position = Position::TOP;
         QString pinNameLabelText;
+        QString pinNumberLabelText;
+
+        /**
+         * The area occupied by the pin number label, relative to this widget.
+         */
+        QRect pinNumberLabelRect;
 
         PinWidget(
             const Targets::TargetPinDescriptor& pinDescriptor,
@@ -56,7 +62,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Dip
 
     private:
         QVBoxLayout* layout = nullptr;
-        Label* pinNumberLabel = nullptr;
         PinBodyWidget* bodyWidget = nullptr;
     };
 }
@@ -27,9 +27,8 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
             QPainter::RenderHint::Antialiasing | QPainter::RenderHint::SmoothPixmapTransform,
             true
         );
-        auto pinWidth = this->isVertical ? PinBodyWidget::WIDTH : PinBodyWidget::HEIGHT;
-        auto pinHeight = this->isVertical ? PinBodyWidget::HEIGHT : PinBodyWidget::WIDTH;
-        this->setFixedSize(pinWidth, pinHeight);
+        const auto pinWidth = this->isVertical ? PinBodyWidget::WIDTH : PinBodyWidget::HEIGHT;
+        const auto pinHeight = this->isVertical ? PinBodyWidget::HEIGHT : PinBodyWidget::WIDTH;
 
         auto pinColor = this->getBodyColor();
 
@@ -44,12 +44,7 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
         this->pinNameLabelText = QString::fromStdString(pinDescriptor.name).toUpper();
         this->pinNameLabelText.truncate(5);
 
-        this->pinNumberLabel = new Label(this);
-        this->pinNumberLabel->setObjectName("target-pin-number");
-        auto pinNumberText = QString::number(pinDescriptor.number);
-        pinNumberText.truncate(5);
-        this->pinNumberLabel->setText(QString::number(pinDescriptor.number));
-        this->pinNumberLabel->setAlignment(Qt::AlignmentFlag::AlignCenter);
+        this->pinNumberLabelText = QString::number(pinDescriptor.number);
 
         if (this->position == Position::LEFT) {
             this->layout->setAlignment((Qt::AlignmentFlag::AlignVCenter | Qt::AlignmentFlag::AlignRight));
@@ -72,18 +67,32 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
             this->setFixedSize(PinWidget::MAXIMUM_VERTICAL_WIDTH, PinWidget::MAXIMUM_VERTICAL_HEIGHT);
         }
 
+        /*
+         * The pin number label is drawn by the package widget, as part of its static layer, so we just reserve the
+         * space for it here.
+         */
         this->layout->addWidget(this->bodyWidget);
         this->layout->addSpacing(3);
-        this->layout->addWidget(this->pinNumberLabel);
 
         if (this->position == Position::LEFT || this->position == Position::RIGHT) {
-            this->pinNumberLabel->setFixedSize(
+            this->layout->addSpacing(PinWidget::MAXIMUM_PIN_NUMBER_LABEL_WIDTH);
+            this->pinNumberLabelRect = QRect(
+                this->position == Position::LEFT ? 0 : PinBodyWidget::HEIGHT + 3,
+                0,
                 PinWidget::MAXIMUM_PIN_NUMBER_LABEL_WIDTH,
                 PinWidget::MAXIMUM_HORIZONTAL_HEIGHT
             );
 
         } else if (this->position == Position::TOP || this->position == Position::BOTTOM) {
-            this->pinNumberLabel->setFixedSize(PinBodyWidget::WIDTH, PinWidget::LABEL_HEIGHT - 2);
+            this->layout->addSpacing(PinWidget::LABEL_HEIGHT - 2);
+            this->pinNumberLabelRect = QRect(
+                0,
+                this->position == Position::BOTTOM
+                    ? PinBodyWidget::HEIGHT + 3
+                    : PinWidget::MAXIMUM_VERTICAL_HEIGHT - PinBodyWidget::HEIGHT - 3 - (PinWidget::LABEL_HEIGHT - 2),
+                PinBodyWidget::WIDTH,
+                PinWidget::LABEL_HEIGHT - 2
+            );
         }
 
         this->layout->addStretch(1);
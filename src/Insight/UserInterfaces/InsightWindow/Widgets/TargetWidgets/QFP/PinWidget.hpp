@@ -3,8 +3,8 @@
 #include <QWidget>
 #include <cstdint>
 #include <QBoxLayout>
+#include <QRect>
 
-#include "src/Insight/UserInterfaces/InsightWindow/Widgets/Label.hpp"
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetWidgets/TargetPinWidget.hpp"
 
 #include "PinBodyWidget.hpp"
@@ -44,6 +44,12 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
 
         Position position;
         QString pinNameLabelText;
+        QString pinNumberLabelText;
+
+        /**
+         * The area occupied by the pin number label, relative to this widget.
+         */
+        QRect pinNumberLabelRect;
 
         PinWidget(
             const Targets::TargetPinDescriptor& pinDescriptor,
@@ -55,9 +61,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
 
     private:
         QBoxLayout* layout = nullptr;
-        Label* pinNumberLabel = nullptr;
-        Label* pinNameLabel = nullptr;
-        Label* pinDirectionLabel = nullptr;
         PinBodyWidget* bodyWidget = nullptr;
     };
 }
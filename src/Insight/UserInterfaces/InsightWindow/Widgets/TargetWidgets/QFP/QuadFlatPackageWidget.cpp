@@ -184,12 +184,110 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
         );
     }
 
-    void QuadFlatPackageWidget::paintEvent(QPaintEvent* event) {
-        auto painter = QPainter(this);
-        this->drawWidget(painter);
+    QRect QuadFlatPackageWidget::getPinArea(const TargetPinWidget* pinWidget) const {
+        // All of our pin widgets are QFP pin widgets (see the constructor)
+        const auto* qfpPinWidget = static_cast<const PinWidget*>(pinWidget);
+        const auto pinGeometry = pinWidget->geometry();
+
+        /*
+         * The pin's labels are drawn in line with the pin, on the outside of the package body. We exclude the body
+         * and the opposite side of the package from the area, so that they're not repainted with the pin.
+         */
+        const auto labelY = pinGeometry.y() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2)
+            - (PinWidget::MAXIMUM_LABEL_HEIGHT / 2);
+        const auto labelX = pinGeometry.x() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2)
+            - (PinWidget::MAXIMUM_LABEL_WIDTH / 2);
+
+        if (qfpPinWidget->position == Position::LEFT) {
+            return pinGeometry.united(QRect(0, labelY, pinGeometry.x(), PinWidget::MAXIMUM_LABEL_HEIGHT));
+        }
+
+        if (qfpPinWidget->position == Position::RIGHT) {
+            return pinGeometry.united(QRect(
+                pinGeometry.x(),
+                labelY,
+                this->width() - pinGeometry.x(),
+                PinWidget::MAXIMUM_LABEL_HEIGHT
+            ));
+        }
+
+        if (qfpPinWidget->position == Position::TOP) {
+            return pinGeometry.united(QRect(labelX, 0, PinWidget::MAXIMUM_LABEL_WIDTH, pinGeometry.y()));
+        }
+
+        return pinGeometry.united(QRect(
+            labelX,
+            pinGeometry.y(),
+            PinWidget::MAXIMUM_LABEL_WIDTH,
+            this->height() - pinGeometry.y()
+        ));
+    }
+
+    void QuadFlatPackageWidget::drawStaticLayer(QPainter& painter) {
+        static auto pinNumberFont = QFont("'Ubuntu', sans-serif");
+        pinNumberFont.setPixelSize(13);
+
+        static const auto lineColor = QColor(0x4F, 0x4F, 0x4F);
+        static const auto pinNumberFontColor = QColor(0xAF, 0xB1, 0xB3);
+
+        painter.setFont(pinNumberFont);
+
+        for (const auto* pinWidget : this->pinWidgets) {
+            const auto pinGeoPosition = pinWidget->pos();
+
+            painter.setPen(pinNumberFontColor);
+            painter.drawText(
+                pinWidget->pinNumberLabelRect.translated(pinGeoPosition),
+                Qt::AlignCenter,
+                pinWidget->pinNumberLabelText
+            );
+
+            painter.setPen(lineColor);
+
+            if (pinWidget->position == Position::LEFT) {
+                painter.drawLine(QLine(
+                    pinGeoPosition.x() - PinWidget::PIN_NAME_LABEL_LONG_LINE_LENGTH,
+                    pinGeoPosition.y() + (PinWidget::MAXIMUM_HORIZONTAL_HEIGHT / 2),
+                    pinGeoPosition.x(),
+                    pinGeoPosition.y() + (PinWidget::MAXIMUM_HORIZONTAL_HEIGHT / 2)
+                ));
+
+            } else if (pinWidget->position == Position::RIGHT) {
+                painter.drawLine(QLine(
+                    pinGeoPosition.x() + PinWidget::MAXIMUM_HORIZONTAL_WIDTH,
+                    pinGeoPosition.y() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2),
+                    pinGeoPosition.x() + PinWidget::MAXIMUM_HORIZONTAL_WIDTH
+                        + PinWidget::PIN_NAME_LABEL_LONG_LINE_LENGTH,
+                    pinGeoPosition.y() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2)
+                ));
+
+            } else {
+                const auto pinNameLabelLineLength = (pinWidget->getPinNumber() % 2 == 0
+                    ? PinWidget::PIN_NAME_LABEL_LONG_LINE_LENGTH
+                    : PinWidget::PIN_NAME_LABEL_SHORT_LINE_LENGTH
+                );
+
+                if (pinWidget->position == Position::TOP) {
+                    painter.drawLine(QLine(
+                        pinGeoPosition.x() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2),
+                        pinGeoPosition.y() - pinNameLabelLineLength,
+                        pinGeoPosition.x() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2),
+                        pinGeoPosition.y()
+                    ));
+
+                } else {
+                    painter.drawLine(QLine(
+                        pinGeoPosition.x() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2),
+                        pinGeoPosition.y() + PinWidget::MAXIMUM_VERTICAL_HEIGHT,
+                        pinGeoPosition.x() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2),
+                        pinGeoPosition.y() + PinWidget::MAXIMUM_VERTICAL_HEIGHT + pinNameLabelLineLength
+                    ));
+                }
+            }
+        }
     }
 
-    void QuadFlatPackageWidget::drawWidget(QPainter& painter) {
+    void QuadFlatPackageWidget::drawDynamicLayer(QPainter& painter, const QRect& exposedRect) {
         static auto pinNameFont = QFont("'Ubuntu', sans-serif");
         static auto pinDirectionFont = pinNameFont;
         pinNameFont.setPixelSize(11);
@@ -204,6 +302,10 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
         static const auto outDirectionText = QString("OUT");
 
         for (const auto* pinWidget : this->pinWidgets) {
+            if (!exposedRect.intersects(this->getPinArea(pinWidget))) {
+                continue;
+            }
+
             const auto pinGeoPosition = pinWidget->pos();
             const auto& pinState = pinWidget->getPinState();
             const auto pinStateChanged = pinWidget->hasPinStateChanged();
@@ -211,14 +313,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
             painter.setFont(pinNameFont);
 
             if (pinWidget->position == Position::LEFT) {
-                painter.setPen(lineColor);
-                painter.drawLine(QLine(
-                    pinGeoPosition.x() - PinWidget::PIN_NAME_LABEL_LONG_LINE_LENGTH,
-                    pinGeoPosition.y() + (PinWidget::MAXIMUM_HORIZONTAL_HEIGHT / 2),
-                    pinGeoPosition.x(),
-                    pinGeoPosition.y() + (PinWidget::MAXIMUM_HORIZONTAL_HEIGHT / 2)
-                ));
-
                 painter.setPen(pinStateChanged ? pinChangedFontColor : pinNameFontColor);
                 painter.drawText(
                     QRect(
@@ -253,15 +347,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
                 }
 
             } else if (pinWidget->position == Position::RIGHT) {
-                painter.setPen(lineColor);
-                painter.drawLine(QLine(
-                    pinGeoPosition.x() + PinWidget::MAXIMUM_HORIZONTAL_WIDTH,
-                    pinGeoPosition.y() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2),
-                    pinGeoPosition.x() + PinWidget::MAXIMUM_HORIZONTAL_WIDTH
-                        + PinWidget::PIN_NAME_LABEL_LONG_LINE_LENGTH,
-                    pinGeoPosition.y() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2)
-                ));
-
                 painter.setPen(pinStateChanged ? pinChangedFontColor : pinNameFontColor);
                 painter.drawText(
                     QRect(
@@ -296,7 +381,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
                 }
 
             } else if (pinWidget->position == Position::TOP) {
-                painter.setPen(lineColor);
                 const auto pinNameLabelLineLength = (pinWidget->getPinNumber() % 2 == 0
                     ? PinWidget::PIN_NAME_LABEL_LONG_LINE_LENGTH
                     : PinWidget::PIN_NAME_LABEL_SHORT_LINE_LENGTH
@@ -306,13 +390,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
                     : PinWidget::PIN_DIRECTION_LABEL_LONG_LINE_LENGTH
                 );
 
-                painter.drawLine(QLine(
-                    pinGeoPosition.x() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2),
-                    pinGeoPosition.y() - pinNameLabelLineLength,
-                    pinGeoPosition.x() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2),
-                    pinGeoPosition.y()
-                ));
-
                 painter.setPen(pinStateChanged ? pinChangedFontColor : pinNameFontColor);
                 painter.drawText(
                     QRect(
@@ -354,7 +431,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
                 }
 
             } else if (pinWidget->position == Position::BOTTOM) {
-                painter.setPen(lineColor);
                 const auto pinNameLabelLineLength = (pinWidget->getPinNumber() % 2 == 0
                     ? PinWidget::PIN_NAME_LABEL_LONG_LINE_LENGTH
                     : PinWidget::PIN_NAME_LABEL_SHORT_LINE_LENGTH
@@ -364,13 +440,6 @@ namespace Bloom::Widgets::InsightTargetWidgets::Qfp
                     : PinWidget::PIN_DIRECTION_LABEL_LONG_LINE_LENGTH
                 );
 
-                painter.drawLine(QLine(
-                    pinGeoPosition.x() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2),
-                    pinGeoPosition.y() + PinWidget::MAXIMUM_VERTICAL_HEIGHT,
-                    pinGeoPosition.x() + (PinWidget::MAXIMUM_VERTICAL_WIDTH / 2),
-                    pinGeoPosition.y() + PinWidget::MAXIMUM_VERTICAL_HEIGHT + pinNameLabelLineLength
-                ));
-
                 painter.setPen(pinStateChanged ? pinChangedFontColor : pinNameFontColor);
                 painter.drawText(
                     QRect(
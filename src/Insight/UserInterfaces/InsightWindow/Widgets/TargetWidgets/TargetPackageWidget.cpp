@@ -1,10 +1,12 @@
 #include "TargetPackageWidget.hpp"
 
 #include <QEvent>
+#include <QRegion>
 
 #include "src/Insight/InsightSignals.hpp"
 #include "src/Insight/InsightWorker/InsightWorker.hpp"
 #include "src/Insight/InsightWorker/Tasks/RefreshTargetPinStates.hpp"
+#include "src/Insight/InsightWorker/Tasks/SetTargetPinStateStreaming.hpp"
 
 namespace Bloom::Widgets::InsightTargetWidgets
 {
@@ -26,11 +28,19 @@ namespace Bloom::Widgets::InsightTargetWidgets
             &TargetPackageWidget::onTargetStateChanged
         );
 
+        insightSignals->subscribeToRegisterWrites(
+            this,
+            Targets::TargetRegisterType::PORT_REGISTER,
+            [this] (const Targets::TargetRegisters&, const QDateTime&) {
+                this->onPortRegistersWritten();
+            }
+        );
+
         QObject::connect(
             insightSignals,
-            &InsightSignals::targetRegistersWritten,
+            &InsightSignals::targetPinStatesChanged,
             this,
-            &TargetPackageWidget::onRegistersWritten
+            &TargetPackageWidget::onPinStatesChanged
         );
 
         QObject::connect(
@@ -75,6 +85,58 @@ namespace Bloom::Widgets::InsightTargetWidgets
         InsightWorker::queueTask(refreshTask);
     }
 
+    void TargetPackageWidget::showEvent(QShowEvent* event) {
+        InsightWorker::queueTask(QSharedPointer<SetTargetPinStateStreaming>(
+            new SetTargetPinStateStreaming(this->targetVariant.id),
+            &QObject::deleteLater
+        ));
+
+        QWidget::showEvent(event);
+    }
+
+    void TargetPackageWidget::hideEvent(QHideEvent* event) {
+        InsightWorker::queueTask(QSharedPointer<SetTargetPinStateStreaming>(
+            new SetTargetPinStateStreaming(std::nullopt),
+            &QObject::deleteLater
+        ));
+
+        QWidget::hideEvent(event);
+    }
+
+    void TargetPackageWidget::paintEvent(QPaintEvent* event) {
+        const auto devicePixelRatio = this->devicePixelRatioF();
+
+        if (this->staticLayer.isNull() || this->staticLayer.devicePixelRatio() != devicePixelRatio) {
+            this->staticLayer = QPixmap(this->size() * devicePixelRatio);
+            this->staticLayer.setDevicePixelRatio(devicePixelRatio);
+            this->staticLayer.fill(Qt::GlobalColor::transparent);
+
+            auto staticLayerPainter = QPainter(&this->staticLayer);
+            this->drawStaticLayer(staticLayerPainter);
+        }
+
+        const auto exposedRect = event->rect();
+
+        auto painter = QPainter(this);
+        painter.drawPixmap(
+            exposedRect,
+            this->staticLayer,
+            QRectF(
+                exposedRect.x() * devicePixelRatio,
+                exposedRect.y() * devicePixelRatio,
+                exposedRect.width() * devicePixelRatio,
+                exposedRect.height() * devicePixelRatio
+            )
+        );
+
+        this->drawDynamicLayer(painter, exposedRect);
+    }
+
+    void TargetPackageWidget::resizeEvent(QResizeEvent* event) {
+        this->staticLayer = QPixmap();
+        QWidget::resizeEvent(event);
+    }
+
     void TargetPackageWidget::updatePinStates(const Targets::TargetPinStateMapping& pinStatesByNumber) {
         for (auto& pinWidget : this->pinWidgets) {
             const auto pinStateIt = pinStatesByNumber.find(pinWidget->getPinNumber());
@@ -87,6 +149,31 @@ namespace Bloom::Widgets::InsightTargetWidgets
         this->update();
     }
 
+    void TargetPackageWidget::onPinStatesChanged(
+        int variantId,
+        const Targets::TargetPinStateMapping& pinStatesByNumber
+    ) {
+        if (variantId != this->targetVariant.id || this->targetState != TargetState::STOPPED) {
+            return;
+        }
+
+        // Only the pins that have changed are repainted
+        auto dirtyRegion = QRegion();
+
+        for (auto& pinWidget : this->pinWidgets) {
+            const auto pinStateIt = pinStatesByNumber.find(pinWidget->getPinNumber());
+
+            if (pinStateIt != pinStatesByNumber.end()) {
+                pinWidget->updatePinState(pinStateIt->second);
+                dirtyRegion += this->getPinArea(pinWidget);
+            }
+        }
+
+        if (!dirtyRegion.isEmpty()) {
+            this->update(dirtyRegion);
+        }
+    }
+
     void TargetPackageWidget::onTargetStateChanged(TargetState newState) {
         if (this->targetState == newState) {
             return;
@@ -107,17 +194,9 @@ namespace Bloom::Widgets::InsightTargetWidgets
         }
     }
 
-    void TargetPackageWidget::onRegistersWritten(Targets::TargetRegisters targetRegisters) {
-        if (this->targetState != TargetState::STOPPED) {
-            return;
-        }
-
-        // If a PORT register was just updated, refresh pin states.
-        for (const auto& targetRegister : targetRegisters) {
-            if (targetRegister.descriptor.type == Targets::TargetRegisterType::PORT_REGISTER) {
-                this->refreshPinStates();
-                return;
-            }
+    void TargetPackageWidget::onPortRegistersWritten() {
+        if (this->targetState == TargetState::STOPPED) {
+            this->refreshPinStates();
         }
     }
 }
@@ -1,6 +1,13 @@
 #pragma once
 
 #include <QWidget>
+#include <QRect>
+#include <QPixmap>
+#include <QPainter>
+#include <QShowEvent>
+#include <QHideEvent>
+#include <QPaintEvent>
+#include <QResizeEvent>
 #include <utility>
 #include <vector>
 #include <map>
@@ -42,10 +49,64 @@ namespace Bloom::Widgets::InsightTargetWidgets
 
         Targets::TargetState targetState = Targets::TargetState::UNKNOWN;
 
+        /**
+         * Everything that doesn't depend on pin states (label lines, pin numbers, etc.) is rendered once, into this
+         * pixmap, and reused for every repaint. It's regenerated when the widget is resized or moved to a screen with
+         * a different device pixel ratio.
+         */
+        QPixmap staticLayer;
+
+        /**
+         * Draws the static layer of the package (see TargetPackageWidget::staticLayer).
+         *
+         * @param painter
+         *  Paints onto the static layer pixmap, in widget coordinates.
+         */
+        virtual void drawStaticLayer(QPainter& painter) = 0;
+
+        /**
+         * Draws the parts of the package that depend on pin states (pin name colours, IO direction labels, etc.),
+         * over the static layer. Invoked on every repaint.
+         *
+         * @param painter
+         *
+         * @param exposedRect
+         *  The area being repainted. Pins outside of this area (see TargetPackageWidget::getPinArea()) can be
+         *  skipped.
+         */
+        virtual void drawDynamicLayer(QPainter& painter, const QRect& exposedRect) = 0;
+
+        /**
+         * Returns the area of this widget that is occupied by the given pin widget, along with anything drawn for
+         * it (such as its labels). Only this area is repainted when the pin's state changes (see
+         * TargetPackageWidget::onPinStatesChanged()).
+         *
+         * The default implementation returns the entire widget.
+         *
+         * @param pinWidget
+         *
+         * @return
+         */
+        virtual QRect getPinArea(const TargetPinWidget* pinWidget) const {
+            return this->rect();
+        }
+
+        /**
+         * Pin states are streamed from the TargetController whilst the widget is visible.
+         *
+         * @param event
+         */
+        void showEvent(QShowEvent* event) override;
+        void hideEvent(QHideEvent* event) override;
+
+        void paintEvent(QPaintEvent* event) override;
+        void resizeEvent(QResizeEvent* event) override;
+
         virtual void updatePinStates(const Targets::TargetPinStateMapping& pinStatesByNumber);
+        void onPinStatesChanged(int variantId, const Targets::TargetPinStateMapping& pinStatesByNumber);
         void onTargetStateChanged(Targets::TargetState newState);
         void onProgrammingModeEnabled();
         void onProgrammingModeDisabled();
-        void onRegistersWritten(Targets::TargetRegisters targetRegisters);
+        void onPortRegistersWritten();
     };
 }
@@ -1,14 +1,78 @@
 #include "Logger.hpp"
 
 #include <iostream>
+#include <cstdlib>
+#include <filesystem>
+#include <csignal>
+#include <pthread.h>
+
+#include "src/Services/PathService.hpp"
 
 namespace Bloom
 {
     void Logger::configure(const ProjectConfig& projectConfig) {
         if (projectConfig.debugLoggingEnabled) {
+            if constexpr (!Logger::DEBUG_LOGGING_AVAILABLE) {
+                Logger::warning("Debug logging is not available in this build - 'debugLoggingEnabled' will be ignored");
+            }
+
             Logger::debugPrintingEnabled = true;
             Logger::debug("Debug log printing has been enabled");
         }
+
+        if (projectConfig.logFilePath.has_value()) {
+            auto logFilePath = std::filesystem::path(projectConfig.logFilePath.value());
+
+            if (logFilePath.is_relative()) {
+                logFilePath = std::filesystem::path(Services::PathService::projectDirPath()) / logFilePath;
+            }
+
+            auto logFileOpened = false;
+
+            {
+                const auto lock = std::unique_lock(Logger::printMutex);
+                Logger::logFile = std::ofstream(logFilePath, std::ios::out | std::ios::app);
+                logFileOpened = Logger::logFile->is_open();
+
+                if (!logFileOpened) {
+                    Logger::logFile = std::nullopt;
+                }
+            }
+
+            if (!logFileOpened) {
+                Logger::error("Failed to open log file " + logFilePath.string() + " - logs will only be printed");
+            }
+        }
+
+        if (Logger::sinkRunning.exchange(true)) {
+            return;
+        }
+
+        Logger::sinkThread = std::thread(&Logger::runSink);
+        Logger::asyncEnabled = true;
+
+        static auto exitHandlerRegistered = false;
+        if (!exitHandlerRegistered) {
+            std::atexit(&Logger::shutdown);
+            exitHandlerRegistered = true;
+        }
+    }
+
+    void Logger::shutdown() {
+        Logger::asyncEnabled = false;
+
+        if (!Logger::sinkRunning.exchange(false)) {
+            return;
+        }
+
+        Logger::sinkNotifier.notify();
+
+        if (Logger::sinkThread.joinable()) {
+            Logger::sinkThread.join();
+        }
+
+        // Entries from any threads that were in the process of queueing them whilst we were shutting down
+        Logger::writeQueuedEntries();
     }
 
     void Logger::silence() {
@@ -18,48 +82,141 @@ namespace Bloom
         Logger::warningPrintingEnabled = false;
     }
 
-    void Logger::log(const LogEntry& logEntry) {
+    void Logger::log(LogEntry&& logEntry) {
+        if (!Logger::asyncEnabled) {
+            auto consoleOutput = std::string();
+            auto fileOutput = std::string();
+
+            const auto lock = std::unique_lock(Logger::printMutex);
+            Logger::appendEntry(logEntry, consoleOutput, fileOutput);
+
+            std::cout << consoleOutput << std::flush;
+
+            if (Logger::logFile.has_value()) {
+                *(Logger::logFile) << fileOutput << std::flush;
+            }
+
+            return;
+        }
+
+        const auto queuedEntryCount = Logger::queuedEntryCount.fetch_add(1);
+
+        if (queuedEntryCount >= Logger::MAX_QUEUED_ENTRIES && logEntry.logLevel == LogLevel::DEBUG) {
+            Logger::queuedEntryCount.fetch_sub(1);
+            Logger::droppedEntryCount.fetch_add(1);
+            return;
+        }
+
+        Logger::queuedEntries.push(std::move(logEntry));
+
+        if (queuedEntryCount == 0) {
+            // The sink only needs waking upon the first entry of a batch
+            Logger::sinkNotifier.notify();
+        }
+    }
+
+    void Logger::runSink() {
+        ::pthread_setname_np(::pthread_self(), "LG");
+
+        /*
+         * The sink thread is started before the main thread blocks signals, so it would otherwise inherit an
+         * unblocked signal mask. The SignalHandler relies on all threads blocking signals (it reads them via
+         * signalfd) - any that were delivered to this thread would terminate the application without a graceful
+         * shutdown.
+         */
+        auto signalSet = sigset_t{};
+        ::sigfillset(&signalSet);
+        ::pthread_sigmask(SIG_SETMASK, &signalSet, nullptr);
+
+        while (Logger::sinkRunning) {
+            Logger::sinkNotifier.waitForNotification(Logger::SINK_INTERVAL);
+            Logger::writeQueuedEntries();
+        }
+
+        Logger::writeQueuedEntries();
+    }
+
+    void Logger::writeQueuedEntries() {
+        const auto lock = std::unique_lock(Logger::printMutex);
+
+        const auto entries = Logger::queuedEntries.takeAll();
+        const auto droppedEntryCount = Logger::droppedEntryCount.exchange(0);
+
+        if (entries.empty() && droppedEntryCount == 0) {
+            return;
+        }
+
+        Logger::queuedEntryCount.fetch_sub(entries.size());
+
+        auto consoleOutput = std::string();
+        auto fileOutput = std::string();
+
+        for (const auto& entry : entries) {
+            Logger::appendEntry(entry, consoleOutput, fileOutput);
+        }
+
+        if (droppedEntryCount > 0) {
+            Logger::appendEntry(
+                LogEntry(
+                    std::to_string(droppedEntryCount) + " debug log entries were dropped, as the log queue was full",
+                    LogLevel::WARNING
+                ),
+                consoleOutput,
+                fileOutput
+            );
+        }
+
+        std::cout << consoleOutput << std::flush;
+
+        if (Logger::logFile.has_value()) {
+            *(Logger::logFile) << fileOutput << std::flush;
+        }
+    }
+
+    void Logger::appendEntry(const LogEntry& logEntry, std::string& consoleOutput, std::string& fileOutput) {
         static auto timezoneAbbreviation = Services::DateTimeService::getTimeZoneAbbreviation(
             logEntry.timestamp
         ).toStdString();
 
-        const auto lock = std::unique_lock(Logger::printMutex);
-
-        // Print the timestamp and id in a green font color:
-        std::cout << "\033[32m";
-        std::cout << logEntry.timestamp.toString("yyyy-MM-dd hh:mm:ss ").toStdString()
-            + timezoneAbbreviation;
+        auto prefix = logEntry.timestamp.toString("yyyy-MM-dd hh:mm:ss ").toStdString() + timezoneAbbreviation;
 
         if (!logEntry.threadName.empty()) {
-            std::cout << " [" << logEntry.threadName << "]";
+            prefix += " [" + logEntry.threadName + "]";
         }
 
-        std::cout << " [" << logEntry.id << "]: ";
-        std::cout << "\033[0m";
+        prefix += " [" + std::to_string(logEntry.id) + "]: ";
+
+        auto levelLabel = std::string();
+        auto levelColour = std::string();
 
         switch (logEntry.logLevel) {
             case LogLevel::ERROR: {
                 // Errors in red
-                std::cout << "\033[31m";
-                std::cout << "[ERROR] ";
+                levelColour = "\033[31m";
+                levelLabel = "[ERROR] ";
                 break;
             }
             case LogLevel::WARNING: {
                 // Warnings in yellow
-                std::cout << "\033[33m";
-                std::cout << "[WARNING] ";
+                levelColour = "\033[33m";
+                levelLabel = "[WARNING] ";
                 break;
             }
             case LogLevel::INFO: {
-                std::cout << "[INFO] ";
+                levelLabel = "[INFO] ";
                 break;
             }
             case LogLevel::DEBUG: {
-                std::cout << "[DEBUG] ";
+                levelLabel = "[DEBUG] ";
                 break;
             }
         }
 
-        std::cout << logEntry.message << "\033[0m" << std::endl;
+        // Print the timestamp and id in a green font color
+        consoleOutput += "\033[32m" + prefix + "\033[0m" + levelColour + levelLabel + logEntry.message + "\033[0m\n";
+
+        if (Logger::logFile.has_value()) {
+            fileOutput += prefix + levelLabel + logEntry.message + "\n";
+        }
     }
 }
@@ -4,9 +4,16 @@
 #include <string>
 #include <mutex>
 #include <atomic>
+#include <thread>
+#include <fstream>
+#include <optional>
+#include <string_view>
+#include <type_traits>
 
 #include "src/ProjectConfig.hpp"
 #include "src/Services/DateTimeService.hpp"
+#include "src/Helpers/MpscQueue.hpp"
+#include "src/Helpers/ConditionVariableNotifier.hpp"
 
 namespace Bloom
 {
@@ -55,46 +62,184 @@ namespace Bloom
 
     /**
      * Super simple thread safe static Logger class for basic logging.
+     *
+     * Once configured (via Logger::configure()), the Logger is asynchronous: log entries are pushed onto a lock-free
+     * queue, and formatted and written (in batches) by a background sink thread. This keeps terminal (and file) I/O
+     * off the calling threads - which matters when debug logging is enabled, as the DebugServer and TargetController
+     * threads log every packet.
+     *
+     * Before Logger::configure() is called, and after Logger::shutdown(), entries are written synchronously.
+     *
+     * Each log function has a variadic overload, which takes the parts of the message (strings and/or numbers)
+     * separately, and only concatenates them if the log level is enabled. Hot paths should use these, to avoid
+     * constructing messages that will never be printed:
+     *
+     *   Logger::debug("Issuing ", CommandType::name, " command (ID: ", commandId, ")");
+     *
+     * When built with the EXCLUDE_DEBUG_LOGGING CMake option, all calls to Logger::debug() are compiled out.
      */
     class Logger
     {
     public:
+        /**
+         * Applies the project configuration and starts the sink thread.
+         *
+         * @param projectConfig
+         */
         static void configure(const ProjectConfig& projectConfig);
 
+        /**
+         * Stops the sink thread, once it has written all queued entries. This is registered as an exit handler, by
+         * Logger::configure().
+         */
+        static void shutdown();
+
         static void silence();
 
+#ifdef BLOOM_EXCLUDE_DEBUG_LOGGING
+        static constexpr bool DEBUG_LOGGING_AVAILABLE = false;
+#else
+        static constexpr bool DEBUG_LOGGING_AVAILABLE = true;
+#endif
+
         static void info(const std::string& message) {
             if (Logger::infoPrintingEnabled) {
                 Logger::log(LogEntry(message, LogLevel::INFO));
             }
         }
 
+        template <typename... PartTypes>
+        requires (sizeof...(PartTypes) > 1)
+        static void info(PartTypes&&... messageParts) {
+            if (Logger::infoPrintingEnabled) {
+                Logger::log(LogEntry(Logger::buildMessage(std::forward<PartTypes>(messageParts)...), LogLevel::INFO));
+            }
+        }
+
         static void warning(const std::string& message) {
             if (Logger::warningPrintingEnabled) {
                 Logger::log(LogEntry(message, LogLevel::WARNING));
             }
         }
 
+        template <typename... PartTypes>
+        requires (sizeof...(PartTypes) > 1)
+        static void warning(PartTypes&&... messageParts) {
+            if (Logger::warningPrintingEnabled) {
+                Logger::log(
+                    LogEntry(Logger::buildMessage(std::forward<PartTypes>(messageParts)...), LogLevel::WARNING)
+                );
+            }
+        }
+
         static void error(const std::string& message) {
             if (Logger::errorPrintingEnabled) {
                 Logger::log(LogEntry(message, LogLevel::ERROR));
             }
         }
 
+        template <typename... PartTypes>
+        requires (sizeof...(PartTypes) > 1)
+        static void error(PartTypes&&... messageParts) {
+            if (Logger::errorPrintingEnabled) {
+                Logger::log(
+                    LogEntry(Logger::buildMessage(std::forward<PartTypes>(messageParts)...), LogLevel::ERROR)
+                );
+            }
+        }
+
         static void debug(const std::string& message) {
-            if (Logger::debugPrintingEnabled) {
-                Logger::log(LogEntry(message, LogLevel::DEBUG));
+            if constexpr (Logger::DEBUG_LOGGING_AVAILABLE) {
+                if (Logger::debugPrintingEnabled) {
+                    Logger::log(LogEntry(message, LogLevel::DEBUG));
+                }
             }
         }
 
+        template <typename... PartTypes>
+        requires (sizeof...(PartTypes) > 1)
+        static void debug(PartTypes&&... messageParts) {
+            if constexpr (Logger::DEBUG_LOGGING_AVAILABLE) {
+                if (Logger::debugPrintingEnabled) {
+                    Logger::log(
+                        LogEntry(Logger::buildMessage(std::forward<PartTypes>(messageParts)...), LogLevel::DEBUG)
+                    );
+                }
+            }
+        }
+
+        /**
+         * Checks if debug logging is enabled. Useful for skipping work that is only done to produce debug logs.
+         *
+         * @return
+         */
+        static bool isDebugLoggingEnabled() {
+            return Logger::DEBUG_LOGGING_AVAILABLE && Logger::debugPrintingEnabled;
+        }
+
     private:
         static inline bool errorPrintingEnabled = true;
         static inline bool warningPrintingEnabled = true;
         static inline bool infoPrintingEnabled = true;
         static inline bool debugPrintingEnabled = false;
 
+        /**
+         * The maximum number of entries that can be queued for the sink thread. Once this limit is reached, debug
+         * entries are dropped (the number of dropped entries is reported in a subsequent warning). Entries of other
+         * levels are never dropped.
+         */
+        static constexpr std::size_t MAX_QUEUED_ENTRIES = 10000;
+
+        /**
+         * The sink thread writes any queued entries at least this often, even in the absence of a notification.
+         */
+        static constexpr auto SINK_INTERVAL = std::chrono::milliseconds(100);
+
+        /**
+         * Guards the console and file sinks.
+         */
         static inline std::mutex printMutex;
 
-        static void log(const LogEntry& logEntry);
+        static inline MpscQueue<LogEntry> queuedEntries;
+        static inline std::atomic<std::size_t> queuedEntryCount = 0;
+        static inline std::atomic<std::size_t> droppedEntryCount = 0;
+
+        static inline std::atomic<bool> asyncEnabled = false;
+        static inline std::atomic<bool> sinkRunning = false;
+        static inline ConditionVariableNotifier sinkNotifier;
+        static inline std::thread sinkThread;
+
+        static inline std::optional<std::ofstream> logFile;
+
+        static void log(LogEntry&& logEntry);
+
+        template <typename... PartTypes>
+        static std::string buildMessage(PartTypes&&... messageParts) {
+            auto message = std::string();
+            (Logger::appendMessagePart(message, std::forward<PartTypes>(messageParts)), ...);
+            return message;
+        }
+
+        static void appendMessagePart(std::string& message, std::string_view part) {
+            message += part;
+        }
+
+        template <typename PartType>
+        requires std::is_arithmetic_v<std::remove_cvref_t<PartType>>
+        static void appendMessagePart(std::string& message, PartType part) {
+            message += std::to_string(part);
+        }
+        static void runSink();
+        static void writeQueuedEntries();
+
+        /**
+         * Formats a log entry and appends it to the given output buffers. The file output is only populated when a
+         * log file is in use. Must be called with Logger::printMutex held.
+         *
+         * @param logEntry
+         * @param consoleOutput
+         * @param fileOutput
+         */
+        static void appendEntry(const LogEntry& logEntry, std::string& consoleOutput, std::string& fileOutput);
     };
 }
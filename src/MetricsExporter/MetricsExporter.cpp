@@ -0,0 +1,242 @@
+#include "MetricsExporter.hpp"
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <array>
+#include <cerrno>
+
+#include "src/Services/MetricsService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+#include "src/Exceptions/InvalidConfig.hpp"
+
+namespace Bloom
+{
+    using Exceptions::Exception;
+    using Exceptions::InvalidConfig;
+
+    MetricsExporter::MetricsExporter(const std::string& ipAddress, std::uint16_t portNumber)
+        : ipAddress(ipAddress)
+        , portNumber(portNumber)
+    {}
+
+    void MetricsExporter::run() {
+        try {
+            this->startup();
+
+            while (this->getThreadState() == ThreadState::READY) {
+                const auto eventFileDescriptor = this->epollInstance.waitForEvent();
+
+                if (
+                    !eventFileDescriptor.has_value()
+                    || eventFileDescriptor.value() == this->shutdownNotifier.getFileDescriptor()
+                ) {
+                    this->shutdownNotifier.clear();
+                    continue;
+                }
+
+                const auto clientSocketFileDescriptor = ::accept(
+                    this->serverSocketFileDescriptor.value(),
+                    nullptr,
+                    nullptr
+                );
+
+                if (clientSocketFileDescriptor < 0) {
+                    Logger::debug("MetricsExporter failed to accept connection - error number: ", errno);
+                    continue;
+                }
+
+                try {
+                    this->serveClient(clientSocketFileDescriptor);
+
+                } catch (const Exception& exception) {
+                    Logger::debug("MetricsExporter failed to serve client - " + exception.getMessage());
+                }
+
+                ::close(clientSocketFileDescriptor);
+            }
+
+        } catch (const std::exception& exception) {
+            /*
+             * The metrics exporter is only a diagnostic aid - its failure shouldn't take the rest of Bloom down with
+             * it, so we just report the error.
+             */
+            Logger::error("MetricsExporter fatal error: " + std::string(exception.what()));
+        }
+
+        this->shutdown();
+    }
+
+    void MetricsExporter::triggerShutdown() {
+        this->setThreadState(ThreadState::SHUTDOWN_INITIATED);
+        this->shutdownNotifier.notify();
+    }
+
+    void MetricsExporter::startup() {
+        this->setName("ME");
+        Logger::debug("Starting MetricsExporter");
+
+        auto socketAddress = ::sockaddr_in{};
+        socketAddress.sin_family = AF_INET;
+        socketAddress.sin_port = htons(this->portNumber);
+
+        if (::inet_pton(AF_INET, this->ipAddress.c_str(), &(socketAddress.sin_addr)) != 1) {
+            throw InvalidConfig("Invalid metrics IP address provided in config file: (\"" + this->ipAddress + "\")");
+        }
+
+        const auto socketFileDescriptor = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (socketFileDescriptor < 0) {
+            throw Exception("Failed to create socket file descriptor.");
+        }
+
+        this->serverSocketFileDescriptor = socketFileDescriptor;
+
+        const auto enableReuseAddressSocketOption = 1;
+
+        if (::setsockopt(
+                socketFileDescriptor,
+                SOL_SOCKET,
+                SO_REUSEADDR,
+                &(enableReuseAddressSocketOption),
+                sizeof(enableReuseAddressSocketOption)
+            ) < 0
+        ) {
+            Logger::error("Failed to set socket SO_REUSEADDR option.");
+        }
+
+        if (::bind(
+                socketFileDescriptor,
+                reinterpret_cast<const sockaddr*>(&socketAddress),
+                sizeof(socketAddress)
+            ) < 0
+        ) {
+            throw Exception("Failed to bind metrics address. The selected port number ("
+                + std::to_string(this->portNumber) + ") may be in use.");
+        }
+
+        if (::listen(socketFileDescriptor, 8) != 0) {
+            throw Exception("Failed to listen on metrics server socket");
+        }
+
+        this->epollInstance.addEntry(socketFileDescriptor, static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN));
+        this->epollInstance.addEntry(
+            this->shutdownNotifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN)
+        );
+
+        Logger::info(
+            "Serving runtime metrics at http://" + this->ipAddress + ":" + std::to_string(this->portNumber)
+                + "/metrics"
+        );
+
+        // It's possible that the MetricsExporter has been instructed to shutdown, before it could finish starting up.
+        if (this->getThreadState() != ThreadState::SHUTDOWN_INITIATED) {
+            this->setThreadState(ThreadState::READY);
+        }
+    }
+
+    void MetricsExporter::shutdown() {
+        Logger::debug("Shutting down MetricsExporter");
+
+        if (this->serverSocketFileDescriptor.has_value()) {
+            ::close(this->serverSocketFileDescriptor.value());
+            this->serverSocketFileDescriptor = std::nullopt;
+        }
+
+        this->setThreadState(ThreadState::STOPPED);
+    }
+
+    void MetricsExporter::serveClient(int clientSocketFileDescriptor) {
+        // A slow (or idle) client mustn't hold up the exporter, or its shutdown
+        const auto socketTimeout = ::timeval{.tv_sec = 1, .tv_usec = 0};
+        ::setsockopt(clientSocketFileDescriptor, SOL_SOCKET, SO_RCVTIMEO, &socketTimeout, sizeof(socketTimeout));
+        ::setsockopt(clientSocketFileDescriptor, SOL_SOCKET, SO_SNDTIMEO, &socketTimeout, sizeof(socketTimeout));
+
+        auto request = std::string();
+        auto buffer = std::array<char, 1024>();
+
+        while (request.find("\r\n\r\n") == std::string::npos) {
+            if (request.size() >= MetricsExporter::MAX_REQUEST_SIZE) {
+                this->writeResponse(
+                    clientSocketFileDescriptor,
+                    "431 Request Header Fields Too Large",
+                    "text/plain",
+                    ""
+                );
+                return;
+            }
+
+            const auto bytesRead = ::recv(clientSocketFileDescriptor, buffer.data(), buffer.size(), 0);
+            if (bytesRead <= 0) {
+                throw Exception("Failed to read request - error number: " + std::to_string(errno));
+            }
+
+            request.append(buffer.data(), static_cast<std::size_t>(bytesRead));
+        }
+
+        // Request line: <method> <target> <version>
+        const auto requestLine = request.substr(0, request.find("\r\n"));
+        const auto methodEndPos = requestLine.find(' ');
+        const auto targetEndPos = requestLine.find(' ', methodEndPos + 1);
+
+        if (methodEndPos == std::string::npos || targetEndPos == std::string::npos) {
+            this->writeResponse(clientSocketFileDescriptor, "400 Bad Request", "text/plain", "");
+            return;
+        }
+
+        const auto method = requestLine.substr(0, methodEndPos);
+        auto target = requestLine.substr(methodEndPos + 1, targetEndPos - methodEndPos - 1);
+        target = target.substr(0, target.find('?'));
+
+        if (method != "GET") {
+            this->writeResponse(clientSocketFileDescriptor, "405 Method Not Allowed", "text/plain", "");
+            return;
+        }
+
+        if (target != "/metrics") {
+            this->writeResponse(clientSocketFileDescriptor, "404 Not Found", "text/plain", "Not found\n");
+            return;
+        }
+
+        this->writeResponse(
+            clientSocketFileDescriptor,
+            "200 OK",
+            "application/openmetrics-text; version=1.0.0; charset=utf-8",
+            Services::MetricsService::generateOpenMetricsReport()
+        );
+    }
+
+    void MetricsExporter::writeResponse(
+        int clientSocketFileDescriptor,
+        const std::string& status,
+        const std::string& contentType,
+        const std::string& body
+    ) {
+        const auto response = "HTTP/1.1 " + status + "\r\n"
+            + "Content-Type: " + contentType + "\r\n"
+            + "Content-Length: " + std::to_string(body.size()) + "\r\n"
+            + "Connection: close\r\n"
+            + "\r\n"
+            + body;
+
+        auto bytesWritten = std::size_t(0);
+        while (bytesWritten < response.size()) {
+            const auto result = ::send(
+                clientSocketFileDescriptor,
+                response.data() + bytesWritten,
+                response.size() - bytesWritten,
+                MSG_NOSIGNAL
+            );
+
+            if (result <= 0) {
+                throw Exception("Failed to write response - error number: " + std::to_string(errno));
+            }
+
+            bytesWritten += static_cast<std::size_t>(result);
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+
+#include "src/Helpers/Thread.hpp"
+#include "src/Helpers/EpollInstance.hpp"
+#include "src/Helpers/EventFdNotifier.hpp"
+
+namespace Bloom
+{
+    /**
+     * The MetricsExporter serves Bloom's runtime performance counters (see Services::MetricsService) over HTTP, in
+     * the OpenMetrics format, for scraping by Prometheus (or any other OpenMetrics compatible collector). It runs on
+     * a dedicated thread, and only reads the metrics - it never interacts with the TargetController.
+     *
+     * The exporter is enabled via the 'metricsPort' project config parameter. The metrics are served at /metrics.
+     *
+     * Requests are served one at a time, and every connection is closed after its response has been sent. This is
+     * more than enough for a collector scraping at regular intervals.
+     */
+    class MetricsExporter: public Thread
+    {
+    public:
+        MetricsExporter(const std::string& ipAddress, std::uint16_t portNumber);
+
+        /**
+         * Entry point for the MetricsExporter thread.
+         */
+        void run();
+
+        /**
+         * Triggers the shutdown of the MetricsExporter thread. This can be called from any thread.
+         */
+        void triggerShutdown();
+
+    private:
+        /**
+         * Requests larger than this are rejected.
+         */
+        static constexpr std::size_t MAX_REQUEST_SIZE = 8192;
+
+        std::string ipAddress;
+        std::uint16_t portNumber = 0;
+
+        std::optional<int> serverSocketFileDescriptor;
+
+        /**
+         * We monitor the server socket and this->shutdownNotifier, so that we can be pulled out of a blocking wait
+         * for a connection, upon shutdown.
+         */
+        EpollInstance epollInstance = EpollInstance();
+        EventFdNotifier shutdownNotifier = EventFdNotifier();
+
+        void startup();
+        void shutdown();
+
+        /**
+         * Reads a single request from the client and responds to it.
+         *
+         * @param clientSocketFileDescriptor
+         */
+        void serveClient(int clientSocketFileDescriptor);
+
+        /**
+         * Writes an HTTP response to the client.
+         *
+         * @param clientSocketFileDescriptor
+         * @param status
+         *  The status code and reason phrase. E.g. "200 OK".
+         *
+         * @param contentType
+         * @param body
+         */
+        void writeResponse(
+            int clientSocketFileDescriptor,
+            const std::string& status,
+            const std::string& contentType,
+            const std::string& body
+        );
+    };
+}
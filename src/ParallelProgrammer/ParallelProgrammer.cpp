@@ -0,0 +1,179 @@
+#include "ParallelProgrammer.hpp"
+
+#include <future>
+#include <QJsonArray>
+#include <QString>
+
+#include "src/Services/TargetControllerService.hpp"
+#include "src/EventManager/EventManager.hpp"
+#include "src/EventManager/EventListener.hpp"
+#include "src/EventManager/Events/Events.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom
+{
+    using namespace Targets;
+    using TargetController::TargetControllerComponent;
+    using Exceptions::Exception;
+
+    using std::chrono::steady_clock;
+
+    ParallelProgrammer::ParallelProgrammer(
+        const ProjectConfig& projectConfig,
+        std::vector<EnvironmentConfig> environmentConfigs,
+        std::shared_ptr<const ProgramImage> programImage,
+        std::function<bool()> shouldAbort
+    )
+        : projectConfig(projectConfig)
+        , environmentConfigs(std::move(environmentConfigs))
+        , programImage(std::move(programImage))
+        , shouldAbort(std::move(shouldAbort))
+    {}
+
+    QJsonObject ParallelProgrammer::run() {
+        auto jobs = std::vector<Job>();
+        jobs.reserve(this->environmentConfigs.size());
+
+        for (const auto& environmentConfig : this->environmentConfigs) {
+            jobs.emplace_back(Job{
+                .environmentConfig = environmentConfig,
+                .targetController = std::make_unique<TargetControllerComponent>(
+                    this->projectConfig,
+                    environmentConfig
+                ),
+            });
+        }
+
+        Logger::info(
+            "Programming " + std::to_string(jobs.size()) + " target(s) with "
+                + std::to_string(this->programImage->size()) + " bytes"
+        );
+
+        auto resultFutures = std::vector<std::future<QJsonObject>>();
+        resultFutures.reserve(jobs.size());
+
+        for (auto& job : jobs) {
+            job.targetControllerThread = std::thread(&TargetControllerComponent::run, job.targetController.get());
+            resultFutures.emplace_back(
+                std::async(std::launch::async, &ParallelProgrammer::programTarget, this, std::ref(job))
+            );
+        }
+
+        auto results = QJsonArray();
+        auto aborted = false;
+        auto successCount = std::size_t(0);
+
+        for (auto& resultFuture : resultFutures) {
+            while (resultFuture.wait_for(ParallelProgrammer::ABORT_POLL_INTERVAL) != std::future_status::ready) {
+                if (!aborted && this->shouldAbort()) {
+                    /*
+                     * Shutting down the TargetControllers will fail any in-flight commands, which will bring the
+                     * workers to a halt.
+                     */
+                    Logger::warning("Aborting programming");
+                    aborted = true;
+                    EventManager::triggerEvent(Events::makeEvent<Events::ShutdownTargetController>());
+                }
+            }
+
+            const auto result = resultFuture.get();
+            if (result.value("success").toBool()) {
+                ++successCount;
+            }
+
+            results.append(result);
+        }
+
+        /*
+         * All workers have finished, so every TargetController has either completed its startup (and registered for
+         * the shutdown event) or has already shut down.
+         */
+        EventManager::triggerEvent(Events::makeEvent<Events::ShutdownTargetController>());
+
+        for (auto& job : jobs) {
+            if (job.targetControllerThread.joinable()) {
+                job.targetControllerThread.join();
+            }
+        }
+
+        Logger::info(
+            std::to_string(successCount) + " of " + std::to_string(jobs.size()) + " target(s) programmed successfully"
+        );
+
+        auto output = QJsonObject();
+        output.insert("success", !aborted && successCount == jobs.size());
+        output.insert("results", results);
+        return output;
+    }
+
+    QJsonObject ParallelProgrammer::programTarget(Job& job) {
+        const auto& environmentName = job.environmentConfig.name;
+        const auto logPrefix = "[" + environmentName + "] ";
+        const auto startTime = steady_clock::now();
+
+        auto result = QJsonObject();
+        result.insert("environment", QString::fromStdString(environmentName));
+        result.insert("debugTool", QString::fromStdString(job.environmentConfig.debugToolConfig.name));
+
+        try {
+            ParallelProgrammer::waitForTargetController(*(job.targetController));
+
+            auto targetControllerService = Services::TargetControllerService(*(job.targetController));
+
+            const auto targetDescriptor = targetControllerService.getTargetDescriptor();
+            result.insert("target", QString::fromStdString(targetDescriptor->name));
+
+            if (targetControllerService.getTargetState() != TargetState::STOPPED) {
+                targetControllerService.stopTargetExecution();
+            }
+
+            const auto bytes = targetControllerService.loadProgramImage(this->programImage);
+
+            Logger::info(logPrefix + "Programming complete");
+            result.insert("success", true);
+            result.insert("bytes", static_cast<qint64>(bytes));
+
+        } catch (const Exception& exception) {
+            Logger::error(logPrefix + "Programming failed - " + exception.getMessage());
+            result.insert("success", false);
+            result.insert("error", QString::fromStdString(exception.getMessage()));
+        }
+
+        result.insert(
+            "durationMs",
+            static_cast<qint64>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - startTime).count()
+            )
+        );
+
+        return result;
+    }
+
+    void ParallelProgrammer::waitForTargetController(TargetControllerComponent& targetController) {
+        auto eventListener = std::make_shared<EventListener>("ParallelProgrammerEventListener");
+        eventListener->registerEventType<Events::TargetControllerThreadStateChanged>();
+        EventManager::registerListener(eventListener);
+
+        /*
+         * The state change events don't identify the TargetController that emitted them, so we just use them as a
+         * prompt to check the state of ours.
+         */
+        auto targetControllerState = targetController.getThreadState();
+
+        while (
+            targetControllerState == ThreadState::UNINITIALISED
+            || targetControllerState == ThreadState::STARTING
+        ) {
+            eventListener->waitForEvent<Events::TargetControllerThreadStateChanged>();
+            targetControllerState = targetController.getThreadState();
+        }
+
+        EventManager::deregisterListener(eventListener->getId());
+
+        if (targetControllerState != ThreadState::READY) {
+            throw Exception("TargetController failed to start up");
+        }
+    }
+}
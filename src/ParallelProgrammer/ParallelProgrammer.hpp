@@ -0,0 +1,99 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <QJsonObject>
+
+#include "src/TargetController/TargetControllerComponent.hpp"
+#include "src/ProgramImage/ProgramImage.hpp"
+
+#include "src/ProjectConfig.hpp"
+
+namespace Bloom
+{
+    /**
+     * The ParallelProgrammer writes a single program image to the targets of numerous environments, at the same time.
+     * It's invoked via the "program" command (see Application::runParallelProgrammer()), and is intended for
+     * production line programming, where a number of boards are programmed in one go.
+     *
+     * Each environment gets its own TargetController, running on a dedicated thread, with its own debug tool and
+     * target. Each TargetController is driven from a separate worker thread, so the programming of one target doesn't
+     * hold up the others.
+     *
+     * Programming is delegated to the TargetController (see TargetController::Commands::LoadProgramImage), so only
+     * the program memory pages that differ from the image are written, and the image is verified once written.
+     */
+    class ParallelProgrammer
+    {
+    public:
+        /**
+         * @param projectConfig
+         *
+         * @param environmentConfigs
+         *  The environments to program. The debug tool of each environment must be distinguishable from the others.
+         *
+         * @param programImage
+         *
+         * @param shouldAbort
+         *  Invoked periodically, whilst programming is in progress. If it returns true, programming will be aborted.
+         */
+        ParallelProgrammer(
+            const ProjectConfig& projectConfig,
+            std::vector<EnvironmentConfig> environmentConfigs,
+            std::shared_ptr<const ProgramImage> programImage,
+            std::function<bool()> shouldAbort
+        );
+
+        /**
+         * Programs all targets and waits for them to finish.
+         *
+         * @return
+         *  The aggregate report, as JSON. The "success" field will only be true if every target was programmed and
+         *  verified successfully.
+         */
+        QJsonObject run();
+
+    private:
+        static constexpr auto ABORT_POLL_INTERVAL = std::chrono::milliseconds(100);
+
+        /**
+         * A single environment's TargetController.
+         */
+        struct Job
+        {
+            EnvironmentConfig environmentConfig;
+            std::unique_ptr<TargetController::TargetControllerComponent> targetController;
+            std::thread targetControllerThread = std::thread();
+        };
+
+        const ProjectConfig& projectConfig;
+        std::vector<EnvironmentConfig> environmentConfigs;
+        std::shared_ptr<const ProgramImage> programImage;
+        std::function<bool()> shouldAbort;
+
+        /**
+         * Starts the job's TargetController, programs and verifies the target, and records the outcome.
+         *
+         * This is invoked on a worker thread - one per job.
+         *
+         * @param job
+         *
+         * @return
+         *  The job's entry in the report.
+         */
+        QJsonObject programTarget(Job& job);
+
+        /**
+         * Waits for the given TargetController to finish starting up.
+         *
+         * @param targetController
+         *
+         * @throws Exceptions::Exception
+         *  If the TargetController failed to start up.
+         */
+        static void waitForTargetController(TargetController::TargetControllerComponent& targetController);
+    };
+}
@@ -0,0 +1,499 @@
+#include "DwarfLineTable.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <elf.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <string_view>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryAddressRange;
+
+    using Exceptions::Exception;
+
+    namespace
+    {
+        /**
+         * Bounds-checked, little-endian reader for DWARF data.
+         */
+        class DwarfReader
+        {
+        public:
+            explicit DwarfReader(std::span<const unsigned char> data)
+                : data(data)
+            {}
+
+            [[nodiscard]] bool atEnd() const {
+                return this->position >= this->data.size();
+            }
+
+            [[nodiscard]] std::size_t getPosition() const {
+                return this->position;
+            }
+
+            void seek(std::size_t position) {
+                if (position > this->data.size()) {
+                    throw Exception("Truncated .debug_line section");
+                }
+
+                this->position = position;
+            }
+
+            void skip(std::uint64_t size) {
+                if (size > this->data.size() - this->position) {
+                    throw Exception("Truncated .debug_line section");
+                }
+
+                this->position += static_cast<std::size_t>(size);
+            }
+
+            std::uint64_t readUnsigned(std::size_t size) {
+                if (size > this->data.size() - this->position) {
+                    throw Exception("Truncated .debug_line section");
+                }
+
+                auto value = std::uint64_t(0);
+                for (auto index = std::size_t(0); index < size; ++index) {
+                    value |= static_cast<std::uint64_t>(this->data[this->position + index]) << (index * 8);
+                }
+
+                this->position += size;
+                return value;
+            }
+
+            std::uint8_t readUint8() {
+                return static_cast<std::uint8_t>(this->readUnsigned(1));
+            }
+
+            std::uint64_t readUleb128() {
+                auto value = std::uint64_t(0);
+                auto shift = 0U;
+
+                while (true) {
+                    const auto byte = this->readUint8();
+
+                    if (shift < 64) {
+                        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                    }
+
+                    shift += 7;
+
+                    if ((byte & 0x80) == 0) {
+                        return value;
+                    }
+                }
+            }
+
+            std::int64_t readSleb128() {
+                auto value = std::int64_t(0);
+                auto shift = 0U;
+                auto byte = std::uint8_t(0);
+
+                do {
+                    byte = this->readUint8();
+
+                    if (shift < 64) {
+                        value |= static_cast<std::int64_t>(byte & 0x7F) << shift;
+                    }
+
+                    shift += 7;
+
+                } while ((byte & 0x80) != 0);
+
+                if (shift < 64 && (byte & 0x40) != 0) {
+                    value |= -(std::int64_t(1) << shift);
+                }
+
+                return value;
+            }
+
+        private:
+            std::span<const unsigned char> data;
+            std::size_t position = 0;
+        };
+
+        // Standard opcodes
+        constexpr auto DW_LNS_COPY = 0x01;
+        constexpr auto DW_LNS_ADVANCE_PC = 0x02;
+        constexpr auto DW_LNS_ADVANCE_LINE = 0x03;
+        constexpr auto DW_LNS_NEGATE_STMT = 0x06;
+        constexpr auto DW_LNS_CONST_ADD_PC = 0x08;
+        constexpr auto DW_LNS_FIXED_ADVANCE_PC = 0x09;
+
+        // Extended opcodes
+        constexpr auto DW_LNE_END_SEQUENCE = 0x01;
+        constexpr auto DW_LNE_SET_ADDRESS = 0x02;
+    }
+
+    DwarfLineTable DwarfLineTable::fromFile(const std::string& filePath) {
+        const auto fileDescriptor = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0) {
+            throw Exception(
+                "Failed to open ELF file (" + filePath + ") - error number: " + std::to_string(errno)
+            );
+        }
+
+        auto fileStat = (struct ::stat){};
+        if (::fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0) {
+            ::close(fileDescriptor);
+            throw Exception("ELF file (" + filePath + ") is empty or cannot be read");
+        }
+
+        const auto fileSize = static_cast<std::size_t>(fileStat.st_size);
+
+        auto* mapping = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        ::close(fileDescriptor);
+
+        if (mapping == MAP_FAILED) {
+            throw Exception("Failed to map ELF file (" + filePath + ") - error number: " + std::to_string(errno));
+        }
+
+        const auto file = std::span<const unsigned char>(static_cast<const unsigned char*>(mapping), fileSize);
+
+        try {
+            if (file.size() <= EI_DATA || std::memcmp(file.data(), ELFMAG, SELFMAG) != 0) {
+                throw Exception("Not an ELF file");
+            }
+
+            if (file[EI_DATA] != ELFDATA2LSB) {
+                throw Exception("Only little-endian ELF files are supported");
+            }
+
+            auto lineSection = std::span<const unsigned char>();
+
+            switch (file[EI_CLASS]) {
+                case ELFCLASS32: {
+                    lineSection = DwarfLineTable::findLineSection<::Elf32_Ehdr, ::Elf32_Shdr>(file);
+                    break;
+                }
+                case ELFCLASS64: {
+                    lineSection = DwarfLineTable::findLineSection<::Elf64_Ehdr, ::Elf64_Shdr>(file);
+                    break;
+                }
+                default: {
+                    throw Exception("Invalid ELF class");
+                }
+            }
+
+            auto lineTable = DwarfLineTable::fromLineSection(lineSection);
+
+            ::munmap(mapping, fileSize);
+            return lineTable;
+
+        } catch (const Exception& exception) {
+            ::munmap(mapping, fileSize);
+            throw Exception(
+                "Failed to load line table from ELF file (" + filePath + ") - " + exception.getMessage()
+            );
+        }
+    }
+
+    std::vector<TargetMemoryAddress> DwarfLineTable::statementAddresses() const {
+        auto output = std::vector<TargetMemoryAddress>();
+
+        for (const auto& sequence : this->sequences) {
+            output.insert(output.end(), sequence.statementAddresses.begin(), sequence.statementAddresses.end());
+        }
+
+        std::sort(output.begin(), output.end());
+        output.erase(std::unique(output.begin(), output.end()), output.end());
+        return output;
+    }
+
+    std::optional<TargetMemoryAddressRange> DwarfLineTable::statementRangeAt(TargetMemoryAddress address) const {
+        const auto* sequence = this->sequenceAt(address);
+        if (sequence == nullptr) {
+            return std::nullopt;
+        }
+
+        const auto& statementAddresses = sequence->statementAddresses;
+        const auto nextStatementIt = std::upper_bound(statementAddresses.begin(), statementAddresses.end(), address);
+
+        if (nextStatementIt == statementAddresses.begin()) {
+            return std::nullopt;
+        }
+
+        return TargetMemoryAddressRange(
+            *(nextStatementIt - 1),
+            (nextStatementIt != statementAddresses.end() ? *nextStatementIt : sequence->addressRange.endAddress) - 1
+        );
+    }
+
+    bool DwarfLineTable::contains(TargetMemoryAddress address) const {
+        return this->sequenceAt(address) != nullptr;
+    }
+
+    const DwarfLineTable::Sequence* DwarfLineTable::sequenceAt(TargetMemoryAddress address) const {
+        // Sequence end addresses are exclusive
+        const auto sequenceIt = std::find_if(
+            this->sequences.begin(),
+            this->sequences.end(),
+            [address] (const Sequence& sequence) {
+                return address >= sequence.addressRange.startAddress && address < sequence.addressRange.endAddress;
+            }
+        );
+
+        return sequenceIt != this->sequences.end() ? &(*sequenceIt) : nullptr;
+    }
+
+    template<typename ElfHeaderType, typename SectionHeaderType>
+    std::span<const unsigned char> DwarfLineTable::findLineSection(std::span<const unsigned char> file) {
+        if (file.size() < sizeof(ElfHeaderType)) {
+            throw Exception("Truncated ELF header");
+        }
+
+        // The mapping may not be suitably aligned for the header structs, so we copy them out
+        auto elfHeader = ElfHeaderType();
+        std::memcpy(&elfHeader, file.data(), sizeof(elfHeader));
+
+        if (elfHeader.e_shnum == 0 || elfHeader.e_shstrndx >= elfHeader.e_shnum) {
+            throw Exception("ELF file has no section name table");
+        }
+
+        if (elfHeader.e_shentsize != sizeof(SectionHeaderType)) {
+            throw Exception("Unexpected ELF section header size");
+        }
+
+        const auto sectionHeadersEnd = static_cast<std::uint64_t>(elfHeader.e_shoff)
+            + static_cast<std::uint64_t>(elfHeader.e_shnum) * sizeof(SectionHeaderType);
+
+        if (sectionHeadersEnd > file.size()) {
+            throw Exception("Truncated ELF section header table");
+        }
+
+        const auto readSectionHeader = [&file, &elfHeader] (std::size_t index) {
+            auto sectionHeader = SectionHeaderType();
+            std::memcpy(
+                &sectionHeader,
+                file.data() + elfHeader.e_shoff + index * sizeof(SectionHeaderType),
+                sizeof(sectionHeader)
+            );
+
+            if (
+                sectionHeader.sh_type != SHT_NOBITS
+                && static_cast<std::uint64_t>(sectionHeader.sh_offset) + sectionHeader.sh_size > file.size()
+            ) {
+                throw Exception("Truncated ELF section");
+            }
+
+            return sectionHeader;
+        };
+
+        const auto nameTableHeader = readSectionHeader(elfHeader.e_shstrndx);
+        const auto nameTable = std::string_view(
+            reinterpret_cast<const char*>(file.data() + nameTableHeader.sh_offset),
+            static_cast<std::size_t>(nameTableHeader.sh_size)
+        );
+
+        static constexpr auto LINE_SECTION_NAME = std::string_view(".debug_line");
+
+        for (auto index = std::size_t(0); index < elfHeader.e_shnum; ++index) {
+            const auto sectionHeader = readSectionHeader(index);
+
+            if (sectionHeader.sh_type != SHT_PROGBITS || sectionHeader.sh_name >= nameTable.size()) {
+                continue;
+            }
+
+            const auto name = nameTable.substr(sectionHeader.sh_name);
+            if (name.substr(0, name.find('\0')) != LINE_SECTION_NAME) {
+                continue;
+            }
+
+            return file.subspan(
+                static_cast<std::size_t>(sectionHeader.sh_offset),
+                static_cast<std::size_t>(sectionHeader.sh_size)
+            );
+        }
+
+        throw Exception("ELF file has no .debug_line section - was it built with debug information (-g)?");
+    }
+
+    DwarfLineTable DwarfLineTable::fromLineSection(std::span<const unsigned char> section) {
+        auto lineTable = DwarfLineTable();
+        auto reader = DwarfReader(section);
+
+        while (!reader.atEnd()) {
+            // Unit header
+            auto unitLength = reader.readUnsigned(4);
+            auto offsetSize = std::size_t(4);
+
+            if (unitLength == 0xFFFFFFFF) {
+                // 64-bit DWARF format
+                unitLength = reader.readUnsigned(8);
+                offsetSize = 8;
+            }
+
+            const auto unitStart = reader.getPosition();
+            if (unitLength > section.size() - unitStart) {
+                throw Exception("Truncated .debug_line section");
+            }
+
+            const auto unitEnd = unitStart + static_cast<std::size_t>(unitLength);
+
+            const auto version = reader.readUnsigned(2);
+            if (version < 2 || version > 5) {
+                throw Exception("Unsupported DWARF line table version (" + std::to_string(version) + ")");
+            }
+
+            if (version >= 5) {
+                reader.skip(2); // address_size and segment_selector_size
+            }
+
+            const auto headerLength = reader.readUnsigned(offsetSize);
+            const auto programStart = reader.getPosition() + headerLength;
+
+            const auto minimumInstructionLength = reader.readUint8();
+
+            if (version >= 4) {
+                reader.skip(1); // maximum_operations_per_instruction - we don't support VLIW architectures
+            }
+
+            const auto defaultIsStatement = reader.readUint8() != 0;
+            reader.skip(1); // line_base - we don't track line numbers
+            const auto lineRange = reader.readUint8();
+            const auto opcodeBase = reader.readUint8();
+
+            if (lineRange == 0 || opcodeBase == 0) {
+                throw Exception("Invalid DWARF line table header");
+            }
+
+            auto standardOpcodeLengths = std::vector<std::uint8_t>(opcodeBase - 1);
+            for (auto& opcodeLength : standardOpcodeLengths) {
+                opcodeLength = reader.readUint8();
+            }
+
+            // We don't need the directory and file tables, so we skip straight to the line number program
+            if (programStart > unitEnd) {
+                throw Exception("Invalid DWARF line table header length");
+            }
+
+            reader.seek(static_cast<std::size_t>(programStart));
+
+            // Line number program state
+            auto address = std::uint64_t(0);
+            auto isStatement = defaultIsStatement;
+            auto sequence = Sequence();
+            auto sequenceStarted = false;
+
+            const auto emitRow = [&] {
+                if (!sequenceStarted) {
+                    sequence.addressRange.startAddress = static_cast<TargetMemoryAddress>(address);
+                    sequenceStarted = true;
+                }
+
+                if (isStatement && address <= std::numeric_limits<TargetMemoryAddress>::max()) {
+                    sequence.statementAddresses.push_back(static_cast<TargetMemoryAddress>(address));
+                }
+            };
+
+            while (reader.getPosition() < unitEnd) {
+                const auto opcode = reader.readUint8();
+
+                if (opcode >= opcodeBase) {
+                    // Special opcode
+                    const auto adjustedOpcode = static_cast<std::uint8_t>(opcode - opcodeBase);
+                    address += static_cast<std::uint64_t>(adjustedOpcode / lineRange) * minimumInstructionLength;
+                    emitRow();
+                    continue;
+                }
+
+                if (opcode == 0) {
+                    // Extended opcode
+                    const auto length = reader.readUleb128();
+                    if (length == 0) {
+                        continue;
+                    }
+
+                    const auto instructionEnd = reader.getPosition() + length;
+                    const auto extendedOpcode = reader.readUint8();
+
+                    if (extendedOpcode == DW_LNE_END_SEQUENCE) {
+                        if (sequenceStarted) {
+                            sequence.addressRange.endAddress = static_cast<TargetMemoryAddress>(
+                                std::min(
+                                    address,
+                                    static_cast<std::uint64_t>(std::numeric_limits<TargetMemoryAddress>::max())
+                                )
+                            );
+
+                            std::sort(sequence.statementAddresses.begin(), sequence.statementAddresses.end());
+                            sequence.statementAddresses.erase(
+                                std::unique(sequence.statementAddresses.begin(), sequence.statementAddresses.end()),
+                                sequence.statementAddresses.end()
+                            );
+
+                            /*
+                             * The linker relocates the sequences of discarded sections (--gc-sections) to address 0,
+                             * leaving them empty. We drop any empty sequences.
+                             */
+                            if (sequence.addressRange.endAddress > sequence.addressRange.startAddress) {
+                                lineTable.sequences.emplace_back(std::move(sequence));
+                            }
+                        }
+
+                        address = 0;
+                        isStatement = defaultIsStatement;
+                        sequence = Sequence();
+                        sequenceStarted = false;
+
+                    } else if (extendedOpcode == DW_LNE_SET_ADDRESS) {
+                        const auto addressSize = static_cast<std::size_t>(length - 1);
+                        address = reader.readUnsigned(std::min(addressSize, std::size_t(8)));
+                    }
+
+                    // Skip any operands we haven't consumed (including those of unknown extended opcodes)
+                    reader.seek(static_cast<std::size_t>(instructionEnd));
+                    continue;
+                }
+
+                switch (opcode) {
+                    case DW_LNS_COPY: {
+                        emitRow();
+                        break;
+                    }
+                    case DW_LNS_ADVANCE_PC: {
+                        address += reader.readUleb128() * minimumInstructionLength;
+                        break;
+                    }
+                    case DW_LNS_ADVANCE_LINE: {
+                        reader.readSleb128();
+                        break;
+                    }
+                    case DW_LNS_NEGATE_STMT: {
+                        isStatement = !isStatement;
+                        break;
+                    }
+                    case DW_LNS_CONST_ADD_PC: {
+                        address += static_cast<std::uint64_t>((255 - opcodeBase) / lineRange)
+                            * minimumInstructionLength;
+                        break;
+                    }
+                    case DW_LNS_FIXED_ADVANCE_PC: {
+                        address += reader.readUnsigned(2);
+                        break;
+                    }
+                    default: {
+                        // All other standard opcodes have ULEB128 operands, which we don't need
+                        for (auto index = 0; index < standardOpcodeLengths[opcode - 1]; ++index) {
+                            reader.readUleb128();
+                        }
+                        break;
+                    }
+                }
+            }
+
+            reader.seek(unitEnd);
+        }
+
+        return lineTable;
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <span>
+#include <optional>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom
+{
+    /**
+     * The statement addresses of an ELF file's DWARF line table (.debug_line), for mapping source lines to code.
+     *
+     * We only run the line number programs far enough to extract the address of each row marked as the beginning of
+     * a statement (is_stmt), grouped by sequence. The directory and file tables are skipped entirely, as are the
+     * line numbers themselves - consumers that need line numbers can map the addresses back via addr2line.
+     *
+     * DWARF versions 2 through 5 are supported, in both the 32-bit and 64-bit DWARF formats.
+     */
+    class DwarfLineTable
+    {
+    public:
+        struct Sequence
+        {
+            /**
+             * The address range covered by the sequence (from its first row to its end_sequence row, exclusive).
+             */
+            Targets::TargetMemoryAddressRange addressRange;
+
+            /**
+             * Sorted and free of duplicates.
+             */
+            std::vector<Targets::TargetMemoryAddress> statementAddresses;
+        };
+
+        std::vector<Sequence> sequences;
+
+        /**
+         * Loads the line table from the given ELF file.
+         *
+         * @param filePath
+         *
+         * @throws Exceptions::Exception
+         *  If the file cannot be read, it isn't a valid ELF file, or it has no .debug_line section.
+         *
+         * @return
+         */
+        static DwarfLineTable fromFile(const std::string& filePath);
+
+        /**
+         * Returns the statement addresses of all sequences, sorted and free of duplicates.
+         *
+         * @return
+         */
+        [[nodiscard]] std::vector<Targets::TargetMemoryAddress> statementAddresses() const;
+
+        /**
+         * Returns the address range of the statement containing the given address - from the statement's address up
+         * to the next statement address in the same sequence (or the end of the sequence).
+         *
+         * @param address
+         *
+         * @return
+         *  The range, with an inclusive end address. std::nullopt if the address isn't covered by the line table, or
+         *  it precedes the first statement of its sequence.
+         */
+        [[nodiscard]] std::optional<Targets::TargetMemoryAddressRange> statementRangeAt(
+            Targets::TargetMemoryAddress address
+        ) const;
+
+        /**
+         * Checks if the given address is covered by any sequence in the line table (that is, if the code at the
+         * address was compiled with debug information).
+         *
+         * @param address
+         *
+         * @return
+         */
+        [[nodiscard]] bool contains(Targets::TargetMemoryAddress address) const;
+
+    private:
+        DwarfLineTable() = default;
+
+        [[nodiscard]] const Sequence* sequenceAt(Targets::TargetMemoryAddress address) const;
+
+        /**
+         * Finds the .debug_line section, for the given ELF class (32 bit or 64 bit).
+         *
+         * @tparam ElfHeaderType
+         * @tparam SectionHeaderType
+         *
+         * @param file
+         *
+         * @return
+         */
+        template<typename ElfHeaderType, typename SectionHeaderType>
+        static std::span<const unsigned char> findLineSection(std::span<const unsigned char> file);
+
+        /**
+         * Runs the line number programs in the given .debug_line section.
+         *
+         * @param section
+         *
+         * @return
+         */
+        static DwarfLineTable fromLineSection(std::span<const unsigned char> section);
+    };
+}
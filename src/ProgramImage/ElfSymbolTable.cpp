@@ -0,0 +1,278 @@
+#include "ElfSymbolTable.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <elf.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <iterator>
+#include <string_view>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+
+    using Exceptions::Exception;
+
+    ElfSymbolTable ElfSymbolTable::fromFile(const std::string& filePath) {
+        const auto fileDescriptor = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0) {
+            throw Exception(
+                "Failed to open ELF file (" + filePath + ") - error number: " + std::to_string(errno)
+            );
+        }
+
+        auto fileStat = (struct ::stat){};
+        if (::fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0) {
+            ::close(fileDescriptor);
+            throw Exception("ELF file (" + filePath + ") is empty or cannot be read");
+        }
+
+        const auto fileSize = static_cast<std::size_t>(fileStat.st_size);
+
+        auto* mapping = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        ::close(fileDescriptor);
+
+        if (mapping == MAP_FAILED) {
+            throw Exception("Failed to map ELF file (" + filePath + ") - error number: " + std::to_string(errno));
+        }
+
+        const auto file = std::span<const unsigned char>(static_cast<const unsigned char*>(mapping), fileSize);
+
+        try {
+            if (file.size() <= EI_DATA || std::memcmp(file.data(), ELFMAG, SELFMAG) != 0) {
+                throw Exception("Not an ELF file");
+            }
+
+            if (file[EI_DATA] != ELFDATA2LSB) {
+                throw Exception("Only little-endian ELF files are supported");
+            }
+
+            auto symbolTable = ElfSymbolTable();
+
+            switch (file[EI_CLASS]) {
+                case ELFCLASS32: {
+                    symbolTable = ElfSymbolTable::fromElfClass<::Elf32_Ehdr, ::Elf32_Shdr, ::Elf32_Sym>(file);
+                    break;
+                }
+                case ELFCLASS64: {
+                    symbolTable = ElfSymbolTable::fromElfClass<::Elf64_Ehdr, ::Elf64_Shdr, ::Elf64_Sym>(file);
+                    break;
+                }
+                default: {
+                    throw Exception("Invalid ELF class");
+                }
+            }
+
+            ::munmap(mapping, fileSize);
+            return symbolTable;
+
+        } catch (const Exception& exception) {
+            ::munmap(mapping, fileSize);
+            throw Exception("Failed to load symbols from ELF file (" + filePath + ") - " + exception.getMessage());
+        }
+    }
+
+    std::optional<std::reference_wrapper<const ElfSymbolTable::Symbol>> ElfSymbolTable::find(
+        TargetMemoryAddress address
+    ) const {
+        return ElfSymbolTable::findInSortedSymbols(this->symbols, address);
+    }
+
+    std::optional<std::reference_wrapper<const ElfSymbolTable::Symbol>> ElfSymbolTable::findObjectAt(
+        TargetMemoryAddress address
+    ) const {
+        return ElfSymbolTable::findInSortedSymbols(this->objectSymbols, address);
+    }
+
+    std::optional<std::reference_wrapper<const ElfSymbolTable::Symbol>> ElfSymbolTable::findObject(
+        const std::string& name
+    ) const {
+        const auto indexIt = this->objectIndicesByName.find(name);
+
+        if (indexIt == this->objectIndicesByName.end()) {
+            return std::nullopt;
+        }
+
+        return std::cref(this->objectSymbols[indexIt->second]);
+    }
+
+    std::optional<std::reference_wrapper<const ElfSymbolTable::Symbol>> ElfSymbolTable::findByName(
+        const std::string& name
+    ) const {
+        if (const auto objectSymbol = this->findObject(name)) {
+            return objectSymbol;
+        }
+
+        const auto indexIt = this->functionIndicesByName.find(name);
+
+        if (indexIt == this->functionIndicesByName.end()) {
+            return std::nullopt;
+        }
+
+        return std::cref(this->symbols[indexIt->second]);
+    }
+
+    std::optional<std::reference_wrapper<const ElfSymbolTable::Symbol>> ElfSymbolTable::findInSortedSymbols(
+        const std::vector<Symbol>& symbols,
+        TargetMemoryAddress address
+    ) {
+        // Find the last symbol that starts at or before the address
+        const auto symbolIt = std::upper_bound(
+            symbols.begin(),
+            symbols.end(),
+            address,
+            [] (TargetMemoryAddress address, const Symbol& symbol) {
+                return address < symbol.startAddress;
+            }
+        );
+
+        if (symbolIt == symbols.begin()) {
+            return std::nullopt;
+        }
+
+        const auto& symbol = *std::prev(symbolIt);
+        if (address - symbol.startAddress >= symbol.size) {
+            return std::nullopt;
+        }
+
+        return std::cref(symbol);
+    }
+
+    template<typename ElfHeaderType, typename SectionHeaderType, typename SymbolType>
+    ElfSymbolTable ElfSymbolTable::fromElfClass(std::span<const unsigned char> file) {
+        if (file.size() < sizeof(ElfHeaderType)) {
+            throw Exception("Truncated ELF header");
+        }
+
+        // The mapping may not be suitably aligned for the header structs, so we copy them out
+        auto elfHeader = ElfHeaderType();
+        std::memcpy(&elfHeader, file.data(), sizeof(elfHeader));
+
+        if (elfHeader.e_shnum == 0) {
+            throw Exception("ELF file has no section headers");
+        }
+
+        if (elfHeader.e_shentsize != sizeof(SectionHeaderType)) {
+            throw Exception("Unexpected ELF section header size");
+        }
+
+        const auto sectionHeadersEnd = static_cast<std::uint64_t>(elfHeader.e_shoff)
+            + static_cast<std::uint64_t>(elfHeader.e_shnum) * sizeof(SectionHeaderType);
+
+        if (sectionHeadersEnd > file.size()) {
+            throw Exception("Truncated ELF section header table");
+        }
+
+        const auto readSectionHeader = [&file, &elfHeader] (std::size_t index) {
+            auto sectionHeader = SectionHeaderType();
+            std::memcpy(
+                &sectionHeader,
+                file.data() + elfHeader.e_shoff + index * sizeof(SectionHeaderType),
+                sizeof(sectionHeader)
+            );
+            return sectionHeader;
+        };
+
+        const auto sectionInBounds = [&file] (const SectionHeaderType& sectionHeader) {
+            return static_cast<std::uint64_t>(sectionHeader.sh_offset) + sectionHeader.sh_size <= file.size();
+        };
+
+        auto symbolTable = ElfSymbolTable();
+
+        for (auto index = std::size_t(0); index < elfHeader.e_shnum; ++index) {
+            const auto sectionHeader = readSectionHeader(index);
+
+            if (sectionHeader.sh_type != SHT_SYMTAB || sectionHeader.sh_entsize != sizeof(SymbolType)) {
+                continue;
+            }
+
+            if (sectionHeader.sh_link >= elfHeader.e_shnum) {
+                throw Exception("Invalid ELF string table index");
+            }
+
+            const auto stringTableHeader = readSectionHeader(sectionHeader.sh_link);
+            if (!sectionInBounds(sectionHeader) || !sectionInBounds(stringTableHeader)) {
+                throw Exception("Truncated ELF symbol table");
+            }
+
+            const auto stringTable = std::string_view(
+                reinterpret_cast<const char*>(file.data() + stringTableHeader.sh_offset),
+                static_cast<std::size_t>(stringTableHeader.sh_size)
+            );
+
+            const auto symbolCount = static_cast<std::size_t>(sectionHeader.sh_size / sizeof(SymbolType));
+
+            for (auto symbolIndex = std::size_t(0); symbolIndex < symbolCount; ++symbolIndex) {
+                auto symbol = SymbolType();
+                std::memcpy(
+                    &symbol,
+                    file.data() + sectionHeader.sh_offset + symbolIndex * sizeof(SymbolType),
+                    sizeof(symbol)
+                );
+
+                // ELF32_ST_TYPE and ELF64_ST_TYPE are identical
+                const auto symbolType = ELF32_ST_TYPE(symbol.st_info);
+
+                if (
+                    (symbolType != STT_FUNC && symbolType != STT_OBJECT)
+                    || symbol.st_size == 0
+                    || symbol.st_name >= stringTable.size()
+                    || symbol.st_value > std::numeric_limits<TargetMemoryAddress>::max()
+                ) {
+                    continue;
+                }
+
+                const auto nameEnd = stringTable.find('\0', symbol.st_name);
+                auto& symbols = symbolType == STT_FUNC ? symbolTable.symbols : symbolTable.objectSymbols;
+                symbols.emplace_back(Symbol{
+                    .startAddress = static_cast<TargetMemoryAddress>(symbol.st_value),
+                    .size = static_cast<TargetMemorySize>(
+                        std::min(
+                            static_cast<std::uint64_t>(symbol.st_size),
+                            static_cast<std::uint64_t>(std::numeric_limits<TargetMemorySize>::max())
+                        )
+                    ),
+                    .name = std::string(
+                        stringTable.substr(
+                            symbol.st_name,
+                            nameEnd == std::string_view::npos ? std::string_view::npos : nameEnd - symbol.st_name
+                        )
+                    ),
+                });
+            }
+        }
+
+        const auto sortAndIndex = [] (
+            std::vector<Symbol>& symbols,
+            std::unordered_map<std::string, std::size_t>& indicesByName
+        ) {
+            std::sort(
+                symbols.begin(),
+                symbols.end(),
+                [] (const Symbol& symbolA, const Symbol& symbolB) {
+                    return symbolA.startAddress < symbolB.startAddress;
+                }
+            );
+
+            indicesByName.reserve(symbols.size());
+
+            for (auto index = std::size_t(0); index < symbols.size(); ++index) {
+                // Local (static) symbols may share a name - the first one (by address) wins
+                indicesByName.emplace(symbols[index].name, index);
+            }
+        };
+
+        sortAndIndex(symbolTable.symbols, symbolTable.functionIndicesByName);
+        sortAndIndex(symbolTable.objectSymbols, symbolTable.objectIndicesByName);
+
+        return symbolTable;
+    }
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <optional>
+#include <span>
+#include <functional>
+#include <unordered_map>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom
+{
+    /**
+     * The function and data object symbols of an ELF file, for mapping program counter values to function names,
+     * and variable names to addresses.
+     *
+     * Address lookups are binary searches over the symbols, sorted by address (O(log n)). Name lookups go through a
+     * hash table (O(1)).
+     *
+     * Only sized STT_FUNC and STT_OBJECT symbols from the static symbol table (SHT_SYMTAB) are retained - stripped
+     * ELF files will yield an empty table. Symbol values are taken as byte addresses, which is what avr-gcc emits for
+     * AVR targets (data object addresses carry avr-gcc's memory offsets - 0x800000 for RAM, for example).
+     */
+    class ElfSymbolTable
+    {
+    public:
+        struct Symbol
+        {
+            Targets::TargetMemoryAddress startAddress = 0;
+            Targets::TargetMemorySize size = 0;
+            std::string name;
+        };
+
+        /**
+         * Loads the function symbols from the given ELF file.
+         *
+         * @param filePath
+         *
+         * @throws Exceptions::Exception
+         *  If the file cannot be read, or it isn't a valid ELF file.
+         *
+         * @return
+         */
+        static ElfSymbolTable fromFile(const std::string& filePath);
+
+        /**
+         * Finds the function containing the given address.
+         *
+         * @param address
+         *
+         * @return
+         *  The function's symbol, or std::nullopt if the address doesn't fall within any known function.
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<const Symbol>> find(
+            Targets::TargetMemoryAddress address
+        ) const;
+
+        /**
+         * Finds the data object (variable) containing the given address.
+         *
+         * @param address
+         *
+         * @return
+         *  The object's symbol, or std::nullopt if the address doesn't fall within any known object.
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<const Symbol>> findObjectAt(
+            Targets::TargetMemoryAddress address
+        ) const;
+
+        /**
+         * Finds a data object (variable) by name.
+         *
+         * @param name
+         *
+         * @return
+         *  The object's symbol, or std::nullopt if no object with the given name exists.
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<const Symbol>> findObject(const std::string& name) const;
+
+        /**
+         * Finds a function or data object by name. Objects take precedence, in the (unlikely) event that a function
+         * and an object share a name.
+         *
+         * @param name
+         *
+         * @return
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<const Symbol>> findByName(const std::string& name) const;
+
+        [[nodiscard]] bool empty() const {
+            return this->symbols.empty();
+        }
+
+    private:
+        /**
+         * Function symbols, sorted by start address.
+         */
+        std::vector<Symbol> symbols;
+
+        /**
+         * Data object symbols, sorted by start address.
+         */
+        std::vector<Symbol> objectSymbols;
+
+        /**
+         * Indices into this->symbols and this->objectSymbols, respectively, keyed by symbol name.
+         */
+        std::unordered_map<std::string, std::size_t> functionIndicesByName;
+        std::unordered_map<std::string, std::size_t> objectIndicesByName;
+
+        ElfSymbolTable() = default;
+
+        /**
+         * Finds the symbol containing the given address, in a vector of symbols sorted by start address.
+         *
+         * @param symbols
+         * @param address
+         *
+         * @return
+         */
+        static std::optional<std::reference_wrapper<const Symbol>> findInSortedSymbols(
+            const std::vector<Symbol>& symbols,
+            Targets::TargetMemoryAddress address
+        );
+
+        /**
+         * Parses the symbol table, for the given ELF class (32 bit or 64 bit).
+         *
+         * @tparam ElfHeaderType
+         * @tparam SectionHeaderType
+         * @tparam SymbolType
+         *
+         * @param file
+         *
+         * @return
+         */
+        template<typename ElfHeaderType, typename SectionHeaderType, typename SymbolType>
+        static ElfSymbolTable fromElfClass(std::span<const unsigned char> file);
+    };
+}
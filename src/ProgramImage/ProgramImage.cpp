@@ -0,0 +1,345 @@
+#include "ProgramImage.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <elf.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+
+    using Exceptions::Exception;
+
+    ProgramImage ProgramImage::fromFile(const std::string& filePath) {
+        const auto fileDescriptor = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0) {
+            throw Exception(
+                "Failed to open image file (" + filePath + ") - error number: " + std::to_string(errno)
+            );
+        }
+
+        auto fileStat = (struct ::stat){};
+        if (::fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0) {
+            ::close(fileDescriptor);
+            throw Exception("Image file (" + filePath + ") is empty or cannot be read");
+        }
+
+        const auto fileSize = static_cast<std::size_t>(fileStat.st_size);
+
+        /*
+         * We map the file, as opposed to reading it into a buffer - we only need to read each byte once, and the
+         * segment data is copied straight out of the mapping.
+         */
+        auto* mapping = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        ::close(fileDescriptor);
+
+        if (mapping == MAP_FAILED) {
+            throw Exception("Failed to map image file (" + filePath + ") - error number: " + std::to_string(errno));
+        }
+
+        const auto file = std::span<const unsigned char>(static_cast<const unsigned char*>(mapping), fileSize);
+
+        try {
+            auto image = file.size() >= SELFMAG && std::memcmp(file.data(), ELFMAG, SELFMAG) == 0
+                ? ProgramImage::fromElf(file)
+                : ProgramImage::fromIntelHex(
+                    std::string_view(reinterpret_cast<const char*>(file.data()), file.size())
+                );
+
+            ::munmap(mapping, fileSize);
+
+            if (image.segments.empty()) {
+                throw Exception("Image file (" + filePath + ") contains no loadable data");
+            }
+
+            return image;
+
+        } catch (const Exception& exception) {
+            ::munmap(mapping, fileSize);
+            throw Exception("Failed to load image file (" + filePath + ") - " + exception.getMessage());
+        }
+    }
+
+    TargetMemorySize ProgramImage::size() const {
+        return std::accumulate(
+            this->segments.begin(),
+            this->segments.end(),
+            TargetMemorySize(0),
+            [] (TargetMemorySize size, const Segment& segment) {
+                return size + static_cast<TargetMemorySize>(segment.data.size());
+            }
+        );
+    }
+
+    ProgramImage ProgramImage::fromElf(std::span<const unsigned char> file) {
+        if (file.size() <= EI_DATA) {
+            throw Exception("Truncated ELF header");
+        }
+
+        if (file[EI_DATA] != ELFDATA2LSB) {
+            throw Exception("Only little-endian ELF files are supported");
+        }
+
+        switch (file[EI_CLASS]) {
+            case ELFCLASS32: {
+                return ProgramImage::fromElfClass<::Elf32_Ehdr, ::Elf32_Phdr>(file);
+            }
+            case ELFCLASS64: {
+                return ProgramImage::fromElfClass<::Elf64_Ehdr, ::Elf64_Phdr>(file);
+            }
+            default: {
+                throw Exception("Invalid ELF class");
+            }
+        }
+    }
+
+    template<typename ElfHeaderType, typename ProgramHeaderType>
+    ProgramImage ProgramImage::fromElfClass(std::span<const unsigned char> file) {
+        if (file.size() < sizeof(ElfHeaderType)) {
+            throw Exception("Truncated ELF header");
+        }
+
+        // The mapping may not be suitably aligned for the header structs, so we copy them out
+        auto elfHeader = ElfHeaderType();
+        std::memcpy(&elfHeader, file.data(), sizeof(elfHeader));
+
+        if (elfHeader.e_phnum == 0) {
+            throw Exception("ELF file has no program headers");
+        }
+
+        if (elfHeader.e_phentsize != sizeof(ProgramHeaderType)) {
+            throw Exception("Unexpected ELF program header size");
+        }
+
+        const auto programHeadersEnd = static_cast<std::uint64_t>(elfHeader.e_phoff)
+            + static_cast<std::uint64_t>(elfHeader.e_phnum) * sizeof(ProgramHeaderType);
+
+        if (programHeadersEnd > file.size()) {
+            throw Exception("Truncated ELF program header table");
+        }
+
+        auto image = ProgramImage();
+
+        for (auto index = std::size_t(0); index < elfHeader.e_phnum; ++index) {
+            auto programHeader = ProgramHeaderType();
+            std::memcpy(
+                &programHeader,
+                file.data() + elfHeader.e_phoff + index * sizeof(ProgramHeaderType),
+                sizeof(programHeader)
+            );
+
+            if (programHeader.p_type != PT_LOAD || programHeader.p_filesz == 0) {
+                continue;
+            }
+
+            if (static_cast<std::uint64_t>(programHeader.p_offset) + programHeader.p_filesz > file.size()) {
+                throw Exception("Truncated ELF segment");
+            }
+
+            if (
+                static_cast<std::uint64_t>(programHeader.p_paddr) + programHeader.p_filesz
+                > static_cast<std::uint64_t>(std::numeric_limits<TargetMemoryAddress>::max()) + 1
+            ) {
+                throw Exception("ELF segment address out of range");
+            }
+
+            const auto segmentData = file.subspan(
+                static_cast<std::size_t>(programHeader.p_offset),
+                static_cast<std::size_t>(programHeader.p_filesz)
+            );
+
+            image.segments.emplace_back(Segment{
+                .startAddress = static_cast<TargetMemoryAddress>(programHeader.p_paddr),
+                .data = Targets::TargetMemoryBuffer(segmentData.begin(), segmentData.end()),
+            });
+        }
+
+        image.normalise();
+        return image;
+    }
+
+    ProgramImage ProgramImage::fromIntelHex(std::string_view file) {
+        static constexpr auto DATA_RECORD = 0x00;
+        static constexpr auto END_OF_FILE_RECORD = 0x01;
+        static constexpr auto EXTENDED_SEGMENT_ADDRESS_RECORD = 0x02;
+        static constexpr auto EXTENDED_LINEAR_ADDRESS_RECORD = 0x04;
+
+        const auto hexValue = [] (char character) -> int {
+            if (character >= '0' && character <= '9') {
+                return character - '0';
+            }
+
+            if (character >= 'A' && character <= 'F') {
+                return character - 'A' + 10;
+            }
+
+            if (character >= 'a' && character <= 'f') {
+                return character - 'a' + 10;
+            }
+
+            return -1;
+        };
+
+        auto image = ProgramImage();
+        auto baseAddress = std::uint32_t(0);
+        auto endOfFile = false;
+        auto lineNumber = std::size_t(0);
+        auto position = std::size_t(0);
+
+        while (position < file.size() && !endOfFile) {
+            auto lineEnd = file.find('\n', position);
+            if (lineEnd == std::string_view::npos) {
+                lineEnd = file.size();
+            }
+
+            auto line = file.substr(position, lineEnd - position);
+            position = lineEnd + 1;
+            ++lineNumber;
+
+            while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t')) {
+                line.remove_suffix(1);
+            }
+
+            if (line.empty()) {
+                continue;
+            }
+
+            const auto lineError = [lineNumber] (const std::string& message) {
+                return Exception("Invalid Intel HEX record on line " + std::to_string(lineNumber) + " - " + message);
+            };
+
+            if (line.front() != ':' || line.size() < 11 || (line.size() - 1) % 2 != 0) {
+                throw lineError("malformed record");
+            }
+
+            auto recordBytes = std::vector<unsigned char>();
+            recordBytes.reserve((line.size() - 1) / 2);
+
+            for (auto index = std::size_t(1); index < line.size(); index += 2) {
+                const auto high = hexValue(line[index]);
+                const auto low = hexValue(line[index + 1]);
+
+                if (high < 0 || low < 0) {
+                    throw lineError("invalid hex digit");
+                }
+
+                recordBytes.push_back(static_cast<unsigned char>((high << 4) | low));
+            }
+
+            const auto byteCount = recordBytes[0];
+            if (recordBytes.size() != static_cast<std::size_t>(byteCount) + 5) {
+                throw lineError("byte count mismatch");
+            }
+
+            const auto checksum = std::accumulate(
+                recordBytes.begin(),
+                recordBytes.end(),
+                std::uint8_t(0),
+                [] (std::uint8_t sum, unsigned char byte) {
+                    return static_cast<std::uint8_t>(sum + byte);
+                }
+            );
+
+            if (checksum != 0) {
+                throw lineError("checksum mismatch");
+            }
+
+            const auto recordAddress = static_cast<std::uint16_t>((recordBytes[1] << 8) | recordBytes[2]);
+            const auto recordType = recordBytes[3];
+            const auto recordData = std::span<const unsigned char>(recordBytes.begin() + 4, byteCount);
+
+            switch (recordType) {
+                case DATA_RECORD: {
+                    const auto address = baseAddress + recordAddress;
+
+                    if (
+                        !image.segments.empty()
+                        && image.segments.back().startAddress + image.segments.back().data.size() == address
+                    ) {
+                        auto& segmentData = image.segments.back().data;
+                        segmentData.insert(segmentData.end(), recordData.begin(), recordData.end());
+                        break;
+                    }
+
+                    image.segments.emplace_back(Segment{
+                        .startAddress = address,
+                        .data = Targets::TargetMemoryBuffer(recordData.begin(), recordData.end()),
+                    });
+                    break;
+                }
+                case END_OF_FILE_RECORD: {
+                    endOfFile = true;
+                    break;
+                }
+                case EXTENDED_SEGMENT_ADDRESS_RECORD:
+                case EXTENDED_LINEAR_ADDRESS_RECORD: {
+                    if (byteCount != 2) {
+                        throw lineError("invalid extended address record");
+                    }
+
+                    const auto value = static_cast<std::uint32_t>((recordData[0] << 8) | recordData[1]);
+                    baseAddress = recordType == EXTENDED_LINEAR_ADDRESS_RECORD ? value << 16 : value << 4;
+                    break;
+                }
+                default: {
+                    // Start address records (types 0x03 and 0x05) are of no use to us
+                    break;
+                }
+            }
+        }
+
+        if (!endOfFile) {
+            throw Exception("Invalid Intel HEX file - missing end of file record");
+        }
+
+        image.normalise();
+        return image;
+    }
+
+    void ProgramImage::normalise() {
+        std::erase_if(this->segments, [] (const Segment& segment) {
+            return segment.data.empty();
+        });
+
+        std::sort(
+            this->segments.begin(),
+            this->segments.end(),
+            [] (const Segment& segmentA, const Segment& segmentB) {
+                return segmentA.startAddress < segmentB.startAddress;
+            }
+        );
+
+        auto mergedSegments = std::vector<Segment>();
+
+        for (auto& segment : this->segments) {
+            if (!mergedSegments.empty()) {
+                auto& previousSegment = mergedSegments.back();
+                const auto previousSegmentEnd = static_cast<std::uint64_t>(previousSegment.startAddress)
+                    + previousSegment.data.size();
+
+                if (segment.startAddress < previousSegmentEnd) {
+                    throw Exception("Image segments overlap at address " + std::to_string(segment.startAddress));
+                }
+
+                if (segment.startAddress == previousSegmentEnd) {
+                    previousSegment.data.insert(previousSegment.data.end(), segment.data.begin(), segment.data.end());
+                    continue;
+                }
+            }
+
+            mergedSegments.emplace_back(std::move(segment));
+        }
+
+        this->segments = std::move(mergedSegments);
+    }
+}
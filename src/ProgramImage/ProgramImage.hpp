@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom
+{
+    /**
+     * A firmware image, extracted from an ELF or Intel HEX file.
+     *
+     * The image consists of a number of segments, each holding a contiguous region of data to be written to the
+     * target's program memory. Segments are held in order of address, do not overlap and are never adjacent (adjacent
+     * regions in the file are merged into a single segment).
+     *
+     * For ELF files, the segments are taken from the loadable (PT_LOAD) program headers, at their physical (load)
+     * addresses. For AVR targets, this means the segments can include EEPROM and fuse data, at the addresses used by
+     * avr-gcc (0x810000 and 0x820000, respectively). It's up to the user of the image to filter out any segments that
+     * don't belong in program memory.
+     */
+    class ProgramImage
+    {
+    public:
+        struct Segment
+        {
+            Targets::TargetMemoryAddress startAddress = 0;
+            Targets::TargetMemoryBuffer data;
+
+            [[nodiscard]] Targets::TargetMemoryAddressRange addressRange() const {
+                return Targets::TargetMemoryAddressRange(
+                    this->startAddress,
+                    this->startAddress + static_cast<Targets::TargetMemorySize>(this->data.size()) - 1
+                );
+            }
+        };
+
+        std::vector<Segment> segments;
+
+        /**
+         * Loads an image from the given file. The file format (ELF or Intel HEX) is determined by the file's content,
+         * not its name.
+         *
+         * @param filePath
+         *
+         * @throws Exceptions::Exception
+         *  If the file cannot be read, or it isn't a valid ELF or Intel HEX file.
+         *
+         * @return
+         */
+        static ProgramImage fromFile(const std::string& filePath);
+
+        /**
+         * Returns the total number of bytes held in all segments.
+         *
+         * @return
+         */
+        [[nodiscard]] Targets::TargetMemorySize size() const;
+
+    private:
+        ProgramImage() = default;
+
+        static ProgramImage fromElf(std::span<const unsigned char> file);
+        static ProgramImage fromIntelHex(std::string_view file);
+
+        /**
+         * Parses the ELF program headers, for the given ELF class (32 bit or 64 bit).
+         *
+         * @tparam ElfHeaderType
+         * @tparam ProgramHeaderType
+         *
+         * @param file
+         *
+         * @return
+         */
+        template<typename ElfHeaderType, typename ProgramHeaderType>
+        static ProgramImage fromElfClass(std::span<const unsigned char> file);
+
+        /**
+         * Sorts the segments by address, merges adjacent segments and removes empty segments.
+         *
+         * @throws Exceptions::Exception
+         *  If any of the segments overlap.
+         */
+        void normalise();
+    };
+}
@@ -1,5 +1,7 @@
 #include "ProjectConfig.hpp"
 
+#include <algorithm>
+
 #include "src/Services/StringService.hpp"
 #include "src/Logger/Logger.hpp"
 #include "src/Exceptions/InvalidConfig.hpp"
@@ -68,12 +70,56 @@ namespace Bloom
         if (configNode["debugLoggingEnabled"]) {
             this->debugLoggingEnabled = configNode["debugLoggingEnabled"].as<bool>(this->debugLoggingEnabled);
         }
+
+        if (configNode["logFile"]) {
+            this->logFilePath = configNode["logFile"].as<std::string>();
+        }
+
+        if (configNode["traceFile"]) {
+            this->traceFilePath = configNode["traceFile"].as<std::string>();
+        }
+
+        if (configNode["metricsPort"]) {
+            this->metricsPortNumber = configNode["metricsPort"].as<std::uint16_t>();
+        }
+
+        if (configNode["metricsIpAddress"]) {
+            this->metricsIpAddress = configNode["metricsIpAddress"].as<std::string>();
+        }
+
+        if (configNode["elfFile"]) {
+            this->elfFilePath = configNode["elfFile"].as<std::string>();
+        }
     }
 
     InsightConfig::InsightConfig(const YAML::Node& insightNode) {
         if (insightNode["enabled"]) {
             this->insightEnabled = insightNode["enabled"].as<bool>(this->insightEnabled);
         }
+
+        if (insightNode["registerHistoryCapacity"]) {
+            this->registerHistoryCapacity = std::max(
+                insightNode["registerHistoryCapacity"].as<std::uint32_t>(this->registerHistoryCapacity),
+                std::uint32_t{1}
+            );
+        }
+
+        if (insightNode["scheduling"]) {
+            if (!insightNode["scheduling"].IsMap()) {
+                throw Exceptions::InvalidConfig(
+                    "Invalid Insight scheduling configuration provided - 'scheduling' must be of mapping type."
+                );
+            }
+
+            this->schedulingConfig = ThreadSchedulingConfig(insightNode["scheduling"]);
+
+            if (this->schedulingConfig.realtimePriority.has_value()) {
+                throw Exceptions::InvalidConfig(
+                    "Real-time scheduling is not supported for Insight - please remove the 'realtimePriority' "
+                    "parameter from the Insight scheduling configuration."
+                );
+            }
+        }
     }
 
     EnvironmentConfig::EnvironmentConfig(std::string name, const YAML::Node& environmentNode)
@@ -122,6 +168,19 @@ namespace Bloom
             this->insightConfig = InsightConfig(environmentNode["insight"]);
         }
 
+        if (environmentNode["targetControllerScheduling"]) {
+            if (!environmentNode["targetControllerScheduling"].IsMap()) {
+                throw Exceptions::InvalidConfig(
+                    "Invalid TargetController scheduling configuration provided - 'targetControllerScheduling' must "
+                    "be of mapping type."
+                );
+            }
+
+            this->targetControllerSchedulingConfig = ThreadSchedulingConfig(
+                environmentNode["targetControllerScheduling"]
+            );
+        }
+
         if (environmentNode["shutdownPostDebugSession"]) {
             this->shutdownPostDebugSession = environmentNode["shutdownPostDebugSession"].as<bool>(
                 this->shutdownPostDebugSession
@@ -129,6 +188,45 @@ namespace Bloom
         }
     }
 
+    ThreadSchedulingConfig::ThreadSchedulingConfig(const YAML::Node& schedulingNode) {
+        if (schedulingNode["realtimePriority"]) {
+            const auto priority = schedulingNode["realtimePriority"].as<int>(0);
+
+            if (priority < 1 || priority > 99) {
+                throw Exceptions::InvalidConfig(
+                    "Invalid real-time priority (" + std::to_string(priority) + ") - the priority must be between "
+                    "1 and 99."
+                );
+            }
+
+            this->realtimePriority = priority;
+        }
+
+        if (schedulingNode["niceValue"]) {
+            this->niceValue = std::clamp(schedulingNode["niceValue"].as<int>(0), -20, 19);
+        }
+
+        if (schedulingNode["cpuAffinity"]) {
+            if (!schedulingNode["cpuAffinity"].IsSequence()) {
+                throw Exceptions::InvalidConfig(
+                    "Invalid CPU affinity provided - 'cpuAffinity' must be a sequence of CPU indices."
+                );
+            }
+
+            for (const auto& cpuNode : schedulingNode["cpuAffinity"]) {
+                const auto cpuIndex = cpuNode.as<int>(-1);
+
+                if (cpuIndex < 0) {
+                    throw Exceptions::InvalidConfig(
+                        "Invalid CPU index in 'cpuAffinity' - CPU indices must be non-negative integers."
+                    );
+                }
+
+                this->cpuAffinity.push_back(static_cast<unsigned int>(cpuIndex));
+            }
+        }
+    }
+
     TargetConfig::TargetConfig(const YAML::Node& targetNode) {
         if (!targetNode["name"]) {
             throw Exceptions::InvalidConfig("No target name found.");
@@ -140,6 +238,44 @@ namespace Bloom
             this->variantName = StringService::asciiToLower(targetNode["variantName"].as<std::string>());
         }
 
+        if (targetNode["stopPrefetch"]) {
+            this->stopPrefetch = targetNode["stopPrefetch"].as<bool>(this->stopPrefetch);
+        }
+
+        if (targetNode["stopPrefetchStackSize"]) {
+            this->stopPrefetchStackSize = targetNode["stopPrefetchStackSize"].as<std::uint32_t>(
+                this->stopPrefetchStackSize
+            );
+        }
+
+        if (targetNode["programMemoryMirror"]) {
+            this->programMemoryMirror = targetNode["programMemoryMirror"].as<bool>(this->programMemoryMirror);
+        }
+
+        if (targetNode["verifyProgramMemoryMirror"]) {
+            this->verifyProgramMemoryMirror = targetNode["verifyProgramMemoryMirror"].as<bool>(
+                this->verifyProgramMemoryMirror
+            );
+        }
+
+        if (targetNode["memoryWriteCombining"]) {
+            this->memoryWriteCombining = targetNode["memoryWriteCombining"].as<bool>(this->memoryWriteCombining);
+        }
+
+        if (targetNode["executionStatePollInterval"]) {
+            this->executionStatePollInterval = std::max(
+                targetNode["executionStatePollInterval"].as<std::uint32_t>(this->executionStatePollInterval),
+                std::uint32_t(1)
+            );
+        }
+
+        if (targetNode["pinStatePollInterval"]) {
+            this->pinStatePollInterval = std::max(
+                targetNode["pinStatePollInterval"].as<std::uint32_t>(this->pinStatePollInterval),
+                std::uint32_t(1)
+            );
+        }
+
         this->targetNode = targetNode;
     }
 
@@ -156,6 +292,10 @@ namespace Bloom
             );
         }
 
+        if (debugToolNode["recordUsbTrace"]) {
+            this->usbTraceRecordingFilePath = debugToolNode["recordUsbTrace"].as<std::string>();
+        }
+
         this->debugToolNode = debugToolNode;
     }
 
@@ -165,6 +305,13 @@ namespace Bloom
         }
 
         this->name = StringService::asciiToLower(debugServerNode["name"].as<std::string>());
+
+        if (debugServerNode["sessionLingerPeriod"]) {
+            this->sessionLingerPeriod = debugServerNode["sessionLingerPeriod"].as<std::uint32_t>(
+                this->sessionLingerPeriod
+            );
+        }
+
         this->debugServerNode = debugServerNode;
     }
 }
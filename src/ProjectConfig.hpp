@@ -4,6 +4,8 @@
 #include <map>
 #include <string>
 #include <optional>
+#include <vector>
+#include <cstdint>
 #include <yaml-cpp/yaml.h>
 
 namespace Bloom
@@ -61,6 +63,72 @@ namespace Bloom
          */
         std::optional<std::string> variantName;
 
+        /**
+         * Determines if the TargetController will prefetch the target's CPU registers and a window of stack memory,
+         * each time the target halts.
+         *
+         * Upon halting, debug clients (like GDB) will typically request the same registers and the memory around the
+         * stack pointer. With this enabled, the TargetController will read all of that data in one go, and service
+         * any such requests from the prefetched data, until the target resumes.
+         */
+        bool stopPrefetch = false;
+
+        /**
+         * The number of bytes of stack memory (starting from the top of the stack) to prefetch, when stopPrefetch is
+         * enabled.
+         */
+        std::uint32_t stopPrefetchStackSize = 64;
+
+        /**
+         * Determines if the TargetController will service program memory reads from its record of the target's
+         * program memory (see TargetControllerComponent::programMemoryContents).
+         *
+         * When enabled, we assume that the program memory can only change via us, so the record is retained across
+         * target execution. Debug clients read program memory frequently (for disassembly, stack unwinding, etc), so
+         * this saves a great deal of traffic to the debug tool.
+         *
+         * This is disabled by default, as the assumption doesn't hold for firmware that rewrites its own program
+         * memory (self-programming via SPM, bootloaders, etc). Serving stale program memory to the debug client is far
+         * worse than the extra traffic. When disabled, the record is discarded whenever the target resumes execution.
+         */
+        bool programMemoryMirror = false;
+
+        /**
+         * Determines if program memory reads serviced from the record of the target's program memory will be
+         * verified against the target. Mismatches are logged, and the record is corrected.
+         *
+         * This defeats the purpose of the record - it's only intended for diagnosing issues with it.
+         */
+        bool verifyProgramMemoryMirror = false;
+
+        /**
+         * Determines if the TargetController will buffer small RAM and EEPROM writes, merging adjacent writes, and
+         * write them to the target in bulk (see TargetControllerComponent::memoryWriteBuffersByType). Writes to
+         * memory-mapped registers are never buffered, and overlapping writes cause the buffer to be flushed first.
+         *
+         * Debug clients often produce many small writes (GDB writes each member of a struct separately, for example).
+         * The buffered writes are written before the target resumes execution, and before any other command that
+         * could observe them is serviced. As a consequence, a failure to write buffered memory will be reported to
+         * the command that triggered the flush, as opposed to the command that issued the write.
+         */
+        bool memoryWriteCombining = true;
+
+        /**
+         * The interval (in milliseconds) at which the TargetController polls the target's execution state, whilst the
+         * target is running. A shorter interval reduces the delay in detecting breakpoint hits, at the cost of more
+         * traffic to the debug tool.
+         *
+         * The TargetController does not poll the target's execution state when it's stopped.
+         */
+        std::uint32_t executionStatePollInterval = 60;
+
+        /**
+         * The interval (in milliseconds) at which the TargetController reads the target's pin states, whilst the
+         * target is stopped and pin state streaming is active (see
+         * TargetController::Commands::SetTargetPinStateStreaming).
+         */
+        std::uint32_t pinStatePollInterval = 250;
+
         /**
          * For extracting any target specific configuration. See Avr8TargetConfig::Avr8TargetConfig() and
          * Avr8::preActivationConfigure() for an example of this.
@@ -100,6 +168,15 @@ namespace Bloom
          */
         bool releasePostDebugSession = false;
 
+        /**
+         * If set, all USB packets exchanged with the debug tool will be recorded to this file, for replaying
+         * without the debug tool (see the "edbg-replay" debug tool). Relative paths are relative to the project
+         * directory.
+         *
+         * Only EDBG-based debug tools support recording.
+         */
+        std::optional<std::string> usbTraceRecordingFilePath;
+
         /**
          * For extracting any debug tool specific configuration.
          */
@@ -125,6 +202,18 @@ namespace Bloom
          */
         std::string name;
 
+        /**
+         * The period (in milliseconds) for which a debug session lingers after the client disconnects.
+         *
+         * Whilst a session is lingering, the TargetController remains in control of the debug tool, breakpoints remain
+         * in place and the target is left in its current state. If a client connects within the period, it picks up
+         * where the previous session left off, without the target being reset. Once the period expires, the usual
+         * end-of-session actions are performed (see DebugToolConfig::releasePostDebugSession).
+         *
+         * A value of 0 disables lingering.
+         */
+        std::uint32_t sessionLingerPeriod = 0;
+
         /**
          * For extracting any debug server specific configuration. See GdbDebugServerConfig::GdbDebugServerConfig() and
          * GdbRspDebugServer::GdbRspDebugServer() for an example of this.
@@ -141,10 +230,62 @@ namespace Bloom
         explicit DebugServerConfig(const YAML::Node& debugServerNode);
     };
 
+    /**
+     * Scheduling parameters for one of Bloom's threads.
+     *
+     * These are applied by the thread itself, once it has started. Threads created by that thread, after the
+     * parameters have been applied, will inherit them.
+     */
+    struct ThreadSchedulingConfig
+    {
+        /**
+         * If set, the thread will be moved to the SCHED_FIFO real-time scheduling policy, with this priority
+         * (1 - 99).
+         *
+         * This typically requires the CAP_SYS_NICE capability, or an RLIMIT_RTPRIO limit that permits the priority.
+         */
+        std::optional<int> realtimePriority;
+
+        /**
+         * If set, the thread's nice value (-20 - 19). Only used when the thread isn't given a real-time priority, or
+         * when the real-time policy couldn't be applied.
+         */
+        std::optional<int> niceValue;
+
+        /**
+         * The indices of the CPUs the thread is permitted to run on. Empty means no restriction.
+         */
+        std::vector<unsigned int> cpuAffinity;
+
+        ThreadSchedulingConfig() = default;
+
+        /**
+         * Obtains config parameters from YAML node.
+         *
+         * @param schedulingNode
+         */
+        explicit ThreadSchedulingConfig(const YAML::Node& schedulingNode);
+    };
+
     struct InsightConfig
     {
         bool insightEnabled = true;
 
+        /**
+         * The maximum number of entries to keep in the history of each register, in the register inspection window.
+         * Once the limit is reached, the oldest entries are discarded.
+         */
+        std::uint32_t registerHistoryCapacity = 100;
+
+        /**
+         * Scheduling parameters for Insight's threads (the GUI thread and the Insight workers).
+         *
+         * By default, Insight runs at a lower priority than the rest of Bloom (a nice value of 10), so that UI load
+         * (rendering, hex viewer construction, etc) doesn't compete with the GDB server and the TargetController for
+         * CPU time. Real-time scheduling is not supported for Insight.
+         */
+        ThreadSchedulingConfig schedulingConfig = InsightConfig::defaultSchedulingConfig();
+
         InsightConfig() = default;
 
         /**
@@ -153,6 +294,13 @@ namespace Bloom
          * @param insightNode
          */
         explicit InsightConfig(const YAML::Node& insightNode);
+
+    private:
+        static ThreadSchedulingConfig defaultSchedulingConfig() {
+            auto config = ThreadSchedulingConfig();
+            config.niceValue = 10;
+            return config;
+        }
     };
 
     /**
@@ -200,6 +348,15 @@ namespace Bloom
          */
         std::optional<InsightConfig> insightConfig;
 
+        /**
+         * Scheduling parameters for the TargetController thread.
+         *
+         * All debug tool communication takes place on the TargetController thread. The TargetController applies
+         * these parameters before it connects to the debug tool, so any USB I/O threads created by the underlying
+         * USB libraries (such as HIDAPI's input report thread) will inherit them.
+         */
+        ThreadSchedulingConfig targetControllerSchedulingConfig;
+
         /**
          * Obtains config parameters from YAML node.
          *
@@ -233,6 +390,38 @@ namespace Bloom
 
         bool debugLoggingEnabled = false;
 
+        /**
+         * If provided, all logs will also be written to this file (in addition to the console). Relative paths are
+         * resolved against the project directory.
+         */
+        std::optional<std::string> logFilePath;
+
+        /**
+         * If provided, latency tracing will be enabled and the trace will be written to this file upon exit, in the
+         * Chrome trace event format. Relative paths are resolved against the project directory.
+         *
+         * See TraceService for more.
+         */
+        std::optional<std::string> traceFilePath;
+
+        /**
+         * If provided, Bloom will serve its runtime performance counters over HTTP, in the OpenMetrics format, on
+         * this port.
+         *
+         * See MetricsExporter for more.
+         */
+        std::optional<std::uint16_t> metricsPortNumber;
+        std::string metricsIpAddress = "127.0.0.1";
+
+        /**
+         * If provided, the symbols in this ELF file will be made available to all components (for resolving
+         * addresses to function and variable names, amongst other things). Relative paths are resolved against the
+         * project directory.
+         *
+         * See SymbolService for more.
+         */
+        std::optional<std::string> elfFilePath;
+
         /**
          * Obtains config parameters from YAML node.
          *
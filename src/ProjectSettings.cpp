@@ -8,16 +8,26 @@
 
 namespace Bloom
 {
-    ProjectSettings::ProjectSettings(const QJsonObject& jsonObject) {
-        if (jsonObject.contains("insight")) {
-            this->insightSettings = InsightProjectSettings(jsonObject.find("insight")->toObject());
+    ProjectSettings::ProjectSettings(const QJsonObject& jsonObject)
+        : jsonObject(jsonObject)
+    {}
+
+    InsightProjectSettings& ProjectSettings::insightSettings() {
+        if (!this->parsedInsightSettings.has_value()) {
+            this->parsedInsightSettings = this->jsonObject.contains("insight")
+                ? InsightProjectSettings(this->jsonObject.find("insight")->toObject())
+                : InsightProjectSettings();
         }
+
+        return *(this->parsedInsightSettings);
     }
 
     QJsonObject ProjectSettings::toJson() const {
-        auto projectSettingsObj = QJsonObject();
+        auto projectSettingsObj = this->jsonObject;
 
-        projectSettingsObj.insert("insight", this->insightSettings.toJson());
+        if (this->parsedInsightSettings.has_value()) {
+            projectSettingsObj.insert("insight", this->parsedInsightSettings->toJson());
+        }
 
         return projectSettingsObj;
     }
@@ -74,21 +84,47 @@ namespace Bloom
             const auto settingsMappingObj = jsonObject.find("memoryInspectionPaneSettings")->toObject();
 
             for (auto settingsIt = settingsMappingObj.begin(); settingsIt != settingsMappingObj.end(); settingsIt++) {
-                const auto settingsObj = settingsIt.value().toObject();
                 const auto memoryTypeName = settingsIt.key();
 
                 if (!EnumToStringMappings::targetMemoryTypes.contains(memoryTypeName)) {
                     continue;
                 }
 
-                this->memoryInspectionPaneSettingsByMemoryType.insert(std::pair(
+                this->unparsedMemoryInspectionPaneSettingsByMemoryType.insert(std::pair(
                     EnumToStringMappings::targetMemoryTypes.at(memoryTypeName),
-                    this->memoryInspectionPaneSettingsFromJson(settingsObj)
+                    settingsIt.value().toObject()
                 ));
             }
         }
     }
 
+    Widgets::TargetMemoryInspectionPaneSettings& InsightProjectSettings::memoryInspectionPaneSettings(
+        Targets::TargetMemoryType memoryType
+    ) {
+        auto settingsIt = this->memoryInspectionPaneSettingsByMemoryType.find(memoryType);
+
+        if (settingsIt == this->memoryInspectionPaneSettingsByMemoryType.end()) {
+            const auto unparsedSettingsIt = this->unparsedMemoryInspectionPaneSettingsByMemoryType.find(memoryType);
+
+            if (unparsedSettingsIt != this->unparsedMemoryInspectionPaneSettingsByMemoryType.end()) {
+                settingsIt = this->memoryInspectionPaneSettingsByMemoryType.insert(std::pair(
+                    memoryType,
+                    this->memoryInspectionPaneSettingsFromJson(unparsedSettingsIt->second)
+                )).first;
+
+                this->unparsedMemoryInspectionPaneSettingsByMemoryType.erase(unparsedSettingsIt);
+
+            } else {
+                settingsIt = this->memoryInspectionPaneSettingsByMemoryType.insert(std::pair(
+                    memoryType,
+                    Widgets::TargetMemoryInspectionPaneSettings()
+                )).first;
+            }
+        }
+
+        return settingsIt->second;
+    }
+
     QJsonObject InsightProjectSettings::toJson() const {
         auto insightObj = QJsonObject();
 
@@ -101,6 +137,10 @@ namespace Bloom
 
         auto memoryInspectionPaneSettingsObj = QJsonObject();
 
+        for (const auto& [memoryType, settingsObj] : this->unparsedMemoryInspectionPaneSettingsByMemoryType) {
+            memoryInspectionPaneSettingsObj.insert(EnumToStringMappings::targetMemoryTypes.at(memoryType), settingsObj);
+        }
+
         for (const auto& [memoryType, inspectionPaneSettings] : this->memoryInspectionPaneSettingsByMemoryType) {
             if (!EnumToStringMappings::targetMemoryTypes.contains(memoryType)) {
                 // This is just a precaution - all known memory types should be in the mapping.
@@ -175,6 +215,16 @@ namespace Bloom
             inspectionPaneSettings.refreshOnActivation = jsonObject.value("refreshOnActivation").toBool();
         }
 
+        if (jsonObject.contains("refreshWhileRunning")) {
+            inspectionPaneSettings.refreshWhileRunning = jsonObject.value("refreshWhileRunning").toBool();
+        }
+
+        if (jsonObject.contains("liveRefreshBandwidthBudget")) {
+            inspectionPaneSettings.liveRefreshBandwidthBudget = static_cast<std::uint32_t>(
+                jsonObject.value("liveRefreshBandwidthBudget").toInteger()
+            );
+        }
+
         if (jsonObject.contains("hexViewerSettings")) {
             auto& hexViewerSettings = inspectionPaneSettings.hexViewerWidgetSettings;
             const auto hexViewerSettingsObj = jsonObject.find("hexViewerSettings")->toObject();
@@ -239,6 +289,17 @@ namespace Bloom
             }
         }
 
+        if (jsonObject.contains("stackCanaryRegion")) {
+            const auto stackCanaryRegionObj = jsonObject.find("stackCanaryRegion")->toObject();
+
+            if (stackCanaryRegionObj.contains("startAddress") && stackCanaryRegionObj.contains("endAddress")) {
+                inspectionPaneSettings.stackCanaryAddressRange = Targets::TargetMemoryAddressRange(
+                    static_cast<std::uint32_t>(stackCanaryRegionObj.find("startAddress")->toInteger()),
+                    static_cast<std::uint32_t>(stackCanaryRegionObj.find("endAddress")->toInteger())
+                );
+            }
+        }
+
         return inspectionPaneSettings;
     }
 
@@ -289,6 +350,8 @@ namespace Bloom
         auto settingsObj = QJsonObject({
             {"refreshOnTargetStop", inspectionPaneSettings.refreshOnTargetStop},
             {"refreshOnActivation", inspectionPaneSettings.refreshOnActivation},
+            {"refreshWhileRunning", inspectionPaneSettings.refreshWhileRunning},
+            {"liveRefreshBandwidthBudget", static_cast<qint64>(inspectionPaneSettings.liveRefreshBandwidthBudget)},
         });
 
         const auto& hexViewerSettings = inspectionPaneSettings.hexViewerWidgetSettings;
@@ -314,6 +377,14 @@ namespace Bloom
         settingsObj.insert("focusedRegions", focusedRegions);
         settingsObj.insert("excludedRegions", excludedRegions);
 
+        if (inspectionPaneSettings.stackCanaryAddressRange.has_value()) {
+            const auto& stackCanaryAddressRange = *(inspectionPaneSettings.stackCanaryAddressRange);
+            settingsObj.insert("stackCanaryRegion", QJsonObject({
+                {"startAddress", static_cast<qint64>(stackCanaryAddressRange.startAddress)},
+                {"endAddress", static_cast<qint64>(stackCanaryAddressRange.endAddress)},
+            }));
+        }
+
         return settingsObj;
     }
 
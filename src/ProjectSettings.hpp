@@ -27,17 +27,35 @@ namespace Bloom
         std::optional<Widgets::PaneState> eepromInspectionPaneState;
         std::optional<Widgets::PaneState> flashInspectionPaneState;
 
-        std::map<
-            Targets::TargetMemoryType,
-            Widgets::TargetMemoryInspectionPaneSettings
-        > memoryInspectionPaneSettingsByMemoryType;
-
         InsightProjectSettings() = default;
         explicit InsightProjectSettings(const QJsonObject& jsonObject);
 
+        /**
+         * Returns the memory inspection pane settings for the given memory type, parsing them from the settings file
+         * upon first access. Default settings are constructed if the settings file has none for the memory type.
+         *
+         * @param memoryType
+         *
+         * @return
+         */
+        Widgets::TargetMemoryInspectionPaneSettings& memoryInspectionPaneSettings(
+            Targets::TargetMemoryType memoryType
+        );
+
         [[nodiscard]] QJsonObject toJson() const;
 
     private:
+        std::map<
+            Targets::TargetMemoryType,
+            Widgets::TargetMemoryInspectionPaneSettings
+        > memoryInspectionPaneSettingsByMemoryType;
+
+        /**
+         * Memory inspection pane settings can hold large numbers of focused and excluded regions, so we only parse
+         * them when the pane is constructed. Until then, we hold on to the JSON, and write it back as is.
+         */
+        std::map<Targets::TargetMemoryType, QJsonObject> unparsedMemoryInspectionPaneSettingsByMemoryType;
+
         static const inline BiMap<Targets::TargetMemoryType, QString> memoryTypesByName = {
             {Targets::TargetMemoryType::RAM, "ram"},
             {Targets::TargetMemoryType::EEPROM, "eeprom"},
@@ -68,11 +86,27 @@ namespace Bloom
 
     struct ProjectSettings
     {
-        InsightProjectSettings insightSettings;
-
         ProjectSettings() = default;
         explicit ProjectSettings(const QJsonObject& jsonObject);
 
+        /**
+         * Returns the Insight settings, parsing them upon first access.
+         *
+         * Bloom can run without Insight (and some CLI commands never need it), so we don't parse the section until
+         * something asks for it.
+         *
+         * @return
+         */
+        InsightProjectSettings& insightSettings();
+
         [[nodiscard]] QJsonObject toJson() const;
+
+    private:
+        /**
+         * The settings file's JSON. Sections that haven't been parsed are written back as they were.
+         */
+        QJsonObject jsonObject;
+
+        std::optional<InsightProjectSettings> parsedInsightSettings;
     };
 }
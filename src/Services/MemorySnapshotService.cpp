@@ -0,0 +1,346 @@
+#include "MemorySnapshotService.hpp"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QStringList>
+#include <map>
+#include <cassert>
+
+#include "src/Services/PathService.hpp"
+#include "src/Targets/SharedTargetMemoryBuffer.hpp"
+#include "src/TargetController/Commands/GetTargetProgramCounter.hpp"
+#include "src/TargetController/Commands/GetTargetStackPointer.hpp"
+#include "src/Helpers/EnumToStringMappings.hpp"
+#include "src/Exceptions/Exception.hpp"
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::Services
+{
+    using Exceptions::Exception;
+
+    QString MemorySnapshotService::snapshotDirPath(Targets::TargetMemoryType memoryType) {
+        return QString::fromStdString(PathService::projectSettingsDirPath()) + "/memory_snapshots/"
+            + EnumToStringMappings::targetMemoryTypes.at(memoryType);
+    }
+
+    MemorySnapshot MemorySnapshotService::capture(
+        TargetControllerService& targetControllerService,
+        const QString& name,
+        const QString& description,
+        Targets::TargetMemoryType memoryType,
+        const std::vector<FocusedMemoryRegion>& focusedRegions,
+        const std::vector<ExcludedMemoryRegion>& excludedRegions,
+        const std::optional<SharedMemoryBuffer>& data,
+        const std::function<void(std::uint8_t)>& progressCallback
+    ) {
+        using Targets::TargetMemorySize;
+
+        Logger::info("Capturing snapshot");
+
+        const auto targetDescriptor = targetControllerService.getTargetDescriptor();
+        const auto memoryDescriptorIt = targetDescriptor->memoryDescriptorsByType.find(memoryType);
+
+        if (memoryDescriptorIt == targetDescriptor->memoryDescriptorsByType.end()) {
+            throw Exception("Invalid memory type");
+        }
+
+        const auto& memoryDescriptor = memoryDescriptorIt->second;
+        const auto memorySize = memoryDescriptor.size();
+
+        auto snapshotData = data;
+
+        if (!snapshotData.has_value()) {
+            Logger::info("Reading data for snapshot capture");
+
+            /*
+             * The whole memory is read via a single command. The TargetController splits the read into chunks and
+             * services other commands in-between, so we don't need to split it here.
+             */
+            // The data is adopted by the snapshot buffer, without being copied
+            snapshotData = SharedMemoryBuffer(Targets::SharedTargetMemoryBuffer(targetControllerService.readMemory(
+                memoryType,
+                memoryDescriptor.addressRange.startAddress,
+                memorySize,
+                {},
+                [&progressCallback, memorySize] (TargetMemorySize bytesRead) {
+                    if (progressCallback) {
+                        progressCallback(static_cast<std::uint8_t>(
+                            (static_cast<std::uint64_t>(bytesRead) * 100) / memorySize
+                        ));
+                    }
+                }
+            )));
+        }
+
+        assert(snapshotData->size() == memorySize);
+
+        // Retrieve the program counter and stack pointer in a single submission
+        using TargetController::Commands::GetTargetProgramCounter;
+        using TargetController::Commands::GetTargetStackPointer;
+
+        auto commandBatch = std::make_unique<TargetController::Commands::CommandBatch>();
+        const auto programCounterIndex = commandBatch->addCommand(std::make_unique<GetTargetProgramCounter>());
+        const auto stackPointerIndex = commandBatch->addCommand(std::make_unique<GetTargetStackPointer>());
+
+        auto batchResponses = targetControllerService.sendCommandBatch(std::move(commandBatch));
+
+        return MemorySnapshot(
+            name,
+            description,
+            memoryType,
+            *snapshotData,
+            batchResponses->takeResponse<GetTargetProgramCounter>(programCounterIndex)->programCounter,
+            batchResponses->takeResponse<GetTargetStackPointer>(stackPointerIndex)->stackPointer,
+            focusedRegions,
+            excludedRegions
+        );
+    }
+
+    QString MemorySnapshotService::store(MemorySnapshot& snapshot, const std::optional<MemorySnapshot>& baseSnapshot) {
+        const auto snapshotDirPath = MemorySnapshotService::snapshotDirPath(snapshot.memoryType);
+        QDir().mkpath(snapshotDirPath);
+
+        const auto snapshotFilePath = snapshotDirPath + "/" + snapshot.id + "."
+            + MemorySnapshot::BINARY_FILE_EXTENSION;
+
+        auto outputFile = QFile(snapshotFilePath);
+
+        if (!outputFile.open(QIODevice::ReadWrite | QIODevice::Truncate)) {
+            throw Exception("Failed to save snapshot - cannot open " + snapshotFilePath.toStdString());
+        }
+
+        auto snapshotBinary = QByteArray();
+
+        if (baseSnapshot.has_value() && baseSnapshot->data.size() == snapshot.data.size()) {
+            snapshotBinary = snapshot.toDeltaBinary(*baseSnapshot);
+
+            if (!snapshotBinary.isEmpty()) {
+                snapshot.baseSnapshotId = baseSnapshot->id;
+                Logger::debug("Storing snapshot as delta of " + baseSnapshot->id.toStdString());
+            }
+        }
+
+        if (snapshotBinary.isEmpty()) {
+            snapshotBinary = snapshot.toBinary();
+        }
+
+        outputFile.write(snapshotBinary);
+        outputFile.close();
+
+        Logger::info("Snapshot captured - UUID: " + snapshot.id.toStdString());
+        return snapshotFilePath;
+    }
+
+    std::optional<MemorySnapshot> MemorySnapshotService::latestFullSnapshot(Targets::TargetMemoryType memoryType) {
+        const auto snapshotDir = QDir(MemorySnapshotService::snapshotDirPath(memoryType));
+
+        if (!snapshotDir.exists()) {
+            return std::nullopt;
+        }
+
+        const auto snapshotFileEntries = snapshotDir.entryInfoList(
+            QStringList({"*." + MemorySnapshot::BINARY_FILE_EXTENSION, "*.json"}),
+            QDir::Files,
+            QDir::SortFlag::Time
+        );
+
+        for (const auto& snapshotFileEntry : snapshotFileEntries) {
+            const auto snapshotFilePath = snapshotFileEntry.absoluteFilePath();
+
+            if (snapshotFilePath.endsWith("." + MemorySnapshot::BINARY_FILE_EXTENSION)) {
+                // Delta snapshots can be identified by their header alone, so there's no need to load them
+                auto snapshotFile = QFile(snapshotFilePath);
+                auto header = MemorySnapshot::BinaryHeader();
+
+                if (
+                    !snapshotFile.open(QIODevice::ReadOnly)
+                    || snapshotFile.read(reinterpret_cast<char*>(&header), sizeof(header)) != sizeof(header)
+                    || header.magic != MemorySnapshot::BINARY_MAGIC
+                    || (header.flags & MemorySnapshot::BINARY_FLAG_DELTA) != 0
+                ) {
+                    continue;
+                }
+            }
+
+            try {
+                return MemorySnapshot::fromFile(snapshotFilePath);
+
+            } catch (const Exception& exception) {
+                Logger::debug(
+                    "Failed to load snapshot " + snapshotFilePath.toStdString() + " - " + exception.getMessage()
+                );
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::vector<MemorySnapshot> MemorySnapshotService::retrieve(Targets::TargetMemoryType memoryType) {
+        const auto snapshotDir = QDir(MemorySnapshotService::snapshotDirPath(memoryType));
+
+        if (!snapshotDir.exists()) {
+            return {};
+        }
+
+        auto snapshots = std::vector<MemorySnapshot>();
+
+        const auto snapshotFileEntries = snapshotDir.entryInfoList(
+            QStringList({"*." + MemorySnapshot::BINARY_FILE_EXTENSION, "*.json"}),
+            QDir::Files,
+            QDir::SortFlag::Time
+        );
+
+        for (const auto& snapshotFileEntry : snapshotFileEntries) {
+            if (snapshots.size() >= MemorySnapshotService::MAX_RETRIEVED_SNAPSHOTS) {
+                const auto memoryTypeName = EnumToStringMappings::targetMemoryTypes.at(memoryType).toUpper();
+
+                Logger::warning(
+                    "The total number of " + memoryTypeName.toStdString() + " snapshots exceeds the hard limit of "
+                        + std::to_string(MemorySnapshotService::MAX_RETRIEVED_SNAPSHOTS) + ". Only the most recent "
+                        + std::to_string(MemorySnapshotService::MAX_RETRIEVED_SNAPSHOTS)
+                        + " snapshots will be loaded."
+                );
+                break;
+            }
+
+            try {
+                snapshots.emplace_back(MemorySnapshot::fromFile(snapshotFileEntry.absoluteFilePath()));
+
+            } catch (const Exception& exception) {
+                Logger::error(
+                    "Failed to load snapshot " + snapshotFileEntry.absoluteFilePath().toStdString() + " - "
+                        + exception.getMessage()
+                );
+            }
+        }
+
+        /*
+         * Reconstruct any delta snapshots from their base snapshots. The base snapshot may not be amongst the loaded
+         * snapshots (if it's beyond the MAX_RETRIEVED_SNAPSHOTS limit), in which case we load it separately.
+         */
+        auto additionalBaseSnapshotsById = std::map<QString, MemorySnapshot>();
+
+        const auto findBaseSnapshot = [&] (const QString& baseSnapshotId) -> const MemorySnapshot& {
+            for (const auto& snapshot : snapshots) {
+                if (snapshot.id == baseSnapshotId) {
+                    return snapshot;
+                }
+            }
+
+            auto baseSnapshotIt = additionalBaseSnapshotsById.find(baseSnapshotId);
+
+            if (baseSnapshotIt == additionalBaseSnapshotsById.end()) {
+                auto baseSnapshotFilePath = snapshotDir.absoluteFilePath(
+                    baseSnapshotId + "." + MemorySnapshot::BINARY_FILE_EXTENSION
+                );
+
+                if (!QFile::exists(baseSnapshotFilePath)) {
+                    baseSnapshotFilePath = snapshotDir.absoluteFilePath(baseSnapshotId + ".json");
+                }
+
+                baseSnapshotIt = additionalBaseSnapshotsById.emplace(
+                    baseSnapshotId,
+                    MemorySnapshot::fromFile(baseSnapshotFilePath)
+                ).first;
+            }
+
+            return baseSnapshotIt->second;
+        };
+
+        for (auto snapshotIt = snapshots.begin(); snapshotIt != snapshots.end();) {
+            if (!snapshotIt->isDeltaPending()) {
+                ++snapshotIt;
+                continue;
+            }
+
+            try {
+                snapshotIt->resolveDelta(findBaseSnapshot(*(snapshotIt->baseSnapshotId)));
+                ++snapshotIt;
+
+            } catch (const Exception& exception) {
+                Logger::error(
+                    "Failed to reconstruct delta snapshot " + snapshotIt->id.toStdString() + " - "
+                        + exception.getMessage()
+                );
+                snapshotIt = snapshots.erase(snapshotIt);
+            }
+        }
+
+        return snapshots;
+    }
+
+    void MemorySnapshotService::remove(const QString& snapshotId, Targets::TargetMemoryType memoryType) {
+        Logger::info("Deleting snapshot " + snapshotId.toStdString());
+
+        const auto snapshotFilePathPrefix = MemorySnapshotService::snapshotDirPath(memoryType) + "/" + snapshotId;
+
+        auto snapshotFilePath = snapshotFilePathPrefix + "." + MemorySnapshot::BINARY_FILE_EXTENSION;
+        auto snapshotFile = QFile(snapshotFilePath);
+
+        if (!snapshotFile.exists()) {
+            // Snapshots captured with older versions of Bloom are stored in JSON files
+            snapshotFilePath = snapshotFilePathPrefix + ".json";
+            snapshotFile.setFileName(snapshotFilePath);
+        }
+
+        if (!snapshotFile.exists()) {
+            Logger::warning(
+                "Could not find snapshot file for " + snapshotId.toStdString() + " - expected path: "
+                    + snapshotFilePath.toStdString()
+            );
+            return;
+        }
+
+        MemorySnapshotService::rewriteDependentSnapshots(snapshotId, snapshotFilePath);
+        snapshotFile.remove();
+    }
+
+    void MemorySnapshotService::rewriteDependentSnapshots(const QString& snapshotId, const QString& snapshotFilePath) {
+        const auto snapshotDir = QFileInfo(snapshotFilePath).dir();
+        const auto snapshotFileEntries = snapshotDir.entryInfoList(
+            QStringList("*." + MemorySnapshot::BINARY_FILE_EXTENSION),
+            QDir::Files
+        );
+
+        auto baseSnapshot = std::optional<MemorySnapshot>();
+
+        for (const auto& snapshotFileEntry : snapshotFileEntries) {
+            const auto dependentFilePath = snapshotFileEntry.absoluteFilePath();
+
+            try {
+                auto snapshot = MemorySnapshot::fromFile(dependentFilePath);
+
+                if (snapshot.baseSnapshotId != snapshotId) {
+                    continue;
+                }
+
+                if (!baseSnapshot.has_value()) {
+                    baseSnapshot = MemorySnapshot::fromFile(snapshotFilePath);
+                }
+
+                Logger::debug(
+                    "Storing snapshot " + snapshot.id.toStdString() + " in full, as its base snapshot is being deleted"
+                );
+
+                snapshot.resolveDelta(*baseSnapshot);
+                snapshot.baseSnapshotId = std::nullopt;
+
+                auto dependentFile = QFile(dependentFilePath);
+
+                if (!dependentFile.open(QIODevice::ReadWrite | QIODevice::Truncate)) {
+                    throw Exception("Failed to open snapshot file");
+                }
+
+                dependentFile.write(snapshot.toBinary());
+                dependentFile.close();
+
+            } catch (const Exception& exception) {
+                Logger::error(
+                    "Failed to rewrite dependent snapshot " + dependentFilePath.toStdString() + " - "
+                        + exception.getMessage()
+                );
+            }
+        }
+    }
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <QString>
+
+#include "src/Services/TargetControllerService.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/MemorySnapshot.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/FocusedMemoryRegion.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/ExcludedMemoryRegion.hpp"
+#include "src/Insight/UserInterfaces/InsightWindow/Widgets/TargetMemoryInspectionPane/SharedMemoryBuffer.hpp"
+
+namespace Bloom::Services
+{
+    /**
+     * Captures, stores, retrieves and deletes memory snapshots.
+     *
+     * Snapshots are stored in the project settings directory, in one subdirectory per memory type, in the binary
+     * snapshot format (see MemorySnapshot::BinaryHeader). This service has no dependency on Insight's widgets, so
+     * that snapshots can be captured from anywhere - Insight's snapshot manager (via the InsightWorker), the GDB
+     * "monitor snapshot" command and the "bloom snapshot" CLI command all use it.
+     *
+     * All functions perform file and/or TargetController I/O, so they should not be called from the GUI thread.
+     */
+    class MemorySnapshotService
+    {
+    public:
+        /**
+         * The maximum number of snapshots (per memory type) loaded by MemorySnapshotService::retrieve().
+         */
+        static constexpr std::size_t MAX_RETRIEVED_SNAPSHOTS = 30;
+
+        /**
+         * Returns the path to the directory in which snapshots of the given memory type are stored.
+         *
+         * @param memoryType
+         *
+         * @return
+         */
+        static QString snapshotDirPath(Targets::TargetMemoryType memoryType);
+
+        /**
+         * Captures a snapshot of the given memory. The snapshot is not stored - see MemorySnapshotService::store().
+         *
+         * @param targetControllerService
+         * @param name
+         * @param description
+         * @param memoryType
+         * @param focusedRegions
+         * @param excludedRegions
+         *
+         * @param data
+         *  The memory data to capture. If not provided, the entire memory is read from the target, via a single bulk
+         *  read.
+         *
+         * @param progressCallback
+         *  If provided, invoked with the percentage of the memory that has been read, throughout the read.
+         *
+         * @return
+         */
+        static MemorySnapshot capture(
+            TargetControllerService& targetControllerService,
+            const QString& name,
+            const QString& description,
+            Targets::TargetMemoryType memoryType,
+            const std::vector<FocusedMemoryRegion>& focusedRegions,
+            const std::vector<ExcludedMemoryRegion>& excludedRegions,
+            const std::optional<SharedMemoryBuffer>& data = std::nullopt,
+            const std::function<void(std::uint8_t)>& progressCallback = {}
+        );
+
+        /**
+         * Writes a snapshot to its file.
+         *
+         * @param snapshot
+         *  If the snapshot is stored as a delta, its MemorySnapshot::baseSnapshotId will be set accordingly.
+         *
+         * @param baseSnapshot
+         *  If provided, the snapshot will be stored as a delta of this snapshot, where worthwhile.
+         *
+         * @throws Exceptions::Exception
+         *  If the snapshot file could not be written.
+         *
+         * @return
+         *  The path of the snapshot file.
+         */
+        static QString store(MemorySnapshot& snapshot, const std::optional<MemorySnapshot>& baseSnapshot);
+
+        /**
+         * Loads the most recently captured full (non-delta) snapshot of the given memory type, for use as the base
+         * of a new delta snapshot. Only the headers of newer (delta) snapshot files are read.
+         *
+         * @param memoryType
+         *
+         * @return
+         *  The snapshot, or std::nullopt if there is no full snapshot of the given memory type.
+         */
+        static std::optional<MemorySnapshot> latestFullSnapshot(Targets::TargetMemoryType memoryType);
+
+        /**
+         * Loads the most recent snapshots (up to MemorySnapshotService::MAX_RETRIEVED_SNAPSHOTS) of the given memory
+         * type, with any delta snapshots resolved against their base snapshots.
+         *
+         * Snapshots that fail to load are logged and skipped.
+         *
+         * @param memoryType
+         *
+         * @return
+         */
+        static std::vector<MemorySnapshot> retrieve(Targets::TargetMemoryType memoryType);
+
+        /**
+         * Deletes a snapshot. Any delta snapshots that use the snapshot as their base are rewritten in full, first.
+         *
+         * @param snapshotId
+         * @param memoryType
+         */
+        static void remove(const QString& snapshotId, Targets::TargetMemoryType memoryType);
+
+    private:
+        /**
+         * Stores any delta snapshots that use the snapshot being deleted as their base, in full.
+         *
+         * @param snapshotId
+         * @param snapshotFilePath
+         *  The file path of the snapshot being deleted.
+         */
+        static void rewriteDependentSnapshots(const QString& snapshotId, const QString& snapshotFilePath);
+    };
+}
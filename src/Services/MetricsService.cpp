@@ -0,0 +1,174 @@
+#include "MetricsService.hpp"
+
+#include <bit>
+#include <cmath>
+#include <algorithm>
+#include <cctype>
+
+namespace Bloom::Services
+{
+    void MetricsService::Histogram::record(std::uint64_t value) {
+        this->buckets[static_cast<std::size_t>(std::bit_width(value))].fetch_add(1, std::memory_order_relaxed);
+        this->count.fetch_add(1, std::memory_order_relaxed);
+        this->sum.fetch_add(value, std::memory_order_relaxed);
+
+        auto currentMax = this->max.load(std::memory_order_relaxed);
+        while (
+            value > currentMax
+            && !this->max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)
+        ) {}
+    }
+
+    std::uint64_t MetricsService::Histogram::getPercentile(double percentile) const {
+        const auto count = this->getCount();
+        if (count == 0) {
+            return 0;
+        }
+
+        const auto rank = std::max(
+            static_cast<std::uint64_t>(std::ceil(static_cast<double>(count) * percentile / 100)),
+            std::uint64_t(1)
+        );
+
+        auto cumulativeCount = std::uint64_t(0);
+        for (auto bucketIndex = std::size_t(0); bucketIndex < BUCKET_COUNT; ++bucketIndex) {
+            cumulativeCount += this->buckets[bucketIndex].load(std::memory_order_relaxed);
+
+            if (cumulativeCount >= rank) {
+                const auto upperBound = bucketIndex == 0
+                    ? std::uint64_t(0)
+                    : bucketIndex == 64 ? UINT64_MAX : (std::uint64_t(1) << bucketIndex) - 1;
+
+                return std::min(upperBound, this->getMax());
+            }
+        }
+
+        return this->getMax();
+    }
+
+    MetricsService::Counter& MetricsService::counter(const std::string& name) {
+        const auto lock = std::unique_lock(MetricsService::registryMutex);
+        return MetricsService::counters.try_emplace(name).first->second;
+    }
+
+    MetricsService::Histogram& MetricsService::histogram(const std::string& name) {
+        const auto lock = std::unique_lock(MetricsService::registryMutex);
+        return MetricsService::histograms.try_emplace(name).first->second;
+    }
+
+    std::string MetricsService::generateReport() {
+        const auto lock = std::unique_lock(MetricsService::registryMutex);
+
+        auto nameWidth = std::size_t(0);
+        for (const auto& [name, counter] : MetricsService::counters) {
+            nameWidth = std::max(nameWidth, name.size());
+        }
+
+        for (const auto& [name, histogram] : MetricsService::histograms) {
+            nameWidth = std::max(nameWidth, name.size());
+        }
+
+        const auto pad = [nameWidth] (const std::string& name) {
+            return "  " + name + std::string(nameWidth - name.size() + 2, ' ');
+        };
+
+        auto output = std::string("Counters:\n");
+
+        if (MetricsService::counters.empty()) {
+            output += "  None\n";
+        }
+
+        for (const auto& [name, counter] : MetricsService::counters) {
+            output += pad(name) + std::to_string(counter.getValue()) + "\n";
+        }
+
+        output += "\nHistograms (count, mean, ~p50, ~p99, max):\n";
+
+        if (MetricsService::histograms.empty()) {
+            output += "  None\n";
+        }
+
+        for (const auto& [name, histogram] : MetricsService::histograms) {
+            const auto count = histogram.getCount();
+
+            output += pad(name) + std::to_string(count) + ", "
+                + std::to_string(count > 0 ? histogram.getSum() / count : 0) + ", "
+                + std::to_string(histogram.getPercentile(50)) + ", "
+                + std::to_string(histogram.getPercentile(99)) + ", "
+                + std::to_string(histogram.getMax()) + "\n";
+        }
+
+        return output;
+    }
+
+    std::string MetricsService::generateOpenMetricsReport() {
+        const auto lock = std::unique_lock(MetricsService::registryMutex);
+
+        auto output = std::string();
+
+        for (const auto& [name, counter] : MetricsService::counters) {
+            const auto metricName = MetricsService::toOpenMetricsName(name);
+
+            output += "# TYPE " + metricName + " counter\n";
+            output += metricName + "_total " + std::to_string(counter.getValue()) + "\n";
+        }
+
+        for (const auto& [name, histogram] : MetricsService::histograms) {
+            const auto metricName = MetricsService::toOpenMetricsName(name);
+
+            /*
+             * The buckets are read individually, so we derive the count from them, to ensure that the count is
+             * consistent with the cumulative bucket values.
+             */
+            auto bucketValues = std::array<std::uint64_t, Histogram::BUCKET_COUNT>();
+            auto totalCount = std::uint64_t(0);
+            auto usedBucketCount = std::size_t(0);
+
+            for (auto bucketIndex = std::size_t(0); bucketIndex < Histogram::BUCKET_COUNT; ++bucketIndex) {
+                bucketValues[bucketIndex] = histogram.getBucketValue(bucketIndex);
+                totalCount += bucketValues[bucketIndex];
+
+                if (bucketValues[bucketIndex] > 0) {
+                    usedBucketCount = bucketIndex + 1;
+                }
+            }
+
+            output += "# TYPE " + metricName + " histogram\n";
+
+            // We omit the trailing empty buckets, as well as the final bucket, which is covered by the +Inf bucket
+            const auto finiteBucketCount = std::min(usedBucketCount, Histogram::BUCKET_COUNT - 1);
+            auto cumulativeCount = std::uint64_t(0);
+
+            for (auto bucketIndex = std::size_t(0); bucketIndex < finiteBucketCount; ++bucketIndex) {
+                cumulativeCount += bucketValues[bucketIndex];
+
+                // Bucket n holds values up to (and including) 2^n - 1
+                const auto upperBound = bucketIndex == 0 ? std::uint64_t(0) : (std::uint64_t(1) << bucketIndex) - 1;
+                output += metricName + "_bucket{le=\"" + std::to_string(upperBound) + "\"} "
+                    + std::to_string(cumulativeCount) + "\n";
+            }
+
+            output += metricName + "_bucket{le=\"+Inf\"} " + std::to_string(totalCount) + "\n";
+            output += metricName + "_count " + std::to_string(totalCount) + "\n";
+            output += metricName + "_sum " + std::to_string(histogram.getSum()) + "\n";
+        }
+
+        output += "# EOF\n";
+        return output;
+    }
+
+    std::string MetricsService::toOpenMetricsName(const std::string& name) {
+        auto output = "bloom_" + name;
+
+        std::replace_if(
+            output.begin(),
+            output.end(),
+            [] (char character) {
+                return !std::isalnum(static_cast<unsigned char>(character)) && character != '_';
+            },
+            '_'
+        );
+
+        return output;
+    }
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <array>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+
+namespace Bloom::Services
+{
+    /**
+     * A registry of runtime performance counters and histograms.
+     *
+     * Metrics are created upon first lookup, and live for the lifetime of the application. Lookups are guarded by a
+     * mutex, so hot paths should look up a metric once and keep the reference (e.g. in a function-local static):
+     *
+     *   static auto& reportsSent = MetricsService::counter("usb.reportsSent");
+     *   reportsSent.increment();
+     *
+     * Updating a metric is lock-free. The metrics can be queried from GDB, via the "monitor stats" command.
+     */
+    class MetricsService
+    {
+    public:
+        class Counter
+        {
+        public:
+            void increment(std::uint64_t value = 1) {
+                this->value.fetch_add(value, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] std::uint64_t getValue() const {
+                return this->value.load(std::memory_order_relaxed);
+            }
+
+        private:
+            std::atomic<std::uint64_t> value = 0;
+        };
+
+        /**
+         * Records the distribution of a value, across power-of-two buckets. Bucket n holds values in the range
+         * [2^(n - 1), 2^n), with bucket 0 holding zeros.
+         */
+        class Histogram
+        {
+        public:
+            static constexpr std::size_t BUCKET_COUNT = 65;
+
+            void record(std::uint64_t value);
+
+            void recordDuration(std::chrono::steady_clock::duration duration) {
+                this->record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(duration).count()
+                ));
+            }
+
+            [[nodiscard]] std::uint64_t getCount() const {
+                return this->count.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] std::uint64_t getSum() const {
+                return this->sum.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] std::uint64_t getMax() const {
+                return this->max.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] std::uint64_t getBucketValue(std::size_t bucketIndex) const {
+                return this->buckets[bucketIndex].load(std::memory_order_relaxed);
+            }
+
+            /**
+             * Approximates the given percentile, as the upper bound of the bucket in which it falls.
+             *
+             * @param percentile
+             *  Between 0 and 100.
+             *
+             * @return
+             */
+            [[nodiscard]] std::uint64_t getPercentile(double percentile) const;
+
+        private:
+            std::atomic<std::uint64_t> count = 0;
+            std::atomic<std::uint64_t> sum = 0;
+            std::atomic<std::uint64_t> max = 0;
+            std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> buckets = {};
+        };
+
+        /**
+         * Looks up a counter, creating it if it doesn't already exist.
+         *
+         * @param name
+         *
+         * @return
+         *  The returned reference remains valid for the lifetime of the application.
+         */
+        static Counter& counter(const std::string& name);
+
+        /**
+         * Looks up a histogram, creating it if it doesn't already exist. Durations are recorded in microseconds, and
+         * the names of duration histograms should end in "Us", by convention.
+         *
+         * @param name
+         *
+         * @return
+         *  The returned reference remains valid for the lifetime of the application.
+         */
+        static Histogram& histogram(const std::string& name);
+
+        /**
+         * Produces a human-readable report of all metrics, ordered by name.
+         *
+         * @return
+         */
+        static std::string generateReport();
+
+        /**
+         * Produces a report of all metrics, in the OpenMetrics text format
+         * (https://github.com/OpenObservability/OpenMetrics/blob/main/specification/OpenMetrics.md).
+         *
+         * Metric names are prefixed with "bloom_", and any characters that aren't permitted in OpenMetrics metric
+         * names are replaced with underscores ("usb.reportsSent" becomes "bloom_usb_reportsSent").
+         *
+         * @return
+         */
+        static std::string generateOpenMetricsReport();
+
+    private:
+        static inline std::mutex registryMutex;
+
+        /*
+         * std::map never relocates its elements, so references to them remain valid as the registry grows.
+         */
+        static inline std::map<std::string, Counter> counters;
+        static inline std::map<std::string, Histogram> histograms;
+
+        static std::string toOpenMetricsName(const std::string& name);
+    };
+}
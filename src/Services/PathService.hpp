@@ -60,6 +60,17 @@ namespace Bloom::Services
             return PathService::projectSettingsDirPath() + "/settings.json";
         }
 
+        /**
+         * Returns the path to the current project's cache directory.
+         *
+         * The cache directory holds files that Bloom can regenerate at any time. It's safe to delete.
+         *
+         * @return
+         */
+        static std::string projectCacheDirPath() {
+            return PathService::projectSettingsDirPath() + "/cache";
+        }
+
         /**
          * Returns the path to Bloom's compiled resources.
          *
@@ -0,0 +1,128 @@
+#include "ProjectSettingsService.hpp"
+
+#include <pthread.h>
+#include <QFile>
+#include <QSaveFile>
+#include <QDir>
+#include <QJsonDocument>
+
+#include "PathService.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::Services
+{
+    using Exceptions::Exception;
+
+    ProjectSettings ProjectSettingsService::load() {
+        const auto projectSettingsPath = PathService::projectSettingsPath();
+        auto jsonSettingsFile = QFile(QString::fromStdString(projectSettingsPath));
+
+        if (jsonSettingsFile.exists()) {
+            try {
+                if (!jsonSettingsFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+                    throw Exception("Failed to open settings file.");
+                }
+
+                const auto document = jsonSettingsFile.readAll();
+                jsonSettingsFile.close();
+
+                {
+                    const auto lock = std::unique_lock(ProjectSettingsService::mutex);
+                    ProjectSettingsService::lastDocument = document;
+                }
+
+                return ProjectSettings(QJsonDocument::fromJson(document).object());
+
+            } catch (const std::exception& exception) {
+                Logger::error(
+                    "Failed to load project settings from " + projectSettingsPath + " - " + exception.what()
+                );
+            }
+        }
+
+        return ProjectSettings();
+    }
+
+    void ProjectSettingsService::save(const ProjectSettings& projectSettings) {
+        auto document = QJsonDocument(projectSettings.toJson()).toJson();
+
+        {
+            const auto lock = std::unique_lock(ProjectSettingsService::mutex);
+
+            if (
+                ProjectSettingsService::pendingDocument.has_value()
+                    ? *(ProjectSettingsService::pendingDocument) == document
+                    : ProjectSettingsService::lastDocument == document
+            ) {
+                return;
+            }
+
+            ProjectSettingsService::pendingDocument = std::move(document);
+        }
+
+        if (!ProjectSettingsService::writerRunning.exchange(true)) {
+            ProjectSettingsService::writerThread = std::thread(&ProjectSettingsService::runWriter);
+        }
+
+        ProjectSettingsService::writerNotifier.notify();
+    }
+
+    void ProjectSettingsService::shutdown() {
+        if (ProjectSettingsService::writerRunning.exchange(false)) {
+            ProjectSettingsService::writerNotifier.notify();
+
+            if (ProjectSettingsService::writerThread.joinable()) {
+                ProjectSettingsService::writerThread.join();
+            }
+        }
+
+        ProjectSettingsService::writePendingDocument();
+    }
+
+    void ProjectSettingsService::runWriter() {
+        ::pthread_setname_np(::pthread_self(), "PS");
+
+        while (ProjectSettingsService::writerRunning) {
+            ProjectSettingsService::writerNotifier.waitForNotification(ProjectSettingsService::WRITE_INTERVAL);
+            ProjectSettingsService::writePendingDocument();
+        }
+    }
+
+    void ProjectSettingsService::writePendingDocument() {
+        auto document = QByteArray();
+
+        {
+            const auto lock = std::unique_lock(ProjectSettingsService::mutex);
+
+            if (!ProjectSettingsService::pendingDocument.has_value()) {
+                return;
+            }
+
+            document = std::move(*(ProjectSettingsService::pendingDocument));
+            ProjectSettingsService::pendingDocument = std::nullopt;
+        }
+
+        const auto projectSettingsPath = PathService::projectSettingsPath();
+        Logger::debug("Saving project settings to " + projectSettingsPath);
+
+        QDir().mkpath(QString::fromStdString(PathService::projectSettingsDirPath()));
+
+        auto jsonSettingsFile = QSaveFile(QString::fromStdString(projectSettingsPath));
+
+        if (
+            !jsonSettingsFile.open(QIODevice::WriteOnly | QIODevice::Text)
+            || jsonSettingsFile.write(document) != document.size()
+            || !jsonSettingsFile.commit()
+        ) {
+            Logger::error(
+                "Failed to save project settings to " + projectSettingsPath + " - "
+                    + jsonSettingsFile.errorString().toStdString() + ". Check file permissions."
+            );
+            return;
+        }
+
+        const auto lock = std::unique_lock(ProjectSettingsService::mutex);
+        ProjectSettingsService::lastDocument = std::move(document);
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <optional>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <QByteArray>
+
+#include "src/ProjectSettings.hpp"
+#include "src/Helpers/ConditionVariableNotifier.hpp"
+
+namespace Bloom::Services
+{
+    /**
+     * Loads and saves the project settings file.
+     *
+     * Saving is done in two steps: the settings are serialised on the calling thread (the thread that owns the
+     * settings object), and the resulting document is written to the settings file on a background thread. Saves
+     * are coalesced - if a save is requested whilst another is still pending, only the latest document is written.
+     * Documents that are identical to the one last written are discarded, so frequent saves are cheap.
+     *
+     * The settings file is written atomically (via a temporary file that's renamed over the settings file), so an
+     * interrupted write will never leave a truncated settings file behind.
+     */
+    class ProjectSettingsService
+    {
+    public:
+        /**
+         * Reads the project settings file. Only the JSON document is parsed here - the individual sections are
+         * parsed upon first access (see ProjectSettings::insightSettings()).
+         *
+         * @return
+         *  Default settings if the settings file doesn't exist or could not be read.
+         */
+        static ProjectSettings load();
+
+        /**
+         * Serialises the given settings and queues the document for writing.
+         *
+         * @param projectSettings
+         */
+        static void save(const ProjectSettings& projectSettings);
+
+        /**
+         * Writes any pending document and stops the background writer thread.
+         */
+        static void shutdown();
+
+    private:
+        static constexpr auto WRITE_INTERVAL = std::chrono::milliseconds(1000);
+
+        static inline std::mutex mutex;
+        static inline std::optional<QByteArray> pendingDocument;
+        static inline QByteArray lastDocument;
+
+        static inline std::thread writerThread;
+        static inline std::atomic<bool> writerRunning = false;
+        static inline ConditionVariableNotifier writerNotifier;
+
+        /**
+         * Writes pending documents until ProjectSettingsService::shutdown() is called. Runs on the writer thread.
+         */
+        static void runWriter();
+
+        static void writePendingDocument();
+    };
+}
@@ -0,0 +1,120 @@
+#include "StartupProfilingService.hpp"
+
+#include <array>
+#include <algorithm>
+#include <cstdio>
+#include <pthread.h>
+
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::Services
+{
+    StartupProfilingService::ScopedPhase::ScopedPhase(std::string_view name) {
+        if (!StartupProfilingService::isEnabled()) {
+            return;
+        }
+
+        auto threadName = std::array<char, 16>();
+        ::pthread_getname_np(::pthread_self(), threadName.data(), threadName.size());
+
+        const auto lock = std::unique_lock(StartupProfilingService::phasesMutex);
+        const auto& parentPhaseIndex = StartupProfilingService::activePhaseIndex;
+
+        this->phaseIndex = StartupProfilingService::phases.size();
+        this->parentPhaseIndex = parentPhaseIndex;
+
+        StartupProfilingService::phases.emplace_back(Phase{
+            .name = std::string(name),
+            .threadName = std::string(threadName.data()),
+            .depth = parentPhaseIndex.has_value() ? StartupProfilingService::phases[*parentPhaseIndex].depth + 1 : 0,
+            .startTime = std::chrono::steady_clock::now(),
+            .endTime = std::nullopt,
+        });
+
+        StartupProfilingService::activePhaseIndex = this->phaseIndex;
+    }
+
+    StartupProfilingService::ScopedPhase::~ScopedPhase() {
+        if (!this->phaseIndex.has_value()) {
+            return;
+        }
+
+        /*
+         * We record the end of the phase even if startup has been completed since it began, so that the phase
+         * isn't reported as incomplete if the report is generated again.
+         */
+        const auto lock = std::unique_lock(StartupProfilingService::phasesMutex);
+        StartupProfilingService::phases[*this->phaseIndex].endTime = std::chrono::steady_clock::now();
+        StartupProfilingService::activePhaseIndex = this->parentPhaseIndex;
+    }
+
+    void StartupProfilingService::enable() {
+        const auto lock = std::unique_lock(StartupProfilingService::phasesMutex);
+        StartupProfilingService::startTime = std::chrono::steady_clock::now();
+        StartupProfilingService::enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void StartupProfilingService::complete() {
+        if (!StartupProfilingService::enabled.exchange(false, std::memory_order_relaxed)) {
+            return;
+        }
+
+        Logger::info("Startup profile:\n" + StartupProfilingService::generateReport());
+    }
+
+    std::string StartupProfilingService::generateReport() {
+        const auto lock = std::unique_lock(StartupProfilingService::phasesMutex);
+        const auto now = std::chrono::steady_clock::now();
+
+        const auto toMilliseconds = [] (std::chrono::steady_clock::duration duration) {
+            auto output = std::array<char, 32>();
+            std::snprintf(
+                output.data(),
+                output.size(),
+                "%.1f ms",
+                std::chrono::duration<double, std::milli>(duration).count()
+            );
+
+            return std::string(output.data());
+        };
+
+        // Threads are listed in the order in which they began their first phase
+        auto threadNames = std::vector<std::string>();
+        auto labelWidth = std::size_t(0);
+
+        for (const auto& phase : StartupProfilingService::phases) {
+            if (std::find(threadNames.begin(), threadNames.end(), phase.threadName) == threadNames.end()) {
+                threadNames.push_back(phase.threadName);
+            }
+
+            labelWidth = std::max(labelWidth, (phase.depth * 2) + phase.name.size());
+        }
+
+        auto output = std::string();
+
+        if (StartupProfilingService::phases.empty()) {
+            output += "  No phases recorded\n";
+        }
+
+        for (const auto& threadName : threadNames) {
+            output += "  Thread \"" + threadName + "\":\n";
+
+            // Phases were recorded in the order in which they began, which places every phase after its parent
+            for (const auto& phase : StartupProfilingService::phases) {
+                if (phase.threadName != threadName) {
+                    continue;
+                }
+
+                const auto label = std::string(phase.depth * 2, ' ') + phase.name;
+                const auto duration = phase.endTime.has_value()
+                    ? toMilliseconds(*phase.endTime - phase.startTime)
+                    : toMilliseconds(now - phase.startTime) + " (incomplete)";
+
+                output += "    " + label + std::string(labelWidth - label.size() + 2, ' ') + duration + " (at +"
+                    + toMilliseconds(phase.startTime - StartupProfilingService::startTime) + ")\n";
+            }
+        }
+
+        return output;
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+
+namespace Bloom::Services
+{
+    /**
+     * Records the duration of each phase of Bloom's startup, across all threads, for the startup profiling report
+     * (requested via the "--profile-startup" argument).
+     *
+     * Phases are recorded with ScopedPhase objects, which time the scope in which they're declared:
+     *
+     *   const auto phase = StartupProfilingService::ScopedPhase("Activate target");
+     *
+     * A phase that begins whilst another phase is active on the same thread is nested within it. When profiling is
+     * disabled (the default), constructing a ScopedPhase costs a single atomic load.
+     */
+    class StartupProfilingService
+    {
+    public:
+        class ScopedPhase
+        {
+        public:
+            explicit ScopedPhase(std::string_view name);
+            ~ScopedPhase();
+
+            ScopedPhase(const ScopedPhase& other) = delete;
+            ScopedPhase(ScopedPhase&& other) = delete;
+
+            ScopedPhase& operator = (const ScopedPhase& other) = delete;
+            ScopedPhase& operator = (ScopedPhase&& other) = delete;
+
+        private:
+            std::optional<std::size_t> phaseIndex;
+            std::optional<std::size_t> parentPhaseIndex;
+        };
+
+        /**
+         * Starts recording phases. Phase offsets in the report are relative to the time of this call.
+         */
+        static void enable();
+
+        [[nodiscard]] static bool isEnabled() {
+            return StartupProfilingService::enabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Marks the end of startup - stops recording phases and logs the report. Has no effect if profiling is
+         * disabled, or if startup has already been completed.
+         */
+        static void complete();
+
+        /**
+         * Produces a human-readable report of all recorded phases, grouped by thread and nested by phase.
+         *
+         * @return
+         */
+        static std::string generateReport();
+
+    private:
+        struct Phase
+        {
+            std::string name;
+            std::string threadName;
+            std::size_t depth = 0;
+            std::chrono::steady_clock::time_point startTime;
+            std::optional<std::chrono::steady_clock::time_point> endTime;
+        };
+
+        static inline std::atomic<bool> enabled = false;
+        static inline std::chrono::steady_clock::time_point startTime;
+
+        static inline std::mutex phasesMutex;
+        static inline std::vector<Phase> phases;
+
+        /**
+         * The innermost active phase on the current thread, if any.
+         */
+        static inline thread_local std::optional<std::size_t> activePhaseIndex;
+    };
+}
@@ -2,8 +2,8 @@
 
 #include <algorithm>
 #include <cctype>
-#include <sstream>
-#include <iomanip>
+
+#include "src/Helpers/HexCodec.hpp"
 
 namespace Bloom::Services
 {
@@ -38,30 +38,18 @@ namespace Bloom::Services
     }
 
     std::string StringService::toHex(unsigned char value) {
-        auto stream = std::stringstream();
-        stream << std::hex << std::setfill('0') << std::setw(2) << static_cast<unsigned int>(value);
-        return stream.str();
+        auto output = std::string(2, '\0');
+        HexCodec::encodeByte(value, reinterpret_cast<unsigned char*>(output.data()));
+        return output;
     }
 
     std::string StringService::toHex(const std::vector<unsigned char>& data) {
-        auto stream = std::stringstream();
-        stream << std::hex << std::setfill('0');
-
-        for (const auto& byte : data) {
-            stream << std::setw(2) << static_cast<unsigned int>(byte);
-        }
-
-        return stream.str();
+        return HexCodec::encode(data);
     }
 
     std::string StringService::toHex(const std::string& data) {
-        std::stringstream stream;
-        stream << std::hex << std::setfill('0');
-
-        for (const auto& byte : data) {
-            stream << std::setw(2) << static_cast<unsigned int>(byte);
-        }
-
-        return stream.str();
+        return HexCodec::encode(
+            std::span(reinterpret_cast<const unsigned char*>(data.data()), data.size())
+        );
     }
 }
@@ -0,0 +1,174 @@
+#include "SymbolService.hpp"
+
+#include <filesystem>
+#include <system_error>
+#include <csignal>
+#include <pthread.h>
+
+#include "PathService.hpp"
+#include "TraceService.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::Services
+{
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAddress;
+
+    void SymbolService::configure(const ProjectConfig& projectConfig) {
+        if (!projectConfig.elfFilePath.has_value()) {
+            return;
+        }
+
+        SymbolService::load(projectConfig.elfFilePath.value());
+    }
+
+    void SymbolService::load(const std::string& elfFilePath) {
+        SymbolService::shutdown();
+
+        auto resolvedElfFilePath = std::filesystem::path(elfFilePath);
+        if (resolvedElfFilePath.is_relative()) {
+            resolvedElfFilePath = std::filesystem::path(PathService::projectDirPath()) / resolvedElfFilePath;
+        }
+
+        SymbolService::watching = true;
+        SymbolService::watcherThread = std::thread(&SymbolService::watch, resolvedElfFilePath.string());
+    }
+
+    void SymbolService::shutdown() {
+        if (!SymbolService::watcherThread.joinable()) {
+            return;
+        }
+
+        SymbolService::watching = false;
+        SymbolService::watcherNotifier.notify();
+        SymbolService::watcherThread.join();
+    }
+
+    std::shared_ptr<const ElfSymbolTable> SymbolService::symbolTable() {
+        const auto lock = std::unique_lock(SymbolService::mutex);
+        return SymbolService::currentSymbolTable;
+    }
+
+    std::shared_ptr<const DwarfLineTable> SymbolService::lineTable() {
+        const auto lock = std::unique_lock(SymbolService::mutex);
+        return SymbolService::currentLineTable;
+    }
+
+    std::optional<SymbolService::Symbol> SymbolService::symbolAt(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress address
+    ) {
+        const auto symbolTable = SymbolService::symbolTable();
+        const auto offsetIt = SymbolService::ELF_MEMORY_OFFSETS.find(memoryType);
+
+        if (symbolTable == nullptr || offsetIt == SymbolService::ELF_MEMORY_OFFSETS.end()) {
+            return std::nullopt;
+        }
+
+        const auto elfAddress = address | offsetIt->second;
+
+        if (memoryType == TargetMemoryType::FLASH) {
+            if (const auto functionSymbol = symbolTable->find(elfAddress)) {
+                return SymbolService::toSymbol(functionSymbol->get());
+            }
+        }
+
+        if (const auto objectSymbol = symbolTable->findObjectAt(elfAddress)) {
+            return SymbolService::toSymbol(objectSymbol->get());
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<SymbolService::Symbol> SymbolService::symbolByName(const std::string& name) {
+        const auto symbolTable = SymbolService::symbolTable();
+
+        if (symbolTable == nullptr) {
+            return std::nullopt;
+        }
+
+        if (const auto symbol = symbolTable->findByName(name)) {
+            return SymbolService::toSymbol(symbol->get());
+        }
+
+        return std::nullopt;
+    }
+
+    void SymbolService::watch(std::string elfFilePath) {
+        ::pthread_setname_np(::pthread_self(), "SYM");
+
+        /*
+         * The watcher thread can be started before the main thread blocks signals. Signals are read by the
+         * SignalHandler, via signalfd, so they must be blocked here (see Thread::blockAllSignals()).
+         */
+        auto signalSet = sigset_t{};
+        ::sigfillset(&signalSet);
+        ::pthread_sigmask(SIG_SETMASK, &signalSet, nullptr);
+
+        auto lastWriteTime = std::optional<std::filesystem::file_time_type>();
+        auto lastFileSize = std::uintmax_t(0);
+
+        while (SymbolService::watching) {
+            auto errorCode = std::error_code();
+            const auto writeTime = std::filesystem::last_write_time(elfFilePath, errorCode);
+            const auto fileSize = errorCode ? 0 : std::filesystem::file_size(elfFilePath, errorCode);
+
+            if (!errorCode && (!lastWriteTime.has_value() || *lastWriteTime != writeTime || lastFileSize != fileSize)) {
+                const auto reload = lastWriteTime.has_value();
+                lastWriteTime = writeTime;
+                lastFileSize = fileSize;
+
+                try {
+                    const auto traceSpan = TraceService::Span("SymbolService::load", "SYM");
+                    auto symbolTable = std::make_shared<const ElfSymbolTable>(ElfSymbolTable::fromFile(elfFilePath));
+                    auto lineTable = std::shared_ptr<const DwarfLineTable>();
+
+                    try {
+                        lineTable = std::make_shared<const DwarfLineTable>(DwarfLineTable::fromFile(elfFilePath));
+
+                    } catch (const Exceptions::Exception& exception) {
+                        // Not every build has debug information - source-line stepping just won't be available
+                        Logger::debug(exception.getMessage());
+                    }
+
+                    {
+                        const auto lock = std::unique_lock(SymbolService::mutex);
+                        SymbolService::currentSymbolTable = std::move(symbolTable);
+                        SymbolService::currentLineTable = std::move(lineTable);
+                    }
+
+                    Logger::info(std::string(reload ? "Reloaded" : "Loaded") + " symbols from " + elfFilePath);
+
+                } catch (const Exceptions::Exception& exception) {
+                    /*
+                     * The file may have been caught mid-write - we keep the current index, and try again when the file
+                     * changes next.
+                     */
+                    Logger::warning(exception.getMessage());
+                }
+            }
+
+            SymbolService::watcherNotifier.waitForNotification(SymbolService::RELOAD_CHECK_INTERVAL);
+        }
+    }
+
+    SymbolService::Symbol SymbolService::toSymbol(const ElfSymbolTable::Symbol& elfSymbol) {
+        auto symbol = Symbol();
+        symbol.name = elfSymbol.name;
+        symbol.size = elfSymbol.size;
+
+        // The address belongs to the memory with the largest offset that doesn't exceed it
+        auto memoryOffset = std::uint32_t(0);
+
+        for (const auto& [memoryType, offset] : SymbolService::ELF_MEMORY_OFFSETS) {
+            if (elfSymbol.startAddress >= offset && offset >= memoryOffset) {
+                symbol.memoryType = memoryType;
+                memoryOffset = offset;
+            }
+        }
+
+        symbol.startAddress = elfSymbol.startAddress - memoryOffset;
+        return symbol;
+    }
+}
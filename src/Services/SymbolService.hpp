@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <map>
+
+#include "src/ProjectConfig.hpp"
+#include "src/ProgramImage/ElfSymbolTable.hpp"
+#include "src/ProgramImage/DwarfLineTable.hpp"
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Helpers/ConditionVariableNotifier.hpp"
+
+namespace Bloom::Services
+{
+    /**
+     * A shared index of the symbols in the user's ELF file, for use by any component that needs to map addresses to
+     * symbols (or vice versa), without having to parse the ELF file itself. The file's DWARF line table is loaded
+     * alongside the symbols, if the file has one.
+     *
+     * The ELF file is specified via the 'elfFile' project config parameter. It's loaded on a background thread,
+     * which also watches the file and reloads it whenever it changes on disk (after a rebuild, for example). Until
+     * the first load completes, lookups find nothing.
+     *
+     * Lookups can be performed from any thread. They operate on an immutable snapshot of the index, so they never
+     * wait for a reload to complete.
+     */
+    class SymbolService
+    {
+    public:
+        struct Symbol
+        {
+            std::string name;
+            Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::FLASH;
+            Targets::TargetMemoryAddress startAddress = 0;
+            Targets::TargetMemorySize size = 0;
+        };
+
+        /**
+         * Starts loading and watching the ELF file, if the project config specifies one.
+         *
+         * @param projectConfig
+         */
+        static void configure(const ProjectConfig& projectConfig);
+
+        /**
+         * Starts loading and watching the given ELF file, replacing any file that was previously being watched.
+         *
+         * @param elfFilePath
+         *  Relative paths are resolved against the project directory.
+         */
+        static void load(const std::string& elfFilePath);
+
+        /**
+         * Stops watching the ELF file. The current index is retained.
+         */
+        static void shutdown();
+
+        /**
+         * Returns a snapshot of the current index, for consumers that perform many lookups at once.
+         *
+         * @return
+         *  nullptr if no ELF file has been loaded.
+         */
+        static std::shared_ptr<const ElfSymbolTable> symbolTable();
+
+        /**
+         * Returns a snapshot of the current line table.
+         *
+         * @return
+         *  nullptr if no ELF file has been loaded, or the ELF file has no debug information.
+         */
+        static std::shared_ptr<const DwarfLineTable> lineTable();
+
+        /**
+         * Finds the symbol containing the given address.
+         *
+         * Program memory addresses are resolved to functions first, and then to data objects (constants placed in
+         * program memory). Addresses in other memories are only resolved to data objects.
+         *
+         * @param memoryType
+         * @param address
+         *
+         * @return
+         */
+        static std::optional<Symbol> symbolAt(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress address
+        );
+
+        /**
+         * Finds a function or data object by name.
+         *
+         * @param name
+         *
+         * @return
+         */
+        static std::optional<Symbol> symbolByName(const std::string& name);
+
+    private:
+        static constexpr auto RELOAD_CHECK_INTERVAL = std::chrono::milliseconds(1000);
+
+        /**
+         * avr-gcc places the contents of each memory at a fixed offset in the ELF file's address space. These are
+         * the same offsets that GDB uses (see DebugServer::Gdb::TargetDescriptor::memoryOffsetsByType).
+         */
+        static inline const std::map<Targets::TargetMemoryType, std::uint32_t> ELF_MEMORY_OFFSETS = {
+            {Targets::TargetMemoryType::FLASH, 0},
+            {Targets::TargetMemoryType::RAM, 0x800000},
+            {Targets::TargetMemoryType::EEPROM, 0x810000},
+        };
+
+        static inline std::mutex mutex;
+        static inline std::shared_ptr<const ElfSymbolTable> currentSymbolTable;
+        static inline std::shared_ptr<const DwarfLineTable> currentLineTable;
+
+        static inline std::thread watcherThread;
+        static inline std::atomic<bool> watching = false;
+        static inline ConditionVariableNotifier watcherNotifier;
+
+        /**
+         * Loads the ELF file, and reloads it whenever its modification time or size changes. Runs on the watcher
+         * thread, until SymbolService::shutdown() is called.
+         *
+         * @param elfFilePath
+         */
+        static void watch(std::string elfFilePath);
+
+        static Symbol toSymbol(const ElfSymbolTable::Symbol& elfSymbol);
+    };
+}
@@ -1,5 +1,9 @@
 #include "TargetControllerService.hpp"
 
+#include <memory>
+
+#include "src/Helpers/SyncSafe.hpp"
+
 // Commands
 #include "src/TargetController/Commands/GetState.hpp"
 #include "src/TargetController/Commands/Suspend.hpp"
@@ -14,16 +18,44 @@
 #include "src/TargetController/Commands/ReadTargetMemory.hpp"
 #include "src/TargetController/Commands/WriteTargetMemory.hpp"
 #include "src/TargetController/Commands/EraseTargetMemory.hpp"
+#include "src/TargetController/Commands/FillTargetMemory.hpp"
+#include "src/TargetController/Commands/ComputeTargetMemoryCrc.hpp"
+#include "src/TargetController/Commands/SearchTargetMemory.hpp"
 #include "src/TargetController/Commands/StepTargetExecution.hpp"
 #include "src/TargetController/Commands/SetBreakpoint.hpp"
 #include "src/TargetController/Commands/RemoveBreakpoint.hpp"
+#include "src/TargetController/Commands/SetWatchpoint.hpp"
+#include "src/TargetController/Commands/RemoveWatchpoint.hpp"
 #include "src/TargetController/Commands/SetTargetProgramCounter.hpp"
 #include "src/TargetController/Commands/GetTargetPinStates.hpp"
 #include "src/TargetController/Commands/SetTargetPinState.hpp"
+#include "src/TargetController/Commands/SetTargetPinStateStreaming.hpp"
 #include "src/TargetController/Commands/GetTargetStackPointer.hpp"
 #include "src/TargetController/Commands/GetTargetProgramCounter.hpp"
 #include "src/TargetController/Commands/EnableProgrammingMode.hpp"
 #include "src/TargetController/Commands/DisableProgrammingMode.hpp"
+#include "src/TargetController/Commands/LoadProgramImage.hpp"
+#include "src/TargetController/Commands/StartProgramCounterSampling.hpp"
+#include "src/TargetController/Commands/StopProgramCounterSampling.hpp"
+#include "src/TargetController/Commands/StartCoverageCollection.hpp"
+#include "src/TargetController/Commands/StopCoverageCollection.hpp"
+#include "src/TargetController/Commands/StartTracing.hpp"
+#include "src/TargetController/Commands/StopTracing.hpp"
+#include "src/TargetController/Commands/GetTraceStatus.hpp"
+#include "src/TargetController/Commands/ReadTraceFrames.hpp"
+#include "src/TargetController/Commands/StartLiveSampling.hpp"
+#include "src/TargetController/Commands/StopLiveSampling.hpp"
+#include "src/TargetController/Commands/GetLiveSamples.hpp"
+#include "src/TargetController/Commands/StartTimingAnalysis.hpp"
+#include "src/TargetController/Commands/GetTimingAnalysisReport.hpp"
+#include "src/TargetController/Commands/StopTimingAnalysis.hpp"
+#include "src/TargetController/Commands/StartMemoryChangeTimeline.hpp"
+#include "src/TargetController/Commands/StopMemoryChangeTimeline.hpp"
+#include "src/TargetController/Commands/GetMemoryChanges.hpp"
+#include "src/TargetController/Commands/GetLastMemoryChange.hpp"
+#include "src/TargetController/Commands/CaptureCheckpoint.hpp"
+#include "src/TargetController/Commands/RestoreCheckpoint.hpp"
+#include "src/TargetController/Commands/CancelCommand.hpp"
 
 namespace Bloom::Services
 {
@@ -40,16 +72,52 @@ namespace Bloom::Services
     using TargetController::Commands::ReadTargetMemory;
     using TargetController::Commands::WriteTargetMemory;
     using TargetController::Commands::EraseTargetMemory;
+    using TargetController::Commands::FillTargetMemory;
+    using TargetController::Commands::ComputeTargetMemoryCrc;
+    using TargetController::Commands::SearchTargetMemory;
     using TargetController::Commands::StepTargetExecution;
     using TargetController::Commands::SetBreakpoint;
     using TargetController::Commands::RemoveBreakpoint;
+    using TargetController::Commands::SetWatchpoint;
+    using TargetController::Commands::RemoveWatchpoint;
     using TargetController::Commands::SetTargetProgramCounter;
     using TargetController::Commands::GetTargetPinStates;
     using TargetController::Commands::SetTargetPinState;
+    using TargetController::Commands::SetTargetPinStateStreaming;
     using TargetController::Commands::GetTargetStackPointer;
     using TargetController::Commands::GetTargetProgramCounter;
     using TargetController::Commands::EnableProgrammingMode;
     using TargetController::Commands::DisableProgrammingMode;
+    using TargetController::Commands::LoadProgramImage;
+    using TargetController::Commands::StartProgramCounterSampling;
+    using TargetController::Commands::StopProgramCounterSampling;
+    using TargetController::Commands::StartCoverageCollection;
+    using TargetController::Commands::StopCoverageCollection;
+    using TargetController::Commands::StartTracing;
+    using TargetController::Commands::StopTracing;
+    using TargetController::Commands::GetTraceStatus;
+    using TargetController::Commands::ReadTraceFrames;
+    using TargetController::Commands::StartLiveSampling;
+    using TargetController::Commands::StopLiveSampling;
+    using TargetController::Commands::GetLiveSamples;
+    using TargetController::Commands::StartMemoryChangeTimeline;
+    using TargetController::Commands::StopMemoryChangeTimeline;
+    using TargetController::Commands::GetMemoryChanges;
+    using TargetController::Commands::GetLastMemoryChange;
+    using TargetController::Commands::StartTimingAnalysis;
+    using TargetController::Commands::GetTimingAnalysisReport;
+    using TargetController::Commands::StopTimingAnalysis;
+    using TargetController::Commands::CaptureCheckpoint;
+    using TargetController::Commands::RestoreCheckpoint;
+    using TargetController::Commands::CommandBatch;
+    using TargetController::Commands::CancelCommand;
+
+    using TargetController::Responses::CommandBatchResponses;
+    using TargetController::Responses::ProgramCounterSamples;
+    using TargetController::Responses::CoverageReport;
+    using TargetController::Responses::TraceStatus;
+    using TargetController::Responses::LiveSamples;
+    using TargetController::Responses::MemoryChanges;
 
     using TargetController::TargetControllerState;
 
@@ -68,6 +136,7 @@ namespace Bloom::Services
     using Targets::TargetStackPointer;
 
     using Targets::TargetBreakpoint;
+    using Targets::TargetWatchpoint;
 
     using Targets::TargetPinDescriptor;
     using Targets::TargetPinState;
@@ -105,9 +174,17 @@ namespace Bloom::Services
         return;
     }
 
-    const TargetDescriptor& TargetControllerService::getTargetDescriptor() const {
+    std::shared_ptr<const TargetDescriptor> TargetControllerService::getTargetDescriptor(
+        bool includeVariants
+    ) const {
+        // The descriptor is published upon activation, so we can usually avoid the round trip to the TC
+        auto targetDescriptor = this->commandManager.getPublishedTargetDescriptor(includeVariants);
+        if (targetDescriptor != nullptr) {
+            return targetDescriptor;
+        }
+
         return this->commandManager.sendCommandAndWaitForResponse(
-            std::make_unique<GetTargetDescriptor>(),
+            std::make_unique<GetTargetDescriptor>(includeVariants),
             this->defaultTimeout
         )->targetDescriptor;
     }
@@ -146,13 +223,40 @@ namespace Bloom::Services
         );
     }
 
-    void TargetControllerService::stepTargetExecution(std::optional<TargetMemoryAddress> fromAddress) const {
+    void TargetControllerService::stepTargetExecution(
+        std::optional<TargetMemoryAddress> fromAddress,
+        std::optional<TargetMemoryAddressRange> stepRange
+    ) const {
         auto stepExecutionCommand = std::make_unique<StepTargetExecution>();
 
         if (fromAddress.has_value()) {
             stepExecutionCommand->fromProgramCounter = fromAddress.value();
         }
 
+        stepExecutionCommand->stepRange = stepRange;
+
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::move(stepExecutionCommand),
+            this->defaultTimeout
+        );
+    }
+
+    void TargetControllerService::stepSourceLine(bool stepOverCalls) const {
+        auto stepExecutionCommand = std::make_unique<StepTargetExecution>();
+        stepExecutionCommand->sourceLine = true;
+        stepExecutionCommand->stepOverCalls = stepOverCalls;
+
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::move(stepExecutionCommand),
+            this->defaultTimeout
+        );
+    }
+
+    void TargetControllerService::stepOverInstruction(std::optional<TargetMemoryAddress> fromAddress) const {
+        auto stepExecutionCommand = std::make_unique<StepTargetExecution>();
+        stepExecutionCommand->fromProgramCounter = fromAddress;
+        stepExecutionCommand->stepOverCalls = true;
+
         this->commandManager.sendCommandAndWaitForResponse(
             std::move(stepExecutionCommand),
             this->defaultTimeout
@@ -163,7 +267,7 @@ namespace Bloom::Services
         return this->commandManager.sendCommandAndWaitForResponse(
             std::make_unique<ReadTargetRegisters>(descriptors),
             this->defaultTimeout
-        )->registers;
+        )->takeRegisters();
     }
 
     void TargetControllerService::writeRegisters(const TargetRegisters& registers) const {
@@ -187,7 +291,45 @@ namespace Bloom::Services
                 excludedAddressRanges
             ),
             this->defaultTimeout
-        )->data;
+        )->takeData();
+    }
+
+    TargetMemoryBuffer TargetControllerService::readMemory(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges,
+        const std::function<void(TargetMemorySize)>& progressCallback
+    ) const {
+        /*
+         * We may stop waiting for the response before the TargetController has completed the read (upon a timeout),
+         * so the progress callback must be disabled before we return. The TargetController holds the lock whilst
+         * invoking the callback.
+         */
+        auto callbackEnabled = std::make_shared<SyncSafe<bool>>(true);
+
+        auto command = std::make_unique<ReadTargetMemory>(memoryType, startAddress, bytes, excludedAddressRanges);
+        command->progressCallback = [callbackEnabled, progressCallback] (TargetMemorySize bytesRead) {
+            const auto lock = callbackEnabled->acquireLock();
+
+            if (callbackEnabled->getValue()) {
+                progressCallback(bytesRead);
+            }
+        };
+
+        try {
+            auto data = this->commandManager.sendCommandAndWaitForResponse(
+                std::move(command),
+                this->defaultTimeout + TargetControllerService::MEMORY_READ_TIMEOUT_PER_KIB * (bytes / 1024)
+            )->takeData();
+
+            callbackEnabled->setValue(false);
+            return data;
+
+        } catch (...) {
+            callbackEnabled->setValue(false);
+            throw;
+        }
     }
 
     void TargetControllerService::writeMemory(
@@ -208,9 +350,49 @@ namespace Bloom::Services
         );
     }
 
-    void TargetControllerService::setBreakpoint(TargetBreakpoint breakpoint) const {
+    TargetMemorySize TargetControllerService::fillMemory(
+        TargetMemoryType memoryType,
+        const TargetMemoryAddressRange& addressRange,
+        TargetMemoryBuffer fillValue
+    ) const {
+        const auto bytes = addressRange.endAddress - addressRange.startAddress + 1;
+
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<FillTargetMemory>(memoryType, addressRange, std::move(fillValue)),
+            this->defaultTimeout + TargetControllerService::MEMORY_FILL_TIMEOUT_PER_KIB * (bytes / 1024)
+        )->bytesWritten;
+    }
+
+    std::uint32_t TargetControllerService::computeMemoryCrc(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes
+    ) const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<ComputeTargetMemoryCrc>(memoryType, startAddress, bytes),
+            this->defaultTimeout
+        )->crc;
+    }
+
+    std::optional<TargetMemoryAddress> TargetControllerService::searchMemory(
+        TargetMemoryType memoryType,
+        const TargetMemoryAddressRange& addressRange,
+        TargetMemoryBuffer pattern
+    ) const {
+        const auto bytes = addressRange.endAddress - addressRange.startAddress + 1;
+
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<SearchTargetMemory>(memoryType, addressRange, std::move(pattern)),
+            this->defaultTimeout + TargetControllerService::MEMORY_READ_TIMEOUT_PER_KIB * (bytes / 1024)
+        )->matchAddress;
+    }
+
+    void TargetControllerService::setBreakpoint(
+        TargetBreakpoint breakpoint,
+        std::vector<TargetController::AgentExpression>&& conditions
+    ) const {
         this->commandManager.sendCommandAndWaitForResponse(
-            std::make_unique<SetBreakpoint>(breakpoint),
+            std::make_unique<SetBreakpoint>(breakpoint, std::move(conditions)),
             this->defaultTimeout
         );
     }
@@ -222,6 +404,20 @@ namespace Bloom::Services
         );
     }
 
+    void TargetControllerService::setWatchpoint(TargetWatchpoint watchpoint) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<SetWatchpoint>(watchpoint),
+            this->defaultTimeout
+        );
+    }
+
+    void TargetControllerService::removeWatchpoint(TargetWatchpoint watchpoint) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<RemoveWatchpoint>(watchpoint),
+            this->defaultTimeout
+        );
+    }
+
     TargetProgramCounter TargetControllerService::getProgramCounter() const {
         return this->commandManager.sendCommandAndWaitForResponse(
             std::make_unique<GetTargetProgramCounter>(),
@@ -250,6 +446,20 @@ namespace Bloom::Services
         );
     }
 
+    void TargetControllerService::startPinStateStreaming(int variantId) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<SetTargetPinStateStreaming>(variantId),
+            this->defaultTimeout
+        );
+    }
+
+    void TargetControllerService::stopPinStateStreaming() const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<SetTargetPinStateStreaming>(std::nullopt),
+            this->defaultTimeout
+        );
+    }
+
     TargetStackPointer TargetControllerService::getStackPointer() const {
         return this->commandManager.sendCommandAndWaitForResponse(
             std::make_unique<GetTargetStackPointer>(),
@@ -257,9 +467,9 @@ namespace Bloom::Services
         )->stackPointer;
     }
 
-    void TargetControllerService::resetTarget() const {
+    void TargetControllerService::resetTarget(bool deferred) const {
         this->commandManager.sendCommandAndWaitForResponse(
-            std::make_unique<ResetTarget>(),
+            std::make_unique<ResetTarget>(deferred),
             this->defaultTimeout
         );
     }
@@ -277,4 +487,191 @@ namespace Bloom::Services
             this->defaultTimeout
         );
     }
+
+    Targets::TargetMemorySize TargetControllerService::loadProgramImage(
+        std::shared_ptr<const ProgramImage> programImage,
+        bool verify
+    ) const {
+        const auto imageSize = programImage->size();
+
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<LoadProgramImage>(std::move(programImage), verify),
+            this->defaultTimeout + TargetControllerService::PROGRAM_IMAGE_LOAD_TIMEOUT_PER_KIB * (imageSize / 1024)
+        )->bytes;
+    }
+
+    void TargetControllerService::startProgramCounterSampling(std::chrono::milliseconds samplingInterval) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StartProgramCounterSampling>(samplingInterval),
+            this->defaultTimeout
+        );
+    }
+
+    std::unique_ptr<ProgramCounterSamples> TargetControllerService::stopProgramCounterSampling() const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StopProgramCounterSampling>(),
+            this->defaultTimeout
+        );
+    }
+
+    void TargetControllerService::startCoverageCollection(
+        std::vector<Targets::TargetMemoryAddress>&& addresses,
+        std::size_t batchSize,
+        std::chrono::milliseconds sweepInterval
+    ) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StartCoverageCollection>(std::move(addresses), batchSize, sweepInterval),
+            this->defaultTimeout
+        );
+    }
+
+    std::unique_ptr<CoverageReport> TargetControllerService::stopCoverageCollection() const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StopCoverageCollection>(),
+            this->defaultTimeout
+        );
+    }
+
+    void TargetControllerService::startTracing(std::vector<TargetController::Tracepoint>&& tracepoints) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StartTracing>(std::move(tracepoints)),
+            this->defaultTimeout
+        );
+    }
+
+    void TargetControllerService::stopTracing() const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StopTracing>(),
+            this->defaultTimeout
+        );
+    }
+
+    std::unique_ptr<TraceStatus> TargetControllerService::getTraceStatus() const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<GetTraceStatus>(),
+            this->defaultTimeout
+        );
+    }
+
+    std::vector<TargetController::TraceFrame> TargetControllerService::readTraceFrames(std::size_t startIndex) const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<ReadTraceFrames>(startIndex),
+            this->defaultTimeout
+        )->frames;
+    }
+
+    void TargetControllerService::startLiveSampling(
+        std::vector<TargetController::LiveSampleVariable>&& variables,
+        std::chrono::milliseconds samplingInterval
+    ) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StartLiveSampling>(std::move(variables), samplingInterval),
+            this->defaultTimeout
+        );
+    }
+
+    void TargetControllerService::stopLiveSampling() const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StopLiveSampling>(),
+            this->defaultTimeout
+        );
+    }
+
+    std::unique_ptr<LiveSamples> TargetControllerService::getLiveSamples(std::uint64_t fromSequenceNumber) const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<GetLiveSamples>(fromSequenceNumber),
+            this->defaultTimeout
+        );
+    }
+
+    void TargetControllerService::startTimingAnalysis(
+        TargetMemoryAddress startAddress,
+        TargetMemoryAddress endAddress,
+        std::uint32_t iterationCount,
+        const std::optional<TargetController::TimingTimerRegister>& timerRegister
+    ) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StartTimingAnalysis>(startAddress, endAddress, iterationCount, timerRegister),
+            this->defaultTimeout
+        );
+    }
+
+    TargetController::TimingAnalysisResults TargetControllerService::getTimingAnalysisReport() const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<GetTimingAnalysisReport>(),
+            this->defaultTimeout
+        )->results;
+    }
+
+    TargetController::TimingAnalysisResults TargetControllerService::stopTimingAnalysis() const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StopTimingAnalysis>(),
+            this->defaultTimeout
+        )->results;
+    }
+
+    void TargetControllerService::startMemoryChangeTimeline(
+        std::vector<TargetController::MemoryChangeTimelineRegion>&& regions
+    ) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StartMemoryChangeTimeline>(std::move(regions)),
+            this->defaultTimeout
+        );
+    }
+
+    void TargetControllerService::stopMemoryChangeTimeline() const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<StopMemoryChangeTimeline>(),
+            this->defaultTimeout
+        );
+    }
+
+    std::unique_ptr<MemoryChanges> TargetControllerService::getMemoryChanges(std::uint64_t fromSequenceNumber) const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<GetMemoryChanges>(fromSequenceNumber),
+            this->defaultTimeout
+        );
+    }
+
+    std::optional<TargetController::MemoryChange> TargetControllerService::getLastMemoryChange(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress address
+    ) const {
+        return std::move(this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<GetLastMemoryChange>(memoryType, address),
+            this->defaultTimeout
+        )->change);
+    }
+
+    void TargetControllerService::captureCheckpoint(
+        const TargetRegisterDescriptors& peripheralRegisterDescriptors
+    ) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<CaptureCheckpoint>(peripheralRegisterDescriptors),
+            this->defaultTimeout + TargetControllerService::CHECKPOINT_TIMEOUT
+        );
+    }
+
+    void TargetControllerService::restoreCheckpoint() const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<RestoreCheckpoint>(),
+            this->defaultTimeout + TargetControllerService::CHECKPOINT_TIMEOUT
+        );
+    }
+
+    void TargetControllerService::cancelCommand(TargetController::Commands::CommandIdType commandId) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<CancelCommand>(commandId),
+            this->defaultTimeout
+        );
+    }
+
+    std::unique_ptr<CommandBatchResponses> TargetControllerService::sendCommandBatch(
+        std::unique_ptr<CommandBatch> batch
+    ) const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::move(batch),
+            this->defaultTimeout
+        );
+    }
 }
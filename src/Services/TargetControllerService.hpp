@@ -3,9 +3,25 @@
 #include <cstdint>
 #include <chrono>
 #include <optional>
+#include <functional>
+#include <memory>
+#include <vector>
 
 #include "src/TargetController/CommandManager.hpp"
 #include "src/TargetController/TargetControllerState.hpp"
+#include "src/TargetController/AgentExpression.hpp"
+#include "src/TargetController/Commands/CommandBatch.hpp"
+#include "src/TargetController/Responses/CommandBatchResponses.hpp"
+#include "src/TargetController/Responses/ProgramCounterSamples.hpp"
+#include "src/TargetController/Responses/CoverageReport.hpp"
+#include "src/TargetController/Responses/TraceStatus.hpp"
+#include "src/TargetController/Responses/LiveSamples.hpp"
+#include "src/TargetController/Responses/TimingAnalysisReport.hpp"
+#include "src/TargetController/Responses/MemoryChanges.hpp"
+#include "src/TargetController/Tracepoint.hpp"
+#include "src/TargetController/LiveSampling.hpp"
+#include "src/TargetController/TimingAnalysis.hpp"
+#include "src/TargetController/MemoryChangeTimeline.hpp"
 
 #include "src/Targets/TargetState.hpp"
 #include "src/Targets/TargetRegister.hpp"
@@ -13,6 +29,7 @@
 #include "src/Targets/TargetBreakpoint.hpp"
 #include "src/Targets/TargetVariant.hpp"
 #include "src/Targets/TargetPinDescriptor.hpp"
+#include "src/ProgramImage/ProgramImage.hpp"
 
 #include "src/Exceptions/Exception.hpp"
 
@@ -26,10 +43,40 @@ namespace Bloom::Services
     public:
         TargetControllerService() = default;
 
+        /**
+         * Constructs a service for a specific TargetController, where more than one is running. See
+         * TargetController::TargetControllerComponent::queueCommand().
+         *
+         * @param targetController
+         */
+        explicit TargetControllerService(TargetController::TargetControllerComponent& targetController)
+            : commandManager(TargetController::CommandManager(targetController))
+        {}
+
         void setDefaultTimeout(std::chrono::milliseconds timeout) {
             this->defaultTimeout = timeout;
         }
 
+        /**
+         * Sets the priority of commands issued via this service. See TargetController::Commands::CommandPriority.
+         *
+         * @param priority
+         */
+        void setCommandPriority(TargetController::Commands::CommandPriority priority) {
+            this->commandManager.setCommandPriority(priority);
+        }
+
+        /**
+         * Sets a handler for the progress of long-running operations (chunked memory reads, writes and fills, and
+         * program image loads), for commands issued via this service. The handler is invoked from the calling
+         * thread. See TargetController::CommandManager::setOperationProgressHandler().
+         *
+         * @param handler
+         */
+        void setOperationProgressHandler(TargetController::CommandManager::OperationProgressHandler handler) {
+            this->commandManager.setOperationProgressHandler(std::move(handler));
+        }
+
         /**
          * Requests the current TargetController state from the TargetController. The TargetController should always
          * respond to such a request, even when it's in a suspended state.
@@ -62,9 +109,15 @@ namespace Bloom::Services
         /**
          * Requests the TargetDescriptor from the TargetController
          *
+         * @param includeVariants
+         *  Whether the target variants should be included in the descriptor (TargetDescriptor::variants). Target
+         *  variants are loaded on demand, so this should only be set by components that need them.
+         *
          * @return
+         *  An immutable descriptor, shared with the TargetController and other components. It remains valid for as
+         *  long as the handle is held, so callers can keep it instead of requesting it again.
          */
-        const Targets::TargetDescriptor& getTargetDescriptor() const;
+        std::shared_ptr<const Targets::TargetDescriptor> getTargetDescriptor(bool includeVariants = false) const;
 
         /**
          * Fetches the current target state.
@@ -92,8 +145,34 @@ namespace Bloom::Services
          * Requests the TargetController to step execution on the target.
          *
          * @param fromAddress
+         *
+         * @param stepRange
+         *  If provided, the TargetController will keep stepping until the program counter leaves this address range.
+         *  The stop will only be reported once stepping has finished. Calls into code that isn't covered by the
+         *  project's line table (see SymbolService) are stepped over.
+         */
+        void stepTargetExecution(
+            std::optional<Targets::TargetMemoryAddress> fromAddress,
+            std::optional<Targets::TargetMemoryAddressRange> stepRange = std::nullopt
+        ) const;
+
+        /**
+         * Requests the TargetController to step execution until the program counter reaches the beginning of another
+         * source statement, according to the line table of the project's ELF file (see SymbolService). The stop will
+         * only be reported once stepping has finished.
+         *
+         * @param stepOverCalls
+         *  If true, calls made from within the statement are stepped over.
          */
-        void stepTargetExecution(std::optional<Targets::TargetMemoryAddress> fromAddress) const;
+        void stepSourceLine(bool stepOverCalls) const;
+
+        /**
+         * Requests the TargetController to step a single instruction, stepping over it if it's a call (by running to
+         * the instruction that follows it). The stop will only be reported once the call has returned.
+         *
+         * @param fromAddress
+         */
+        void stepOverInstruction(std::optional<Targets::TargetMemoryAddress> fromAddress) const;
 
         /**
          * Requests the TargetController to read register values from the target.
@@ -128,6 +207,32 @@ namespace Bloom::Services
             const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {}
         ) const;
 
+        /**
+         * Requests the TargetController to read a large block of memory from the target, in a single command.
+         *
+         * The TargetController performs the read in chunks, servicing other commands in-between (see
+         * TargetControllerComponent::completeMemoryOperationChunk()), so this doesn't lock up the TargetController.
+         * The response timeout is extended in proportion to the size of the read.
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param bytes
+         * @param excludedAddressRanges
+         *
+         * @param progressCallback
+         *  Invoked with the number of bytes read so far, after each chunk. It's invoked from the TargetController's
+         *  thread, and never after this function returns.
+         *
+         * @return
+         */
+        Targets::TargetMemoryBuffer readMemory(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges,
+            const std::function<void(Targets::TargetMemorySize)>& progressCallback
+        ) const;
+
         /**
          * Requests the TargetController to write memory to the target.
          *
@@ -148,12 +253,73 @@ namespace Bloom::Services
          */
         void eraseMemory(Targets::TargetMemoryType memoryType) const;
 
+        /**
+         * Requests the TargetController to fill a range of target memory with a repeating value. Only the parts of
+         * the range that don't already hold the fill value are written to. See Commands::FillTargetMemory.
+         *
+         * The response timeout is extended in proportion to the size of the range.
+         *
+         * @param memoryType
+         * @param addressRange
+         * @param fillValue
+         *
+         * @return
+         *  The number of bytes that were written to the target.
+         */
+        Targets::TargetMemorySize fillMemory(
+            Targets::TargetMemoryType memoryType,
+            const Targets::TargetMemoryAddressRange& addressRange,
+            Targets::TargetMemoryBuffer fillValue
+        ) const;
+
+        /**
+         * Requests the TargetController to compute a CRC-32 (see Bloom::Crc32) over a range of the target's memory.
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         */
+        std::uint32_t computeMemoryCrc(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes
+        ) const;
+
+        /**
+         * Requests the TargetController to search a range of the target's memory for the first occurrence of the
+         * given pattern. See Commands::SearchTargetMemory.
+         *
+         * The response timeout is extended in proportion to the size of the range.
+         *
+         * @param memoryType
+         * @param addressRange
+         * @param pattern
+         *
+         * @return
+         *  The address of the first match, or std::nullopt if the pattern wasn't found.
+         */
+        std::optional<Targets::TargetMemoryAddress> searchMemory(
+            Targets::TargetMemoryType memoryType,
+            const Targets::TargetMemoryAddressRange& addressRange,
+            Targets::TargetMemoryBuffer pattern
+        ) const;
+
         /**
          * Requests the TargetController to set a breakpoint on the target.
          *
          * @param breakpoint
+         *
+         * @param conditions
+         *  Conditions to be evaluated by the TargetController, each time the target halts at the breakpoint. If none
+         *  of the conditions are met, the target is resumed without reporting the halt. See
+         *  Commands::SetBreakpoint::conditions.
          */
-        void setBreakpoint(Targets::TargetBreakpoint breakpoint) const;
+        void setBreakpoint(
+            Targets::TargetBreakpoint breakpoint,
+            std::vector<TargetController::AgentExpression>&& conditions = {}
+        ) const;
 
         /**
          * Requests the TargetController to remove a breakpoint from the target.
@@ -162,6 +328,23 @@ namespace Bloom::Services
          */
         void removeBreakpoint(Targets::TargetBreakpoint breakpoint) const;
 
+        /**
+         * Requests the TargetController to set a watchpoint on the target.
+         *
+         * Watchpoints are implemented with the target's data breakpoints. This function will throw an exception if
+         * the target has insufficient data breakpoints for the watchpoint.
+         *
+         * @param watchpoint
+         */
+        void setWatchpoint(Targets::TargetWatchpoint watchpoint) const;
+
+        /**
+         * Requests the TargetController to remove a watchpoint from the target.
+         *
+         * @param watchpoint
+         */
+        void removeWatchpoint(Targets::TargetWatchpoint watchpoint) const;
+
         /**
          * Retrieves the current program counter value from the target.
          *
@@ -191,6 +374,21 @@ namespace Bloom::Services
          */
         void setPinState(Targets::TargetPinDescriptor pinDescriptor, Targets::TargetPinState pinState) const;
 
+        /**
+         * Starts streaming pin states for a particular target variant. Whilst the target is stopped, the
+         * TargetController will emit TargetPinStatesChanged events for any pins that change state.
+         *
+         * Any existing stream (for another variant) is replaced.
+         *
+         * @param variantId
+         */
+        void startPinStateStreaming(int variantId) const;
+
+        /**
+         * Stops streaming pin states.
+         */
+        void stopPinStateStreaming() const;
+
         /**
          * Retrieves the current stack pointer value from the target.
          *
@@ -200,8 +398,11 @@ namespace Bloom::Services
 
         /**
          * Triggers a reset on the target. The target will be held in a stopped state.
+         *
+         * @param deferred
+         *  Defer the reset until it's needed (see Commands::ResetTarget::deferred).
          */
-        void resetTarget() const;
+        void resetTarget(bool deferred = false) const;
 
         /**
          * Enables programming mode on the target.
@@ -217,9 +418,271 @@ namespace Bloom::Services
          */
         void disableProgrammingMode() const;
 
+        /**
+         * Requests the TargetController to write the given program image to the target's program memory, and verify
+         * it. Programming mode is enabled for the duration of the load, if it isn't already enabled.
+         *
+         * The response timeout is extended in proportion to the size of the image.
+         *
+         * @param programImage
+         * @param verify
+         *
+         * @return
+         *  The number of bytes from the image that reside in program memory.
+         */
+        Targets::TargetMemorySize loadProgramImage(
+            std::shared_ptr<const ProgramImage> programImage,
+            bool verify = true
+        ) const;
+
+        /**
+         * Requests the TargetController to start sampling the target's program counter, at the given interval, for
+         * statistical profiling.
+         *
+         * @param samplingInterval
+         */
+        void startProgramCounterSampling(std::chrono::milliseconds samplingInterval) const;
+
+        /**
+         * Requests the TargetController to stop sampling the target's program counter.
+         *
+         * @return
+         *  The samples collected since sampling was started.
+         */
+        std::unique_ptr<TargetController::Responses::ProgramCounterSamples> stopProgramCounterSampling() const;
+
+        /**
+         * Requests the TargetController to start collecting code coverage, over the given program memory addresses.
+         *
+         * @param addresses
+         *  The addresses to instrument, in ascending order.
+         *
+         * @param batchSize
+         *  The maximum number of coverage breakpoints to have in place at any one time.
+         *
+         * @param sweepInterval
+         *  How often to swap the unhit breakpoints of the current batch for the next batch.
+         */
+        void startCoverageCollection(
+            std::vector<Targets::TargetMemoryAddress>&& addresses,
+            std::size_t batchSize,
+            std::chrono::milliseconds sweepInterval
+        ) const;
+
+        /**
+         * Requests the TargetController to stop collecting code coverage.
+         *
+         * @return
+         *  The coverage collected since collection was started.
+         */
+        std::unique_ptr<TargetController::Responses::CoverageReport> stopCoverageCollection() const;
+
+        /**
+         * Requests the TargetController to start a trace experiment. Frames collected by any previous experiment are
+         * discarded.
+         *
+         * @param tracepoints
+         */
+        void startTracing(std::vector<TargetController::Tracepoint>&& tracepoints) const;
+
+        /**
+         * Requests the TargetController to stop the current trace experiment. The collected frames are retained.
+         */
+        void stopTracing() const;
+
+        /**
+         * Retrieves the status of the current (or last) trace experiment.
+         *
+         * @return
+         */
+        std::unique_ptr<TargetController::Responses::TraceStatus> getTraceStatus() const;
+
+        /**
+         * Reads frames from the trace buffer, from the given index onwards.
+         *
+         * @param startIndex
+         *
+         * @return
+         */
+        std::vector<TargetController::TraceFrame> readTraceFrames(std::size_t startIndex) const;
+
+        /**
+         * Requests the TargetController to start sampling the given variables periodically, whilst the target is
+         * running. Any existing sampling session is discarded.
+         *
+         * @param variables
+         * @param samplingInterval
+         */
+        void startLiveSampling(
+            std::vector<TargetController::LiveSampleVariable>&& variables,
+            std::chrono::milliseconds samplingInterval
+        ) const;
+
+        /**
+         * Requests the TargetController to stop live sampling. Samples that have already been taken are retained,
+         * until the next sampling session is started.
+         */
+        void stopLiveSampling() const;
+
+        /**
+         * Retrieves live samples, from the given sequence number onwards.
+         *
+         * @param fromSequenceNumber
+         *
+         * @return
+         */
+        std::unique_ptr<TargetController::Responses::LiveSamples> getLiveSamples(
+            std::uint64_t fromSequenceNumber = 0
+        ) const;
+
+        /**
+         * Requests the TargetController to start a timing analysis session, measuring the time taken for execution
+         * to get from the start address to the end address. Any existing session is discarded.
+         *
+         * @param startAddress
+         * @param endAddress
+         * @param iterationCount
+         * @param timerRegister
+         *  Optional target timer register to read at each break, for tick-accurate durations.
+         */
+        void startTimingAnalysis(
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemoryAddress endAddress,
+            std::uint32_t iterationCount,
+            const std::optional<TargetController::TimingTimerRegister>& timerRegister
+        ) const;
+
+        /**
+         * Retrieves the results of the current (or most recently completed) timing analysis session.
+         *
+         * @return
+         */
+        TargetController::TimingAnalysisResults getTimingAnalysisReport() const;
+
+        /**
+         * Requests the TargetController to stop the current timing analysis session.
+         *
+         * @return
+         *  The results collected before the session was stopped.
+         */
+        TargetController::TimingAnalysisResults stopTimingAnalysis() const;
+
+        /**
+         * Requests the TargetController to start recording the memory change timeline for the given regions. Any
+         * existing timeline is discarded.
+         *
+         * @param regions
+         */
+        void startMemoryChangeTimeline(std::vector<TargetController::MemoryChangeTimelineRegion>&& regions) const;
+
+        /**
+         * Requests the TargetController to stop recording the memory change timeline. Recorded changes are retained,
+         * until the next timeline is started.
+         */
+        void stopMemoryChangeTimeline() const;
+
+        /**
+         * Retrieves the changes recorded in the memory change timeline, from the given sequence number onwards.
+         *
+         * @param fromSequenceNumber
+         *
+         * @return
+         */
+        std::unique_ptr<TargetController::Responses::MemoryChanges> getMemoryChanges(
+            std::uint64_t fromSequenceNumber = 0
+        ) const;
+
+        /**
+         * Looks up the most recent change to the given address, in the memory change timeline.
+         *
+         * @param memoryType
+         * @param address
+         *
+         * @return
+         *  The change, or std::nullopt if the address hasn't changed since the timeline was started (or it isn't
+         *  tracked).
+         */
+        std::optional<TargetController::MemoryChange> getLastMemoryChange(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress address
+        ) const;
+
+        /**
+         * Requests the TargetController to capture a checkpoint of the target's RAM and CPU registers, along with
+         * the given peripheral registers. Any existing checkpoint is replaced.
+         *
+         * @param peripheralRegisterDescriptors
+         */
+        void captureCheckpoint(const Targets::TargetRegisterDescriptors& peripheralRegisterDescriptors) const;
+
+        /**
+         * Requests the TargetController to return the target to the state captured in the current checkpoint.
+         */
+        void restoreCheckpoint() const;
+
+        /**
+         * Requests the TargetController to cancel a previously issued command.
+         *
+         * This is typically used to abort large memory operations that are in progress - the ID of the command that
+         * initiated the operation is provided in TargetMemoryOperationProgress events.
+         *
+         * @param commandId
+         */
+        void cancelCommand(TargetController::Commands::CommandIdType commandId) const;
+
+        /**
+         * Issues a batch of commands to the TargetController, in a single submission, and waits for all of the
+         * responses.
+         *
+         * This is considerably cheaper than issuing each command individually, as the TargetController will only
+         * need to wake up once to process the entire batch.
+         *
+         * Usage:
+         *  auto batch = std::make_unique<TargetController::Commands::CommandBatch>();
+         *  const auto pcIndex = batch->addCommand(std::make_unique<Commands::GetTargetProgramCounter>());
+         *  const auto spIndex = batch->addCommand(std::make_unique<Commands::GetTargetStackPointer>());
+         *
+         *  auto responses = tcService.sendCommandBatch(std::move(batch));
+         *  const auto pc = responses->takeResponse<Commands::GetTargetProgramCounter>(pcIndex)->programCounter;
+         *
+         * @param batch
+         *
+         * @return
+         *  The responses for each command in the batch (see CommandBatchResponses::takeResponse()). An exception will
+         *  only be thrown here if the batch itself failed - errors for individual commands are thrown upon extraction
+         *  of the command's response.
+         */
+        std::unique_ptr<TargetController::Responses::CommandBatchResponses> sendCommandBatch(
+            std::unique_ptr<TargetController::Commands::CommandBatch> batch
+        ) const;
+
     private:
         TargetController::CommandManager commandManager = TargetController::CommandManager();
 
         std::chrono::milliseconds defaultTimeout = std::chrono::milliseconds(60000);
+
+        /**
+         * The additional response timeout, per KiB, for large memory reads. This is deliberately generous - the
+         * slowest debug tools read around 8 KiB per second.
+         */
+        static constexpr auto MEMORY_READ_TIMEOUT_PER_KIB = std::chrono::milliseconds(250);
+
+        /**
+         * The additional response timeout, per KiB, for loading program images. This allows for an erase, a write, a
+         * read (for the page diff) and another read (for verification) of every byte.
+         */
+        static constexpr auto PROGRAM_IMAGE_LOAD_TIMEOUT_PER_KIB = std::chrono::milliseconds(1000);
+
+        /**
+         * The additional response timeout, per KiB, for memory fills. Fills are typically applied to EEPROM, where
+         * writing a single byte can take several milliseconds.
+         */
+        static constexpr auto MEMORY_FILL_TIMEOUT_PER_KIB = std::chrono::milliseconds(10000);
+
+        /**
+         * The response timeout for capturing and restoring checkpoints, which involve reading/writing the entirety
+         * of the target's RAM. This allows for 32 KiB of RAM, at the slowest debug tool's read rate.
+         */
+        static constexpr auto CHECKPOINT_TIMEOUT = TargetControllerService::MEMORY_READ_TIMEOUT_PER_KIB * 32;
     };
 }
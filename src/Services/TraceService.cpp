@@ -0,0 +1,141 @@
+#include "TraceService.hpp"
+
+#include <fstream>
+#include <filesystem>
+#include <cstdlib>
+#include <array>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "PathService.hpp"
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::Services
+{
+    void TraceService::configure(const ProjectConfig& projectConfig) {
+        if (!projectConfig.traceFilePath.has_value() || TraceService::enabled) {
+            return;
+        }
+
+        auto traceFilePath = std::filesystem::path(projectConfig.traceFilePath.value());
+        if (traceFilePath.is_relative()) {
+            traceFilePath = std::filesystem::path(PathService::projectDirPath()) / traceFilePath;
+        }
+
+        TraceService::traceFilePath = traceFilePath.string();
+        TraceService::startTime = std::chrono::steady_clock::now();
+        TraceService::enabled = true;
+
+        static auto exitHandlerRegistered = false;
+        if (!exitHandlerRegistered) {
+            std::atexit(&TraceService::finish);
+            exitHandlerRegistered = true;
+        }
+
+        Logger::warning(
+            "Latency tracing enabled - the trace will be written to " + TraceService::traceFilePath.value()
+                + " upon exit"
+        );
+    }
+
+    void TraceService::finish() {
+        if (!TraceService::enabled.exchange(false)) {
+            return;
+        }
+
+        const auto events = TraceService::events.takeAll();
+        TraceService::eventCount = 0;
+
+        auto traceFile = std::ofstream(TraceService::traceFilePath.value(), std::ios::out | std::ios::trunc);
+        if (!traceFile.is_open()) {
+            Logger::error("Failed to open trace file " + TraceService::traceFilePath.value());
+            return;
+        }
+
+        const auto processId = ::getpid();
+        const auto toMicroseconds = [] (std::chrono::steady_clock::duration duration) {
+            return std::chrono::duration<double, std::micro>(duration).count();
+        };
+
+        traceFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        auto firstEvent = true;
+
+        for (const auto& event : events) {
+            if (!firstEvent) {
+                traceFile << ",\n";
+            }
+
+            firstEvent = false;
+
+            if (event.threadName.has_value()) {
+                traceFile << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << processId << ",\"tid\":"
+                    << event.threadId << ",\"args\":{\"name\":\"" << *(event.threadName) << "\"}}";
+                continue;
+            }
+
+            traceFile << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category
+                << "\",\"ph\":\"X\",\"ts\":" << std::fixed << toMicroseconds(event.startTime - TraceService::startTime)
+                << ",\"dur\":" << toMicroseconds(event.duration) << ",\"pid\":" << processId << ",\"tid\":"
+                << event.threadId;
+
+            if (event.id.has_value()) {
+                traceFile << ",\"args\":{\"id\":" << *(event.id) << "}";
+            }
+
+            traceFile << "}";
+        }
+
+        traceFile << "\n]}\n";
+        traceFile.close();
+
+        const auto droppedEventCount = TraceService::droppedEventCount.exchange(0);
+        if (droppedEventCount > 0) {
+            Logger::warning(
+                std::to_string(droppedEventCount) + " trace spans were discarded, as the trace reached its limit"
+            );
+        }
+
+        Logger::info("Trace written to " + TraceService::traceFilePath.value());
+    }
+
+    void TraceService::record(
+        const char* name,
+        const char* category,
+        std::optional<std::uint64_t> id,
+        std::chrono::steady_clock::time_point startTime,
+        std::chrono::steady_clock::time_point endTime
+    ) {
+        static thread_local const auto threadId = ::gettid();
+        static thread_local auto threadNameRecorded = false;
+
+        if (TraceService::eventCount.fetch_add(1, std::memory_order_relaxed) >= TraceService::MAX_EVENTS) {
+            TraceService::droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        if (!threadNameRecorded) {
+            auto threadNameBuffer = std::array<char, 16>();
+
+            if (::pthread_getname_np(::pthread_self(), threadNameBuffer.data(), threadNameBuffer.size()) == 0) {
+                auto threadName = std::string(threadNameBuffer.data());
+
+                // See LogEntry::LogEntry()
+                TraceService::events.push(TraceEvent{
+                    .threadId = threadId,
+                    .threadName = threadName == "Bloom" ? "MT" : threadName,
+                });
+            }
+
+            threadNameRecorded = true;
+        }
+
+        TraceService::events.push(TraceEvent{
+            .name = name,
+            .category = category,
+            .id = id,
+            .startTime = startTime,
+            .duration = endTime - startTime,
+            .threadId = threadId,
+        });
+    }
+}
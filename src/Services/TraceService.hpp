@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+#include <atomic>
+#include <chrono>
+#include <sys/types.h>
+
+#include "src/ProjectConfig.hpp"
+#include "src/Helpers/MpscQueue.hpp"
+
+namespace Bloom::Services
+{
+    /**
+     * Opt-in latency tracing.
+     *
+     * When a trace file is configured (via the 'traceFile' project config parameter), spans (see TraceService::Span)
+     * are recorded along the path of every GDB packet - from the GDB socket, through the DebugServer and the
+     * TargetController, down to the USB HID interface. Upon exit, the recorded spans are written to the trace file,
+     * in the Chrome trace event format, which can be loaded into Perfetto (https://ui.perfetto.dev) or
+     * chrome://tracing.
+     *
+     * When tracing is disabled, constructing a span costs a single atomic load.
+     */
+    class TraceService
+    {
+    public:
+        /**
+         * Records the duration of the enclosing scope.
+         *
+         * The name and category must be string literals (or otherwise outlive the TraceService), as only the
+         * pointers are kept.
+         */
+        class Span
+        {
+        public:
+            /**
+             * @param name
+             * @param category
+             * @param id
+             *  An optional ID, for correlating spans across threads (e.g. the ID of a TargetController command).
+             */
+            Span(const char* name, const char* category, std::optional<std::uint64_t> id = std::nullopt)
+                : name(name)
+                , category(category)
+                , id(id)
+            {
+                if (TraceService::isEnabled()) {
+                    this->startTime = std::chrono::steady_clock::now();
+                }
+            };
+
+            ~Span() {
+                if (this->startTime.has_value()) {
+                    TraceService::record(
+                        this->name,
+                        this->category,
+                        this->id,
+                        *(this->startTime),
+                        std::chrono::steady_clock::now()
+                    );
+                }
+            }
+
+            Span(const Span& other) = delete;
+            Span(Span&& other) = delete;
+
+            Span& operator = (const Span& other) = delete;
+            Span& operator = (Span&& other) = delete;
+
+        private:
+            const char* name;
+            const char* category;
+            std::optional<std::uint64_t> id;
+            std::optional<std::chrono::steady_clock::time_point> startTime;
+        };
+
+        /**
+         * Enables tracing, if the project config specifies a trace file.
+         *
+         * @param projectConfig
+         */
+        static void configure(const ProjectConfig& projectConfig);
+
+        static bool isEnabled() {
+            return TraceService::enabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Disables tracing and writes all recorded spans to the trace file. This is registered as an exit handler,
+         * by TraceService::configure().
+         */
+        static void finish();
+
+    private:
+        /**
+         * Any spans beyond this limit are discarded, to prevent a forgotten trace from consuming all memory.
+         */
+        static constexpr std::size_t MAX_EVENTS = 1000000;
+
+        struct TraceEvent
+        {
+            const char* name = nullptr;
+            const char* category = nullptr;
+            std::optional<std::uint64_t> id = std::nullopt;
+            std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::time_point();
+            std::chrono::steady_clock::duration duration = std::chrono::steady_clock::duration::zero();
+            ::pid_t threadId = 0;
+
+            /**
+             * Thread name events are recorded once for every thread that records a span, so that the trace viewer
+             * can label the threads.
+             */
+            std::optional<std::string> threadName = std::nullopt;
+        };
+
+        static inline std::atomic<bool> enabled = false;
+        static inline std::optional<std::string> traceFilePath;
+        static inline std::chrono::steady_clock::time_point startTime;
+
+        static inline MpscQueue<TraceEvent> events;
+        static inline std::atomic<std::size_t> eventCount = 0;
+        static inline std::atomic<std::size_t> droppedEventCount = 0;
+
+        static void record(
+            const char* name,
+            const char* category,
+            std::optional<std::uint64_t> id,
+            std::chrono::steady_clock::time_point startTime,
+            std::chrono::steady_clock::time_point endTime
+        );
+    };
+}
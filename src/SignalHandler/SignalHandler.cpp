@@ -1,5 +1,7 @@
 #include "SignalHandler.hpp"
 
+#include <sys/signalfd.h>
+#include <unistd.h>
 #include <csignal>
 #include <thread>
 
@@ -11,20 +13,10 @@ namespace Bloom
     void SignalHandler::run() {
         try {
             this->startup();
-            const auto signalSet = this->getRegisteredSignalSet();
-            int signalNumber = 0;
 
             Logger::debug("SignalHandler ready");
             while(Thread::getThreadState() == ThreadState::READY) {
-                if (::sigwait(&signalSet, &signalNumber) == 0) {
-                    Logger::debug("SIGNAL " + std::to_string(signalNumber) + " received");
-
-                    const auto& handlerIt = this->handlersBySignalNum.find(signalNumber);
-                    if (handlerIt != this->handlersBySignalNum.end()) {
-                        // We have a registered handler for this signal.
-                        handlerIt->second();
-                    }
-                }
+                this->eventLoop.runOnce();
             }
 
         } catch (std::exception& exception) {
@@ -32,6 +24,13 @@ namespace Bloom
         }
 
         Logger::info("Shutting down SignalHandler");
+
+        if (this->signalFileDescriptor.has_value()) {
+            this->eventLoop.unwatch(this->signalFileDescriptor.value());
+            ::close(this->signalFileDescriptor.value());
+            this->signalFileDescriptor = std::nullopt;
+        }
+
         Thread::setThreadState(ThreadState::STOPPED);
     }
 
@@ -43,6 +42,24 @@ namespace Bloom
         auto signalSet = this->getRegisteredSignalSet();
         ::sigprocmask(SIG_SETMASK, &signalSet, NULL);
 
+        /*
+         * All other threads block all signals, so every signal sent to the process will be queued, for us to read
+         * from the signalfd object.
+         */
+        const auto signalFileDescriptor = ::signalfd(-1, &signalSet, SFD_NONBLOCK | SFD_CLOEXEC);
+        if (signalFileDescriptor < 0) {
+            throw Exceptions::Exception("::signalfd() failed - error number: " + std::to_string(errno));
+        }
+
+        this->signalFileDescriptor = signalFileDescriptor;
+        this->eventLoop.watch(
+            signalFileDescriptor,
+            static_cast<std::uint16_t>(::EPOLL_EVENTS::EPOLLIN),
+            [this] (std::uint32_t) {
+                this->handlePendingSignals();
+            }
+        );
+
         // Register handlers
         this->handlersBySignalNum.insert(std::pair(
             SIGINT,
@@ -60,6 +77,24 @@ namespace Bloom
         }
     }
 
+    void SignalHandler::handlePendingSignals() {
+        auto signalInfo = (struct ::signalfd_siginfo) {};
+
+        while (
+            ::read(this->signalFileDescriptor.value(), &signalInfo, sizeof(signalInfo))
+            == static_cast<::ssize_t>(sizeof(signalInfo))
+        ) {
+            const auto signalNumber = static_cast<int>(signalInfo.ssi_signo);
+            Logger::debug("SIGNAL " + std::to_string(signalNumber) + " received");
+
+            const auto& handlerIt = this->handlersBySignalNum.find(signalNumber);
+            if (handlerIt != this->handlersBySignalNum.end()) {
+                // We have a registered handler for this signal.
+                handlerIt->second();
+            }
+        }
+    }
+
     ::sigset_t SignalHandler::getRegisteredSignalSet() const {
         ::sigset_t set = {};
         if (::sigfillset(&set) == -1) {
@@ -80,6 +115,6 @@ namespace Bloom
         }
 
         Logger::info("Attempting clean shutdown");
-        EventManager::triggerEvent(std::make_shared<Events::ShutdownApplication>());
+        EventManager::triggerEvent(Events::makeEvent<Events::ShutdownApplication>());
     }
 }
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <csignal>
+#include <optional>
 
 #include "src/Helpers/Thread.hpp"
+#include "src/Helpers/EventLoop.hpp"
 #include "src/EventManager/EventManager.hpp"
 #include "src/Helpers/SyncSafe.hpp"
 
@@ -19,10 +21,11 @@ namespace Bloom
         void run();
 
         /**
-         * Triggers the shutdown of the SignalHandler thread.
+         * Triggers the shutdown of the SignalHandler thread. This can be called from any thread.
          */
         void triggerShutdown() {
             this->setThreadState(ThreadState::SHUTDOWN_INITIATED);
+            this->eventLoop.notify();
         };
 
     private:
@@ -37,11 +40,23 @@ namespace Bloom
          */
         int shutdownSignalsReceived = 0;
 
+        /**
+         * Signals are received via a signalfd object, monitored by this event loop. The loop is also woken up upon
+         * shutdown (see SignalHandler::triggerShutdown()).
+         */
+        EventLoop eventLoop;
+        std::optional<int> signalFileDescriptor;
+
         /**
          * Initiates the SignalHandler thread.
          */
         void startup();
 
+        /**
+         * Reads all pending signals from the signalfd object and invokes their handlers.
+         */
+        void handlePendingSignals();
+
         /**
          * Fetches all signals currently of interest to the application.
          *
@@ -0,0 +1,402 @@
+#include "AgentExpression.hpp"
+
+#include <algorithm>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::TargetController
+{
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetMemoryEndianness;
+
+    using Exceptions::Exception;
+
+    std::vector<std::uint16_t> AgentExpression::getReferencedRegisterNumbers() const {
+        auto output = std::vector<std::uint16_t>();
+
+        auto position = std::size_t(0);
+        while (position < this->bytecode.size()) {
+            const auto opcode = this->bytecode[position];
+            const auto operandSize = AgentExpression::getOperandSize(opcode);
+
+            if (static_cast<Opcode>(opcode) == Opcode::REG) {
+                const auto registerNumber = static_cast<std::uint16_t>(this->readOperand(position + 1, operandSize));
+
+                if (std::find(output.begin(), output.end(), registerNumber) == output.end()) {
+                    output.push_back(registerNumber);
+                }
+            }
+
+            position += 1 + operandSize;
+        }
+
+        return output;
+    }
+
+    std::uint64_t AgentExpression::evaluate(
+        const RegisterReader& readRegister,
+        const MemoryReader& readMemory,
+        const MemoryCollector& collectMemory
+    ) const {
+        auto stack = std::vector<std::uint64_t>();
+        stack.reserve(AgentExpression::MAX_STACK_SIZE);
+
+        const auto pop = [&stack] {
+            if (stack.empty()) {
+                throw Exception("Agent expression stack underflow");
+            }
+
+            const auto value = stack.back();
+            stack.pop_back();
+            return value;
+        };
+
+        const auto push = [&stack] (std::uint64_t value) {
+            if (stack.size() >= AgentExpression::MAX_STACK_SIZE) {
+                throw Exception("Agent expression stack overflow");
+            }
+
+            stack.push_back(value);
+        };
+
+        const auto signExtend = [] (std::uint64_t value, std::uint64_t bitCount) {
+            if (bitCount == 0 || bitCount >= 64) {
+                return value;
+            }
+
+            const auto signBit = std::uint64_t(1) << (bitCount - 1);
+            value &= (std::uint64_t(1) << bitCount) - 1;
+            return (value ^ signBit) - signBit;
+        };
+
+        const auto trace = [this, &readMemory, &collectMemory] (
+            std::uint64_t gdbAddress,
+            std::uint64_t bytes,
+            bool stopAtZero
+        ) {
+            if (!collectMemory) {
+                throw Exception("Trace operations are only permitted in tracepoint collection expressions");
+            }
+
+            if (bytes > AgentExpression::MAX_TRACE_SIZE) {
+                throw Exception("Agent expression trace operation exceeds size limit");
+            }
+
+            auto buffer = this->readTargetMemory(readMemory, gdbAddress, static_cast<TargetMemorySize>(bytes));
+
+            if (stopAtZero) {
+                const auto zeroIt = std::find(buffer.begin(), buffer.end(), 0x00);
+                buffer.erase(zeroIt == buffer.end() ? zeroIt : zeroIt + 1, buffer.end());
+            }
+
+            collectMemory(static_cast<TargetMemoryAddress>(gdbAddress), std::move(buffer));
+        };
+
+        const auto toValue = [] (const TargetMemoryBuffer& buffer, bool msbFirst) {
+            auto value = std::uint64_t(0);
+
+            for (auto i = std::size_t(0); i < buffer.size(); ++i) {
+                value = (value << 8) | buffer[msbFirst ? i : buffer.size() - 1 - i];
+            }
+
+            return value;
+        };
+
+        auto position = std::size_t(0);
+
+        for (
+            auto operationCount = std::size_t(0);
+            operationCount < AgentExpression::MAX_OPERATION_COUNT;
+            ++operationCount
+        ) {
+            if (position >= this->bytecode.size()) {
+                throw Exception("Agent expression ended without an 'end' operation");
+            }
+
+            const auto opcode = this->bytecode[position];
+            const auto operandSize = AgentExpression::getOperandSize(opcode);
+            const auto operand = this->readOperand(position + 1, operandSize);
+
+            position += 1 + operandSize;
+
+            switch (static_cast<Opcode>(opcode)) {
+                case Opcode::ADD: {
+                    const auto b = pop();
+                    push(pop() + b);
+                    break;
+                }
+                case Opcode::SUB: {
+                    const auto b = pop();
+                    push(pop() - b);
+                    break;
+                }
+                case Opcode::MUL: {
+                    const auto b = pop();
+                    push(pop() * b);
+                    break;
+                }
+                case Opcode::DIV_SIGNED:
+                case Opcode::REM_SIGNED: {
+                    const auto b = static_cast<std::int64_t>(pop());
+                    const auto a = static_cast<std::int64_t>(pop());
+                    const auto divide = static_cast<Opcode>(opcode) == Opcode::DIV_SIGNED;
+
+                    if (b == 0) {
+                        throw Exception("Agent expression division by zero");
+                    }
+
+                    // Avoid the overflow trap on INT64_MIN / -1
+                    if (b == -1) {
+                        push(divide ? std::uint64_t(0) - static_cast<std::uint64_t>(a) : 0);
+                        break;
+                    }
+
+                    push(static_cast<std::uint64_t>(divide ? a / b : a % b));
+                    break;
+                }
+                case Opcode::DIV_UNSIGNED:
+                case Opcode::REM_UNSIGNED: {
+                    const auto b = pop();
+                    const auto a = pop();
+
+                    if (b == 0) {
+                        throw Exception("Agent expression division by zero");
+                    }
+
+                    push(static_cast<Opcode>(opcode) == Opcode::DIV_UNSIGNED ? a / b : a % b);
+                    break;
+                }
+                case Opcode::LSH: {
+                    const auto b = pop();
+                    const auto a = pop();
+                    push(b < 64 ? a << b : 0);
+                    break;
+                }
+                case Opcode::RSH_SIGNED: {
+                    const auto b = pop();
+                    const auto a = static_cast<std::int64_t>(pop());
+                    push(static_cast<std::uint64_t>(a >> std::min(b, std::uint64_t(63))));
+                    break;
+                }
+                case Opcode::RSH_UNSIGNED: {
+                    const auto b = pop();
+                    const auto a = pop();
+                    push(b < 64 ? a >> b : 0);
+                    break;
+                }
+                case Opcode::LOG_NOT: {
+                    push(pop() == 0 ? 1 : 0);
+                    break;
+                }
+                case Opcode::BIT_AND: {
+                    const auto b = pop();
+                    push(pop() & b);
+                    break;
+                }
+                case Opcode::BIT_OR: {
+                    const auto b = pop();
+                    push(pop() | b);
+                    break;
+                }
+                case Opcode::BIT_XOR: {
+                    const auto b = pop();
+                    push(pop() ^ b);
+                    break;
+                }
+                case Opcode::BIT_NOT: {
+                    push(~pop());
+                    break;
+                }
+                case Opcode::EQUAL: {
+                    const auto b = pop();
+                    push(pop() == b ? 1 : 0);
+                    break;
+                }
+                case Opcode::LESS_SIGNED: {
+                    const auto b = static_cast<std::int64_t>(pop());
+                    push(static_cast<std::int64_t>(pop()) < b ? 1 : 0);
+                    break;
+                }
+                case Opcode::LESS_UNSIGNED: {
+                    const auto b = pop();
+                    push(pop() < b ? 1 : 0);
+                    break;
+                }
+                case Opcode::EXT: {
+                    push(signExtend(pop(), operand));
+                    break;
+                }
+                case Opcode::ZERO_EXT: {
+                    const auto value = pop();
+                    push(operand > 0 && operand < 64 ? value & ((std::uint64_t(1) << operand) - 1) : value);
+                    break;
+                }
+                case Opcode::REF8:
+                case Opcode::REF16:
+                case Opcode::REF32:
+                case Opcode::REF64: {
+                    const auto bytes = static_cast<TargetMemorySize>(
+                        1U << (opcode - static_cast<unsigned char>(Opcode::REF8))
+                    );
+
+                    push(toValue(
+                        this->readTargetMemory(readMemory, pop(), bytes),
+                        this->endianness == TargetMemoryEndianness::BIG
+                    ));
+                    break;
+                }
+                case Opcode::TRACE:
+                case Opcode::TRACENZ: {
+                    const auto bytes = pop();
+                    trace(pop(), bytes, static_cast<Opcode>(opcode) == Opcode::TRACENZ);
+                    break;
+                }
+                case Opcode::TRACE_QUICK:
+                case Opcode::TRACE16: {
+                    // The address is left on the stack
+                    const auto gdbAddress = pop();
+                    push(gdbAddress);
+                    trace(gdbAddress, operand, false);
+                    break;
+                }
+                case Opcode::IF_GOTO: {
+                    if (pop() != 0) {
+                        position = static_cast<std::size_t>(operand);
+                    }
+                    break;
+                }
+                case Opcode::GOTO: {
+                    position = static_cast<std::size_t>(operand);
+                    break;
+                }
+                case Opcode::CONST8:
+                case Opcode::CONST16:
+                case Opcode::CONST32:
+                case Opcode::CONST64: {
+                    push(operand);
+                    break;
+                }
+                case Opcode::REG: {
+                    const auto descriptorIt = this->registerDescriptorsByNumber.find(
+                        static_cast<std::uint16_t>(operand)
+                    );
+
+                    if (descriptorIt == this->registerDescriptorsByNumber.end()) {
+                        throw Exception(
+                            "Agent expression references unmapped register (number " + std::to_string(operand) + ")"
+                        );
+                    }
+
+                    push(toValue(readRegister(descriptorIt->second), true));
+                    break;
+                }
+                case Opcode::END: {
+                    // Collection expressions can leave the stack empty - they're evaluated for their side effects
+                    return !stack.empty() ? pop() : 0;
+                }
+                case Opcode::DUP: {
+                    const auto value = pop();
+                    push(value);
+                    push(value);
+                    break;
+                }
+                case Opcode::POP: {
+                    pop();
+                    break;
+                }
+                case Opcode::SWAP: {
+                    const auto b = pop();
+                    const auto a = pop();
+                    push(b);
+                    push(a);
+                    break;
+                }
+                case Opcode::PICK: {
+                    if (operand >= stack.size()) {
+                        throw Exception("Agent expression stack underflow");
+                    }
+
+                    push(stack[stack.size() - 1 - static_cast<std::size_t>(operand)]);
+                    break;
+                }
+                case Opcode::ROT: {
+                    // a b c => c a b
+                    const auto c = pop();
+                    const auto b = pop();
+                    const auto a = pop();
+                    push(c);
+                    push(a);
+                    push(b);
+                    break;
+                }
+                default: {
+                    throw Exception(
+                        "Unsupported agent expression operation (opcode " + std::to_string(opcode) + ")"
+                    );
+                }
+            }
+        }
+
+        throw Exception("Agent expression exceeded the operation limit");
+    }
+
+    std::size_t AgentExpression::getOperandSize(unsigned char opcode) {
+        switch (static_cast<Opcode>(opcode)) {
+            case Opcode::TRACE_QUICK:
+            case Opcode::EXT:
+            case Opcode::CONST8:
+            case Opcode::ZERO_EXT:
+            case Opcode::PICK: {
+                return 1;
+            }
+            case Opcode::IF_GOTO:
+            case Opcode::GOTO:
+            case Opcode::CONST16:
+            case Opcode::REG:
+            case Opcode::TRACE16: {
+                return 2;
+            }
+            case Opcode::CONST32: {
+                return 4;
+            }
+            case Opcode::CONST64: {
+                return 8;
+            }
+            default: {
+                return 0;
+            }
+        }
+    }
+
+    std::uint64_t AgentExpression::readOperand(std::size_t position, std::size_t size) const {
+        if (position + size > this->bytecode.size()) {
+            throw Exception("Truncated agent expression operand");
+        }
+
+        auto value = std::uint64_t(0);
+        for (auto i = std::size_t(0); i < size; ++i) {
+            value = (value << 8) | this->bytecode[position + i];
+        }
+
+        return value;
+    }
+
+    TargetMemoryBuffer AgentExpression::readTargetMemory(
+        const MemoryReader& readMemory,
+        std::uint64_t gdbAddress,
+        TargetMemorySize bytes
+    ) const {
+        const auto address = static_cast<TargetMemoryAddress>(gdbAddress);
+
+        for (const auto& segment : this->memorySegments) {
+            if ((address & segment.offset) == segment.offset) {
+                return readMemory(segment.memoryType, address & ~segment.offset, bytes);
+            }
+        }
+
+        throw Exception("Agent expression references unmapped memory (address " + std::to_string(address) + ")");
+    }
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <map>
+#include <functional>
+
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetRegister.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A GDB agent expression - a bytecode program for a simple stack machine, which GDB compiles from a source-level
+     * expression. We use these to evaluate breakpoint conditions on the TargetController side, so that a breakpoint
+     * whose condition is false can be resumed without involving GDB (see
+     * TargetControllerComponent::breakpointConditionsMet()).
+     *
+     * Agent expressions refer to registers by their GDB register number, and to memory by GDB address. The
+     * component that constructs the expression (the GDB server) must provide the mappings to target registers and
+     * memory types.
+     *
+     * Only the subset of the bytecode that GDB uses for conditions and tracepoint collection is supported. Trace state
+     * variables and floating point operations are rejected upon evaluation.
+     *
+     * For more on agent expressions, see the 'Agent Expressions' appendix of the GDB manual.
+     * @link https://sourceware.org/gdb/current/onlinedocs/gdb.html/Agent-Expressions.html
+     */
+    class AgentExpression
+    {
+    public:
+        /**
+         * Evaluation is aborted after this many operations - a bad expression mustn't be able to hang the
+         * TargetController.
+         */
+        static constexpr std::size_t MAX_OPERATION_COUNT = 10000;
+        static constexpr std::size_t MAX_STACK_SIZE = 100;
+
+        /**
+         * The maximum number of bytes that a single trace operation can record.
+         */
+        static constexpr std::uint64_t MAX_TRACE_SIZE = 4096;
+
+        /**
+         * Maps a range of GDB addresses to a target memory type. GDB addresses are mapped to the first segment whose
+         * offset bits are all set in the address, so segments should be ordered by offset, largest first.
+         */
+        struct MemorySegment
+        {
+            Targets::TargetMemoryAddress offset = 0;
+            Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::FLASH;
+
+            MemorySegment(Targets::TargetMemoryAddress offset, Targets::TargetMemoryType memoryType)
+                : offset(offset)
+                , memoryType(memoryType)
+            {};
+        };
+
+        /**
+         * Should return the value of the given register (in MSB form, as with all register values from the target).
+         */
+        using RegisterReader = std::function<Targets::TargetMemoryBuffer(const Targets::TargetRegisterDescriptor&)>;
+
+        using MemoryReader = std::function<Targets::TargetMemoryBuffer(
+            Targets::TargetMemoryType,
+            Targets::TargetMemoryAddress,
+            Targets::TargetMemorySize
+        )>;
+
+        /**
+         * Receives the memory recorded by the trace operations ('trace', 'trace_quick', etc), along with the GDB
+         * address it was read from.
+         */
+        using MemoryCollector = std::function<void(Targets::TargetMemoryAddress, Targets::TargetMemoryBuffer&&)>;
+
+        std::vector<unsigned char> bytecode;
+
+        /**
+         * The target registers referenced by the expression, mapped by GDB register number. A reference to any
+         * register that isn't in this map will fail evaluation.
+         */
+        std::map<std::uint16_t, Targets::TargetRegisterDescriptor> registerDescriptorsByNumber;
+
+        std::vector<MemorySegment> memorySegments;
+        Targets::TargetMemoryEndianness endianness = Targets::TargetMemoryEndianness::LITTLE;
+
+        AgentExpression() = default;
+        explicit AgentExpression(std::vector<unsigned char>&& bytecode)
+            : bytecode(std::move(bytecode))
+        {};
+
+        /**
+         * Returns the GDB register numbers referenced by the expression's 'reg' operations.
+         *
+         * @throws Exception
+         *  If the bytecode is malformed.
+         *
+         * @return
+         */
+        [[nodiscard]] std::vector<std::uint16_t> getReferencedRegisterNumbers() const;
+
+        /**
+         * Evaluates the expression.
+         *
+         * @param readRegister
+         * @param readMemory
+         *
+         * @param collectMemory
+         *  Required for expressions that contain trace operations (tracepoint collection expressions). For
+         *  condition expressions, this can be omitted, in which case any trace operation will fail evaluation.
+         *
+         * @throws Exception
+         *  If the bytecode is malformed or contains unsupported operations, if it references an unmapped register,
+         *  if it divides by zero, or if it exceeds the stack or operation limits.
+         *
+         * @return
+         *  The value on the top of the stack, upon the 'end' operation, or 0 if the stack is empty.
+         */
+        std::uint64_t evaluate(
+            const RegisterReader& readRegister,
+            const MemoryReader& readMemory,
+            const MemoryCollector& collectMemory = {}
+        ) const;
+
+    private:
+        enum class Opcode: unsigned char
+        {
+            FLOAT = 0x01,
+            ADD = 0x02,
+            SUB = 0x03,
+            MUL = 0x04,
+            DIV_SIGNED = 0x05,
+            DIV_UNSIGNED = 0x06,
+            REM_SIGNED = 0x07,
+            REM_UNSIGNED = 0x08,
+            LSH = 0x09,
+            RSH_SIGNED = 0x0A,
+            RSH_UNSIGNED = 0x0B,
+            TRACE = 0x0C,
+            TRACE_QUICK = 0x0D,
+            LOG_NOT = 0x0E,
+            BIT_AND = 0x0F,
+            BIT_OR = 0x10,
+            BIT_XOR = 0x11,
+            BIT_NOT = 0x12,
+            EQUAL = 0x13,
+            LESS_SIGNED = 0x14,
+            LESS_UNSIGNED = 0x15,
+            EXT = 0x16,
+            REF8 = 0x17,
+            REF16 = 0x18,
+            REF32 = 0x19,
+            REF64 = 0x1A,
+            IF_GOTO = 0x20,
+            GOTO = 0x21,
+            CONST8 = 0x22,
+            CONST16 = 0x23,
+            CONST32 = 0x24,
+            CONST64 = 0x25,
+            REG = 0x26,
+            END = 0x27,
+            DUP = 0x28,
+            POP = 0x29,
+            ZERO_EXT = 0x2A,
+            SWAP = 0x2B,
+            TRACENZ = 0x2F,
+            TRACE16 = 0x30,
+            PICK = 0x32,
+            ROT = 0x33,
+        };
+
+        /**
+         * Returns the size of the immediate operand of the given opcode, in bytes.
+         *
+         * @param opcode
+         * @return
+         */
+        static std::size_t getOperandSize(unsigned char opcode);
+
+        /**
+         * Reads a big-endian immediate operand from the bytecode.
+         *
+         * @param position
+         * @param size
+         *
+         * @throws Exception
+         *  If the operand extends beyond the end of the bytecode.
+         *
+         * @return
+         */
+        std::uint64_t readOperand(std::size_t position, std::size_t size) const;
+
+        Targets::TargetMemoryBuffer readTargetMemory(
+            const MemoryReader& readMemory,
+            std::uint64_t gdbAddress,
+            Targets::TargetMemorySize bytes
+        ) const;
+    };
+}
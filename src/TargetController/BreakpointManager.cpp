@@ -0,0 +1,213 @@
+#include "BreakpointManager.hpp"
+
+#include <algorithm>
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::TargetController
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetWatchpoint;
+    using Targets::TargetWatchpointType;
+
+    void BreakpointManager::reset(std::uint16_t hardwareBreakpointCount, std::uint16_t dataBreakpointCount) {
+        this->requestedAddresses.clear();
+        this->softwareBreakpointAddresses.clear();
+        this->hardwareBreakpointAddresses.assign(hardwareBreakpointCount, std::nullopt);
+
+        this->requestedWatchpoints.clear();
+        this->dataBreakpoints.assign(std::min(dataBreakpointCount, hardwareBreakpointCount), std::nullopt);
+    }
+
+    void BreakpointManager::addBreakpoint(TargetMemoryAddress address) {
+        this->requestedAddresses.insert(address);
+    }
+
+    void BreakpointManager::removeBreakpoint(TargetMemoryAddress address) {
+        this->requestedAddresses.erase(address);
+    }
+
+    void BreakpointManager::addWatchpoint(const TargetWatchpoint& watchpoint) {
+        if (watchpoint.size == 0) {
+            throw Exceptions::Exception("Invalid watchpoint size");
+        }
+
+        auto watchpoints = this->requestedWatchpoints;
+        watchpoints.push_back(watchpoint);
+
+        if (BreakpointManager::resolveDataBreakpoints(watchpoints).size() > this->dataBreakpoints.size()) {
+            throw Exceptions::Exception(
+                "Insufficient data breakpoints - the target has " + std::to_string(this->dataBreakpoints.size())
+                    + " data breakpoint(s), each of which can only watch a single byte"
+            );
+        }
+
+        this->requestedWatchpoints = std::move(watchpoints);
+    }
+
+    void BreakpointManager::removeWatchpoint(const TargetWatchpoint& watchpoint) {
+        const auto watchpointIt = std::find_if(
+            this->requestedWatchpoints.begin(),
+            this->requestedWatchpoints.end(),
+            [&watchpoint] (const TargetWatchpoint& requestedWatchpoint) {
+                return requestedWatchpoint.address == watchpoint.address
+                    && requestedWatchpoint.size == watchpoint.size
+                    && requestedWatchpoint.type == watchpoint.type;
+            }
+        );
+
+        if (watchpointIt != this->requestedWatchpoints.end()) {
+            this->requestedWatchpoints.erase(watchpointIt);
+        }
+    }
+
+    void BreakpointManager::commit(
+        Targets::Target& target,
+        std::optional<TargetMemoryAddress> retainedAddress
+    ) {
+        /*
+         * Removals come first, to free up any hardware breakpoints for the additions.
+         *
+         * We keep the target and our records in sync as we go, so that a failure part way through doesn't leave us
+         * with stale records.
+         */
+        const auto requestedDataBreakpoints = BreakpointManager::resolveDataBreakpoints(this->requestedWatchpoints);
+
+        for (auto index = std::size_t(0); index < this->dataBreakpoints.size(); ++index) {
+            auto& dataBreakpoint = this->dataBreakpoints[index];
+
+            if (!dataBreakpoint.has_value()) {
+                continue;
+            }
+
+            const auto requestedIt = requestedDataBreakpoints.find(dataBreakpoint->first);
+            if (requestedIt == requestedDataBreakpoints.end() || requestedIt->second != dataBreakpoint->second) {
+                target.removeDataBreakpoint(static_cast<std::uint16_t>(index));
+                dataBreakpoint = std::nullopt;
+            }
+        }
+
+        for (auto index = std::size_t(0); index < this->hardwareBreakpointAddresses.size(); ++index) {
+            auto& hardwareBreakpointAddress = this->hardwareBreakpointAddresses[index];
+
+            if (
+                hardwareBreakpointAddress.has_value()
+                && !this->requestedAddresses.contains(*hardwareBreakpointAddress)
+                && hardwareBreakpointAddress != retainedAddress
+            ) {
+                target.removeHardwareBreakpoint(static_cast<std::uint16_t>(index));
+                hardwareBreakpointAddress = std::nullopt;
+            }
+        }
+
+        for (const auto& [address, type] : requestedDataBreakpoints) {
+            const auto dataBreakpoint = std::make_optional(std::make_pair(address, type));
+
+            if (
+                std::find(this->dataBreakpoints.begin(), this->dataBreakpoints.end(), dataBreakpoint)
+                != this->dataBreakpoints.end()
+            ) {
+                continue;
+            }
+
+            auto index = std::size_t(0);
+            while (index < this->dataBreakpoints.size() && !this->isHardwareBreakpointFree(index)) {
+                ++index;
+            }
+
+            if (index == this->dataBreakpoints.size()) {
+                /*
+                 * All data breakpoints are in use, but addWatchpoint() ensures we have enough of them for all
+                 * requested watchpoints, so at least one of them must be holding a hardware breakpoint. That
+                 * breakpoint will be moved elsewhere (a different hardware breakpoint or a software breakpoint),
+                 * below.
+                 */
+                index = 0;
+                while (this->dataBreakpoints[index].has_value()) {
+                    ++index;
+                }
+
+                target.removeHardwareBreakpoint(static_cast<std::uint16_t>(index));
+                this->hardwareBreakpointAddresses[index] = std::nullopt;
+            }
+
+            target.setDataBreakpoint(static_cast<std::uint16_t>(index), address, type);
+            this->dataBreakpoints[index] = dataBreakpoint;
+        }
+
+        auto softwareBreakpointsToRemove = std::vector<TargetMemoryAddress>();
+        for (const auto address : this->softwareBreakpointAddresses) {
+            if (!this->requestedAddresses.contains(address) && address != retainedAddress) {
+                softwareBreakpointsToRemove.push_back(address);
+            }
+        }
+
+        if (!softwareBreakpointsToRemove.empty()) {
+            Logger::debug("Removing " + std::to_string(softwareBreakpointsToRemove.size()) + " software breakpoint(s)");
+            target.removeSoftwareBreakpoints(softwareBreakpointsToRemove);
+
+            for (const auto address : softwareBreakpointsToRemove) {
+                this->softwareBreakpointAddresses.erase(address);
+            }
+        }
+
+        auto softwareBreakpointsToSet = std::vector<TargetMemoryAddress>();
+        for (const auto address : this->requestedAddresses) {
+            if (
+                this->softwareBreakpointAddresses.contains(address)
+                || std::find(
+                    this->hardwareBreakpointAddresses.begin(),
+                    this->hardwareBreakpointAddresses.end(),
+                    address
+                ) != this->hardwareBreakpointAddresses.end()
+            ) {
+                // This breakpoint is already in place
+                continue;
+            }
+
+            auto freeIndex = std::size_t(0);
+            while (freeIndex < this->hardwareBreakpointAddresses.size() && !this->isHardwareBreakpointFree(freeIndex)) {
+                ++freeIndex;
+            }
+
+            if (freeIndex < this->hardwareBreakpointAddresses.size()) {
+                target.setHardwareBreakpoint(static_cast<std::uint16_t>(freeIndex), address);
+                this->hardwareBreakpointAddresses[freeIndex] = address;
+                continue;
+            }
+
+            softwareBreakpointsToSet.push_back(address);
+        }
+
+        if (!softwareBreakpointsToSet.empty()) {
+            // The addresses are sorted (courtesy of std::set), so breakpoints within the same page are adjacent
+            Logger::debug("Setting " + std::to_string(softwareBreakpointsToSet.size()) + " software breakpoint(s)");
+            target.setSoftwareBreakpoints(softwareBreakpointsToSet);
+            this->softwareBreakpointAddresses.insert(softwareBreakpointsToSet.begin(), softwareBreakpointsToSet.end());
+        }
+    }
+
+    std::map<TargetMemoryAddress, TargetWatchpointType> BreakpointManager::resolveDataBreakpoints(
+        const std::vector<TargetWatchpoint>& watchpoints
+    ) {
+        auto output = std::map<TargetMemoryAddress, TargetWatchpointType>();
+
+        for (const auto& watchpoint : watchpoints) {
+            for (auto address = watchpoint.address; address < watchpoint.address + watchpoint.size; ++address) {
+                const auto [typeIt, inserted] = output.emplace(address, watchpoint.type);
+
+                if (!inserted && typeIt->second != watchpoint.type) {
+                    typeIt->second = TargetWatchpointType::ACCESS;
+                }
+            }
+        }
+
+        return output;
+    }
+
+    bool BreakpointManager::isHardwareBreakpointFree(std::size_t index) const {
+        return !this->hardwareBreakpointAddresses[index].has_value()
+            && (index >= this->dataBreakpoints.size() || !this->dataBreakpoints[index].has_value());
+    }
+}
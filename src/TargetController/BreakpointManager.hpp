@@ -0,0 +1,192 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <vector>
+#include <map>
+#include <optional>
+#include <algorithm>
+
+#include "src/Targets/Target.hpp"
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetBreakpoint.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * Keeps track of the breakpoints requested by other components, and decides how each breakpoint is implemented on
+     * the target.
+     *
+     * Hardware breakpoints are cheap to set and remove, but there are only a few of them. Software breakpoints are
+     * unlimited, but they're implemented by rewriting program memory, which is slow and wears the target's flash.
+     * So we place breakpoints in hardware for as long as we have comparators available, and only fall back to
+     * software breakpoints when we've run out.
+     *
+     * Changes to the requested breakpoints are not applied to the target immediately. They're applied in a single
+     * pass (see BreakpointManager::commit()), just before the target resumes execution. This means:
+     *  - Software breakpoints are inserted/removed with a single command, allowing the debug tool to rewrite each
+     *    affected flash page once, as opposed to once per breakpoint.
+     *  - Breakpoints that are removed and then re-added before the target resumes (which GDB does every time the
+     *    target stops) don't touch the target at all.
+     *
+     * Watchpoints are implemented with data breakpoints, which occupy the same comparators as hardware breakpoints.
+     * There is no fallback for watchpoints, so they take precedence - a hardware breakpoint will be moved to
+     * software if its comparator is needed for a watchpoint.
+     */
+    class BreakpointManager
+    {
+    public:
+        /**
+         * Discards all breakpoint state. This should be called whenever the breakpoints on the target have been
+         * cleared by other means (e.g. target activation/deactivation).
+         *
+         * @param hardwareBreakpointCount
+         *  The number of hardware breakpoints available on the target.
+         *
+         * @param dataBreakpointCount
+         *  The number of hardware breakpoints that can be used as data breakpoints.
+         */
+        void reset(std::uint16_t hardwareBreakpointCount, std::uint16_t dataBreakpointCount);
+
+        /**
+         * Requests a breakpoint at the given address. The breakpoint will be set upon the next commit.
+         *
+         * @param address
+         */
+        void addBreakpoint(Targets::TargetMemoryAddress address);
+
+        /**
+         * Requests the removal of the breakpoint at the given address. The breakpoint will be removed upon the next
+         * commit.
+         *
+         * @param address
+         */
+        void removeBreakpoint(Targets::TargetMemoryAddress address);
+
+        /**
+         * Checks if a breakpoint has been requested at the given address.
+         *
+         * @param address
+         * @return
+         */
+        [[nodiscard]] bool isBreakpointSet(Targets::TargetMemoryAddress address) const {
+            return this->requestedAddresses.contains(address);
+        }
+
+        /**
+         * Checks if a breakpoint (hardware or software) is currently in place on the target, at the given address.
+         *
+         * @param address
+         * @return
+         */
+        [[nodiscard]] bool isBreakpointInstalled(Targets::TargetMemoryAddress address) const {
+            return this->softwareBreakpointAddresses.contains(address)
+                || std::find(
+                    this->hardwareBreakpointAddresses.begin(),
+                    this->hardwareBreakpointAddresses.end(),
+                    address
+                ) != this->hardwareBreakpointAddresses.end();
+        }
+
+        /**
+         * Checks if any watchpoints have been requested, or are still in place on the target.
+         *
+         * @return
+         */
+        [[nodiscard]] bool hasWatchpoints() const {
+            return !this->requestedWatchpoints.empty()
+                || std::any_of(
+                    this->dataBreakpoints.begin(),
+                    this->dataBreakpoints.end(),
+                    [] (const auto& dataBreakpoint) {
+                        return dataBreakpoint.has_value();
+                    }
+                );
+        }
+
+        /**
+         * Requests a watchpoint. The watchpoint will be set upon the next commit.
+         *
+         * Each watched byte requires its own data breakpoint. This function will throw an exception if there are
+         * insufficient data breakpoints for the watchpoint, as opposed to failing upon commit.
+         *
+         * @param watchpoint
+         */
+        void addWatchpoint(const Targets::TargetWatchpoint& watchpoint);
+
+        /**
+         * Requests the removal of a watchpoint. The watchpoint will be removed upon the next commit.
+         *
+         * @param watchpoint
+         */
+        void removeWatchpoint(const Targets::TargetWatchpoint& watchpoint);
+
+        /**
+         * Applies any outstanding changes to the target. Breakpoints that are already in place on the target are left
+         * untouched.
+         *
+         * This must be called before the target resumes execution.
+         *
+         * @param target
+         *
+         * @param retainedAddress
+         *  If provided, any breakpoint currently in place at this address will be left in place, even if its removal
+         *  has been requested. See TargetControllerComponent::handleStepTargetExecution() for why this is useful.
+         *
+         *  The breakpoint will be removed upon the next commit that doesn't retain it (unless it's re-requested in
+         *  the meantime).
+         */
+        void commit(
+            Targets::Target& target,
+            std::optional<Targets::TargetMemoryAddress> retainedAddress = std::nullopt
+        );
+
+    private:
+        /**
+         * Addresses of all requested breakpoints, regardless of whether they've been committed.
+         */
+        std::set<Targets::TargetMemoryAddress> requestedAddresses;
+
+        /**
+         * Addresses of the hardware breakpoints currently set on the target, indexed by hardware breakpoint index.
+         */
+        std::vector<std::optional<Targets::TargetMemoryAddress>> hardwareBreakpointAddresses;
+
+        /**
+         * Addresses of the software breakpoints currently set on the target.
+         */
+        std::set<Targets::TargetMemoryAddress> softwareBreakpointAddresses;
+
+        /**
+         * All requested watchpoints, regardless of whether they've been committed.
+         */
+        std::vector<Targets::TargetWatchpoint> requestedWatchpoints;
+
+        /**
+         * The data breakpoints currently set on the target (address and type), indexed by hardware breakpoint index.
+         */
+        std::vector<std::optional<std::pair<Targets::TargetMemoryAddress, Targets::TargetWatchpointType>>>
+            dataBreakpoints;
+
+        /**
+         * Computes the data breakpoints required for the given watchpoints, mapped by address.
+         *
+         * Where watchpoints of different types overlap, the overlapping bytes are watched for any access.
+         *
+         * @param watchpoints
+         * @return
+         */
+        static std::map<Targets::TargetMemoryAddress, Targets::TargetWatchpointType> resolveDataBreakpoints(
+            const std::vector<Targets::TargetWatchpoint>& watchpoints
+        );
+
+        /**
+         * Checks if the hardware breakpoint with the given index is free for use (holds neither a hardware breakpoint
+         * nor a data breakpoint).
+         *
+         * @param index
+         * @return
+         */
+        [[nodiscard]] bool isHardwareBreakpointFree(std::size_t index) const;
+    };
+}
@@ -3,21 +3,68 @@
 #include <memory>
 #include <chrono>
 #include <optional>
+#include <future>
+#include <algorithm>
+#include <functional>
+#include <utility>
 
 #include "Commands/Command.hpp"
 #include "Responses/Response.hpp"
 #include "Responses/Error.hpp"
 #include "TargetControllerComponent.hpp"
 
+#include "src/Helpers/SyncSafe.hpp"
 #include "src/Exceptions/Exception.hpp"
 
 #include "src/Logger/Logger.hpp"
+#include "src/Services/TraceService.hpp"
+#include "src/Services/MetricsService.hpp"
 
 namespace Bloom::TargetController
 {
     class CommandManager
     {
     public:
+        CommandManager() = default;
+
+        /**
+         * Commands issued via this CommandManager will be sent to the given TargetController, as opposed to the
+         * default TargetController (see TargetControllerComponent::registerCommand()).
+         *
+         * @param targetController
+         */
+        explicit CommandManager(TargetControllerComponent& targetController)
+            : targetController(&targetController)
+        {}
+
+        /**
+         * Sets the priority of commands issued via this CommandManager. Commands with a higher intrinsic priority
+         * (see Commands::Command::priority) will retain their priority.
+         *
+         * @param priority
+         */
+        void setCommandPriority(Commands::CommandPriority priority) {
+            this->commandPriority = priority;
+        }
+
+        using OperationProgressHandler = std::function<
+            void(Targets::TargetMemorySize bytesCompleted, Targets::TargetMemorySize bytesTotal)
+        >;
+
+        /**
+         * Sets a handler for the progress of long-running operations, for commands issued via this CommandManager
+         * (see Commands::Command::operationProgressCallback). Pass an empty handler to remove it.
+         *
+         * Unlike the command's callback, the handler is invoked from the issuing thread, whilst it waits for the
+         * response. Progress is checked every OPERATION_PROGRESS_POLL_INTERVAL, and only the latest progress is
+         * reported - so the handler is invoked at most once per interval.
+         *
+         * @param handler
+         */
+        void setOperationProgressHandler(OperationProgressHandler handler) {
+            this->operationProgressHandler = std::move(handler);
+        }
+
         template<class CommandType>
             requires
                 std::is_base_of_v<Commands::Command, CommandType>
@@ -29,47 +76,155 @@ namespace Bloom::TargetController
             using SuccessResponseType = typename CommandType::SuccessResponseType;
 
             const auto commandId = command->id;
-            Logger::debug(
-                "Issuing " + CommandType::name + " command (ID: " + std::to_string(commandId) + ") to TargetController"
+            command->priority = std::min(command->priority, this->commandPriority);
+
+            const auto traceSpan = Services::TraceService::Span(
+                CommandType::name.c_str(),
+                "CommandManager",
+                commandId
             );
 
-            TargetControllerComponent::registerCommand(std::move(command));
+            // One histogram per command type - this is initialised once per template instantiation
+            static auto& latencyHistogram = Services::MetricsService::histogram(
+                "commands." + CommandType::name + ".latencyUs"
+            );
+
+            Logger::debug("Issuing ", CommandType::name, " command (ID: ", commandId, ") to TargetController");
+
+            /*
+             * The TargetController reports progress from its own thread, so we just record the latest progress, for
+             * the handler to pick up from this thread. The record is shared, as the TargetController may outlive our
+             * wait (upon a timeout).
+             */
+            using Progress = std::optional<std::pair<Targets::TargetMemorySize, Targets::TargetMemorySize>>;
+            const auto progress = this->operationProgressHandler ? std::make_shared<SyncSafe<Progress>>() : nullptr;
+
+            if (progress != nullptr) {
+                command->operationProgressCallback = [progress] (
+                    Targets::TargetMemorySize bytesCompleted,
+                    Targets::TargetMemorySize bytesTotal
+                ) {
+                    progress->setValue(std::pair(bytesCompleted, bytesTotal));
+                };
+            }
+
+            const auto issueTime = std::chrono::steady_clock::now();
+            auto responseFuture = this->targetController != nullptr
+                ? this->targetController->queueCommand(std::move(command))
+                : TargetControllerComponent::registerCommand(std::move(command));
+
+            const auto deadline = issueTime + timeout;
+            auto responseStatus = std::future_status::timeout;
+
+            while (std::chrono::steady_clock::now() < deadline) {
+                responseStatus = responseFuture.wait_until(
+                    progress != nullptr
+                        ? std::min(
+                            deadline,
+                            std::chrono::steady_clock::now() + CommandManager::OPERATION_PROGRESS_POLL_INTERVAL
+                        )
+                        : deadline
+                );
 
-            auto optionalResponse = TargetControllerComponent::waitForResponse(commandId, timeout);
+                if (responseStatus == std::future_status::ready) {
+                    break;
+                }
 
-            if (!optionalResponse.has_value()) {
+                if (progress != nullptr) {
+                    auto latestProgress = Progress();
+
+                    {
+                        const auto lock = progress->acquireLock();
+                        latestProgress.swap(progress->getValue());
+                    }
+
+                    if (latestProgress.has_value()) {
+                        this->operationProgressHandler(latestProgress->first, latestProgress->second);
+                    }
+                }
+            }
+
+            if (responseStatus != std::future_status::ready) {
                 Logger::debug(
-                    "Timed out whilst waiting for TargetController to respond to " + CommandType::name + " command"
+                    "Timed out whilst waiting for TargetController to respond to ", CommandType::name, " command"
                 );
                 throw Exceptions::Exception("Command timed out");
             }
 
-            auto& response = optionalResponse.value();
+            latencyHistogram.recordDuration(std::chrono::steady_clock::now() - issueTime);
+
+            auto response = std::unique_ptr<Responses::Response>(nullptr);
+
+            try {
+                response = responseFuture.get();
+
+            } catch (const std::future_error&) {
+                // The TargetController dropped the command without responding (this can happen upon a fatal error)
+                throw Exceptions::Exception("TargetController failed to respond to command");
+            }
 
             if (response->getType() == Responses::ResponseType::ERROR) {
-                const auto errorResponse = dynamic_cast<Responses::Error*>(response.get());
+                const auto errorResponse = static_cast<Responses::Error*>(response.get());
 
                 Logger::debug(
-                    "TargetController returned error in response to " + CommandType::name + " command (ID: "
-                        + std::to_string(commandId) + "). Error: " + errorResponse->errorMessage
+                    "TargetController returned error in response to ", CommandType::name, " command (ID: ",
+                    commandId, "). Error: ", errorResponse->errorMessage
                 );
                 throw Exceptions::Exception(errorResponse->errorMessage);
             }
 
-            Logger::debug(
-                "Delivering response for " + CommandType::name + " command (ID: " + std::to_string(commandId) + ")"
-            );
+            Logger::debug("Delivering response for ", CommandType::name, " command (ID: ", commandId, ")");
 
-            // Only downcast if the command's SuccessResponseType is not the generic Response type.
+            /*
+             * Only downcast if the command's SuccessResponseType is not the generic Response type.
+             *
+             * Each response class has a unique type tag, so once we've checked the tag, we can use a static_cast
+             * instead of the more expensive dynamic_cast.
+             */
             if constexpr (!std::is_same_v<SuccessResponseType, Responses::Response>) {
-                assert(response->getType() == SuccessResponseType::type);
+                if (response->getType() != SuccessResponseType::type) {
+                    throw Exceptions::Exception(
+                        "Unexpected response type from TargetController for " + CommandType::name + " command"
+                    );
+                }
+
                 return std::unique_ptr<SuccessResponseType>(
-                    dynamic_cast<SuccessResponseType*>(response.release())
+                    static_cast<SuccessResponseType*>(response.release())
                 );
 
             } else {
-                return std::move(response);
+                return response;
             }
         }
+
+        /**
+         * Returns the target descriptor published by the TargetController, without issuing a command (see
+         * TargetControllerComponent::getPublishedTargetDescriptor()).
+         *
+         * @param includeVariants
+         *
+         * @return
+         */
+        [[nodiscard]] std::shared_ptr<const Targets::TargetDescriptor> getPublishedTargetDescriptor(
+            bool includeVariants
+        ) const {
+            return this->targetController != nullptr
+                ? this->targetController->getPublishedTargetDescriptor(includeVariants)
+                : TargetControllerComponent::getDefaultPublishedTargetDescriptor(includeVariants);
+        }
+
+    private:
+        /**
+         * See CommandManager::setOperationProgressHandler().
+         */
+        static constexpr auto OPERATION_PROGRESS_POLL_INTERVAL = std::chrono::milliseconds(500);
+
+        Commands::CommandPriority commandPriority = Commands::CommandPriority::INTERACTIVE;
+        OperationProgressHandler operationProgressHandler;
+
+        /**
+         * If not set, commands will be sent to the default TargetController.
+         */
+        TargetControllerComponent* targetController = nullptr;
     };
 }
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Command.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Cancels a previously issued command.
+     *
+     * If the command is still awaiting processing, it will be rejected with an error. If the command is a large memory
+     * operation that is in progress, the operation will be aborted at the end of the current chunk. Otherwise, this
+     * command has no effect.
+     */
+    class CancelCommand: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::CANCEL_COMMAND;
+        static const inline std::string name = "CancelCommand";
+
+        CommandIdType commandId;
+
+        explicit CancelCommand(CommandIdType commandId)
+            : commandId(commandId)
+        {
+            this->priority = CommandPriority::REALTIME;
+        };
+
+        [[nodiscard]] CommandType getType() const override {
+            return CancelCommand::type;
+        }
+
+        [[nodiscard]] bool requiresActiveState() const override {
+            return false;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return false;
+        }
+    };
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Command.hpp"
+
+#include "src/Targets/TargetRegister.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Captures the target's RAM, CPU registers (GPRs, status register, stack pointer and program counter) and the
+     * given peripheral registers, so that the target can later be returned to this state via RestoreCheckpoint.
+     *
+     * Only one checkpoint is held at any one time - capturing a new checkpoint replaces the previous one.
+     */
+    class CaptureCheckpoint: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::CAPTURE_CHECKPOINT;
+        static const inline std::string name = "CaptureCheckpoint";
+
+        Targets::TargetRegisterDescriptors peripheralRegisterDescriptors;
+
+        explicit CaptureCheckpoint(const Targets::TargetRegisterDescriptors& peripheralRegisterDescriptors)
+            : peripheralRegisterDescriptors(peripheralRegisterDescriptors)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return CaptureCheckpoint::type;
+        }
+
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return true;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return true;
+        }
+    };
+}
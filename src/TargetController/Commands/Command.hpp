@@ -3,11 +3,18 @@
 #include <string>
 #include <atomic>
 #include <cstdint>
+#include <cstddef>
+#include <functional>
 
 #include "CommandTypes.hpp"
+#include "CommandPriority.hpp"
 
 #include "src/TargetController/Responses/Response.hpp"
 
+#include "src/Targets/TargetMemory.hpp"
+
+#include "src/Helpers/MemoryPool.hpp"
+
 namespace Bloom::TargetController::Commands
 {
     using CommandIdType = int;
@@ -20,6 +27,25 @@ namespace Bloom::TargetController::Commands
 
         CommandIdType id = ++(Command::lastCommandId);
 
+        /**
+         * The priority of the command.
+         *
+         * Most commands have no intrinsic urgency, so they default to the lowest priority. The CommandManager raises
+         * this to the priority of the issuer (see CommandManager::setCommandPriority()). Commands that are always
+         * urgent can set a higher priority at construction.
+         */
+        CommandPriority priority = CommandPriority::BACKGROUND;
+
+        /**
+         * Invoked by the TargetController, from its own thread, with the progress of long-running operations (such as
+         * chunked memory reads and writes - see TargetControllerComponent::completeMemoryOperationChunk()).
+         *
+         * This is set by the CommandManager - see CommandManager::setOperationProgressHandler().
+         */
+        std::function<
+            void(Targets::TargetMemorySize bytesCompleted, Targets::TargetMemorySize bytesTotal)
+        > operationProgressCallback;
+
         static constexpr CommandType type = CommandType::GENERIC;
         static const inline std::string name = "GenericCommand";
 
@@ -32,6 +58,19 @@ namespace Bloom::TargetController::Commands
         Command& operator = (const Command& other) = default;
         Command& operator = (Command&& other) = default;
 
+        /*
+         * Commands are allocated by the issuing thread and freed by the TargetController, at a high rate (every
+         * TargetControllerService call issues at least one). We recycle their memory via a pool, to keep the heap out
+         * of the round trip.
+         */
+        static void* operator new(std::size_t size) {
+            return MemoryPool<Command>::allocate(size);
+        }
+
+        static void operator delete(void* pointer, std::size_t size) {
+            MemoryPool<Command>::deallocate(pointer, size);
+        }
+
         [[nodiscard]] virtual CommandType getType() const {
             return Command::type;
         }
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <type_traits>
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/CommandBatchResponses.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * A batch of commands, to be issued to the TargetController in a single submission.
+     *
+     * The TargetController will process each command in the batch, in order, as if each one was issued individually.
+     * The responses are delivered together, in a single CommandBatchResponses response. The failure of one command
+     * does not prevent the processing of the others - errors are reported via an Error response, in place of the
+     * failed command's response.
+     */
+    class CommandBatch: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::CommandBatchResponses;
+
+        static constexpr CommandType type = CommandType::COMMAND_BATCH;
+        static const inline std::string name = "CommandBatch";
+
+        std::vector<std::unique_ptr<Command>> commands;
+
+        CommandBatch() = default;
+
+        /**
+         * Appends a command to the batch.
+         *
+         * @tparam CommandType
+         * @param command
+         *
+         * @return
+         *  The index of the command within the batch. This can be used to retrieve the command's response (see
+         *  CommandBatchResponses::takeResponse()).
+         */
+        template<class CommandType>
+            requires std::is_base_of_v<Command, CommandType>
+        std::size_t addCommand(std::unique_ptr<CommandType> command) {
+            this->commands.emplace_back(std::move(command));
+            return this->commands.size() - 1;
+        }
+
+        [[nodiscard]] CommandType getType() const override {
+            return CommandBatch::type;
+        }
+
+        /*
+         * Each command in the batch is checked individually, so the batch itself has no requirements.
+         */
+        [[nodiscard]] bool requiresActiveState() const override {
+            return false;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return false;
+        }
+    };
+}
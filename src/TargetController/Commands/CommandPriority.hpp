@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Command priority classes. The TargetController services pending commands of a higher priority class first.
+     *
+     * Lower values represent higher priorities.
+     */
+    enum class CommandPriority: std::uint8_t
+    {
+        /**
+         * For commands that must be serviced as soon as possible, regardless of who issued them (e.g. halting the
+         * target).
+         */
+        REALTIME,
+
+        /**
+         * For commands issued in response to direct user interaction, such as commands from the debug client.
+         */
+        INTERACTIVE,
+
+        /**
+         * For commands issued as part of background work, such as the Insight worker's tasks.
+         */
+        BACKGROUND,
+    };
+}
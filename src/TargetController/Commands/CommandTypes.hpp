@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 
 namespace Bloom::TargetController::Commands
 {
@@ -19,16 +20,51 @@ namespace Bloom::TargetController::Commands
         READ_TARGET_MEMORY,
         WRITE_TARGET_MEMORY,
         ERASE_TARGET_MEMORY,
+        FILL_TARGET_MEMORY,
+        COMPUTE_TARGET_MEMORY_CRC,
+        SEARCH_TARGET_MEMORY,
         GET_TARGET_STATE,
         STEP_TARGET_EXECUTION,
         SET_BREAKPOINT,
         REMOVE_BREAKPOINT,
+        SET_WATCHPOINT,
+        REMOVE_WATCHPOINT,
         SET_TARGET_PROGRAM_COUNTER,
         GET_TARGET_PIN_STATES,
         SET_TARGET_PIN_STATE,
+        SET_TARGET_PIN_STATE_STREAMING,
         GET_TARGET_STACK_POINTER,
         GET_TARGET_PROGRAM_COUNTER,
         ENABLE_PROGRAMMING_MODE,
         DISABLE_PROGRAMMING_MODE,
+        LOAD_PROGRAM_IMAGE,
+        START_PROGRAM_COUNTER_SAMPLING,
+        STOP_PROGRAM_COUNTER_SAMPLING,
+        START_COVERAGE_COLLECTION,
+        STOP_COVERAGE_COLLECTION,
+        START_TRACING,
+        STOP_TRACING,
+        GET_TRACE_STATUS,
+        READ_TRACE_FRAMES,
+        START_LIVE_SAMPLING,
+        STOP_LIVE_SAMPLING,
+        GET_LIVE_SAMPLES,
+        START_TIMING_ANALYSIS,
+        GET_TIMING_ANALYSIS_REPORT,
+        STOP_TIMING_ANALYSIS,
+        START_MEMORY_CHANGE_TIMELINE,
+        STOP_MEMORY_CHANGE_TIMELINE,
+        GET_MEMORY_CHANGES,
+        GET_LAST_MEMORY_CHANGE,
+        CAPTURE_CHECKPOINT,
+        RESTORE_CHECKPOINT,
+        COMMAND_BATCH,
+        CANCEL_COMMAND,
     };
+
+    /**
+     * The number of command types. This must be kept in sync with the last entry in the CommandType enum, as the
+     * TargetController's command handler table is indexed by command type.
+     */
+    static constexpr auto COMMAND_TYPE_COUNT = static_cast<std::size_t>(CommandType::CANCEL_COMMAND) + 1;
 }
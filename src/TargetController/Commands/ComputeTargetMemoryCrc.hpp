@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Command.hpp"
+#include "src/TargetController/Responses/TargetMemoryCrc.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    class ComputeTargetMemoryCrc: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::TargetMemoryCrc;
+
+        static constexpr CommandType type = CommandType::COMPUTE_TARGET_MEMORY_CRC;
+        static const inline std::string name = "ComputeTargetMemoryCrc";
+
+        Targets::TargetMemoryType memoryType;
+        Targets::TargetMemoryAddress startAddress;
+        Targets::TargetMemorySize bytes;
+
+        ComputeTargetMemoryCrc(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes
+        )
+            : memoryType(memoryType)
+            , startAddress(startAddress)
+            , bytes(bytes)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return ComputeTargetMemoryCrc::type;
+        }
+
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return true;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return this->memoryType == Targets::TargetMemoryType::RAM;
+        }
+    };
+}
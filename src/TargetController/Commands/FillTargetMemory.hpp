@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Command.hpp"
+#include "src/TargetController/Responses/TargetMemoryFilled.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Fills a range of target memory with a repeating value.
+     *
+     * The TargetController reads the current content of the range first, and only writes to the parts of the range
+     * that don't already hold the fill value. Where the target supports it, writes are performed a page at a time
+     * (see Target::eepromPageWritesSupported()).
+     *
+     * Program memory cannot be filled via this command - use WriteTargetMemory instead.
+     */
+    class FillTargetMemory: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::TargetMemoryFilled;
+
+        static constexpr CommandType type = CommandType::FILL_TARGET_MEMORY;
+        static const inline std::string name = "FillTargetMemory";
+
+        Targets::TargetMemoryType memoryType;
+        Targets::TargetMemoryAddressRange addressRange;
+
+        /**
+         * The value to repeat across the address range. If the size of the range is not a multiple of the value
+         * size, the value will be truncated in the final repetition.
+         */
+        Targets::TargetMemoryBuffer fillValue;
+
+        FillTargetMemory(
+            Targets::TargetMemoryType memoryType,
+            const Targets::TargetMemoryAddressRange& addressRange,
+            Targets::TargetMemoryBuffer fillValue
+        )
+            : memoryType(memoryType)
+            , addressRange(addressRange)
+            , fillValue(std::move(fillValue))
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return FillTargetMemory::type;
+        }
+
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return true;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return this->memoryType == Targets::TargetMemoryType::RAM;
+        }
+    };
+}
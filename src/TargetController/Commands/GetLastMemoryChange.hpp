@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/LastMemoryChange.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Looks up the most recent change to the given address, in the memory change timeline. See
+     * MemoryChangeTimeline::lastChange().
+     */
+    class GetLastMemoryChange: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::LastMemoryChange;
+
+        static constexpr CommandType type = CommandType::GET_LAST_MEMORY_CHANGE;
+        static const inline std::string name = "GetLastMemoryChange";
+
+        Targets::TargetMemoryType memoryType;
+        Targets::TargetMemoryAddress address;
+
+        GetLastMemoryChange(Targets::TargetMemoryType memoryType, Targets::TargetMemoryAddress address)
+            : memoryType(memoryType)
+            , address(address)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return GetLastMemoryChange::type;
+        }
+    };
+}
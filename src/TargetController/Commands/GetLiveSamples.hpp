@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/LiveSamples.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Retrieves the live samples held in the sample buffer, with sequence numbers at or above the given sequence
+     * number.
+     */
+    class GetLiveSamples: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::LiveSamples;
+
+        static constexpr CommandType type = CommandType::GET_LIVE_SAMPLES;
+        static const inline std::string name = "GetLiveSamples";
+
+        std::uint64_t fromSequenceNumber = 0;
+
+        explicit GetLiveSamples(std::uint64_t fromSequenceNumber)
+            : fromSequenceNumber(fromSequenceNumber)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return GetLiveSamples::type;
+        }
+    };
+}
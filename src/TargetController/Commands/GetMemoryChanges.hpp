@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/MemoryChanges.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Retrieves the changes recorded in the memory change timeline, with sequence numbers at or above the given
+     * sequence number. Changes are never modified once recorded, so this can be used to retrieve new changes
+     * incrementally, whilst the timeline is being recorded.
+     */
+    class GetMemoryChanges: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::MemoryChanges;
+
+        static constexpr CommandType type = CommandType::GET_MEMORY_CHANGES;
+        static const inline std::string name = "GetMemoryChanges";
+
+        std::uint64_t fromSequenceNumber = 0;
+
+        explicit GetMemoryChanges(std::uint64_t fromSequenceNumber)
+            : fromSequenceNumber(fromSequenceNumber)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return GetMemoryChanges::type;
+        }
+    };
+}
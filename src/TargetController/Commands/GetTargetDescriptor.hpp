@@ -14,6 +14,17 @@ namespace Bloom::TargetController::Commands
         static constexpr CommandType type = CommandType::GET_TARGET_DESCRIPTOR;
         static const inline std::string name = "GetTargetDescriptor";
 
+        /**
+         * Target variants are only needed for GPIO pin inspection, and are loaded on demand. They'll only be included
+         * in the descriptor if this is set.
+         */
+        bool includeVariants = false;
+
+        GetTargetDescriptor() = default;
+        explicit GetTargetDescriptor(bool includeVariants)
+            : includeVariants(includeVariants)
+        {};
+
         [[nodiscard]] CommandType getType() const override {
             return GetTargetDescriptor::type;
         }
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/TimingAnalysisReport.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Retrieves the results of the current (or most recently completed) timing analysis, without stopping it.
+     */
+    class GetTimingAnalysisReport: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::TimingAnalysisReport;
+
+        static constexpr CommandType type = CommandType::GET_TIMING_ANALYSIS_REPORT;
+        static const inline std::string name = "GetTimingAnalysisReport";
+
+        [[nodiscard]] CommandType getType() const override {
+            return GetTimingAnalysisReport::type;
+        }
+    };
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/TraceStatus.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    class GetTraceStatus: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::TraceStatus;
+
+        static constexpr CommandType type = CommandType::GET_TRACE_STATUS;
+        static const inline std::string name = "GetTraceStatus";
+
+        [[nodiscard]] CommandType getType() const override {
+            return GetTraceStatus::type;
+        }
+    };
+}
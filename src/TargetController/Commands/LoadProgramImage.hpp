@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+
+#include "Command.hpp"
+#include "src/TargetController/Responses/ProgramImageLoaded.hpp"
+
+#include "src/ProgramImage/ProgramImage.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Writes a program image to the target's program memory, and (optionally) verifies it.
+     *
+     * Image segments that don't reside in program memory are ignored.
+     */
+    class LoadProgramImage: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::ProgramImageLoaded;
+
+        static constexpr CommandType type = CommandType::LOAD_PROGRAM_IMAGE;
+        static const inline std::string name = "LoadProgramImage";
+
+        /**
+         * The image is shared, as the same image can be loaded onto numerous targets (see ParallelProgrammer).
+         */
+        std::shared_ptr<const ProgramImage> programImage;
+
+        /**
+         * Whether to verify the content of the program memory, once the image has been written, via a CRC of each
+         * segment.
+         */
+        bool verify = true;
+
+        LoadProgramImage(std::shared_ptr<const ProgramImage> programImage, bool verify)
+            : programImage(std::move(programImage))
+            , verify(verify)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return LoadProgramImage::type;
+        }
+
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return true;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return false;
+        }
+    };
+}
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <set>
+#include <functional>
 
 #include "Command.hpp"
 #include "src/TargetController/Responses/TargetMemoryRead.hpp"
@@ -23,6 +24,13 @@ namespace Bloom::TargetController::Commands
         Targets::TargetMemorySize bytes;
         std::set<Targets::TargetMemoryAddressRange> excludedAddressRanges;
 
+        /**
+         * Optional callback for progress updates on large reads. It's invoked, from the TargetController's thread,
+         * after each chunk of the read (see TargetControllerComponent::readTargetMemoryInChunks()), with the number of
+         * bytes read so far.
+         */
+        std::function<void(Targets::TargetMemorySize)> progressCallback;
+
         ReadTargetMemory(
             Targets::TargetMemoryType memoryType,
             Targets::TargetMemoryAddress startAddress,
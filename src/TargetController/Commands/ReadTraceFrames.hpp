@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/TraceFrames.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Reads frames from the trace buffer, from the given index onwards. Frames are never modified once recorded, so
+     * this can be used to retrieve new frames incrementally, whilst tracing is in progress.
+     */
+    class ReadTraceFrames: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::TraceFrames;
+
+        static constexpr CommandType type = CommandType::READ_TRACE_FRAMES;
+        static const inline std::string name = "ReadTraceFrames";
+
+        std::size_t startIndex = 0;
+
+        explicit ReadTraceFrames(std::size_t startIndex)
+            : startIndex(startIndex)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return ReadTraceFrames::type;
+        }
+    };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Command.hpp"
+
+#include "src/Targets/TargetBreakpoint.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    class RemoveWatchpoint: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::REMOVE_WATCHPOINT;
+        static const inline std::string name = "RemoveWatchpoint";
+
+        Targets::TargetWatchpoint watchpoint;
+
+        RemoveWatchpoint() = default;
+        explicit RemoveWatchpoint(const Targets::TargetWatchpoint& watchpoint)
+            : watchpoint(watchpoint)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return RemoveWatchpoint::type;
+        }
+
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return true;
+        }
+    };
+}
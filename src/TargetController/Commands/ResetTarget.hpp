@@ -10,6 +10,17 @@ namespace Bloom::TargetController::Commands
         static constexpr CommandType type = CommandType::RESET_TARGET;
         static const inline std::string name = "ResetTarget";
 
+        /**
+         * If set, the reset is deferred - the TargetController will perform it just before servicing the next
+         * command that depends on the reset (such as a request to resume execution), or skip it altogether if the
+         * next command is another (non-deferred) reset. See TargetControllerComponent::targetResetPending.
+         */
+        bool deferred = false;
+
+        explicit ResetTarget(bool deferred = false)
+            : deferred(deferred)
+        {};
+
         [[nodiscard]] CommandType getType() const override {
             return ResetTarget::type;
         }
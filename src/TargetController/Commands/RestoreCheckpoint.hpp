@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Command.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Writes the state captured via CaptureCheckpoint back to the target - returning the target to the point at
+     * which the checkpoint was captured, without resetting it and re-running its initialisation code.
+     */
+    class RestoreCheckpoint: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::RESTORE_CHECKPOINT;
+        static const inline std::string name = "RestoreCheckpoint";
+
+        [[nodiscard]] CommandType getType() const override {
+            return RestoreCheckpoint::type;
+        }
+
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return true;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return true;
+        }
+    };
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Command.hpp"
+#include "src/TargetController/Responses/TargetMemorySearchResult.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Searches a range of target memory for the first occurrence of a byte pattern.
+     *
+     * The range is read via the same path as ReadTargetMemory commands (stop snapshot, memory cache or chunked bulk
+     * reads), and the search is performed by the TargetController, so only the address of the match needs to be
+     * returned.
+     */
+    class SearchTargetMemory: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::TargetMemorySearchResult;
+
+        static constexpr CommandType type = CommandType::SEARCH_TARGET_MEMORY;
+        static const inline std::string name = "SearchTargetMemory";
+
+        Targets::TargetMemoryType memoryType;
+        Targets::TargetMemoryAddressRange addressRange;
+        Targets::TargetMemoryBuffer pattern;
+
+        SearchTargetMemory(
+            Targets::TargetMemoryType memoryType,
+            const Targets::TargetMemoryAddressRange& addressRange,
+            Targets::TargetMemoryBuffer pattern
+        )
+            : memoryType(memoryType)
+            , addressRange(addressRange)
+            , pattern(std::move(pattern))
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return SearchTargetMemory::type;
+        }
+
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return true;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return this->memoryType == Targets::TargetMemoryType::RAM;
+        }
+    };
+}
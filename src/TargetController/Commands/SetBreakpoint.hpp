@@ -1,8 +1,11 @@
 #pragma once
 
+#include <vector>
+
 #include "Command.hpp"
 
 #include "src/Targets/TargetBreakpoint.hpp"
+#include "src/TargetController/AgentExpression.hpp"
 
 namespace Bloom::TargetController::Commands
 {
@@ -14,11 +17,24 @@ namespace Bloom::TargetController::Commands
 
         Targets::TargetBreakpoint breakpoint;
 
+        /**
+         * The breakpoint's conditions. The target is only to halt at the breakpoint if any of the conditions
+         * evaluate to a non-zero value. An empty vector means the breakpoint is unconditional.
+         *
+         * Setting a breakpoint that already exists replaces its conditions.
+         */
+        std::vector<AgentExpression> conditions;
+
         SetBreakpoint() = default;
         explicit SetBreakpoint(const Targets::TargetBreakpoint& breakpoint)
             : breakpoint(breakpoint)
         {};
 
+        SetBreakpoint(const Targets::TargetBreakpoint& breakpoint, std::vector<AgentExpression>&& conditions)
+            : breakpoint(breakpoint)
+            , conditions(std::move(conditions))
+        {};
+
         [[nodiscard]] CommandType getType() const override {
             return SetBreakpoint::type;
         }
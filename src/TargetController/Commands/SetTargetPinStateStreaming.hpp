@@ -0,0 +1,41 @@
+#pragma once
+
+#include <optional>
+
+#include "Command.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Starts or stops pin state streaming.
+     *
+     * Whilst streaming, the TargetController periodically reads the pin states of the given variant (only when the
+     * target is stopped) and emits a TargetPinStatesChanged event for any pins that have changed.
+     */
+    class SetTargetPinStateStreaming: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::SET_TARGET_PIN_STATE_STREAMING;
+        static const inline std::string name = "SetTargetPinStateStreaming";
+
+        /**
+         * The ID of the target variant for which to stream pin states, or std::nullopt to stop streaming.
+         */
+        std::optional<int> variantId;
+
+        explicit SetTargetPinStateStreaming(std::optional<int> variantId)
+            : variantId(variantId)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return SetTargetPinStateStreaming::type;
+        }
+
+        /**
+         * Streaming is merely paused whilst programming mode is enabled, so this command can be issued at any time.
+         */
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return false;
+        }
+    };
+}
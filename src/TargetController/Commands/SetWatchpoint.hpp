@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Command.hpp"
+
+#include "src/Targets/TargetBreakpoint.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    class SetWatchpoint: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::SET_WATCHPOINT;
+        static const inline std::string name = "SetWatchpoint";
+
+        Targets::TargetWatchpoint watchpoint;
+
+        SetWatchpoint() = default;
+        explicit SetWatchpoint(const Targets::TargetWatchpoint& watchpoint)
+            : watchpoint(watchpoint)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return SetWatchpoint::type;
+        }
+
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return true;
+        }
+    };
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <chrono>
+
+#include "Command.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Starts collecting code coverage, over the given program memory addresses. See
+     * TargetControllerComponent::recordCoverageHit().
+     *
+     * Any coverage from a previous collection session is discarded.
+     */
+    class StartCoverageCollection: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::START_COVERAGE_COLLECTION;
+        static const inline std::string name = "StartCoverageCollection";
+
+        /**
+         * The addresses to instrument, in ascending order.
+         */
+        std::vector<Targets::TargetMemoryAddress> addresses;
+
+        /**
+         * The maximum number of coverage breakpoints to have in place at any one time.
+         */
+        std::size_t batchSize;
+
+        /**
+         * How often the unhit breakpoints of the current batch are swapped out for the next batch.
+         */
+        std::chrono::milliseconds sweepInterval;
+
+        StartCoverageCollection(
+            std::vector<Targets::TargetMemoryAddress>&& addresses,
+            std::size_t batchSize,
+            std::chrono::milliseconds sweepInterval
+        )
+            : addresses(std::move(addresses))
+            , batchSize(batchSize)
+            , sweepInterval(sweepInterval)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return StartCoverageCollection::type;
+        }
+    };
+}
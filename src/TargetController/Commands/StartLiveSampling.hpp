@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+#include <chrono>
+
+#include "Command.hpp"
+
+#include "src/TargetController/LiveSampling.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Starts sampling the given variables at a fixed interval, whilst the target is running. See
+     * TargetControllerComponent::takeLiveSample().
+     *
+     * Any samples from a previous sampling session are discarded.
+     */
+    class StartLiveSampling: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::START_LIVE_SAMPLING;
+        static const inline std::string name = "StartLiveSampling";
+
+        std::vector<LiveSampleVariable> variables;
+        std::chrono::milliseconds samplingInterval;
+
+        StartLiveSampling(std::vector<LiveSampleVariable>&& variables, std::chrono::milliseconds samplingInterval)
+            : variables(std::move(variables))
+            , samplingInterval(samplingInterval)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return StartLiveSampling::type;
+        }
+    };
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+
+#include "Command.hpp"
+
+#include "src/TargetController/MemoryChangeTimeline.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Starts recording the memory change timeline for the given regions. See
+     * TargetControllerComponent::recordMemoryChanges().
+     *
+     * Any changes recorded by a previous timeline are discarded.
+     */
+    class StartMemoryChangeTimeline: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::START_MEMORY_CHANGE_TIMELINE;
+        static const inline std::string name = "StartMemoryChangeTimeline";
+
+        std::vector<MemoryChangeTimelineRegion> regions;
+
+        explicit StartMemoryChangeTimeline(std::vector<MemoryChangeTimelineRegion>&& regions)
+            : regions(std::move(regions))
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return StartMemoryChangeTimeline::type;
+        }
+    };
+}
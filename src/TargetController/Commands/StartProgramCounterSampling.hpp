@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+
+#include "Command.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Starts sampling the target's program counter, at a fixed interval, for statistical profiling. See
+     * TargetControllerComponent::sampleProgramCounter().
+     *
+     * Any samples from a previous sampling session are discarded.
+     */
+    class StartProgramCounterSampling: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::START_PROGRAM_COUNTER_SAMPLING;
+        static const inline std::string name = "StartProgramCounterSampling";
+
+        std::chrono::milliseconds samplingInterval;
+
+        explicit StartProgramCounterSampling(std::chrono::milliseconds samplingInterval)
+            : samplingInterval(samplingInterval)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return StartProgramCounterSampling::type;
+        }
+    };
+}
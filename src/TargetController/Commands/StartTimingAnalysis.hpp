@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "Command.hpp"
+
+#include "src/TargetController/TimingAnalysis.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Starts measuring the interval between two program memory addresses, over a number of iterations. See
+     * TargetControllerComponent::handleTimingBreak().
+     *
+     * The results of any previous timing analysis are discarded.
+     */
+    class StartTimingAnalysis: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::START_TIMING_ANALYSIS;
+        static const inline std::string name = "StartTimingAnalysis";
+
+        Targets::TargetMemoryAddress startAddress;
+        Targets::TargetMemoryAddress endAddress;
+        std::uint32_t iterationCount;
+
+        /**
+         * If provided, the timer register is read at each timing breakpoint, for cycle-accurate measurements.
+         */
+        std::optional<TimingTimerRegister> timerRegister;
+
+        StartTimingAnalysis(
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemoryAddress endAddress,
+            std::uint32_t iterationCount,
+            const std::optional<TimingTimerRegister>& timerRegister
+        )
+            : startAddress(startAddress)
+            , endAddress(endAddress)
+            , iterationCount(iterationCount)
+            , timerRegister(timerRegister)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return StartTimingAnalysis::type;
+        }
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+#include "Command.hpp"
+
+#include "src/TargetController/Tracepoint.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Starts a trace experiment, with the given tracepoints. The trace buffer (and the frames collected by any
+     * previous experiment) is cleared.
+     */
+    class StartTracing: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::START_TRACING;
+        static const inline std::string name = "StartTracing";
+
+        std::vector<Tracepoint> tracepoints;
+
+        explicit StartTracing(std::vector<Tracepoint>&& tracepoints)
+            : tracepoints(std::move(tracepoints))
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return StartTracing::type;
+        }
+    };
+}
@@ -16,6 +16,30 @@ namespace Bloom::TargetController::Commands
 
         std::optional<Targets::TargetProgramCounter> fromProgramCounter;
 
+        /**
+         * If provided, the TargetController will continue to step execution until the program counter leaves this
+         * address range (or a breakpoint is reached), before reporting that the target has stopped.
+         */
+        std::optional<Targets::TargetMemoryAddressRange> stepRange;
+
+        /**
+         * If true, the step range is derived from the line table of the project's ELF file (see SymbolService) - the
+         * TargetController steps until execution reaches the beginning of another statement. Any step range provided
+         * via StepTargetExecution::stepRange is ignored.
+         */
+        bool sourceLine = false;
+
+        /**
+         * If true, calls made from within the step range are stepped over (by running to the return address), as
+         * opposed to ending the step at the callee's entry point.
+         *
+         * Calls to code that isn't covered by the line table are always stepped over, as GDB would do the same.
+         *
+         * If there's no step range, and the instruction at the program counter is a call, the call is stepped over
+         * by running to the instruction that follows it. Any other instruction is stepped as usual.
+         */
+        bool stepOverCalls = false;
+
         StepTargetExecution() = default;
         explicit StepTargetExecution(Targets::TargetProgramCounter fromProgramCounter)
             : fromProgramCounter(fromProgramCounter)
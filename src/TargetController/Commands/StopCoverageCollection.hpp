@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/CoverageReport.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Stops collecting code coverage, removes any outstanding coverage breakpoints and yields the coverage collected
+     * since the last StartCoverageCollection command.
+     */
+    class StopCoverageCollection: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::CoverageReport;
+
+        static constexpr CommandType type = CommandType::STOP_COVERAGE_COLLECTION;
+        static const inline std::string name = "StopCoverageCollection";
+
+        [[nodiscard]] CommandType getType() const override {
+            return StopCoverageCollection::type;
+        }
+    };
+}
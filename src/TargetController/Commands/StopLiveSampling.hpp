@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Command.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Stops live sampling. The collected samples are retained until sampling is started again.
+     */
+    class StopLiveSampling: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::STOP_LIVE_SAMPLING;
+        static const inline std::string name = "StopLiveSampling";
+
+        [[nodiscard]] CommandType getType() const override {
+            return StopLiveSampling::type;
+        }
+    };
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Command.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Stops recording the memory change timeline. The recorded changes are retained until the next timeline is
+     * started.
+     */
+    class StopMemoryChangeTimeline: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::STOP_MEMORY_CHANGE_TIMELINE;
+        static const inline std::string name = "StopMemoryChangeTimeline";
+
+        [[nodiscard]] CommandType getType() const override {
+            return StopMemoryChangeTimeline::type;
+        }
+    };
+}
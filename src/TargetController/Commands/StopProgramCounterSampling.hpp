@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/ProgramCounterSamples.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Stops sampling the target's program counter and yields the samples collected since the last
+     * StartProgramCounterSampling command.
+     */
+    class StopProgramCounterSampling: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::ProgramCounterSamples;
+
+        static constexpr CommandType type = CommandType::STOP_PROGRAM_COUNTER_SAMPLING;
+        static const inline std::string name = "StopProgramCounterSampling";
+
+        [[nodiscard]] CommandType getType() const override {
+            return StopProgramCounterSampling::type;
+        }
+    };
+}
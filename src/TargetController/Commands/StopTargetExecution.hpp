@@ -10,6 +10,14 @@ namespace Bloom::TargetController::Commands
         static constexpr CommandType type = CommandType::STOP_TARGET_EXECUTION;
         static const inline std::string name = "StopTargetExecution";
 
+        StopTargetExecution() {
+            /*
+             * Halting the target is time-sensitive (the user is trying to interrupt the program), so it should never
+             * be held up by other work.
+             */
+            this->priority = CommandPriority::REALTIME;
+        }
+
         [[nodiscard]] CommandType getType() const override {
             return StopTargetExecution::type;
         }
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/TimingAnalysisReport.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Stops the current timing analysis (if it hasn't already completed), removes its breakpoints and yields its
+     * results.
+     */
+    class StopTimingAnalysis: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::TimingAnalysisReport;
+
+        static constexpr CommandType type = CommandType::STOP_TIMING_ANALYSIS;
+        static const inline std::string name = "StopTimingAnalysis";
+
+        [[nodiscard]] CommandType getType() const override {
+            return StopTimingAnalysis::type;
+        }
+    };
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Command.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Stops the current trace experiment and removes its tracepoints. The collected frames are retained.
+     */
+    class StopTracing: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::STOP_TRACING;
+        static const inline std::string name = "StopTracing";
+
+        [[nodiscard]] CommandType getType() const override {
+            return StopTracing::type;
+        }
+    };
+}
@@ -2,6 +2,8 @@
 
 #include "DeviceFailure.hpp"
 
+#include "src/Services/MetricsService.hpp"
+
 namespace Bloom::Exceptions
 {
     class DeviceCommunicationFailure: public DeviceFailure
@@ -9,10 +11,24 @@ namespace Bloom::Exceptions
     public:
         explicit DeviceCommunicationFailure(const std::string& message): DeviceFailure(message) {
             this->message = message;
+            DeviceCommunicationFailure::countFailure();
         }
 
         explicit DeviceCommunicationFailure(const char* message): DeviceFailure(message) {
             this->message = std::string(message);
+            DeviceCommunicationFailure::countFailure();
+        }
+
+    private:
+        /**
+         * Every construction is counted, as an indication of how often communication with the debug tool fails (the
+         * "targetController.deviceCommunicationFailures" metric).
+         */
+        static void countFailure() {
+            static auto& failureCounter = Services::MetricsService::counter(
+                "targetController.deviceCommunicationFailures"
+            );
+            failureCounter.increment();
         }
     };
 }
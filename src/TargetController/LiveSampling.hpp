@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A variable to be sampled periodically, whilst the target is running. See
+     * TargetControllerComponent::takeLiveSample().
+     */
+    struct LiveSampleVariable
+    {
+        /**
+         * A name for the variable (typically the symbol name), for display and export purposes.
+         */
+        std::string name;
+
+        Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::RAM;
+        Targets::TargetMemoryAddress address = 0;
+        Targets::TargetMemorySize size = 0;
+
+        LiveSampleVariable(
+            const std::string& name,
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress address,
+            Targets::TargetMemorySize size
+        )
+            : name(name)
+            , memoryType(memoryType)
+            , address(address)
+            , size(size)
+        {};
+    };
+
+    /**
+     * The values of all sampled variables, at a single point in time.
+     */
+    struct LiveSample
+    {
+        /**
+         * Samples are numbered sequentially, from zero, within each sampling session. Consumers can use this to
+         * retrieve new samples incrementally (see Commands::GetLiveSamples).
+         */
+        std::uint64_t sequenceNumber = 0;
+
+        /**
+         * Time elapsed since sampling was started.
+         */
+        std::chrono::microseconds timestamp = {};
+
+        /**
+         * The value of each variable, in the order in which the variables were given. Values are in the target's
+         * byte order.
+         */
+        std::vector<Targets::TargetMemoryBuffer> values;
+
+        LiveSample(std::uint64_t sequenceNumber, std::chrono::microseconds timestamp)
+            : sequenceNumber(sequenceNumber)
+            , timestamp(timestamp)
+        {};
+    };
+}
@@ -0,0 +1,181 @@
+#include "MemoryChangeTimeline.hpp"
+
+#include <cassert>
+#include <algorithm>
+#include <iterator>
+
+#include "src/Helpers/BufferDiff.hpp"
+
+namespace Bloom::TargetController
+{
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryAddressRange;
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetProgramCounter;
+
+    MemoryChangeTimeline::MemoryChangeTimeline(
+        std::vector<MemoryChangeTimelineRegion>&& regions,
+        std::size_t capacity
+    )
+        : regions(std::move(regions))
+        , capacity(capacity)
+    {}
+
+    std::size_t MemoryChangeTimeline::recordStop(
+        TargetProgramCounter programCounter,
+        std::chrono::microseconds timestamp,
+        std::vector<TargetMemoryBuffer>&& regionData
+    ) {
+        assert(regionData.size() == this->regions.size());
+
+        const auto stopNumber = this->stopCount++;
+
+        if (this->regionData.empty()) {
+            this->regionData = std::move(regionData);
+            return 0;
+        }
+
+        const auto initialChangeCount = this->changes.size();
+
+        for (auto regionIndex = std::size_t(0); regionIndex < this->regions.size() && !this->full; ++regionIndex) {
+            const auto& region = this->regions[regionIndex];
+            const auto& previousData = this->regionData[regionIndex];
+            const auto& currentData = regionData[regionIndex];
+
+            const auto changedRanges = BufferDiff::differingRanges(previousData, currentData, region.startAddress);
+
+            for (const auto& changedRange : changedRanges) {
+                const auto changedBytes = static_cast<std::size_t>(
+                    changedRange.endAddress - changedRange.startAddress + 1
+                );
+                const auto changeSize = sizeof(MemoryChange) + changedBytes;
+
+                if ((this->size + changeSize) > this->capacity) {
+                    this->full = true;
+                    break;
+                }
+
+                const auto offset = static_cast<std::ptrdiff_t>(changedRange.startAddress - region.startAddress);
+
+                this->changes.emplace_back(MemoryChange{
+                    .sequenceNumber = this->changes.size(),
+                    .stopNumber = stopNumber,
+                    .programCounter = programCounter,
+                    .timestamp = timestamp,
+                    .memoryType = region.memoryType,
+                    .addressRange = changedRange,
+                    .data = TargetMemoryBuffer(
+                        currentData.begin() + offset,
+                        currentData.begin() + offset + static_cast<std::ptrdiff_t>(changedBytes)
+                    ),
+                });
+
+                this->size += changeSize;
+                this->indexChange(this->changes.size() - 1);
+            }
+        }
+
+        this->regionData = std::move(regionData);
+
+        return this->changes.size() - initialChangeCount;
+    }
+
+    void MemoryChangeTimeline::applyWrite(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        const TargetMemoryBuffer& buffer
+    ) {
+        if (this->regionData.empty() || buffer.empty()) {
+            return;
+        }
+
+        const auto writeRange = TargetMemoryAddressRange(
+            startAddress,
+            startAddress + static_cast<TargetMemoryAddress>(buffer.size()) - 1
+        );
+
+        for (auto regionIndex = std::size_t(0); regionIndex < this->regions.size(); ++regionIndex) {
+            const auto& region = this->regions[regionIndex];
+            const auto regionRange = TargetMemoryAddressRange(
+                region.startAddress,
+                region.startAddress + region.size - 1
+            );
+
+            if (region.memoryType != memoryType || !regionRange.intersectsWith(writeRange)) {
+                continue;
+            }
+
+            const auto overlapStart = std::max(regionRange.startAddress, writeRange.startAddress);
+            const auto overlapEnd = std::min(regionRange.endAddress, writeRange.endAddress);
+
+            std::copy(
+                buffer.begin() + static_cast<std::ptrdiff_t>(overlapStart - startAddress),
+                buffer.begin() + static_cast<std::ptrdiff_t>(overlapEnd - startAddress + 1),
+                this->regionData[regionIndex].begin() + static_cast<std::ptrdiff_t>(overlapStart - region.startAddress)
+            );
+        }
+    }
+
+    const MemoryChange* MemoryChangeTimeline::lastChange(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress address
+    ) const {
+        const auto entriesIt = this->lastChangeEntriesByMemoryType.find(memoryType);
+        if (entriesIt == this->lastChangeEntriesByMemoryType.end()) {
+            return nullptr;
+        }
+
+        const auto& entries = entriesIt->second;
+
+        // The entries are disjoint - the last entry starting at or before the address is the only one that can hold it
+        auto entryIt = entries.upper_bound(address);
+        if (entryIt == entries.begin()) {
+            return nullptr;
+        }
+
+        --entryIt;
+        if (entryIt->second.endAddress < address) {
+            return nullptr;
+        }
+
+        return &(this->changes[entryIt->second.changeIndex]);
+    }
+
+    void MemoryChangeTimeline::indexChange(std::size_t changeIndex) {
+        const auto& change = this->changes[changeIndex];
+        const auto startAddress = change.addressRange.startAddress;
+        const auto endAddress = change.addressRange.endAddress;
+
+        auto& entries = this->lastChangeEntriesByMemoryType[change.memoryType];
+
+        auto entryIt = entries.lower_bound(startAddress);
+
+        // Trim the entry that starts before the change, if it overlaps - splitting it if it extends beyond the change
+        if (entryIt != entries.begin()) {
+            auto& precedingEntry = std::prev(entryIt)->second;
+
+            if (precedingEntry.endAddress >= startAddress) {
+                const auto precedingEntryCopy = precedingEntry;
+                precedingEntry.endAddress = startAddress - 1;
+
+                if (precedingEntryCopy.endAddress > endAddress) {
+                    entryIt = entries.emplace_hint(entryIt, endAddress + 1, precedingEntryCopy);
+                }
+            }
+        }
+
+        // Remove the entries that start within the change, keeping the tail of any entry that extends beyond it
+        while (entryIt != entries.end() && entryIt->first <= endAddress) {
+            const auto entry = entryIt->second;
+            entryIt = entries.erase(entryIt);
+
+            if (entry.endAddress > endAddress) {
+                entryIt = entries.emplace_hint(entryIt, endAddress + 1, entry);
+                break;
+            }
+        }
+
+        entries.emplace_hint(entryIt, startAddress, LastChangeEntry{endAddress, changeIndex});
+    }
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <map>
+#include <optional>
+#include <chrono>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A region of target memory tracked by the memory change timeline.
+     */
+    struct MemoryChangeTimelineRegion
+    {
+        Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::RAM;
+        Targets::TargetMemoryAddress startAddress = 0;
+        Targets::TargetMemorySize size = 0;
+
+        MemoryChangeTimelineRegion(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize size
+        )
+            : memoryType(memoryType)
+            , startAddress(startAddress)
+            , size(size)
+        {};
+    };
+
+    /**
+     * A contiguous range of tracked memory that changed between two consecutive target stops.
+     */
+    struct MemoryChange
+    {
+        /**
+         * Changes are numbered sequentially, from zero, within each timeline. Consumers can use this to retrieve new
+         * changes incrementally (see Commands::GetMemoryChanges).
+         */
+        std::uint64_t sequenceNumber = 0;
+
+        /**
+         * The number of the stop at which the change was detected. The first stop of the timeline (at which the
+         * initial state of the tracked regions is captured) is stop zero, so the first change can be detected at
+         * stop one.
+         */
+        std::uint64_t stopNumber = 0;
+
+        /**
+         * The program counter at the stop. The change was made by the code executed between the previous stop and
+         * this one.
+         */
+        Targets::TargetProgramCounter programCounter = 0;
+
+        /**
+         * Time elapsed since the timeline was started.
+         */
+        std::chrono::microseconds timestamp = {};
+
+        Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::RAM;
+        Targets::TargetMemoryAddressRange addressRange;
+
+        /**
+         * The content of the address range, after the change.
+         */
+        Targets::TargetMemoryBuffer data;
+    };
+
+    /**
+     * An append-only log of the changes made to a set of tracked memory regions, recorded at each target stop.
+     *
+     * At each stop, the content of the tracked regions is compared with their content at the previous stop, and only
+     * the differing ranges (the deltas) are appended to the log. The timeline holds a single copy of each region (the
+     * content at the last stop), regardless of how many stops have been recorded.
+     *
+     * The timeline maintains an index of the last change to every changed address, so the last change to any given
+     * address can be found in logarithmic time (see MemoryChangeTimeline::lastChange()).
+     */
+    class MemoryChangeTimeline
+    {
+    public:
+        /**
+         * @param regions
+         *
+         * @param capacity
+         *  The maximum size of the log, in bytes (see MemoryChangeTimeline::getSize()). Once the log is full, no
+         *  further changes are recorded.
+         */
+        MemoryChangeTimeline(std::vector<MemoryChangeTimelineRegion>&& regions, std::size_t capacity);
+
+        [[nodiscard]] const std::vector<MemoryChangeTimelineRegion>& getRegions() const {
+            return this->regions;
+        }
+
+        [[nodiscard]] const std::vector<MemoryChange>& getChanges() const {
+            return this->changes;
+        }
+
+        /**
+         * The number of stops recorded, including the first stop (at which the initial state was captured).
+         *
+         * @return
+         */
+        [[nodiscard]] std::uint64_t getStopCount() const {
+            return this->stopCount;
+        }
+
+        /**
+         * The (approximate) space occupied by the log, in bytes.
+         *
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const {
+            return this->size;
+        }
+
+        [[nodiscard]] bool isFull() const {
+            return this->full;
+        }
+
+        /**
+         * Records a target stop.
+         *
+         * @param programCounter
+         * @param timestamp
+         *
+         * @param regionData
+         *  The current content of each tracked region, in the order in which the regions were given upon
+         *  construction.
+         *
+         * @return
+         *  The number of changes appended to the log.
+         */
+        std::size_t recordStop(
+            Targets::TargetProgramCounter programCounter,
+            std::chrono::microseconds timestamp,
+            std::vector<Targets::TargetMemoryBuffer>&& regionData
+        );
+
+        /**
+         * Applies a write (from a debug client) to the content recorded at the last stop, so that the written
+         * values are not reported as a change made by the program, at the next stop.
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param buffer
+         */
+        void applyWrite(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            const Targets::TargetMemoryBuffer& buffer
+        );
+
+        /**
+         * Finds the most recent change to the given address.
+         *
+         * @param memoryType
+         * @param address
+         *
+         * @return
+         *  A pointer to the change, or nullptr if the address hasn't changed since the timeline was started (or it
+         *  isn't tracked). The pointer is invalidated by any subsequent call to MemoryChangeTimeline::recordStop().
+         */
+        [[nodiscard]] const MemoryChange* lastChange(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress address
+        ) const;
+
+    private:
+        struct LastChangeEntry
+        {
+            Targets::TargetMemoryAddress endAddress = 0;
+
+            /**
+             * Index (into this->changes) of the last change to the range.
+             */
+            std::size_t changeIndex = 0;
+        };
+
+        std::vector<MemoryChangeTimelineRegion> regions;
+        std::size_t capacity = 0;
+
+        /**
+         * The content of each tracked region, at the last stop. Empty until the first stop has been recorded.
+         */
+        std::vector<Targets::TargetMemoryBuffer> regionData;
+
+        std::vector<MemoryChange> changes;
+        std::uint64_t stopCount = 0;
+        std::size_t size = 0;
+        bool full = false;
+
+        /**
+         * Disjoint address ranges, mapped by start address, each with the index of the last change to the range.
+         * Neighbouring ranges may refer to different changes.
+         */
+        std::map<Targets::TargetMemoryType, std::map<Targets::TargetMemoryAddress, LastChangeEntry>>
+            lastChangeEntriesByMemoryType;
+
+        void indexChange(std::size_t changeIndex);
+    };
+}
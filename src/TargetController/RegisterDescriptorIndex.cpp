@@ -0,0 +1,66 @@
+#include "RegisterDescriptorIndex.hpp"
+
+#include <algorithm>
+
+namespace Bloom::TargetController
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetRegisterDescriptor;
+
+    void RegisterDescriptorIndex::insert(const TargetRegisterDescriptor& descriptor) {
+        if (!descriptor.startAddress.has_value() || descriptor.size < 1) {
+            return;
+        }
+
+        const auto startAddress = *(descriptor.startAddress);
+        const auto insertIt = std::upper_bound(
+            this->descriptors.begin(),
+            this->descriptors.end(),
+            startAddress,
+            [] (TargetMemoryAddress address, const TargetRegisterDescriptor& existingDescriptor) {
+                return address < *(existingDescriptor.startAddress);
+            }
+        );
+
+        this->descriptors.insert(insertIt, descriptor);
+        this->maxRegisterSize = std::max(this->maxRegisterSize, descriptor.size);
+    }
+
+    std::vector<RegisterDescriptorIndex::RegisterDescriptorId> RegisterDescriptorIndex::getIdsWithinAddressRange(
+        TargetMemoryAddress startAddress,
+        TargetMemoryAddress endAddress
+    ) const {
+        auto output = std::vector<RegisterDescriptorId>();
+
+        if (this->descriptors.empty()) {
+            return output;
+        }
+
+        const auto earliestStartAddress = startAddress > (this->maxRegisterSize - 1)
+            ? startAddress - (this->maxRegisterSize - 1)
+            : TargetMemoryAddress(0);
+
+        auto descriptorIt = std::lower_bound(
+            this->descriptors.begin(),
+            this->descriptors.end(),
+            earliestStartAddress,
+            [] (const TargetRegisterDescriptor& descriptor, TargetMemoryAddress address) {
+                return *(descriptor.startAddress) < address;
+            }
+        );
+
+        for (; descriptorIt != this->descriptors.end(); ++descriptorIt) {
+            const auto registerStartAddress = *(descriptorIt->startAddress);
+
+            if (registerStartAddress > endAddress) {
+                break;
+            }
+
+            if ((registerStartAddress + (descriptorIt->size - 1)) >= startAddress) {
+                output.push_back(static_cast<RegisterDescriptorId>(descriptorIt - this->descriptors.begin()));
+            }
+        }
+
+        return output;
+    }
+}
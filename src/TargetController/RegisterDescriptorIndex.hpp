@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "src/Targets/TargetRegister.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A contiguous table of the register descriptors for the registers that reside in a single target memory,
+     * ordered by start address.
+     *
+     * The index is used to resolve the registers that are affected by a memory access, in O(log n + k) time, where k
+     * is the number of registers found. Descriptors are referred to by their position in the table (their ID), so that
+     * lookups don't copy any descriptors.
+     */
+    class RegisterDescriptorIndex
+    {
+    public:
+        using RegisterDescriptorId = std::uint32_t;
+
+        RegisterDescriptorIndex() = default;
+
+        /**
+         * Adds a descriptor to the index.
+         *
+         * Descriptors without a start address, or with a size of 0, cannot reside within an address range, and are
+         * ignored.
+         *
+         * This invalidates any IDs previously returned by the index.
+         *
+         * @param descriptor
+         */
+        void insert(const Targets::TargetRegisterDescriptor& descriptor);
+
+        [[nodiscard]] bool empty() const {
+            return this->descriptors.empty();
+        }
+
+        [[nodiscard]] const Targets::TargetRegisterDescriptor& at(RegisterDescriptorId id) const {
+            return this->descriptors.at(id);
+        }
+
+        /**
+         * Returns the IDs of all registers that intersect with the given address range, ordered by start address.
+         *
+         * @param startAddress
+         * @param endAddress
+         *
+         * @return
+         */
+        [[nodiscard]] std::vector<RegisterDescriptorId> getIdsWithinAddressRange(
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemoryAddress endAddress
+        ) const;
+
+    private:
+        std::vector<Targets::TargetRegisterDescriptor> descriptors;
+
+        /**
+         * The size of the largest register in the index. A register that intersects with an address range cannot
+         * start more than (maxRegisterSize - 1) bytes before the range starts.
+         */
+        Targets::TargetMemorySize maxRegisterSize = 0;
+    };
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cassert>
+#include <type_traits>
+
+#include "Response.hpp"
+#include "Error.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class CommandBatchResponses: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::COMMAND_BATCH_RESPONSES;
+
+        /**
+         * The responses for each command in the batch, in the order in which the commands were added to the batch.
+         */
+        std::vector<std::unique_ptr<Response>> responses;
+
+        explicit CommandBatchResponses(std::vector<std::unique_ptr<Response>>&& responses)
+            : responses(std::move(responses))
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return CommandBatchResponses::type;
+        }
+
+        /**
+         * Extracts the response for a particular command in the batch, and downcasts it to the command's
+         * SuccessResponseType.
+         *
+         * If the TargetController responded to the command with an error, an exception will be thrown.
+         *
+         * @tparam CommandType
+         *  The type of the command that the response belongs to.
+         *
+         * @param index
+         *  The index of the command in the batch (see CommandBatch::addCommand()).
+         *
+         * @return
+         */
+        template<class CommandType>
+        std::unique_ptr<typename CommandType::SuccessResponseType> takeResponse(std::size_t index) {
+            using SuccessResponseType = typename CommandType::SuccessResponseType;
+
+            if (index >= this->responses.size() || this->responses[index] == nullptr) {
+                throw Exceptions::Exception(
+                    "No response available for " + CommandType::name + " command in batch"
+                );
+            }
+
+            auto response = std::move(this->responses[index]);
+
+            if (response->getType() == ResponseType::ERROR) {
+                throw Exceptions::Exception(static_cast<Error*>(response.get())->errorMessage);
+            }
+
+            if constexpr (!std::is_same_v<SuccessResponseType, Response>) {
+                if (response->getType() != SuccessResponseType::type) {
+                    throw Exceptions::Exception(
+                        "Unexpected response type for " + CommandType::name + " command in batch"
+                    );
+                }
+
+                // The response type tag has been checked above, so there's no need for a dynamic_cast
+                return std::unique_ptr<SuccessResponseType>(static_cast<SuccessResponseType*>(response.release()));
+
+            } else {
+                return response;
+            }
+        }
+    };
+}
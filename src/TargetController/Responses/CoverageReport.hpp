@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <chrono>
+
+#include "Response.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class CoverageReport: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::COVERAGE_REPORT;
+
+        /**
+         * The instrumented addresses, in ascending order.
+         */
+        std::vector<Targets::TargetMemoryAddress> addresses;
+
+        /**
+         * Whether each address (at the same index in this->addresses) was hit.
+         */
+        std::vector<bool> hits;
+
+        /**
+         * The number of times the coverage breakpoints were swept (swapped for the next batch).
+         */
+        std::uint64_t sweepCount = 0;
+
+        std::chrono::steady_clock::duration collectionDuration = {};
+
+        CoverageReport(
+            std::vector<Targets::TargetMemoryAddress>&& addresses,
+            std::vector<bool>&& hits,
+            std::uint64_t sweepCount,
+            std::chrono::steady_clock::duration collectionDuration
+        )
+            : addresses(std::move(addresses))
+            , hits(std::move(hits))
+            , sweepCount(sweepCount)
+            , collectionDuration(collectionDuration)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return CoverageReport::type;
+        }
+    };
+}
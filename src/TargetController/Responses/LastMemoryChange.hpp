@@ -0,0 +1,29 @@
+#pragma once
+
+#include <optional>
+
+#include "Response.hpp"
+
+#include "src/TargetController/MemoryChangeTimeline.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class LastMemoryChange: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::LAST_MEMORY_CHANGE;
+
+        /**
+         * Not set if the address hasn't changed since the timeline was started, or it isn't tracked.
+         */
+        std::optional<MemoryChange> change;
+
+        explicit LastMemoryChange(std::optional<MemoryChange>&& change)
+            : change(std::move(change))
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return LastMemoryChange::type;
+        }
+    };
+}
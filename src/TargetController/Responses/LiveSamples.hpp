@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Response.hpp"
+
+#include "src/TargetController/LiveSampling.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class LiveSamples: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::LIVE_SAMPLES;
+
+        /**
+         * The sampled variables, in the order in which their values appear in each sample.
+         */
+        std::vector<LiveSampleVariable> variables;
+
+        std::vector<LiveSample> samples;
+
+        bool active = false;
+
+        /**
+         * The number of samples that were evicted from the sample buffer (as it was full), before they could be
+         * retrieved, along with the number of sampling intervals that were skipped because the target wasn't in a
+         * state to be sampled (in programming mode, for example).
+         */
+        std::uint64_t droppedSampleCount = 0;
+        std::uint64_t skippedSampleCount = 0;
+
+        LiveSamples(
+            const std::vector<LiveSampleVariable>& variables,
+            std::vector<LiveSample>&& samples,
+            bool active,
+            std::uint64_t droppedSampleCount,
+            std::uint64_t skippedSampleCount
+        )
+            : variables(variables)
+            , samples(std::move(samples))
+            , active(active)
+            , droppedSampleCount(droppedSampleCount)
+            , skippedSampleCount(skippedSampleCount)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return LiveSamples::type;
+        }
+    };
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Response.hpp"
+
+#include "src/TargetController/MemoryChangeTimeline.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class MemoryChanges: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::MEMORY_CHANGES;
+
+        std::vector<MemoryChangeTimelineRegion> regions;
+        std::vector<MemoryChange> changes;
+
+        bool active = false;
+
+        /**
+         * Set if the timeline ran out of space. No changes are recorded beyond that point.
+         */
+        bool full = false;
+
+        /**
+         * The number of target stops recorded by the timeline (see MemoryChangeTimeline::getStopCount()).
+         */
+        std::uint64_t stopCount = 0;
+
+        MemoryChanges(
+            const std::vector<MemoryChangeTimelineRegion>& regions,
+            std::vector<MemoryChange>&& changes,
+            bool active,
+            bool full,
+            std::uint64_t stopCount
+        )
+            : regions(regions)
+            , changes(std::move(changes))
+            , active(active)
+            , full(full)
+            , stopCount(stopCount)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return MemoryChanges::type;
+        }
+    };
+}
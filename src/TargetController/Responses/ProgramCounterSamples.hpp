@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <chrono>
+
+#include "Response.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class ProgramCounterSamples: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::PROGRAM_COUNTER_SAMPLES;
+
+        /**
+         * The number of times each program counter value was sampled.
+         */
+        std::map<Targets::TargetProgramCounter, std::uint64_t> sampleCountsByProgramCounter;
+
+        /**
+         * The number of sampling intervals that elapsed whilst the target was stopped (at a breakpoint, for
+         * example), for which no sample was taken.
+         */
+        std::uint64_t skippedSampleCount = 0;
+
+        std::chrono::steady_clock::duration samplingDuration = {};
+
+        ProgramCounterSamples(
+            std::map<Targets::TargetProgramCounter, std::uint64_t>&& sampleCountsByProgramCounter,
+            std::uint64_t skippedSampleCount,
+            std::chrono::steady_clock::duration samplingDuration
+        )
+            : sampleCountsByProgramCounter(std::move(sampleCountsByProgramCounter))
+            , skippedSampleCount(skippedSampleCount)
+            , samplingDuration(samplingDuration)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return ProgramCounterSamples::type;
+        }
+    };
+}
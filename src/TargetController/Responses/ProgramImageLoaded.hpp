@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Response.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class ProgramImageLoaded: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::PROGRAM_IMAGE_LOADED;
+
+        /**
+         * The number of bytes from the image that reside in program memory. The TargetController skips pages that
+         * already hold the desired content, so fewer bytes may have actually been written to the target.
+         */
+        Targets::TargetMemorySize bytes;
+
+        explicit ProgramImageLoaded(Targets::TargetMemorySize bytes)
+            : bytes(bytes)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return ProgramImageLoaded::type;
+        }
+    };
+}
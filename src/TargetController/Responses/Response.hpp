@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cstddef>
+
 #include "ResponseTypes.hpp"
 
+#include "src/Helpers/MemoryPool.hpp"
+
 namespace Bloom::TargetController::Responses
 {
     class Response
@@ -18,6 +22,18 @@ namespace Bloom::TargetController::Responses
         Response& operator = (const Response& other) = default;
         Response& operator = (Response&& other) = default;
 
+        /*
+         * Responses are allocated by the TargetController and freed by the thread that issued the command. As with
+         * commands, we recycle their memory via a pool.
+         */
+        static void* operator new(std::size_t size) {
+            return MemoryPool<Response>::allocate(size);
+        }
+
+        static void operator delete(void* pointer, std::size_t size) {
+            MemoryPool<Response>::deallocate(pointer, size);
+        }
+
         [[nodiscard]] virtual ResponseType getType() const {
             return Response::type;
         }
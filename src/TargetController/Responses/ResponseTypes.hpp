@@ -12,9 +12,22 @@ namespace Bloom::TargetController::Responses
         TARGET_DESCRIPTOR,
         TARGET_REGISTERS_READ,
         TARGET_MEMORY_READ,
+        TARGET_MEMORY_CRC,
+        TARGET_MEMORY_FILLED,
+        TARGET_MEMORY_SEARCH_RESULT,
         TARGET_STATE,
         TARGET_PIN_STATES,
         TARGET_STACK_POINTER,
         TARGET_PROGRAM_COUNTER,
+        PROGRAM_IMAGE_LOADED,
+        COMMAND_BATCH_RESPONSES,
+        PROGRAM_COUNTER_SAMPLES,
+        COVERAGE_REPORT,
+        TRACE_STATUS,
+        TRACE_FRAMES,
+        LIVE_SAMPLES,
+        TIMING_ANALYSIS_REPORT,
+        MEMORY_CHANGES,
+        LAST_MEMORY_CHANGE,
     };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 
 #include "Response.hpp"
 
@@ -13,10 +14,10 @@ namespace Bloom::TargetController::Responses
     public:
         static constexpr ResponseType type = ResponseType::TARGET_DESCRIPTOR;
 
-        const Targets::TargetDescriptor& targetDescriptor;
+        std::shared_ptr<const Targets::TargetDescriptor> targetDescriptor;
 
-        explicit TargetDescriptor(const Targets::TargetDescriptor& targetDescriptor)
-            : targetDescriptor(targetDescriptor)
+        explicit TargetDescriptor(std::shared_ptr<const Targets::TargetDescriptor> targetDescriptor)
+            : targetDescriptor(std::move(targetDescriptor))
         {}
 
         [[nodiscard]] ResponseType getType() const override {
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Response.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class TargetMemoryCrc: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::TARGET_MEMORY_CRC;
+
+        std::uint32_t crc;
+
+        explicit TargetMemoryCrc(std::uint32_t crc)
+            : crc(crc)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return TargetMemoryCrc::type;
+        }
+    };
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Response.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class TargetMemoryFilled: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::TARGET_MEMORY_FILLED;
+
+        /**
+         * The number of bytes that were written to the target. Bytes that already held the fill value are skipped,
+         * so this can be less than the size of the filled range.
+         */
+        Targets::TargetMemorySize bytesWritten;
+
+        explicit TargetMemoryFilled(Targets::TargetMemorySize bytesWritten)
+            : bytesWritten(bytesWritten)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return TargetMemoryFilled::type;
+        }
+    };
+}
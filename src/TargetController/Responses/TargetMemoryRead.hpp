@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+
 #include "Response.hpp"
 
 #include "src/Targets/TargetMemory.hpp"
@@ -13,10 +15,19 @@ namespace Bloom::TargetController::Responses
 
         Targets::TargetMemoryBuffer data;
 
-        explicit TargetMemoryRead(const Targets::TargetMemoryBuffer& data)
-            : data(data)
+        explicit TargetMemoryRead(Targets::TargetMemoryBuffer&& data)
+            : data(std::move(data))
         {}
 
+        /**
+         * Moves the data out of the response, to save the caller from copying it.
+         *
+         * @return
+         */
+        Targets::TargetMemoryBuffer takeData() {
+            return std::move(this->data);
+        }
+
         [[nodiscard]] ResponseType getType() const override {
             return TargetMemoryRead::type;
         }
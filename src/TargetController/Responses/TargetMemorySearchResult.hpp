@@ -0,0 +1,29 @@
+#pragma once
+
+#include <optional>
+
+#include "Response.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class TargetMemorySearchResult: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::TARGET_MEMORY_SEARCH_RESULT;
+
+        /**
+         * The address of the first occurrence of the pattern, or std::nullopt if the pattern wasn't found.
+         */
+        std::optional<Targets::TargetMemoryAddress> matchAddress;
+
+        explicit TargetMemorySearchResult(std::optional<Targets::TargetMemoryAddress> matchAddress)
+            : matchAddress(matchAddress)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return TargetMemorySearchResult::type;
+        }
+    };
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+
 #include "Response.hpp"
 
 #include "src/Targets/TargetRegister.hpp"
@@ -13,10 +15,19 @@ namespace Bloom::TargetController::Responses
 
         Targets::TargetRegisters registers;
 
-        explicit TargetRegistersRead(const Targets::TargetRegisters& registers)
-            : registers(registers)
+        explicit TargetRegistersRead(Targets::TargetRegisters&& registers)
+            : registers(std::move(registers))
         {}
 
+        /**
+         * Moves the registers out of the response, to save the caller from copying them.
+         *
+         * @return
+         */
+        Targets::TargetRegisters takeRegisters() {
+            return std::move(this->registers);
+        }
+
         [[nodiscard]] ResponseType getType() const override {
             return TargetRegistersRead::type;
         }
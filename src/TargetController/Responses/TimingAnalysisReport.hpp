@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Response.hpp"
+
+#include "src/TargetController/TimingAnalysis.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class TimingAnalysisReport: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::TIMING_ANALYSIS_REPORT;
+
+        TimingAnalysisResults results;
+
+        explicit TimingAnalysisReport(const TimingAnalysisResults& results)
+            : results(results)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return TimingAnalysisReport::type;
+        }
+    };
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+
+#include "Response.hpp"
+
+#include "src/TargetController/Tracepoint.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class TraceFrames: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::TRACE_FRAMES;
+
+        std::vector<TraceFrame> frames;
+
+        explicit TraceFrames(std::vector<TraceFrame>&& frames)
+            : frames(std::move(frames))
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return TraceFrames::type;
+        }
+    };
+}
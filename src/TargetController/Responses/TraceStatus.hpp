@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "Response.hpp"
+
+#include "src/TargetController/Tracepoint.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    class TraceStatus: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::TRACE_STATUS;
+
+        bool running = false;
+        TraceStopReason stopReason = TraceStopReason::NOT_RUN;
+
+        /**
+         * For TraceStopReason::PASS_COUNT, the number of the tracepoint that reached its pass count.
+         */
+        std::uint32_t stopTracepointNumber = 0;
+
+        std::size_t frameCount = 0;
+        std::size_t bufferSize = 0;
+        std::size_t bufferUsed = 0;
+
+        TraceStatus(
+            bool running,
+            TraceStopReason stopReason,
+            std::uint32_t stopTracepointNumber,
+            std::size_t frameCount,
+            std::size_t bufferSize,
+            std::size_t bufferUsed
+        )
+            : running(running)
+            , stopReason(stopReason)
+            , stopTracepointNumber(stopTracepointNumber)
+            , frameCount(frameCount)
+            , bufferSize(bufferSize)
+            , bufferUsed(bufferUsed)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return TraceStatus::type;
+        }
+    };
+}
@@ -3,13 +3,25 @@
 #include <filesystem>
 #include <typeindex>
 #include <algorithm>
+#include <functional>
 
 #include "Responses/Error.hpp"
 
 #include "src/Services/ProcessService.hpp"
 #include "src/Logger/Logger.hpp"
+#include "src/Services/TraceService.hpp"
+#include "src/Services/MetricsService.hpp"
+#include "src/Services/StartupProfilingService.hpp"
+#include "src/Services/SymbolService.hpp"
+#include "src/Services/PathService.hpp"
+#include "src/Helpers/Crc32.hpp"
+#include "src/DebugToolDrivers/USB/UsbDeviceRegistry.hpp"
+
+#include "src/Targets/Microchip/AVR/AVR8/TargetDescription/TargetDescriptionIndex.hpp"
+#include "src/Targets/Microchip/AVR/AVR8/TargetDescription/TargetDescriptionFile.hpp"
 
 #include "src/Exceptions/InvalidConfig.hpp"
+#include "src/TargetController/Exceptions/TargetOperationFailure.hpp"
 
 namespace Bloom::TargetController
 {
@@ -18,8 +30,10 @@ namespace Bloom::TargetController
     using namespace Bloom::Exceptions;
 
     using Commands::CommandIdType;
+    using Commands::CommandPriority;
 
     using Commands::Command;
+    using Commands::CommandType;
     using Commands::GetState;
     using Commands::Resume;
     using Commands::Suspend;
@@ -33,23 +47,65 @@ namespace Bloom::TargetController
     using Commands::ReadTargetMemory;
     using Commands::WriteTargetMemory;
     using Commands::EraseTargetMemory;
+    using Commands::FillTargetMemory;
+    using Commands::ComputeTargetMemoryCrc;
+    using Commands::SearchTargetMemory;
     using Commands::StepTargetExecution;
     using Commands::SetBreakpoint;
     using Commands::RemoveBreakpoint;
+    using Commands::SetWatchpoint;
+    using Commands::RemoveWatchpoint;
     using Commands::SetTargetProgramCounter;
     using Commands::GetTargetPinStates;
     using Commands::SetTargetPinState;
+    using Commands::SetTargetPinStateStreaming;
     using Commands::GetTargetStackPointer;
     using Commands::GetTargetProgramCounter;
     using Commands::EnableProgrammingMode;
     using Commands::DisableProgrammingMode;
+    using Commands::LoadProgramImage;
+    using Commands::StartProgramCounterSampling;
+    using Commands::StopProgramCounterSampling;
+    using Commands::StartCoverageCollection;
+    using Commands::StopCoverageCollection;
+    using Commands::StartTracing;
+    using Commands::StopTracing;
+    using Commands::GetTraceStatus;
+    using Commands::ReadTraceFrames;
+    using Commands::StartLiveSampling;
+    using Commands::StopLiveSampling;
+    using Commands::GetLiveSamples;
+    using Commands::StartTimingAnalysis;
+    using Commands::GetTimingAnalysisReport;
+    using Commands::StopTimingAnalysis;
+    using Commands::StartMemoryChangeTimeline;
+    using Commands::StopMemoryChangeTimeline;
+    using Commands::GetMemoryChanges;
+    using Commands::GetLastMemoryChange;
+    using Commands::CaptureCheckpoint;
+    using Commands::RestoreCheckpoint;
+    using Commands::CommandBatch;
+    using Commands::CancelCommand;
 
     using Responses::Response;
     using Responses::TargetRegistersRead;
     using Responses::TargetMemoryRead;
+    using Responses::TargetMemoryCrc;
+    using Responses::TargetMemoryFilled;
+    using Responses::TargetMemorySearchResult;
     using Responses::TargetPinStates;
     using Responses::TargetStackPointer;
     using Responses::TargetProgramCounter;
+    using Responses::ProgramImageLoaded;
+    using Responses::ProgramCounterSamples;
+    using Responses::CoverageReport;
+    using Responses::TraceStatus;
+    using Responses::TraceFrames;
+    using Responses::LiveSamples;
+    using Responses::TimingAnalysisReport;
+    using Responses::MemoryChanges;
+    using Responses::LastMemoryChange;
+    using Responses::CommandBatchResponses;
 
     TargetControllerComponent::TargetControllerComponent(
         const ProjectConfig& projectConfig,
@@ -57,7 +113,15 @@ namespace Bloom::TargetController
     )
         : projectConfig(projectConfig)
         , environmentConfig(environmentConfig)
-    {}
+    {
+        auto* expectedInstance = static_cast<TargetControllerComponent*>(nullptr);
+        TargetControllerComponent::defaultInstance.compare_exchange_strong(expectedInstance, this);
+    }
+
+    TargetControllerComponent::~TargetControllerComponent() {
+        auto* expectedInstance = this;
+        TargetControllerComponent::defaultInstance.compare_exchange_strong(expectedInstance, nullptr);
+    }
 
     void TargetControllerComponent::run() {
         try {
@@ -72,11 +136,15 @@ namespace Bloom::TargetController
                         this->fireTargetEvents();
                     }
 
-                    TargetControllerComponent::notifier.waitForNotification(std::chrono::milliseconds(60));
+                    this->eventLoop.runOnce(this->getPollTimeout());
 
                     this->processQueuedCommands();
                     this->eventListener->dispatchCurrentEvents();
 
+                    if (this->state == TargetControllerState::ACTIVE) {
+                        this->streamPinStates();
+                    }
+
                 } catch (const DeviceFailure& exception) {
                     /*
                      * Upon a device failure, we assume Bloom has lost control of the debug tool. This could be the
@@ -91,6 +159,13 @@ namespace Bloom::TargetController
                     Logger::error("Device failure detected - " + exception.getMessage());
                     Logger::error("Suspending TargetController");
                     this->suspend();
+
+                    this->awaitingDebugToolReconnection = this->debugToolUsbId.has_value()
+                        && Usb::UsbDeviceRegistry::hotplugSupported();
+
+                    if (this->awaitingDebugToolReconnection) {
+                        Logger::info("The TargetController will resume once the debug tool has been reconnected");
+                    }
                 }
             }
 
@@ -102,152 +177,190 @@ namespace Bloom::TargetController
         this->shutdown();
     }
 
-    void TargetControllerComponent::registerCommand(std::unique_ptr<Command> command) {
-        auto commandQueueLock = TargetControllerComponent::commandQueue.acquireLock();
-        TargetControllerComponent::commandQueue.getValue().push(std::move(command));
-        TargetControllerComponent::notifier.notify();
+    std::future<std::unique_ptr<Response>> TargetControllerComponent::registerCommand(
+        std::unique_ptr<Command> command
+    ) {
+        auto* targetController = TargetControllerComponent::defaultInstance.load();
+
+        if (targetController == nullptr) {
+            // Abandoning the promise will result in a broken promise error, for the caller
+            auto responsePromise = std::promise<std::unique_ptr<Response>>();
+            return responsePromise.get_future();
+        }
+
+        return targetController->queueCommand(std::move(command));
     }
 
-    std::optional<std::unique_ptr<Responses::Response>> TargetControllerComponent::waitForResponse(
-        CommandIdType commandId,
-        std::optional<std::chrono::milliseconds> timeout
+    std::shared_ptr<const Targets::TargetDescriptor> TargetControllerComponent::getDefaultPublishedTargetDescriptor(
+        bool includeVariants
     ) {
-        auto response = std::unique_ptr<Response>(nullptr);
+        auto* targetController = TargetControllerComponent::defaultInstance.load();
+        return targetController != nullptr ? targetController->getPublishedTargetDescriptor(includeVariants) : nullptr;
+    }
 
-        const auto predicate = [commandId, &response] {
-            auto& responsesByCommandId = TargetControllerComponent::responsesByCommandId.getValue();
-            auto responseIt = responsesByCommandId.find(commandId);
+    std::shared_ptr<const Targets::TargetDescriptor> TargetControllerComponent::getPublishedTargetDescriptor(
+        bool includeVariants
+    ) {
+        const auto lock = this->publishedTargetDescriptor.acquireLock();
+        const auto& published = this->publishedTargetDescriptor.getValue();
 
-            if (responseIt != responsesByCommandId.end()) {
-                response.swap(responseIt->second);
-                responsesByCommandId.erase(responseIt);
+        if (includeVariants && !published.includesVariants) {
+            return nullptr;
+        }
 
-                return true;
-            }
+        return published.descriptor;
+    }
 
-            return false;
+    std::future<std::unique_ptr<Response>> TargetControllerComponent::queueCommand(
+        std::unique_ptr<Command> command
+    ) {
+        /*
+         * The promise's shared state is allocated from a pool, for the same reason as the command and response
+         * objects (see Commands::Command::operator new()).
+         */
+        auto queuedCommand = QueuedCommand{
+            std::move(command),
+            std::promise<std::unique_ptr<Response>>(
+                std::allocator_arg,
+                MemoryPoolAllocator<QueuedCommand, QueuedCommand>()
+            ),
+            std::chrono::steady_clock::now()
         };
+        auto responseFuture = queuedCommand.responsePromise.get_future();
 
-        auto responsesByCommandIdLock = TargetControllerComponent::responsesByCommandId.acquireLock();
+        this->commandQueue.push(std::move(queuedCommand));
+        this->eventLoop.notify();
 
-        if (timeout.has_value()) {
-            TargetControllerComponent::responsesByCommandIdCv.wait_for(
-                responsesByCommandIdLock,
-                timeout.value(),
-                predicate
-            );
-
-        } else {
-            TargetControllerComponent::responsesByCommandIdCv.wait(responsesByCommandIdLock, predicate);
-        }
-
-        return (response != nullptr) ? std::optional(std::move(response)) : std::nullopt;
+        return responseFuture;
     }
 
     void TargetControllerComponent::deregisterCommandHandler(Commands::CommandType commandType) {
-        this->commandHandlersByCommandType.erase(commandType);
+        this->commandHandlersByCommandType[static_cast<std::size_t>(commandType)] = nullptr;
     }
 
     void TargetControllerComponent::startup() {
         this->setName("TC");
+
+        const auto startupPhase = Services::StartupProfilingService::ScopedPhase("TargetController startup");
         Logger::info("Starting TargetController");
         this->setThreadState(ThreadState::STARTING);
         this->blockAllSignals();
-        this->eventListener->setInterruptEventNotifier(&TargetControllerComponent::notifier);
+        this->applySchedulingConfig(
+            this->environmentConfig.targetControllerSchedulingConfig,
+            "TargetController thread"
+        );
+        this->eventListener->setInterruptEventNotifier(&(this->eventLoop));
         EventManager::registerListener(this->eventListener);
 
         // Register command handlers
-        this->registerCommandHandler<GetState>(
-            std::bind(&TargetControllerComponent::handleGetState, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<Resume>(
-            std::bind(&TargetControllerComponent::handleResume, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<Suspend>(
-            std::bind(&TargetControllerComponent::handleSuspend, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<GetTargetDescriptor>(
-            std::bind(&TargetControllerComponent::handleGetTargetDescriptor, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<GetTargetState>(
-            std::bind(&TargetControllerComponent::handleGetTargetState, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<StopTargetExecution>(
-            std::bind(&TargetControllerComponent::handleStopTargetExecution, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<ResumeTargetExecution>(
-            std::bind(&TargetControllerComponent::handleResumeTargetExecution, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<ResetTarget>(
-            std::bind(&TargetControllerComponent::handleResetTarget, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<ReadTargetRegisters>(
-            std::bind(&TargetControllerComponent::handleReadTargetRegisters, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<WriteTargetRegisters>(
-            std::bind(&TargetControllerComponent::handleWriteTargetRegisters, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<ReadTargetMemory>(
-            std::bind(&TargetControllerComponent::handleReadTargetMemory, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<WriteTargetMemory>(
-            std::bind(&TargetControllerComponent::handleWriteTargetMemory, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<EraseTargetMemory>(
-            std::bind(&TargetControllerComponent::handleEraseTargetMemory, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<StepTargetExecution>(
-            std::bind(&TargetControllerComponent::handleStepTargetExecution, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<SetBreakpoint>(
-            std::bind(&TargetControllerComponent::handleSetBreakpoint, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<RemoveBreakpoint>(
-            std::bind(&TargetControllerComponent::handleRemoveBreakpoint, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<SetTargetProgramCounter>(
-            std::bind(&TargetControllerComponent::handleSetProgramCounter, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<GetTargetPinStates>(
-            std::bind(&TargetControllerComponent::handleGetTargetPinStates, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<SetTargetPinState>(
-            std::bind(&TargetControllerComponent::handleSetTargetPinState, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<GetTargetStackPointer>(
-            std::bind(&TargetControllerComponent::handleGetTargetStackPointer, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<GetTargetProgramCounter>(
-            std::bind(&TargetControllerComponent::handleGetTargetProgramCounter, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<EnableProgrammingMode>(
-            std::bind(&TargetControllerComponent::handleEnableProgrammingMode, this, std::placeholders::_1)
-        );
-
-        this->registerCommandHandler<DisableProgrammingMode>(
-            std::bind(&TargetControllerComponent::handleDisableProgrammingMode, this, std::placeholders::_1)
-        );
+        this->registerCommandHandler<GetState, &TargetControllerComponent::handleGetState>();
+        this->registerCommandHandler<Resume, &TargetControllerComponent::handleResume>();
+        this->registerCommandHandler<Suspend, &TargetControllerComponent::handleSuspend>();
+        this->registerCommandHandler<GetTargetDescriptor, &TargetControllerComponent::handleGetTargetDescriptor>();
+        this->registerCommandHandler<GetTargetState, &TargetControllerComponent::handleGetTargetState>();
+        this->registerCommandHandler<StopTargetExecution, &TargetControllerComponent::handleStopTargetExecution>();
+        this->registerCommandHandler<ResumeTargetExecution, &TargetControllerComponent::handleResumeTargetExecution>();
+        this->registerCommandHandler<ResetTarget, &TargetControllerComponent::handleResetTarget>();
+        this->registerCommandHandler<ReadTargetRegisters, &TargetControllerComponent::handleReadTargetRegisters>();
+        this->registerCommandHandler<WriteTargetRegisters, &TargetControllerComponent::handleWriteTargetRegisters>();
+        this->registerCommandHandler<ReadTargetMemory, &TargetControllerComponent::handleReadTargetMemory>();
+        this->registerCommandHandler<WriteTargetMemory, &TargetControllerComponent::handleWriteTargetMemory>();
+        this->registerCommandHandler<EraseTargetMemory, &TargetControllerComponent::handleEraseTargetMemory>();
+        this->registerCommandHandler<FillTargetMemory, &TargetControllerComponent::handleFillTargetMemory>();
+
+        this->registerCommandHandler<
+            ComputeTargetMemoryCrc,
+            &TargetControllerComponent::handleComputeTargetMemoryCrc
+        >();
+
+        this->registerCommandHandler<SearchTargetMemory, &TargetControllerComponent::handleSearchTargetMemory>();
+
+        this->registerCommandHandler<StepTargetExecution, &TargetControllerComponent::handleStepTargetExecution>();
+        this->registerCommandHandler<SetBreakpoint, &TargetControllerComponent::handleSetBreakpoint>();
+        this->registerCommandHandler<RemoveBreakpoint, &TargetControllerComponent::handleRemoveBreakpoint>();
+        this->registerCommandHandler<SetWatchpoint, &TargetControllerComponent::handleSetWatchpoint>();
+        this->registerCommandHandler<RemoveWatchpoint, &TargetControllerComponent::handleRemoveWatchpoint>();
+        this->registerCommandHandler<SetTargetProgramCounter, &TargetControllerComponent::handleSetProgramCounter>();
+        this->registerCommandHandler<GetTargetPinStates, &TargetControllerComponent::handleGetTargetPinStates>();
+        this->registerCommandHandler<SetTargetPinState, &TargetControllerComponent::handleSetTargetPinState>();
+
+        this->registerCommandHandler<
+            SetTargetPinStateStreaming,
+            &TargetControllerComponent::handleSetTargetPinStateStreaming
+        >();
+
+        this->registerCommandHandler<GetTargetStackPointer, &TargetControllerComponent::handleGetTargetStackPointer>();
+
+        this->registerCommandHandler<
+            GetTargetProgramCounter,
+            &TargetControllerComponent::handleGetTargetProgramCounter
+        >();
+
+        this->registerCommandHandler<EnableProgrammingMode, &TargetControllerComponent::handleEnableProgrammingMode>();
+
+        this->registerCommandHandler<
+            DisableProgrammingMode,
+            &TargetControllerComponent::handleDisableProgrammingMode
+        >();
+
+        this->registerCommandHandler<LoadProgramImage, &TargetControllerComponent::handleLoadProgramImage>();
+
+        this->registerCommandHandler<
+            StartProgramCounterSampling,
+            &TargetControllerComponent::handleStartProgramCounterSampling
+        >();
+
+        this->registerCommandHandler<
+            StopProgramCounterSampling,
+            &TargetControllerComponent::handleStopProgramCounterSampling
+        >();
+
+        this->registerCommandHandler<
+            StartCoverageCollection,
+            &TargetControllerComponent::handleStartCoverageCollection
+        >();
+
+        this->registerCommandHandler<
+            StopCoverageCollection,
+            &TargetControllerComponent::handleStopCoverageCollection
+        >();
+
+        this->registerCommandHandler<StartTracing, &TargetControllerComponent::handleStartTracing>();
+        this->registerCommandHandler<StopTracing, &TargetControllerComponent::handleStopTracing>();
+        this->registerCommandHandler<GetTraceStatus, &TargetControllerComponent::handleGetTraceStatus>();
+        this->registerCommandHandler<ReadTraceFrames, &TargetControllerComponent::handleReadTraceFrames>();
+
+        this->registerCommandHandler<StartLiveSampling, &TargetControllerComponent::handleStartLiveSampling>();
+        this->registerCommandHandler<StopLiveSampling, &TargetControllerComponent::handleStopLiveSampling>();
+        this->registerCommandHandler<GetLiveSamples, &TargetControllerComponent::handleGetLiveSamples>();
+        this->registerCommandHandler<StartTimingAnalysis, &TargetControllerComponent::handleStartTimingAnalysis>();
+
+        this->registerCommandHandler<
+            GetTimingAnalysisReport,
+            &TargetControllerComponent::handleGetTimingAnalysisReport
+        >();
+
+        this->registerCommandHandler<StopTimingAnalysis, &TargetControllerComponent::handleStopTimingAnalysis>();
+
+        this->registerCommandHandler<
+            StartMemoryChangeTimeline,
+            &TargetControllerComponent::handleStartMemoryChangeTimeline
+        >();
+
+        this->registerCommandHandler<
+            StopMemoryChangeTimeline,
+            &TargetControllerComponent::handleStopMemoryChangeTimeline
+        >();
+
+        this->registerCommandHandler<GetMemoryChanges, &TargetControllerComponent::handleGetMemoryChanges>();
+        this->registerCommandHandler<GetLastMemoryChange, &TargetControllerComponent::handleGetLastMemoryChange>();
+        this->registerCommandHandler<CaptureCheckpoint, &TargetControllerComponent::handleCaptureCheckpoint>();
+        this->registerCommandHandler<RestoreCheckpoint, &TargetControllerComponent::handleRestoreCheckpoint>();
+
+        this->registerCommandHandler<CommandBatch, &TargetControllerComponent::handleCommandBatch>();
+        this->registerCommandHandler<CancelCommand, &TargetControllerComponent::handleCancelCommand>();
+
+        this->startUsbHotplugMonitoring();
 
         // Register event handlers
         this->eventListener->registerCallbackForEventType<Events::ShutdownTargetController>(
@@ -275,8 +388,10 @@ namespace Bloom::TargetController
             },
             {
                 "power-debugger",
-                [] {
-                    return std::make_unique<DebugToolDrivers::PowerDebugger>();
+                [this] {
+                    return std::make_unique<DebugToolDrivers::PowerDebugger>(
+                        this->environmentConfig.debugToolConfig
+                    );
                 }
             },
             {
@@ -321,6 +436,30 @@ namespace Bloom::TargetController
                     return std::make_unique<DebugToolDrivers::JtagIce3>();
                 }
             },
+            {
+                "mock",
+                [this] {
+                    return std::make_unique<DebugToolDrivers::MockDebugTool>(
+                        this->environmentConfig.debugToolConfig
+                    );
+                }
+            },
+            {
+                "simulator",
+                [this] {
+                    return std::make_unique<DebugToolDrivers::Simulator::SimulatorDebugTool>(
+                        this->environmentConfig.debugToolConfig
+                    );
+                }
+            },
+            {
+                "edbg-replay",
+                [this] {
+                    return std::make_unique<DebugToolDrivers::EdbgReplayDevice>(
+                        this->environmentConfig.debugToolConfig
+                    );
+                }
+            },
         };
     }
 
@@ -328,7 +467,7 @@ namespace Bloom::TargetController
         std::string,
         std::function<std::unique_ptr<Targets::Target>()>
     > TargetControllerComponent::getSupportedTargets() {
-        using Avr8TargetDescriptionFile = Targets::Microchip::Avr::Avr8Bit::TargetDescription::TargetDescriptionFile;
+        using Avr8TargetDescriptionIndex = Targets::Microchip::Avr::Avr8Bit::TargetDescription::TargetDescriptionIndex;
 
         auto mapping = std::map<std::string, std::function<std::unique_ptr<Targets::Target>()>>({
             {
@@ -340,28 +479,20 @@ namespace Bloom::TargetController
         });
 
         // Include all targets from AVR8 target description files
-        const auto avr8PdMapping = Avr8TargetDescriptionFile::getTargetDescriptionMapping();
-
-        for (auto mapIt = avr8PdMapping.begin(); mapIt != avr8PdMapping.end(); mapIt++) {
-            // Each target signature maps to an array of targets, as numerous targets can possess the same signature.
-            const auto targets = mapIt.value().toArray();
-
-            for (auto targetIt = targets.begin(); targetIt != targets.end(); targetIt++) {
-                const auto targetName = targetIt->toObject().find("targetName").value().toString()
-                    .toLower().toStdString();
-                const auto targetSignatureHex = mapIt.key().toLower().toStdString();
-
-                if (!mapping.contains(targetName)) {
-                    mapping.insert({
-                        targetName,
-                        [targetName, targetSignatureHex] {
-                            return std::make_unique<Targets::Microchip::Avr::Avr8Bit::Avr8>(
-                                targetName,
-                                Targets::Microchip::Avr::TargetSignature(targetSignatureHex)
-                            );
-                        }
-                    });
-                }
+        for (const auto& indexEntry : Avr8TargetDescriptionIndex::getEntries()) {
+            const auto targetName = std::string(indexEntry.targetName);
+            const auto targetSignature = indexEntry.getTargetSignature();
+
+            if (!mapping.contains(targetName)) {
+                mapping.insert({
+                    targetName,
+                    [targetName, targetSignature] {
+                        return std::make_unique<Targets::Microchip::Avr::Avr8Bit::Avr8>(
+                            targetName,
+                            targetSignature
+                        );
+                    }
+                });
             }
         }
 
@@ -369,63 +500,115 @@ namespace Bloom::TargetController
     }
 
     void TargetControllerComponent::processQueuedCommands() {
-        auto commands = std::queue<std::unique_ptr<Command>>();
-
-        {
-            const auto queueLock = TargetControllerComponent::commandQueue.acquireLock();
-            commands.swap(TargetControllerComponent::commandQueue.getValue());
-        }
+        this->processPendingCommands();
+    }
 
-        while (!commands.empty()) {
-            const auto command = std::move(commands.front());
-            commands.pop();
+    void TargetControllerComponent::processPendingCommands(std::optional<CommandPriority> priorityThreshold) {
+        static auto& queueDepthHistogram = Services::MetricsService::histogram("targetController.queueDepth");
+        static auto& queueWaitHistogram = Services::MetricsService::histogram("targetController.queueWaitUs");
 
-            const auto commandId = command->id;
-            const auto commandType = command->getType();
+        while (true) {
+            this->commandQueue.takeAll(this->takenCommands);
 
-            try {
-                const auto commandHandlerIt = this->commandHandlersByCommandType.find(commandType);
+            if (!this->takenCommands.empty()) {
+                auto pendingCommandCount = std::size_t(0);
 
-                if (commandHandlerIt == this->commandHandlersByCommandType.end()) {
-                    throw Exception("No handler registered for this command.");
+                /*
+                 * At most one command is processed per iteration, after the taken commands have been moved to the
+                 * pending queues, so nested calls (from chunked memory operations) can't clobber the vector.
+                 */
+                for (auto& queuedCommand : this->takenCommands) {
+                    const auto priority = queuedCommand.command->priority;
+                    this->pendingCommandsByPriority[priority].push_back(std::move(queuedCommand));
                 }
 
-                if (this->state != TargetControllerState::ACTIVE && command->requiresActiveState()) {
-                    throw Exception("Command rejected - TargetController not in active state.");
+                for (const auto& [priority, pendingCommands] : this->pendingCommandsByPriority) {
+                    pendingCommandCount += pendingCommands.size();
                 }
 
-                if (this->state == TargetControllerState::ACTIVE) {
-                    if (command->requiresStoppedTargetState() && this->lastTargetState != TargetState::STOPPED) {
-                        throw Exception("Command rejected - command requires target execution to be stopped.");
-                    }
+                queueDepthHistogram.record(pendingCommandCount);
+            }
 
-                    if (this->target->programmingModeEnabled() && command->requiresDebugMode()) {
-                        throw Exception(
-                            "Command rejected - command cannot be serviced whilst the target is in programming mode."
-                        );
-                    }
+            // The map is ordered by priority, highest first
+            const auto pendingCommandsIt = std::find_if(
+                this->pendingCommandsByPriority.begin(),
+                this->pendingCommandsByPriority.end(),
+                [] (const auto& pair) {
+                    return !pair.second.empty();
                 }
+            );
 
-                this->registerCommandResponse(commandId, commandHandlerIt->second(*(command.get())));
-
-            } catch (const Exception& exception) {
-                this->registerCommandResponse(
-                    commandId,
-                    std::make_unique<Responses::Error>(exception.getMessage())
-                );
+            if (
+                pendingCommandsIt == this->pendingCommandsByPriority.end()
+                || (priorityThreshold.has_value() && pendingCommandsIt->first >= *priorityThreshold)
+            ) {
+                return;
             }
+
+            auto queuedCommand = std::move(pendingCommandsIt->second.front());
+            pendingCommandsIt->second.pop_front();
+
+            queueWaitHistogram.recordDuration(std::chrono::steady_clock::now() - queuedCommand.queuedTime);
+
+            const auto traceSpan = Services::TraceService::Span(
+                "TargetControllerComponent::processCommand",
+                "TargetController",
+                queuedCommand.command->id
+            );
+
+            queuedCommand.responsePromise.set_value(this->processCommand(*(queuedCommand.command.get())));
         }
     }
 
-    void TargetControllerComponent::registerCommandResponse(
-        CommandIdType commandId,
-        std::unique_ptr<Response> response
-    ) {
-        const auto responseMappingLock = TargetControllerComponent::responsesByCommandId.acquireLock();
-        TargetControllerComponent::responsesByCommandId.getValue().insert(
-            std::pair(commandId, std::move(response))
-        );
-        TargetControllerComponent::responsesByCommandIdCv.notify_all();
+    std::unique_ptr<Response> TargetControllerComponent::processCommand(Command& command) {
+        const auto commandType = command.getType();
+
+        try {
+            const auto commandTypeIndex = static_cast<std::size_t>(commandType);
+            const auto commandHandler = commandTypeIndex < this->commandHandlersByCommandType.size()
+                ? this->commandHandlersByCommandType[commandTypeIndex]
+                : nullptr;
+
+            if (commandHandler == nullptr) {
+                throw Exception("No handler registered for this command.");
+            }
+
+            if (this->state != TargetControllerState::ACTIVE && command.requiresActiveState()) {
+                throw Exception("Command rejected - TargetController not in active state.");
+            }
+
+            if (this->state == TargetControllerState::ACTIVE) {
+                if (command.requiresStoppedTargetState() && this->lastTargetState != TargetState::STOPPED) {
+                    throw Exception("Command rejected - command requires target execution to be stopped.");
+                }
+
+                if (this->target->programmingModeEnabled() && command.requiresDebugMode()) {
+                    throw Exception(
+                        "Command rejected - command cannot be serviced whilst the target is in programming mode."
+                    );
+                }
+            }
+
+            if (this->memoryWriteFlushRequired(command)) {
+                this->flushMemoryWriteBuffers();
+            }
+
+            if (this->targetResetPending && this->pendingTargetResetRequired(command)) {
+                this->performPendingTargetReset();
+            }
+
+            const auto startTime = std::chrono::steady_clock::now();
+            auto response = commandHandler(*this, command);
+
+            this->commandLatencyHistogramsByCommandType[commandTypeIndex]->recordDuration(
+                std::chrono::steady_clock::now() - startTime
+            );
+
+            return response;
+
+        } catch (const Exception& exception) {
+            return std::make_unique<Responses::Error>(exception.getMessage());
+        }
     }
 
     void TargetControllerComponent::shutdown() {
@@ -436,6 +619,7 @@ namespace Bloom::TargetController
         try {
             Logger::info("Shutting down TargetController");
             EventManager::deregisterListener(this->eventListener->getId());
+            Usb::UsbDeviceRegistry::setArrivalCallback(nullptr);
             this->releaseHardware();
 
         } catch (const std::exception& exception) {
@@ -446,6 +630,13 @@ namespace Bloom::TargetController
             );
         }
 
+        /*
+         * Discard any commands that we haven't processed. This will break their promises, so that the issuers don't
+         * have to wait for their timeouts to elapse.
+         */
+        this->commandQueue.takeAll();
+        this->pendingCommandsByPriority.clear();
+
         this->setThreadStateAndEmitEvent(ThreadState::STOPPED);
     }
 
@@ -456,6 +647,50 @@ namespace Bloom::TargetController
 
         Logger::debug("Suspending TargetController");
 
+        this->stopProgramCounterSampling();
+        this->stopLiveSampling();
+        this->stopMemoryChangeTimeline();
+
+        if (this->coverageSession.has_value()) {
+            // The breakpoints will be cleared from the target along with the hardware, so we just drop the session
+            this->eventLoop.removeTimer(this->coverageSession->sweepTimerId);
+            this->coverageSession = std::nullopt;
+            Logger::warning("Coverage collection aborted");
+        }
+
+        if (this->timingSession.has_value() && !this->timingSession->results.completed()) {
+            // As above, the timing breakpoints will be cleared along with the hardware
+            this->timingSession = std::nullopt;
+            Logger::warning("Timing analysis aborted");
+        }
+
+        if (this->traceSession.running) {
+            // As above, the tracepoint breakpoints will be cleared along with the hardware
+            this->traceSession.ownedAddresses.clear();
+            this->stopTracing(TraceStopReason::STOPPED);
+            Logger::warning("Trace experiment stopped");
+        }
+
+        try {
+            // The target may still be accessible (if we're suspending on request) - don't lose the buffered writes
+            this->flushMemoryWriteBuffers();
+
+        } catch (const std::exception& exception) {
+            Logger::error("Discarding buffered memory writes - " + std::string(exception.what()));
+        }
+
+        if (this->targetResetPending) {
+            try {
+                // As above, the target should be in the state the client expects, when we release it
+                this->performPendingTargetReset();
+
+            } catch (const std::exception& exception) {
+                Logger::error("Failed to perform deferred target reset - " + std::string(exception.what()));
+                this->targetResetPending = false;
+                this->pendingResetProgramCounter = std::nullopt;
+            }
+        }
+
         try {
             this->releaseHardware();
 
@@ -467,19 +702,36 @@ namespace Bloom::TargetController
         this->eventListener->deregisterCallbacksForEventType<Events::DebugSessionFinished>();
 
         this->lastTargetState = TargetState::UNKNOWN;
-        this->cachedTargetDescriptor = std::nullopt;
-        this->registerDescriptorsByMemoryType.clear();
-        this->registerAddressRangeByMemoryType.clear();
+        this->cancelDebugSessionLinger();
+        this->endActiveStep();
+        this->invalidateStopSnapshot();
+        this->logMemoryCacheStatistics();
+        this->memoryCachesByType.clear();
+        this->programMemoryContents = std::nullopt;
+        this->checkpoint = std::nullopt;
+        this->cachedTargetDescriptor = nullptr;
+        this->cachedTargetDescriptorIncludesVariants = false;
+        this->publishTargetDescriptor();
+        this->registerDescriptorIndicesByMemoryType.clear();
+        this->pinStateStreamVariantId = std::nullopt;
+        this->lastStreamedPinStates = std::nullopt;
 
         TargetControllerComponent::state = TargetControllerState::SUSPENDED;
-        EventManager::triggerEvent(std::make_shared<TargetControllerStateChanged>(TargetControllerComponent::state));
+        EventManager::triggerEvent(Events::makeEvent<TargetControllerStateChanged>(TargetControllerComponent::state));
 
         Logger::debug("TargetController suspended");
     }
 
     void TargetControllerComponent::resume() {
         this->acquireHardware();
-        this->loadRegisterDescriptors();
+
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Load register descriptors");
+            this->loadRegisterDescriptors();
+        }
+
+        // Publish the descriptor before announcing the activation, so that listeners can find it
+        this->getTargetDescriptor();
 
         this->eventListener->registerCallbackForEventType<Events::DebugSessionFinished>(
             std::bind(&TargetControllerComponent::onDebugSessionFinishedEvent, this, std::placeholders::_1)
@@ -487,13 +739,15 @@ namespace Bloom::TargetController
 
         TargetControllerComponent::state = TargetControllerState::ACTIVE;
         EventManager::triggerEvent(
-            std::make_shared<TargetControllerStateChanged>(TargetControllerComponent::state)
+            Events::makeEvent<TargetControllerStateChanged>(TargetControllerComponent::state)
         );
 
         if (this->target->getState() != TargetState::RUNNING) {
             this->target->run();
             this->lastTargetState = TargetState::RUNNING;
         }
+
+        this->awaitingDebugToolReconnection = false;
     }
 
     void TargetControllerComponent::acquireHardware() {
@@ -518,11 +772,39 @@ namespace Bloom::TargetController
             );
         }
 
+        const auto targetDescriptionFilePreload = this->preloadTargetDescriptionFile(targetName);
+
         // Initiate debug tool and target
         this->debugTool = debugToolIt->second();
 
+        const auto& usbTraceRecordingFilePath = this->environmentConfig.debugToolConfig.usbTraceRecordingFilePath;
+        if (usbTraceRecordingFilePath.has_value()) {
+            auto* edbgDevice = dynamic_cast<DebugToolDrivers::EdbgDevice*>(this->debugTool.get());
+
+            if (edbgDevice == nullptr) {
+                throw Exceptions::InvalidConfig(
+                    "USB trace recording (\"recordUsbTrace\") is only supported on EDBG-based debug tools"
+                );
+            }
+
+            edbgDevice->recordUsbTrace(
+                usbTraceRecordingFilePath->starts_with('/')
+                    ? *usbTraceRecordingFilePath
+                    : Services::PathService::projectDirPath() + "/" + *usbTraceRecordingFilePath
+            );
+        }
+
+        const auto* usbDevice = dynamic_cast<Usb::UsbDevice*>(this->debugTool.get());
+        this->debugToolUsbId = usbDevice != nullptr
+            ? std::optional(std::pair(usbDevice->vendorId, usbDevice->productId))
+            : std::nullopt;
+
         Logger::info("Connecting to debug tool");
-        this->debugTool->init();
+
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Connect to debug tool");
+            this->debugTool->init();
+        }
 
         Logger::info("Debug tool connected");
         Logger::info("Debug tool name: " + this->debugTool->getName());
@@ -538,29 +820,82 @@ namespace Bloom::TargetController
         }
 
         this->target->setDebugTool(this->debugTool.get());
-        this->target->preActivationConfigure(this->environmentConfig.targetConfig);
+
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Pre-activation configuration");
+            this->target->preActivationConfigure(this->environmentConfig.targetConfig);
+        }
 
         Logger::info("Activating target");
-        this->target->activate();
+
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Activate target");
+            this->target->activate();
+        }
+
         Logger::info("Target activated");
-        this->target->postActivationConfigure();
 
-        while (this->target->supportsPromotion()) {
-            auto promotedTarget = this->target->promote();
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Post-activation configuration");
+            this->target->postActivationConfigure();
+        }
 
-            if (
-                promotedTarget == nullptr
-                || std::type_index(typeid(*promotedTarget)) == std::type_index(typeid(*this->target))
-            ) {
-                break;
-            }
+        {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Target promotion");
+
+            while (this->target->supportsPromotion()) {
+                auto promotedTarget = this->target->promote();
 
-            this->target = std::move(promotedTarget);
-            this->target->postPromotionConfigure();
+                if (
+                    promotedTarget == nullptr
+                    || std::type_index(typeid(*promotedTarget)) == std::type_index(typeid(*this->target))
+                ) {
+                    break;
+                }
+
+                this->target = std::move(promotedTarget);
+                this->target->postPromotionConfigure();
+            }
         }
 
         Logger::info("Target ID: " + this->target->getHumanReadableId());
         Logger::info("Target name: " + this->target->getName());
+
+        this->breakpointManager.reset(
+            this->target->getHardwareBreakpointCount(),
+            this->target->getDataBreakpointCount()
+        );
+        this->breakpointConditionsByAddress.clear();
+    }
+
+    std::future<void> TargetControllerComponent::preloadTargetDescriptionFile(const std::string& targetName) {
+        using Targets::Microchip::Avr::Avr8Bit::TargetDescription::TargetDescriptionIndex;
+        using Targets::Microchip::Avr::Avr8Bit::TargetDescription::TargetDescriptionFile;
+
+        const auto entries = TargetDescriptionIndex::getEntries();
+        const auto entryIt = std::find_if(
+            entries.begin(),
+            entries.end(),
+            [&targetName] (const auto& entry) {
+                return entry.targetName == targetName;
+            }
+        );
+
+        if (entryIt == entries.end()) {
+            // Ambiguous target name - the TDF can only be resolved once we've read the signature from the target
+            return {};
+        }
+
+        return std::async(std::launch::async, [targetName, targetSignature = entryIt->getTargetSignature()] {
+            const auto phase = Services::StartupProfilingService::ScopedPhase("Preload TDF (background)");
+
+            try {
+                TargetDescriptionFile::getShared(targetSignature, targetName);
+
+            } catch (const std::exception& exception) {
+                Logger::debug("Failed to preload TDF - " + std::string(exception.what()));
+            }
+        });
     }
 
     void TargetControllerComponent::releaseHardware() {
@@ -586,382 +921,3496 @@ namespace Bloom::TargetController
         }
     }
 
-    void TargetControllerComponent::loadRegisterDescriptors() {
-        const auto& targetDescriptor = this->getTargetDescriptor();
-
-        for (const auto& [registerType, registerDescriptors] : targetDescriptor.registerDescriptorsByType) {
-            for (const auto& registerDescriptor : registerDescriptors) {
-                auto startAddress = registerDescriptor.startAddress.value_or(0);
-                auto endAddress = startAddress + (registerDescriptor.size - 1);
-
-                const auto registerAddressRangeIt = this->registerAddressRangeByMemoryType.find(
-                    registerDescriptor.memoryType
-                );
-
-                if (registerAddressRangeIt == this->registerAddressRangeByMemoryType.end()) {
-                    this->registerAddressRangeByMemoryType.insert(
-                        std::pair(registerDescriptor.memoryType, TargetMemoryAddressRange(startAddress, endAddress))
-                    );
-
-                } else {
-                    auto& addressRange = registerAddressRangeIt->second;
-
-                    if (startAddress < addressRange.startAddress) {
-                        addressRange.startAddress = startAddress;
-                    }
+    void TargetControllerComponent::startUsbHotplugMonitoring() {
+        if (!Usb::UsbDeviceRegistry::hotplugSupported()) {
+            Logger::debug("USB hotplug events not supported - debug tool reconnection will not be detected");
+            return;
+        }
 
-                    if (endAddress > addressRange.endAddress) {
-                        addressRange.endAddress = endAddress;
-                    }
+        for (const auto& eventFileDescriptor : Usb::UsbDeviceRegistry::getEventFileDescriptors()) {
+            this->eventLoop.watch(
+                eventFileDescriptor.fileDescriptor,
+                eventFileDescriptor.eventMask,
+                [] (std::uint32_t) {
+                    Usb::UsbDeviceRegistry::handleEvents();
                 }
-
-                this->registerDescriptorsByMemoryType[registerDescriptor.memoryType].insert(registerDescriptor);
-            }
+            );
         }
-    }
-
-    TargetRegisterDescriptors TargetControllerComponent::getRegisterDescriptorsWithinAddressRange(
-        Targets::TargetMemoryAddress startAddress,
-        Targets::TargetMemoryAddress endAddress,
-        Targets::TargetMemoryType memoryType
-    ) {
-        auto output = TargetRegisterDescriptors();
 
-        const auto registerAddressRangeIt = this->registerAddressRangeByMemoryType.find(memoryType);
-        const auto registerDescriptorsIt = this->registerDescriptorsByMemoryType.find(memoryType);
+        Usb::UsbDeviceRegistry::setArrivalCallback(
+            std::bind(
+                &TargetControllerComponent::onUsbDeviceArrival,
+                this,
+                std::placeholders::_1,
+                std::placeholders::_2
+            )
+        );
+    }
 
+    void TargetControllerComponent::onUsbDeviceArrival(std::uint16_t vendorId, std::uint16_t productId) {
         if (
-            registerAddressRangeIt != this->registerAddressRangeByMemoryType.end()
-            && registerDescriptorsIt != this->registerDescriptorsByMemoryType.end()
+            !this->awaitingDebugToolReconnection
+            || this->state != TargetControllerState::SUSPENDED
+            || this->debugToolUsbId != std::pair(vendorId, productId)
         ) {
-            const auto& registersAddressRange = registerAddressRangeIt->second;
-
-            if (
-                (startAddress <= registersAddressRange.startAddress && endAddress >= registersAddressRange.startAddress)
-                || (startAddress <= registersAddressRange.endAddress && endAddress >= registersAddressRange.startAddress)
-            ) {
-                const auto& registerDescriptors = this->registerDescriptorsByMemoryType.at(memoryType);
-
-                for (const auto& registerDescriptor : registerDescriptors) {
-                    if (!registerDescriptor.startAddress.has_value() || registerDescriptor.size < 1) {
-                        continue;
-                    }
-
-                    const auto registerStartAddress = registerDescriptor.startAddress.value();
-                    const auto registerEndAddress = registerStartAddress + registerDescriptor.size;
-
-                    if (
-                        (startAddress <= registerStartAddress && endAddress >= registerStartAddress)
-                        || (startAddress <= registerEndAddress && endAddress >= registerStartAddress)
-                    ) {
-                        output.insert(registerDescriptor);
-                    }
-                }
-            }
+            return;
         }
 
-        return output;
+        Logger::info("Debug tool reconnected");
+        this->eventLoop.addTimer(
+            TargetControllerComponent::DEBUG_TOOL_RECONNECTION_DELAY,
+            [this] {
+                this->reacquireHardware();
+            }
+        );
     }
 
-    void TargetControllerComponent::fireTargetEvents() {
-        auto newTargetState = this->target->getState();
+    void TargetControllerComponent::reacquireHardware() {
+        if (!this->awaitingDebugToolReconnection || this->state != TargetControllerState::SUSPENDED) {
+            return;
+        }
 
-        if (newTargetState != this->lastTargetState) {
-            this->lastTargetState = newTargetState;
+        Logger::info("Resuming TargetController");
+
+        try {
+            this->resume();
+            this->fireTargetEvents();
+
+        } catch (const std::exception& exception) {
+            Logger::error("Failed to reacquire debug tool - " + std::string(exception.what()));
+
+            /*
+             * Release whatever we managed to acquire. We'll try again upon the next reconnection, or the next debug
+             * session.
+             */
+            this->suspend();
+            this->awaitingDebugToolReconnection = true;
+        }
+    }
+
+    void TargetControllerComponent::loadRegisterDescriptors() {
+        const auto& targetDescriptor = this->getTargetDescriptor();
+
+        for (const auto& [registerType, registerDescriptors] : targetDescriptor.registerDescriptorsByType) {
+            for (const auto& registerDescriptor : registerDescriptors) {
+                this->registerDescriptorIndicesByMemoryType[registerDescriptor.memoryType].insert(registerDescriptor);
+            }
+        }
+    }
+
+    void TargetControllerComponent::fireTargetEvents() {
+        auto newTargetState = this->target->getState();
+
+        if (newTargetState != this->lastTargetState) {
+            if (
+                newTargetState == TargetState::STOPPED
+                && this->coverageSession.has_value()
+                && this->recordCoverageHit(this->target->getProgramCounter())
+                && !this->activeStepRange.has_value()
+            ) {
+                // The target stopped at one of our coverage breakpoints - resume it without reporting the stop
+                this->breakpointManager.commit(*this->target);
+                this->target->run();
+                return;
+            }
+
+            if (
+                newTargetState == TargetState::STOPPED
+                && this->timingSession.has_value()
+                && !this->activeStepRange.has_value()
+                && !this->steppingExecution
+                && this->handleTimingBreak(this->target->getProgramCounter())
+            ) {
+                // The target stopped at one of our timing breakpoints, and has been resumed
+                return;
+            }
+
+            if (
+                newTargetState == TargetState::STOPPED
+                && this->activeStepRange.has_value()
+                && this->continueActiveStep()
+            ) {
+                // The step is still in progress - we don't report the stop
+                return;
+            }
+
+            if (
+                newTargetState == TargetState::STOPPED
+                && !this->steppingExecution
+                && this->traceSession.running
+                && this->recordTraceFrames(this->target->getProgramCounter())
+            ) {
+                // The target stopped at one of our tracepoints - resume it without reporting the stop
+                this->breakpointManager.commit(*this->target);
+                this->target->run();
+                return;
+            }
+
+            if (
+                newTargetState == TargetState::STOPPED
+                && !this->steppingExecution
+                && !this->breakpointConditionsByAddress.empty()
+            ) {
+                const auto programCounter = this->target->getProgramCounter();
+
+                if (
+                    this->breakpointManager.isBreakpointSet(programCounter)
+                    && !this->breakpointConditionsMet(programCounter)
+                ) {
+                    // The breakpoint's conditions weren't met - resume without reporting the stop
+                    this->breakpointManager.commit(*this->target);
+                    this->target->run();
+                    return;
+                }
+            }
+
+            this->lastTargetState = newTargetState;
 
             if (newTargetState == TargetState::STOPPED) {
                 Logger::debug("Target state changed - STOPPED");
-                EventManager::triggerEvent(std::make_shared<TargetExecutionStopped>(
-                    this->target->getProgramCounter(),
+
+                // The snapshot must be captured before we notify other components, as they'll be quick to act
+                this->captureStopSnapshot();
+
+                const auto programCounter = this->stopSnapshot.has_value()
+                    && this->stopSnapshot->programCounter.has_value()
+                        ? *(this->stopSnapshot->programCounter)
+                        : this->target->getProgramCounter();
+
+                // As with the snapshot, the changes must be recorded before other components are notified of the stop
+                this->recordMemoryChanges(programCounter);
+
+                EventManager::triggerEvent(Events::makeEvent<TargetExecutionStopped>(
+                    programCounter,
                     TargetBreakCause::UNKNOWN
                 ));
             }
 
             if (newTargetState == TargetState::RUNNING) {
                 Logger::debug("Target state changed - RUNNING");
-                EventManager::triggerEvent(std::make_shared<TargetExecutionResumed>(false));
+                this->invalidateStopSnapshot();
+                this->invalidateMemoryCaches();
+                this->invalidateProgramMemoryContents();
+                EventManager::triggerEvent(Events::makeEvent<TargetExecutionResumed>(false));
+            }
+        }
+    }
+
+    std::optional<std::chrono::milliseconds> TargetControllerComponent::getPollTimeout() const {
+        /*
+         * Commands and events wake up the event loop, so we only need a timeout when we have to poll the target
+         * for a change in its execution state (which can only happen when it's running), or for its pin states (when
+         * pin state streaming is active).
+         *
+         * Otherwise, we sleep until woken.
+         */
+        if (this->state != TargetControllerState::ACTIVE) {
+            return std::nullopt;
+        }
+
+        if (this->lastTargetState != TargetState::STOPPED) {
+            /*
+             * Range steps consist of many short steps - we poll without delay to keep them quick. That doesn't apply
+             * when running to the return address of a call that's being stepped over.
+             */
+            const auto timingAnalysisActive = this->timingSession.has_value()
+                && !this->timingSession->results.completed();
+
+            /*
+             * Timing analysis relies on us detecting halts at the timing breakpoints as soon as possible (the host-side
+             * durations include the detection latency), so we poll without delay for that, too.
+             */
+            return std::chrono::milliseconds(
+                (this->activeStepRange.has_value() && !this->activeStepReturnAddress.has_value())
+                    || timingAnalysisActive
+                    ? 0
+                    : this->environmentConfig.targetConfig.executionStatePollInterval
+            );
+        }
+
+        if (this->pinStateStreamVariantId.has_value()) {
+            const auto interval = std::chrono::milliseconds(
+                this->environmentConfig.targetConfig.pinStatePollInterval
+            );
+            const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - this->lastPinStateStreamReadTime
+            );
+
+            return elapsed < interval ? interval - elapsed : std::chrono::milliseconds(0);
+        }
+
+        return std::nullopt;
+    }
+
+    void TargetControllerComponent::streamPinStates() {
+        if (
+            !this->pinStateStreamVariantId.has_value()
+            || this->lastTargetState != TargetState::STOPPED
+            || this->target->programmingModeEnabled()
+        ) {
+            return;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (
+            now - this->lastPinStateStreamReadTime
+            < std::chrono::milliseconds(this->environmentConfig.targetConfig.pinStatePollInterval)
+        ) {
+            return;
+        }
+
+        this->lastPinStateStreamReadTime = now;
+        const auto variantId = *(this->pinStateStreamVariantId);
+
+        try {
+            auto pinStates = this->target->getPinStates(variantId);
+            auto changedPinStates = TargetPinStateMapping();
+
+            for (const auto& [pinNumber, pinState] : pinStates) {
+                if (this->lastStreamedPinStates.has_value()) {
+                    const auto lastPinStateIt = this->lastStreamedPinStates->find(pinNumber);
+
+                    if (lastPinStateIt != this->lastStreamedPinStates->end() && lastPinStateIt->second == pinState) {
+                        continue;
+                    }
+                }
+
+                changedPinStates.emplace(pinNumber, pinState);
+            }
+
+            this->lastStreamedPinStates = std::move(pinStates);
+
+            if (!changedPinStates.empty()) {
+                EventManager::triggerEvent(
+                    Events::makeEvent<TargetPinStatesChanged>(variantId, std::move(changedPinStates))
+                );
+            }
+
+        } catch (const DeviceFailure&) {
+            throw;
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to read target pin states - " + exception.getMessage());
+            Logger::error("Pin state streaming stopped");
+            this->pinStateStreamVariantId = std::nullopt;
+            this->lastStreamedPinStates = std::nullopt;
+        }
+    }
+
+    void TargetControllerComponent::sampleProgramCounter() {
+        /*
+         * We only sample whilst the target is running freely. If it has stopped since the last poll (at a
+         * breakpoint, for example), we leave it stopped, and let fireTargetEvents() report the stop.
+         *
+         * We don't sample whilst watchpoints are in place, as we'd have no way of telling if the target hit one
+         * just before we stopped it (see below).
+         */
+        if (
+            this->state != TargetControllerState::ACTIVE
+            || this->lastTargetState != TargetState::RUNNING
+            || this->activeStepRange.has_value()
+            || this->steppingExecution
+            || this->breakpointManager.hasWatchpoints()
+            || this->target->getState() != TargetState::RUNNING
+        ) {
+            ++this->skippedProgramCounterSampleCount;
+            return;
+        }
+
+        const auto traceSpan = Services::TraceService::Span("TargetControllerComponent::sampleProgramCounter", "TC");
+
+        try {
+            this->target->stop();
+            const auto programCounter = this->target->getProgramCounter();
+
+            if (
+                this->breakpointManager.isBreakpointInstalled(programCounter)
+                || (this->runToAddress.has_value() && programCounter == *(this->runToAddress))
+            ) {
+                /*
+                 * The target stopped of its own accord, between the state check above and our stop request (or it
+                 * was about to). We mustn't resume it - we leave it stopped, for fireTargetEvents() to report the
+                 * stop, and discard the sample.
+                 */
+                ++this->skippedProgramCounterSampleCount;
+                return;
+            }
+
+            // The target must resume as it was running - including any run-to address
+            this->target->run(this->runToAddress);
+
+            ++(this->programCounterSampleCounts[programCounter]);
+
+        } catch (const TargetOperationFailure& exception) {
+            Logger::error("Program counter sampling failed - " + exception.getMessage());
+            this->stopProgramCounterSampling();
+        }
+    }
+
+    void TargetControllerComponent::stopProgramCounterSampling() {
+        if (!this->programCounterSamplingTimerId.has_value()) {
+            return;
+        }
+
+        this->eventLoop.removeTimer(*this->programCounterSamplingTimerId);
+        this->programCounterSamplingTimerId = std::nullopt;
+
+        Logger::info(
+            "Program counter sampling stopped (" + std::to_string(this->programCounterSampleCounts.size())
+                + " distinct program counter values sampled)"
+        );
+    }
+
+    void TargetControllerComponent::takeLiveSample() {
+        auto& session = this->liveSamplingSession;
+
+        if (this->state != TargetControllerState::ACTIVE || this->target->programmingModeEnabled()) {
+            ++session.skippedSampleCount;
+            return;
+        }
+
+        const auto traceSpan = Services::TraceService::Span("TargetControllerComponent::takeLiveSample", "TC");
+        static auto& sampleCounter = Services::MetricsService::counter("targetController.liveSamples");
+
+        try {
+            auto sample = LiveSample(
+                session.nextSequenceNumber,
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - session.startTime
+                )
+            );
+            sample.values.resize(session.variables.size());
+
+            for (const auto& span : session.spans) {
+                const auto buffer = this->target->readMemory(span.memoryType, span.startAddress, span.size);
+
+                for (const auto variableIndex : span.variableIndices) {
+                    const auto& variable = session.variables[variableIndex];
+                    const auto offset = static_cast<std::ptrdiff_t>(variable.address - span.startAddress);
+
+                    sample.values[variableIndex] = TargetMemoryBuffer(
+                        buffer.begin() + offset,
+                        buffer.begin() + offset + static_cast<std::ptrdiff_t>(variable.size)
+                    );
+                }
+            }
+
+            if (session.samples.size() >= TargetControllerComponent::LIVE_SAMPLE_BUFFER_CAPACITY) {
+                session.samples.pop_front();
+                ++session.droppedSampleCount;
+            }
+
+            session.samples.emplace_back(std::move(sample));
+            ++session.nextSequenceNumber;
+            sampleCounter.increment();
+
+        } catch (const TargetOperationFailure& exception) {
+            Logger::error("Live sampling failed - " + exception.getMessage());
+            this->stopLiveSampling();
+        }
+    }
+
+    void TargetControllerComponent::stopLiveSampling() {
+        auto& session = this->liveSamplingSession;
+
+        if (!session.timerId.has_value()) {
+            return;
+        }
+
+        this->eventLoop.removeTimer(*session.timerId);
+        session.timerId = std::nullopt;
+
+        Logger::info("Live sampling stopped (" + std::to_string(session.nextSequenceNumber) + " samples taken)");
+    }
+
+    void TargetControllerComponent::recordMemoryChanges(Targets::TargetProgramCounter programCounter) {
+        if (!this->memoryChangeTimelineSession.has_value() || !this->memoryChangeTimelineSession->active) {
+            return;
+        }
+
+        auto& session = *(this->memoryChangeTimelineSession);
+
+        const auto traceSpan = Services::TraceService::Span("TargetControllerComponent::recordMemoryChanges", "TC");
+        static auto& changeCounter = Services::MetricsService::counter("targetController.memoryChanges");
+
+        try {
+            auto regionData = std::vector<TargetMemoryBuffer>();
+            regionData.reserve(session.timeline.getRegions().size());
+
+            for (const auto& region : session.timeline.getRegions()) {
+                if (region.size > TargetControllerComponent::MEMORY_OPERATION_CHUNK_SIZE) {
+                    /*
+                     * We don't want other commands to be serviced between chunks (see
+                     * TargetControllerComponent::readTargetMemoryInChunks()), as the stop hasn't been reported yet.
+                     */
+                    regionData.emplace_back(
+                        this->target->readMemory(region.memoryType, region.startAddress, region.size, {})
+                    );
+                    continue;
+                }
+
+                auto readCommand = ReadTargetMemory(region.memoryType, region.startAddress, region.size, {});
+                regionData.emplace_back(std::move(this->handleReadTargetMemory(readCommand)->data));
+            }
+
+            const auto changeCount = session.timeline.recordStop(
+                programCounter,
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - session.startTime
+                ),
+                std::move(regionData)
+            );
+
+            changeCounter.increment(changeCount);
+
+            if (session.timeline.isFull()) {
+                Logger::warning("Memory change timeline is full - no further changes will be recorded");
+                this->stopMemoryChangeTimeline();
+            }
+
+        } catch (const TargetOperationFailure& exception) {
+            Logger::error("Failed to record memory changes - " + exception.getMessage());
+            this->stopMemoryChangeTimeline();
+        }
+    }
+
+    void TargetControllerComponent::stopMemoryChangeTimeline() {
+        if (!this->memoryChangeTimelineSession.has_value() || !this->memoryChangeTimelineSession->active) {
+            return;
+        }
+
+        auto& session = *(this->memoryChangeTimelineSession);
+        session.active = false;
+
+        Logger::info(
+            "Memory change timeline stopped (" + std::to_string(session.timeline.getChanges().size())
+                + " changes recorded, over " + std::to_string(session.timeline.getStopCount()) + " stops)"
+        );
+    }
+
+    bool TargetControllerComponent::recordCoverageHit(Targets::TargetProgramCounter programCounter) {
+        auto& session = *(this->coverageSession);
+
+        const auto addressIt = std::lower_bound(session.addresses.begin(), session.addresses.end(), programCounter);
+        if (addressIt == session.addresses.end() || *addressIt != programCounter) {
+            return false;
+        }
+
+        session.hits[static_cast<std::size_t>(std::distance(session.addresses.begin(), addressIt))] = true;
+
+        if (!session.armedAddresses.contains(programCounter)) {
+            // Stopped at an instrumented address, but not at one of our breakpoints (a GDB breakpoint, for example)
+            return false;
+        }
+
+        session.armedAddresses.erase(programCounter);
+        this->breakpointManager.removeBreakpoint(programCounter);
+        this->armCoverageBreakpoints();
+
+        return true;
+    }
+
+    bool TargetControllerComponent::handleTimingBreak(Targets::TargetProgramCounter programCounter) {
+        auto& session = *(this->timingSession);
+        auto& results = session.results;
+
+        if (programCounter != results.startAddress && programCounter != results.endAddress) {
+            return false;
+        }
+
+        const auto hitTime = std::chrono::steady_clock::now();
+        const auto ownedAddress = session.ownedAddresses.contains(programCounter);
+
+        if (results.completed()) {
+            return false;
+        }
+
+        const auto timerValue = this->readTimingTimerValue();
+
+        if (programCounter == results.endAddress && session.intervalStartTime.has_value()) {
+            results.hostDurations.emplace_back(
+                std::chrono::duration_cast<std::chrono::microseconds>(hitTime - *(session.intervalStartTime))
+            );
+
+            if (timerValue.has_value() && session.intervalStartTimerValue.has_value()) {
+                const auto timerBits = results.timerRegister->size * 8;
+                const auto timerMask = timerBits >= 64
+                    ? ~std::uint64_t(0)
+                    : (std::uint64_t(1) << timerBits) - 1;
+
+                results.timerTickDurations.emplace_back((*timerValue - *(session.intervalStartTimerValue)) & timerMask);
+            }
+
+            session.intervalStartTime = std::nullopt;
+            session.intervalStartTimerValue = std::nullopt;
+
+            if (results.completed()) {
+                this->releaseTimingBreakpoints();
+                Logger::info("Timing analysis completed (" + std::to_string(results.iterationCount) + " iterations)");
+                EventManager::triggerEvent(Events::makeEvent<Events::TimingAnalysisCompleted>(results));
+            }
+        }
+
+        const auto intervalStarted = programCounter == results.startAddress;
+        if (intervalStarted) {
+            // A repeated hit at the start address (without an end address hit in between) restarts the interval
+            session.intervalStartTimerValue = timerValue;
+            session.intervalStartTime = hitTime;
+        }
+
+        if (!ownedAddress) {
+            // Another component's breakpoint - the stop must be reported
+            return false;
+        }
+
+        this->breakpointManager.commit(*this->target);
+        this->target->run();
+
+        if (intervalStarted) {
+            // The interval begins when the target resumes - not when we detected the halt
+            session.intervalStartTime = std::chrono::steady_clock::now();
+        }
+
+        return true;
+    }
+
+    std::optional<std::uint64_t> TargetControllerComponent::readTimingTimerValue() {
+        const auto& timerRegister = this->timingSession->results.timerRegister;
+        if (!timerRegister.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto data = this->target->readMemory(
+            timerRegister->memoryType,
+            timerRegister->address,
+            timerRegister->size
+        );
+
+        // AVR registers are little-endian
+        auto value = std::uint64_t(0);
+        for (auto byteIndex = data.size(); byteIndex > 0; --byteIndex) {
+            value = (value << 8) | data[byteIndex - 1];
+        }
+
+        return value;
+    }
+
+    void TargetControllerComponent::releaseTimingBreakpoints() {
+        auto& session = *(this->timingSession);
+
+        for (const auto address : session.ownedAddresses) {
+            this->breakpointManager.removeBreakpoint(address);
+        }
+
+        session.ownedAddresses.clear();
+    }
+
+    void TargetControllerComponent::armCoverageBreakpoints() {
+        auto& session = *(this->coverageSession);
+        const auto addressCount = session.addresses.size();
+
+        for (
+            auto scannedCount = std::size_t(0);
+            scannedCount < addressCount && session.armedAddresses.size() < session.batchSize;
+            ++scannedCount
+        ) {
+            const auto index = session.cursor;
+            session.cursor = (session.cursor + 1) % addressCount;
+
+            const auto address = session.addresses[index];
+            if (
+                session.hits[index]
+                || session.armedAddresses.contains(address)
+                || this->breakpointManager.isBreakpointSet(address)
+            ) {
+                continue;
             }
+
+            this->breakpointManager.addBreakpoint(address);
+            session.armedAddresses.insert(address);
+        }
+    }
+
+    void TargetControllerComponent::sweepCoverageBreakpoints() {
+        if (this->state != TargetControllerState::ACTIVE || this->activeStepRange.has_value()) {
+            return;
+        }
+
+        auto& session = *(this->coverageSession);
+
+        const auto unhitCount = static_cast<std::size_t>(
+            std::count(session.hits.begin(), session.hits.end(), false)
+        );
+
+        if (unhitCount <= session.armedAddresses.size()) {
+            // Every unhit address is already instrumented - there's nothing to swap in
+            return;
+        }
+
+        for (const auto address : session.armedAddresses) {
+            this->breakpointManager.removeBreakpoint(address);
+        }
+
+        session.armedAddresses.clear();
+        this->armCoverageBreakpoints();
+        ++session.sweepCount;
+
+        try {
+            this->applyBreakpointChanges();
+
+        } catch (const TargetOperationFailure& exception) {
+            Logger::error("Failed to sweep coverage breakpoints - " + exception.getMessage());
+        }
+    }
+
+    void TargetControllerComponent::applyBreakpointChanges() {
+        if (
+            this->lastTargetState != TargetState::RUNNING
+            || this->activeStepRange.has_value()
+            || this->target->getState() != TargetState::RUNNING
+        ) {
+            // If the target has stopped since the last poll, we leave it to fireTargetEvents() to handle the stop
+            return;
+        }
+
+        const auto traceSpan = Services::TraceService::Span(
+            "TargetControllerComponent::applyBreakpointChanges",
+            "TC"
+        );
+
+        this->target->stop();
+        this->breakpointManager.commit(*this->target);
+        this->target->run();
+    }
+
+    bool TargetControllerComponent::breakpointConditionsMet(TargetMemoryAddress address) {
+        const auto conditionsIt = this->breakpointConditionsByAddress.find(address);
+        if (conditionsIt == this->breakpointConditionsByAddress.end()) {
+            return true;
+        }
+
+        static auto& evaluationCount = Services::MetricsService::counter("targetController.breakpointConditions");
+        static auto& resumeCount = Services::MetricsService::counter("targetController.breakpointConditions.resumed");
+
+        evaluationCount.increment();
+
+        try {
+            auto descriptors = TargetRegisterDescriptors();
+
+            for (const auto& condition : conditionsIt->second) {
+                for (const auto registerNumber : condition.getReferencedRegisterNumbers()) {
+                    const auto descriptorIt = condition.registerDescriptorsByNumber.find(registerNumber);
+
+                    if (descriptorIt != condition.registerDescriptorsByNumber.end()) {
+                        descriptors.insert(descriptorIt->second);
+                    }
+                }
+            }
+
+            const auto registerValuesByDescriptor = this->readExpressionRegisters(descriptors);
+            const auto readRegister = [&registerValuesByDescriptor] (const TargetRegisterDescriptor& descriptor) {
+                const auto valueIt = registerValuesByDescriptor.find(descriptor);
+
+                if (valueIt == registerValuesByDescriptor.end()) {
+                    throw Exception("Target returned no value for register referenced in breakpoint condition");
+                }
+
+                return valueIt->second;
+            };
+
+            auto cachedBytes = std::map<std::pair<TargetMemoryType, TargetMemoryAddress>, unsigned char>();
+            const auto readMemory = this->createExpressionMemoryReader(cachedBytes);
+
+            for (const auto& condition : conditionsIt->second) {
+                if (condition.evaluate(readRegister, readMemory) != 0) {
+                    return true;
+                }
+            }
+
+            resumeCount.increment();
+            return false;
+
+        } catch (const Exception& exception) {
+            Logger::warning(
+                "Failed to evaluate breakpoint condition, at address " + std::to_string(address)
+                    + " - halting target. Error: " + exception.getMessage()
+            );
+            return true;
+        }
+    }
+
+    bool TargetControllerComponent::continueActiveStep() {
+        const auto programCounter = this->target->getProgramCounter();
+
+        if (this->activeStepReturnAddress.has_value()) {
+            if (programCounter != *this->activeStepReturnAddress) {
+                if (
+                    this->breakpointManager.isBreakpointSet(programCounter)
+                    && !this->breakpointConditionsMet(programCounter)
+                ) {
+                    // A conditional breakpoint within the callee, whose conditions weren't met
+                    this->breakpointManager.commit(*this->target);
+                    this->target->run(this->activeStepReturnAddress);
+                    return true;
+                }
+
+                // Something else halted the target within the callee (a breakpoint, for example) - the step ends here
+                this->endActiveStep();
+                return false;
+            }
+
+            if (this->target->getStackPointer() < *this->activeStepReturnStackPointer) {
+                // A recursive invocation reached the return address - the call we're stepping over hasn't returned
+                this->breakpointManager.commit(*this->target);
+                this->target->run(this->activeStepReturnAddress);
+                return true;
+            }
+
+            this->activeStepReturnAddress = std::nullopt;
+            this->activeStepReturnStackPointer = std::nullopt;
+        }
+
+        const auto breakpointHit = this->breakpointManager.isBreakpointSet(programCounter)
+            && this->breakpointConditionsMet(programCounter);
+
+        if (breakpointHit) {
+            this->endActiveStep();
+            return false;
+        }
+
+        if (this->activeStepRange->contains(programCounter)) {
+            // Still within the step range - keep stepping
+            this->breakpointManager.commit(*this->target);
+
+            if (!this->runOverCallInstruction(programCounter)) {
+                this->target->step();
+            }
+
+            return true;
+        }
+
+        if (const auto returnAddress = this->stepOverReturnAddress(programCounter)) {
+            this->activeStepReturnAddress = returnAddress;
+            this->breakpointManager.commit(*this->target);
+            this->target->run(returnAddress);
+            return true;
+        }
+
+        if (this->activeStepSourceLine) {
+            /*
+             * We've left the statement, but we've landed part way through another one (we've returned into the
+             * caller, for example). We keep stepping until we reach the beginning of a statement, as GDB would.
+             */
+            const auto lineTable = Services::SymbolService::lineTable();
+            const auto statementRange = lineTable != nullptr
+                ? lineTable->statementRangeAt(programCounter)
+                : std::nullopt;
+
+            if (statementRange.has_value() && statementRange->startAddress != programCounter) {
+                this->activeStepRange = statementRange;
+                this->activeStepStackPointer = this->target->getStackPointer();
+                this->target->step();
+                return true;
+            }
+        }
+
+        this->endActiveStep();
+        return false;
+    }
+
+    std::optional<TargetMemoryAddress> TargetControllerComponent::stepOverReturnAddress(
+        Targets::TargetProgramCounter programCounter
+    ) {
+        if (!this->activeStepStackPointer.has_value()) {
+            return std::nullopt;
+        }
+
+        if (!this->activeStepOverCalls) {
+            /*
+             * We only step over calls into code that isn't covered by the line table - GDB would step over those
+             * anyway. We can't tell what GDB would do without a line table, so we leave those to GDB.
+             */
+            const auto lineTable = Services::SymbolService::lineTable();
+            if (lineTable == nullptr || lineTable->contains(programCounter)) {
+                return std::nullopt;
+            }
+        }
+
+        const auto stackPointer = this->target->getStackPointer();
+        if (stackPointer >= *this->activeStepStackPointer) {
+            return std::nullopt;
+        }
+
+        // Targets with more than 128KiB of program memory have a 22-bit program counter, which takes 3 bytes
+        const auto& flashDescriptor = this->getTargetDescriptor().memoryDescriptorsByType.at(TargetMemoryType::FLASH);
+        const auto returnAddressSize = static_cast<TargetMemorySize>(flashDescriptor.size() > 0x20000 ? 3 : 2);
+
+        if (*this->activeStepStackPointer - stackPointer < returnAddressSize) {
+            return std::nullopt;
+        }
+
+        // The return address is pushed onto the stack as a word address, in big-endian byte order
+        const auto stackData = this->target->readMemory(TargetMemoryType::RAM, stackPointer + 1, returnAddressSize);
+
+        auto returnAddress = TargetMemoryAddress(0);
+        for (const auto byte : stackData) {
+            returnAddress = (returnAddress << 8) | byte;
+        }
+
+        returnAddress *= 2;
+
+        if (
+            returnAddress < this->activeStepRange->startAddress
+            || returnAddress > this->activeStepRange->endAddress + 1
+        ) {
+            // Not a call made from within the step range
+            return std::nullopt;
+        }
+
+        this->activeStepReturnStackPointer = stackPointer + returnAddressSize;
+        return returnAddress;
+    }
+
+    bool TargetControllerComponent::runOverCallInstruction(Targets::TargetProgramCounter programCounter) {
+        if (
+            !this->activeStepRange.has_value()
+            || !this->activeStepStackPointer.has_value()
+            || !this->activeStepRange->contains(programCounter)
+        ) {
+            return false;
+        }
+
+        const auto instruction = this->decodeInstruction(programCounter);
+        if (!instruction.has_value() || !instruction->isCall()) {
+            return false;
+        }
+
+        if (!this->activeStepOverCalls) {
+            // As with TargetControllerComponent::stepOverReturnAddress(), we only step over calls into code that
+            // isn't covered by the line table.
+            const auto lineTable = Services::SymbolService::lineTable();
+            if (
+                lineTable == nullptr
+                || !instruction->destinationAddress.has_value()
+                || lineTable->contains(*instruction->destinationAddress)
+            ) {
+                return false;
+            }
+        }
+
+        /*
+         * The call will push the return address onto the stack, and the callee will pop it upon return, so the stack
+         * pointer at the return address will be what it is now. See TargetControllerComponent::continueActiveStep().
+         */
+        const auto returnAddress = static_cast<TargetMemoryAddress>(programCounter + instruction->byteSize);
+        this->activeStepReturnAddress = returnAddress;
+        this->activeStepReturnStackPointer = this->target->getStackPointer();
+        this->target->run(returnAddress);
+        return true;
+    }
+
+    std::optional<Targets::Microchip::Avr::Avr8Bit::Instruction> TargetControllerComponent::decodeInstruction(
+        TargetMemoryAddress address
+    ) {
+        using Targets::Microchip::Avr::Avr8Bit::InstructionDecoder;
+
+        const auto& targetDescriptor = this->getTargetDescriptor();
+        const auto& programMemoryDescriptor = targetDescriptor.memoryDescriptorsByType.at(
+            targetDescriptor.programMemoryType
+        );
+
+        if (!programMemoryDescriptor.addressRange.contains(address)) {
+            return std::nullopt;
+        }
+
+        // Enough for the longest (two-word) instructions
+        const auto readCommand = ReadTargetMemory(
+            targetDescriptor.programMemoryType,
+            address,
+            std::min(TargetMemorySize(4), programMemoryDescriptor.addressRange.endAddress - address + 1),
+            {}
+        );
+
+        auto data = this->readProgramMemoryFromMirror(readCommand);
+        if (!data.has_value()) {
+            data = this->target->readMemory(readCommand.memoryType, readCommand.startAddress, readCommand.bytes, {});
+        }
+
+        return InstructionDecoder::decode(address, *data);
+    }
+
+    void TargetControllerComponent::endActiveStep() {
+        this->activeStepRange = std::nullopt;
+        this->activeStepSourceLine = false;
+        this->activeStepOverCalls = false;
+        this->activeStepStackPointer = std::nullopt;
+        this->activeStepReturnAddress = std::nullopt;
+        this->activeStepReturnStackPointer = std::nullopt;
+    }
+
+    bool TargetControllerComponent::recordTraceFrames(Targets::TargetProgramCounter programCounter) {
+        auto& session = this->traceSession;
+
+        const auto tracepointsIt = session.tracepointsByAddress.find(programCounter);
+        if (tracepointsIt == session.tracepointsByAddress.end()) {
+            return false;
+        }
+
+        // If tracing stops during this collection, the owned addresses will have been released by the time we return
+        const auto ownedAddress = session.ownedAddresses.contains(programCounter);
+
+        static auto& frameCount = Services::MetricsService::counter("targetController.traceFrames");
+
+        auto cachedBytes = std::map<std::pair<TargetMemoryType, TargetMemoryAddress>, unsigned char>();
+        const auto readMemory = this->createExpressionMemoryReader(cachedBytes);
+
+        auto registerValuesByDescriptor = std::optional<std::map<TargetRegisterDescriptor, TargetMemoryBuffer>>();
+
+        for (const auto& tracepoint : tracepointsIt->second) {
+            if (!session.running) {
+                break;
+            }
+
+            if (!tracepoint.enabled) {
+                continue;
+            }
+
+            try {
+                if (!registerValuesByDescriptor.has_value()) {
+                    // We read the registers for all tracepoints at this address, in one go
+                    auto descriptors = TargetRegisterDescriptors();
+
+                    const auto insertReferencedDescriptors = [&descriptors] (const AgentExpression& expression) {
+                        for (const auto registerNumber : expression.getReferencedRegisterNumbers()) {
+                            const auto descriptorIt = expression.registerDescriptorsByNumber.find(registerNumber);
+
+                            if (descriptorIt != expression.registerDescriptorsByNumber.end()) {
+                                descriptors.insert(descriptorIt->second);
+                            }
+                        }
+                    };
+
+                    for (const auto& addressTracepoint : tracepointsIt->second) {
+                        descriptors.insert(
+                            addressTracepoint.registerDescriptors.begin(),
+                            addressTracepoint.registerDescriptors.end()
+                        );
+
+                        if (addressTracepoint.condition.has_value()) {
+                            insertReferencedDescriptors(*(addressTracepoint.condition));
+                        }
+
+                        for (const auto& expression : addressTracepoint.collectionExpressions) {
+                            insertReferencedDescriptors(expression);
+                        }
+                    }
+
+                    registerValuesByDescriptor = this->readExpressionRegisters(descriptors);
+                }
+
+                const auto readRegister = [&registerValuesByDescriptor] (const TargetRegisterDescriptor& descriptor) {
+                    const auto valueIt = registerValuesByDescriptor->find(descriptor);
+
+                    if (valueIt == registerValuesByDescriptor->end()) {
+                        throw Exception("Target returned no value for register referenced in tracepoint action");
+                    }
+
+                    return valueIt->second;
+                };
+
+                if (
+                    tracepoint.condition.has_value()
+                    && tracepoint.condition->evaluate(readRegister, readMemory) == 0
+                ) {
+                    continue;
+                }
+
+                auto frame = TraceFrame(tracepoint.number, programCounter);
+
+                for (const auto& descriptor : tracepoint.registerDescriptors) {
+                    frame.registers.emplace_back(descriptor, readRegister(descriptor));
+                }
+
+                for (const auto& expression : tracepoint.collectionExpressions) {
+                    expression.evaluate(
+                        readRegister,
+                        readMemory,
+                        [&frame] (TargetMemoryAddress address, TargetMemoryBuffer&& data) {
+                            frame.memoryBlocks.emplace_back(address, std::move(data));
+                        }
+                    );
+                }
+
+                const auto frameSize = frame.size();
+                if (session.bufferUsed + frameSize > TargetControllerComponent::TRACE_BUFFER_SIZE) {
+                    Logger::warning("Trace buffer full - stopping trace experiment");
+                    this->stopTracing(TraceStopReason::BUFFER_FULL);
+                    break;
+                }
+
+                session.frames.emplace_back(std::move(frame));
+                session.bufferUsed += frameSize;
+                frameCount.increment();
+
+            } catch (const Exception& exception) {
+                Logger::warning(
+                    "Failed to collect trace frame for tracepoint " + std::to_string(tracepoint.number) + " - "
+                        + exception.getMessage()
+                );
+            }
+
+            auto& hitCount = session.hitCountsByTracepointNumber[tracepoint.number];
+            ++hitCount;
+
+            if (tracepoint.passCount > 0 && hitCount >= tracepoint.passCount) {
+                Logger::info(
+                    "Tracepoint " + std::to_string(tracepoint.number) + " reached its pass count - stopping trace "
+                        "experiment"
+                );
+                this->stopTracing(TraceStopReason::PASS_COUNT, tracepoint.number);
+            }
+        }
+
+        return ownedAddress;
+    }
+
+    void TargetControllerComponent::stopTracing(TraceStopReason stopReason, std::uint32_t tracepointNumber) {
+        auto& session = this->traceSession;
+
+        for (const auto address : session.ownedAddresses) {
+            this->breakpointManager.removeBreakpoint(address);
+        }
+
+        session.ownedAddresses.clear();
+        session.running = false;
+        session.stopReason = stopReason;
+        session.stopTracepointNumber = tracepointNumber;
+    }
+
+    std::map<TargetRegisterDescriptor, TargetMemoryBuffer> TargetControllerComponent::readExpressionRegisters(
+        const TargetRegisterDescriptors& descriptors
+    ) {
+        auto output = std::map<TargetRegisterDescriptor, TargetMemoryBuffer>();
+
+        if (!descriptors.empty()) {
+            for (auto& reg : this->target->readRegisters(descriptors)) {
+                output.insert(std::pair(reg.descriptor, std::move(reg.value)));
+            }
+        }
+
+        return output;
+    }
+
+    AgentExpression::MemoryReader TargetControllerComponent::createExpressionMemoryReader(
+        std::map<std::pair<TargetMemoryType, TargetMemoryAddress>, unsigned char>& cachedBytes
+    ) {
+        return [this, &cachedBytes] (
+            TargetMemoryType memoryType,
+            TargetMemoryAddress startAddress,
+            TargetMemorySize bytes
+        ) {
+            auto buffer = TargetMemoryBuffer();
+            buffer.reserve(bytes);
+
+            for (auto address = startAddress; address < startAddress + bytes; ++address) {
+                const auto byteIt = cachedBytes.find(std::pair(memoryType, address));
+
+                if (byteIt == cachedBytes.end()) {
+                    buffer = this->target->readMemory(memoryType, startAddress, bytes, {});
+
+                    for (auto i = TargetMemorySize(0); i < buffer.size(); ++i) {
+                        cachedBytes[std::pair(memoryType, startAddress + i)] = buffer[i];
+                    }
+
+                    return buffer;
+                }
+
+                buffer.push_back(byteIt->second);
+            }
+
+            return buffer;
+        };
+    }
+
+    void TargetControllerComponent::captureStopSnapshot() {
+        this->invalidateStopSnapshot();
+
+        if (!this->environmentConfig.targetConfig.stopPrefetch) {
+            return;
+        }
+
+        try {
+            const auto& targetDescriptor = this->getTargetDescriptor();
+            auto descriptors = TargetRegisterDescriptors();
+
+            for (const auto registerType : {
+                TargetRegisterType::GENERAL_PURPOSE_REGISTER,
+                TargetRegisterType::STATUS_REGISTER,
+                TargetRegisterType::STACK_POINTER,
+                TargetRegisterType::PROGRAM_COUNTER,
+            }) {
+                const auto registerDescriptorsIt = targetDescriptor.registerDescriptorsByType.find(registerType);
+
+                if (registerDescriptorsIt != targetDescriptor.registerDescriptorsByType.end()) {
+                    descriptors.insert(registerDescriptorsIt->second.begin(), registerDescriptorsIt->second.end());
+                }
+            }
+
+            auto snapshot = StopSnapshot();
+
+            for (auto& reg : this->target->readRegisters(descriptors)) {
+                /*
+                 * Register values are in MSB form. We extract the stack pointer and program counter here, to save
+                 * us from having to read them again.
+                 */
+                if (
+                    reg.descriptor.type == TargetRegisterType::STACK_POINTER
+                    || reg.descriptor.type == TargetRegisterType::PROGRAM_COUNTER
+                ) {
+                    auto value = TargetMemoryAddress(0);
+                    for (const auto& byte : reg.value) {
+                        value = (value << 8) | byte;
+                    }
+
+                    if (reg.descriptor.type == TargetRegisterType::STACK_POINTER) {
+                        snapshot.stackPointer = value;
+
+                    } else {
+                        snapshot.programCounter = value;
+                    }
+                }
+
+                snapshot.registerValuesByDescriptor.insert(std::pair(reg.descriptor, std::move(reg.value)));
+            }
+
+            const auto ramDescriptorIt = targetDescriptor.memoryDescriptorsByType.find(TargetMemoryType::RAM);
+            const auto stackSize = this->environmentConfig.targetConfig.stopPrefetchStackSize;
+
+            if (
+                snapshot.stackPointer.has_value()
+                && stackSize > 0
+                && ramDescriptorIt != targetDescriptor.memoryDescriptorsByType.end()
+            ) {
+                const auto& ramAddressRange = ramDescriptorIt->second.addressRange;
+
+                /*
+                 * The stack grows downwards, and the stack pointer points to the next free byte, so the top of the
+                 * stack is the byte that proceeds the stack pointer.
+                 */
+                const auto windowStartAddress = *(snapshot.stackPointer) + 1;
+
+                if (
+                    windowStartAddress >= ramAddressRange.startAddress
+                    && windowStartAddress <= ramAddressRange.endAddress
+                ) {
+                    const auto windowSize = std::min(
+                        static_cast<TargetMemorySize>(stackSize),
+                        (ramAddressRange.endAddress - windowStartAddress) + 1
+                    );
+
+                    snapshot.stackWindowStartAddress = windowStartAddress;
+                    snapshot.stackWindow = this->target->readMemory(
+                        TargetMemoryType::RAM,
+                        windowStartAddress,
+                        windowSize,
+                        {}
+                    );
+                }
+            }
+
+            this->stopSnapshot = std::move(snapshot);
+
+        } catch (const Exception& exception) {
+            Logger::debug("Failed to capture stop snapshot - " + exception.getMessage());
+            this->invalidateStopSnapshot();
+        }
+    }
+
+    std::optional<TargetRegisters> TargetControllerComponent::readRegistersFromStopSnapshot(
+        const TargetRegisterDescriptors& descriptors
+    ) {
+        if (!this->stopSnapshot.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto& registerValuesByDescriptor = this->stopSnapshot->registerValuesByDescriptor;
+        auto output = TargetRegisters();
+        output.reserve(descriptors.size());
+
+        for (const auto& descriptor : descriptors) {
+            const auto registerValueIt = registerValuesByDescriptor.find(descriptor);
+
+            if (registerValueIt == registerValuesByDescriptor.end()) {
+                return std::nullopt;
+            }
+
+            output.emplace_back(descriptor, registerValueIt->second);
+        }
+
+        return output;
+    }
+
+    std::optional<TargetMemoryBuffer> TargetControllerComponent::readProgramMemoryFromMirror(
+        const ReadTargetMemory& command
+    ) {
+        const auto& targetDescriptor = this->getTargetDescriptor();
+
+        if (
+            !this->environmentConfig.targetConfig.programMemoryMirror
+            || command.memoryType != targetDescriptor.programMemoryType
+            || !command.excludedAddressRanges.empty()
+        ) {
+            return std::nullopt;
+        }
+
+        if (!this->programMemoryContents.has_value()) {
+            this->programMemoryContents.emplace(targetDescriptor.memoryDescriptorsByType.at(command.memoryType));
+        }
+
+        auto& programMemoryContents = *(this->programMemoryContents);
+
+        if (!programMemoryContents.covers(command.startAddress, command.bytes)) {
+            return std::nullopt;
+        }
+
+        /*
+         * Large reads of pages that we haven't seen before are left to the usual route, for the same reason that
+         * they bypass the memory caches (see TargetControllerComponent::handleReadTargetMemory()).
+         */
+        if (
+            command.bytes > TargetControllerComponent::MEMORY_OPERATION_CHUNK_SIZE
+            && !programMemoryContents.contains(command.startAddress, command.bytes)
+        ) {
+            return std::nullopt;
+        }
+
+        const auto missCount = programMemoryContents.getMissCount();
+
+        auto buffer = programMemoryContents.fetch(
+            command.startAddress,
+            command.bytes,
+            [this, &command] (TargetMemoryAddress startAddress, TargetMemorySize bytes) {
+                return this->target->readMemory(command.memoryType, startAddress, bytes, {});
+            }
+        );
+
+        Services::MetricsService::counter(
+            std::string("targetController.programMemoryMirror")
+                + (programMemoryContents.getMissCount() == missCount ? ".hits" : ".misses")
+        ).increment();
+
+        if (this->environmentConfig.targetConfig.verifyProgramMemoryMirror) {
+            auto targetBuffer = this->readTargetMemoryInChunks(command);
+
+            if (targetBuffer != buffer) {
+                Logger::warning(
+                    "Program memory mirror mismatch in " + std::to_string(command.bytes) + " byte read at address "
+                        + std::to_string(command.startAddress) + " - correcting mirror"
+                );
+
+                programMemoryContents.store(command.startAddress, targetBuffer);
+                return targetBuffer;
+            }
+        }
+
+        return buffer;
+    }
+
+    std::optional<TargetMemoryBuffer> TargetControllerComponent::readMemoryFromStopSnapshot(
+        const ReadTargetMemory& command
+    ) {
+        if (
+            !this->stopSnapshot.has_value()
+            || command.memoryType != TargetMemoryType::RAM
+            || !command.excludedAddressRanges.empty()
+            || command.bytes == 0
+        ) {
+            return std::nullopt;
+        }
+
+        const auto& snapshot = *(this->stopSnapshot);
+        const auto windowEndAddress = snapshot.stackWindowStartAddress + snapshot.stackWindow.size();
+
+        if (
+            command.startAddress < snapshot.stackWindowStartAddress
+            || (command.startAddress + command.bytes) > windowEndAddress
+        ) {
+            return std::nullopt;
+        }
+
+        const auto beginIt = snapshot.stackWindow.begin() + (command.startAddress - snapshot.stackWindowStartAddress);
+        return TargetMemoryBuffer(beginIt, beginIt + command.bytes);
+    }
+
+    void TargetControllerComponent::invalidateMemoryCaches() {
+        for (auto& [memoryType, memoryCache] : this->memoryCachesByType) {
+            memoryCache.invalidate();
+        }
+    }
+
+    void TargetControllerComponent::invalidateProgramMemoryContents() {
+        if (this->environmentConfig.targetConfig.programMemoryMirror || !this->programMemoryContents.has_value()) {
+            return;
+        }
+
+        this->programMemoryContents->invalidate();
+    }
+
+    void TargetControllerComponent::invalidateMemoryCache(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes
+    ) {
+        const auto memoryCacheIt = this->memoryCachesByType.find(memoryType);
+
+        if (memoryCacheIt != this->memoryCachesByType.end()) {
+            memoryCacheIt->second.invalidate(startAddress, bytes);
+        }
+    }
+
+    void TargetControllerComponent::logMemoryCacheStatistics() {
+        for (const auto& [memoryType, memoryCache] : this->memoryCachesByType) {
+            Logger::debug(
+                "Memory cache statistics (" + TargetControllerComponent::getMemoryTypeName(memoryType) + ") - "
+                    + std::to_string(memoryCache.getHitCount()) + " hit(s), "
+                    + std::to_string(memoryCache.getMissCount()) + " miss(es)"
+            );
+        }
+
+        if (this->programMemoryContents.has_value()) {
+            Logger::debug(
+                "Program memory mirror statistics - " + std::to_string(this->programMemoryContents->getHitCount())
+                    + " hit(s), " + std::to_string(this->programMemoryContents->getMissCount()) + " miss(es)"
+            );
+        }
+    }
+
+    bool TargetControllerComponent::memoryWriteCombinable(const WriteTargetMemory& command) {
+        if (
+            !this->environmentConfig.targetConfig.memoryWriteCombining
+            || this->lastTargetState != TargetState::STOPPED
+            || (command.memoryType != TargetMemoryType::RAM && command.memoryType != TargetMemoryType::EEPROM)
+            || command.buffer.empty()
+            || command.buffer.size() > TargetControllerComponent::MEMORY_WRITE_COMBINING_LIMIT
+        ) {
+            return false;
+        }
+
+        const auto& memoryDescriptorsByType = this->getTargetDescriptor().memoryDescriptorsByType;
+        const auto memoryDescriptorIt = memoryDescriptorsByType.find(command.memoryType);
+        if (memoryDescriptorIt == memoryDescriptorsByType.end()) {
+            return false;
+        }
+
+        // Writes that touch anything outside of the memory (such as memory-mapped I/O registers) go straight through
+        const auto writeRange = TargetMemoryAddressRange(
+            command.startAddress,
+            command.startAddress + static_cast<TargetMemorySize>(command.buffer.size()) - 1
+        );
+
+        if (
+            writeRange.endAddress < writeRange.startAddress
+            || !memoryDescriptorIt->second.addressRange.contains(writeRange)
+        ) {
+            return false;
+        }
+
+        const auto writeBufferIt = this->memoryWriteBuffersByType.find(command.memoryType);
+        return writeBufferIt == this->memoryWriteBuffersByType.end()
+            || !writeBufferIt->second.intersects(
+                command.startAddress,
+                static_cast<TargetMemorySize>(command.buffer.size())
+            );
+    }
+
+    bool TargetControllerComponent::memoryWriteFlushRequired(const Command& command) {
+        if (this->memoryWriteBuffersByType.empty()) {
+            return false;
+        }
+
+        switch (command.getType()) {
+            case CommandType::WRITE_TARGET_MEMORY: {
+                return !this->memoryWriteCombinable(static_cast<const WriteTargetMemory&>(command));
+            }
+            case CommandType::READ_TARGET_MEMORY: {
+                const auto& readCommand = static_cast<const ReadTargetMemory&>(command);
+                const auto writeBufferIt = this->memoryWriteBuffersByType.find(readCommand.memoryType);
+
+                return writeBufferIt != this->memoryWriteBuffersByType.end()
+                    && writeBufferIt->second.intersects(readCommand.startAddress, readCommand.bytes);
+            }
+            case CommandType::GET_STATE:
+            case CommandType::GET_TARGET_STATE:
+            case CommandType::GET_TARGET_DESCRIPTOR: {
+                return false;
+            }
+            default: {
+                return true;
+            }
+        }
+    }
+
+    bool TargetControllerComponent::pendingTargetResetRequired(const Command& command) {
+        switch (command.getType()) {
+            case CommandType::READ_TARGET_MEMORY: {
+                // A reset has no effect on the content of program memory
+                return static_cast<const ReadTargetMemory&>(command).memoryType
+                    != this->getTargetDescriptor().programMemoryType;
+            }
+            case CommandType::GET_TARGET_PROGRAM_COUNTER: {
+                return !this->pendingResetProgramCounter.has_value();
+            }
+            case CommandType::RESET_TARGET:
+            case CommandType::SET_TARGET_PROGRAM_COUNTER:
+            case CommandType::SET_BREAKPOINT:
+            case CommandType::REMOVE_BREAKPOINT:
+            case CommandType::SET_WATCHPOINT:
+            case CommandType::REMOVE_WATCHPOINT:
+            case CommandType::GET_STATE:
+            case CommandType::GET_TARGET_STATE:
+            case CommandType::GET_TARGET_DESCRIPTOR: {
+                return false;
+            }
+            default: {
+                return true;
+            }
+        }
+    }
+
+    void TargetControllerComponent::performPendingTargetReset() {
+        Logger::debug("Performing deferred target reset");
+
+        const auto programCounter = this->pendingResetProgramCounter;
+        this->resetTarget();
+
+        if (programCounter.has_value()) {
+            this->target->setProgramCounter(*programCounter);
+        }
+    }
+
+    void TargetControllerComponent::flushMemoryWriteBuffers() {
+        auto writeBuffersByType = std::exchange(this->memoryWriteBuffersByType, {});
+
+        try {
+            for (auto& [memoryType, writeBuffer] : writeBuffersByType) {
+                Services::MetricsService::counter(
+                    "targetController.memoryWritesCombined." + TargetControllerComponent::getMemoryTypeName(memoryType)
+                ).increment(writeBuffer.getMergeCount());
+
+                for (const auto& [startAddress, buffer] : writeBuffer.take()) {
+                    this->writeTargetMemory(WriteTargetMemory(memoryType, startAddress, buffer));
+                }
+            }
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to flush buffered memory writes - " + exception.getMessage());
+            throw;
+        }
+    }
+
+    const std::string& TargetControllerComponent::getMemoryTypeName(TargetMemoryType memoryType) {
+        static const auto memoryTypeNames = std::map<TargetMemoryType, std::string>({
+            {TargetMemoryType::FLASH, "FLASH"},
+            {TargetMemoryType::RAM, "RAM"},
+            {TargetMemoryType::EEPROM, "EEPROM"},
+            {TargetMemoryType::FUSES, "FUSES"},
+            {TargetMemoryType::OTHER, "OTHER"},
+        });
+
+        return memoryTypeNames.at(memoryType);
+    }
+
+    TargetMemoryBuffer TargetControllerComponent::readTargetMemoryInChunks(const ReadTargetMemory& command) {
+        if (command.bytes <= TargetControllerComponent::MEMORY_OPERATION_CHUNK_SIZE) {
+            return this->target->readMemory(
+                command.memoryType,
+                command.startAddress,
+                command.bytes,
+                command.excludedAddressRanges
+            );
+        }
+
+        auto output = TargetMemoryBuffer();
+        output.reserve(command.bytes);
+
+        this->cancellationRequestedByCommandId.insert(std::pair(command.id, false));
+
+        try {
+            while (output.size() < command.bytes) {
+                const auto chunkSize = std::min(
+                    TargetControllerComponent::MEMORY_OPERATION_CHUNK_SIZE,
+                    static_cast<TargetMemorySize>(command.bytes - output.size())
+                );
+
+                const auto chunk = this->target->readMemory(
+                    command.memoryType,
+                    command.startAddress + static_cast<TargetMemoryAddress>(output.size()),
+                    chunkSize,
+                    command.excludedAddressRanges
+                );
+
+                output.insert(output.end(), chunk.begin(), chunk.end());
+
+                if (command.progressCallback) {
+                    command.progressCallback(static_cast<TargetMemorySize>(output.size()));
+                }
+
+                if (output.size() < command.bytes) {
+                    this->completeMemoryOperationChunk(
+                        command,
+                        command.memoryType,
+                        static_cast<TargetMemorySize>(output.size()),
+                        command.bytes
+                    );
+                }
+            }
+
+        } catch (...) {
+            this->cancellationRequestedByCommandId.erase(command.id);
+            throw;
+        }
+
+        this->cancellationRequestedByCommandId.erase(command.id);
+        return output;
+    }
+
+    void TargetControllerComponent::writeTargetMemoryInChunks(
+        const WriteTargetMemory& command,
+        TargetMemoryAddress startAddress,
+        const TargetMemoryBuffer& buffer
+    ) {
+        const auto bufferSize = static_cast<TargetMemorySize>(buffer.size());
+
+        if (bufferSize <= TargetControllerComponent::MEMORY_OPERATION_CHUNK_SIZE) {
+            this->target->writeMemory(command.memoryType, startAddress, buffer);
+            return;
+        }
+
+        this->cancellationRequestedByCommandId.insert(std::pair(command.id, false));
+
+        try {
+            auto bytesWritten = TargetMemorySize(0);
+
+            while (bytesWritten < bufferSize) {
+                const auto chunkSize = std::min(
+                    TargetControllerComponent::MEMORY_OPERATION_CHUNK_SIZE,
+                    bufferSize - bytesWritten
+                );
+
+                this->target->writeMemory(
+                    command.memoryType,
+                    startAddress + bytesWritten,
+                    TargetMemoryBuffer(
+                        buffer.begin() + bytesWritten,
+                        buffer.begin() + bytesWritten + chunkSize
+                    )
+                );
+
+                bytesWritten += chunkSize;
+
+                if (bytesWritten < bufferSize) {
+                    this->completeMemoryOperationChunk(command, command.memoryType, bytesWritten, bufferSize);
+                }
+            }
+
+        } catch (...) {
+            this->cancellationRequestedByCommandId.erase(command.id);
+            throw;
+        }
+
+        this->cancellationRequestedByCommandId.erase(command.id);
+    }
+
+    void TargetControllerComponent::writeProgramMemory(const WriteTargetMemory& command) {
+        const auto& buffer = command.buffer;
+        const auto bufferSize = static_cast<TargetMemorySize>(buffer.size());
+
+        if (!this->programMemoryContents.has_value()) {
+            this->programMemoryContents.emplace(
+                this->getTargetDescriptor().memoryDescriptorsByType.at(command.memoryType)
+            );
+        }
+
+        auto& programMemoryContents = *(this->programMemoryContents);
+
+        if (bufferSize == 0 || !programMemoryContents.covers(command.startAddress, bufferSize)) {
+            this->checkpoint = std::nullopt;
+            this->writeTargetMemoryInChunks(command, command.startAddress, buffer);
+            return;
+        }
+
+        /*
+         * Obtain the current content of the affected pages. Any pages that we haven't seen before are read from the
+         * target. Reading is much cheaper than erasing and writing, so this is well worth it.
+         *
+         * The read is performed under the ID of the write command, so that it can be cancelled in the same way.
+         */
+        const auto currentContent = programMemoryContents.fetch(
+            command.startAddress,
+            bufferSize,
+            [this, &command] (TargetMemoryAddress startAddress, TargetMemorySize bytes) {
+                auto readCommand = ReadTargetMemory(command.memoryType, startAddress, bytes, {});
+                readCommand.id = command.id;
+                return this->readTargetMemoryInChunks(readCommand);
+            }
+        );
+
+        // Collect the runs of consecutive pages that need to be written
+        const auto pageSize = programMemoryContents.getPageSize();
+        auto changedRanges = std::vector<std::pair<TargetMemorySize, TargetMemorySize>>();
+        auto changedPageCount = std::size_t(0);
+        auto totalPageCount = std::size_t(0);
+
+        // Whether all of the changed pages are currently in their erased state (all 0xFF)
+        auto changedPagesErased = true;
+
+        auto offset = TargetMemorySize(0);
+        while (offset < bufferSize) {
+            const auto pageEndOffset = std::min(
+                static_cast<TargetMemorySize>(
+                    ((command.startAddress + offset) / pageSize + 1) * pageSize - command.startAddress
+                ),
+                bufferSize
+            );
+
+            ++totalPageCount;
+
+            if (!std::equal(
+                buffer.begin() + offset,
+                buffer.begin() + pageEndOffset,
+                currentContent.begin() + offset
+            )) {
+                ++changedPageCount;
+
+                changedPagesErased = changedPagesErased && std::all_of(
+                    currentContent.begin() + offset,
+                    currentContent.begin() + pageEndOffset,
+                    [] (unsigned char byte) {
+                        return byte == 0xFF;
+                    }
+                );
+
+                if (!changedRanges.empty() && changedRanges.back().second == offset) {
+                    changedRanges.back().second = pageEndOffset;
+
+                } else {
+                    changedRanges.emplace_back(offset, pageEndOffset);
+                }
+            }
+
+            offset = pageEndOffset;
+        }
+
+        if (changedRanges.empty()) {
+            Logger::info("Program memory is already up to date - nothing to write");
+            return;
+        }
+
+        this->checkpoint = std::nullopt;
+
+        /*
+         * Pages that are already in their erased state can be written without erasing them first, so we only need
+         * to erase the program memory if one of the changed pages holds something else. This allows for the program
+         * memory to be written in separate parts (e.g. an application and a bootloader), with a single erase.
+         */
+        if (!this->target->programMemoryPageRewritesSupported() && !changedPagesErased) {
+            Logger::info(
+                std::to_string(changedPageCount) + " of " + std::to_string(totalPageCount) + " page(s) have "
+                    + "changed - erasing and rewriting program memory"
+            );
+
+            this->eraseAndWriteProgramMemory(command);
+            return;
+        }
+
+        Logger::info(
+            "Writing " + std::to_string(changedPageCount) + " of " + std::to_string(totalPageCount)
+                + " page(s) - all other pages are unchanged"
+        );
+
+        try {
+            for (const auto& [rangeStartOffset, rangeEndOffset] : changedRanges) {
+                const auto rangeBuffer = TargetMemoryBuffer(
+                    buffer.begin() + rangeStartOffset,
+                    buffer.begin() + rangeEndOffset
+                );
+
+                this->writeTargetMemoryInChunks(command, command.startAddress + rangeStartOffset, rangeBuffer);
+                programMemoryContents.store(command.startAddress + rangeStartOffset, rangeBuffer);
+            }
+
+        } catch (const Exception& exception) {
+            /*
+             * Some targets can only determine whether page rewrites are supported by attempting one (see
+             * EdbgAvr8Interface::eraseAndWriteFlashPage()). If the target has withdrawn its support, the failed
+             * attempt was the first rewrite, so nothing has been written yet and we can fall back to erasing the
+             * program memory.
+             */
+            if (this->target->programMemoryPageRewritesSupported()) {
+                throw;
+            }
+
+            Logger::warning(
+                "Failed to rewrite program memory pages (" + exception.getMessage() + ") - erasing and rewriting "
+                    "program memory instead"
+            );
+
+            this->eraseAndWriteProgramMemory(command);
+        }
+    }
+
+    void TargetControllerComponent::eraseAndWriteProgramMemory(const WriteTargetMemory& command) {
+        const auto& buffer = command.buffer;
+        const auto bufferSize = static_cast<TargetMemorySize>(buffer.size());
+        auto& programMemoryContents = *(this->programMemoryContents);
+        const auto pageSize = programMemoryContents.getPageSize();
+
+        this->target->eraseMemory(command.memoryType);
+        programMemoryContents.invalidate();
+
+        /*
+         * Following the erase, every page is in its erased state (all 0xFF), so we only need to write the pages
+         * that contain something else.
+         */
+        auto pageOffset = TargetMemorySize(0);
+        auto rangeStartOffset = std::optional<TargetMemorySize>();
+
+        while (pageOffset < bufferSize) {
+            const auto pageEndOffset = std::min(
+                static_cast<TargetMemorySize>(
+                    ((command.startAddress + pageOffset) / pageSize + 1) * pageSize - command.startAddress
+                ),
+                bufferSize
+            );
+
+            const auto pageErased = std::all_of(
+                buffer.begin() + pageOffset,
+                buffer.begin() + pageEndOffset,
+                [] (unsigned char byte) {
+                    return byte == 0xFF;
+                }
+            );
+
+            if (!pageErased && !rangeStartOffset.has_value()) {
+                rangeStartOffset = pageOffset;
+            }
+
+            if (rangeStartOffset.has_value() && (pageErased || pageEndOffset == bufferSize)) {
+                const auto rangeEndOffset = pageErased ? pageOffset : pageEndOffset;
+
+                this->writeTargetMemoryInChunks(
+                    command,
+                    command.startAddress + *rangeStartOffset,
+                    TargetMemoryBuffer(buffer.begin() + *rangeStartOffset, buffer.begin() + rangeEndOffset)
+                );
+
+                rangeStartOffset = std::nullopt;
+            }
+
+            pageOffset = pageEndOffset;
+        }
+
+        programMemoryContents.store(command.startAddress, buffer);
+    }
+
+    void TargetControllerComponent::completeMemoryOperationChunk(
+        const Command& command,
+        TargetMemoryType memoryType,
+        TargetMemorySize bytesCompleted,
+        TargetMemorySize bytesTotal
+    ) {
+        if (command.operationProgressCallback) {
+            command.operationProgressCallback(bytesCompleted, bytesTotal);
+        }
+
+        if (EventManager::isEventTypeListenedFor(Events::TargetMemoryOperationProgress::type)) {
+            EventManager::triggerEvent(Events::makeEvent<Events::TargetMemoryOperationProgress>(
+                command.id,
+                memoryType,
+                bytesCompleted,
+                bytesTotal
+            ));
+        }
+
+        if (command.priority != CommandPriority::REALTIME) {
+            this->processPendingCommands(command.priority);
+        }
+
+        if (this->cancellationRequestedByCommandId.at(command.id)) {
+            throw Exception("Command cancelled.");
+        }
+
+        /*
+         * The commands that we've just processed may have changed the state of the target, in which case we cannot
+         * continue with the operation.
+         */
+        if (this->state != TargetControllerState::ACTIVE) {
+            throw Exception("Operation aborted - TargetController no longer in active state.");
+        }
+
+        if (command.requiresStoppedTargetState() && this->lastTargetState != TargetState::STOPPED) {
+            throw Exception("Operation aborted - target execution resumed.");
+        }
+
+        if (command.requiresDebugMode() && this->target->programmingModeEnabled()) {
+            throw Exception("Operation aborted - programming mode enabled.");
+        }
+    }
+
+    void TargetControllerComponent::resetTarget() {
+        this->targetResetPending = false;
+        this->pendingResetProgramCounter = std::nullopt;
+
+        this->endActiveStep();
+        this->invalidateStopSnapshot();
+        this->invalidateMemoryCaches();
+        this->target->reset();
+
+        EventManager::triggerEvent(Events::makeEvent<Events::TargetReset>());
+    }
+
+    void TargetControllerComponent::enableProgrammingMode() {
+        Logger::debug("Enabling programming mode");
+        this->invalidateStopSnapshot();
+        this->invalidateMemoryCaches();
+        this->target->enableProgrammingMode();
+        Logger::warning("Programming mode enabled");
+
+        EventManager::triggerEvent(Events::makeEvent<Events::ProgrammingModeEnabled>());
+    }
+
+    void TargetControllerComponent::disableProgrammingMode() {
+        Logger::debug("Disabling programming mode");
+        this->target->disableProgrammingMode();
+        Logger::info("Programming mode disabled");
+
+        EventManager::triggerEvent(Events::makeEvent<Events::ProgrammingModeDisabled>());
+    }
+
+    const Targets::TargetDescriptor& TargetControllerComponent::getTargetDescriptor() {
+        if (this->cachedTargetDescriptor == nullptr) {
+            this->cachedTargetDescriptor = std::make_shared<const Targets::TargetDescriptor>(
+                this->target->getDescriptor()
+            );
+            this->cachedTargetDescriptorIncludesVariants = false;
+            this->publishTargetDescriptor();
+        }
+
+        return *this->cachedTargetDescriptor;
+    }
+
+    void TargetControllerComponent::publishTargetDescriptor() {
+        this->publishedTargetDescriptor.setValue(PublishedTargetDescriptor{
+            .descriptor = this->cachedTargetDescriptor,
+            .includesVariants = this->cachedTargetDescriptorIncludesVariants,
+        });
+    }
+
+    void TargetControllerComponent::onShutdownTargetControllerEvent(const Events::ShutdownTargetController&) {
+        this->shutdown();
+    }
+
+    void TargetControllerComponent::onDebugSessionStartedEvent(const Events::DebugSessionStarted&) {
+        if (this->debugSessionLingerTimerId.has_value()) {
+            Logger::info("Debug client reconnected within the session linger period");
+            this->cancelDebugSessionLinger();
+        }
+
+        if (TargetControllerComponent::state == TargetControllerState::SUSPENDED) {
+            Logger::debug("Waking TargetController");
+
+            this->resume();
+            this->fireTargetEvents();
+        }
+    }
+
+    void TargetControllerComponent::onDebugSessionFinishedEvent(const DebugSessionFinished&) {
+        try {
+            this->flushMemoryWriteBuffers();
+
+        } catch (const Exception& exception) {
+            Logger::error("Discarding buffered memory writes - " + exception.getMessage());
+        }
+
+        const auto lingerPeriod = this->environmentConfig.debugServerConfig.has_value()
+            ? this->environmentConfig.debugServerConfig->sessionLingerPeriod
+            : std::uint32_t(0);
+
+        if (lingerPeriod == 0) {
+            this->finaliseDebugSession();
+            return;
+        }
+
+        /*
+         * Hold on to the target, as it is, for the linger period. If a client reconnects within the period, it can
+         * carry on from where the previous session left off, without us going through the whole activation again.
+         */
+        Logger::info("Debug session ended - holding target for " + std::to_string(lingerPeriod) + "ms");
+
+        this->cancelDebugSessionLinger();
+        this->debugSessionLingerTimerId = this->eventLoop.addTimer(
+            std::chrono::milliseconds(lingerPeriod),
+            [this] {
+                this->debugSessionLingerTimerId = std::nullopt;
+
+                if (this->state != TargetControllerState::ACTIVE) {
+                    return;
+                }
+
+                Logger::debug("Debug session linger period expired");
+
+                try {
+                    this->finaliseDebugSession();
+
+                } catch (const std::exception& exception) {
+                    Logger::error("Failed to finalise debug session - " + std::string(exception.what()));
+                }
+            }
+        );
+    }
+
+    void TargetControllerComponent::finaliseDebugSession() {
+        if (this->targetResetPending) {
+            this->performPendingTargetReset();
+        }
+
+        if (this->target->getState() != TargetState::RUNNING) {
+            // The client may have removed its breakpoints before ending the session
+            this->breakpointManager.commit(*this->target);
+            this->target->run();
+            this->fireTargetEvents();
+        }
+
+        if (this->environmentConfig.debugToolConfig.releasePostDebugSession) {
+            this->suspend();
+        }
+    }
+
+    void TargetControllerComponent::cancelDebugSessionLinger() {
+        if (this->debugSessionLingerTimerId.has_value()) {
+            this->eventLoop.removeTimer(*(this->debugSessionLingerTimerId));
+            this->debugSessionLingerTimerId = std::nullopt;
+        }
+    }
+
+    std::unique_ptr<Responses::State> TargetControllerComponent::handleGetState(GetState& command) {
+        return std::make_unique<Responses::State>(this->state);
+    }
+
+    std::unique_ptr<Responses::Response> TargetControllerComponent::handleResume(Resume& command) {
+        if (this->state != TargetControllerState::ACTIVE) {
+            this->resume();
+        }
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Responses::Response> TargetControllerComponent::handleSuspend(Suspend& command) {
+        if (this->state != TargetControllerState::SUSPENDED) {
+            this->suspend();
+        }
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Responses::TargetDescriptor> TargetControllerComponent::handleGetTargetDescriptor(
+        GetTargetDescriptor& command
+    ) {
+        const auto& targetDescriptor = this->getTargetDescriptor();
+
+        if (command.includeVariants && !this->cachedTargetDescriptorIncludesVariants) {
+            /*
+             * Other components may hold the current descriptor, so we can't add the variants to it. We replace it
+             * with a copy that includes them, instead.
+             */
+            auto descriptorWithVariants = std::make_shared<Targets::TargetDescriptor>(targetDescriptor);
+            descriptorWithVariants->variants = this->target->getVariants();
+
+            this->cachedTargetDescriptor = std::move(descriptorWithVariants);
+            this->cachedTargetDescriptorIncludesVariants = true;
+            this->publishTargetDescriptor();
+        }
+
+        return std::make_unique<Responses::TargetDescriptor>(this->cachedTargetDescriptor);
+    }
+
+    std::unique_ptr<Responses::TargetState> TargetControllerComponent::handleGetTargetState(GetTargetState& command) {
+        return std::make_unique<Responses::TargetState>(this->target->getState());
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleStopTargetExecution(StopTargetExecution& command) {
+        this->endActiveStep();
+
+        auto newlyStopped = false;
+
+        if (this->target->getState() != TargetState::STOPPED) {
+            this->target->stop();
+            this->lastTargetState = TargetState::STOPPED;
+            this->captureStopSnapshot();
+            newlyStopped = true;
+        }
+
+        const auto programCounter = this->stopSnapshot.has_value() && this->stopSnapshot->programCounter.has_value()
+            ? *(this->stopSnapshot->programCounter)
+            : this->target->getProgramCounter();
+
+        if (newlyStopped) {
+            this->recordMemoryChanges(programCounter);
+        }
+
+        EventManager::triggerEvent(Events::makeEvent<Events::TargetExecutionStopped>(
+            programCounter,
+            TargetBreakCause::UNKNOWN
+        ));
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleResumeTargetExecution(
+        ResumeTargetExecution& command
+    ) {
+        this->invalidateStopSnapshot();
+        this->invalidateMemoryCaches();
+        this->invalidateProgramMemoryContents();
+
+        if (this->target->getState() != TargetState::RUNNING) {
+            if (command.fromAddress.has_value()) {
+                this->target->setProgramCounter(*command.fromAddress);
+            }
+
+            this->breakpointManager.commit(*this->target);
+            this->target->run(command.toAddress);
+            this->runToAddress = command.toAddress;
+            this->lastTargetState = TargetState::RUNNING;
+            this->steppingExecution = false;
+        }
+
+        EventManager::triggerEvent(Events::makeEvent<Events::TargetExecutionResumed>(false));
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleResetTarget(ResetTarget& command) {
+        if (command.deferred) {
+            Logger::debug("Deferring target reset");
+            this->targetResetPending = true;
+            this->pendingResetProgramCounter = std::nullopt;
+            return std::make_unique<Response>();
+        }
+
+        // Any pending (deferred) reset is superseded by this one
+        this->resetTarget();
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<TargetRegistersRead> TargetControllerComponent::handleReadTargetRegisters(
+        ReadTargetRegisters& command
+    ) {
+        auto snapshotRegisters = this->readRegistersFromStopSnapshot(command.descriptors);
+
+        if (snapshotRegisters.has_value()) {
+            return std::make_unique<TargetRegistersRead>(std::move(*snapshotRegisters));
+        }
+
+        return std::make_unique<TargetRegistersRead>(this->target->readRegisters(command.descriptors));
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleWriteTargetRegisters(WriteTargetRegisters& command) {
+        this->invalidateStopSnapshot();
+
+        for (const auto& reg : command.registers) {
+            // Some registers are mapped to target memory
+            if (reg.descriptor.startAddress.has_value()) {
+                this->invalidateMemoryCache(
+                    reg.descriptor.memoryType,
+                    *(reg.descriptor.startAddress),
+                    reg.descriptor.size
+                );
+            }
+        }
+
+        this->target->writeRegisters(command.registers);
+
+        if (EventManager::isEventTypeListenedFor(Events::RegistersWrittenToTarget::type)) {
+            // The command is spent at this point, so the event can take ownership of the written registers
+            auto registersWrittenEvent = Events::makeEvent<Events::RegistersWrittenToTarget>();
+            registersWrittenEvent->registers = std::move(command.registers);
+
+            EventManager::triggerEvent(registersWrittenEvent);
+        }
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<TargetMemoryRead> TargetControllerComponent::handleReadTargetMemory(ReadTargetMemory& command) {
+        const auto& memoryTypeName = TargetControllerComponent::getMemoryTypeName(command.memoryType);
+        Services::MetricsService::counter("targetController.bytesRead." + memoryTypeName).increment(command.bytes);
+
+        auto snapshotBuffer = this->readMemoryFromStopSnapshot(command);
+
+        if (snapshotBuffer.has_value()) {
+            return std::make_unique<TargetMemoryRead>(std::move(*snapshotBuffer));
+        }
+
+        if (command.bytes > 0) {
+            auto mirrorBuffer = this->readProgramMemoryFromMirror(command);
+
+            if (mirrorBuffer.has_value()) {
+                return std::make_unique<TargetMemoryRead>(std::move(*mirrorBuffer));
+            }
+        }
+
+        /*
+         * Large reads bypass the memory cache, as other commands may be processed between chunks (see
+         * TargetControllerComponent::completeMemoryOperationChunk()), which could leave the cache in an inconsistent
+         * state.
+         *
+         * Reads issued whilst the target is running (on targets that support it) also bypass the cache, as the
+         * target is free to change its memory at any time.
+         */
+        if (
+            command.excludedAddressRanges.empty()
+            && command.bytes <= TargetControllerComponent::MEMORY_OPERATION_CHUNK_SIZE
+            && this->lastTargetState != TargetState::RUNNING
+        ) {
+            auto memoryCacheIt = this->memoryCachesByType.find(command.memoryType);
+
+            if (memoryCacheIt == this->memoryCachesByType.end()) {
+                const auto& memoryDescriptorsByType = this->getTargetDescriptor().memoryDescriptorsByType;
+                const auto memoryDescriptorIt = memoryDescriptorsByType.find(command.memoryType);
+
+                if (memoryDescriptorIt != memoryDescriptorsByType.end()) {
+                    memoryCacheIt = this->memoryCachesByType.insert(
+                        std::pair(command.memoryType, TargetMemoryCache(memoryDescriptorIt->second))
+                    ).first;
+                }
+            }
+
+            if (
+                memoryCacheIt != this->memoryCachesByType.end()
+                && memoryCacheIt->second.covers(command.startAddress, command.bytes)
+            ) {
+                auto& memoryCache = memoryCacheIt->second;
+                const auto missCount = memoryCache.getMissCount();
+
+                auto buffer = memoryCache.fetch(
+                    command.startAddress,
+                    command.bytes,
+                    [this, &command] (TargetMemoryAddress startAddress, TargetMemorySize bytes) {
+                        return this->target->readMemory(command.memoryType, startAddress, bytes, {});
+                    }
+                );
+
+                Services::MetricsService::counter(
+                    "targetController.memoryCache." + memoryTypeName
+                        + (memoryCache.getMissCount() == missCount ? ".hits" : ".misses")
+                ).increment();
+
+                return std::make_unique<TargetMemoryRead>(std::move(buffer));
+            }
+        }
+
+        return std::make_unique<TargetMemoryRead>(this->readTargetMemoryInChunks(command));
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleWriteTargetMemory(WriteTargetMemory& command) {
+        if (
+            command.memoryType == this->getTargetDescriptor().programMemoryType
+            && !this->target->programmingModeEnabled()
+        ) {
+            throw Exception("Cannot write to program memory - programming mode not enabled.");
+        }
+
+        if (this->memoryWriteCombinable(command)) {
+            auto& writeBuffer = this->memoryWriteBuffersByType[command.memoryType];
+            writeBuffer.add(command.startAddress, command.buffer);
+
+            if (writeBuffer.getSize() >= TargetControllerComponent::MEMORY_WRITE_COMBINING_LIMIT) {
+                this->flushMemoryWriteBuffers();
+            }
+
+            return std::make_unique<Response>();
+        }
+
+        this->writeTargetMemory(command);
+        return std::make_unique<Response>();
+    }
+
+    void TargetControllerComponent::writeTargetMemory(const WriteTargetMemory& command) {
+        const auto& buffer = command.buffer;
+        const auto bufferSize = command.buffer.size();
+        const auto bufferStartAddress = command.startAddress;
+
+        const auto& targetDescriptor = this->getTargetDescriptor();
+
+        Services::MetricsService::counter(
+            "targetController.bytesWritten." + TargetControllerComponent::getMemoryTypeName(command.memoryType)
+        ).increment(bufferSize);
+
+        this->invalidateStopSnapshot();
+        this->invalidateMemoryCache(
+            command.memoryType,
+            bufferStartAddress,
+            static_cast<TargetMemorySize>(bufferSize)
+        );
+
+        if (command.memoryType == targetDescriptor.programMemoryType) {
+            this->writeProgramMemory(command);
+
+        } else {
+            this->writeTargetMemoryInChunks(command, bufferStartAddress, buffer);
+        }
+
+        if (this->memoryChangeTimelineSession.has_value() && this->memoryChangeTimelineSession->active) {
+            this->memoryChangeTimelineSession->timeline.applyWrite(command.memoryType, bufferStartAddress, buffer);
+        }
+
+        EventManager::triggerEvent(
+            Events::makeEvent<Events::MemoryWrittenToTarget>(command.memoryType, bufferStartAddress, bufferSize)
+        );
+
+        const auto registerDescriptorIndexIt = this->registerDescriptorIndicesByMemoryType.find(command.memoryType);
+
+        if (
+            EventManager::isEventTypeListenedFor(Events::RegistersWrittenToTarget::type)
+            && command.memoryType == targetDescriptor.programMemoryType
+            && registerDescriptorIndexIt != this->registerDescriptorIndicesByMemoryType.end()
+        ) {
+            /*
+             * The memory type we just wrote to contains some number of registers - if we've written to any address
+             * that is known to store the value of a register, trigger a RegistersWrittenToTarget event
+             */
+            const auto& registerDescriptorIndex = registerDescriptorIndexIt->second;
+            const auto bufferEndAddress = static_cast<std::uint32_t>(bufferStartAddress + (bufferSize - 1));
+            const auto registerDescriptorIds = registerDescriptorIndex.getIdsWithinAddressRange(
+                bufferStartAddress,
+                bufferEndAddress
+            );
+
+            if (!registerDescriptorIds.empty()) {
+                auto registersWrittenEvent = Events::makeEvent<Events::RegistersWrittenToTarget>();
+                registersWrittenEvent->registers.reserve(registerDescriptorIds.size());
+
+                for (const auto registerDescriptorId : registerDescriptorIds) {
+                    const auto& registerDescriptor = registerDescriptorIndex.at(registerDescriptorId);
+                    const auto registerSize = registerDescriptor.size;
+                    const auto registerStartAddress = registerDescriptor.startAddress.value();
+                    const auto registerEndAddress = registerStartAddress + (registerSize - 1);
+
+                    if (registerStartAddress < bufferStartAddress || registerEndAddress > bufferEndAddress) {
+                        continue;
+                    }
+
+                    const auto bufferBeginIt = buffer.begin() + (registerStartAddress - bufferStartAddress);
+                    registersWrittenEvent->registers.emplace_back(TargetRegister(
+                        registerDescriptor,
+                        TargetMemoryBuffer(bufferBeginIt, bufferBeginIt + registerSize)
+                    ));
+                }
+
+                EventManager::triggerEvent(registersWrittenEvent);
+            }
+        }
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleEraseTargetMemory(EraseTargetMemory& command) {
+        const auto& targetDescriptor = this->getTargetDescriptor();
+
+        if (
+            command.memoryType == this->getTargetDescriptor().programMemoryType
+            && !this->target->programmingModeEnabled()
+        ) {
+            throw Exception("Cannot erase program memory - programming mode not enabled.");
+        }
+
+        this->invalidateStopSnapshot();
+
+        const auto memoryCacheIt = this->memoryCachesByType.find(command.memoryType);
+        if (memoryCacheIt != this->memoryCachesByType.end()) {
+            memoryCacheIt->second.invalidate();
+        }
+
+        if (command.memoryType == targetDescriptor.programMemoryType) {
+            this->checkpoint = std::nullopt;
+
+            if (this->programMemoryContents.has_value()) {
+                this->programMemoryContents->invalidate();
+            }
+        }
+
+        const auto eepromDescriptorIt = targetDescriptor.memoryDescriptorsByType.find(TargetMemoryType::EEPROM);
+
+        if (
+            command.memoryType == TargetMemoryType::EEPROM
+            && eepromDescriptorIt != targetDescriptor.memoryDescriptorsByType.end()
+        ) {
+            /*
+             * Targets erase EEPROM by writing 0xFF to every byte. Doing this via a fill allows us to skip the bytes
+             * that have already been erased.
+             */
+            auto fillCommand = FillTargetMemory(
+                TargetMemoryType::EEPROM,
+                eepromDescriptorIt->second.addressRange,
+                {0xFF}
+            );
+            fillCommand.id = command.id;
+            fillCommand.priority = command.priority;
+
+            this->handleFillTargetMemory(fillCommand);
+            return std::make_unique<Response>();
+        }
+
+        this->target->eraseMemory(command.memoryType);
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<TargetMemoryFilled> TargetControllerComponent::handleFillTargetMemory(FillTargetMemory& command) {
+        const auto& targetDescriptor = this->getTargetDescriptor();
+
+        if (command.memoryType == targetDescriptor.programMemoryType) {
+            throw Exception("Cannot fill program memory - use WriteTargetMemory instead.");
+        }
+
+        const auto memoryDescriptorIt = targetDescriptor.memoryDescriptorsByType.find(command.memoryType);
+        if (memoryDescriptorIt == targetDescriptor.memoryDescriptorsByType.end()) {
+            throw Exception("Invalid memory type");
+        }
+
+        const auto& memoryDescriptor = memoryDescriptorIt->second;
+        const auto& addressRange = command.addressRange;
+
+        if (
+            addressRange.startAddress > addressRange.endAddress
+            || !memoryDescriptor.addressRange.contains(addressRange)
+        ) {
+            throw Exception("Invalid address range - range exceeds memory boundary");
+        }
+
+        const auto& fillValue = command.fillValue;
+        if (fillValue.empty()) {
+            throw Exception("Fill value required");
+        }
+
+        const auto bytes = addressRange.endAddress - addressRange.startAddress + 1;
+
+        /*
+         * Obtain the current content of the range, in a single (bulk) read. Reading is much cheaper than writing,
+         * especially for EEPROM, so this is well worth it.
+         *
+         * The read is performed under the ID of the fill command, so that it can be cancelled in the same way.
+         */
+        auto readCommand = ReadTargetMemory(command.memoryType, addressRange.startAddress, bytes, {});
+        readCommand.id = command.id;
+        readCommand.priority = command.priority;
+        const auto currentContent = this->readTargetMemoryInChunks(readCommand);
+
+        const auto desiredByte = [&fillValue] (TargetMemorySize offset) {
+            return fillValue[offset % fillValue.size()];
+        };
+
+        /*
+         * Where the target can write whole EEPROM pages in a single operation, we write every page that contains at
+         * least one changed byte, in its entirety. Otherwise, each byte is written individually, so we only write
+         * the bytes that have changed.
+         */
+        const auto writeUnitSize = command.memoryType == TargetMemoryType::EEPROM
+            && this->target->eepromPageWritesSupported()
+            && memoryDescriptor.pageSize.value_or(0) > 0
+                ? *(memoryDescriptor.pageSize)
+                : TargetMemorySize(1);
+
+        // Collect the runs of consecutive write units that need to be written, as offsets into the range
+        auto changedRanges = std::vector<std::pair<TargetMemorySize, TargetMemorySize>>();
+        auto bytesToWrite = TargetMemorySize(0);
+
+        auto offset = TargetMemorySize(0);
+        while (offset < bytes) {
+            const auto unitEndOffset = std::min(
+                static_cast<TargetMemorySize>(
+                    ((addressRange.startAddress + offset) / writeUnitSize + 1) * writeUnitSize
+                        - addressRange.startAddress
+                ),
+                bytes
+            );
+
+            auto unitChanged = false;
+            for (auto byteOffset = offset; byteOffset < unitEndOffset; ++byteOffset) {
+                if (currentContent[byteOffset] != desiredByte(byteOffset)) {
+                    unitChanged = true;
+                    break;
+                }
+            }
+
+            if (unitChanged) {
+                bytesToWrite += unitEndOffset - offset;
+
+                if (!changedRanges.empty() && changedRanges.back().second == offset) {
+                    changedRanges.back().second = unitEndOffset;
+
+                } else {
+                    changedRanges.emplace_back(offset, unitEndOffset);
+                }
+            }
+
+            offset = unitEndOffset;
+        }
+
+        if (changedRanges.empty()) {
+            Logger::info("Target memory already holds the fill value - nothing to write");
+            return std::make_unique<TargetMemoryFilled>(0);
+        }
+
+        Logger::info(
+            "Writing " + std::to_string(bytesToWrite) + " of " + std::to_string(bytes) + " byte(s) - all other "
+                "bytes already hold the fill value"
+        );
+
+        Services::MetricsService::counter(
+            "targetController.bytesWritten." + TargetControllerComponent::getMemoryTypeName(command.memoryType)
+        ).increment(bytesToWrite);
+
+        this->invalidateStopSnapshot();
+        this->invalidateMemoryCache(command.memoryType, addressRange.startAddress, bytes);
+
+        /*
+         * Chunks must consist of whole write units, to avoid the driver having to read back the remainder of a
+         * partially written page.
+         */
+        const auto chunkSize = std::max(
+            TargetControllerComponent::MEMORY_FILL_CHUNK_SIZE / writeUnitSize * writeUnitSize,
+            writeUnitSize
+        );
+
+        this->cancellationRequestedByCommandId.insert(std::pair(command.id, false));
+
+        try {
+            auto bytesWritten = TargetMemorySize(0);
+
+            for (const auto& [rangeStartOffset, rangeEndOffset] : changedRanges) {
+                auto chunkStartOffset = rangeStartOffset;
+
+                while (chunkStartOffset < rangeEndOffset) {
+                    const auto chunkEndOffset = std::min(
+                        static_cast<TargetMemorySize>(
+                            ((addressRange.startAddress + chunkStartOffset) / chunkSize + 1) * chunkSize
+                                - addressRange.startAddress
+                        ),
+                        rangeEndOffset
+                    );
+
+                    auto chunk = TargetMemoryBuffer();
+                    chunk.reserve(chunkEndOffset - chunkStartOffset);
+
+                    for (auto byteOffset = chunkStartOffset; byteOffset < chunkEndOffset; ++byteOffset) {
+                        chunk.push_back(desiredByte(byteOffset));
+                    }
+
+                    this->target->writeMemory(
+                        command.memoryType,
+                        addressRange.startAddress + chunkStartOffset,
+                        chunk
+                    );
+
+                    bytesWritten += chunkEndOffset - chunkStartOffset;
+                    chunkStartOffset = chunkEndOffset;
+
+                    if (bytesWritten < bytesToWrite) {
+                        this->completeMemoryOperationChunk(command, command.memoryType, bytesWritten, bytesToWrite);
+                    }
+                }
+
+                EventManager::triggerEvent(Events::makeEvent<Events::MemoryWrittenToTarget>(
+                    command.memoryType,
+                    addressRange.startAddress + rangeStartOffset,
+                    rangeEndOffset - rangeStartOffset
+                ));
+            }
+
+        } catch (...) {
+            this->cancellationRequestedByCommandId.erase(command.id);
+            throw;
+        }
+
+        this->cancellationRequestedByCommandId.erase(command.id);
+        return std::make_unique<TargetMemoryFilled>(bytesToWrite);
+    }
+
+    std::unique_ptr<TargetMemoryCrc> TargetControllerComponent::handleComputeTargetMemoryCrc(
+        ComputeTargetMemoryCrc& command
+    ) {
+        /*
+         * We deliberately bypass the memory caches here - the CRC is used to verify the content of the target's
+         * memory, so it must be computed from the target itself.
+         */
+        return std::make_unique<TargetMemoryCrc>(
+            this->target->computeMemoryCrc(command.memoryType, command.startAddress, command.bytes)
+        );
+    }
+
+    std::unique_ptr<TargetMemorySearchResult> TargetControllerComponent::handleSearchTargetMemory(
+        SearchTargetMemory& command
+    ) {
+        const auto& memoryDescriptorsByType = this->getTargetDescriptor().memoryDescriptorsByType;
+        const auto memoryDescriptorIt = memoryDescriptorsByType.find(command.memoryType);
+
+        if (memoryDescriptorIt == memoryDescriptorsByType.end()) {
+            throw Exception("Invalid memory type");
+        }
+
+        const auto& addressRange = command.addressRange;
+
+        if (
+            addressRange.startAddress > addressRange.endAddress
+            || !memoryDescriptorIt->second.addressRange.contains(addressRange)
+        ) {
+            throw Exception("Invalid address range - range exceeds memory boundary");
+        }
+
+        const auto& pattern = command.pattern;
+        const auto bytes = addressRange.endAddress - addressRange.startAddress + 1;
+
+        if (pattern.empty() || pattern.size() > bytes) {
+            return std::make_unique<TargetMemorySearchResult>(std::nullopt);
+        }
+
+        /*
+         * We read the range via handleReadTargetMemory(), so that the read can be served from the stop snapshot or
+         * the memory cache, where possible. As with fills, the read is performed under the ID of the search command.
+         */
+        auto readCommand = ReadTargetMemory(command.memoryType, addressRange.startAddress, bytes, {});
+        readCommand.id = command.id;
+        readCommand.priority = command.priority;
+        const auto content = this->handleReadTargetMemory(readCommand)->takeData();
+
+        const auto matchIt = std::search(
+            content.begin(),
+            content.end(),
+            std::boyer_moore_horspool_searcher(pattern.begin(), pattern.end())
+        );
+
+        if (matchIt == content.end()) {
+            return std::make_unique<TargetMemorySearchResult>(std::nullopt);
+        }
+
+        return std::make_unique<TargetMemorySearchResult>(
+            addressRange.startAddress + static_cast<TargetMemoryAddress>(matchIt - content.begin())
+        );
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleStepTargetExecution(StepTargetExecution& command) {
+        this->invalidateStopSnapshot();
+        this->invalidateMemoryCaches();
+        this->invalidateProgramMemoryContents();
+
+        if (command.fromProgramCounter.has_value()) {
+            this->target->setProgramCounter(command.fromProgramCounter.value());
+        }
+
+        this->endActiveStep();
+
+        if (command.sourceLine) {
+            const auto lineTable = Services::SymbolService::lineTable();
+            if (lineTable == nullptr) {
+                throw Exception(
+                    "No line table available - source-line stepping requires an ELF file with debug information, "
+                        "specified via the \"elfFile\" project config parameter"
+                );
+            }
+
+            // Outside of the line table, there are no statements to step to - we fall back to a single step
+            this->activeStepRange = lineTable->statementRangeAt(this->target->getProgramCounter());
+            this->activeStepSourceLine = true;
+
+        } else {
+            this->activeStepRange = command.stepRange;
+        }
+
+        if (
+            this->activeStepRange.has_value()
+            && (command.stepOverCalls || Services::SymbolService::lineTable() != nullptr)
+        ) {
+            this->activeStepOverCalls = command.stepOverCalls;
+            this->activeStepStackPointer = this->target->getStackPointer();
+        }
+
+        const auto programCounter = this->target->getProgramCounter();
+
+        if (!this->activeStepRange.has_value() && command.stepOverCalls) {
+            /*
+             * A single instruction step, over calls. If the instruction is a call, we treat it as a range step over
+             * the call instruction, which will run the target to the instruction that follows it.
+             */
+            const auto instruction = this->decodeInstruction(programCounter);
+
+            if (instruction.has_value() && instruction->isCall()) {
+                this->activeStepRange = TargetMemoryAddressRange(
+                    programCounter,
+                    programCounter + instruction->byteSize - 1
+                );
+                this->activeStepOverCalls = true;
+                this->activeStepStackPointer = this->target->getStackPointer();
+            }
+        }
+
+        if (!this->activeStepRange.has_value()) {
+            /*
+             * To continue from a breakpoint, GDB removes the breakpoint, steps a single instruction, re-inserts the
+             * breakpoint, and then continues. Committing the removal would cost us a program memory page rewrite
+             * (for a software breakpoint), only for the breakpoint to be rewritten upon the following commit.
+             *
+             * A breakpoint at the program counter has no effect on a single instruction step - all supported debug
+             * tools execute the instruction beneath it. So we leave it in place. GDB's re-insertion then makes the
+             * following commit a no-op, and if GDB doesn't re-insert it, the following commit will remove it.
+             *
+             * We don't do this for range steps, as the target may return to the breakpoint's address within the
+             * range.
+             */
+            this->breakpointManager.commit(*this->target, programCounter);
+
+        } else {
+            this->breakpointManager.commit(*this->target);
+        }
+
+        if (!this->runOverCallInstruction(programCounter)) {
+            this->target->step();
+        }
+        this->lastTargetState = TargetState::RUNNING;
+        this->steppingExecution = true;
+        EventManager::triggerEvent(Events::makeEvent<Events::TargetExecutionResumed>(true));
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleSetBreakpoint(SetBreakpoint& command) {
+        if (this->coverageSession.has_value()) {
+            /*
+             * If we already have a coverage breakpoint at this address, it now belongs to GDB - we mustn't release it
+             * upon a hit.
+             */
+            this->coverageSession->armedAddresses.erase(command.breakpoint.address);
+        }
+
+        this->traceSession.ownedAddresses.erase(command.breakpoint.address);
+
+        if (this->timingSession.has_value()) {
+            this->timingSession->ownedAddresses.erase(command.breakpoint.address);
+        }
+
+        if (command.conditions.empty()) {
+            this->breakpointConditionsByAddress.erase(command.breakpoint.address);
+
+        } else {
+            this->breakpointConditionsByAddress[command.breakpoint.address] = std::move(command.conditions);
+        }
+
+        // The breakpoint will be placed on the target just before execution resumes
+        this->breakpointManager.addBreakpoint(command.breakpoint.address);
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleRemoveBreakpoint(RemoveBreakpoint& command) {
+        this->breakpointConditionsByAddress.erase(command.breakpoint.address);
+        this->breakpointManager.removeBreakpoint(command.breakpoint.address);
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleSetWatchpoint(SetWatchpoint& command) {
+        // As with breakpoints, the watchpoint will be placed on the target just before execution resumes
+        this->breakpointManager.addWatchpoint(command.watchpoint);
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleRemoveWatchpoint(RemoveWatchpoint& command) {
+        this->breakpointManager.removeWatchpoint(command.watchpoint);
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleSetProgramCounter(SetTargetProgramCounter& command) {
+        this->invalidateStopSnapshot();
+        this->target->setProgramCounter(command.address);
+
+        if (this->targetResetPending) {
+            this->pendingResetProgramCounter = command.address;
+        }
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<TargetPinStates> TargetControllerComponent::handleGetTargetPinStates(GetTargetPinStates& command) {
+        return std::make_unique<TargetPinStates>(this->target->getPinStates(command.variantId));
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleSetTargetPinState(SetTargetPinState& command) {
+        this->invalidateStopSnapshot();
+
+        // Pin states are set via writes to memory mapped I/O registers, which bypass the memory caches
+        this->invalidateMemoryCaches();
+        this->target->setPinState(command.pinDescriptor, command.pinState);
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleSetTargetPinStateStreaming(
+        SetTargetPinStateStreaming& command
+    ) {
+        this->pinStateStreamVariantId = command.variantId;
+
+        // The first read after (re)starting the stream will report the state of every pin
+        this->lastStreamedPinStates = std::nullopt;
+        this->lastPinStateStreamReadTime = {};
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<TargetStackPointer> TargetControllerComponent::handleGetTargetStackPointer(
+        GetTargetStackPointer& command
+    ) {
+        if (this->stopSnapshot.has_value() && this->stopSnapshot->stackPointer.has_value()) {
+            return std::make_unique<TargetStackPointer>(*(this->stopSnapshot->stackPointer));
+        }
+
+        return std::make_unique<TargetStackPointer>(this->target->getStackPointer());
+    }
+
+    std::unique_ptr<TargetProgramCounter> TargetControllerComponent::handleGetTargetProgramCounter(
+        GetTargetProgramCounter& command
+    ) {
+        if (this->stopSnapshot.has_value() && this->stopSnapshot->programCounter.has_value()) {
+            return std::make_unique<TargetProgramCounter>(*(this->stopSnapshot->programCounter));
+        }
+
+        return std::make_unique<TargetProgramCounter>(this->target->getProgramCounter());
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleEnableProgrammingMode(EnableProgrammingMode& command) {
+        if (!this->target->programmingModeEnabled()) {
+            this->enableProgrammingMode();
+        }
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleDisableProgrammingMode(DisableProgrammingMode& command) {
+        if (this->target->programmingModeEnabled()) {
+            this->disableProgrammingMode();
+        }
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<ProgramImageLoaded> TargetControllerComponent::handleLoadProgramImage(LoadProgramImage& command) {
+        const auto& targetDescriptor = this->getTargetDescriptor();
+        const auto programMemoryType = targetDescriptor.programMemoryType;
+
+        const auto programMemoryDescriptorIt = targetDescriptor.memoryDescriptorsByType.find(programMemoryType);
+        if (programMemoryDescriptorIt == targetDescriptor.memoryDescriptorsByType.end()) {
+            throw Exception("Target has no program memory");
+        }
+
+        const auto& programMemoryAddressRange = programMemoryDescriptorIt->second.addressRange;
+
+        auto segments = std::vector<const ProgramImage::Segment*>();
+        auto bytes = TargetMemorySize(0);
+
+        for (const auto& segment : command.programImage->segments) {
+            const auto segmentAddressRange = segment.addressRange();
+
+            if (!programMemoryAddressRange.intersectsWith(segmentAddressRange)) {
+                // For AVR ELF files, this will be the EEPROM and fuse sections
+                Logger::warning(
+                    "Ignoring image segment at address " + std::to_string(segment.startAddress)
+                        + " - the segment does not reside in program memory"
+                );
+                continue;
+            }
+
+            if (!programMemoryAddressRange.contains(segmentAddressRange)) {
+                throw Exception(
+                    "Image segment at address " + std::to_string(segment.startAddress)
+                        + " exceeds the target's program memory"
+                );
+            }
+
+            segments.push_back(&segment);
+            bytes += static_cast<TargetMemorySize>(segment.data.size());
+        }
+
+        if (segments.empty()) {
+            throw Exception("Image contains no program memory data");
+        }
+
+        Logger::info(
+            "Loading program image - " + std::to_string(bytes) + " bytes in " + std::to_string(segments.size())
+                + " segment(s)"
+        );
+
+        const auto programmingModeWasEnabled = this->target->programmingModeEnabled();
+        if (!programmingModeWasEnabled) {
+            this->enableProgrammingMode();
+        }
+
+        try {
+            auto bytesLoaded = TargetMemorySize(0);
+
+            for (const auto* segment : segments) {
+                /*
+                 * Each segment goes through the regular write path, so that we only write the pages that have
+                 * changed. The write is performed under the ID of the load command, so that it can be cancelled.
+                 */
+                auto writeCommand = WriteTargetMemory(programMemoryType, segment->startAddress, segment->data);
+                writeCommand.id = command.id;
+                this->handleWriteTargetMemory(writeCommand);
+
+                bytesLoaded += static_cast<TargetMemorySize>(segment->data.size());
+
+                if (command.operationProgressCallback) {
+                    command.operationProgressCallback(bytesLoaded, bytes);
+                }
+            }
+
+        } catch (...) {
+            if (!programmingModeWasEnabled) {
+                try {
+                    this->disableProgrammingMode();
+
+                } catch (const Exception& exception) {
+                    Logger::error("Failed to disable programming mode - " + exception.getMessage());
+                }
+            }
+
+            throw;
+        }
+
+        if (!programmingModeWasEnabled) {
+            this->disableProgrammingMode();
+        }
+
+        if (command.verify) {
+            Logger::info("Verifying program memory");
+
+            for (const auto* segment : segments) {
+                const auto targetCrc = this->target->computeMemoryCrc(
+                    programMemoryType,
+                    segment->startAddress,
+                    static_cast<TargetMemorySize>(segment->data.size())
+                );
+
+                if (targetCrc != Crc32::update(Crc32::INITIAL_VALUE, segment->data)) {
+                    // The content of the program memory is no longer known
+                    if (this->programMemoryContents.has_value()) {
+                        this->programMemoryContents->invalidate();
+                    }
+
+                    throw Exception(
+                        "Verification failed - CRC mismatch for segment at address "
+                            + std::to_string(segment->startAddress)
+                    );
+                }
+            }
+        }
+
+        Logger::info("Program image loaded");
+        return std::make_unique<ProgramImageLoaded>(bytes);
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleStartProgramCounterSampling(
+        StartProgramCounterSampling& command
+    ) {
+        this->stopProgramCounterSampling();
+
+        this->programCounterSampleCounts.clear();
+        this->skippedProgramCounterSampleCount = 0;
+        this->programCounterSamplingStartTime = std::chrono::steady_clock::now();
+
+        this->programCounterSamplingTimerId = this->eventLoop.addTimer(
+            std::max(command.samplingInterval, std::chrono::milliseconds(1)),
+            [this] {
+                this->sampleProgramCounter();
+            },
+            true
+        );
+
+        Logger::info(
+            "Program counter sampling started (interval: " + std::to_string(command.samplingInterval.count())
+                + "ms)"
+        );
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<ProgramCounterSamples> TargetControllerComponent::handleStopProgramCounterSampling(
+        StopProgramCounterSampling& command
+    ) {
+        const auto wasSampling = this->programCounterSamplingTimerId.has_value();
+        this->stopProgramCounterSampling();
+
+        auto response = std::make_unique<ProgramCounterSamples>(
+            std::move(this->programCounterSampleCounts),
+            this->skippedProgramCounterSampleCount,
+            wasSampling
+                ? std::chrono::steady_clock::now() - this->programCounterSamplingStartTime
+                : std::chrono::steady_clock::duration::zero()
+        );
+
+        this->programCounterSampleCounts.clear();
+        this->skippedProgramCounterSampleCount = 0;
+
+        return response;
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleStartCoverageCollection(
+        StartCoverageCollection& command
+    ) {
+        if (command.addresses.empty()) {
+            throw Exception("No addresses to instrument");
+        }
+
+        if (this->coverageSession.has_value()) {
+            this->eventLoop.removeTimer(this->coverageSession->sweepTimerId);
+
+            for (const auto address : this->coverageSession->armedAddresses) {
+                this->breakpointManager.removeBreakpoint(address);
+            }
+
+            this->coverageSession = std::nullopt;
+        }
+
+        auto& session = this->coverageSession.emplace();
+        session.addresses = std::move(command.addresses);
+        session.hits.assign(session.addresses.size(), false);
+        session.batchSize = std::max(command.batchSize, std::size_t(1));
+        session.startTime = std::chrono::steady_clock::now();
+
+        this->armCoverageBreakpoints();
+        this->applyBreakpointChanges();
+
+        session.sweepTimerId = this->eventLoop.addTimer(
+            std::max(command.sweepInterval, std::chrono::milliseconds(1)),
+            [this] {
+                this->sweepCoverageBreakpoints();
+            },
+            true
+        );
+
+        Logger::info(
+            "Coverage collection started (" + std::to_string(session.addresses.size()) + " addresses, batch size: "
+                + std::to_string(session.batchSize) + ")"
+        );
+
+        return std::make_unique<Response>();
+    }
+
+    std::unique_ptr<CoverageReport> TargetControllerComponent::handleStopCoverageCollection(
+        StopCoverageCollection& command
+    ) {
+        if (!this->coverageSession.has_value()) {
+            throw Exception("Coverage collection is not active");
+        }
+
+        auto& session = *(this->coverageSession);
+        this->eventLoop.removeTimer(session.sweepTimerId);
+
+        for (const auto address : session.armedAddresses) {
+            this->breakpointManager.removeBreakpoint(address);
         }
-    }
 
-    void TargetControllerComponent::resetTarget() {
-        this->target->reset();
+        session.armedAddresses.clear();
 
-        EventManager::triggerEvent(std::make_shared<Events::TargetReset>());
-    }
+        auto response = std::make_unique<CoverageReport>(
+            std::move(session.addresses),
+            std::move(session.hits),
+            session.sweepCount,
+            std::chrono::steady_clock::now() - session.startTime
+        );
 
-    void TargetControllerComponent::enableProgrammingMode() {
-        Logger::debug("Enabling programming mode");
-        this->target->enableProgrammingMode();
-        Logger::warning("Programming mode enabled");
+        this->coverageSession = std::nullopt;
+        this->applyBreakpointChanges();
 
-        EventManager::triggerEvent(std::make_shared<Events::ProgrammingModeEnabled>());
+        Logger::info("Coverage collection stopped");
+        return response;
     }
 
-    void TargetControllerComponent::disableProgrammingMode() {
-        Logger::debug("Disabling programming mode");
-        this->target->disableProgrammingMode();
-        Logger::info("Programming mode disabled");
+    std::unique_ptr<Response> TargetControllerComponent::handleStartTracing(StartTracing& command) {
+        if (this->traceSession.running) {
+            this->stopTracing(TraceStopReason::STOPPED);
+        }
+
+        auto& session = this->traceSession;
+        session = TraceSession();
+
+        for (auto& tracepoint : command.tracepoints) {
+            const auto address = tracepoint.address;
 
-        EventManager::triggerEvent(std::make_shared<Events::ProgrammingModeDisabled>());
+            if (tracepoint.enabled && !this->breakpointManager.isBreakpointSet(address)) {
+                this->breakpointManager.addBreakpoint(address);
+                session.ownedAddresses.insert(address);
+            }
+
+            if (this->coverageSession.has_value()) {
+                // Tracepoint breakpoints must not be released upon a coverage hit
+                this->coverageSession->armedAddresses.erase(address);
+            }
+
+            session.tracepointsByAddress[address].emplace_back(std::move(tracepoint));
+        }
+
+        session.running = true;
+        this->applyBreakpointChanges();
+
+        Logger::info(
+            "Trace experiment started (" + std::to_string(command.tracepoints.size()) + " tracepoint(s))"
+        );
+
+        return std::make_unique<Response>();
     }
 
-    const Targets::TargetDescriptor& TargetControllerComponent::getTargetDescriptor() {
-        if (!this->cachedTargetDescriptor.has_value()) {
-            this->cachedTargetDescriptor.emplace(this->target->getDescriptor());
+    std::unique_ptr<Response> TargetControllerComponent::handleStopTracing(StopTracing& command) {
+        if (this->traceSession.running) {
+            this->stopTracing(TraceStopReason::STOPPED);
+            this->applyBreakpointChanges();
+
+            Logger::info(
+                "Trace experiment stopped (" + std::to_string(this->traceSession.frames.size()) + " frame(s) "
+                    "collected)"
+            );
         }
 
-        return *this->cachedTargetDescriptor;
+        return std::make_unique<Response>();
     }
 
-    void TargetControllerComponent::onShutdownTargetControllerEvent(const Events::ShutdownTargetController&) {
-        this->shutdown();
+    std::unique_ptr<TraceStatus> TargetControllerComponent::handleGetTraceStatus(GetTraceStatus& command) {
+        const auto& session = this->traceSession;
+
+        return std::make_unique<TraceStatus>(
+            session.running,
+            session.stopReason,
+            session.stopTracepointNumber,
+            session.frames.size(),
+            TargetControllerComponent::TRACE_BUFFER_SIZE,
+            session.bufferUsed
+        );
     }
 
-    void TargetControllerComponent::onDebugSessionStartedEvent(const Events::DebugSessionStarted&) {
-        if (TargetControllerComponent::state == TargetControllerState::SUSPENDED) {
-            Logger::debug("Waking TargetController");
+    std::unique_ptr<TraceFrames> TargetControllerComponent::handleReadTraceFrames(ReadTraceFrames& command) {
+        const auto& frames = this->traceSession.frames;
 
-            this->resume();
-            this->fireTargetEvents();
+        if (command.startIndex >= frames.size()) {
+            return std::make_unique<TraceFrames>(std::vector<TraceFrame>());
         }
+
+        return std::make_unique<TraceFrames>(
+            std::vector<TraceFrame>(frames.begin() + static_cast<std::ptrdiff_t>(command.startIndex), frames.end())
+        );
     }
 
-    void TargetControllerComponent::onDebugSessionFinishedEvent(const DebugSessionFinished&) {
-        if (this->target->getState() != TargetState::RUNNING) {
-            this->target->run();
-            this->fireTargetEvents();
+    std::unique_ptr<Response> TargetControllerComponent::handleStartLiveSampling(StartLiveSampling& command) {
+        if (command.variables.empty()) {
+            throw Exception("No variables to sample");
         }
 
-        if (this->environmentConfig.debugToolConfig.releasePostDebugSession) {
-            this->suspend();
+        if (!this->target->runtimeMemoryAccessSupported()) {
+            throw Exception(
+                "Live sampling is not supported on this target - memory cannot be accessed whilst the target is "
+                    "running"
+            );
         }
-    }
 
-    std::unique_ptr<Responses::State> TargetControllerComponent::handleGetState(GetState& command) {
-        return std::make_unique<Responses::State>(this->state);
-    }
+        for (const auto& variable : command.variables) {
+            if (variable.size == 0) {
+                throw Exception("Invalid size for live sampled variable \"" + variable.name + "\"");
+            }
+        }
 
-    std::unique_ptr<Responses::Response> TargetControllerComponent::handleResume(Resume& command) {
-        if (this->state != TargetControllerState::ACTIVE) {
-            this->resume();
+        this->stopLiveSampling();
+
+        auto& session = this->liveSamplingSession;
+        session = LiveSamplingSession();
+        session.variables = std::move(command.variables);
+
+        /*
+         * Coalesce the variables into spans, so that each sample requires as few reads as possible. Variables that
+         * are adjacent (or nearly adjacent - see LIVE_SAMPLE_MAX_SPAN_GAP) share a span.
+         */
+        auto variableIndices = std::vector<std::size_t>(session.variables.size());
+        for (auto index = std::size_t(0); index < variableIndices.size(); ++index) {
+            variableIndices[index] = index;
         }
 
-        return std::make_unique<Response>();
-    }
+        std::sort(
+            variableIndices.begin(),
+            variableIndices.end(),
+            [&session] (std::size_t indexA, std::size_t indexB) {
+                const auto& variableA = session.variables[indexA];
+                const auto& variableB = session.variables[indexB];
 
-    std::unique_ptr<Responses::Response> TargetControllerComponent::handleSuspend(Suspend& command) {
-        if (this->state != TargetControllerState::SUSPENDED) {
-            this->suspend();
+                return variableA.memoryType != variableB.memoryType
+                    ? variableA.memoryType < variableB.memoryType
+                    : variableA.address < variableB.address;
+            }
+        );
+
+        for (const auto variableIndex : variableIndices) {
+            const auto& variable = session.variables[variableIndex];
+            const auto variableEndAddress = variable.address + variable.size;
+
+            if (
+                !session.spans.empty()
+                && session.spans.back().memoryType == variable.memoryType
+                && variable.address <= session.spans.back().startAddress + session.spans.back().size
+                    + TargetControllerComponent::LIVE_SAMPLE_MAX_SPAN_GAP
+            ) {
+                auto& span = session.spans.back();
+                span.size = std::max(span.size, variableEndAddress - span.startAddress);
+                span.variableIndices.push_back(variableIndex);
+                continue;
+            }
+
+            auto& span = session.spans.emplace_back();
+            span.memoryType = variable.memoryType;
+            span.startAddress = variable.address;
+            span.size = variable.size;
+            span.variableIndices.push_back(variableIndex);
         }
 
+        session.startTime = std::chrono::steady_clock::now();
+        session.timerId = this->eventLoop.addTimer(
+            std::max(command.samplingInterval, std::chrono::milliseconds(1)),
+            [this] {
+                this->takeLiveSample();
+            },
+            true
+        );
+
+        Logger::info(
+            "Live sampling started (" + std::to_string(session.variables.size()) + " variable(s), "
+                + std::to_string(session.spans.size()) + " read(s) per sample, interval: "
+                + std::to_string(command.samplingInterval.count()) + "ms)"
+        );
+
         return std::make_unique<Response>();
     }
 
-    std::unique_ptr<Responses::TargetDescriptor> TargetControllerComponent::handleGetTargetDescriptor(
-        GetTargetDescriptor& command
-    ) {
-        return std::make_unique<Responses::TargetDescriptor>(this->getTargetDescriptor());
+    std::unique_ptr<Response> TargetControllerComponent::handleStopLiveSampling(StopLiveSampling& command) {
+        this->stopLiveSampling();
+        return std::make_unique<Response>();
     }
 
-    std::unique_ptr<Responses::TargetState> TargetControllerComponent::handleGetTargetState(GetTargetState& command) {
-        return std::make_unique<Responses::TargetState>(this->target->getState());
+    std::unique_ptr<LiveSamples> TargetControllerComponent::handleGetLiveSamples(GetLiveSamples& command) {
+        const auto& session = this->liveSamplingSession;
+
+        // Sequence numbers are contiguous, so we can locate the first requested sample without searching
+        const auto firstSequenceNumber = session.samples.empty() ? 0 : session.samples.front().sequenceNumber;
+        const auto skipCount = command.fromSequenceNumber > firstSequenceNumber
+            ? std::min(command.fromSequenceNumber - firstSequenceNumber, std::uint64_t(session.samples.size()))
+            : 0;
+
+        return std::make_unique<LiveSamples>(
+            session.variables,
+            std::vector<LiveSample>(
+                session.samples.begin() + static_cast<std::ptrdiff_t>(skipCount),
+                session.samples.end()
+            ),
+            session.timerId.has_value(),
+            session.droppedSampleCount,
+            session.skippedSampleCount
+        );
     }
 
-    std::unique_ptr<Response> TargetControllerComponent::handleStopTargetExecution(StopTargetExecution& command) {
-        if (this->target->getState() != TargetState::STOPPED) {
-            this->target->stop();
-            this->lastTargetState = TargetState::STOPPED;
+    std::unique_ptr<Response> TargetControllerComponent::handleStartTimingAnalysis(StartTimingAnalysis& command) {
+        if (command.startAddress == command.endAddress) {
+            throw Exception("The start and end addresses must differ");
         }
 
-        EventManager::triggerEvent(std::make_shared<Events::TargetExecutionStopped>(
-            this->target->getProgramCounter(),
-            TargetBreakCause::UNKNOWN
-        ));
+        if (command.iterationCount == 0) {
+            throw Exception("Invalid iteration count");
+        }
 
-        return std::make_unique<Response>();
-    }
+        if (
+            command.timerRegister.has_value()
+            && (command.timerRegister->size == 0 || command.timerRegister->size > 8)
+        ) {
+            throw Exception("Invalid timer register size - must be between 1 and 8 bytes");
+        }
 
-    std::unique_ptr<Response> TargetControllerComponent::handleResumeTargetExecution(
-        ResumeTargetExecution& command
-    ) {
-        if (this->target->getState() != TargetState::RUNNING) {
-            if (command.fromAddress.has_value()) {
-                this->target->setProgramCounter(*command.fromAddress);
+        if (this->timingSession.has_value()) {
+            this->releaseTimingBreakpoints();
+            this->timingSession = std::nullopt;
+        }
+
+        for (const auto address : {command.startAddress, command.endAddress}) {
+            if (this->breakpointManager.isBreakpointSet(address)) {
+                /*
+                 * A halt at another component's breakpoint is reported (and the target stays halted until it's
+                 * resumed), which would distort the measurements.
+                 */
+                this->applyBreakpointChanges();
+                throw Exception(
+                    "A breakpoint is already set at address " + std::to_string(address) + " - remove it first"
+                );
             }
+        }
 
-            this->target->run(command.toAddress);
-            this->lastTargetState = TargetState::RUNNING;
+        auto& session = this->timingSession.emplace();
+        session.results.startAddress = command.startAddress;
+        session.results.endAddress = command.endAddress;
+        session.results.iterationCount = command.iterationCount;
+        session.results.timerRegister = command.timerRegister;
+        session.results.hostDurations.reserve(command.iterationCount);
+
+        for (const auto address : {command.startAddress, command.endAddress}) {
+            this->breakpointManager.addBreakpoint(address);
+            session.ownedAddresses.insert(address);
         }
 
-        EventManager::triggerEvent(std::make_shared<Events::TargetExecutionResumed>(false));
+        this->applyBreakpointChanges();
 
-        return std::make_unique<Response>();
-    }
+        Logger::info(
+            "Timing analysis started (" + std::to_string(command.iterationCount) + " iterations)"
+        );
 
-    std::unique_ptr<Response> TargetControllerComponent::handleResetTarget(ResetTarget& command) {
-        this->resetTarget();
         return std::make_unique<Response>();
     }
 
-    std::unique_ptr<TargetRegistersRead> TargetControllerComponent::handleReadTargetRegisters(
-        ReadTargetRegisters& command
+    std::unique_ptr<TimingAnalysisReport> TargetControllerComponent::handleGetTimingAnalysisReport(
+        GetTimingAnalysisReport& command
     ) {
-        return std::make_unique<TargetRegistersRead>(this->target->readRegisters(command.descriptors));
+        if (!this->timingSession.has_value()) {
+            throw Exception("No timing analysis has been started");
+        }
+
+        return std::make_unique<TimingAnalysisReport>(this->timingSession->results);
     }
 
-    std::unique_ptr<Response> TargetControllerComponent::handleWriteTargetRegisters(WriteTargetRegisters& command) {
-        this->target->writeRegisters(command.registers);
+    std::unique_ptr<TimingAnalysisReport> TargetControllerComponent::handleStopTimingAnalysis(
+        StopTimingAnalysis& command
+    ) {
+        if (!this->timingSession.has_value()) {
+            throw Exception("No timing analysis has been started");
+        }
 
-        auto registersWrittenEvent = std::make_shared<Events::RegistersWrittenToTarget>();
-        registersWrittenEvent->registers = command.registers;
+        this->releaseTimingBreakpoints();
+        auto response = std::make_unique<TimingAnalysisReport>(this->timingSession->results);
 
-        EventManager::triggerEvent(registersWrittenEvent);
+        this->timingSession = std::nullopt;
+        this->applyBreakpointChanges();
 
-        return std::make_unique<Response>();
+        Logger::info("Timing analysis stopped");
+        return response;
     }
 
-    std::unique_ptr<TargetMemoryRead> TargetControllerComponent::handleReadTargetMemory(ReadTargetMemory& command) {
-        return std::make_unique<TargetMemoryRead>(this->target->readMemory(
-            command.memoryType,
-            command.startAddress,
-            command.bytes,
-            command.excludedAddressRanges
-        ));
-    }
+    std::unique_ptr<Response> TargetControllerComponent::handleStartMemoryChangeTimeline(
+        StartMemoryChangeTimeline& command
+    ) {
+        if (command.regions.empty()) {
+            throw Exception("No memory regions to track");
+        }
 
-    std::unique_ptr<Response> TargetControllerComponent::handleWriteTargetMemory(WriteTargetMemory& command) {
-        const auto& buffer = command.buffer;
-        const auto bufferSize = command.buffer.size();
-        const auto bufferStartAddress = command.startAddress;
+        const auto& memoryDescriptorsByType = this->getTargetDescriptor().memoryDescriptorsByType;
 
-        const auto& targetDescriptor = this->getTargetDescriptor();
+        for (const auto& region : command.regions) {
+            const auto memoryDescriptorIt = memoryDescriptorsByType.find(region.memoryType);
 
-        if (command.memoryType == targetDescriptor.programMemoryType && !this->target->programmingModeEnabled()) {
-            throw Exception("Cannot write to program memory - programming mode not enabled.");
+            if (
+                region.size == 0
+                || memoryDescriptorIt == memoryDescriptorsByType.end()
+                || !memoryDescriptorIt->second.addressRange.contains(
+                    TargetMemoryAddressRange(region.startAddress, region.startAddress + region.size - 1)
+                )
+            ) {
+                throw Exception("Invalid memory change timeline region");
+            }
         }
 
-        this->target->writeMemory(command.memoryType, bufferStartAddress, buffer);
-        EventManager::triggerEvent(
-            std::make_shared<Events::MemoryWrittenToTarget>(command.memoryType, bufferStartAddress, bufferSize)
+        this->stopMemoryChangeTimeline();
+
+        this->memoryChangeTimelineSession = MemoryChangeTimelineSession{
+            .timeline = MemoryChangeTimeline(
+                std::move(command.regions),
+                TargetControllerComponent::MEMORY_CHANGE_TIMELINE_SIZE
+            ),
+            .startTime = std::chrono::steady_clock::now(),
+        };
+
+        // If the target is already stopped, this stop serves as the starting point of the timeline
+        if (this->lastTargetState == TargetState::STOPPED) {
+            this->recordMemoryChanges(this->target->getProgramCounter());
+        }
+
+        Logger::info(
+            "Memory change timeline started (" + std::to_string(
+                this->memoryChangeTimelineSession->timeline.getRegions().size()
+            ) + " region(s))"
         );
 
-        if (
-            EventManager::isEventTypeListenedFor(Events::RegistersWrittenToTarget::type)
-            && command.memoryType == targetDescriptor.programMemoryType
-            && this->registerDescriptorsByMemoryType.contains(command.memoryType)
-        ) {
-            /*
-             * The memory type we just wrote to contains some number of registers - if we've written to any address
-             * that is known to store the value of a register, trigger a RegistersWrittenToTarget event
-             */
-            const auto bufferEndAddress = static_cast<std::uint32_t>(bufferStartAddress + (bufferSize - 1));
-            auto registerDescriptors = this->getRegisterDescriptorsWithinAddressRange(
-                bufferStartAddress,
-                bufferEndAddress,
-                command.memoryType
-            );
+        return std::make_unique<Response>();
+    }
 
-            if (!registerDescriptors.empty()) {
-                auto registersWrittenEvent = std::make_shared<Events::RegistersWrittenToTarget>();
+    std::unique_ptr<Response> TargetControllerComponent::handleStopMemoryChangeTimeline(
+        StopMemoryChangeTimeline& command
+    ) {
+        this->stopMemoryChangeTimeline();
+        return std::make_unique<Response>();
+    }
 
-                for (const auto& registerDescriptor : registerDescriptors) {
-                    const auto registerSize = registerDescriptor.size;
-                    const auto registerStartAddress = registerDescriptor.startAddress.value();
-                    const auto registerEndAddress = registerStartAddress + (registerSize - 1);
+    std::unique_ptr<MemoryChanges> TargetControllerComponent::handleGetMemoryChanges(GetMemoryChanges& command) {
+        if (!this->memoryChangeTimelineSession.has_value()) {
+            return std::make_unique<MemoryChanges>(
+                std::vector<MemoryChangeTimelineRegion>(),
+                std::vector<MemoryChange>(),
+                false,
+                false,
+                0
+            );
+        }
 
-                    if (registerStartAddress < bufferStartAddress || registerEndAddress > bufferEndAddress) {
-                        continue;
-                    }
+        const auto& session = *(this->memoryChangeTimelineSession);
+        const auto& changes = session.timeline.getChanges();
 
-                    const auto bufferBeginIt = buffer.begin() + (registerStartAddress - bufferStartAddress);
-                    registersWrittenEvent->registers.emplace_back(TargetRegister(
-                        registerDescriptor,
-                        TargetMemoryBuffer(bufferBeginIt, bufferBeginIt + registerSize)
-                    ));
-                }
+        // Sequence numbers are indices into the log, so we can locate the first requested change without searching
+        const auto skipCount = std::min(command.fromSequenceNumber, std::uint64_t(changes.size()));
 
-                EventManager::triggerEvent(registersWrittenEvent);
-            }
+        return std::make_unique<MemoryChanges>(
+            session.timeline.getRegions(),
+            std::vector<MemoryChange>(changes.begin() + static_cast<std::ptrdiff_t>(skipCount), changes.end()),
+            session.active,
+            session.timeline.isFull(),
+            session.timeline.getStopCount()
+        );
+    }
+
+    std::unique_ptr<LastMemoryChange> TargetControllerComponent::handleGetLastMemoryChange(
+        GetLastMemoryChange& command
+    ) {
+        if (!this->memoryChangeTimelineSession.has_value()) {
+            return std::make_unique<LastMemoryChange>(std::nullopt);
         }
 
-        return std::make_unique<Response>();
+        const auto* change = this->memoryChangeTimelineSession->timeline.lastChange(
+            command.memoryType,
+            command.address
+        );
+
+        return std::make_unique<LastMemoryChange>(
+            change != nullptr ? std::optional<MemoryChange>(*change) : std::nullopt
+        );
     }
 
-    std::unique_ptr<Response> TargetControllerComponent::handleEraseTargetMemory(EraseTargetMemory& command) {
+    std::unique_ptr<Response> TargetControllerComponent::handleCaptureCheckpoint(CaptureCheckpoint& command) {
         const auto& targetDescriptor = this->getTargetDescriptor();
+        const auto ramDescriptorIt = targetDescriptor.memoryDescriptorsByType.find(TargetMemoryType::RAM);
 
-        if (
-            command.memoryType == this->getTargetDescriptor().programMemoryType
-            && !this->target->programmingModeEnabled()
-        ) {
-            throw Exception("Cannot erase program memory - programming mode not enabled.");
+        if (ramDescriptorIt == targetDescriptor.memoryDescriptorsByType.end()) {
+            throw Exception("Cannot capture checkpoint - target has no RAM");
         }
 
-        this->target->eraseMemory(command.memoryType);
+        const auto& ramDescriptor = ramDescriptorIt->second;
 
-        return std::make_unique<Response>();
-    }
+        auto registerDescriptors = command.peripheralRegisterDescriptors;
 
-    std::unique_ptr<Response> TargetControllerComponent::handleStepTargetExecution(StepTargetExecution& command) {
-        if (command.fromProgramCounter.has_value()) {
-            this->target->setProgramCounter(command.fromProgramCounter.value());
+        for (const auto registerType : {
+            TargetRegisterType::GENERAL_PURPOSE_REGISTER,
+            TargetRegisterType::STATUS_REGISTER,
+            TargetRegisterType::STACK_POINTER,
+            TargetRegisterType::PROGRAM_COUNTER,
+        }) {
+            const auto descriptorsIt = targetDescriptor.registerDescriptorsByType.find(registerType);
+
+            if (descriptorsIt != targetDescriptor.registerDescriptorsByType.end()) {
+                registerDescriptors.insert(descriptorsIt->second.begin(), descriptorsIt->second.end());
+            }
         }
 
-        this->target->step();
-        this->lastTargetState = TargetState::RUNNING;
-        EventManager::triggerEvent(std::make_shared<Events::TargetExecutionResumed>(true));
+        auto readCommand = ReadTargetMemory(
+            TargetMemoryType::RAM,
+            ramDescriptor.addressRange.startAddress,
+            ramDescriptor.size(),
+            {}
+        );
+        readCommand.id = command.id;
 
-        return std::make_unique<Response>();
-    }
+        auto checkpoint = TargetCheckpoint();
+        checkpoint.ramStartAddress = ramDescriptor.addressRange.startAddress;
+        checkpoint.ramData = this->readTargetMemoryInChunks(readCommand);
+        checkpoint.registers = this->target->readRegisters(registerDescriptors);
 
-    std::unique_ptr<Response> TargetControllerComponent::handleSetBreakpoint(SetBreakpoint& command) {
-        this->target->setBreakpoint(command.breakpoint.address);
-        return std::make_unique<Response>();
-    }
+        Logger::info(
+            "Checkpoint captured (" + std::to_string(checkpoint.ramData.size()) + " byte(s) of RAM, "
+                + std::to_string(checkpoint.registers.size()) + " register(s))"
+        );
 
-    std::unique_ptr<Response> TargetControllerComponent::handleRemoveBreakpoint(RemoveBreakpoint& command) {
-        this->target->removeBreakpoint(command.breakpoint.address);
+        this->checkpoint = std::move(checkpoint);
         return std::make_unique<Response>();
     }
 
-    std::unique_ptr<Response> TargetControllerComponent::handleSetProgramCounter(SetTargetProgramCounter& command) {
-        this->target->setProgramCounter(command.address);
-        return std::make_unique<Response>();
-    }
+    std::unique_ptr<Response> TargetControllerComponent::handleRestoreCheckpoint(RestoreCheckpoint& command) {
+        if (!this->checkpoint.has_value()) {
+            throw Exception("No checkpoint has been captured");
+        }
 
-    std::unique_ptr<TargetPinStates> TargetControllerComponent::handleGetTargetPinStates(GetTargetPinStates& command) {
-        return std::make_unique<TargetPinStates>(this->target->getPinStates(command.variantId));
-    }
+        /*
+         * We go through the regular write handlers, so that the caches are invalidated and the relevant events are
+         * triggered, as they would be for any other write. The registers are written last, as the stack pointer and
+         * program counter must reflect the restored RAM.
+         */
+        auto writeMemoryCommand = WriteTargetMemory(
+            TargetMemoryType::RAM,
+            this->checkpoint->ramStartAddress,
+            this->checkpoint->ramData
+        );
+        writeMemoryCommand.id = command.id;
+        this->handleWriteTargetMemory(writeMemoryCommand);
 
-    std::unique_ptr<Response> TargetControllerComponent::handleSetTargetPinState(SetTargetPinState& command) {
-        this->target->setPinState(command.pinDescriptor, command.pinState);
+        auto writeRegistersCommand = WriteTargetRegisters(this->checkpoint->registers);
+        writeRegistersCommand.id = command.id;
+        this->handleWriteTargetRegisters(writeRegistersCommand);
+
+        Logger::info("Checkpoint restored");
         return std::make_unique<Response>();
     }
 
-    std::unique_ptr<TargetStackPointer> TargetControllerComponent::handleGetTargetStackPointer(
-        GetTargetStackPointer& command
-    ) {
-        return std::make_unique<TargetStackPointer>(this->target->getStackPointer());
-    }
+    std::unique_ptr<CommandBatchResponses> TargetControllerComponent::handleCommandBatch(CommandBatch& command) {
+        auto responses = std::vector<std::unique_ptr<Response>>();
+        responses.reserve(command.commands.size());
 
-    std::unique_ptr<TargetProgramCounter> TargetControllerComponent::handleGetTargetProgramCounter(
-        GetTargetProgramCounter& command
-    ) {
-        return std::make_unique<TargetProgramCounter>(this->target->getProgramCounter());
-    }
+        for (auto& batchedCommand : command.commands) {
+            if (batchedCommand->getType() == CommandBatch::type) {
+                responses.emplace_back(std::make_unique<Responses::Error>("Nested command batches are not supported."));
+                continue;
+            }
 
-    std::unique_ptr<Response> TargetControllerComponent::handleEnableProgrammingMode(EnableProgrammingMode& command) {
-        if (!this->target->programmingModeEnabled()) {
-            this->enableProgrammingMode();
+            responses.emplace_back(this->processCommand(*(batchedCommand.get())));
+
+            // Don't hold up any higher priority commands that were queued whilst we were processing the batch
+            if (command.priority != CommandPriority::REALTIME) {
+                this->processPendingCommands(command.priority);
+            }
         }
 
-        return std::make_unique<Response>();
+        return std::make_unique<CommandBatchResponses>(std::move(responses));
     }
 
-    std::unique_ptr<Response> TargetControllerComponent::handleDisableProgrammingMode(DisableProgrammingMode& command) {
-        if (this->target->programmingModeEnabled()) {
-            this->disableProgrammingMode();
+    std::unique_ptr<Response> TargetControllerComponent::handleCancelCommand(CancelCommand& command) {
+        // If the command is yet to be processed, we just reject it
+        for (auto& [priority, pendingCommands] : this->pendingCommandsByPriority) {
+            const auto queuedCommandIt = std::find_if(
+                pendingCommands.begin(),
+                pendingCommands.end(),
+                [&command] (const QueuedCommand& queuedCommand) {
+                    return queuedCommand.command->id == command.commandId;
+                }
+            );
+
+            if (queuedCommandIt != pendingCommands.end()) {
+                queuedCommandIt->responsePromise.set_value(std::make_unique<Responses::Error>("Command cancelled."));
+                pendingCommands.erase(queuedCommandIt);
+                return std::make_unique<Response>();
+            }
+        }
+
+        // The operation will be aborted at the end of the current chunk
+        const auto cancellationRequestedIt = this->cancellationRequestedByCommandId.find(command.commandId);
+        if (cancellationRequestedIt != this->cancellationRequestedByCommandId.end()) {
+            cancellationRequestedIt->second = true;
         }
 
         return std::make_unique<Response>();
@@ -2,21 +2,35 @@
 
 #include <atomic>
 #include <memory>
-#include <queue>
-#include <condition_variable>
+#include <future>
+#include <deque>
 #include <optional>
 #include <chrono>
 #include <map>
+#include <set>
+#include <vector>
+#include <array>
 #include <string>
 #include <functional>
+#include <utility>
 #include <QJsonObject>
 #include <QJsonArray>
 
 #include "src/Helpers/Thread.hpp"
 #include "src/Helpers/SyncSafe.hpp"
-#include "src/Helpers/ConditionVariableNotifier.hpp"
+#include "src/Helpers/MpscQueue.hpp"
+#include "src/Helpers/MemoryPool.hpp"
+#include "src/Helpers/EventLoop.hpp"
+#include "src/Services/MetricsService.hpp"
 
 #include "TargetControllerState.hpp"
+#include "TargetMemoryCache.hpp"
+#include "TargetMemoryWriteBuffer.hpp"
+#include "RegisterDescriptorIndex.hpp"
+#include "BreakpointManager.hpp"
+#include "AgentExpression.hpp"
+#include "Tracepoint.hpp"
+#include "MemoryChangeTimeline.hpp"
 
 // Commands
 #include "Commands/Command.hpp"
@@ -33,16 +47,45 @@
 #include "Commands/ReadTargetMemory.hpp"
 #include "Commands/WriteTargetMemory.hpp"
 #include "Commands/EraseTargetMemory.hpp"
+#include "Commands/FillTargetMemory.hpp"
+#include "Commands/ComputeTargetMemoryCrc.hpp"
+#include "Commands/SearchTargetMemory.hpp"
 #include "Commands/StepTargetExecution.hpp"
 #include "Commands/SetBreakpoint.hpp"
 #include "Commands/RemoveBreakpoint.hpp"
+#include "Commands/SetWatchpoint.hpp"
+#include "Commands/RemoveWatchpoint.hpp"
 #include "Commands/SetTargetProgramCounter.hpp"
 #include "Commands/GetTargetPinStates.hpp"
 #include "Commands/SetTargetPinState.hpp"
+#include "Commands/SetTargetPinStateStreaming.hpp"
 #include "Commands/GetTargetStackPointer.hpp"
 #include "Commands/GetTargetProgramCounter.hpp"
 #include "Commands/EnableProgrammingMode.hpp"
 #include "Commands/DisableProgrammingMode.hpp"
+#include "Commands/LoadProgramImage.hpp"
+#include "Commands/StartProgramCounterSampling.hpp"
+#include "Commands/StopProgramCounterSampling.hpp"
+#include "Commands/StartCoverageCollection.hpp"
+#include "Commands/StopCoverageCollection.hpp"
+#include "Commands/StartTracing.hpp"
+#include "Commands/StopTracing.hpp"
+#include "Commands/GetTraceStatus.hpp"
+#include "Commands/ReadTraceFrames.hpp"
+#include "Commands/StartLiveSampling.hpp"
+#include "Commands/StopLiveSampling.hpp"
+#include "Commands/GetLiveSamples.hpp"
+#include "Commands/StartTimingAnalysis.hpp"
+#include "Commands/GetTimingAnalysisReport.hpp"
+#include "Commands/StopTimingAnalysis.hpp"
+#include "Commands/StartMemoryChangeTimeline.hpp"
+#include "Commands/StopMemoryChangeTimeline.hpp"
+#include "Commands/GetMemoryChanges.hpp"
+#include "Commands/GetLastMemoryChange.hpp"
+#include "Commands/CaptureCheckpoint.hpp"
+#include "Commands/RestoreCheckpoint.hpp"
+#include "Commands/CommandBatch.hpp"
+#include "Commands/CancelCommand.hpp"
 
 // Responses
 #include "Responses/Response.hpp"
@@ -51,15 +94,29 @@
 #include "Responses/TargetState.hpp"
 #include "Responses/TargetRegistersRead.hpp"
 #include "Responses/TargetMemoryRead.hpp"
+#include "Responses/TargetMemoryCrc.hpp"
+#include "Responses/ProgramCounterSamples.hpp"
+#include "Responses/CoverageReport.hpp"
+#include "Responses/TraceStatus.hpp"
+#include "Responses/TraceFrames.hpp"
+#include "Responses/LiveSamples.hpp"
+#include "Responses/TimingAnalysisReport.hpp"
+#include "Responses/MemoryChanges.hpp"
+#include "Responses/LastMemoryChange.hpp"
+#include "Responses/TargetMemoryFilled.hpp"
+#include "Responses/TargetMemorySearchResult.hpp"
 #include "Responses/TargetPinStates.hpp"
 #include "Responses/TargetStackPointer.hpp"
 #include "Responses/TargetProgramCounter.hpp"
+#include "Responses/ProgramImageLoaded.hpp"
+#include "Responses/CommandBatchResponses.hpp"
 
 #include "src/DebugToolDrivers/DebugTools.hpp"
 #include "src/Targets/Target.hpp"
 #include "src/Targets/Targets.hpp"
 #include "src/Targets/TargetRegister.hpp"
 #include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/Microchip/AVR/AVR8/InstructionDecoder.hpp"
 
 #include "src/EventManager/EventManager.hpp"
 #include "src/EventManager/EventListener.hpp"
@@ -81,34 +138,406 @@ namespace Bloom::TargetController
     class TargetControllerComponent: public Thread
     {
     public:
+        /**
+         * The first TargetController to be constructed becomes the default TargetController - the one that receives
+         * commands queued via TargetControllerComponent::registerCommand(). Bloom usually runs a single
+         * TargetController. Others (see the "program" command) must be addressed directly, via
+         * TargetControllerComponent::queueCommand().
+         *
+         * @param projectConfig
+         * @param environmentConfig
+         */
         explicit TargetControllerComponent(
             const ProjectConfig& projectConfig,
             const EnvironmentConfig& environmentConfig
         );
 
+        ~TargetControllerComponent() override;
+
         /**
          * Entry point for the TargetController.
          */
         void run();
 
-        static void registerCommand(std::unique_ptr<Commands::Command> command);
+        /**
+         * Queues a command for the default TargetController. Safe to call from any thread.
+         *
+         * @param command
+         *
+         * @return
+         *  A future for the command's response. Only the caller is woken when the response is delivered.
+         */
+        static std::future<std::unique_ptr<Responses::Response>> registerCommand(
+            std::unique_ptr<Commands::Command> command
+        );
 
-        static std::optional<std::unique_ptr<Responses::Response>> waitForResponse(
-            Commands::CommandIdType commandId,
-            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        /**
+         * Queues a command for this TargetController. Safe to call from any thread.
+         *
+         * If the TargetController shuts down before processing the command, the returned future will hold a
+         * std::future_error (broken promise).
+         *
+         * @param command
+         *
+         * @return
+         */
+        std::future<std::unique_ptr<Responses::Response>> queueCommand(std::unique_ptr<Commands::Command> command);
+
+        /**
+         * Returns the descriptor published by the default TargetController. Safe to call from any thread.
+         *
+         * See TargetControllerComponent::getPublishedTargetDescriptor().
+         *
+         * @param includeVariants
+         *
+         * @return
+         */
+        static std::shared_ptr<const Targets::TargetDescriptor> getDefaultPublishedTargetDescriptor(
+            bool includeVariants
         );
 
+        /**
+         * Returns the target descriptor published by this TargetController, upon activation. Safe to call from any
+         * thread.
+         *
+         * The descriptor is immutable, and remains valid for as long as the caller holds the handle, even after the
+         * TargetController has been suspended.
+         *
+         * @param includeVariants
+         *  Whether the descriptor must include the target variants (see Commands::GetTargetDescriptor).
+         *
+         * @return
+         *  A null pointer if the TargetController is not active, or if the variants were requested but haven't yet
+         *  been loaded. In which case, the caller should fall back to the GetTargetDescriptor command.
+         */
+        std::shared_ptr<const Targets::TargetDescriptor> getPublishedTargetDescriptor(bool includeVariants);
+
     private:
-        static inline SyncSafe<
-            std::queue<std::unique_ptr<Commands::Command>>
-        > commandQueue;
+        /**
+         * A queued command, along with the promise through which its response will be delivered.
+         */
+        struct QueuedCommand
+        {
+            std::unique_ptr<Commands::Command> command;
+            std::promise<std::unique_ptr<Responses::Response>> responsePromise;
+
+            /**
+             * For the "targetController.queueWaitUs" metric.
+             */
+            std::chrono::steady_clock::time_point queuedTime;
+        };
+
+        /**
+         * See TargetControllerComponent::registerCommand().
+         */
+        static inline std::atomic<TargetControllerComponent*> defaultInstance = nullptr;
+
+        MpscQueue<QueuedCommand> commandQueue;
+
+        /**
+         * Reused for every take from the command queue, to avoid allocating a new vector each time.
+         */
+        std::vector<QueuedCommand> takenCommands;
+
+        /**
+         * Commands taken from the command queue, awaiting processing, mapped by priority. Higher priority commands
+         * are processed first. Commands of the same priority are processed in the order they were queued.
+         */
+        std::map<Commands::CommandPriority, std::deque<QueuedCommand>> pendingCommandsByPriority;
+
+        /**
+         * Memory reads and writes larger than this are performed in chunks of this size. Between chunks, the
+         * TargetController services any pending commands of a higher priority and emits a
+         * TargetMemoryOperationProgress event.
+         */
+        static constexpr Targets::TargetMemorySize MEMORY_OPERATION_CHUNK_SIZE = 4096;
 
-        static inline SyncSafe<
-            std::map<Commands::CommandIdType, std::unique_ptr<Responses::Response>>
-        > responsesByCommandId;
+        /**
+         * Fills (see Commands::FillTargetMemory) are typically applied to EEPROM, which is much slower to write to
+         * than other memory types, so they're performed in smaller chunks, to provide finer progress reporting.
+         */
+        static constexpr Targets::TargetMemorySize MEMORY_FILL_CHUNK_SIZE = 256;
+
+        /**
+         * Buffered memory writes (see TargetControllerComponent::memoryWriteBuffersByType) are flushed once a
+         * buffer holds this many bytes. Writes larger than this are not buffered.
+         */
+        static constexpr Targets::TargetMemorySize MEMORY_WRITE_COMBINING_LIMIT =
+            TargetControllerComponent::MEMORY_OPERATION_CHUNK_SIZE;
 
-        static inline ConditionVariableNotifier notifier = ConditionVariableNotifier();
-        static inline std::condition_variable responsesByCommandIdCv = std::condition_variable();
+        /**
+         * The capacity of the trace buffer, in bytes (see TraceFrame::size()). Tracing stops once the buffer is full.
+         */
+        static constexpr std::size_t TRACE_BUFFER_SIZE = 1024 * 1024;
+
+        /**
+         * The capacity of the live sample buffer, in samples. Once the buffer is full, the oldest samples are
+         * evicted to make room for new ones.
+         */
+        static constexpr std::size_t LIVE_SAMPLE_BUFFER_CAPACITY = 16384;
+
+        /**
+         * When live sampling, variables separated by no more than this many bytes are read in a single span. Reading
+         * a few unused bytes is cheaper than issuing another read command.
+         */
+        static constexpr Targets::TargetMemorySize LIVE_SAMPLE_MAX_SPAN_GAP = 16;
+
+        /**
+         * The capacity of the memory change timeline, in bytes (see MemoryChangeTimeline::getSize()). The timeline
+         * stops recording once it's full.
+         */
+        static constexpr std::size_t MEMORY_CHANGE_TIMELINE_SIZE = 4 * 1024 * 1024;
+
+        /**
+         * Cancellation flags for the chunked memory operations that are currently in progress, mapped by the ID of
+         * the command that initiated the operation. See TargetControllerComponent::handleCancelCommand().
+         */
+        std::map<Commands::CommandIdType, bool> cancellationRequestedByCommandId;
+
+        /**
+         * The address range of the range step that is currently in progress, if any.
+         *
+         * Whilst a range step is in progress, each time the target stops, we check if the program counter is still
+         * within this range. If it is, we step again, without reporting the stop to other components. See
+         * TargetControllerComponent::fireTargetEvents().
+         */
+        std::optional<Targets::TargetMemoryAddressRange> activeStepRange;
+
+        /**
+         * Parameters of the range step in progress (see StepTargetExecution::sourceLine and
+         * StepTargetExecution::stepOverCalls).
+         */
+        bool activeStepSourceLine = false;
+        bool activeStepOverCalls = false;
+
+        /**
+         * The stack pointer at the beginning of the range step in progress. Only captured when a call could be
+         * stepped over (that is, when this->activeStepOverCalls is set, or a line table is available).
+         */
+        std::optional<Targets::TargetStackPointer> activeStepStackPointer;
+
+        /**
+         * The address the target was last resumed to run to, if any (see ResumeTargetExecution::toAddress).
+         */
+        std::optional<Targets::TargetMemoryAddress> runToAddress;
+
+        /**
+         * When stepping over a call, the target runs to the call's return address. These hold the return address
+         * and the stack pointer value that will be restored upon return - a hit at the return address with a lower
+         * stack pointer belongs to a recursive invocation.
+         */
+        std::optional<Targets::TargetMemoryAddress> activeStepReturnAddress;
+        std::optional<Targets::TargetStackPointer> activeStepReturnStackPointer;
+
+        /**
+         * Whether the target was last resumed with a (single or range) step. Breakpoint conditions are not evaluated
+         * for halts caused by a step - the step must always be reported.
+         */
+        bool steppingExecution = false;
+
+        /**
+         * Set upon receiving a deferred ResetTarget command (see Commands::ResetTarget::deferred).
+         *
+         * The reset is performed just before we service the next command that could observe or depend on it (see
+         * TargetControllerComponent::pendingTargetResetRequired()) - most notably, a request to resume or step
+         * execution. If that command is a ResetTarget command, the pending reset is dropped in favour of it.
+         *
+         * This allows the GDB server to defer the reset that follows the programming of the target, as GDB tends to
+         * issue its own reset or resume immediately afterwards - the target is then reset once, not twice.
+         */
+        bool targetResetPending = false;
+
+        /**
+         * A program counter value set whilst a reset was pending. The value is restored after the pending reset has
+         * been performed, as it would have been set after the reset, had the reset not been deferred.
+         */
+        std::optional<Targets::TargetProgramCounter> pendingResetProgramCounter;
+
+        /**
+         * The event loop timer that drives program counter sampling, whilst sampling is active. See
+         * TargetControllerComponent::sampleProgramCounter().
+         */
+        std::optional<EventLoop::TimerId> programCounterSamplingTimerId;
+
+        /**
+         * The program counter samples collected since sampling was started (see
+         * Commands::StartProgramCounterSampling), mapped by program counter value.
+         */
+        std::map<Targets::TargetProgramCounter, std::uint64_t> programCounterSampleCounts;
+        std::uint64_t skippedProgramCounterSampleCount = 0;
+        std::chrono::steady_clock::time_point programCounterSamplingStartTime;
+
+        struct CoverageSession
+        {
+            /**
+             * The instrumented addresses, in ascending order, and whether each of them has been hit.
+             */
+            std::vector<Targets::TargetMemoryAddress> addresses;
+            std::vector<bool> hits;
+
+            std::size_t batchSize = 0;
+
+            /**
+             * Index (into this->addresses) of the next address to consider, when arming coverage breakpoints.
+             */
+            std::size_t cursor = 0;
+
+            /**
+             * The coverage breakpoints currently requested from the breakpoint manager. Breakpoints requested by other
+             * components (GDB) are never included here, even if they're at an instrumented address.
+             */
+            std::set<Targets::TargetMemoryAddress> armedAddresses;
+
+            std::uint64_t sweepCount = 0;
+            EventLoop::TimerId sweepTimerId = 0;
+            std::chrono::steady_clock::time_point startTime;
+        };
+
+        /**
+         * Code coverage collection state, whilst coverage collection is active. See
+         * TargetControllerComponent::recordCoverageHit().
+         */
+        std::optional<CoverageSession> coverageSession;
+
+        struct TimingSession
+        {
+            TimingAnalysisResults results;
+
+            /**
+             * The timing breakpoints that we placed. Breakpoints requested by other components (GDB) are never
+             * included here - halts at those are always reported.
+             */
+            std::set<Targets::TargetMemoryAddress> ownedAddresses;
+
+            /**
+             * Set when the current interval has started (the start address has been hit, and the end address has
+             * not yet been hit).
+             */
+            std::optional<std::chrono::steady_clock::time_point> intervalStartTime;
+            std::optional<std::uint64_t> intervalStartTimerValue;
+        };
+
+        /**
+         * Timing analysis state. Retained after the analysis has completed, until the next analysis is started (or
+         * the analysis is stopped), so that the results can be retrieved.
+         */
+        std::optional<TimingSession> timingSession;
+
+        struct TargetCheckpoint
+        {
+            Targets::TargetMemoryAddress ramStartAddress = 0;
+            Targets::TargetMemoryBuffer ramData;
+            Targets::TargetRegisters registers;
+        };
+
+        /**
+         * The state captured via Commands::CaptureCheckpoint.
+         *
+         * The checkpoint is discarded when the program memory changes, as the captured state is only meaningful to
+         * the program that was running when it was captured.
+         */
+        std::optional<TargetCheckpoint> checkpoint;
+
+        /**
+         * The conditions of all conditional breakpoints, mapped by breakpoint address. Breakpoints without conditions
+         * have no entry here. See TargetControllerComponent::breakpointConditionsMet().
+         */
+        std::map<Targets::TargetMemoryAddress, std::vector<AgentExpression>> breakpointConditionsByAddress;
+
+        struct TraceSession
+        {
+            bool running = false;
+
+            /**
+             * The tracepoints of the current (or last) trace experiment, mapped by address. GDB permits more than one
+             * tracepoint at the same address.
+             */
+            std::map<Targets::TargetMemoryAddress, std::vector<Tracepoint>> tracepointsByAddress;
+            std::map<std::uint32_t, std::uint64_t> hitCountsByTracepointNumber;
+
+            /**
+             * The breakpoints we've requested for the tracepoints. As with coverage breakpoints, this excludes any
+             * breakpoints that were already requested by other components.
+             */
+            std::set<Targets::TargetMemoryAddress> ownedAddresses;
+
+            std::vector<TraceFrame> frames;
+            std::size_t bufferUsed = 0;
+
+            TraceStopReason stopReason = TraceStopReason::NOT_RUN;
+            std::uint32_t stopTracepointNumber = 0;
+        };
+
+        /**
+         * The state of the current (or last) trace experiment. Collected frames are retained after the experiment is
+         * stopped, until the next one is started. See TargetControllerComponent::recordTraceFrames().
+         */
+        TraceSession traceSession;
+
+        struct LiveSamplingSession
+        {
+            /**
+             * A contiguous range of memory, read in one go upon each sample, holding one or more of the sampled
+             * variables.
+             */
+            struct Span
+            {
+                Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::RAM;
+                Targets::TargetMemoryAddress startAddress = 0;
+                Targets::TargetMemorySize size = 0;
+
+                /**
+                 * Indices (into LiveSamplingSession::variables) of the variables that reside in this span.
+                 */
+                std::vector<std::size_t> variableIndices;
+            };
+
+            std::vector<LiveSampleVariable> variables;
+            std::vector<Span> spans;
+
+            std::deque<LiveSample> samples;
+            std::uint64_t nextSequenceNumber = 0;
+            std::uint64_t droppedSampleCount = 0;
+            std::uint64_t skippedSampleCount = 0;
+
+            /**
+             * Only set whilst sampling is active.
+             */
+            std::optional<EventLoop::TimerId> timerId;
+            std::chrono::steady_clock::time_point startTime;
+        };
+
+        /**
+         * The state of the current (or last) live sampling session. See TargetControllerComponent::takeLiveSample().
+         */
+        LiveSamplingSession liveSamplingSession;
+
+        struct MemoryChangeTimelineSession
+        {
+            MemoryChangeTimeline timeline;
+            bool active = true;
+            std::chrono::steady_clock::time_point startTime;
+        };
+
+        /**
+         * The current (or last) memory change timeline. Retained after the timeline is stopped, until the next one
+         * is started. See TargetControllerComponent::recordMemoryChanges().
+         */
+        std::optional<MemoryChangeTimelineSession> memoryChangeTimelineSession;
+
+        /**
+         * All breakpoints are managed by the breakpoint manager. It's reset upon (re)activating the target, and
+         * committed before the target resumes execution.
+         *
+         * A range step ends upon reaching any of the breakpoints.
+         */
+        BreakpointManager breakpointManager;
+
+        /**
+         * The TC thread waits on this event loop, between iterations of its run loop. The loop is woken up upon the
+         * queueing of a command, or the registration of an event on this->eventListener.
+         */
+        EventLoop eventLoop;
 
         /**
          * The TC starts off in a suspended state. TargetControllerComponent::resume() is invoked from the start up
@@ -127,10 +556,50 @@ namespace Bloom::TargetController
         std::unique_ptr<Targets::Target> target = nullptr;
         std::unique_ptr<DebugTool> debugTool = nullptr;
 
-        std::map<
-            Commands::CommandType,
-            std::function<std::unique_ptr<Responses::Response>(Commands::Command&)>
-        > commandHandlersByCommandType;
+        /**
+         * How long we wait, after the debug tool has been reconnected, before attempting to reacquire it. Debug
+         * tools typically need a moment to initialise, after enumeration.
+         */
+        static constexpr auto DEBUG_TOOL_RECONNECTION_DELAY = std::chrono::milliseconds(1000);
+
+        /**
+         * The USB vendor and product ID of the selected debug tool, recorded upon acquiring the hardware.
+         */
+        std::optional<std::pair<std::uint16_t, std::uint16_t>> debugToolUsbId;
+
+        /**
+         * Set when the TargetController has been suspended due to a device failure. Whilst set, the reconnection
+         * of the debug tool (as reported by the UsbDeviceRegistry) will trigger an immediate attempt to reacquire
+         * the hardware, as opposed to waiting for the next debug session.
+         */
+        bool awaitingDebugToolReconnection = false;
+
+        /**
+         * The timer for the current debug session linger period, if a session is lingering (see
+         * DebugServerConfig::sessionLingerPeriod).
+         */
+        std::optional<EventLoop::TimerId> debugSessionLingerTimerId;
+
+        using CommandHandler = std::unique_ptr<Responses::Response> (*)(
+            TargetControllerComponent&,
+            Commands::Command&
+        );
+
+        /**
+         * Command handlers, indexed by command type. Types with no registered handler map to nullptr.
+         *
+         * See TargetControllerComponent::registerCommandHandler().
+         */
+        std::array<CommandHandler, Commands::COMMAND_TYPE_COUNT> commandHandlersByCommandType = {};
+
+        /**
+         * The time taken to handle each command (in microseconds), indexed by command type. Populated upon the
+         * registration of each command handler.
+         */
+        std::array<
+            Services::MetricsService::Histogram*,
+            Commands::COMMAND_TYPE_COUNT
+        > commandLatencyHistogramsByCommandType = {};
 
         EventListenerPointer eventListener = std::make_shared<EventListener>("TargetControllerEventListener");
 
@@ -143,36 +612,129 @@ namespace Bloom::TargetController
 
         /**
          * Obtaining a TargetDescriptor for the connected target can be quite expensive. We cache it here.
+         *
+         * The cached descriptor is never modified - it's shared with other components (see
+         * TargetControllerComponent::publishedTargetDescriptor). The target variants are only loaded upon the first
+         * request for them (see Commands::GetTargetDescriptor::includeVariants), at which point we replace the cached
+         * descriptor with a copy that includes them.
+         */
+        std::shared_ptr<const Targets::TargetDescriptor> cachedTargetDescriptor;
+        bool cachedTargetDescriptorIncludesVariants = false;
+
+        struct PublishedTargetDescriptor
+        {
+            std::shared_ptr<const Targets::TargetDescriptor> descriptor;
+            bool includesVariants = false;
+        };
+
+        /**
+         * The cached target descriptor, as published to other threads. Cleared upon suspension.
+         */
+        SyncSafe<PublishedTargetDescriptor> publishedTargetDescriptor;
+
+        /**
+         * Indices of target register descriptors, mapped by the memory type on which the registers are stored.
+         */
+        std::map<Targets::TargetMemoryType, RegisterDescriptorIndex> registerDescriptorIndicesByMemoryType;
+
+        /**
+         * Target state captured as soon as the target halts, when the stop prefetch is enabled (see
+         * TargetConfig::stopPrefetch).
+         */
+        struct StopSnapshot
+        {
+            std::map<Targets::TargetRegisterDescriptor, Targets::TargetMemoryBuffer> registerValuesByDescriptor;
+            std::optional<Targets::TargetStackPointer> stackPointer;
+            std::optional<Targets::TargetProgramCounter> programCounter;
+
+            Targets::TargetMemoryAddress stackWindowStartAddress = 0;
+            Targets::TargetMemoryBuffer stackWindow;
+        };
+
+        /**
+         * Register and memory reads are serviced from the snapshot (where possible) until it's invalidated. The
+         * snapshot must be invalidated whenever the target resumes execution, or any of its state is modified.
+         *
+         * See TargetControllerComponent::captureStopSnapshot().
+         */
+        std::optional<StopSnapshot> stopSnapshot;
+
+        /**
+         * Memory caches, mapped by memory type. Caches are constructed upon the first read of the memory type.
+         *
+         * Memory reads are serviced from these caches while the target is stopped. The caches are invalidated whenever
+         * the target resumes execution or is reset, and on any write to target memory (for the affected range).
          */
-        std::optional<const Targets::TargetDescriptor> cachedTargetDescriptor;
+        std::map<Targets::TargetMemoryType, TargetMemoryCache> memoryCachesByType;
 
         /**
-         * Target register descriptors mapped by the memory type on which the register is stored.
+         * The known contents of the target's program memory, populated by program memory writes (and the reads
+         * required to verify them), and by program memory reads (see
+         * TargetControllerComponent::readProgramMemoryFromMirror()).
+         *
+         * The target may rewrite its own program memory (self-programming), so this cache is discarded whenever the
+         * target resumes execution, unless the user has opted in to the program memory mirror
+         * (TargetConfig::programMemoryMirror). In that case, it's retained for as long as we hold the debug tool,
+         * which spans numerous debug sessions, unless the tool is released after each session. See
+         * TargetControllerComponent::writeProgramMemory() and
+         * TargetControllerComponent::invalidateProgramMemoryContents().
+         */
+        std::optional<TargetMemoryCache> programMemoryContents;
+
+        /**
+         * Write-combining buffers for RAM and EEPROM writes, mapped by memory type. See
+         * TargetConfig::memoryWriteCombining.
+         *
+         * Buffered writes are flushed before we service any command that could observe them, or otherwise depends on
+         * them (see TargetControllerComponent::memoryWriteFlushRequired()). A buffer is only present in this map
+         * whilst it holds writes.
+         */
+        std::map<Targets::TargetMemoryType, TargetMemoryWriteBuffer> memoryWriteBuffersByType;
+
+        /**
+         * The ID of the target variant for which pin states are being streamed, if any.
+         *
+         * See TargetControllerComponent::streamPinStates().
          */
-        std::map<Targets::TargetMemoryType, Targets::TargetRegisterDescriptors> registerDescriptorsByMemoryType;
+        std::optional<int> pinStateStreamVariantId;
 
         /**
-         * Memory address ranges for target registers, mapped by the register memory type.
+         * The pin states from the last read, for the streamed variant. Each read is compared against this, so that
+         * TargetPinStatesChanged events only carry the pins that have changed.
          */
-        std::map<Targets::TargetMemoryType, Targets::TargetMemoryAddressRange> registerAddressRangeByMemoryType;
+        std::optional<Targets::TargetPinStateMapping> lastStreamedPinStates;
+
+        std::chrono::steady_clock::time_point lastPinStateStreamReadTime = {};
 
         /**
-         * Registers a handler function for a particular command type.
-         * Only one handler function can be registered per command type.
+         * Registers a handler member function for a particular command type.
+         * Only one handler function can be registered per command type - subsequent registrations replace the
+         * existing handler.
+         *
+         * The handler is bound at compile time, so invoking it costs a single indirect call, with no allocation.
          *
          * @tparam CommandType
-         * @param callback
-         */
-        template<class CommandType>
-        void registerCommandHandler(std::function<std::unique_ptr<Responses::Response>(CommandType&)> callback) {
-            this->commandHandlersByCommandType.insert(
-                std::pair(
-                    CommandType::type,
-                    [callback] (Commands::Command& command) {
-                        // Downcast the command to the expected type
-                        return callback(dynamic_cast<CommandType&>(command));
-                    }
-                )
+         * @tparam handler
+         *  Member function of the form std::unique_ptr<ResponseType> handleX(CommandType&).
+         */
+        template<class CommandType, auto handler>
+        void registerCommandHandler() {
+            constexpr auto index = static_cast<std::size_t>(CommandType::type);
+            static_assert(index < Commands::COMMAND_TYPE_COUNT, "Command type out of range");
+
+            this->commandHandlersByCommandType[index] = [] (
+                TargetControllerComponent& targetController,
+                Commands::Command& command
+            ) -> std::unique_ptr<Responses::Response> {
+                /*
+                 * Downcast the command to the expected type. Handlers are looked up via Command::getType(), and each
+                 * command class has a unique type tag, so a static_cast is safe here.
+                 */
+                return (targetController.*handler)(static_cast<CommandType&>(command));
+            };
+
+            this->commandLatencyHistogramsByCommandType[index] = &(
+                Services::MetricsService::histogram("targetController.commandLatencyUs." + CommandType::name)
             );
         }
 
@@ -194,7 +756,7 @@ namespace Bloom::TargetController
         void setThreadStateAndEmitEvent(ThreadState state) {
             this->setThreadState(state);
             EventManager::triggerEvent(
-                std::make_shared<Events::TargetControllerThreadStateChanged>(state)
+                Events::makeEvent<Events::TargetControllerThreadStateChanged>(state)
             );
         }
 
@@ -226,13 +788,25 @@ namespace Bloom::TargetController
         void processQueuedCommands();
 
         /**
-         * Records a response for a given command ID. Notifies the TargetControllerComponent::responsesByCommandIdCv
-         * condition variable of the new response.
+         * Processes pending commands, in order of priority, until none remain. The command queue is checked before
+         * each command is processed, so that newly queued commands of a higher priority will be processed first.
          *
-         * @param commandId
-         * @param response
+         * @param priorityThreshold
+         *  If provided, only commands of a higher priority than this will be processed. This is used to service
+         *  higher priority commands between the individual commands of a lower priority command batch.
          */
-        void registerCommandResponse(Commands::CommandIdType commandId, std::unique_ptr<Responses::Response> response);
+        void processPendingCommands(std::optional<Commands::CommandPriority> priorityThreshold = std::nullopt);
+
+        /**
+         * Checks if the given command can be serviced in the TargetController's current state, and invokes the
+         * appropriate handler.
+         *
+         * @param command
+         *
+         * @return
+         *  The handler's response, or an Error response if the command was rejected or the handler threw an exception.
+         */
+        std::unique_ptr<Responses::Response> processCommand(Commands::Command& command);
 
         /**
          * Exit point - must be called before the TargetController thread is terminated.
@@ -258,6 +832,20 @@ namespace Bloom::TargetController
          */
         void acquireHardware();
 
+        /**
+         * Loads the TDF for the given target name on a separate thread, if the name maps to a specific target. This
+         * allows the TDF to be parsed whilst we're connecting to the debug tool. Once loaded, the TDF is retained
+         * for the target's construction (see Avr8Bit::TargetDescription::TargetDescriptionFile::getShared()).
+         *
+         * Failures are ignored here - they'll resurface when the target is constructed.
+         *
+         * @param targetName
+         *
+         * @return
+         *  A future for the completion of the load. Destroying the future will block until the load has completed.
+         */
+        std::future<void> preloadTargetDescriptionFile(const std::string& targetName);
+
         /**
          * Attempts to gracefully disconnect from the debug tool and the target. All control of the debug tool and
          * target will cease.
@@ -265,28 +853,516 @@ namespace Bloom::TargetController
         void releaseHardware();
 
         /**
-         * Extracts address ranges and groups target register descriptors.
+         * Has the TargetController's event loop deliver USB hotplug events (see Usb::UsbDeviceRegistry), so that we
+         * can reacquire the debug tool as soon as it has been reconnected.
+         */
+        void startUsbHotplugMonitoring();
+
+        /**
+         * Invoked by the UsbDeviceRegistry upon the arrival of a USB device of interest.
+         *
+         * @param vendorId
+         * @param productId
+         */
+        void onUsbDeviceArrival(std::uint16_t vendorId, std::uint16_t productId);
+
+        /**
+         * Attempts to wake the TargetController after the debug tool has been reconnected.
+         */
+        void reacquireHardware();
+
+        /**
+         * Populates this->registerDescriptorIndicesByMemoryType with the target's register descriptors.
          */
         void loadRegisterDescriptors();
 
         /**
-         * Resolves the descriptors of all target registers found within the given address range and memory type.
+         * Should fire any events queued on the target.
+         */
+        void fireTargetEvents();
+
+        /**
+         * Determines how long the TargetController can sleep for, before it must poll the target.
+         *
+         * @return
+         *  The timeout, or std::nullopt if there's no need to wake up until notified.
+         */
+        [[nodiscard]] std::optional<std::chrono::milliseconds> getPollTimeout() const;
+
+        /**
+         * Reads the pin states of the streamed variant and emits a TargetPinStatesChanged event for any that have
+         * changed since the last read.
+         *
+         * Does nothing if pin state streaming isn't active, the target isn't stopped, or the pin state poll interval
+         * (TargetConfig::pinStatePollInterval) hasn't elapsed since the last read.
+         */
+        void streamPinStates();
+
+        /**
+         * Takes a single program counter sample: stops the target, reads the program counter and resumes execution.
+         *
+         * This is invoked directly from this->eventLoop, on the TC thread, so samples don't go through the command
+         * queue. The target is stopped and resumed silently - no TargetExecutionStopped/Resumed events are fired, so
+         * other components are unaware of the sampling.
+         *
+         * If the target isn't running (it's stopped at a breakpoint, for example), the sample is skipped.
+         */
+        void sampleProgramCounter();
+
+        /**
+         * Stops program counter sampling, if it's active. Collected samples are retained until sampling is started
+         * again.
+         */
+        void stopProgramCounterSampling();
+
+        /**
+         * Reads the current value of each live sampled variable (one read per span), and appends the sample to the
+         * live sample buffer.
+         *
+         * This is invoked directly from this->eventLoop, on the TC thread. Unlike program counter sampling, the target
+         * is never stopped - live sampling is only permitted on targets that support memory access whilst running
+         * (see Target::runtimeMemoryAccessSupported()). Samples are also taken whilst the target is stopped.
+         */
+        void takeLiveSample();
+
+        /**
+         * Stops live sampling, if it's active. Collected samples are retained until sampling is started again.
+         */
+        void stopLiveSampling();
+
+        /**
+         * Records a coverage hit at the given program counter, if it's an instrumented address. Invoked each time the
+         * target stops, whilst coverage collection is active.
          *
+         * If the target stopped at one of our coverage breakpoints, the breakpoint is released (it's removed from the
+         * target lazily, upon the next commit, along with any others) and replaced with the next unhit address.
+         *
+         * @param programCounter
+         *
+         * @return
+         *  True if the target stopped at a coverage breakpoint, in which case the stop is our own, and the target
+         *  should be resumed without reporting it.
+         */
+        bool recordCoverageHit(Targets::TargetProgramCounter programCounter);
+
+        /**
+         * Reads the regions tracked by the memory change timeline and records the changes made since the last stop.
+         * Invoked each time the target stops (and the stop is reported), whilst the timeline is active.
+         *
+         * The regions are read via the memory caches (or in a single read, for regions larger than
+         * MEMORY_OPERATION_CHUNK_SIZE), so the reads can service the debug client's subsequent reads of the same
+         * memory.
+         *
+         * @param programCounter
+         */
+        void recordMemoryChanges(Targets::TargetProgramCounter programCounter);
+
+        /**
+         * Stops recording the memory change timeline, if it's active. The recorded changes are retained.
+         */
+        void stopMemoryChangeTimeline();
+
+        /**
+         * Records a timing breakpoint hit, if the target stopped at the start or end address of the timing analysis
+         * in progress. Invoked each time the target stops, whilst a timing analysis is in progress.
+         *
+         * A hit at the start address begins an interval. A hit at the end address ends the current interval (if
+         * any), and records its duration. Once all iterations have been measured, the timing breakpoints are
+         * released, and a TimingAnalysisCompleted event is triggered.
+         *
+         * @param programCounter
+         *
+         * @return
+         *  True if the target stopped at one of our timing breakpoints, in which case the target will have been
+         *  resumed, and the stop should not be reported.
+         */
+        bool handleTimingBreak(Targets::TargetProgramCounter programCounter);
+
+        /**
+         * Reads the timing analysis timer register, if one was given.
+         *
+         * @return
+         */
+        std::optional<std::uint64_t> readTimingTimerValue();
+
+        /**
+         * Releases the timing breakpoints, leaving the results in place. The breakpoints are removed from the target
+         * upon the next commit.
+         */
+        void releaseTimingBreakpoints();
+
+        /**
+         * Requests coverage breakpoints for the next unhit addresses, until the batch is full.
+         */
+        void armCoverageBreakpoints();
+
+        /**
+         * Swaps the unhit coverage breakpoints of the current batch for the next batch, so that all addresses are
+         * eventually instrumented, even when there are more of them than the batch size. Invoked periodically, from
+         * this->eventLoop.
+         */
+        void sweepCoverageBreakpoints();
+
+        /**
+         * Applies changes to the requested breakpoints (coverage breakpoints, tracepoints) immediately, if the target
+         * is running freely - by stopping it, committing the breakpoints and resuming it, silently.
+         *
+         * If the target is stopped, this does nothing - the changes will be committed when it resumes.
+         */
+        void applyBreakpointChanges();
+
+        /**
+         * Collects a trace frame for each enabled tracepoint at the given program counter, whose condition (if any)
+         * is met. Invoked each time the target stops, whilst a trace experiment is running.
+         *
+         * All registers to be collected are read in a single request, and memory reads are cached for the duration
+         * of the collection. Tracing is stopped if the trace buffer fills up or if a tracepoint reaches its pass
+         * count.
+         *
+         * @param programCounter
+         *
+         * @return
+         *  True if the target stopped at one of our tracepoint breakpoints, in which case the target should be
+         *  resumed without reporting the stop. False if there was no tracepoint at the program counter, or if another
+         *  component had also requested a breakpoint there.
+         */
+        bool recordTraceFrames(Targets::TargetProgramCounter programCounter);
+
+        /**
+         * Ends the current trace experiment and releases its tracepoint breakpoints (they're removed from the target
+         * upon the next commit).
+         *
+         * @param stopReason
+         * @param tracepointNumber
+         *  For TraceStopReason::PASS_COUNT, the number of the tracepoint that reached its pass count.
+         */
+        void stopTracing(TraceStopReason stopReason, std::uint32_t tracepointNumber = 0);
+
+        /**
+         * Reads register values for agent expression evaluation, in a single request.
+         *
+         * @param descriptors
+         *
+         * @return
+         *  The register values (in MSB form), mapped by descriptor.
+         */
+        std::map<Targets::TargetRegisterDescriptor, Targets::TargetMemoryBuffer> readExpressionRegisters(
+            const Targets::TargetRegisterDescriptors& descriptors
+        );
+
+        /**
+         * Constructs a memory reader for agent expression evaluation. Reads are cached per byte, in the given cache.
+         *
+         * We can't use the memory caches (this->memoryCachesByType) for this, as expressions are evaluated just
+         * before the target is resumed silently, without passing through the usual cache invalidation.
+         *
+         * @param cachedBytes
+         *  Must outlive the reader.
+         *
+         * @return
+         */
+        AgentExpression::MemoryReader createExpressionMemoryReader(
+            std::map<std::pair<Targets::TargetMemoryType, Targets::TargetMemoryAddress>, unsigned char>& cachedBytes
+        );
+
+        /**
+         * Evaluates the conditions of the breakpoint at the given address, if it has any.
+         *
+         * All registers referenced by the conditions are read from the target in a single request, and memory
+         * reads are cached for the duration of the evaluation. So a typical condition (comparing a variable or
+         * register with a constant) costs one or two reads.
+         *
+         * A condition that fails evaluation is considered met, so that the target halts and the user can see what's
+         * going on.
+         *
+         * @param address
+         *
+         * @return
+         *  True if the breakpoint is unconditional, or if any of its conditions are met. False otherwise, in which
+         *  case the target should be resumed silently.
+         */
+        bool breakpointConditionsMet(Targets::TargetMemoryAddress address);
+
+        /**
+         * Handles a stop whilst a range step is in progress (see this->activeStepRange) - steps again if the
+         * program counter is still within the range, runs to the return address if the target stepped into a call
+         * that should be stepped over, or ends the step.
+         *
+         * @return
+         *  True if the target was resumed (the step is still in progress), in which case the stop should not be
+         *  reported. False if the step has ended.
+         */
+        bool continueActiveStep();
+
+        /**
+         * Checks if the target has just stepped into a call (or an interrupt) made from within the range step in
+         * progress, that should be stepped over.
+         *
+         * A call is identified by the stack pointer having dropped below its value at the beginning of the step,
+         * with a return address at the top of the stack that lies within the step range (or immediately after it).
+         *
+         * @param programCounter
+         *  The callee's entry point.
+         *
+         * @return
+         *  The return address (byte address) of the call, if it should be stepped over.
+         */
+        std::optional<Targets::TargetMemoryAddress> stepOverReturnAddress(Targets::TargetProgramCounter programCounter);
+
+        /**
+         * Checks if the instruction at the program counter is a call that should be stepped over, as part of the
+         * range step in progress, and if so, runs the target to the instruction that follows the call.
+         *
+         * This saves us from stepping into the callee, only to identify the call via the stack (see
+         * TargetControllerComponent::stepOverReturnAddress()). It doesn't apply to indirect calls (ICALL, EICALL)
+         * unless this->activeStepOverCalls is set, as we can't tell whether the callee is covered by the line table.
+         *
+         * @param programCounter
+         *
+         * @return
+         *  True if the target was resumed.
+         */
+        bool runOverCallInstruction(Targets::TargetProgramCounter programCounter);
+
+        /**
+         * Decodes the instruction at the given address, from our record of the target's program memory, where
+         * possible (see TargetControllerComponent::readProgramMemoryFromMirror()).
+         *
+         * @param address
+         *
+         * @return
+         *  std::nullopt if the address is outside of program memory, or the opcode is undefined.
+         */
+        std::optional<Targets::Microchip::Avr::Avr8Bit::Instruction> decodeInstruction(
+            Targets::TargetMemoryAddress address
+        );
+
+        /**
+         * Clears all range step state.
+         */
+        void endActiveStep();
+
+        /**
+         * Reads the target's CPU registers and a window of stack memory, and stores them in this->stopSnapshot.
+         *
+         * Does nothing if the stop prefetch is disabled.
+         */
+        void captureStopSnapshot();
+
+        /**
+         * Discards the current stop snapshot, if any.
+         */
+        void invalidateStopSnapshot() {
+            this->stopSnapshot = std::nullopt;
+        }
+
+        /**
+         * Attempts to service a register read from the stop snapshot.
+         *
+         * @param descriptors
+         *
+         * @return
+         *  The register values, or std::nullopt if any of the requested registers are not in the snapshot.
+         */
+        std::optional<Targets::TargetRegisters> readRegistersFromStopSnapshot(
+            const Targets::TargetRegisterDescriptors& descriptors
+        );
+
+        /**
+         * Attempts to service a program memory read from our record of the target's program memory
+         * (this->programMemoryContents). Any pages that we haven't seen before are read from the target, and retained.
+         *
+         * See TargetConfig::programMemoryMirror.
+         *
+         * @param command
+         *
+         * @return
+         *  The memory buffer, or std::nullopt if the read cannot be serviced from the record (in which case, it
+         *  should be serviced via the usual route).
+         */
+        std::optional<Targets::TargetMemoryBuffer> readProgramMemoryFromMirror(
+            const Commands::ReadTargetMemory& command
+        );
+
+        /**
+         * Attempts to service a memory read from the stop snapshot.
+         *
+         * @param command
+         *
+         * @return
+         *  The memory buffer, or std::nullopt if the requested memory is not in the snapshot.
+         */
+        std::optional<Targets::TargetMemoryBuffer> readMemoryFromStopSnapshot(
+            const Commands::ReadTargetMemory& command
+        );
+
+        /**
+         * Invalidates all memory caches.
+         */
+        void invalidateMemoryCaches();
+
+        /**
+         * Discards our record of the target's program memory (this->programMemoryContents), in preparation for target
+         * execution - unless the program memory mirror is enabled, in which case the user has told us that the
+         * program memory can only change via us.
+         *
+         * See TargetConfig::programMemoryMirror.
+         */
+        void invalidateProgramMemoryContents();
+
+        /**
+         * Invalidates the cached memory within the given address range, for a particular memory type.
+         *
+         * @param memoryType
          * @param startAddress
-         * @param endAddress
+         * @param bytes
+         */
+        void invalidateMemoryCache(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes
+        );
+
+        /**
+         * Logs the hit/miss counts of each memory cache.
+         */
+        void logMemoryCacheStatistics();
+
+        /**
+         * Checks if the given memory write can be buffered (see TargetControllerComponent::memoryWriteBuffersByType).
+         *
+         * Only EEPROM writes and RAM writes that fall entirely within the RAM memory descriptor's address range can
+         * be buffered. On AVR8 targets, the register file and I/O registers reside below that range, and writes to
+         * them can have side effects (clearing interrupt flags, transmitting UART data, timed sequences, etc) - such
+         * writes must reach the target exactly as issued, and in order.
+         *
+         * Writes that overlap a buffered write are not combinable either, so that no write is ever replaced by a
+         * later one - the buffer is flushed first.
+         *
+         * @param command
+         * @return
+         */
+        [[nodiscard]] bool memoryWriteCombinable(const Commands::WriteTargetMemory& command);
+
+        /**
+         * Checks if the buffered memory writes must be flushed before the given command is serviced.
+         *
+         * Only combinable memory writes, reads that don't intersect with any buffered write and a few state queries
+         * can be serviced with writes held in the buffers.
+         *
+         * @param command
+         * @return
+         */
+        [[nodiscard]] bool memoryWriteFlushRequired(const Commands::Command& command);
+
+        /**
+         * Checks if the pending (deferred) target reset must be performed before the given command is serviced.
+         *
+         * Only state queries, breakpoint changes (breakpoints are committed upon resuming execution), program memory
+         * reads and program counter changes can be serviced with the reset still pending.
+         *
+         * @param command
+         * @return
+         */
+        [[nodiscard]] bool pendingTargetResetRequired(const Commands::Command& command);
+
+        /**
+         * Performs the pending target reset, restoring any program counter value that was set whilst it was pending.
+         */
+        void performPendingTargetReset();
+
+        /**
+         * Writes all buffered memory writes to the target. The buffers are emptied even if a write fails.
+         */
+        void flushMemoryWriteBuffers();
+
+        /**
+         * Writes to the target's memory, invalidating the affected caches and triggering the relevant events.
+         *
+         * This is where TargetControllerComponent::handleWriteTargetMemory() ends up, for writes that aren't
+         * buffered, and where buffered writes end up when they're flushed.
+         *
+         * @param command
+         */
+        void writeTargetMemory(const Commands::WriteTargetMemory& command);
+
+        /**
+         * Returns the name of the given memory type, for log messages and metric names.
+         *
          * @param memoryType
          * @return
          */
-        Targets::TargetRegisterDescriptors getRegisterDescriptorsWithinAddressRange(
+        static const std::string& getMemoryTypeName(Targets::TargetMemoryType memoryType);
+
+        /**
+         * Reads target memory, in chunks of MEMORY_OPERATION_CHUNK_SIZE bytes. See
+         * TargetControllerComponent::completeMemoryOperationChunk() for what happens between chunks.
+         *
+         * @param command
+         * @return
+         */
+        Targets::TargetMemoryBuffer readTargetMemoryInChunks(const Commands::ReadTargetMemory& command);
+
+        /**
+         * Writes to target memory, in chunks of MEMORY_OPERATION_CHUNK_SIZE bytes.
+         *
+         * @param command
+         *  The command that initiated the write.
+         *
+         * @param startAddress
+         * @param buffer
+         */
+        void writeTargetMemoryInChunks(
+            const Commands::WriteTargetMemory& command,
             Targets::TargetMemoryAddress startAddress,
-            Targets::TargetMemoryAddress endAddress,
-            Targets::TargetMemoryType memoryType
+            const Targets::TargetMemoryBuffer& buffer
         );
 
         /**
-         * Should fire any events queued on the target.
+         * Writes to the target's program memory, skipping any pages that already hold the desired content (according
+         * to this->programMemoryContents). Pages with unknown content are read from the target first.
+         *
+         * If the target doesn't support rewriting individual pages (see
+         * Target::programMemoryPageRewritesSupported()), and at least one of the changed pages is not in its erased
+         * state, the program memory is erased and every page of the buffer that isn't in its erased state (all 0xFF)
+         * is written (see TargetControllerComponent::eraseAndWriteProgramMemory()). The same applies if the target
+         * withdraws its support for page rewrites upon the first attempt.
+         *
+         * @param command
          */
-        void fireTargetEvents();
+        void writeProgramMemory(const Commands::WriteTargetMemory& command);
+
+        /**
+         * Erases the target's program memory and writes every page of the command's buffer that isn't in its erased
+         * state (all 0xFF). this->programMemoryContents must be initialised.
+         *
+         * @param command
+         */
+        void eraseAndWriteProgramMemory(const Commands::WriteTargetMemory& command);
+
+        /**
+         * Called after each chunk of a chunked memory operation.
+         *
+         * Emits a TargetMemoryOperationProgress event, processes any pending commands of a higher priority than
+         * the given command, and then checks if the operation can continue.
+         *
+         * @param command
+         *  The command that initiated the memory operation.
+         *
+         * @param memoryType
+         * @param bytesCompleted
+         * @param bytesTotal
+         *
+         * @throws Exception
+         *  If the operation has been cancelled, or one of the interleaved commands has left the target in a state in
+         *  which the operation cannot continue.
+         */
+        void completeMemoryOperationChunk(
+            const Commands::Command& command,
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemorySize bytesCompleted,
+            Targets::TargetMemorySize bytesTotal
+        );
 
         /**
          * Triggers a target reset and emits a TargetReset event.
@@ -311,6 +1387,12 @@ namespace Bloom::TargetController
          */
         const Targets::TargetDescriptor& getTargetDescriptor();
 
+        /**
+         * Publishes the cached target descriptor to other threads (see
+         * TargetControllerComponent::getPublishedTargetDescriptor()).
+         */
+        void publishTargetDescriptor();
+
         /**
          * Invokes a shutdown.
          *
@@ -326,12 +1408,24 @@ namespace Bloom::TargetController
         void onDebugSessionStartedEvent(const Events::DebugSessionStarted& event);
 
         /**
-         * Will simply kick off execution on the target.
+         * Will simply kick off execution on the target - or, if the debug session is to linger, start the linger
+         * period (see DebugServerConfig::sessionLingerPeriod).
          *
          * @param event
          */
         void onDebugSessionFinishedEvent(const Events::DebugSessionFinished& event);
 
+        /**
+         * Performs the end-of-session actions: resumes execution on the target and, if configured to do so,
+         * releases the hardware.
+         */
+        void finaliseDebugSession();
+
+        /**
+         * Cancels the debug session linger period, if a session is lingering.
+         */
+        void cancelDebugSessionLinger();
+
         // Command handlers
         std::unique_ptr<Responses::State> handleGetState(Commands::GetState& command);
         std::unique_ptr<Responses::Response> handleSuspend(Commands::Suspend& command);
@@ -348,12 +1442,24 @@ namespace Bloom::TargetController
         std::unique_ptr<Responses::TargetMemoryRead> handleReadTargetMemory(Commands::ReadTargetMemory& command);
         std::unique_ptr<Responses::Response> handleWriteTargetMemory(Commands::WriteTargetMemory& command);
         std::unique_ptr<Responses::Response> handleEraseTargetMemory(Commands::EraseTargetMemory& command);
+        std::unique_ptr<Responses::TargetMemoryFilled> handleFillTargetMemory(Commands::FillTargetMemory& command);
+        std::unique_ptr<Responses::TargetMemoryCrc> handleComputeTargetMemoryCrc(
+            Commands::ComputeTargetMemoryCrc& command
+        );
+        std::unique_ptr<Responses::TargetMemorySearchResult> handleSearchTargetMemory(
+            Commands::SearchTargetMemory& command
+        );
         std::unique_ptr<Responses::Response> handleStepTargetExecution(Commands::StepTargetExecution& command);
         std::unique_ptr<Responses::Response> handleSetBreakpoint(Commands::SetBreakpoint& command);
         std::unique_ptr<Responses::Response> handleRemoveBreakpoint(Commands::RemoveBreakpoint& command);
+        std::unique_ptr<Responses::Response> handleSetWatchpoint(Commands::SetWatchpoint& command);
+        std::unique_ptr<Responses::Response> handleRemoveWatchpoint(Commands::RemoveWatchpoint& command);
         std::unique_ptr<Responses::Response> handleSetProgramCounter(Commands::SetTargetProgramCounter& command);
         std::unique_ptr<Responses::TargetPinStates> handleGetTargetPinStates(Commands::GetTargetPinStates& command);
         std::unique_ptr<Responses::Response> handleSetTargetPinState(Commands::SetTargetPinState& command);
+        std::unique_ptr<Responses::Response> handleSetTargetPinStateStreaming(
+            Commands::SetTargetPinStateStreaming& command
+        );
         std::unique_ptr<Responses::TargetStackPointer> handleGetTargetStackPointer(
             Commands::GetTargetStackPointer& command
         );
@@ -362,5 +1468,46 @@ namespace Bloom::TargetController
         );
         std::unique_ptr<Responses::Response> handleEnableProgrammingMode(Commands::EnableProgrammingMode& command);
         std::unique_ptr<Responses::Response> handleDisableProgrammingMode(Commands::DisableProgrammingMode& command);
+        std::unique_ptr<Responses::ProgramImageLoaded> handleLoadProgramImage(Commands::LoadProgramImage& command);
+        std::unique_ptr<Responses::Response> handleStartProgramCounterSampling(
+            Commands::StartProgramCounterSampling& command
+        );
+        std::unique_ptr<Responses::ProgramCounterSamples> handleStopProgramCounterSampling(
+            Commands::StopProgramCounterSampling& command
+        );
+        std::unique_ptr<Responses::Response> handleStartCoverageCollection(
+            Commands::StartCoverageCollection& command
+        );
+        std::unique_ptr<Responses::CoverageReport> handleStopCoverageCollection(
+            Commands::StopCoverageCollection& command
+        );
+        std::unique_ptr<Responses::Response> handleStartTracing(Commands::StartTracing& command);
+        std::unique_ptr<Responses::Response> handleStopTracing(Commands::StopTracing& command);
+        std::unique_ptr<Responses::TraceStatus> handleGetTraceStatus(Commands::GetTraceStatus& command);
+        std::unique_ptr<Responses::TraceFrames> handleReadTraceFrames(Commands::ReadTraceFrames& command);
+        std::unique_ptr<Responses::Response> handleStartLiveSampling(Commands::StartLiveSampling& command);
+        std::unique_ptr<Responses::Response> handleStopLiveSampling(Commands::StopLiveSampling& command);
+        std::unique_ptr<Responses::LiveSamples> handleGetLiveSamples(Commands::GetLiveSamples& command);
+        std::unique_ptr<Responses::Response> handleStartTimingAnalysis(Commands::StartTimingAnalysis& command);
+        std::unique_ptr<Responses::TimingAnalysisReport> handleGetTimingAnalysisReport(
+            Commands::GetTimingAnalysisReport& command
+        );
+        std::unique_ptr<Responses::TimingAnalysisReport> handleStopTimingAnalysis(
+            Commands::StopTimingAnalysis& command
+        );
+        std::unique_ptr<Responses::Response> handleStartMemoryChangeTimeline(
+            Commands::StartMemoryChangeTimeline& command
+        );
+        std::unique_ptr<Responses::Response> handleStopMemoryChangeTimeline(
+            Commands::StopMemoryChangeTimeline& command
+        );
+        std::unique_ptr<Responses::MemoryChanges> handleGetMemoryChanges(Commands::GetMemoryChanges& command);
+        std::unique_ptr<Responses::LastMemoryChange> handleGetLastMemoryChange(
+            Commands::GetLastMemoryChange& command
+        );
+        std::unique_ptr<Responses::Response> handleCaptureCheckpoint(Commands::CaptureCheckpoint& command);
+        std::unique_ptr<Responses::Response> handleRestoreCheckpoint(Commands::RestoreCheckpoint& command);
+        std::unique_ptr<Responses::CommandBatchResponses> handleCommandBatch(Commands::CommandBatch& command);
+        std::unique_ptr<Responses::Response> handleCancelCommand(Commands::CancelCommand& command);
     };
 }
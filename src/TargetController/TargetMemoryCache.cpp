@@ -0,0 +1,186 @@
+#include "TargetMemoryCache.hpp"
+
+#include <algorithm>
+
+namespace Bloom::TargetController
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+    using Targets::TargetMemoryBuffer;
+
+    TargetMemoryCache::TargetMemoryCache(const Targets::TargetMemoryDescriptor& memoryDescriptor)
+        : addressRange(memoryDescriptor.addressRange)
+    {
+        if (memoryDescriptor.pageSize.has_value() && *(memoryDescriptor.pageSize) > 0) {
+            this->pageSize = *(memoryDescriptor.pageSize);
+        }
+    }
+
+    bool TargetMemoryCache::covers(TargetMemoryAddress startAddress, TargetMemorySize bytes) const {
+        return bytes > 0
+            && startAddress >= this->addressRange.startAddress
+            && startAddress <= this->addressRange.endAddress
+            && (bytes - 1) <= (this->addressRange.endAddress - startAddress);
+    }
+
+    bool TargetMemoryCache::contains(TargetMemoryAddress startAddress, TargetMemorySize bytes) const {
+        if (this->validPages.empty()) {
+            return false;
+        }
+
+        return std::all_of(
+            this->validPages.begin() + static_cast<long>(this->pageIndex(startAddress)),
+            this->validPages.begin() + static_cast<long>(this->pageIndex(startAddress + (bytes - 1)) + 1),
+            [] (bool valid) {
+                return valid;
+            }
+        );
+    }
+
+    TargetMemoryBuffer TargetMemoryCache::fetch(
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes,
+        const ReadCallback& readCallback
+    ) {
+        this->allocate();
+
+        const auto firstPageIndex = this->pageIndex(startAddress);
+        const auto lastPageIndex = this->pageIndex(startAddress + (bytes - 1));
+        auto miss = false;
+
+        const auto sequential = this->nextSequentialAddress == startAddress;
+        this->nextSequentialAddress = startAddress + bytes;
+
+        if (!sequential) {
+            this->readAheadSize = 0;
+        }
+
+        /*
+         * For sequential fetches, the last run of uncached pages may extend beyond the requested range, by up to
+         * readAheadSize bytes.
+         */
+        const auto readAheadSize = std::min(
+            std::max(this->readAheadSize * 2, bytes),
+            TargetMemoryCache::MAXIMUM_READ_AHEAD_SIZE
+        );
+        const auto readAheadLastPageIndex = sequential
+            ? std::min(
+                lastPageIndex + (readAheadSize + this->pageSize - 1) / this->pageSize,
+                this->validPages.size() - 1
+            )
+            : lastPageIndex;
+
+        /*
+         * Read any runs of consecutive uncached pages from the target, one read per run.
+         */
+        auto pageIndex = firstPageIndex;
+        while (pageIndex <= lastPageIndex) {
+            if (this->validPages[pageIndex]) {
+                ++pageIndex;
+                continue;
+            }
+
+            const auto runStartPageIndex = pageIndex;
+            while (pageIndex <= readAheadLastPageIndex && !this->validPages[pageIndex]) {
+                ++pageIndex;
+            }
+
+            if (pageIndex > (lastPageIndex + 1)) {
+                this->readAheadSize = readAheadSize;
+            }
+
+            const auto runStartOffset = static_cast<TargetMemorySize>(runStartPageIndex * this->pageSize);
+            const auto runEndOffset = std::min(
+                static_cast<TargetMemorySize>(pageIndex * this->pageSize),
+                static_cast<TargetMemorySize>(this->data.size())
+            );
+
+            const auto buffer = readCallback(
+                this->addressRange.startAddress + runStartOffset,
+                runEndOffset - runStartOffset
+            );
+
+            std::copy(
+                buffer.begin(),
+                buffer.begin() + std::min(buffer.size(), static_cast<std::size_t>(runEndOffset - runStartOffset)),
+                this->data.begin() + runStartOffset
+            );
+
+            std::fill(
+                this->validPages.begin() + static_cast<long>(runStartPageIndex),
+                this->validPages.begin() + static_cast<long>(pageIndex),
+                true
+            );
+
+            miss = true;
+        }
+
+        if (miss) {
+            ++this->missCount;
+
+        } else {
+            ++this->hitCount;
+        }
+
+        const auto beginIt = this->data.begin() + (startAddress - this->addressRange.startAddress);
+        return TargetMemoryBuffer(beginIt, beginIt + bytes);
+    }
+
+    void TargetMemoryCache::store(TargetMemoryAddress startAddress, const TargetMemoryBuffer& buffer) {
+        if (buffer.empty()) {
+            return;
+        }
+
+        this->allocate();
+
+        const auto startOffset = startAddress - this->addressRange.startAddress;
+        std::copy(buffer.begin(), buffer.end(), this->data.begin() + startOffset);
+
+        const auto endOffset = startOffset + static_cast<TargetMemorySize>(buffer.size());
+        const auto firstWholePageIndex = (startOffset + this->pageSize - 1) / this->pageSize;
+        const auto lastWholePageEndIndex = endOffset == this->data.size()
+            ? this->validPages.size()
+            : endOffset / this->pageSize;
+
+        for (auto pageIndex = firstWholePageIndex; pageIndex < lastWholePageEndIndex; ++pageIndex) {
+            this->validPages[pageIndex] = true;
+        }
+    }
+
+    void TargetMemoryCache::invalidate() {
+        std::fill(this->validPages.begin(), this->validPages.end(), false);
+        this->nextSequentialAddress = std::nullopt;
+        this->readAheadSize = 0;
+    }
+
+    void TargetMemoryCache::invalidate(TargetMemoryAddress startAddress, TargetMemorySize bytes) {
+        if (this->validPages.empty() || bytes == 0) {
+            return;
+        }
+
+        const auto endAddress = startAddress + (bytes - 1);
+
+        if (endAddress < this->addressRange.startAddress || startAddress > this->addressRange.endAddress) {
+            return;
+        }
+
+        const auto firstPageIndex = this->pageIndex(std::max(startAddress, this->addressRange.startAddress));
+        const auto lastPageIndex = this->pageIndex(std::min(endAddress, this->addressRange.endAddress));
+
+        std::fill(
+            this->validPages.begin() + static_cast<long>(firstPageIndex),
+            this->validPages.begin() + static_cast<long>(lastPageIndex + 1),
+            false
+        );
+    }
+
+    void TargetMemoryCache::allocate() {
+        if (!this->data.empty()) {
+            return;
+        }
+
+        const auto segmentSize = (this->addressRange.endAddress - this->addressRange.startAddress) + 1;
+        this->data.resize(segmentSize, 0x00);
+        this->validPages.resize((segmentSize + this->pageSize - 1) / this->pageSize, false);
+    }
+}
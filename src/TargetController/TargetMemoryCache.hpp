@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include <optional>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A page-granular cache of a single target memory segment.
+     *
+     * The cache is populated on demand. When a read request includes any pages that are not already cached, those
+     * pages are read from the target (in as few reads as possible) and retained for subsequent requests.
+     *
+     * When a fetch continues from where the previous fetch ended (as is the case when debug clients read a block of
+     * memory in a series of smaller reads), any read from the target is extended beyond the requested range, so that
+     * subsequent fetches can be serviced from the cache. See TargetMemoryCache::MAXIMUM_READ_AHEAD_SIZE.
+     *
+     * The cache is oblivious to the target's execution state - it's the responsibility of the TargetController to
+     * invalidate the cache whenever the memory may have changed (see
+     * TargetControllerComponent::invalidateMemoryCaches()).
+     */
+    class TargetMemoryCache
+    {
+    public:
+        /**
+         * The page size to use when the memory descriptor does not provide one.
+         */
+        static constexpr Targets::TargetMemorySize DEFAULT_PAGE_SIZE = 64;
+
+        /**
+         * The read-ahead size starts at the size of the first sequential fetch that misses, and doubles upon each
+         * subsequent one, up to this limit. Read-ahead never extends beyond the memory segment, or into pages that
+         * are already cached.
+         */
+        static constexpr Targets::TargetMemorySize MAXIMUM_READ_AHEAD_SIZE = 1024;
+
+        using ReadCallback = std::function<Targets::TargetMemoryBuffer(
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes
+        )>;
+
+        explicit TargetMemoryCache(const Targets::TargetMemoryDescriptor& memoryDescriptor);
+
+        /**
+         * Checks if the given address range falls within the memory segment managed by this cache.
+         *
+         * @param startAddress
+         * @param bytes
+         * @return
+         */
+        [[nodiscard]] bool covers(Targets::TargetMemoryAddress startAddress, Targets::TargetMemorySize bytes) const;
+
+        /**
+         * Checks if the given address range is entirely cached, in which case a fetch of the range will not require
+         * any reads from the target.
+         *
+         * The given address range must be covered by this cache (see TargetMemoryCache::covers()).
+         *
+         * @param startAddress
+         * @param bytes
+         * @return
+         */
+        [[nodiscard]] bool contains(Targets::TargetMemoryAddress startAddress, Targets::TargetMemorySize bytes) const;
+
+        /**
+         * Fetches memory from the cache. Any pages that are not cached will be read from the target, via the given
+         * callback.
+         *
+         * The given address range must be covered by this cache (see TargetMemoryCache::covers()).
+         *
+         * @param startAddress
+         * @param bytes
+         * @param readCallback
+         * @return
+         */
+        Targets::TargetMemoryBuffer fetch(
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes,
+            const ReadCallback& readCallback
+        );
+
+        /**
+         * Writes the given data to the cache. Pages that are entirely covered by the data become valid. Partially
+         * covered pages are updated, but their validity is left untouched.
+         *
+         * The given address range must be covered by this cache (see TargetMemoryCache::covers()).
+         *
+         * @param startAddress
+         * @param buffer
+         */
+        void store(Targets::TargetMemoryAddress startAddress, const Targets::TargetMemoryBuffer& buffer);
+
+        /**
+         * Invalidates all cached pages.
+         */
+        void invalidate();
+
+        /**
+         * Invalidates all cached pages that intersect with the given address range.
+         *
+         * @param startAddress
+         * @param bytes
+         */
+        void invalidate(Targets::TargetMemoryAddress startAddress, Targets::TargetMemorySize bytes);
+
+        [[nodiscard]] Targets::TargetMemorySize getPageSize() const {
+            return this->pageSize;
+        }
+
+        /**
+         * The number of fetches that were serviced entirely from the cache.
+         *
+         * @return
+         */
+        [[nodiscard]] std::uint64_t getHitCount() const {
+            return this->hitCount;
+        }
+
+        /**
+         * The number of fetches that required at least one read from the target.
+         *
+         * @return
+         */
+        [[nodiscard]] std::uint64_t getMissCount() const {
+            return this->missCount;
+        }
+
+    private:
+        Targets::TargetMemoryAddressRange addressRange;
+        Targets::TargetMemorySize pageSize = TargetMemoryCache::DEFAULT_PAGE_SIZE;
+
+        /**
+         * The cached memory. This is allocated upon the first fetch, to avoid allocating memory for segments that are
+         * never accessed.
+         */
+        Targets::TargetMemoryBuffer data;
+
+        /**
+         * Page validity flags, indexed by page number (relative to the start of the segment).
+         */
+        std::vector<bool> validPages;
+
+        std::uint64_t hitCount = 0;
+        std::uint64_t missCount = 0;
+
+        /**
+         * The address immediately following the range of the last fetch. A fetch that starts at this address is
+         * considered sequential.
+         */
+        std::optional<Targets::TargetMemoryAddress> nextSequentialAddress;
+
+        /**
+         * The size of the last read-ahead, or 0 if the last read from the target wasn't extended.
+         */
+        Targets::TargetMemorySize readAheadSize = 0;
+
+        /**
+         * Allocates the cache buffer and page validity flags, if they haven't already been allocated.
+         */
+        void allocate();
+
+        [[nodiscard]] std::size_t pageIndex(Targets::TargetMemoryAddress address) const {
+            return (address - this->addressRange.startAddress) / this->pageSize;
+        }
+    };
+}
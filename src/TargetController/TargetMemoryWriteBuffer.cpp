@@ -0,0 +1,94 @@
+#include "TargetMemoryWriteBuffer.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <cassert>
+
+namespace Bloom::TargetController
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+    using Targets::TargetMemoryBuffer;
+
+    void TargetMemoryWriteBuffer::add(TargetMemoryAddress startAddress, const TargetMemoryBuffer& buffer) {
+        if (buffer.empty()) {
+            return;
+        }
+
+        assert(!this->intersects(startAddress, static_cast<TargetMemorySize>(buffer.size())));
+
+        // We work with exclusive end addresses here, to simplify the detection of adjacent writes
+        auto mergedStartAddress = static_cast<std::uint64_t>(startAddress);
+        auto mergedEndAddress = mergedStartAddress + buffer.size();
+
+        /*
+         * Find the buffered writes that are adjacent to the new write. The first candidate is the last write that
+         * starts at or before the new write.
+         */
+        auto firstIt = this->buffersByStartAddress.upper_bound(startAddress);
+        if (firstIt != this->buffersByStartAddress.begin()) {
+            const auto previousIt = std::prev(firstIt);
+
+            if ((static_cast<std::uint64_t>(previousIt->first) + previousIt->second.size()) >= mergedStartAddress) {
+                firstIt = previousIt;
+            }
+        }
+
+        auto lastIt = firstIt;
+        while (lastIt != this->buffersByStartAddress.end() && lastIt->first <= mergedEndAddress) {
+            mergedStartAddress = std::min(mergedStartAddress, static_cast<std::uint64_t>(lastIt->first));
+            mergedEndAddress = std::max(
+                mergedEndAddress,
+                static_cast<std::uint64_t>(lastIt->first) + lastIt->second.size()
+            );
+            ++lastIt;
+        }
+
+        if (firstIt == lastIt) {
+            this->buffersByStartAddress.emplace(startAddress, buffer);
+            this->size += static_cast<TargetMemorySize>(buffer.size());
+            return;
+        }
+
+        auto mergedBuffer = TargetMemoryBuffer(mergedEndAddress - mergedStartAddress, 0x00);
+
+        for (auto it = firstIt; it != lastIt; ++it) {
+            std::copy(it->second.begin(), it->second.end(), mergedBuffer.begin() + (it->first - mergedStartAddress));
+            this->size -= static_cast<TargetMemorySize>(it->second.size());
+            ++this->mergeCount;
+        }
+
+        std::copy(buffer.begin(), buffer.end(), mergedBuffer.begin() + (startAddress - mergedStartAddress));
+
+        this->buffersByStartAddress.erase(firstIt, lastIt);
+        this->size += static_cast<TargetMemorySize>(mergedBuffer.size());
+        this->buffersByStartAddress.emplace(
+            static_cast<TargetMemoryAddress>(mergedStartAddress),
+            std::move(mergedBuffer)
+        );
+    }
+
+    bool TargetMemoryWriteBuffer::intersects(TargetMemoryAddress startAddress, TargetMemorySize bytes) const {
+        if (bytes == 0 || this->buffersByStartAddress.empty()) {
+            return false;
+        }
+
+        /*
+         * The buffered writes are disjoint, so the only candidate is the last write that starts at or before the
+         * end of the range.
+         */
+        auto it = this->buffersByStartAddress.upper_bound(startAddress + (bytes - 1));
+        if (it == this->buffersByStartAddress.begin()) {
+            return false;
+        }
+
+        --it;
+        return (static_cast<std::uint64_t>(it->first) + it->second.size()) > startAddress;
+    }
+
+    std::map<TargetMemoryAddress, TargetMemoryBuffer> TargetMemoryWriteBuffer::take() {
+        this->size = 0;
+        return std::exchange(this->buffersByStartAddress, {});
+    }
+}
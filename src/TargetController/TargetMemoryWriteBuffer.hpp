@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A write-combining buffer for a single memory type.
+     *
+     * Writes are held in the buffer until they're taken (see TargetMemoryWriteBuffer::take()), to be written to the
+     * target. Adjacent writes are merged, so that a series of small writes (as produced by GDB when assigning a
+     * value to a struct, for example) can be written to the target in a single operation.
+     *
+     * The buffer must only hold writes to plain memory (no memory-mapped registers), as the writes are reordered.
+     * Callers must not add a write that overlaps a buffered write - the buffer should be taken first, so that every
+     * write reaches the target (see TargetControllerComponent::memoryWriteCombinable()).
+     *
+     * It's the responsibility of the TargetController to take the buffered writes before servicing any command that
+     * could observe the affected memory (see TargetControllerComponent::flushMemoryWriteBuffers()).
+     */
+    class TargetMemoryWriteBuffer
+    {
+    public:
+        /**
+         * Buffers a write.
+         *
+         * @param startAddress
+         *
+         * @param buffer
+         *  Must not overlap any buffered write (see TargetMemoryWriteBuffer::intersects()).
+         */
+        void add(Targets::TargetMemoryAddress startAddress, const Targets::TargetMemoryBuffer& buffer);
+
+        /**
+         * Checks if any buffered write intersects with the given address range.
+         *
+         * @param startAddress
+         * @param bytes
+         * @return
+         */
+        [[nodiscard]] bool intersects(Targets::TargetMemoryAddress startAddress, Targets::TargetMemorySize bytes) const;
+
+        [[nodiscard]] bool empty() const {
+            return this->buffersByStartAddress.empty();
+        }
+
+        /**
+         * The total number of bytes held in the buffer.
+         *
+         * @return
+         */
+        [[nodiscard]] Targets::TargetMemorySize getSize() const {
+            return this->size;
+        }
+
+        /**
+         * The number of writes that have been merged into other writes, since the buffer was constructed.
+         *
+         * @return
+         */
+        [[nodiscard]] std::uint64_t getMergeCount() const {
+            return this->mergeCount;
+        }
+
+        /**
+         * Removes all buffered writes from the buffer.
+         *
+         * @return
+         *  The buffered writes, mapped by start address. The writes are disjoint and non-adjacent.
+         */
+        std::map<Targets::TargetMemoryAddress, Targets::TargetMemoryBuffer> take();
+
+    private:
+        /**
+         * Buffered writes, mapped by their start addresses. The writes held here are always disjoint and
+         * non-adjacent - overlapping and adjacent writes are merged upon insertion.
+         */
+        std::map<Targets::TargetMemoryAddress, Targets::TargetMemoryBuffer> buffersByStartAddress;
+        Targets::TargetMemorySize size = 0;
+        std::uint64_t mergeCount = 0;
+    };
+}
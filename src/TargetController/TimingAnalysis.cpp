@@ -0,0 +1,82 @@
+#include "TimingAnalysis.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <iomanip>
+
+namespace Bloom::TargetController
+{
+    namespace
+    {
+        constexpr std::size_t HISTOGRAM_BIN_COUNT = 10;
+        constexpr std::size_t HISTOGRAM_BAR_WIDTH = 40;
+
+        void writeStatistics(std::ostream& output, const std::string& label, const std::vector<std::uint64_t>& values) {
+            const auto [minimumIt, maximumIt] = std::minmax_element(values.begin(), values.end());
+            const auto sum = std::accumulate(values.begin(), values.end(), static_cast<long double>(0));
+
+            output << label << "min " << *minimumIt << ", avg " << std::fixed << std::setprecision(1)
+                << (sum / static_cast<long double>(values.size())) << ", max " << *maximumIt << "\n";
+        }
+
+        void writeHistogram(std::ostream& output, const std::string& unit, const std::vector<std::uint64_t>& values) {
+            const auto [minimumIt, maximumIt] = std::minmax_element(values.begin(), values.end());
+            const auto minimum = *minimumIt;
+            const auto binWidth = std::max((*maximumIt - minimum) / HISTOGRAM_BIN_COUNT + 1, std::uint64_t(1));
+
+            auto binCounts = std::vector<std::size_t>(HISTOGRAM_BIN_COUNT, 0);
+            for (const auto value : values) {
+                ++binCounts[std::min(static_cast<std::size_t>((value - minimum) / binWidth), HISTOGRAM_BIN_COUNT - 1)];
+            }
+
+            const auto largestBinCount = *std::max_element(binCounts.begin(), binCounts.end());
+
+            output << "Histogram (" << unit << "):\n";
+
+            for (auto binIndex = std::size_t(0); binIndex < HISTOGRAM_BIN_COUNT; ++binIndex) {
+                const auto binStart = minimum + binIndex * binWidth;
+                if (binStart > *maximumIt) {
+                    break;
+                }
+
+                const auto barLength = binCounts[binIndex] * HISTOGRAM_BAR_WIDTH / largestBinCount;
+
+                output << "  " << std::setw(10) << binStart << " - " << std::setw(10) << (binStart + binWidth - 1)
+                    << "  " << std::string(barLength, '#') << " " << binCounts[binIndex] << "\n";
+            }
+        }
+    }
+
+    std::string TimingAnalysisResults::summary() const {
+        auto output = std::stringstream();
+
+        output << "Timing analysis: 0x" << std::hex << std::setfill('0') << std::setw(6) << this->startAddress
+            << " -> 0x" << std::setw(6) << this->endAddress << std::dec << std::setfill(' ') << ", "
+            << this->hostDurations.size() << "/" << this->iterationCount << " iterations measured\n";
+
+        if (this->hostDurations.empty()) {
+            return output.str();
+        }
+
+        auto hostDurationValues = std::vector<std::uint64_t>();
+        hostDurationValues.reserve(this->hostDurations.size());
+
+        for (const auto& duration : this->hostDurations) {
+            hostDurationValues.push_back(static_cast<std::uint64_t>(duration.count()));
+        }
+
+        writeStatistics(output, "Host time (us):  ", hostDurationValues);
+
+        if (!this->timerTickDurations.empty()) {
+            writeStatistics(output, "Timer ticks:     ", this->timerTickDurations);
+            writeHistogram(output, "timer ticks", this->timerTickDurations);
+            return output.str();
+        }
+
+        output << "Host times include USB latency (typically around 1 ms) - provide a timer register for "
+            "cycle-accurate results\n";
+        writeHistogram(output, "us", hostDurationValues);
+        return output.str();
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <optional>
+#include <chrono>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A free-running timer/counter register on the target, read at each timing breakpoint, for cycle-accurate
+     * interval measurements. See TimingAnalysisResults::timerTickDurations.
+     */
+    struct TimingTimerRegister
+    {
+        Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::RAM;
+        Targets::TargetMemoryAddress address = 0;
+
+        /**
+         * In bytes - the register's value is read in the target's (little-endian) byte order.
+         */
+        Targets::TargetMemorySize size = 1;
+
+        TimingTimerRegister(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress address,
+            Targets::TargetMemorySize size
+        )
+            : memoryType(memoryType)
+            , address(address)
+            , size(size)
+        {};
+    };
+
+    /**
+     * Measurements of the interval between two program memory addresses (an ISR's entry and exit, for example),
+     * collected by the TargetController via breakpoints. See TargetControllerComponent::handleTimingBreak().
+     */
+    struct TimingAnalysisResults
+    {
+        Targets::TargetMemoryAddress startAddress = 0;
+        Targets::TargetMemoryAddress endAddress = 0;
+
+        /**
+         * The number of intervals to measure.
+         */
+        std::uint32_t iterationCount = 0;
+
+        std::optional<TimingTimerRegister> timerRegister;
+
+        /**
+         * Host-side duration of each measured interval - from the moment the target was resumed at the start
+         * address, to the moment we detected the halt at the end address.
+         *
+         * The debug tool doesn't timestamp its break events, so these durations include the latency of the USB round
+         * trips involved in detecting the halt, which is typically in the order of a millisecond.
+         */
+        std::vector<std::chrono::microseconds> hostDurations;
+
+        /**
+         * Duration of each measured interval, in ticks of the timer register (if one was given). The counter's
+         * overflow is accounted for, as long as it overflows no more than once per interval.
+         */
+        std::vector<std::uint64_t> timerTickDurations;
+
+        [[nodiscard]] bool completed() const {
+            return this->hostDurations.size() >= this->iterationCount;
+        }
+
+        /**
+         * Generates a human-readable summary of the results - the minimum, mean and maximum durations, along with a
+         * histogram of the most accurate set of durations available.
+         *
+         * @return
+         */
+        [[nodiscard]] std::string summary() const;
+    };
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <optional>
+
+#include "AgentExpression.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetRegister.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A tracepoint - a breakpoint at which the TargetController collects data into the trace buffer and resumes the
+     * target, without reporting the halt. See TargetControllerComponent::recordTraceFrames().
+     */
+    struct Tracepoint
+    {
+        /**
+         * The tracepoint number, as assigned by the client.
+         */
+        std::uint32_t number = 0;
+
+        /**
+         * Program memory address of the tracepoint.
+         */
+        Targets::TargetMemoryAddress address = 0;
+
+        bool enabled = true;
+
+        /**
+         * Tracing stops once this tracepoint has been hit this many times. Zero means no limit.
+         */
+        std::uint64_t passCount = 0;
+
+        /**
+         * If set, data is only collected when the condition evaluates to a non-zero value.
+         */
+        std::optional<AgentExpression> condition;
+
+        /**
+         * The registers to collect upon each hit.
+         */
+        Targets::TargetRegisterDescriptors registerDescriptors;
+
+        /**
+         * Expressions whose trace operations record the memory to collect upon each hit.
+         */
+        std::vector<AgentExpression> collectionExpressions;
+
+        Tracepoint() = default;
+        Tracepoint(std::uint32_t number, Targets::TargetMemoryAddress address)
+            : number(number)
+            , address(address)
+        {};
+    };
+
+    struct TraceMemoryBlock
+    {
+        /**
+         * The address of the block, in the client's address space (the address used in the collection expression).
+         */
+        Targets::TargetMemoryAddress address = 0;
+        Targets::TargetMemoryBuffer data;
+
+        TraceMemoryBlock(Targets::TargetMemoryAddress address, Targets::TargetMemoryBuffer&& data)
+            : address(address)
+            , data(std::move(data))
+        {};
+    };
+
+    /**
+     * The data collected upon a single tracepoint hit.
+     */
+    struct TraceFrame
+    {
+        std::uint32_t tracepointNumber = 0;
+        Targets::TargetProgramCounter programCounter = 0;
+
+        Targets::TargetRegisters registers;
+        std::vector<TraceMemoryBlock> memoryBlocks;
+
+        TraceFrame(std::uint32_t tracepointNumber, Targets::TargetProgramCounter programCounter)
+            : tracepointNumber(tracepointNumber)
+            , programCounter(programCounter)
+        {};
+
+        /**
+         * The (approximate) space occupied by the frame, in the trace buffer.
+         *
+         * @return
+         */
+        [[nodiscard]] std::size_t size() const {
+            auto output = sizeof(TraceFrame);
+
+            for (const auto& reg : this->registers) {
+                output += sizeof(reg) + reg.value.size();
+            }
+
+            for (const auto& block : this->memoryBlocks) {
+                output += sizeof(block) + block.data.size();
+            }
+
+            return output;
+        }
+    };
+
+    enum class TraceStopReason: std::uint8_t
+    {
+        NOT_RUN,
+        STOPPED,
+        BUFFER_FULL,
+        PASS_COUNT,
+    };
+}
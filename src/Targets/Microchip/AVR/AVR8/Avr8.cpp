@@ -2,9 +2,12 @@
 
 #include <cassert>
 #include <bitset>
+#include <set>
 #include <limits>
 #include <thread>
 #include <algorithm>
+#include <vector>
+#include <span>
 
 #include "src/Logger/Logger.hpp"
 #include "src/Services/PathService.hpp"
@@ -15,6 +18,7 @@
 #include "src/Targets/TargetRegister.hpp"
 
 #include "src/Targets/Microchip/AVR/Fuse.hpp"
+#include "src/Helpers/Crc32.hpp"
 
 // Derived AVR8 targets
 #include "XMega/XMega.hpp"
@@ -116,6 +120,27 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
             );
         }
 
+        if (
+            this->targetConfig->ispFlashProgramming
+            && this->targetConfig->physicalInterface == PhysicalInterface::DEBUG_WIRE
+            && (this->avrIspInterface == nullptr || this->targetPowerManagementInterface == nullptr)
+        ) {
+            Logger::warning(
+                "The 'ispFlashProgramming' parameter requires a debug tool with an ISP interface and target power "
+                    "management - the program memory will be programmed via debugWire, in this session."
+            );
+        }
+
+        if (
+            this->targetConfig->ispFlashProgramming
+            && this->targetConfig->physicalInterface != PhysicalInterface::DEBUG_WIRE
+        ) {
+            Logger::warning(
+                "The 'ispFlashProgramming' parameter only applies to debugWire targets. It will be ignored in this "
+                    "session."
+            );
+        }
+
         this->avr8DebugInterface->configure(*(this->targetConfig));
 
         if (this->avrIspInterface != nullptr) {
@@ -124,7 +149,7 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
     }
 
     void Avr8::postActivationConfigure() {
-        if (!this->targetDescriptionFile.has_value()) {
+        if (this->targetDescriptionFile == nullptr) {
             this->initFromTargetDescriptionFile();
         }
 
@@ -182,6 +207,12 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
                 );
             }
 
+            /*
+             * After cycling the target power, we poll the debugWire interface, instead of waiting the full power-up
+             * delay. targetPowerCycleDelay serves as the upper bound.
+             */
+            auto powerUpDeadline = std::optional<std::chrono::steady_clock::time_point>();
+
             try {
                 Logger::warning(
                     "Failed to activate the debugWire physical interface - attempting to access target via "
@@ -194,26 +225,7 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
                     this->targetPowerManagementInterface != nullptr
                     && this->targetConfig->cycleTargetPowerPostDwenUpdate
                 ) {
-                    Logger::info("Cycling target power");
-
-                    Logger::debug("Disabling target power");
-                    this->targetPowerManagementInterface->disableTargetPower();
-
-                    Logger::debug(
-                        "Holding power off for ~"
-                            + std::to_string(this->targetConfig->targetPowerCycleDelay.count())
-                            + " ms"
-                    );
-                    std::this_thread::sleep_for(this->targetConfig->targetPowerCycleDelay);
-
-                    Logger::debug("Enabling target power");
-                    this->targetPowerManagementInterface->enableTargetPower();
-
-                    Logger::debug(
-                        "Waiting ~" + std::to_string(this->targetConfig->targetPowerCycleDelay.count())
-                            + " ms for target power-up"
-                    );
-                    std::this_thread::sleep_for(this->targetConfig->targetPowerCycleDelay);
+                    powerUpDeadline = this->cycleTargetPower();
                 }
 
             } catch (const Exception& exception) {
@@ -223,7 +235,7 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
             }
 
             Logger::info("Retrying debugWire physical interface activation");
-            this->avr8DebugInterface->activate();
+            this->activateDebugInterface(powerUpDeadline);
         }
 
         if (
@@ -234,6 +246,8 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
             this->updateOcdenFuseBit(true);
         }
 
+        this->loadGpioPinTables();
+
         this->activated = true;
         this->avr8DebugInterface->reset();
     }
@@ -299,17 +313,28 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         descriptor.programMemoryType = Targets::TargetMemoryType::FLASH;
         descriptor.registerDescriptorsByType = this->targetRegisterDescriptorsByType;
         descriptor.memoryDescriptorsByType = this->targetMemoryDescriptorsByType;
+        descriptor.programMemoryPageRewritesSupported = this->programMemoryPageRewritesSupported();
+        descriptor.runtimeMemoryAccessSupported = this->runtimeMemoryAccessSupported();
+
+        return descriptor;
+    }
+
+    std::vector<TargetVariant> Avr8::getVariants() {
+        const auto& targetVariantsById = this->targetDescriptionFile->getVariantsMappedById();
+
+        auto variants = std::vector<TargetVariant>();
+        variants.reserve(targetVariantsById.size());
 
         std::transform(
-            this->targetVariantsById.begin(),
-            this->targetVariantsById.end(),
-            std::back_inserter(descriptor.variants),
+            targetVariantsById.begin(),
+            targetVariantsById.end(),
+            std::back_inserter(variants),
             [] (auto& variantToIdPair) {
                 return variantToIdPair.second;
             }
         );
 
-        return descriptor;
+        return variants;
     }
 
     void Avr8::run(std::optional<TargetMemoryAddress> toAddress) {
@@ -332,66 +357,88 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         this->avr8DebugInterface->reset();
     }
 
-    void Avr8::setBreakpoint(std::uint32_t address) {
-        this->avr8DebugInterface->setBreakpoint(address);
+    void Avr8::setSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        this->avr8DebugInterface->setSoftwareBreakpoints(addresses);
     }
 
-    void Avr8::removeBreakpoint(std::uint32_t address) {
-        this->avr8DebugInterface->clearBreakpoint(address);
+    void Avr8::removeSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        this->avr8DebugInterface->clearSoftwareBreakpoints(addresses);
     }
 
-    void Avr8::clearAllBreakpoints() {
-        this->avr8DebugInterface->clearAllBreakpoints();
+    std::uint16_t Avr8::getHardwareBreakpointCount() {
+        return this->avr8DebugInterface->getHardwareBreakpointCount();
     }
 
-    void Avr8::writeRegisters(TargetRegisters registers) {
-        for (auto registerIt = registers.begin(); registerIt != registers.end();) {
-            if (registerIt->descriptor.type == TargetRegisterType::PROGRAM_COUNTER) {
-                auto programCounterBytes = registerIt->value;
+    void Avr8::setHardwareBreakpoint(std::uint16_t index, TargetMemoryAddress address) {
+        this->avr8DebugInterface->setHardwareBreakpoint(index, address);
+    }
 
-                if (programCounterBytes.size() < 4) {
-                    // All PC register values should be at least 4 bytes in size
-                    programCounterBytes.insert(programCounterBytes.begin(), 4 - programCounterBytes.size(), 0x00);
-                }
+    void Avr8::removeHardwareBreakpoint(std::uint16_t index) {
+        this->avr8DebugInterface->clearHardwareBreakpoint(index);
+    }
+
+    std::uint16_t Avr8::getDataBreakpointCount() {
+        return this->avr8DebugInterface->getDataBreakpointCount();
+    }
 
-                this->setProgramCounter(static_cast<std::uint32_t>(
-                    programCounterBytes[0] << 24
-                    | programCounterBytes[1] << 16
-                    | programCounterBytes[2] << 8
-                    | programCounterBytes[3]
-                ));
+    void Avr8::setDataBreakpoint(std::uint16_t index, TargetMemoryAddress address, TargetWatchpointType type) {
+        this->avr8DebugInterface->setDataBreakpoint(index, address, type);
+    }
 
-                registerIt = registers.erase(registerIt);
+    void Avr8::removeDataBreakpoint(std::uint16_t index) {
+        this->avr8DebugInterface->clearDataBreakpoint(index);
+    }
 
-            } else {
-                registerIt++;
+    void Avr8::clearAllBreakpoints() {
+        this->avr8DebugInterface->clearAllBreakpoints();
+    }
+
+    void Avr8::writeRegisters(const TargetRegisters& registers) {
+        /*
+         * The PC isn't memory-mapped, so we handle it separately. All other registers are passed to the debug
+         * interface by reference.
+         */
+        auto otherRegisters = std::vector<const TargetRegister*>();
+        otherRegisters.reserve(registers.size());
+
+        for (const auto& reg : registers) {
+            if (reg.descriptor.type != TargetRegisterType::PROGRAM_COUNTER) {
+                otherRegisters.push_back(&reg);
+                continue;
+            }
+
+            // The value is in MSB form. Any missing most-significant bytes are implicitly 0x00.
+            auto programCounter = std::uint32_t(0);
+            for (const auto byte : reg.value) {
+                programCounter = (programCounter << 8) | byte;
             }
+
+            this->setProgramCounter(programCounter);
         }
 
-        if (!registers.empty()) {
-            this->avr8DebugInterface->writeRegisters(registers);
+        if (!otherRegisters.empty()) {
+            this->avr8DebugInterface->writeRegisters(otherRegisters);
         }
     }
 
-    TargetRegisters Avr8::readRegisters(TargetRegisterDescriptors descriptors) {
-        TargetRegisters registers;
+    TargetRegisters Avr8::readRegisters(const TargetRegisterDescriptors& descriptors) {
+        auto registers = TargetRegisters();
+        registers.reserve(descriptors.size());
 
-        for (auto registerDescriptorIt = descriptors.begin(); registerDescriptorIt != descriptors.end();) {
-            const auto& descriptor = *registerDescriptorIt;
+        auto otherDescriptors = std::vector<const TargetRegisterDescriptor*>();
+        otherDescriptors.reserve(descriptors.size());
 
+        for (const auto& descriptor : descriptors) {
             if (descriptor.type == TargetRegisterType::PROGRAM_COUNTER) {
                 registers.push_back(this->getProgramCounterRegister());
-
-                registerDescriptorIt = descriptors.erase(registerDescriptorIt);
-
-            } else {
-                registerDescriptorIt++;
+                continue;
             }
+
+            otherDescriptors.push_back(&descriptor);
         }
 
-        if (!descriptors.empty()) {
-            auto otherRegisters = this->avr8DebugInterface->readRegisters(descriptors);
-            registers.insert(registers.end(), otherRegisters.begin(), otherRegisters.end());
+        if (!otherDescriptors.empty()) {
+            this->avr8DebugInterface->readRegisters(otherDescriptors, registers);
         }
 
         return registers;
@@ -403,7 +450,21 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         std::uint32_t bytes,
         const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
     ) {
-        return this->avr8DebugInterface->readMemory(memoryType, startAddress, bytes, excludedAddressRanges);
+        auto output = this->avr8DebugInterface->readMemory(memoryType, startAddress, bytes, excludedAddressRanges);
+
+        if (memoryType == TargetMemoryType::FLASH && this->ispProgramMemoryImage.has_value()) {
+            // Reflect the program memory writes that are yet to be committed
+            const auto& image = *(this->ispProgramMemoryImage);
+            const auto offset = startAddress - this->targetParameters->flashStartAddress.value();
+
+            for (auto i = std::size_t(0); i < output.size() && offset + i < image.data.size(); ++i) {
+                if (image.eraseRequested || image.written[offset + i]) {
+                    output[i] = image.data[offset + i];
+                }
+            }
+        }
+
+        return output;
     }
 
     void Avr8::writeMemory(TargetMemoryType memoryType, std::uint32_t startAddress, const TargetMemoryBuffer& buffer) {
@@ -411,11 +472,36 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
             throw Exception("Attempted FLASH memory write with no active programming session.");
         }
 
+        if (memoryType == TargetMemoryType::FLASH && this->ispProgramMemoryImage.has_value()) {
+            auto& image = *(this->ispProgramMemoryImage);
+            const auto offset = startAddress - this->targetParameters->flashStartAddress.value();
+
+            if (
+                startAddress < this->targetParameters->flashStartAddress.value()
+                || offset + buffer.size() > image.data.size()
+            ) {
+                throw Exception("Attempted FLASH memory write beyond the boundaries of the program memory.");
+            }
+
+            std::copy(buffer.begin(), buffer.end(), image.data.begin() + offset);
+            std::fill(image.written.begin() + offset, image.written.begin() + offset + buffer.size(), true);
+            return;
+        }
+
         this->avr8DebugInterface->writeMemory(memoryType, startAddress, buffer);
     }
 
     void Avr8::eraseMemory(TargetMemoryType memoryType) {
         if (memoryType == TargetMemoryType::FLASH) {
+            if (this->ispProgramMemoryImage.has_value()) {
+                // The erase will take place when the image is committed (the ISP interface performs a chip erase)
+                auto& image = *(this->ispProgramMemoryImage);
+                image.eraseRequested = true;
+                std::fill(image.data.begin(), image.data.end(), 0xFF);
+                std::fill(image.written.begin(), image.written.end(), false);
+                return;
+            }
+
             if (this->targetConfig->physicalInterface == PhysicalInterface::DEBUG_WIRE) {
                 // debugWire targets do not need to be erased
                 return;
@@ -442,6 +528,19 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         );
     }
 
+    std::uint32_t Avr8::computeMemoryCrc(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes
+    ) {
+        if (memoryType == TargetMemoryType::FLASH && this->ispProgramMemoryImage.has_value()) {
+            // The debug tool isn't aware of the program memory writes that are yet to be committed
+            return Crc32::update(Crc32::INITIAL_VALUE, this->readMemory(memoryType, startAddress, bytes, {}));
+        }
+
+        return this->avr8DebugInterface->computeMemoryCrc(memoryType, startAddress, bytes);
+    }
+
     TargetState Avr8::getState() {
         return this->avr8DebugInterface->getTargetState();
     }
@@ -479,93 +578,152 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
     }
 
     std::map<int, TargetPinState> Avr8::getPinStates(int variantId) {
-        const auto targetVariantIt = this->targetVariantsById.find(variantId);
+        const auto pinTableIt = this->gpioPinTablesByVariantId.find(variantId);
 
-        if (targetVariantIt == this->targetVariantsById.end()) {
+        if (pinTableIt == this->gpioPinTablesByVariantId.end()) {
             throw Exception("Invalid target variant ID");
         }
 
-        std::map<int, TargetPinState> output;
-        const auto& variant = targetVariantIt->second;
+        const auto& pinTable = pinTableIt->second;
 
         /*
-         * To prevent the number of memory reads we perform here, we cache the data and map it by start address.
-         *
-         * This way, we only perform 3 memory reads for a target variant with 3 ports - one per port (instead of one
-         * per pin).
+         * We read the GPIO registers for all pins in a single go (via Avr8DebugInterface::readMemoryRanges()), and
+         * extract the value of each register from the returned buffers, at the locations recorded in the pin table.
          *
-         * We may be able to make this more efficient by combining reads for ports with aligned memory addresses. This
-         * will be considered when the need for it becomes apparent.
+         * This way, we only perform a single batch of memory reads for the entire target variant, instead of one
+         * read per register (or one per pin).
          */
-        std::map<std::uint16_t, TargetMemoryBuffer> cachedMemoryByStartAddress;
-        const auto readMemoryBitset = [this, &cachedMemoryByStartAddress] (std::uint16_t startAddress) {
-            auto cachedByteIt = cachedMemoryByStartAddress.find(startAddress);
-
-            if (cachedByteIt == cachedMemoryByStartAddress.end()) {
-                cachedByteIt = cachedMemoryByStartAddress.insert(
-                    std::pair(
-                        startAddress,
-                        this->readMemory(TargetMemoryType::RAM, startAddress, 1)
-                    )
-                ).first;
-            }
+        const auto registerValues = this->avr8DebugInterface->readMemoryRanges(
+            TargetMemoryType::RAM,
+            pinTable.addressRanges
+        );
 
-            return std::bitset<std::numeric_limits<unsigned char>::digits>(
-                cachedByteIt->second.at(0)
-            );
+        const auto isBitSet = [&registerValues] (const GpioRegisterLocation& location, unsigned char mask) {
+            return (registerValues[location.rangeIndex][location.offset] & mask) != 0;
         };
 
-        for (const auto& [pinNumber, pinDescriptor] : variant.pinDescriptorsByNumber) {
-            const auto padIt = this->padDescriptorsByName.find(pinDescriptor.padName);
+        auto output = std::map<int, TargetPinState>();
 
-            if (padIt != this->padDescriptorsByName.end()) {
-                const auto& pad = padIt->second;
+        for (const auto& pin : pinTable.pins) {
+            auto pinState = TargetPinState();
 
-                if (!pad.gpioPinNumber.has_value()) {
-                    continue;
+            if (pin.ddrLocation.has_value()) {
+                pinState.ioDirection = isBitSet(*(pin.ddrLocation), pin.mask)
+                    ? TargetPinState::IoDirection::OUTPUT
+                    : TargetPinState::IoDirection::INPUT;
+
+                const auto& stateLocation = pinState.ioDirection == TargetPinState::IoDirection::OUTPUT
+                    ? pin.portLocation
+                    : pin.portInputLocation;
+
+                if (stateLocation.has_value()) {
+                    pinState.ioState = isBitSet(*stateLocation, pin.mask)
+                        ? TargetPinState::IoState::HIGH
+                        : TargetPinState::IoState::LOW;
                 }
+            }
+
+            // The pins are sorted by number, so each insertion takes place at the end of the map
+            output.emplace_hint(output.end(), pin.pinNumber, pinState);
+        }
 
-                auto pinState = TargetPinState();
+        return output;
+    }
 
-                if (pad.gpioDdrAddress.has_value()) {
-                    const auto ddrValue = readMemoryBitset(pad.gpioDdrAddress.value());
+    void Avr8::loadGpioPinTables() {
+        this->gpioPinTablesByVariantId.clear();
 
-                    pinState.ioDirection = ddrValue.test(pad.gpioPinNumber.value()) ?
-                        TargetPinState::IoDirection::OUTPUT : TargetPinState::IoDirection::INPUT;
+        const auto& padDescriptorsByName = this->targetDescriptionFile->getPadDescriptorsMappedByName();
 
-                    if (pinState.ioDirection == TargetPinState::IoDirection::OUTPUT
-                        && pad.gpioPortAddress.has_value()
-                    ) {
-                        const auto portRegisterValueBitset = readMemoryBitset(pad.gpioPortAddress.value());
-                        pinState.ioState = portRegisterValueBitset.test(pad.gpioPinNumber.value()) ?
-                            TargetPinState::IoState::HIGH : TargetPinState::IoState::LOW;
+        for (const auto& [variantId, variant] : this->targetDescriptionFile->getVariantsMappedById()) {
+            auto gpioPads = std::vector<std::pair<int, const PadDescriptor*>>();
+            auto registerAddresses = std::set<std::uint16_t>();
 
-                    } else if (pinState.ioDirection == TargetPinState::IoDirection::INPUT
-                        && pad.gpioPortInputAddress.has_value()
-                    ) {
-                        const auto portInputRegisterValue = readMemoryBitset(pad.gpioPortInputAddress.value());
-                        pinState.ioState = portInputRegisterValue.test(pad.gpioPinNumber.value()) ?
-                            TargetPinState::IoState::HIGH : TargetPinState::IoState::LOW;
+            for (const auto& [pinNumber, pinDescriptor] : variant.pinDescriptorsByNumber) {
+                const auto padIt = padDescriptorsByName.find(pinDescriptor.padName);
+
+                if (padIt == padDescriptorsByName.end() || !padIt->second.gpioPinNumber.has_value()) {
+                    continue;
+                }
+
+                const auto& pad = padIt->second;
+                gpioPads.emplace_back(pinNumber, &pad);
+
+                for (const auto& address : {pad.gpioDdrAddress, pad.gpioPortAddress, pad.gpioPortInputAddress}) {
+                    if (address.has_value()) {
+                        registerAddresses.insert(address.value());
                     }
                 }
+            }
+
+            auto pinTable = GpioPinTable();
+
+            /*
+             * The GPIO registers of a port usually occupy consecutive addresses (PINx, DDRx, PORTx), and the
+             * registers of neighbouring ports usually follow on from one another. We coalesce consecutive addresses
+             * into a single range, to keep the number of ranges (and thus the work done by readMemoryRanges()) to a
+             * minimum.
+             */
+            for (const auto address : registerAddresses) {
+                if (!pinTable.addressRanges.empty() && pinTable.addressRanges.back().endAddress + 1 == address) {
+                    pinTable.addressRanges.back().endAddress = address;
+                    continue;
+                }
 
-                output.insert(std::pair(pinNumber, pinState));
+                pinTable.addressRanges.emplace_back(address, address);
             }
-        }
 
-        return output;
+            const auto& addressRanges = pinTable.addressRanges;
+            const auto locate = [&addressRanges] (
+                const std::optional<std::uint16_t>& address
+            ) -> std::optional<GpioRegisterLocation> {
+                if (!address.has_value()) {
+                    return std::nullopt;
+                }
+
+                // The ranges are sorted and disjoint - the last range starting at or before the address contains it
+                const auto rangeIt = std::upper_bound(
+                    addressRanges.begin(),
+                    addressRanges.end(),
+                    *address,
+                    [] (std::uint16_t value, const TargetMemoryAddressRange& addressRange) {
+                        return value < addressRange.startAddress;
+                    }
+                ) - 1;
+
+                return GpioRegisterLocation{
+                    .rangeIndex = static_cast<std::size_t>(rangeIt - addressRanges.begin()),
+                    .offset = static_cast<std::size_t>(*address - rangeIt->startAddress),
+                };
+            };
+
+            pinTable.pins.reserve(gpioPads.size());
+            for (const auto& [pinNumber, pad] : gpioPads) {
+                pinTable.pins.emplace_back(GpioPin{
+                    .pinNumber = pinNumber,
+                    .mask = static_cast<unsigned char>(0x01 << pad->gpioPinNumber.value()),
+                    .ddrLocation = locate(pad->gpioDdrAddress),
+                    .portLocation = locate(pad->gpioPortAddress),
+                    .portInputLocation = locate(pad->gpioPortInputAddress),
+                });
+            }
+
+            this->gpioPinTablesByVariantId.emplace(variantId, std::move(pinTable));
+        }
     }
 
     void Avr8::setPinState(const TargetPinDescriptor& pinDescriptor, const TargetPinState& state) {
-        const auto targetVariantIt = this->targetVariantsById.find(pinDescriptor.variantId);
+        const auto& targetVariantsById = this->targetDescriptionFile->getVariantsMappedById();
+        const auto& padDescriptorsByName = this->targetDescriptionFile->getPadDescriptorsMappedByName();
+        const auto targetVariantIt = targetVariantsById.find(pinDescriptor.variantId);
 
-        if (targetVariantIt == this->targetVariantsById.end()) {
+        if (targetVariantIt == targetVariantsById.end()) {
             throw Exception("Invalid target variant ID");
         }
 
-        const auto padDescriptorIt = this->padDescriptorsByName.find(pinDescriptor.padName);
+        const auto padDescriptorIt = padDescriptorsByName.find(pinDescriptor.padName);
 
-        if (padDescriptorIt == this->padDescriptorsByName.end()) {
+        if (padDescriptorIt == padDescriptorsByName.end()) {
             throw Exception("Unknown pad");
         }
 
@@ -636,11 +794,40 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
     }
 
     void Avr8::enableProgrammingMode() {
+        if (this->ispFlashProgrammingEnabled()) {
+            /*
+             * We don't enter programming mode on the debugWire interface - program memory writes are buffered and
+             * committed via the ISP interface, at the end of the session. See Avr8::disableProgrammingMode().
+             */
+            this->ispProgramMemoryImage = IspProgramMemoryImage{
+                .data = TargetMemoryBuffer(this->targetParameters->flashSize.value(), 0xFF),
+                .written = std::vector<bool>(this->targetParameters->flashSize.value(), false),
+            };
+
+            this->progModeEnabled = true;
+            return;
+        }
+
         this->avr8DebugInterface->enableProgrammingMode();
         this->progModeEnabled = true;
     }
 
     void Avr8::disableProgrammingMode() {
+        if (this->ispProgramMemoryImage.has_value()) {
+            auto image = std::move(*(this->ispProgramMemoryImage));
+            this->ispProgramMemoryImage = std::nullopt;
+            this->progModeEnabled = false;
+
+            if (
+                image.eraseRequested
+                || std::find(image.written.begin(), image.written.end(), true) != image.written.end()
+            ) {
+                this->programProgramMemoryViaIsp(image);
+            }
+
+            return;
+        }
+
         this->avr8DebugInterface->disableProgrammingMode();
         this->progModeEnabled = false;
     }
@@ -649,8 +836,20 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         return this->progModeEnabled;
     }
 
+    bool Avr8::programMemoryPageRewritesSupported() {
+        return this->avr8DebugInterface->programMemoryPageRewritesSupported();
+    }
+
+    bool Avr8::eepromPageWritesSupported() {
+        return this->avr8DebugInterface->eepromPageWritesSupported();
+    }
+
+    bool Avr8::runtimeMemoryAccessSupported() {
+        return this->avr8DebugInterface->runtimeMemoryAccessSupported();
+    }
+
     void Avr8::initFromTargetDescriptionFile() {
-        this->targetDescriptionFile = TargetDescription::TargetDescriptionFile(
+        this->targetDescriptionFile = TargetDescription::TargetDescriptionFile::getShared(
             this->getId(),
             (!this->name.empty()) ? std::optional(this->name) : std::nullopt
         );
@@ -660,8 +859,6 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         this->supportedPhysicalInterfaces = this->targetDescriptionFile->getSupportedPhysicalInterfaces();
 
         this->targetParameters = this->targetDescriptionFile->getTargetParameters();
-        this->padDescriptorsByName = this->targetDescriptionFile->getPadDescriptorsMappedByName();
-        this->targetVariantsById = this->targetDescriptionFile->getVariantsMappedById();
 
         if (!this->targetParameters->stackPointerRegisterLowAddress.has_value()) {
             throw Exception(
@@ -788,7 +985,8 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
                         eepromStartAddress,
                         eepromStartAddress + this->targetParameters->eepromSize.value() - 1
                     ),
-                    TargetMemoryAccess(true, true, true)
+                    TargetMemoryAccess(true, true, true),
+                    this->targetParameters->eepromPageSize
                 )
             ));
         }
@@ -802,6 +1000,239 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         return this->id.value();
     }
 
+    std::chrono::steady_clock::time_point Avr8::cycleTargetPower() {
+        Logger::info("Cycling target power");
+
+        Logger::debug("Disabling target power");
+        this->targetPowerManagementInterface->disableTargetPower();
+
+        Logger::debug(
+            "Holding power off for ~" + std::to_string(this->targetConfig->targetPowerCycleDelay.count()) + " ms"
+        );
+        std::this_thread::sleep_for(this->targetConfig->targetPowerCycleDelay);
+
+        Logger::debug("Enabling target power");
+        this->targetPowerManagementInterface->enableTargetPower();
+
+        Logger::debug(
+            "Waiting up to ~" + std::to_string(this->targetConfig->targetPowerCycleDelay.count())
+                + " ms for target power-up"
+        );
+        return std::chrono::steady_clock::now() + this->targetConfig->targetPowerCycleDelay;
+    }
+
+    void Avr8::activateDebugInterface(std::optional<std::chrono::steady_clock::time_point> powerUpDeadline) {
+        if (powerUpDeadline.has_value()) {
+            auto retryDelay = Avr8::POWER_UP_INITIAL_RETRY_DELAY;
+
+            while (std::chrono::steady_clock::now() < *powerUpDeadline) {
+                try {
+                    this->avr8DebugInterface->activate();
+                    return;
+
+                } catch (const Exception&) {
+                    // The target may not have powered up yet
+                }
+
+                std::this_thread::sleep_for(retryDelay);
+                retryDelay = std::min(retryDelay * 2, Avr8::POWER_UP_MAXIMUM_RETRY_DELAY);
+            }
+        }
+
+        // Final attempt - any failure here will propagate
+        this->avr8DebugInterface->activate();
+    }
+
+    bool Avr8::ispFlashProgrammingEnabled() {
+        if (
+            !this->targetConfig->ispFlashProgramming
+            || this->targetConfig->physicalInterface != PhysicalInterface::DEBUG_WIRE
+            || this->avrIspInterface == nullptr
+            || this->targetPowerManagementInterface == nullptr
+        ) {
+            return false;
+        }
+
+        if (this->targetDescriptionFile == nullptr || !this->id.has_value()) {
+            Logger::warning(
+                "Insufficient target information for ISP programming - falling back to programming via debugWire. "
+                    "Do not use the generic \"avr8\" target name in conjunction with the ISP interface."
+            );
+            return false;
+        }
+
+        const auto ispParameters = this->targetDescriptionFile->getIspParameters();
+        if (
+            !ispParameters.chipEraseDelay.has_value()
+            || !ispParameters.chipErasePollMethod.has_value()
+            || !ispParameters.programMemoryProgramming.has_value()
+            || (this->targetParameters->flashSize.value() % ispParameters.programMemoryProgramming->blockSize) != 0
+        ) {
+            Logger::warning(
+                "The target's TDF does not provide the necessary ISP programming parameters - falling back to "
+                    "programming via debugWire"
+            );
+            return false;
+        }
+
+        return true;
+    }
+
+    void Avr8::programProgramMemoryViaIsp(IspProgramMemoryImage& image) {
+        const auto ispParameters = this->targetDescriptionFile->getIspParameters();
+        const auto pageSize = static_cast<std::size_t>(ispParameters.programMemoryProgramming->blockSize);
+
+        const auto pageFullyWritten = [&image, pageSize] (std::size_t pageOffset) {
+            const auto writtenBegin = image.written.begin() + static_cast<std::ptrdiff_t>(pageOffset);
+            return std::find(writtenBegin, writtenBegin + static_cast<std::ptrdiff_t>(pageSize), false)
+                == writtenBegin + static_cast<std::ptrdiff_t>(pageSize);
+        };
+
+        const auto allErased = [] (std::span<const unsigned char> buffer) {
+            return std::all_of(buffer.begin(), buffer.end(), [] (unsigned char byte) { return byte == 0xFF; });
+        };
+
+        Logger::info("Programming program memory via the ISP interface");
+
+        /*
+         * The debugWire module holds on to the RESET pin, which the ISP interface needs. We disable the module
+         * temporarily - it will be re-enabled by the target power cycle, below.
+         *
+         * The chip erase will wipe any software breakpoints, so we clear them beforehand, to keep the debug tool in
+         * sync with the target.
+         */
+        Logger::debug("Temporarily disabling debugWire");
+        this->avr8DebugInterface->clearAllBreakpoints();
+        this->avr8DebugInterface->disableDebugWire();
+        this->avr8DebugInterface->deactivate();
+
+        auto ispErrorMessage = std::optional<std::string>();
+
+        try {
+            this->avrIspInterface->setIspParameters(ispParameters);
+            this->avrIspInterface->activate();
+
+            try {
+                const auto ispDeviceId = this->avrIspInterface->getDeviceId();
+
+                if (ispDeviceId != this->id) {
+                    throw Exception(
+                        "AVR target signature mismatch - expected signature \"" + this->id->toHex()
+                            + "\" but got \"" + ispDeviceId.toHex() + "\". Please check target configuration."
+                    );
+                }
+
+                if (!image.eraseRequested) {
+                    /*
+                     * The chip erase will wipe all of the program memory, so we read back any pages that weren't
+                     * written in full, in this session. Consecutive pages are read in a single operation.
+                     */
+                    Logger::info("Reading back unchanged program memory via ISP");
+
+                    auto pageOffset = std::size_t(0);
+                    while (pageOffset < image.data.size()) {
+                        if (pageFullyWritten(pageOffset)) {
+                            pageOffset += pageSize;
+                            continue;
+                        }
+
+                        auto endOffset = pageOffset + pageSize;
+                        while (endOffset < image.data.size() && !pageFullyWritten(endOffset)) {
+                            endOffset += pageSize;
+                        }
+
+                        const auto content = this->avrIspInterface->readProgramMemory(
+                            static_cast<std::uint32_t>(pageOffset),
+                            static_cast<std::uint32_t>(endOffset - pageOffset)
+                        );
+
+                        for (auto offset = pageOffset; offset < endOffset; ++offset) {
+                            if (!image.written[offset]) {
+                                image.data[offset] = content[offset - pageOffset];
+                            }
+                        }
+
+                        pageOffset = endOffset;
+                    }
+                }
+
+                auto eepromBackup = std::optional<TargetMemoryBuffer>();
+
+                if (this->targetConfig->preserveEeprom) {
+                    const auto eesaveFuseBitsDescriptor = this->targetDescriptionFile->getEesaveFuseBitsDescriptor();
+
+                    if (
+                        !eesaveFuseBitsDescriptor.has_value()
+                        || !this->createIspFuseTransaction().isProgrammed(*eesaveFuseBitsDescriptor)
+                    ) {
+                        if (!ispParameters.eepromProgramming.has_value()) {
+                            throw Exception(
+                                "The target's TDF does not provide the ISP EEPROM programming parameters - unable "
+                                    "to preserve EEPROM. Disable the 'preserveEeprom' parameter or program the EESAVE "
+                                    "fuse bit to proceed."
+                            );
+                        }
+
+                        Logger::info("Backing up EEPROM via ISP");
+                        eepromBackup = this->avrIspInterface->readEeprom(
+                            0,
+                            this->targetParameters->eepromSize.value()
+                        );
+                    }
+                }
+
+                Logger::info("Erasing chip via ISP");
+                this->avrIspInterface->eraseChip();
+
+                Logger::info("Writing program memory via ISP");
+                for (auto pageOffset = std::size_t(0); pageOffset < image.data.size(); pageOffset += pageSize) {
+                    const auto page = std::span<const unsigned char>(image.data).subspan(pageOffset, pageSize);
+
+                    // Erased pages need not be written
+                    if (!allErased(page)) {
+                        this->avrIspInterface->writeProgramMemory(static_cast<std::uint32_t>(pageOffset), page);
+                    }
+                }
+
+                if (eepromBackup.has_value()) {
+                    Logger::info("Restoring EEPROM via ISP");
+
+                    const auto blockSize = static_cast<std::size_t>(ispParameters.eepromProgramming->blockSize);
+                    for (auto offset = std::size_t(0); offset < eepromBackup->size(); offset += blockSize) {
+                        const auto block = std::span<const unsigned char>(*eepromBackup).subspan(
+                            offset,
+                            std::min(blockSize, eepromBackup->size() - offset)
+                        );
+
+                        if (!allErased(block)) {
+                            this->avrIspInterface->writeEeprom(static_cast<std::uint32_t>(offset), block);
+                        }
+                    }
+                }
+
+            } catch (const Exception& exception) {
+                this->avrIspInterface->deactivate();
+                throw exception;
+            }
+
+            this->avrIspInterface->deactivate();
+
+        } catch (const Exception& exception) {
+            ispErrorMessage = exception.getMessage();
+        }
+
+        // Whatever the outcome, we must restore the debugWire session
+        Logger::debug("Re-enabling debugWire");
+        this->activateDebugInterface(this->cycleTargetPower());
+        this->avr8DebugInterface->reset();
+
+        if (ispErrorMessage.has_value()) {
+            throw Exception("Failed to program program memory via the ISP interface - " + *ispErrorMessage);
+        }
+
+        Logger::info("Program memory successfully programmed via the ISP interface");
+    }
+
     void Avr8::updateDwenFuseBit(bool enable) {
         if (this->avrIspInterface == nullptr) {
             throw Exception(
@@ -811,7 +1242,7 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
             );
         }
 
-        if (!this->targetDescriptionFile.has_value() || !this->id.has_value()) {
+        if (this->targetDescriptionFile == nullptr || !this->id.has_value()) {
             throw Exception(
                 "Insufficient target information for ISP interface - do not use the generic \"avr8\" "
                     "target name in conjunction with the ISP interface. Please update your target configuration."
@@ -901,17 +1332,9 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
 
             Logger::info("Target signature confirmed: " + ispDeviceId.toHex());
 
-            const auto dwenFuseByte = this->avrIspInterface->readFuse(dwenFuseBitsDescriptor->fuseType).value;
-            const auto spienFuseByte = (spienFuseBitsDescriptor->fuseType == dwenFuseBitsDescriptor->fuseType)
-                ? dwenFuseByte
-                : this->avrIspInterface->readFuse(spienFuseBitsDescriptor->fuseType).value;
+            auto fuseTransaction = this->createIspFuseTransaction();
 
-            /*
-             * Keep in mind that, for AVR fuses and lock bits, a set bit (0b1) means the fuse/lock is cleared, and a
-             * cleared bit (0b0), means the fuse/lock is set.
-             */
-
-            if ((spienFuseByte & spienFuseBitsDescriptor->bitMask) != 0) {
+            if (!fuseTransaction.isProgrammed(*spienFuseBitsDescriptor)) {
                 /*
                  * If we get here, something is very wrong. The SPIEN (SPI enable) fuse bit appears to be cleared, but
                  * this is not possible because we're connected to the target via the SPI (the ISP interface uses a
@@ -931,7 +1354,7 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
 
             Logger::info("Current SPIEN fuse bit value confirmed");
 
-            if (!static_cast<bool>(dwenFuseByte & dwenFuseBitsDescriptor->bitMask) == enable) {
+            if (fuseTransaction.isProgrammed(*dwenFuseBitsDescriptor) == enable) {
                 /*
                  * The DWEN fuse appears to already be set to the desired value. This may be a result of incorrect data
                  * in the TDF, but we're not taking any chances.
@@ -945,6 +1368,10 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
                 return;
             }
 
+            /*
+             * Keep in mind that, for AVR lock bits, a set bit (0b1) means the lock is cleared, and a cleared bit
+             * (0b0), means the lock is set.
+             */
             const auto lockBitByte = this->avrIspInterface->readLockBitByte();
             if (lockBitByte != 0xFF) {
                 /*
@@ -959,19 +1386,9 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
 
             Logger::info("Cleared lock bits confirmed");
 
-            const auto newFuse = Fuse(
-                dwenFuseBitsDescriptor->fuseType,
-                (enable) ? static_cast<unsigned char>(dwenFuseByte & ~(dwenFuseBitsDescriptor->bitMask))
-                    : static_cast<unsigned char>(dwenFuseByte | dwenFuseBitsDescriptor->bitMask)
-            );
-
             Logger::warning("Updating DWEN fuse bit");
-            this->avrIspInterface->programFuse(newFuse);
-
-            Logger::debug("Verifying DWEN fuse bit");
-            if (this->avrIspInterface->readFuse(dwenFuseBitsDescriptor->fuseType).value != newFuse.value) {
-                throw Exception("Failed to update DWEN fuse bit - post-update verification failed");
-            }
+            fuseTransaction.setProgrammed(*dwenFuseBitsDescriptor, enable);
+            fuseTransaction.commit();
 
             Logger::info("DWEN fuse bit successfully updated");
 
@@ -985,9 +1402,8 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
 
     void Avr8::updateOcdenFuseBit(bool enable) {
         using Services::PathService;
-        using Services::StringService;
 
-        if (!this->targetDescriptionFile.has_value() || !this->id.has_value()) {
+        if (this->targetDescriptionFile == nullptr || !this->id.has_value()) {
             throw Exception(
                 "Insufficient target information for managing OCDEN fuse bit - do not use the generic \"avr8\" "
                     "target name in conjunction with the \"manageOcdenFuseBit\" function. Please update your target "
@@ -1028,23 +1444,9 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         try {
             this->enableProgrammingMode();
 
-            const auto ocdenFuseByteValue = this->avr8DebugInterface->readMemory(
-                TargetMemoryType::FUSES,
-                ocdenFuseBitsDescriptor->byteAddress,
-                1
-            ).at(0);
-            const auto jtagenFuseByteValue = jtagenFuseBitsDescriptor->byteAddress == ocdenFuseBitsDescriptor->byteAddress
-                ? ocdenFuseByteValue
-                : this->avr8DebugInterface->readMemory(
-                    TargetMemoryType::FUSES,
-                    jtagenFuseBitsDescriptor->byteAddress,
-                    1
-                ).at(0)
-            ;
-
-            Logger::debug("OCDEN fuse byte value (before update): 0x" + StringService::toHex(ocdenFuseByteValue));
+            auto fuseTransaction = this->createDebugInterfaceFuseTransaction();
 
-            if ((jtagenFuseByteValue & jtagenFuseBitsDescriptor->bitMask) != 0) {
+            if (!fuseTransaction.isProgrammed(*jtagenFuseBitsDescriptor)) {
                 /*
                  * If we get here, something has gone wrong. The JTAGEN fuse should always be programmed by this point.
                  * We wouldn't have been able to activate the JTAG physical interface if the fuse wasn't programmed.
@@ -1058,36 +1460,16 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
                 );
             }
 
-            if (!static_cast<bool>(ocdenFuseByteValue & ocdenFuseBitsDescriptor->bitMask) == enable) {
+            if (fuseTransaction.isProgrammed(*ocdenFuseBitsDescriptor) == enable) {
                 Logger::debug("OCDEN fuse bit already set to desired value - aborting update operation");
 
                 this->disableProgrammingMode();
                 return;
             }
 
-            const auto newValue = (enable)
-                ? static_cast<unsigned char>(ocdenFuseByteValue & ~(ocdenFuseBitsDescriptor->bitMask))
-                : static_cast<unsigned char>(ocdenFuseByteValue | ocdenFuseBitsDescriptor->bitMask);
-
-            Logger::debug("New OCDEN fuse byte value (to be written): 0x" + StringService::toHex(newValue));
-
             Logger::warning("Updating OCDEN fuse bit");
-            this->avr8DebugInterface->writeMemory(
-                TargetMemoryType::FUSES,
-                ocdenFuseBitsDescriptor->byteAddress,
-                {newValue}
-            );
-
-            Logger::debug("Verifying OCDEN fuse bit");
-            const auto postUpdateOcdenByteValue = this->avr8DebugInterface->readMemory(
-                TargetMemoryType::FUSES,
-                ocdenFuseBitsDescriptor->byteAddress,
-                1
-            ).at(0);
-
-            if (postUpdateOcdenByteValue != newValue) {
-                throw Exception("Failed to update OCDEN fuse bit - post-update verification failed");
-            }
+            fuseTransaction.setProgrammed(*ocdenFuseBitsDescriptor, enable);
+            fuseTransaction.commit();
 
             Logger::info("OCDEN fuse bit updated");
 
@@ -1099,6 +1481,32 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         }
     }
 
+    FuseTransaction Avr8::createIspFuseTransaction() {
+        return FuseTransaction(
+            [this] (const FuseBitsDescriptor& fuseBitsDescriptor) {
+                return this->avrIspInterface->readFuse(fuseBitsDescriptor.fuseType).value;
+            },
+            [this] (const FuseBitsDescriptor& fuseBitsDescriptor, std::uint8_t value) {
+                this->avrIspInterface->programFuse(Fuse(fuseBitsDescriptor.fuseType, value));
+            }
+        );
+    }
+
+    FuseTransaction Avr8::createDebugInterfaceFuseTransaction() {
+        return FuseTransaction(
+            [this] (const FuseBitsDescriptor& fuseBitsDescriptor) {
+                return this->avr8DebugInterface->readMemory(
+                    TargetMemoryType::FUSES,
+                    fuseBitsDescriptor.byteAddress,
+                    1
+                ).at(0);
+            },
+            [this] (const FuseBitsDescriptor& fuseBitsDescriptor, std::uint8_t value) {
+                this->avr8DebugInterface->writeMemory(TargetMemoryType::FUSES, fuseBitsDescriptor.byteAddress, {value});
+            }
+        );
+    }
+
     ProgramMemorySection Avr8::getProgramMemorySectionFromAddress(std::uint32_t address) {
         return this->targetParameters->bootSectionStartAddress.has_value()
             && address >= this->targetParameters->bootSectionStartAddress.value()
@@ -4,8 +4,12 @@
 #include <queue>
 #include <utility>
 #include <optional>
+#include <memory>
+#include <chrono>
+#include <vector>
 
 #include "src/Targets/Microchip/AVR/Target.hpp"
+#include "src/Targets/Microchip/AVR/FuseTransaction.hpp"
 #include "src/DebugToolDrivers/DebugTool.hpp"
 
 #include "src/DebugToolDrivers/TargetInterfaces/Microchip/AVR/AVR8/Avr8DebugInterface.hpp"
@@ -14,6 +18,7 @@
 #include "Family.hpp"
 #include "TargetParameters.hpp"
 #include "PadDescriptor.hpp"
+#include "GpioPinTable.hpp"
 #include "ProgramMemorySection.hpp"
 #include "src/Targets/TargetRegister.hpp"
 
@@ -86,18 +91,30 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         }
 
         TargetDescriptor getDescriptor() override;
+        std::vector<TargetVariant> getVariants() override;
 
         void run(std::optional<TargetMemoryAddress> toAddress = std::nullopt) override;
         void stop() override;
         void step() override;
         void reset() override;
 
-        void setBreakpoint(TargetProgramCounter address) override;
-        void removeBreakpoint(TargetProgramCounter address) override;
+        void setSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) override;
+        void removeSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) override;
+        std::uint16_t getHardwareBreakpointCount() override;
+        void setHardwareBreakpoint(std::uint16_t index, TargetMemoryAddress address) override;
+        void removeHardwareBreakpoint(std::uint16_t index) override;
+
+        std::uint16_t getDataBreakpointCount() override;
+        void setDataBreakpoint(
+            std::uint16_t index,
+            TargetMemoryAddress address,
+            TargetWatchpointType type
+        ) override;
+        void removeDataBreakpoint(std::uint16_t index) override;
         void clearAllBreakpoints() override;
 
-        void writeRegisters(TargetRegisters registers) override;
-        TargetRegisters readRegisters(TargetRegisterDescriptors descriptors) override;
+        void writeRegisters(const TargetRegisters& registers) override;
+        TargetRegisters readRegisters(const TargetRegisterDescriptors& descriptors) override;
 
         TargetMemoryBuffer readMemory(
             TargetMemoryType memoryType,
@@ -112,6 +129,12 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         ) override;
         void eraseMemory(TargetMemoryType memoryType) override;
 
+        std::uint32_t computeMemoryCrc(
+            TargetMemoryType memoryType,
+            TargetMemoryAddress startAddress,
+            TargetMemorySize bytes
+        ) override;
+
         TargetState getState() override;
 
         TargetProgramCounter getProgramCounter() override;
@@ -131,8 +154,18 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         void disableProgrammingMode() override;
 
         bool programmingModeEnabled() override;
+        bool programMemoryPageRewritesSupported() override;
+        bool eepromPageWritesSupported() override;
+        bool runtimeMemoryAccessSupported() override;
 
     protected:
+        /**
+         * The delay between debugWire activation attempts, following a target power cycle, starts at
+         * POWER_UP_INITIAL_RETRY_DELAY and doubles after each failed attempt, up to POWER_UP_MAXIMUM_RETRY_DELAY.
+         */
+        static constexpr auto POWER_UP_INITIAL_RETRY_DELAY = std::chrono::milliseconds(10);
+        static constexpr auto POWER_UP_MAXIMUM_RETRY_DELAY = std::chrono::milliseconds(100);
+
         DebugToolDrivers::TargetInterfaces::TargetPowerManagementInterface* targetPowerManagementInterface = nullptr;
         DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8::Avr8DebugInterface* avr8DebugInterface = nullptr;
         DebugToolDrivers::TargetInterfaces::Microchip::Avr::AvrIspInterface* avrIspInterface = nullptr;
@@ -141,18 +174,47 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
 
         std::string name;
         std::optional<Family> family;
-        std::optional<TargetDescription::TargetDescriptionFile> targetDescriptionFile;
+        std::shared_ptr<const TargetDescription::TargetDescriptionFile> targetDescriptionFile = nullptr;
 
         std::set<PhysicalInterface> supportedPhysicalInterfaces;
 
         std::optional<TargetParameters> targetParameters;
-        std::map<std::string, PadDescriptor> padDescriptorsByName;
-        std::map<int, TargetVariant> targetVariantsById;
+
+        /**
+         * The GPIO pin tables of all target variants, mapped by variant ID. See Avr8::loadGpioPinTables().
+         */
+        std::map<int, GpioPinTable> gpioPinTablesByVariantId;
         std::map<TargetRegisterType, TargetRegisterDescriptors> targetRegisterDescriptorsByType;
         std::map<TargetMemoryType, TargetMemoryDescriptor> targetMemoryDescriptorsByType;
 
         bool progModeEnabled = false;
 
+        /**
+         * When programming the program memory via the ISP interface (see Avr8TargetConfig::ispFlashProgramming),
+         * program memory writes are buffered for the duration of the programming session, and committed to the
+         * target upon the end of the session (see Avr8::disableProgrammingMode()).
+         */
+        struct IspProgramMemoryImage
+        {
+            /**
+             * The buffered program memory content, covering the entire program memory.
+             */
+            TargetMemoryBuffer data;
+
+            /**
+             * Flags for each byte in this->data, indicating whether the byte was written in this session.
+             */
+            std::vector<bool> written;
+
+            /**
+             * Whether the program memory was erased in this session. If so, any bytes that weren't written in this
+             * session are to be left in the erased state (0xFF).
+             */
+            bool eraseRequested = false;
+        };
+
+        std::optional<IspProgramMemoryImage> ispProgramMemoryImage;
+
         /**
          * Initiates the AVR8 instance from data extracted from the TDF.
          */
@@ -166,6 +228,11 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
 
         void loadTargetMemoryDescriptors();
 
+        /**
+         * Populates this->gpioPinTablesByVariantId with a GpioPinTable for each target variant.
+         */
+        void loadGpioPinTables();
+
         /**
          * Extracts the ID from the target's memory.
          *
@@ -175,6 +242,46 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
          */
         TargetSignature getId() override;
 
+        /**
+         * Cycles the target power, via the target power management interface.
+         *
+         * @return
+         *  The deadline for the target power-up. See Avr8::activateDebugInterface().
+         */
+        std::chrono::steady_clock::time_point cycleTargetPower();
+
+        /**
+         * Activates the debug interface.
+         *
+         * @param powerUpDeadline
+         *  Following a target power cycle, the target may take some time to power up. If a deadline is given, the
+         *  activation is retried until the deadline passes, starting with a delay of POWER_UP_INITIAL_RETRY_DELAY
+         *  between attempts. A final attempt is made after the deadline, and any failure in that attempt will
+         *  propagate.
+         */
+        void activateDebugInterface(std::optional<std::chrono::steady_clock::time_point> powerUpDeadline);
+
+        /**
+         * Checks if the program memory should be programmed via the ISP interface, for this session. See
+         * Avr8TargetConfig::ispFlashProgramming.
+         *
+         * @return
+         */
+        bool ispFlashProgrammingEnabled();
+
+        /**
+         * Programs the buffered program memory image via the ISP interface.
+         *
+         * The debugWire module is disabled for the duration of the operation, and then re-enabled via a target power
+         * cycle. Program memory pages that weren't fully written in the programming session are read back via ISP
+         * before the chip erase, and rewritten along with the new pages. The EEPROM is also preserved, unless the
+         * EESAVE fuse bit is programmed (in which case the chip erase won't touch it) or the user has disabled
+         * Avr8TargetConfig::preserveEeprom.
+         *
+         * @param image
+         */
+        void programProgramMemoryViaIsp(IspProgramMemoryImage& image);
+
         /**
          * Updates the debugWire enable (DWEN) fuse bit on the AVR target.
          *
@@ -191,6 +298,22 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
          */
         void updateOcdenFuseBit(bool enable);
 
+        /**
+         * Creates a fuse transaction that accesses the target's fuses via the ISP interface. The ISP interface must
+         * be active for the lifetime of the transaction.
+         *
+         * @return
+         */
+        FuseTransaction createIspFuseTransaction();
+
+        /**
+         * Creates a fuse transaction that accesses the target's fuses via the debug interface. The target must be in
+         * programming mode for the lifetime of the transaction.
+         *
+         * @return
+         */
+        FuseTransaction createDebugInterfaceFuseTransaction();
+
         /**
          * Resolves the program memory section from a program memory address.
          *
@@ -61,5 +61,26 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         if (targetNode["preserveEeprom"]) {
             this->preserveEeprom = targetNode["preserveEeprom"].as<bool>();
         }
+
+        if (targetNode["interfaceClockSpeed"]) {
+            const auto clockSpeed = targetNode["interfaceClockSpeed"].as<int>(0);
+
+            if (clockSpeed <= 0 || clockSpeed > 0xFFFF) {
+                throw InvalidConfig(
+                    "Invalid interface clock speed (\"" + targetNode["interfaceClockSpeed"].as<std::string>()
+                        + "\") - the clock speed must be given in kHz, between 1 and 65535."
+                );
+            }
+
+            this->interfaceClockSpeed = static_cast<std::uint16_t>(clockSpeed);
+        }
+
+        if (targetNode["tuneInterfaceClock"]) {
+            this->tuneInterfaceClock = targetNode["tuneInterfaceClock"].as<bool>();
+        }
+
+        if (targetNode["ispFlashProgramming"]) {
+            this->ispFlashProgramming = targetNode["ispFlashProgramming"].as<bool>();
+        }
     }
 }
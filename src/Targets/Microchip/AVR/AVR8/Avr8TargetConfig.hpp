@@ -3,6 +3,8 @@
 #include <chrono>
 #include <string>
 #include <map>
+#include <optional>
+#include <cstdint>
 
 #include "src/ProjectConfig.hpp"
 
@@ -77,8 +79,9 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         bool manageOcdenFuseBit = false;
 
         /**
-         * With JTAG and UPDI targets, we have to perform a full chip erase when updating the target's flash memory.
-         * This means the user will lose their EEPROM data whenever they wish to upload any program changes via Bloom.
+         * With JTAG targets, we have to perform a full chip erase when updating the target's flash memory. The same
+         * applies to UPDI targets, when the entire program memory is erased. This means the user will lose their
+         * EEPROM data whenever they wish to upload any program changes via Bloom.
          *
          * The preserveEeprom flag determines if Bloom should preserve the target's EEPROM when performing a full chip
          * erase. If enabled, we'll take a backup of the target's EEPROM just before performing the chip erase, then
@@ -93,6 +96,41 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
          */
         bool preserveEeprom = true;
 
+        /**
+         * The clock speed (in kHz) of the programming/debugging interface (PDI, UPDI or JTAG). This has no effect on
+         * debugWire targets, where the interface clock is derived from the target's clock.
+         *
+         * If set, Bloom will use this clock speed, without any tuning (see Avr8TargetConfig::tuneInterfaceClock).
+         *
+         * This parameter is optional.
+         */
+        std::optional<std::uint16_t> interfaceClockSpeed;
+
+        /**
+         * If enabled (and no interfaceClockSpeed has been given), Bloom will step up the interface clock upon
+         * activating the target, validating each step with a series of read-back tests, and settle on the highest
+         * stable clock speed. The result is cached (per debug tool and target), so subsequent activations skip the
+         * tuning.
+         *
+         * This parameter is optional. The function is enabled by default.
+         */
+        bool tuneInterfaceClock = true;
+
+        /**
+         * Programming the program memory of debugWire targets, via the debugWire interface, is slow - each page is
+         * written via the debugWire monitor. If enabled, Bloom will instead program the program memory via the ISP
+         * interface, at the end of the programming session: debugWire is temporarily disabled, the target is chip
+         * erased and programmed via ISP, and then the target power is cycled to re-enable debugWire.
+         *
+         * This requires a debug tool with an ISP interface and the ability to manage the target's power (to re-enable
+         * debugWire). The chip erase clears all of the program memory, so Bloom reads back any unchanged pages
+         * beforehand, and rewrites them. It also backs up and restores the EEPROM, if the EESAVE fuse bit isn't
+         * programmed and preserveEeprom is enabled.
+         *
+         * This parameter is optional, and the function is disabled by default.
+         */
+        bool ispFlashProgramming = false;
+
         explicit Avr8TargetConfig(const TargetConfig& targetConfig);
 
     private:
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::Targets::Microchip::Avr::Avr8Bit
+{
+    /**
+     * The location of a GPIO register's value, in the buffers returned by a readMemoryRanges() call for the
+     * address ranges of a GpioPinTable.
+     */
+    struct GpioRegisterLocation
+    {
+        std::size_t rangeIndex = 0;
+        std::size_t offset = 0;
+    };
+
+    /**
+     * A GPIO pin, as mapped on a particular target variant.
+     */
+    struct GpioPin
+    {
+        int pinNumber = 0;
+
+        /**
+         * The mask of the pin's bit, in each of its GPIO registers.
+         */
+        unsigned char mask = 0x00;
+
+        std::optional<GpioRegisterLocation> ddrLocation;
+        std::optional<GpioRegisterLocation> portLocation;
+        std::optional<GpioRegisterLocation> portInputLocation;
+    };
+
+    /**
+     * The GPIO pins of a single target variant, with the address ranges of their GPIO registers (DDR, PORT and PIN
+     * registers).
+     *
+     * This is a flattened form of the variant's pin descriptors and the pad descriptors they map to. It allows us
+     * to compute the state of every GPIO pin on the variant from a single readMemoryRanges() call, without any pad
+     * lookups. See Avr8::getPinStates().
+     *
+     * GpioPinTables are generated upon target activation (see Avr8::loadGpioPinTables()).
+     */
+    struct GpioPinTable
+    {
+        /**
+         * Sorted by pin number.
+         */
+        std::vector<GpioPin> pins;
+
+        /**
+         * The GPIO register address ranges, with consecutive registers coalesced into a single range. Sorted by
+         * start address.
+         */
+        std::vector<TargetMemoryAddressRange> addressRanges;
+    };
+}
@@ -0,0 +1,230 @@
+#include "InstructionDecoder.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace Bloom::Targets::Microchip::Avr::Avr8Bit
+{
+    namespace
+    {
+        struct OpcodeDescriptor
+        {
+            std::uint16_t mask;
+            std::uint16_t value;
+            std::string_view mnemonic;
+            InstructionType type = InstructionType::OTHER;
+            TargetMemorySize byteSize = 2;
+        };
+
+        /**
+         * The AVR instruction set, by the encoding of the first word of each instruction.
+         *
+         * Where encodings overlap, the first matching descriptor wins, so more specific encodings must precede the
+         * more general ones (RET must precede BSET/BCLR, for example).
+         */
+        constexpr auto OPCODE_DESCRIPTORS = std::to_array<OpcodeDescriptor>({
+            {0xFFFF, 0x0000, "NOP"},
+            {0xFF00, 0x0100, "MOVW"},
+            {0xFF00, 0x0200, "MULS"},
+            {0xFF88, 0x0300, "MULSU"},
+            {0xFF88, 0x0308, "FMUL"},
+            {0xFF88, 0x0380, "FMULS"},
+            {0xFF88, 0x0388, "FMULSU"},
+            {0xFC00, 0x0400, "CPC"},
+            {0xFC00, 0x0800, "SBC"},
+            {0xFC00, 0x0C00, "ADD"},
+            {0xFC00, 0x1000, "CPSE", InstructionType::SKIP},
+            {0xFC00, 0x1400, "CP"},
+            {0xFC00, 0x1800, "SUB"},
+            {0xFC00, 0x1C00, "ADC"},
+            {0xFC00, 0x2000, "AND"},
+            {0xFC00, 0x2400, "EOR"},
+            {0xFC00, 0x2800, "OR"},
+            {0xFC00, 0x2C00, "MOV"},
+            {0xF000, 0x3000, "CPI"},
+            {0xF000, 0x4000, "SBCI"},
+            {0xF000, 0x5000, "SUBI"},
+            {0xF000, 0x6000, "ORI"},
+            {0xF000, 0x7000, "ANDI"},
+
+            {0xFE0F, 0x9000, "LDS", InstructionType::OTHER, 4},
+            {0xFE0F, 0x9001, "LD"},
+            {0xFE0F, 0x9002, "LD"},
+            {0xFE0F, 0x9004, "LPM"},
+            {0xFE0F, 0x9005, "LPM"},
+            {0xFE0F, 0x9006, "ELPM"},
+            {0xFE0F, 0x9007, "ELPM"},
+            {0xFE0F, 0x9009, "LD"},
+            {0xFE0F, 0x900A, "LD"},
+            {0xFE0F, 0x900C, "LD"},
+            {0xFE0F, 0x900D, "LD"},
+            {0xFE0F, 0x900E, "LD"},
+            {0xFE0F, 0x900F, "POP"},
+
+            {0xFE0F, 0x9200, "STS", InstructionType::OTHER, 4},
+            {0xFE0F, 0x9201, "ST"},
+            {0xFE0F, 0x9202, "ST"},
+            {0xFE0F, 0x9204, "XCH"},
+            {0xFE0F, 0x9205, "LAS"},
+            {0xFE0F, 0x9206, "LAC"},
+            {0xFE0F, 0x9207, "LAT"},
+            {0xFE0F, 0x9209, "ST"},
+            {0xFE0F, 0x920A, "ST"},
+            {0xFE0F, 0x920C, "ST"},
+            {0xFE0F, 0x920D, "ST"},
+            {0xFE0F, 0x920E, "ST"},
+            {0xFE0F, 0x920F, "PUSH"},
+
+            {0xFFFF, 0x9409, "IJMP", InstructionType::INDIRECT_JUMP},
+            {0xFFFF, 0x9419, "EIJMP", InstructionType::INDIRECT_JUMP},
+            {0xFFFF, 0x9508, "RET", InstructionType::RETURN},
+            {0xFFFF, 0x9509, "ICALL", InstructionType::INDIRECT_CALL},
+            {0xFFFF, 0x9518, "RETI", InstructionType::RETURN},
+            {0xFFFF, 0x9519, "EICALL", InstructionType::INDIRECT_CALL},
+            {0xFFFF, 0x9588, "SLEEP"},
+            {0xFFFF, 0x9598, "BREAK"},
+            {0xFFFF, 0x95A8, "WDR"},
+            {0xFFFF, 0x95C8, "LPM"},
+            {0xFFFF, 0x95D8, "ELPM"},
+            {0xFFFF, 0x95E8, "SPM"},
+            {0xFFFF, 0x95F8, "SPM"},
+            {0xFF8F, 0x9408, "BSET"},
+            {0xFF8F, 0x9488, "BCLR"},
+            {0xFF0F, 0x940B, "DES"},
+            {0xFE0F, 0x9400, "COM"},
+            {0xFE0F, 0x9401, "NEG"},
+            {0xFE0F, 0x9402, "SWAP"},
+            {0xFE0F, 0x9403, "INC"},
+            {0xFE0F, 0x9405, "ASR"},
+            {0xFE0F, 0x9406, "LSR"},
+            {0xFE0F, 0x9407, "ROR"},
+            {0xFE0F, 0x940A, "DEC"},
+            {0xFE0E, 0x940C, "JMP", InstructionType::JUMP, 4},
+            {0xFE0E, 0x940E, "CALL", InstructionType::CALL, 4},
+            {0xFF00, 0x9600, "ADIW"},
+            {0xFF00, 0x9700, "SBIW"},
+            {0xFF00, 0x9800, "CBI"},
+            {0xFF00, 0x9900, "SBIC", InstructionType::SKIP},
+            {0xFF00, 0x9A00, "SBI"},
+            {0xFF00, 0x9B00, "SBIS", InstructionType::SKIP},
+            {0xFC00, 0x9C00, "MUL"},
+
+            // LD and ST with displacement (LDD and STD). A displacement of 0 is the plain LD/ST via Y or Z.
+            {0xD208, 0x8000, "LDD"},
+            {0xD208, 0x8008, "LDD"},
+            {0xD208, 0x8200, "STD"},
+            {0xD208, 0x8208, "STD"},
+
+            {0xF800, 0xB000, "IN"},
+            {0xF800, 0xB800, "OUT"},
+            {0xF000, 0xC000, "RJMP", InstructionType::JUMP},
+            {0xF000, 0xD000, "RCALL", InstructionType::CALL},
+            {0xF000, 0xE000, "LDI"},
+            {0xFC00, 0xF000, "BRBS", InstructionType::BRANCH},
+            {0xFC00, 0xF400, "BRBC", InstructionType::BRANCH},
+            {0xFE08, 0xF800, "BLD"},
+            {0xFE08, 0xFA00, "BST"},
+            {0xFE08, 0xFC00, "SBRC", InstructionType::SKIP},
+            {0xFE08, 0xFE00, "SBRS", InstructionType::SKIP},
+        });
+
+        constexpr auto UNDEFINED_OPCODE = std::uint8_t(0xFF);
+        static_assert(OPCODE_DESCRIPTORS.size() < UNDEFINED_OPCODE);
+
+        /**
+         * Maps every possible first word to the index of its descriptor in OPCODE_DESCRIPTORS.
+         */
+        const std::array<std::uint8_t, 0x10000>& descriptorIndicesByOpcode() {
+            static const auto lookupTable = [] {
+                auto lookupTable = std::array<std::uint8_t, 0x10000>();
+                lookupTable.fill(UNDEFINED_OPCODE);
+
+                for (auto opcode = std::uint32_t(0); opcode < lookupTable.size(); ++opcode) {
+                    for (auto index = std::size_t(0); index < OPCODE_DESCRIPTORS.size(); ++index) {
+                        const auto& descriptor = OPCODE_DESCRIPTORS[index];
+
+                        if ((opcode & descriptor.mask) == descriptor.value) {
+                            lookupTable[opcode] = static_cast<std::uint8_t>(index);
+                            break;
+                        }
+                    }
+                }
+
+                return lookupTable;
+            }();
+
+            return lookupTable;
+        }
+
+        /**
+         * Computes the byte address of the destination of a relative call, jump or branch.
+         *
+         * @param address
+         * @param wordOffset
+         *  The (signed) word offset, relative to the following instruction.
+         *
+         * @return
+         */
+        TargetMemoryAddress relativeDestination(TargetMemoryAddress address, std::int32_t wordOffset) {
+            return static_cast<TargetMemoryAddress>(static_cast<std::int64_t>(address) + 2 + (wordOffset * 2));
+        }
+    }
+
+    std::optional<Instruction> InstructionDecoder::decode(
+        TargetMemoryAddress address,
+        std::span<const unsigned char> data
+    ) {
+        if (data.size() < 2) {
+            return std::nullopt;
+        }
+
+        // Instructions are stored in little-endian byte order
+        const auto opcode = static_cast<std::uint16_t>(data[0] | (data[1] << 8));
+        const auto descriptorIndex = descriptorIndicesByOpcode()[opcode];
+
+        if (descriptorIndex == UNDEFINED_OPCODE) {
+            return std::nullopt;
+        }
+
+        const auto& descriptor = OPCODE_DESCRIPTORS[descriptorIndex];
+
+        if (data.size() < descriptor.byteSize) {
+            return std::nullopt;
+        }
+
+        auto instruction = Instruction();
+        instruction.mnemonic = descriptor.mnemonic;
+        instruction.type = descriptor.type;
+        instruction.byteSize = descriptor.byteSize;
+        instruction.opcode = opcode;
+
+        if (instruction.type == InstructionType::CALL || instruction.type == InstructionType::JUMP) {
+            if (instruction.byteSize == 4) {
+                // 22-bit word address - the upper 6 bits reside in the first word, the remaining 16 in the second
+                const auto upperBits = static_cast<TargetMemoryAddress>(((opcode >> 3) & 0x3E) | (opcode & 0x01));
+                const auto lowerBits = static_cast<TargetMemoryAddress>(data[2] | (data[3] << 8));
+                instruction.destinationAddress = ((upperBits << 16) | lowerBits) * 2;
+
+            } else {
+                // 12-bit signed word offset
+                auto wordOffset = static_cast<std::int32_t>(opcode & 0x0FFF);
+                if ((wordOffset & 0x0800) != 0) {
+                    wordOffset -= 0x1000;
+                }
+
+                instruction.destinationAddress = relativeDestination(address, wordOffset);
+            }
+
+        } else if (instruction.type == InstructionType::BRANCH) {
+            // 7-bit signed word offset
+            auto wordOffset = static_cast<std::int32_t>((opcode >> 3) & 0x7F);
+            if ((wordOffset & 0x40) != 0) {
+                wordOffset -= 0x80;
+            }
+
+            instruction.destinationAddress = relativeDestination(address, wordOffset);
+        }
+
+        return instruction;
+    }
+}
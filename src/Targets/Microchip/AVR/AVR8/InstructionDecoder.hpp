@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <optional>
+#include <span>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::Targets::Microchip::Avr::Avr8Bit
+{
+    enum class InstructionType: std::uint8_t
+    {
+        OTHER,
+
+        /**
+         * CALL and RCALL.
+         */
+        CALL,
+
+        /**
+         * ICALL and EICALL - the destination is held in the Z register (and EIND), so it can't be decoded.
+         */
+        INDIRECT_CALL,
+
+        /**
+         * JMP and RJMP.
+         */
+        JUMP,
+
+        /**
+         * IJMP and EIJMP.
+         */
+        INDIRECT_JUMP,
+
+        /**
+         * Conditional relative branches (BRBS and BRBC, and their aliases - BREQ, BRNE, etc).
+         */
+        BRANCH,
+
+        /**
+         * CPSE, SBRC, SBRS, SBIC and SBIS - these skip the next instruction, depending on a condition.
+         */
+        SKIP,
+
+        /**
+         * RET and RETI.
+         */
+        RETURN,
+    };
+
+    struct Instruction
+    {
+        /**
+         * The instruction's mnemonic, as it appears in the AVR instruction set manual. Aliases (LSL, CLR, SEC, BREQ,
+         * etc) are not resolved.
+         */
+        std::string_view mnemonic;
+
+        InstructionType type = InstructionType::OTHER;
+
+        /**
+         * 2 or 4 - LDS, STS, JMP and CALL occupy two words.
+         */
+        TargetMemorySize byteSize = 2;
+
+        /**
+         * The first word of the instruction.
+         */
+        std::uint16_t opcode = 0;
+
+        /**
+         * The byte address of the destination of direct calls, jumps and branches.
+         */
+        std::optional<TargetMemoryAddress> destinationAddress;
+
+        [[nodiscard]] bool isCall() const {
+            return this->type == InstructionType::CALL || this->type == InstructionType::INDIRECT_CALL;
+        }
+    };
+
+    /**
+     * A table-driven decoder for the AVR instruction set.
+     *
+     * The opcode table is expanded into a lookup table, indexed by the first word of the instruction, upon first use.
+     * Decoding an instruction is then a single lookup, plus the extraction of the destination address, for calls,
+     * jumps and branches.
+     *
+     * The decoder doesn't check whether the instruction is supported by any particular target (MUL isn't available
+     * on some tinyAVR targets, for example) - it decodes every instruction in the AVR instruction set, except those
+     * that are exclusive to the reduced core tinyAVR targets (the 16-bit LDS/STS variants), which aren't supported by
+     * Bloom.
+     */
+    class InstructionDecoder
+    {
+    public:
+        /**
+         * Decodes the instruction at the given address.
+         *
+         * @param address
+         *  The byte address of the instruction.
+         *
+         * @param data
+         *  Program memory, beginning at the given address. Four bytes are required to decode two-word instructions.
+         *
+         * @return
+         *  std::nullopt if the opcode is undefined, or there isn't enough data to decode the instruction.
+         */
+        static std::optional<Instruction> decode(
+            TargetMemoryAddress address,
+            std::span<const unsigned char> data
+        );
+    };
+}
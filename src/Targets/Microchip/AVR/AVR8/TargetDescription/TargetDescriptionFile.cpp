@@ -1,8 +1,6 @@
 #include "TargetDescriptionFile.hpp"
 
-#include <QJsonDocument>
-#include <QJsonArray>
-#include <QJsonObject>
+#include "TargetDescriptionIndex.hpp"
 
 #include "src/Services/PathService.hpp"
 #include "src/Logger/Logger.hpp"
@@ -27,54 +25,43 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
         std::optional<std::string> targetName
     ) {
         const auto targetSignatureHex = targetSignature.toHex();
-        const auto mapping = TargetDescriptionFile::getTargetDescriptionMapping();
-        const auto descriptionFiles = mapping.find(QString::fromStdString(targetSignatureHex).toLower())->toArray();
+        const auto indexEntries = TargetDescriptionIndex::getEntriesBySignature(targetSignature);
 
-        if (descriptionFiles.empty()) {
+        if (indexEntries.empty()) {
             throw Exception(
                 "Failed to resolve target description file for target \"" + targetSignatureHex
                     + "\" - unknown target signature."
             );
         }
 
-        if (descriptionFiles.size() > 1 && !targetName.has_value()) {
+        if (indexEntries.size() > 1 && !targetName.has_value()) {
             /*
              * There are numerous target description files mapped to this target signature and we don't have a target
              * name to filter by. There's really not much we can do at this point, so we'll just instruct the user to
              * provide a specific target name.
              */
-            auto targetNames = QStringList();
-            std::transform(
-                descriptionFiles.begin(),
-                descriptionFiles.end(),
-                std::back_inserter(targetNames),
-                [] (const QJsonValue& descriptionFile) {
-                    return QString(
-                        "\"" + descriptionFile.toObject().find("targetName")->toString().toLower() + "\""
-                    );
-                }
-            );
+            auto targetNames = std::string();
+
+            for (const auto& indexTargetName : TargetDescriptionIndex::getTargetNamesBySignature(targetSignature)) {
+                targetNames += (targetNames.empty() ? "\"" : ", \"") + indexTargetName + "\"";
+            }
 
             throw Exception(
                 "Failed to resolve target description file for target \"" + targetSignatureHex
                     + "\" - ambiguous signature.\nThe signature is mapped to numerous targets: "
-                    + targetNames.join(", ").toStdString() + ".\n\nPlease update the target name in your Bloom "
+                    + targetNames + ".\n\nPlease update the target name in your Bloom "
                     + "configuration file, to one of the above."
             );
         }
 
-        for (const auto& mappingJsonValue : descriptionFiles) {
-            const auto mappingObject = mappingJsonValue.toObject();
-
-            if (
-                targetName.has_value()
-                && *targetName != mappingObject.find("targetName")->toString().toLower().toStdString()
-            ) {
+        for (const auto& indexEntry : indexEntries) {
+            if (targetName.has_value() && *targetName != indexEntry.targetName) {
                 continue;
             }
 
-            const auto descriptionFilePath = QString::fromStdString(Services::PathService::applicationDirPath()) + "/"
-                + mappingObject.find("targetDescriptionFilePath")->toString();
+            const auto descriptionFilePath = QString::fromStdString(
+                Services::PathService::applicationDirPath() + "/" + std::string(indexEntry.targetDescriptionFilePath)
+            );
 
             Logger::debug("Loading AVR8 target description file: " + descriptionFilePath.toStdString());
             Targets::TargetDescription::TargetDescriptionFile::init(descriptionFilePath);
@@ -88,26 +75,53 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
         );
     }
 
-    void TargetDescriptionFile::init(const QDomDocument& xml) {
-        Targets::TargetDescription::TargetDescriptionFile::init(xml);
+    TargetDescriptionFile::TargetDescriptionFile(const QString& xmlFilePath, bool loadBinaryForm) {
+        if (loadBinaryForm) {
+            Targets::TargetDescription::TargetDescriptionFile::init(xmlFilePath);
+            return;
+        }
 
-        this->loadSupportedPhysicalInterfaces();
-        this->loadPadDescriptors();
-        this->loadTargetVariants();
-        this->loadTargetRegisterDescriptors();
+        this->initFromXml(xmlFilePath);
     }
 
-    QJsonObject TargetDescriptionFile::getTargetDescriptionMapping() {
-        auto mappingFile = QFile(
-            QString::fromStdString(Services::PathService::resourcesDirPath() + "/TargetDescriptionFiles/AVR/Mapping.json")
-        );
+    std::shared_ptr<const TargetDescriptionFile> TargetDescriptionFile::getShared(
+        const TargetSignature& targetSignature,
+        std::optional<std::string> targetName
+    ) {
+        const auto key = targetSignature.toHex() + ":" + targetName.value_or("");
 
-        if (!mappingFile.exists()) {
-            throw Exception("Failed to load AVR target description mapping - mapping file not found");
+        /*
+         * We hold the lock for the duration of the parse, to prevent concurrent callers from parsing the same TDF
+         * more than once.
+         */
+        const auto lock = TargetDescriptionFile::sharedDescriptionFilesByKey.acquireLock();
+        auto& descriptionFilesByKey = TargetDescriptionFile::sharedDescriptionFilesByKey.getValue();
+
+        const auto descriptionFileIt = descriptionFilesByKey.find(key);
+        if (descriptionFileIt != descriptionFilesByKey.end()) {
+            Logger::debug("Using previously loaded AVR8 target description file for target "" + key + """);
+            return descriptionFileIt->second;
         }
 
-        mappingFile.open(QIODevice::ReadOnly);
-        return QJsonDocument::fromJson(mappingFile.readAll()).object();
+        auto descriptionFile = std::make_shared<const TargetDescriptionFile>(targetSignature, std::move(targetName));
+        descriptionFilesByKey.insert(std::pair(key, descriptionFile));
+
+        return descriptionFile;
+    }
+
+    void TargetDescriptionFile::postInit() {
+        this->loadSupportedPhysicalInterfaces();
+        this->loadTargetRegisterDescriptors();
+    }
+
+    const std::map<std::string, PadDescriptor>& TargetDescriptionFile::getPadDescriptorsMappedByName() const {
+        std::call_once(this->padDescriptorsLoadedFlag, &TargetDescriptionFile::loadPadDescriptors, this);
+        return this->padDescriptorsByName;
+    }
+
+    const std::map<int, TargetVariant>& TargetDescriptionFile::getVariantsMappedById() const {
+        std::call_once(this->targetVariantsLoadedFlag, &TargetDescriptionFile::loadTargetVariants, this);
+        return this->targetVariantsById;
     }
 
     TargetSignature TargetDescriptionFile::getTargetSignature() const {
@@ -383,6 +397,59 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
             ispParameterPropertiesByName.at("ispreadlock_pollindex").value.toUShort()
         );
 
+        // The parameters for ISP programming are optional - some values are given in hex, others in decimal
+        const auto propertyValue = [&ispParameterPropertiesByName] (const std::string& name) {
+            const auto propertyIt = ispParameterPropertiesByName.find(name);
+            return propertyIt != ispParameterPropertiesByName.end()
+                ? std::optional(propertyIt->second.value.toUShort(nullptr, 0))
+                : std::nullopt;
+        };
+
+        const auto memoryProgrammingParameters = [&propertyValue] (const std::string& prefix) {
+            const auto mode = propertyValue(prefix + "_mode");
+            const auto delay = propertyValue(prefix + "_delay");
+            const auto loadPageCommand = propertyValue(prefix + "_cmd1");
+            const auto writePageCommand = propertyValue(prefix + "_cmd2");
+            const auto readCommand = propertyValue(prefix + "_cmd3");
+            const auto blockSize = propertyValue(prefix + "_blocksize");
+
+            if (
+                !mode.has_value()
+                || !delay.has_value()
+                || !loadPageCommand.has_value()
+                || !writePageCommand.has_value()
+                || !readCommand.has_value()
+                || !blockSize.has_value()
+                || *blockSize == 0
+            ) {
+                return std::optional<IspMemoryProgrammingParameters>();
+            }
+
+            return std::optional(IspMemoryProgrammingParameters{
+                .mode = static_cast<std::uint8_t>(*mode),
+                .delay = static_cast<std::uint8_t>(*delay),
+                .loadPageCommand = static_cast<std::uint8_t>(*loadPageCommand),
+                .writePageCommand = static_cast<std::uint8_t>(*writePageCommand),
+                .readCommand = static_cast<std::uint8_t>(*readCommand),
+                .pollValue1 = static_cast<std::uint8_t>(propertyValue(prefix + "_pollval1").value_or(0)),
+                .pollValue2 = static_cast<std::uint8_t>(propertyValue(prefix + "_pollval2").value_or(0)),
+                .blockSize = *blockSize,
+            });
+        };
+
+        if (const auto chipEraseDelay = propertyValue("ispchiperase_erasedelay")) {
+            output.chipEraseDelay = static_cast<std::uint8_t>(*chipEraseDelay);
+        }
+
+        if (const auto chipErasePollMethod = propertyValue("ispchiperase_pollmethod")) {
+            output.chipErasePollMethod = static_cast<std::uint8_t>(*chipErasePollMethod);
+        }
+
+        output.programMemoryProgramming = memoryProgrammingParameters("ispprogramflash");
+        output.eepromProgramming = memoryProgrammingParameters("ispprogrameeprom");
+        output.programMemoryReadBlockSize = propertyValue("ispreadflash_blocksize").value_or(256);
+        output.eepromReadBlockSize = propertyValue("ispreadeeprom_blocksize").value_or(256);
+
         return output;
     }
 
@@ -402,6 +469,10 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
         return this->getFuseBitsDescriptorByName("jtagen");
     }
 
+    std::optional<FuseBitsDescriptor> TargetDescriptionFile::getEesaveFuseBitsDescriptor() const {
+        return this->getFuseBitsDescriptorByName("eesave");
+    }
+
     void TargetDescriptionFile::loadSupportedPhysicalInterfaces() {
         auto interfaceNamesToInterfaces = std::map<std::string, PhysicalInterface>({
            {"updi", PhysicalInterface::UPDI},
@@ -419,7 +490,7 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
         }
     }
 
-    void TargetDescriptionFile::loadPadDescriptors() {
+    void TargetDescriptionFile::loadPadDescriptors() const {
         const auto& modules = this->getModulesMappedByName();
 
         const auto portModuleIt = modules.find("port");
@@ -536,10 +607,11 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
         }
     }
 
-    void TargetDescriptionFile::loadTargetVariants() {
-        auto tdVariants = this->getVariants();
-        auto tdPinoutsByName = this->getPinoutsMappedByName();
+    void TargetDescriptionFile::loadTargetVariants() const {
+        const auto& tdVariants = this->getVariants();
+        const auto& tdPinoutsByName = this->getPinoutsMappedByName();
         const auto& modules = this->getModulesMappedByName();
+        const auto& padDescriptorsByName = this->getPadDescriptorsMappedByName();
 
         for (const auto& tdVariant : tdVariants) {
             if (tdVariant.disabled) {
@@ -595,8 +667,8 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
                     targetPin.type = TargetPinType::GND;
                 }
 
-                const auto padIt = this->padDescriptorsByName.find(targetPin.padName);
-                if (padIt != this->padDescriptorsByName.end()) {
+                const auto padIt = padDescriptorsByName.find(targetPin.padName);
+                if (padIt != padDescriptorsByName.end()) {
                     const auto& pad = padIt->second;
                     if (pad.gpioPortAddress.has_value() && pad.gpioDdrAddress.has_value()) {
                         targetPin.type = TargetPinType::GPIO;
@@ -1,10 +1,16 @@
 #pragma once
 
 #include <set>
+#include <map>
+#include <string>
+#include <memory>
 #include <optional>
+#include <mutex>
 
 #include "src/Targets/TargetDescription/TargetDescriptionFile.hpp"
 
+#include "src/Helpers/SyncSafe.hpp"
+
 #include "src/Targets/TargetVariant.hpp"
 #include "src/Targets/TargetRegister.hpp"
 
@@ -22,11 +28,11 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
     /**
      * Represents an AVR8 TDF. See the Targets::TargetDescription::TargetDescriptionFile close for more on TDFs.
      *
-     * During the build process, we generate a JSON file containing a mapping of AVR8 target signatures to target
-     * description file paths. Bloom uses this mapping to find a particular target description file, for AVR8 targets,
-     * given a target signature. See directory "build/resources/TargetDescriptionFiles".
-     * The generation of the JSON mapping, is done by a PHP script:
-     * "build/scripts/CopyAvrPartFilesAndCreateMapping.php". This script is invoked via a custom command, at build time.
+     * During the build process, we generate an index of AVR8 target signatures to target description file paths,
+     * which is compiled into Bloom's binary. Bloom uses this index to find a particular target description file, for
+     * AVR8 targets, given a target signature. See TargetDescriptionIndex.
+     * The generation of the index is done by a PHP script: "build/scripts/Avr8TargetDescriptionFiles.php". This script
+     * is invoked via a custom command, at build time.
      *
      * For more information of TDFs, see src/Targets/TargetDescription/README.md
      */
@@ -34,7 +40,7 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
     {
     public:
         /**
-         * Will resolve the target description file using the target description JSON mapping and a given target signature.
+         * Will resolve the target description file using the target description index and a given target signature.
          *
          * @param targetSignatureHex
          * @param targetName
@@ -42,19 +48,45 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
         TargetDescriptionFile(const TargetSignature& targetSignature, std::optional<std::string> targetName);
 
         /**
-         * Extends TDF initialisation to include the loading of physical interfaces for debugging AVR8 targets, among
-         * other things.
+         * Loads the TDF at the given path, bypassing the target description index. Used by tooling that operates on
+         * the whole TDF catalogue (see benchmarks/TargetDescriptionFiles/main.cpp).
+         *
+         * @param xmlFilePath
          *
-         * @param xml
+         * @param loadBinaryForm
+         *  If true, the binary form of the TDF will be loaded, if it exists and is valid (otherwise, we fall back to
+         *  the XML). If false, the XML will be parsed, regardless of whether a binary form exists.
          */
-        void init(const QDomDocument& xml) override;
+        TargetDescriptionFile(const QString& xmlFilePath, bool loadBinaryForm);
 
         /**
-         * Loads the AVR8 target description JSON mapping file.
+         * Returns a shared, read-only instance of the target description file for the given target signature and
+         * name.
+         *
+         * Parsing a TDF is expensive. Parsed TDFs are retained for the lifetime of the process, and shared between
+         * all targets that make use of them. This means the TDF (and the JSON mapping) will only be parsed once per
+         * process, as opposed to every time the TargetController acquires the hardware (which happens upon every
+         * resume from a suspended state).
+         *
+         * This function is thread-safe.
+         *
+         * @param targetSignature
+         * @param targetName
          *
          * @return
          */
-        static QJsonObject getTargetDescriptionMapping();
+        static std::shared_ptr<const TargetDescriptionFile> getShared(
+            const TargetSignature& targetSignature,
+            std::optional<std::string> targetName
+        );
+
+        /**
+         * Extends TDF initialisation to include the loading of physical interfaces for debugging AVR8 targets, among
+         * other things.
+         *
+         * This is called regardless of whether the TDF was loaded from its XML or binary form.
+         */
+        void postInit() override;
 
         /**
          * Extracts the AVR8 target signature from the TDF.
@@ -120,6 +152,15 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
          */
         [[nodiscard]] std::optional<FuseBitsDescriptor> getJtagenFuseBitsDescriptor() const;
 
+        /**
+         * Constructs a FuseBitDescriptor for the EEPROM save (EESAVE) fuse bit, with information extracted from
+         * the TDF.
+         *
+         * @return
+         *  std::nullopt if the EESAVE bit field could not be found in the TDF.
+         */
+        [[nodiscard]] std::optional<FuseBitsDescriptor> getEesaveFuseBitsDescriptor() const;
+
         /**
          * Returns a set of all supported physical interfaces for debugging.
          *
@@ -132,20 +173,21 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
         /**
          * Returns a mapping of all pad descriptors extracted from TDF, mapped by name.
          *
+         * Pad descriptors are only needed for GPIO pin inspection, so they're loaded upon the first call to this
+         * function.
+         *
          * @return
          */
-        [[nodiscard]] const auto& getPadDescriptorsMappedByName() const {
-            return this->padDescriptorsByName;
-        }
+        [[nodiscard]] const std::map<std::string, PadDescriptor>& getPadDescriptorsMappedByName() const;
 
         /**
          * Returns a mapping of all target variants extracted from the TDF, mapped by ID.
          *
+         * Like pad descriptors, target variants are loaded upon the first call to this function.
+         *
          * @return
          */
-        [[nodiscard]] const auto& getVariantsMappedById() const {
-            return this->targetVariantsById;
-        }
+        [[nodiscard]] const std::map<int, TargetVariant>& getVariantsMappedById() const;
 
         /**
          * Returns a mapping of all target register descriptors extracted from the TDF, by type.
@@ -157,6 +199,15 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
         }
 
     private:
+        /**
+         * Previously parsed TDFs, mapped by target signature (in hex form) and target name (if provided).
+         *
+         * See TargetDescriptionFile::getShared().
+         */
+        static inline SyncSafe<
+            std::map<std::string, std::shared_ptr<const TargetDescriptionFile>>
+        > sharedDescriptionFilesByKey;
+
         /**`
          * AVR8 target description files include the target family name. This method returns a mapping of part
          * description family name strings to Family enum values.
@@ -183,8 +234,14 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
 
         std::set<PhysicalInterface> supportedPhysicalInterfaces;
 
-        std::map<std::string, PadDescriptor> padDescriptorsByName;
-        std::map<int, TargetVariant> targetVariantsById;
+        /*
+         * The pad descriptors and target variants are loaded lazily - see getPadDescriptorsMappedByName() and
+         * getVariantsMappedById().
+         */
+        mutable std::map<std::string, PadDescriptor> padDescriptorsByName;
+        mutable std::once_flag padDescriptorsLoadedFlag;
+        mutable std::map<int, TargetVariant> targetVariantsById;
+        mutable std::once_flag targetVariantsLoadedFlag;
 
         std::map<TargetRegisterType, TargetRegisterDescriptors> targetRegisterDescriptorsByType;
 
@@ -196,12 +253,12 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
         /**
          * Generates a collection of PadDescriptor objects from data in the TDF and populates this->padDescriptorsByName.
          */
-        void loadPadDescriptors();
+        void loadPadDescriptors() const;
 
         /**
          * Loads all variants for the AVR8 target, from the TDF, and populates this->targetVariantsById.
          */
-        void loadTargetVariants();
+        void loadTargetVariants() const;
 
         /**
          * Loads all register descriptors from the TDF, and populates this->targetRegisterDescriptorsByType.
@@ -0,0 +1,47 @@
+#include "TargetDescriptionIndex.hpp"
+
+#include <algorithm>
+
+// Generated at build time, in the build directory - see build/scripts/Avr8TargetDescriptionFiles.php
+#include "Avr8TargetDescriptionIndex.hpp"
+
+namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
+{
+    using Generated::TARGET_DESCRIPTION_INDEX_ENTRIES;
+
+    static_assert(
+        std::ranges::is_sorted(TARGET_DESCRIPTION_INDEX_ENTRIES, {}, &TargetDescriptionIndexEntry::signature),
+        "AVR8 TDF index entries must be sorted by signature"
+    );
+
+    std::span<const TargetDescriptionIndexEntry> TargetDescriptionIndex::getEntries() {
+        return TARGET_DESCRIPTION_INDEX_ENTRIES;
+    }
+
+    std::span<const TargetDescriptionIndexEntry> TargetDescriptionIndex::getEntriesBySignature(
+        const TargetSignature& signature
+    ) {
+        const auto signatureValue = static_cast<std::uint32_t>(
+            signature.byteZero << 16 | signature.byteOne << 8 | signature.byteTwo
+        );
+
+        const auto entries = std::ranges::equal_range(
+            TARGET_DESCRIPTION_INDEX_ENTRIES,
+            signatureValue,
+            {},
+            &TargetDescriptionIndexEntry::signature
+        );
+
+        return std::span(entries.begin(), entries.end());
+    }
+
+    std::vector<std::string> TargetDescriptionIndex::getTargetNamesBySignature(const TargetSignature& signature) {
+        auto targetNames = std::vector<std::string>();
+
+        for (const auto& entry : TargetDescriptionIndex::getEntriesBySignature(signature)) {
+            targetNames.emplace_back(entry.targetName);
+        }
+
+        return targetNames;
+    }
+}
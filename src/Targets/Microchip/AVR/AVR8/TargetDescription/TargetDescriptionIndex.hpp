@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <span>
+#include <vector>
+
+#include "src/Targets/Microchip/AVR/TargetSignature.hpp"
+
+namespace Bloom::Targets::Microchip::Avr::Avr8Bit::TargetDescription
+{
+    struct TargetDescriptionIndexEntry
+    {
+        /**
+         * The AVR8 target signature, in the form of 0xAABBCC (see TargetSignature).
+         */
+        std::uint32_t signature;
+
+        /**
+         * The lowercase target name - the name used in project configuration files.
+         */
+        std::string_view targetName;
+
+        /**
+         * Path to the target's TDF, relative to Bloom's executable path.
+         */
+        std::string_view targetDescriptionFilePath;
+
+        [[nodiscard]] TargetSignature getTargetSignature() const {
+            return TargetSignature(
+                static_cast<unsigned char>(this->signature >> 16),
+                static_cast<unsigned char>(this->signature >> 8),
+                static_cast<unsigned char>(this->signature)
+            );
+        }
+    };
+
+    /**
+     * An index of all AVR8 TDFs distributed with Bloom, sorted by target signature.
+     *
+     * The index is generated at build time, by the "build/scripts/Avr8TargetDescriptionFiles.php" script, and compiled
+     * into Bloom's binary (see generated/Avr8TargetDescriptionIndex.hpp, in the build directory). Resolving a TDF from
+     * a target signature doesn't involve any file I/O.
+     */
+    class TargetDescriptionIndex
+    {
+    public:
+        /**
+         * Returns all entries in the index, sorted by target signature and then by target name.
+         *
+         * @return
+         */
+        static std::span<const TargetDescriptionIndexEntry> getEntries();
+
+        /**
+         * Returns the entries for all targets that carry the given signature. More than one entry will be returned
+         * for ambiguous signatures (signatures shared by multiple targets).
+         *
+         * @param signature
+         *
+         * @return
+         *  An empty span if the signature is unknown.
+         */
+        static std::span<const TargetDescriptionIndexEntry> getEntriesBySignature(const TargetSignature& signature);
+
+        /**
+         * Returns the names of all targets that carry the given signature.
+         *
+         * @param signature
+         *
+         * @return
+         */
+        static std::vector<std::string> getTargetNamesBySignature(const TargetSignature& signature);
+    };
+}
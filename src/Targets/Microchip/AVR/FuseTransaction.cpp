@@ -0,0 +1,79 @@
+#include "FuseTransaction.hpp"
+
+#include <string>
+
+#include "src/Logger/Logger.hpp"
+#include "src/Services/StringService.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::Targets::Microchip::Avr
+{
+    using Services::StringService;
+
+    FuseTransaction::FuseTransaction(FuseByteReader reader, FuseByteWriter writer)
+        : reader(std::move(reader))
+        , writer(std::move(writer))
+    {}
+
+    bool FuseTransaction::isProgrammed(const FuseBitsDescriptor& fuseBitsDescriptor) {
+        /*
+         * For AVR fuses, a set bit (0b1) means the fuse is unprogrammed (cleared), and a cleared bit (0b0) means the
+         * fuse is programmed (set).
+         */
+        return (this->getFuseByte(fuseBitsDescriptor).stagedValue & fuseBitsDescriptor.bitMask) == 0;
+    }
+
+    void FuseTransaction::setProgrammed(const FuseBitsDescriptor& fuseBitsDescriptor, bool programmed) {
+        auto& fuseByte = this->getFuseByte(fuseBitsDescriptor);
+
+        fuseByte.stagedValue = programmed
+            ? static_cast<std::uint8_t>(fuseByte.stagedValue & ~(fuseBitsDescriptor.bitMask))
+            : static_cast<std::uint8_t>(fuseByte.stagedValue | fuseBitsDescriptor.bitMask);
+    }
+
+    std::size_t FuseTransaction::commit() {
+        auto bytesWritten = std::size_t(0);
+
+        for (auto& [byteAddress, fuseByte] : this->fuseBytesByAddress) {
+            if (fuseByte.stagedValue == fuseByte.targetValue) {
+                continue;
+            }
+
+            Logger::debug(
+                "Writing fuse byte at address " + std::to_string(byteAddress) + " (0x"
+                    + StringService::toHex(fuseByte.targetValue) + " -> 0x"
+                    + StringService::toHex(fuseByte.stagedValue) + ")"
+            );
+            this->writer(fuseByte.descriptor, fuseByte.stagedValue);
+
+            const auto postWriteValue = this->reader(fuseByte.descriptor);
+            if (postWriteValue != fuseByte.stagedValue) {
+                throw Exceptions::Exception(
+                    "Post-write verification of fuse byte at address " + std::to_string(byteAddress) + " failed - "
+                        "expected 0x" + StringService::toHex(fuseByte.stagedValue) + ", got 0x"
+                        + StringService::toHex(postWriteValue)
+                );
+            }
+
+            fuseByte.targetValue = postWriteValue;
+            ++bytesWritten;
+        }
+
+        return bytesWritten;
+    }
+
+    FuseTransaction::FuseByte& FuseTransaction::getFuseByte(const FuseBitsDescriptor& fuseBitsDescriptor) {
+        auto fuseByteIt = this->fuseBytesByAddress.find(fuseBitsDescriptor.byteAddress);
+
+        if (fuseByteIt == this->fuseBytesByAddress.end()) {
+            const auto value = this->reader(fuseBitsDescriptor);
+            fuseByteIt = this->fuseBytesByAddress.emplace(
+                fuseBitsDescriptor.byteAddress,
+                FuseByte{fuseBitsDescriptor, value, value}
+            ).first;
+        }
+
+        return fuseByteIt->second;
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+
+#include "Fuse.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::Targets::Microchip::Avr
+{
+    /**
+     * A fuse transaction groups the reading, modification and verification of fuse bits, within a single
+     * programming session.
+     *
+     * Each fuse byte is read from the target at most once (upon the first inspection of any of its bits), and all
+     * modifications are staged against the read values. Upon commit, only the fuse bytes whose staged value differs
+     * from the value on the target are written, and each written byte is verified.
+     *
+     * The transaction doesn't manage the programming session itself - the caller must ensure that the target is in
+     * programming mode (via the ISP interface or otherwise) for the lifetime of the transaction.
+     */
+    class FuseTransaction
+    {
+    public:
+        /**
+         * Reads the fuse byte in which the given fuse bits reside.
+         */
+        using FuseByteReader = std::function<std::uint8_t(const FuseBitsDescriptor&)>;
+
+        /**
+         * Writes the given value to the fuse byte in which the given fuse bits reside.
+         */
+        using FuseByteWriter = std::function<void(const FuseBitsDescriptor&, std::uint8_t)>;
+
+        FuseTransaction(FuseByteReader reader, FuseByteWriter writer);
+
+        /**
+         * Checks if the given fuse bits are programmed (cleared), reading the fuse byte from the target if it hasn't
+         * been read already.
+         *
+         * If the fuse bits have a staged modification, the staged value is reported.
+         *
+         * @param fuseBitsDescriptor
+         *
+         * @return
+         */
+        bool isProgrammed(const FuseBitsDescriptor& fuseBitsDescriptor);
+
+        /**
+         * Stages the programming (clearing) or unprogramming (setting) of the given fuse bits. Nothing is written to
+         * the target until the transaction is committed.
+         *
+         * @param fuseBitsDescriptor
+         * @param programmed
+         */
+        void setProgrammed(const FuseBitsDescriptor& fuseBitsDescriptor, bool programmed);
+
+        /**
+         * Writes all modified fuse bytes to the target and verifies them. Fuse bytes whose staged value matches the
+         * value on the target are not written.
+         *
+         * @throws Exception
+         *  If the post-write verification of any fuse byte fails.
+         *
+         * @return
+         *  The number of fuse bytes written.
+         */
+        std::size_t commit();
+
+    private:
+        struct FuseByte
+        {
+            FuseBitsDescriptor descriptor;
+            std::uint8_t targetValue = 0;
+            std::uint8_t stagedValue = 0;
+        };
+
+        FuseByteReader reader;
+        FuseByteWriter writer;
+
+        std::map<TargetMemoryAddress, FuseByte> fuseBytesByAddress;
+
+        FuseByte& getFuseByte(const FuseBitsDescriptor& fuseBitsDescriptor);
+    };
+}
@@ -1,9 +1,31 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 
 namespace Bloom::Targets::Microchip::Avr
 {
+    /**
+     * Parameters for programming a particular memory (program memory or EEPROM) via the ISP interface. These map
+     * directly to the fields of the ISP program memory commands (see the "AVR ISP Protocol" section in the
+     * DS50002630A document, and Atmel's AVR068 application note).
+     */
+    struct IspMemoryProgrammingParameters
+    {
+        std::uint8_t mode;
+        std::uint8_t delay;
+        std::uint8_t loadPageCommand;
+        std::uint8_t writePageCommand;
+        std::uint8_t readCommand;
+        std::uint8_t pollValue1;
+        std::uint8_t pollValue2;
+
+        /**
+         * The number of bytes to write in a single command - the page size, for paged memories.
+         */
+        std::uint16_t blockSize;
+    };
+
     /**
      * These parameters are required by the ISP interface. They can be extracted from the target's TDF.
      */
@@ -22,5 +44,18 @@ namespace Bloom::Targets::Microchip::Avr
         std::uint8_t readSignaturePollIndex;
         std::uint8_t readFusePollIndex;
         std::uint8_t readLockPollIndex;
+
+        /**
+         * The parameters below are only required for programming memories via the ISP interface. Not all TDFs
+         * provide them.
+         */
+        std::optional<std::uint8_t> chipEraseDelay;
+        std::optional<std::uint8_t> chipErasePollMethod;
+
+        std::optional<IspMemoryProgrammingParameters> programMemoryProgramming;
+        std::optional<IspMemoryProgrammingParameters> eepromProgramming;
+
+        std::uint16_t programMemoryReadBlockSize = 256;
+        std::uint16_t eepromReadBlockSize = 256;
     };
 }
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+#include <cassert>
+#include <QMetaType>
+
+#include "TargetMemory.hpp"
+
+namespace Bloom::Targets
+{
+    /**
+     * An immutable, reference-counted TargetMemoryBuffer.
+     *
+     * Copying a SharedTargetMemoryBuffer only copies a reference to the underlying buffer - the data itself is never
+     * copied. This allows a single read of target memory to be passed across threads (in queued Qt signals, for
+     * example) and held by any number of consumers, without duplicating the data.
+     *
+     * Constructing a SharedTargetMemoryBuffer from a TargetMemoryBuffer rvalue takes ownership of its storage, so
+     * the data that was read by the TargetController is the data that's shared.
+     *
+     * Because the data cannot be modified, it can be read from any thread, without synchronisation.
+     */
+    class SharedTargetMemoryBuffer
+    {
+    public:
+        SharedTargetMemoryBuffer() = default;
+
+        explicit SharedTargetMemoryBuffer(TargetMemoryBuffer&& buffer)
+            : buffer(std::make_shared<const TargetMemoryBuffer>(std::move(buffer)))
+        {}
+
+        [[nodiscard]] std::size_t size() const {
+            return this->buffer ? this->buffer->size() : 0;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return this->size() == 0;
+        }
+
+        [[nodiscard]] const unsigned char* data() const {
+            return this->buffer ? this->buffer->data() : nullptr;
+        }
+
+        [[nodiscard]] const unsigned char* begin() const {
+            return this->data();
+        }
+
+        [[nodiscard]] const unsigned char* end() const {
+            return this->data() + this->size();
+        }
+
+        unsigned char operator [] (std::size_t index) const {
+            assert(index < this->size());
+            return (*(this->buffer))[index];
+        }
+
+        [[nodiscard]] std::span<const unsigned char> span() const {
+            return std::span<const unsigned char>(this->data(), this->size());
+        }
+
+        [[nodiscard]] std::span<const unsigned char> subspan(std::size_t offset, std::size_t size) const {
+            assert(offset + size <= this->size());
+            return this->span().subspan(offset, size);
+        }
+
+        /**
+         * Returns a pointer to the byte at the given offset, which keeps the whole buffer alive for as long as it (or
+         * any copy of it) exists.
+         *
+         * This allows other containers to hold portions of the buffer, without copying them (see SharedMemoryBuffer).
+         *
+         * @param offset
+         *
+         * @return
+         */
+        [[nodiscard]] std::shared_ptr<const unsigned char> share(std::size_t offset) const {
+            assert(offset < this->size());
+            return std::shared_ptr<const unsigned char>(this->buffer, this->buffer->data() + offset);
+        }
+
+        /**
+         * Copies the data to a new TargetMemoryBuffer.
+         *
+         * @return
+         */
+        [[nodiscard]] TargetMemoryBuffer toBuffer() const {
+            return TargetMemoryBuffer(this->begin(), this->end());
+        }
+
+    private:
+        std::shared_ptr<const TargetMemoryBuffer> buffer;
+    };
+}
+
+Q_DECLARE_METATYPE(Bloom::Targets::SharedTargetMemoryBuffer)
@@ -173,10 +173,23 @@ namespace Bloom::Targets
          * The TargetController will cache this upon the first request. Subsequent requests will be serviced with the
          * cached value.
          *
+         * The TargetDescriptor::variants member should be left empty - target variants are only needed for GPIO pin
+         * inspection, and are obtained separately, via Target::getVariants().
+         *
          * @return
          */
         virtual TargetDescriptor getDescriptor() = 0;
 
+        /**
+         * Should return all variants of the current target.
+         *
+         * This is only called when a component requests the target variants (along with the TargetDescriptor), from
+         * the TargetController. Targets are expected to load the necessary data on demand.
+         *
+         * @return
+         */
+        virtual std::vector<TargetVariant> getVariants() = 0;
+
         /**
          * Should resume execution on the target.
          *
@@ -200,18 +213,73 @@ namespace Bloom::Targets
         virtual void reset() = 0;
 
         /**
-         * Should set a breakpoint on the target, at the given address.
+         * Should set software breakpoints on the target, at the given addresses.
+         *
+         * Setting software breakpoints typically involves rewriting program memory, so implementations should set
+         * all of the given breakpoints in as few operations as possible.
+         *
+         * @param addresses
+         */
+        virtual void setSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) = 0;
+
+        /**
+         * Should remove the software breakpoints at the given addresses.
+         *
+         * @param addresses
+         */
+        virtual void removeSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) = 0;
+
+        /**
+         * Should return the number of hardware breakpoints available on the target.
+         *
+         * @return
+         */
+        virtual std::uint16_t getHardwareBreakpointCount() = 0;
+
+        /**
+         * Should set a hardware breakpoint on the target, at the given address.
+         *
+         * @param index
+         *  The zero-based index of the hardware breakpoint to use. Must be less than getHardwareBreakpointCount().
          *
          * @param address
          */
-        virtual void setBreakpoint(TargetMemoryAddress address) = 0;
+        virtual void setHardwareBreakpoint(std::uint16_t index, TargetMemoryAddress address) = 0;
+
+        /**
+         * Should remove the hardware breakpoint with the given index.
+         *
+         * @param index
+         */
+        virtual void removeHardwareBreakpoint(std::uint16_t index) = 0;
+
+        /**
+         * Should return the number of hardware breakpoints that can be used as data breakpoints (for watchpoints).
+         *
+         * Data breakpoints share comparators with hardware breakpoints - the first getDataBreakpointCount() hardware
+         * breakpoint indices can be used for either, but not both at the same time.
+         *
+         * @return
+         */
+        virtual std::uint16_t getDataBreakpointCount() = 0;
 
         /**
-         * Should remove a breakpoint at the given address.
+         * Should set a data breakpoint on the target, for the given RAM address.
+         *
+         * @param index
+         *  The zero-based index of the hardware breakpoint to use. Must be less than getDataBreakpointCount().
          *
          * @param address
+         * @param type
          */
-        virtual void removeBreakpoint(TargetMemoryAddress address) = 0;
+        virtual void setDataBreakpoint(std::uint16_t index, TargetMemoryAddress address, TargetWatchpointType type) = 0;
+
+        /**
+         * Should remove the data breakpoint with the given index.
+         *
+         * @param index
+         */
+        virtual void removeDataBreakpoint(std::uint16_t index) = 0;
 
         /**
          * Should clear all breakpoints on the target.
@@ -225,7 +293,7 @@ namespace Bloom::Targets
          *
          * @param registers
          */
-        virtual void writeRegisters(TargetRegisters registers) = 0;
+        virtual void writeRegisters(const TargetRegisters& registers) = 0;
 
         /**
          * Should read register values of the registers described by the given descriptors.
@@ -234,7 +302,7 @@ namespace Bloom::Targets
          *
          * @return
          */
-        virtual TargetRegisters readRegisters(TargetRegisterDescriptors descriptors) = 0;
+        virtual TargetRegisters readRegisters(const TargetRegisterDescriptors& descriptors) = 0;
 
         /**
          * Should read memory from the target.
@@ -273,6 +341,24 @@ namespace Bloom::Targets
          */
         virtual void eraseMemory(TargetMemoryType memoryType) = 0;
 
+        /**
+         * Should compute a CRC-32 (see Bloom::Crc32) over the given range of the target's memory.
+         *
+         * Where possible, implementations should avoid transferring the memory contents to the host in their
+         * entirety, at once.
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         */
+        virtual std::uint32_t computeMemoryCrc(
+            TargetMemoryType memoryType,
+            TargetMemoryAddress startAddress,
+            TargetMemorySize bytes
+        ) = 0;
+
         /**
          * Should return the current state of the target.
          *
@@ -338,6 +424,33 @@ namespace Bloom::Targets
          */
         virtual bool programmingModeEnabled() = 0;
 
+        /**
+         * Should return true if individual program memory pages can be rewritten without erasing the entire program
+         * memory first. Otherwise false.
+         *
+         * @return
+         */
+        virtual bool programMemoryPageRewritesSupported() = 0;
+
+        /**
+         * Should return true if whole EEPROM pages can be written in a single operation, in the target's current
+         * mode (debug or programming). Otherwise false, in which case each byte is written individually.
+         *
+         * The TargetController uses this to determine the granularity at which EEPROM fills are applied - see
+         * TargetControllerComponent::handleFillTargetMemory().
+         *
+         * @return
+         */
+        virtual bool eepromPageWritesSupported() = 0;
+
+        /**
+         * Should return true if the target's data memory (RAM) can be read whilst the target is running, without
+         * stopping it. Otherwise false.
+         *
+         * @return
+         */
+        virtual bool runtimeMemoryAccessSupported() = 0;
+
     protected:
         /**
          * Target related configuration provided by the user. This is passed in via the first stage of target
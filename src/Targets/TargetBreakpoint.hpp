@@ -22,4 +22,36 @@ namespace Bloom::Targets
         TargetBreakpoint() = default;
         explicit TargetBreakpoint(TargetMemoryAddress address): address(address) {};
     };
+
+    enum class TargetWatchpointType: std::uint8_t
+    {
+        WRITE,
+        READ,
+        ACCESS,
+    };
+
+    /**
+     * A watchpoint (data breakpoint) halts target execution upon access to any byte within the watched range.
+     */
+    struct TargetWatchpoint
+    {
+        /**
+         * Start (byte) address of the watched range, in RAM.
+         */
+        TargetMemoryAddress address = 0;
+
+        /**
+         * Number of bytes to watch, from the start address.
+         */
+        TargetMemorySize size = 1;
+
+        TargetWatchpointType type = TargetWatchpointType::WRITE;
+
+        TargetWatchpoint() = default;
+        TargetWatchpoint(TargetMemoryAddress address, TargetMemorySize size, TargetWatchpointType type)
+            : address(address)
+            , size(size)
+            , type(type)
+        {};
+    };
 }
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Bloom::Targets::TargetDescription::BinaryFormat
+{
+    /**
+     * The binary TDF format is a compact representation of the data that is extracted from a TDF (see
+     * TargetDescriptionFile), produced at build time, from the XML. It allows us to load a TDF without parsing any
+     * XML.
+     *
+     * A binary TDF consists of a header, followed by a number of flat tables of fixed-size records, followed by a
+     * string pool. Records refer to strings via StringRef (an offset and length into the string pool), and to their
+     * child records via RecordRange (a contiguous range of records in the appropriate table). All values are stored
+     * in the byte order of the machine that produced the file - files produced on a machine with a different byte
+     * order will be rejected (via the magic number) and the XML will be used instead.
+     *
+     * Every record only consists of 32-bit fields, so that all records are naturally aligned when the file is mapped
+     * into memory.
+     *
+     * The format version must be bumped upon any change to the records below.
+     */
+    static constexpr std::uint32_t MAGIC = 0x46445442; // "BTDF", in little-endian byte order
+    static constexpr std::uint32_t VERSION = 1;
+
+    /**
+     * Denotes absent optional values (including optional strings).
+     */
+    static constexpr std::uint32_t NONE = 0xFFFFFFFF;
+
+    struct StringRef
+    {
+        std::uint32_t offset = NONE;
+        std::uint32_t length = 0;
+    };
+
+    struct RecordRange
+    {
+        std::uint32_t first = 0;
+        std::uint32_t count = 0;
+    };
+
+    /**
+     * The byte offset and record count of a table. For the string pool, the count is the size of the pool, in bytes.
+     */
+    struct TableRef
+    {
+        std::uint32_t offset = 0;
+        std::uint32_t count = 0;
+    };
+
+    struct Header
+    {
+        std::uint32_t magic = MAGIC;
+        std::uint32_t version = VERSION;
+        StringRef targetName;
+        StringRef familyName;
+
+        TableRef addressSpaces;
+        TableRef memorySegments;
+        TableRef propertyGroups;
+        TableRef properties;
+        TableRef modules;
+        TableRef peripheralModules;
+        TableRef moduleInstances;
+        TableRef registerGroups;
+        TableRef registers;
+        TableRef bitFields;
+        TableRef signals;
+        TableRef peripheralRegisterGroupMappings;
+        TableRef variants;
+        TableRef pinouts;
+        TableRef pins;
+        TableRef interfaces;
+        TableRef stringPool;
+    };
+
+    struct AddressSpaceRecord
+    {
+        StringRef id;
+        StringRef name;
+        std::uint32_t startAddress = 0;
+        std::uint32_t size = 0;
+        std::uint32_t littleEndian = 1;
+        RecordRange memorySegments;
+    };
+
+    struct MemorySegmentRecord
+    {
+        StringRef name;
+        std::uint32_t type = 0;
+        std::uint32_t startAddress = 0;
+        std::uint32_t size = 0;
+        std::uint32_t pageSize = NONE;
+    };
+
+    struct PropertyGroupRecord
+    {
+        StringRef name;
+        RecordRange properties;
+    };
+
+    struct PropertyRecord
+    {
+        /**
+         * Properties are mapped by their lowercase name, whereas the name itself retains its original case.
+         */
+        StringRef key;
+        StringRef name;
+        StringRef value;
+    };
+
+    /**
+     * Used for both modules and peripheral modules.
+     */
+    struct ModuleRecord
+    {
+        StringRef name;
+        RecordRange registerGroups;
+        RecordRange instances;
+    };
+
+    struct ModuleInstanceRecord
+    {
+        StringRef name;
+        RecordRange registerGroups;
+        RecordRange signals;
+    };
+
+    struct RegisterGroupRecord
+    {
+        StringRef name;
+        StringRef moduleName;
+        StringRef addressSpaceId;
+        std::uint32_t offset = NONE;
+        RecordRange registers;
+    };
+
+    struct RegisterRecord
+    {
+        StringRef name;
+        StringRef caption;
+        StringRef readWriteAccess;
+        std::uint32_t offset = 0;
+        std::uint32_t size = 0;
+        RecordRange bitFields;
+    };
+
+    struct BitFieldRecord
+    {
+        StringRef name;
+        std::uint32_t mask = 0;
+    };
+
+    struct SignalRecord
+    {
+        StringRef padName;
+        StringRef function;
+        StringRef group;
+        std::uint32_t hasIndex = 0;
+        std::int32_t index = 0;
+    };
+
+    /**
+     * See TargetDescriptionFile::peripheralRegisterGroupsMappedByModuleRegisterGroupName
+     */
+    struct PeripheralRegisterGroupMappingRecord
+    {
+        StringRef moduleRegisterGroupName;
+        RecordRange registerGroups;
+    };
+
+    struct VariantRecord
+    {
+        StringRef name;
+        StringRef pinoutName;
+        StringRef package;
+        std::uint32_t disabled = 0;
+    };
+
+    struct PinoutRecord
+    {
+        StringRef name;
+        RecordRange pins;
+    };
+
+    struct PinRecord
+    {
+        StringRef pad;
+        std::int32_t position = 0;
+    };
+
+    struct InterfaceRecord
+    {
+        StringRef name;
+        StringRef type;
+    };
+}
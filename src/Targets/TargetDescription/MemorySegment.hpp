@@ -2,7 +2,7 @@
 
 #include <cstdint>
 #include <optional>
-#include <QDomElement>
+#include <string>
 
 #include "src/Helpers/BiMap.hpp"
 
@@ -2,14 +2,61 @@
 
 #include <QJsonDocument>
 #include <QJsonArray>
+#include <span>
+#include <cstring>
+#include <charconv>
+#include <cctype>
+#include <memory>
 
+#include "BinaryFormat.hpp"
 #include "Exceptions/TargetDescriptionParsingFailureException.hpp"
 #include "src/Logger/Logger.hpp"
 #include "src/Services/PathService.hpp"
+#include "src/Services/StringService.hpp"
 
 namespace Bloom::Targets::TargetDescription
 {
     using namespace Bloom::Exceptions;
+    using Services::StringService;
+
+    namespace
+    {
+        /**
+         * Parses an integer from a TDF attribute value, in the same way that QString::toUInt() (and friends) would:
+         * surrounding whitespace is ignored and, for base 16, a "0x" prefix is permitted.
+         *
+         * @tparam IntegerType
+         *
+         * @param value
+         * @param base
+         *
+         * @return
+         *  std::nullopt if the value is empty, isn't a valid integer, or doesn't fit in IntegerType.
+         */
+        template <typename IntegerType>
+        std::optional<IntegerType> parseInteger(std::string_view value, int base) {
+            while (!value.empty() && std::isspace(static_cast<unsigned char>(value.front()))) {
+                value.remove_prefix(1);
+            }
+
+            while (!value.empty() && std::isspace(static_cast<unsigned char>(value.back()))) {
+                value.remove_suffix(1);
+            }
+
+            if (base == 16 && (value.starts_with("0x") || value.starts_with("0X"))) {
+                value.remove_prefix(2);
+            }
+
+            auto output = IntegerType();
+            const auto result = std::from_chars(value.data(), value.data() + value.size(), output, base);
+
+            if (value.empty() || result.ec != std::errc() || result.ptr != value.data() + value.size()) {
+                return std::nullopt;
+            }
+
+            return output;
+        }
+    }
 
     const std::string& TargetDescriptionFile::getTargetName() const {
         return this->targetName;
@@ -19,7 +66,46 @@ namespace Bloom::Targets::TargetDescription
         return this->familyName;
     }
 
+    void TargetDescriptionFile::compileToBinary(const QString& xmlFilePath) {
+        auto descriptionFile = TargetDescriptionFile();
+        descriptionFile.initFromXml(xmlFilePath);
+        descriptionFile.writeBinary(TargetDescriptionFile::getBinaryFilePath(xmlFilePath));
+    }
+
+    QString TargetDescriptionFile::getBinaryFilePath(const QString& xmlFilePath) {
+        auto binaryFilePath = xmlFilePath;
+
+        if (binaryFilePath.endsWith(".xml", Qt::CaseInsensitive)) {
+            binaryFilePath.chop(4);
+        }
+
+        return binaryFilePath + ".bin";
+    }
+
     void TargetDescriptionFile::init(const QString& xmlFilePath) {
+        const auto binaryFilePath = TargetDescriptionFile::getBinaryFilePath(xmlFilePath);
+
+        if (QFile::exists(binaryFilePath)) {
+            try {
+                this->initFromBinary(binaryFilePath);
+                this->postInit();
+                return;
+
+            } catch (const Exception& exception) {
+                Logger::warning(
+                    "Failed to load binary target description file - " + exception.getMessage()
+                        + " - falling back to XML"
+                );
+
+                // Discard anything that was loaded before the failure
+                TargetDescriptionFile::operator = (TargetDescriptionFile());
+            }
+        }
+
+        this->initFromXml(xmlFilePath);
+    }
+
+    void TargetDescriptionFile::initFromXml(const QString& xmlFilePath) {
         auto file = QFile(xmlFilePath);
         if (!file.exists()) {
             // This can happen if someone has been messing with the Resources directory.
@@ -27,23 +113,29 @@ namespace Bloom::Targets::TargetDescription
         }
 
         file.open(QIODevice::ReadOnly);
-        auto document = QDomDocument();
-        if (!document.setContent(file.readAll())) {
-            throw Exception("Failed to parse target description file - please report this error "
-                "to Bloom developers via " + Services::PathService::homeDomainName() + "/report-issue");
+
+        auto document = std::unique_ptr<XmlDocument>();
+
+        try {
+            document = std::make_unique<XmlDocument>(file.readAll().toStdString());
+
+        } catch (const Exception& exception) {
+            throw Exception("Failed to parse target description file (" + exception.getMessage()
+                + ") - please report this error to Bloom developers via " + Services::PathService::homeDomainName()
+                + "/report-issue");
         }
 
-        this->init(document);
+        this->init(*document);
     }
 
-    void TargetDescriptionFile::init(const QDomDocument& document) {
-        const auto device = document.elementsByTagName("device").item(0).toElement();
+    void TargetDescriptionFile::init(const XmlDocument& document) {
+        const auto device = document.document().firstDescendant("device");
         if (!device.isElement()) {
             throw TargetDescriptionParsingFailureException("Device element not found.");
         }
 
-        this->targetName = device.attributes().namedItem("name").nodeValue().toStdString();
-        this->familyName = device.attributes().namedItem("family").nodeValue().toLower().toStdString();
+        this->targetName = device.attributeOrEmpty("name");
+        this->familyName = StringService::asciiToLower(device.attributeOrEmpty("family"));
 
         this->loadAddressSpaces(document);
         this->loadPropertyGroups(document);
@@ -52,9 +144,551 @@ namespace Bloom::Targets::TargetDescription
         this->loadVariants(document);
         this->loadPinouts(document);
         this->loadInterfaces(document);
+
+        this->postInit();
+    }
+
+    void TargetDescriptionFile::initFromBinary(const QString& binaryFilePath) {
+        using namespace BinaryFormat;
+
+        auto file = QFile(binaryFilePath);
+        if (!file.open(QIODevice::ReadOnly)) {
+            throw Exception("Failed to open binary target description file");
+        }
+
+        const auto fileSize = static_cast<std::uint64_t>(file.size());
+        if (fileSize < sizeof(Header)) {
+            throw Exception("Binary target description file is truncated");
+        }
+
+        // The mapping is released when the file is closed (upon destruction of the QFile object)
+        const auto* fileData = file.map(0, file.size());
+        if (fileData == nullptr) {
+            throw Exception("Failed to map binary target description file into memory");
+        }
+
+        const auto& header = *reinterpret_cast<const Header*>(fileData);
+
+        if (header.magic != MAGIC) {
+            throw Exception("Invalid magic number in binary target description file");
+        }
+
+        if (header.version != VERSION) {
+            throw Exception(
+                "Unsupported binary target description file version (" + std::to_string(header.version) + ")"
+            );
+        }
+
+        /*
+         * The tables are accessed in place - we only check that they lie within the file. The record type is
+         * deduced from the (unused) second argument.
+         */
+        const auto table = [fileData, fileSize] (const TableRef& tableRef, auto record) {
+            using RecordType = decltype(record);
+
+            if (
+                tableRef.offset % alignof(RecordType) != 0
+                || tableRef.offset + static_cast<std::uint64_t>(tableRef.count) * sizeof(RecordType) > fileSize
+            ) {
+                throw Exception("Invalid table in binary target description file");
+            }
+
+            return std::span<const RecordType>(
+                reinterpret_cast<const RecordType*>(fileData + tableRef.offset),
+                tableRef.count
+            );
+        };
+
+        const auto range = [] (auto records, const RecordRange& recordRange) {
+            if (static_cast<std::uint64_t>(recordRange.first) + recordRange.count > records.size()) {
+                throw Exception("Invalid record range in binary target description file");
+            }
+
+            return records.subspan(recordRange.first, recordRange.count);
+        };
+
+        const auto stringPool = table(header.stringPool, char());
+
+        const auto optionalString = [&stringPool] (const StringRef& stringRef) -> std::optional<std::string> {
+            if (stringRef.offset == NONE) {
+                return std::nullopt;
+            }
+
+            if (static_cast<std::uint64_t>(stringRef.offset) + stringRef.length > stringPool.size()) {
+                throw Exception("Invalid string reference in binary target description file");
+            }
+
+            return std::string(stringPool.data() + stringRef.offset, stringRef.length);
+        };
+
+        const auto string = [&optionalString] (const StringRef& stringRef) {
+            auto value = optionalString(stringRef);
+
+            if (!value.has_value()) {
+                throw Exception("Missing string in binary target description file");
+            }
+
+            return std::move(*value);
+        };
+
+        const auto memorySegmentRecords = table(header.memorySegments, MemorySegmentRecord());
+        const auto propertyRecords = table(header.properties, PropertyRecord());
+        const auto moduleInstanceRecords = table(header.moduleInstances, ModuleInstanceRecord());
+        const auto registerGroupRecords = table(header.registerGroups, RegisterGroupRecord());
+        const auto registerRecords = table(header.registers, RegisterRecord());
+        const auto bitFieldRecords = table(header.bitFields, BitFieldRecord());
+        const auto signalRecords = table(header.signals, SignalRecord());
+        const auto pinRecords = table(header.pins, PinRecord());
+
+        const auto loadRegisterGroup = [&] (const RegisterGroupRecord& record) {
+            auto registerGroup = RegisterGroup();
+            registerGroup.name = string(record.name);
+            registerGroup.moduleName = optionalString(record.moduleName);
+            registerGroup.addressSpaceId = optionalString(record.addressSpaceId);
+
+            if (record.offset != NONE) {
+                registerGroup.offset = static_cast<std::uint16_t>(record.offset);
+            }
+
+            for (const auto& registerRecord : range(registerRecords, record.registers)) {
+                auto reg = Register();
+                reg.name = string(registerRecord.name);
+                reg.caption = optionalString(registerRecord.caption);
+                reg.readWriteAccess = optionalString(registerRecord.readWriteAccess);
+                reg.offset = static_cast<std::uint16_t>(registerRecord.offset);
+                reg.size = static_cast<std::uint16_t>(registerRecord.size);
+
+                for (const auto& bitFieldRecord : range(bitFieldRecords, registerRecord.bitFields)) {
+                    auto bitField = BitField();
+                    bitField.name = string(bitFieldRecord.name);
+                    bitField.mask = static_cast<std::uint8_t>(bitFieldRecord.mask);
+
+                    reg.bitFieldsMappedByName.insert(std::pair(bitField.name, bitField));
+                }
+
+                registerGroup.registersMappedByName.insert(std::pair(reg.name, std::move(reg)));
+            }
+
+            return registerGroup;
+        };
+
+        const auto loadModule = [&] (const ModuleRecord& record) {
+            auto module = Module();
+            module.name = string(record.name);
+
+            for (const auto& registerGroupRecord : range(registerGroupRecords, record.registerGroups)) {
+                auto group = loadRegisterGroup(registerGroupRecord);
+                module.registerGroupsMappedByName.insert(std::pair(group.name, std::move(group)));
+            }
+
+            for (const auto& instanceRecord : range(moduleInstanceRecords, record.instances)) {
+                auto instance = ModuleInstance();
+                instance.name = string(instanceRecord.name);
+
+                for (const auto& registerGroupRecord : range(registerGroupRecords, instanceRecord.registerGroups)) {
+                    auto group = loadRegisterGroup(registerGroupRecord);
+                    instance.registerGroupsMappedByName.insert(std::pair(group.name, std::move(group)));
+                }
+
+                for (const auto& signalRecord : range(signalRecords, instanceRecord.signals)) {
+                    auto signal = Signal();
+                    signal.padName = string(signalRecord.padName);
+                    signal.function = string(signalRecord.function);
+                    signal.group = string(signalRecord.group);
+
+                    if (signalRecord.hasIndex != 0) {
+                        signal.index = signalRecord.index;
+                    }
+
+                    instance.instanceSignals.emplace_back(std::move(signal));
+                }
+
+                module.instancesMappedByName.insert(std::pair(instance.name, std::move(instance)));
+            }
+
+            return module;
+        };
+
+        this->targetName = string(header.targetName);
+        this->familyName = string(header.familyName);
+
+        for (const auto& record : table(header.addressSpaces, AddressSpaceRecord())) {
+            auto addressSpace = AddressSpace();
+            addressSpace.id = string(record.id);
+            addressSpace.name = string(record.name);
+            addressSpace.startAddress = record.startAddress;
+            addressSpace.size = record.size;
+            addressSpace.littleEndian = record.littleEndian != 0;
+
+            for (const auto& segmentRecord : range(memorySegmentRecords, record.memorySegments)) {
+                auto segment = MemorySegment();
+                segment.name = string(segmentRecord.name);
+                segment.type = static_cast<MemorySegmentType>(segmentRecord.type);
+                segment.startAddress = segmentRecord.startAddress;
+                segment.size = segmentRecord.size;
+
+                if (segmentRecord.pageSize != NONE) {
+                    segment.pageSize = static_cast<std::uint16_t>(segmentRecord.pageSize);
+                }
+
+                addressSpace.memorySegmentsByTypeAndName[segment.type].insert(std::pair(segment.name, segment));
+            }
+
+            this->addressSpacesMappedById.insert(std::pair(addressSpace.id, std::move(addressSpace)));
+        }
+
+        for (const auto& record : table(header.propertyGroups, PropertyGroupRecord())) {
+            auto propertyGroup = PropertyGroup();
+            propertyGroup.name = string(record.name);
+
+            for (const auto& propertyRecord : range(propertyRecords, record.properties)) {
+                auto property = Property();
+                property.name = string(propertyRecord.name);
+                property.value = QString::fromStdString(string(propertyRecord.value));
+
+                propertyGroup.propertiesMappedByName.insert(std::pair(string(propertyRecord.key), property));
+            }
+
+            this->propertyGroupsMappedByName.insert(std::pair(propertyGroup.name, std::move(propertyGroup)));
+        }
+
+        for (const auto& record : table(header.modules, ModuleRecord())) {
+            auto loadedModule = loadModule(record);
+            this->modulesMappedByName.insert(std::pair(loadedModule.name, std::move(loadedModule)));
+        }
+
+        for (const auto& record : table(header.peripheralModules, ModuleRecord())) {
+            auto loadedModule = loadModule(record);
+            this->peripheralModulesMappedByName.insert(std::pair(loadedModule.name, std::move(loadedModule)));
+        }
+
+        const auto peripheralRegisterGroupMappingRecords = table(
+            header.peripheralRegisterGroupMappings,
+            PeripheralRegisterGroupMappingRecord()
+        );
+
+        for (const auto& record : peripheralRegisterGroupMappingRecords) {
+            auto& registerGroups = this->peripheralRegisterGroupsMappedByModuleRegisterGroupName[
+                string(record.moduleRegisterGroupName)
+            ];
+
+            for (const auto& registerGroupRecord : range(registerGroupRecords, record.registerGroups)) {
+                registerGroups.emplace_back(loadRegisterGroup(registerGroupRecord));
+            }
+        }
+
+        for (const auto& record : table(header.variants, VariantRecord())) {
+            auto variant = Variant();
+            variant.name = string(record.name);
+            variant.pinoutName = string(record.pinoutName);
+            variant.package = string(record.package);
+            variant.disabled = record.disabled != 0;
+
+            this->variants.push_back(std::move(variant));
+        }
+
+        for (const auto& record : table(header.pinouts, PinoutRecord())) {
+            auto pinout = Pinout();
+            pinout.name = string(record.name);
+
+            for (const auto& pinRecord : range(pinRecords, record.pins)) {
+                auto pin = Pin();
+                pin.pad = string(pinRecord.pad);
+                pin.position = pinRecord.position;
+
+                pinout.pins.push_back(std::move(pin));
+            }
+
+            this->pinoutsMappedByName.insert(std::pair(pinout.name, std::move(pinout)));
+        }
+
+        for (const auto& record : table(header.interfaces, InterfaceRecord())) {
+            auto interface = Interface();
+            interface.name = string(record.name);
+            interface.type = optionalString(record.type);
+
+            this->interfacesByName.insert(std::pair(interface.name, std::move(interface)));
+        }
+    }
+
+    void TargetDescriptionFile::writeBinary(const QString& binaryFilePath) const {
+        using namespace BinaryFormat;
+
+        auto stringPool = std::string();
+        auto stringRefsByValue = std::map<std::string, StringRef>();
+
+        // Identical strings (which are plentiful in TDFs) share the same space in the pool
+        const auto string = [&stringPool, &stringRefsByValue] (const std::string& value) {
+            const auto stringRefIt = stringRefsByValue.find(value);
+            if (stringRefIt != stringRefsByValue.end()) {
+                return stringRefIt->second;
+            }
+
+            const auto stringRef = StringRef{
+                static_cast<std::uint32_t>(stringPool.size()),
+                static_cast<std::uint32_t>(value.size())
+            };
+
+            stringPool.append(value);
+            stringRefsByValue.insert(std::pair(value, stringRef));
+            return stringRef;
+        };
+
+        const auto optionalString = [&string] (const std::optional<std::string>& value) {
+            return value.has_value() ? string(*value) : StringRef();
+        };
+
+        auto addressSpaceRecords = std::vector<AddressSpaceRecord>();
+        auto memorySegmentRecords = std::vector<MemorySegmentRecord>();
+        auto propertyGroupRecords = std::vector<PropertyGroupRecord>();
+        auto propertyRecords = std::vector<PropertyRecord>();
+        auto moduleRecords = std::vector<ModuleRecord>();
+        auto peripheralModuleRecords = std::vector<ModuleRecord>();
+        auto moduleInstanceRecords = std::vector<ModuleInstanceRecord>();
+        auto registerGroupRecords = std::vector<RegisterGroupRecord>();
+        auto registerRecords = std::vector<RegisterRecord>();
+        auto bitFieldRecords = std::vector<BitFieldRecord>();
+        auto signalRecords = std::vector<SignalRecord>();
+        auto peripheralRegisterGroupMappingRecords = std::vector<PeripheralRegisterGroupMappingRecord>();
+        auto variantRecords = std::vector<VariantRecord>();
+        auto pinoutRecords = std::vector<PinoutRecord>();
+        auto pinRecords = std::vector<PinRecord>();
+        auto interfaceRecords = std::vector<InterfaceRecord>();
+
+        /*
+         * Child records must be contiguous in their tables, so we append all children of a record before moving on
+         * to the next record. Children always reside in a different table to their parents.
+         */
+        const auto writeRegisterGroup = [&] (const RegisterGroup& registerGroup) {
+            auto record = RegisterGroupRecord();
+            record.name = string(registerGroup.name);
+            record.moduleName = optionalString(registerGroup.moduleName);
+            record.addressSpaceId = optionalString(registerGroup.addressSpaceId);
+            record.offset = registerGroup.offset.has_value() ? *registerGroup.offset : NONE;
+            record.registers.first = static_cast<std::uint32_t>(registerRecords.size());
+
+            for (const auto& [registerName, reg] : registerGroup.registersMappedByName) {
+                auto registerRecord = RegisterRecord();
+                registerRecord.name = string(reg.name);
+                registerRecord.caption = optionalString(reg.caption);
+                registerRecord.readWriteAccess = optionalString(reg.readWriteAccess);
+                registerRecord.offset = reg.offset;
+                registerRecord.size = reg.size;
+                registerRecord.bitFields.first = static_cast<std::uint32_t>(bitFieldRecords.size());
+
+                for (const auto& [bitFieldName, bitField] : reg.bitFieldsMappedByName) {
+                    bitFieldRecords.push_back(BitFieldRecord{string(bitField.name), bitField.mask});
+                }
+
+                registerRecord.bitFields.count = static_cast<std::uint32_t>(
+                    bitFieldRecords.size() - registerRecord.bitFields.first
+                );
+                registerRecords.push_back(registerRecord);
+            }
+
+            record.registers.count = static_cast<std::uint32_t>(registerRecords.size() - record.registers.first);
+            registerGroupRecords.push_back(record);
+        };
+
+        const auto writeRegisterGroups = [&] (const std::map<std::string, RegisterGroup>& registerGroupsMappedByName) {
+            auto recordRange = RecordRange{static_cast<std::uint32_t>(registerGroupRecords.size()), 0};
+
+            for (const auto& [registerGroupName, group] : registerGroupsMappedByName) {
+                writeRegisterGroup(group);
+            }
+
+            recordRange.count = static_cast<std::uint32_t>(registerGroupRecords.size() - recordRange.first);
+            return recordRange;
+        };
+
+        const auto writeModule = [&] (const Module& module) {
+            auto record = ModuleRecord();
+            record.name = string(module.name);
+            record.registerGroups = writeRegisterGroups(module.registerGroupsMappedByName);
+
+            /*
+             * We construct the instance records before appending them, as each instance appends its own register
+             * groups, and those must not be interleaved with the register groups of other instances.
+             */
+            auto instanceRecords = std::vector<ModuleInstanceRecord>();
+
+            for (const auto& [instanceName, instance] : module.instancesMappedByName) {
+                auto instanceRecord = ModuleInstanceRecord();
+                instanceRecord.name = string(instance.name);
+                instanceRecord.registerGroups = writeRegisterGroups(instance.registerGroupsMappedByName);
+                instanceRecord.signals.first = static_cast<std::uint32_t>(signalRecords.size());
+
+                for (const auto& signal : instance.instanceSignals) {
+                    auto signalRecord = SignalRecord();
+                    signalRecord.padName = string(signal.padName);
+                    signalRecord.function = string(signal.function);
+                    signalRecord.group = string(signal.group);
+                    signalRecord.hasIndex = signal.index.has_value() ? 1 : 0;
+                    signalRecord.index = signal.index.value_or(0);
+
+                    signalRecords.push_back(signalRecord);
+                }
+
+                instanceRecord.signals.count = static_cast<std::uint32_t>(
+                    signalRecords.size() - instanceRecord.signals.first
+                );
+                instanceRecords.push_back(instanceRecord);
+            }
+
+            record.instances = RecordRange{
+                static_cast<std::uint32_t>(moduleInstanceRecords.size()),
+                static_cast<std::uint32_t>(instanceRecords.size())
+            };
+            moduleInstanceRecords.insert(moduleInstanceRecords.end(), instanceRecords.begin(), instanceRecords.end());
+
+            return record;
+        };
+
+        for (const auto& [addressSpaceId, addressSpace] : this->addressSpacesMappedById) {
+            auto record = AddressSpaceRecord();
+            record.id = string(addressSpace.id);
+            record.name = string(addressSpace.name);
+            record.startAddress = addressSpace.startAddress;
+            record.size = addressSpace.size;
+            record.littleEndian = addressSpace.littleEndian ? 1 : 0;
+            record.memorySegments.first = static_cast<std::uint32_t>(memorySegmentRecords.size());
+
+            for (const auto& [segmentType, segmentsByName] : addressSpace.memorySegmentsByTypeAndName) {
+                for (const auto& [segmentName, segment] : segmentsByName) {
+                    auto segmentRecord = MemorySegmentRecord();
+                    segmentRecord.name = string(segment.name);
+                    segmentRecord.type = static_cast<std::uint32_t>(segment.type);
+                    segmentRecord.startAddress = segment.startAddress;
+                    segmentRecord.size = segment.size;
+                    segmentRecord.pageSize = segment.pageSize.has_value() ? *segment.pageSize : NONE;
+
+                    memorySegmentRecords.push_back(segmentRecord);
+                }
+            }
+
+            record.memorySegments.count = static_cast<std::uint32_t>(
+                memorySegmentRecords.size() - record.memorySegments.first
+            );
+            addressSpaceRecords.push_back(record);
+        }
+
+        for (const auto& [propertyGroupName, propertyGroup] : this->propertyGroupsMappedByName) {
+            auto record = PropertyGroupRecord();
+            record.name = string(propertyGroup.name);
+            record.properties.first = static_cast<std::uint32_t>(propertyRecords.size());
+
+            for (const auto& [propertyKey, property] : propertyGroup.propertiesMappedByName) {
+                propertyRecords.push_back(PropertyRecord{
+                    string(propertyKey),
+                    string(property.name),
+                    string(property.value.toStdString())
+                });
+            }
+
+            record.properties.count = static_cast<std::uint32_t>(propertyRecords.size() - record.properties.first);
+            propertyGroupRecords.push_back(record);
+        }
+
+        for (const auto& [moduleName, loadedModule] : this->modulesMappedByName) {
+            moduleRecords.push_back(writeModule(loadedModule));
+        }
+
+        for (const auto& [moduleName, loadedModule] : this->peripheralModulesMappedByName) {
+            peripheralModuleRecords.push_back(writeModule(loadedModule));
+        }
+
+        const auto& peripheralRegisterGroupsByName = this->peripheralRegisterGroupsMappedByModuleRegisterGroupName;
+
+        for (const auto& [moduleRegisterGroupName, groups] : peripheralRegisterGroupsByName) {
+            auto record = PeripheralRegisterGroupMappingRecord();
+            record.moduleRegisterGroupName = string(moduleRegisterGroupName);
+            record.registerGroups.first = static_cast<std::uint32_t>(registerGroupRecords.size());
+
+            for (const auto& group : groups) {
+                writeRegisterGroup(group);
+            }
+
+            record.registerGroups.count = static_cast<std::uint32_t>(
+                registerGroupRecords.size() - record.registerGroups.first
+            );
+            peripheralRegisterGroupMappingRecords.push_back(record);
+        }
+
+        for (const auto& variant : this->variants) {
+            variantRecords.push_back(VariantRecord{
+                string(variant.name),
+                string(variant.pinoutName),
+                string(variant.package),
+                variant.disabled ? 1U : 0U
+            });
+        }
+
+        for (const auto& [pinoutName, pinout] : this->pinoutsMappedByName) {
+            auto record = PinoutRecord();
+            record.name = string(pinout.name);
+            record.pins.first = static_cast<std::uint32_t>(pinRecords.size());
+
+            for (const auto& pin : pinout.pins) {
+                pinRecords.push_back(PinRecord{string(pin.pad), pin.position});
+            }
+
+            record.pins.count = static_cast<std::uint32_t>(pinRecords.size() - record.pins.first);
+            pinoutRecords.push_back(record);
+        }
+
+        for (const auto& [interfaceName, interface] : this->interfacesByName) {
+            interfaceRecords.push_back(InterfaceRecord{string(interface.name), optionalString(interface.type)});
+        }
+
+        auto header = Header();
+        header.targetName = string(this->targetName);
+        header.familyName = string(this->familyName);
+
+        auto output = QByteArray(sizeof(Header), '\0');
+
+        const auto appendTable = [&output] (const auto& records) {
+            const auto tableRef = TableRef{
+                static_cast<std::uint32_t>(output.size()),
+                static_cast<std::uint32_t>(records.size())
+            };
+
+            output.append(
+                reinterpret_cast<const char*>(records.data()),
+                static_cast<qsizetype>(records.size() * sizeof(typename std::decay_t<decltype(records)>::value_type))
+            );
+
+            return tableRef;
+        };
+
+        header.addressSpaces = appendTable(addressSpaceRecords);
+        header.memorySegments = appendTable(memorySegmentRecords);
+        header.propertyGroups = appendTable(propertyGroupRecords);
+        header.properties = appendTable(propertyRecords);
+        header.modules = appendTable(moduleRecords);
+        header.peripheralModules = appendTable(peripheralModuleRecords);
+        header.moduleInstances = appendTable(moduleInstanceRecords);
+        header.registerGroups = appendTable(registerGroupRecords);
+        header.registers = appendTable(registerRecords);
+        header.bitFields = appendTable(bitFieldRecords);
+        header.signals = appendTable(signalRecords);
+        header.peripheralRegisterGroupMappings = appendTable(peripheralRegisterGroupMappingRecords);
+        header.variants = appendTable(variantRecords);
+        header.pinouts = appendTable(pinoutRecords);
+        header.pins = appendTable(pinRecords);
+        header.interfaces = appendTable(interfaceRecords);
+
+        // The string pool must be the last table, as it's the only one that isn't a multiple of 4 bytes in size
+        header.stringPool = appendTable(stringPool);
+
+        std::memcpy(output.data(), &header, sizeof(Header));
+
+        auto file = QFile(binaryFilePath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(output) != output.size()) {
+            throw Exception("Failed to write binary target description file - " + binaryFilePath.toStdString());
+        }
     }
 
-    AddressSpace TargetDescriptionFile::generateAddressSpaceFromXml(const QDomElement& xmlElement) {
+    AddressSpace TargetDescriptionFile::generateAddressSpaceFromXml(const XmlDocument::Element& xmlElement) {
         if (
             !xmlElement.hasAttribute("id")
             || !xmlElement.hasAttribute("name")
@@ -65,34 +699,34 @@ namespace Bloom::Targets::TargetDescription
         }
 
         auto addressSpace = AddressSpace();
-        addressSpace.name = xmlElement.attribute("name").toStdString();
-        addressSpace.id = xmlElement.attribute("id").toStdString();
+        addressSpace.name = xmlElement.attributeOrEmpty("name");
+        addressSpace.id = xmlElement.attributeOrEmpty("id");
 
-        bool conversionStatus;
-        addressSpace.startAddress = xmlElement.attribute("start").toUInt(&conversionStatus, 16);
+        const auto startAddress = parseInteger<std::uint32_t>(xmlElement.attributeOrEmpty("start"), 16);
 
-        if (!conversionStatus) {
+        if (!startAddress.has_value()) {
             throw Exception("Failed to convert start address hex value to integer.");
         }
 
-        addressSpace.size = xmlElement.attribute("size").toUInt(&conversionStatus, 16);
+        addressSpace.startAddress = *startAddress;
+
+        const auto size = parseInteger<std::uint32_t>(xmlElement.attributeOrEmpty("size"), 16);
 
-        if (!conversionStatus) {
+        if (!size.has_value()) {
             throw Exception("Failed to convert size hex value to integer.");
         }
 
+        addressSpace.size = *size;
+
         if (xmlElement.hasAttribute("endianness")) {
-            addressSpace.littleEndian = (xmlElement.attribute("endianness").toStdString() == "little");
+            addressSpace.littleEndian = (xmlElement.attributeOrEmpty("endianness") == "little");
         }
 
         // Create memory segment objects and add them to the mapping.
-        auto segmentNodes = xmlElement.elementsByTagName("memory-segment");
         auto& memorySegments = addressSpace.memorySegmentsByTypeAndName;
-        for (int segmentIndex = 0; segmentIndex < segmentNodes.count(); segmentIndex++) {
+        for (const auto& segmentElement : xmlElement.descendants("memory-segment")) {
             try {
-                auto segment = TargetDescriptionFile::generateMemorySegmentFromXml(
-                    segmentNodes.item(segmentIndex).toElement()
-                );
+                auto segment = TargetDescriptionFile::generateMemorySegmentFromXml(segmentElement);
 
                 if (!memorySegments.contains(segment.type)) {
                     memorySegments.insert(
@@ -113,7 +747,7 @@ namespace Bloom::Targets::TargetDescription
         return addressSpace;
     }
 
-    MemorySegment TargetDescriptionFile::generateMemorySegmentFromXml(const QDomElement& xmlElement) {
+    MemorySegment TargetDescriptionFile::generateMemorySegmentFromXml(const XmlDocument::Element& xmlElement) {
         if (
             !xmlElement.hasAttribute("type")
             || !xmlElement.hasAttribute("name")
@@ -124,7 +758,7 @@ namespace Bloom::Targets::TargetDescription
         }
 
         auto segment = MemorySegment();
-        auto typeName = xmlElement.attribute("type").toStdString();
+        auto typeName = xmlElement.attributeOrEmpty("type");
         auto type = MemorySegment::typesMappedByName.valueAt(typeName);
 
         if (!type.has_value()) {
@@ -132,68 +766,72 @@ namespace Bloom::Targets::TargetDescription
         }
 
         segment.type = type.value();
-        segment.name = xmlElement.attribute("name").toLower().toStdString();
+        segment.name = StringService::asciiToLower(xmlElement.attributeOrEmpty("name"));
 
-        bool conversionStatus = false;
-        segment.startAddress = xmlElement.attribute("start").toUInt(&conversionStatus, 16);
+        const auto startAddress = parseInteger<std::uint32_t>(xmlElement.attributeOrEmpty("start"), 16);
 
-        if (!conversionStatus) {
-            // Failed to convert startAddress hex value as string to uint16_t
+        if (!startAddress.has_value()) {
             throw Exception("Invalid start address");
         }
 
-        segment.size = xmlElement.attribute("size").toUInt(&conversionStatus, 16);
+        segment.startAddress = *startAddress;
 
-        if (!conversionStatus) {
-            // Failed to convert size hex value as string to uint16_t
+        const auto size = parseInteger<std::uint32_t>(xmlElement.attributeOrEmpty("size"), 16);
+
+        if (!size.has_value()) {
             throw Exception("Invalid size");
         }
 
+        segment.size = *size;
+
         if (xmlElement.hasAttribute("pagesize")) {
             // The page size can be in single byte hexadecimal form ("0x01"), or it can be in plain integer form!
-            auto pageSize = xmlElement.attribute("pagesize");
-            segment.pageSize = pageSize.toUInt(&conversionStatus, pageSize.contains("0x") ? 16 : 10);
+            const auto pageSizeValue = xmlElement.attributeOrEmpty("pagesize");
+            const auto pageSize = parseInteger<std::uint16_t>(
+                pageSizeValue,
+                pageSizeValue.find("0x") != std::string::npos ? 16 : 10
+            );
 
-            if (!conversionStatus) {
-                // Failed to convert size hex value as string to uint16_t
+            if (!pageSize.has_value()) {
                 throw Exception("Invalid size");
             }
+
+            segment.pageSize = *pageSize;
         }
 
         return segment;
     }
 
-    RegisterGroup TargetDescriptionFile::generateRegisterGroupFromXml(const QDomElement& xmlElement) {
+    RegisterGroup TargetDescriptionFile::generateRegisterGroupFromXml(const XmlDocument::Element& xmlElement) {
         if (!xmlElement.hasAttribute("name")) {
             throw Exception("Missing register group name attribute");
         }
 
         auto registerGroup = RegisterGroup();
-        registerGroup.name = xmlElement.attribute("name").toLower().toStdString();
+        registerGroup.name = StringService::asciiToLower(xmlElement.attributeOrEmpty("name"));
 
         if (registerGroup.name.empty()) {
             throw Exception("Empty register group name");
         }
 
         if (xmlElement.hasAttribute("name-in-module")) {
-            registerGroup.moduleName = xmlElement.attribute("name-in-module").toLower().toStdString();
+            registerGroup.moduleName = StringService::asciiToLower(xmlElement.attributeOrEmpty("name-in-module"));
         }
 
         if (xmlElement.hasAttribute("address-space")) {
-            registerGroup.addressSpaceId = xmlElement.attribute("address-space").toLower().toStdString();
+            registerGroup.addressSpaceId = StringService::asciiToLower(xmlElement.attributeOrEmpty("address-space"));
         }
 
         if (xmlElement.hasAttribute("offset")) {
-            registerGroup.offset = xmlElement.attribute("offset").toInt(nullptr, 16);
+            registerGroup.offset = static_cast<std::uint16_t>(
+                parseInteger<int>(xmlElement.attributeOrEmpty("offset"), 16).value_or(0)
+            );
         }
 
         auto& registers = registerGroup.registersMappedByName;
-        auto registerNodes = xmlElement.elementsByTagName("register");
-        for (int registerIndex = 0; registerIndex < registerNodes.count(); registerIndex++) {
+        for (const auto& registerElement : xmlElement.descendants("register")) {
             try {
-                auto reg = TargetDescriptionFile::generateRegisterFromXml(
-                    registerNodes.item(registerIndex).toElement()
-                );
+                auto reg = TargetDescriptionFile::generateRegisterFromXml(registerElement);
                 registers.insert(std::pair(reg.name, reg));
 
             } catch (const Exception& exception) {
@@ -205,7 +843,7 @@ namespace Bloom::Targets::TargetDescription
         return registerGroup;
     }
 
-    Register TargetDescriptionFile::generateRegisterFromXml(const QDomElement& xmlElement) {
+    Register TargetDescriptionFile::generateRegisterFromXml(const XmlDocument::Element& xmlElement) {
         if (
             !xmlElement.hasAttribute("name")
             || !xmlElement.hasAttribute("offset")
@@ -215,39 +853,38 @@ namespace Bloom::Targets::TargetDescription
         }
 
         auto reg = Register();
-        reg.name = xmlElement.attribute("name").toLower().toStdString();
+        reg.name = StringService::asciiToLower(xmlElement.attributeOrEmpty("name"));
 
         if (reg.name.empty()) {
             throw Exception("Empty register name");
         }
 
         if (xmlElement.hasAttribute("caption")) {
-            reg.caption = xmlElement.attribute("caption").toStdString();
+            reg.caption = xmlElement.attributeOrEmpty("caption");
         }
 
         if (xmlElement.hasAttribute("ocd-rw")) {
-            reg.readWriteAccess = xmlElement.attribute("ocd-rw").toLower().toStdString();
+            reg.readWriteAccess = StringService::asciiToLower(xmlElement.attributeOrEmpty("ocd-rw"));
 
         } else if (xmlElement.hasAttribute("rw")) {
-            reg.readWriteAccess = xmlElement.attribute("rw").toLower().toStdString();
+            reg.readWriteAccess = StringService::asciiToLower(xmlElement.attributeOrEmpty("rw"));
         }
 
-        bool conversionStatus = false;
-        reg.size = xmlElement.attribute("size").toUShort(nullptr, 10);
-        reg.offset = xmlElement.attribute("offset").toUShort(&conversionStatus, 16);
+        reg.size = parseInteger<std::uint16_t>(xmlElement.attributeOrEmpty("size"), 10).value_or(0);
+
+        const auto offset = parseInteger<std::uint16_t>(xmlElement.attributeOrEmpty("offset"), 16);
 
-        if (!conversionStatus) {
+        if (!offset.has_value()) {
             // Failed to convert offset hex value as string to uint16_t
             throw Exception("Invalid register offset");
         }
 
+        reg.offset = *offset;
+
         auto& bitFields = reg.bitFieldsMappedByName;
-        auto bitFieldNodes = xmlElement.elementsByTagName("bitfield");
-        for (int bitFieldIndex = 0; bitFieldIndex < bitFieldNodes.count(); bitFieldIndex++) {
+        for (const auto& bitFieldElement : xmlElement.descendants("bitfield")) {
             try {
-                auto bitField = TargetDescriptionFile::generateBitFieldFromXml(
-                    bitFieldNodes.item(bitFieldIndex).toElement()
-                );
+                auto bitField = TargetDescriptionFile::generateBitFieldFromXml(bitFieldElement);
                 bitFields.insert(std::pair(bitField.name, bitField));
 
             } catch (const Exception& exception) {
@@ -259,23 +896,22 @@ namespace Bloom::Targets::TargetDescription
         return reg;
     }
 
-    BitField TargetDescriptionFile::generateBitFieldFromXml(const QDomElement& xmlElement) {
+    BitField TargetDescriptionFile::generateBitFieldFromXml(const XmlDocument::Element& xmlElement) {
         if (!xmlElement.hasAttribute("name") || !xmlElement.hasAttribute("mask")) {
             throw Exception("Missing bit field name/mask attribute");
         }
 
         auto bitField = BitField();
-        bitField.name = xmlElement.attribute("name").toLower().toStdString();
+        bitField.name = StringService::asciiToLower(xmlElement.attributeOrEmpty("name"));
 
-        auto maskConversion = false;
-        bitField.mask = static_cast<std::uint8_t>(
-            xmlElement.attribute("mask").toUShort(&maskConversion, 16)
-        );
+        const auto mask = parseInteger<std::uint16_t>(xmlElement.attributeOrEmpty("mask"), 16);
 
-        if (!maskConversion) {
+        if (!mask.has_value()) {
             throw Exception("Failed to convert bit field mask to integer (from hex string)");
         }
 
+        bitField.mask = static_cast<std::uint8_t>(*mask);
+
         if (bitField.name.empty()) {
             throw Exception("Empty bit field name");
         }
@@ -283,17 +919,15 @@ namespace Bloom::Targets::TargetDescription
         return bitField;
     }
 
-    void TargetDescriptionFile::loadAddressSpaces(const QDomDocument& document) {
-        const auto deviceElement = document.elementsByTagName("device").item(0).toElement();
-
-        auto addressSpaceNodes = deviceElement.elementsByTagName("address-spaces").item(0).toElement()
-            .elementsByTagName("address-space");
+    void TargetDescriptionFile::loadAddressSpaces(const XmlDocument& document) {
+        const auto deviceElement = document.document().firstDescendant("device");
 
-        for (int addressSpaceIndex = 0; addressSpaceIndex < addressSpaceNodes.count(); addressSpaceIndex++) {
+        for (
+            const auto& addressSpaceElement :
+            deviceElement.firstDescendant("address-spaces").descendants("address-space")
+        ) {
             try {
-                auto addressSpace = TargetDescriptionFile::generateAddressSpaceFromXml(
-                    addressSpaceNodes.item(addressSpaceIndex).toElement()
-                );
+                auto addressSpace = TargetDescriptionFile::generateAddressSpaceFromXml(addressSpaceElement);
                 this->addressSpacesMappedById.insert(std::pair(addressSpace.id, addressSpace));
 
             } catch (const Exception& exception) {
@@ -305,31 +939,23 @@ namespace Bloom::Targets::TargetDescription
         }
     }
 
-    void TargetDescriptionFile::loadPropertyGroups(const QDomDocument& document) {
-        const auto deviceElement = document.elementsByTagName("device").item(0).toElement();
-
-        auto propertyGroupNodes = deviceElement.elementsByTagName("property-groups").item(0).toElement()
-            .elementsByTagName("property-group");
+    void TargetDescriptionFile::loadPropertyGroups(const XmlDocument& document) {
+        const auto deviceElement = document.document().firstDescendant("device");
 
-        for (int propertyGroupIndex = 0; propertyGroupIndex < propertyGroupNodes.count(); propertyGroupIndex++) {
-            auto propertyGroupElement = propertyGroupNodes.item(propertyGroupIndex).toElement();
-            auto propertyGroupName = propertyGroupElement.attributes().namedItem(
-                "name"
-            ).nodeValue().toLower().toStdString();
+        for (
+            const auto& propertyGroupElement :
+            deviceElement.firstDescendant("property-groups").descendants("property-group")
+        ) {
             PropertyGroup propertyGroup;
-            propertyGroup.name = propertyGroupName;
-
-            auto propertyNodes = propertyGroupElement.elementsByTagName("property");
-            for (int propertyIndex = 0; propertyIndex < propertyNodes.count(); propertyIndex++) {
-                auto propertyElement = propertyNodes.item(propertyIndex).toElement();
-                auto propertyName = propertyElement.attributes().namedItem("name").nodeValue();
+            propertyGroup.name = StringService::asciiToLower(propertyGroupElement.attributeOrEmpty("name"));
 
+            for (const auto& propertyElement : propertyGroupElement.descendants("property")) {
                 Property property;
-                property.name = propertyName.toStdString();
-                property.value = propertyElement.attributes().namedItem("value").nodeValue();
+                property.name = propertyElement.attributeOrEmpty("name");
+                property.value = QString::fromStdString(propertyElement.attributeOrEmpty("value"));
 
                 propertyGroup.propertiesMappedByName.insert(
-                    std::pair(propertyName.toLower().toStdString(), property)
+                    std::pair(StringService::asciiToLower(property.name), property)
                 );
             }
 
@@ -337,24 +963,13 @@ namespace Bloom::Targets::TargetDescription
         }
     }
 
-    void TargetDescriptionFile::loadModules(const QDomDocument& document) {
-        const auto deviceElement = document.elementsByTagName("device").item(0).toElement();
-
-        auto moduleNodes = document.elementsByTagName("modules").item(0).toElement()
-            .elementsByTagName("module");
-
-        for (int moduleIndex = 0; moduleIndex < moduleNodes.count(); moduleIndex++) {
-            auto moduleElement = moduleNodes.item(moduleIndex).toElement();
-            auto moduleName = moduleElement.attributes().namedItem("name").nodeValue().toLower().toStdString();
+    void TargetDescriptionFile::loadModules(const XmlDocument& document) {
+        for (const auto& moduleElement : document.document().firstDescendant("modules").descendants("module")) {
             Module module;
-            module.name = moduleName;
-
-            auto registerGroupNodes = moduleElement.elementsByTagName("register-group");
-            for (int registerGroupIndex = 0; registerGroupIndex < registerGroupNodes.count(); registerGroupIndex++) {
-                auto registerGroup = TargetDescriptionFile::generateRegisterGroupFromXml(
-                    registerGroupNodes.item(registerGroupIndex).toElement()
-                );
+            module.name = StringService::asciiToLower(moduleElement.attributeOrEmpty("name"));
 
+            for (const auto& registerGroupElement : moduleElement.descendants("register-group")) {
+                auto registerGroup = TargetDescriptionFile::generateRegisterGroupFromXml(registerGroupElement);
                 module.registerGroupsMappedByName.insert(std::pair(registerGroup.name, registerGroup));
             }
 
@@ -362,23 +977,15 @@ namespace Bloom::Targets::TargetDescription
         }
     }
 
-    void TargetDescriptionFile::loadPeripheralModules(const QDomDocument& document) {
-        const auto deviceElement = document.elementsByTagName("device").item(0).toElement();
-
-        auto moduleNodes = deviceElement.elementsByTagName("peripherals").item(0).toElement()
-            .elementsByTagName("module");
+    void TargetDescriptionFile::loadPeripheralModules(const XmlDocument& document) {
+        const auto deviceElement = document.document().firstDescendant("device");
 
-        for (int moduleIndex = 0; moduleIndex < moduleNodes.count(); moduleIndex++) {
-            auto moduleElement = moduleNodes.item(moduleIndex).toElement();
-            auto moduleName = moduleElement.attributes().namedItem("name").nodeValue().toLower().toStdString();
+        for (const auto& moduleElement : deviceElement.firstDescendant("peripherals").descendants("module")) {
             Module module;
-            module.name = moduleName;
+            module.name = StringService::asciiToLower(moduleElement.attributeOrEmpty("name"));
 
-            auto registerGroupNodes = moduleElement.elementsByTagName("register-group");
-            for (int registerGroupIndex = 0; registerGroupIndex < registerGroupNodes.count(); registerGroupIndex++) {
-                auto registerGroup = TargetDescriptionFile::generateRegisterGroupFromXml(
-                    registerGroupNodes.item(registerGroupIndex).toElement()
-                );
+            for (const auto& registerGroupElement : moduleElement.descendants("register-group")) {
+                auto registerGroup = TargetDescriptionFile::generateRegisterGroupFromXml(registerGroupElement);
 
                 module.registerGroupsMappedByName.insert(std::pair(registerGroup.name, registerGroup));
 
@@ -388,45 +995,25 @@ namespace Bloom::Targets::TargetDescription
                 }
             }
 
-            auto instanceNodes = moduleElement.elementsByTagName("instance");
-            for (int instanceIndex = 0; instanceIndex < instanceNodes.count(); instanceIndex++) {
-                auto instanceXml = instanceNodes.item(instanceIndex).toElement();
+            for (const auto& instanceElement : moduleElement.descendants("instance")) {
                 auto instance = ModuleInstance();
-                instance.name = instanceXml.attribute("name").toLower().toStdString();
-
-                auto registerGroupNodes = instanceXml.elementsByTagName("register-group");
-                for (
-                    int registerGroupIndex = 0;
-                    registerGroupIndex < registerGroupNodes.count();
-                    registerGroupIndex++
-                ) {
-                    auto registerGroup = TargetDescriptionFile::generateRegisterGroupFromXml(
-                        registerGroupNodes.item(registerGroupIndex).toElement()
-                    );
+                instance.name = StringService::asciiToLower(instanceElement.attributeOrEmpty("name"));
 
+                for (const auto& registerGroupElement : instanceElement.descendants("register-group")) {
+                    auto registerGroup = TargetDescriptionFile::generateRegisterGroupFromXml(registerGroupElement);
                     instance.registerGroupsMappedByName.insert(std::pair(registerGroup.name, registerGroup));
                 }
 
-                auto signalNodes = instanceXml.elementsByTagName("signals").item(0).toElement()
-                    .elementsByTagName("signal");
-                for (int signalIndex = 0; signalIndex < signalNodes.count(); signalIndex++) {
-                    auto signalXml = signalNodes.item(signalIndex).toElement();
-                    auto signal = Signal();
-
-                    if (!signalXml.hasAttribute("pad")) {
+                for (const auto& signalElement : instanceElement.firstDescendant("signals").descendants("signal")) {
+                    if (!signalElement.hasAttribute("pad")) {
                         continue;
                     }
 
-                    signal.padName = signalXml.attribute("pad").toLower().toStdString();
-                    signal.function = signalXml.attribute("function").toStdString();
-                    signal.group = signalXml.attribute("group").toStdString();
-                    auto indexAttribute = signalXml.attribute("index");
-                    bool indexValid = false;
-                    auto indexValue = indexAttribute.toInt(&indexValid, 10);
-
-                    if (!indexAttribute.isEmpty() && indexValid) {
-                        signal.index = indexValue;
-                    }
+                    auto signal = Signal();
+                    signal.padName = StringService::asciiToLower(signalElement.attributeOrEmpty("pad"));
+                    signal.function = signalElement.attributeOrEmpty("function");
+                    signal.group = signalElement.attributeOrEmpty("group");
+                    signal.index = parseInteger<int>(signalElement.attributeOrEmpty("index"), 10);
 
                     instance.instanceSignals.emplace_back(signal);
                 }
@@ -438,35 +1025,28 @@ namespace Bloom::Targets::TargetDescription
         }
     }
 
-    void TargetDescriptionFile::loadVariants(const QDomDocument& document) {
-        const auto deviceElement = document.elementsByTagName("device").item(0).toElement();
-
-        auto variantNodes = document.elementsByTagName("variants").item(0).toElement()
-            .elementsByTagName("variant");
-
-        for (int variantIndex = 0; variantIndex < variantNodes.count(); variantIndex++) {
+    void TargetDescriptionFile::loadVariants(const XmlDocument& document) {
+        for (const auto& variantElement : document.document().firstDescendant("variants").descendants("variant")) {
             try {
-                auto variantXml = variantNodes.item(variantIndex).toElement();
-
-                if (!variantXml.hasAttribute("ordercode")) {
+                if (!variantElement.hasAttribute("ordercode")) {
                     throw Exception("Missing ordercode attribute");
                 }
 
-                if (!variantXml.hasAttribute("package")) {
+                if (!variantElement.hasAttribute("package")) {
                     throw Exception("Missing package attribute");
                 }
 
-                if (!variantXml.hasAttribute("pinout")) {
+                if (!variantElement.hasAttribute("pinout")) {
                     throw Exception("Missing pinout attribute");
                 }
 
                 auto variant = Variant();
-                variant.name = variantXml.attribute("ordercode").toStdString();
-                variant.pinoutName = variantXml.attribute("pinout").toLower().toStdString();
-                variant.package = variantXml.attribute("package").toUpper().toStdString();
+                variant.name = variantElement.attributeOrEmpty("ordercode");
+                variant.pinoutName = StringService::asciiToLower(variantElement.attributeOrEmpty("pinout"));
+                variant.package = StringService::asciiToUpper(variantElement.attributeOrEmpty("package"));
 
-                if (variantXml.hasAttribute("disabled")) {
-                    variant.disabled = (variantXml.attribute("disabled") == "1");
+                if (variantElement.hasAttribute("disabled")) {
+                    variant.disabled = (variantElement.attributeOrEmpty("disabled") == "1");
                 }
 
                 this->variants.push_back(variant);
@@ -479,48 +1059,42 @@ namespace Bloom::Targets::TargetDescription
         }
     }
 
-    void TargetDescriptionFile::loadPinouts(const QDomDocument& document) {
-        const auto deviceElement = document.elementsByTagName("device").item(0).toElement();
-
-        auto pinoutNodes = document.elementsByTagName("pinouts").item(0).toElement()
-            .elementsByTagName("pinout");
-
-        for (int pinoutIndex = 0; pinoutIndex < pinoutNodes.count(); pinoutIndex++) {
+    void TargetDescriptionFile::loadPinouts(const XmlDocument& document) {
+        for (const auto& pinoutElement : document.document().firstDescendant("pinouts").descendants("pinout")) {
             try {
-                auto pinoutXml = pinoutNodes.item(pinoutIndex).toElement();
-
-                if (!pinoutXml.hasAttribute("name")) {
+                if (!pinoutElement.hasAttribute("name")) {
                     throw Exception("Missing name attribute");
                 }
 
                 auto pinout = Pinout();
-                pinout.name = pinoutXml.attribute("name").toLower().toStdString();
+                pinout.name = StringService::asciiToLower(pinoutElement.attributeOrEmpty("name"));
 
-                auto pinNodes = pinoutXml.elementsByTagName("pin");
+                const auto pinElements = pinoutElement.descendants("pin");
 
-                for (int pinIndex = 0; pinIndex < pinNodes.count(); pinIndex++) {
-                    auto pinXml = pinNodes.item(pinIndex).toElement();
+                for (std::size_t pinIndex = 0; pinIndex < pinElements.size(); ++pinIndex) {
+                    const auto& pinElement = pinElements[pinIndex];
 
-                    if (!pinXml.hasAttribute("position")) {
+                    if (!pinElement.hasAttribute("position")) {
                         throw Exception(
                             "Missing position attribute on pin element " + std::to_string(pinIndex)
                         );
                     }
 
-                    if (!pinXml.hasAttribute("pad")) {
+                    if (!pinElement.hasAttribute("pad")) {
                         throw Exception("Missing pad attribute on pin element " + std::to_string(pinIndex));
                     }
 
-                    auto pin = Pin();
-                    bool positionConversionSucceeded = true;
-                    pin.position = pinXml.attribute("position").toInt(&positionConversionSucceeded, 10);
-                    pin.pad = pinXml.attribute("pad").toLower().toStdString();
+                    const auto position = parseInteger<int>(pinElement.attributeOrEmpty("position"), 10);
 
-                    if (!positionConversionSucceeded) {
+                    if (!position.has_value()) {
                         throw Exception("Failed to convert position attribute value to integer on pin element "
                             + std::to_string(pinIndex));
                     }
 
+                    auto pin = Pin();
+                    pin.position = *position;
+                    pin.pad = StringService::asciiToLower(pinElement.attributeOrEmpty("pad"));
+
                     pinout.pins.push_back(pin);
                 }
 
@@ -534,25 +1108,20 @@ namespace Bloom::Targets::TargetDescription
         }
     }
 
-    void TargetDescriptionFile::loadInterfaces(const QDomDocument& document) {
-        const auto deviceElement = document.elementsByTagName("device").item(0).toElement();
-
-        auto interfaceNodes = deviceElement.elementsByTagName("interfaces").item(0).toElement()
-            .elementsByTagName("interface");
+    void TargetDescriptionFile::loadInterfaces(const XmlDocument& document) {
+        const auto deviceElement = document.document().firstDescendant("device");
 
-        for (int interfaceIndex = 0; interfaceIndex < interfaceNodes.count(); interfaceIndex++) {
+        for (const auto& interfaceElement : deviceElement.firstDescendant("interfaces").descendants("interface")) {
             try {
-                auto interfaceXml = interfaceNodes.item(interfaceIndex).toElement();
-
-                if (!interfaceXml.hasAttribute("name")) {
+                if (!interfaceElement.hasAttribute("name")) {
                     throw Exception("Missing name attribute");
                 }
 
                 auto interface = Interface();
-                interface.name = interfaceXml.attribute("name").toLower().toStdString();
+                interface.name = StringService::asciiToLower(interfaceElement.attributeOrEmpty("name"));
 
-                if (interfaceXml.hasAttribute("type")) {
-                    interface.type = interfaceXml.attribute("type").toStdString();
+                if (interfaceElement.hasAttribute("type")) {
+                    interface.type = interfaceElement.attributeOrEmpty("type");
                 }
 
                 this->interfacesByName.insert(std::pair(interface.name, interface));
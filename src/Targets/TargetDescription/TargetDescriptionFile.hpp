@@ -1,7 +1,7 @@
 #pragma once
 
 #include <QFile>
-#include <QDomDocument>
+#include <QString>
 
 #include "AddressSpace.hpp"
 #include "MemorySegment.hpp"
@@ -12,6 +12,8 @@
 #include "Pinout.hpp"
 #include "Interface.hpp"
 
+#include "src/Helpers/XmlDocument.hpp"
+
 namespace Bloom::Targets::TargetDescription
 {
     /**
@@ -40,6 +42,9 @@ namespace Bloom::Targets::TargetDescription
          * Will construct a TargetDescriptionFile instance from the XML of a target description file, the path to which
          * is given via xmlFilePath.
          *
+         * If a binary form of the TDF exists (see TargetDescriptionFile::compileToBinary()), it will be loaded instead
+         * of the XML.
+         *
          * @param xmlFilePath
          */
         explicit TargetDescriptionFile(const QString& xmlFilePath) {
@@ -51,10 +56,29 @@ namespace Bloom::Targets::TargetDescription
          *
          * @param xml
          */
-        explicit TargetDescriptionFile(const QDomDocument& xml) {
+        explicit TargetDescriptionFile(const XmlDocument& xml) {
             this->init(xml);
         }
 
+        /**
+         * Parses the XML of a target description file and writes the extracted data to a binary TDF file, alongside
+         * the XML (see TargetDescriptionFile::getBinaryFilePath()). The binary TDF can be loaded without parsing any
+         * XML. See BinaryFormat.hpp for the format.
+         *
+         * This is done at build time, for every TDF that is distributed with Bloom.
+         *
+         * @param xmlFilePath
+         */
+        static void compileToBinary(const QString& xmlFilePath);
+
+        /**
+         * Returns the path to the binary form of the TDF at the given XML file path.
+         *
+         * @param xmlFilePath
+         * @return
+         */
+        static QString getBinaryFilePath(const QString& xmlFilePath);
+
         /**
          * Returns the target name extracted from the TDF.
          *
@@ -136,16 +160,53 @@ namespace Bloom::Targets::TargetDescription
         TargetDescriptionFile& operator = (const TargetDescriptionFile& other) = default;
         TargetDescriptionFile& operator = (TargetDescriptionFile&& other) = default;
 
-        virtual void init(const QDomDocument& document);
+        virtual void init(const XmlDocument& document);
+
+        /**
+         * Loads the TDF from its binary form, if one exists and is valid. Otherwise, from the XML.
+         *
+         * @param xmlFilePath
+         */
         void init(const QString& xmlFilePath);
 
+        /**
+         * Called once the TDF data has been loaded, from either the XML or the binary form of the TDF.
+         *
+         * Derived classes can override this to extract any additional information from the loaded data.
+         */
+        virtual void postInit() {}
+
+        /**
+         * Loads the TDF data from the XML file at the given path.
+         *
+         * @param xmlFilePath
+         */
+        void initFromXml(const QString& xmlFilePath);
+
+        /**
+         * Loads the TDF data from the binary TDF file at the given path.
+         *
+         * The file is mapped into memory and its tables are read directly, without any parsing. An exception is
+         * thrown if the file is malformed, or was produced for a different version of the format.
+         *
+         * @param binaryFilePath
+         */
+        void initFromBinary(const QString& binaryFilePath);
+
+        /**
+         * Writes the loaded TDF data to a binary TDF file, at the given path.
+         *
+         * @param binaryFilePath
+         */
+        void writeBinary(const QString& binaryFilePath) const;
+
         /**
          * Constructs an AddressSpace object from an XML element.
          *
          * @param xmlElement
          * @return
          */
-        static AddressSpace generateAddressSpaceFromXml(const QDomElement& xmlElement);
+        static AddressSpace generateAddressSpaceFromXml(const XmlDocument::Element& xmlElement);
 
         /**
          * Constructs a MemorySegment object from an XML element.
@@ -153,7 +214,7 @@ namespace Bloom::Targets::TargetDescription
          * @param xmlElement
          * @return
          */
-        static MemorySegment generateMemorySegmentFromXml(const QDomElement& xmlElement);
+        static MemorySegment generateMemorySegmentFromXml(const XmlDocument::Element& xmlElement);
 
         /**
          * Constructs a RegisterGroup object from an XML element.
@@ -161,7 +222,7 @@ namespace Bloom::Targets::TargetDescription
          * @param xmlElement
          * @return
          */
-        static RegisterGroup generateRegisterGroupFromXml(const QDomElement& xmlElement);
+        static RegisterGroup generateRegisterGroupFromXml(const XmlDocument::Element& xmlElement);
 
         /**
          * Constructs a Register object from an XML element.
@@ -169,7 +230,7 @@ namespace Bloom::Targets::TargetDescription
          * @param xmlElement
          * @return
          */
-        static Register generateRegisterFromXml(const QDomElement& xmlElement);
+        static Register generateRegisterFromXml(const XmlDocument::Element& xmlElement);
 
         /**
          * Consturcts a BitField object from an XML element.
@@ -177,41 +238,41 @@ namespace Bloom::Targets::TargetDescription
          * @param xmlElement
          * @return
          */
-        static BitField generateBitFieldFromXml(const QDomElement& xmlElement);
+        static BitField generateBitFieldFromXml(const XmlDocument::Element& xmlElement);
 
         /**
          * Extracts all address spaces and loads them into this->addressSpacesMappedById.
          */
-        void loadAddressSpaces(const QDomDocument& document);
+        void loadAddressSpaces(const XmlDocument& document);
 
         /**
          * Extracts all property groups and loads them into this->propertyGroupsMappedByName.
          */
-        void loadPropertyGroups(const QDomDocument& document);
+        void loadPropertyGroups(const XmlDocument& document);
 
         /**
          * Extracts all modules and loads them into this->modulesMappedByName.
          */
-        void loadModules(const QDomDocument& document);
+        void loadModules(const XmlDocument& document);
 
         /**
          * Extracts all peripheral modules and loads them into this->peripheralModulesMappedByName.
          */
-        void loadPeripheralModules(const QDomDocument& document);
+        void loadPeripheralModules(const XmlDocument& document);
 
         /**
          * Extracts all variants and loads them into this->variants.
          */
-        void loadVariants(const QDomDocument& document);
+        void loadVariants(const XmlDocument& document);
 
         /**
          * Extracts all pinouts and loads them into this->pinoutsMappedByName.
          */
-        void loadPinouts(const QDomDocument& document);
+        void loadPinouts(const XmlDocument& document);
 
         /**
          * Extracts all interfaces and loads them into this->interfacesByName
          */
-        void loadInterfaces(const QDomDocument& document);
+        void loadInterfaces(const XmlDocument& document);
     };
 }
@@ -19,9 +19,24 @@ namespace Bloom::Targets
         std::string vendorName;
         std::map<TargetMemoryType, TargetMemoryDescriptor> memoryDescriptorsByType;
         std::map<TargetRegisterType, TargetRegisterDescriptors> registerDescriptorsByType;
+
+        /**
+         * Only populated upon request - see TargetControllerService::getTargetDescriptor().
+         */
         std::vector<TargetVariant> variants;
 
         TargetMemoryType programMemoryType;
+
+        /**
+         * Whether individual program memory pages can be rewritten, without erasing the entire program memory. See
+         * Target::programMemoryPageRewritesSupported().
+         */
+        bool programMemoryPageRewritesSupported = false;
+
+        /**
+         * Whether data memory can be read whilst the target is running. See Target::runtimeMemoryAccessSupported().
+         */
+        bool runtimeMemoryAccessSupported = false;
     };
 }
 
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <set>
+#include <algorithm>
+
+#include "TargetMemory.hpp"
+
+namespace Bloom::Targets
+{
+    /**
+     * An interval tree of address ranges, for finding the ranges that intersect with a given range, in
+     * O(log n + k) time (where k is the number of intersecting ranges).
+     *
+     * We use this for the focused and excluded memory regions, which are otherwise scanned linearly for every read,
+     * every diff and every validation pass. Projects can have hundreds of regions, which makes those scans
+     * quadratic.
+     *
+     * The tree is static - it's built once, from a set of ranges, and cannot be modified. It's an implicit binary
+     * search tree, laid over the ranges sorted by start address: the root of any subarray is its middle element, and
+     * each node holds the greatest end address in its subtree. This allows whole subtrees to be skipped, when they
+     * end before the range we're looking for. The ranges may overlap.
+     *
+     * Each range keeps the index it had in the vector it was constructed from, so that callers can map intersecting
+     * ranges back to whatever they're associated with (a memory region, for example).
+     */
+    class TargetMemoryAddressRangeIndex
+    {
+    public:
+        TargetMemoryAddressRangeIndex() = default;
+
+        explicit TargetMemoryAddressRangeIndex(const std::vector<TargetMemoryAddressRange>& addressRanges) {
+            this->nodes.reserve(addressRanges.size());
+
+            for (auto index = std::size_t(0); index < addressRanges.size(); ++index) {
+                this->nodes.emplace_back(addressRanges[index], index);
+            }
+
+            std::sort(
+                this->nodes.begin(),
+                this->nodes.end(),
+                [] (const Node& nodeA, const Node& nodeB) {
+                    return nodeA.addressRange.startAddress < nodeB.addressRange.startAddress;
+                }
+            );
+
+            this->populateMaximumEndAddresses(0, this->nodes.size());
+        }
+
+        /**
+         * Indices follow the order of the set (ascending start address).
+         *
+         * @param addressRanges
+         */
+        explicit TargetMemoryAddressRangeIndex(const std::set<TargetMemoryAddressRange>& addressRanges)
+            : TargetMemoryAddressRangeIndex(
+                std::vector<TargetMemoryAddressRange>(addressRanges.begin(), addressRanges.end())
+            )
+        {}
+
+        [[nodiscard]] bool empty() const {
+            return this->nodes.empty();
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return this->nodes.size();
+        }
+
+        /**
+         * Invokes the callback for each range that intersects with the given range, in ascending order of start
+         * address.
+         *
+         * @param addressRange
+         *
+         * @param callback
+         *  Invoked with the intersecting range and the index it had in the vector that the tree was constructed from.
+         */
+        template <typename CallbackType>
+        void forEachIntersecting(const TargetMemoryAddressRange& addressRange, CallbackType&& callback) const {
+            this->visitIntersecting(0, this->nodes.size(), addressRange, callback);
+        }
+
+        /**
+         * Returns the ranges that intersect with the given range, in ascending order of start address.
+         *
+         * @param addressRange
+         *
+         * @return
+         */
+        [[nodiscard]] std::vector<TargetMemoryAddressRange> intersecting(
+            const TargetMemoryAddressRange& addressRange
+        ) const {
+            auto output = std::vector<TargetMemoryAddressRange>();
+
+            this->forEachIntersecting(
+                addressRange,
+                [&output] (const TargetMemoryAddressRange& intersectingRange, std::size_t) {
+                    output.push_back(intersectingRange);
+                }
+            );
+
+            return output;
+        }
+
+        [[nodiscard]] bool intersects(const TargetMemoryAddressRange& addressRange) const {
+            auto intersects = false;
+
+            this->forEachIntersecting(
+                addressRange,
+                [&intersects] (const TargetMemoryAddressRange&, std::size_t) {
+                    intersects = true;
+                }
+            );
+
+            return intersects;
+        }
+
+    private:
+        struct Node
+        {
+            TargetMemoryAddressRange addressRange;
+            std::size_t index = 0;
+
+            /**
+             * The greatest end address of all ranges in this node's subtree (including this node's range).
+             */
+            TargetMemoryAddress maximumEndAddress = 0;
+
+            Node(const TargetMemoryAddressRange& addressRange, std::size_t index)
+                : addressRange(addressRange)
+                , index(index)
+                , maximumEndAddress(addressRange.endAddress)
+            {}
+        };
+
+        std::vector<Node> nodes;
+
+        /**
+         * Populates the maximumEndAddress of each node in the subtree of nodes [begin, end), and returns the
+         * maximumEndAddress of the subtree's root.
+         *
+         * @param begin
+         * @param end
+         *
+         * @return
+         */
+        TargetMemoryAddress populateMaximumEndAddresses(std::size_t begin, std::size_t end) {
+            if (begin >= end) {
+                return 0;
+            }
+
+            const auto middle = begin + (end - begin) / 2;
+            auto& node = this->nodes[middle];
+
+            node.maximumEndAddress = std::max({
+                node.addressRange.endAddress,
+                this->populateMaximumEndAddresses(begin, middle),
+                this->populateMaximumEndAddresses(middle + 1, end),
+            });
+
+            return node.maximumEndAddress;
+        }
+
+        template <typename CallbackType>
+        void visitIntersecting(
+            std::size_t begin,
+            std::size_t end,
+            const TargetMemoryAddressRange& addressRange,
+            CallbackType& callback
+        ) const {
+            if (begin >= end) {
+                return;
+            }
+
+            const auto middle = begin + (end - begin) / 2;
+            const auto& node = this->nodes[middle];
+
+            if (node.maximumEndAddress < addressRange.startAddress) {
+                // Every range in this subtree ends before the given range
+                return;
+            }
+
+            this->visitIntersecting(begin, middle, addressRange, callback);
+
+            if (node.addressRange.startAddress > addressRange.endAddress) {
+                // This range, and every range in the right subtree, starts after the given range
+                return;
+            }
+
+            if (node.addressRange.endAddress >= addressRange.startAddress) {
+                callback(node.addressRange, node.index);
+            }
+
+            this->visitIntersecting(middle + 1, end, addressRange, callback);
+        }
+    };
+}
@@ -55,6 +55,14 @@ namespace Bloom::Targets
 
         std::optional<IoState> ioState;
         std::optional<IoDirection> ioDirection;
+
+        bool operator == (const TargetPinState& pinState) const {
+            return this->ioState == pinState.ioState && this->ioDirection == pinState.ioDirection;
+        }
+
+        bool operator != (const TargetPinState& pinState) const {
+            return !(*this == pinState);
+        }
     };
 
     using TargetPinStateMapping = std::map<int, Bloom::Targets::TargetPinState>;
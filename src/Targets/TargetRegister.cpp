@@ -3,13 +3,10 @@
 namespace Bloom::Targets
 {
     std::size_t TargetRegisterDescriptor::getHash() const {
-        if (!this->cachedHash.has_value()) {
-            auto stringHasher = std::hash<std::string>();
-
-            this->cachedHash = stringHasher(std::to_string(this->startAddress.value_or(0))
-                + "_" + std::to_string(static_cast<std::uint8_t>(this->type)));
-        }
-
-        return this->cachedHash.value();
+        // Cheap enough to compute upon each use, so there's no need to cache it
+        return std::hash<std::uint64_t>()(
+            (static_cast<std::uint64_t>(this->startAddress.value_or(0)) << 8)
+                | static_cast<std::uint64_t>(this->type)
+        );
     }
 }
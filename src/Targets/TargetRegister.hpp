@@ -7,9 +7,12 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <span>
 
 #include "TargetMemory.hpp"
 
+#include "src/Helpers/InternedString.hpp"
+
 namespace Bloom::Targets
 {
     enum class TargetRegisterType: std::uint8_t
@@ -22,6 +25,13 @@ namespace Bloom::Targets
         OTHER,
     };
 
+    /**
+     * Register descriptors are copied into register sets, register values, events and Insight's widgets, so they're
+     * kept small. The strings (which mostly come from the target description file) are interned - copying a
+     * descriptor copies three pointers, as opposed to three strings.
+     *
+     * A descriptor is identified by its type and start address.
+     */
     struct TargetRegisterDescriptor
     {
     public:
@@ -30,18 +40,18 @@ namespace Bloom::Targets
         TargetRegisterType type = TargetRegisterType::OTHER;
         TargetMemoryType memoryType = TargetMemoryType::OTHER;
 
-        std::optional<std::string> name;
-        std::optional<std::string> groupName;
-        std::optional<std::string> description;
-
         bool readable = false;
         bool writable = false;
 
+        InternedString name;
+        InternedString groupName;
+        InternedString description;
+
         TargetRegisterDescriptor() = default;
         explicit TargetRegisterDescriptor(TargetRegisterType type): type(type) {};
 
         bool operator == (const TargetRegisterDescriptor& other) const {
-            return this->getHash() == other.getHash();
+            return this->type == other.type && this->startAddress.value_or(0) == other.startAddress.value_or(0);
         }
 
         bool operator < (const TargetRegisterDescriptor& other) const {
@@ -50,14 +60,13 @@ namespace Bloom::Targets
             }
 
             /*
-             * If the registers are of different type, there is no meaningful way to sort them, so we just use
-             * the unique hash.
+             * If the registers are of different type, there is no meaningful way to sort them, so we just sort them
+             * by type.
              */
-            return this->getHash() < other.getHash();
+            return this->type < other.type;
         }
 
     private:
-        mutable std::optional<std::size_t> cachedHash;
         std::size_t getHash() const;
 
         friend std::hash<Bloom::Targets::TargetRegisterDescriptor>;
@@ -80,6 +89,13 @@ namespace Bloom::Targets
 
     using TargetRegisters = std::vector<TargetRegister>;
     using TargetRegisterDescriptors = std::set<TargetRegisterDescriptor>;
+
+    /*
+     * Non-owning selections of registers and register descriptors. These allow us to pass a subset of a
+     * TargetRegisters or TargetRegisterDescriptors collection down to the debug tool driver, without copying it.
+     */
+    using TargetRegisterSelection = std::span<const TargetRegister* const>;
+    using TargetRegisterDescriptorSelection = std::span<const TargetRegisterDescriptor* const>;
 }
 
 namespace std